@@ -0,0 +1,632 @@
+//
+//  benchmark.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+//
+// Measures the performance of the lexer, the parser and the parser generator on a fixed set of workloads.
+//
+// Every workload uses the grammars in the Examples directory and synthetic input that is the same on every run, so
+// the results of different builds can be compared. The results can be written to a file and used as the baseline
+// for a later run, which will then report any measurements that have become worse.
+//
+
+#include "TameParse/TameParse.h"
+#include "TameParse/Util/stopwatch.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace util;
+using namespace dfa;
+using namespace lr;
+using namespace compiler;
+
+//              =============
+//               Allocations
+//
+
+#if __cplusplus >= 201103L
+#   define BENCHMARK_THROW_BAD_ALLOC
+#   define BENCHMARK_NOTHROW            noexcept
+#else
+#   define BENCHMARK_THROW_BAD_ALLOC    throw(std::bad_alloc)
+#   define BENCHMARK_NOTHROW            throw()
+#endif
+
+/// \brief The number of allocations made since this program started
+///
+/// The workloads are run on a single thread, so these don't need to be atomic
+static long s_Allocations       = 0;
+
+/// \brief The number of bytes allocated since this program started
+static long s_AllocatedBytes    = 0;
+
+/// \brief Allocates memory, counting the allocation
+static void* counted_alloc(std::size_t size) {
+    ++s_Allocations;
+    s_AllocatedBytes += (long) size;
+    
+    void* result = malloc(size > 0 ? size : 1);
+    if (!result) throw std::bad_alloc();
+    
+    return result;
+}
+
+void* operator new(std::size_t size) BENCHMARK_THROW_BAD_ALLOC     { return counted_alloc(size); }
+void* operator new[](std::size_t size) BENCHMARK_THROW_BAD_ALLOC   { return counted_alloc(size); }
+void operator delete(void* ptr) BENCHMARK_NOTHROW                   { free(ptr); }
+void operator delete[](void* ptr) BENCHMARK_NOTHROW                 { free(ptr); }
+
+/// \brief Counts the allocations made while it exists
+class allocation_counter {
+private:
+    long m_StartAllocations;
+    long m_StartBytes;
+    
+public:
+    allocation_counter()
+    : m_StartAllocations(s_Allocations)
+    , m_StartBytes(s_AllocatedBytes) {
+    }
+    
+    /// \brief The number of allocations since this object was created
+    inline long allocations() const { return s_Allocations - m_StartAllocations; }
+    
+    /// \brief The number of bytes allocated since this object was created
+    inline long bytes() const { return s_AllocatedBytes - m_StartBytes; }
+};
+
+//              ==============
+//               Measurements
+//
+
+/// \brief A single measurement made by a workload
+struct measurement {
+    /// \brief The workload that made the measurement (eg 'lexer.json')
+    string workload;
+    
+    /// \brief What was measured (eg 'mb_per_second')
+    string metric;
+    
+    /// \brief The value that was measured
+    double value;
+    
+    measurement(const string& workloadName, const string& metricName, double measured)
+    : workload(workloadName)
+    , metric(metricName)
+    , value(measured) {
+    }
+    
+    /// \brief The name used for this measurement in a report
+    inline string key() const { return workload + " " + metric; }
+};
+
+typedef vector<measurement> measurement_list;
+
+/// \brief True if smaller values of the specified metric are better
+static bool lower_is_better(const string& metric) {
+    return metric == "seconds" || metric == "allocations" || metric == "allocated_bytes";
+}
+
+/// \brief The first line of a benchmark report
+static const char* c_ReportHeader = "# TameParse benchmark";
+
+/// \brief Writes out a list of measurements in the format read by read_report
+static void write_report(ostream& target, const measurement_list& measurements) {
+    target << c_ReportHeader << "\n";
+    
+    for (measurement_list::const_iterator next = measurements.begin(); next != measurements.end(); ++next) {
+        target << next->workload << " " << next->metric << " " << fixed << setprecision(6) << next->value << "\n";
+    }
+}
+
+/// \brief Reads the measurements written by write_report, returning false if the stream is not a benchmark report
+static bool read_report(istream& source, map<string, double>& measurements) {
+    string line;
+    if (!getline(source, line) || line != c_ReportHeader) return false;
+    
+    while (getline(source, line)) {
+        if (line.empty()) continue;
+        
+        istringstream   lineStream(line);
+        string          workload;
+        string          metric;
+        double          value;
+        
+        if (!(lineStream >> workload >> metric >> value)) return false;
+        measurements[workload + " " + metric] = value;
+    }
+    
+    return true;
+}
+
+/// \brief Compares a set of measurements against a baseline, returning the number of regressions
+///
+/// A measurement has regressed if it is worse than the baseline by more than the specified fraction. Measurements
+/// that are missing from the baseline are not compared.
+static int compare_with_baseline(const measurement_list& measurements, const map<string, double>& baseline, double tolerance) {
+    int regressions = 0;
+    
+    cout << endl << "Comparison with baseline (positive changes are worse, tolerance " << fixed << setprecision(1) << tolerance * 100.0 << "%):" << endl;
+    
+    for (measurement_list::const_iterator next = measurements.begin(); next != measurements.end(); ++next) {
+        map<string, double>::const_iterator base = baseline.find(next->key());
+        if (base == baseline.end() || base->second <= 0) continue;
+        
+        // Work out how much worse this measurement is than the baseline (negative values are improvements)
+        double change = (next->value - base->second) / base->second;
+        if (!lower_is_better(next->metric)) change = -change;
+        
+        bool regressed = change > tolerance;
+        if (regressed) ++regressions;
+        
+        cout << "  " << left << setw(44) << next->key() << right
+             << setw(16) << setprecision(3) << base->second << " -> " << setw(16) << next->value
+             << "  " << showpos << setprecision(1) << change * 100.0 << noshowpos << "%"
+             << (regressed ? "  REGRESSION" : "") << endl;
+    }
+    
+    return regressions;
+}
+
+//              =========
+//               Console
+//
+
+/// \brief Console used to compile the example grammars
+///
+/// Everything is compiled on a single thread so that the allocations can be counted, and the stage profiles are kept
+/// so that the time spent building the DFA and the LALR parser can be measured separately.
+class benchmark_console : public std_console {
+private:
+    /// \brief The directory to search for imported files
+    wstring m_Directory;
+    
+public:
+    benchmark_console(const wstring& filename, const wstring& directory)
+    : std_console(filename)
+    , m_Directory(directory) {
+    }
+    
+    virtual console* clone() const {
+        return new benchmark_console(*this);
+    }
+    
+    virtual wstring get_option(const wstring& name) const {
+        if (name == L"silent")              return L"1";
+        if (name == L"suppress-warnings")   return L"1";
+        if (name == L"enable-lr1-resolver") return L"1";
+        if (name == L"threads")             return L"1";
+        
+        return wstring();
+    }
+    
+    /// \brief Opens a file, looking in the examples directory if it isn't found in the current directory
+    virtual istream* open_file(const wstring& filename) {
+        istream* result = std_console::open_file(filename);
+        
+        if (!result && !filename.empty() && filename[0] != L'/') {
+            result = std_console::open_file(m_Directory + L"/" + filename);
+        }
+        
+        return result;
+    }
+    
+    /// \brief The time taken by the stage with the specified name, or 0 if it wasn't run
+    double stage_seconds(const wstring& stage) const {
+        double total = 0;
+        
+        for (vector<stage_profile>::const_iterator profile = profiles().begin(); profile != profiles().end(); ++profile) {
+            if (profile->stage() == stage) total += profile->seconds();
+        }
+        
+        return total;
+    }
+};
+
+//              ===========
+//               Workloads
+//
+
+/// \brief Options for the benchmarks
+struct benchmark_options {
+    /// \brief The directory containing the example grammars
+    string examplesDir;
+    
+    /// \brief The json_format program, or empty if it should not be benchmarked
+    string jsonFormat;
+    
+    /// \brief The number of times to run each workload (the fastest run is reported)
+    int repeat;
+    
+    /// \brief Multiplier for the size of the synthetic input
+    int scale;
+    
+    benchmark_options()
+    : examplesDir("Examples")
+    , repeat(3)
+    , scale(1) {
+    }
+};
+
+/// \brief Reads a UTF-8 file into a string, returning false if it can't be read
+static bool read_file(const string& filename, wstring& result) {
+    ifstream* source = new ifstream(filename.c_str(), ios::in | ios::binary);
+    if (!source->good()) {
+        delete source;
+        return false;
+    }
+    
+    utf8reader      reader(source, true);
+    wstringstream   text;
+    
+    for (;;) {
+        wchar_t nextChar;
+        reader.get(nextChar);
+        
+        if (!reader.good()) break;
+        
+        text << nextChar;
+    }
+    
+    result = text.str();
+    return true;
+}
+
+/// \brief Compiles one of the example grammars, returning NULL if it can't be compiled
+static compiled_language* compile_example(const benchmark_options& options, const string& filename, const wstring& languageName, const wstring& startSymbol, benchmark_console** consoleResult = NULL) {
+    string  path = options.examplesDir + "/" + filename;
+    wstring definition;
+    
+    if (!read_file(path, definition)) {
+        cerr << "Could not read " << path << endl;
+        return NULL;
+    }
+    
+    wstring             widePath(path.begin(), path.end());
+    wstring             wideDirectory(widePath, 0, widePath.rfind(L'/'));
+    benchmark_console*  console = new benchmark_console(widePath, wideDirectory);
+    console_container   cons(console, false);
+    
+    compiled_language* result = language_compiler::compile_language(cons, widePath, definition, languageName, vector<wstring>(1, startSymbol));
+    
+    if (!result) {
+        cerr << "Could not compile " << path << endl;
+    }
+    
+    if (consoleResult) {
+        *consoleResult = console;
+    } else {
+        delete console;
+    }
+    
+    return result;
+}
+
+/// \brief Measures the time taken to build the lexer and parser for one of the example grammars
+static bool benchmark_generator(const benchmark_options& options, const string& filename, const wstring& languageName, const wstring& startSymbol, measurement_list& results) {
+    string  workload    = "generator." + filename.substr(0, filename.find('.'));
+    double  dfaSeconds  = -1;
+    double  lalrSeconds = -1;
+    double  seconds     = -1;
+    long    allocations = 0;
+    long    bytes       = 0;
+    
+    // The first compilation fills in caches that later ones reuse (including the parser for the definition language),
+    // so it is run once before anything is measured to make the results repeatable
+    for (int run = -1; run < options.repeat; ++run) {
+        benchmark_console*  console = NULL;
+        allocation_counter  allocs;
+        stopwatch           timer;
+        compiled_language*  result  = compile_example(options, filename, languageName, startSymbol, &console);
+        double              elapsed = timer.seconds();
+        
+        allocations = allocs.allocations();
+        bytes       = allocs.bytes();
+        
+        double dfa  = console->stage_seconds(L"lexer");
+        double lalr = console->stage_seconds(L"lr_parser");
+        
+        delete console;
+        if (!result) return false;
+        delete result;
+        
+        if (run < 0) continue;
+        
+        if (seconds < 0 || elapsed < seconds)   seconds     = elapsed;
+        if (dfaSeconds < 0 || dfa < dfaSeconds) dfaSeconds  = dfa;
+        if (lalrSeconds < 0 || lalr < lalrSeconds) lalrSeconds = lalr;
+    }
+    
+    results.push_back(measurement(workload + ".dfa", "seconds", dfaSeconds));
+    results.push_back(measurement(workload + ".lalr", "seconds", lalrSeconds));
+    results.push_back(measurement(workload, "seconds", seconds));
+    results.push_back(measurement(workload, "allocations", (double) allocations));
+    results.push_back(measurement(workload, "allocated_bytes", (double) bytes));
+    
+    return true;
+}
+
+/// \brief Generates a C source file with the specified number of functions
+static string synthetic_c(int numFunctions) {
+    stringstream result;
+    
+    for (int function = 0; function < numFunctions; ++function) {
+        result  << "static int function_" << function << "(int value, int count) {\n"
+                << "    int total = " << function % 97 << ";\n"
+                << "    int index;\n"
+                << "    /* Accumulate the values */\n"
+                << "    for (index = 0; index < count; index++) {\n"
+                << "        if ((value + index) % " << function % 13 + 2 << " == 0) {\n"
+                << "            total = total + value * index - " << function << ";\n"
+                << "        } else {\n"
+                << "            total = total - (index << 2);\n"
+                << "        }\n"
+                << "    }\n"
+                << "    return total;\n"
+                << "}\n\n";
+    }
+    
+    return result.str();
+}
+
+/// \brief Generates a JSON object with the specified number of items
+static string synthetic_json(int numItems) {
+    stringstream result;
+    
+    result << "{\n  \"items\": [\n";
+    
+    for (int item = 0; item < numItems; ++item) {
+        result  << "    { \"id\": " << item << ", \"name\": \"item " << item << "\", \"price\": " << item % 1000 << "." << item % 7 << "5"
+                << ", \"tags\": [ \"alpha\", \"beta\" ], \"active\": " << (item % 2 ? "true" : "false")
+                << ", \"child\": { \"depth\": " << item % 5 << ", \"values\": [ 1, 2, 3 ], \"parent\": null } }"
+                << (item + 1 < numItems ? ",\n" : "\n");
+    }
+    
+    result << "  ]\n}\n";
+    
+    return result.str();
+}
+
+/// \brief Measures the speed of the lexer and parser of a language on some synthetic input
+static bool benchmark_parser(const benchmark_options& options, const compiled_language& language, const string& name, const string& input, measurement_list& results) {
+    double  lexSeconds      = -1;
+    double  parseSeconds    = -1;
+    long    tokens          = 0;
+    long    allocations     = 0;
+    
+    for (int run = 0; run < options.repeat; ++run) {
+        // Just the lexer
+        stringstream    lexInput(input);
+        lexeme_stream*  stream      = language.get_lexer().create_stream_from<char>(lexInput);
+        stopwatch       lexTimer;
+        
+        tokens = 0;
+        for (;;) {
+            lexeme* next;
+            (*stream) >> next;
+            if (!next) break;
+            
+            ++tokens;
+            delete next;
+        }
+        
+        double lexElapsed = lexTimer.seconds();
+        delete stream;
+        
+        // The lexer and the parser, building an AST
+        stringstream        parseInput(input);
+        allocation_counter  allocs;
+        stopwatch           parseTimer;
+        ast_parser::state*  parser      = language.get_parser().create_parser(new ast_parser_actions(language.get_lexer().create_stream_from<char>(parseInput)));
+        bool                accepted    = parser->parse();
+        
+        delete parser;
+        
+        double parseElapsed = parseTimer.seconds();
+        allocations         = allocs.allocations();
+        
+        if (!accepted) {
+            cerr << "The synthetic input for " << name << " was rejected by its parser" << endl;
+            return false;
+        }
+        
+        if (lexSeconds < 0 || lexElapsed < lexSeconds)          lexSeconds      = lexElapsed;
+        if (parseSeconds < 0 || parseElapsed < parseSeconds)    parseSeconds    = parseElapsed;
+    }
+    
+    // Avoid dividing by zero on very fast runs
+    if (lexSeconds <= 0)    lexSeconds      = 1e-9;
+    if (parseSeconds <= 0)  parseSeconds    = 1e-9;
+    
+    results.push_back(measurement("lexer." + name, "mb_per_second", (double) input.size() / (1024.0 * 1024.0) / lexSeconds));
+    results.push_back(measurement("lexer." + name, "tokens_per_second", (double) tokens / lexSeconds));
+    results.push_back(measurement("parser." + name, "tokens_per_second", (double) tokens / parseSeconds));
+    results.push_back(measurement("parser." + name, "allocations", (double) allocations));
+    
+    return true;
+}
+
+/// \brief Measures the time taken by the json_format example to pretty-print some synthetic input
+static bool benchmark_json_format(const benchmark_options& options, const string& input, measurement_list& results) {
+    // Write the input to a temporary file
+    string inputFile = "benchmark-input.json";
+    {
+        ofstream target(inputFile.c_str(), ios::out | ios::binary);
+        target << input;
+        
+        if (!target.good()) {
+            cerr << "Could not write " << inputFile << endl;
+            return false;
+        }
+    }
+    
+    string  command = "\"" + options.jsonFormat + "\" < " + inputFile + " > benchmark-output.json";
+    double  seconds = -1;
+    
+    for (int run = 0; run < options.repeat; ++run) {
+        stopwatch   timer;
+        int         exitCode = system(command.c_str());
+        double      elapsed  = timer.seconds();
+        
+        if (exitCode != 0) {
+            cerr << "json_format failed: " << command << endl;
+            remove(inputFile.c_str());
+            return false;
+        }
+        
+        if (seconds < 0 || elapsed < seconds) seconds = elapsed;
+    }
+    
+    remove(inputFile.c_str());
+    remove("benchmark-output.json");
+    
+    if (seconds <= 0) seconds = 1e-9;
+    
+    results.push_back(measurement("json_format", "seconds", seconds));
+    results.push_back(measurement("json_format", "mb_per_second", (double) input.size() / (1024.0 * 1024.0) / seconds));
+    
+    return true;
+}
+
+//              ======
+//               Main
+//
+
+/// \brief Displays the command line options
+static void usage() {
+    cerr << "Usage: benchmark [options]" << endl << endl
+         << "  --examples DIR       directory containing the example grammars (default: Examples)" << endl
+         << "  --json-format PATH   also measure the json_format example program" << endl
+         << "  --repeat N           run each workload N times and report the fastest (default: 3)" << endl
+         << "  --scale N            multiply the size of the synthetic input by N (default: 1)" << endl
+         << "  --output FILE        write the results to FILE so they can be used as a baseline" << endl
+         << "  --baseline FILE      compare the results with an earlier run, and fail if any have regressed" << endl
+         << "  --tolerance PERCENT  how much worse than the baseline a result can be (default: 10)" << endl;
+}
+
+int main(int argc, const char** argv) {
+    benchmark_options   options;
+    string              outputFile;
+    string              baselineFile;
+    double              tolerance = 0.1;
+    
+    // Read the options
+    for (int arg = 1; arg < argc; ++arg) {
+        string option = argv[arg];
+        
+        if (option == "--help" || arg + 1 >= argc) {
+            usage();
+            return option == "--help" ? 0 : 1;
+        }
+        
+        string value = argv[++arg];
+        
+        if (option == "--examples")         options.examplesDir = value;
+        else if (option == "--json-format") options.jsonFormat  = value;
+        else if (option == "--repeat")      options.repeat      = atoi(value.c_str());
+        else if (option == "--scale")       options.scale       = atoi(value.c_str());
+        else if (option == "--output")      outputFile          = value;
+        else if (option == "--baseline")    baselineFile        = value;
+        else if (option == "--tolerance")   tolerance           = atof(value.c_str()) / 100.0;
+        else {
+            usage();
+            return 1;
+        }
+    }
+    
+    if (options.repeat < 1) options.repeat  = 1;
+    if (options.scale < 1)  options.scale   = 1;
+    
+    // Run the workloads
+    measurement_list    results;
+    bool                ok = true;
+    
+    ok = benchmark_generator(options, "AnsiC.tp", L"Ansi-C", L"<Translation-Unit>", results) && ok;
+    ok = benchmark_generator(options, "C99.tp", L"C99", L"<Translation-Unit>", results) && ok;
+    ok = benchmark_generator(options, "Pascal.tp", L"Pascal", L"<Program>", results) && ok;
+    
+    compiled_language* ansiC = compile_example(options, "AnsiC.tp", L"Ansi-C", L"<Translation-Unit>");
+    if (ansiC) {
+        ok = benchmark_parser(options, *ansiC, "c", synthetic_c(2000 * options.scale), results) && ok;
+        delete ansiC;
+    } else {
+        ok = false;
+    }
+    
+    string              jsonInput   = synthetic_json(4000 * options.scale);
+    compiled_language*  json        = compile_example(options, "JsonPrettyPrinter/json.tp", L"JSON", L"<Object>");
+    if (json) {
+        ok = benchmark_parser(options, *json, "json", jsonInput, results) && ok;
+        delete json;
+    } else {
+        ok = false;
+    }
+    
+    if (!options.jsonFormat.empty()) {
+        ok = benchmark_json_format(options, jsonInput, results) && ok;
+    }
+    
+    // Display the results
+    write_report(cout, results);
+    
+    if (!outputFile.empty()) {
+        ofstream target(outputFile.c_str(), ios::out | ios::binary);
+        write_report(target, results);
+        
+        if (!target.good()) {
+            cerr << "Could not write " << outputFile << endl;
+            ok = false;
+        }
+    }
+    
+    // Compare with the baseline
+    if (!baselineFile.empty()) {
+        ifstream            source(baselineFile.c_str(), ios::in | ios::binary);
+        map<string, double> baseline;
+        
+        if (!read_report(source, baseline)) {
+            cerr << "Could not read the baseline " << baselineFile << endl;
+            return 1;
+        }
+        
+        int regressions = compare_with_baseline(results, baseline, tolerance);
+        if (regressions > 0) {
+            cout << endl << regressions << " measurement(s) regressed" << endl;
+            return 1;
+        }
+    }
+    
+    return ok ? 0 : 1;
+}
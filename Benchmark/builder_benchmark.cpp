@@ -0,0 +1,574 @@
+//
+//  builder_benchmark.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+//
+// Measures how the time and memory taken to build a lexer and parser grow with the size of the language.
+//
+// Each family of synthetic languages stresses a different part of the builder: many levels of operator precedence
+// (the LALR states and their lookaheads), many keywords (the DFA and the keyword table), deeply nested EBNF items
+// (the closures and the conflict checker) and many guards (the guard states). Every family is compiled at a series
+// of sizes, each twice as large as the last, and the time and peak heap memory of every phase is recorded. The
+// scaling exponent of each phase is the slope of log(time) against log(size): 1 means that the phase is linear in the
+// size of the language, and anything much larger than that is worth investigating.
+//
+
+#include "TameParse/TameParse.h"
+#include "TameParse/Util/stopwatch.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace util;
+using namespace lr;
+using namespace compiler;
+
+//              ========
+//               Memory
+//
+
+#if __cplusplus >= 201103L
+#   define BENCHMARK_THROW_BAD_ALLOC
+#   define BENCHMARK_NOTHROW            noexcept
+#else
+#   define BENCHMARK_THROW_BAD_ALLOC    throw(std::bad_alloc)
+#   define BENCHMARK_NOTHROW            throw()
+#endif
+
+/// \brief The size of the header that records the size of each allocation (keeps the memory suitably aligned)
+static const size_t c_AllocationHeader = 16;
+
+/// \brief The number of bytes currently allocated on the heap
+///
+/// The languages are compiled on a single thread, so these don't need to be atomic
+static long s_LiveBytes = 0;
+
+/// \brief The largest value of s_LiveBytes since the peak was last reset
+static long s_PeakBytes = 0;
+
+/// \brief Allocates memory, tracking the number of bytes in use
+static void* tracked_alloc(std::size_t size) {
+    char* result = static_cast<char*>(malloc(size + c_AllocationHeader));
+    if (!result) throw std::bad_alloc();
+    
+    *reinterpret_cast<size_t*>(result) = size;
+    
+    s_LiveBytes += (long) size;
+    if (s_LiveBytes > s_PeakBytes) s_PeakBytes = s_LiveBytes;
+    
+    return result + c_AllocationHeader;
+}
+
+/// \brief Frees memory allocated by tracked_alloc
+static void tracked_free(void* ptr) {
+    if (!ptr) return;
+    
+    char* block = static_cast<char*>(ptr) - c_AllocationHeader;
+    s_LiveBytes -= (long) *reinterpret_cast<size_t*>(block);
+    
+    free(block);
+}
+
+void* operator new(std::size_t size) BENCHMARK_THROW_BAD_ALLOC     { return tracked_alloc(size); }
+void* operator new[](std::size_t size) BENCHMARK_THROW_BAD_ALLOC   { return tracked_alloc(size); }
+void operator delete(void* ptr) BENCHMARK_NOTHROW                   { tracked_free(ptr); }
+void operator delete[](void* ptr) BENCHMARK_NOTHROW                 { tracked_free(ptr); }
+
+//              ==============
+//               Measurements
+//
+
+/// \brief A single measurement made by a workload
+struct measurement {
+    /// \brief The workload that made the measurement (eg 'builder.precedence.64.lookaheads')
+    string workload;
+    
+    /// \brief What was measured (eg 'seconds')
+    string metric;
+    
+    /// \brief The value that was measured
+    double value;
+    
+    measurement(const string& workloadName, const string& metricName, double measured)
+    : workload(workloadName)
+    , metric(metricName)
+    , value(measured) {
+    }
+};
+
+typedef vector<measurement> measurement_list;
+
+/// \brief Writes out a list of measurements in the same format as the benchmark program
+static void write_report(ostream& target, const measurement_list& measurements) {
+    target << "# TameParse benchmark" << "\n";
+    
+    for (measurement_list::const_iterator next = measurements.begin(); next != measurements.end(); ++next) {
+        target << next->workload << " " << next->metric << " " << fixed << setprecision(6) << next->value << "\n";
+    }
+}
+
+//              =========
+//               Console
+//
+
+/// \brief The time and peak heap memory of a phase of the builder
+struct phase_measurement {
+    double  seconds;
+    long    peakBytes;
+    
+    phase_measurement()
+    : seconds(0)
+    , peakBytes(0) {
+    }
+};
+
+/// \brief Map of phase names to their measurements
+typedef map<string, phase_measurement> phase_map;
+
+/// \brief Console used to compile the synthetic languages
+///
+/// This records the time taken by each stage and by each of the phases within the lexer and parser stages, and the
+/// peak heap memory in use while each stage was running. Only the heap is measured (not the resident size of the
+/// process), so the results don't depend on what the earlier languages left behind.
+class builder_benchmark_console : public std_console {
+private:
+    /// \brief The phases measured so far
+    phase_map* m_Phases;
+    
+public:
+    builder_benchmark_console(const wstring& filename, phase_map* phases)
+    : std_console(filename)
+    , m_Phases(phases) {
+    }
+    
+    virtual console* clone() const {
+        return new builder_benchmark_console(*this);
+    }
+    
+    virtual wstring get_option(const wstring& name) const {
+        if (name == L"silent")              return L"1";
+        if (name == L"suppress-warnings")   return L"1";
+        if (name == L"threads")             return L"1";
+        
+        return wstring();
+    }
+    
+    /// \brief Records the time and memory used by a stage, and the times of its phases
+    virtual void record_profile(const stage_profile& profile) {
+        string stage(profile.stage().begin(), profile.stage().end());
+        
+        phase_measurement& total = (*m_Phases)[stage];
+        total.seconds   += profile.seconds();
+        if (s_PeakBytes > total.peakBytes) total.peakBytes = s_PeakBytes;
+        
+        // The phases share the peak memory of the stage they belong to
+        for (stage_profile::timing_list::const_iterator timing = profile.timings().begin(); timing != profile.timings().end(); ++timing) {
+            if (timing->first.compare(0, 6, L"phase.") != 0) continue;
+            
+            phase_measurement& phase = (*m_Phases)[string(timing->first.begin() + 6, timing->first.end())];
+            phase.seconds   += timing->second;
+            phase.peakBytes = total.peakBytes;
+        }
+        
+        // Measure the next stage from the memory in use now
+        s_PeakBytes = s_LiveBytes;
+    }
+};
+
+//              ====================
+//               Synthetic grammars
+//
+
+/// \brief A family of synthetic languages
+struct grammar_family {
+    /// \brief The name of the family
+    const char* name;
+    
+    /// \brief The size of the smallest language in the family
+    int baseSize;
+    
+    /// \brief Generates the language with the specified size
+    string (*generate)(int size);
+};
+
+/// \brief Language with size levels of left-associative binary operators (and a prefix operator for each level)
+static string precedence_grammar(int size) {
+    stringstream result;
+    
+    result  << "language Synthetic {\n"
+            << "  lexer {\n"
+            << "    identifier = /[a-z]+/\n"
+            << "    number = /[0-9]+/\n"
+            << "  }\n"
+            << "  ignore {\n"
+            << "    whitespace = /[ \\t\\r\\n]+/\n"
+            << "  }\n"
+            << "  grammar {\n"
+            << "    <Start> = <Expr-0>\n";
+    
+    for (int level = 0; level < size; ++level) {
+        result  << "    <Expr-" << level << "> = <Expr-" << level + 1 << ">"
+                << " | <Expr-" << level << "> \"#" << level << "\" <Expr-" << level + 1 << ">"
+                << " | \"!" << level << "\" <Expr-" << level + 1 << ">\n";
+    }
+    
+    result  << "    <Expr-" << size << "> = identifier | number | '(' <Expr-0> ')'\n"
+            << "  }\n"
+            << "}\n";
+    
+    return result.str();
+}
+
+/// \brief Language with size keywords, each starting a different kind of statement
+static string keyword_grammar(int size) {
+    stringstream result;
+    
+    result  << "language Synthetic {\n"
+            << "  keywords {\n";
+    
+    for (int keyword = 0; keyword < size; ++keyword) {
+        result << "    kw" << keyword << "x\n";
+    }
+    
+    result  << "  }\n"
+            << "  lexer {\n"
+            << "    identifier = /[a-z][a-z0-9]*/\n"
+            << "    number = /[0-9]+/\n"
+            << "  }\n"
+            << "  ignore {\n"
+            << "    whitespace = /[ \\t\\r\\n]+/\n"
+            << "  }\n"
+            << "  grammar {\n"
+            << "    <Start> = <Statement>*\n"
+            << "    <Statement> = identifier '=' number ';'\n";
+    
+    for (int keyword = 0; keyword < size; ++keyword) {
+        result << "      | kw" << keyword << "x (identifier | number)* ';'\n";
+    }
+    
+    result  << "  }\n"
+            << "}\n";
+    
+    return result.str();
+}
+
+/// \brief Language whose start symbol is a single rule with EBNF items nested size levels deep
+static string nested_grammar(int size) {
+    // Build the rule from the inside out: each level is a bracketed list of the level inside it
+    string item = "identifier";
+    
+    for (int level = 1; level <= size; ++level) {
+        stringstream next;
+        next << "\"[" << level << "\" (" << item << " | number (',' number)* | ':' ('+' number)?)* \"]" << level << "\"";
+        item = next.str();
+    }
+    
+    stringstream result;
+    
+    result  << "language Synthetic {\n"
+            << "  lexer {\n"
+            << "    identifier = /[a-z]+/\n"
+            << "    number = /[0-9]+/\n"
+            << "  }\n"
+            << "  ignore {\n"
+            << "    whitespace = /[ \\t\\r\\n]+/\n"
+            << "  }\n"
+            << "  grammar {\n"
+            << "    <Start> = (" << item << ")+\n"
+            << "  }\n"
+            << "}\n";
+    
+    return result.str();
+}
+
+/// \brief Language with size kinds of item, each of which is chosen with a guard
+static string guard_grammar(int size) {
+    stringstream result;
+    
+    result  << "language Synthetic {\n"
+            << "  lexer {\n"
+            << "    identifier = /[a-z]+/\n"
+            << "    number = /[0-9]+/\n"
+            << "  }\n"
+            << "  ignore {\n"
+            << "    whitespace = /[ \\t\\r\\n]+/\n"
+            << "  }\n"
+            << "  grammar {\n"
+            << "    <Start> = <Item>*\n"
+            << "    <Item> = <Item-0>\n";
+    
+    for (int item = 1; item < size; ++item) {
+        result << "      | <Item-" << item << ">\n";
+    }
+    
+    for (int item = 0; item < size; ++item) {
+        result  << "    <Item-" << item << "> = [=> identifier \"@" << item << "\" ':'] <Label-" << item << "> | <Use-" << item << ">\n"
+                << "    <Label-" << item << "> = identifier \"@" << item << "\" ':'\n"
+                << "    <Use-" << item << "> = identifier \"@" << item << "\" number\n";
+    }
+    
+    result  << "  }\n"
+            << "}\n";
+    
+    return result.str();
+}
+
+/// \brief The families of languages that are measured
+static const grammar_family c_Families[] = {
+    { "precedence", 8,  precedence_grammar },
+    { "keywords",   64, keyword_grammar },
+    { "nested",     2,  nested_grammar },
+    { "guards",     8,  guard_grammar }
+};
+
+/// \brief The number of families of languages
+static const int c_NumFamilies = sizeof(c_Families) / sizeof(c_Families[0]);
+
+//              ===========
+//               Workloads
+//
+
+/// \brief Options for the builder benchmark
+struct builder_options {
+    /// \brief The family to measure, or empty to measure all of them
+    string family;
+    
+    /// \brief The number of sizes to measure for each family (each one twice as large as the last)
+    int steps;
+    
+    /// \brief Multiplier for the size of the smallest language in each family
+    int scale;
+    
+    /// \brief The number of times to build each language (the fastest time is reported)
+    int repeat;
+    
+    builder_options()
+    : steps(5)
+    , scale(1)
+    , repeat(3) {
+    }
+};
+
+/// \brief Compiles a synthetic language, filling in the time and memory used by each phase
+static bool build_language(const string& definition, phase_map& phases, double& seconds) {
+    wstring             filename(L"synthetic.tp");
+    console_container   console(new builder_benchmark_console(filename, &phases), true);
+    
+    // Only count the memory used by the builder
+    s_PeakBytes = s_LiveBytes;
+    
+    stopwatch           timer;
+    compiled_language*  result  = language_compiler::compile_language(console, filename, wstring(definition.begin(), definition.end()), L"Synthetic", vector<wstring>(1, L"<Start>"));
+    
+    seconds = timer.seconds();
+    
+    if (!result) return false;
+    delete result;
+    
+    return true;
+}
+
+/// \brief The slope of the least-squares line through log(y) against log(x), or 0 if there aren't enough points
+static double scaling_exponent(const vector<double>& x, const vector<double>& y) {
+    double  sumX    = 0;
+    double  sumY    = 0;
+    double  sumXX   = 0;
+    double  sumXY   = 0;
+    int     count   = 0;
+    
+    for (size_t point = 0; point < x.size(); ++point) {
+        // Times that are too small to measure don't say anything about the scaling
+        if (x[point] <= 0 || y[point] <= 1e-6) continue;
+        
+        double logX = log(x[point]);
+        double logY = log(y[point]);
+        
+        sumX    += logX;
+        sumY    += logY;
+        sumXX   += logX * logX;
+        sumXY   += logX * logY;
+        ++count;
+    }
+    
+    double divisor = count * sumXX - sumX * sumX;
+    if (count < 2 || divisor <= 0) return 0;
+    
+    return (count * sumXY - sumX * sumY) / divisor;
+}
+
+/// \brief Measures one family of languages at increasing sizes
+static bool benchmark_family(const builder_options& options, const grammar_family& family, measurement_list& results) {
+    string                      workload = string("builder.") + family.name;
+    vector<double>              sizes;
+    map<string, vector<double> > phaseSeconds;
+    
+    cerr << "Measuring " << family.name << endl;
+    
+    for (int step = 0; step < options.steps; ++step) {
+        int     size        = family.baseSize * options.scale << step;
+        string  definition  = family.generate(size);
+        
+        // Keep the fastest run of each phase, and the largest amount of memory
+        phase_map   best;
+        double      bestSeconds = -1;
+        
+        for (int run = 0; run < options.repeat; ++run) {
+            phase_map   phases;
+            double      seconds;
+            
+            if (!build_language(definition, phases, seconds)) {
+                cerr << "Could not build the " << family.name << " language with size " << size << endl;
+                return false;
+            }
+            
+            if (bestSeconds < 0 || seconds < bestSeconds) bestSeconds = seconds;
+            
+            for (phase_map::const_iterator phase = phases.begin(); phase != phases.end(); ++phase) {
+                phase_map::iterator found = best.find(phase->first);
+                
+                if (found == best.end()) {
+                    best[phase->first] = phase->second;
+                } else {
+                    if (phase->second.seconds < found->second.seconds)      found->second.seconds   = phase->second.seconds;
+                    if (phase->second.peakBytes > found->second.peakBytes)  found->second.peakBytes = phase->second.peakBytes;
+                }
+            }
+        }
+        
+        // Record the measurements for this size
+        stringstream sizeName;
+        sizeName << workload << "." << size;
+        
+        results.push_back(measurement(sizeName.str(), "seconds", bestSeconds));
+        phaseSeconds["total"].push_back(bestSeconds);
+        
+        for (phase_map::const_iterator phase = best.begin(); phase != best.end(); ++phase) {
+            results.push_back(measurement(sizeName.str() + "." + phase->first, "seconds", phase->second.seconds));
+            results.push_back(measurement(sizeName.str() + "." + phase->first, "peak_bytes", (double) phase->second.peakBytes));
+            
+            // Phases that weren't run for the smaller sizes are left out of the scaling exponent
+            vector<double>& times = phaseSeconds[phase->first];
+            times.resize(sizes.size(), 0);
+            times.push_back(phase->second.seconds);
+        }
+        
+        sizes.push_back((double) size);
+    }
+    
+    // Work out how each phase scales
+    for (map<string, vector<double> >::iterator phase = phaseSeconds.begin(); phase != phaseSeconds.end(); ++phase) {
+        phase->second.resize(sizes.size(), 0);
+        
+        string name = phase->first == "total" ? workload : workload + "." + phase->first;
+        results.push_back(measurement(name, "scaling_exponent", scaling_exponent(sizes, phase->second)));
+    }
+    
+    return true;
+}
+
+//              ======
+//               Main
+//
+
+/// \brief Displays the command line options
+static void usage() {
+    cerr << "Usage: builder_benchmark [options]" << endl << endl
+         << "  --family NAME        measure only one family: precedence, keywords, nested or guards" << endl
+         << "  --steps N            the number of sizes to measure, each twice the last (default: 5)" << endl
+         << "  --scale N            multiply the size of the smallest language by N (default: 1)" << endl
+         << "  --repeat N           build each language N times and report the fastest (default: 3)" << endl
+         << "  --output FILE        also write the results to FILE" << endl;
+}
+
+int main(int argc, const char** argv) {
+    builder_options options;
+    string          outputFile;
+    
+    // Read the options
+    for (int arg = 1; arg < argc; ++arg) {
+        string option = argv[arg];
+        
+        if (option == "--help" || arg + 1 >= argc) {
+            usage();
+            return option == "--help" ? 0 : 1;
+        }
+        
+        string value = argv[++arg];
+        
+        if (option == "--family")           options.family  = value;
+        else if (option == "--steps")       options.steps   = atoi(value.c_str());
+        else if (option == "--scale")       options.scale   = atoi(value.c_str());
+        else if (option == "--repeat")      options.repeat  = atoi(value.c_str());
+        else if (option == "--output")      outputFile      = value;
+        else {
+            usage();
+            return 1;
+        }
+    }
+    
+    if (options.steps < 1)  options.steps   = 1;
+    if (options.scale < 1)  options.scale   = 1;
+    if (options.repeat < 1) options.repeat  = 1;
+    
+    // Run the workloads
+    measurement_list    results;
+    bool                ok      = true;
+    bool                found   = false;
+    
+    for (int familyNum = 0; familyNum < c_NumFamilies; ++familyNum) {
+        if (!options.family.empty() && options.family != c_Families[familyNum].name) continue;
+        
+        found   = true;
+        ok      = benchmark_family(options, c_Families[familyNum], results) && ok;
+    }
+    
+    if (!found) {
+        cerr << "Unknown family: " << options.family << endl;
+        return 1;
+    }
+    
+    // Display the results
+    write_report(cout, results);
+    
+    if (!outputFile.empty()) {
+        ofstream target(outputFile.c_str(), ios::out | ios::binary);
+        write_report(target, results);
+        
+        if (!target.good()) {
+            cerr << "Could not write " << outputFile << endl;
+            ok = false;
+        }
+    }
+    
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,681 @@
+//
+//  lexer_benchmark.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+
+//
+// Measures the speed of each of the ways that a lexer can be built from a DFA, using synthetic input.
+//
+// The input is generated from the DFA itself: each token is produced by a random walk from the initial state, so
+// every lexer configuration sees the same mix of tokens the language actually defines rather than a hand-written
+// sample. The walks are seeded, so the same options always produce the same input.
+//
+
+#include "TameParse/TameParse.h"
+#include "TameParse/Util/stopwatch.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace util;
+using namespace dfa;
+using namespace language;
+using namespace compiler;
+
+//              ==============
+//               Measurements
+//
+
+/// \brief A single measurement made by a workload
+struct measurement {
+    /// \brief The workload that made the measurement (eg 'lexer_dfa.json.flat')
+    string workload;
+    
+    /// \brief What was measured (eg 'mb_per_second')
+    string metric;
+    
+    /// \brief The value that was measured
+    double value;
+    
+    measurement(const string& workloadName, const string& metricName, double measured)
+    : workload(workloadName)
+    , metric(metricName)
+    , value(measured) {
+    }
+};
+
+typedef vector<measurement> measurement_list;
+
+/// \brief Writes out a list of measurements in the same format as the benchmark program
+static void write_report(ostream& target, const measurement_list& measurements) {
+    target << "# TameParse benchmark" << "\n";
+    
+    for (measurement_list::const_iterator next = measurements.begin(); next != measurements.end(); ++next) {
+        target << next->workload << " " << next->metric << " " << fixed << setprecision(6) << next->value << "\n";
+    }
+}
+
+//              =========
+//               Options
+//
+
+/// \brief How the lengths of the generated tokens are chosen
+enum length_distribution {
+    /// \brief Every token is generated with the same target length
+    length_fixed,
+    
+    /// \brief Target lengths are chosen evenly between 1 and twice the mean length
+    length_uniform,
+    
+    /// \brief Target lengths follow a geometric distribution, so most tokens are short and a few are very long
+    length_geometric
+};
+
+/// \brief Options for the lexer benchmark
+struct lexer_options {
+    /// \brief The directory containing the example grammars
+    string examplesDir;
+    
+    /// \brief The grammar to benchmark, or empty to use the examples
+    string grammar;
+    
+    /// \brief The language in the grammar to benchmark
+    string language;
+    
+    /// \brief The number of symbols of input to generate
+    int size;
+    
+    /// \brief The mean target length of the generated tokens
+    int tokenLength;
+    
+    /// \brief How the target lengths of the tokens are chosen
+    length_distribution distribution;
+    
+    /// \brief The seed for the input generator
+    unsigned int seed;
+    
+    /// \brief The number of times to run each workload (the fastest run is reported)
+    int repeat;
+    
+    lexer_options()
+    : examplesDir("Examples")
+    , size(1000000)
+    , tokenLength(6)
+    , distribution(length_geometric)
+    , seed(1)
+    , repeat(5) {
+    }
+};
+
+//              =================
+//               Input generator
+//
+
+/// \brief Linear congruential random number generator
+///
+/// The C library rand() differs between platforms, and the input should be the same everywhere so that results can
+/// be compared between machines.
+class random_source {
+private:
+    unsigned int m_State;
+    
+public:
+    explicit random_source(unsigned int seed)
+    : m_State(seed) {
+    }
+    
+    /// \brief A random number between 0 and 0x7fff
+    inline unsigned int next() {
+        m_State = m_State * 1103515245u + 12345u;
+        return (m_State >> 16) & 0x7fff;
+    }
+    
+    /// \brief A random number that is at least 0 and less than max
+    inline int below(int max) {
+        if (max <= 1) return 0;
+        
+        unsigned int value = (next() << 15) | next();
+        return (int) (value % (unsigned int) max);
+    }
+};
+
+/// \brief Generates input for a lexer by taking random walks through its DFA
+class dfa_walker {
+private:
+    typedef vector<range<int> >         range_list;
+    typedef pair<int, int>              walk_transition;
+    typedef vector<walk_transition>     transition_list;
+    
+    /// \brief The DFA being walked
+    const ndfa& m_Dfa;
+    
+    /// \brief The transitions out of each state, as (symbol set, new state) pairs
+    vector<transition_list> m_Transitions;
+    
+    /// \brief The symbols that can be generated for each symbol set
+    ///
+    /// These are limited to the basic multilingual plane and exclude surrogates, so that every lexer configuration
+    /// (including the binary lexer, which only looks at the low 16 bits of each symbol) sees valid input.
+    vector<range_list> m_Ranges;
+    
+    /// \brief The printable ASCII symbols in each symbol set
+    ///
+    /// Symbols are taken from here when possible, so that (for example) a walk through an identifier produces
+    /// something that looks like an identifier rather than a string of CJK characters.
+    vector<range_list> m_AsciiRanges;
+    
+    /// \brief Adds part of a range to a list, if it's not empty
+    static void add_range(range_list& target, int lower, int upper, int minSymbol, int maxSymbol) {
+        if (lower < minSymbol) lower = minSymbol;
+        if (upper > maxSymbol) upper = maxSymbol;
+        
+        if (lower < upper) target.push_back(range<int>(lower, upper));
+    }
+    
+    /// \brief Chooses a random symbol from a list of ranges
+    static int choose(const range_list& ranges, random_source& random) {
+        const range<int>& chosen = ranges[random.below((int) ranges.size())];
+        return chosen.lower() + random.below(chosen.upper() - chosen.lower());
+    }
+    
+public:
+    explicit dfa_walker(const ndfa& dfa)
+    : m_Dfa(dfa) {
+        // Work out which symbols can be generated for each set
+        const symbol_map& symbols = dfa.symbols();
+        
+        m_Ranges.resize(symbols.count_sets());
+        m_AsciiRanges.resize(symbols.count_sets());
+        
+        for (symbol_map::iterator setIt = symbols.begin(); setIt != symbols.end(); ++setIt) {
+            int id = setIt->second;
+            
+            for (symbol_set::iterator rangeIt = setIt->first->begin(); rangeIt != setIt->first->end(); ++rangeIt) {
+                add_range(m_Ranges[id], rangeIt->lower(), rangeIt->upper(), 0, 0xd800);
+                add_range(m_Ranges[id], rangeIt->lower(), rangeIt->upper(), 0xe000, 0x10000);
+                add_range(m_AsciiRanges[id], rangeIt->lower(), rangeIt->upper(), 0x20, 0x7f);
+            }
+        }
+        
+        // Store the transitions that can generate a symbol
+        m_Transitions.resize(dfa.count_states());
+        
+        for (int stateId = 0; stateId < dfa.count_states(); ++stateId) {
+            const state& thisState = dfa.get_state(stateId);
+            
+            for (state::iterator trans = thisState.begin(); trans != thisState.end(); ++trans) {
+                if (m_Ranges[trans->symbol_set()].empty()) continue;
+                m_Transitions[stateId].push_back(walk_transition(trans->symbol_set(), trans->new_state()));
+            }
+        }
+    }
+    
+    /// \brief Appends a token to the specified buffer, returning false if no token could be generated
+    ///
+    /// The walk stops once it has generated targetLength symbols or reaches a state with no transitions, and the
+    /// output is cut back to the last point where the DFA was in an accepting state. Walks that never reach an
+    /// accepting state are retried a few times before giving up.
+    bool generate(int targetLength, random_source& random, vector<int>& target) const {
+        size_t start = target.size();
+        
+        for (int attempt = 0; attempt < 16; ++attempt) {
+            size_t  acceptLength    = 0;
+            int     stateId         = 0;
+            
+            for (int length = 0; length < targetLength; ++length) {
+                const transition_list& transitions = m_Transitions[stateId];
+                if (transitions.empty()) break;
+                
+                const walk_transition& chosen = transitions[random.below((int) transitions.size())];
+                
+                // Mostly choose printable symbols where there are some
+                const range_list& ascii = m_AsciiRanges[chosen.first];
+                if (!ascii.empty() && random.below(8) != 0) {
+                    target.push_back(choose(ascii, random));
+                } else {
+                    target.push_back(choose(m_Ranges[chosen.first], random));
+                }
+                
+                stateId = chosen.second;
+                if (!m_Dfa.actions_for_state(stateId).empty()) {
+                    acceptLength = target.size() - start;
+                }
+            }
+            
+            target.resize(start + acceptLength);
+            if (acceptLength > 0) return true;
+        }
+        
+        return false;
+    }
+};
+
+/// \brief Chooses the target length of the next token
+static int token_length(const lexer_options& options, random_source& random) {
+    int mean = options.tokenLength;
+    
+    switch (options.distribution) {
+        case length_uniform:
+            return 1 + random.below(2 * mean - 1);
+            
+        case length_geometric:
+        {
+            // Each additional symbol is added with probability (mean-1)/mean, which gives the requested mean length
+            int length = 1;
+            while (length < 64 * mean && random.below(mean) != 0) ++length;
+            return length;
+        }
+            
+        case length_fixed:
+        default:
+            return mean;
+    }
+}
+
+/// \brief Generates options.size symbols of input for the specified DFA, returning false if that isn't possible
+static bool generate_input(const lexer_options& options, const ndfa& dfa, vector<int>& result) {
+    dfa_walker      walker(dfa);
+    random_source   random(options.seed);
+    int             failures = 0;
+    
+    result.clear();
+    result.reserve(options.size + 64 * options.tokenLength);
+    
+    while ((int) result.size() < options.size) {
+        if (!walker.generate(token_length(options, random), random, result)) {
+            // Give up if the DFA doesn't seem to accept anything
+            if (++failures > 1000) return false;
+        }
+    }
+    
+    result.resize(options.size);
+    return true;
+}
+
+/// \brief The number of bytes needed to encode some symbols as UTF-8
+static size_t utf8_size(const vector<int>& symbols) {
+    size_t result = 0;
+    
+    for (vector<int>::const_iterator symbol = symbols.begin(); symbol != symbols.end(); ++symbol) {
+        if (*symbol < 0x80)         result += 1;
+        else if (*symbol < 0x800)   result += 2;
+        else if (*symbol < 0x10000) result += 3;
+        else                        result += 4;
+    }
+    
+    return result;
+}
+
+//              ===========
+//               Workloads
+//
+
+/// \brief Console used to compile the grammars
+class lexer_benchmark_console : public std_console {
+private:
+    /// \brief The directory to search for imported files
+    wstring m_Directory;
+    
+public:
+    lexer_benchmark_console(const wstring& filename, const wstring& directory)
+    : std_console(filename)
+    , m_Directory(directory) {
+    }
+    
+    virtual console* clone() const {
+        return new lexer_benchmark_console(*this);
+    }
+    
+    virtual wstring get_option(const wstring& name) const {
+        if (name == L"silent")              return L"1";
+        if (name == L"suppress-warnings")   return L"1";
+        if (name == L"threads")             return L"1";
+        
+        return wstring();
+    }
+    
+    /// \brief Opens a file, looking in the directory containing the grammar if it isn't found in the current directory
+    virtual istream* open_file(const wstring& filename) {
+        istream* result = std_console::open_file(filename);
+        
+        if (!result && !filename.empty() && filename[0] != L'/') {
+            result = std_console::open_file(m_Directory + L"/" + filename);
+        }
+        
+        return result;
+    }
+};
+
+/// \brief Reads a UTF-8 file into a string, returning false if it can't be read
+static bool read_file(const string& filename, wstring& result) {
+    ifstream* source = new ifstream(filename.c_str(), ios::in | ios::binary);
+    if (!source->good()) {
+        delete source;
+        return false;
+    }
+    
+    utf8reader      reader(source, true);
+    wstringstream   text;
+    
+    for (;;) {
+        wchar_t nextChar;
+        reader.get(nextChar);
+        
+        if (!reader.good()) break;
+        
+        text << nextChar;
+    }
+    
+    result = text.str();
+    return true;
+}
+
+/// \brief Builds the DFA for the lexer of a language, returning NULL if it can't be built
+///
+/// This runs the same stages as language_compiler::compile_language as far as the lexer: the lexer it returns only
+/// contains the compiled tables, and the benchmark needs the DFA so that it can build each kind of lexer from it.
+static ndfa* compile_dfa(const string& path, const wstring& languageName) {
+    wstring definitionText;
+    
+    if (!read_file(path, definitionText)) {
+        cerr << "Could not read " << path << endl;
+        return NULL;
+    }
+    
+    wstring             filename(path.begin(), path.end());
+    wstring             directory(filename, 0, filename.rfind(L'/'));
+    console_container   console(new lexer_benchmark_console(filename, directory), true);
+    language_parser     parser;
+    
+    parser.set_filename(filename);
+    if (!parser.parse(definitionText)) {
+        cerr << "Could not parse " << path << endl;
+        return NULL;
+    }
+    
+    import_stage importStage(console, filename, parser.file_definition());
+    importStage.compile();
+    if (console->exit_code()) return NULL;
+    
+    language_builder_stage builderStage(console, filename, &importStage);
+    builderStage.compile();
+    if (console->exit_code()) return NULL;
+    
+    language_stage* languageStage = builderStage.language_with_name(languageName);
+    if (!languageStage) {
+        cerr << "Could not find the language " << string(languageName.begin(), languageName.end()) << " in " << path << endl;
+        return NULL;
+    }
+    
+    lexer_stage lexerStage(console, importStage.file_with_language(languageName), languageStage);
+    lexerStage.compile();
+    if (console->exit_code() || !lexerStage.dfa()) return NULL;
+    
+    // The stage owns its DFA
+    return new ndfa(*lexerStage.dfa());
+}
+
+/// \brief Measures the speed of a lexer on the generated input
+///
+/// Two things are measured: reading every lexeme from a stream (which is what a parser does), and splitting the
+/// input into tokens with tokenize_all (which creates no lexemes, so is closer to the speed of the state machine).
+static void benchmark_lexer(const lexer_options& options, const basic_lexer& lex, const string& name, const vector<int>& input, size_t inputBytes, measurement_list& results) {
+    const int*      begin           = &input[0];
+    const int*      end             = begin + input.size();
+    double          streamSeconds   = -1;
+    double          tokenSeconds    = -1;
+    long            lexemes         = 0;
+    long            rejected        = 0;
+    vector<token>   tokens;
+    
+    for (int run = 0; run < options.repeat; ++run) {
+        // Read the lexemes from a stream
+        stopwatch       streamTimer;
+        lexeme_stream*  stream      = lex.create_stream_from_symbols(begin, end);
+        
+        lexemes     = 0;
+        rejected    = 0;
+        
+        for (;;) {
+            lexeme* next;
+            (*stream) >> next;
+            if (!next) break;
+            
+            ++lexemes;
+            if (next->matched() < 0) ++rejected;
+            delete next;
+        }
+        
+        delete stream;
+        double streamElapsed = streamTimer.seconds();
+        
+        // Split the input into tokens
+        tokens.clear();
+        tokens.reserve(input.size());
+        
+        stopwatch tokenTimer;
+        lex.tokenize_all(begin, end, tokens);
+        double tokenElapsed = tokenTimer.seconds();
+        
+        if (streamSeconds < 0 || streamElapsed < streamSeconds) streamSeconds   = streamElapsed;
+        if (tokenSeconds < 0 || tokenElapsed < tokenSeconds)    tokenSeconds    = tokenElapsed;
+    }
+    
+    // Avoid dividing by zero on very fast runs
+    if (streamSeconds <= 0) streamSeconds   = 1e-9;
+    if (tokenSeconds <= 0)  tokenSeconds    = 1e-9;
+    
+    double megabytes = (double) inputBytes / (1024.0 * 1024.0);
+    
+    results.push_back(measurement(name + ".stream", "mb_per_second", megabytes / streamSeconds));
+    results.push_back(measurement(name + ".stream", "tokens_per_second", (double) lexemes / streamSeconds));
+    results.push_back(measurement(name + ".tokenize", "mb_per_second", megabytes / tokenSeconds));
+    results.push_back(measurement(name + ".tokenize", "tokens_per_second", (double) tokens.size() / tokenSeconds));
+    results.push_back(measurement(name, "table_bytes", (double) lex.size()));
+    results.push_back(measurement(name, "rejected", (double) rejected));
+}
+
+/// \brief A state machine that uses a symbol translator without the fast table for the first 256 symbols
+typedef state_machine<wchar_t, state_machine_flat_table, symbol_translator<wchar_t, symbol_table<wchar_t, symbol_level<symbol_level<int, 0xff, 0>, 0xff00, 8> > > > translated_state_machine;
+
+/// \brief Measures every kind of lexer that can be built from a DFA
+static bool benchmark_dfa(const lexer_options& options, const ndfa& dfa, const string& name, measurement_list& results) {
+    vector<int> input;
+    if (!generate_input(options, dfa, input)) {
+        cerr << "Could not generate any input for " << name << endl;
+        return false;
+    }
+    
+    string  workload    = "lexer_dfa." + name;
+    size_t  inputBytes  = utf8_size(input);
+    
+    // The lexer that language_compiler creates
+    {
+        lexer lex(dfa);
+        benchmark_lexer(options, lex, workload + ".lexer", input, inputBytes, results);
+    }
+    
+    // Table-driven lexers
+    {
+        dfa_lexer<wchar_t, state_machine_flat_table> lex(dfa);
+        benchmark_lexer(options, lex, workload + ".flat", input, inputBytes, results);
+    }
+    
+    {
+        dfa_lexer<wchar_t, state_machine_compact_table<> > lex(dfa);
+        benchmark_lexer(options, lex, workload + ".compact", input, inputBytes, results);
+    }
+    
+    {
+        dfa_lexer_base<translated_state_machine> lex(dfa);
+        benchmark_lexer(options, lex, workload + ".translator", input, inputBytes, results);
+    }
+    
+    if (packed_dfa_lexer<wchar_t, unsigned char>::fits(dfa)) {
+        packed_dfa_lexer<wchar_t, unsigned char> lex(dfa);
+        benchmark_lexer(options, lex, workload + ".packed8", input, inputBytes, results);
+    }
+    
+    if (packed_dfa_lexer<wchar_t, unsigned short>::fits(dfa)) {
+        packed_dfa_lexer<wchar_t, unsigned short> lex(dfa);
+        benchmark_lexer(options, lex, workload + ".packed16", input, inputBytes, results);
+    }
+    
+    {
+        comb_dfa_lexer<wchar_t> lex(dfa);
+        benchmark_lexer(options, lex, workload + ".comb", input, inputBytes, results);
+    }
+    
+    // The binary lexer, which uses a hard-coded symbol table
+    stringstream binaryStream;
+    binary_lexer::write_binary(binaryStream, dfa);
+    
+    string      binaryData = binaryStream.str();
+    vector<int> binaryBuffer(binaryData.size() / sizeof(int) + 1);
+    memcpy(&binaryBuffer[0], binaryData.data(), binaryData.size());
+    
+    binary_lexer* binaryLexer = binary_lexer::from_binary(&binaryBuffer[0], binaryData.size());
+    if (!binaryLexer) {
+        cerr << "Could not create a binary lexer for " << name << endl;
+        return false;
+    }
+    
+    benchmark_lexer(options, *binaryLexer, workload + ".binary", input, inputBytes, results);
+    delete binaryLexer;
+    
+    return true;
+}
+
+/// \brief Builds the DFA for a grammar and measures its lexers
+static bool benchmark_grammar(const lexer_options& options, const string& path, const string& languageName, const string& name, measurement_list& results) {
+    ndfa* dfa = compile_dfa(path, wstring(languageName.begin(), languageName.end()));
+    if (!dfa) {
+        cerr << "Could not compile " << path << endl;
+        return false;
+    }
+    
+    bool result = benchmark_dfa(options, *dfa, name, results);
+    delete dfa;
+    
+    return result;
+}
+
+//              ======
+//               Main
+//
+
+/// \brief Displays the command line options
+static void usage() {
+    cerr << "Usage: lexer_benchmark [options]" << endl << endl
+         << "  --examples DIR         directory containing the example grammars (default: Examples)" << endl
+         << "  --grammar FILE         measure the lexer for FILE instead of the examples" << endl
+         << "  --language NAME        the language in FILE to measure" << endl
+         << "  --size N               the number of symbols of input to generate (default: 1000000)" << endl
+         << "  --token-length N       the mean length of the generated tokens (default: 6)" << endl
+         << "  --distribution TYPE    how token lengths are chosen: fixed, uniform or geometric (default: geometric)" << endl
+         << "  --seed N               seed for the input generator (default: 1)" << endl
+         << "  --repeat N             run each workload N times and report the fastest (default: 5)" << endl
+         << "  --output FILE          also write the results to FILE" << endl;
+}
+
+int main(int argc, const char** argv) {
+    lexer_options   options;
+    string          outputFile;
+    
+    // Read the options
+    for (int arg = 1; arg < argc; ++arg) {
+        string option = argv[arg];
+        
+        if (option == "--help" || arg + 1 >= argc) {
+            usage();
+            return option == "--help" ? 0 : 1;
+        }
+        
+        string value = argv[++arg];
+        
+        if (option == "--examples")             options.examplesDir = value;
+        else if (option == "--grammar")         options.grammar     = value;
+        else if (option == "--language")        options.language    = value;
+        else if (option == "--size")            options.size        = atoi(value.c_str());
+        else if (option == "--token-length")    options.tokenLength = atoi(value.c_str());
+        else if (option == "--seed")            options.seed        = (unsigned int) strtoul(value.c_str(), NULL, 10);
+        else if (option == "--repeat")          options.repeat      = atoi(value.c_str());
+        else if (option == "--output")          outputFile          = value;
+        else if (option == "--distribution") {
+            if (value == "fixed")               options.distribution = length_fixed;
+            else if (value == "uniform")        options.distribution = length_uniform;
+            else if (value == "geometric")      options.distribution = length_geometric;
+            else {
+                usage();
+                return 1;
+            }
+        } else {
+            usage();
+            return 1;
+        }
+    }
+    
+    if (options.repeat < 1)         options.repeat      = 1;
+    if (options.size < 1)           options.size        = 1;
+    if (options.tokenLength < 1)    options.tokenLength = 1;
+    
+    if (!options.grammar.empty() && options.language.empty()) {
+        cerr << "--language must be specified with --grammar" << endl;
+        return 1;
+    }
+    
+    // Run the workloads
+    measurement_list    results;
+    bool                ok = true;
+    
+    if (!options.grammar.empty()) {
+        ok = benchmark_grammar(options, options.grammar, options.language, "custom", results) && ok;
+    } else {
+        ok = benchmark_grammar(options, options.examplesDir + "/AnsiC.tp", "Ansi-C", "c", results) && ok;
+        ok = benchmark_grammar(options, options.examplesDir + "/JsonPrettyPrinter/json.tp", "JSON", "json", results) && ok;
+    }
+    
+    // Display the results
+    write_report(cout, results);
+    
+    if (!outputFile.empty()) {
+        ofstream target(outputFile.c_str(), ios::out | ios::binary);
+        write_report(target, results);
+        
+        if (!target.good()) {
+            cerr << "Could not write " << outputFile << endl;
+            ok = false;
+        }
+    }
+    
+    return ok ? 0 : 1;
+}
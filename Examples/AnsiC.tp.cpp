@@ -0,0 +1,18349 @@
+///
+/// /root/repo/Examples/AnsiC.tp.cpp
+/// Parser file generated by TameParse at Wed 2026/10/14 18:54:28
+///
+
+#include "/root/repo/Examples/AnsiC.tp.h"
+
+#include "TameParse/Dfa/hard_coded_symbol_table.h"
+
+static const int s_SymbolMapTable[] = {
+        -1, 65536, 258, 516, 518, 520, 522, 524, 526, 528, 
+        530, 532, 534, 536, 538, 540, 542, 544, 546, 548, 
+        550, 552, 554, 556, 558, 560, 562, 564, 566, 568, 
+        570, 572, 574, 576, 578, 580, 582, 584, 586, 588, 
+        590, 592, 594, 596, 598, 600, 602, 604, 606, 608, 
+        610, 612, 614, 616, 618, 620, 622, 624, 626, 628, 
+        630, 632, 634, 636, 638, 640, 642, 644, 646, 648, 
+        650, 652, 654, 656, 658, 660, 662, 664, 666, 668, 
+        670, 672, 674, 676, 678, 680, 682, 684, 686, 688, 
+        690, 692, 694, 696, 698, 700, 702, 704, 706, 708, 
+        710, 712, 714, 716, 718, 720, 722, 724, 726, 728, 
+        730, 732, 734, 736, 738, 740, 742, 744, 746, 748, 
+        750, 752, 754, 756, 758, 760, 762, 764, 766, 768, 
+        770, 772, 774, 776, 778, 780, 782, 784, 786, 788, 
+        790, 792, 794, 796, 798, 800, 802, 804, 806, 808, 
+        810, 812, 814, 816, 818, 820, 822, 824, 826, 828, 
+        830, 832, 834, 836, 838, 840, 842, 844, 846, 848, 
+        850, 852, 854, 856, 858, 860, 862, 864, 866, 868, 
+        870, 872, 874, 876, 878, 880, 882, 884, 886, 888, 
+        890, 892, 894, 896, 898, 900, 902, 904, 906, 908, 
+        910, 912, 914, 916, 918, 920, 922, 924, 926, 928, 
+        930, 932, 934, 936, 938, 940, 942, 944, 946, 948, 
+        950, 952, 954, 956, 958, 960, 962, 964, 966, 968, 
+        970, 972, 974, 976, 978, 980, 982, 984, 986, 988, 
+        990, 992, 994, 996, 998, 1000, 1002, 1004, 1006, 1008, 
+        1010, 1012, 1014, 1016, 1018, 1020, 1022, 1024, -1, 65536, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 46, 
+        46, 53, 53, 46, 53, 53, 53, 53, 53, 53, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 
+        53, 53, 46, 1, 45, 53, 53, 3, 4, 35, 
+        14, 15, 5, 6, 16, 7, 9, 10, 36, 37, 
+        37, 37, 37, 37, 37, 37, 37, 37, 17, 18, 
+        11, 2, 8, 19, 53, 58, 58, 58, 58, 55, 
+        57, 61, 61, 61, 61, 61, 34, 61, 61, 61, 
+        61, 61, 61, 61, 61, 54, 61, 61, 56, 61, 
+        61, 20, 52, 21, 12, 61, 53, 25, 29, 32, 
+        40, 31, 39, 42, 51, 41, 61, 50, 38, 60, 
+        47, 28, 62, 61, 30, 33, 27, 26, 44, 43, 
+        49, 48, 59, 22, 13, 23, 24, 53, 53, 53, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 
+        53, 53, 53, 53, 53, 53, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 
+        53, 0, 53, 0, 53, 0
+    };
+
+static const int s_SymbolMapFast[256] = {
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 46, 46, 53, 53, 46, 53, 53, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 
+        46, 1, 45, 53, 53, 3, 4, 35, 14, 15, 5, 6, 16, 7, 9, 10, 
+        36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 17, 18, 11, 2, 8, 19, 
+        53, 58, 58, 58, 58, 55, 57, 61, 61, 61, 61, 61, 34, 61, 61, 61, 
+        61, 61, 61, 61, 61, 54, 61, 61, 56, 61, 61, 20, 52, 21, 12, 61, 
+        53, 25, 29, 32, 40, 31, 39, 42, 51, 41, 61, 50, 38, 60, 47, 28, 
+        62, 61, 30, 33, 27, 26, 44, 43, 49, 48, 59, 22, 13, 23, 24, 53, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53
+    };
+
+static const dfa::hard_coded_fast_symbol_table<wchar_t, 2> s_SymbolMap(s_SymbolMapFast, s_SymbolMapTable);
+
+#include "TameParse/Dfa/state_machine.h"
+
+#include "TameParse/Dfa/skip_state.h"
+
+static const dfa::skip_state s_SkipStates[] = {
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 3, { 34, 92, 65536, 0, 0, 0 }, { 35, 93, 2147483647, 0, 0, 0 }, { 34, 92, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 3, { 39, 92, 65536, 0, 0, 0 }, { 40, 93, 2147483647, 0, 0, 0 }, { 39, 92, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 1, { 42, 0, 0, 0, 0, 0 }, { 43, 0, 0, 0, 0, 0 }, { 42, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }, 
+        { 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 127, 127, 127, 127 } }
+    };
+
+static const unsigned char s_LexerStateMachine[] = {
+
+        // State 0
+        0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 
+        17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 
+        33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 1
+        0, 0, 219, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 2
+        0, 0, 218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 3
+        0, 0, 217, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 4
+        0, 0, 215, 0, 216, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 5
+        0, 0, 214, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 6
+        0, 0, 212, 0, 0, 0, 213, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 7
+        0, 0, 209, 0, 0, 0, 0, 210, 211, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 8
+        0, 0, 206, 0, 0, 0, 0, 0, 207, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 9
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 204, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 89, 89, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 10
+        0, 0, 196, 0, 0, 197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 11
+        0, 0, 193, 0, 0, 0, 0, 0, 0, 0, 0, 194, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 12
+        0, 0, 192, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 13
+        0, 0, 190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 191, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 14
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 15
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 16
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 17
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 18
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 19
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 20
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 21
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 22
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 23
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 24
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 25
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 187, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 26
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 177, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 27
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        171, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 28
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 29
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 167, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 30
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 156, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 31
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 146, 29, 29, 29, 29, 29, 29, 0, 0, 145, 
+        29, 147, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 32
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 29, 29, 131, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 132, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 33
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 103, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 105, 29, 106, 29, 0, 0, 29, 
+        29, 29, 29, 104, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 34
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 36, 29, 29, 29, 29, 29, 29, 29, 29, 29, 46, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 35
+        0, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 
+        100, 100, 100, 0, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 
+        100, 100, 100, 100, 101, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 0, 
+
+        // State 36
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 0, 0, 0, 0, 91, 
+        0, 0, 90, 0, 95, 95, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 96, 0, 0, 0, 0, 90, 91, 96, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 37
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 0, 0, 0, 0, 91, 
+        0, 0, 90, 0, 38, 38, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 90, 91, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 38
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 86, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 39
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 80, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 81, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 40
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 69, 29, 29, 70, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 41
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 67, 29, 29, 29, 29, 29, 0, 0, 66, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 42
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 63, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 43
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 59, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 44
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 50, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 45
+        0, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 
+        46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 
+        46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 49, 46, 46, 
+        46, 46, 46, 46, 48, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 0, 
+
+        // State 46
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 47
+        0, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 
+        46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 
+        46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 
+        46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 0, 
+
+        // State 48
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 49
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 51, 29, 29, 52, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 50
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 51
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 53, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 52
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 53
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 55, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 54
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 56, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 55
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 57, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 56
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 58, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 57
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 58
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 60, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 59
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 61, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 60
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 62, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 61
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 62
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 64, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 63
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 65, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 64
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 65
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 68, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 66
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 67
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 68
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 76, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 69
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 71, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 70
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 71
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 73, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 72
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 74, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 73
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 75, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 74
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 75
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 77, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 76
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 78, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 77
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 79, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 78
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 79
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 85, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 80
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 82, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 81
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 82
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 84, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 83
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 84
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 85
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 87, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 86
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 88, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 87
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 88
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 91, 
+        0, 0, 94, 0, 89, 89, 94, 94, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 91, 0, 94, 0, 0, 0, 0, 0, 0, 
+
+        // State 89
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 0, 0, 0, 0, 0, 
+        0, 0, 90, 0, 0, 0, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 90
+        0, 0, 0, 0, 0, 0, 92, 92, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 93, 93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 91
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 93, 93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 92
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 94, 0, 93, 93, 94, 94, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 94, 0, 0, 0, 0, 0, 0, 
+
+        // State 93
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 94
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 99, 0, 0, 0, 0, 91, 
+        0, 0, 99, 0, 95, 95, 99, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 99, 91, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 95
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 0, 0, 0, 97, 0, 97, 
+        97, 0, 0, 0, 97, 97, 0, 97, 97, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 97, 0, 97, 97, 0, 0, 0, 0, 0, 
+
+        // State 96
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 98, 0, 0, 97, 0, 97, 
+        97, 0, 98, 0, 97, 97, 98, 97, 97, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 98, 97, 0, 97, 97, 0, 0, 0, 0, 0, 
+
+        // State 97
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 98, 0, 0, 0, 0, 0, 
+        0, 0, 98, 0, 0, 0, 98, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 98, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 98
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 99, 0, 0, 0, 0, 0, 
+        0, 0, 99, 0, 0, 0, 99, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 99, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 99
+        0, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 
+        100, 100, 100, 102, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 
+        100, 100, 100, 100, 101, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 0, 
+
+        // State 100
+        0, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 0, 
+
+        // State 101
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 102
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 122, 29, 29, 29, 29, 123, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 103
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 119, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 104
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 111, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 112, 29, 29, 29, 0, 
+
+        // State 105
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 107, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 106
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 108, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 107
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        109, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 108
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 110, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 109
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 110
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 116, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 111
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 113, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 112
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 114, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 113
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 115, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 114
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 115
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 117, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 116
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 118, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 117
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 118
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 120, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 119
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 121, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 120
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 121
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 127, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 122
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 124, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 123
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        125, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 124
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 126, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 125
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 126
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 128, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 127
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        129, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 128
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 129
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 143, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 130
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 135, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 131
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 133, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 132
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 134, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 133
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 134
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 136, 29, 29, 29, 29, 
+        29, 137, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 135
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 139, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 136
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 138, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 137
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 138
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 140, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 139
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 141, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 140
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 142, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 141
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 142
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 144, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 143
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 144
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 154, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 145
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 152, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 146
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 148, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 147
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 149, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 148
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 150, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 149
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 151, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 150
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 151
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 153, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 152
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 153
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 155, 29, 29, 0, 
+
+        // State 154
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 155
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 157, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 158, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 156
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 164, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 157
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 159, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 158
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 160, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 159
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 161, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 160
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 162, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 161
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 163, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 162
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 163
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 165, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 164
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 166, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 165
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 166
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 168, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 167
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 169, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 168
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 170, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 169
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 170
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 172, 0, 
+
+        // State 171
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 173, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 172
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 174, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 173
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 175, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 174
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 176, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 175
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 176
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 178, 29, 0, 29, 29, 29, 29, 29, 179, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 177
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 182, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 178
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 180, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 179
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 181, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 180
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 181
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 183, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 182
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 184, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 183
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 185, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 184
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 186, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 185
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 186
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 188, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 187
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 189, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 188
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 
+        29, 29, 29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 
+        29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 
+
+        // State 189
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 190
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 191
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 192
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 193
+        0, 0, 195, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 194
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 195
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 196
+        0, 198, 198, 198, 198, 199, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 
+        198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 
+        198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 
+        198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 
+
+        // State 197
+        0, 198, 198, 198, 198, 203, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 
+        198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 
+        198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 
+        198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 
+
+        // State 198
+        0, 198, 198, 198, 198, 198, 198, 198, 198, 198, 200, 198, 198, 198, 198, 198, 
+        198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 
+        198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 
+        198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 
+
+        // State 199
+        0, 0, 0, 0, 0, 201, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 200
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 202, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 201
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 202
+        0, 198, 198, 198, 198, 198, 198, 198, 198, 198, 202, 198, 198, 198, 198, 198, 
+        198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 
+        198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 
+        198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 
+
+        // State 203
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 205, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 204
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 205
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 206
+        0, 0, 208, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 207
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 208
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 209
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 210
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 211
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 212
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 213
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 214
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 215
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 216
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 217
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+        // State 218
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+    };
+
+typedef dfa::state_machine_flat_tables<wchar_t, dfa::hard_coded_fast_symbol_table<wchar_t, 2>, unsigned char> lexer_state_machine;
+static const lexer_state_machine s_StateMachine(s_SymbolMap, s_LexerStateMachine, 219, 64);
+
+static const int s_AcceptingStates[] = {
+        -1, 56, 73, 58, 51, 52, 53, 54, 62, 46, 57, 61, 67, 68, 42, 43, 50, 72, 84, 71, 44, 45, 85, 86, 55, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, -1, 35, 35, 32, 32, 32, 32, 32, 32, 32, -1, 39, -1, 38, 32, 32, 32, 29, 32, 32, 32, 32, 30, 32, 32, 32, 31, 32, 32, 14, 32, 15, 16, 7, 32, 32, 32, 32, 32, 6, 32, 32, 32, 8, 32, 32, 32, 32, 12, 13, 32, 32, 17, 37, 35, -1, -1, 37, 37, 34, -1, 33, 33, 34, -1, -1, 36, 32, 32, 32, 32, 32, 32, 32, 25, 32, 32, 32, 32, 22, 32, 32, 21, 32, 32, 20, 32, 32, 32, 32, 24, 32, 32, 23, 32, 32, 32, 32, 3, 32, 32, 32, 4, 32, 32, 32, 5, 32, 2, 32, 32, 32, 32, 32, 32, 11, 32, 9, 32, 10, 32, 32, 32, 32, 32, 32, 32, 18, 32, 32, 19, 32, 32, 32, 1, 32, 32, 32, 32, 32, 26, 32, 32, 32, 32, 27, 32, 32, 32, 32, 28, 32, 32, 0, 83, 70, 82, 63, 59, 79, 75, -1, -1, -1, 39, -1, 39, -1, -1, 87, 64, 60, 80, 78, 49, 47, 77, 48, 74, 81, 69, 76, 65, 66
+    };
+
+typedef dfa::dfa_lexer_base<const lexer_state_machine&, 0, 0, false, const lexer_state_machine&> lexer_definition;
+static lexer_definition s_LexerDefinition(s_StateMachine, 207, s_AcceptingStates, s_SkipStates);
+
+const dfa::lexer Ansi_C::lexer(&s_LexerDefinition, false);
+
+size_t Ansi_C::tokenize(dfa::token_cursor& cursor, dfa::token* tokens, size_t maxTokens) {
+    return s_LexerDefinition.lexer_definition::tokenize(cursor, tokens, maxTokens);
+}
+
+void Ansi_C::tokenize_all(const int* begin, const int* end, std::vector<dfa::token>& tokens) {
+    s_LexerDefinition.tokenize_all(begin, end, tokens);
+}
+
+#include "TameParse/Lr/parser_tables.h"
+#include "TameParse/Lr/compact_parser_tables.h"
+
+static const lr::small_parser_tables::action s_TerminalActions_data[] = {
+
+    // State 0
+    { 0, 2, 0 }, { 0, 3, 3 }, { 0, 4, 4 }, { 0, 5, 8 }, { 0, 6, 10 }, 
+    { 0, 7, 11 }, { 0, 8, 12 }, { 0, 9, 16 }, { 0, 10, 17 }, { 0, 11, 18 }, 
+    { 0, 12, 20 }, { 0, 13, 21 }, { 0, 14, 23 }, { 0, 15, 24 }, { 0, 16, 26 }, 
+    { 0, 17, 27 }, { 0, 18, 28 }, { 0, 19, 29 }, { 0, 20, 30 }, { 8, 1, 32 }, 
+    { 0, 21, 32 }, { 2, 0, 39 }, { 2, 0, 40 }, { 2, 0, 41 }, { 8, 1, 42 }, 
+    { 8, 1, 52 }
+
+    // State 1
+    , { 3, 0, 32 }, { 2, 1, 39 }, { 2, 1, 40 }, { 2, 1, 41 }, 
+    { 3, 0, 42 }, { 0, 37, 52 }
+
+    // State 2
+    , { 3, 1, 0 }, { 3, 1, 3 }, { 3, 1, 4 }, 
+    { 3, 1, 8 }, { 3, 1, 10 }, { 3, 1, 11 }, { 3, 1, 12 }, { 3, 1, 16 }, 
+    { 3, 1, 17 }, { 3, 1, 18 }, { 3, 1, 20 }, { 3, 1, 21 }, { 3, 1, 23 }, 
+    { 3, 1, 24 }, { 3, 1, 26 }, { 3, 1, 27 }, { 3, 1, 28 }, { 3, 1, 29 }, 
+    { 3, 1, 30 }, { 8, 1, 32 }, { 8, 43, 32 }, { 8, 263, 32 }, { 3, 1, 32 }, 
+    { 2, 2, 39 }, { 2, 2, 40 }, { 2, 2, 41 }, { 8, 1, 42 }, { 8, 43, 42 }, 
+    { 8, 263, 42 }, { 3, 1, 42 }, { 3, 1, 43 }, { 3, 1, 44 }, { 3, 1, 50 }, 
+    { 8, 1, 52 }, { 8, 43, 52 }, { 8, 263, 52 }, { 3, 1, 52 }, { 8, 43, 84 }
+
+    // State 3
+    , { 3, 2, 0 }, { 3, 2, 3 }, { 3, 2, 4 }, { 3, 2, 8 }, { 3, 2, 10 }, 
+    { 3, 2, 11 }, { 3, 2, 12 }, { 3, 2, 16 }, { 3, 2, 17 }, { 3, 2, 18 }, 
+    { 3, 2, 20 }, { 3, 2, 21 }, { 3, 2, 23 }, { 3, 2, 24 }, { 3, 2, 26 }, 
+    { 3, 2, 27 }, { 3, 2, 28 }, { 3, 2, 29 }, { 3, 2, 30 }, { 8, 263, 32 }, 
+    { 8, 163, 32 }, { 8, 43, 32 }, { 8, 1, 32 }, { 3, 2, 32 }, { 2, 3, 39 }, 
+    { 2, 3, 40 }, { 2, 3, 41 }, { 8, 1, 42 }, { 8, 43, 42 }, { 8, 163, 42 }, 
+    { 8, 263, 42 }, { 3, 2, 42 }, { 3, 2, 43 }, { 3, 2, 44 }, { 3, 2, 50 }, 
+    { 8, 1, 52 }, { 8, 43, 52 }, { 8, 163, 52 }, { 8, 263, 52 }, { 3, 2, 52 }, 
+    { 8, 163, 72 }, { 8, 43, 84 }
+
+    // State 4
+    , { 3, 3, 0 }, { 3, 3, 3 }, { 3, 3, 4 }, 
+    { 3, 3, 8 }, { 3, 3, 10 }, { 3, 3, 11 }, { 3, 3, 12 }, { 3, 3, 16 }, 
+    { 3, 3, 17 }, { 3, 3, 18 }, { 3, 3, 20 }, { 3, 3, 21 }, { 3, 3, 23 }, 
+    { 3, 3, 24 }, { 3, 3, 26 }, { 3, 3, 27 }, { 3, 3, 28 }, { 3, 3, 29 }, 
+    { 3, 3, 30 }, { 8, 263, 32 }, { 8, 163, 32 }, { 8, 43, 32 }, { 8, 1, 32 }, 
+    { 3, 3, 32 }, { 2, 4, 39 }, { 2, 4, 40 }, { 2, 4, 41 }, { 8, 1, 42 }, 
+    { 8, 43, 42 }, { 8, 163, 42 }, { 8, 263, 42 }, { 3, 3, 42 }, { 3, 3, 43 }, 
+    { 3, 3, 44 }, { 3, 3, 50 }, { 8, 1, 52 }, { 8, 43, 52 }, { 8, 163, 52 }, 
+    { 8, 263, 52 }, { 3, 3, 52 }, { 8, 163, 72 }, { 8, 43, 84 }
+
+    // State 5
+    , { 3, 4, 0 }, 
+    { 3, 4, 3 }, { 3, 4, 4 }, { 3, 4, 8 }, { 3, 4, 10 }, { 3, 4, 11 }, 
+    { 3, 4, 12 }, { 3, 4, 16 }, { 3, 4, 17 }, { 3, 4, 18 }, { 3, 4, 20 }, 
+    { 3, 4, 21 }, { 3, 4, 23 }, { 3, 4, 24 }, { 3, 4, 26 }, { 3, 4, 27 }, 
+    { 3, 4, 28 }, { 3, 4, 29 }, { 3, 4, 30 }, { 8, 263, 32 }, { 8, 163, 32 }, 
+    { 8, 43, 32 }, { 8, 1, 32 }, { 3, 4, 32 }, { 2, 5, 39 }, { 2, 5, 40 }, 
+    { 2, 5, 41 }, { 8, 1, 42 }, { 8, 43, 42 }, { 8, 163, 42 }, { 8, 263, 42 }, 
+    { 3, 4, 42 }, { 3, 4, 43 }, { 3, 4, 44 }, { 3, 4, 50 }, { 8, 1, 52 }, 
+    { 8, 43, 52 }, { 8, 163, 52 }, { 8, 263, 52 }, { 3, 4, 52 }, { 8, 163, 72 }, 
+    { 8, 43, 84 }
+
+    // State 6
+    , { 0, 41, 32 }, { 2, 6, 39 }, { 2, 6, 40 }, { 2, 6, 41 }, 
+    { 3, 5, 85 }
+
+    // State 7
+    , { 3, 6, 0 }, { 3, 6, 3 }, { 3, 6, 4 }, { 3, 6, 8 }, 
+    { 3, 6, 10 }, { 3, 6, 11 }, { 3, 6, 12 }, { 3, 6, 16 }, { 3, 6, 17 }, 
+    { 3, 6, 18 }, { 3, 6, 20 }, { 3, 6, 21 }, { 3, 6, 23 }, { 3, 6, 24 }, 
+    { 3, 6, 26 }, { 3, 6, 27 }, { 3, 6, 28 }, { 3, 6, 29 }, { 3, 6, 30 }, 
+    { 8, 1, 32 }, { 8, 43, 32 }, { 8, 263, 32 }, { 3, 6, 32 }, { 2, 7, 39 }, 
+    { 2, 7, 40 }, { 2, 7, 41 }, { 8, 1, 42 }, { 8, 43, 42 }, { 8, 263, 42 }, 
+    { 3, 6, 42 }, { 3, 6, 43 }, { 3, 6, 44 }, { 3, 6, 50 }, { 8, 1, 52 }, 
+    { 8, 43, 52 }, { 8, 263, 52 }, { 3, 6, 52 }, { 8, 43, 84 }
+
+    // State 8
+    , { 3, 7, 0 }, 
+    { 3, 7, 3 }, { 3, 7, 4 }, { 3, 7, 8 }, { 3, 7, 10 }, { 3, 7, 11 }, 
+    { 3, 7, 12 }, { 3, 7, 16 }, { 3, 7, 17 }, { 3, 7, 18 }, { 3, 7, 20 }, 
+    { 3, 7, 21 }, { 3, 7, 23 }, { 3, 7, 24 }, { 3, 7, 26 }, { 3, 7, 27 }, 
+    { 3, 7, 28 }, { 3, 7, 29 }, { 3, 7, 30 }, { 8, 263, 32 }, { 8, 163, 32 }, 
+    { 8, 43, 32 }, { 8, 1, 32 }, { 3, 7, 32 }, { 2, 8, 39 }, { 2, 8, 40 }, 
+    { 2, 8, 41 }, { 8, 1, 42 }, { 8, 43, 42 }, { 8, 163, 42 }, { 8, 263, 42 }, 
+    { 3, 7, 42 }, { 3, 7, 43 }, { 3, 7, 44 }, { 3, 7, 50 }, { 8, 1, 52 }, 
+    { 8, 43, 52 }, { 8, 163, 52 }, { 8, 263, 52 }, { 3, 7, 52 }, { 8, 163, 72 }, 
+    { 8, 43, 84 }
+
+    // State 9
+    , { 3, 8, 0 }, { 3, 8, 3 }, { 3, 8, 4 }, { 3, 8, 8 }, 
+    { 3, 8, 10 }, { 3, 8, 11 }, { 3, 8, 12 }, { 3, 8, 16 }, { 3, 8, 17 }, 
+    { 3, 8, 18 }, { 3, 8, 20 }, { 3, 8, 21 }, { 3, 8, 23 }, { 3, 8, 24 }, 
+    { 3, 8, 26 }, { 3, 8, 27 }, { 3, 8, 28 }, { 3, 8, 29 }, { 3, 8, 30 }, 
+    { 8, 263, 32 }, { 8, 163, 32 }, { 8, 43, 32 }, { 8, 1, 32 }, { 3, 8, 32 }, 
+    { 2, 9, 39 }, { 2, 9, 40 }, { 2, 9, 41 }, { 8, 1, 42 }, { 8, 43, 42 }, 
+    { 8, 163, 42 }, { 8, 263, 42 }, { 3, 8, 42 }, { 3, 8, 43 }, { 3, 8, 44 }, 
+    { 3, 8, 50 }, { 8, 1, 52 }, { 8, 43, 52 }, { 8, 163, 52 }, { 8, 263, 52 }, 
+    { 3, 8, 52 }, { 8, 163, 72 }, { 8, 43, 84 }
+
+    // State 10
+    , { 3, 9, 0 }, { 3, 9, 3 }, 
+    { 3, 9, 4 }, { 3, 9, 8 }, { 3, 9, 10 }, { 3, 9, 11 }, { 3, 9, 12 }, 
+    { 3, 9, 16 }, { 3, 9, 17 }, { 3, 9, 18 }, { 3, 9, 20 }, { 3, 9, 21 }, 
+    { 3, 9, 23 }, { 3, 9, 24 }, { 3, 9, 26 }, { 3, 9, 27 }, { 3, 9, 28 }, 
+    { 3, 9, 29 }, { 3, 9, 30 }, { 8, 263, 32 }, { 8, 163, 32 }, { 8, 43, 32 }, 
+    { 8, 1, 32 }, { 3, 9, 32 }, { 2, 10, 39 }, { 2, 10, 40 }, { 2, 10, 41 }, 
+    { 8, 1, 42 }, { 8, 43, 42 }, { 8, 163, 42 }, { 8, 263, 42 }, { 3, 9, 42 }, 
+    { 3, 9, 43 }, { 3, 9, 44 }, { 3, 9, 50 }, { 8, 1, 52 }, { 8, 43, 52 }, 
+    { 8, 163, 52 }, { 8, 263, 52 }, { 3, 9, 52 }, { 8, 163, 72 }, { 8, 43, 84 }
+
+    // State 11
+    , { 3, 10, 0 }, { 3, 10, 3 }, { 3, 10, 4 }, { 3, 10, 8 }, { 3, 10, 10 }, 
+    { 3, 10, 11 }, { 3, 10, 12 }, { 3, 10, 16 }, { 3, 10, 17 }, { 3, 10, 18 }, 
+    { 3, 10, 20 }, { 3, 10, 21 }, { 3, 10, 23 }, { 3, 10, 24 }, { 3, 10, 26 }, 
+    { 3, 10, 27 }, { 3, 10, 28 }, { 3, 10, 29 }, { 3, 10, 30 }, { 8, 1, 32 }, 
+    { 8, 43, 32 }, { 8, 263, 32 }, { 3, 10, 32 }, { 2, 11, 39 }, { 2, 11, 40 }, 
+    { 2, 11, 41 }, { 8, 1, 42 }, { 8, 43, 42 }, { 8, 263, 42 }, { 3, 10, 42 }, 
+    { 3, 10, 43 }, { 3, 10, 44 }, { 3, 10, 50 }, { 8, 1, 52 }, { 8, 43, 52 }, 
+    { 8, 263, 52 }, { 3, 10, 52 }, { 8, 43, 84 }
+
+    // State 12
+    , { 3, 11, 0 }, { 3, 11, 3 }, 
+    { 3, 11, 4 }, { 3, 11, 8 }, { 3, 11, 10 }, { 3, 11, 11 }, { 3, 11, 12 }, 
+    { 3, 11, 16 }, { 3, 11, 17 }, { 3, 11, 18 }, { 3, 11, 20 }, { 3, 11, 21 }, 
+    { 3, 11, 23 }, { 3, 11, 24 }, { 3, 11, 26 }, { 3, 11, 27 }, { 3, 11, 28 }, 
+    { 3, 11, 29 }, { 3, 11, 30 }, { 8, 263, 32 }, { 8, 163, 32 }, { 8, 43, 32 }, 
+    { 8, 1, 32 }, { 3, 11, 32 }, { 2, 12, 39 }, { 2, 12, 40 }, { 2, 12, 41 }, 
+    { 8, 1, 42 }, { 8, 43, 42 }, { 8, 163, 42 }, { 8, 263, 42 }, { 3, 11, 42 }, 
+    { 3, 11, 43 }, { 3, 11, 44 }, { 3, 11, 50 }, { 8, 1, 52 }, { 8, 43, 52 }, 
+    { 8, 163, 52 }, { 8, 263, 52 }, { 3, 11, 52 }, { 8, 163, 72 }, { 8, 43, 84 }
+
+    // State 13
+    , { 3, 12, 0 }, { 3, 12, 3 }, { 3, 12, 4 }, { 3, 12, 8 }, { 3, 12, 10 }, 
+    { 3, 12, 11 }, { 3, 12, 12 }, { 3, 12, 16 }, { 3, 12, 17 }, { 3, 12, 18 }, 
+    { 3, 12, 20 }, { 3, 12, 21 }, { 3, 12, 23 }, { 3, 12, 24 }, { 3, 12, 26 }, 
+    { 3, 12, 27 }, { 3, 12, 28 }, { 3, 12, 29 }, { 3, 12, 30 }, { 8, 263, 32 }, 
+    { 8, 163, 32 }, { 8, 43, 32 }, { 8, 1, 32 }, { 3, 12, 32 }, { 2, 13, 39 }, 
+    { 2, 13, 40 }, { 2, 13, 41 }, { 8, 1, 42 }, { 8, 43, 42 }, { 8, 163, 42 }, 
+    { 8, 263, 42 }, { 3, 12, 42 }, { 3, 12, 43 }, { 3, 12, 44 }, { 3, 12, 50 }, 
+    { 8, 1, 52 }, { 8, 43, 52 }, { 8, 163, 52 }, { 8, 263, 52 }, { 3, 12, 52 }, 
+    { 8, 163, 72 }, { 8, 43, 84 }
+
+    // State 14
+    , { 3, 13, 0 }, { 3, 13, 3 }, { 3, 13, 4 }, 
+    { 3, 13, 8 }, { 3, 13, 10 }, { 3, 13, 11 }, { 3, 13, 12 }, { 3, 13, 16 }, 
+    { 3, 13, 17 }, { 3, 13, 18 }, { 3, 13, 20 }, { 3, 13, 21 }, { 3, 13, 23 }, 
+    { 3, 13, 24 }, { 3, 13, 26 }, { 3, 13, 27 }, { 3, 13, 28 }, { 3, 13, 29 }, 
+    { 3, 13, 30 }, { 8, 1, 32 }, { 8, 43, 32 }, { 8, 263, 32 }, { 3, 13, 32 }, 
+    { 2, 14, 39 }, { 2, 14, 40 }, { 2, 14, 41 }, { 8, 1, 42 }, { 8, 43, 42 }, 
+    { 8, 263, 42 }, { 3, 13, 42 }, { 3, 13, 43 }, { 3, 13, 44 }, { 3, 13, 50 }, 
+    { 8, 1, 52 }, { 8, 43, 52 }, { 8, 263, 52 }, { 3, 13, 52 }, { 8, 43, 84 }
+
+    // State 15
+    , { 3, 14, 32 }, { 2, 15, 39 }, { 2, 15, 40 }, { 2, 15, 41 }, { 3, 14, 85 }
+
+    // State 16
+    , { 3, 15, 0 }, { 3, 15, 3 }, { 3, 15, 4 }, { 3, 15, 8 }, { 3, 15, 10 }, 
+    { 3, 15, 11 }, { 3, 15, 12 }, { 3, 15, 16 }, { 3, 15, 17 }, { 3, 15, 18 }, 
+    { 3, 15, 20 }, { 3, 15, 21 }, { 3, 15, 23 }, { 3, 15, 24 }, { 3, 15, 26 }, 
+    { 3, 15, 27 }, { 3, 15, 28 }, { 3, 15, 29 }, { 3, 15, 30 }, { 8, 1, 32 }, 
+    { 8, 43, 32 }, { 8, 263, 32 }, { 3, 15, 32 }, { 2, 16, 39 }, { 2, 16, 40 }, 
+    { 2, 16, 41 }, { 8, 1, 42 }, { 8, 43, 42 }, { 8, 263, 42 }, { 3, 15, 42 }, 
+    { 3, 15, 43 }, { 3, 15, 44 }, { 3, 15, 50 }, { 8, 1, 52 }, { 8, 43, 52 }, 
+    { 8, 263, 52 }, { 3, 15, 52 }, { 8, 43, 84 }
+
+    // State 17
+    , { 3, 16, 32 }, { 2, 17, 39 }, 
+    { 2, 17, 40 }, { 2, 17, 41 }, { 3, 16, 85 }
+
+    // State 18
+    , { 3, 17, 0 }, { 3, 17, 3 }, 
+    { 3, 17, 4 }, { 3, 17, 8 }, { 3, 17, 10 }, { 3, 17, 11 }, { 3, 17, 12 }, 
+    { 3, 17, 16 }, { 3, 17, 17 }, { 3, 17, 18 }, { 3, 17, 20 }, { 3, 17, 21 }, 
+    { 3, 17, 23 }, { 3, 17, 24 }, { 3, 17, 26 }, { 3, 17, 27 }, { 3, 17, 28 }, 
+    { 3, 17, 29 }, { 3, 17, 30 }, { 8, 263, 32 }, { 8, 163, 32 }, { 8, 43, 32 }, 
+    { 8, 1, 32 }, { 3, 17, 32 }, { 2, 18, 39 }, { 2, 18, 40 }, { 2, 18, 41 }, 
+    { 8, 1, 42 }, { 8, 43, 42 }, { 8, 163, 42 }, { 8, 263, 42 }, { 3, 17, 42 }, 
+    { 3, 17, 43 }, { 3, 17, 44 }, { 3, 17, 50 }, { 8, 1, 52 }, { 8, 43, 52 }, 
+    { 8, 163, 52 }, { 8, 263, 52 }, { 3, 17, 52 }, { 8, 163, 72 }, { 8, 43, 84 }
+
+    // State 19
+    , { 3, 18, 0 }, { 3, 18, 3 }, { 3, 18, 4 }, { 3, 18, 8 }, { 3, 18, 10 }, 
+    { 3, 18, 11 }, { 3, 18, 12 }, { 3, 18, 16 }, { 3, 18, 17 }, { 3, 18, 18 }, 
+    { 3, 18, 20 }, { 3, 18, 21 }, { 3, 18, 23 }, { 3, 18, 24 }, { 3, 18, 26 }, 
+    { 3, 18, 27 }, { 3, 18, 28 }, { 3, 18, 29 }, { 3, 18, 30 }, { 8, 263, 32 }, 
+    { 8, 163, 32 }, { 8, 43, 32 }, { 8, 1, 32 }, { 3, 18, 32 }, { 2, 19, 39 }, 
+    { 2, 19, 40 }, { 2, 19, 41 }, { 8, 1, 42 }, { 8, 43, 42 }, { 8, 163, 42 }, 
+    { 8, 263, 42 }, { 3, 18, 42 }, { 3, 18, 43 }, { 3, 18, 44 }, { 3, 18, 50 }, 
+    { 8, 1, 52 }, { 8, 43, 52 }, { 8, 163, 52 }, { 8, 263, 52 }, { 3, 18, 52 }, 
+    { 8, 163, 72 }, { 8, 43, 84 }
+
+    // State 20
+    , { 3, 19, 0 }, { 3, 19, 3 }, { 3, 19, 4 }, 
+    { 3, 19, 8 }, { 3, 19, 10 }, { 3, 19, 11 }, { 3, 19, 12 }, { 3, 19, 16 }, 
+    { 3, 19, 17 }, { 3, 19, 18 }, { 3, 19, 20 }, { 3, 19, 21 }, { 3, 19, 23 }, 
+    { 3, 19, 24 }, { 3, 19, 26 }, { 3, 19, 27 }, { 3, 19, 28 }, { 3, 19, 29 }, 
+    { 3, 19, 30 }, { 8, 263, 32 }, { 8, 163, 32 }, { 8, 43, 32 }, { 8, 1, 32 }, 
+    { 3, 19, 32 }, { 2, 20, 39 }, { 2, 20, 40 }, { 2, 20, 41 }, { 8, 1, 42 }, 
+    { 8, 43, 42 }, { 8, 163, 42 }, { 8, 263, 42 }, { 3, 19, 42 }, { 3, 19, 43 }, 
+    { 3, 19, 44 }, { 3, 19, 50 }, { 8, 1, 52 }, { 8, 43, 52 }, { 8, 163, 52 }, 
+    { 8, 263, 52 }, { 3, 19, 52 }, { 8, 163, 72 }, { 8, 43, 84 }
+
+    // State 21
+    , { 3, 20, 0 }, 
+    { 3, 20, 3 }, { 3, 20, 4 }, { 3, 20, 8 }, { 3, 20, 10 }, { 3, 20, 11 }, 
+    { 3, 20, 12 }, { 3, 20, 16 }, { 3, 20, 17 }, { 3, 20, 18 }, { 3, 20, 20 }, 
+    { 3, 20, 21 }, { 3, 20, 23 }, { 3, 20, 24 }, { 3, 20, 26 }, { 3, 20, 27 }, 
+    { 3, 20, 28 }, { 3, 20, 29 }, { 3, 20, 30 }, { 8, 263, 32 }, { 8, 163, 32 }, 
+    { 8, 43, 32 }, { 8, 1, 32 }, { 3, 20, 32 }, { 2, 21, 39 }, { 2, 21, 40 }, 
+    { 2, 21, 41 }, { 8, 1, 42 }, { 8, 43, 42 }, { 8, 163, 42 }, { 8, 263, 42 }, 
+    { 3, 20, 42 }, { 3, 20, 43 }, { 3, 20, 44 }, { 3, 20, 50 }, { 8, 1, 52 }, 
+    { 8, 43, 52 }, { 8, 163, 52 }, { 8, 263, 52 }, { 3, 20, 52 }, { 8, 163, 72 }, 
+    { 8, 43, 84 }
+
+    // State 22
+    , { 3, 21, 0 }, { 3, 21, 3 }, { 3, 21, 4 }, { 3, 21, 8 }, 
+    { 3, 21, 10 }, { 3, 21, 11 }, { 3, 21, 12 }, { 3, 21, 16 }, { 3, 21, 17 }, 
+    { 3, 21, 18 }, { 3, 21, 20 }, { 3, 21, 21 }, { 3, 21, 23 }, { 3, 21, 24 }, 
+    { 3, 21, 26 }, { 3, 21, 27 }, { 3, 21, 28 }, { 3, 21, 29 }, { 3, 21, 30 }, 
+    { 8, 1, 32 }, { 8, 43, 32 }, { 8, 263, 32 }, { 3, 21, 32 }, { 2, 22, 39 }, 
+    { 2, 22, 40 }, { 2, 22, 41 }, { 8, 1, 42 }, { 8, 43, 42 }, { 8, 263, 42 }, 
+    { 3, 21, 42 }, { 3, 21, 43 }, { 3, 21, 44 }, { 3, 21, 50 }, { 8, 1, 52 }, 
+    { 8, 43, 52 }, { 8, 263, 52 }, { 3, 21, 52 }, { 8, 43, 84 }
+
+    // State 23
+    , { 3, 22, 0 }, 
+    { 3, 22, 3 }, { 3, 22, 4 }, { 3, 22, 8 }, { 3, 22, 10 }, { 3, 22, 11 }, 
+    { 3, 22, 12 }, { 3, 22, 16 }, { 3, 22, 17 }, { 3, 22, 18 }, { 3, 22, 20 }, 
+    { 3, 22, 21 }, { 3, 22, 23 }, { 3, 22, 24 }, { 3, 22, 26 }, { 3, 22, 27 }, 
+    { 3, 22, 28 }, { 3, 22, 29 }, { 3, 22, 30 }, { 8, 1, 32 }, { 3, 22, 32 }, 
+    { 2, 23, 39 }, { 2, 23, 40 }, { 2, 23, 41 }, { 8, 1, 42 }, { 8, 1, 52 }
+
+    // State 24
+    , { 8, 1, 32 }, { 8, 43, 32 }, { 2, 24, 39 }, { 2, 24, 40 }, { 2, 24, 41 }, 
+    { 8, 1, 42 }, { 8, 43, 42 }, { 8, 1, 52 }, { 8, 43, 52 }, { 8, 43, 84 }
+
+    // State 25
+    , { 3, 23, 0 }, { 3, 23, 3 }, { 3, 23, 4 }, { 3, 23, 8 }, { 3, 23, 10 }, 
+    { 3, 23, 11 }, { 3, 23, 12 }, { 3, 23, 16 }, { 3, 23, 17 }, { 3, 23, 18 }, 
+    { 3, 23, 20 }, { 3, 23, 21 }, { 3, 23, 23 }, { 3, 23, 24 }, { 3, 23, 26 }, 
+    { 3, 23, 27 }, { 3, 23, 28 }, { 3, 23, 29 }, { 3, 23, 30 }, { 8, 1, 32 }, 
+    { 8, 43, 32 }, { 8, 263, 32 }, { 3, 23, 32 }, { 2, 25, 39 }, { 2, 25, 40 }, 
+    { 2, 25, 41 }, { 8, 1, 42 }, { 8, 43, 42 }, { 8, 263, 42 }, { 3, 23, 42 }, 
+    { 3, 23, 43 }, { 3, 23, 44 }, { 3, 23, 50 }, { 8, 1, 52 }, { 8, 43, 52 }, 
+    { 8, 263, 52 }, { 3, 23, 52 }, { 8, 43, 84 }
+
+    // State 26
+    , { 3, 24, 0 }, { 3, 24, 3 }, 
+    { 3, 24, 4 }, { 3, 24, 8 }, { 3, 24, 10 }, { 3, 24, 11 }, { 3, 24, 12 }, 
+    { 3, 24, 16 }, { 3, 24, 17 }, { 3, 24, 18 }, { 3, 24, 20 }, { 3, 24, 21 }, 
+    { 3, 24, 23 }, { 3, 24, 24 }, { 3, 24, 26 }, { 3, 24, 27 }, { 3, 24, 28 }, 
+    { 3, 24, 29 }, { 3, 24, 30 }, { 8, 1, 32 }, { 8, 43, 32 }, { 8, 263, 32 }, 
+    { 3, 24, 32 }, { 2, 26, 39 }, { 2, 26, 40 }, { 2, 26, 41 }, { 8, 1, 42 }, 
+    { 8, 43, 42 }, { 8, 263, 42 }, { 3, 24, 42 }, { 3, 24, 43 }, { 3, 24, 44 }, 
+    { 3, 24, 50 }, { 8, 1, 52 }, { 8, 43, 52 }, { 8, 263, 52 }, { 3, 24, 52 }, 
+    { 8, 43, 84 }
+
+    // State 27
+    , { 3, 25, 0 }, { 3, 25, 3 }, { 3, 25, 4 }, { 3, 25, 8 }, 
+    { 3, 25, 10 }, { 3, 25, 11 }, { 3, 25, 12 }, { 3, 25, 16 }, { 3, 25, 17 }, 
+    { 3, 25, 18 }, { 3, 25, 20 }, { 3, 25, 21 }, { 3, 25, 23 }, { 3, 25, 24 }, 
+    { 3, 25, 26 }, { 3, 25, 27 }, { 3, 25, 28 }, { 3, 25, 29 }, { 3, 25, 30 }, 
+    { 8, 263, 32 }, { 8, 163, 32 }, { 8, 43, 32 }, { 8, 1, 32 }, { 3, 25, 32 }, 
+    { 2, 27, 39 }, { 2, 27, 40 }, { 2, 27, 41 }, { 8, 1, 42 }, { 8, 43, 42 }, 
+    { 8, 163, 42 }, { 8, 263, 42 }, { 3, 25, 42 }, { 3, 25, 43 }, { 3, 25, 44 }, 
+    { 3, 25, 50 }, { 8, 1, 52 }, { 8, 43, 52 }, { 8, 163, 52 }, { 8, 263, 52 }, 
+    { 3, 25, 52 }, { 8, 163, 72 }, { 8, 43, 84 }
+
+    // State 28
+    , { 3, 26, 0 }, { 3, 26, 3 }, 
+    { 3, 26, 4 }, { 3, 26, 8 }, { 3, 26, 10 }, { 3, 26, 11 }, { 3, 26, 12 }, 
+    { 3, 26, 16 }, { 3, 26, 17 }, { 3, 26, 18 }, { 3, 26, 20 }, { 3, 26, 21 }, 
+    { 3, 26, 23 }, { 3, 26, 24 }, { 3, 26, 26 }, { 3, 26, 27 }, { 3, 26, 28 }, 
+    { 3, 26, 29 }, { 3, 26, 30 }, { 8, 263, 32 }, { 8, 163, 32 }, { 8, 43, 32 }, 
+    { 8, 1, 32 }, { 3, 26, 32 }, { 2, 28, 39 }, { 2, 28, 40 }, { 2, 28, 41 }, 
+    { 8, 1, 42 }, { 8, 43, 42 }, { 8, 163, 42 }, { 8, 263, 42 }, { 3, 26, 42 }, 
+    { 3, 26, 43 }, { 3, 26, 44 }, { 3, 26, 50 }, { 8, 1, 52 }, { 8, 43, 52 }, 
+    { 8, 163, 52 }, { 8, 263, 52 }, { 3, 26, 52 }, { 8, 163, 72 }, { 8, 43, 84 }
+
+    // State 29
+    , { 2, 29, 39 }, { 2, 29, 40 }, { 2, 29, 41 }
+
+    // State 30
+    , { 3, 28, 0 }, { 3, 28, 3 }, 
+    { 3, 28, 4 }, { 3, 28, 8 }, { 3, 28, 10 }, { 3, 28, 11 }, { 3, 28, 12 }, 
+    { 3, 28, 16 }, { 3, 28, 17 }, { 3, 28, 18 }, { 3, 28, 20 }, { 3, 28, 21 }, 
+    { 3, 28, 23 }, { 3, 28, 24 }, { 3, 28, 26 }, { 3, 28, 27 }, { 3, 28, 28 }, 
+    { 3, 28, 29 }, { 3, 28, 30 }, { 8, 1, 32 }, { 3, 28, 32 }, { 2, 30, 39 }, 
+    { 2, 30, 40 }, { 2, 30, 41 }, { 8, 1, 42 }, { 8, 1, 52 }
+
+    // State 31
+    , { 3, 29, 0 }, 
+    { 3, 29, 3 }, { 3, 29, 4 }, { 3, 29, 8 }, { 3, 29, 10 }, { 3, 29, 11 }, 
+    { 3, 29, 12 }, { 3, 29, 16 }, { 3, 29, 17 }, { 3, 29, 18 }, { 3, 29, 20 }, 
+    { 3, 29, 21 }, { 3, 29, 23 }, { 3, 29, 24 }, { 3, 29, 26 }, { 3, 29, 27 }, 
+    { 3, 29, 28 }, { 3, 29, 29 }, { 3, 29, 30 }, { 8, 1, 32 }, { 3, 29, 32 }, 
+    { 2, 31, 39 }, { 2, 31, 40 }, { 2, 31, 41 }, { 8, 1, 42 }, { 8, 1, 52 }
+
+    // State 32
+    , { 3, 0, 32 }, { 2, 32, 39 }, { 2, 32, 40 }, { 2, 32, 41 }, { 3, 0, 42 }, 
+    { 0, 37, 52 }
+
+    // State 33
+    , { 0, 2, 0 }, { 0, 3, 3 }, { 0, 4, 4 }, { 0, 5, 8 }, 
+    { 0, 6, 10 }, { 0, 7, 11 }, { 0, 8, 12 }, { 0, 9, 16 }, { 0, 10, 17 }, 
+    { 0, 11, 18 }, { 0, 12, 20 }, { 0, 13, 21 }, { 0, 14, 23 }, { 0, 15, 24 }, 
+    { 0, 16, 26 }, { 0, 17, 27 }, { 0, 18, 28 }, { 0, 19, 29 }, { 0, 20, 30 }, 
+    { 8, 1, 32 }, { 0, 21, 32 }, { 2, 33, 39 }, { 2, 33, 40 }, { 2, 33, 41 }, 
+    { 8, 1, 42 }, { 8, 1, 52 }
+
+    // State 34
+    , { 0, 2, 0 }, { 0, 3, 3 }, { 0, 4, 4 }, 
+    { 0, 5, 8 }, { 0, 6, 10 }, { 0, 7, 11 }, { 0, 8, 12 }, { 0, 9, 16 }, 
+    { 0, 10, 17 }, { 0, 11, 18 }, { 0, 12, 20 }, { 0, 13, 21 }, { 0, 14, 23 }, 
+    { 0, 15, 24 }, { 0, 16, 26 }, { 0, 17, 27 }, { 0, 18, 28 }, { 0, 19, 29 }, 
+    { 0, 20, 30 }, { 8, 1, 32 }, { 8, 43, 32 }, { 8, 263, 32 }, { 0, 21, 32 }, 
+    { 2, 34, 39 }, { 2, 34, 40 }, { 2, 34, 41 }, { 8, 1, 42 }, { 8, 43, 42 }, 
+    { 8, 263, 42 }, { 3, 31, 42 }, { 3, 31, 43 }, { 3, 31, 44 }, { 3, 31, 50 }, 
+    { 8, 1, 52 }, { 8, 43, 52 }, { 8, 263, 52 }, { 3, 31, 52 }, { 8, 43, 84 }
+
+    // State 35
+    , { 0, 49, 32 }, { 2, 35, 39 }, { 2, 35, 40 }, { 2, 35, 41 }, { 0, 50, 85 }
+
+    // State 36
+    , { 3, 32, 0 }, { 3, 32, 3 }, { 3, 32, 4 }, { 3, 32, 8 }, { 3, 32, 10 }, 
+    { 3, 32, 11 }, { 3, 32, 12 }, { 3, 32, 16 }, { 3, 32, 17 }, { 3, 32, 18 }, 
+    { 3, 32, 20 }, { 3, 32, 21 }, { 3, 32, 23 }, { 3, 32, 24 }, { 3, 32, 26 }, 
+    { 3, 32, 27 }, { 3, 32, 28 }, { 3, 32, 29 }, { 3, 32, 30 }, { 8, 1, 32 }, 
+    { 8, 43, 32 }, { 8, 263, 32 }, { 3, 32, 32 }, { 2, 36, 39 }, { 2, 36, 40 }, 
+    { 2, 36, 41 }, { 8, 1, 42 }, { 8, 43, 42 }, { 8, 263, 42 }, { 3, 32, 42 }, 
+    { 3, 32, 43 }, { 3, 32, 44 }, { 3, 32, 50 }, { 8, 1, 52 }, { 8, 43, 52 }, 
+    { 8, 263, 52 }, { 3, 32, 52 }, { 8, 43, 84 }
+
+    // State 37
+    , { 3, 33, 4 }, { 3, 33, 30 }, 
+    { 3, 33, 32 }, { 2, 37, 39 }, { 2, 37, 40 }, { 2, 37, 41 }, { 3, 33, 42 }, 
+    { 3, 33, 43 }, { 3, 33, 44 }, { 3, 33, 50 }, { 3, 33, 52 }
+
+    // State 38
+    , { 8, 52, 0 }, 
+    { 8, 52, 3 }, { 8, 52, 4 }, { 8, 52, 8 }, { 8, 52, 10 }, { 8, 52, 11 }, 
+    { 8, 52, 12 }, { 8, 52, 16 }, { 8, 52, 17 }, { 8, 52, 18 }, { 8, 52, 20 }, 
+    { 8, 52, 21 }, { 8, 52, 23 }, { 8, 52, 24 }, { 8, 52, 26 }, { 8, 52, 27 }, 
+    { 8, 52, 28 }, { 8, 52, 29 }, { 8, 52, 30 }, { 8, 52, 32 }, { 2, 38, 39 }, 
+    { 2, 38, 40 }, { 2, 38, 41 }, { 3, 34, 85 }
+
+    // State 39
+    , { 3, 35, 32 }, { 2, 39, 39 }, 
+    { 2, 39, 40 }, { 2, 39, 41 }, { 3, 35, 42 }
+
+    // State 40
+    , { 0, 57, 32 }, { 2, 40, 39 }, 
+    { 2, 40, 40 }, { 2, 40, 41 }, { 0, 58, 42 }
+
+    // State 41
+    , { 3, 36, 0 }, { 3, 36, 3 }, 
+    { 3, 36, 4 }, { 3, 36, 8 }, { 3, 36, 10 }, { 3, 36, 11 }, { 3, 36, 12 }, 
+    { 3, 36, 16 }, { 3, 36, 17 }, { 3, 36, 18 }, { 3, 36, 20 }, { 3, 36, 21 }, 
+    { 3, 36, 23 }, { 3, 36, 24 }, { 3, 36, 26 }, { 3, 36, 27 }, { 3, 36, 28 }, 
+    { 3, 36, 29 }, { 3, 36, 30 }, { 8, 263, 32 }, { 8, 163, 32 }, { 8, 43, 32 }, 
+    { 8, 1, 32 }, { 3, 36, 32 }, { 2, 41, 39 }, { 2, 41, 40 }, { 2, 41, 41 }, 
+    { 8, 1, 42 }, { 8, 43, 42 }, { 8, 163, 42 }, { 8, 263, 42 }, { 3, 36, 42 }, 
+    { 3, 36, 43 }, { 3, 36, 44 }, { 3, 36, 50 }, { 8, 1, 52 }, { 8, 43, 52 }, 
+    { 8, 163, 52 }, { 8, 263, 52 }, { 3, 36, 52 }, { 8, 163, 72 }, { 8, 43, 84 }, 
+    { 3, 37, 85 }
+
+    // State 42
+    , { 2, 42, 39 }, { 2, 42, 40 }, { 2, 42, 41 }, { 0, 60, 85 }
+
+    // State 43
+    , { 3, 0, 32 }, { 2, 43, 39 }, { 2, 43, 40 }, { 2, 43, 41 }, { 3, 0, 42 }, 
+    { 0, 37, 52 }, { 0, 61, 84 }
+
+    // State 44
+    , { 3, 0, 32 }, { 2, 44, 39 }, { 2, 44, 40 }, 
+    { 2, 44, 41 }, { 3, 0, 42 }, { 0, 37, 52 }, { 3, 38, 84 }
+
+    // State 45
+    , { 3, 0, 32 }, 
+    { 2, 45, 39 }, { 2, 45, 40 }, { 2, 45, 41 }, { 3, 0, 42 }, { 0, 37, 52 }
+
+    // State 46
+    , { 8, 52, 0 }, { 8, 52, 3 }, { 8, 52, 4 }, { 8, 52, 8 }, { 8, 52, 10 }, 
+    { 8, 52, 11 }, { 8, 52, 12 }, { 8, 52, 16 }, { 8, 52, 17 }, { 8, 52, 18 }, 
+    { 8, 52, 20 }, { 8, 52, 21 }, { 8, 52, 23 }, { 8, 52, 24 }, { 8, 52, 26 }, 
+    { 8, 52, 27 }, { 8, 52, 28 }, { 8, 52, 29 }, { 8, 52, 30 }, { 8, 52, 32 }, 
+    { 2, 46, 39 }, { 2, 46, 40 }, { 2, 46, 41 }, { 3, 34, 85 }
+
+    // State 47
+    , { 3, 39, 0 }, 
+    { 3, 39, 3 }, { 3, 39, 4 }, { 3, 39, 8 }, { 3, 39, 10 }, { 3, 39, 11 }, 
+    { 3, 39, 12 }, { 3, 39, 16 }, { 3, 39, 17 }, { 3, 39, 18 }, { 3, 39, 20 }, 
+    { 3, 39, 21 }, { 3, 39, 23 }, { 3, 39, 24 }, { 3, 39, 26 }, { 3, 39, 27 }, 
+    { 3, 39, 28 }, { 3, 39, 29 }, { 3, 39, 30 }, { 8, 1, 32 }, { 3, 39, 32 }, 
+    { 2, 47, 39 }, { 2, 47, 40 }, { 2, 47, 41 }, { 8, 1, 42 }, { 8, 1, 52 }
+
+    // State 48
+    , { 3, 40, 0 }, { 3, 40, 3 }, { 3, 40, 4 }, { 3, 40, 8 }, { 3, 40, 10 }, 
+    { 3, 40, 11 }, { 3, 40, 12 }, { 3, 40, 16 }, { 3, 40, 17 }, { 3, 40, 18 }, 
+    { 3, 40, 20 }, { 3, 40, 21 }, { 3, 40, 23 }, { 3, 40, 24 }, { 3, 40, 26 }, 
+    { 3, 40, 27 }, { 3, 40, 28 }, { 3, 40, 29 }, { 3, 40, 30 }, { 8, 1, 32 }, 
+    { 8, 43, 32 }, { 8, 263, 32 }, { 3, 40, 32 }, { 2, 48, 39 }, { 2, 48, 40 }, 
+    { 2, 48, 41 }, { 8, 1, 42 }, { 8, 43, 42 }, { 8, 263, 42 }, { 3, 40, 42 }, 
+    { 3, 40, 43 }, { 3, 40, 44 }, { 3, 40, 50 }, { 8, 1, 52 }, { 8, 43, 52 }, 
+    { 8, 263, 52 }, { 3, 40, 52 }, { 8, 43, 84 }
+
+    // State 49
+    , { 3, 41, 0 }, { 3, 41, 3 }, 
+    { 3, 41, 4 }, { 3, 41, 8 }, { 3, 41, 10 }, { 3, 41, 11 }, { 3, 41, 12 }, 
+    { 3, 41, 16 }, { 3, 41, 17 }, { 3, 41, 18 }, { 3, 41, 20 }, { 3, 41, 21 }, 
+    { 3, 41, 23 }, { 3, 41, 24 }, { 3, 41, 26 }, { 3, 41, 27 }, { 3, 41, 28 }, 
+    { 3, 41, 29 }, { 3, 41, 30 }, { 8, 263, 32 }, { 8, 163, 32 }, { 8, 43, 32 }, 
+    { 8, 1, 32 }, { 3, 41, 32 }, { 2, 49, 39 }, { 2, 49, 40 }, { 2, 49, 41 }, 
+    { 8, 1, 42 }, { 8, 43, 42 }, { 8, 163, 42 }, { 8, 263, 42 }, { 3, 41, 42 }, 
+    { 3, 41, 43 }, { 3, 41, 44 }, { 3, 41, 50 }, { 8, 1, 52 }, { 8, 43, 52 }, 
+    { 8, 163, 52 }, { 8, 263, 52 }, { 3, 41, 52 }, { 8, 163, 72 }, { 8, 43, 84 }, 
+    { 0, 70, 85 }
+
+    // State 50
+    , { 3, 42, 3 }, { 3, 42, 4 }, { 3, 42, 8 }, { 3, 42, 10 }, 
+    { 3, 42, 12 }, { 3, 42, 16 }, { 3, 42, 17 }, { 3, 42, 20 }, { 3, 42, 21 }, 
+    { 3, 42, 24 }, { 3, 42, 27 }, { 3, 42, 28 }, { 3, 42, 29 }, { 3, 42, 30 }, 
+    { 3, 42, 32 }, { 2, 50, 39 }, { 2, 50, 40 }, { 2, 50, 41 }, { 3, 42, 86 }
+
+    // State 51
+    , { 0, 4, 4 }, { 0, 20, 30 }, { 3, 43, 32 }, { 2, 51, 39 }, { 2, 51, 40 }, 
+    { 2, 51, 41 }, { 3, 43, 42 }, { 3, 43, 43 }, { 3, 43, 44 }, { 3, 43, 50 }, 
+    { 0, 37, 52 }
+
+    // State 52
+    , { 0, 2, 0 }, { 0, 3, 3 }, { 0, 4, 4 }, { 0, 5, 8 }, 
+    { 0, 6, 10 }, { 0, 7, 11 }, { 0, 8, 12 }, { 0, 9, 16 }, { 0, 10, 17 }, 
+    { 0, 11, 18 }, { 0, 12, 20 }, { 0, 13, 21 }, { 0, 14, 23 }, { 0, 15, 24 }, 
+    { 0, 16, 26 }, { 0, 17, 27 }, { 0, 18, 28 }, { 0, 19, 29 }, { 0, 20, 30 }, 
+    { 0, 21, 32 }, { 2, 52, 39 }, { 2, 52, 40 }, { 2, 52, 41 }
+
+    // State 53
+    , { 3, 44, 1 }, 
+    { 3, 44, 2 }, { 3, 44, 5 }, { 3, 44, 6 }, { 3, 44, 7 }, { 3, 44, 13 }, 
+    { 3, 44, 14 }, { 3, 44, 15 }, { 3, 44, 19 }, { 3, 44, 22 }, { 3, 44, 25 }, 
+    { 3, 44, 31 }, { 3, 44, 32 }, { 3, 44, 33 }, { 3, 44, 34 }, { 3, 44, 35 }, 
+    { 3, 44, 36 }, { 3, 44, 37 }, { 3, 44, 38 }, { 2, 53, 39 }, { 2, 53, 40 }, 
+    { 2, 53, 41 }, { 3, 44, 42 }, { 3, 44, 48 }, { 3, 44, 49 }, { 3, 44, 51 }, 
+    { 3, 44, 52 }, { 3, 44, 53 }, { 3, 44, 54 }, { 3, 44, 55 }, { 3, 44, 56 }, 
+    { 3, 44, 84 }, { 3, 44, 85 }, { 3, 44, 86 }
+
+    // State 54
+    , { 0, 2, 0 }, { 0, 3, 3 }, 
+    { 0, 4, 4 }, { 0, 5, 8 }, { 0, 6, 10 }, { 0, 7, 11 }, { 0, 8, 12 }, 
+    { 0, 9, 16 }, { 0, 10, 17 }, { 0, 11, 18 }, { 0, 12, 20 }, { 0, 13, 21 }, 
+    { 0, 14, 23 }, { 0, 15, 24 }, { 0, 16, 26 }, { 0, 17, 27 }, { 0, 18, 28 }, 
+    { 0, 19, 29 }, { 0, 20, 30 }, { 0, 21, 32 }, { 2, 54, 39 }, { 2, 54, 40 }, 
+    { 2, 54, 41 }
+
+    // State 55
+    , { 2, 55, 39 }, { 2, 55, 40 }, { 2, 55, 41 }, { 0, 78, 85 }
+
+    // State 56
+    , { 8, 52, 0 }, { 3, 45, 1 }, { 3, 45, 2 }, { 8, 52, 3 }, { 8, 52, 4 }, 
+    { 3, 45, 5 }, { 3, 45, 6 }, { 3, 45, 7 }, { 8, 52, 8 }, { 8, 52, 10 }, 
+    { 8, 52, 11 }, { 8, 52, 12 }, { 3, 45, 13 }, { 3, 45, 14 }, { 3, 45, 15 }, 
+    { 8, 52, 16 }, { 8, 52, 17 }, { 8, 52, 18 }, { 3, 45, 19 }, { 8, 52, 20 }, 
+    { 8, 52, 21 }, { 3, 45, 22 }, { 8, 52, 23 }, { 8, 52, 24 }, { 3, 45, 25 }, 
+    { 8, 52, 26 }, { 8, 52, 27 }, { 8, 52, 28 }, { 8, 52, 29 }, { 8, 52, 30 }, 
+    { 3, 45, 31 }, { 8, 52, 32 }, { 3, 45, 32 }, { 3, 45, 33 }, { 3, 45, 34 }, 
+    { 3, 45, 35 }, { 3, 45, 36 }, { 3, 45, 37 }, { 3, 45, 38 }, { 2, 56, 39 }, 
+    { 2, 56, 40 }, { 2, 56, 41 }, { 3, 45, 42 }, { 3, 45, 48 }, { 3, 45, 49 }, 
+    { 3, 45, 51 }, { 3, 45, 52 }, { 3, 45, 53 }, { 3, 45, 54 }, { 3, 45, 55 }, 
+    { 3, 45, 56 }, { 3, 45, 84 }, { 3, 45, 85 }, { 3, 45, 86 }
+
+    // State 57
+    , { 8, 52, 0 }, 
+    { 8, 52, 3 }, { 8, 52, 4 }, { 8, 52, 8 }, { 8, 52, 10 }, { 8, 52, 11 }, 
+    { 8, 52, 12 }, { 8, 52, 16 }, { 8, 52, 17 }, { 8, 52, 18 }, { 8, 52, 20 }, 
+    { 8, 52, 21 }, { 8, 52, 23 }, { 8, 52, 24 }, { 8, 52, 26 }, { 8, 52, 27 }, 
+    { 8, 52, 28 }, { 8, 52, 29 }, { 8, 52, 30 }, { 8, 52, 32 }, { 2, 57, 39 }, 
+    { 2, 57, 40 }, { 2, 57, 41 }, { 3, 46, 42 }, { 3, 46, 43 }, { 3, 46, 44 }, 
+    { 3, 46, 50 }, { 3, 46, 72 }, { 3, 46, 73 }, { 3, 46, 84 }, { 3, 46, 85 }
+
+    // State 58
+    , { 3, 0, 32 }, { 2, 58, 39 }, { 2, 58, 40 }, { 2, 58, 41 }, { 3, 0, 42 }, 
+    { 0, 37, 52 }
+
+    // State 59
+    , { 8, 52, 0 }, { 8, 52, 3 }, { 8, 52, 4 }, { 8, 52, 8 }, 
+    { 8, 52, 10 }, { 8, 52, 11 }, { 8, 52, 12 }, { 8, 52, 16 }, { 8, 52, 17 }, 
+    { 8, 52, 18 }, { 8, 52, 20 }, { 8, 52, 21 }, { 8, 52, 23 }, { 8, 52, 24 }, 
+    { 8, 52, 26 }, { 8, 52, 27 }, { 8, 52, 28 }, { 8, 52, 29 }, { 8, 52, 30 }, 
+    { 8, 52, 32 }, { 2, 59, 39 }, { 2, 59, 40 }, { 2, 59, 41 }, { 0, 81, 42 }, 
+    { 3, 47, 43 }, { 0, 82, 44 }, { 3, 47, 50 }, { 3, 47, 72 }, { 3, 47, 73 }, 
+    { 3, 47, 84 }, { 3, 47, 85 }
+
+    // State 60
+    , { 0, 83, 32 }, { 2, 60, 39 }, { 2, 60, 40 }, 
+    { 2, 60, 41 }
+
+    // State 61
+    , { 2, 61, 39 }, { 2, 61, 40 }, { 2, 61, 41 }
+
+    // State 62
+    , { 2, 62, 39 }, 
+    { 2, 62, 40 }, { 2, 62, 41 }, { 0, 86, 50 }, { 0, 87, 84 }
+
+    // State 63
+    , { 2, 63, 39 }, 
+    { 2, 63, 40 }, { 2, 63, 41 }, { 3, 49, 50 }, { 0, 89, 73 }, { 3, 49, 84 }
+
+    // State 64
+    , { 2, 64, 39 }, { 2, 64, 40 }, { 2, 64, 41 }
+
+    // State 65
+    , { 2, 65, 39 }, { 2, 65, 40 }, 
+    { 2, 65, 41 }, { 3, 51, 50 }, { 3, 51, 84 }
+
+    // State 66
+    , { 2, 66, 39 }, { 2, 66, 40 }, 
+    { 2, 66, 41 }, { 3, 52, 84 }
+
+    // State 67
+    , { 2, 67, 39 }, { 2, 67, 40 }, { 2, 67, 41 }, 
+    { 0, 92, 84 }
+
+    // State 68
+    , { 8, 52, 0 }, { 8, 52, 3 }, { 8, 52, 4 }, { 8, 52, 8 }, 
+    { 8, 52, 10 }, { 8, 52, 11 }, { 8, 52, 12 }, { 8, 52, 16 }, { 8, 52, 17 }, 
+    { 8, 52, 18 }, { 8, 52, 20 }, { 8, 52, 21 }, { 8, 52, 23 }, { 8, 52, 24 }, 
+    { 8, 52, 26 }, { 8, 52, 27 }, { 8, 52, 28 }, { 8, 52, 29 }, { 8, 52, 30 }, 
+    { 8, 52, 32 }, { 2, 68, 39 }, { 2, 68, 40 }, { 2, 68, 41 }, { 3, 34, 85 }
+
+    // State 69
+    , { 2, 69, 39 }, { 2, 69, 40 }, { 2, 69, 41 }, { 0, 94, 85 }
+
+    // State 70
+    , { 3, 42, 3 }, 
+    { 3, 42, 4 }, { 3, 42, 8 }, { 3, 42, 10 }, { 3, 42, 12 }, { 3, 42, 16 }, 
+    { 3, 42, 17 }, { 3, 42, 20 }, { 3, 42, 21 }, { 3, 42, 24 }, { 3, 42, 27 }, 
+    { 3, 42, 28 }, { 3, 42, 29 }, { 3, 42, 30 }, { 3, 42, 32 }, { 2, 70, 39 }, 
+    { 2, 70, 40 }, { 2, 70, 41 }, { 3, 42, 86 }
+
+    // State 71
+    , { 3, 53, 0 }, { 3, 53, 3 }, 
+    { 3, 53, 4 }, { 3, 53, 8 }, { 3, 53, 10 }, { 3, 53, 11 }, { 3, 53, 12 }, 
+    { 3, 53, 16 }, { 3, 53, 17 }, { 3, 53, 18 }, { 3, 53, 20 }, { 3, 53, 21 }, 
+    { 3, 53, 23 }, { 3, 53, 24 }, { 3, 53, 26 }, { 3, 53, 27 }, { 3, 53, 28 }, 
+    { 3, 53, 29 }, { 3, 53, 30 }, { 8, 263, 32 }, { 8, 163, 32 }, { 8, 43, 32 }, 
+    { 8, 1, 32 }, { 3, 53, 32 }, { 2, 71, 39 }, { 2, 71, 40 }, { 2, 71, 41 }, 
+    { 8, 1, 42 }, { 8, 43, 42 }, { 8, 163, 42 }, { 8, 263, 42 }, { 3, 53, 42 }, 
+    { 3, 53, 43 }, { 3, 53, 44 }, { 3, 53, 50 }, { 8, 1, 52 }, { 8, 43, 52 }, 
+    { 8, 163, 52 }, { 8, 263, 52 }, { 3, 53, 52 }, { 8, 163, 72 }, { 8, 43, 84 }
+
+    // State 72
+    , { 0, 3, 3 }, { 0, 4, 4 }, { 0, 5, 8 }, { 0, 6, 10 }, { 0, 8, 12 }, 
+    { 0, 9, 16 }, { 0, 10, 17 }, { 0, 12, 20 }, { 0, 13, 21 }, { 0, 15, 24 }, 
+    { 0, 17, 27 }, { 0, 18, 28 }, { 0, 19, 29 }, { 0, 20, 30 }, { 0, 21, 32 }, 
+    { 2, 72, 39 }, { 2, 72, 40 }, { 2, 72, 41 }, { 0, 97, 86 }
+
+    // State 73
+    , { 3, 54, 4 }, 
+    { 3, 54, 30 }, { 3, 54, 32 }, { 2, 73, 39 }, { 2, 73, 40 }, { 2, 73, 41 }, 
+    { 3, 54, 42 }, { 3, 54, 43 }, { 3, 54, 44 }, { 3, 54, 50 }, { 3, 54, 52 }
+
+    // State 74
+    , { 3, 55, 32 }, { 2, 74, 39 }, { 2, 74, 40 }, { 2, 74, 41 }, { 3, 55, 42 }, 
+    { 3, 55, 43 }, { 3, 55, 44 }, { 3, 55, 50 }
+
+    // State 75
+    , { 2, 75, 39 }, { 2, 75, 40 }, 
+    { 2, 75, 41 }
+
+    // State 76
+    , { 8, 43, 32 }, { 2, 76, 39 }, { 2, 76, 40 }, { 2, 76, 41 }, 
+    { 8, 43, 42 }, { 8, 43, 52 }, { 8, 43, 84 }
+
+    // State 77
+    , { 8, 52, 0 }, { 3, 57, 1 }, 
+    { 3, 57, 2 }, { 8, 52, 3 }, { 8, 52, 4 }, { 3, 57, 5 }, { 3, 57, 6 }, 
+    { 3, 57, 7 }, { 8, 52, 8 }, { 8, 52, 10 }, { 8, 52, 11 }, { 8, 52, 12 }, 
+    { 3, 57, 13 }, { 3, 57, 14 }, { 3, 57, 15 }, { 8, 52, 16 }, { 8, 52, 17 }, 
+    { 8, 52, 18 }, { 3, 57, 19 }, { 8, 52, 20 }, { 8, 52, 21 }, { 3, 57, 22 }, 
+    { 8, 52, 23 }, { 8, 52, 24 }, { 3, 57, 25 }, { 8, 52, 26 }, { 8, 52, 27 }, 
+    { 8, 52, 28 }, { 8, 52, 29 }, { 8, 52, 30 }, { 3, 57, 31 }, { 8, 52, 32 }, 
+    { 3, 57, 32 }, { 3, 57, 33 }, { 3, 57, 34 }, { 3, 57, 35 }, { 3, 57, 36 }, 
+    { 3, 57, 37 }, { 3, 57, 38 }, { 2, 77, 39 }, { 2, 77, 40 }, { 2, 77, 41 }, 
+    { 3, 57, 42 }, { 3, 57, 48 }, { 3, 57, 49 }, { 3, 57, 51 }, { 3, 57, 52 }, 
+    { 3, 57, 53 }, { 3, 57, 54 }, { 3, 57, 55 }, { 3, 57, 56 }, { 3, 57, 84 }, 
+    { 3, 57, 85 }, { 3, 57, 86 }
+
+    // State 78
+    , { 2, 78, 39 }, { 2, 78, 40 }, { 2, 78, 41 }
+
+    // State 79
+    , { 0, 2, 0 }, { 0, 3, 3 }, { 0, 4, 4 }, { 0, 5, 8 }, { 0, 6, 10 }, 
+    { 0, 7, 11 }, { 0, 8, 12 }, { 0, 9, 16 }, { 0, 10, 17 }, { 0, 11, 18 }, 
+    { 0, 12, 20 }, { 0, 13, 21 }, { 0, 14, 23 }, { 0, 15, 24 }, { 0, 16, 26 }, 
+    { 0, 17, 27 }, { 0, 18, 28 }, { 0, 19, 29 }, { 0, 20, 30 }, { 0, 21, 32 }, 
+    { 2, 79, 39 }, { 2, 79, 40 }, { 2, 79, 41 }
+
+    // State 80
+    , { 2, 80, 39 }, { 2, 80, 40 }, 
+    { 2, 80, 41 }, { 0, 105, 43 }
+
+    // State 81
+    , { 8, 106, 0 }, { 8, 106, 3 }, { 8, 106, 4 }, 
+    { 8, 106, 8 }, { 8, 106, 10 }, { 8, 106, 11 }, { 8, 106, 12 }, { 8, 106, 16 }, 
+    { 8, 106, 17 }, { 8, 106, 18 }, { 8, 106, 20 }, { 8, 106, 21 }, { 8, 106, 23 }, 
+    { 8, 106, 24 }, { 8, 106, 26 }, { 8, 106, 27 }, { 8, 106, 28 }, { 8, 106, 29 }, 
+    { 8, 106, 30 }, { 8, 106, 32 }, { 0, 107, 32 }, { 2, 81, 39 }, { 2, 81, 40 }, 
+    { 2, 81, 41 }, { 0, 108, 43 }
+
+    // State 82
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, 
+    { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, 
+    { 2, 82, 39 }, { 2, 82, 40 }, { 2, 82, 41 }, { 0, 120, 42 }, { 3, 59, 45 }, 
+    { 0, 121, 48 }, { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, 
+    { 0, 126, 54 }, { 0, 127, 55 }, { 0, 128, 56 }
+
+    // State 83
+    , { 2, 83, 39 }, { 2, 83, 40 }, 
+    { 2, 83, 41 }, { 3, 60, 50 }, { 0, 150, 73 }, { 3, 60, 86 }
+
+    // State 84
+    , { 2, 84, 39 }, 
+    { 2, 84, 40 }, { 2, 84, 41 }, { 0, 152, 86 }
+
+    // State 85
+    , { 2, 85, 39 }, { 2, 85, 40 }, 
+    { 2, 85, 41 }, { 3, 61, 50 }, { 3, 61, 86 }
+
+    // State 86
+    , { 2, 86, 39 }, { 2, 86, 40 }, 
+    { 2, 86, 41 }
+
+    // State 87
+    , { 2, 87, 39 }, { 2, 87, 40 }, { 2, 87, 41 }
+
+    // State 88
+    , { 2, 88, 39 }, 
+    { 2, 88, 40 }, { 2, 88, 41 }
+
+    // State 89
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, 
+    { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, 
+    { 2, 89, 39 }, { 2, 89, 40 }, { 2, 89, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, 
+    { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, 
+    { 0, 127, 55 }, { 0, 128, 56 }, { 0, 154, 85 }
+
+    // State 90
+    , { 2, 90, 39 }, { 2, 90, 40 }, 
+    { 2, 90, 41 }, { 3, 65, 50 }, { 3, 65, 84 }
+
+    // State 91
+    , { 2, 91, 39 }, { 2, 91, 40 }, 
+    { 2, 91, 41 }, { 0, 159, 50 }, { 3, 66, 84 }
+
+    // State 92
+    , { 8, 52, 0 }, { 3, 67, 0 }, 
+    { 3, 67, 1 }, { 3, 67, 2 }, { 8, 52, 3 }, { 3, 67, 3 }, { 8, 52, 4 }, 
+    { 3, 67, 4 }, { 3, 67, 5 }, { 3, 67, 6 }, { 3, 67, 7 }, { 8, 52, 8 }, 
+    { 3, 67, 8 }, { 8, 52, 10 }, { 3, 67, 10 }, { 8, 52, 11 }, { 3, 67, 11 }, 
+    { 8, 52, 12 }, { 3, 67, 12 }, { 3, 67, 13 }, { 3, 67, 14 }, { 3, 67, 15 }, 
+    { 8, 52, 16 }, { 3, 67, 16 }, { 8, 52, 17 }, { 3, 67, 17 }, { 8, 52, 18 }, 
+    { 3, 67, 18 }, { 3, 67, 19 }, { 8, 52, 20 }, { 3, 67, 20 }, { 8, 52, 21 }, 
+    { 3, 67, 21 }, { 3, 67, 22 }, { 8, 52, 23 }, { 3, 67, 23 }, { 8, 52, 24 }, 
+    { 3, 67, 24 }, { 3, 67, 25 }, { 8, 52, 26 }, { 3, 67, 26 }, { 8, 52, 27 }, 
+    { 3, 67, 27 }, { 8, 52, 28 }, { 3, 67, 28 }, { 8, 52, 29 }, { 3, 67, 29 }, 
+    { 8, 52, 30 }, { 3, 67, 30 }, { 3, 67, 31 }, { 8, 1, 32 }, { 8, 52, 32 }, 
+    { 3, 67, 32 }, { 3, 67, 33 }, { 3, 67, 34 }, { 3, 67, 35 }, { 3, 67, 36 }, 
+    { 3, 67, 37 }, { 3, 67, 38 }, { 2, 92, 39 }, { 2, 92, 40 }, { 2, 92, 41 }, 
+    { 8, 1, 42 }, { 3, 67, 42 }, { 3, 67, 48 }, { 3, 67, 49 }, { 3, 67, 51 }, 
+    { 8, 1, 52 }, { 3, 67, 52 }, { 3, 67, 53 }, { 3, 67, 54 }, { 3, 67, 55 }, 
+    { 3, 67, 56 }, { 3, 67, 84 }, { 3, 67, 85 }, { 3, 67, 86 }
+
+    // State 93
+    , { 2, 93, 39 }, 
+    { 2, 93, 40 }, { 2, 93, 41 }, { 0, 94, 85 }
+
+    // State 94
+    , { 8, 52, 0 }, { 3, 34, 1 }, 
+    { 3, 34, 2 }, { 8, 52, 3 }, { 8, 52, 4 }, { 3, 34, 5 }, { 3, 34, 6 }, 
+    { 3, 34, 7 }, { 8, 52, 8 }, { 8, 52, 10 }, { 8, 52, 11 }, { 8, 52, 12 }, 
+    { 3, 34, 13 }, { 3, 34, 14 }, { 3, 34, 15 }, { 8, 52, 16 }, { 8, 52, 17 }, 
+    { 8, 52, 18 }, { 3, 34, 19 }, { 8, 52, 20 }, { 8, 52, 21 }, { 3, 34, 22 }, 
+    { 8, 52, 23 }, { 8, 52, 24 }, { 3, 34, 25 }, { 8, 52, 26 }, { 8, 52, 27 }, 
+    { 8, 52, 28 }, { 8, 52, 29 }, { 8, 52, 30 }, { 3, 34, 31 }, { 8, 52, 32 }, 
+    { 3, 34, 32 }, { 3, 34, 33 }, { 3, 34, 34 }, { 3, 34, 35 }, { 3, 34, 36 }, 
+    { 3, 34, 37 }, { 3, 34, 38 }, { 2, 94, 39 }, { 2, 94, 40 }, { 2, 94, 41 }, 
+    { 3, 34, 42 }, { 3, 34, 48 }, { 3, 34, 49 }, { 3, 34, 51 }, { 3, 34, 52 }, 
+    { 3, 34, 53 }, { 3, 34, 54 }, { 3, 34, 55 }, { 3, 34, 56 }, { 3, 34, 84 }, 
+    { 3, 34, 85 }, { 3, 34, 86 }
+
+    // State 95
+    , { 3, 68, 0 }, { 3, 68, 3 }, { 3, 68, 4 }, 
+    { 3, 68, 8 }, { 3, 68, 10 }, { 3, 68, 11 }, { 3, 68, 12 }, { 3, 68, 16 }, 
+    { 3, 68, 17 }, { 3, 68, 18 }, { 3, 68, 20 }, { 3, 68, 21 }, { 3, 68, 23 }, 
+    { 3, 68, 24 }, { 3, 68, 26 }, { 3, 68, 27 }, { 3, 68, 28 }, { 3, 68, 29 }, 
+    { 3, 68, 30 }, { 8, 1, 32 }, { 3, 68, 32 }, { 2, 95, 39 }, { 2, 95, 40 }, 
+    { 2, 95, 41 }, { 8, 1, 42 }, { 8, 1, 52 }
+
+    // State 96
+    , { 0, 3, 3 }, { 0, 4, 4 }, 
+    { 0, 5, 8 }, { 0, 6, 10 }, { 0, 8, 12 }, { 0, 9, 16 }, { 0, 10, 17 }, 
+    { 0, 12, 20 }, { 0, 13, 21 }, { 0, 15, 24 }, { 0, 17, 27 }, { 0, 18, 28 }, 
+    { 0, 19, 29 }, { 0, 20, 30 }, { 0, 21, 32 }, { 2, 96, 39 }, { 2, 96, 40 }, 
+    { 2, 96, 41 }, { 0, 162, 86 }
+
+    // State 97
+    , { 3, 69, 0 }, { 3, 69, 3 }, { 3, 69, 4 }, 
+    { 3, 69, 8 }, { 3, 69, 10 }, { 3, 69, 11 }, { 3, 69, 12 }, { 3, 69, 16 }, 
+    { 3, 69, 17 }, { 3, 69, 18 }, { 3, 69, 20 }, { 3, 69, 21 }, { 3, 69, 23 }, 
+    { 3, 69, 24 }, { 3, 69, 26 }, { 3, 69, 27 }, { 3, 69, 28 }, { 3, 69, 29 }, 
+    { 3, 69, 30 }, { 8, 263, 32 }, { 8, 163, 32 }, { 8, 43, 32 }, { 8, 1, 32 }, 
+    { 3, 69, 32 }, { 2, 97, 39 }, { 2, 97, 40 }, { 2, 97, 41 }, { 8, 1, 42 }, 
+    { 8, 43, 42 }, { 8, 163, 42 }, { 8, 263, 42 }, { 3, 69, 42 }, { 3, 69, 43 }, 
+    { 3, 69, 44 }, { 3, 69, 50 }, { 8, 1, 52 }, { 8, 43, 52 }, { 8, 163, 52 }, 
+    { 8, 263, 52 }, { 3, 69, 52 }, { 8, 163, 72 }, { 8, 43, 84 }
+
+    // State 98
+    , { 3, 70, 3 }, 
+    { 3, 70, 4 }, { 3, 70, 8 }, { 3, 70, 10 }, { 3, 70, 12 }, { 3, 70, 16 }, 
+    { 3, 70, 17 }, { 3, 70, 20 }, { 3, 70, 21 }, { 3, 70, 24 }, { 3, 70, 27 }, 
+    { 3, 70, 28 }, { 3, 70, 29 }, { 3, 70, 30 }, { 8, 163, 32 }, { 3, 70, 32 }, 
+    { 2, 98, 39 }, { 2, 98, 40 }, { 2, 98, 41 }, { 8, 163, 42 }, { 3, 70, 42 }, 
+    { 3, 70, 43 }, { 3, 70, 44 }, { 8, 163, 52 }, { 3, 70, 52 }, { 8, 163, 72 }
+
+    // State 99
+    , { 3, 71, 3 }, { 3, 71, 4 }, { 3, 71, 8 }, { 3, 71, 10 }, { 3, 71, 12 }, 
+    { 3, 71, 16 }, { 3, 71, 17 }, { 3, 71, 20 }, { 3, 71, 21 }, { 3, 71, 24 }, 
+    { 3, 71, 27 }, { 3, 71, 28 }, { 3, 71, 29 }, { 3, 71, 30 }, { 8, 163, 32 }, 
+    { 3, 71, 32 }, { 2, 99, 39 }, { 2, 99, 40 }, { 2, 99, 41 }, { 8, 163, 42 }, 
+    { 3, 71, 42 }, { 3, 71, 43 }, { 3, 71, 44 }, { 8, 163, 52 }, { 3, 71, 52 }, 
+    { 8, 163, 72 }
+
+    // State 100
+    , { 3, 72, 3 }, { 3, 72, 4 }, { 3, 72, 8 }, { 3, 72, 10 }, 
+    { 3, 72, 12 }, { 3, 72, 16 }, { 3, 72, 17 }, { 3, 72, 20 }, { 3, 72, 21 }, 
+    { 3, 72, 24 }, { 3, 72, 27 }, { 3, 72, 28 }, { 3, 72, 29 }, { 3, 72, 30 }, 
+    { 3, 72, 32 }, { 2, 100, 39 }, { 2, 100, 40 }, { 2, 100, 41 }, { 3, 72, 86 }
+
+    // State 101
+    , { 8, 163, 32 }, { 2, 101, 39 }, { 2, 101, 40 }, { 2, 101, 41 }, { 8, 163, 42 }, 
+    { 8, 163, 52 }, { 8, 163, 72 }
+
+    // State 102
+    , { 0, 3, 3 }, { 0, 4, 4 }, { 0, 5, 8 }, 
+    { 0, 6, 10 }, { 0, 8, 12 }, { 0, 9, 16 }, { 0, 10, 17 }, { 0, 12, 20 }, 
+    { 0, 13, 21 }, { 0, 15, 24 }, { 0, 17, 27 }, { 0, 18, 28 }, { 0, 19, 29 }, 
+    { 0, 20, 30 }, { 8, 163, 32 }, { 0, 21, 32 }, { 2, 102, 39 }, { 2, 102, 40 }, 
+    { 2, 102, 41 }, { 8, 163, 42 }, { 3, 73, 42 }, { 3, 73, 43 }, { 3, 73, 44 }, 
+    { 8, 163, 52 }, { 3, 73, 52 }, { 8, 163, 72 }
+
+    // State 103
+    , { 3, 74, 3 }, { 3, 74, 4 }, 
+    { 3, 74, 8 }, { 3, 74, 10 }, { 3, 74, 12 }, { 3, 74, 16 }, { 3, 74, 17 }, 
+    { 3, 74, 20 }, { 3, 74, 21 }, { 3, 74, 24 }, { 3, 74, 27 }, { 3, 74, 28 }, 
+    { 3, 74, 29 }, { 3, 74, 30 }, { 8, 163, 32 }, { 3, 74, 32 }, { 2, 103, 39 }, 
+    { 2, 103, 40 }, { 2, 103, 41 }, { 8, 163, 42 }, { 3, 74, 42 }, { 3, 74, 43 }, 
+    { 3, 74, 44 }, { 8, 163, 52 }, { 3, 74, 52 }, { 8, 163, 72 }
+
+    // State 104
+    , { 8, 52, 0 }, 
+    { 3, 75, 1 }, { 3, 75, 2 }, { 8, 52, 3 }, { 8, 52, 4 }, { 3, 75, 5 }, 
+    { 3, 75, 6 }, { 3, 75, 7 }, { 8, 52, 8 }, { 8, 52, 10 }, { 8, 52, 11 }, 
+    { 8, 52, 12 }, { 3, 75, 13 }, { 3, 75, 14 }, { 3, 75, 15 }, { 8, 52, 16 }, 
+    { 8, 52, 17 }, { 8, 52, 18 }, { 3, 75, 19 }, { 8, 52, 20 }, { 8, 52, 21 }, 
+    { 3, 75, 22 }, { 8, 52, 23 }, { 8, 52, 24 }, { 3, 75, 25 }, { 8, 52, 26 }, 
+    { 8, 52, 27 }, { 8, 52, 28 }, { 8, 52, 29 }, { 8, 52, 30 }, { 3, 75, 31 }, 
+    { 8, 52, 32 }, { 3, 75, 32 }, { 3, 75, 33 }, { 3, 75, 34 }, { 3, 75, 35 }, 
+    { 3, 75, 36 }, { 3, 75, 37 }, { 3, 75, 38 }, { 2, 104, 39 }, { 2, 104, 40 }, 
+    { 2, 104, 41 }, { 3, 75, 42 }, { 3, 75, 48 }, { 3, 75, 49 }, { 3, 75, 51 }, 
+    { 3, 75, 52 }, { 3, 75, 53 }, { 3, 75, 54 }, { 3, 75, 55 }, { 3, 75, 56 }, 
+    { 3, 75, 84 }, { 3, 75, 85 }, { 3, 75, 86 }
+
+    // State 105
+    , { 8, 52, 0 }, { 8, 52, 3 }, 
+    { 8, 52, 4 }, { 8, 52, 8 }, { 8, 52, 10 }, { 8, 52, 11 }, { 8, 52, 12 }, 
+    { 8, 52, 16 }, { 8, 52, 17 }, { 8, 52, 18 }, { 8, 52, 20 }, { 8, 52, 21 }, 
+    { 8, 52, 23 }, { 8, 52, 24 }, { 8, 52, 26 }, { 8, 52, 27 }, { 8, 52, 28 }, 
+    { 8, 52, 29 }, { 8, 52, 30 }, { 8, 52, 32 }, { 2, 105, 39 }, { 2, 105, 40 }, 
+    { 2, 105, 41 }, { 3, 76, 42 }, { 3, 76, 43 }, { 3, 76, 44 }, { 3, 76, 50 }, 
+    { 3, 76, 72 }, { 3, 76, 73 }, { 3, 76, 84 }, { 3, 76, 85 }
+
+    // State 106
+    , { 0, 2, 0 }, 
+    { 0, 3, 3 }, { 0, 4, 4 }, { 0, 5, 8 }, { 0, 6, 10 }, { 0, 7, 11 }, 
+    { 0, 8, 12 }, { 0, 9, 16 }, { 0, 10, 17 }, { 0, 11, 18 }, { 0, 12, 20 }, 
+    { 0, 13, 21 }, { 0, 14, 23 }, { 0, 15, 24 }, { 0, 16, 26 }, { 0, 17, 27 }, 
+    { 0, 18, 28 }, { 0, 19, 29 }, { 0, 20, 30 }, { 0, 21, 32 }, { 2, 106, 39 }, 
+    { 2, 106, 40 }, { 2, 106, 41 }
+
+    // State 107
+    , { 2, 107, 39 }, { 2, 107, 40 }, { 2, 107, 41 }, 
+    { 3, 77, 43 }, { 3, 77, 50 }
+
+    // State 108
+    , { 8, 52, 0 }, { 8, 52, 3 }, { 8, 52, 4 }, 
+    { 8, 52, 8 }, { 8, 52, 10 }, { 8, 52, 11 }, { 8, 52, 12 }, { 8, 52, 16 }, 
+    { 8, 52, 17 }, { 8, 52, 18 }, { 8, 52, 20 }, { 8, 52, 21 }, { 8, 52, 23 }, 
+    { 8, 52, 24 }, { 8, 52, 26 }, { 8, 52, 27 }, { 8, 52, 28 }, { 8, 52, 29 }, 
+    { 8, 52, 30 }, { 8, 52, 32 }, { 2, 108, 39 }, { 2, 108, 40 }, { 2, 108, 41 }, 
+    { 3, 78, 42 }, { 3, 78, 43 }, { 3, 78, 44 }, { 3, 78, 50 }, { 3, 78, 72 }, 
+    { 3, 78, 73 }, { 3, 78, 84 }, { 3, 78, 85 }
+
+    // State 109
+    , { 2, 109, 39 }, { 2, 109, 40 }, 
+    { 2, 109, 41 }, { 3, 79, 43 }
+
+    // State 110
+    , { 0, 2, 0 }, { 0, 3, 3 }, { 0, 4, 4 }, 
+    { 0, 5, 8 }, { 0, 6, 10 }, { 0, 7, 11 }, { 0, 8, 12 }, { 0, 9, 16 }, 
+    { 0, 10, 17 }, { 0, 11, 18 }, { 0, 12, 20 }, { 0, 13, 21 }, { 0, 14, 23 }, 
+    { 0, 15, 24 }, { 0, 16, 26 }, { 0, 17, 27 }, { 0, 18, 28 }, { 0, 19, 29 }, 
+    { 0, 20, 30 }, { 0, 21, 32 }, { 2, 110, 39 }, { 2, 110, 40 }, { 2, 110, 41 }
+
+    // State 111
+    , { 2, 111, 39 }, { 2, 111, 40 }, { 2, 111, 41 }, { 0, 171, 43 }
+
+    // State 112
+    , { 0, 112, 22 }, 
+    { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, 
+    { 0, 118, 37 }, { 0, 119, 38 }, { 2, 112, 39 }, { 2, 112, 40 }, { 2, 112, 41 }, 
+    { 8, 172, 42 }, { 0, 173, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, { 0, 123, 51 }, 
+    { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, { 0, 128, 56 }
+
+    // State 113
+    , { 2, 113, 39 }, { 2, 113, 40 }, { 2, 113, 41 }, { 3, 80, 42 }, { 3, 80, 43 }, 
+    { 3, 80, 44 }, { 3, 80, 45 }, { 3, 80, 46 }, { 3, 80, 47 }, { 3, 80, 48 }, 
+    { 3, 80, 49 }, { 3, 80, 50 }, { 3, 80, 51 }, { 3, 80, 52 }, { 3, 80, 53 }, 
+    { 3, 80, 54 }, { 3, 80, 57 }, { 3, 80, 58 }, { 3, 80, 59 }, { 3, 80, 60 }, 
+    { 3, 80, 61 }, { 3, 80, 62 }, { 3, 80, 63 }, { 3, 80, 64 }, { 3, 80, 65 }, 
+    { 3, 80, 66 }, { 3, 80, 67 }, { 3, 80, 68 }, { 3, 80, 69 }, { 3, 80, 70 }, 
+    { 3, 80, 71 }, { 3, 80, 72 }, { 3, 80, 73 }, { 3, 80, 74 }, { 3, 80, 75 }, 
+    { 3, 80, 76 }, { 3, 80, 77 }, { 3, 80, 78 }, { 3, 80, 79 }, { 3, 80, 80 }, 
+    { 3, 80, 81 }, { 3, 80, 82 }, { 3, 80, 83 }, { 3, 80, 84 }, { 3, 80, 86 }
+
+    // State 114
+    , { 2, 114, 39 }, { 2, 114, 40 }, { 2, 114, 41 }, { 3, 81, 42 }, { 3, 81, 43 }, 
+    { 3, 81, 44 }, { 3, 81, 45 }, { 3, 81, 46 }, { 3, 81, 47 }, { 3, 81, 48 }, 
+    { 3, 81, 49 }, { 3, 81, 50 }, { 3, 81, 51 }, { 3, 81, 52 }, { 3, 81, 53 }, 
+    { 3, 81, 54 }, { 3, 81, 57 }, { 3, 81, 58 }, { 3, 81, 59 }, { 3, 81, 60 }, 
+    { 3, 81, 61 }, { 3, 81, 62 }, { 3, 81, 63 }, { 3, 81, 64 }, { 3, 81, 65 }, 
+    { 3, 81, 66 }, { 3, 81, 67 }, { 3, 81, 68 }, { 3, 81, 69 }, { 3, 81, 70 }, 
+    { 3, 81, 71 }, { 3, 81, 72 }, { 3, 81, 73 }, { 3, 81, 74 }, { 3, 81, 75 }, 
+    { 3, 81, 76 }, { 3, 81, 77 }, { 3, 81, 78 }, { 3, 81, 79 }, { 3, 81, 80 }, 
+    { 3, 81, 81 }, { 3, 81, 82 }, { 3, 81, 83 }, { 3, 81, 84 }, { 3, 81, 86 }
+
+    // State 115
+    , { 2, 115, 39 }, { 2, 115, 40 }, { 2, 115, 41 }, { 3, 82, 42 }, { 3, 82, 43 }, 
+    { 3, 82, 44 }, { 3, 82, 45 }, { 3, 82, 46 }, { 3, 82, 47 }, { 3, 82, 48 }, 
+    { 3, 82, 49 }, { 3, 82, 50 }, { 3, 82, 51 }, { 3, 82, 52 }, { 3, 82, 53 }, 
+    { 3, 82, 54 }, { 3, 82, 57 }, { 3, 82, 58 }, { 3, 82, 59 }, { 3, 82, 60 }, 
+    { 3, 82, 61 }, { 3, 82, 62 }, { 3, 82, 63 }, { 3, 82, 64 }, { 3, 82, 65 }, 
+    { 3, 82, 66 }, { 3, 82, 67 }, { 3, 82, 68 }, { 3, 82, 69 }, { 3, 82, 70 }, 
+    { 3, 82, 71 }, { 3, 82, 72 }, { 3, 82, 73 }, { 3, 82, 74 }, { 3, 82, 75 }, 
+    { 3, 82, 76 }, { 3, 82, 77 }, { 3, 82, 78 }, { 3, 82, 79 }, { 3, 82, 80 }, 
+    { 3, 82, 81 }, { 3, 82, 82 }, { 3, 82, 83 }, { 3, 82, 84 }, { 3, 82, 86 }
+
+    // State 116
+    , { 2, 116, 39 }, { 2, 116, 40 }, { 2, 116, 41 }, { 3, 83, 42 }, { 3, 83, 43 }, 
+    { 3, 83, 44 }, { 3, 83, 45 }, { 3, 83, 46 }, { 3, 83, 47 }, { 3, 83, 48 }, 
+    { 3, 83, 49 }, { 3, 83, 50 }, { 3, 83, 51 }, { 3, 83, 52 }, { 3, 83, 53 }, 
+    { 3, 83, 54 }, { 3, 83, 57 }, { 3, 83, 58 }, { 3, 83, 59 }, { 3, 83, 60 }, 
+    { 3, 83, 61 }, { 3, 83, 62 }, { 3, 83, 63 }, { 3, 83, 64 }, { 3, 83, 65 }, 
+    { 3, 83, 66 }, { 3, 83, 67 }, { 3, 83, 68 }, { 3, 83, 69 }, { 3, 83, 70 }, 
+    { 3, 83, 71 }, { 3, 83, 72 }, { 3, 83, 73 }, { 3, 83, 74 }, { 3, 83, 75 }, 
+    { 3, 83, 76 }, { 3, 83, 77 }, { 3, 83, 78 }, { 3, 83, 79 }, { 3, 83, 80 }, 
+    { 3, 83, 81 }, { 3, 83, 82 }, { 3, 83, 83 }, { 3, 83, 84 }, { 3, 83, 86 }
+
+    // State 117
+    , { 2, 117, 39 }, { 2, 117, 40 }, { 2, 117, 41 }, { 3, 84, 42 }, { 3, 84, 43 }, 
+    { 3, 84, 44 }, { 3, 84, 45 }, { 3, 84, 46 }, { 3, 84, 47 }, { 3, 84, 48 }, 
+    { 3, 84, 49 }, { 3, 84, 50 }, { 3, 84, 51 }, { 3, 84, 52 }, { 3, 84, 53 }, 
+    { 3, 84, 54 }, { 3, 84, 57 }, { 3, 84, 58 }, { 3, 84, 59 }, { 3, 84, 60 }, 
+    { 3, 84, 61 }, { 3, 84, 62 }, { 3, 84, 63 }, { 3, 84, 64 }, { 3, 84, 65 }, 
+    { 3, 84, 66 }, { 3, 84, 67 }, { 3, 84, 68 }, { 3, 84, 69 }, { 3, 84, 70 }, 
+    { 3, 84, 71 }, { 3, 84, 72 }, { 3, 84, 73 }, { 3, 84, 74 }, { 3, 84, 75 }, 
+    { 3, 84, 76 }, { 3, 84, 77 }, { 3, 84, 78 }, { 3, 84, 79 }, { 3, 84, 80 }, 
+    { 3, 84, 81 }, { 3, 84, 82 }, { 3, 84, 83 }, { 3, 84, 84 }, { 3, 84, 86 }
+
+    // State 118
+    , { 2, 118, 39 }, { 2, 118, 40 }, { 2, 118, 41 }, { 3, 85, 42 }, { 3, 85, 43 }, 
+    { 3, 85, 44 }, { 3, 85, 45 }, { 3, 85, 46 }, { 3, 85, 47 }, { 3, 85, 48 }, 
+    { 3, 85, 49 }, { 3, 85, 50 }, { 3, 85, 51 }, { 3, 85, 52 }, { 3, 85, 53 }, 
+    { 3, 85, 54 }, { 3, 85, 57 }, { 3, 85, 58 }, { 3, 85, 59 }, { 3, 85, 60 }, 
+    { 3, 85, 61 }, { 3, 85, 62 }, { 3, 85, 63 }, { 3, 85, 64 }, { 3, 85, 65 }, 
+    { 3, 85, 66 }, { 3, 85, 67 }, { 3, 85, 68 }, { 3, 85, 69 }, { 3, 85, 70 }, 
+    { 3, 85, 71 }, { 3, 85, 72 }, { 3, 85, 73 }, { 3, 85, 74 }, { 3, 85, 75 }, 
+    { 3, 85, 76 }, { 3, 85, 77 }, { 3, 85, 78 }, { 3, 85, 79 }, { 3, 85, 80 }, 
+    { 3, 85, 81 }, { 3, 85, 82 }, { 3, 85, 83 }, { 3, 85, 84 }, { 3, 85, 86 }
+
+    // State 119
+    , { 2, 119, 39 }, { 2, 119, 40 }, { 2, 119, 41 }, { 3, 86, 42 }, { 3, 86, 43 }, 
+    { 3, 86, 44 }, { 3, 86, 45 }, { 3, 86, 46 }, { 3, 86, 47 }, { 3, 86, 48 }, 
+    { 3, 86, 49 }, { 3, 86, 50 }, { 3, 86, 51 }, { 3, 86, 52 }, { 3, 86, 53 }, 
+    { 3, 86, 54 }, { 3, 86, 57 }, { 3, 86, 58 }, { 3, 86, 59 }, { 3, 86, 60 }, 
+    { 3, 86, 61 }, { 3, 86, 62 }, { 3, 86, 63 }, { 3, 86, 64 }, { 3, 86, 65 }, 
+    { 3, 86, 66 }, { 3, 86, 67 }, { 3, 86, 68 }, { 3, 86, 69 }, { 3, 86, 70 }, 
+    { 3, 86, 71 }, { 3, 86, 72 }, { 3, 86, 73 }, { 3, 86, 74 }, { 3, 86, 75 }, 
+    { 3, 86, 76 }, { 3, 86, 77 }, { 3, 86, 78 }, { 3, 86, 79 }, { 3, 86, 80 }, 
+    { 3, 86, 81 }, { 3, 86, 82 }, { 3, 86, 83 }, { 3, 86, 84 }, { 3, 86, 86 }
+
+    // State 120
+    , { 8, 176, 3 }, { 8, 176, 4 }, { 8, 176, 8 }, { 8, 176, 10 }, { 8, 176, 12 }, 
+    { 8, 176, 16 }, { 8, 176, 17 }, { 8, 176, 20 }, { 8, 176, 21 }, { 0, 112, 22 }, 
+    { 8, 176, 24 }, { 8, 176, 27 }, { 8, 176, 28 }, { 8, 176, 29 }, { 8, 176, 30 }, 
+    { 8, 176, 32 }, { 8, 177, 32 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 120, 39 }, 
+    { 2, 120, 40 }, { 2, 120, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }
+
+    // State 121
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 121, 39 }, 
+    { 2, 121, 40 }, { 2, 121, 41 }, { 0, 173, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }
+
+    // State 122
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 122, 39 }, 
+    { 2, 122, 40 }, { 2, 122, 41 }, { 0, 173, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }
+
+    // State 123
+    , { 3, 87, 22 }, { 3, 87, 32 }, { 3, 87, 33 }, { 3, 87, 34 }, 
+    { 3, 87, 35 }, { 3, 87, 36 }, { 3, 87, 37 }, { 3, 87, 38 }, { 2, 123, 39 }, 
+    { 2, 123, 40 }, { 2, 123, 41 }, { 3, 87, 42 }, { 3, 87, 48 }, { 3, 87, 49 }, 
+    { 3, 87, 51 }, { 3, 87, 52 }, { 3, 87, 53 }, { 3, 87, 54 }, { 3, 87, 55 }, 
+    { 3, 87, 56 }
+
+    // State 124
+    , { 3, 88, 22 }, { 3, 88, 32 }, { 3, 88, 33 }, { 3, 88, 34 }, 
+    { 3, 88, 35 }, { 3, 88, 36 }, { 3, 88, 37 }, { 3, 88, 38 }, { 2, 124, 39 }, 
+    { 2, 124, 40 }, { 2, 124, 41 }, { 3, 88, 42 }, { 3, 88, 48 }, { 3, 88, 49 }, 
+    { 3, 88, 51 }, { 3, 88, 52 }, { 3, 88, 53 }, { 3, 88, 54 }, { 3, 88, 55 }, 
+    { 3, 88, 56 }
+
+    // State 125
+    , { 3, 89, 22 }, { 3, 89, 32 }, { 3, 89, 33 }, { 3, 89, 34 }, 
+    { 3, 89, 35 }, { 3, 89, 36 }, { 3, 89, 37 }, { 3, 89, 38 }, { 2, 125, 39 }, 
+    { 2, 125, 40 }, { 2, 125, 41 }, { 3, 89, 42 }, { 3, 89, 48 }, { 3, 89, 49 }, 
+    { 3, 89, 51 }, { 3, 89, 52 }, { 3, 89, 53 }, { 3, 89, 54 }, { 3, 89, 55 }, 
+    { 3, 89, 56 }
+
+    // State 126
+    , { 3, 90, 22 }, { 3, 90, 32 }, { 3, 90, 33 }, { 3, 90, 34 }, 
+    { 3, 90, 35 }, { 3, 90, 36 }, { 3, 90, 37 }, { 3, 90, 38 }, { 2, 126, 39 }, 
+    { 2, 126, 40 }, { 2, 126, 41 }, { 3, 90, 42 }, { 3, 90, 48 }, { 3, 90, 49 }, 
+    { 3, 90, 51 }, { 3, 90, 52 }, { 3, 90, 53 }, { 3, 90, 54 }, { 3, 90, 55 }, 
+    { 3, 90, 56 }
+
+    // State 127
+    , { 3, 91, 22 }, { 3, 91, 32 }, { 3, 91, 33 }, { 3, 91, 34 }, 
+    { 3, 91, 35 }, { 3, 91, 36 }, { 3, 91, 37 }, { 3, 91, 38 }, { 2, 127, 39 }, 
+    { 2, 127, 40 }, { 2, 127, 41 }, { 3, 91, 42 }, { 3, 91, 48 }, { 3, 91, 49 }, 
+    { 3, 91, 51 }, { 3, 91, 52 }, { 3, 91, 53 }, { 3, 91, 54 }, { 3, 91, 55 }, 
+    { 3, 91, 56 }
+
+    // State 128
+    , { 3, 92, 22 }, { 3, 92, 32 }, { 3, 92, 33 }, { 3, 92, 34 }, 
+    { 3, 92, 35 }, { 3, 92, 36 }, { 3, 92, 37 }, { 3, 92, 38 }, { 2, 128, 39 }, 
+    { 2, 128, 40 }, { 2, 128, 41 }, { 3, 92, 42 }, { 3, 92, 48 }, { 3, 92, 49 }, 
+    { 3, 92, 51 }, { 3, 92, 52 }, { 3, 92, 53 }, { 3, 92, 54 }, { 3, 92, 55 }, 
+    { 3, 92, 56 }
+
+    // State 129
+    , { 2, 129, 39 }, { 2, 129, 40 }, { 2, 129, 41 }, { 3, 93, 42 }, 
+    { 3, 93, 43 }, { 3, 93, 44 }, { 3, 93, 45 }, { 3, 93, 46 }, { 3, 93, 47 }, 
+    { 3, 93, 48 }, { 3, 93, 49 }, { 3, 93, 50 }, { 3, 93, 51 }, { 3, 93, 52 }, 
+    { 3, 93, 53 }, { 3, 93, 54 }, { 3, 93, 57 }, { 3, 93, 58 }, { 3, 93, 59 }, 
+    { 3, 93, 60 }, { 3, 93, 61 }, { 3, 93, 62 }, { 3, 93, 63 }, { 3, 93, 64 }, 
+    { 3, 93, 65 }, { 3, 93, 66 }, { 3, 93, 67 }, { 3, 93, 68 }, { 3, 93, 69 }, 
+    { 3, 93, 70 }, { 3, 93, 71 }, { 3, 93, 72 }, { 3, 93, 73 }, { 3, 93, 74 }, 
+    { 3, 93, 75 }, { 3, 93, 76 }, { 3, 93, 77 }, { 3, 93, 78 }, { 3, 93, 79 }, 
+    { 3, 93, 80 }, { 3, 93, 81 }, { 3, 93, 82 }, { 3, 93, 83 }, { 3, 93, 84 }, 
+    { 3, 93, 86 }
+
+    // State 130
+    , { 2, 130, 39 }, { 2, 130, 40 }, { 2, 130, 41 }, { 3, 94, 42 }, 
+    { 3, 94, 43 }, { 3, 94, 44 }, { 3, 94, 45 }, { 3, 94, 46 }, { 3, 94, 47 }, 
+    { 3, 94, 48 }, { 3, 94, 49 }, { 3, 94, 50 }, { 3, 94, 51 }, { 3, 94, 52 }, 
+    { 3, 94, 53 }, { 3, 94, 54 }, { 3, 94, 57 }, { 3, 94, 58 }, { 3, 94, 59 }, 
+    { 3, 94, 60 }, { 3, 94, 61 }, { 3, 94, 62 }, { 3, 94, 63 }, { 3, 94, 64 }, 
+    { 3, 94, 65 }, { 3, 94, 66 }, { 3, 94, 67 }, { 3, 94, 68 }, { 3, 94, 69 }, 
+    { 3, 94, 70 }, { 3, 94, 71 }, { 3, 94, 72 }, { 3, 94, 73 }, { 3, 94, 74 }, 
+    { 3, 94, 75 }, { 3, 94, 76 }, { 3, 94, 77 }, { 3, 94, 78 }, { 3, 94, 79 }, 
+    { 3, 94, 80 }, { 3, 94, 81 }, { 3, 94, 82 }, { 3, 94, 83 }, { 3, 94, 84 }, 
+    { 3, 94, 86 }
+
+    // State 131
+    , { 2, 131, 39 }, { 2, 131, 40 }, { 2, 131, 41 }, { 0, 184, 42 }, 
+    { 3, 95, 43 }, { 0, 185, 44 }, { 3, 95, 45 }, { 0, 186, 46 }, { 0, 187, 47 }, 
+    { 0, 188, 48 }, { 0, 189, 49 }, { 3, 95, 50 }, { 3, 95, 51 }, { 3, 95, 52 }, 
+    { 3, 95, 53 }, { 3, 95, 54 }, { 3, 95, 57 }, { 3, 95, 58 }, { 3, 95, 59 }, 
+    { 3, 95, 60 }, { 3, 95, 61 }, { 3, 95, 62 }, { 3, 95, 63 }, { 3, 95, 64 }, 
+    { 3, 95, 65 }, { 3, 95, 66 }, { 3, 95, 67 }, { 3, 95, 68 }, { 3, 95, 69 }, 
+    { 3, 95, 70 }, { 3, 95, 71 }, { 3, 95, 72 }, { 3, 95, 73 }, { 3, 95, 74 }, 
+    { 3, 95, 75 }, { 3, 95, 76 }, { 3, 95, 77 }, { 3, 95, 78 }, { 3, 95, 79 }, 
+    { 3, 95, 80 }, { 3, 95, 81 }, { 3, 95, 82 }, { 3, 95, 83 }, { 3, 95, 84 }, 
+    { 3, 95, 86 }
+
+    // State 132
+    , { 2, 132, 39 }, { 2, 132, 40 }, { 2, 132, 41 }, { 3, 96, 43 }, 
+    { 3, 96, 45 }, { 3, 96, 50 }, { 3, 96, 51 }, { 3, 96, 52 }, { 3, 96, 53 }, 
+    { 3, 96, 54 }, { 3, 96, 57 }, { 3, 96, 58 }, { 3, 96, 59 }, { 3, 96, 60 }, 
+    { 3, 96, 61 }, { 3, 96, 62 }, { 3, 96, 63 }, { 3, 96, 64 }, { 3, 96, 65 }, 
+    { 3, 96, 66 }, { 3, 96, 67 }, { 3, 96, 68 }, { 3, 96, 69 }, { 3, 96, 70 }, 
+    { 3, 96, 71 }, { 3, 96, 72 }, { 3, 96, 73 }, { 3, 96, 74 }, { 3, 96, 75 }, 
+    { 3, 96, 76 }, { 3, 96, 77 }, { 3, 96, 78 }, { 3, 96, 79 }, { 3, 96, 80 }, 
+    { 3, 96, 81 }, { 3, 96, 82 }, { 3, 96, 83 }, { 3, 96, 84 }, { 3, 96, 86 }
+
+    // State 133
+    , { 2, 133, 39 }, { 2, 133, 40 }, { 2, 133, 41 }, { 3, 97, 43 }, { 3, 97, 45 }, 
+    { 3, 97, 50 }, { 3, 97, 51 }, { 3, 97, 52 }, { 3, 97, 53 }, { 3, 97, 54 }, 
+    { 3, 97, 57 }, { 3, 97, 58 }, { 3, 97, 59 }, { 3, 97, 60 }, { 3, 97, 61 }, 
+    { 3, 97, 62 }, { 3, 97, 63 }, { 3, 97, 64 }, { 3, 97, 65 }, { 3, 97, 66 }, 
+    { 3, 97, 67 }, { 3, 97, 68 }, { 3, 97, 69 }, { 3, 97, 70 }, { 3, 97, 71 }, 
+    { 3, 97, 72 }, { 3, 97, 84 }, { 3, 97, 86 }
+
+    // State 134
+    , { 0, 112, 22 }, { 0, 113, 32 }, 
+    { 0, 114, 33 }, { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, 
+    { 0, 119, 38 }, { 2, 134, 39 }, { 2, 134, 40 }, { 2, 134, 41 }, { 0, 120, 42 }, 
+    { 0, 121, 48 }, { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, 
+    { 0, 126, 54 }, { 0, 127, 55 }, { 0, 128, 56 }
+
+    // State 135
+    , { 0, 112, 22 }, { 0, 113, 32 }, 
+    { 0, 114, 33 }, { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, 
+    { 0, 119, 38 }, { 2, 135, 39 }, { 2, 135, 40 }, { 2, 135, 41 }, { 0, 120, 42 }, 
+    { 0, 121, 48 }, { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, 
+    { 0, 126, 54 }, { 0, 127, 55 }, { 0, 128, 56 }
+
+    // State 136
+    , { 2, 136, 39 }, { 2, 136, 40 }, 
+    { 2, 136, 41 }, { 3, 98, 43 }, { 3, 98, 45 }, { 3, 98, 50 }, { 3, 98, 51 }, 
+    { 0, 192, 52 }, { 3, 98, 53 }, { 3, 98, 54 }, { 0, 193, 57 }, { 0, 194, 58 }, 
+    { 3, 98, 59 }, { 3, 98, 60 }, { 3, 98, 61 }, { 3, 98, 62 }, { 3, 98, 63 }, 
+    { 3, 98, 64 }, { 3, 98, 65 }, { 3, 98, 66 }, { 3, 98, 67 }, { 3, 98, 68 }, 
+    { 3, 98, 69 }, { 3, 98, 70 }, { 3, 98, 71 }, { 3, 98, 72 }, { 3, 98, 84 }, 
+    { 3, 98, 86 }
+
+    // State 137
+    , { 2, 137, 39 }, { 2, 137, 40 }, { 2, 137, 41 }, { 3, 99, 43 }, 
+    { 3, 99, 45 }, { 3, 99, 50 }, { 3, 99, 51 }, { 0, 196, 53 }, { 0, 197, 54 }, 
+    { 3, 99, 59 }, { 3, 99, 60 }, { 3, 99, 61 }, { 3, 99, 62 }, { 3, 99, 63 }, 
+    { 3, 99, 64 }, { 3, 99, 65 }, { 3, 99, 66 }, { 3, 99, 67 }, { 3, 99, 68 }, 
+    { 3, 99, 69 }, { 3, 99, 70 }, { 3, 99, 71 }, { 3, 99, 72 }, { 3, 99, 84 }, 
+    { 3, 99, 86 }
+
+    // State 138
+    , { 2, 138, 39 }, { 2, 138, 40 }, { 2, 138, 41 }, { 3, 100, 43 }, 
+    { 3, 100, 45 }, { 3, 100, 50 }, { 3, 100, 51 }, { 0, 199, 59 }, { 0, 200, 60 }, 
+    { 3, 100, 61 }, { 3, 100, 62 }, { 3, 100, 63 }, { 3, 100, 64 }, { 3, 100, 65 }, 
+    { 3, 100, 66 }, { 3, 100, 67 }, { 3, 100, 68 }, { 3, 100, 69 }, { 3, 100, 70 }, 
+    { 3, 100, 71 }, { 3, 100, 72 }, { 3, 100, 84 }, { 3, 100, 86 }
+
+    // State 139
+    , { 2, 139, 39 }, 
+    { 2, 139, 40 }, { 2, 139, 41 }, { 3, 101, 43 }, { 3, 101, 45 }, { 3, 101, 50 }, 
+    { 3, 101, 51 }, { 0, 202, 61 }, { 0, 203, 62 }, { 0, 204, 63 }, { 0, 205, 64 }, 
+    { 3, 101, 65 }, { 3, 101, 66 }, { 3, 101, 67 }, { 3, 101, 68 }, { 3, 101, 69 }, 
+    { 3, 101, 70 }, { 3, 101, 71 }, { 3, 101, 72 }, { 3, 101, 84 }, { 3, 101, 86 }
+
+    // State 140
+    , { 2, 140, 39 }, { 2, 140, 40 }, { 2, 140, 41 }, { 3, 102, 43 }, { 3, 102, 45 }, 
+    { 3, 102, 50 }, { 3, 102, 51 }, { 0, 207, 65 }, { 0, 208, 66 }, { 3, 102, 67 }, 
+    { 3, 102, 68 }, { 3, 102, 69 }, { 3, 102, 70 }, { 3, 102, 71 }, { 3, 102, 72 }, 
+    { 3, 102, 84 }, { 3, 102, 86 }
+
+    // State 141
+    , { 2, 141, 39 }, { 2, 141, 40 }, { 2, 141, 41 }, 
+    { 3, 103, 43 }, { 3, 103, 45 }, { 3, 103, 50 }, { 0, 210, 51 }, { 3, 103, 67 }, 
+    { 3, 103, 68 }, { 3, 103, 69 }, { 3, 103, 70 }, { 3, 103, 71 }, { 3, 103, 72 }, 
+    { 3, 103, 84 }, { 3, 103, 86 }
+
+    // State 142
+    , { 2, 142, 39 }, { 2, 142, 40 }, { 2, 142, 41 }, 
+    { 3, 104, 43 }, { 3, 104, 45 }, { 3, 104, 50 }, { 0, 211, 67 }, { 3, 104, 68 }, 
+    { 3, 104, 69 }, { 3, 104, 70 }, { 3, 104, 71 }, { 3, 104, 72 }, { 3, 104, 84 }, 
+    { 3, 104, 86 }
+
+    // State 143
+    , { 2, 143, 39 }, { 2, 143, 40 }, { 2, 143, 41 }, { 3, 105, 43 }, 
+    { 3, 105, 45 }, { 3, 105, 50 }, { 0, 212, 68 }, { 3, 105, 69 }, { 3, 105, 70 }, 
+    { 3, 105, 71 }, { 3, 105, 72 }, { 3, 105, 84 }, { 3, 105, 86 }
+
+    // State 144
+    , { 2, 144, 39 }, 
+    { 2, 144, 40 }, { 2, 144, 41 }, { 3, 106, 43 }, { 3, 106, 45 }, { 3, 106, 50 }, 
+    { 0, 213, 69 }, { 3, 106, 70 }, { 3, 106, 71 }, { 3, 106, 72 }, { 3, 106, 84 }, 
+    { 3, 106, 86 }
+
+    // State 145
+    , { 2, 145, 39 }, { 2, 145, 40 }, { 2, 145, 41 }, { 3, 107, 43 }, 
+    { 3, 107, 45 }, { 3, 107, 50 }, { 0, 214, 70 }, { 0, 215, 71 }, { 3, 107, 72 }, 
+    { 3, 107, 84 }, { 3, 107, 86 }
+
+    // State 146
+    , { 2, 146, 39 }, { 2, 146, 40 }, { 2, 146, 41 }, 
+    { 3, 108, 45 }, { 3, 108, 50 }, { 3, 108, 72 }, { 3, 108, 84 }, { 3, 108, 86 }
+
+    // State 147
+    , { 2, 147, 39 }, { 2, 147, 40 }, { 2, 147, 41 }, { 3, 109, 45 }
+
+    // State 148
+    , { 2, 148, 39 }, 
+    { 2, 148, 40 }, { 2, 148, 41 }, { 0, 216, 45 }
+
+    // State 149
+    , { 0, 112, 22 }, { 0, 113, 32 }, 
+    { 0, 114, 33 }, { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, 
+    { 0, 119, 38 }, { 2, 149, 39 }, { 2, 149, 40 }, { 2, 149, 41 }, { 0, 120, 42 }, 
+    { 0, 121, 48 }, { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, 
+    { 0, 126, 54 }, { 0, 127, 55 }, { 0, 128, 56 }
+
+    // State 150
+    , { 0, 112, 22 }, { 0, 113, 32 }, 
+    { 0, 114, 33 }, { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, 
+    { 0, 119, 38 }, { 2, 150, 39 }, { 2, 150, 40 }, { 2, 150, 41 }, { 0, 120, 42 }, 
+    { 0, 121, 48 }, { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, 
+    { 0, 126, 54 }, { 0, 127, 55 }, { 0, 128, 56 }
+
+    // State 151
+    , { 2, 151, 39 }, { 2, 151, 40 }, 
+    { 2, 151, 41 }, { 3, 110, 50 }, { 3, 110, 86 }
+
+    // State 152
+    , { 3, 111, 0 }, { 3, 111, 3 }, 
+    { 3, 111, 4 }, { 3, 111, 8 }, { 3, 111, 10 }, { 3, 111, 11 }, { 3, 111, 12 }, 
+    { 3, 111, 16 }, { 3, 111, 17 }, { 3, 111, 18 }, { 3, 111, 20 }, { 3, 111, 21 }, 
+    { 3, 111, 23 }, { 3, 111, 24 }, { 3, 111, 26 }, { 3, 111, 27 }, { 3, 111, 28 }, 
+    { 3, 111, 29 }, { 3, 111, 30 }, { 8, 263, 32 }, { 8, 163, 32 }, { 8, 43, 32 }, 
+    { 8, 1, 32 }, { 3, 111, 32 }, { 2, 152, 39 }, { 2, 152, 40 }, { 2, 152, 41 }, 
+    { 8, 1, 42 }, { 8, 43, 42 }, { 8, 163, 42 }, { 8, 263, 42 }, { 3, 111, 42 }, 
+    { 3, 111, 43 }, { 3, 111, 44 }, { 3, 111, 50 }, { 8, 1, 52 }, { 8, 43, 52 }, 
+    { 8, 163, 52 }, { 8, 263, 52 }, { 3, 111, 52 }, { 8, 163, 72 }, { 8, 43, 84 }
+
+    // State 153
+    , { 2, 153, 39 }, { 2, 153, 40 }, { 2, 153, 41 }, { 0, 219, 50 }, { 3, 112, 86 }
+
+    // State 154
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, { 0, 116, 35 }, 
+    { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 154, 39 }, { 2, 154, 40 }, 
+    { 2, 154, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, { 0, 123, 51 }, 
+    { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, { 0, 128, 56 }, 
+    { 0, 154, 85 }
+
+    // State 155
+    , { 2, 155, 39 }, { 2, 155, 40 }, { 2, 155, 41 }, { 3, 113, 50 }, 
+    { 3, 113, 84 }, { 3, 113, 86 }
+
+    // State 156
+    , { 2, 156, 39 }, { 2, 156, 40 }, { 2, 156, 41 }, 
+    { 3, 96, 43 }, { 3, 96, 45 }, { 3, 96, 50 }, { 3, 96, 51 }, { 3, 96, 52 }, 
+    { 3, 96, 53 }, { 3, 96, 54 }, { 3, 96, 57 }, { 3, 96, 58 }, { 3, 96, 59 }, 
+    { 3, 96, 60 }, { 3, 96, 61 }, { 3, 96, 62 }, { 3, 96, 63 }, { 3, 96, 64 }, 
+    { 3, 96, 65 }, { 3, 96, 66 }, { 3, 96, 67 }, { 3, 96, 68 }, { 3, 96, 69 }, 
+    { 3, 96, 70 }, { 3, 96, 71 }, { 3, 96, 72 }, { 0, 221, 73 }, { 0, 222, 74 }, 
+    { 0, 223, 75 }, { 0, 224, 76 }, { 0, 225, 77 }, { 0, 226, 78 }, { 0, 227, 79 }, 
+    { 0, 228, 80 }, { 0, 229, 81 }, { 0, 230, 82 }, { 0, 231, 83 }, { 3, 96, 84 }, 
+    { 3, 96, 86 }
+
+    // State 157
+    , { 2, 157, 39 }, { 2, 157, 40 }, { 2, 157, 41 }, { 3, 114, 43 }, 
+    { 3, 114, 45 }, { 3, 114, 50 }, { 3, 114, 72 }, { 3, 114, 84 }, { 3, 114, 86 }
+
+    // State 158
+    , { 2, 158, 39 }, { 2, 158, 40 }, { 2, 158, 41 }, { 3, 115, 50 }, { 3, 115, 84 }
+
+    // State 159
+    , { 3, 0, 32 }, { 2, 159, 39 }, { 2, 159, 40 }, { 2, 159, 41 }, { 3, 0, 42 }, 
+    { 0, 37, 52 }
+
+    // State 160
+    , { 3, 116, 0 }, { 3, 116, 3 }, { 3, 116, 4 }, { 3, 116, 8 }, 
+    { 3, 116, 10 }, { 3, 116, 11 }, { 3, 116, 12 }, { 3, 116, 16 }, { 3, 116, 17 }, 
+    { 3, 116, 18 }, { 3, 116, 20 }, { 3, 116, 21 }, { 3, 116, 23 }, { 3, 116, 24 }, 
+    { 3, 116, 26 }, { 3, 116, 27 }, { 3, 116, 28 }, { 3, 116, 29 }, { 3, 116, 30 }, 
+    { 8, 1, 32 }, { 3, 116, 32 }, { 2, 160, 39 }, { 2, 160, 40 }, { 2, 160, 41 }, 
+    { 8, 1, 42 }, { 8, 1, 52 }
+
+    // State 161
+    , { 0, 234, 1 }, { 0, 235, 2 }, { 0, 236, 5 }, 
+    { 0, 237, 6 }, { 0, 238, 7 }, { 0, 239, 13 }, { 0, 240, 14 }, { 0, 241, 15 }, 
+    { 0, 242, 19 }, { 0, 112, 22 }, { 0, 243, 25 }, { 0, 244, 31 }, { 0, 245, 32 }, 
+    { 0, 114, 33 }, { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, 
+    { 0, 119, 38 }, { 2, 161, 39 }, { 2, 161, 40 }, { 2, 161, 41 }, { 0, 120, 42 }, 
+    { 0, 121, 48 }, { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, 
+    { 0, 126, 54 }, { 0, 127, 55 }, { 0, 128, 56 }, { 3, 117, 84 }, { 0, 94, 85 }, 
+    { 3, 118, 86 }
+
+    // State 162
+    , { 3, 119, 0 }, { 3, 119, 3 }, { 3, 119, 4 }, { 3, 119, 8 }, 
+    { 3, 119, 10 }, { 3, 119, 11 }, { 3, 119, 12 }, { 3, 119, 16 }, { 3, 119, 17 }, 
+    { 3, 119, 18 }, { 3, 119, 20 }, { 3, 119, 21 }, { 3, 119, 23 }, { 3, 119, 24 }, 
+    { 3, 119, 26 }, { 3, 119, 27 }, { 3, 119, 28 }, { 3, 119, 29 }, { 3, 119, 30 }, 
+    { 8, 263, 32 }, { 8, 163, 32 }, { 8, 43, 32 }, { 8, 1, 32 }, { 3, 119, 32 }, 
+    { 2, 162, 39 }, { 2, 162, 40 }, { 2, 162, 41 }, { 8, 1, 42 }, { 8, 43, 42 }, 
+    { 8, 163, 42 }, { 8, 263, 42 }, { 3, 119, 42 }, { 3, 119, 43 }, { 3, 119, 44 }, 
+    { 3, 119, 50 }, { 8, 1, 52 }, { 8, 43, 52 }, { 8, 163, 52 }, { 8, 263, 52 }, 
+    { 3, 119, 52 }, { 8, 163, 72 }, { 8, 43, 84 }
+
+    // State 163
+    , { 3, 0, 32 }, { 2, 163, 39 }, 
+    { 2, 163, 40 }, { 2, 163, 41 }, { 3, 0, 42 }, { 0, 37, 52 }, { 0, 258, 72 }
+
+    // State 164
+    , { 3, 0, 32 }, { 2, 164, 39 }, { 2, 164, 40 }, { 2, 164, 41 }, { 3, 0, 42 }, 
+    { 0, 37, 52 }, { 0, 258, 72 }
+
+    // State 165
+    , { 3, 120, 3 }, { 3, 120, 4 }, { 3, 120, 8 }, 
+    { 3, 120, 10 }, { 3, 120, 12 }, { 3, 120, 16 }, { 3, 120, 17 }, { 3, 120, 20 }, 
+    { 3, 120, 21 }, { 3, 120, 24 }, { 3, 120, 27 }, { 3, 120, 28 }, { 3, 120, 29 }, 
+    { 3, 120, 30 }, { 8, 163, 32 }, { 3, 120, 32 }, { 2, 165, 39 }, { 2, 165, 40 }, 
+    { 2, 165, 41 }, { 8, 163, 42 }, { 3, 120, 42 }, { 3, 120, 43 }, { 3, 120, 44 }, 
+    { 8, 163, 52 }, { 3, 120, 52 }, { 8, 163, 72 }
+
+    // State 166
+    , { 8, 263, 32 }, { 2, 166, 39 }, 
+    { 2, 166, 40 }, { 2, 166, 41 }, { 8, 263, 42 }, { 0, 264, 42 }, { 3, 121, 43 }, 
+    { 0, 265, 44 }, { 3, 121, 50 }, { 8, 263, 52 }, { 0, 37, 52 }
+
+    // State 167
+    , { 2, 167, 39 }, 
+    { 2, 167, 40 }, { 2, 167, 41 }, { 0, 272, 43 }
+
+    // State 168
+    , { 2, 168, 39 }, { 2, 168, 40 }, 
+    { 2, 168, 41 }, { 3, 122, 43 }, { 3, 122, 50 }
+
+    // State 169
+    , { 2, 169, 39 }, { 2, 169, 40 }, 
+    { 2, 169, 41 }, { 3, 123, 43 }, { 0, 274, 50 }
+
+    // State 170
+    , { 2, 170, 39 }, { 2, 170, 40 }, 
+    { 2, 170, 41 }, { 3, 124, 43 }
+
+    // State 171
+    , { 8, 52, 0 }, { 8, 52, 3 }, { 8, 52, 4 }, 
+    { 8, 52, 8 }, { 8, 52, 10 }, { 8, 52, 11 }, { 8, 52, 12 }, { 8, 52, 16 }, 
+    { 8, 52, 17 }, { 8, 52, 18 }, { 8, 52, 20 }, { 8, 52, 21 }, { 8, 52, 23 }, 
+    { 8, 52, 24 }, { 8, 52, 26 }, { 8, 52, 27 }, { 8, 52, 28 }, { 8, 52, 29 }, 
+    { 8, 52, 30 }, { 8, 52, 32 }, { 2, 171, 39 }, { 2, 171, 40 }, { 2, 171, 41 }, 
+    { 3, 125, 42 }, { 3, 125, 43 }, { 3, 125, 44 }, { 3, 125, 50 }, { 3, 125, 72 }, 
+    { 3, 125, 73 }, { 3, 125, 84 }, { 3, 125, 85 }
+
+    // State 172
+    , { 2, 172, 39 }, { 2, 172, 40 }, 
+    { 2, 172, 41 }, { 0, 275, 42 }
+
+    // State 173
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, 
+    { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, 
+    { 2, 173, 39 }, { 2, 173, 40 }, { 2, 173, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, 
+    { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, 
+    { 0, 127, 55 }, { 0, 128, 56 }
+
+    // State 174
+    , { 2, 174, 39 }, { 2, 174, 40 }, { 2, 174, 41 }, 
+    { 3, 126, 43 }, { 3, 126, 45 }, { 3, 126, 50 }, { 3, 126, 51 }, { 3, 126, 52 }, 
+    { 3, 126, 53 }, { 3, 126, 54 }, { 3, 126, 57 }, { 3, 126, 58 }, { 3, 126, 59 }, 
+    { 3, 126, 60 }, { 3, 126, 61 }, { 3, 126, 62 }, { 3, 126, 63 }, { 3, 126, 64 }, 
+    { 3, 126, 65 }, { 3, 126, 66 }, { 3, 126, 67 }, { 3, 126, 68 }, { 3, 126, 69 }, 
+    { 3, 126, 70 }, { 3, 126, 71 }, { 3, 126, 72 }, { 3, 126, 73 }, { 3, 126, 74 }, 
+    { 3, 126, 75 }, { 3, 126, 76 }, { 3, 126, 77 }, { 3, 126, 78 }, { 3, 126, 79 }, 
+    { 3, 126, 80 }, { 3, 126, 81 }, { 3, 126, 82 }, { 3, 126, 83 }, { 3, 126, 84 }, 
+    { 3, 126, 86 }
+
+    // State 175
+    , { 2, 175, 39 }, { 2, 175, 40 }, { 2, 175, 41 }, { 0, 276, 42 }
+
+    // State 176
+    , { 0, 277, 3 }, { 0, 4, 4 }, { 0, 278, 8 }, { 0, 6, 10 }, { 0, 279, 12 }, 
+    { 0, 280, 16 }, { 0, 281, 17 }, { 0, 282, 20 }, { 0, 283, 21 }, { 0, 15, 24 }, 
+    { 0, 17, 27 }, { 0, 284, 28 }, { 0, 285, 29 }, { 0, 20, 30 }, { 0, 286, 32 }, 
+    { 2, 176, 39 }, { 2, 176, 40 }, { 2, 176, 41 }
+
+    // State 177
+    , { 0, 292, 32 }, { 2, 177, 39 }, 
+    { 2, 177, 40 }, { 2, 177, 41 }
+
+    // State 178
+    , { 2, 178, 39 }, { 2, 178, 40 }, { 2, 178, 41 }, 
+    { 0, 294, 43 }, { 0, 295, 50 }
+
+    // State 179
+    , { 2, 179, 39 }, { 2, 179, 40 }, { 2, 179, 41 }, 
+    { 3, 127, 43 }, { 3, 127, 45 }, { 3, 127, 50 }, { 3, 127, 72 }, { 3, 127, 84 }
+
+    // State 180
+    , { 0, 3, 3 }, { 0, 4, 4 }, { 0, 5, 8 }, { 0, 6, 10 }, { 0, 8, 12 }, 
+    { 0, 9, 16 }, { 0, 10, 17 }, { 0, 12, 20 }, { 0, 13, 21 }, { 0, 15, 24 }, 
+    { 0, 17, 27 }, { 0, 18, 28 }, { 0, 19, 29 }, { 0, 20, 30 }, { 0, 21, 32 }, 
+    { 2, 180, 39 }, { 2, 180, 40 }, { 2, 180, 41 }
+
+    // State 181
+    , { 0, 3, 3 }, { 0, 4, 4 }, 
+    { 0, 5, 8 }, { 0, 6, 10 }, { 0, 8, 12 }, { 0, 9, 16 }, { 0, 10, 17 }, 
+    { 0, 12, 20 }, { 0, 13, 21 }, { 0, 15, 24 }, { 0, 17, 27 }, { 0, 18, 28 }, 
+    { 0, 19, 29 }, { 0, 20, 30 }, { 0, 21, 32 }, { 2, 181, 39 }, { 2, 181, 40 }, 
+    { 2, 181, 41 }
+
+    // State 182
+    , { 2, 182, 39 }, { 2, 182, 40 }, { 2, 182, 41 }, { 3, 128, 43 }, 
+    { 3, 128, 45 }, { 3, 128, 50 }, { 3, 128, 51 }, { 3, 128, 52 }, { 3, 128, 53 }, 
+    { 3, 128, 54 }, { 3, 128, 57 }, { 3, 128, 58 }, { 3, 128, 59 }, { 3, 128, 60 }, 
+    { 3, 128, 61 }, { 3, 128, 62 }, { 3, 128, 63 }, { 3, 128, 64 }, { 3, 128, 65 }, 
+    { 3, 128, 66 }, { 3, 128, 67 }, { 3, 128, 68 }, { 3, 128, 69 }, { 3, 128, 70 }, 
+    { 3, 128, 71 }, { 3, 128, 72 }, { 3, 128, 73 }, { 3, 128, 74 }, { 3, 128, 75 }, 
+    { 3, 128, 76 }, { 3, 128, 77 }, { 3, 128, 78 }, { 3, 128, 79 }, { 3, 128, 80 }, 
+    { 3, 128, 81 }, { 3, 128, 82 }, { 3, 128, 83 }, { 3, 128, 84 }, { 3, 128, 86 }
+
+    // State 183
+    , { 2, 183, 39 }, { 2, 183, 40 }, { 2, 183, 41 }, { 3, 129, 43 }, { 3, 129, 45 }, 
+    { 3, 129, 50 }, { 3, 129, 51 }, { 3, 129, 52 }, { 3, 129, 53 }, { 3, 129, 54 }, 
+    { 3, 129, 57 }, { 3, 129, 58 }, { 3, 129, 59 }, { 3, 129, 60 }, { 3, 129, 61 }, 
+    { 3, 129, 62 }, { 3, 129, 63 }, { 3, 129, 64 }, { 3, 129, 65 }, { 3, 129, 66 }, 
+    { 3, 129, 67 }, { 3, 129, 68 }, { 3, 129, 69 }, { 3, 129, 70 }, { 3, 129, 71 }, 
+    { 3, 129, 72 }, { 3, 129, 73 }, { 3, 129, 74 }, { 3, 129, 75 }, { 3, 129, 76 }, 
+    { 3, 129, 77 }, { 3, 129, 78 }, { 3, 129, 79 }, { 3, 129, 80 }, { 3, 129, 81 }, 
+    { 3, 129, 82 }, { 3, 129, 83 }, { 3, 129, 84 }, { 3, 129, 86 }
+
+    // State 184
+    , { 0, 112, 22 }, 
+    { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, 
+    { 0, 118, 37 }, { 0, 119, 38 }, { 2, 184, 39 }, { 2, 184, 40 }, { 2, 184, 41 }, 
+    { 0, 120, 42 }, { 3, 130, 43 }, { 0, 121, 48 }, { 0, 122, 49 }, { 0, 123, 51 }, 
+    { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, { 0, 128, 56 }
+
+    // State 185
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, { 0, 116, 35 }, 
+    { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 185, 39 }, { 2, 185, 40 }, 
+    { 2, 185, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, { 0, 123, 51 }, 
+    { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, { 0, 128, 56 }
+
+    // State 186
+    , { 0, 303, 32 }, { 2, 186, 39 }, { 2, 186, 40 }, { 2, 186, 41 }
+
+    // State 187
+    , { 0, 304, 32 }, 
+    { 2, 187, 39 }, { 2, 187, 40 }, { 2, 187, 41 }
+
+    // State 188
+    , { 2, 188, 39 }, { 2, 188, 40 }, 
+    { 2, 188, 41 }, { 3, 131, 42 }, { 3, 131, 43 }, { 3, 131, 44 }, { 3, 131, 45 }, 
+    { 3, 131, 46 }, { 3, 131, 47 }, { 3, 131, 48 }, { 3, 131, 49 }, { 3, 131, 50 }, 
+    { 3, 131, 51 }, { 3, 131, 52 }, { 3, 131, 53 }, { 3, 131, 54 }, { 3, 131, 57 }, 
+    { 3, 131, 58 }, { 3, 131, 59 }, { 3, 131, 60 }, { 3, 131, 61 }, { 3, 131, 62 }, 
+    { 3, 131, 63 }, { 3, 131, 64 }, { 3, 131, 65 }, { 3, 131, 66 }, { 3, 131, 67 }, 
+    { 3, 131, 68 }, { 3, 131, 69 }, { 3, 131, 70 }, { 3, 131, 71 }, { 3, 131, 72 }, 
+    { 3, 131, 73 }, { 3, 131, 74 }, { 3, 131, 75 }, { 3, 131, 76 }, { 3, 131, 77 }, 
+    { 3, 131, 78 }, { 3, 131, 79 }, { 3, 131, 80 }, { 3, 131, 81 }, { 3, 131, 82 }, 
+    { 3, 131, 83 }, { 3, 131, 84 }, { 3, 131, 86 }
+
+    // State 189
+    , { 2, 189, 39 }, { 2, 189, 40 }, 
+    { 2, 189, 41 }, { 3, 132, 42 }, { 3, 132, 43 }, { 3, 132, 44 }, { 3, 132, 45 }, 
+    { 3, 132, 46 }, { 3, 132, 47 }, { 3, 132, 48 }, { 3, 132, 49 }, { 3, 132, 50 }, 
+    { 3, 132, 51 }, { 3, 132, 52 }, { 3, 132, 53 }, { 3, 132, 54 }, { 3, 132, 57 }, 
+    { 3, 132, 58 }, { 3, 132, 59 }, { 3, 132, 60 }, { 3, 132, 61 }, { 3, 132, 62 }, 
+    { 3, 132, 63 }, { 3, 132, 64 }, { 3, 132, 65 }, { 3, 132, 66 }, { 3, 132, 67 }, 
+    { 3, 132, 68 }, { 3, 132, 69 }, { 3, 132, 70 }, { 3, 132, 71 }, { 3, 132, 72 }, 
+    { 3, 132, 73 }, { 3, 132, 74 }, { 3, 132, 75 }, { 3, 132, 76 }, { 3, 132, 77 }, 
+    { 3, 132, 78 }, { 3, 132, 79 }, { 3, 132, 80 }, { 3, 132, 81 }, { 3, 132, 82 }, 
+    { 3, 132, 83 }, { 3, 132, 84 }, { 3, 132, 86 }
+
+    // State 190
+    , { 2, 190, 39 }, { 2, 190, 40 }, 
+    { 2, 190, 41 }, { 3, 133, 43 }, { 3, 133, 45 }, { 3, 133, 50 }, { 3, 133, 51 }, 
+    { 3, 133, 52 }, { 3, 133, 53 }, { 3, 133, 54 }, { 3, 133, 57 }, { 3, 133, 58 }, 
+    { 3, 133, 59 }, { 3, 133, 60 }, { 3, 133, 61 }, { 3, 133, 62 }, { 3, 133, 63 }, 
+    { 3, 133, 64 }, { 3, 133, 65 }, { 3, 133, 66 }, { 3, 133, 67 }, { 3, 133, 68 }, 
+    { 3, 133, 69 }, { 3, 133, 70 }, { 3, 133, 71 }, { 3, 133, 72 }, { 3, 133, 73 }, 
+    { 3, 133, 74 }, { 3, 133, 75 }, { 3, 133, 76 }, { 3, 133, 77 }, { 3, 133, 78 }, 
+    { 3, 133, 79 }, { 3, 133, 80 }, { 3, 133, 81 }, { 3, 133, 82 }, { 3, 133, 83 }, 
+    { 3, 133, 84 }, { 3, 133, 86 }
+
+    // State 191
+    , { 2, 191, 39 }, { 2, 191, 40 }, { 2, 191, 41 }, 
+    { 3, 134, 43 }, { 3, 134, 45 }, { 3, 134, 50 }, { 3, 134, 51 }, { 3, 134, 52 }, 
+    { 3, 134, 53 }, { 3, 134, 54 }, { 3, 134, 57 }, { 3, 134, 58 }, { 3, 134, 59 }, 
+    { 3, 134, 60 }, { 3, 134, 61 }, { 3, 134, 62 }, { 3, 134, 63 }, { 3, 134, 64 }, 
+    { 3, 134, 65 }, { 3, 134, 66 }, { 3, 134, 67 }, { 3, 134, 68 }, { 3, 134, 69 }, 
+    { 3, 134, 70 }, { 3, 134, 71 }, { 3, 134, 72 }, { 3, 134, 73 }, { 3, 134, 74 }, 
+    { 3, 134, 75 }, { 3, 134, 76 }, { 3, 134, 77 }, { 3, 134, 78 }, { 3, 134, 79 }, 
+    { 3, 134, 80 }, { 3, 134, 81 }, { 3, 134, 82 }, { 3, 134, 83 }, { 3, 134, 84 }, 
+    { 3, 134, 86 }
+
+    // State 192
+    , { 3, 135, 22 }, { 3, 135, 32 }, { 3, 135, 33 }, { 3, 135, 34 }, 
+    { 3, 135, 35 }, { 3, 135, 36 }, { 3, 135, 37 }, { 3, 135, 38 }, { 2, 192, 39 }, 
+    { 2, 192, 40 }, { 2, 192, 41 }, { 3, 135, 42 }, { 3, 135, 48 }, { 3, 135, 49 }, 
+    { 3, 135, 51 }, { 3, 135, 52 }, { 3, 135, 53 }, { 3, 135, 54 }, { 3, 135, 55 }, 
+    { 3, 135, 56 }
+
+    // State 193
+    , { 3, 136, 22 }, { 3, 136, 32 }, { 3, 136, 33 }, { 3, 136, 34 }, 
+    { 3, 136, 35 }, { 3, 136, 36 }, { 3, 136, 37 }, { 3, 136, 38 }, { 2, 193, 39 }, 
+    { 2, 193, 40 }, { 2, 193, 41 }, { 3, 136, 42 }, { 3, 136, 48 }, { 3, 136, 49 }, 
+    { 3, 136, 51 }, { 3, 136, 52 }, { 3, 136, 53 }, { 3, 136, 54 }, { 3, 136, 55 }, 
+    { 3, 136, 56 }
+
+    // State 194
+    , { 3, 137, 22 }, { 3, 137, 32 }, { 3, 137, 33 }, { 3, 137, 34 }, 
+    { 3, 137, 35 }, { 3, 137, 36 }, { 3, 137, 37 }, { 3, 137, 38 }, { 2, 194, 39 }, 
+    { 2, 194, 40 }, { 2, 194, 41 }, { 3, 137, 42 }, { 3, 137, 48 }, { 3, 137, 49 }, 
+    { 3, 137, 51 }, { 3, 137, 52 }, { 3, 137, 53 }, { 3, 137, 54 }, { 3, 137, 55 }, 
+    { 3, 137, 56 }
+
+    // State 195
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 195, 39 }, 
+    { 2, 195, 40 }, { 2, 195, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }
+
+    // State 196
+    , { 3, 138, 22 }, { 3, 138, 32 }, { 3, 138, 33 }, { 3, 138, 34 }, 
+    { 3, 138, 35 }, { 3, 138, 36 }, { 3, 138, 37 }, { 3, 138, 38 }, { 2, 196, 39 }, 
+    { 2, 196, 40 }, { 2, 196, 41 }, { 3, 138, 42 }, { 3, 138, 48 }, { 3, 138, 49 }, 
+    { 3, 138, 51 }, { 3, 138, 52 }, { 3, 138, 53 }, { 3, 138, 54 }, { 3, 138, 55 }, 
+    { 3, 138, 56 }
+
+    // State 197
+    , { 3, 139, 22 }, { 3, 139, 32 }, { 3, 139, 33 }, { 3, 139, 34 }, 
+    { 3, 139, 35 }, { 3, 139, 36 }, { 3, 139, 37 }, { 3, 139, 38 }, { 2, 197, 39 }, 
+    { 2, 197, 40 }, { 2, 197, 41 }, { 3, 139, 42 }, { 3, 139, 48 }, { 3, 139, 49 }, 
+    { 3, 139, 51 }, { 3, 139, 52 }, { 3, 139, 53 }, { 3, 139, 54 }, { 3, 139, 55 }, 
+    { 3, 139, 56 }
+
+    // State 198
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 198, 39 }, 
+    { 2, 198, 40 }, { 2, 198, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }
+
+    // State 199
+    , { 3, 140, 22 }, { 3, 140, 32 }, { 3, 140, 33 }, { 3, 140, 34 }, 
+    { 3, 140, 35 }, { 3, 140, 36 }, { 3, 140, 37 }, { 3, 140, 38 }, { 2, 199, 39 }, 
+    { 2, 199, 40 }, { 2, 199, 41 }, { 3, 140, 42 }, { 3, 140, 48 }, { 3, 140, 49 }, 
+    { 3, 140, 51 }, { 3, 140, 52 }, { 3, 140, 53 }, { 3, 140, 54 }, { 3, 140, 55 }, 
+    { 3, 140, 56 }
+
+    // State 200
+    , { 3, 141, 22 }, { 3, 141, 32 }, { 3, 141, 33 }, { 3, 141, 34 }, 
+    { 3, 141, 35 }, { 3, 141, 36 }, { 3, 141, 37 }, { 3, 141, 38 }, { 2, 200, 39 }, 
+    { 2, 200, 40 }, { 2, 200, 41 }, { 3, 141, 42 }, { 3, 141, 48 }, { 3, 141, 49 }, 
+    { 3, 141, 51 }, { 3, 141, 52 }, { 3, 141, 53 }, { 3, 141, 54 }, { 3, 141, 55 }, 
+    { 3, 141, 56 }
+
+    // State 201
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 201, 39 }, 
+    { 2, 201, 40 }, { 2, 201, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }
+
+    // State 202
+    , { 3, 142, 22 }, { 3, 142, 32 }, { 3, 142, 33 }, { 3, 142, 34 }, 
+    { 3, 142, 35 }, { 3, 142, 36 }, { 3, 142, 37 }, { 3, 142, 38 }, { 2, 202, 39 }, 
+    { 2, 202, 40 }, { 2, 202, 41 }, { 3, 142, 42 }, { 3, 142, 48 }, { 3, 142, 49 }, 
+    { 3, 142, 51 }, { 3, 142, 52 }, { 3, 142, 53 }, { 3, 142, 54 }, { 3, 142, 55 }, 
+    { 3, 142, 56 }
+
+    // State 203
+    , { 3, 143, 22 }, { 3, 143, 32 }, { 3, 143, 33 }, { 3, 143, 34 }, 
+    { 3, 143, 35 }, { 3, 143, 36 }, { 3, 143, 37 }, { 3, 143, 38 }, { 2, 203, 39 }, 
+    { 2, 203, 40 }, { 2, 203, 41 }, { 3, 143, 42 }, { 3, 143, 48 }, { 3, 143, 49 }, 
+    { 3, 143, 51 }, { 3, 143, 52 }, { 3, 143, 53 }, { 3, 143, 54 }, { 3, 143, 55 }, 
+    { 3, 143, 56 }
+
+    // State 204
+    , { 3, 144, 22 }, { 3, 144, 32 }, { 3, 144, 33 }, { 3, 144, 34 }, 
+    { 3, 144, 35 }, { 3, 144, 36 }, { 3, 144, 37 }, { 3, 144, 38 }, { 2, 204, 39 }, 
+    { 2, 204, 40 }, { 2, 204, 41 }, { 3, 144, 42 }, { 3, 144, 48 }, { 3, 144, 49 }, 
+    { 3, 144, 51 }, { 3, 144, 52 }, { 3, 144, 53 }, { 3, 144, 54 }, { 3, 144, 55 }, 
+    { 3, 144, 56 }
+
+    // State 205
+    , { 3, 145, 22 }, { 3, 145, 32 }, { 3, 145, 33 }, { 3, 145, 34 }, 
+    { 3, 145, 35 }, { 3, 145, 36 }, { 3, 145, 37 }, { 3, 145, 38 }, { 2, 205, 39 }, 
+    { 2, 205, 40 }, { 2, 205, 41 }, { 3, 145, 42 }, { 3, 145, 48 }, { 3, 145, 49 }, 
+    { 3, 145, 51 }, { 3, 145, 52 }, { 3, 145, 53 }, { 3, 145, 54 }, { 3, 145, 55 }, 
+    { 3, 145, 56 }
+
+    // State 206
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 206, 39 }, 
+    { 2, 206, 40 }, { 2, 206, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }
+
+    // State 207
+    , { 3, 146, 22 }, { 3, 146, 32 }, { 3, 146, 33 }, { 3, 146, 34 }, 
+    { 3, 146, 35 }, { 3, 146, 36 }, { 3, 146, 37 }, { 3, 146, 38 }, { 2, 207, 39 }, 
+    { 2, 207, 40 }, { 2, 207, 41 }, { 3, 146, 42 }, { 3, 146, 48 }, { 3, 146, 49 }, 
+    { 3, 146, 51 }, { 3, 146, 52 }, { 3, 146, 53 }, { 3, 146, 54 }, { 3, 146, 55 }, 
+    { 3, 146, 56 }
+
+    // State 208
+    , { 3, 147, 22 }, { 3, 147, 32 }, { 3, 147, 33 }, { 3, 147, 34 }, 
+    { 3, 147, 35 }, { 3, 147, 36 }, { 3, 147, 37 }, { 3, 147, 38 }, { 2, 208, 39 }, 
+    { 2, 208, 40 }, { 2, 208, 41 }, { 3, 147, 42 }, { 3, 147, 48 }, { 3, 147, 49 }, 
+    { 3, 147, 51 }, { 3, 147, 52 }, { 3, 147, 53 }, { 3, 147, 54 }, { 3, 147, 55 }, 
+    { 3, 147, 56 }
+
+    // State 209
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 209, 39 }, 
+    { 2, 209, 40 }, { 2, 209, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }
+
+    // State 210
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 210, 39 }, 
+    { 2, 210, 40 }, { 2, 210, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }
+
+    // State 211
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 211, 39 }, 
+    { 2, 211, 40 }, { 2, 211, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }
+
+    // State 212
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 212, 39 }, 
+    { 2, 212, 40 }, { 2, 212, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }
+
+    // State 213
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 213, 39 }, 
+    { 2, 213, 40 }, { 2, 213, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }
+
+    // State 214
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 214, 39 }, 
+    { 2, 214, 40 }, { 2, 214, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }
+
+    // State 215
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 215, 39 }, 
+    { 2, 215, 40 }, { 2, 215, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }
+
+    // State 216
+    , { 8, 52, 0 }, { 8, 52, 3 }, { 8, 52, 4 }, { 8, 52, 8 }, 
+    { 8, 52, 10 }, { 8, 52, 11 }, { 8, 52, 12 }, { 8, 52, 16 }, { 8, 52, 17 }, 
+    { 8, 52, 18 }, { 8, 52, 20 }, { 8, 52, 21 }, { 8, 52, 23 }, { 8, 52, 24 }, 
+    { 8, 52, 26 }, { 8, 52, 27 }, { 8, 52, 28 }, { 8, 52, 29 }, { 8, 52, 30 }, 
+    { 8, 52, 32 }, { 2, 216, 39 }, { 2, 216, 40 }, { 2, 216, 41 }, { 3, 148, 42 }, 
+    { 3, 148, 43 }, { 3, 148, 44 }, { 3, 148, 50 }, { 3, 148, 72 }, { 3, 148, 73 }, 
+    { 3, 148, 84 }, { 3, 148, 85 }
+
+    // State 217
+    , { 2, 217, 39 }, { 2, 217, 40 }, { 2, 217, 41 }, 
+    { 3, 149, 43 }, { 3, 149, 45 }, { 3, 149, 50 }, { 3, 149, 51 }, { 3, 149, 52 }, 
+    { 3, 149, 53 }, { 3, 149, 54 }, { 3, 149, 57 }, { 3, 149, 58 }, { 3, 149, 59 }, 
+    { 3, 149, 60 }, { 3, 149, 61 }, { 3, 149, 62 }, { 3, 149, 63 }, { 3, 149, 64 }, 
+    { 3, 149, 65 }, { 3, 149, 66 }, { 3, 149, 67 }, { 3, 149, 68 }, { 3, 149, 69 }, 
+    { 3, 149, 70 }, { 3, 149, 71 }, { 3, 149, 72 }, { 3, 149, 73 }, { 3, 149, 74 }, 
+    { 3, 149, 75 }, { 3, 149, 76 }, { 3, 149, 77 }, { 3, 149, 78 }, { 3, 149, 79 }, 
+    { 3, 149, 80 }, { 3, 149, 81 }, { 3, 149, 82 }, { 3, 149, 83 }, { 3, 149, 84 }, 
+    { 3, 149, 86 }
+
+    // State 218
+    , { 2, 218, 39 }, { 2, 218, 40 }, { 2, 218, 41 }, { 3, 150, 50 }, 
+    { 3, 150, 86 }
+
+    // State 219
+    , { 0, 83, 32 }, { 2, 219, 39 }, { 2, 219, 40 }, { 2, 219, 41 }
+
+    // State 220
+    , { 2, 220, 39 }, { 2, 220, 40 }, { 2, 220, 41 }, { 3, 151, 50 }, { 3, 151, 86 }
+
+    // State 221
+    , { 3, 152, 22 }, { 3, 152, 32 }, { 3, 152, 33 }, { 3, 152, 34 }, { 3, 152, 35 }, 
+    { 3, 152, 36 }, { 3, 152, 37 }, { 3, 152, 38 }, { 2, 221, 39 }, { 2, 221, 40 }, 
+    { 2, 221, 41 }, { 3, 152, 42 }, { 3, 152, 48 }, { 3, 152, 49 }, { 3, 152, 51 }, 
+    { 3, 152, 52 }, { 3, 152, 53 }, { 3, 152, 54 }, { 3, 152, 55 }, { 3, 152, 56 }
+
+    // State 222
+    , { 3, 153, 22 }, { 3, 153, 32 }, { 3, 153, 33 }, { 3, 153, 34 }, { 3, 153, 35 }, 
+    { 3, 153, 36 }, { 3, 153, 37 }, { 3, 153, 38 }, { 2, 222, 39 }, { 2, 222, 40 }, 
+    { 2, 222, 41 }, { 3, 153, 42 }, { 3, 153, 48 }, { 3, 153, 49 }, { 3, 153, 51 }, 
+    { 3, 153, 52 }, { 3, 153, 53 }, { 3, 153, 54 }, { 3, 153, 55 }, { 3, 153, 56 }
+
+    // State 223
+    , { 3, 154, 22 }, { 3, 154, 32 }, { 3, 154, 33 }, { 3, 154, 34 }, { 3, 154, 35 }, 
+    { 3, 154, 36 }, { 3, 154, 37 }, { 3, 154, 38 }, { 2, 223, 39 }, { 2, 223, 40 }, 
+    { 2, 223, 41 }, { 3, 154, 42 }, { 3, 154, 48 }, { 3, 154, 49 }, { 3, 154, 51 }, 
+    { 3, 154, 52 }, { 3, 154, 53 }, { 3, 154, 54 }, { 3, 154, 55 }, { 3, 154, 56 }
+
+    // State 224
+    , { 3, 155, 22 }, { 3, 155, 32 }, { 3, 155, 33 }, { 3, 155, 34 }, { 3, 155, 35 }, 
+    { 3, 155, 36 }, { 3, 155, 37 }, { 3, 155, 38 }, { 2, 224, 39 }, { 2, 224, 40 }, 
+    { 2, 224, 41 }, { 3, 155, 42 }, { 3, 155, 48 }, { 3, 155, 49 }, { 3, 155, 51 }, 
+    { 3, 155, 52 }, { 3, 155, 53 }, { 3, 155, 54 }, { 3, 155, 55 }, { 3, 155, 56 }
+
+    // State 225
+    , { 3, 156, 22 }, { 3, 156, 32 }, { 3, 156, 33 }, { 3, 156, 34 }, { 3, 156, 35 }, 
+    { 3, 156, 36 }, { 3, 156, 37 }, { 3, 156, 38 }, { 2, 225, 39 }, { 2, 225, 40 }, 
+    { 2, 225, 41 }, { 3, 156, 42 }, { 3, 156, 48 }, { 3, 156, 49 }, { 3, 156, 51 }, 
+    { 3, 156, 52 }, { 3, 156, 53 }, { 3, 156, 54 }, { 3, 156, 55 }, { 3, 156, 56 }
+
+    // State 226
+    , { 3, 157, 22 }, { 3, 157, 32 }, { 3, 157, 33 }, { 3, 157, 34 }, { 3, 157, 35 }, 
+    { 3, 157, 36 }, { 3, 157, 37 }, { 3, 157, 38 }, { 2, 226, 39 }, { 2, 226, 40 }, 
+    { 2, 226, 41 }, { 3, 157, 42 }, { 3, 157, 48 }, { 3, 157, 49 }, { 3, 157, 51 }, 
+    { 3, 157, 52 }, { 3, 157, 53 }, { 3, 157, 54 }, { 3, 157, 55 }, { 3, 157, 56 }
+
+    // State 227
+    , { 3, 158, 22 }, { 3, 158, 32 }, { 3, 158, 33 }, { 3, 158, 34 }, { 3, 158, 35 }, 
+    { 3, 158, 36 }, { 3, 158, 37 }, { 3, 158, 38 }, { 2, 227, 39 }, { 2, 227, 40 }, 
+    { 2, 227, 41 }, { 3, 158, 42 }, { 3, 158, 48 }, { 3, 158, 49 }, { 3, 158, 51 }, 
+    { 3, 158, 52 }, { 3, 158, 53 }, { 3, 158, 54 }, { 3, 158, 55 }, { 3, 158, 56 }
+
+    // State 228
+    , { 3, 159, 22 }, { 3, 159, 32 }, { 3, 159, 33 }, { 3, 159, 34 }, { 3, 159, 35 }, 
+    { 3, 159, 36 }, { 3, 159, 37 }, { 3, 159, 38 }, { 2, 228, 39 }, { 2, 228, 40 }, 
+    { 2, 228, 41 }, { 3, 159, 42 }, { 3, 159, 48 }, { 3, 159, 49 }, { 3, 159, 51 }, 
+    { 3, 159, 52 }, { 3, 159, 53 }, { 3, 159, 54 }, { 3, 159, 55 }, { 3, 159, 56 }
+
+    // State 229
+    , { 3, 160, 22 }, { 3, 160, 32 }, { 3, 160, 33 }, { 3, 160, 34 }, { 3, 160, 35 }, 
+    { 3, 160, 36 }, { 3, 160, 37 }, { 3, 160, 38 }, { 2, 229, 39 }, { 2, 229, 40 }, 
+    { 2, 229, 41 }, { 3, 160, 42 }, { 3, 160, 48 }, { 3, 160, 49 }, { 3, 160, 51 }, 
+    { 3, 160, 52 }, { 3, 160, 53 }, { 3, 160, 54 }, { 3, 160, 55 }, { 3, 160, 56 }
+
+    // State 230
+    , { 3, 161, 22 }, { 3, 161, 32 }, { 3, 161, 33 }, { 3, 161, 34 }, { 3, 161, 35 }, 
+    { 3, 161, 36 }, { 3, 161, 37 }, { 3, 161, 38 }, { 2, 230, 39 }, { 2, 230, 40 }, 
+    { 2, 230, 41 }, { 3, 161, 42 }, { 3, 161, 48 }, { 3, 161, 49 }, { 3, 161, 51 }, 
+    { 3, 161, 52 }, { 3, 161, 53 }, { 3, 161, 54 }, { 3, 161, 55 }, { 3, 161, 56 }
+
+    // State 231
+    , { 3, 162, 22 }, { 3, 162, 32 }, { 3, 162, 33 }, { 3, 162, 34 }, { 3, 162, 35 }, 
+    { 3, 162, 36 }, { 3, 162, 37 }, { 3, 162, 38 }, { 2, 231, 39 }, { 2, 231, 40 }, 
+    { 2, 231, 41 }, { 3, 162, 42 }, { 3, 162, 48 }, { 3, 162, 49 }, { 3, 162, 51 }, 
+    { 3, 162, 52 }, { 3, 162, 53 }, { 3, 162, 54 }, { 3, 162, 55 }, { 3, 162, 56 }
+
+    // State 232
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, { 0, 116, 35 }, 
+    { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 232, 39 }, { 2, 232, 40 }, 
+    { 2, 232, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, { 0, 123, 51 }, 
+    { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, { 0, 128, 56 }
+
+    // State 233
+    , { 2, 233, 39 }, { 2, 233, 40 }, { 2, 233, 41 }, { 3, 163, 50 }, { 3, 163, 84 }
+
+    // State 234
+    , { 2, 234, 39 }, { 2, 234, 40 }, { 2, 234, 41 }, { 0, 319, 84 }
+
+    // State 235
+    , { 0, 112, 22 }, 
+    { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, 
+    { 0, 118, 37 }, { 0, 119, 38 }, { 2, 235, 39 }, { 2, 235, 40 }, { 2, 235, 41 }, 
+    { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, 
+    { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, { 0, 128, 56 }
+
+    // State 236
+    , { 2, 236, 39 }, 
+    { 2, 236, 40 }, { 2, 236, 41 }, { 0, 321, 84 }
+
+    // State 237
+    , { 2, 237, 39 }, { 2, 237, 40 }, 
+    { 2, 237, 41 }, { 0, 322, 72 }
+
+    // State 238
+    , { 0, 234, 1 }, { 0, 235, 2 }, { 0, 236, 5 }, 
+    { 0, 237, 6 }, { 0, 238, 7 }, { 0, 239, 13 }, { 0, 240, 14 }, { 0, 241, 15 }, 
+    { 0, 242, 19 }, { 0, 112, 22 }, { 0, 243, 25 }, { 0, 244, 31 }, { 0, 245, 32 }, 
+    { 0, 114, 33 }, { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, 
+    { 0, 119, 38 }, { 2, 238, 39 }, { 2, 238, 40 }, { 2, 238, 41 }, { 0, 120, 42 }, 
+    { 0, 121, 48 }, { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, 
+    { 0, 126, 54 }, { 0, 127, 55 }, { 0, 128, 56 }, { 3, 117, 84 }, { 0, 94, 85 }
+
+    // State 239
+    , { 2, 239, 39 }, { 2, 239, 40 }, { 2, 239, 41 }, { 0, 324, 42 }
+
+    // State 240
+    , { 0, 325, 32 }, 
+    { 2, 240, 39 }, { 2, 240, 40 }, { 2, 240, 41 }
+
+    // State 241
+    , { 2, 241, 39 }, { 2, 241, 40 }, 
+    { 2, 241, 41 }, { 0, 326, 42 }
+
+    // State 242
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, 
+    { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, 
+    { 2, 242, 39 }, { 2, 242, 40 }, { 2, 242, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, 
+    { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, 
+    { 0, 127, 55 }, { 0, 128, 56 }, { 0, 327, 84 }
+
+    // State 243
+    , { 2, 243, 39 }, { 2, 243, 40 }, 
+    { 2, 243, 41 }, { 0, 329, 42 }
+
+    // State 244
+    , { 2, 244, 39 }, { 2, 244, 40 }, { 2, 244, 41 }, 
+    { 0, 330, 42 }
+
+    // State 245
+    , { 2, 245, 39 }, { 2, 245, 40 }, { 2, 245, 41 }, { 3, 80, 42 }, 
+    { 3, 80, 44 }, { 3, 80, 46 }, { 3, 80, 47 }, { 3, 80, 48 }, { 3, 80, 49 }, 
+    { 3, 80, 50 }, { 3, 80, 51 }, { 3, 80, 52 }, { 3, 80, 53 }, { 3, 80, 54 }, 
+    { 3, 80, 57 }, { 3, 80, 58 }, { 3, 80, 59 }, { 3, 80, 60 }, { 3, 80, 61 }, 
+    { 3, 80, 62 }, { 3, 80, 63 }, { 3, 80, 64 }, { 3, 80, 65 }, { 3, 80, 66 }, 
+    { 3, 80, 67 }, { 3, 80, 68 }, { 3, 80, 69 }, { 3, 80, 70 }, { 3, 80, 71 }, 
+    { 0, 331, 72 }, { 3, 80, 73 }, { 3, 80, 74 }, { 3, 80, 75 }, { 3, 80, 76 }, 
+    { 3, 80, 77 }, { 3, 80, 78 }, { 3, 80, 79 }, { 3, 80, 80 }, { 3, 80, 81 }, 
+    { 3, 80, 82 }, { 3, 80, 83 }, { 3, 80, 84 }
+
+    // State 246
+    , { 2, 246, 39 }, { 2, 246, 40 }, 
+    { 2, 246, 41 }, { 3, 164, 43 }, { 0, 295, 50 }, { 3, 164, 84 }
+
+    // State 247
+    , { 3, 165, 1 }, 
+    { 3, 165, 2 }, { 3, 165, 5 }, { 3, 165, 6 }, { 3, 165, 7 }, { 3, 165, 13 }, 
+    { 3, 165, 14 }, { 3, 165, 15 }, { 3, 165, 19 }, { 3, 165, 22 }, { 3, 165, 25 }, 
+    { 3, 165, 31 }, { 3, 165, 32 }, { 3, 165, 33 }, { 3, 165, 34 }, { 3, 165, 35 }, 
+    { 3, 165, 36 }, { 3, 165, 37 }, { 3, 165, 38 }, { 2, 247, 39 }, { 2, 247, 40 }, 
+    { 2, 247, 41 }, { 3, 165, 42 }, { 3, 165, 48 }, { 3, 165, 49 }, { 3, 165, 51 }, 
+    { 3, 165, 52 }, { 3, 165, 53 }, { 3, 165, 54 }, { 3, 165, 55 }, { 3, 165, 56 }, 
+    { 3, 165, 84 }, { 3, 165, 85 }, { 3, 165, 86 }
+
+    // State 248
+    , { 3, 166, 1 }, { 3, 166, 2 }, 
+    { 3, 166, 5 }, { 3, 166, 6 }, { 3, 166, 7 }, { 3, 166, 9 }, { 3, 166, 13 }, 
+    { 3, 166, 14 }, { 3, 166, 15 }, { 3, 166, 19 }, { 3, 166, 22 }, { 3, 166, 25 }, 
+    { 3, 166, 31 }, { 3, 166, 32 }, { 3, 166, 33 }, { 3, 166, 34 }, { 3, 166, 35 }, 
+    { 3, 166, 36 }, { 3, 166, 37 }, { 3, 166, 38 }, { 2, 248, 39 }, { 2, 248, 40 }, 
+    { 2, 248, 41 }, { 3, 166, 42 }, { 3, 166, 48 }, { 3, 166, 49 }, { 3, 166, 51 }, 
+    { 3, 166, 52 }, { 3, 166, 53 }, { 3, 166, 54 }, { 3, 166, 55 }, { 3, 166, 56 }, 
+    { 3, 166, 84 }, { 3, 166, 85 }, { 3, 166, 86 }
+
+    // State 249
+    , { 3, 167, 1 }, { 3, 167, 2 }, 
+    { 3, 167, 5 }, { 3, 167, 6 }, { 3, 167, 7 }, { 3, 167, 9 }, { 3, 167, 13 }, 
+    { 3, 167, 14 }, { 3, 167, 15 }, { 3, 167, 19 }, { 3, 167, 22 }, { 3, 167, 25 }, 
+    { 3, 167, 31 }, { 3, 167, 32 }, { 3, 167, 33 }, { 3, 167, 34 }, { 3, 167, 35 }, 
+    { 3, 167, 36 }, { 3, 167, 37 }, { 3, 167, 38 }, { 2, 249, 39 }, { 2, 249, 40 }, 
+    { 2, 249, 41 }, { 3, 167, 42 }, { 3, 167, 48 }, { 3, 167, 49 }, { 3, 167, 51 }, 
+    { 3, 167, 52 }, { 3, 167, 53 }, { 3, 167, 54 }, { 3, 167, 55 }, { 3, 167, 56 }, 
+    { 3, 167, 84 }, { 3, 167, 85 }, { 3, 167, 86 }
+
+    // State 250
+    , { 3, 168, 1 }, { 3, 168, 2 }, 
+    { 3, 168, 5 }, { 3, 168, 6 }, { 3, 168, 7 }, { 3, 168, 9 }, { 3, 168, 13 }, 
+    { 3, 168, 14 }, { 3, 168, 15 }, { 3, 168, 19 }, { 3, 168, 22 }, { 3, 168, 25 }, 
+    { 3, 168, 31 }, { 3, 168, 32 }, { 3, 168, 33 }, { 3, 168, 34 }, { 3, 168, 35 }, 
+    { 3, 168, 36 }, { 3, 168, 37 }, { 3, 168, 38 }, { 2, 250, 39 }, { 2, 250, 40 }, 
+    { 2, 250, 41 }, { 3, 168, 42 }, { 3, 168, 48 }, { 3, 168, 49 }, { 3, 168, 51 }, 
+    { 3, 168, 52 }, { 3, 168, 53 }, { 3, 168, 54 }, { 3, 168, 55 }, { 3, 168, 56 }, 
+    { 3, 168, 84 }, { 3, 168, 85 }, { 3, 168, 86 }
+
+    // State 251
+    , { 3, 169, 1 }, { 3, 169, 2 }, 
+    { 3, 169, 5 }, { 3, 169, 6 }, { 3, 169, 7 }, { 3, 169, 9 }, { 3, 169, 13 }, 
+    { 3, 169, 14 }, { 3, 169, 15 }, { 3, 169, 19 }, { 3, 169, 22 }, { 3, 169, 25 }, 
+    { 3, 169, 31 }, { 3, 169, 32 }, { 3, 169, 33 }, { 3, 169, 34 }, { 3, 169, 35 }, 
+    { 3, 169, 36 }, { 3, 169, 37 }, { 3, 169, 38 }, { 2, 251, 39 }, { 2, 251, 40 }, 
+    { 2, 251, 41 }, { 3, 169, 42 }, { 3, 169, 48 }, { 3, 169, 49 }, { 3, 169, 51 }, 
+    { 3, 169, 52 }, { 3, 169, 53 }, { 3, 169, 54 }, { 3, 169, 55 }, { 3, 169, 56 }, 
+    { 3, 169, 84 }, { 3, 169, 85 }, { 3, 169, 86 }
+
+    // State 252
+    , { 3, 170, 1 }, { 3, 170, 2 }, 
+    { 3, 170, 5 }, { 3, 170, 6 }, { 3, 170, 7 }, { 3, 170, 9 }, { 3, 170, 13 }, 
+    { 3, 170, 14 }, { 3, 170, 15 }, { 3, 170, 19 }, { 3, 170, 22 }, { 3, 170, 25 }, 
+    { 3, 170, 31 }, { 3, 170, 32 }, { 3, 170, 33 }, { 3, 170, 34 }, { 3, 170, 35 }, 
+    { 3, 170, 36 }, { 3, 170, 37 }, { 3, 170, 38 }, { 2, 252, 39 }, { 2, 252, 40 }, 
+    { 2, 252, 41 }, { 3, 170, 42 }, { 3, 170, 48 }, { 3, 170, 49 }, { 3, 170, 51 }, 
+    { 3, 170, 52 }, { 3, 170, 53 }, { 3, 170, 54 }, { 3, 170, 55 }, { 3, 170, 56 }, 
+    { 3, 170, 84 }, { 3, 170, 85 }, { 3, 170, 86 }
+
+    // State 253
+    , { 3, 171, 1 }, { 3, 171, 2 }, 
+    { 3, 171, 5 }, { 3, 171, 6 }, { 3, 171, 7 }, { 3, 171, 9 }, { 3, 171, 13 }, 
+    { 3, 171, 14 }, { 3, 171, 15 }, { 3, 171, 19 }, { 3, 171, 22 }, { 3, 171, 25 }, 
+    { 3, 171, 31 }, { 3, 171, 32 }, { 3, 171, 33 }, { 3, 171, 34 }, { 3, 171, 35 }, 
+    { 3, 171, 36 }, { 3, 171, 37 }, { 3, 171, 38 }, { 2, 253, 39 }, { 2, 253, 40 }, 
+    { 2, 253, 41 }, { 3, 171, 42 }, { 3, 171, 48 }, { 3, 171, 49 }, { 3, 171, 51 }, 
+    { 3, 171, 52 }, { 3, 171, 53 }, { 3, 171, 54 }, { 3, 171, 55 }, { 3, 171, 56 }, 
+    { 3, 171, 84 }, { 3, 171, 85 }, { 3, 171, 86 }
+
+    // State 254
+    , { 2, 254, 39 }, { 2, 254, 40 }, 
+    { 2, 254, 41 }, { 3, 172, 86 }
+
+    // State 255
+    , { 2, 255, 39 }, { 2, 255, 40 }, { 2, 255, 41 }, 
+    { 0, 332, 84 }
+
+    // State 256
+    , { 2, 256, 39 }, { 2, 256, 40 }, { 2, 256, 41 }, { 0, 333, 86 }
+
+    // State 257
+    , { 0, 234, 1 }, { 0, 235, 2 }, { 0, 236, 5 }, { 0, 237, 6 }, { 0, 238, 7 }, 
+    { 0, 239, 13 }, { 0, 240, 14 }, { 0, 241, 15 }, { 0, 242, 19 }, { 0, 112, 22 }, 
+    { 0, 243, 25 }, { 0, 244, 31 }, { 0, 245, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 257, 39 }, 
+    { 2, 257, 40 }, { 2, 257, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }, { 3, 117, 84 }, { 0, 94, 85 }, { 3, 173, 86 }
+
+    // State 258
+    , { 0, 112, 22 }, 
+    { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, 
+    { 0, 118, 37 }, { 0, 119, 38 }, { 2, 258, 39 }, { 2, 258, 40 }, { 2, 258, 41 }, 
+    { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, 
+    { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, { 0, 128, 56 }
+
+    // State 259
+    , { 2, 259, 39 }, 
+    { 2, 259, 40 }, { 2, 259, 41 }, { 3, 174, 50 }, { 0, 336, 72 }, { 3, 174, 84 }
+
+    // State 260
+    , { 2, 260, 39 }, { 2, 260, 40 }, { 2, 260, 41 }, { 0, 338, 84 }
+
+    // State 261
+    , { 2, 261, 39 }, 
+    { 2, 261, 40 }, { 2, 261, 41 }, { 3, 175, 50 }, { 3, 175, 84 }
+
+    // State 262
+    , { 2, 262, 39 }, 
+    { 2, 262, 40 }, { 2, 262, 41 }, { 0, 340, 84 }
+
+    // State 263
+    , { 3, 0, 32 }, { 2, 263, 39 }, 
+    { 2, 263, 40 }, { 2, 263, 41 }, { 3, 0, 42 }, { 0, 37, 52 }
+
+    // State 264
+    , { 0, 2, 0 }, 
+    { 0, 3, 3 }, { 0, 4, 4 }, { 0, 5, 8 }, { 0, 6, 10 }, { 0, 7, 11 }, 
+    { 0, 8, 12 }, { 0, 9, 16 }, { 0, 10, 17 }, { 0, 11, 18 }, { 0, 12, 20 }, 
+    { 0, 13, 21 }, { 0, 14, 23 }, { 0, 15, 24 }, { 0, 16, 26 }, { 0, 17, 27 }, 
+    { 0, 18, 28 }, { 0, 19, 29 }, { 0, 20, 30 }, { 0, 21, 32 }, { 2, 264, 39 }, 
+    { 2, 264, 40 }, { 2, 264, 41 }, { 0, 264, 42 }, { 3, 176, 43 }, { 0, 265, 44 }, 
+    { 0, 37, 52 }
+
+    // State 265
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 265, 39 }, 
+    { 2, 265, 40 }, { 2, 265, 41 }, { 0, 120, 42 }, { 3, 59, 45 }, { 0, 121, 48 }, 
+    { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, 
+    { 0, 127, 55 }, { 0, 128, 56 }
+
+    // State 266
+    , { 2, 266, 39 }, { 2, 266, 40 }, { 2, 266, 41 }, 
+    { 3, 177, 43 }, { 3, 177, 50 }
+
+    // State 267
+    , { 2, 267, 39 }, { 2, 267, 40 }, { 2, 267, 41 }, 
+    { 0, 264, 42 }, { 3, 178, 43 }, { 0, 265, 44 }, { 3, 178, 50 }
+
+    // State 268
+    , { 2, 268, 39 }, 
+    { 2, 268, 40 }, { 2, 268, 41 }, { 0, 349, 42 }, { 3, 179, 43 }, { 0, 350, 44 }, 
+    { 3, 179, 50 }
+
+    // State 269
+    , { 3, 0, 32 }, { 2, 269, 39 }, { 2, 269, 40 }, { 2, 269, 41 }, 
+    { 3, 0, 42 }, { 0, 37, 52 }
+
+    // State 270
+    , { 2, 270, 39 }, { 2, 270, 40 }, { 2, 270, 41 }, 
+    { 3, 180, 43 }, { 3, 180, 50 }
+
+    // State 271
+    , { 2, 271, 39 }, { 2, 271, 40 }, { 2, 271, 41 }, 
+    { 3, 181, 43 }, { 3, 181, 50 }
+
+    // State 272
+    , { 2, 272, 39 }, { 2, 272, 40 }, { 2, 272, 41 }
+
+    // State 273
+    , { 2, 273, 39 }, { 2, 273, 40 }, { 2, 273, 41 }, { 3, 183, 43 }, { 0, 352, 50 }
+
+    // State 274
+    , { 0, 354, 32 }, { 2, 274, 39 }, { 2, 274, 40 }, { 2, 274, 41 }
+
+    // State 275
+    , { 0, 3, 3 }, 
+    { 0, 4, 4 }, { 0, 5, 8 }, { 0, 6, 10 }, { 0, 8, 12 }, { 0, 9, 16 }, 
+    { 0, 10, 17 }, { 0, 12, 20 }, { 0, 13, 21 }, { 0, 15, 24 }, { 0, 17, 27 }, 
+    { 0, 18, 28 }, { 0, 19, 29 }, { 0, 20, 30 }, { 0, 21, 32 }, { 2, 275, 39 }, 
+    { 2, 275, 40 }, { 2, 275, 41 }
+
+    // State 276
+    , { 0, 3, 3 }, { 0, 4, 4 }, { 0, 5, 8 }, 
+    { 0, 6, 10 }, { 0, 8, 12 }, { 0, 9, 16 }, { 0, 10, 17 }, { 0, 12, 20 }, 
+    { 0, 13, 21 }, { 0, 15, 24 }, { 0, 17, 27 }, { 0, 18, 28 }, { 0, 19, 29 }, 
+    { 0, 20, 30 }, { 0, 21, 32 }, { 2, 276, 39 }, { 2, 276, 40 }, { 2, 276, 41 }
+
+    // State 277
+    , { 2, 277, 39 }, { 2, 277, 40 }, { 2, 277, 41 }
+
+    // State 278
+    , { 2, 278, 39 }, { 2, 278, 40 }, 
+    { 2, 278, 41 }
+
+    // State 279
+    , { 2, 279, 39 }, { 2, 279, 40 }, { 2, 279, 41 }
+
+    // State 280
+    , { 2, 280, 39 }, 
+    { 2, 280, 40 }, { 2, 280, 41 }
+
+    // State 281
+    , { 2, 281, 39 }, { 2, 281, 40 }, { 2, 281, 41 }
+
+    // State 282
+    , { 2, 282, 39 }, { 2, 282, 40 }, { 2, 282, 41 }
+
+    // State 283
+    , { 2, 283, 39 }, { 2, 283, 40 }, 
+    { 2, 283, 41 }
+
+    // State 284
+    , { 2, 284, 39 }, { 2, 284, 40 }, { 2, 284, 41 }
+
+    // State 285
+    , { 2, 285, 39 }, 
+    { 2, 285, 40 }, { 2, 285, 41 }
+
+    // State 286
+    , { 0, 277, 3 }, { 0, 4, 4 }, { 0, 278, 8 }, 
+    { 0, 6, 10 }, { 0, 279, 12 }, { 0, 280, 16 }, { 0, 281, 17 }, { 0, 282, 20 }, 
+    { 0, 283, 21 }, { 0, 15, 24 }, { 0, 17, 27 }, { 0, 284, 28 }, { 0, 285, 29 }, 
+    { 0, 20, 30 }, { 2, 286, 39 }, { 2, 286, 40 }, { 2, 286, 41 }, { 0, 264, 42 }, 
+    { 3, 193, 43 }, { 0, 265, 44 }, { 0, 37, 52 }
+
+    // State 287
+    , { 2, 287, 39 }, { 2, 287, 40 }, 
+    { 2, 287, 41 }
+
+    // State 288
+    , { 2, 288, 39 }, { 2, 288, 40 }, { 2, 288, 41 }
+
+    // State 289
+    , { 2, 289, 39 }, 
+    { 2, 289, 40 }, { 2, 289, 41 }
+
+    // State 290
+    , { 2, 290, 39 }, { 2, 290, 40 }, { 2, 290, 41 }
+
+    // State 291
+    , { 2, 291, 39 }, { 2, 291, 40 }, { 2, 291, 41 }
+
+    // State 292
+    , { 2, 292, 39 }, { 2, 292, 40 }, 
+    { 2, 292, 41 }, { 0, 264, 42 }, { 3, 193, 43 }, { 0, 265, 44 }, { 0, 37, 52 }
+
+    // State 293
+    , { 2, 293, 39 }, { 2, 293, 40 }, { 2, 293, 41 }
+
+    // State 294
+    , { 2, 294, 39 }, { 2, 294, 40 }, 
+    { 2, 294, 41 }, { 3, 200, 42 }, { 3, 200, 43 }, { 3, 200, 44 }, { 3, 200, 45 }, 
+    { 3, 200, 46 }, { 3, 200, 47 }, { 3, 200, 48 }, { 3, 200, 49 }, { 3, 200, 50 }, 
+    { 3, 200, 51 }, { 3, 200, 52 }, { 3, 200, 53 }, { 3, 200, 54 }, { 3, 200, 57 }, 
+    { 3, 200, 58 }, { 3, 200, 59 }, { 3, 200, 60 }, { 3, 200, 61 }, { 3, 200, 62 }, 
+    { 3, 200, 63 }, { 3, 200, 64 }, { 3, 200, 65 }, { 3, 200, 66 }, { 3, 200, 67 }, 
+    { 3, 200, 68 }, { 3, 200, 69 }, { 3, 200, 70 }, { 3, 200, 71 }, { 3, 200, 72 }, 
+    { 3, 200, 73 }, { 3, 200, 74 }, { 3, 200, 75 }, { 3, 200, 76 }, { 3, 200, 77 }, 
+    { 3, 200, 78 }, { 3, 200, 79 }, { 3, 200, 80 }, { 3, 200, 81 }, { 3, 200, 82 }, 
+    { 3, 200, 83 }, { 3, 200, 84 }, { 3, 200, 86 }
+
+    // State 295
+    , { 0, 112, 22 }, { 0, 113, 32 }, 
+    { 0, 114, 33 }, { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, 
+    { 0, 119, 38 }, { 2, 295, 39 }, { 2, 295, 40 }, { 2, 295, 41 }, { 0, 120, 42 }, 
+    { 0, 121, 48 }, { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, 
+    { 0, 126, 54 }, { 0, 127, 55 }, { 0, 128, 56 }
+
+    // State 296
+    , { 2, 296, 39 }, { 2, 296, 40 }, 
+    { 2, 296, 41 }, { 0, 364, 43 }
+
+    // State 297
+    , { 2, 297, 39 }, { 2, 297, 40 }, { 2, 297, 41 }, 
+    { 0, 264, 42 }, { 3, 193, 43 }, { 0, 265, 44 }, { 0, 37, 52 }
+
+    // State 298
+    , { 2, 298, 39 }, 
+    { 2, 298, 40 }, { 2, 298, 41 }, { 0, 366, 43 }
+
+    // State 299
+    , { 2, 299, 39 }, { 2, 299, 40 }, 
+    { 2, 299, 41 }, { 3, 201, 43 }
+
+    // State 300
+    , { 2, 300, 39 }, { 2, 300, 40 }, { 2, 300, 41 }, 
+    { 3, 202, 43 }, { 3, 202, 50 }
+
+    // State 301
+    , { 2, 301, 39 }, { 2, 301, 40 }, { 2, 301, 41 }, 
+    { 0, 368, 43 }
+
+    // State 302
+    , { 2, 302, 39 }, { 2, 302, 40 }, { 2, 302, 41 }, { 0, 369, 45 }, 
+    { 0, 295, 50 }
+
+    // State 303
+    , { 2, 303, 39 }, { 2, 303, 40 }, { 2, 303, 41 }, { 3, 203, 42 }, 
+    { 3, 203, 43 }, { 3, 203, 44 }, { 3, 203, 45 }, { 3, 203, 46 }, { 3, 203, 47 }, 
+    { 3, 203, 48 }, { 3, 203, 49 }, { 3, 203, 50 }, { 3, 203, 51 }, { 3, 203, 52 }, 
+    { 3, 203, 53 }, { 3, 203, 54 }, { 3, 203, 57 }, { 3, 203, 58 }, { 3, 203, 59 }, 
+    { 3, 203, 60 }, { 3, 203, 61 }, { 3, 203, 62 }, { 3, 203, 63 }, { 3, 203, 64 }, 
+    { 3, 203, 65 }, { 3, 203, 66 }, { 3, 203, 67 }, { 3, 203, 68 }, { 3, 203, 69 }, 
+    { 3, 203, 70 }, { 3, 203, 71 }, { 3, 203, 72 }, { 3, 203, 73 }, { 3, 203, 74 }, 
+    { 3, 203, 75 }, { 3, 203, 76 }, { 3, 203, 77 }, { 3, 203, 78 }, { 3, 203, 79 }, 
+    { 3, 203, 80 }, { 3, 203, 81 }, { 3, 203, 82 }, { 3, 203, 83 }, { 3, 203, 84 }, 
+    { 3, 203, 86 }
+
+    // State 304
+    , { 2, 304, 39 }, { 2, 304, 40 }, { 2, 304, 41 }, { 3, 204, 42 }, 
+    { 3, 204, 43 }, { 3, 204, 44 }, { 3, 204, 45 }, { 3, 204, 46 }, { 3, 204, 47 }, 
+    { 3, 204, 48 }, { 3, 204, 49 }, { 3, 204, 50 }, { 3, 204, 51 }, { 3, 204, 52 }, 
+    { 3, 204, 53 }, { 3, 204, 54 }, { 3, 204, 57 }, { 3, 204, 58 }, { 3, 204, 59 }, 
+    { 3, 204, 60 }, { 3, 204, 61 }, { 3, 204, 62 }, { 3, 204, 63 }, { 3, 204, 64 }, 
+    { 3, 204, 65 }, { 3, 204, 66 }, { 3, 204, 67 }, { 3, 204, 68 }, { 3, 204, 69 }, 
+    { 3, 204, 70 }, { 3, 204, 71 }, { 3, 204, 72 }, { 3, 204, 73 }, { 3, 204, 74 }, 
+    { 3, 204, 75 }, { 3, 204, 76 }, { 3, 204, 77 }, { 3, 204, 78 }, { 3, 204, 79 }, 
+    { 3, 204, 80 }, { 3, 204, 81 }, { 3, 204, 82 }, { 3, 204, 83 }, { 3, 204, 84 }, 
+    { 3, 204, 86 }
+
+    // State 305
+    , { 2, 305, 39 }, { 2, 305, 40 }, { 2, 305, 41 }, { 3, 205, 43 }, 
+    { 3, 205, 45 }, { 3, 205, 50 }, { 3, 205, 51 }, { 3, 205, 52 }, { 3, 205, 53 }, 
+    { 3, 205, 54 }, { 3, 205, 57 }, { 3, 205, 58 }, { 3, 205, 59 }, { 3, 205, 60 }, 
+    { 3, 205, 61 }, { 3, 205, 62 }, { 3, 205, 63 }, { 3, 205, 64 }, { 3, 205, 65 }, 
+    { 3, 205, 66 }, { 3, 205, 67 }, { 3, 205, 68 }, { 3, 205, 69 }, { 3, 205, 70 }, 
+    { 3, 205, 71 }, { 3, 205, 72 }, { 3, 205, 84 }, { 3, 205, 86 }
+
+    // State 306
+    , { 2, 306, 39 }, 
+    { 2, 306, 40 }, { 2, 306, 41 }, { 3, 206, 43 }, { 3, 206, 45 }, { 3, 206, 50 }, 
+    { 3, 206, 51 }, { 0, 192, 52 }, { 3, 206, 53 }, { 3, 206, 54 }, { 0, 193, 57 }, 
+    { 0, 194, 58 }, { 3, 206, 59 }, { 3, 206, 60 }, { 3, 206, 61 }, { 3, 206, 62 }, 
+    { 3, 206, 63 }, { 3, 206, 64 }, { 3, 206, 65 }, { 3, 206, 66 }, { 3, 206, 67 }, 
+    { 3, 206, 68 }, { 3, 206, 69 }, { 3, 206, 70 }, { 3, 206, 71 }, { 3, 206, 72 }, 
+    { 3, 206, 84 }, { 3, 206, 86 }
+
+    // State 307
+    , { 2, 307, 39 }, { 2, 307, 40 }, { 2, 307, 41 }, 
+    { 3, 207, 43 }, { 3, 207, 45 }, { 3, 207, 50 }, { 3, 207, 51 }, { 0, 196, 53 }, 
+    { 0, 197, 54 }, { 3, 207, 59 }, { 3, 207, 60 }, { 3, 207, 61 }, { 3, 207, 62 }, 
+    { 3, 207, 63 }, { 3, 207, 64 }, { 3, 207, 65 }, { 3, 207, 66 }, { 3, 207, 67 }, 
+    { 3, 207, 68 }, { 3, 207, 69 }, { 3, 207, 70 }, { 3, 207, 71 }, { 3, 207, 72 }, 
+    { 3, 207, 84 }, { 3, 207, 86 }
+
+    // State 308
+    , { 2, 308, 39 }, { 2, 308, 40 }, { 2, 308, 41 }, 
+    { 3, 208, 43 }, { 3, 208, 45 }, { 3, 208, 50 }, { 3, 208, 51 }, { 0, 199, 59 }, 
+    { 0, 200, 60 }, { 3, 208, 61 }, { 3, 208, 62 }, { 3, 208, 63 }, { 3, 208, 64 }, 
+    { 3, 208, 65 }, { 3, 208, 66 }, { 3, 208, 67 }, { 3, 208, 68 }, { 3, 208, 69 }, 
+    { 3, 208, 70 }, { 3, 208, 71 }, { 3, 208, 72 }, { 3, 208, 84 }, { 3, 208, 86 }
+
+    // State 309
+    , { 2, 309, 39 }, { 2, 309, 40 }, { 2, 309, 41 }, { 3, 209, 43 }, { 3, 209, 45 }, 
+    { 3, 209, 50 }, { 3, 209, 51 }, { 0, 202, 61 }, { 0, 203, 62 }, { 0, 204, 63 }, 
+    { 0, 205, 64 }, { 3, 209, 65 }, { 3, 209, 66 }, { 3, 209, 67 }, { 3, 209, 68 }, 
+    { 3, 209, 69 }, { 3, 209, 70 }, { 3, 209, 71 }, { 3, 209, 72 }, { 3, 209, 84 }, 
+    { 3, 209, 86 }
+
+    // State 310
+    , { 2, 310, 39 }, { 2, 310, 40 }, { 2, 310, 41 }, { 3, 210, 43 }, 
+    { 3, 210, 45 }, { 3, 210, 50 }, { 3, 210, 51 }, { 0, 207, 65 }, { 0, 208, 66 }, 
+    { 3, 210, 67 }, { 3, 210, 68 }, { 3, 210, 69 }, { 3, 210, 70 }, { 3, 210, 71 }, 
+    { 3, 210, 72 }, { 3, 210, 84 }, { 3, 210, 86 }
+
+    // State 311
+    , { 2, 311, 39 }, { 2, 311, 40 }, 
+    { 2, 311, 41 }, { 3, 211, 43 }, { 3, 211, 45 }, { 3, 211, 50 }, { 0, 210, 51 }, 
+    { 3, 211, 67 }, { 3, 211, 68 }, { 3, 211, 69 }, { 3, 211, 70 }, { 3, 211, 71 }, 
+    { 3, 211, 72 }, { 3, 211, 84 }, { 3, 211, 86 }
+
+    // State 312
+    , { 2, 312, 39 }, { 2, 312, 40 }, 
+    { 2, 312, 41 }, { 3, 212, 43 }, { 3, 212, 45 }, { 3, 212, 50 }, { 0, 211, 67 }, 
+    { 3, 212, 68 }, { 3, 212, 69 }, { 3, 212, 70 }, { 3, 212, 71 }, { 3, 212, 72 }, 
+    { 3, 212, 84 }, { 3, 212, 86 }
+
+    // State 313
+    , { 2, 313, 39 }, { 2, 313, 40 }, { 2, 313, 41 }, 
+    { 3, 213, 43 }, { 3, 213, 45 }, { 3, 213, 50 }, { 0, 212, 68 }, { 3, 213, 69 }, 
+    { 3, 213, 70 }, { 3, 213, 71 }, { 3, 213, 72 }, { 3, 213, 84 }, { 3, 213, 86 }
+
+    // State 314
+    , { 2, 314, 39 }, { 2, 314, 40 }, { 2, 314, 41 }, { 3, 214, 43 }, { 3, 214, 45 }, 
+    { 3, 214, 50 }, { 0, 213, 69 }, { 3, 214, 70 }, { 3, 214, 71 }, { 3, 214, 72 }, 
+    { 3, 214, 84 }, { 3, 214, 86 }
+
+    // State 315
+    , { 2, 315, 39 }, { 2, 315, 40 }, { 2, 315, 41 }, 
+    { 0, 295, 50 }, { 0, 370, 72 }
+
+    // State 316
+    , { 2, 316, 39 }, { 2, 316, 40 }, { 2, 316, 41 }, 
+    { 3, 215, 50 }, { 3, 215, 86 }
+
+    // State 317
+    , { 2, 317, 39 }, { 2, 317, 40 }, { 2, 317, 41 }, 
+    { 0, 371, 50 }, { 3, 216, 86 }
+
+    // State 318
+    , { 2, 318, 39 }, { 2, 318, 40 }, { 2, 318, 41 }, 
+    { 3, 217, 43 }, { 3, 217, 45 }, { 3, 217, 50 }, { 3, 217, 72 }, { 3, 217, 84 }, 
+    { 3, 217, 86 }
+
+    // State 319
+    , { 3, 218, 1 }, { 3, 218, 2 }, { 3, 218, 5 }, { 3, 218, 6 }, 
+    { 3, 218, 7 }, { 3, 218, 9 }, { 3, 218, 13 }, { 3, 218, 14 }, { 3, 218, 15 }, 
+    { 3, 218, 19 }, { 3, 218, 22 }, { 3, 218, 25 }, { 3, 218, 31 }, { 3, 218, 32 }, 
+    { 3, 218, 33 }, { 3, 218, 34 }, { 3, 218, 35 }, { 3, 218, 36 }, { 3, 218, 37 }, 
+    { 3, 218, 38 }, { 2, 319, 39 }, { 2, 319, 40 }, { 2, 319, 41 }, { 3, 218, 42 }, 
+    { 3, 218, 48 }, { 3, 218, 49 }, { 3, 218, 51 }, { 3, 218, 52 }, { 3, 218, 53 }, 
+    { 3, 218, 54 }, { 3, 218, 55 }, { 3, 218, 56 }, { 3, 218, 84 }, { 3, 218, 85 }, 
+    { 3, 218, 86 }
+
+    // State 320
+    , { 2, 320, 39 }, { 2, 320, 40 }, { 2, 320, 41 }, { 0, 373, 72 }
+
+    // State 321
+    , { 3, 219, 1 }, { 3, 219, 2 }, { 3, 219, 5 }, { 3, 219, 6 }, { 3, 219, 7 }, 
+    { 3, 219, 9 }, { 3, 219, 13 }, { 3, 219, 14 }, { 3, 219, 15 }, { 3, 219, 19 }, 
+    { 3, 219, 22 }, { 3, 219, 25 }, { 3, 219, 31 }, { 3, 219, 32 }, { 3, 219, 33 }, 
+    { 3, 219, 34 }, { 3, 219, 35 }, { 3, 219, 36 }, { 3, 219, 37 }, { 3, 219, 38 }, 
+    { 2, 321, 39 }, { 2, 321, 40 }, { 2, 321, 41 }, { 3, 219, 42 }, { 3, 219, 48 }, 
+    { 3, 219, 49 }, { 3, 219, 51 }, { 3, 219, 52 }, { 3, 219, 53 }, { 3, 219, 54 }, 
+    { 3, 219, 55 }, { 3, 219, 56 }, { 3, 219, 84 }, { 3, 219, 85 }, { 3, 219, 86 }
+
+    // State 322
+    , { 0, 234, 1 }, { 0, 235, 2 }, { 0, 236, 5 }, { 0, 237, 6 }, { 0, 238, 7 }, 
+    { 0, 239, 13 }, { 0, 240, 14 }, { 0, 241, 15 }, { 0, 242, 19 }, { 0, 112, 22 }, 
+    { 0, 243, 25 }, { 0, 244, 31 }, { 0, 245, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 322, 39 }, 
+    { 2, 322, 40 }, { 2, 322, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }, { 3, 117, 84 }, { 0, 94, 85 }
+
+    // State 323
+    , { 0, 375, 31 }, { 2, 323, 39 }, 
+    { 2, 323, 40 }, { 2, 323, 41 }
+
+    // State 324
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, 
+    { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, 
+    { 2, 324, 39 }, { 2, 324, 40 }, { 2, 324, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, 
+    { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, 
+    { 0, 127, 55 }, { 0, 128, 56 }, { 3, 117, 84 }
+
+    // State 325
+    , { 2, 325, 39 }, { 2, 325, 40 }, 
+    { 2, 325, 41 }, { 0, 377, 84 }
+
+    // State 326
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, 
+    { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, 
+    { 2, 326, 39 }, { 2, 326, 40 }, { 2, 326, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, 
+    { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, 
+    { 0, 127, 55 }, { 0, 128, 56 }
+
+    // State 327
+    , { 3, 220, 1 }, { 3, 220, 2 }, { 3, 220, 5 }, 
+    { 3, 220, 6 }, { 3, 220, 7 }, { 3, 220, 9 }, { 3, 220, 13 }, { 3, 220, 14 }, 
+    { 3, 220, 15 }, { 3, 220, 19 }, { 3, 220, 22 }, { 3, 220, 25 }, { 3, 220, 31 }, 
+    { 3, 220, 32 }, { 3, 220, 33 }, { 3, 220, 34 }, { 3, 220, 35 }, { 3, 220, 36 }, 
+    { 3, 220, 37 }, { 3, 220, 38 }, { 2, 327, 39 }, { 2, 327, 40 }, { 2, 327, 41 }, 
+    { 3, 220, 42 }, { 3, 220, 48 }, { 3, 220, 49 }, { 3, 220, 51 }, { 3, 220, 52 }, 
+    { 3, 220, 53 }, { 3, 220, 54 }, { 3, 220, 55 }, { 3, 220, 56 }, { 3, 220, 84 }, 
+    { 3, 220, 85 }, { 3, 220, 86 }
+
+    // State 328
+    , { 2, 328, 39 }, { 2, 328, 40 }, { 2, 328, 41 }, 
+    { 0, 295, 50 }, { 0, 379, 84 }
+
+    // State 329
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, 
+    { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, 
+    { 2, 329, 39 }, { 2, 329, 40 }, { 2, 329, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, 
+    { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, 
+    { 0, 127, 55 }, { 0, 128, 56 }
+
+    // State 330
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, 
+    { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, 
+    { 2, 330, 39 }, { 2, 330, 40 }, { 2, 330, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, 
+    { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, 
+    { 0, 127, 55 }, { 0, 128, 56 }
+
+    // State 331
+    , { 0, 234, 1 }, { 0, 235, 2 }, { 0, 236, 5 }, 
+    { 0, 237, 6 }, { 0, 238, 7 }, { 0, 239, 13 }, { 0, 240, 14 }, { 0, 241, 15 }, 
+    { 0, 242, 19 }, { 0, 112, 22 }, { 0, 243, 25 }, { 0, 244, 31 }, { 0, 245, 32 }, 
+    { 0, 114, 33 }, { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, 
+    { 0, 119, 38 }, { 2, 331, 39 }, { 2, 331, 40 }, { 2, 331, 41 }, { 0, 120, 42 }, 
+    { 0, 121, 48 }, { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, 
+    { 0, 126, 54 }, { 0, 127, 55 }, { 0, 128, 56 }, { 3, 117, 84 }, { 0, 94, 85 }
+
+    // State 332
+    , { 3, 221, 1 }, { 3, 221, 2 }, { 3, 221, 5 }, { 3, 221, 6 }, { 3, 221, 7 }, 
+    { 3, 221, 9 }, { 3, 221, 13 }, { 3, 221, 14 }, { 3, 221, 15 }, { 3, 221, 19 }, 
+    { 3, 221, 22 }, { 3, 221, 25 }, { 3, 221, 31 }, { 3, 221, 32 }, { 3, 221, 33 }, 
+    { 3, 221, 34 }, { 3, 221, 35 }, { 3, 221, 36 }, { 3, 221, 37 }, { 3, 221, 38 }, 
+    { 2, 332, 39 }, { 2, 332, 40 }, { 2, 332, 41 }, { 3, 221, 42 }, { 3, 221, 43 }, 
+    { 3, 221, 48 }, { 3, 221, 49 }, { 3, 221, 51 }, { 3, 221, 52 }, { 3, 221, 53 }, 
+    { 3, 221, 54 }, { 3, 221, 55 }, { 3, 221, 56 }, { 3, 221, 84 }, { 3, 221, 85 }, 
+    { 3, 221, 86 }
+
+    // State 333
+    , { 3, 222, 0 }, { 3, 222, 1 }, { 3, 222, 2 }, { 3, 222, 3 }, 
+    { 3, 222, 4 }, { 3, 222, 5 }, { 3, 222, 6 }, { 3, 222, 7 }, { 3, 222, 8 }, 
+    { 3, 222, 9 }, { 3, 222, 10 }, { 3, 222, 11 }, { 3, 222, 12 }, { 3, 222, 13 }, 
+    { 3, 222, 14 }, { 3, 222, 15 }, { 3, 222, 16 }, { 3, 222, 17 }, { 3, 222, 18 }, 
+    { 3, 222, 19 }, { 3, 222, 20 }, { 3, 222, 21 }, { 3, 222, 22 }, { 3, 222, 23 }, 
+    { 3, 222, 24 }, { 3, 222, 25 }, { 3, 222, 26 }, { 3, 222, 27 }, { 3, 222, 28 }, 
+    { 3, 222, 29 }, { 3, 222, 30 }, { 3, 222, 31 }, { 8, 1, 32 }, { 3, 222, 32 }, 
+    { 3, 222, 33 }, { 3, 222, 34 }, { 3, 222, 35 }, { 3, 222, 36 }, { 3, 222, 37 }, 
+    { 3, 222, 38 }, { 2, 333, 39 }, { 2, 333, 40 }, { 2, 333, 41 }, { 8, 1, 42 }, 
+    { 3, 222, 42 }, { 3, 222, 48 }, { 3, 222, 49 }, { 3, 222, 51 }, { 8, 1, 52 }, 
+    { 3, 222, 52 }, { 3, 222, 53 }, { 3, 222, 54 }, { 3, 222, 55 }, { 3, 222, 56 }, 
+    { 3, 222, 84 }, { 3, 222, 85 }, { 3, 222, 86 }
+
+    // State 334
+    , { 3, 223, 1 }, { 3, 223, 2 }, 
+    { 3, 223, 5 }, { 3, 223, 6 }, { 3, 223, 7 }, { 3, 223, 13 }, { 3, 223, 14 }, 
+    { 3, 223, 15 }, { 3, 223, 19 }, { 3, 223, 22 }, { 3, 223, 25 }, { 3, 223, 31 }, 
+    { 3, 223, 32 }, { 3, 223, 33 }, { 3, 223, 34 }, { 3, 223, 35 }, { 3, 223, 36 }, 
+    { 3, 223, 37 }, { 3, 223, 38 }, { 2, 334, 39 }, { 2, 334, 40 }, { 2, 334, 41 }, 
+    { 3, 223, 42 }, { 3, 223, 48 }, { 3, 223, 49 }, { 3, 223, 51 }, { 3, 223, 52 }, 
+    { 3, 223, 53 }, { 3, 223, 54 }, { 3, 223, 55 }, { 3, 223, 56 }, { 3, 223, 84 }, 
+    { 3, 223, 85 }, { 3, 223, 86 }
+
+    // State 335
+    , { 2, 335, 39 }, { 2, 335, 40 }, { 2, 335, 41 }, 
+    { 3, 224, 50 }, { 3, 224, 84 }
+
+    // State 336
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, 
+    { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, 
+    { 2, 336, 39 }, { 2, 336, 40 }, { 2, 336, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, 
+    { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, 
+    { 0, 127, 55 }, { 0, 128, 56 }
+
+    // State 337
+    , { 2, 337, 39 }, { 2, 337, 40 }, { 2, 337, 41 }, 
+    { 3, 225, 50 }, { 3, 225, 84 }
+
+    // State 338
+    , { 2, 338, 39 }, { 2, 338, 40 }, { 2, 338, 41 }
+
+    // State 339
+    , { 2, 339, 39 }, { 2, 339, 40 }, { 2, 339, 41 }, { 0, 384, 50 }, { 3, 227, 84 }
+
+    // State 340
+    , { 3, 228, 3 }, { 3, 228, 4 }, { 3, 228, 8 }, { 3, 228, 10 }, { 3, 228, 12 }, 
+    { 3, 228, 16 }, { 3, 228, 17 }, { 3, 228, 20 }, { 3, 228, 21 }, { 3, 228, 24 }, 
+    { 3, 228, 27 }, { 3, 228, 28 }, { 3, 228, 29 }, { 3, 228, 30 }, { 3, 228, 32 }, 
+    { 2, 340, 39 }, { 2, 340, 40 }, { 2, 340, 41 }, { 3, 228, 86 }
+
+    // State 341
+    , { 2, 341, 39 }, 
+    { 2, 341, 40 }, { 2, 341, 41 }, { 0, 385, 43 }, { 0, 386, 50 }
+
+    // State 342
+    , { 2, 342, 39 }, 
+    { 2, 342, 40 }, { 2, 342, 41 }, { 3, 229, 43 }
+
+    // State 343
+    , { 2, 343, 39 }, { 2, 343, 40 }, 
+    { 2, 343, 41 }, { 3, 230, 43 }
+
+    // State 344
+    , { 2, 344, 39 }, { 2, 344, 40 }, { 2, 344, 41 }, 
+    { 0, 388, 43 }
+
+    // State 345
+    , { 2, 345, 39 }, { 2, 345, 40 }, { 2, 345, 41 }, { 3, 231, 43 }
+
+    // State 346
+    , { 2, 346, 39 }, { 2, 346, 40 }, { 2, 346, 41 }, { 0, 389, 45 }
+
+    // State 347
+    , { 2, 347, 39 }, 
+    { 2, 347, 40 }, { 2, 347, 41 }, { 0, 349, 42 }, { 3, 232, 43 }, { 0, 350, 44 }, 
+    { 3, 232, 50 }
+
+    // State 348
+    , { 2, 348, 39 }, { 2, 348, 40 }, { 2, 348, 41 }, { 3, 233, 43 }, 
+    { 3, 233, 50 }
+
+    // State 349
+    , { 0, 2, 0 }, { 0, 3, 3 }, { 0, 4, 4 }, { 0, 5, 8 }, 
+    { 0, 6, 10 }, { 0, 7, 11 }, { 0, 8, 12 }, { 0, 9, 16 }, { 0, 10, 17 }, 
+    { 0, 11, 18 }, { 0, 12, 20 }, { 0, 13, 21 }, { 0, 14, 23 }, { 0, 15, 24 }, 
+    { 0, 16, 26 }, { 0, 17, 27 }, { 0, 18, 28 }, { 0, 19, 29 }, { 0, 20, 30 }, 
+    { 0, 21, 32 }, { 2, 349, 39 }, { 2, 349, 40 }, { 2, 349, 41 }, { 3, 234, 43 }
+
+    // State 350
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, { 0, 116, 35 }, 
+    { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 350, 39 }, { 2, 350, 40 }, 
+    { 2, 350, 41 }, { 0, 120, 42 }, { 3, 59, 45 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }
+
+    // State 351
+    , { 2, 351, 39 }, { 2, 351, 40 }, { 2, 351, 41 }, { 3, 235, 43 }, 
+    { 3, 235, 50 }
+
+    // State 352
+    , { 0, 2, 0 }, { 0, 3, 3 }, { 0, 4, 4 }, { 0, 5, 8 }, 
+    { 0, 6, 10 }, { 0, 7, 11 }, { 0, 8, 12 }, { 0, 9, 16 }, { 0, 10, 17 }, 
+    { 0, 11, 18 }, { 0, 12, 20 }, { 0, 13, 21 }, { 0, 14, 23 }, { 0, 15, 24 }, 
+    { 0, 16, 26 }, { 0, 17, 27 }, { 0, 18, 28 }, { 0, 19, 29 }, { 0, 20, 30 }, 
+    { 0, 21, 32 }, { 2, 352, 39 }, { 2, 352, 40 }, { 2, 352, 41 }, { 0, 393, 87 }
+
+    // State 353
+    , { 2, 353, 39 }, { 2, 353, 40 }, { 2, 353, 41 }, { 3, 236, 43 }
+
+    // State 354
+    , { 2, 354, 39 }, 
+    { 2, 354, 40 }, { 2, 354, 41 }, { 3, 237, 43 }, { 3, 237, 50 }
+
+    // State 355
+    , { 2, 355, 39 }, 
+    { 2, 355, 40 }, { 2, 355, 41 }
+
+    // State 356
+    , { 2, 356, 39 }, { 2, 356, 40 }, { 2, 356, 41 }, 
+    { 0, 395, 43 }
+
+    // State 357
+    , { 2, 357, 39 }, { 2, 357, 40 }, { 2, 357, 41 }
+
+    // State 358
+    , { 2, 358, 39 }, 
+    { 2, 358, 40 }, { 2, 358, 41 }
+
+    // State 359
+    , { 2, 359, 39 }, { 2, 359, 40 }, { 2, 359, 41 }, 
+    { 3, 241, 43 }
+
+    // State 360
+    , { 2, 360, 39 }, { 2, 360, 40 }, { 2, 360, 41 }, { 0, 396, 43 }
+
+    // State 361
+    , { 2, 361, 39 }, { 2, 361, 40 }, { 2, 361, 41 }
+
+    // State 362
+    , { 2, 362, 39 }, { 2, 362, 40 }, 
+    { 2, 362, 41 }, { 0, 397, 43 }
+
+    // State 363
+    , { 2, 363, 39 }, { 2, 363, 40 }, { 2, 363, 41 }, 
+    { 3, 243, 43 }, { 3, 243, 45 }, { 3, 243, 50 }, { 3, 243, 72 }, { 3, 243, 84 }
+
+    // State 364
+    , { 3, 244, 22 }, { 3, 244, 32 }, { 3, 244, 33 }, { 3, 244, 34 }, { 3, 244, 35 }, 
+    { 3, 244, 36 }, { 3, 244, 37 }, { 3, 244, 38 }, { 2, 364, 39 }, { 2, 364, 40 }, 
+    { 2, 364, 41 }, { 3, 244, 42 }, { 3, 244, 48 }, { 3, 244, 49 }, { 3, 244, 51 }, 
+    { 3, 244, 52 }, { 3, 244, 53 }, { 3, 244, 54 }, { 3, 244, 55 }, { 3, 244, 56 }
+
+    // State 365
+    , { 2, 365, 39 }, { 2, 365, 40 }, { 2, 365, 41 }, { 3, 245, 43 }
+
+    // State 366
+    , { 3, 246, 22 }, 
+    { 3, 246, 32 }, { 3, 246, 33 }, { 3, 246, 34 }, { 3, 246, 35 }, { 3, 246, 36 }, 
+    { 3, 246, 37 }, { 3, 246, 38 }, { 2, 366, 39 }, { 2, 366, 40 }, { 2, 366, 41 }, 
+    { 3, 246, 42 }, { 3, 246, 48 }, { 3, 246, 49 }, { 3, 246, 51 }, { 3, 246, 52 }, 
+    { 3, 246, 53 }, { 3, 246, 54 }, { 3, 246, 55 }, { 3, 246, 56 }
+
+    // State 367
+    , { 2, 367, 39 }, 
+    { 2, 367, 40 }, { 2, 367, 41 }, { 3, 247, 43 }, { 0, 398, 50 }
+
+    // State 368
+    , { 2, 368, 39 }, 
+    { 2, 368, 40 }, { 2, 368, 41 }, { 3, 248, 42 }, { 3, 248, 43 }, { 3, 248, 44 }, 
+    { 3, 248, 45 }, { 3, 248, 46 }, { 3, 248, 47 }, { 3, 248, 48 }, { 3, 248, 49 }, 
+    { 3, 248, 50 }, { 3, 248, 51 }, { 3, 248, 52 }, { 3, 248, 53 }, { 3, 248, 54 }, 
+    { 3, 248, 57 }, { 3, 248, 58 }, { 3, 248, 59 }, { 3, 248, 60 }, { 3, 248, 61 }, 
+    { 3, 248, 62 }, { 3, 248, 63 }, { 3, 248, 64 }, { 3, 248, 65 }, { 3, 248, 66 }, 
+    { 3, 248, 67 }, { 3, 248, 68 }, { 3, 248, 69 }, { 3, 248, 70 }, { 3, 248, 71 }, 
+    { 3, 248, 72 }, { 3, 248, 73 }, { 3, 248, 74 }, { 3, 248, 75 }, { 3, 248, 76 }, 
+    { 3, 248, 77 }, { 3, 248, 78 }, { 3, 248, 79 }, { 3, 248, 80 }, { 3, 248, 81 }, 
+    { 3, 248, 82 }, { 3, 248, 83 }, { 3, 248, 84 }, { 3, 248, 86 }
+
+    // State 369
+    , { 2, 369, 39 }, 
+    { 2, 369, 40 }, { 2, 369, 41 }, { 3, 249, 42 }, { 3, 249, 43 }, { 3, 249, 44 }, 
+    { 3, 249, 45 }, { 3, 249, 46 }, { 3, 249, 47 }, { 3, 249, 48 }, { 3, 249, 49 }, 
+    { 3, 249, 50 }, { 3, 249, 51 }, { 3, 249, 52 }, { 3, 249, 53 }, { 3, 249, 54 }, 
+    { 3, 249, 57 }, { 3, 249, 58 }, { 3, 249, 59 }, { 3, 249, 60 }, { 3, 249, 61 }, 
+    { 3, 249, 62 }, { 3, 249, 63 }, { 3, 249, 64 }, { 3, 249, 65 }, { 3, 249, 66 }, 
+    { 3, 249, 67 }, { 3, 249, 68 }, { 3, 249, 69 }, { 3, 249, 70 }, { 3, 249, 71 }, 
+    { 3, 249, 72 }, { 3, 249, 73 }, { 3, 249, 74 }, { 3, 249, 75 }, { 3, 249, 76 }, 
+    { 3, 249, 77 }, { 3, 249, 78 }, { 3, 249, 79 }, { 3, 249, 80 }, { 3, 249, 81 }, 
+    { 3, 249, 82 }, { 3, 249, 83 }, { 3, 249, 84 }, { 3, 249, 86 }
+
+    // State 370
+    , { 0, 112, 22 }, 
+    { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, 
+    { 0, 118, 37 }, { 0, 119, 38 }, { 2, 370, 39 }, { 2, 370, 40 }, { 2, 370, 41 }, 
+    { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, 
+    { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, { 0, 128, 56 }
+
+    // State 371
+    , { 0, 112, 22 }, 
+    { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, 
+    { 0, 118, 37 }, { 0, 119, 38 }, { 2, 371, 39 }, { 2, 371, 40 }, { 2, 371, 41 }, 
+    { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, 
+    { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, { 0, 128, 56 }, { 0, 154, 85 }, 
+    { 3, 250, 86 }
+
+    // State 372
+    , { 2, 372, 39 }, { 2, 372, 40 }, { 2, 372, 41 }, { 0, 401, 86 }
+
+    // State 373
+    , { 0, 234, 1 }, { 0, 235, 2 }, { 0, 236, 5 }, { 0, 237, 6 }, { 0, 238, 7 }, 
+    { 0, 239, 13 }, { 0, 240, 14 }, { 0, 241, 15 }, { 0, 242, 19 }, { 0, 112, 22 }, 
+    { 0, 243, 25 }, { 0, 244, 31 }, { 0, 245, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 373, 39 }, 
+    { 2, 373, 40 }, { 2, 373, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }, { 3, 117, 84 }, { 0, 94, 85 }
+
+    // State 374
+    , { 3, 251, 1 }, { 3, 251, 2 }, 
+    { 3, 251, 5 }, { 3, 251, 6 }, { 3, 251, 7 }, { 3, 251, 9 }, { 3, 251, 13 }, 
+    { 3, 251, 14 }, { 3, 251, 15 }, { 3, 251, 19 }, { 3, 251, 22 }, { 3, 251, 25 }, 
+    { 3, 251, 31 }, { 3, 251, 32 }, { 3, 251, 33 }, { 3, 251, 34 }, { 3, 251, 35 }, 
+    { 3, 251, 36 }, { 3, 251, 37 }, { 3, 251, 38 }, { 2, 374, 39 }, { 2, 374, 40 }, 
+    { 2, 374, 41 }, { 3, 251, 42 }, { 3, 251, 48 }, { 3, 251, 49 }, { 3, 251, 51 }, 
+    { 3, 251, 52 }, { 3, 251, 53 }, { 3, 251, 54 }, { 3, 251, 55 }, { 3, 251, 56 }, 
+    { 3, 251, 84 }, { 3, 251, 85 }, { 3, 251, 86 }
+
+    // State 375
+    , { 2, 375, 39 }, { 2, 375, 40 }, 
+    { 2, 375, 41 }, { 0, 403, 42 }
+
+    // State 376
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, 
+    { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, 
+    { 2, 376, 39 }, { 2, 376, 40 }, { 2, 376, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, 
+    { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, 
+    { 0, 127, 55 }, { 0, 128, 56 }, { 3, 117, 84 }
+
+    // State 377
+    , { 3, 252, 1 }, { 3, 252, 2 }, 
+    { 3, 252, 5 }, { 3, 252, 6 }, { 3, 252, 7 }, { 3, 252, 9 }, { 3, 252, 13 }, 
+    { 3, 252, 14 }, { 3, 252, 15 }, { 3, 252, 19 }, { 3, 252, 22 }, { 3, 252, 25 }, 
+    { 3, 252, 31 }, { 3, 252, 32 }, { 3, 252, 33 }, { 3, 252, 34 }, { 3, 252, 35 }, 
+    { 3, 252, 36 }, { 3, 252, 37 }, { 3, 252, 38 }, { 2, 377, 39 }, { 2, 377, 40 }, 
+    { 2, 377, 41 }, { 3, 252, 42 }, { 3, 252, 48 }, { 3, 252, 49 }, { 3, 252, 51 }, 
+    { 3, 252, 52 }, { 3, 252, 53 }, { 3, 252, 54 }, { 3, 252, 55 }, { 3, 252, 56 }, 
+    { 3, 252, 84 }, { 3, 252, 85 }, { 3, 252, 86 }
+
+    // State 378
+    , { 2, 378, 39 }, { 2, 378, 40 }, 
+    { 2, 378, 41 }, { 0, 405, 43 }, { 0, 295, 50 }
+
+    // State 379
+    , { 3, 253, 1 }, { 3, 253, 2 }, 
+    { 3, 253, 5 }, { 3, 253, 6 }, { 3, 253, 7 }, { 3, 253, 9 }, { 3, 253, 13 }, 
+    { 3, 253, 14 }, { 3, 253, 15 }, { 3, 253, 19 }, { 3, 253, 22 }, { 3, 253, 25 }, 
+    { 3, 253, 31 }, { 3, 253, 32 }, { 3, 253, 33 }, { 3, 253, 34 }, { 3, 253, 35 }, 
+    { 3, 253, 36 }, { 3, 253, 37 }, { 3, 253, 38 }, { 2, 379, 39 }, { 2, 379, 40 }, 
+    { 2, 379, 41 }, { 3, 253, 42 }, { 3, 253, 48 }, { 3, 253, 49 }, { 3, 253, 51 }, 
+    { 3, 253, 52 }, { 3, 253, 53 }, { 3, 253, 54 }, { 3, 253, 55 }, { 3, 253, 56 }, 
+    { 3, 253, 84 }, { 3, 253, 85 }, { 3, 253, 86 }
+
+    // State 380
+    , { 2, 380, 39 }, { 2, 380, 40 }, 
+    { 2, 380, 41 }, { 0, 406, 43 }, { 0, 295, 50 }
+
+    // State 381
+    , { 2, 381, 39 }, { 2, 381, 40 }, 
+    { 2, 381, 41 }, { 0, 407, 43 }, { 0, 295, 50 }
+
+    // State 382
+    , { 3, 254, 1 }, { 3, 254, 2 }, 
+    { 3, 254, 5 }, { 3, 254, 6 }, { 3, 254, 7 }, { 3, 254, 9 }, { 3, 254, 13 }, 
+    { 3, 254, 14 }, { 3, 254, 15 }, { 3, 254, 19 }, { 3, 254, 22 }, { 3, 254, 25 }, 
+    { 3, 254, 31 }, { 3, 254, 32 }, { 3, 254, 33 }, { 3, 254, 34 }, { 3, 254, 35 }, 
+    { 3, 254, 36 }, { 3, 254, 37 }, { 3, 254, 38 }, { 2, 382, 39 }, { 2, 382, 40 }, 
+    { 2, 382, 41 }, { 3, 254, 42 }, { 3, 254, 48 }, { 3, 254, 49 }, { 3, 254, 51 }, 
+    { 3, 254, 52 }, { 3, 254, 53 }, { 3, 254, 54 }, { 3, 254, 55 }, { 3, 254, 56 }, 
+    { 3, 254, 84 }, { 3, 254, 85 }, { 3, 254, 86 }
+
+    // State 383
+    , { 2, 383, 39 }, { 2, 383, 40 }, 
+    { 2, 383, 41 }, { 3, 255, 50 }, { 3, 255, 84 }
+
+    // State 384
+    , { 3, 0, 32 }, { 2, 384, 39 }, 
+    { 2, 384, 40 }, { 2, 384, 41 }, { 3, 0, 42 }, { 0, 37, 52 }, { 0, 258, 72 }
+
+    // State 385
+    , { 2, 385, 39 }, { 2, 385, 40 }, { 2, 385, 41 }
+
+    // State 386
+    , { 2, 386, 39 }, { 2, 386, 40 }, 
+    { 2, 386, 41 }
+
+    // State 387
+    , { 2, 387, 39 }, { 2, 387, 40 }, { 2, 387, 41 }
+
+    // State 388
+    , { 2, 388, 39 }, 
+    { 2, 388, 40 }, { 2, 388, 41 }, { 3, 259, 42 }, { 3, 259, 43 }, { 3, 259, 44 }, 
+    { 3, 259, 50 }
+
+    // State 389
+    , { 2, 389, 39 }, { 2, 389, 40 }, { 2, 389, 41 }, { 3, 260, 42 }, 
+    { 3, 260, 43 }, { 3, 260, 44 }, { 3, 260, 50 }
+
+    // State 390
+    , { 2, 390, 39 }, { 2, 390, 40 }, 
+    { 2, 390, 41 }, { 3, 261, 43 }
+
+    // State 391
+    , { 2, 391, 39 }, { 2, 391, 40 }, { 2, 391, 41 }, 
+    { 0, 409, 43 }
+
+    // State 392
+    , { 2, 392, 39 }, { 2, 392, 40 }, { 2, 392, 41 }, { 0, 410, 45 }
+
+    // State 393
+    , { 2, 393, 39 }, { 2, 393, 40 }, { 2, 393, 41 }, { 3, 262, 43 }
+
+    // State 394
+    , { 2, 394, 39 }, 
+    { 2, 394, 40 }, { 2, 394, 41 }, { 3, 263, 43 }, { 3, 263, 50 }
+
+    // State 395
+    , { 2, 395, 39 }, 
+    { 2, 395, 40 }, { 2, 395, 41 }, { 3, 264, 43 }, { 3, 264, 45 }, { 3, 264, 50 }, 
+    { 3, 264, 51 }, { 3, 264, 52 }, { 3, 264, 53 }, { 3, 264, 54 }, { 3, 264, 57 }, 
+    { 3, 264, 58 }, { 3, 264, 59 }, { 3, 264, 60 }, { 3, 264, 61 }, { 3, 264, 62 }, 
+    { 3, 264, 63 }, { 3, 264, 64 }, { 3, 264, 65 }, { 3, 264, 66 }, { 3, 264, 67 }, 
+    { 3, 264, 68 }, { 3, 264, 69 }, { 3, 264, 70 }, { 3, 264, 71 }, { 3, 264, 72 }, 
+    { 3, 264, 73 }, { 3, 264, 74 }, { 3, 264, 75 }, { 3, 264, 76 }, { 3, 264, 77 }, 
+    { 3, 264, 78 }, { 3, 264, 79 }, { 3, 264, 80 }, { 3, 264, 81 }, { 3, 264, 82 }, 
+    { 3, 264, 83 }, { 3, 264, 84 }, { 3, 264, 86 }
+
+    // State 396
+    , { 0, 411, 22 }, { 0, 412, 32 }, 
+    { 0, 114, 33 }, { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, 
+    { 0, 119, 38 }, { 2, 396, 39 }, { 2, 396, 40 }, { 2, 396, 41 }, { 0, 413, 48 }, 
+    { 0, 414, 49 }, { 0, 415, 51 }, { 0, 416, 55 }, { 0, 417, 56 }
+
+    // State 397
+    , { 2, 397, 39 }, 
+    { 2, 397, 40 }, { 2, 397, 41 }, { 0, 420, 42 }, { 0, 421, 52 }, { 0, 422, 53 }, 
+    { 0, 423, 54 }
+
+    // State 398
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 398, 39 }, 
+    { 2, 398, 40 }, { 2, 398, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }
+
+    // State 399
+    , { 2, 399, 39 }, { 2, 399, 40 }, { 2, 399, 41 }, { 3, 265, 43 }, 
+    { 3, 265, 45 }, { 3, 265, 50 }, { 3, 265, 72 }, { 3, 265, 84 }, { 3, 265, 86 }
+
+    // State 400
+    , { 2, 400, 39 }, { 2, 400, 40 }, { 2, 400, 41 }, { 3, 266, 50 }, { 3, 266, 86 }
+
+    // State 401
+    , { 2, 401, 39 }, { 2, 401, 40 }, { 2, 401, 41 }, { 3, 267, 50 }, { 3, 267, 84 }, 
+    { 3, 267, 86 }
+
+    // State 402
+    , { 3, 268, 1 }, { 3, 268, 2 }, { 3, 268, 5 }, { 3, 268, 6 }, 
+    { 3, 268, 7 }, { 3, 268, 9 }, { 3, 268, 13 }, { 3, 268, 14 }, { 3, 268, 15 }, 
+    { 3, 268, 19 }, { 3, 268, 22 }, { 3, 268, 25 }, { 3, 268, 31 }, { 3, 268, 32 }, 
+    { 3, 268, 33 }, { 3, 268, 34 }, { 3, 268, 35 }, { 3, 268, 36 }, { 3, 268, 37 }, 
+    { 3, 268, 38 }, { 2, 402, 39 }, { 2, 402, 40 }, { 2, 402, 41 }, { 3, 268, 42 }, 
+    { 3, 268, 48 }, { 3, 268, 49 }, { 3, 268, 51 }, { 3, 268, 52 }, { 3, 268, 53 }, 
+    { 3, 268, 54 }, { 3, 268, 55 }, { 3, 268, 56 }, { 3, 268, 84 }, { 3, 268, 85 }, 
+    { 3, 268, 86 }
+
+    // State 403
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 403, 39 }, 
+    { 2, 403, 40 }, { 2, 403, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }
+
+    // State 404
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 404, 39 }, 
+    { 2, 404, 40 }, { 2, 404, 41 }, { 0, 120, 42 }, { 3, 117, 43 }, { 0, 121, 48 }, 
+    { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, 
+    { 0, 127, 55 }, { 0, 128, 56 }
+
+    // State 405
+    , { 0, 234, 1 }, { 0, 235, 2 }, { 0, 236, 5 }, 
+    { 0, 237, 6 }, { 0, 238, 7 }, { 0, 239, 13 }, { 0, 240, 14 }, { 0, 241, 15 }, 
+    { 0, 242, 19 }, { 0, 112, 22 }, { 0, 243, 25 }, { 0, 244, 31 }, { 0, 245, 32 }, 
+    { 0, 114, 33 }, { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, 
+    { 0, 119, 38 }, { 2, 405, 39 }, { 2, 405, 40 }, { 2, 405, 41 }, { 0, 120, 42 }, 
+    { 0, 121, 48 }, { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, 
+    { 0, 126, 54 }, { 0, 127, 55 }, { 0, 128, 56 }, { 3, 117, 84 }, { 0, 94, 85 }
+
+    // State 406
+    , { 0, 234, 1 }, { 0, 235, 2 }, { 0, 236, 5 }, { 0, 237, 6 }, { 0, 238, 7 }, 
+    { 0, 239, 13 }, { 0, 240, 14 }, { 0, 241, 15 }, { 0, 242, 19 }, { 0, 112, 22 }, 
+    { 0, 243, 25 }, { 0, 244, 31 }, { 0, 245, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 406, 39 }, 
+    { 2, 406, 40 }, { 2, 406, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }, { 3, 117, 84 }, { 0, 94, 85 }
+
+    // State 407
+    , { 0, 234, 1 }, { 0, 235, 2 }, 
+    { 0, 236, 5 }, { 0, 237, 6 }, { 0, 238, 7 }, { 0, 239, 13 }, { 0, 240, 14 }, 
+    { 0, 241, 15 }, { 0, 242, 19 }, { 0, 112, 22 }, { 0, 243, 25 }, { 0, 244, 31 }, 
+    { 0, 245, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, 
+    { 0, 118, 37 }, { 0, 119, 38 }, { 2, 407, 39 }, { 2, 407, 40 }, { 2, 407, 41 }, 
+    { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, 
+    { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, { 0, 128, 56 }, { 3, 117, 84 }, 
+    { 0, 94, 85 }
+
+    // State 408
+    , { 2, 408, 39 }, { 2, 408, 40 }, { 2, 408, 41 }, { 3, 269, 50 }, 
+    { 3, 269, 84 }
+
+    // State 409
+    , { 2, 409, 39 }, { 2, 409, 40 }, { 2, 409, 41 }, { 3, 270, 42 }, 
+    { 3, 270, 43 }, { 3, 270, 44 }, { 3, 270, 50 }
+
+    // State 410
+    , { 2, 410, 39 }, { 2, 410, 40 }, 
+    { 2, 410, 41 }, { 3, 271, 42 }, { 3, 271, 43 }, { 3, 271, 44 }, { 3, 271, 50 }
+
+    // State 411
+    , { 2, 411, 39 }, { 2, 411, 40 }, { 2, 411, 41 }
+
+    // State 412
+    , { 2, 412, 39 }, { 2, 412, 40 }, 
+    { 2, 412, 41 }
+
+    // State 413
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 413, 39 }, 
+    { 2, 413, 40 }, { 2, 413, 41 }, { 0, 173, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }
+
+    // State 414
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 414, 39 }, 
+    { 2, 414, 40 }, { 2, 414, 41 }, { 0, 173, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }
+
+    // State 415
+    , { 2, 415, 39 }, { 2, 415, 40 }, { 2, 415, 41 }
+
+    // State 416
+    , { 2, 416, 39 }, 
+    { 2, 416, 40 }, { 2, 416, 41 }
+
+    // State 417
+    , { 2, 417, 39 }, { 2, 417, 40 }, { 2, 417, 41 }
+
+    // State 418
+    , { 2, 418, 39 }, { 2, 418, 40 }, { 2, 418, 41 }
+
+    // State 419
+    , { 2, 419, 39 }, { 2, 419, 40 }, 
+    { 2, 419, 41 }
+
+    // State 420
+    , { 0, 112, 22 }, { 0, 113, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, 
+    { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, { 2, 420, 39 }, 
+    { 2, 420, 40 }, { 2, 420, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, 
+    { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, 
+    { 0, 128, 56 }
+
+    // State 421
+    , { 2, 421, 39 }, { 2, 421, 40 }, { 2, 421, 41 }
+
+    // State 422
+    , { 2, 422, 39 }, 
+    { 2, 422, 40 }, { 2, 422, 41 }
+
+    // State 423
+    , { 2, 423, 39 }, { 2, 423, 40 }, { 2, 423, 41 }
+
+    // State 424
+    , { 2, 424, 39 }, { 2, 424, 40 }, { 2, 424, 41 }
+
+    // State 425
+    , { 2, 425, 39 }, { 2, 425, 40 }, 
+    { 2, 425, 41 }, { 3, 283, 43 }, { 3, 283, 50 }
+
+    // State 426
+    , { 2, 426, 39 }, { 2, 426, 40 }, 
+    { 2, 426, 41 }, { 0, 434, 43 }, { 0, 295, 50 }
+
+    // State 427
+    , { 2, 427, 39 }, { 2, 427, 40 }, 
+    { 2, 427, 41 }, { 0, 435, 43 }
+
+    // State 428
+    , { 3, 284, 1 }, { 3, 284, 2 }, { 3, 284, 5 }, 
+    { 3, 284, 6 }, { 3, 284, 7 }, { 0, 436, 9 }, { 3, 284, 13 }, { 3, 284, 14 }, 
+    { 3, 284, 15 }, { 3, 284, 19 }, { 3, 284, 22 }, { 3, 284, 25 }, { 3, 284, 31 }, 
+    { 3, 284, 32 }, { 3, 284, 33 }, { 3, 284, 34 }, { 3, 284, 35 }, { 3, 284, 36 }, 
+    { 3, 284, 37 }, { 3, 284, 38 }, { 2, 428, 39 }, { 2, 428, 40 }, { 2, 428, 41 }, 
+    { 3, 284, 42 }, { 3, 284, 48 }, { 3, 284, 49 }, { 3, 284, 51 }, { 3, 284, 52 }, 
+    { 3, 284, 53 }, { 3, 284, 54 }, { 3, 284, 55 }, { 3, 284, 56 }, { 3, 284, 84 }, 
+    { 3, 284, 85 }, { 3, 284, 86 }
+
+    // State 429
+    , { 3, 285, 1 }, { 3, 285, 2 }, { 3, 285, 5 }, 
+    { 3, 285, 6 }, { 3, 285, 7 }, { 3, 285, 9 }, { 3, 285, 13 }, { 3, 285, 14 }, 
+    { 3, 285, 15 }, { 3, 285, 19 }, { 3, 285, 22 }, { 3, 285, 25 }, { 3, 285, 31 }, 
+    { 3, 285, 32 }, { 3, 285, 33 }, { 3, 285, 34 }, { 3, 285, 35 }, { 3, 285, 36 }, 
+    { 3, 285, 37 }, { 3, 285, 38 }, { 2, 429, 39 }, { 2, 429, 40 }, { 2, 429, 41 }, 
+    { 3, 285, 42 }, { 3, 285, 48 }, { 3, 285, 49 }, { 3, 285, 51 }, { 3, 285, 52 }, 
+    { 3, 285, 53 }, { 3, 285, 54 }, { 3, 285, 55 }, { 3, 285, 56 }, { 3, 285, 84 }, 
+    { 3, 285, 85 }, { 3, 285, 86 }
+
+    // State 430
+    , { 3, 286, 1 }, { 3, 286, 2 }, { 3, 286, 5 }, 
+    { 3, 286, 6 }, { 3, 286, 7 }, { 3, 286, 9 }, { 3, 286, 13 }, { 3, 286, 14 }, 
+    { 3, 286, 15 }, { 3, 286, 19 }, { 3, 286, 22 }, { 3, 286, 25 }, { 3, 286, 31 }, 
+    { 3, 286, 32 }, { 3, 286, 33 }, { 3, 286, 34 }, { 3, 286, 35 }, { 3, 286, 36 }, 
+    { 3, 286, 37 }, { 3, 286, 38 }, { 2, 430, 39 }, { 2, 430, 40 }, { 2, 430, 41 }, 
+    { 3, 286, 42 }, { 3, 286, 48 }, { 3, 286, 49 }, { 3, 286, 51 }, { 3, 286, 52 }, 
+    { 3, 286, 53 }, { 3, 286, 54 }, { 3, 286, 55 }, { 3, 286, 56 }, { 3, 286, 84 }, 
+    { 3, 286, 85 }, { 3, 286, 86 }
+
+    // State 431
+    , { 2, 431, 39 }, { 2, 431, 40 }, { 2, 431, 41 }
+
+    // State 432
+    , { 2, 432, 39 }, { 2, 432, 40 }, { 2, 432, 41 }
+
+    // State 433
+    , { 2, 433, 39 }, { 2, 433, 40 }, 
+    { 2, 433, 41 }, { 0, 437, 43 }, { 0, 295, 50 }
+
+    // State 434
+    , { 3, 289, 1 }, { 3, 289, 2 }, 
+    { 3, 289, 5 }, { 3, 289, 6 }, { 3, 289, 7 }, { 3, 289, 9 }, { 3, 289, 13 }, 
+    { 3, 289, 14 }, { 3, 289, 15 }, { 3, 289, 19 }, { 3, 289, 22 }, { 3, 289, 25 }, 
+    { 3, 289, 31 }, { 3, 289, 32 }, { 3, 289, 33 }, { 3, 289, 34 }, { 3, 289, 35 }, 
+    { 3, 289, 36 }, { 3, 289, 37 }, { 3, 289, 38 }, { 2, 434, 39 }, { 2, 434, 40 }, 
+    { 2, 434, 41 }, { 3, 289, 42 }, { 3, 289, 48 }, { 3, 289, 49 }, { 3, 289, 51 }, 
+    { 3, 289, 52 }, { 3, 289, 53 }, { 3, 289, 54 }, { 3, 289, 55 }, { 3, 289, 56 }, 
+    { 3, 289, 84 }, { 3, 289, 85 }, { 3, 289, 86 }
+
+    // State 435
+    , { 0, 234, 1 }, { 0, 235, 2 }, 
+    { 0, 236, 5 }, { 0, 237, 6 }, { 0, 238, 7 }, { 0, 239, 13 }, { 0, 240, 14 }, 
+    { 0, 241, 15 }, { 0, 242, 19 }, { 0, 112, 22 }, { 0, 243, 25 }, { 0, 244, 31 }, 
+    { 0, 245, 32 }, { 0, 114, 33 }, { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, 
+    { 0, 118, 37 }, { 0, 119, 38 }, { 2, 435, 39 }, { 2, 435, 40 }, { 2, 435, 41 }, 
+    { 0, 120, 42 }, { 0, 121, 48 }, { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, 
+    { 0, 125, 53 }, { 0, 126, 54 }, { 0, 127, 55 }, { 0, 128, 56 }, { 3, 117, 84 }, 
+    { 0, 94, 85 }
+
+    // State 436
+    , { 0, 234, 1 }, { 0, 235, 2 }, { 0, 236, 5 }, { 0, 237, 6 }, 
+    { 0, 238, 7 }, { 0, 239, 13 }, { 0, 240, 14 }, { 0, 241, 15 }, { 0, 242, 19 }, 
+    { 0, 112, 22 }, { 0, 243, 25 }, { 0, 244, 31 }, { 0, 245, 32 }, { 0, 114, 33 }, 
+    { 0, 115, 34 }, { 0, 116, 35 }, { 0, 117, 36 }, { 0, 118, 37 }, { 0, 119, 38 }, 
+    { 2, 436, 39 }, { 2, 436, 40 }, { 2, 436, 41 }, { 0, 120, 42 }, { 0, 121, 48 }, 
+    { 0, 122, 49 }, { 0, 123, 51 }, { 0, 124, 52 }, { 0, 125, 53 }, { 0, 126, 54 }, 
+    { 0, 127, 55 }, { 0, 128, 56 }, { 3, 117, 84 }, { 0, 94, 85 }
+
+    // State 437
+    , { 2, 437, 39 }, 
+    { 2, 437, 40 }, { 2, 437, 41 }
+
+    // State 438
+    , { 3, 291, 1 }, { 3, 291, 2 }, { 3, 291, 5 }, 
+    { 3, 291, 6 }, { 3, 291, 7 }, { 3, 291, 9 }, { 3, 291, 13 }, { 3, 291, 14 }, 
+    { 3, 291, 15 }, { 3, 291, 19 }, { 3, 291, 22 }, { 3, 291, 25 }, { 3, 291, 31 }, 
+    { 3, 291, 32 }, { 3, 291, 33 }, { 3, 291, 34 }, { 3, 291, 35 }, { 3, 291, 36 }, 
+    { 3, 291, 37 }, { 3, 291, 38 }, { 2, 438, 39 }, { 2, 438, 40 }, { 2, 438, 41 }, 
+    { 3, 291, 42 }, { 3, 291, 48 }, { 3, 291, 49 }, { 3, 291, 51 }, { 3, 291, 52 }, 
+    { 3, 291, 53 }, { 3, 291, 54 }, { 3, 291, 55 }, { 3, 291, 56 }, { 3, 291, 84 }, 
+    { 3, 291, 85 }, { 3, 291, 86 }
+
+    // State 439
+    , { 3, 292, 1 }, { 3, 292, 2 }, { 3, 292, 5 }, 
+    { 3, 292, 6 }, { 3, 292, 7 }, { 3, 292, 9 }, { 3, 292, 13 }, { 3, 292, 14 }, 
+    { 3, 292, 15 }, { 3, 292, 19 }, { 3, 292, 22 }, { 3, 292, 25 }, { 3, 292, 31 }, 
+    { 3, 292, 32 }, { 3, 292, 33 }, { 3, 292, 34 }, { 3, 292, 35 }, { 3, 292, 36 }, 
+    { 3, 292, 37 }, { 3, 292, 38 }, { 2, 439, 39 }, { 2, 439, 40 }, { 2, 439, 41 }, 
+    { 3, 292, 42 }, { 3, 292, 48 }, { 3, 292, 49 }, { 3, 292, 51 }, { 3, 292, 52 }, 
+    { 3, 292, 53 }, { 3, 292, 54 }, { 3, 292, 55 }, { 3, 292, 56 }, { 3, 292, 84 }, 
+    { 3, 292, 85 }, { 3, 292, 86 }
+};
+static const lr::small_parser_tables::action* const s_TerminalActions[] = {
+    s_TerminalActions_data + 0, s_TerminalActions_data + 26, s_TerminalActions_data + 32, 
+    s_TerminalActions_data + 70, s_TerminalActions_data + 112, s_TerminalActions_data + 154, 
+    s_TerminalActions_data + 196, s_TerminalActions_data + 201, s_TerminalActions_data + 239, 
+    s_TerminalActions_data + 281, s_TerminalActions_data + 323, s_TerminalActions_data + 365, 
+    s_TerminalActions_data + 403, s_TerminalActions_data + 445, s_TerminalActions_data + 487, 
+    s_TerminalActions_data + 525, s_TerminalActions_data + 530, s_TerminalActions_data + 568, 
+    s_TerminalActions_data + 573, s_TerminalActions_data + 615, s_TerminalActions_data + 657, 
+    s_TerminalActions_data + 699, s_TerminalActions_data + 741, s_TerminalActions_data + 779, 
+    s_TerminalActions_data + 805, s_TerminalActions_data + 815, s_TerminalActions_data + 853, 
+    s_TerminalActions_data + 891, s_TerminalActions_data + 933, s_TerminalActions_data + 975, 
+    s_TerminalActions_data + 978, s_TerminalActions_data + 1004, s_TerminalActions_data + 1030, 
+    s_TerminalActions_data + 1036, s_TerminalActions_data + 1062, s_TerminalActions_data + 1100, 
+    s_TerminalActions_data + 1105, s_TerminalActions_data + 1143, s_TerminalActions_data + 1154, 
+    s_TerminalActions_data + 1178, s_TerminalActions_data + 1183, s_TerminalActions_data + 1188, 
+    s_TerminalActions_data + 1231, s_TerminalActions_data + 1235, s_TerminalActions_data + 1242, 
+    s_TerminalActions_data + 1249, s_TerminalActions_data + 1255, s_TerminalActions_data + 1279, 
+    s_TerminalActions_data + 1305, s_TerminalActions_data + 1343, s_TerminalActions_data + 1386, 
+    s_TerminalActions_data + 1405, s_TerminalActions_data + 1416, s_TerminalActions_data + 1439, 
+    s_TerminalActions_data + 1473, s_TerminalActions_data + 1496, s_TerminalActions_data + 1500, 
+    s_TerminalActions_data + 1554, s_TerminalActions_data + 1585, s_TerminalActions_data + 1591, 
+    s_TerminalActions_data + 1622, s_TerminalActions_data + 1626, s_TerminalActions_data + 1629, 
+    s_TerminalActions_data + 1634, s_TerminalActions_data + 1640, s_TerminalActions_data + 1643, 
+    s_TerminalActions_data + 1648, s_TerminalActions_data + 1652, s_TerminalActions_data + 1656, 
+    s_TerminalActions_data + 1680, s_TerminalActions_data + 1684, s_TerminalActions_data + 1703, 
+    s_TerminalActions_data + 1745, s_TerminalActions_data + 1764, s_TerminalActions_data + 1775, 
+    s_TerminalActions_data + 1783, s_TerminalActions_data + 1786, s_TerminalActions_data + 1793, 
+    s_TerminalActions_data + 1847, s_TerminalActions_data + 1850, s_TerminalActions_data + 1873, 
+    s_TerminalActions_data + 1877, s_TerminalActions_data + 1902, s_TerminalActions_data + 1923, 
+    s_TerminalActions_data + 1929, s_TerminalActions_data + 1933, s_TerminalActions_data + 1938, 
+    s_TerminalActions_data + 1941, s_TerminalActions_data + 1944, s_TerminalActions_data + 1947, 
+    s_TerminalActions_data + 1968, s_TerminalActions_data + 1973, s_TerminalActions_data + 1978, 
+    s_TerminalActions_data + 2054, s_TerminalActions_data + 2058, s_TerminalActions_data + 2112, 
+    s_TerminalActions_data + 2138, s_TerminalActions_data + 2157, s_TerminalActions_data + 2199, 
+    s_TerminalActions_data + 2225, s_TerminalActions_data + 2251, s_TerminalActions_data + 2270, 
+    s_TerminalActions_data + 2277, s_TerminalActions_data + 2303, s_TerminalActions_data + 2329, 
+    s_TerminalActions_data + 2383, s_TerminalActions_data + 2414, s_TerminalActions_data + 2437, 
+    s_TerminalActions_data + 2442, s_TerminalActions_data + 2473, s_TerminalActions_data + 2477, 
+    s_TerminalActions_data + 2500, s_TerminalActions_data + 2504, s_TerminalActions_data + 2525, 
+    s_TerminalActions_data + 2570, s_TerminalActions_data + 2615, s_TerminalActions_data + 2660, 
+    s_TerminalActions_data + 2705, s_TerminalActions_data + 2750, s_TerminalActions_data + 2795, 
+    s_TerminalActions_data + 2840, s_TerminalActions_data + 2876, s_TerminalActions_data + 2896, 
+    s_TerminalActions_data + 2916, s_TerminalActions_data + 2936, s_TerminalActions_data + 2956, 
+    s_TerminalActions_data + 2976, s_TerminalActions_data + 2996, s_TerminalActions_data + 3016, 
+    s_TerminalActions_data + 3036, s_TerminalActions_data + 3081, s_TerminalActions_data + 3126, 
+    s_TerminalActions_data + 3171, s_TerminalActions_data + 3210, s_TerminalActions_data + 3238, 
+    s_TerminalActions_data + 3258, s_TerminalActions_data + 3278, s_TerminalActions_data + 3306, 
+    s_TerminalActions_data + 3331, s_TerminalActions_data + 3354, s_TerminalActions_data + 3375, 
+    s_TerminalActions_data + 3392, s_TerminalActions_data + 3407, s_TerminalActions_data + 3421, 
+    s_TerminalActions_data + 3434, s_TerminalActions_data + 3446, s_TerminalActions_data + 3457, 
+    s_TerminalActions_data + 3465, s_TerminalActions_data + 3469, s_TerminalActions_data + 3473, 
+    s_TerminalActions_data + 3493, s_TerminalActions_data + 3513, s_TerminalActions_data + 3518, 
+    s_TerminalActions_data + 3560, s_TerminalActions_data + 3565, s_TerminalActions_data + 3586, 
+    s_TerminalActions_data + 3592, s_TerminalActions_data + 3631, s_TerminalActions_data + 3640, 
+    s_TerminalActions_data + 3645, s_TerminalActions_data + 3651, s_TerminalActions_data + 3677, 
+    s_TerminalActions_data + 3711, s_TerminalActions_data + 3753, s_TerminalActions_data + 3760, 
+    s_TerminalActions_data + 3767, s_TerminalActions_data + 3793, s_TerminalActions_data + 3804, 
+    s_TerminalActions_data + 3808, s_TerminalActions_data + 3813, s_TerminalActions_data + 3818, 
+    s_TerminalActions_data + 3822, s_TerminalActions_data + 3853, s_TerminalActions_data + 3857, 
+    s_TerminalActions_data + 3877, s_TerminalActions_data + 3916, s_TerminalActions_data + 3920, 
+    s_TerminalActions_data + 3938, s_TerminalActions_data + 3942, s_TerminalActions_data + 3947, 
+    s_TerminalActions_data + 3955, s_TerminalActions_data + 3973, s_TerminalActions_data + 3991, 
+    s_TerminalActions_data + 4030, s_TerminalActions_data + 4069, s_TerminalActions_data + 4090, 
+    s_TerminalActions_data + 4110, s_TerminalActions_data + 4114, s_TerminalActions_data + 4118, 
+    s_TerminalActions_data + 4163, s_TerminalActions_data + 4208, s_TerminalActions_data + 4247, 
+    s_TerminalActions_data + 4286, s_TerminalActions_data + 4306, s_TerminalActions_data + 4326, 
+    s_TerminalActions_data + 4346, s_TerminalActions_data + 4366, s_TerminalActions_data + 4386, 
+    s_TerminalActions_data + 4406, s_TerminalActions_data + 4426, s_TerminalActions_data + 4446, 
+    s_TerminalActions_data + 4466, s_TerminalActions_data + 4486, s_TerminalActions_data + 4506, 
+    s_TerminalActions_data + 4526, s_TerminalActions_data + 4546, s_TerminalActions_data + 4566, 
+    s_TerminalActions_data + 4586, s_TerminalActions_data + 4606, s_TerminalActions_data + 4626, 
+    s_TerminalActions_data + 4646, s_TerminalActions_data + 4666, s_TerminalActions_data + 4686, 
+    s_TerminalActions_data + 4706, s_TerminalActions_data + 4726, s_TerminalActions_data + 4746, 
+    s_TerminalActions_data + 4766, s_TerminalActions_data + 4797, s_TerminalActions_data + 4836, 
+    s_TerminalActions_data + 4841, s_TerminalActions_data + 4845, s_TerminalActions_data + 4850, 
+    s_TerminalActions_data + 4870, s_TerminalActions_data + 4890, s_TerminalActions_data + 4910, 
+    s_TerminalActions_data + 4930, s_TerminalActions_data + 4950, s_TerminalActions_data + 4970, 
+    s_TerminalActions_data + 4990, s_TerminalActions_data + 5010, s_TerminalActions_data + 5030, 
+    s_TerminalActions_data + 5050, s_TerminalActions_data + 5070, s_TerminalActions_data + 5090, 
+    s_TerminalActions_data + 5095, s_TerminalActions_data + 5099, s_TerminalActions_data + 5119, 
+    s_TerminalActions_data + 5123, s_TerminalActions_data + 5127, s_TerminalActions_data + 5160, 
+    s_TerminalActions_data + 5164, s_TerminalActions_data + 5168, s_TerminalActions_data + 5172, 
+    s_TerminalActions_data + 5193, s_TerminalActions_data + 5197, s_TerminalActions_data + 5201, 
+    s_TerminalActions_data + 5243, s_TerminalActions_data + 5249, s_TerminalActions_data + 5283, 
+    s_TerminalActions_data + 5318, s_TerminalActions_data + 5353, s_TerminalActions_data + 5388, 
+    s_TerminalActions_data + 5423, s_TerminalActions_data + 5458, s_TerminalActions_data + 5493, 
+    s_TerminalActions_data + 5497, s_TerminalActions_data + 5501, s_TerminalActions_data + 5505, 
+    s_TerminalActions_data + 5539, s_TerminalActions_data + 5559, s_TerminalActions_data + 5565, 
+    s_TerminalActions_data + 5569, s_TerminalActions_data + 5574, s_TerminalActions_data + 5578, 
+    s_TerminalActions_data + 5584, s_TerminalActions_data + 5611, s_TerminalActions_data + 5632, 
+    s_TerminalActions_data + 5637, s_TerminalActions_data + 5644, s_TerminalActions_data + 5651, 
+    s_TerminalActions_data + 5657, s_TerminalActions_data + 5662, s_TerminalActions_data + 5667, 
+    s_TerminalActions_data + 5670, s_TerminalActions_data + 5675, s_TerminalActions_data + 5679, 
+    s_TerminalActions_data + 5697, s_TerminalActions_data + 5715, s_TerminalActions_data + 5718, 
+    s_TerminalActions_data + 5721, s_TerminalActions_data + 5724, s_TerminalActions_data + 5727, 
+    s_TerminalActions_data + 5730, s_TerminalActions_data + 5733, s_TerminalActions_data + 5736, 
+    s_TerminalActions_data + 5739, s_TerminalActions_data + 5742, s_TerminalActions_data + 5763, 
+    s_TerminalActions_data + 5766, s_TerminalActions_data + 5769, s_TerminalActions_data + 5772, 
+    s_TerminalActions_data + 5775, s_TerminalActions_data + 5778, s_TerminalActions_data + 5785, 
+    s_TerminalActions_data + 5788, s_TerminalActions_data + 5833, s_TerminalActions_data + 5853, 
+    s_TerminalActions_data + 5857, s_TerminalActions_data + 5864, s_TerminalActions_data + 5868, 
+    s_TerminalActions_data + 5872, s_TerminalActions_data + 5877, s_TerminalActions_data + 5881, 
+    s_TerminalActions_data + 5886, s_TerminalActions_data + 5931, s_TerminalActions_data + 5976, 
+    s_TerminalActions_data + 6004, s_TerminalActions_data + 6032, s_TerminalActions_data + 6057, 
+    s_TerminalActions_data + 6080, s_TerminalActions_data + 6101, s_TerminalActions_data + 6118, 
+    s_TerminalActions_data + 6133, s_TerminalActions_data + 6147, s_TerminalActions_data + 6160, 
+    s_TerminalActions_data + 6172, s_TerminalActions_data + 6177, s_TerminalActions_data + 6182, 
+    s_TerminalActions_data + 6187, s_TerminalActions_data + 6196, s_TerminalActions_data + 6231, 
+    s_TerminalActions_data + 6235, s_TerminalActions_data + 6270, s_TerminalActions_data + 6303, 
+    s_TerminalActions_data + 6307, s_TerminalActions_data + 6328, s_TerminalActions_data + 6332, 
+    s_TerminalActions_data + 6352, s_TerminalActions_data + 6387, s_TerminalActions_data + 6392, 
+    s_TerminalActions_data + 6412, s_TerminalActions_data + 6432, s_TerminalActions_data + 6465, 
+    s_TerminalActions_data + 6501, s_TerminalActions_data + 6558, s_TerminalActions_data + 6592, 
+    s_TerminalActions_data + 6597, s_TerminalActions_data + 6617, s_TerminalActions_data + 6622, 
+    s_TerminalActions_data + 6625, s_TerminalActions_data + 6630, s_TerminalActions_data + 6649, 
+    s_TerminalActions_data + 6654, s_TerminalActions_data + 6658, s_TerminalActions_data + 6662, 
+    s_TerminalActions_data + 6666, s_TerminalActions_data + 6670, s_TerminalActions_data + 6674, 
+    s_TerminalActions_data + 6681, s_TerminalActions_data + 6686, s_TerminalActions_data + 6710, 
+    s_TerminalActions_data + 6731, s_TerminalActions_data + 6736, s_TerminalActions_data + 6760, 
+    s_TerminalActions_data + 6764, s_TerminalActions_data + 6769, s_TerminalActions_data + 6772, 
+    s_TerminalActions_data + 6776, s_TerminalActions_data + 6779, s_TerminalActions_data + 6782, 
+    s_TerminalActions_data + 6786, s_TerminalActions_data + 6790, s_TerminalActions_data + 6793, 
+    s_TerminalActions_data + 6797, s_TerminalActions_data + 6805, s_TerminalActions_data + 6825, 
+    s_TerminalActions_data + 6829, s_TerminalActions_data + 6849, s_TerminalActions_data + 6854, 
+    s_TerminalActions_data + 6899, s_TerminalActions_data + 6944, s_TerminalActions_data + 6964, 
+    s_TerminalActions_data + 6986, s_TerminalActions_data + 6990, s_TerminalActions_data + 7023, 
+    s_TerminalActions_data + 7058, s_TerminalActions_data + 7062, s_TerminalActions_data + 7083, 
+    s_TerminalActions_data + 7118, s_TerminalActions_data + 7123, s_TerminalActions_data + 7158, 
+    s_TerminalActions_data + 7163, s_TerminalActions_data + 7168, s_TerminalActions_data + 7203, 
+    s_TerminalActions_data + 7208, s_TerminalActions_data + 7215, s_TerminalActions_data + 7218, 
+    s_TerminalActions_data + 7221, s_TerminalActions_data + 7224, s_TerminalActions_data + 7231, 
+    s_TerminalActions_data + 7238, s_TerminalActions_data + 7242, s_TerminalActions_data + 7246, 
+    s_TerminalActions_data + 7250, s_TerminalActions_data + 7254, s_TerminalActions_data + 7259, 
+    s_TerminalActions_data + 7298, s_TerminalActions_data + 7314, s_TerminalActions_data + 7321, 
+    s_TerminalActions_data + 7341, s_TerminalActions_data + 7350, s_TerminalActions_data + 7355, 
+    s_TerminalActions_data + 7361, s_TerminalActions_data + 7396, s_TerminalActions_data + 7416, 
+    s_TerminalActions_data + 7437, s_TerminalActions_data + 7470, s_TerminalActions_data + 7503, 
+    s_TerminalActions_data + 7536, s_TerminalActions_data + 7541, s_TerminalActions_data + 7548, 
+    s_TerminalActions_data + 7555, s_TerminalActions_data + 7558, s_TerminalActions_data + 7561, 
+    s_TerminalActions_data + 7581, s_TerminalActions_data + 7601, s_TerminalActions_data + 7604, 
+    s_TerminalActions_data + 7607, s_TerminalActions_data + 7610, s_TerminalActions_data + 7613, 
+    s_TerminalActions_data + 7616, s_TerminalActions_data + 7636, s_TerminalActions_data + 7639, 
+    s_TerminalActions_data + 7642, s_TerminalActions_data + 7645, s_TerminalActions_data + 7648, 
+    s_TerminalActions_data + 7653, s_TerminalActions_data + 7658, s_TerminalActions_data + 7662, 
+    s_TerminalActions_data + 7697, s_TerminalActions_data + 7732, s_TerminalActions_data + 7767, 
+    s_TerminalActions_data + 7770, s_TerminalActions_data + 7773, s_TerminalActions_data + 7778, 
+    s_TerminalActions_data + 7813, s_TerminalActions_data + 7846, s_TerminalActions_data + 7879, 
+    s_TerminalActions_data + 7882, s_TerminalActions_data + 7917
+};
+
+static const lr::small_parser_tables::action s_NonterminalActions_data[] = {
+
+    // State 0
+    { 6, 22, 23 }, { 6, 23, 69 }, { 6, 24, 70 }, { 6, 25, 77 }, { 6, 26, 78 }, 
+    { 6, 36, 80 }, { 6, 34, 81 }, { 6, 27, 86 }, { 6, 28, 87 }, { 6, 35, 88 }, 
+    { 6, 29, 143 }, { 6, 30, 144 }, { 6, 33, 145 }, { 6, 31, 146 }, { 0, 32, 147 }
+
+    // State 1
+    , { 6, 38, 83 }, { 6, 39, 104 }, { 6, 40, 105 }
+
+    // State 2
+    , { 3, 1, 74 }, { 3, 1, 117 }, 
+    { 3, 1, 147 }
+
+    // State 3
+    , { 3, 2, 74 }, { 3, 2, 94 }, { 3, 2, 117 }, { 3, 2, 147 }, 
+    { 3, 2, 233 }
+
+    // State 4
+    , { 3, 3, 74 }, { 3, 3, 94 }, { 3, 3, 117 }, { 3, 3, 147 }, 
+    { 3, 3, 233 }
+
+    // State 5
+    , { 3, 4, 74 }, { 3, 4, 94 }, { 3, 4, 117 }, { 3, 4, 147 }, 
+    { 3, 4, 233 }
+
+    // State 6
+    , { 6, 42, 99 }
+
+    // State 7
+    , { 3, 6, 74 }, { 3, 6, 117 }, { 3, 6, 147 }
+
+    // State 8
+    , { 3, 7, 74 }, { 3, 7, 94 }, { 3, 7, 117 }, { 3, 7, 147 }, { 3, 7, 233 }
+
+    // State 9
+    , { 3, 8, 74 }, { 3, 8, 94 }, { 3, 8, 117 }, { 3, 8, 147 }, { 3, 8, 233 }
+
+    // State 10
+    , { 3, 9, 74 }, { 3, 9, 94 }, { 3, 9, 117 }, { 3, 9, 147 }, { 3, 9, 233 }
+
+    // State 11
+    , { 3, 10, 74 }, { 3, 10, 117 }, { 3, 10, 147 }
+
+    // State 12
+    , { 3, 11, 74 }, { 3, 11, 94 }, 
+    { 3, 11, 117 }, { 3, 11, 147 }, { 3, 11, 233 }
+
+    // State 13
+    , { 3, 12, 74 }, { 3, 12, 94 }, 
+    { 3, 12, 117 }, { 3, 12, 147 }, { 3, 12, 233 }
+
+    // State 14
+    , { 3, 13, 74 }, { 3, 13, 117 }, 
+    { 3, 13, 147 }
+
+    // State 15
+    
+
+    // State 16
+    , { 3, 15, 74 }, { 3, 15, 117 }, { 3, 15, 147 }
+
+    // State 17
+    
+
+    // State 18
+    , { 3, 17, 74 }, 
+    { 3, 17, 94 }, { 3, 17, 117 }, { 3, 17, 147 }, { 3, 17, 233 }
+
+    // State 19
+    , { 3, 18, 74 }, 
+    { 3, 18, 94 }, { 3, 18, 117 }, { 3, 18, 147 }, { 3, 18, 233 }
+
+    // State 20
+    , { 3, 19, 74 }, 
+    { 3, 19, 94 }, { 3, 19, 117 }, { 3, 19, 147 }, { 3, 19, 233 }
+
+    // State 21
+    , { 3, 20, 74 }, 
+    { 3, 20, 94 }, { 3, 20, 117 }, { 3, 20, 147 }, { 3, 20, 233 }
+
+    // State 22
+    , { 3, 21, 74 }, 
+    { 3, 21, 117 }, { 3, 21, 147 }
+
+    // State 23
+    , { 3, 22, 147 }, { 3, 22, 232 }
+
+    // State 24
+    , { 0, 44, 74 }, 
+    { 0, 45, 147 }
+
+    // State 25
+    , { 3, 23, 74 }, { 3, 23, 117 }, { 3, 23, 147 }
+
+    // State 26
+    , { 3, 24, 74 }, 
+    { 3, 24, 117 }, { 3, 24, 147 }
+
+    // State 27
+    , { 3, 25, 74 }, { 3, 25, 94 }, { 3, 25, 117 }, 
+    { 3, 25, 147 }, { 3, 25, 233 }
+
+    // State 28
+    , { 3, 26, 74 }, { 3, 26, 94 }, { 3, 26, 117 }, 
+    { 3, 26, 147 }, { 3, 26, 233 }
+
+    // State 29
+    , { 5, 27, 232 }
+
+    // State 30
+    , { 3, 28, 147 }, { 3, 28, 232 }
+
+    // State 31
+    , { 3, 29, 147 }, { 3, 29, 232 }
+
+    // State 32
+    , { 6, 46, 83 }, { 6, 39, 104 }, { 6, 40, 105 }
+
+    // State 33
+    , { 6, 22, 23 }, { 6, 23, 69 }, { 6, 24, 70 }, { 6, 25, 77 }, { 6, 26, 78 }, 
+    { 6, 36, 80 }, { 6, 34, 81 }, { 6, 27, 86 }, { 6, 28, 87 }, { 6, 35, 88 }, 
+    { 6, 47, 144 }, { 6, 31, 146 }, { 0, 32, 147 }, { 3, 30, 232 }
+
+    // State 34
+    , { 6, 22, 23 }, 
+    { 3, 31, 74 }, { 6, 25, 77 }, { 6, 26, 78 }, { 6, 48, 80 }, { 6, 27, 86 }, 
+    { 6, 28, 87 }, { 6, 35, 88 }, { 3, 31, 117 }, { 3, 31, 147 }
+
+    // State 35
+    
+
+    // State 36
+    , { 3, 32, 74 }, 
+    { 3, 32, 117 }, { 3, 32, 147 }
+
+    // State 37
+    , { 6, 51, 112 }, { 3, 33, 233 }
+
+    // State 38
+    , { 6, 53, 135 }, 
+    { 6, 55, 136 }, { 0, 54, 139 }, { 6, 56, 140 }
+
+    // State 39
+    
+
+    // State 40
+    , { 6, 59, 106 }
+
+    // State 41
+    , { 3, 36, 74 }, 
+    { 3, 36, 94 }, { 3, 36, 117 }, { 3, 36, 147 }, { 3, 36, 233 }
+
+    // State 42
+    
+
+    // State 43
+    , { 6, 62, 71 }, 
+    { 6, 64, 73 }, { 6, 63, 83 }, { 6, 39, 104 }, { 6, 40, 105 }
+
+    // State 44
+    , { 6, 65, 71 }, 
+    { 6, 66, 75 }, { 6, 67, 76 }, { 6, 63, 83 }, { 6, 39, 104 }, { 6, 40, 105 }
+
+    // State 45
+    , { 6, 68, 83 }, { 6, 39, 104 }, { 6, 40, 105 }
+
+    // State 46
+    , { 6, 53, 135 }, { 6, 69, 136 }, 
+    { 0, 54, 139 }, { 6, 56, 140 }
+
+    // State 47
+    , { 3, 39, 147 }, { 3, 39, 232 }
+
+    // State 48
+    , { 3, 40, 74 }, 
+    { 3, 40, 117 }, { 3, 40, 147 }
+
+    // State 49
+    , { 3, 41, 74 }, { 6, 71, 91 }, { 3, 41, 94 }, 
+    { 3, 41, 117 }, { 3, 41, 147 }, { 3, 41, 233 }
+
+    // State 50
+    , { 6, 72, 90 }
+
+    // State 51
+    , { 6, 73, 23 }, 
+    { 6, 74, 104 }, { 3, 43, 233 }
+
+    // State 52
+    , { 6, 22, 23 }, { 6, 75, 69 }, { 6, 76, 70 }, 
+    { 6, 25, 77 }, { 6, 26, 78 }, { 6, 36, 80 }, { 6, 34, 81 }, { 6, 27, 86 }, 
+    { 6, 28, 87 }, { 6, 35, 88 }
+
+    // State 53
+    
+
+    // State 54
+    , { 6, 22, 23 }, { 6, 77, 69 }, { 6, 76, 70 }, 
+    { 6, 25, 77 }, { 6, 26, 78 }, { 6, 36, 80 }, { 6, 34, 81 }, { 6, 27, 86 }, 
+    { 6, 28, 87 }, { 6, 35, 88 }
+
+    // State 55
+    
+
+    // State 56
+    , { 0, 79, 139 }
+
+    // State 57
+    , { 3, 46, 139 }
+
+    // State 58
+    , { 6, 80, 83 }, 
+    { 6, 39, 104 }, { 6, 40, 105 }
+
+    // State 59
+    , { 3, 47, 139 }
+
+    // State 60
+    , { 6, 84, 100 }, { 6, 85, 101 }
+
+    // State 61
+    , { 3, 48, 233 }
+
+    // State 62
+    , { 6, 88, 72 }
+
+    // State 63
+    , { 6, 90, 85 }
+
+    // State 64
+    , { 5, 50, 233 }
+
+    // State 65
+    , { 6, 91, 82 }
+
+    // State 66
+    
+
+    // State 67
+    
+
+    // State 68
+    , { 6, 53, 135 }, { 6, 93, 136 }, { 0, 54, 139 }, { 6, 56, 140 }
+
+    // State 69
+    , { 6, 95, 130 }
+
+    // State 70
+    , { 6, 96, 90 }
+
+    // State 71
+    , { 3, 53, 74 }, { 3, 53, 94 }, { 3, 53, 117 }, { 3, 53, 147 }, 
+    { 3, 53, 233 }
+
+    // State 72
+    , { 6, 98, 23 }, { 6, 99, 78 }, { 6, 103, 79 }, { 6, 27, 86 }, 
+    { 6, 28, 87 }, { 6, 35, 88 }, { 6, 100, 89 }, { 6, 101, 92 }, { 6, 102, 95 }
+
+    // State 73
+    , { 3, 54, 233 }
+
+    // State 74
+    , { 3, 55, 233 }
+
+    // State 75
+    , { 5, 56, 233 }
+
+    // State 76
+    , { 0, 44, 74 }
+
+    // State 77
+    , { 3, 57, 139 }
+
+    // State 78
+    , { 5, 58, 233 }
+
+    // State 79
+    , { 6, 22, 23 }, { 6, 104, 69 }, { 6, 76, 70 }, { 6, 25, 77 }, 
+    { 6, 26, 78 }, { 6, 36, 80 }, { 6, 34, 81 }, { 6, 27, 86 }, { 6, 28, 87 }, 
+    { 6, 35, 88 }
+
+    // State 80
+    
+
+    // State 81
+    , { 0, 110, 109 }, { 6, 109, 110 }, { 6, 111, 111 }
+
+    // State 82
+    , { 6, 129, 1 }, 
+    { 6, 130, 2 }, { 6, 131, 4 }, { 6, 132, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, 
+    { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, 
+    { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, { 6, 143, 54 }, 
+    { 6, 144, 55 }, { 6, 145, 56 }, { 6, 146, 57 }, { 6, 147, 68 }, { 6, 148, 107 }
+
+    // State 83
+    , { 6, 151, 103 }
+
+    // State 84
+    
+
+    // State 85
+    , { 6, 153, 102 }
+
+    // State 86
+    , { 3, 62, 233 }
+
+    // State 87
+    , { 3, 63, 233 }
+
+    // State 88
+    , { 3, 64, 233 }
+
+    // State 89
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 131, 4 }, { 6, 155, 7 }, { 6, 156, 9 }, 
+    { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, 
+    { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, 
+    { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, { 6, 145, 56 }, { 6, 157, 57 }, 
+    { 6, 158, 84 }
+
+    // State 90
+    
+
+    // State 91
+    
+
+    // State 92
+    , { 3, 67, 139 }, { 3, 67, 147 }, { 3, 67, 232 }, { 3, 67, 233 }
+
+    // State 93
+    , { 6, 160, 130 }
+
+    // State 94
+    , { 6, 53, 135 }, { 6, 161, 136 }, { 0, 54, 139 }, { 6, 56, 140 }
+
+    // State 95
+    , { 3, 68, 147 }, { 3, 68, 232 }
+
+    // State 96
+    , { 6, 98, 23 }, { 6, 99, 78 }, { 6, 103, 79 }, 
+    { 6, 27, 86 }, { 6, 28, 87 }, { 6, 35, 88 }, { 6, 100, 89 }, { 6, 101, 92 }, 
+    { 6, 102, 95 }
+
+    // State 97
+    , { 3, 69, 74 }, { 3, 69, 94 }, { 3, 69, 117 }, { 3, 69, 147 }, 
+    { 3, 69, 233 }
+
+    // State 98
+    , { 3, 70, 94 }, { 3, 70, 233 }
+
+    // State 99
+    , { 3, 71, 94 }, { 3, 71, 233 }
+
+    // State 100
+    
+
+    // State 101
+    , { 0, 164, 94 }
+
+    // State 102
+    , { 6, 98, 23 }, { 6, 99, 78 }, { 6, 165, 79 }, { 6, 27, 86 }, 
+    { 6, 28, 87 }, { 6, 35, 88 }, { 3, 73, 94 }, { 3, 73, 233 }
+
+    // State 103
+    , { 3, 74, 94 }, 
+    { 3, 74, 233 }
+
+    // State 104
+    , { 3, 75, 139 }
+
+    // State 105
+    , { 3, 76, 139 }
+
+    // State 106
+    , { 6, 22, 23 }, { 6, 166, 70 }, 
+    { 6, 25, 77 }, { 6, 26, 78 }, { 6, 36, 80 }, { 6, 34, 81 }, { 6, 27, 86 }, 
+    { 6, 28, 87 }, { 6, 35, 88 }, { 6, 167, 108 }, { 6, 168, 113 }
+
+    // State 107
+    , { 6, 169, 120 }
+
+    // State 108
+    , { 3, 78, 139 }
+
+    // State 109
+    
+
+    // State 110
+    , { 6, 22, 23 }, { 6, 166, 70 }, { 6, 25, 77 }, { 6, 26, 78 }, 
+    { 6, 36, 80 }, { 6, 34, 81 }, { 6, 27, 86 }, { 6, 28, 87 }, { 6, 35, 88 }, 
+    { 6, 170, 108 }, { 6, 168, 113 }
+
+    // State 111
+    
+
+    // State 112
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 131, 4 }, 
+    { 6, 174, 9 }, { 6, 149, 14 }, { 0, 175, 17 }
+
+    // State 113
+    , { 3, 80, 233 }
+
+    // State 114
+    , { 3, 81, 233 }
+
+    // State 115
+    , { 3, 82, 233 }
+
+    // State 116
+    , { 3, 83, 233 }
+
+    // State 117
+    , { 3, 84, 233 }
+
+    // State 118
+    , { 3, 85, 233 }
+
+    // State 119
+    , { 3, 86, 233 }
+
+    // State 120
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 178, 3 }, { 6, 131, 4 }, { 6, 179, 7 }, 
+    { 6, 156, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, 
+    { 0, 180, 21 }, { 0, 181, 35 }, { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, 
+    { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, { 6, 143, 54 }, 
+    { 6, 144, 55 }, { 6, 145, 56 }, { 6, 157, 57 }
+
+    // State 121
+    , { 6, 129, 1 }, { 6, 130, 2 }, 
+    { 6, 131, 4 }, { 6, 182, 9 }, { 6, 149, 14 }
+
+    // State 122
+    , { 6, 129, 1 }, { 6, 130, 2 }, 
+    { 6, 131, 4 }, { 6, 183, 9 }, { 6, 149, 14 }
+
+    // State 123
+    
+
+    // State 124
+    
+
+    // State 125
+    
+
+    // State 126
+    
+
+    // State 127
+    
+
+    // State 128
+    
+
+    // State 129
+    , { 3, 93, 233 }
+
+    // State 130
+    , { 3, 94, 233 }
+
+    // State 131
+    , { 3, 95, 233 }
+
+    // State 132
+    , { 3, 96, 233 }
+
+    // State 133
+    
+
+    // State 134
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 131, 4 }, 
+    { 6, 132, 9 }, { 6, 149, 14 }, { 6, 190, 15 }, { 6, 134, 18 }, { 6, 135, 19 }
+
+    // State 135
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 131, 4 }, { 6, 132, 9 }, { 6, 149, 14 }, 
+    { 6, 191, 15 }, { 6, 134, 18 }, { 6, 135, 19 }
+
+    // State 136
+    , { 6, 195, 41 }
+
+    // State 137
+    , { 6, 198, 43 }
+
+    // State 138
+    , { 6, 201, 45 }
+
+    // State 139
+    , { 6, 206, 49 }
+
+    // State 140
+    , { 6, 209, 51 }
+
+    // State 141
+    
+
+    // State 142
+    
+
+    // State 143
+    
+
+    // State 144
+    
+
+    // State 145
+    
+
+    // State 146
+    
+
+    // State 147
+    
+
+    // State 148
+    
+
+    // State 149
+    , { 6, 129, 1 }, { 6, 130, 2 }, 
+    { 6, 131, 4 }, { 6, 132, 9 }, { 6, 149, 14 }, { 6, 217, 15 }, { 6, 134, 18 }, 
+    { 6, 135, 19 }
+
+    // State 150
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 131, 4 }, { 6, 132, 9 }, 
+    { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, 
+    { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, 
+    { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, { 6, 145, 56 }, { 6, 146, 57 }, 
+    { 6, 218, 68 }
+
+    // State 151
+    
+
+    // State 152
+    , { 3, 111, 74 }, { 3, 111, 94 }, { 3, 111, 117 }, { 3, 111, 147 }, 
+    { 3, 111, 233 }
+
+    // State 153
+    
+
+    // State 154
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 131, 4 }, { 6, 155, 7 }, 
+    { 6, 156, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, 
+    { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, 
+    { 6, 141, 52 }, { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, { 6, 145, 56 }, 
+    { 6, 157, 57 }, { 6, 220, 84 }
+
+    // State 155
+    
+
+    // State 156
+    , { 6, 232, 67 }
+
+    // State 157
+    
+
+    // State 158
+    
+
+    // State 159
+    , { 6, 233, 71 }, { 6, 63, 83 }, 
+    { 6, 39, 104 }, { 6, 40, 105 }
+
+    // State 160
+    , { 3, 116, 147 }, { 3, 116, 232 }
+
+    // State 161
+    , { 6, 129, 1 }, 
+    { 6, 130, 2 }, { 6, 246, 3 }, { 6, 131, 4 }, { 6, 179, 7 }, { 6, 156, 9 }, 
+    { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, 
+    { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, 
+    { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, { 6, 145, 56 }, { 6, 157, 57 }, 
+    { 6, 247, 128 }, { 6, 248, 129 }, { 6, 249, 130 }, { 6, 250, 131 }, { 6, 251, 132 }, 
+    { 6, 252, 133 }, { 6, 253, 134 }, { 6, 254, 137 }, { 6, 256, 138 }, { 6, 257, 141 }, 
+    { 6, 255, 142 }
+
+    // State 162
+    , { 3, 119, 74 }, { 3, 119, 94 }, { 3, 119, 117 }, { 3, 119, 147 }, 
+    { 3, 119, 233 }
+
+    // State 163
+    , { 6, 259, 83 }, { 6, 260, 93 }, { 6, 261, 96 }, { 6, 39, 104 }, 
+    { 6, 40, 105 }
+
+    // State 164
+    , { 6, 259, 83 }, { 6, 262, 93 }, { 6, 261, 96 }, { 6, 39, 104 }, 
+    { 6, 40, 105 }
+
+    // State 165
+    , { 3, 120, 94 }, { 3, 120, 233 }
+
+    // State 166
+    , { 6, 266, 25 }, { 6, 267, 104 }, 
+    { 0, 269, 117 }, { 6, 271, 118 }, { 6, 270, 119 }, { 6, 268, 121 }
+
+    // State 167
+    
+
+    // State 168
+    , { 6, 273, 114 }
+
+    // State 169
+    
+
+    // State 170
+    
+
+    // State 171
+    , { 3, 125, 139 }
+
+    // State 172
+    
+
+    // State 173
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 178, 3 }, { 6, 131, 4 }, 
+    { 6, 179, 7 }, { 6, 156, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, 
+    { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, 
+    { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, 
+    { 6, 145, 56 }, { 6, 157, 57 }
+
+    // State 174
+    , { 3, 126, 233 }
+
+    // State 175
+    
+
+    // State 176
+    , { 6, 287, 20 }, { 6, 288, 22 }, 
+    { 6, 289, 23 }, { 6, 290, 86 }, { 6, 291, 87 }, { 6, 35, 88 }
+
+    // State 177
+    , { 6, 293, 34 }
+
+    // State 178
+    
+
+    // State 179
+    
+
+    // State 180
+    , { 6, 296, 16 }, { 6, 98, 23 }, { 6, 99, 78 }, { 6, 103, 79 }, { 6, 27, 86 }, 
+    { 6, 28, 87 }, { 6, 35, 88 }, { 6, 297, 92 }, { 6, 102, 95 }
+
+    // State 181
+    , { 6, 298, 16 }, 
+    { 6, 98, 23 }, { 6, 99, 78 }, { 6, 103, 79 }, { 6, 27, 86 }, { 6, 28, 87 }, 
+    { 6, 35, 88 }, { 6, 297, 92 }, { 6, 102, 95 }
+
+    // State 182
+    , { 3, 128, 233 }
+
+    // State 183
+    , { 3, 129, 233 }
+
+    // State 184
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 131, 4 }, { 6, 299, 5 }, { 6, 301, 6 }, 
+    { 6, 300, 7 }, { 6, 156, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, 
+    { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, 
+    { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, 
+    { 6, 145, 56 }, { 6, 157, 57 }
+
+    // State 185
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 302, 3 }, 
+    { 6, 131, 4 }, { 6, 179, 7 }, { 6, 156, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, 
+    { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, 
+    { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, { 6, 143, 54 }, 
+    { 6, 144, 55 }, { 6, 145, 56 }, { 6, 157, 57 }
+
+    // State 186
+    
+
+    // State 187
+    
+
+    // State 188
+    , { 3, 131, 233 }
+
+    // State 189
+    , { 3, 132, 233 }
+
+    // State 190
+    , { 3, 133, 233 }
+
+    // State 191
+    , { 3, 134, 233 }
+
+    // State 192
+    
+
+    // State 193
+    
+
+    // State 194
+    
+
+    // State 195
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 131, 4 }, 
+    { 6, 132, 9 }, { 6, 149, 14 }, { 6, 305, 15 }, { 6, 134, 18 }, { 6, 135, 19 }
+
+    // State 196
+    
+
+    // State 197
+    
+
+    // State 198
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 131, 4 }, { 6, 132, 9 }, { 6, 149, 14 }, 
+    { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, { 6, 306, 39 }
+
+    // State 199
+    
+
+    // State 200
+    
+
+    // State 201
+    , { 6, 129, 1 }, 
+    { 6, 130, 2 }, { 6, 131, 4 }, { 6, 132, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, 
+    { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, { 6, 307, 42 }
+
+    // State 202
+    
+
+    // State 203
+    
+
+    // State 204
+    
+
+    // State 205
+    
+
+    // State 206
+    , { 6, 129, 1 }, 
+    { 6, 130, 2 }, { 6, 131, 4 }, { 6, 132, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, 
+    { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, { 6, 308, 44 }
+
+    // State 207
+    
+
+    // State 208
+    
+
+    // State 209
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 131, 4 }, { 6, 132, 9 }, { 6, 149, 14 }, 
+    { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, 
+    { 6, 138, 44 }, { 6, 309, 46 }
+
+    // State 210
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 131, 4 }, 
+    { 6, 132, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, 
+    { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, { 6, 310, 50 }
+
+    // State 211
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 131, 4 }, { 6, 132, 9 }, { 6, 149, 14 }, 
+    { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, 
+    { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, { 6, 311, 52 }
+
+    // State 212
+    , { 6, 129, 1 }, 
+    { 6, 130, 2 }, { 6, 131, 4 }, { 6, 132, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, 
+    { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, 
+    { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, { 6, 312, 53 }
+
+    // State 213
+    , { 6, 129, 1 }, 
+    { 6, 130, 2 }, { 6, 131, 4 }, { 6, 132, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, 
+    { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, 
+    { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, { 6, 313, 54 }
+
+    // State 214
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 131, 4 }, { 6, 132, 9 }, { 6, 149, 14 }, 
+    { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, 
+    { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, 
+    { 6, 143, 54 }, { 6, 314, 55 }
+
+    // State 215
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 315, 3 }, 
+    { 6, 131, 4 }, { 6, 179, 7 }, { 6, 156, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, 
+    { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, 
+    { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, { 6, 143, 54 }, 
+    { 6, 144, 55 }, { 6, 145, 56 }, { 6, 157, 57 }
+
+    // State 216
+    , { 3, 148, 139 }
+
+    // State 217
+    , { 3, 149, 233 }
+
+    // State 218
+    
+
+    // State 219
+    , { 6, 316, 101 }
+
+    // State 220
+    , { 6, 317, 126 }
+
+    // State 221
+    
+
+    // State 222
+    
+
+    // State 223
+    
+
+    // State 224
+    
+
+    // State 225
+    
+
+    // State 226
+    
+
+    // State 227
+    
+
+    // State 228
+    
+
+    // State 229
+    
+
+    // State 230
+    
+
+    // State 231
+    
+
+    // State 232
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 131, 4 }, 
+    { 6, 318, 7 }, { 6, 156, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, 
+    { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, 
+    { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, 
+    { 6, 145, 56 }, { 6, 157, 57 }
+
+    // State 233
+    
+
+    // State 234
+    
+
+    // State 235
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 131, 4 }, 
+    { 6, 132, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, 
+    { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, 
+    { 6, 141, 52 }, { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, { 6, 145, 56 }, 
+    { 6, 146, 57 }, { 6, 320, 68 }
+
+    // State 236
+    
+
+    // State 237
+    
+
+    // State 238
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 246, 3 }, 
+    { 6, 131, 4 }, { 6, 179, 7 }, { 6, 156, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, 
+    { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, 
+    { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, { 6, 143, 54 }, 
+    { 6, 144, 55 }, { 6, 145, 56 }, { 6, 157, 57 }, { 6, 323, 128 }, { 6, 248, 129 }, 
+    { 6, 249, 130 }, { 6, 250, 131 }, { 6, 251, 132 }, { 6, 252, 133 }, { 6, 253, 134 }, 
+    { 6, 255, 142 }
+
+    // State 239
+    
+
+    // State 240
+    
+
+    // State 241
+    
+
+    // State 242
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 328, 3 }, { 6, 131, 4 }, 
+    { 6, 179, 7 }, { 6, 156, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, 
+    { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, 
+    { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, 
+    { 6, 145, 56 }, { 6, 157, 57 }
+
+    // State 243
+    
+
+    // State 244
+    
+
+    // State 245
+    
+
+    // State 246
+    
+
+    // State 247
+    
+
+    // State 248
+    
+
+    // State 249
+    
+
+    // State 250
+    
+
+    // State 251
+    
+
+    // State 252
+    
+
+    // State 253
+    
+
+    // State 254
+    
+
+    // State 255
+    
+
+    // State 256
+    
+
+    // State 257
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 246, 3 }, 
+    { 6, 131, 4 }, { 6, 179, 7 }, { 6, 156, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, 
+    { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, 
+    { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, { 6, 143, 54 }, 
+    { 6, 144, 55 }, { 6, 145, 56 }, { 6, 157, 57 }, { 6, 334, 128 }, { 6, 248, 129 }, 
+    { 6, 249, 130 }, { 6, 250, 131 }, { 6, 251, 132 }, { 6, 252, 133 }, { 6, 253, 134 }, 
+    { 6, 255, 142 }
+
+    // State 258
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 131, 4 }, { 6, 132, 9 }, 
+    { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, 
+    { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, 
+    { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, { 6, 145, 56 }, { 6, 146, 57 }, 
+    { 6, 335, 68 }
+
+    // State 259
+    , { 6, 337, 98 }
+
+    // State 260
+    
+
+    // State 261
+    , { 6, 339, 97 }
+
+    // State 262
+    
+
+    // State 263
+    , { 6, 341, 83 }, { 6, 39, 104 }, 
+    { 6, 40, 105 }
+
+    // State 264
+    , { 6, 22, 23 }, { 6, 342, 25 }, { 6, 166, 70 }, { 6, 25, 77 }, 
+    { 6, 26, 78 }, { 6, 36, 80 }, { 6, 34, 81 }, { 6, 27, 86 }, { 6, 28, 87 }, 
+    { 6, 35, 88 }, { 6, 267, 104 }, { 6, 343, 108 }, { 6, 168, 113 }, { 6, 268, 121 }, 
+    { 6, 345, 123 }, { 6, 344, 124 }
+
+    // State 265
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 131, 4 }, 
+    { 6, 132, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, 
+    { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, 
+    { 6, 141, 52 }, { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, { 6, 145, 56 }, 
+    { 6, 146, 57 }, { 6, 147, 68 }, { 6, 346, 107 }
+
+    // State 266
+    
+
+    // State 267
+    , { 6, 347, 121 }, { 6, 348, 122 }, 
+    { 3, 178, 233 }
+
+    // State 268
+    , { 3, 179, 233 }
+
+    // State 269
+    , { 6, 351, 83 }, { 6, 39, 104 }, { 6, 40, 105 }
+
+    // State 270
+    
+
+    // State 271
+    
+
+    // State 272
+    , { 5, 182, 233 }
+
+    // State 273
+    , { 6, 353, 115 }
+
+    // State 274
+    
+
+    // State 275
+    , { 6, 355, 16 }, { 6, 98, 23 }, { 6, 99, 78 }, 
+    { 6, 103, 79 }, { 6, 27, 86 }, { 6, 28, 87 }, { 6, 35, 88 }, { 6, 297, 92 }, 
+    { 6, 102, 95 }
+
+    // State 276
+    , { 6, 356, 16 }, { 6, 98, 23 }, { 6, 99, 78 }, { 6, 103, 79 }, 
+    { 6, 27, 86 }, { 6, 28, 87 }, { 6, 35, 88 }, { 6, 297, 92 }, { 6, 102, 95 }
+
+    // State 277
+    , { 3, 184, 233 }
+
+    // State 278
+    , { 3, 185, 233 }
+
+    // State 279
+    , { 3, 186, 233 }
+
+    // State 280
+    , { 3, 187, 233 }
+
+    // State 281
+    , { 3, 188, 233 }
+
+    // State 282
+    , { 3, 189, 233 }
+
+    // State 283
+    , { 3, 190, 233 }
+
+    // State 284
+    , { 3, 191, 233 }
+
+    // State 285
+    , { 3, 192, 233 }
+
+    // State 286
+    , { 6, 357, 22 }, 
+    { 6, 358, 23 }, { 6, 361, 24 }, { 6, 359, 25 }, { 6, 360, 26 }, { 6, 290, 86 }, 
+    { 6, 291, 87 }, { 6, 35, 88 }, { 6, 267, 104 }, { 6, 268, 121 }
+
+    // State 287
+    , { 5, 194, 233 }
+
+    // State 288
+    , { 3, 195, 233 }
+
+    // State 289
+    , { 3, 196, 233 }
+
+    // State 290
+    , { 3, 197, 233 }
+
+    // State 291
+    , { 3, 198, 233 }
+
+    // State 292
+    , { 6, 359, 25 }, 
+    { 6, 362, 26 }, { 6, 267, 104 }, { 6, 268, 121 }
+
+    // State 293
+    , { 5, 199, 233 }
+
+    // State 294
+    , { 3, 200, 233 }
+
+    // State 295
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 131, 4 }, { 6, 363, 7 }, { 6, 156, 9 }, 
+    { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, 
+    { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, 
+    { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, { 6, 145, 56 }, { 6, 157, 57 }
+
+    // State 296
+    
+
+    // State 297
+    , { 6, 359, 25 }, { 6, 365, 26 }, { 6, 267, 104 }, { 6, 268, 121 }, { 3, 193, 233 }
+
+    // State 298
+    
+
+    // State 299
+    
+
+    // State 300
+    , { 6, 367, 8 }
+
+    // State 301
+    
+
+    // State 302
+    
+
+    // State 303
+    , { 3, 203, 233 }
+
+    // State 304
+    , { 3, 204, 233 }
+
+    // State 305
+    
+
+    // State 306
+    , { 6, 195, 41 }
+
+    // State 307
+    , { 6, 198, 43 }
+
+    // State 308
+    , { 6, 201, 45 }
+
+    // State 309
+    , { 6, 206, 49 }
+
+    // State 310
+    , { 6, 209, 51 }
+
+    // State 311
+    
+
+    // State 312
+    
+
+    // State 313
+    
+
+    // State 314
+    
+
+    // State 315
+    
+
+    // State 316
+    
+
+    // State 317
+    , { 6, 372, 127 }
+
+    // State 318
+    
+
+    // State 319
+    
+
+    // State 320
+    
+
+    // State 321
+    
+
+    // State 322
+    , { 6, 129, 1 }, 
+    { 6, 130, 2 }, { 6, 246, 3 }, { 6, 131, 4 }, { 6, 179, 7 }, { 6, 156, 9 }, 
+    { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, 
+    { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, 
+    { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, { 6, 145, 56 }, { 6, 157, 57 }, 
+    { 6, 374, 128 }, { 6, 248, 129 }, { 6, 249, 130 }, { 6, 250, 131 }, { 6, 251, 132 }, 
+    { 6, 252, 133 }, { 6, 253, 134 }, { 6, 255, 142 }
+
+    // State 323
+    
+
+    // State 324
+    , { 6, 129, 1 }, { 6, 130, 2 }, 
+    { 6, 246, 3 }, { 6, 131, 4 }, { 6, 179, 7 }, { 6, 156, 9 }, { 6, 149, 14 }, 
+    { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, 
+    { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, 
+    { 6, 143, 54 }, { 6, 144, 55 }, { 6, 145, 56 }, { 6, 157, 57 }, { 6, 376, 131 }, 
+    { 6, 255, 142 }
+
+    // State 325
+    
+
+    // State 326
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 378, 3 }, { 6, 131, 4 }, 
+    { 6, 179, 7 }, { 6, 156, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, 
+    { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, 
+    { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, 
+    { 6, 145, 56 }, { 6, 157, 57 }
+
+    // State 327
+    
+
+    // State 328
+    
+
+    // State 329
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 380, 3 }, 
+    { 6, 131, 4 }, { 6, 179, 7 }, { 6, 156, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, 
+    { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, 
+    { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, { 6, 143, 54 }, 
+    { 6, 144, 55 }, { 6, 145, 56 }, { 6, 157, 57 }
+
+    // State 330
+    , { 6, 129, 1 }, { 6, 130, 2 }, 
+    { 6, 381, 3 }, { 6, 131, 4 }, { 6, 179, 7 }, { 6, 156, 9 }, { 6, 149, 14 }, 
+    { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, 
+    { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, 
+    { 6, 143, 54 }, { 6, 144, 55 }, { 6, 145, 56 }, { 6, 157, 57 }
+
+    // State 331
+    , { 6, 129, 1 }, 
+    { 6, 130, 2 }, { 6, 246, 3 }, { 6, 131, 4 }, { 6, 179, 7 }, { 6, 156, 9 }, 
+    { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, 
+    { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, 
+    { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, { 6, 145, 56 }, { 6, 157, 57 }, 
+    { 6, 382, 128 }, { 6, 248, 129 }, { 6, 249, 130 }, { 6, 250, 131 }, { 6, 251, 132 }, 
+    { 6, 252, 133 }, { 6, 253, 134 }, { 6, 255, 142 }
+
+    // State 332
+    
+
+    // State 333
+    , { 3, 222, 147 }, { 3, 222, 232 }
+
+    // State 334
+    
+
+    // State 335
+    
+
+    // State 336
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 131, 4 }, { 6, 132, 9 }, { 6, 149, 14 }, 
+    { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, 
+    { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, 
+    { 6, 143, 54 }, { 6, 144, 55 }, { 6, 145, 56 }, { 6, 146, 57 }, { 6, 383, 68 }
+
+    // State 337
+    
+
+    // State 338
+    , { 5, 226, 233 }
+
+    // State 339
+    
+
+    // State 340
+    
+
+    // State 341
+    , { 6, 387, 116 }
+
+    // State 342
+    
+
+    // State 343
+    
+
+    // State 344
+    
+
+    // State 345
+    
+
+    // State 346
+    
+
+    // State 347
+    , { 3, 232, 233 }
+
+    // State 348
+    , { 3, 233, 233 }
+
+    // State 349
+    , { 6, 22, 23 }, 
+    { 6, 166, 70 }, { 6, 25, 77 }, { 6, 26, 78 }, { 6, 36, 80 }, { 6, 34, 81 }, 
+    { 6, 27, 86 }, { 6, 28, 87 }, { 6, 35, 88 }, { 6, 390, 108 }, { 6, 168, 113 }, 
+    { 6, 391, 125 }
+
+    // State 350
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 131, 4 }, { 6, 132, 9 }, 
+    { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, 
+    { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, 
+    { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, { 6, 145, 56 }, { 6, 146, 57 }, 
+    { 6, 147, 68 }, { 6, 392, 107 }
+
+    // State 351
+    
+
+    // State 352
+    , { 6, 22, 23 }, { 6, 166, 70 }, { 6, 25, 77 }, 
+    { 6, 26, 78 }, { 6, 36, 80 }, { 6, 34, 81 }, { 6, 27, 86 }, { 6, 28, 87 }, 
+    { 6, 35, 88 }, { 6, 394, 113 }
+
+    // State 353
+    
+
+    // State 354
+    
+
+    // State 355
+    , { 5, 238, 233 }
+
+    // State 356
+    
+
+    // State 357
+    , { 3, 239, 233 }
+
+    // State 358
+    , { 3, 240, 233 }
+
+    // State 359
+    , { 3, 241, 233 }
+
+    // State 360
+    
+
+    // State 361
+    , { 3, 242, 233 }
+
+    // State 362
+    
+
+    // State 363
+    
+
+    // State 364
+    
+
+    // State 365
+    , { 3, 245, 233 }
+
+    // State 366
+    
+
+    // State 367
+    
+
+    // State 368
+    , { 3, 248, 233 }
+
+    // State 369
+    , { 3, 249, 233 }
+
+    // State 370
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 131, 4 }, { 6, 132, 9 }, { 6, 149, 14 }, 
+    { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, 
+    { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, 
+    { 6, 143, 54 }, { 6, 144, 55 }, { 6, 145, 56 }, { 6, 399, 57 }
+
+    // State 371
+    , { 6, 129, 1 }, 
+    { 6, 130, 2 }, { 6, 131, 4 }, { 6, 155, 7 }, { 6, 156, 9 }, { 6, 149, 14 }, 
+    { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, 
+    { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, 
+    { 6, 143, 54 }, { 6, 144, 55 }, { 6, 145, 56 }, { 6, 157, 57 }, { 6, 400, 84 }
+
+    // State 372
+    
+
+    // State 373
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 246, 3 }, { 6, 131, 4 }, { 6, 179, 7 }, 
+    { 6, 156, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, 
+    { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, 
+    { 6, 141, 52 }, { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, { 6, 145, 56 }, 
+    { 6, 157, 57 }, { 6, 402, 128 }, { 6, 248, 129 }, { 6, 249, 130 }, { 6, 250, 131 }, 
+    { 6, 251, 132 }, { 6, 252, 133 }, { 6, 253, 134 }, { 6, 255, 142 }
+
+    // State 374
+    
+
+    // State 375
+    
+
+    // State 376
+    , { 6, 129, 1 }, 
+    { 6, 130, 2 }, { 6, 246, 3 }, { 6, 131, 4 }, { 6, 179, 7 }, { 6, 156, 9 }, 
+    { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, 
+    { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, 
+    { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, { 6, 145, 56 }, { 6, 157, 57 }, 
+    { 6, 404, 131 }, { 6, 255, 142 }
+
+    // State 377
+    
+
+    // State 378
+    
+
+    // State 379
+    
+
+    // State 380
+    
+
+    // State 381
+    
+
+    // State 382
+    
+
+    // State 383
+    
+
+    // State 384
+    , { 6, 259, 83 }, { 6, 408, 96 }, { 6, 39, 104 }, 
+    { 6, 40, 105 }
+
+    // State 385
+    , { 3, 256, 233 }
+
+    // State 386
+    , { 3, 257, 233 }
+
+    // State 387
+    , { 5, 258, 233 }
+
+    // State 388
+    , { 3, 259, 233 }
+
+    // State 389
+    , { 3, 260, 233 }
+
+    // State 390
+    
+
+    // State 391
+    
+
+    // State 392
+    
+
+    // State 393
+    
+
+    // State 394
+    
+
+    // State 395
+    , { 3, 264, 233 }
+
+    // State 396
+    , { 6, 418, 1 }, { 6, 419, 33 }
+
+    // State 397
+    , { 6, 424, 38 }
+
+    // State 398
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 131, 4 }, { 6, 425, 7 }, { 6, 156, 9 }, 
+    { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, 
+    { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, 
+    { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, { 6, 145, 56 }, { 6, 157, 57 }
+
+    // State 399
+    
+
+    // State 400
+    
+
+    // State 401
+    
+
+    // State 402
+    
+
+    // State 403
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 426, 3 }, { 6, 131, 4 }, { 6, 179, 7 }, 
+    { 6, 156, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, 
+    { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, 
+    { 6, 141, 52 }, { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, { 6, 145, 56 }, 
+    { 6, 157, 57 }
+
+    // State 404
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 246, 3 }, { 6, 131, 4 }, 
+    { 6, 179, 7 }, { 6, 156, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, 
+    { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, 
+    { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, 
+    { 6, 145, 56 }, { 6, 157, 57 }, { 6, 427, 142 }
+
+    // State 405
+    , { 6, 129, 1 }, { 6, 130, 2 }, 
+    { 6, 246, 3 }, { 6, 131, 4 }, { 6, 179, 7 }, { 6, 156, 9 }, { 6, 149, 14 }, 
+    { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, 
+    { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, 
+    { 6, 143, 54 }, { 6, 144, 55 }, { 6, 145, 56 }, { 6, 157, 57 }, { 6, 428, 128 }, 
+    { 6, 248, 129 }, { 6, 249, 130 }, { 6, 250, 131 }, { 6, 251, 132 }, { 6, 252, 133 }, 
+    { 6, 253, 134 }, { 6, 255, 142 }
+
+    // State 406
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 246, 3 }, 
+    { 6, 131, 4 }, { 6, 179, 7 }, { 6, 156, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, 
+    { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, 
+    { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, { 6, 143, 54 }, 
+    { 6, 144, 55 }, { 6, 145, 56 }, { 6, 157, 57 }, { 6, 429, 128 }, { 6, 248, 129 }, 
+    { 6, 249, 130 }, { 6, 250, 131 }, { 6, 251, 132 }, { 6, 252, 133 }, { 6, 253, 134 }, 
+    { 6, 255, 142 }
+
+    // State 407
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 246, 3 }, { 6, 131, 4 }, 
+    { 6, 179, 7 }, { 6, 156, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, 
+    { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, 
+    { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, 
+    { 6, 145, 56 }, { 6, 157, 57 }, { 6, 430, 128 }, { 6, 248, 129 }, { 6, 249, 130 }, 
+    { 6, 250, 131 }, { 6, 251, 132 }, { 6, 252, 133 }, { 6, 253, 134 }, { 6, 255, 142 }
+
+    // State 408
+    
+
+    // State 409
+    , { 3, 270, 233 }
+
+    // State 410
+    , { 3, 271, 233 }
+
+    // State 411
+    , { 3, 272, 233 }
+
+    // State 412
+    , { 3, 273, 233 }
+
+    // State 413
+    , { 6, 129, 1 }, 
+    { 6, 130, 2 }, { 6, 131, 4 }, { 6, 431, 9 }, { 6, 149, 14 }
+
+    // State 414
+    , { 6, 129, 1 }, 
+    { 6, 130, 2 }, { 6, 131, 4 }, { 6, 432, 9 }, { 6, 149, 14 }
+
+    // State 415
+    , { 3, 274, 233 }
+
+    // State 416
+    , { 3, 275, 233 }
+
+    // State 417
+    , { 3, 276, 233 }
+
+    // State 418
+    , { 3, 277, 233 }
+
+    // State 419
+    , { 3, 278, 233 }
+
+    // State 420
+    , { 6, 129, 1 }, 
+    { 6, 130, 2 }, { 6, 433, 3 }, { 6, 131, 4 }, { 6, 179, 7 }, { 6, 156, 9 }, 
+    { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, { 6, 136, 39 }, 
+    { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, { 6, 141, 52 }, 
+    { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, { 6, 145, 56 }, { 6, 157, 57 }
+
+    // State 421
+    , { 3, 279, 233 }
+
+    // State 422
+    , { 3, 280, 233 }
+
+    // State 423
+    , { 3, 281, 233 }
+
+    // State 424
+    , { 3, 282, 233 }
+
+    // State 425
+    
+
+    // State 426
+    
+
+    // State 427
+    
+
+    // State 428
+    
+
+    // State 429
+    
+
+    // State 430
+    
+
+    // State 431
+    , { 3, 287, 233 }
+
+    // State 432
+    , { 3, 288, 233 }
+
+    // State 433
+    
+
+    // State 434
+    
+
+    // State 435
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 246, 3 }, { 6, 131, 4 }, 
+    { 6, 179, 7 }, { 6, 156, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, 
+    { 6, 135, 19 }, { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, 
+    { 6, 140, 50 }, { 6, 141, 52 }, { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, 
+    { 6, 145, 56 }, { 6, 157, 57 }, { 6, 438, 128 }, { 6, 248, 129 }, { 6, 249, 130 }, 
+    { 6, 250, 131 }, { 6, 251, 132 }, { 6, 252, 133 }, { 6, 253, 134 }, { 6, 255, 142 }
+
+    // State 436
+    , { 6, 129, 1 }, { 6, 130, 2 }, { 6, 246, 3 }, { 6, 131, 4 }, { 6, 179, 7 }, 
+    { 6, 156, 9 }, { 6, 149, 14 }, { 6, 133, 15 }, { 6, 134, 18 }, { 6, 135, 19 }, 
+    { 6, 136, 39 }, { 6, 137, 42 }, { 6, 138, 44 }, { 6, 139, 46 }, { 6, 140, 50 }, 
+    { 6, 141, 52 }, { 6, 142, 53 }, { 6, 143, 54 }, { 6, 144, 55 }, { 6, 145, 56 }, 
+    { 6, 157, 57 }, { 6, 439, 128 }, { 6, 248, 129 }, { 6, 249, 130 }, { 6, 250, 131 }, 
+    { 6, 251, 132 }, { 6, 252, 133 }, { 6, 253, 134 }, { 6, 255, 142 }
+
+    // State 437
+    , { 3, 290, 233 }
+
+    // State 438
+    
+
+    // State 439
+    
+};
+static const lr::small_parser_tables::action* const s_NonterminalActions[] = {
+    s_NonterminalActions_data + 0, s_NonterminalActions_data + 15, s_NonterminalActions_data + 18, 
+    s_NonterminalActions_data + 21, s_NonterminalActions_data + 26, s_NonterminalActions_data + 31, 
+    s_NonterminalActions_data + 36, s_NonterminalActions_data + 37, s_NonterminalActions_data + 40, 
+    s_NonterminalActions_data + 45, s_NonterminalActions_data + 50, s_NonterminalActions_data + 55, 
+    s_NonterminalActions_data + 58, s_NonterminalActions_data + 63, s_NonterminalActions_data + 68, 
+    s_NonterminalActions_data + 71, s_NonterminalActions_data + 71, s_NonterminalActions_data + 74, 
+    s_NonterminalActions_data + 74, s_NonterminalActions_data + 79, s_NonterminalActions_data + 84, 
+    s_NonterminalActions_data + 89, s_NonterminalActions_data + 94, s_NonterminalActions_data + 97, 
+    s_NonterminalActions_data + 99, s_NonterminalActions_data + 101, s_NonterminalActions_data + 104, 
+    s_NonterminalActions_data + 107, s_NonterminalActions_data + 112, s_NonterminalActions_data + 117, 
+    s_NonterminalActions_data + 118, s_NonterminalActions_data + 120, s_NonterminalActions_data + 122, 
+    s_NonterminalActions_data + 125, s_NonterminalActions_data + 139, s_NonterminalActions_data + 149, 
+    s_NonterminalActions_data + 149, s_NonterminalActions_data + 152, s_NonterminalActions_data + 154, 
+    s_NonterminalActions_data + 158, s_NonterminalActions_data + 158, s_NonterminalActions_data + 159, 
+    s_NonterminalActions_data + 164, s_NonterminalActions_data + 164, s_NonterminalActions_data + 169, 
+    s_NonterminalActions_data + 175, s_NonterminalActions_data + 178, s_NonterminalActions_data + 182, 
+    s_NonterminalActions_data + 184, s_NonterminalActions_data + 187, s_NonterminalActions_data + 193, 
+    s_NonterminalActions_data + 194, s_NonterminalActions_data + 197, s_NonterminalActions_data + 207, 
+    s_NonterminalActions_data + 207, s_NonterminalActions_data + 217, s_NonterminalActions_data + 217, 
+    s_NonterminalActions_data + 218, s_NonterminalActions_data + 219, s_NonterminalActions_data + 222, 
+    s_NonterminalActions_data + 223, s_NonterminalActions_data + 225, s_NonterminalActions_data + 226, 
+    s_NonterminalActions_data + 227, s_NonterminalActions_data + 228, s_NonterminalActions_data + 229, 
+    s_NonterminalActions_data + 230, s_NonterminalActions_data + 230, s_NonterminalActions_data + 230, 
+    s_NonterminalActions_data + 234, s_NonterminalActions_data + 235, s_NonterminalActions_data + 236, 
+    s_NonterminalActions_data + 241, s_NonterminalActions_data + 250, s_NonterminalActions_data + 251, 
+    s_NonterminalActions_data + 252, s_NonterminalActions_data + 253, s_NonterminalActions_data + 254, 
+    s_NonterminalActions_data + 255, s_NonterminalActions_data + 256, s_NonterminalActions_data + 266, 
+    s_NonterminalActions_data + 266, s_NonterminalActions_data + 269, s_NonterminalActions_data + 290, 
+    s_NonterminalActions_data + 291, s_NonterminalActions_data + 291, s_NonterminalActions_data + 292, 
+    s_NonterminalActions_data + 293, s_NonterminalActions_data + 294, s_NonterminalActions_data + 295, 
+    s_NonterminalActions_data + 316, s_NonterminalActions_data + 316, s_NonterminalActions_data + 316, 
+    s_NonterminalActions_data + 320, s_NonterminalActions_data + 321, s_NonterminalActions_data + 325, 
+    s_NonterminalActions_data + 327, s_NonterminalActions_data + 336, s_NonterminalActions_data + 341, 
+    s_NonterminalActions_data + 343, s_NonterminalActions_data + 345, s_NonterminalActions_data + 345, 
+    s_NonterminalActions_data + 346, s_NonterminalActions_data + 354, s_NonterminalActions_data + 356, 
+    s_NonterminalActions_data + 357, s_NonterminalActions_data + 358, s_NonterminalActions_data + 369, 
+    s_NonterminalActions_data + 370, s_NonterminalActions_data + 371, s_NonterminalActions_data + 371, 
+    s_NonterminalActions_data + 382, s_NonterminalActions_data + 382, s_NonterminalActions_data + 388, 
+    s_NonterminalActions_data + 389, s_NonterminalActions_data + 390, s_NonterminalActions_data + 391, 
+    s_NonterminalActions_data + 392, s_NonterminalActions_data + 393, s_NonterminalActions_data + 394, 
+    s_NonterminalActions_data + 395, s_NonterminalActions_data + 418, s_NonterminalActions_data + 423, 
+    s_NonterminalActions_data + 428, s_NonterminalActions_data + 428, s_NonterminalActions_data + 428, 
+    s_NonterminalActions_data + 428, s_NonterminalActions_data + 428, s_NonterminalActions_data + 428, 
+    s_NonterminalActions_data + 428, s_NonterminalActions_data + 429, s_NonterminalActions_data + 430, 
+    s_NonterminalActions_data + 431, s_NonterminalActions_data + 432, s_NonterminalActions_data + 432, 
+    s_NonterminalActions_data + 440, s_NonterminalActions_data + 448, s_NonterminalActions_data + 449, 
+    s_NonterminalActions_data + 450, s_NonterminalActions_data + 451, s_NonterminalActions_data + 452, 
+    s_NonterminalActions_data + 453, s_NonterminalActions_data + 453, s_NonterminalActions_data + 453, 
+    s_NonterminalActions_data + 453, s_NonterminalActions_data + 453, s_NonterminalActions_data + 453, 
+    s_NonterminalActions_data + 453, s_NonterminalActions_data + 453, s_NonterminalActions_data + 453, 
+    s_NonterminalActions_data + 461, s_NonterminalActions_data + 481, s_NonterminalActions_data + 481, 
+    s_NonterminalActions_data + 486, s_NonterminalActions_data + 486, s_NonterminalActions_data + 507, 
+    s_NonterminalActions_data + 507, s_NonterminalActions_data + 508, s_NonterminalActions_data + 508, 
+    s_NonterminalActions_data + 508, s_NonterminalActions_data + 512, s_NonterminalActions_data + 514, 
+    s_NonterminalActions_data + 546, s_NonterminalActions_data + 551, s_NonterminalActions_data + 556, 
+    s_NonterminalActions_data + 561, s_NonterminalActions_data + 563, s_NonterminalActions_data + 569, 
+    s_NonterminalActions_data + 569, s_NonterminalActions_data + 570, s_NonterminalActions_data + 570, 
+    s_NonterminalActions_data + 570, s_NonterminalActions_data + 571, s_NonterminalActions_data + 571, 
+    s_NonterminalActions_data + 592, s_NonterminalActions_data + 593, s_NonterminalActions_data + 593, 
+    s_NonterminalActions_data + 599, s_NonterminalActions_data + 600, s_NonterminalActions_data + 600, 
+    s_NonterminalActions_data + 600, s_NonterminalActions_data + 609, s_NonterminalActions_data + 618, 
+    s_NonterminalActions_data + 619, s_NonterminalActions_data + 620, s_NonterminalActions_data + 642, 
+    s_NonterminalActions_data + 663, s_NonterminalActions_data + 663, s_NonterminalActions_data + 663, 
+    s_NonterminalActions_data + 664, s_NonterminalActions_data + 665, s_NonterminalActions_data + 666, 
+    s_NonterminalActions_data + 667, s_NonterminalActions_data + 667, s_NonterminalActions_data + 667, 
+    s_NonterminalActions_data + 667, s_NonterminalActions_data + 675, s_NonterminalActions_data + 675, 
+    s_NonterminalActions_data + 675, s_NonterminalActions_data + 684, s_NonterminalActions_data + 684, 
+    s_NonterminalActions_data + 684, s_NonterminalActions_data + 694, s_NonterminalActions_data + 694, 
+    s_NonterminalActions_data + 694, s_NonterminalActions_data + 694, s_NonterminalActions_data + 694, 
+    s_NonterminalActions_data + 705, s_NonterminalActions_data + 705, s_NonterminalActions_data + 705, 
+    s_NonterminalActions_data + 717, s_NonterminalActions_data + 730, s_NonterminalActions_data + 744, 
+    s_NonterminalActions_data + 759, s_NonterminalActions_data + 775, s_NonterminalActions_data + 792, 
+    s_NonterminalActions_data + 813, s_NonterminalActions_data + 814, s_NonterminalActions_data + 815, 
+    s_NonterminalActions_data + 815, s_NonterminalActions_data + 816, s_NonterminalActions_data + 817, 
+    s_NonterminalActions_data + 817, s_NonterminalActions_data + 817, s_NonterminalActions_data + 817, 
+    s_NonterminalActions_data + 817, s_NonterminalActions_data + 817, s_NonterminalActions_data + 817, 
+    s_NonterminalActions_data + 817, s_NonterminalActions_data + 817, s_NonterminalActions_data + 817, 
+    s_NonterminalActions_data + 817, s_NonterminalActions_data + 817, s_NonterminalActions_data + 837, 
+    s_NonterminalActions_data + 837, s_NonterminalActions_data + 837, s_NonterminalActions_data + 857, 
+    s_NonterminalActions_data + 857, s_NonterminalActions_data + 857, s_NonterminalActions_data + 886, 
+    s_NonterminalActions_data + 886, s_NonterminalActions_data + 886, s_NonterminalActions_data + 886, 
+    s_NonterminalActions_data + 907, s_NonterminalActions_data + 907, s_NonterminalActions_data + 907, 
+    s_NonterminalActions_data + 907, s_NonterminalActions_data + 907, s_NonterminalActions_data + 907, 
+    s_NonterminalActions_data + 907, s_NonterminalActions_data + 907, s_NonterminalActions_data + 907, 
+    s_NonterminalActions_data + 907, s_NonterminalActions_data + 907, s_NonterminalActions_data + 907, 
+    s_NonterminalActions_data + 907, s_NonterminalActions_data + 907, s_NonterminalActions_data + 907, 
+    s_NonterminalActions_data + 936, s_NonterminalActions_data + 956, s_NonterminalActions_data + 957, 
+    s_NonterminalActions_data + 957, s_NonterminalActions_data + 958, s_NonterminalActions_data + 958, 
+    s_NonterminalActions_data + 961, s_NonterminalActions_data + 977, s_NonterminalActions_data + 998, 
+    s_NonterminalActions_data + 998, s_NonterminalActions_data + 1001, s_NonterminalActions_data + 1002, 
+    s_NonterminalActions_data + 1005, s_NonterminalActions_data + 1005, s_NonterminalActions_data + 1005, 
+    s_NonterminalActions_data + 1006, s_NonterminalActions_data + 1007, s_NonterminalActions_data + 1007, 
+    s_NonterminalActions_data + 1016, s_NonterminalActions_data + 1025, s_NonterminalActions_data + 1026, 
+    s_NonterminalActions_data + 1027, s_NonterminalActions_data + 1028, s_NonterminalActions_data + 1029, 
+    s_NonterminalActions_data + 1030, s_NonterminalActions_data + 1031, s_NonterminalActions_data + 1032, 
+    s_NonterminalActions_data + 1033, s_NonterminalActions_data + 1034, s_NonterminalActions_data + 1044, 
+    s_NonterminalActions_data + 1045, s_NonterminalActions_data + 1046, s_NonterminalActions_data + 1047, 
+    s_NonterminalActions_data + 1048, s_NonterminalActions_data + 1049, s_NonterminalActions_data + 1053, 
+    s_NonterminalActions_data + 1054, s_NonterminalActions_data + 1055, s_NonterminalActions_data + 1075, 
+    s_NonterminalActions_data + 1075, s_NonterminalActions_data + 1080, s_NonterminalActions_data + 1080, 
+    s_NonterminalActions_data + 1080, s_NonterminalActions_data + 1081, s_NonterminalActions_data + 1081, 
+    s_NonterminalActions_data + 1081, s_NonterminalActions_data + 1082, s_NonterminalActions_data + 1083, 
+    s_NonterminalActions_data + 1083, s_NonterminalActions_data + 1084, s_NonterminalActions_data + 1085, 
+    s_NonterminalActions_data + 1086, s_NonterminalActions_data + 1087, s_NonterminalActions_data + 1088, 
+    s_NonterminalActions_data + 1088, s_NonterminalActions_data + 1088, s_NonterminalActions_data + 1088, 
+    s_NonterminalActions_data + 1088, s_NonterminalActions_data + 1088, s_NonterminalActions_data + 1088, 
+    s_NonterminalActions_data + 1089, s_NonterminalActions_data + 1089, s_NonterminalActions_data + 1089, 
+    s_NonterminalActions_data + 1089, s_NonterminalActions_data + 1089, s_NonterminalActions_data + 1118, 
+    s_NonterminalActions_data + 1118, s_NonterminalActions_data + 1141, s_NonterminalActions_data + 1141, 
+    s_NonterminalActions_data + 1162, s_NonterminalActions_data + 1162, s_NonterminalActions_data + 1162, 
+    s_NonterminalActions_data + 1183, s_NonterminalActions_data + 1204, s_NonterminalActions_data + 1233, 
+    s_NonterminalActions_data + 1233, s_NonterminalActions_data + 1235, s_NonterminalActions_data + 1235, 
+    s_NonterminalActions_data + 1235, s_NonterminalActions_data + 1255, s_NonterminalActions_data + 1255, 
+    s_NonterminalActions_data + 1256, s_NonterminalActions_data + 1256, s_NonterminalActions_data + 1256, 
+    s_NonterminalActions_data + 1257, s_NonterminalActions_data + 1257, s_NonterminalActions_data + 1257, 
+    s_NonterminalActions_data + 1257, s_NonterminalActions_data + 1257, s_NonterminalActions_data + 1257, 
+    s_NonterminalActions_data + 1258, s_NonterminalActions_data + 1259, s_NonterminalActions_data + 1271, 
+    s_NonterminalActions_data + 1292, s_NonterminalActions_data + 1292, s_NonterminalActions_data + 1302, 
+    s_NonterminalActions_data + 1302, s_NonterminalActions_data + 1302, s_NonterminalActions_data + 1303, 
+    s_NonterminalActions_data + 1303, s_NonterminalActions_data + 1304, s_NonterminalActions_data + 1305, 
+    s_NonterminalActions_data + 1306, s_NonterminalActions_data + 1306, s_NonterminalActions_data + 1307, 
+    s_NonterminalActions_data + 1307, s_NonterminalActions_data + 1307, s_NonterminalActions_data + 1307, 
+    s_NonterminalActions_data + 1308, s_NonterminalActions_data + 1308, s_NonterminalActions_data + 1308, 
+    s_NonterminalActions_data + 1309, s_NonterminalActions_data + 1310, s_NonterminalActions_data + 1329, 
+    s_NonterminalActions_data + 1350, s_NonterminalActions_data + 1350, s_NonterminalActions_data + 1379, 
+    s_NonterminalActions_data + 1379, s_NonterminalActions_data + 1379, s_NonterminalActions_data + 1402, 
+    s_NonterminalActions_data + 1402, s_NonterminalActions_data + 1402, s_NonterminalActions_data + 1402, 
+    s_NonterminalActions_data + 1402, s_NonterminalActions_data + 1402, s_NonterminalActions_data + 1402, 
+    s_NonterminalActions_data + 1402, s_NonterminalActions_data + 1406, s_NonterminalActions_data + 1407, 
+    s_NonterminalActions_data + 1408, s_NonterminalActions_data + 1409, s_NonterminalActions_data + 1410, 
+    s_NonterminalActions_data + 1411, s_NonterminalActions_data + 1411, s_NonterminalActions_data + 1411, 
+    s_NonterminalActions_data + 1411, s_NonterminalActions_data + 1411, s_NonterminalActions_data + 1411, 
+    s_NonterminalActions_data + 1412, s_NonterminalActions_data + 1414, s_NonterminalActions_data + 1415, 
+    s_NonterminalActions_data + 1435, s_NonterminalActions_data + 1435, s_NonterminalActions_data + 1435, 
+    s_NonterminalActions_data + 1435, s_NonterminalActions_data + 1435, s_NonterminalActions_data + 1456, 
+    s_NonterminalActions_data + 1478, s_NonterminalActions_data + 1507, s_NonterminalActions_data + 1536, 
+    s_NonterminalActions_data + 1565, s_NonterminalActions_data + 1565, s_NonterminalActions_data + 1566, 
+    s_NonterminalActions_data + 1567, s_NonterminalActions_data + 1568, s_NonterminalActions_data + 1569, 
+    s_NonterminalActions_data + 1574, s_NonterminalActions_data + 1579, s_NonterminalActions_data + 1580, 
+    s_NonterminalActions_data + 1581, s_NonterminalActions_data + 1582, s_NonterminalActions_data + 1583, 
+    s_NonterminalActions_data + 1584, s_NonterminalActions_data + 1605, s_NonterminalActions_data + 1606, 
+    s_NonterminalActions_data + 1607, s_NonterminalActions_data + 1608, s_NonterminalActions_data + 1609, 
+    s_NonterminalActions_data + 1609, s_NonterminalActions_data + 1609, s_NonterminalActions_data + 1609, 
+    s_NonterminalActions_data + 1609, s_NonterminalActions_data + 1609, s_NonterminalActions_data + 1609, 
+    s_NonterminalActions_data + 1610, s_NonterminalActions_data + 1611, s_NonterminalActions_data + 1611, 
+    s_NonterminalActions_data + 1611, s_NonterminalActions_data + 1640, s_NonterminalActions_data + 1669, 
+    s_NonterminalActions_data + 1670, s_NonterminalActions_data + 1670
+};
+
+static const lr::small_parser_tables::action s_DefaultReductions[] = {
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, 
+    { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }, { 2, 0, -1 }
+};
+
+static const int s_TerminalIndex_base[] = {
+        6132, 4697, 5380, 4426, 4479, 4532, 1803, 5431, 4585, 4638, 4691, 5482, 4744, 4797, 5533, 3106, 
+        5584, 3896, 4850, 4903, 4956, 5009, 5635, 6175, 4380, 5686, 5737, 5062, 5115, 2290, 6218, 6261, 
+        4750, 6304, 5788, 3966, 5839, 3875, 6552, 3881, 3951, 3860, 1352, 4485, 4538, 4803, 6586, 6347, 
+        5890, 3930, 9202, 3945, 6772, 2991, 6806, 1400, 87, 4000, 4856, 4071, 1898, 2402, 4280, 3996, 
+        2458, 6467, 1449, 1497, 6628, 1544, 9236, 5168, 9270, 4015, 3808, 2514, 4591, 174, 2570, 6840, 
+        464, 6662, 25, 6342, 1593, 3767, 2626, 2682, 2738, 7261, 6656, 6870, 261, 1688, 348, 6390, 
+        9304, 5221, 6874, 6920, 9338, 4085, 6966, 7012, 435, 4142, 7059, 1904, 4213, 1931, 7093, 1987, 
+        460, 483, 531, 579, 627, 675, 723, 771, 3062, 7548, 7573, 7598, 7623, 7648, 7673, 7698, 
+        7723, 819, 867, 915, 1345, 5896, 7748, 7773, 5936, 6394, 7096, 7286, 9545, 9641, 9713, 9783, 
+        9853, 9888, 4302, 5, 92, 7798, 7823, 5376, 5274, 5427, 7341, 3023, 1393, 4089, 6916, 4909, 
+        6471, 3118, 5327, 4156, 4227, 7167, 3009, 2043, 1960, 2016, 2099, 4284, 117, 7848, 1441, 178, 
+        9406, 1954, 2072, 4361, 9440, 9474, 1489, 1537, 112, 7873, 2010, 2066, 963, 1011, 1585, 1633, 
+        7898, 7923, 7948, 7973, 7998, 8023, 8048, 8073, 8098, 8123, 8148, 8173, 8198, 8223, 8248, 8273, 
+        8298, 8323, 8348, 8373, 8398, 8423, 8448, 8473, 4355, 1681, 5478, 2122, 5529, 8498, 8523, 8548, 
+        8573, 8598, 8623, 8648, 8673, 8698, 8723, 8748, 8773, 6962, 1641, 8798, 2996, 1876, 3342, 265, 
+        2178, 352, 7366, 378, 439, 1299, 6580, 3174, 1871, 1927, 1983, 2039, 2095, 2151, 1737, 4021, 
+        3796, 3230, 8823, 6835, 4067, 7008, 4138, 4962, 6087, 199, 2128, 4296, 4374, 5015, 2184, 2240, 
+        2794, 2296, 2234, 9508, 9542, 2850, 2906, 3088, 3234, 3255, 3263, 3290, 3311, 3319, 7424, 3346, 
+        3367, 3375, 3402, 3423, 3854, 3431, 1059, 8848, 2155, 3924, 2211, 2267, 2352, 2323, 1786, 1107, 
+        1155, 5973, 6010, 6475, 7181, 7430, 9582, 9678, 9748, 9818, 9871, 1842, 5580, 5631, 4160, 2207, 
+        2346, 2263, 3398, 3095, 7485, 4209, 8873, 2319, 7088, 8898, 8923, 3454, 1815, 0, 3286, 7173, 
+        8948, 7177, 3458, 9197, 9372, 2408, 2435, 2491, 2547, 2603, 1820, 6126, 2464, 6704, 286, 2520, 
+        6738, 2659, 2576, 3479, 2715, 3487, 3514, 2771, 2827, 3535, 2883, 9558, 8973, 2939, 8998, 2632, 
+        1203, 1251, 9023, 7236, 4037, 3510, 2375, 2380, 7510, 2431, 2688, 2487, 2744, 2800, 2543, 9265, 
+        4644, 3543, 3570, 3591, 6169, 6212, 2960, 3122, 3145, 3178, 2856, 1729, 9623, 3015, 9048, 4231, 
+        5682, 6386, 2599, 9073, 373, 3566, 3622, 3678, 9333, 6255, 6298, 3599, 3626, 9098, 9123, 3647, 
+        3655, 3682, 3703, 3711, 9148, 3738, 3759, 3815, 3826, 2912, 2968, 3199, 2655, 2711, 2767, 4079, 
+        4108, 3207, 2823, 3734, 3790, 4150, 2879, 2935
+    };
+
+static const int s_TerminalIndex_check[] = {
+        333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 
+        333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 
+        333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, -1, 147, 147, 147, 82, 
+        333, 333, 147, 333, 333, 333, 333, 333, 333, 82, 82, 82, 82, 82, 82, 82, 
+        82, 82, 82, 82, -1, -1, 82, -1, -1, 82, 82, -1, 82, 82, 82, 82, 
+        82, 82, -1, -1, 333, 333, 333, 56, 56, 56, 56, 56, 56, 56, 56, 56, 
+        -1, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 
+        56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 
+        56, 56, -1, 148, 148, 148, 184, 56, 56, 148, 56, 56, 56, 56, 56, 56, 
+        184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 172, 172, 172, 172, 
+        184, 184, -1, 184, 184, 184, 184, 184, 184, -1, -1, 56, 56, 56, 77, 77, 
+        77, 77, 77, 77, 77, 77, 77, -1, 77, 77, 77, 77, 77, 77, 77, 77, 
+        77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 
+        77, 77, 77, 77, 77, 77, 77, 77, 77, 175, 175, 175, 175, 265, 77, 77, 
+        -1, 77, 77, 77, 77, 77, 77, 265, 265, 265, 265, 265, 265, 265, 265, 265, 
+        265, 265, -1, -1, 265, -1, -1, 265, 265, -1, 265, 265, 265, 265, 265, 265, 
+        -1, -1, 77, 77, 77, 92, 92, 92, 92, 92, 92, 92, 92, 92, -1, 92, 
+        92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 
+        92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 
+        239, 239, 239, 239, 350, 92, 92, -1, 92, 92, 92, 92, 92, 92, 350, 350, 
+        350, 350, 350, 350, 350, 350, 350, 350, 350, -1, -1, 350, -1, -1, 350, 350, 
+        -1, 350, 350, 350, 350, 350, 350, -1, -1, 92, 92, 92, 94, 94, 94, 94, 
+        94, 94, 94, 94, 94, -1, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 
+        94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 
+        94, 94, 94, 94, 94, 94, 94, 241, 241, 241, 241, 404, 94, 94, -1, 94, 
+        94, 94, 94, 94, 94, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 
+        404, 243, 243, 243, 243, 404, 404, -1, 404, 404, 404, 404, 404, 404, -1, -1, 
+        94, 94, 94, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, 104, 104, 104, 
+        104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 
+        104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 244, 244, 
+        244, 244, 112, 104, 104, -1, 104, 104, 104, 104, 104, 104, 112, 112, 112, 112, 
+        112, 112, 112, 112, 112, 112, 112, 80, 80, 80, -1, 80, 112, 112, -1, 112, 
+        112, 112, 112, 112, 112, -1, -1, 104, 104, 104, 113, 113, 113, 113, 113, 113, 
+        113, 113, 113, 113, 113, 113, 113, 113, 113, 113, -1, -1, 113, 113, 113, 113, 
+        113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 
+        113, 113, 113, 113, 113, 113, 113, 113, -1, 113, 114, 114, 114, 114, 114, 114, 
+        114, 114, 114, 114, 114, 114, 114, 114, 114, 114, -1, -1, 114, 114, 114, 114, 
+        114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 
+        114, 114, 114, 114, 114, 114, 114, 114, -1, 114, 115, 115, 115, 115, 115, 115, 
+        115, 115, 115, 115, 115, 115, 115, 115, 115, 115, -1, -1, 115, 115, 115, 115, 
+        115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 
+        115, 115, 115, 115, 115, 115, 115, 115, -1, 115, 116, 116, 116, 116, 116, 116, 
+        116, 116, 116, 116, 116, 116, 116, 116, 116, 116, -1, -1, 116, 116, 116, 116, 
+        116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 
+        116, 116, 116, 116, 116, 116, 116, 116, -1, 116, 117, 117, 117, 117, 117, 117, 
+        117, 117, 117, 117, 117, 117, 117, 117, 117, 117, -1, -1, 117, 117, 117, 117, 
+        117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 
+        117, 117, 117, 117, 117, 117, 117, 117, -1, 117, 118, 118, 118, 118, 118, 118, 
+        118, 118, 118, 118, 118, 118, 118, 118, 118, 118, -1, -1, 118, 118, 118, 118, 
+        118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 
+        118, 118, 118, 118, 118, 118, 118, 118, -1, 118, 119, 119, 119, 119, 119, 119, 
+        119, 119, 119, 119, 119, 119, 119, 119, 119, 119, -1, -1, 119, 119, 119, 119, 
+        119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 
+        119, 119, 119, 119, 119, 119, 119, 119, -1, 119, 129, 129, 129, 129, 129, 129, 
+        129, 129, 129, 129, 129, 129, 129, 129, 129, 129, -1, -1, 129, 129, 129, 129, 
+        129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
+        129, 129, 129, 129, 129, 129, 129, 129, -1, 129, 130, 130, 130, 130, 130, 130, 
+        130, 130, 130, 130, 130, 130, 130, 130, 130, 130, -1, -1, 130, 130, 130, 130, 
+        130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
+        130, 130, 130, 130, 130, 130, 130, 130, -1, 130, 131, 131, 131, 131, 131, 131, 
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, -1, -1, 131, 131, 131, 131, 
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 
+        131, 131, 131, 131, 131, 131, 131, 131, -1, 131, 188, 188, 188, 188, 188, 188, 
+        188, 188, 188, 188, 188, 188, 188, 188, 188, 188, -1, -1, 188, 188, 188, 188, 
+        188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 
+        188, 188, 188, 188, 188, 188, 188, 188, -1, 188, 189, 189, 189, 189, 189, 189, 
+        189, 189, 189, 189, 189, 189, 189, 189, 189, 189, -1, -1, 189, 189, 189, 189, 
+        189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 
+        189, 189, 189, 189, 189, 189, 189, 189, -1, 189, 294, 294, 294, 294, 294, 294, 
+        294, 294, 294, 294, 294, 294, 294, 294, 294, 294, -1, -1, 294, 294, 294, 294, 
+        294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 
+        294, 294, 294, 294, 294, 294, 294, 294, -1, 294, 303, 303, 303, 303, 303, 303, 
+        303, 303, 303, 303, 303, 303, 303, 303, 303, 303, -1, -1, 303, 303, 303, 303, 
+        303, 303, 303, 303, 303, 303, 303, 303, 303, 303, 303, 303, 303, 303, 303, 303, 
+        303, 303, 303, 303, 303, 303, 303, 303, -1, 303, 304, 304, 304, 304, 304, 304, 
+        304, 304, 304, 304, 304, 304, 304, 304, 304, 304, -1, -1, 304, 304, 304, 304, 
+        304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 
+        304, 304, 304, 304, 304, 304, 304, 304, -1, 304, 368, 368, 368, 368, 368, 368, 
+        368, 368, 368, 368, 368, 368, 368, 368, 368, 368, -1, -1, 368, 368, 368, 368, 
+        368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 
+        368, 368, 368, 368, 368, 368, 368, 368, -1, 368, 369, 369, 369, 369, 369, 369, 
+        369, 369, 369, 369, 369, 369, 369, 369, 369, 369, -1, -1, 369, 369, 369, 369, 
+        369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 
+        369, 369, 369, 369, 369, 369, 369, 369, -1, 369, 245, 245, 245, 245, -1, 245, 
+        -1, 245, 245, 245, 245, 245, 245, 245, 245, 245, -1, -1, 245, 245, 245, 245, 
+        245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 
+        245, 245, 245, 245, 245, 245, 245, 245, 132, 132, 132, -1, 132, -1, 132, 42, 
+        42, 42, -1, 132, 132, 132, 132, 132, -1, -1, 132, 132, 132, 132, 132, 132, 
+        132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 
+        132, 132, 132, 132, 132, 132, -1, 132, 156, 156, 156, -1, 156, 42, 156, 55, 
+        55, 55, -1, 156, 156, 156, 156, 156, -1, -1, 156, 156, 156, 156, 156, 156, 
+        156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 
+        156, 156, 156, 156, 156, 156, -1, 156, 174, 174, 174, -1, 174, 55, 174, -1, 
+        66, 66, 66, 174, 174, 174, 174, 174, -1, -1, 174, 174, 174, 174, 174, 174, 
+        174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 
+        174, 174, 174, 174, 174, 174, -1, 174, 182, 182, 182, -1, 182, 66, 182, -1, 
+        67, 67, 67, 182, 182, 182, 182, 182, -1, -1, 182, 182, 182, 182, 182, 182, 
+        182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 
+        182, 182, 182, 182, 182, 182, -1, 182, 183, 183, 183, -1, 183, 67, 183, 69, 
+        69, 69, -1, 183, 183, 183, 183, 183, -1, -1, 183, 183, 183, 183, 183, 183, 
+        183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 
+        183, 183, 183, 183, 183, 183, -1, 183, 190, 190, 190, -1, 190, 69, 190, -1, 
+        84, 84, 84, 190, 190, 190, 190, 190, -1, -1, 190, 190, 190, 190, 190, 190, 
+        190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 
+        190, 190, 190, 190, 190, 190, -1, 190, 191, 191, 191, -1, 191, -1, 191, 84, 
+        234, 234, 234, 191, 191, 191, 191, 191, -1, -1, 191, 191, 191, 191, 191, 191, 
+        191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 
+        191, 191, 191, 191, 191, 191, -1, 191, 217, 217, 217, -1, 217, 234, 217, 93, 
+        93, 93, -1, 217, 217, 217, 217, 217, -1, -1, 217, 217, 217, 217, 217, 217, 
+        217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 
+        217, 217, 217, 217, 217, 217, -1, 217, 395, 395, 395, -1, 395, 93, 395, -1, 
+        254, 254, 254, 395, 395, 395, 395, 395, -1, -1, 395, 395, 395, 395, 395, 395, 
+        395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 
+        395, 395, 395, 395, 395, 395, -1, 395, 332, 332, -1, -1, 332, 332, 332, 254, 
+        332, 302, 302, 302, 332, 332, 332, 302, -1, -1, 332, 6, 302, 332, -1, -1, 
+        332, -1, 6, 6, 6, -1, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 
+        332, 332, 332, 346, 346, 346, -1, 332, 332, 346, 332, 332, 332, 332, 332, 332, 
+        248, 248, -1, -1, 248, 248, 248, -1, 248, 315, 315, 315, 248, 248, 248, -1, 
+        6, -1, 248, -1, 315, 248, -1, -1, 248, -1, -1, 332, 332, 332, 248, 248, 
+        248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 315, 237, 237, 237, -1, 248, 
+        248, -1, 248, 248, 248, 248, 248, 248, 249, 249, 60, -1, 249, 249, 249, -1, 
+        249, 60, 60, 60, 249, 249, 249, 107, 107, 107, 249, 107, 237, 249, -1, -1, 
+        249, -1, 107, 248, 248, 248, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 
+        249, 249, 109, 109, 109, -1, 109, 249, 249, -1, 249, 249, 249, 249, 249, 249, 
+        250, 250, 177, -1, 250, 250, 250, -1, 250, 177, 177, 177, 250, 250, 250, 168, 
+        168, 168, 250, 168, -1, 250, -1, -1, 250, -1, 168, 249, 249, 249, 250, 250, 
+        250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 111, 111, 111, -1, 111, 250, 
+        250, -1, 250, 250, 250, 250, 250, 250, 251, 251, 186, -1, 251, 251, 251, -1, 
+        251, 186, 186, 186, 251, 251, 251, 169, 169, 169, 251, 169, -1, 251, -1, -1, 
+        251, -1, 169, 250, 250, 250, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 
+        251, 251, 167, 167, 167, -1, 167, 251, 251, -1, 251, 251, 251, 251, 251, 251, 
+        252, 252, 187, -1, 252, 252, 252, -1, 252, 187, 187, 187, 252, 252, 252, 178, 
+        178, 178, 252, 178, -1, 252, -1, -1, 252, -1, 178, 251, 251, 251, 252, 252, 
+        252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 170, 170, 170, -1, 170, 252, 
+        252, -1, 252, 252, 252, 252, 252, 252, 253, 253, 219, -1, 253, 253, 253, -1, 
+        253, 219, 219, 219, 253, 253, 253, 266, 266, 266, 253, 266, -1, 253, -1, -1, 
+        253, -1, 266, 252, 252, 252, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 
+        253, 253, 296, 296, 296, -1, 296, 253, 253, -1, 253, 253, 253, 253, 253, 253, 
+        319, 319, 240, -1, 319, 319, 319, -1, 319, 240, 240, 240, 319, 319, 319, 270, 
+        270, 270, 319, 270, -1, 319, -1, -1, 319, -1, 270, 253, 253, 253, 319, 319, 
+        319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 298, 298, 298, -1, 298, 319, 
+        319, -1, 319, 319, 319, 319, 319, 319, 321, 321, 274, -1, 321, 321, 321, -1, 
+        321, 274, 274, 274, 321, 321, 321, 271, 271, 271, 321, 271, -1, 321, -1, -1, 
+        321, -1, 271, 319, 319, 319, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 
+        321, 321, 299, 299, 299, -1, 299, 321, 321, -1, 321, 321, 321, 321, 321, 321, 
+        327, 327, -1, -1, 327, 327, 327, -1, 327, 29, 29, 29, 327, 327, 327, 273, 
+        273, 273, 327, 273, -1, 327, -1, -1, 327, -1, 273, 321, 321, 321, 327, 327, 
+        327, 327, 327, 327, 327, 327, 327, 327, 327, 327, 301, 301, 301, -1, 301, 327, 
+        327, -1, 327, 327, 327, 327, 327, 327, 374, 374, -1, -1, 374, 374, 374, -1, 
+        374, 320, 320, 320, 374, 374, 374, 300, 300, 300, 374, 300, -1, 374, -1, -1, 
+        374, -1, 300, 327, 327, 327, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 
+        374, 374, 320, 375, 375, 375, 375, 374, 374, -1, 374, 374, 374, 374, 374, 374, 
+        377, 377, -1, -1, 377, 377, 377, -1, 377, 61, 61, 61, 377, 377, 377, 341, 
+        341, 341, 377, 341, -1, 377, -1, -1, 377, -1, 341, 374, 374, 374, 377, 377, 
+        377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 342, 342, 342, -1, 342, 377, 
+        377, -1, 377, 377, 377, 377, 377, 377, 379, 379, -1, -1, 379, 379, 379, -1, 
+        379, 64, 64, 64, 379, 379, 379, 348, 348, 348, 379, 348, -1, 379, -1, -1, 
+        379, -1, 348, 377, 377, 377, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 
+        379, 379, 343, 343, 343, -1, 343, 379, 379, -1, 379, 379, 379, 379, 379, 379, 
+        382, 382, -1, -1, 382, 382, 382, -1, 382, 75, 75, 75, 382, 382, 382, 351, 
+        351, 351, 382, 351, -1, 382, -1, -1, 382, -1, 351, 379, 379, 379, 382, 382, 
+        382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 344, 344, 344, -1, 344, 382, 
+        382, -1, 382, 382, 382, 382, 382, 382, 402, 402, -1, -1, 402, 402, 402, -1, 
+        402, 78, 78, 78, 402, 402, 402, 354, 354, 354, 402, 354, -1, 402, -1, -1, 
+        402, -1, 354, 382, 382, 382, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 
+        402, 402, 345, 345, 345, -1, 345, 402, 402, -1, 402, 402, 402, 402, 402, 402, 
+        428, 428, -1, -1, 428, 428, 428, -1, 428, 86, 86, 86, 428, 428, 428, 367, 
+        367, 367, 428, 367, -1, 428, -1, -1, 428, -1, 367, 402, 402, 402, 428, 428, 
+        428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 353, 353, 353, -1, 353, 428, 
+        428, -1, 428, 428, 428, 428, 428, 428, 429, 429, -1, -1, 429, 429, 429, -1, 
+        429, 87, 87, 87, 429, 429, 429, 378, 378, 378, 429, 378, -1, 429, -1, -1, 
+        429, -1, 378, 428, 428, 428, 429, 429, 429, 429, 429, 429, 429, 429, 429, 429, 
+        429, 429, 356, 356, 356, -1, 356, 429, 429, -1, 429, 429, 429, 429, 429, 429, 
+        430, 430, -1, -1, 430, 430, 430, -1, 430, 88, 88, 88, 430, 430, 430, 380, 
+        380, 380, 430, 380, -1, 430, -1, -1, 430, -1, 380, 429, 429, 429, 430, 430, 
+        430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 359, 359, 359, -1, 359, 430, 
+        430, -1, 430, 430, 430, 430, 430, 430, 434, 434, -1, -1, 434, 434, 434, -1, 
+        434, 272, 272, 272, 434, 434, 434, 381, 381, 381, 434, 381, -1, 434, -1, -1, 
+        434, -1, 381, 430, 430, 430, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 
+        434, 434, 360, 360, 360, -1, 360, 434, 434, -1, 434, 434, 434, 434, 434, 434, 
+        438, 438, -1, -1, 438, 438, 438, -1, 438, 277, 277, 277, 438, 438, 438, 394, 
+        394, 394, 438, 394, -1, 438, -1, -1, 438, -1, 394, 434, 434, 434, 438, 438, 
+        438, 438, 438, 438, 438, 438, 438, 438, 438, 438, 362, 362, 362, -1, 362, 438, 
+        438, -1, 438, 438, 438, 438, 438, 438, 439, 439, -1, -1, 439, 439, 439, -1, 
+        439, 278, 278, 278, 439, 439, 439, 425, 425, 425, 439, 425, -1, 439, -1, -1, 
+        439, -1, 425, 438, 438, 438, 439, 439, 439, 439, 439, 439, 439, 439, 439, 439, 
+        439, 439, 365, 365, 365, -1, 365, 439, 439, -1, 439, 439, 439, 439, 439, 439, 
+        53, 53, -1, -1, 53, 53, 53, 390, 390, 390, -1, 390, 53, 53, 53, 426, 
+        426, 426, 53, 426, -1, 53, -1, -1, 53, -1, 426, 439, 439, 439, 53, 53, 
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, -1, 236, 236, 236, -1, 53, 
+        53, 166, 53, 53, 53, 53, 53, 53, 166, 166, 166, 166, 166, 166, 397, 397, 
+        397, 397, -1, 166, -1, 166, 155, 155, 155, 120, 120, 397, 397, 397, 120, -1, 
+        120, 155, 120, 53, 53, 53, 120, 120, 236, -1, 120, 120, 120, -1, 120, -1, 
+        -1, 120, 120, 120, 120, -1, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 
+        120, -1, -1, 155, -1, 155, 120, 120, -1, 120, 120, 120, 120, 120, 120, 161, 
+        161, -1, -1, 161, 161, 161, 323, 279, 279, 279, -1, 161, 161, 161, 323, 323, 
+        323, 161, 15, -1, 161, -1, -1, 161, -1, 15, 15, 15, -1, 161, 161, 161, 
+        161, 161, 161, 161, 161, 161, 161, 161, 161, 391, 391, 391, -1, 391, 161, 161, 
+        -1, 161, 161, 161, 161, 161, 161, 247, 247, -1, -1, 247, 247, 247, -1, -1, 
+        392, 392, 392, 247, 247, 247, 392, 15, -1, 247, -1, -1, 247, -1, -1, 247, 
+        -1, -1, 161, 161, 161, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 
+        247, 393, 393, 393, -1, 393, 247, 247, -1, 247, 247, 247, 247, 247, 247, 257, 
+        257, -1, -1, 257, 257, 257, 427, 427, 427, -1, 427, 257, 257, 257, 433, 433, 
+        433, 257, 433, -1, 257, -1, -1, 257, -1, 433, 247, 247, 247, 257, 257, 257, 
+        257, 257, 257, 257, 257, 257, 257, 257, 257, 280, 280, 280, -1, -1, 257, 257, 
+        -1, 257, 257, 257, 257, 257, 257, 334, 334, -1, -1, 334, 334, 334, 281, 281, 
+        281, -1, -1, 334, 334, 334, 282, 282, 282, 334, -1, -1, 334, -1, -1, 334, 
+        -1, -1, 257, 257, 257, 334, 334, 334, 334, 334, 334, 334, 334, 334, 334, 334, 
+        334, 283, 283, 283, -1, -1, 334, 334, -1, 334, 334, 334, 334, 334, 334, 238, 
+        238, -1, -1, 238, 238, 238, 284, 284, 284, -1, -1, 238, 238, 238, 285, 285, 
+        285, 238, -1, -1, 238, -1, -1, 238, -1, -1, 334, 334, 334, 238, 238, 238, 
+        238, 238, 238, 238, 238, 238, 238, 238, 238, 287, 287, 287, -1, -1, 238, 238, 
+        -1, 238, 238, 238, 238, 238, 238, 322, 322, -1, -1, 322, 322, 322, 288, 288, 
+        288, -1, -1, 322, 322, 322, 289, 289, 289, 322, -1, -1, 322, -1, -1, 322, 
+        -1, -1, 238, 238, -1, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 
+        322, 290, 290, 290, -1, -1, 322, 322, -1, 322, 322, 322, 322, 322, 322, 331, 
+        331, -1, -1, 331, 331, 331, 291, 291, 291, -1, -1, 331, 331, 331, 293, 293, 
+        293, 331, -1, -1, 331, -1, -1, 331, -1, -1, 322, 322, -1, 331, 331, 331, 
+        331, 331, 331, 331, 331, 331, 331, 331, 331, 338, 338, 338, -1, -1, 331, 331, 
+        -1, 331, 331, 331, 331, 331, 331, 373, 373, -1, -1, 373, 373, 373, 355, 355, 
+        355, -1, -1, 373, 373, 373, 357, 357, 357, 373, -1, -1, 373, -1, -1, 373, 
+        -1, -1, 331, 331, -1, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 
+        373, 358, 358, 358, -1, -1, 373, 373, -1, 373, 373, 373, 373, 373, 373, 405, 
+        405, -1, -1, 405, 405, 405, 361, 361, 361, -1, -1, 405, 405, 405, 385, 385, 
+        385, 405, -1, -1, 405, -1, -1, 405, -1, -1, 373, 373, -1, 405, 405, 405, 
+        405, 405, 405, 405, 405, 405, 405, 405, 405, 386, 386, 386, -1, -1, 405, 405, 
+        -1, 405, 405, 405, 405, 405, 405, 406, 406, -1, -1, 406, 406, 406, 387, 387, 
+        387, -1, -1, 406, 406, 406, 411, 411, 411, 406, -1, -1, 406, -1, -1, 406, 
+        -1, -1, 405, 405, -1, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 
+        406, 412, 412, 412, -1, -1, 406, 406, -1, 406, 406, 406, 406, 406, 406, 407, 
+        407, -1, -1, 407, 407, 407, 415, 415, 415, -1, -1, 407, 407, 407, 416, 416, 
+        416, 407, -1, -1, 407, -1, -1, 407, -1, -1, 406, 406, -1, 407, 407, 407, 
+        407, 407, 407, 407, 407, 407, 407, 407, 407, 417, 417, 417, -1, -1, 407, 407, 
+        -1, 407, 407, 407, 407, 407, 407, 435, 435, -1, -1, 435, 435, 435, 418, 418, 
+        418, -1, -1, 435, 435, 435, 419, 419, 419, 435, -1, -1, 435, -1, -1, 435, 
+        -1, -1, 407, 407, -1, 435, 435, 435, 435, 435, 435, 435, 435, 435, 435, 435, 
+        435, 421, 421, 421, -1, -1, 435, 435, -1, 435, 435, 435, 435, 435, 435, 436, 
+        436, -1, -1, 436, 436, 436, 422, 422, 422, -1, -1, 436, 436, 436, 85, 85, 
+        85, 436, -1, -1, 436, -1, -1, 436, -1, 85, 435, 435, -1, 436, 436, 436, 
+        436, 436, 436, 436, 436, 436, 436, 436, 436, -1, -1, 256, 256, 256, 436, 436, 
+        74, 436, 436, 436, 436, 436, 436, 74, 74, 74, 74, 74, 74, 85, 423, 423, 
+        423, -1, 74, -1, 41, -1, -1, 41, 41, 424, 424, 424, 41, -1, 41, 41, 
+        41, -1, 436, 436, 41, 41, 41, 37, 41, 41, 256, 41, 41, -1, 41, 41, 
+        41, 41, 41, -1, 41, 292, 292, 292, 292, 292, 292, 41, 41, 41, 41, 41, 
+        41, 37, 292, 37, -1, -1, 41, -1, 41, 39, 37, 37, 37, 37, 37, 37, 
+        39, 39, 39, 39, -1, 37, -1, 37, 17, -1, 49, -1, 41, 49, 49, 17, 
+        17, 17, 49, -1, 49, 49, 49, -1, 41, 41, 49, 49, 49, 51, 49, 49, 
+        -1, 49, 49, -1, 49, 49, 49, 49, 49, -1, 49, 297, 297, 297, 297, 297, 
+        297, 49, 49, 49, 49, 49, 49, 51, 297, 51, -1, -1, 49, 17, 49, 40, 
+        51, 51, 51, 51, 51, 51, 40, 40, 40, 40, -1, 51, -1, 51, 35, -1, 
+        57, -1, 49, 57, 57, 35, 35, 35, 57, -1, 57, 57, 57, -1, 49, 49, 
+        57, 57, 57, 73, 57, 57, -1, 57, 57, -1, 57, 57, 57, 57, 57, -1, 
+        57, -1, -1, 63, 63, 63, -1, 57, 57, 57, 57, 57, 57, 73, 63, 73, 
+        -1, -1, 57, 35, -1, -1, 73, 73, 73, 73, 73, 73, 255, 255, 255, -1, 
+        -1, 73, -1, 73, -1, 63, -1, 59, 57, 57, 59, 59, 372, 372, 372, 59, 
+        63, 59, 59, 59, 57, 57, -1, 59, 59, 59, -1, 59, 59, -1, 59, 59, 
+        -1, 59, 59, 59, 59, 59, -1, 59, -1, 255, 260, 260, 260, -1, 59, 59, 
+        59, 59, 59, 59, -1, 101, 431, 431, 431, 59, -1, 372, 101, 101, 101, 101, 
+        157, 157, 157, -1, 157, -1, 157, -1, -1, 101, -1, 157, -1, -1, 105, 59, 
+        59, 105, 105, 432, 432, 432, 105, 260, 105, 105, 105, 59, 59, 101, 105, 105, 
+        105, 157, 105, 105, -1, 105, 105, -1, 105, 105, 105, 105, 105, 157, 105, 157, 
+        -1, 262, 262, 262, -1, 105, 105, 105, 105, 105, 105, -1, 163, 437, 437, 437, 
+        105, -1, -1, 163, 163, 163, 163, 318, 318, 318, -1, 318, -1, 318, -1, -1, 
+        163, -1, 318, -1, -1, 108, 105, 105, 108, 108, -1, -1, -1, 108, 262, 108, 
+        108, 108, 105, 105, 163, 108, 108, 108, 318, 108, 108, -1, 108, 108, -1, 108, 
+        108, 108, 108, 108, 318, 108, 318, -1, 325, 325, 325, -1, 108, 108, 108, 108, 
+        108, 108, -1, 164, -1, -1, -1, 108, -1, -1, 164, 164, 164, 164, 399, 399, 
+        399, -1, 399, -1, 399, -1, -1, 164, -1, 399, -1, -1, 171, 108, 108, 171, 
+        171, -1, -1, -1, 171, 325, 171, 171, 171, 108, 108, 164, 171, 171, 171, 399, 
+        171, 171, -1, 171, 171, -1, 171, 171, 171, 171, 171, 399, 171, 399, -1, 62, 
+        62, 62, -1, 171, 171, 171, 171, 171, 171, -1, 62, -1, -1, -1, 171, 267, 
+        267, 267, 267, 267, 267, 146, 146, 146, -1, -1, 267, 146, -1, -1, -1, -1, 
+        146, -1, -1, 216, 171, 171, 216, 216, -1, -1, -1, 216, 62, 216, 216, 216, 
+        171, 171, -1, 216, 216, 216, 146, 216, 216, -1, 216, 216, -1, 216, 216, 216, 
+        216, 216, 146, 216, 146, -1, -1, -1, -1, -1, 216, 216, 216, 216, 216, 216, 
+        179, 179, 179, -1, 179, 216, 179, -1, -1, -1, -1, 179, 24, 268, 268, 268, 
+        268, 268, 268, 24, 24, 24, 24, -1, 268, -1, 3, 216, 216, 3, 3, -1, 
+        24, 179, 3, -1, 3, 3, 3, 216, 216, -1, 3, 3, 3, 179, 3, 3, 
+        -1, 3, 3, -1, 3, 3, 3, 3, 3, -1, 3, -1, -1, -1, -1, -1, 
+        24, 3, 3, 3, 3, 3, 3, -1, -1, -1, -1, -1, 3, -1, 3, 4, 
+        -1, -1, 4, 4, -1, -1, -1, 4, -1, 4, 4, 4, -1, -1, -1, 4, 
+        4, 4, 3, 4, 4, -1, 4, 4, -1, 4, 4, 4, 4, 4, 3, 4, 
+        -1, -1, -1, -1, -1, 43, 4, 4, 4, 4, 4, 4, 43, 43, 43, 43, 
+        -1, 4, -1, 4, 5, -1, -1, 5, 5, 43, -1, -1, 5, -1, 5, 5, 
+        5, -1, -1, -1, 5, 5, 5, 4, 5, 5, -1, 5, 5, -1, 5, 5, 
+        5, 5, 5, 4, 5, -1, -1, -1, -1, 43, 44, 5, 5, 5, 5, 5, 
+        5, 44, 44, 44, 44, -1, 5, -1, 5, 8, -1, -1, 8, 8, 44, -1, 
+        -1, 8, -1, 8, 8, 8, -1, -1, -1, 8, 8, 8, 5, 8, 8, -1, 
+        8, 8, -1, 8, 8, 8, 8, 8, 5, 8, -1, -1, -1, -1, 44, 76, 
+        8, 8, 8, 8, 8, 8, 76, 76, 76, 76, -1, 8, -1, 8, 9, -1, 
+        -1, 9, 9, 76, -1, -1, 9, -1, 9, 9, 9, -1, -1, -1, 9, 9, 
+        9, 8, 9, 9, -1, 9, 9, -1, 9, 9, 9, 9, 9, 8, 9, -1, 
+        -1, -1, -1, 76, 384, 9, 9, 9, 9, 9, 9, 384, 384, 384, 384, -1, 
+        9, -1, 9, 10, -1, -1, 10, 10, 384, -1, -1, 10, -1, 10, 10, 10, 
+        -1, -1, -1, 10, 10, 10, 9, 10, 10, -1, 10, 10, 384, 10, 10, 10, 
+        10, 10, 9, 10, -1, -1, -1, -1, -1, 1, 10, 10, 10, 10, 10, 10, 
+        1, 1, 1, 1, -1, 10, -1, 10, 12, -1, -1, 12, 12, 1, -1, -1, 
+        12, -1, 12, 12, 12, -1, -1, -1, 12, 12, 12, 10, 12, 12, -1, 12, 
+        12, -1, 12, 12, 12, 12, 12, 10, 12, -1, -1, -1, -1, -1, 32, 12, 
+        12, 12, 12, 12, 12, 32, 32, 32, 32, -1, 12, -1, 12, 13, -1, -1, 
+        13, 13, 32, -1, -1, 13, -1, 13, 13, 13, -1, -1, -1, 13, 13, 13, 
+        12, 13, 13, -1, 13, 13, -1, 13, 13, 13, 13, 13, 12, 13, -1, -1, 
+        -1, -1, -1, 45, 13, 13, 13, 13, 13, 13, 45, 45, 45, 45, -1, 13, 
+        -1, 13, 18, -1, -1, 18, 18, 45, -1, -1, 18, -1, 18, 18, 18, -1, 
+        -1, -1, 18, 18, 18, 13, 18, 18, -1, 18, 18, -1, 18, 18, 18, 18, 
+        18, 13, 18, -1, -1, -1, -1, -1, 58, 18, 18, 18, 18, 18, 18, 58, 
+        58, 58, 58, -1, 18, -1, 18, 19, -1, -1, 19, 19, 58, -1, -1, 19, 
+        -1, 19, 19, 19, -1, -1, -1, 19, 19, 19, 18, 19, 19, -1, 19, 19, 
+        -1, 19, 19, 19, 19, 19, 18, 19, -1, -1, -1, -1, -1, 159, 19, 19, 
+        19, 19, 19, 19, 159, 159, 159, 159, -1, 19, -1, 19, 20, -1, -1, 20, 
+        20, 159, -1, -1, 20, -1, 20, 20, 20, -1, -1, -1, 20, 20, 20, 19, 
+        20, 20, -1, 20, 20, -1, 20, 20, 20, 20, 20, 19, 20, -1, -1, -1, 
+        -1, -1, 263, 20, 20, 20, 20, 20, 20, 263, 263, 263, 263, -1, 20, -1, 
+        20, 21, -1, -1, 21, 21, 263, -1, -1, 21, -1, 21, 21, 21, -1, -1, 
+        -1, 21, 21, 21, 20, 21, 21, -1, 21, 21, -1, 21, 21, 21, 21, 21, 
+        20, 21, -1, -1, -1, -1, -1, 269, 21, 21, 21, 21, 21, 21, 269, 269, 
+        269, 269, -1, 21, -1, 21, 27, -1, -1, 27, 27, 269, -1, -1, 27, -1, 
+        27, 27, 27, -1, -1, -1, 27, 27, 27, 21, 27, 27, -1, 27, 27, -1, 
+        27, 27, 27, 27, 27, 21, 27, -1, -1, -1, -1, -1, -1, 27, 27, 27, 
+        27, 27, 27, -1, -1, -1, -1, -1, 27, -1, 27, 28, -1, -1, 28, 28, 
+        -1, -1, -1, 28, -1, 28, 28, 28, -1, -1, -1, 28, 28, 28, 27, 28, 
+        28, -1, 28, 28, -1, 28, 28, 28, 28, 28, 27, 28, -1, -1, -1, -1, 
+        -1, -1, 28, 28, 28, 28, 28, 28, -1, -1, -1, -1, -1, 28, -1, 28, 
+        71, -1, -1, 71, 71, -1, -1, -1, 71, -1, 71, 71, 71, -1, -1, -1, 
+        71, 71, 71, 28, 71, 71, -1, 71, 71, -1, 71, 71, 71, 71, 71, 28, 
+        71, -1, -1, -1, -1, -1, -1, 71, 71, 71, 71, 71, 71, -1, -1, -1, 
+        -1, -1, 71, -1, 71, 97, -1, -1, 97, 97, -1, -1, -1, 97, -1, 97, 
+        97, 97, -1, -1, -1, 97, 97, 97, 71, 97, 97, -1, 97, 97, -1, 97, 
+        97, 97, 97, 97, 71, 97, -1, -1, -1, -1, -1, -1, 97, 97, 97, 97, 
+        97, 97, -1, -1, -1, -1, -1, 97, -1, 97, 152, -1, -1, 152, 152, -1, 
+        -1, -1, 152, -1, 152, 152, 152, -1, -1, -1, 152, 152, 152, 97, 152, 152, 
+        -1, 152, 152, -1, 152, 152, 152, 152, 152, 97, 152, -1, -1, -1, -1, -1, 
+        -1, 152, 152, 152, 152, 152, 152, -1, -1, -1, -1, -1, 152, -1, 152, 162, 
+        -1, -1, 162, 162, -1, -1, -1, 162, -1, 162, 162, 162, -1, -1, -1, 162, 
+        162, 162, 152, 162, 162, -1, 162, 162, -1, 162, 162, 162, 162, 162, 152, 162, 
+        -1, -1, -1, -1, -1, -1, 162, 162, 162, 162, 162, 162, -1, -1, -1, -1, 
+        -1, 162, -1, 162, 2, -1, -1, 2, 2, -1, -1, -1, 2, -1, 2, 2, 
+        2, -1, -1, -1, 2, 2, 2, 162, 2, 2, -1, 2, 2, -1, 2, 2, 
+        2, 2, 2, 162, 2, -1, -1, 151, 151, 151, -1, 2, 2, 2, 2, 2, 
+        2, -1, 151, -1, -1, -1, 2, 7, 2, -1, 7, 7, -1, -1, -1, 7, 
+        -1, 7, 7, 7, -1, -1, -1, 7, 7, 7, -1, 7, 7, -1, 7, 7, 
+        -1, 7, 7, 7, 7, 7, 151, 7, 2, -1, 153, 153, 153, -1, 7, 7, 
+        7, 7, 7, 7, -1, 153, -1, -1, -1, 7, 11, 7, -1, 11, 11, -1, 
+        -1, -1, 11, -1, 11, 11, 11, -1, -1, -1, 11, 11, 11, -1, 11, 11, 
+        -1, 11, 11, -1, 11, 11, 11, 11, 11, 153, 11, 7, -1, 218, 218, 218, 
+        -1, 11, 11, 11, 11, 11, 11, -1, 218, -1, -1, -1, 11, 14, 11, -1, 
+        14, 14, -1, -1, -1, 14, -1, 14, 14, 14, -1, -1, -1, 14, 14, 14, 
+        -1, 14, 14, -1, 14, 14, -1, 14, 14, 14, 14, 14, 218, 14, 11, -1, 
+        220, 220, 220, -1, 14, 14, 14, 14, 14, 14, -1, 220, -1, -1, -1, 14, 
+        16, 14, -1, 16, 16, -1, -1, -1, 16, -1, 16, 16, 16, -1, -1, -1, 
+        16, 16, 16, -1, 16, 16, -1, 16, 16, -1, 16, 16, 16, 16, 16, 220, 
+        16, 14, -1, 316, 316, 316, -1, 16, 16, 16, 16, 16, 16, -1, 316, -1, 
+        -1, -1, 16, 22, 16, -1, 22, 22, -1, -1, -1, 22, -1, 22, 22, 22, 
+        -1, -1, -1, 22, 22, 22, -1, 22, 22, -1, 22, 22, -1, 22, 22, 22, 
+        22, 22, 316, 22, 16, -1, 317, 317, 317, -1, 22, 22, 22, 22, 22, 22, 
+        -1, 317, -1, -1, -1, 22, 25, 22, -1, 25, 25, -1, -1, -1, 25, -1, 
+        25, 25, 25, -1, -1, -1, 25, 25, 25, -1, 25, 25, -1, 25, 25, -1, 
+        25, 25, 25, 25, 25, 317, 25, 22, -1, 400, 400, 400, -1, 25, 25, 25, 
+        25, 25, 25, -1, 400, -1, -1, -1, 25, 26, 25, -1, 26, 26, -1, -1, 
+        -1, 26, -1, 26, 26, 26, -1, -1, -1, 26, 26, 26, -1, 26, 26, -1, 
+        26, 26, -1, 26, 26, 26, 26, 26, 400, 26, 25, -1, -1, -1, -1, -1, 
+        26, 26, 26, 26, 26, 26, -1, -1, -1, -1, -1, 26, 34, 26, -1, 34, 
+        34, -1, -1, -1, 34, -1, 34, 34, 34, -1, -1, -1, 34, 34, 34, -1, 
+        34, 34, -1, 34, 34, -1, 34, 34, 34, 34, 34, -1, 34, 26, -1, -1, 
+        -1, -1, -1, 34, 34, 34, 34, 34, 34, -1, -1, -1, -1, -1, 34, 36, 
+        34, -1, 36, 36, -1, -1, -1, 36, -1, 36, 36, 36, -1, -1, -1, 36, 
+        36, 36, -1, 36, 36, -1, 36, 36, -1, 36, 36, 36, 36, 36, -1, 36, 
+        34, -1, -1, -1, -1, -1, 36, 36, 36, 36, 36, 36, -1, -1, -1, -1, 
+        -1, 36, 48, 36, -1, 48, 48, -1, -1, -1, 48, -1, 48, 48, 48, -1, 
+        -1, -1, 48, 48, 48, -1, 48, 48, -1, 48, 48, -1, 48, 48, 48, 48, 
+        48, -1, 48, 36, -1, -1, -1, -1, -1, 48, 48, 48, 48, 48, 48, 133, 
+        133, 133, -1, 133, 48, 133, 48, -1, -1, -1, 133, 133, 133, 133, 133, -1, 
+        -1, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 
+        133, -1, -1, -1, -1, -1, 48, 136, 136, 136, -1, 136, 133, 136, 133, -1, 
+        -1, -1, 136, 136, 136, 136, 136, -1, -1, 136, 136, 136, 136, 136, 136, 136, 
+        136, 136, 136, 136, 136, 136, 136, 136, 136, -1, -1, -1, 305, 305, 305, -1, 
+        305, -1, 305, -1, 136, -1, 136, 305, 305, 305, 305, 305, -1, -1, 305, 305, 
+        305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, -1, -1, 
+        -1, 306, 306, 306, -1, 306, -1, 306, -1, 305, -1, 305, 306, 306, 306, 306, 
+        306, -1, -1, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 
+        306, 306, 306, -1, -1, -1, -1, 264, -1, -1, 264, 264, -1, -1, 306, 264, 
+        306, 264, 264, 264, -1, -1, -1, 264, 264, 264, -1, 264, 264, -1, 264, 264, 
+        -1, 264, 264, 264, 264, 264, -1, 264, -1, -1, -1, -1, -1, -1, 264, 264, 
+        264, 264, 264, 264, 0, -1, -1, 0, 0, -1, -1, 264, 0, -1, 0, 0, 
+        0, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 
+        0, 0, 0, -1, 0, 347, 347, 347, 347, 347, 347, 0, 0, 0, 0, 23, 
+        347, -1, 23, 23, -1, -1, -1, 23, 0, 23, 23, 23, -1, -1, -1, 23, 
+        23, 23, -1, 23, 23, -1, 23, 23, -1, 23, 23, 23, 23, 23, -1, 23, 
+        388, 388, 388, 388, 388, 388, 23, 23, 23, 23, 30, 388, -1, 30, 30, -1, 
+        -1, -1, 30, 23, 30, 30, 30, -1, -1, -1, 30, 30, 30, -1, 30, 30, 
+        -1, 30, 30, -1, 30, 30, 30, 30, 30, -1, 30, 389, 389, 389, 389, 389, 
+        389, 30, 30, 30, 30, 31, 389, -1, 31, 31, -1, -1, -1, 31, 30, 31, 
+        31, 31, -1, -1, -1, 31, 31, 31, -1, 31, 31, -1, 31, 31, -1, 31, 
+        31, 31, 31, 31, -1, 31, 409, 409, 409, 409, 409, 409, 31, 31, 31, 31, 
+        33, 409, -1, 33, 33, -1, -1, -1, 33, 31, 33, 33, 33, -1, -1, -1, 
+        33, 33, 33, -1, 33, 33, -1, 33, 33, -1, 33, 33, 33, 33, 33, -1, 
+        33, 410, 410, 410, 410, 410, 410, 33, 33, 33, 33, 47, 410, -1, 47, 47, 
+        -1, -1, -1, 47, 33, 47, 47, 47, -1, -1, -1, 47, 47, 47, -1, 47, 
+        47, -1, 47, 47, -1, 47, 47, 47, 47, 47, -1, 47, -1, 83, 83, 83, 
+        -1, -1, 47, 47, 47, 47, 95, -1, 83, 95, 95, -1, -1, -1, 95, 47, 
+        95, 95, 95, -1, -1, -1, 95, 95, 95, -1, 95, 95, -1, 95, 95, 83, 
+        95, 95, 95, 95, 95, -1, 95, -1, -1, 401, 401, 401, 83, 95, 95, 95, 
+        95, 137, 137, 137, 401, 137, -1, 137, -1, -1, 95, -1, 137, 137, -1, 137, 
+        137, -1, -1, -1, -1, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 
+        137, 137, 137, -1, -1, -1, 401, 160, 401, -1, 160, 160, -1, -1, 137, 160, 
+        137, 160, 160, 160, -1, -1, -1, 160, 160, 160, -1, 160, 160, -1, 160, 160, 
+        -1, 160, 160, 160, 160, 160, -1, 160, -1, -1, 65, 65, 65, -1, 160, 160, 
+        160, 160, 307, 307, 307, 65, 307, -1, 307, -1, -1, 160, -1, 307, 307, -1, 
+        307, 307, -1, -1, -1, -1, 307, 307, 307, 307, 307, 307, 307, 307, 307, 307, 
+        307, 307, 307, 307, -1, -1, -1, 65, 38, -1, -1, 38, 38, -1, -1, 307, 
+        38, 307, 38, 38, 38, -1, -1, -1, 38, 38, 38, -1, 38, 38, -1, 38, 
+        38, -1, 38, 38, 38, 38, 38, -1, 38, -1, 46, -1, -1, 46, 46, 38, 
+        38, 38, 46, -1, 46, 46, 46, -1, -1, -1, 46, 46, 46, -1, 46, 46, 
+        -1, 46, 46, -1, 46, 46, 46, 46, 46, -1, 46, 246, 246, 246, -1, 246, 
+        -1, 46, 46, 46, 68, -1, 246, 68, 68, -1, -1, -1, 68, 38, 68, 68, 
+        68, -1, -1, -1, 68, 68, 68, -1, 68, 68, -1, 68, 68, -1, 68, 68, 
+        68, 68, 68, -1, 68, -1, 81, -1, 246, 81, 81, 68, 68, 68, 81, 46, 
+        81, 81, 81, -1, -1, -1, 81, 81, 81, -1, 81, 81, -1, 81, 81, -1, 
+        81, 81, 81, 81, 81, -1, 81, 90, 90, 90, -1, -1, -1, 81, 81, 81, 
+        349, 81, 90, 349, 349, -1, -1, -1, 349, 68, 349, 349, 349, -1, -1, -1, 
+        349, 349, 349, -1, 349, 349, -1, 349, 349, -1, 349, 349, 349, 349, 349, -1, 
+        349, -1, 352, -1, 90, 352, 352, 349, 349, 349, 352, 349, 352, 352, 352, -1, 
+        -1, -1, 352, 352, 352, -1, 352, 352, -1, 352, 352, -1, 352, 352, 352, 352, 
+        352, -1, 352, -1, 52, -1, -1, 52, 52, 352, 352, 352, 52, -1, 52, 52, 
+        52, -1, -1, -1, 52, 52, 52, -1, 52, 52, -1, 52, 52, -1, 52, 52, 
+        52, 52, 52, -1, 52, -1, 54, -1, -1, 54, 54, 52, 52, 52, 54, -1, 
+        54, 54, 54, -1, -1, -1, 54, 54, 54, 352, 54, 54, -1, 54, 54, -1, 
+        54, 54, 54, 54, 54, -1, 54, -1, 79, -1, -1, 79, 79, 54, 54, 54, 
+        79, -1, 79, 79, 79, -1, -1, -1, 79, 79, 79, -1, 79, 79, -1, 79, 
+        79, -1, 79, 79, 79, 79, 79, -1, 79, -1, 259, 259, 259, 98, 98, 79, 
+        79, 79, 98, -1, 98, 259, 98, -1, -1, -1, 98, 98, -1, -1, 98, 98, 
+        -1, -1, 98, -1, -1, 98, 98, 98, 98, -1, 98, 259, -1, 91, 91, 91, 
+        -1, 98, 98, 98, 98, 98, 98, 259, 91, -1, -1, 99, 99, -1, 98, -1, 
+        99, -1, 99, -1, 99, -1, -1, -1, 99, 99, -1, -1, 99, 99, -1, -1, 
+        99, -1, 98, 99, 99, 99, 99, -1, 99, -1, 91, 158, 158, 158, -1, 99, 
+        99, 99, 99, 99, 99, -1, 158, -1, -1, 102, 102, -1, 99, -1, 102, -1, 
+        102, -1, 102, -1, -1, -1, 102, 102, -1, -1, 102, 102, -1, -1, 102, -1, 
+        99, 102, 102, 102, 102, -1, 102, -1, 158, 233, 233, 233, -1, 102, 102, 102, 
+        102, 102, 102, -1, 233, -1, -1, 103, 103, -1, 102, -1, 103, -1, 103, -1, 
+        103, -1, -1, -1, 103, 103, -1, -1, 103, 103, -1, -1, 103, -1, 102, 103, 
+        103, 103, 103, -1, 103, -1, 233, 261, 261, 261, -1, 103, 103, 103, 103, 103, 
+        103, -1, 261, 106, -1, -1, 106, 106, 103, -1, -1, 106, -1, 106, 106, 106, 
+        -1, -1, -1, 106, 106, 106, -1, 106, 106, -1, 106, 106, 103, 106, 106, 106, 
+        106, 106, -1, 106, 261, 110, -1, -1, 110, 110, 106, 106, 106, 110, -1, 110, 
+        110, 110, -1, -1, -1, 110, 110, 110, -1, 110, 110, -1, 110, 110, -1, 110, 
+        110, 110, 110, 110, -1, 110, -1, 328, 328, 328, -1, -1, 110, 110, 110, 138, 
+        138, 138, 328, 138, -1, 138, -1, -1, -1, -1, 138, 138, -1, -1, -1, -1, 
+        -1, -1, -1, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 
+        138, -1, 165, 165, 328, -1, -1, 165, -1, 165, -1, 165, 138, -1, 138, 165, 
+        165, -1, -1, 165, 165, -1, -1, 165, -1, -1, 165, 165, 165, 165, -1, 165, 
+        -1, -1, -1, -1, -1, -1, 165, 165, 165, 165, 165, 165, 335, 335, 335, -1, 
+        337, 337, 337, 165, 308, 308, 308, 335, 308, -1, 308, 337, -1, -1, -1, 308, 
+        308, -1, -1, -1, -1, -1, -1, 165, 308, 308, 308, 308, 308, 308, 308, 308, 
+        308, 308, 308, 308, 308, 308, -1, -1, -1, 335, 371, -1, -1, 337, -1, -1, 
+        -1, 308, -1, 308, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, -1, 
+        -1, -1, -1, 89, 371, 371, -1, 371, 371, 371, 371, 371, 371, 89, 89, 89, 
+        89, 89, 89, 89, 89, 89, 89, 89, -1, -1, -1, -1, -1, 89, 89, -1, 
+        89, 89, 89, 89, 89, 89, -1, -1, -1, 371, 371, -1, -1, 139, 139, 139, 
+        -1, 139, -1, 139, -1, -1, -1, -1, 139, 139, -1, -1, -1, -1, -1, -1, 
+        -1, -1, 89, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, -1, 
+        -1, -1, -1, 154, -1, -1, -1, -1, -1, -1, 139, -1, 139, 154, 154, 154, 
+        154, 154, 154, 154, 154, 154, 154, 154, -1, -1, -1, -1, 242, 154, 154, -1, 
+        154, 154, 154, 154, 154, 154, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 
+        242, -1, -1, -1, -1, -1, 242, 242, -1, 242, 242, 242, 242, 242, 242, -1, 
+        -1, -1, 154, 286, 286, -1, -1, -1, 286, -1, 286, -1, 286, -1, -1, -1, 
+        286, 286, -1, -1, 286, 286, -1, -1, 286, -1, 242, 286, 286, 286, 286, -1, 
+        -1, -1, -1, -1, -1, -1, -1, 286, 286, 286, 286, 286, 286, 309, 309, 309, 
+        -1, 309, -1, 309, 286, -1, -1, -1, 309, 309, -1, -1, -1, -1, -1, -1, 
+        -1, -1, -1, 309, 309, 309, 309, 309, 309, 309, 309, 309, 309, 309, 309, -1, 
+        -1, -1, -1, 324, -1, -1, -1, -1, -1, -1, 309, -1, 309, 324, 324, 324, 
+        324, 324, 324, 324, 324, 324, 324, 324, -1, -1, -1, -1, 376, 324, 324, -1, 
+        324, 324, 324, 324, 324, 324, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 
+        376, -1, -1, -1, -1, -1, 376, 376, -1, 376, 376, 376, 376, 376, 376, -1, 
+        -1, 324, 121, -1, -1, -1, -1, -1, -1, -1, -1, -1, 121, 121, 121, 121, 
+        121, 121, 121, 121, 121, 121, 121, -1, -1, -1, 376, 122, 121, 121, -1, 121, 
+        121, 121, 121, 121, 121, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 
+        -1, -1, -1, -1, 123, 122, 122, -1, 122, 122, 122, 122, 122, 122, 123, 123, 
+        123, 123, 123, 123, 123, 123, 123, 123, 123, -1, -1, -1, -1, 124, 123, 123, 
+        -1, 123, 123, 123, 123, 123, 123, 124, 124, 124, 124, 124, 124, 124, 124, 124, 
+        124, 124, -1, -1, -1, -1, 125, 124, 124, -1, 124, 124, 124, 124, 124, 124, 
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, -1, -1, -1, -1, 126, 
+        125, 125, -1, 125, 125, 125, 125, 125, 125, 126, 126, 126, 126, 126, 126, 126, 
+        126, 126, 126, 126, -1, -1, -1, -1, 127, 126, 126, -1, 126, 126, 126, 126, 
+        126, 126, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, -1, -1, -1, 
+        -1, 128, 127, 127, -1, 127, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 
+        128, 128, 128, 128, 128, 128, -1, -1, -1, -1, 134, 128, 128, -1, 128, 128, 
+        128, 128, 128, 128, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, -1, 
+        -1, -1, -1, 135, 134, 134, -1, 134, 134, 134, 134, 134, 134, 135, 135, 135, 
+        135, 135, 135, 135, 135, 135, 135, 135, -1, -1, -1, -1, 149, 135, 135, -1, 
+        135, 135, 135, 135, 135, 135, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 
+        149, -1, -1, -1, -1, 150, 149, 149, -1, 149, 149, 149, 149, 149, 149, 150, 
+        150, 150, 150, 150, 150, 150, 150, 150, 150, 150, -1, -1, -1, -1, 173, 150, 
+        150, -1, 150, 150, 150, 150, 150, 150, 173, 173, 173, 173, 173, 173, 173, 173, 
+        173, 173, 173, -1, -1, -1, -1, 185, 173, 173, -1, 173, 173, 173, 173, 173, 
+        173, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, -1, -1, -1, -1, 
+        192, 185, 185, -1, 185, 185, 185, 185, 185, 185, 192, 192, 192, 192, 192, 192, 
+        192, 192, 192, 192, 192, -1, -1, -1, -1, 193, 192, 192, -1, 192, 192, 192, 
+        192, 192, 192, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, -1, -1, 
+        -1, -1, 194, 193, 193, -1, 193, 193, 193, 193, 193, 193, 194, 194, 194, 194, 
+        194, 194, 194, 194, 194, 194, 194, -1, -1, -1, -1, 195, 194, 194, -1, 194, 
+        194, 194, 194, 194, 194, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 
+        -1, -1, -1, -1, 196, 195, 195, -1, 195, 195, 195, 195, 195, 195, 196, 196, 
+        196, 196, 196, 196, 196, 196, 196, 196, 196, -1, -1, -1, -1, 197, 196, 196, 
+        -1, 196, 196, 196, 196, 196, 196, 197, 197, 197, 197, 197, 197, 197, 197, 197, 
+        197, 197, -1, -1, -1, -1, 198, 197, 197, -1, 197, 197, 197, 197, 197, 197, 
+        198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, -1, -1, -1, -1, 199, 
+        198, 198, -1, 198, 198, 198, 198, 198, 198, 199, 199, 199, 199, 199, 199, 199, 
+        199, 199, 199, 199, -1, -1, -1, -1, 200, 199, 199, -1, 199, 199, 199, 199, 
+        199, 199, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, -1, -1, -1, 
+        -1, 201, 200, 200, -1, 200, 200, 200, 200, 200, 200, 201, 201, 201, 201, 201, 
+        201, 201, 201, 201, 201, 201, -1, -1, -1, -1, 202, 201, 201, -1, 201, 201, 
+        201, 201, 201, 201, 202, 202, 202, 202, 202, 202, 202, 202, 202, 202, 202, -1, 
+        -1, -1, -1, 203, 202, 202, -1, 202, 202, 202, 202, 202, 202, 203, 203, 203, 
+        203, 203, 203, 203, 203, 203, 203, 203, -1, -1, -1, -1, 204, 203, 203, -1, 
+        203, 203, 203, 203, 203, 203, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 
+        204, -1, -1, -1, -1, 205, 204, 204, -1, 204, 204, 204, 204, 204, 204, 205, 
+        205, 205, 205, 205, 205, 205, 205, 205, 205, 205, -1, -1, -1, -1, 206, 205, 
+        205, -1, 205, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 206, 206, 206, 
+        206, 206, 206, -1, -1, -1, -1, 207, 206, 206, -1, 206, 206, 206, 206, 206, 
+        206, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, -1, -1, -1, -1, 
+        208, 207, 207, -1, 207, 207, 207, 207, 207, 207, 208, 208, 208, 208, 208, 208, 
+        208, 208, 208, 208, 208, -1, -1, -1, -1, 209, 208, 208, -1, 208, 208, 208, 
+        208, 208, 208, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, -1, -1, 
+        -1, -1, 210, 209, 209, -1, 209, 209, 209, 209, 209, 209, 210, 210, 210, 210, 
+        210, 210, 210, 210, 210, 210, 210, -1, -1, -1, -1, 211, 210, 210, -1, 210, 
+        210, 210, 210, 210, 210, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 
+        -1, -1, -1, -1, 212, 211, 211, -1, 211, 211, 211, 211, 211, 211, 212, 212, 
+        212, 212, 212, 212, 212, 212, 212, 212, 212, -1, -1, -1, -1, 213, 212, 212, 
+        -1, 212, 212, 212, 212, 212, 212, 213, 213, 213, 213, 213, 213, 213, 213, 213, 
+        213, 213, -1, -1, -1, -1, 214, 213, 213, -1, 213, 213, 213, 213, 213, 213, 
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, -1, -1, -1, -1, 215, 
+        214, 214, -1, 214, 214, 214, 214, 214, 214, 215, 215, 215, 215, 215, 215, 215, 
+        215, 215, 215, 215, -1, -1, -1, -1, 221, 215, 215, -1, 215, 215, 215, 215, 
+        215, 215, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, -1, -1, -1, 
+        -1, 222, 221, 221, -1, 221, 221, 221, 221, 221, 221, 222, 222, 222, 222, 222, 
+        222, 222, 222, 222, 222, 222, -1, -1, -1, -1, 223, 222, 222, -1, 222, 222, 
+        222, 222, 222, 222, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, -1, 
+        -1, -1, -1, 224, 223, 223, -1, 223, 223, 223, 223, 223, 223, 224, 224, 224, 
+        224, 224, 224, 224, 224, 224, 224, 224, -1, -1, -1, -1, 225, 224, 224, -1, 
+        224, 224, 224, 224, 224, 224, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 
+        225, -1, -1, -1, -1, 226, 225, 225, -1, 225, 225, 225, 225, 225, 225, 226, 
+        226, 226, 226, 226, 226, 226, 226, 226, 226, 226, -1, -1, -1, -1, 227, 226, 
+        226, -1, 226, 226, 226, 226, 226, 226, 227, 227, 227, 227, 227, 227, 227, 227, 
+        227, 227, 227, -1, -1, -1, -1, 228, 227, 227, -1, 227, 227, 227, 227, 227, 
+        227, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, -1, -1, -1, -1, 
+        229, 228, 228, -1, 228, 228, 228, 228, 228, 228, 229, 229, 229, 229, 229, 229, 
+        229, 229, 229, 229, 229, -1, -1, -1, -1, 230, 229, 229, -1, 229, 229, 229, 
+        229, 229, 229, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, -1, -1, 
+        -1, -1, 231, 230, 230, -1, 230, 230, 230, 230, 230, 230, 231, 231, 231, 231, 
+        231, 231, 231, 231, 231, 231, 231, -1, -1, -1, -1, 232, 231, 231, -1, 231, 
+        231, 231, 231, 231, 231, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 
+        -1, -1, -1, -1, 235, 232, 232, -1, 232, 232, 232, 232, 232, 232, 235, 235, 
+        235, 235, 235, 235, 235, 235, 235, 235, 235, -1, -1, -1, -1, 258, 235, 235, 
+        -1, 235, 235, 235, 235, 235, 235, 258, 258, 258, 258, 258, 258, 258, 258, 258, 
+        258, 258, -1, -1, -1, -1, 295, 258, 258, -1, 258, 258, 258, 258, 258, 258, 
+        295, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295, -1, -1, -1, -1, 326, 
+        295, 295, -1, 295, 295, 295, 295, 295, 295, 326, 326, 326, 326, 326, 326, 326, 
+        326, 326, 326, 326, -1, -1, -1, -1, 329, 326, 326, -1, 326, 326, 326, 326, 
+        326, 326, 329, 329, 329, 329, 329, 329, 329, 329, 329, 329, 329, -1, -1, -1, 
+        -1, 330, 329, 329, -1, 329, 329, 329, 329, 329, 329, 330, 330, 330, 330, 330, 
+        330, 330, 330, 330, 330, 330, -1, -1, -1, -1, 336, 330, 330, -1, 330, 330, 
+        330, 330, 330, 330, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, -1, 
+        -1, -1, -1, 364, 336, 336, -1, 336, 336, 336, 336, 336, 336, 364, 364, 364, 
+        364, 364, 364, 364, 364, 364, 364, 364, -1, -1, -1, -1, 366, 364, 364, -1, 
+        364, 364, 364, 364, 364, 364, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 
+        366, -1, -1, -1, -1, 370, 366, 366, -1, 366, 366, 366, 366, 366, 366, 370, 
+        370, 370, 370, 370, 370, 370, 370, 370, 370, 370, -1, -1, -1, -1, 398, 370, 
+        370, -1, 370, 370, 370, 370, 370, 370, 398, 398, 398, 398, 398, 398, 398, 398, 
+        398, 398, 398, -1, -1, -1, -1, 403, 398, 398, -1, 398, 398, 398, 398, 398, 
+        398, 403, 403, 403, 403, 403, 403, 403, 403, 403, 403, 403, -1, -1, -1, -1, 
+        413, 403, 403, -1, 403, 403, 403, 403, 403, 403, 413, 413, 413, 413, 413, 413, 
+        413, 413, 413, 413, 413, -1, -1, -1, -1, 414, 413, 413, -1, 413, 413, 413, 
+        413, 413, 413, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, -1, -1, 
+        -1, -1, 420, 414, 414, -1, 414, 414, 414, 414, 414, 414, 420, 420, 420, 420, 
+        420, 420, 420, 420, 420, 420, 420, -1, -1, -1, -1, -1, 420, 420, -1, 420, 
+        420, 420, 420, 420, 420, 50, 50, -1, -1, -1, 50, -1, 50, -1, 50, -1, 
+        -1, -1, 50, 50, -1, -1, 50, 50, -1, -1, 50, -1, -1, 50, 50, 50, 
+        50, -1, 50, -1, 339, 339, 339, 70, 70, 50, 50, 50, 70, -1, 70, 339, 
+        70, -1, -1, -1, 70, 70, -1, -1, 70, 70, -1, -1, 70, -1, -1, 70, 
+        70, 70, 70, -1, 70, -1, -1, -1, -1, 72, 72, 70, 70, 70, 72, -1, 
+        72, 339, 72, -1, -1, -1, 72, 72, 50, -1, 72, 72, -1, -1, 72, -1, 
+        -1, 72, 72, 72, 72, -1, 72, -1, 383, 383, 383, 96, 96, 72, 72, 72, 
+        96, -1, 96, 383, 96, -1, -1, -1, 96, 96, 70, -1, 96, 96, -1, -1, 
+        96, -1, -1, 96, 96, 96, 96, -1, 96, -1, -1, -1, -1, 100, 100, 96, 
+        96, 96, 100, -1, 100, 383, 100, -1, -1, -1, 100, 100, 72, -1, 100, 100, 
+        -1, -1, 100, -1, -1, 100, 100, 100, 100, -1, 100, -1, 408, 408, 408, 340, 
+        340, 100, 100, 100, 340, -1, 340, 408, 340, -1, -1, -1, 340, 340, 96, -1, 
+        340, 340, -1, -1, 340, -1, -1, 340, 340, 340, 340, -1, 340, -1, -1, -1, 
+        -1, 176, 176, 340, 340, 340, 176, -1, 176, 408, 176, -1, -1, -1, 176, 176, 
+        100, -1, 176, 176, -1, -1, 176, -1, -1, 176, 176, 176, 176, -1, 176, -1, 
+        -1, -1, -1, 180, 180, 176, 176, 176, 180, -1, 180, -1, 180, -1, -1, -1, 
+        180, 180, 340, -1, 180, 180, -1, -1, 180, -1, -1, 180, 180, 180, 180, -1, 
+        180, -1, -1, -1, -1, 181, 181, 180, 180, 180, 181, -1, 181, -1, 181, -1, 
+        -1, -1, 181, 181, -1, -1, 181, 181, -1, -1, 181, -1, -1, 181, 181, 181, 
+        181, -1, 181, -1, -1, -1, -1, 275, 275, 181, 181, 181, 275, -1, 275, -1, 
+        275, -1, -1, -1, 275, 275, -1, -1, 275, 275, -1, -1, 275, -1, -1, 275, 
+        275, 275, 275, -1, 275, -1, -1, -1, -1, 276, 276, 275, 275, 275, 276, -1, 
+        276, -1, 276, -1, -1, -1, 276, 276, -1, -1, 276, 276, -1, -1, 276, -1, 
+        -1, 276, 276, 276, 276, -1, 276, -1, -1, -1, -1, -1, -1, 276, 276, 276, 
+        140, 140, 140, -1, 140, -1, 140, -1, -1, -1, -1, 140, 140, 363, 363, 363, 
+        -1, 363, -1, 363, -1, -1, -1, -1, 363, -1, 140, 140, 140, 140, 140, 140, 
+        140, 140, -1, -1, -1, 310, 310, 310, -1, 310, -1, 310, -1, 140, 363, 140, 
+        310, 310, -1, -1, -1, -1, -1, -1, -1, -1, 363, -1, -1, 396, -1, 310, 
+        310, 310, 310, 310, 310, 310, 310, 396, 396, 396, 396, 396, 396, 396, 396, 396, 
+        396, -1, 310, -1, 310, -1, -1, 396, 396, -1, 396, -1, -1, -1, 396, 396, 
+        141, 141, 141, -1, 141, -1, 141, -1, -1, -1, -1, 141, 141, -1, -1, -1, 
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 141, 141, 141, 141, 
+        141, 141, -1, -1, -1, 311, 311, 311, -1, 311, -1, 311, -1, 141, -1, 141, 
+        311, 311, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 
+        -1, 311, 311, 311, 311, 311, 311, -1, 142, 142, 142, -1, 142, -1, 142, -1, 
+        -1, -1, 311, 142, 311, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 
+        -1, -1, -1, -1, 142, 142, 142, 142, 142, 142, -1, 312, 312, 312, -1, 312, 
+        -1, 312, -1, -1, -1, 142, 312, 142, -1, -1, -1, -1, -1, -1, -1, -1, 
+        -1, -1, -1, -1, -1, -1, -1, 312, 312, 312, 312, 312, 312, -1, 143, 143, 
+        143, -1, 143, -1, 143, -1, -1, -1, 312, 143, 312, -1, -1, -1, -1, -1, 
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 143, 143, 143, 143, 143, 
+        -1, 313, 313, 313, -1, 313, -1, 313, -1, -1, -1, 143, 313, 143, -1, -1, 
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 313, 313, 
+        313, 313, 313, -1, 144, 144, 144, -1, 144, -1, 144, -1, -1, -1, 313, 144, 
+        313, -1, -1, -1, -1, -1, 314, 314, 314, -1, 314, -1, 314, -1, -1, -1, 
+        -1, 314, 144, 144, 144, 144, -1, 145, 145, 145, -1, 145, -1, 145, -1, -1, 
+        -1, 144, 145, 144, 314, 314, 314, 314, -1, -1, -1, -1, -1, -1, -1, -1, 
+        -1, -1, -1, 314, -1, 314, 145, 145, 145, -1, -1, -1, -1, -1, -1, -1, 
+        -1, -1, -1, -1, 145, -1, 145
+    };
+
+static const int s_TerminalIndex_offset[] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 
+        32, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 0, 0, 1, 2, 0, 
+        45, 46, 3, 47, 48, 50, 51, 52, 53, 1, 2, 3, 4, 5, 6, 7, 
+        8, 9, 10, 11, 0, 0, 12, 0, 0, 13, 14, 0, 15, 16, 17, 18, 
+        19, 20, 0, 0, 54, 55, 56, 0, 1, 2, 3, 4, 5, 6, 7, 8, 
+        0, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 
+        24, 25, 26, 27, 28, 29, 30, 31, 33, 34, 35, 36, 37, 38, 39, 40, 
+        41, 42, 0, 0, 1, 2, 0, 43, 44, 3, 45, 46, 47, 48, 49, 50, 
+        1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0, 1, 2, 3, 
+        13, 14, 0, 15, 16, 17, 18, 19, 20, 0, 0, 51, 52, 53, 0, 1, 
+        2, 3, 4, 5, 6, 7, 8, 0, 9, 10, 11, 12, 13, 14, 15, 16, 
+        17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 33, 
+        34, 35, 36, 37, 38, 39, 40, 41, 42, 0, 1, 2, 3, 0, 43, 44, 
+        0, 45, 46, 47, 48, 49, 50, 1, 2, 3, 4, 5, 6, 7, 8, 9, 
+        10, 11, 0, 0, 12, 0, 0, 13, 14, 0, 15, 16, 17, 18, 19, 20, 
+        0, 0, 51, 52, 53, 0, 2, 3, 4, 6, 8, 9, 10, 11, 0, 13, 
+        15, 17, 19, 20, 21, 22, 24, 26, 28, 29, 31, 33, 34, 36, 38, 39, 
+        41, 43, 45, 47, 49, 50, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 
+        0, 1, 2, 3, 0, 64, 65, 0, 66, 67, 69, 70, 71, 72, 1, 2, 
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 12, 0, 0, 13, 14, 
+        0, 15, 16, 17, 18, 19, 20, 0, 0, 73, 74, 75, 0, 1, 2, 3, 
+        4, 5, 6, 7, 8, 0, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 
+        19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 33, 34, 35, 
+        36, 37, 38, 39, 40, 41, 42, 0, 1, 2, 3, 0, 43, 44, 0, 45, 
+        46, 47, 48, 49, 50, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 
+        12, 0, 1, 2, 3, 13, 14, 0, 15, 16, 17, 18, 19, 20, 0, 0, 
+        51, 52, 53, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 9, 10, 11, 
+        12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 
+        28, 29, 30, 31, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 0, 1, 
+        2, 3, 0, 43, 44, 0, 45, 46, 47, 48, 49, 50, 1, 2, 3, 4, 
+        5, 6, 7, 8, 9, 10, 11, 0, 1, 2, 0, 3, 13, 14, 0, 15, 
+        16, 17, 18, 19, 20, 0, 0, 51, 52, 53, 0, 1, 2, 3, 4, 5, 
+        6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 0, 16, 17, 18, 19, 
+        20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 
+        36, 37, 38, 39, 40, 41, 42, 43, 0, 44, 0, 1, 2, 3, 4, 5, 
+        6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 0, 16, 17, 18, 19, 
+        20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 
+        36, 37, 38, 39, 40, 41, 42, 43, 0, 44, 0, 1, 2, 3, 4, 5, 
+        6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 0, 16, 17, 18, 19, 
+        20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 
+        36, 37, 38, 39, 40, 41, 42, 43, 0, 44, 0, 1, 2, 3, 4, 5, 
+        6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 0, 16, 17, 18, 19, 
+        20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 
+        36, 37, 38, 39, 40, 41, 42, 43, 0, 44, 0, 1, 2, 3, 4, 5, 
+        6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 0, 16, 17, 18, 19, 
+        20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 
+        36, 37, 38, 39, 40, 41, 42, 43, 0, 44, 0, 1, 2, 3, 4, 5, 
+        6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 0, 16, 17, 18, 19, 
+        20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 
+        36, 37, 38, 39, 40, 41, 42, 43, 0, 44, 0, 1, 2, 3, 4, 5, 
+        6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 0, 16, 17, 18, 19, 
+        20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 
+        36, 37, 38, 39, 40, 41, 42, 43, 0, 44, 0, 1, 2, 3, 4, 5, 
+        6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 0, 16, 17, 18, 19, 
+        20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 
+        36, 37, 38, 39, 40, 41, 42, 43, 0, 44, 0, 1, 2, 3, 4, 5, 
+        6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 0, 16, 17, 18, 19, 
+        20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 
+        36, 37, 38, 39, 40, 41, 42, 43, 0, 44, 0, 1, 2, 3, 4, 5, 
+        6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 0, 16, 17, 18, 19, 
+        20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 
+        36, 37, 38, 39, 40, 41, 42, 43, 0, 44, 0, 1, 2, 3, 4, 5, 
+        6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 0, 16, 17, 18, 19, 
+        20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 
+        36, 37, 38, 39, 40, 41, 42, 43, 0, 44, 0, 1, 2, 3, 4, 5, 
+        6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 0, 16, 17, 18, 19, 
+        20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 
+        36, 37, 38, 39, 40, 41, 42, 43, 0, 44, 0, 1, 2, 3, 4, 5, 
+        6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 0, 16, 17, 18, 19, 
+        20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 
+        36, 37, 38, 39, 40, 41, 42, 43, 0, 44, 0, 1, 2, 3, 4, 5, 
+        6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 0, 16, 17, 18, 19, 
+        20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 
+        36, 37, 38, 39, 40, 41, 42, 43, 0, 44, 0, 1, 2, 3, 4, 5, 
+        6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 0, 16, 17, 18, 19, 
+        20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 
+        36, 37, 38, 39, 40, 41, 42, 43, 0, 44, 0, 1, 2, 3, 4, 5, 
+        6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 0, 16, 17, 18, 19, 
+        20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 
+        36, 37, 38, 39, 40, 41, 42, 43, 0, 44, 0, 1, 2, 3, 4, 5, 
+        6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 0, 16, 17, 18, 19, 
+        20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 
+        36, 37, 38, 39, 40, 41, 42, 43, 0, 44, 0, 1, 2, 3, 0, 4, 
+        0, 5, 6, 7, 8, 9, 10, 11, 12, 13, 0, 0, 14, 15, 16, 17, 
+        18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 
+        34, 35, 36, 37, 38, 39, 40, 41, 0, 1, 2, 0, 3, 0, 4, 0, 
+        1, 2, 0, 5, 6, 7, 8, 9, 0, 0, 10, 11, 12, 13, 14, 15, 
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 
+        32, 33, 34, 35, 36, 37, 0, 38, 0, 1, 2, 0, 3, 3, 4, 0, 
+        1, 2, 0, 5, 6, 7, 8, 9, 0, 0, 10, 11, 12, 13, 14, 15, 
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 
+        32, 33, 34, 35, 36, 37, 0, 38, 0, 1, 2, 0, 3, 3, 4, 0, 
+        0, 1, 2, 5, 6, 7, 8, 9, 0, 0, 10, 11, 12, 13, 14, 15, 
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 
+        32, 33, 34, 35, 36, 37, 0, 38, 0, 1, 2, 0, 3, 3, 4, 0, 
+        0, 1, 2, 5, 6, 7, 8, 9, 0, 0, 10, 11, 12, 13, 14, 15, 
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 
+        32, 33, 34, 35, 36, 37, 0, 38, 0, 1, 2, 0, 3, 3, 4, 0, 
+        1, 2, 0, 5, 6, 7, 8, 9, 0, 0, 10, 11, 12, 13, 14, 15, 
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 
+        32, 33, 34, 35, 36, 37, 0, 38, 0, 1, 2, 0, 3, 3, 4, 0, 
+        0, 1, 2, 5, 6, 7, 8, 9, 0, 0, 10, 11, 12, 13, 14, 15, 
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 
+        32, 33, 34, 35, 36, 37, 0, 38, 0, 1, 2, 0, 3, 0, 4, 3, 
+        0, 1, 2, 5, 6, 7, 8, 9, 0, 0, 10, 11, 12, 13, 14, 15, 
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 
+        32, 33, 34, 35, 36, 37, 0, 38, 0, 1, 2, 0, 3, 3, 4, 0, 
+        1, 2, 0, 5, 6, 7, 8, 9, 0, 0, 10, 11, 12, 13, 14, 15, 
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 
+        32, 33, 34, 35, 36, 37, 0, 38, 0, 1, 2, 0, 3, 3, 4, 0, 
+        0, 1, 2, 5, 6, 7, 8, 9, 0, 0, 10, 11, 12, 13, 14, 15, 
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 
+        32, 33, 34, 35, 36, 37, 0, 38, 0, 1, 0, 0, 2, 3, 4, 3, 
+        5, 0, 1, 2, 6, 7, 8, 3, 0, 0, 9, 0, 4, 10, 0, 0, 
+        11, 0, 1, 2, 3, 0, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 
+        22, 23, 24, 0, 1, 2, 0, 25, 26, 3, 27, 28, 29, 30, 31, 32, 
+        0, 1, 0, 0, 2, 3, 4, 0, 5, 0, 1, 2, 6, 7, 8, 0, 
+        4, 0, 9, 0, 3, 10, 0, 0, 11, 0, 0, 33, 34, 35, 12, 13, 
+        14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 4, 0, 1, 2, 0, 24, 
+        25, 0, 26, 27, 28, 29, 30, 31, 0, 1, 0, 0, 2, 3, 4, 0, 
+        5, 1, 2, 3, 6, 7, 8, 0, 1, 2, 9, 3, 3, 10, 0, 0, 
+        11, 0, 4, 32, 33, 34, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 
+        22, 23, 0, 1, 2, 0, 3, 24, 25, 0, 26, 27, 28, 29, 30, 31, 
+        0, 1, 0, 0, 2, 3, 4, 0, 5, 1, 2, 3, 6, 7, 8, 0, 
+        1, 2, 9, 3, 0, 10, 0, 0, 11, 0, 4, 32, 33, 34, 12, 13, 
+        14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 0, 1, 2, 0, 3, 24, 
+        25, 0, 26, 27, 28, 29, 30, 31, 0, 1, 0, 0, 2, 3, 4, 0, 
+        5, 1, 2, 3, 6, 7, 8, 0, 1, 2, 9, 3, 0, 10, 0, 0, 
+        11, 0, 4, 32, 33, 34, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 
+        22, 23, 0, 1, 2, 0, 3, 24, 25, 0, 26, 27, 28, 29, 30, 31, 
+        0, 1, 0, 0, 2, 3, 4, 0, 5, 1, 2, 3, 6, 7, 8, 0, 
+        1, 2, 9, 3, 0, 10, 0, 0, 11, 0, 4, 32, 33, 34, 12, 13, 
+        14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 0, 1, 2, 0, 3, 24, 
+        25, 0, 26, 27, 28, 29, 30, 31, 0, 1, 0, 0, 2, 3, 4, 0, 
+        5, 1, 2, 3, 6, 7, 8, 0, 1, 2, 9, 3, 0, 10, 0, 0, 
+        11, 0, 4, 32, 33, 34, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 
+        22, 23, 0, 1, 2, 0, 3, 24, 25, 0, 26, 27, 28, 29, 30, 31, 
+        0, 1, 0, 0, 2, 3, 4, 0, 5, 1, 2, 3, 6, 7, 8, 0, 
+        1, 2, 9, 3, 0, 10, 0, 0, 11, 0, 4, 32, 33, 34, 12, 13, 
+        14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 0, 1, 2, 0, 3, 24, 
+        25, 0, 26, 27, 28, 29, 30, 31, 0, 1, 0, 0, 2, 3, 4, 0, 
+        5, 1, 2, 3, 6, 7, 8, 0, 1, 2, 9, 3, 0, 10, 0, 0, 
+        11, 0, 4, 32, 33, 34, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 
+        22, 23, 0, 1, 2, 0, 3, 24, 25, 0, 26, 27, 28, 29, 30, 31, 
+        0, 1, 0, 0, 2, 3, 4, 0, 5, 0, 1, 2, 6, 7, 8, 0, 
+        1, 2, 9, 3, 0, 10, 0, 0, 11, 0, 4, 32, 33, 34, 12, 13, 
+        14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 0, 1, 2, 0, 3, 24, 
+        25, 0, 26, 27, 28, 29, 30, 31, 0, 1, 0, 0, 2, 3, 4, 0, 
+        5, 0, 1, 2, 6, 7, 8, 0, 1, 2, 9, 3, 0, 10, 0, 0, 
+        11, 0, 4, 32, 33, 34, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 
+        22, 23, 3, 0, 1, 2, 3, 24, 25, 0, 26, 27, 28, 29, 30, 31, 
+        0, 1, 0, 0, 2, 3, 4, 0, 5, 0, 1, 2, 6, 7, 8, 0, 
+        1, 2, 9, 3, 0, 10, 0, 0, 11, 0, 4, 32, 33, 34, 12, 13, 
+        14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 0, 1, 2, 0, 3, 24, 
+        25, 0, 26, 27, 28, 29, 30, 31, 0, 1, 0, 0, 2, 3, 4, 0, 
+        5, 0, 1, 2, 6, 7, 8, 0, 1, 2, 9, 3, 0, 10, 0, 0, 
+        11, 0, 4, 32, 33, 34, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 
+        22, 23, 0, 1, 2, 0, 3, 24, 25, 0, 26, 27, 28, 29, 30, 31, 
+        0, 1, 0, 0, 2, 3, 4, 0, 5, 0, 1, 2, 6, 7, 8, 0, 
+        1, 2, 9, 3, 0, 10, 0, 0, 11, 0, 4, 32, 33, 34, 12, 13, 
+        14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 0, 1, 2, 0, 3, 24, 
+        25, 0, 26, 27, 28, 29, 30, 31, 0, 1, 0, 0, 2, 3, 4, 0, 
+        5, 0, 1, 2, 6, 7, 8, 0, 1, 2, 9, 3, 0, 10, 0, 0, 
+        11, 0, 4, 32, 33, 34, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 
+        22, 23, 0, 1, 2, 0, 3, 24, 25, 0, 26, 27, 28, 29, 30, 31, 
+        0, 1, 0, 0, 2, 3, 4, 0, 5, 0, 1, 2, 6, 7, 8, 0, 
+        1, 2, 9, 3, 0, 10, 0, 0, 11, 0, 4, 32, 33, 34, 12, 13, 
+        14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 0, 1, 2, 0, 3, 24, 
+        25, 0, 26, 27, 28, 29, 30, 31, 0, 1, 0, 0, 2, 3, 4, 0, 
+        5, 0, 1, 2, 6, 7, 8, 0, 1, 2, 9, 3, 0, 10, 0, 0, 
+        11, 0, 4, 32, 33, 34, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 
+        22, 23, 0, 1, 2, 0, 3, 24, 25, 0, 26, 27, 28, 29, 30, 31, 
+        0, 1, 0, 0, 2, 3, 4, 0, 5, 0, 1, 2, 6, 7, 8, 0, 
+        1, 2, 9, 3, 0, 10, 0, 0, 11, 0, 4, 32, 33, 34, 12, 13, 
+        14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 0, 1, 2, 0, 3, 24, 
+        25, 0, 26, 27, 28, 29, 30, 31, 0, 1, 0, 0, 2, 3, 4, 0, 
+        5, 0, 1, 2, 6, 7, 8, 0, 1, 2, 9, 3, 0, 10, 0, 0, 
+        11, 0, 4, 32, 33, 34, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 
+        22, 23, 0, 1, 2, 0, 3, 24, 25, 0, 26, 27, 28, 29, 30, 31, 
+        0, 1, 0, 0, 2, 3, 4, 0, 5, 0, 1, 2, 6, 7, 8, 0, 
+        1, 2, 9, 3, 0, 10, 0, 0, 11, 0, 4, 32, 33, 34, 12, 13, 
+        14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 0, 1, 2, 0, 3, 24, 
+        25, 0, 26, 27, 28, 29, 30, 31, 0, 1, 0, 0, 2, 3, 4, 0, 
+        5, 0, 1, 2, 6, 7, 8, 0, 1, 2, 9, 3, 0, 10, 0, 0, 
+        11, 0, 4, 32, 33, 34, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 
+        22, 23, 0, 1, 2, 0, 3, 24, 25, 0, 26, 27, 28, 29, 30, 31, 
+        0, 1, 0, 0, 2, 3, 4, 0, 1, 2, 0, 3, 5, 6, 7, 0, 
+        1, 2, 8, 3, 0, 9, 0, 0, 10, 0, 4, 32, 33, 34, 11, 12, 
+        13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 0, 0, 1, 2, 0, 23, 
+        24, 0, 25, 26, 27, 28, 29, 30, 1, 2, 3, 4, 6, 7, 0, 1, 
+        2, 3, 0, 8, 0, 9, 0, 1, 2, 0, 1, 4, 5, 6, 2, 0, 
+        3, 3, 4, 31, 32, 33, 5, 6, 3, 0, 7, 8, 9, 0, 10, 0, 
+        0, 11, 12, 13, 14, 0, 15, 18, 19, 20, 21, 22, 23, 24, 25, 26, 
+        27, 0, 0, 4, 0, 5, 28, 29, 0, 30, 31, 32, 33, 34, 35, 0, 
+        1, 0, 0, 2, 3, 4, 0, 0, 1, 2, 0, 5, 6, 7, 1, 2, 
+        3, 8, 0, 0, 9, 0, 0, 10, 0, 1, 2, 3, 0, 11, 12, 13, 
+        14, 15, 16, 17, 18, 19, 20, 21, 22, 0, 1, 2, 0, 3, 23, 24, 
+        0, 25, 26, 27, 28, 29, 30, 0, 1, 0, 0, 2, 3, 4, 0, 0, 
+        0, 1, 2, 5, 6, 7, 3, 4, 0, 8, 0, 0, 9, 0, 0, 10, 
+        0, 0, 31, 32, 33, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 
+        22, 0, 1, 2, 0, 3, 23, 24, 0, 25, 26, 27, 28, 29, 30, 0, 
+        1, 0, 0, 2, 3, 4, 0, 1, 2, 0, 3, 5, 6, 7, 0, 1, 
+        2, 8, 3, 0, 9, 0, 0, 10, 0, 4, 31, 32, 33, 11, 12, 13, 
+        14, 15, 16, 17, 18, 19, 20, 21, 22, 0, 1, 2, 0, 0, 23, 24, 
+        0, 25, 26, 27, 28, 29, 30, 0, 1, 0, 0, 2, 3, 4, 0, 1, 
+        2, 0, 0, 5, 6, 7, 0, 1, 2, 8, 0, 0, 9, 0, 0, 10, 
+        0, 0, 31, 32, 33, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 
+        22, 0, 1, 2, 0, 0, 23, 24, 0, 25, 26, 27, 28, 29, 30, 0, 
+        1, 0, 0, 2, 3, 4, 0, 1, 2, 0, 0, 5, 6, 7, 0, 1, 
+        2, 8, 0, 0, 9, 0, 0, 10, 0, 0, 31, 32, 33, 11, 12, 13, 
+        14, 15, 16, 17, 18, 19, 20, 21, 22, 0, 1, 2, 0, 0, 23, 24, 
+        0, 25, 26, 27, 28, 29, 30, 0, 1, 0, 0, 2, 3, 4, 0, 1, 
+        2, 0, 0, 5, 6, 7, 0, 1, 2, 8, 0, 0, 9, 0, 0, 10, 
+        0, 0, 31, 32, 0, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 
+        22, 0, 1, 2, 0, 0, 23, 24, 0, 25, 26, 27, 28, 29, 30, 0, 
+        1, 0, 0, 2, 3, 4, 0, 1, 2, 0, 0, 5, 6, 7, 0, 1, 
+        2, 8, 0, 0, 9, 0, 0, 10, 0, 0, 31, 32, 0, 11, 12, 13, 
+        14, 15, 16, 17, 18, 19, 20, 21, 22, 0, 1, 2, 0, 0, 23, 24, 
+        0, 25, 26, 27, 28, 29, 30, 0, 1, 0, 0, 2, 3, 4, 0, 1, 
+        2, 0, 0, 5, 6, 7, 0, 1, 2, 8, 0, 0, 9, 0, 0, 10, 
+        0, 0, 31, 32, 0, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 
+        22, 0, 1, 2, 0, 0, 23, 24, 0, 25, 26, 27, 28, 29, 30, 0, 
+        1, 0, 0, 2, 3, 4, 0, 1, 2, 0, 0, 5, 6, 7, 0, 1, 
+        2, 8, 0, 0, 9, 0, 0, 10, 0, 0, 31, 32, 0, 11, 12, 13, 
+        14, 15, 16, 17, 18, 19, 20, 21, 22, 0, 1, 2, 0, 0, 23, 24, 
+        0, 25, 26, 27, 28, 29, 30, 0, 1, 0, 0, 2, 3, 4, 0, 1, 
+        2, 0, 0, 5, 6, 7, 0, 1, 2, 8, 0, 0, 9, 0, 0, 10, 
+        0, 0, 31, 32, 0, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 
+        22, 0, 1, 2, 0, 0, 23, 24, 0, 25, 26, 27, 28, 29, 30, 0, 
+        1, 0, 0, 2, 3, 4, 0, 1, 2, 0, 0, 5, 6, 7, 0, 1, 
+        2, 8, 0, 0, 9, 0, 0, 10, 0, 0, 31, 32, 0, 11, 12, 13, 
+        14, 15, 16, 17, 18, 19, 20, 21, 22, 0, 1, 2, 0, 0, 23, 24, 
+        0, 25, 26, 27, 28, 29, 30, 0, 1, 0, 0, 2, 3, 4, 0, 1, 
+        2, 0, 0, 5, 6, 7, 0, 1, 2, 8, 0, 0, 9, 0, 0, 10, 
+        0, 0, 31, 32, 0, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 
+        22, 0, 1, 2, 0, 0, 23, 24, 0, 25, 26, 27, 28, 29, 30, 0, 
+        1, 0, 0, 2, 3, 4, 0, 1, 2, 0, 0, 5, 6, 7, 0, 1, 
+        2, 8, 0, 0, 9, 0, 0, 10, 0, 3, 31, 32, 0, 11, 12, 13, 
+        14, 15, 16, 17, 18, 19, 20, 21, 22, 0, 0, 0, 1, 2, 23, 24, 
+        0, 25, 26, 27, 28, 29, 30, 1, 2, 3, 4, 5, 6, 4, 0, 1, 
+        2, 0, 7, 0, 0, 0, 0, 1, 2, 0, 1, 2, 3, 0, 4, 5, 
+        6, 0, 31, 32, 7, 8, 9, 0, 10, 11, 3, 12, 13, 0, 14, 15, 
+        16, 17, 18, 0, 19, 0, 1, 2, 3, 4, 5, 24, 25, 26, 27, 32, 
+        33, 1, 6, 2, 0, 0, 34, 0, 35, 0, 3, 4, 5, 6, 7, 8, 
+        1, 2, 3, 4, 0, 9, 0, 10, 0, 0, 0, 0, 40, 1, 2, 1, 
+        2, 3, 3, 0, 4, 5, 6, 0, 41, 42, 7, 8, 9, 0, 10, 11, 
+        0, 12, 13, 0, 14, 15, 16, 17, 18, 0, 19, 0, 1, 2, 3, 4, 
+        5, 24, 25, 26, 27, 32, 33, 1, 6, 2, 0, 0, 34, 4, 35, 0, 
+        3, 4, 5, 6, 7, 8, 1, 2, 3, 4, 0, 9, 0, 10, 0, 0, 
+        0, 0, 40, 1, 2, 1, 2, 3, 3, 0, 4, 5, 6, 0, 41, 42, 
+        7, 8, 9, 0, 10, 11, 0, 12, 13, 0, 14, 15, 16, 17, 18, 0, 
+        19, 0, 0, 0, 1, 2, 0, 20, 21, 22, 23, 24, 25, 1, 3, 2, 
+        0, 0, 26, 4, 0, 0, 3, 4, 5, 6, 7, 8, 0, 1, 2, 0, 
+        0, 9, 0, 10, 0, 4, 0, 0, 27, 28, 1, 2, 0, 1, 2, 3, 
+        5, 4, 5, 6, 29, 30, 0, 7, 8, 9, 0, 10, 11, 0, 12, 13, 
+        0, 14, 15, 16, 17, 18, 0, 19, 0, 3, 0, 1, 2, 0, 20, 21, 
+        22, 23, 24, 25, 0, 0, 0, 1, 2, 26, 0, 3, 1, 2, 3, 4, 
+        0, 1, 2, 0, 3, 0, 4, 0, 0, 5, 0, 5, 0, 0, 0, 27, 
+        28, 1, 2, 0, 1, 2, 3, 3, 4, 5, 6, 29, 30, 6, 7, 8, 
+        9, 6, 10, 11, 0, 12, 13, 0, 14, 15, 16, 17, 18, 7, 19, 8, 
+        0, 0, 1, 2, 0, 20, 21, 22, 23, 24, 25, 0, 0, 0, 1, 2, 
+        26, 0, 0, 1, 2, 3, 4, 0, 1, 2, 0, 3, 0, 4, 0, 0, 
+        5, 0, 5, 0, 0, 0, 27, 28, 1, 2, 0, 0, 0, 3, 3, 4, 
+        5, 6, 29, 30, 6, 7, 8, 9, 6, 10, 11, 0, 12, 13, 0, 14, 
+        15, 16, 17, 18, 7, 19, 8, 0, 0, 1, 2, 0, 20, 21, 22, 23, 
+        24, 25, 0, 0, 0, 0, 0, 26, 0, 0, 1, 2, 3, 4, 0, 1, 
+        2, 0, 3, 0, 4, 0, 0, 5, 0, 5, 0, 0, 0, 27, 28, 1, 
+        2, 0, 0, 0, 3, 3, 4, 5, 6, 29, 30, 6, 7, 8, 9, 6, 
+        10, 11, 0, 12, 13, 0, 14, 15, 16, 17, 18, 7, 19, 8, 0, 0, 
+        1, 2, 0, 20, 21, 22, 23, 24, 25, 0, 3, 0, 0, 0, 26, 0, 
+        1, 2, 3, 4, 5, 0, 1, 2, 0, 0, 6, 3, 0, 0, 0, 0, 
+        4, 0, 0, 0, 27, 28, 1, 2, 0, 0, 0, 3, 4, 4, 5, 6, 
+        29, 30, 0, 7, 8, 9, 5, 10, 11, 0, 12, 13, 0, 14, 15, 16, 
+        17, 18, 6, 19, 7, 0, 0, 0, 0, 0, 20, 21, 22, 23, 24, 25, 
+        0, 1, 2, 0, 3, 26, 4, 0, 0, 0, 0, 5, 0, 0, 1, 2, 
+        3, 4, 5, 2, 3, 4, 5, 0, 6, 0, 0, 27, 28, 1, 2, 0, 
+        7, 6, 3, 0, 4, 5, 6, 29, 30, 0, 7, 8, 9, 7, 10, 11, 
+        0, 12, 13, 0, 14, 15, 16, 17, 18, 0, 19, 0, 0, 0, 0, 0, 
+        9, 24, 25, 26, 27, 32, 33, 0, 0, 0, 0, 0, 34, 0, 35, 0, 
+        0, 0, 1, 2, 0, 0, 0, 3, 0, 4, 5, 6, 0, 0, 0, 7, 
+        8, 9, 40, 10, 11, 0, 12, 13, 0, 14, 15, 16, 17, 18, 41, 19, 
+        0, 0, 0, 0, 0, 0, 24, 25, 26, 27, 32, 33, 1, 2, 3, 4, 
+        0, 34, 0, 35, 0, 0, 0, 1, 2, 5, 0, 0, 3, 0, 4, 5, 
+        6, 0, 0, 0, 7, 8, 9, 40, 10, 11, 0, 12, 13, 0, 14, 15, 
+        16, 17, 18, 41, 19, 0, 0, 0, 0, 6, 0, 24, 25, 26, 27, 32, 
+        33, 1, 2, 3, 4, 0, 34, 0, 35, 0, 0, 0, 1, 2, 5, 0, 
+        0, 3, 0, 4, 5, 6, 0, 0, 0, 7, 8, 9, 40, 10, 11, 0, 
+        12, 13, 0, 14, 15, 16, 17, 18, 41, 19, 0, 0, 0, 0, 6, 0, 
+        24, 25, 26, 27, 32, 33, 1, 2, 3, 4, 0, 34, 0, 35, 0, 0, 
+        0, 1, 2, 5, 0, 0, 3, 0, 4, 5, 6, 0, 0, 0, 7, 8, 
+        9, 40, 10, 11, 0, 12, 13, 0, 14, 15, 16, 17, 18, 41, 19, 0, 
+        0, 0, 0, 6, 0, 24, 25, 26, 27, 32, 33, 1, 2, 3, 4, 0, 
+        34, 0, 35, 0, 0, 0, 1, 2, 5, 0, 0, 3, 0, 4, 5, 6, 
+        0, 0, 0, 7, 8, 9, 40, 10, 11, 0, 12, 13, 6, 14, 15, 16, 
+        17, 18, 41, 19, 0, 0, 0, 0, 0, 0, 24, 25, 26, 27, 32, 33, 
+        1, 2, 3, 4, 0, 34, 0, 35, 0, 0, 0, 1, 2, 5, 0, 0, 
+        3, 0, 4, 5, 6, 0, 0, 0, 7, 8, 9, 40, 10, 11, 0, 12, 
+        13, 0, 14, 15, 16, 17, 18, 41, 19, 0, 0, 0, 0, 0, 0, 24, 
+        25, 26, 27, 32, 33, 1, 2, 3, 4, 0, 34, 0, 35, 0, 0, 0, 
+        1, 2, 5, 0, 0, 3, 0, 4, 5, 6, 0, 0, 0, 7, 8, 9, 
+        40, 10, 11, 0, 12, 13, 0, 14, 15, 16, 17, 18, 41, 19, 0, 0, 
+        0, 0, 0, 0, 24, 25, 26, 27, 32, 33, 1, 2, 3, 4, 0, 34, 
+        0, 35, 0, 0, 0, 1, 2, 5, 0, 0, 3, 0, 4, 5, 6, 0, 
+        0, 0, 7, 8, 9, 40, 10, 11, 0, 12, 13, 0, 14, 15, 16, 17, 
+        18, 41, 19, 0, 0, 0, 0, 0, 0, 24, 25, 26, 27, 32, 33, 1, 
+        2, 3, 4, 0, 34, 0, 35, 0, 0, 0, 1, 2, 5, 0, 0, 3, 
+        0, 4, 5, 6, 0, 0, 0, 7, 8, 9, 40, 10, 11, 0, 12, 13, 
+        0, 14, 15, 16, 17, 18, 41, 19, 0, 0, 0, 0, 0, 0, 24, 25, 
+        26, 27, 32, 33, 1, 2, 3, 4, 0, 34, 0, 35, 0, 0, 0, 1, 
+        2, 5, 0, 0, 3, 0, 4, 5, 6, 0, 0, 0, 7, 8, 9, 40, 
+        10, 11, 0, 12, 13, 0, 14, 15, 16, 17, 18, 41, 19, 0, 0, 0, 
+        0, 0, 0, 24, 25, 26, 27, 32, 33, 1, 2, 3, 4, 0, 34, 0, 
+        35, 0, 0, 0, 1, 2, 5, 0, 0, 3, 0, 4, 5, 6, 0, 0, 
+        0, 7, 8, 9, 40, 10, 11, 0, 12, 13, 0, 14, 15, 16, 17, 18, 
+        41, 19, 0, 0, 0, 0, 0, 0, 24, 25, 26, 27, 32, 33, 1, 2, 
+        3, 4, 0, 34, 0, 35, 0, 0, 0, 1, 2, 5, 0, 0, 3, 0, 
+        4, 5, 6, 0, 0, 0, 7, 8, 9, 40, 10, 11, 0, 12, 13, 0, 
+        14, 15, 16, 17, 18, 41, 19, 0, 0, 0, 0, 0, 0, 24, 25, 26, 
+        27, 32, 33, 0, 0, 0, 0, 0, 34, 0, 35, 0, 0, 0, 1, 2, 
+        0, 0, 0, 3, 0, 4, 5, 6, 0, 0, 0, 7, 8, 9, 40, 10, 
+        11, 0, 12, 13, 0, 14, 15, 16, 17, 18, 41, 19, 0, 0, 0, 0, 
+        0, 0, 24, 25, 26, 27, 32, 33, 0, 0, 0, 0, 0, 34, 0, 35, 
+        0, 0, 0, 1, 2, 0, 0, 0, 3, 0, 4, 5, 6, 0, 0, 0, 
+        7, 8, 9, 40, 10, 11, 0, 12, 13, 0, 14, 15, 16, 17, 18, 41, 
+        19, 0, 0, 0, 0, 0, 0, 24, 25, 26, 27, 32, 33, 0, 0, 0, 
+        0, 0, 34, 0, 35, 0, 0, 0, 1, 2, 0, 0, 0, 3, 0, 4, 
+        5, 6, 0, 0, 0, 7, 8, 9, 40, 10, 11, 0, 12, 13, 0, 14, 
+        15, 16, 17, 18, 41, 19, 0, 0, 0, 0, 0, 0, 24, 25, 26, 27, 
+        32, 33, 0, 0, 0, 0, 0, 34, 0, 35, 0, 0, 0, 1, 2, 0, 
+        0, 0, 3, 0, 4, 5, 6, 0, 0, 0, 7, 8, 9, 40, 10, 11, 
+        0, 12, 13, 0, 14, 15, 16, 17, 18, 41, 19, 0, 0, 0, 0, 0, 
+        0, 24, 25, 26, 27, 32, 33, 0, 0, 0, 0, 0, 34, 0, 35, 0, 
+        0, 0, 1, 2, 0, 0, 0, 3, 0, 4, 5, 6, 0, 0, 0, 7, 
+        8, 9, 40, 10, 11, 0, 12, 13, 0, 14, 15, 16, 17, 18, 41, 19, 
+        0, 0, 0, 0, 0, 0, 24, 25, 26, 27, 32, 33, 0, 0, 0, 0, 
+        0, 34, 0, 35, 0, 0, 0, 1, 2, 0, 0, 0, 3, 0, 4, 5, 
+        6, 0, 0, 0, 7, 8, 9, 40, 10, 11, 0, 12, 13, 0, 14, 15, 
+        16, 17, 18, 41, 19, 0, 0, 0, 1, 2, 0, 23, 24, 25, 26, 30, 
+        31, 0, 3, 0, 0, 0, 32, 0, 33, 0, 1, 2, 0, 0, 0, 3, 
+        0, 4, 5, 6, 0, 0, 0, 7, 8, 9, 0, 10, 11, 0, 12, 13, 
+        0, 14, 15, 16, 17, 18, 4, 19, 37, 0, 0, 1, 2, 0, 23, 24, 
+        25, 26, 30, 31, 0, 3, 0, 0, 0, 32, 0, 33, 0, 1, 2, 0, 
+        0, 0, 3, 0, 4, 5, 6, 0, 0, 0, 7, 8, 9, 0, 10, 11, 
+        0, 12, 13, 0, 14, 15, 16, 17, 18, 4, 19, 37, 0, 0, 1, 2, 
+        0, 23, 24, 25, 26, 30, 31, 0, 3, 0, 0, 0, 32, 0, 33, 0, 
+        1, 2, 0, 0, 0, 3, 0, 4, 5, 6, 0, 0, 0, 7, 8, 9, 
+        0, 10, 11, 0, 12, 13, 0, 14, 15, 16, 17, 18, 4, 19, 37, 0, 
+        0, 1, 2, 0, 23, 24, 25, 26, 30, 31, 0, 3, 0, 0, 0, 32, 
+        0, 33, 0, 1, 2, 0, 0, 0, 3, 0, 4, 5, 6, 0, 0, 0, 
+        7, 8, 9, 0, 10, 11, 0, 12, 13, 0, 14, 15, 16, 17, 18, 4, 
+        19, 37, 0, 0, 1, 2, 0, 23, 24, 25, 26, 30, 31, 0, 3, 0, 
+        0, 0, 32, 0, 33, 0, 1, 2, 0, 0, 0, 3, 0, 4, 5, 6, 
+        0, 0, 0, 7, 8, 9, 0, 10, 11, 0, 12, 13, 0, 14, 15, 16, 
+        17, 18, 4, 19, 37, 0, 0, 1, 2, 0, 23, 24, 25, 26, 30, 31, 
+        0, 3, 0, 0, 0, 32, 0, 33, 0, 1, 2, 0, 0, 0, 3, 0, 
+        4, 5, 6, 0, 0, 0, 7, 8, 9, 0, 10, 11, 0, 12, 13, 0, 
+        14, 15, 16, 17, 18, 4, 19, 37, 0, 0, 1, 2, 0, 23, 24, 25, 
+        26, 30, 31, 0, 3, 0, 0, 0, 32, 0, 33, 0, 1, 2, 0, 0, 
+        0, 3, 0, 4, 5, 6, 0, 0, 0, 7, 8, 9, 0, 10, 11, 0, 
+        12, 13, 0, 14, 15, 16, 17, 18, 4, 19, 37, 0, 0, 0, 0, 0, 
+        23, 24, 25, 26, 30, 31, 0, 0, 0, 0, 0, 32, 0, 33, 0, 1, 
+        2, 0, 0, 0, 3, 0, 4, 5, 6, 0, 0, 0, 7, 8, 9, 0, 
+        10, 11, 0, 12, 13, 0, 14, 15, 16, 17, 18, 0, 19, 37, 0, 0, 
+        0, 0, 0, 23, 24, 25, 26, 30, 31, 0, 0, 0, 0, 0, 32, 0, 
+        33, 0, 1, 2, 0, 0, 0, 3, 0, 4, 5, 6, 0, 0, 0, 7, 
+        8, 9, 0, 10, 11, 0, 12, 13, 0, 14, 15, 16, 17, 18, 0, 19, 
+        37, 0, 0, 0, 0, 0, 23, 24, 25, 26, 30, 31, 0, 0, 0, 0, 
+        0, 32, 0, 33, 0, 1, 2, 0, 0, 0, 3, 0, 4, 5, 6, 0, 
+        0, 0, 7, 8, 9, 0, 10, 11, 0, 12, 13, 0, 14, 15, 16, 17, 
+        18, 0, 19, 37, 0, 0, 0, 0, 0, 23, 24, 25, 26, 30, 31, 0, 
+        1, 2, 0, 3, 32, 4, 33, 0, 0, 0, 5, 6, 7, 8, 9, 0, 
+        0, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 
+        25, 0, 0, 0, 0, 0, 37, 0, 1, 2, 0, 3, 26, 4, 27, 0, 
+        0, 0, 5, 6, 7, 8, 9, 0, 0, 10, 11, 12, 13, 14, 15, 16, 
+        17, 18, 19, 20, 21, 22, 23, 24, 25, 0, 0, 0, 0, 1, 2, 0, 
+        3, 0, 4, 0, 26, 0, 27, 5, 6, 7, 8, 9, 0, 0, 10, 11, 
+        12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 0, 0, 
+        0, 0, 1, 2, 0, 3, 0, 4, 0, 26, 0, 27, 5, 6, 7, 8, 
+        9, 0, 0, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 
+        23, 24, 25, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 26, 3, 
+        27, 4, 5, 6, 0, 0, 0, 7, 8, 9, 0, 10, 11, 0, 12, 13, 
+        0, 14, 15, 16, 17, 18, 0, 19, 0, 0, 0, 0, 0, 0, 20, 21, 
+        22, 23, 24, 25, 0, 0, 0, 1, 2, 0, 0, 26, 3, 0, 4, 5, 
+        6, 0, 0, 0, 7, 8, 9, 0, 10, 11, 0, 12, 13, 0, 14, 15, 
+        16, 17, 18, 0, 19, 0, 1, 2, 3, 4, 5, 21, 22, 23, 24, 0, 
+        6, 0, 1, 2, 0, 0, 0, 3, 25, 4, 5, 6, 0, 0, 0, 7, 
+        8, 9, 0, 10, 11, 0, 12, 13, 0, 14, 15, 16, 17, 18, 0, 19, 
+        0, 1, 2, 3, 4, 5, 21, 22, 23, 24, 0, 6, 0, 1, 2, 0, 
+        0, 0, 3, 25, 4, 5, 6, 0, 0, 0, 7, 8, 9, 0, 10, 11, 
+        0, 12, 13, 0, 14, 15, 16, 17, 18, 0, 19, 0, 1, 2, 3, 4, 
+        5, 21, 22, 23, 24, 0, 6, 0, 1, 2, 0, 0, 0, 3, 25, 4, 
+        5, 6, 0, 0, 0, 7, 8, 9, 0, 10, 11, 0, 12, 13, 0, 14, 
+        15, 16, 17, 18, 0, 19, 0, 1, 2, 3, 4, 5, 21, 22, 23, 24, 
+        0, 6, 0, 1, 2, 0, 0, 0, 3, 25, 4, 5, 6, 0, 0, 0, 
+        7, 8, 9, 0, 10, 11, 0, 12, 13, 0, 14, 15, 16, 17, 18, 0, 
+        19, 0, 1, 2, 3, 4, 5, 21, 22, 23, 24, 0, 6, 0, 1, 2, 
+        0, 0, 0, 3, 25, 4, 5, 6, 0, 0, 0, 7, 8, 9, 0, 10, 
+        11, 0, 12, 13, 0, 14, 15, 16, 17, 18, 0, 19, 0, 0, 1, 2, 
+        0, 0, 21, 22, 23, 24, 0, 0, 3, 1, 2, 0, 0, 0, 3, 25, 
+        4, 5, 6, 0, 0, 0, 7, 8, 9, 0, 10, 11, 0, 12, 13, 4, 
+        14, 15, 16, 17, 18, 0, 19, 0, 0, 0, 1, 2, 5, 21, 22, 23, 
+        24, 0, 1, 2, 3, 3, 0, 4, 0, 0, 25, 0, 5, 6, 0, 7, 
+        8, 0, 0, 0, 0, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 
+        20, 21, 22, 0, 0, 0, 4, 0, 5, 0, 1, 2, 0, 0, 23, 3, 
+        24, 4, 5, 6, 0, 0, 0, 7, 8, 9, 0, 10, 11, 0, 12, 13, 
+        0, 14, 15, 16, 17, 18, 0, 19, 0, 0, 0, 1, 2, 0, 21, 22, 
+        23, 24, 0, 1, 2, 3, 3, 0, 4, 0, 0, 25, 0, 5, 6, 0, 
+        7, 8, 0, 0, 0, 0, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 
+        19, 20, 21, 22, 0, 0, 0, 4, 0, 0, 0, 1, 2, 0, 0, 23, 
+        3, 24, 4, 5, 6, 0, 0, 0, 7, 8, 9, 0, 10, 11, 0, 12, 
+        13, 0, 14, 15, 16, 17, 18, 0, 19, 0, 0, 0, 0, 1, 2, 20, 
+        21, 22, 3, 0, 4, 5, 6, 0, 0, 0, 7, 8, 9, 0, 10, 11, 
+        0, 12, 13, 0, 14, 15, 16, 17, 18, 0, 19, 0, 1, 2, 0, 3, 
+        0, 20, 21, 22, 0, 0, 4, 1, 2, 0, 0, 0, 3, 23, 4, 5, 
+        6, 0, 0, 0, 7, 8, 9, 0, 10, 11, 0, 12, 13, 0, 14, 15, 
+        16, 17, 18, 0, 19, 0, 0, 0, 5, 1, 2, 20, 21, 22, 3, 23, 
+        4, 5, 6, 0, 0, 0, 7, 8, 9, 0, 10, 11, 0, 12, 13, 0, 
+        14, 15, 16, 17, 18, 0, 19, 0, 1, 2, 0, 0, 0, 21, 22, 23, 
+        0, 24, 3, 1, 2, 0, 0, 0, 3, 23, 4, 5, 6, 0, 0, 0, 
+        7, 8, 9, 0, 10, 11, 0, 12, 13, 0, 14, 15, 16, 17, 18, 0, 
+        19, 0, 0, 0, 4, 1, 2, 20, 21, 22, 3, 23, 4, 5, 6, 0, 
+        0, 0, 7, 8, 9, 0, 10, 11, 0, 12, 13, 0, 14, 15, 16, 17, 
+        18, 0, 19, 0, 0, 0, 0, 1, 2, 20, 21, 22, 3, 0, 4, 5, 
+        6, 0, 0, 0, 7, 8, 9, 0, 10, 11, 0, 12, 13, 0, 14, 15, 
+        16, 17, 18, 0, 19, 0, 0, 0, 0, 1, 2, 20, 21, 22, 3, 0, 
+        4, 5, 6, 0, 0, 0, 7, 8, 9, 23, 10, 11, 0, 12, 13, 0, 
+        14, 15, 16, 17, 18, 0, 19, 0, 0, 0, 0, 1, 2, 20, 21, 22, 
+        3, 0, 4, 5, 6, 0, 0, 0, 7, 8, 9, 0, 10, 11, 0, 12, 
+        13, 0, 14, 15, 16, 17, 18, 0, 19, 0, 0, 1, 2, 0, 1, 20, 
+        21, 22, 2, 0, 3, 3, 4, 0, 0, 0, 5, 6, 0, 0, 7, 8, 
+        0, 0, 9, 0, 0, 10, 11, 12, 13, 0, 14, 4, 0, 0, 1, 2, 
+        0, 16, 17, 18, 19, 21, 22, 5, 3, 0, 0, 0, 1, 0, 23, 0, 
+        2, 0, 3, 0, 4, 0, 0, 0, 5, 6, 0, 0, 7, 8, 0, 0, 
+        9, 0, 25, 10, 11, 12, 13, 0, 14, 0, 4, 0, 1, 2, 0, 16, 
+        17, 18, 19, 21, 22, 0, 3, 0, 0, 0, 1, 0, 23, 0, 2, 0, 
+        3, 0, 4, 0, 0, 0, 5, 6, 0, 0, 7, 8, 0, 0, 9, 0, 
+        25, 10, 11, 12, 13, 0, 14, 0, 4, 0, 1, 2, 0, 16, 17, 18, 
+        19, 21, 22, 0, 3, 0, 0, 0, 1, 0, 23, 0, 2, 0, 3, 0, 
+        4, 0, 0, 0, 5, 6, 0, 0, 7, 8, 0, 0, 9, 0, 25, 10, 
+        11, 12, 13, 0, 14, 0, 4, 0, 1, 2, 0, 16, 17, 18, 19, 21, 
+        22, 0, 3, 0, 0, 0, 1, 2, 23, 0, 0, 3, 0, 4, 5, 6, 
+        0, 0, 0, 7, 8, 9, 0, 10, 11, 0, 12, 13, 25, 14, 15, 16, 
+        17, 18, 0, 19, 4, 0, 0, 0, 1, 2, 20, 21, 22, 3, 0, 4, 
+        5, 6, 0, 0, 0, 7, 8, 9, 0, 10, 11, 0, 12, 13, 0, 14, 
+        15, 16, 17, 18, 0, 19, 0, 0, 1, 2, 0, 0, 20, 21, 22, 0, 
+        1, 2, 3, 3, 0, 4, 0, 0, 0, 0, 5, 6, 0, 0, 0, 0, 
+        0, 0, 0, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 
+        20, 0, 0, 1, 4, 0, 0, 2, 0, 3, 0, 4, 21, 0, 22, 5, 
+        6, 0, 0, 7, 8, 0, 0, 9, 0, 0, 10, 11, 12, 13, 0, 14, 
+        0, 0, 0, 0, 0, 0, 16, 17, 18, 19, 21, 22, 0, 1, 2, 0, 
+        0, 1, 2, 23, 0, 1, 2, 3, 3, 0, 4, 3, 0, 0, 0, 5, 
+        6, 0, 0, 0, 0, 0, 0, 25, 7, 8, 9, 10, 11, 12, 13, 14, 
+        15, 16, 17, 18, 19, 20, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 
+        0, 21, 0, 22, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 
+        0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 
+        4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 
+        14, 15, 16, 17, 18, 19, 0, 0, 0, 20, 21, 0, 0, 0, 1, 2, 
+        0, 3, 0, 4, 0, 0, 0, 0, 5, 6, 0, 0, 0, 0, 0, 0, 
+        0, 0, 20, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 20, 1, 2, 3, 
+        4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 
+        14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 
+        11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 0, 
+        0, 0, 20, 0, 1, 0, 0, 0, 2, 0, 3, 0, 4, 0, 0, 0, 
+        5, 6, 0, 0, 7, 8, 0, 0, 9, 0, 20, 10, 11, 12, 13, 0, 
+        0, 0, 0, 0, 0, 0, 0, 14, 15, 16, 17, 18, 19, 0, 1, 2, 
+        0, 3, 0, 4, 20, 0, 0, 0, 5, 6, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 20, 1, 2, 3, 
+        4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 
+        14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 
+        11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 0, 
+        0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 
+        5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 20, 0, 12, 13, 0, 14, 
+        15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 
+        0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 
+        0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 
+        10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 
+        1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 
+        12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 
+        8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 
+        18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 
+        0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 
+        6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 
+        16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 
+        0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 
+        4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 
+        14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 
+        11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 
+        2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 
+        13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 
+        9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 
+        19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 
+        0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 
+        7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 
+        17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 
+        0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 
+        5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 
+        15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 
+        0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 
+        0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 
+        10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 
+        1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 
+        12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 
+        8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 
+        18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 
+        0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 
+        6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 
+        16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 
+        0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 
+        4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 
+        14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 
+        11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 
+        2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 
+        13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 
+        9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 
+        19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 
+        0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 
+        7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 
+        17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 
+        0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 
+        5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 
+        15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 
+        0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 
+        0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 
+        10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 
+        1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 
+        12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 
+        8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 
+        18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 
+        0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 
+        6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 
+        16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 
+        0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 
+        4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 
+        14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 
+        11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 
+        2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 
+        13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 
+        9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 
+        19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 
+        0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 
+        7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 
+        17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 
+        0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 
+        5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 
+        15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 
+        0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 
+        0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 
+        10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 
+        1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 
+        12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 
+        8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 
+        18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 
+        0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 
+        6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 
+        16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 
+        0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 
+        4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 
+        14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 
+        11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 
+        2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 
+        13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 
+        9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 
+        19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 
+        0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 5, 6, 
+        7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 15, 16, 
+        17, 18, 19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 
+        0, 0, 0, 12, 13, 0, 14, 15, 16, 17, 18, 19, 1, 2, 3, 4, 
+        5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12, 13, 0, 14, 
+        15, 16, 17, 18, 19, 0, 1, 0, 0, 0, 2, 0, 3, 0, 4, 0, 
+        0, 0, 5, 6, 0, 0, 7, 8, 0, 0, 9, 0, 0, 10, 11, 12, 
+        13, 0, 14, 0, 0, 1, 2, 0, 1, 15, 16, 17, 2, 0, 3, 3, 
+        4, 0, 0, 0, 5, 6, 0, 0, 7, 8, 0, 0, 9, 0, 0, 10, 
+        11, 12, 13, 0, 14, 0, 0, 0, 0, 0, 1, 15, 16, 17, 2, 0, 
+        3, 4, 4, 0, 0, 0, 5, 6, 18, 0, 7, 8, 0, 0, 9, 0, 
+        0, 10, 11, 12, 13, 0, 14, 0, 0, 1, 2, 0, 1, 15, 16, 17, 
+        2, 0, 3, 3, 4, 0, 0, 0, 5, 6, 18, 0, 7, 8, 0, 0, 
+        9, 0, 0, 10, 11, 12, 13, 0, 14, 0, 0, 0, 0, 0, 1, 15, 
+        16, 17, 2, 0, 3, 4, 4, 0, 0, 0, 5, 6, 18, 0, 7, 8, 
+        0, 0, 9, 0, 0, 10, 11, 12, 13, 0, 14, 0, 0, 1, 2, 0, 
+        1, 15, 16, 17, 2, 0, 3, 3, 4, 0, 0, 0, 5, 6, 18, 0, 
+        7, 8, 0, 0, 9, 0, 0, 10, 11, 12, 13, 0, 14, 0, 0, 0, 
+        0, 0, 1, 15, 16, 17, 2, 0, 3, 4, 4, 0, 0, 0, 5, 6, 
+        18, 0, 7, 8, 0, 0, 9, 0, 0, 10, 11, 12, 13, 0, 14, 0, 
+        0, 0, 0, 0, 1, 15, 16, 17, 2, 0, 3, 0, 4, 0, 0, 0, 
+        5, 6, 18, 0, 7, 8, 0, 0, 9, 0, 0, 10, 11, 12, 13, 0, 
+        14, 0, 0, 0, 0, 0, 1, 15, 16, 17, 2, 0, 3, 0, 4, 0, 
+        0, 0, 5, 6, 0, 0, 7, 8, 0, 0, 9, 0, 0, 10, 11, 12, 
+        13, 0, 14, 0, 0, 0, 0, 0, 1, 15, 16, 17, 2, 0, 3, 0, 
+        4, 0, 0, 0, 5, 6, 0, 0, 7, 8, 0, 0, 9, 0, 0, 10, 
+        11, 12, 13, 0, 14, 0, 0, 0, 0, 0, 1, 15, 16, 17, 2, 0, 
+        3, 0, 4, 0, 0, 0, 5, 6, 0, 0, 7, 8, 0, 0, 9, 0, 
+        0, 10, 11, 12, 13, 0, 14, 0, 0, 0, 0, 0, 0, 15, 16, 17, 
+        0, 1, 2, 0, 3, 0, 4, 0, 0, 0, 0, 5, 6, 0, 1, 2, 
+        0, 3, 0, 4, 0, 0, 0, 0, 5, 0, 7, 8, 9, 10, 11, 12, 
+        13, 14, 0, 0, 0, 0, 1, 2, 0, 3, 0, 4, 0, 15, 6, 16, 
+        5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 7, 
+        8, 9, 10, 11, 12, 13, 14, 1, 2, 3, 4, 5, 6, 7, 8, 9, 
+        10, 0, 15, 0, 16, 0, 0, 11, 12, 0, 13, 0, 0, 0, 14, 15, 
+        0, 1, 2, 0, 3, 0, 4, 0, 0, 0, 0, 5, 6, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 8, 9, 10, 
+        11, 12, 0, 0, 0, 0, 1, 2, 0, 3, 0, 4, 0, 13, 0, 14, 
+        5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 7, 8, 9, 10, 11, 12, 0, 0, 1, 2, 0, 3, 0, 4, 0, 
+        0, 0, 13, 5, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 6, 7, 8, 9, 10, 11, 0, 0, 1, 2, 0, 3, 
+        0, 4, 0, 0, 0, 12, 5, 13, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 6, 7, 8, 9, 10, 11, 0, 0, 1, 
+        2, 0, 3, 0, 4, 0, 0, 0, 12, 5, 13, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 7, 8, 9, 10, 
+        0, 0, 1, 2, 0, 3, 0, 4, 0, 0, 0, 11, 5, 12, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 7, 
+        8, 9, 10, 0, 0, 1, 2, 0, 3, 0, 4, 0, 0, 0, 11, 5, 
+        12, 0, 0, 0, 0, 0, 0, 1, 2, 0, 3, 0, 4, 0, 0, 0, 
+        0, 5, 6, 7, 8, 9, 0, 0, 1, 2, 0, 3, 0, 4, 0, 0, 
+        0, 10, 5, 11, 6, 7, 8, 9, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 10, 0, 11, 6, 7, 8, 0, 0, 0, 0, 0, 0, 0, 
+        0, 0, 0, 0, 9, 0, 10
+    };
+static const util::comb_vector s_TerminalIndex(s_TerminalIndex_base, s_TerminalIndex_check, s_TerminalIndex_offset, 440, 9975);
+
+static const int s_NonterminalIndex_base[] = {
+        647, 173, -69, 103, 140, 217, -95, -51, 347, 352, 389, 46, 733, 792, 129, 0, 
+        171, 0, 794, 829, 920, 996, 224, -108, -13, 255, 327, 1367, 1519, -225, -97, -37, 
+        385, 35, 21, 0, 448, 104, -124, 0, -82, 1652, 0, 434, 344, 420, -105, 10, 
+        480, 198, -62, 88, 330, 0, 619, 0, -99, -97, 479, -80, -91, -170, -7, -18, 
+        -164, 6, 0, 0, 48, -28, 13, 1728, 709, -127, -94, -75, 88, 26, -64, 633, 
+        0, 90, 1054, 115, 0, 120, 2, 18, 31, 1073, 0, 0, -21, 180, 123, 17, 
+        1076, 1747, 6, 180, 0, 236, 3, 238, 196, 209, 6, 230, 213, 0, 465, 0, 
+        546, 121, 123, 132, 134, 136, 149, 152, 821, 382, 1165, 0, 0, 0, 0, 0, 
+        0, 160, 173, 176, 179, 0, 2211, 2230, 373, 381, 384, 383, 389, 0, 0, 0, 
+        0, 0, 0, 0, 0, 2249, 1644, 0, 1804, 0, 1131, 0, 376, 0, 0, 498, 
+        29, -1, 1879, 136, 885, 252, 271, 0, 331, 0, 0, 312, 0, 1188, 237, 0, 
+        57, 441, 0, 0, 2062, 2081, 249, 254, 978, 1207, 0, 0, 260, 265, 276, 287, 
+        0, 0, 0, 2268, 0, 0, 2170, 0, 0, 843, 0, 0, 0, 0, 557, 0, 
+        0, 251, 229, 2087, 2040, 1967, 1948, 1264, 387, 295, 0, 436, 414, 0, 0, 0, 
+        0, 0, 0, 0, 0, 0, 0, 0, 1663, 0, 0, 1720, 0, 0, 18, 0, 
+        0, 0, 1283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+        0, 152, 1739, 443, 0, 447, 0, 588, 1952, 1340, 0, 195, 316, 590, 0, 0, 
+        323, 442, 0, 2104, 2119, 331, 334, 335, 337, 341, 344, 346, 349, 360, 725, 361, 
+        365, 371, 383, 384, 397, 388, 390, 1796, 0, 21, 0, 0, 616, 0, 0, 395, 
+        402, 0, 595, 597, 596, 594, 595, 0, 0, 0, 0, 0, 0, 520, 0, 0, 
+        0, 0, 171, 0, 898, 0, 1359, 0, 0, 1416, 1435, 305, 0, 90, 0, 0, 
+        1815, 0, 419, 0, 0, 538, 0, 0, 0, 0, 0, 425, 429, 317, 1492, 0, 
+        2030, 0, 0, 442, 0, 444, 445, 446, 0, 448, 0, 0, 0, 457, 0, 0, 
+        458, 465, 1891, 1511, 0, 324, 0, 0, 917, 0, 0, 0, 0, 0, 0, 0, 
+        555, 468, 471, 475, 476, 479, 0, 0, 0, 0, 0, 482, 84, 680, 1872, 0, 
+        0, 0, 0, 1568, 997, 458, 477, 611, 0, 489, 490, 493, 496, 2014, 2060, 497, 
+        498, 503, 504, 505, 1587, 513, 519, 521, 522, 0, 0, 0, 0, 0, 0, 523, 
+        524, 0, 0, 630, 764, 536, 0, 0
+    };
+
+static const int s_NonterminalIndex_check[] = {
+        161, 161, 161, 161, 6, 2, 161, 29, 161, 60, 60, 38, 38, 161, 161, 38, 
+        38, 161, 161, 238, 238, 238, 238, 7, 40, 238, 102, 238, 50, 106, 46, 46, 
+        238, 238, 46, 46, 238, 238, 161, 23, 56, 161, 57, 161, 34, 161, 297, 297, 
+        2, 161, 30, 161, 161, 161, 161, 161, 161, 238, 33, 59, 238, 24, 238, 61, 
+        238, 62, 7, 63, 238, 64, 238, 238, 238, 238, 238, 238, 106, 176, 2, 176, 
+        176, 102, 102, 106, 106, 396, 106, 106, 65, 102, 102, 102, 106, 106, 106, 34, 
+        7, 102, 34, 34, 98, 34, 69, 70, 33, 33, 73, 34, 34, 34, 31, 51, 
+        33, 33, 106, 33, 33, 396, 92, 106, 11, 33, 33, 33, 23, 297, 92, 161, 
+        161, 161, 161, 161, 161, 161, 24, 30, 161, 161, 34, 74, 161, 161, 297, 176, 
+        176, 176, 238, 238, 238, 238, 238, 238, 238, 257, 257, 257, 257, 47, 75, 257, 
+        238, 257, 76, 11, 95, 77, 257, 257, 34, 78, 257, 257, 322, 322, 322, 322, 
+        160, 3, 322, 33, 322, 33, 33, 68, 68, 322, 322, 68, 68, 322, 322, 257, 
+        51, 11, 257, 31, 257, 3, 257, 81, 81, 81, 257, 14, 257, 257, 257, 257, 
+        257, 257, 322, 92, 92, 322, 4, 322, 37, 322, 83, 163, 3, 322, 85, 322, 
+        322, 322, 322, 322, 322, 163, 210, 210, 163, 210, 4, 86, 102, 333, 210, 98, 
+        163, 163, 47, 210, 210, 16, 14, 210, 210, 95, 3, 87, 209, 209, 297, 209, 
+        1, 4, 94, 94, 209, 160, 94, 94, 88, 209, 209, 33, 210, 209, 209, 210, 
+        49, 210, 99, 210, 14, 1, 1, 210, 257, 257, 257, 257, 257, 257, 257, 4, 
+        16, 49, 209, 5, 49, 209, 257, 209, 166, 209, 22, 322, 322, 322, 322, 322, 
+        322, 322, 331, 331, 331, 331, 93, 5, 331, 322, 331, 49, 267, 267, 16, 331, 
+        331, 51, 333, 331, 331, 373, 373, 373, 373, 25, 101, 373, 103, 373, 5, 104, 
+        3, 37, 373, 373, 349, 22, 373, 373, 331, 49, 165, 331, 105, 331, 107, 331, 
+        108, 52, 113, 331, 114, 331, 331, 331, 331, 331, 331, 373, 5, 115, 373, 116, 
+        373, 117, 373, 22, 25, 4, 373, 166, 373, 373, 373, 373, 373, 373, 118, 121, 
+        121, 119, 121, 349, 166, 166, 166, 121, 166, 129, 349, 349, 121, 349, 349, 52, 
+        52, 26, 25, 349, 349, 349, 130, 52, 52, 131, 52, 52, 132, 99, 136, 44, 
+        52, 52, 52, 44, 44, 8, 292, 292, 137, 349, 9, 44, 267, 138, 349, 49, 
+        139, 331, 331, 331, 331, 331, 331, 331, 140, 8, 349, 156, 26, 168, 9, 331, 
+        44, 44, 5, 171, 373, 373, 373, 373, 373, 373, 373, 405, 405, 405, 405, 10, 
+        8, 405, 373, 405, 32, 9, 174, 103, 405, 405, 26, 177, 405, 405, 406, 406, 
+        406, 406, 182, 10, 406, 165, 406, 183, 110, 32, 32, 406, 406, 188, 8, 406, 
+        406, 405, 189, 9, 405, 292, 405, 45, 405, 43, 10, 43, 405, 190, 405, 405, 
+        405, 405, 405, 405, 406, 43, 292, 406, 191, 406, 36, 406, 45, 45, 216, 406, 
+        217, 406, 406, 406, 406, 406, 406, 110, 10, 219, 43, 43, 220, 259, 110, 110, 
+        261, 110, 110, 112, 112, 268, 112, 110, 110, 110, 48, 112, 272, 273, 206, 206, 
+        112, 206, 58, 112, 277, 36, 206, 278, 279, 159, 280, 206, 206, 110, 281, 206, 
+        206, 282, 110, 283, 8, 159, 284, 58, 58, 9, 405, 405, 405, 405, 405, 405, 
+        405, 285, 287, 36, 206, 48, 288, 206, 405, 206, 159, 159, 289, 406, 406, 406, 
+        406, 406, 406, 406, 407, 407, 407, 407, 290, 291, 407, 406, 407, 293, 10, 294, 
+        300, 407, 407, 48, 303, 407, 407, 435, 435, 435, 435, 304, 306, 435, 384, 435, 
+        307, 308, 54, 309, 435, 435, 310, 317, 435, 435, 407, 384, 338, 407, 341, 407, 
+        79, 407, 347, 384, 384, 407, 348, 407, 407, 407, 407, 407, 407, 435, 0, 263, 
+        435, 269, 435, 355, 435, 357, 358, 359, 435, 361, 435, 435, 435, 435, 435, 435, 
+        54, 54, 365, 368, 263, 263, 269, 269, 54, 54, 369, 54, 54, 385, 79, 79, 
+        386, 54, 54, 54, 387, 388, 79, 79, 389, 79, 79, 395, 0, 0, 397, 79, 
+        79, 79, 409, 410, 0, 0, 411, 0, 0, 412, 415, 416, 72, 0, 0, 0, 
+        417, 418, 419, 407, 407, 407, 407, 407, 407, 407, 421, 286, 286, 286, 286, 286, 
+        422, 407, 423, 424, 431, 432, 435, 435, 435, 435, 435, 435, 435, 436, 436, 436, 
+        436, 437, -1, 436, 435, 436, -1, -1, -1, -1, 436, 436, -1, -1, 436, 436, 
+        -1, -1, -1, 72, 72, -1, 0, 0, 0, 0, 0, 72, 72, 72, 72, -1, 
+        -1, 72, -1, 436, 72, -1, 436, 12, 436, -1, 436, 286, 286, 286, 436, -1, 
+        436, 436, 436, 436, 436, 436, 120, 120, 120, 120, -1, 12, 120, 286, 120, -1, 
+        -1, -1, -1, 120, 120, -1, -1, 120, 120, -1, 120, -1, 201, 201, 286, 201, 
+        -1, -1, 12, -1, 201, -1, -1, -1, 120, 201, 201, -1, 120, 201, 201, 120, 
+        -1, 120, 13, 120, 18, -1, -1, 120, -1, 120, 120, 120, 120, 120, 120, -1, 
+        12, -1, 201, -1, -1, 201, 13, -1, 18, -1, -1, -1, 436, 436, 436, 436, 
+        436, 436, 436, 324, 324, 324, 324, 19, -1, 324, 436, 324, -1, 13, -1, 18, 
+        324, 324, -1, -1, 324, 324, 376, 376, 376, 376, -1, 19, 376, -1, 376, -1, 
+        -1, -1, -1, 376, 376, -1, -1, 376, 376, 324, -1, 13, 324, 18, 324, -1, 
+        324, -1, 19, -1, 324, -1, 324, 324, 324, 324, 324, 324, 376, -1, -1, 376, 
+        -1, 376, -1, 376, -1, -1, 12, 376, 164, 376, 376, 376, 376, 376, 376, -1, 
+        19, -1, 164, 184, 184, 164, 184, 184, 184, 184, -1, 184, -1, 164, 164, -1, 
+        184, 184, 20, -1, 184, 184, 404, 404, 404, 404, -1, -1, 404, -1, 404, -1, 
+        -1, -1, -1, 404, 404, -1, 20, 404, 404, 184, -1, -1, 184, -1, 184, -1, 
+        184, 13, -1, 18, 184, 324, 184, 184, 184, 184, 184, 184, 404, 20, -1, 404, 
+        324, 404, -1, 404, -1, -1, -1, 404, 376, 404, 404, 404, 404, 404, 404, 82, 
+        82, -1, 82, 376, -1, -1, 19, 82, -1, -1, -1, 20, 82, 82, 21, -1, 
+        82, 82, 89, 89, -1, 89, -1, -1, 89, -1, 89, -1, -1, -1, -1, 89, 
+        89, -1, 21, 89, 89, 82, -1, -1, 82, -1, 82, 96, 82, -1, -1, -1, 
+        82, -1, 82, 82, 82, 82, 82, 82, 89, 21, -1, 89, -1, 89, -1, 89, 
+        -1, -1, 82, 89, -1, 89, 89, 89, 89, 89, 89, -1, 154, 154, -1, 154, 
+        -1, -1, 154, 404, 154, -1, -1, 21, -1, 154, 154, -1, -1, 154, 154, -1, 
+        -1, 20, 96, 96, -1, 89, -1, -1, -1, 82, 96, 96, 96, 96, 122, 122, 
+        96, 122, 154, 96, -1, 154, 122, 154, -1, 154, -1, 122, -1, 154, -1, 154, 
+        154, 154, 154, 154, 154, 173, 173, 173, 173, -1, -1, 173, -1, 173, -1, -1, 
+        -1, -1, 173, 173, -1, -1, 173, 173, 185, 185, 185, 185, -1, -1, 185, 154, 
+        185, -1, -1, -1, -1, 185, 185, -1, -1, 185, 185, 173, -1, 21, 173, -1, 
+        173, -1, 173, -1, -1, -1, 173, -1, 173, 173, 173, 173, 173, 173, 185, -1, 
+        -1, 185, -1, 185, -1, 185, -1, -1, -1, 185, -1, 185, 185, 185, 185, 185, 
+        185, 215, 215, 215, 215, -1, -1, 215, -1, 215, -1, -1, -1, -1, 215, 215, 
+        -1, -1, 215, 215, 242, 242, 242, 242, -1, -1, 242, -1, 242, -1, -1, -1, 
+        -1, 242, 242, -1, -1, 242, 242, 215, -1, -1, 215, -1, 215, -1, 215, -1, 
+        -1, -1, 215, -1, 215, 215, 215, 215, 215, 215, 242, -1, -1, 242, -1, 242, 
+        -1, 242, -1, -1, -1, 242, -1, 242, 242, 242, 242, 242, 242, 265, 265, -1, 
+        265, -1, -1, -1, -1, 265, -1, -1, -1, -1, 265, 265, -1, -1, 265, 265, 
+        326, 326, 326, 326, -1, -1, 326, -1, 326, -1, -1, -1, -1, 326, 326, -1, 
+        -1, 326, 326, 265, -1, -1, 265, -1, 265, -1, 265, -1, -1, -1, 265, -1, 
+        265, 265, 265, 265, 265, 265, 326, -1, -1, 326, -1, 326, -1, 326, -1, -1, 
+        265, 326, -1, 326, 326, 326, 326, 326, 326, 329, 329, 329, 329, -1, -1, 329, 
+        -1, 329, -1, -1, -1, -1, 329, 329, -1, -1, 329, 329, 330, 330, 330, 330, 
+        -1, 27, 330, -1, 330, -1, -1, 265, -1, 330, 330, -1, -1, 330, 330, 329, 
+        -1, -1, 329, -1, 329, 27, 329, -1, -1, -1, 329, -1, 329, 329, 329, 329, 
+        329, 329, 330, -1, -1, 330, -1, 330, -1, 330, -1, -1, 27, 330, -1, 330, 
+        330, 330, 330, 330, 330, 350, 350, -1, 350, -1, -1, -1, -1, 350, -1, -1, 
+        -1, -1, 350, 350, -1, -1, 350, 350, 371, 371, 27, 371, -1, -1, 371, -1, 
+        371, -1, -1, -1, -1, 371, 371, -1, -1, 371, 371, 350, -1, -1, 350, -1, 
+        350, -1, 350, -1, -1, -1, 350, -1, 350, 350, 350, 350, 350, 350, 371, -1, 
+        -1, 371, -1, 371, -1, 371, -1, -1, 350, 371, -1, 371, 371, 371, 371, 371, 
+        371, 403, 403, 403, 403, -1, -1, 403, -1, 403, -1, -1, -1, -1, 403, 403, 
+        -1, -1, 403, 403, 420, 420, 420, 420, -1, 28, 420, 371, 420, -1, -1, 350, 
+        27, 420, 420, -1, -1, 420, 420, 403, -1, -1, 403, -1, 403, 28, 403, -1, 
+        -1, -1, 403, -1, 403, 403, 403, 403, 403, 403, 420, -1, -1, 420, -1, 420, 
+        -1, 420, -1, -1, 28, 420, -1, 420, 420, 420, 420, 420, 420, 150, 150, -1, 
+        150, -1, -1, -1, -1, 150, -1, -1, -1, -1, 150, 150, -1, -1, 150, 150, 
+        232, 232, 28, 232, -1, -1, 232, -1, 232, -1, -1, -1, -1, 232, 232, -1, 
+        -1, 232, 232, 150, -1, -1, 150, -1, 150, -1, 150, -1, -1, -1, 150, -1, 
+        150, 150, 150, 150, 150, 150, 232, -1, -1, 232, -1, 232, -1, 232, -1, -1, 
+        150, 232, -1, 232, 232, 232, 232, 232, 232, 235, 235, -1, 235, -1, 41, -1, 
+        -1, 235, -1, -1, -1, -1, 235, 235, -1, -1, 235, 235, 258, 258, -1, 258, 
+        -1, -1, 41, -1, 258, -1, -1, -1, 28, 258, 258, -1, -1, 258, 258, 235, 
+        -1, -1, 235, -1, 235, -1, 235, -1, -1, 41, 235, -1, 235, 235, 235, 235, 
+        235, 235, 258, -1, -1, 258, -1, 258, -1, 258, -1, -1, 235, 258, -1, 258, 
+        258, 258, 258, 258, 258, 295, 295, 41, 295, -1, 71, 295, -1, 295, -1, 258, 
+        -1, -1, 295, 295, -1, -1, 295, 295, 336, 336, -1, 336, -1, 97, 71, -1, 
+        336, -1, -1, -1, -1, 336, 336, -1, -1, 336, 336, 295, -1, -1, 295, -1, 
+        295, 97, 295, -1, -1, 71, 295, -1, 295, 295, 295, 295, 295, 295, 336, -1, 
+        -1, 336, -1, 336, -1, 336, -1, -1, 97, 336, -1, 336, 336, 336, 336, 336, 
+        336, 398, 398, 71, 398, -1, 152, 398, -1, 398, -1, 336, -1, 41, 398, 398, 
+        -1, -1, 398, 398, 370, 370, 97, 370, -1, -1, 152, -1, 370, -1, -1, -1, 
+        -1, 370, 370, -1, -1, 370, 370, 398, -1, -1, 398, -1, 398, -1, 398, -1, 
+        -1, 152, 398, -1, 398, 398, 398, 398, 398, 398, 370, -1, -1, 370, -1, 370, 
+        -1, 370, -1, -1, -1, 370, -1, 370, 370, 370, 370, 370, 370, 214, 214, 152, 
+        214, 162, -1, -1, -1, 214, -1, -1, -1, 71, 214, 214, -1, -1, 214, 214, 
+        213, 213, -1, 213, -1, 162, -1, 264, 213, 264, -1, -1, 97, 213, 213, -1, 
+        -1, 213, 213, 214, -1, -1, 214, -1, 214, -1, 214, -1, 162, -1, 214, -1, 
+        214, 214, 214, 214, -1, -1, 213, -1, -1, 213, -1, 213, -1, 213, -1, 413, 
+        413, 213, 413, 213, 213, 213, 264, 413, -1, -1, 162, -1, 413, 264, 264, -1, 
+        264, 264, -1, -1, -1, 152, 264, 264, 264, 212, 212, -1, 212, -1, -1, -1, 
+        -1, 212, -1, -1, -1, 352, 212, 212, 264, -1, 212, 212, 264, 414, 414, -1, 
+        414, 264, -1, -1, -1, 414, -1, -1, -1, 264, 414, 264, 264, -1, 180, 212, 
+        -1, -1, 212, -1, 212, 180, 212, -1, 211, 211, 212, 211, 212, 212, -1, -1, 
+        211, 181, -1, -1, 352, 211, 211, -1, 181, 211, 211, 352, 352, -1, 352, 352, 
+        162, -1, -1, -1, 352, 352, 352, -1, 275, -1, -1, -1, -1, -1, 211, 275, 
+        -1, 211, -1, 211, -1, 211, -1, 276, -1, 211, -1, 211, 180, 180, 276, 352, 
+        -1, -1, -1, -1, 180, 180, 180, -1, -1, -1, 180, -1, -1, 180, -1, 181, 
+        181, -1, -1, -1, -1, -1, -1, 181, 181, 181, -1, 198, 198, 181, 198, -1, 
+        181, -1, -1, 198, -1, -1, 275, 275, 198, 198, -1, -1, 198, 198, 275, 275, 
+        275, -1, -1, -1, 275, 276, 276, 275, -1, -1, -1, -1, -1, 276, 276, 276, 
+        -1, 198, -1, 276, 134, 134, 276, 134, -1, -1, -1, -1, 134, -1, -1, -1, 
+        -1, 134, 134, -1, -1, 134, 134, 135, 135, -1, 135, -1, -1, -1, -1, 135, 
+        -1, -1, -1, -1, 135, 135, -1, -1, 135, 135, 149, 149, -1, 149, -1, -1, 
+        -1, -1, 149, -1, -1, -1, -1, 149, 149, -1, -1, 149, 149, 195, 195, -1, 
+        195, -1, -1, -1, -1, 195, -1, -1, -1, -1, 195, 195, -1, -1, 195, 195
+    };
+
+static const int s_NonterminalIndex_offset[] = {
+        0, 1, 2, 3, 0, 0, 4, 0, 5, 0, 1, 0, 1, 6, 7, 2, 
+        3, 8, 9, 0, 1, 2, 3, 0, 0, 4, 0, 5, 0, 0, 0, 1, 
+        6, 7, 2, 3, 8, 9, 10, 0, 0, 11, 0, 12, 0, 13, 0, 1, 
+        1, 14, 0, 15, 16, 17, 18, 19, 20, 10, 0, 0, 11, 0, 12, 0, 
+        13, 0, 1, 0, 14, 0, 15, 16, 17, 18, 19, 20, 1, 0, 2, 1, 
+        2, 1, 2, 2, 3, 0, 4, 5, 0, 3, 4, 5, 6, 7, 8, 1, 
+        2, 6, 2, 3, 0, 4, 0, 0, 1, 2, 0, 5, 6, 7, 0, 0, 
+        3, 4, 9, 5, 6, 1, 0, 10, 0, 7, 8, 9, 1, 2, 1, 21, 
+        22, 23, 24, 25, 26, 27, 1, 1, 28, 29, 8, 0, 30, 31, 3, 3, 
+        4, 5, 21, 22, 23, 24, 25, 26, 27, 0, 1, 2, 3, 0, 0, 4, 
+        28, 5, 0, 1, 0, 0, 6, 7, 9, 0, 8, 9, 0, 1, 2, 3, 
+        0, 0, 4, 10, 5, 11, 12, 0, 1, 6, 7, 2, 3, 8, 9, 10, 
+        1, 2, 11, 1, 12, 1, 13, 0, 1, 2, 14, 0, 15, 16, 17, 18, 
+        19, 20, 10, 2, 3, 11, 0, 12, 0, 13, 0, 0, 2, 14, 0, 15, 
+        16, 17, 18, 19, 20, 1, 0, 1, 2, 2, 1, 0, 7, 0, 3, 1, 
+        3, 4, 1, 4, 5, 0, 1, 6, 7, 1, 3, 0, 0, 1, 4, 2, 
+        0, 2, 0, 1, 3, 1, 2, 3, 0, 4, 5, 13, 8, 6, 7, 9, 
+        0, 10, 0, 11, 2, 1, 2, 12, 21, 22, 23, 24, 25, 26, 27, 3, 
+        1, 1, 8, 0, 2, 9, 28, 10, 0, 11, 0, 21, 22, 23, 24, 25, 
+        26, 27, 0, 1, 2, 3, 0, 1, 4, 28, 5, 3, 0, 1, 2, 6, 
+        7, 2, 1, 8, 9, 0, 1, 2, 3, 0, 0, 4, 0, 5, 2, 0, 
+        4, 1, 6, 7, 0, 1, 8, 9, 10, 4, 0, 11, 0, 12, 0, 13, 
+        0, 0, 0, 14, 0, 15, 16, 17, 18, 19, 20, 10, 3, 0, 11, 0, 
+        12, 0, 13, 2, 1, 4, 14, 1, 15, 16, 17, 18, 19, 20, 0, 0, 
+        1, 0, 2, 1, 2, 3, 4, 3, 5, 0, 2, 3, 4, 4, 5, 1, 
+        2, 0, 2, 6, 7, 8, 0, 3, 4, 0, 5, 6, 0, 1, 0, 0, 
+        7, 8, 9, 1, 2, 0, 0, 1, 0, 9, 0, 3, 2, 0, 10, 5, 
+        0, 21, 22, 23, 24, 25, 26, 27, 0, 1, 11, 0, 1, 0, 1, 28, 
+        4, 5, 4, 0, 21, 22, 23, 24, 25, 26, 27, 0, 1, 2, 3, 0, 
+        2, 4, 28, 5, 0, 2, 0, 1, 6, 7, 2, 0, 8, 9, 0, 1, 
+        2, 3, 0, 1, 4, 1, 5, 0, 0, 1, 2, 6, 7, 0, 3, 8, 
+        9, 10, 0, 3, 11, 2, 12, 0, 13, 0, 2, 1, 14, 0, 15, 16, 
+        17, 18, 19, 20, 10, 2, 3, 11, 0, 12, 0, 13, 1, 2, 0, 14, 
+        0, 15, 16, 17, 18, 19, 20, 1, 3, 0, 3, 4, 0, 0, 2, 3, 
+        0, 4, 5, 0, 1, 0, 2, 6, 7, 8, 0, 3, 0, 0, 0, 1, 
+        4, 2, 0, 5, 0, 1, 3, 0, 0, 0, 0, 4, 5, 9, 0, 6, 
+        7, 0, 10, 0, 4, 1, 0, 1, 2, 4, 21, 22, 23, 24, 25, 26, 
+        27, 0, 0, 2, 8, 1, 0, 9, 28, 10, 2, 3, 0, 21, 22, 23, 
+        24, 25, 26, 27, 0, 1, 2, 3, 0, 0, 4, 28, 5, 0, 4, 0, 
+        0, 6, 7, 2, 0, 8, 9, 0, 1, 2, 3, 0, 0, 4, 0, 5, 
+        0, 0, 0, 0, 6, 7, 0, 0, 8, 9, 10, 1, 0, 11, 0, 12, 
+        0, 13, 0, 2, 3, 14, 0, 15, 16, 17, 18, 19, 20, 10, 0, 0, 
+        11, 0, 12, 0, 13, 0, 0, 0, 14, 0, 15, 16, 17, 18, 19, 20, 
+        1, 2, 0, 0, 1, 2, 1, 2, 3, 4, 0, 5, 6, 0, 1, 2, 
+        0, 7, 8, 9, 0, 0, 3, 4, 0, 5, 6, 0, 1, 2, 0, 7, 
+        8, 9, 0, 0, 3, 4, 0, 5, 6, 0, 0, 0, 0, 7, 8, 9, 
+        0, 0, 0, 21, 22, 23, 24, 25, 26, 27, 0, 0, 1, 2, 3, 4, 
+        0, 28, 0, 0, 0, 0, 21, 22, 23, 24, 25, 26, 27, 0, 1, 2, 
+        3, 0, 0, 4, 28, 5, 0, 0, 0, 0, 6, 7, 0, 0, 8, 9, 
+        0, 0, 0, 1, 2, 0, 10, 11, 12, 13, 14, 3, 4, 5, 6, 0, 
+        0, 7, 0, 10, 8, 0, 11, 0, 12, 0, 13, 5, 6, 7, 14, 0, 
+        15, 16, 17, 18, 19, 20, 0, 1, 2, 3, 0, 1, 4, 8, 5, 0, 
+        0, 0, 0, 6, 7, 0, 0, 8, 9, 0, 10, 0, 0, 1, 9, 2, 
+        0, 0, 2, 0, 3, 0, 0, 0, 11, 4, 5, 0, 12, 6, 7, 13, 
+        0, 14, 0, 15, 0, 0, 0, 16, 0, 17, 18, 19, 20, 21, 22, 0, 
+        3, 0, 8, 0, 0, 9, 1, 0, 1, 0, 0, 0, 21, 22, 23, 24, 
+        25, 26, 27, 0, 1, 2, 3, 0, 0, 4, 28, 5, 0, 2, 0, 2, 
+        6, 7, 0, 0, 8, 9, 0, 1, 2, 3, 0, 1, 4, 0, 5, 0, 
+        0, 0, 0, 6, 7, 0, 0, 8, 9, 10, 0, 3, 11, 3, 12, 0, 
+        13, 0, 2, 0, 14, 0, 15, 16, 17, 18, 19, 20, 10, 0, 0, 11, 
+        0, 12, 0, 13, 0, 0, 4, 14, 0, 15, 16, 17, 18, 19, 20, 0, 
+        3, 0, 1, 0, 1, 2, 2, 3, 4, 5, 0, 6, 0, 3, 4, 0, 
+        7, 8, 0, 0, 9, 10, 0, 1, 2, 3, 0, 0, 4, 0, 5, 0, 
+        0, 0, 0, 6, 7, 0, 1, 8, 9, 11, 0, 0, 12, 0, 13, 0, 
+        14, 4, 0, 4, 15, 21, 16, 17, 18, 19, 20, 21, 10, 2, 0, 11, 
+        22, 12, 0, 13, 0, 0, 0, 14, 21, 15, 16, 17, 18, 19, 20, 0, 
+        1, 0, 2, 22, 0, 0, 4, 3, 0, 0, 0, 3, 4, 5, 0, 0, 
+        6, 7, 0, 1, 0, 2, 0, 0, 3, 0, 4, 0, 0, 0, 0, 5, 
+        6, 0, 1, 7, 8, 8, 0, 0, 9, 0, 10, 0, 11, 0, 0, 0, 
+        12, 0, 13, 14, 15, 16, 17, 18, 9, 2, 0, 10, 0, 11, 0, 12, 
+        0, 0, 19, 13, 0, 14, 15, 16, 17, 18, 19, 0, 0, 1, 0, 2, 
+        0, 0, 3, 21, 4, 0, 0, 3, 0, 5, 6, 0, 0, 7, 8, 0, 
+        0, 4, 1, 2, 0, 20, 0, 0, 0, 20, 3, 4, 5, 6, 0, 1, 
+        7, 2, 9, 8, 0, 10, 3, 11, 0, 12, 0, 4, 0, 13, 0, 14, 
+        15, 16, 17, 18, 19, 0, 1, 2, 3, 0, 0, 4, 0, 5, 0, 0, 
+        0, 0, 6, 7, 0, 0, 8, 9, 0, 1, 2, 3, 0, 0, 4, 20, 
+        5, 0, 0, 0, 0, 6, 7, 0, 0, 8, 9, 10, 0, 4, 11, 0, 
+        12, 0, 13, 0, 0, 0, 14, 0, 15, 16, 17, 18, 19, 20, 10, 0, 
+        0, 11, 0, 12, 0, 13, 0, 0, 0, 14, 0, 15, 16, 17, 18, 19, 
+        20, 0, 1, 2, 3, 0, 0, 4, 0, 5, 0, 0, 0, 0, 6, 7, 
+        0, 0, 8, 9, 0, 1, 2, 3, 0, 0, 4, 0, 5, 0, 0, 0, 
+        0, 6, 7, 0, 0, 8, 9, 10, 0, 0, 11, 0, 12, 0, 13, 0, 
+        0, 0, 14, 0, 15, 16, 17, 18, 19, 20, 10, 0, 0, 11, 0, 12, 
+        0, 13, 0, 0, 0, 14, 0, 15, 16, 17, 18, 19, 20, 0, 1, 0, 
+        2, 0, 0, 0, 0, 3, 0, 0, 0, 0, 4, 5, 0, 0, 6, 7, 
+        0, 1, 2, 3, 0, 0, 4, 0, 5, 0, 0, 0, 0, 6, 7, 0, 
+        0, 8, 9, 8, 0, 0, 9, 0, 10, 0, 11, 0, 0, 0, 12, 0, 
+        13, 14, 15, 16, 17, 18, 10, 0, 0, 11, 0, 12, 0, 13, 0, 0, 
+        19, 14, 0, 15, 16, 17, 18, 19, 20, 0, 1, 2, 3, 0, 0, 4, 
+        0, 5, 0, 0, 0, 0, 6, 7, 0, 0, 8, 9, 0, 1, 2, 3, 
+        0, 0, 4, 0, 5, 0, 0, 20, 0, 6, 7, 0, 0, 8, 9, 10, 
+        0, 0, 11, 0, 12, 1, 13, 0, 0, 0, 14, 0, 15, 16, 17, 18, 
+        19, 20, 10, 0, 0, 11, 0, 12, 0, 13, 0, 0, 2, 14, 0, 15, 
+        16, 17, 18, 19, 20, 0, 1, 0, 2, 0, 0, 0, 0, 3, 0, 0, 
+        0, 0, 4, 5, 0, 0, 6, 7, 0, 1, 3, 2, 0, 0, 3, 0, 
+        4, 0, 0, 0, 0, 5, 6, 0, 0, 7, 8, 8, 0, 0, 9, 0, 
+        10, 0, 11, 0, 0, 0, 12, 0, 13, 14, 15, 16, 17, 18, 9, 0, 
+        0, 10, 0, 11, 0, 12, 0, 0, 19, 13, 0, 14, 15, 16, 17, 18, 
+        19, 0, 1, 2, 3, 0, 0, 4, 0, 5, 0, 0, 0, 0, 6, 7, 
+        0, 0, 8, 9, 0, 1, 2, 3, 0, 0, 4, 20, 5, 0, 0, 20, 
+        4, 6, 7, 0, 0, 8, 9, 10, 0, 0, 11, 0, 12, 1, 13, 0, 
+        0, 0, 14, 0, 15, 16, 17, 18, 19, 20, 10, 0, 0, 11, 0, 12, 
+        0, 13, 0, 0, 2, 14, 0, 15, 16, 17, 18, 19, 20, 0, 1, 0, 
+        2, 0, 0, 0, 0, 3, 0, 0, 0, 0, 4, 5, 0, 0, 6, 7, 
+        0, 1, 3, 2, 0, 0, 3, 0, 4, 0, 0, 0, 0, 5, 6, 0, 
+        0, 7, 8, 8, 0, 0, 9, 0, 10, 0, 11, 0, 0, 0, 12, 0, 
+        13, 14, 15, 16, 17, 18, 9, 0, 0, 10, 0, 11, 0, 12, 0, 0, 
+        19, 13, 0, 14, 15, 16, 17, 18, 19, 0, 1, 0, 2, 0, 0, 0, 
+        0, 3, 0, 0, 0, 0, 4, 5, 0, 0, 6, 7, 0, 1, 0, 2, 
+        0, 0, 1, 0, 3, 0, 0, 0, 4, 4, 5, 0, 0, 6, 7, 8, 
+        0, 0, 9, 0, 10, 0, 11, 0, 0, 2, 12, 0, 13, 14, 15, 16, 
+        17, 18, 8, 0, 0, 9, 0, 10, 0, 11, 0, 0, 19, 12, 0, 13, 
+        14, 15, 16, 17, 18, 0, 1, 3, 2, 0, 0, 3, 0, 4, 0, 19, 
+        0, 0, 5, 6, 0, 0, 7, 8, 0, 1, 0, 2, 0, 0, 1, 0, 
+        3, 0, 0, 0, 0, 4, 5, 0, 0, 6, 7, 9, 0, 0, 10, 0, 
+        11, 1, 12, 0, 0, 2, 13, 0, 14, 15, 16, 17, 18, 19, 8, 0, 
+        0, 9, 0, 10, 0, 11, 0, 0, 2, 12, 0, 13, 14, 15, 16, 17, 
+        18, 0, 1, 3, 2, 0, 0, 3, 0, 4, 0, 19, 0, 4, 5, 6, 
+        0, 0, 7, 8, 0, 1, 3, 2, 0, 0, 1, 0, 3, 0, 0, 0, 
+        0, 4, 5, 0, 0, 6, 7, 9, 0, 0, 10, 0, 11, 0, 12, 0, 
+        0, 2, 13, 0, 14, 15, 16, 17, 18, 19, 8, 0, 0, 9, 0, 10, 
+        0, 11, 0, 0, 0, 12, 0, 13, 14, 15, 16, 17, 18, 0, 1, 3, 
+        2, 0, 0, 0, 0, 3, 0, 0, 0, 4, 4, 5, 0, 0, 6, 7, 
+        0, 1, 0, 2, 0, 1, 0, 0, 3, 1, 0, 0, 4, 4, 5, 0, 
+        0, 6, 7, 8, 0, 0, 9, 0, 10, 0, 11, 0, 2, 0, 12, 0, 
+        13, 14, 15, 16, 0, 0, 8, 0, 0, 9, 0, 10, 0, 11, 0, 0, 
+        1, 12, 2, 13, 14, 15, 2, 3, 0, 0, 3, 0, 4, 3, 4, 0, 
+        5, 6, 0, 0, 0, 4, 7, 8, 9, 0, 1, 0, 2, 0, 0, 0, 
+        0, 3, 0, 0, 0, 0, 4, 5, 10, 0, 6, 7, 11, 0, 1, 0, 
+        2, 12, 0, 0, 0, 3, 0, 0, 0, 13, 4, 14, 15, 0, 0, 8, 
+        0, 0, 9, 0, 10, 1, 11, 0, 0, 1, 12, 2, 13, 14, 0, 0, 
+        3, 0, 0, 0, 1, 4, 5, 0, 1, 6, 7, 2, 3, 0, 4, 5, 
+        4, 0, 0, 0, 6, 7, 8, 0, 0, 0, 0, 0, 0, 0, 8, 1, 
+        0, 9, 0, 10, 0, 11, 0, 0, 0, 12, 0, 13, 2, 3, 1, 9, 
+        0, 0, 0, 0, 4, 5, 6, 0, 0, 0, 7, 0, 0, 8, 0, 2, 
+        3, 0, 0, 0, 0, 0, 0, 4, 5, 6, 0, 0, 1, 7, 2, 0, 
+        8, 0, 0, 3, 0, 0, 2, 3, 4, 5, 0, 0, 6, 7, 4, 5, 
+        6, 0, 0, 0, 7, 2, 3, 8, 0, 0, 0, 0, 0, 4, 5, 6, 
+        0, 8, 0, 7, 0, 1, 8, 2, 0, 0, 0, 0, 3, 0, 0, 0, 
+        0, 4, 5, 0, 0, 6, 7, 0, 1, 0, 2, 0, 0, 0, 0, 3, 
+        0, 0, 0, 0, 4, 5, 0, 0, 6, 7, 0, 1, 0, 2, 0, 0, 
+        0, 0, 3, 0, 0, 0, 0, 4, 5, 0, 0, 6, 7, 0, 1, 0, 
+        2, 0, 0, 0, 0, 3, 0, 0, 0, 0, 4, 5, 0, 0, 6, 7
+    };
+static const util::comb_vector s_NonterminalIndex(s_NonterminalIndex_base, s_NonterminalIndex_check, s_NonterminalIndex_offset, 440, 2288);
+
+static const lr::small_parser_tables::action_count s_ActionCounts[] = {
+    { 26, 15 }, { 6, 3 }, { 38, 3 }, { 42, 5 }, { 42, 5 }, 
+    { 42, 5 }, { 5, 1 }, { 38, 3 }, { 42, 5 }, { 42, 5 }, 
+    { 42, 5 }, { 38, 3 }, { 42, 5 }, { 42, 5 }, { 38, 3 }, 
+    { 5, 0 }, { 38, 3 }, { 5, 0 }, { 42, 5 }, { 42, 5 }, 
+    { 42, 5 }, { 42, 5 }, { 38, 3 }, { 26, 2 }, { 10, 2 }, 
+    { 38, 3 }, { 38, 3 }, { 42, 5 }, { 42, 5 }, { 3, 1 }, 
+    { 26, 2 }, { 26, 2 }, { 6, 3 }, { 26, 14 }, { 38, 10 }, 
+    { 5, 0 }, { 38, 3 }, { 11, 2 }, { 24, 4 }, { 5, 0 }, 
+    { 5, 1 }, { 43, 5 }, { 4, 0 }, { 7, 5 }, { 7, 6 }, 
+    { 6, 3 }, { 24, 4 }, { 26, 2 }, { 38, 3 }, { 43, 6 }, 
+    { 19, 1 }, { 11, 3 }, { 23, 10 }, { 34, 0 }, { 23, 10 }, 
+    { 4, 0 }, { 54, 1 }, { 31, 1 }, { 6, 3 }, { 31, 1 }, 
+    { 4, 2 }, { 3, 1 }, { 5, 1 }, { 6, 1 }, { 3, 1 }, 
+    { 5, 1 }, { 4, 0 }, { 4, 0 }, { 24, 4 }, { 4, 1 }, 
+    { 19, 1 }, { 42, 5 }, { 19, 9 }, { 11, 1 }, { 8, 1 }, 
+    { 3, 1 }, { 7, 1 }, { 54, 1 }, { 3, 1 }, { 23, 10 }, 
+    { 4, 0 }, { 25, 3 }, { 21, 21 }, { 6, 1 }, { 4, 0 }, 
+    { 5, 1 }, { 3, 1 }, { 3, 1 }, { 3, 1 }, { 21, 21 }, 
+    { 5, 0 }, { 5, 0 }, { 76, 4 }, { 4, 1 }, { 54, 4 }, 
+    { 26, 2 }, { 19, 9 }, { 42, 5 }, { 26, 2 }, { 26, 2 }, 
+    { 19, 0 }, { 7, 1 }, { 26, 8 }, { 26, 2 }, { 54, 1 }, 
+    { 31, 1 }, { 23, 11 }, { 5, 1 }, { 31, 1 }, { 4, 0 }, 
+    { 23, 11 }, { 4, 0 }, { 21, 6 }, { 45, 1 }, { 45, 1 }, 
+    { 45, 1 }, { 45, 1 }, { 45, 1 }, { 45, 1 }, { 45, 1 }, 
+    { 36, 23 }, { 20, 5 }, { 20, 5 }, { 20, 0 }, { 20, 0 }, 
+    { 20, 0 }, { 20, 0 }, { 20, 0 }, { 20, 0 }, { 45, 1 }, 
+    { 45, 1 }, { 45, 1 }, { 39, 1 }, { 28, 0 }, { 20, 8 }, 
+    { 20, 8 }, { 28, 1 }, { 25, 1 }, { 23, 1 }, { 21, 1 }, 
+    { 17, 1 }, { 15, 0 }, { 14, 0 }, { 13, 0 }, { 12, 0 }, 
+    { 11, 0 }, { 8, 0 }, { 4, 0 }, { 4, 0 }, { 20, 8 }, 
+    { 20, 20 }, { 5, 0 }, { 42, 5 }, { 5, 0 }, { 21, 21 }, 
+    { 6, 0 }, { 39, 1 }, { 9, 0 }, { 5, 0 }, { 6, 4 }, 
+    { 26, 2 }, { 34, 32 }, { 42, 5 }, { 7, 5 }, { 7, 5 }, 
+    { 26, 2 }, { 11, 6 }, { 4, 0 }, { 5, 1 }, { 5, 0 }, 
+    { 4, 0 }, { 31, 1 }, { 4, 0 }, { 20, 21 }, { 39, 1 }, 
+    { 4, 0 }, { 18, 6 }, { 4, 1 }, { 5, 0 }, { 8, 0 }, 
+    { 18, 9 }, { 18, 9 }, { 39, 1 }, { 39, 1 }, { 21, 22 }, 
+    { 20, 21 }, { 4, 0 }, { 4, 0 }, { 45, 1 }, { 45, 1 }, 
+    { 39, 1 }, { 39, 1 }, { 20, 0 }, { 20, 0 }, { 20, 0 }, 
+    { 20, 8 }, { 20, 0 }, { 20, 0 }, { 20, 9 }, { 20, 0 }, 
+    { 20, 0 }, { 20, 10 }, { 20, 0 }, { 20, 0 }, { 20, 0 }, 
+    { 20, 0 }, { 20, 11 }, { 20, 0 }, { 20, 0 }, { 20, 12 }, 
+    { 20, 13 }, { 20, 14 }, { 20, 15 }, { 20, 16 }, { 20, 17 }, 
+    { 20, 21 }, { 31, 1 }, { 39, 1 }, { 5, 0 }, { 4, 1 }, 
+    { 5, 1 }, { 20, 0 }, { 20, 0 }, { 20, 0 }, { 20, 0 }, 
+    { 20, 0 }, { 20, 0 }, { 20, 0 }, { 20, 0 }, { 20, 0 }, 
+    { 20, 0 }, { 20, 0 }, { 20, 20 }, { 5, 0 }, { 4, 0 }, 
+    { 20, 20 }, { 4, 0 }, { 4, 0 }, { 33, 29 }, { 4, 0 }, 
+    { 4, 0 }, { 4, 0 }, { 21, 21 }, { 4, 0 }, { 4, 0 }, 
+    { 42, 0 }, { 6, 0 }, { 34, 0 }, { 35, 0 }, { 35, 0 }, 
+    { 35, 0 }, { 35, 0 }, { 35, 0 }, { 35, 0 }, { 4, 0 }, 
+    { 4, 0 }, { 4, 0 }, { 34, 29 }, { 20, 20 }, { 6, 1 }, 
+    { 4, 0 }, { 5, 1 }, { 4, 0 }, { 6, 3 }, { 27, 16 }, 
+    { 21, 21 }, { 5, 0 }, { 7, 3 }, { 7, 1 }, { 6, 3 }, 
+    { 5, 0 }, { 5, 0 }, { 3, 1 }, { 5, 1 }, { 4, 0 }, 
+    { 18, 9 }, { 18, 9 }, { 3, 1 }, { 3, 1 }, { 3, 1 }, 
+    { 3, 1 }, { 3, 1 }, { 3, 1 }, { 3, 1 }, { 3, 1 }, 
+    { 3, 1 }, { 21, 10 }, { 3, 1 }, { 3, 1 }, { 3, 1 }, 
+    { 3, 1 }, { 3, 1 }, { 7, 4 }, { 3, 1 }, { 45, 1 }, 
+    { 20, 20 }, { 4, 0 }, { 7, 5 }, { 4, 0 }, { 4, 0 }, 
+    { 5, 1 }, { 4, 0 }, { 5, 0 }, { 45, 1 }, { 45, 1 }, 
+    { 28, 0 }, { 28, 1 }, { 25, 1 }, { 23, 1 }, { 21, 1 }, 
+    { 17, 1 }, { 15, 0 }, { 14, 0 }, { 13, 0 }, { 12, 0 }, 
+    { 5, 0 }, { 5, 0 }, { 5, 1 }, { 9, 0 }, { 35, 0 }, 
+    { 4, 0 }, { 35, 0 }, { 33, 29 }, { 4, 0 }, { 21, 23 }, 
+    { 4, 0 }, { 20, 21 }, { 35, 0 }, { 5, 0 }, { 20, 21 }, 
+    { 20, 21 }, { 33, 29 }, { 36, 0 }, { 57, 2 }, { 34, 0 }, 
+    { 5, 0 }, { 20, 20 }, { 5, 0 }, { 3, 1 }, { 5, 0 }, 
+    { 19, 0 }, { 5, 1 }, { 4, 0 }, { 4, 0 }, { 4, 0 }, 
+    { 4, 0 }, { 4, 0 }, { 7, 1 }, { 5, 1 }, { 24, 12 }, 
+    { 21, 21 }, { 5, 0 }, { 24, 10 }, { 4, 0 }, { 5, 0 }, 
+    { 3, 1 }, { 4, 0 }, { 3, 1 }, { 3, 1 }, { 4, 1 }, 
+    { 4, 0 }, { 3, 1 }, { 4, 0 }, { 8, 0 }, { 20, 0 }, 
+    { 4, 1 }, { 20, 0 }, { 5, 0 }, { 45, 1 }, { 45, 1 }, 
+    { 20, 19 }, { 22, 21 }, { 4, 0 }, { 33, 29 }, { 35, 0 }, 
+    { 4, 0 }, { 21, 23 }, { 35, 0 }, { 5, 0 }, { 35, 0 }, 
+    { 5, 0 }, { 5, 0 }, { 35, 0 }, { 5, 0 }, { 7, 4 }, 
+    { 3, 1 }, { 3, 1 }, { 3, 1 }, { 7, 1 }, { 7, 1 }, 
+    { 4, 0 }, { 4, 0 }, { 4, 0 }, { 4, 0 }, { 5, 0 }, 
+    { 39, 1 }, { 16, 2 }, { 7, 1 }, { 20, 20 }, { 9, 0 }, 
+    { 5, 0 }, { 6, 0 }, { 35, 0 }, { 20, 21 }, { 21, 22 }, 
+    { 33, 29 }, { 33, 29 }, { 33, 29 }, { 5, 0 }, { 7, 1 }, 
+    { 7, 1 }, { 3, 1 }, { 3, 1 }, { 20, 5 }, { 20, 5 }, 
+    { 3, 1 }, { 3, 1 }, { 3, 1 }, { 3, 1 }, { 3, 1 }, 
+    { 20, 21 }, { 3, 1 }, { 3, 1 }, { 3, 1 }, { 3, 1 }, 
+    { 5, 0 }, { 5, 0 }, { 4, 0 }, { 35, 0 }, { 35, 0 }, 
+    { 35, 0 }, { 3, 1 }, { 3, 1 }, { 5, 0 }, { 35, 0 }, 
+    { 33, 29 }, { 33, 29 }, { 3, 1 }, { 35, 0 }, { 35, 0 }
+};
+
+static const int s_EndGuardStates[] = {
+    3, 4, 5, 8, 9, 10, 12, 13, 18, 19, 20, 21, 27, 28, 37, 41, 49, 51, 61, 64, 
+    71, 73, 74, 75, 78, 86, 87, 88, 92, 97, 98, 99, 102, 103, 113, 114, 115, 116, 117, 118, 
+    119, 129, 130, 131, 132, 152, 162, 165, 174, 182, 183, 188, 189, 190, 191, 217, 267, 268, 272, 277, 
+    278, 279, 280, 281, 282, 283, 284, 285, 287, 288, 289, 290, 291, 293, 294, 297, 303, 304, 338, 347, 
+    348, 355, 357, 358, 359, 361, 365, 368, 369, 385, 386, 387, 388, 389, 395, 409, 410, 411, 412, 415, 
+    416, 417, 418, 419, 421, 422, 423, 424, 431, 432, 437
+};
+
+static const lr::small_parser_tables::reduce_rule s_ReduceRules[] = {
+    { 105, 165, 0 }, { 77, 67, 1 }, { 78, 70, 1 }, { 23, 103, 1 }, { 78, 75, 1 }, 
+    { 99, 167, 0 }, { 77, 65, 1 }, { 78, 74, 1 }, { 78, 72, 1 }, { 78, 73, 1 }, 
+    { 77, 68, 1 }, { 78, 71, 1 }, { 78, 76, 1 }, { 77, 66, 1 }, { 88, 157, 1 }, 
+    { 77, 64, 1 }, { 88, 158, 1 }, { 78, 77, 1 }, { 78, 69, 1 }, { 23, 104, 1 }, 
+    { 78, 80, 1 }, { 80, 159, 1 }, { 144, 151, 1 }, { 80, 155, 1 }, { 80, 156, 1 }, 
+    { 78, 78, 1 }, { 78, 79, 1 }, { 0, 154, 1 }, { 145, 162, 1 }, { 144, 150, 1 }, 
+    { 143, 149, 1 }, { 70, 61, 1 }, { 81, 160, 1 }, { 112, 170, 0 }, { 136, 172, 0 }, 
+    { 105, 166, 1 }, { 87, 100, 2 }, { 99, 168, 1 }, { 76, 178, 0 }, { 145, 163, 2 }, 
+    { 81, 161, 2 }, { 91, 180, 0 }, { 90, 182, 0 }, { 104, 111, 2 }, { 136, 173, 1 }, 
+    { 135, 135, 1 }, { 106, 106, 1 }, { 83, 105, 2 }, { 73, 176, 1 }, { 85, 187, 0 }, 
+    { 74, 169, 1 }, { 82, 189, 0 }, { 76, 179, 1 }, { 86, 92, 3 }, { 112, 171, 2 }, 
+    { 104, 112, 3 }, { 139, 184, 1 }, { 140, 174, 2 }, { 147, 164, 3 }, { 107, 197, 0 }, 
+    { 103, 205, 0 }, { 102, 207, 0 }, { 72, 186, 1 }, { 72, 185, 1 }, { 73, 177, 2 }, 
+    { 71, 63, 2 }, { 75, 62, 2 }, { 69, 60, 4 }, { 146, 153, 4 }, { 86, 93, 4 }, 
+    { 79, 192, 1 }, { 79, 191, 1 }, { 90, 183, 2 }, { 92, 95, 1 }, { 95, 193, 1 }, 
+    { 140, 175, 3 }, { 106, 107, 3 }, { 120, 211, 0 }, { 106, 110, 3 }, { 111, 196, 1 }, 
+    { 2, 6, 1 }, { 1, 0, 1 }, { 1, 1, 1 }, { 1, 2, 1 }, { 1, 4, 1 }, 
+    { 1, 3, 1 }, { 1, 5, 1 }, { 14, 199, 1 }, { 14, 200, 1 }, { 14, 201, 1 }, 
+    { 14, 202, 1 }, { 14, 203, 1 }, { 14, 204, 1 }, { 2, 7, 1 }, { 4, 9, 1 }, 
+    { 9, 17, 1 }, { 15, 23, 1 }, { 39, 33, 1 }, { 42, 35, 1 }, { 44, 37, 1 }, 
+    { 46, 39, 1 }, { 50, 41, 1 }, { 52, 43, 1 }, { 53, 45, 1 }, { 54, 47, 1 }, 
+    { 55, 49, 1 }, { 56, 51, 1 }, { 57, 53, 1 }, { 68, 59, 1 }, { 107, 198, 1 }, 
+    { 101, 102, 2 }, { 87, 99, 5 }, { 100, 101, 2 }, { 84, 123, 1 }, { 7, 55, 1 }, 
+    { 85, 188, 2 }, { 146, 152, 5 }, { 142, 239, 0 }, { 138, 237, 0 }, { 91, 181, 3 }, 
+    { 95, 194, 2 }, { 119, 246, 0 }, { 114, 250, 0 }, { 110, 115, 2 }, { 111, 195, 2 }, 
+    { 106, 109, 4 }, { 9, 21, 2 }, { 3, 57, 1 }, { 9, 18, 2 }, { 9, 19, 2 }, 
+    { 6, 252, 0 }, { 4, 14, 2 }, { 4, 15, 2 }, { 15, 24, 2 }, { 15, 25, 2 }, 
+    { 41, 213, 1 }, { 41, 214, 1 }, { 41, 215, 1 }, { 43, 216, 1 }, { 43, 217, 1 }, 
+    { 45, 218, 1 }, { 45, 219, 1 }, { 49, 220, 1 }, { 49, 221, 1 }, { 49, 222, 1 }, 
+    { 49, 223, 1 }, { 51, 224, 1 }, { 51, 225, 1 }, { 106, 108, 4 }, { 9, 20, 2 }, 
+    { 103, 206, 2 }, { 126, 254, 0 }, { 67, 226, 1 }, { 67, 227, 1 }, { 67, 228, 1 }, 
+    { 67, 229, 1 }, { 67, 230, 1 }, { 67, 231, 1 }, { 67, 232, 1 }, { 67, 233, 1 }, 
+    { 67, 234, 1 }, { 67, 235, 1 }, { 67, 236, 1 }, { 82, 190, 3 }, { 142, 240, 1 }, 
+    { 141, 241, 1 }, { 128, 125, 1 }, { 128, 126, 1 }, { 128, 127, 1 }, { 128, 128, 1 }, 
+    { 128, 129, 1 }, { 128, 130, 1 }, { 138, 238, 1 }, { 137, 136, 1 }, { 98, 256, 0 }, 
+    { 97, 258, 0 }, { 124, 261, 0 }, { 118, 249, 1 }, { 122, 265, 0 }, { 25, 118, 1 }, 
+    { 113, 114, 2 }, { 119, 247, 1 }, { 109, 209, 2 }, { 115, 267, 0 }, { 22, 82, 1 }, 
+    { 22, 87, 1 }, { 22, 86, 1 }, { 22, 84, 1 }, { 22, 85, 1 }, { 22, 83, 1 }, 
+    { 22, 88, 1 }, { 22, 89, 1 }, { 22, 81, 1 }, { 26, 271, 0 }, { 21, 244, 1 }, 
+    { 20, 27, 1 }, { 20, 28, 1 }, { 22, 90, 1 }, { 22, 91, 1 }, { 35, 245, 1 }, 
+    { 2, 8, 3 }, { 6, 253, 1 }, { 8, 273, 0 }, { 4, 12, 3 }, { 4, 13, 3 }, 
+    { 39, 34, 3 }, { 42, 36, 3 }, { 44, 38, 3 }, { 46, 40, 3 }, { 50, 42, 3 }, 
+    { 52, 44, 3 }, { 53, 46, 3 }, { 54, 48, 3 }, { 55, 50, 3 }, { 56, 52, 3 }, 
+    { 102, 208, 3 }, { 127, 275, 0 }, { 7, 56, 3 }, { 134, 146, 2 }, { 134, 145, 2 }, 
+    { 134, 147, 2 }, { 131, 137, 2 }, { 130, 134, 4 }, { 141, 242, 2 }, { 96, 98, 2 }, 
+    { 96, 97, 2 }, { 94, 210, 2 }, { 93, 96, 2 }, { 89, 94, 4 }, { 123, 263, 1 }, 
+    { 123, 264, 1 }, { 124, 262, 1 }, { 122, 266, 1 }, { 25, 117, 2 }, { 125, 279, 0 }, 
+    { 118, 248, 2 }, { 108, 113, 3 }, { 120, 212, 3 }, { 17, 243, 2 }, { 24, 269, 1 }, 
+    { 24, 270, 1 }, { 26, 272, 1 }, { 20, 29, 2 }, { 3, 58, 3 }, { 18, 26, 4 }, 
+    { 16, 116, 2 }, { 19, 31, 4 }, { 5, 16, 2 }, { 4, 11, 4 }, { 4, 10, 4 }, 
+    { 127, 276, 1 }, { 129, 133, 3 }, { 134, 144, 3 }, { 134, 148, 3 }, { 129, 131, 3 }, 
+    { 98, 257, 2 }, { 116, 278, 1 }, { 116, 277, 1 }, { 117, 260, 2 }, { 121, 119, 3 }, 
+    { 121, 120, 3 }, { 125, 280, 1 }, { 115, 268, 2 }, { 114, 251, 3 }, { 9, 22, 5 }, 
+    { 57, 54, 5 }, { 126, 255, 3 }, { 84, 124, 5 }, { 129, 132, 4 }, { 97, 259, 3 }, 
+    { 121, 122, 4 }, { 121, 121, 4 }, { 33, 286, 1 }, { 33, 287, 1 }, { 33, 283, 1 }, 
+    { 33, 284, 1 }, { 33, 285, 1 }, { 33, 288, 1 }, { 20, 30, 4 }, { 38, 290, 1 }, 
+    { 38, 289, 1 }, { 38, 291, 1 }, { 34, 32, 4 }, { 8, 274, 3 }, { 132, 138, 5 }, 
+    { 132, 140, 5 }, { 133, 141, 5 }, { 33, 281, 2 }, { 33, 282, 2 }, { 133, 142, 6 }, 
+    { 38, 292, 3 }, { 133, 143, 7 }, { 132, 139, 7 }
+};
+
+static const lr::small_parser_tables::symbol_equivalent s_WeakToStrong[] = {
+};
+
+const lr::small_parser_tables Ansi_C::lr_tables(440, 232, 233, s_TerminalActions, s_NonterminalActions, s_ActionCounts, s_EndGuardStates, 111, 293, s_ReduceRules, 0, s_WeakToStrong, s_DefaultReductions, &s_TerminalIndex, &s_NonterminalIndex, 0, NULL);
+
+const bool Ansi_C::skipped_symbols[] = {
+    false, false, false, false, false, false, false, false, false, false, 
+    false, false, false, false, false, false, false, false, false, false, 
+    false, false, false, false, false, false, false, false, false, false, 
+    false, false, false, false, false, false, false, false, false, true, 
+    true, true
+};
+const int Ansi_C::count_skipped_symbols = 42;
+
+Ansi_C::syntax_node::~syntax_node() { }
+std::wstring Ansi_C::syntax_node::to_string() { return L"syntax_node"; }
+dfa::position Ansi_C::syntax_node::pos() const { return dfa::position(-1, -1, -1); }
+dfa::position Ansi_C::syntax_node::final_pos() const { return dfa::position(-1, -1, -1); }
+
+Ansi_C::terminal::terminal(const dfa::lexeme_container& lexeme) : m_Lexeme(lexeme) { }
+
+dfa::position Ansi_C::terminal::pos() const { return m_Lexeme->pos(); }
+
+dfa::position Ansi_C::terminal::final_pos() const { return m_Lexeme->final_pos(); }
+
+// Rule 154
+Ansi_C::epsilon_n::epsilon_n(const util::syntax_ptr<class Translation_Unit_n>& Translation_Unit_0)
+: m_Rule(154)
+, Translation_Unit(Translation_Unit_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::epsilon_n::epsilon_n(util::syntax_ptr<class Translation_Unit_n>&& Translation_Unit_0)
+: m_Rule(154)
+, Translation_Unit(std::move(Translation_Unit_0)) {
+}
+#endif
+
+Ansi_C::epsilon_n::~epsilon_n() { }
+
+// Rule 0
+Ansi_C::Constant_n::Constant_n(const util::syntax_ptr<class constant_hex_n>& constant_hex_0)
+: m_Rule(0)
+, constant_hex(constant_hex_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Constant_n::Constant_n(util::syntax_ptr<class constant_hex_n>&& constant_hex_0)
+: m_Rule(0)
+, constant_hex(std::move(constant_hex_0)) {
+}
+#endif
+
+// Rule 1
+Ansi_C::Constant_n::Constant_n(const util::syntax_ptr<class constant_octal_n>& constant_octal_0)
+: m_Rule(1)
+, constant_octal(constant_octal_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Constant_n::Constant_n(util::syntax_ptr<class constant_octal_n>&& constant_octal_0)
+: m_Rule(1)
+, constant_octal(std::move(constant_octal_0)) {
+}
+#endif
+
+// Rule 2
+Ansi_C::Constant_n::Constant_n(const util::syntax_ptr<class constant_decimal_n>& constant_decimal_0)
+: m_Rule(2)
+, constant_decimal(constant_decimal_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Constant_n::Constant_n(util::syntax_ptr<class constant_decimal_n>&& constant_decimal_0)
+: m_Rule(2)
+, constant_decimal(std::move(constant_decimal_0)) {
+}
+#endif
+
+// Rule 3
+Ansi_C::Constant_n::Constant_n(const util::syntax_ptr<class constant_float_n>& constant_float_0)
+: m_Rule(3)
+, constant_float(constant_float_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Constant_n::Constant_n(util::syntax_ptr<class constant_float_n>&& constant_float_0)
+: m_Rule(3)
+, constant_float(std::move(constant_float_0)) {
+}
+#endif
+
+// Rule 4
+Ansi_C::Constant_n::Constant_n(const util::syntax_ptr<class constant_character_n>& constant_character_0)
+: m_Rule(4)
+, constant_character(constant_character_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Constant_n::Constant_n(util::syntax_ptr<class constant_character_n>&& constant_character_0)
+: m_Rule(4)
+, constant_character(std::move(constant_character_0)) {
+}
+#endif
+
+// Rule 5
+Ansi_C::Constant_n::Constant_n(const util::syntax_ptr<class string_literal_n>& string_literal_0)
+: m_Rule(5)
+, string_literal(string_literal_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Constant_n::Constant_n(util::syntax_ptr<class string_literal_n>&& string_literal_0)
+: m_Rule(5)
+, string_literal(std::move(string_literal_0)) {
+}
+#endif
+
+Ansi_C::Constant_n::~Constant_n() { }
+
+// Rule 6
+Ansi_C::Primary_Expression_n::Primary_Expression_n(const util::syntax_ptr<class identifier_n>& identifier_0)
+: m_Rule(6)
+, identifier(identifier_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Primary_Expression_n::Primary_Expression_n(util::syntax_ptr<class identifier_n>&& identifier_0)
+: m_Rule(6)
+, identifier(std::move(identifier_0)) {
+}
+#endif
+
+// Rule 7
+Ansi_C::Primary_Expression_n::Primary_Expression_n(const util::syntax_ptr<class Constant_n>& Constant_0)
+: m_Rule(7)
+, Constant(Constant_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Primary_Expression_n::Primary_Expression_n(util::syntax_ptr<class Constant_n>&& Constant_0)
+: m_Rule(7)
+, Constant(std::move(Constant_0)) {
+}
+#endif
+
+// Rule 8
+Ansi_C::Primary_Expression_n::Primary_Expression_n(const util::syntax_ptr<class _openparen__n>& _openparen__0, const util::syntax_ptr<class Expression_n>& Expression_1, const util::syntax_ptr<class _closeparen__n>& _closeparen__2)
+: m_Rule(8)
+, _openparen_(_openparen__0)
+, Expression(Expression_1)
+, _closeparen_(_closeparen__2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Primary_Expression_n::Primary_Expression_n(util::syntax_ptr<class _openparen__n>&& _openparen__0, util::syntax_ptr<class Expression_n>&& Expression_1, util::syntax_ptr<class _closeparen__n>&& _closeparen__2)
+: m_Rule(8)
+, _openparen_(std::move(_openparen__0))
+, Expression(std::move(Expression_1))
+, _closeparen_(std::move(_closeparen__2)) {
+}
+#endif
+
+Ansi_C::Primary_Expression_n::~Primary_Expression_n() { }
+
+// Rule 57
+Ansi_C::Expression_n::Expression_n(const util::syntax_ptr<class Assignment_Expression_n>& Assignment_Expression_0)
+: m_Rule(57)
+, Assignment_Expression(Assignment_Expression_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Expression_n::Expression_n(util::syntax_ptr<class Assignment_Expression_n>&& Assignment_Expression_0)
+: m_Rule(57)
+, Assignment_Expression(std::move(Assignment_Expression_0)) {
+}
+#endif
+
+// Rule 58
+Ansi_C::Expression_n::Expression_n(const util::syntax_ptr<class Expression_n>& Expression_0, const util::syntax_ptr<class _comma__n>& _comma__1, const util::syntax_ptr<class Assignment_Expression_n>& Assignment_Expression_2)
+: m_Rule(58)
+, Expression(Expression_0)
+, _comma_(_comma__1)
+, Assignment_Expression(Assignment_Expression_2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Expression_n::Expression_n(util::syntax_ptr<class Expression_n>&& Expression_0, util::syntax_ptr<class _comma__n>&& _comma__1, util::syntax_ptr<class Assignment_Expression_n>&& Assignment_Expression_2)
+: m_Rule(58)
+, Expression(std::move(Expression_0))
+, _comma_(std::move(_comma__1))
+, Assignment_Expression(std::move(Assignment_Expression_2)) {
+}
+#endif
+
+Ansi_C::Expression_n::~Expression_n() { }
+
+// Rule 9
+Ansi_C::Postfix_Expression_n::Postfix_Expression_n(const util::syntax_ptr<class Primary_Expression_n>& Primary_Expression_0)
+: m_Rule(9)
+, Primary_Expression(Primary_Expression_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Postfix_Expression_n::Postfix_Expression_n(util::syntax_ptr<class Primary_Expression_n>&& Primary_Expression_0)
+: m_Rule(9)
+, Primary_Expression(std::move(Primary_Expression_0)) {
+}
+#endif
+
+// Rule 10
+Ansi_C::Postfix_Expression_n::Postfix_Expression_n(const util::syntax_ptr<class Postfix_Expression_n>& Postfix_Expression_0, const util::syntax_ptr<class _opensquare__n>& _opensquare__1, const util::syntax_ptr<class Expression_n>& Expression_2, const util::syntax_ptr<class _closesquare__n>& _closesquare__3)
+: m_Rule(10)
+, Postfix_Expression(Postfix_Expression_0)
+, _opensquare_(_opensquare__1)
+, Expression(Expression_2)
+, _closesquare_(_closesquare__3) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Postfix_Expression_n::Postfix_Expression_n(util::syntax_ptr<class Postfix_Expression_n>&& Postfix_Expression_0, util::syntax_ptr<class _opensquare__n>&& _opensquare__1, util::syntax_ptr<class Expression_n>&& Expression_2, util::syntax_ptr<class _closesquare__n>&& _closesquare__3)
+: m_Rule(10)
+, Postfix_Expression(std::move(Postfix_Expression_0))
+, _opensquare_(std::move(_opensquare__1))
+, Expression(std::move(Expression_2))
+, _closesquare_(std::move(_closesquare__3)) {
+}
+#endif
+
+// Rule 11
+Ansi_C::Postfix_Expression_n::Postfix_Expression_n(const util::syntax_ptr<class Postfix_Expression_n>& Postfix_Expression_0, const util::syntax_ptr<class _openparen__n>& _openparen__1, const util::syntax_ptr<class optional_Argument_Expression_List_n>& optional_Argument_Expression_List_2, const util::syntax_ptr<class _closeparen__n>& _closeparen__3)
+: m_Rule(11)
+, Postfix_Expression(Postfix_Expression_0)
+, _openparen_(_openparen__1)
+, optional_Argument_Expression_List(optional_Argument_Expression_List_2)
+, _closeparen_(_closeparen__3) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Postfix_Expression_n::Postfix_Expression_n(util::syntax_ptr<class Postfix_Expression_n>&& Postfix_Expression_0, util::syntax_ptr<class _openparen__n>&& _openparen__1, util::syntax_ptr<class optional_Argument_Expression_List_n>&& optional_Argument_Expression_List_2, util::syntax_ptr<class _closeparen__n>&& _closeparen__3)
+: m_Rule(11)
+, Postfix_Expression(std::move(Postfix_Expression_0))
+, _openparen_(std::move(_openparen__1))
+, optional_Argument_Expression_List(std::move(optional_Argument_Expression_List_2))
+, _closeparen_(std::move(_closeparen__3)) {
+}
+#endif
+
+// Rule 12
+Ansi_C::Postfix_Expression_n::Postfix_Expression_n(const util::syntax_ptr<class Postfix_Expression_n>& Postfix_Expression_0, const util::syntax_ptr<class _dot__n>& _dot__1, const util::syntax_ptr<class identifier_n>& identifier_2)
+: m_Rule(12)
+, Postfix_Expression(Postfix_Expression_0)
+, _dot_(_dot__1)
+, identifier(identifier_2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Postfix_Expression_n::Postfix_Expression_n(util::syntax_ptr<class Postfix_Expression_n>&& Postfix_Expression_0, util::syntax_ptr<class _dot__n>&& _dot__1, util::syntax_ptr<class identifier_n>&& identifier_2)
+: m_Rule(12)
+, Postfix_Expression(std::move(Postfix_Expression_0))
+, _dot_(std::move(_dot__1))
+, identifier(std::move(identifier_2)) {
+}
+#endif
+
+// Rule 13
+Ansi_C::Postfix_Expression_n::Postfix_Expression_n(const util::syntax_ptr<class Postfix_Expression_n>& Postfix_Expression_0, const util::syntax_ptr<class __greaterthan__n>& __greaterthan__1, const util::syntax_ptr<class identifier_n>& identifier_2)
+: m_Rule(13)
+, Postfix_Expression(Postfix_Expression_0)
+, __greaterthan_(__greaterthan__1)
+, identifier(identifier_2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Postfix_Expression_n::Postfix_Expression_n(util::syntax_ptr<class Postfix_Expression_n>&& Postfix_Expression_0, util::syntax_ptr<class __greaterthan__n>&& __greaterthan__1, util::syntax_ptr<class identifier_n>&& identifier_2)
+: m_Rule(13)
+, Postfix_Expression(std::move(Postfix_Expression_0))
+, __greaterthan_(std::move(__greaterthan__1))
+, identifier(std::move(identifier_2)) {
+}
+#endif
+
+// Rule 14
+Ansi_C::Postfix_Expression_n::Postfix_Expression_n(const util::syntax_ptr<class Postfix_Expression_n>& Postfix_Expression_0, const util::syntax_ptr<class _plus__plus__n>& _plus__plus__1)
+: m_Rule(14)
+, Postfix_Expression(Postfix_Expression_0)
+, _plus__plus_(_plus__plus__1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Postfix_Expression_n::Postfix_Expression_n(util::syntax_ptr<class Postfix_Expression_n>&& Postfix_Expression_0, util::syntax_ptr<class _plus__plus__n>&& _plus__plus__1)
+: m_Rule(14)
+, Postfix_Expression(std::move(Postfix_Expression_0))
+, _plus__plus_(std::move(_plus__plus__1)) {
+}
+#endif
+
+// Rule 15
+Ansi_C::Postfix_Expression_n::Postfix_Expression_n(const util::syntax_ptr<class Postfix_Expression_n>& Postfix_Expression_0, const util::syntax_ptr<class ___n>& ___1)
+: m_Rule(15)
+, Postfix_Expression(Postfix_Expression_0)
+, __(___1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Postfix_Expression_n::Postfix_Expression_n(util::syntax_ptr<class Postfix_Expression_n>&& Postfix_Expression_0, util::syntax_ptr<class ___n>&& ___1)
+: m_Rule(15)
+, Postfix_Expression(std::move(Postfix_Expression_0))
+, __(std::move(___1)) {
+}
+#endif
+
+Ansi_C::Postfix_Expression_n::~Postfix_Expression_n() { }
+
+// Rule 16
+Ansi_C::Argument_Expression_List_n::Argument_Expression_List_n(const util::syntax_ptr<class Assignment_Expression_n>& Assignment_Expression_0, const util::syntax_ptr<class list_of__comma__Assignment_Expression_n>& list_of__comma__Assignment_Expression_1)
+: m_Rule(16)
+, Assignment_Expression(Assignment_Expression_0)
+, list_of__comma__Assignment_Expression(list_of__comma__Assignment_Expression_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Argument_Expression_List_n::Argument_Expression_List_n(util::syntax_ptr<class Assignment_Expression_n>&& Assignment_Expression_0, util::syntax_ptr<class list_of__comma__Assignment_Expression_n>&& list_of__comma__Assignment_Expression_1)
+: m_Rule(16)
+, Assignment_Expression(std::move(Assignment_Expression_0))
+, list_of__comma__Assignment_Expression(std::move(list_of__comma__Assignment_Expression_1)) {
+}
+#endif
+
+Ansi_C::Argument_Expression_List_n::~Argument_Expression_List_n() { }
+
+// Rule 252
+Ansi_C::optional_Argument_Expression_List_n::optional_Argument_Expression_List_n(const dfa::position& pos)
+: m_Rule(252)
+, m_Position(pos) {
+}
+
+// Rule 253
+Ansi_C::optional_Argument_Expression_List_n::optional_Argument_Expression_List_n(const util::syntax_ptr<class Argument_Expression_List_n>& Argument_Expression_List_0)
+: m_Rule(253)
+, Argument_Expression_List(Argument_Expression_List_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::optional_Argument_Expression_List_n::optional_Argument_Expression_List_n(util::syntax_ptr<class Argument_Expression_List_n>&& Argument_Expression_List_0)
+: m_Rule(253)
+, Argument_Expression_List(std::move(Argument_Expression_List_0)) {
+}
+#endif
+
+Ansi_C::optional_Argument_Expression_List_n::~optional_Argument_Expression_List_n() { }
+
+// Rule 55
+Ansi_C::Assignment_Expression_n::Assignment_Expression_n(const util::syntax_ptr<class Conditional_Expression_n>& Conditional_Expression_0)
+: m_Rule(55)
+, Conditional_Expression(Conditional_Expression_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Assignment_Expression_n::Assignment_Expression_n(util::syntax_ptr<class Conditional_Expression_n>&& Conditional_Expression_0)
+: m_Rule(55)
+, Conditional_Expression(std::move(Conditional_Expression_0)) {
+}
+#endif
+
+// Rule 56
+Ansi_C::Assignment_Expression_n::Assignment_Expression_n(const util::syntax_ptr<class Unary_Expression_n>& Unary_Expression_0, const util::syntax_ptr<class one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n>& one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__1, const util::syntax_ptr<class Assignment_Expression_n>& Assignment_Expression_2)
+: m_Rule(56)
+, Unary_Expression(Unary_Expression_0)
+, one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals_(one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__1)
+, Assignment_Expression(Assignment_Expression_2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Assignment_Expression_n::Assignment_Expression_n(util::syntax_ptr<class Unary_Expression_n>&& Unary_Expression_0, util::syntax_ptr<class one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n>&& one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__1, util::syntax_ptr<class Assignment_Expression_n>&& Assignment_Expression_2)
+: m_Rule(56)
+, Unary_Expression(std::move(Unary_Expression_0))
+, one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals_(std::move(one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__1))
+, Assignment_Expression(std::move(Assignment_Expression_2)) {
+}
+#endif
+
+Ansi_C::Assignment_Expression_n::~Assignment_Expression_n() { }
+
+// Rule 274
+Ansi_C::list_of__comma__Assignment_Expression_n_content::list_of__comma__Assignment_Expression_n_content(const util::syntax_ptr<class _comma__n>& _comma__0, const util::syntax_ptr<class Assignment_Expression_n>& Assignment_Expression_1)
+: m_Rule(274)
+, _comma_(_comma__0)
+, Assignment_Expression(Assignment_Expression_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::list_of__comma__Assignment_Expression_n_content::list_of__comma__Assignment_Expression_n_content(util::syntax_ptr<class _comma__n>&& _comma__0, util::syntax_ptr<class Assignment_Expression_n>&& Assignment_Expression_1)
+: m_Rule(274)
+, _comma_(std::move(_comma__0))
+, Assignment_Expression(std::move(Assignment_Expression_1)) {
+}
+#endif
+
+Ansi_C::list_of__comma__Assignment_Expression_n_content::~list_of__comma__Assignment_Expression_n_content() { }
+
+// Rule 17
+Ansi_C::Unary_Expression_n::Unary_Expression_n(const util::syntax_ptr<class Postfix_Expression_n>& Postfix_Expression_0)
+: m_Rule(17)
+, Postfix_Expression(Postfix_Expression_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Unary_Expression_n::Unary_Expression_n(util::syntax_ptr<class Postfix_Expression_n>&& Postfix_Expression_0)
+: m_Rule(17)
+, Postfix_Expression(std::move(Postfix_Expression_0)) {
+}
+#endif
+
+// Rule 18
+Ansi_C::Unary_Expression_n::Unary_Expression_n(const util::syntax_ptr<class _plus__plus__n>& _plus__plus__0, const util::syntax_ptr<class Unary_Expression_n>& Unary_Expression_1)
+: m_Rule(18)
+, _plus__plus_(_plus__plus__0)
+, Unary_Expression(Unary_Expression_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Unary_Expression_n::Unary_Expression_n(util::syntax_ptr<class _plus__plus__n>&& _plus__plus__0, util::syntax_ptr<class Unary_Expression_n>&& Unary_Expression_1)
+: m_Rule(18)
+, _plus__plus_(std::move(_plus__plus__0))
+, Unary_Expression(std::move(Unary_Expression_1)) {
+}
+#endif
+
+// Rule 19
+Ansi_C::Unary_Expression_n::Unary_Expression_n(const util::syntax_ptr<class ___n>& ___0, const util::syntax_ptr<class Unary_Expression_n>& Unary_Expression_1)
+: m_Rule(19)
+, __(___0)
+, Unary_Expression(Unary_Expression_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Unary_Expression_n::Unary_Expression_n(util::syntax_ptr<class ___n>&& ___0, util::syntax_ptr<class Unary_Expression_n>&& Unary_Expression_1)
+: m_Rule(19)
+, __(std::move(___0))
+, Unary_Expression(std::move(Unary_Expression_1)) {
+}
+#endif
+
+// Rule 20
+Ansi_C::Unary_Expression_n::Unary_Expression_n(const util::syntax_ptr<class one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n>& one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__0, const util::syntax_ptr<class Cast_Expression_n>& Cast_Expression_1)
+: m_Rule(20)
+, one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation_(one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__0)
+, Cast_Expression(Cast_Expression_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Unary_Expression_n::Unary_Expression_n(util::syntax_ptr<class one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n>&& one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__0, util::syntax_ptr<class Cast_Expression_n>&& Cast_Expression_1)
+: m_Rule(20)
+, one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation_(std::move(one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__0))
+, Cast_Expression(std::move(Cast_Expression_1)) {
+}
+#endif
+
+// Rule 21
+Ansi_C::Unary_Expression_n::Unary_Expression_n(const util::syntax_ptr<class sizeof_n>& sizeof_0, const util::syntax_ptr<class Unary_Expression_n>& Unary_Expression_1)
+: m_Rule(21)
+, sizeof_2(sizeof_0)
+, Unary_Expression(Unary_Expression_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Unary_Expression_n::Unary_Expression_n(util::syntax_ptr<class sizeof_n>&& sizeof_0, util::syntax_ptr<class Unary_Expression_n>&& Unary_Expression_1)
+: m_Rule(21)
+, sizeof_2(std::move(sizeof_0))
+, Unary_Expression(std::move(Unary_Expression_1)) {
+}
+#endif
+
+// Rule 22
+Ansi_C::Unary_Expression_n::Unary_Expression_n(const util::syntax_ptr<class sizeof_n>& sizeof_0, const util::syntax_ptr<class _openparen__n>& _openparen__1, const util::syntax_ptr<class Type_Name_n>& Type_Name_2, const util::syntax_ptr<class _closeparen__n>& _closeparen__3)
+: m_Rule(22)
+, sizeof_2(sizeof_0)
+, _openparen_(_openparen__1)
+, Type_Name(Type_Name_2)
+, _closeparen_(_closeparen__3) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Unary_Expression_n::Unary_Expression_n(util::syntax_ptr<class sizeof_n>&& sizeof_0, util::syntax_ptr<class _openparen__n>&& _openparen__1, util::syntax_ptr<class Type_Name_n>&& Type_Name_2, util::syntax_ptr<class _closeparen__n>&& _closeparen__3)
+: m_Rule(22)
+, sizeof_2(std::move(sizeof_0))
+, _openparen_(std::move(_openparen__1))
+, Type_Name(std::move(Type_Name_2))
+, _closeparen_(std::move(_closeparen__3)) {
+}
+#endif
+
+Ansi_C::Unary_Expression_n::~Unary_Expression_n() { }
+
+Ansi_C::one_of__tilde__or__exclamation__n::~one_of__tilde__or__exclamation__n() { }
+
+Ansi_C::one_of___or_one_of__tilde__or__exclamation__n::~one_of___or_one_of__tilde__or__exclamation__n() { }
+
+Ansi_C::one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n::~one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n() { }
+
+Ansi_C::one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n::~one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n() { }
+
+// Rule 199
+Ansi_C::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(const util::syntax_ptr<class _ampersand__n>& _ampersand__0)
+: m_Rule(199)
+, _ampersand_(_ampersand__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(util::syntax_ptr<class _ampersand__n>&& _ampersand__0)
+: m_Rule(199)
+, _ampersand_(std::move(_ampersand__0)) {
+}
+#endif
+
+// Rule 200
+Ansi_C::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(const util::syntax_ptr<class _star__n>& _star__0)
+: m_Rule(200)
+, _star_(_star__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(util::syntax_ptr<class _star__n>&& _star__0)
+: m_Rule(200)
+, _star_(std::move(_star__0)) {
+}
+#endif
+
+// Rule 201
+Ansi_C::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(const util::syntax_ptr<class _plus__n>& _plus__0)
+: m_Rule(201)
+, _plus_(_plus__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(util::syntax_ptr<class _plus__n>&& _plus__0)
+: m_Rule(201)
+, _plus_(std::move(_plus__0)) {
+}
+#endif
+
+// Rule 202
+Ansi_C::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(const util::syntax_ptr<class _minus__n>& _minus__0)
+: m_Rule(202)
+, _minus_(_minus__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(util::syntax_ptr<class _minus__n>&& _minus__0)
+: m_Rule(202)
+, _minus_(std::move(_minus__0)) {
+}
+#endif
+
+// Rule 203
+Ansi_C::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(const util::syntax_ptr<class _tilde__n>& _tilde__0)
+: m_Rule(203)
+, _tilde_(_tilde__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(util::syntax_ptr<class _tilde__n>&& _tilde__0)
+: m_Rule(203)
+, _tilde_(std::move(_tilde__0)) {
+}
+#endif
+
+// Rule 204
+Ansi_C::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(const util::syntax_ptr<class _exclamation__n>& _exclamation__0)
+: m_Rule(204)
+, _exclamation_(_exclamation__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(util::syntax_ptr<class _exclamation__n>&& _exclamation__0)
+: m_Rule(204)
+, _exclamation_(std::move(_exclamation__0)) {
+}
+#endif
+
+Ansi_C::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n::~one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n() { }
+
+// Rule 23
+Ansi_C::Cast_Expression_n::Cast_Expression_n(const util::syntax_ptr<class Unary_Expression_n>& Unary_Expression_0)
+: m_Rule(23)
+, Unary_Expression(Unary_Expression_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Cast_Expression_n::Cast_Expression_n(util::syntax_ptr<class Unary_Expression_n>&& Unary_Expression_0)
+: m_Rule(23)
+, Unary_Expression(std::move(Unary_Expression_0)) {
+}
+#endif
+
+// Rule 24
+Ansi_C::Cast_Expression_n::Cast_Expression_n(const util::syntax_ptr<class Unambiguous_Cast_n>& Unambiguous_Cast_0, const util::syntax_ptr<class Cast_Expression_n>& Cast_Expression_1)
+: m_Rule(24)
+, Unambiguous_Cast(Unambiguous_Cast_0)
+, Cast_Expression(Cast_Expression_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Cast_Expression_n::Cast_Expression_n(util::syntax_ptr<class Unambiguous_Cast_n>&& Unambiguous_Cast_0, util::syntax_ptr<class Cast_Expression_n>&& Cast_Expression_1)
+: m_Rule(24)
+, Unambiguous_Cast(std::move(Unambiguous_Cast_0))
+, Cast_Expression(std::move(Cast_Expression_1)) {
+}
+#endif
+
+// Rule 25
+Ansi_C::Cast_Expression_n::Cast_Expression_n(const util::syntax_ptr<class Ambiguous_Cast_n>& Ambiguous_Cast_0, const util::syntax_ptr<class Cast_Expression_n>& Cast_Expression_1)
+: m_Rule(25)
+, Ambiguous_Cast(Ambiguous_Cast_0)
+, Cast_Expression(Cast_Expression_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Cast_Expression_n::Cast_Expression_n(util::syntax_ptr<class Ambiguous_Cast_n>&& Ambiguous_Cast_0, util::syntax_ptr<class Cast_Expression_n>&& Cast_Expression_1)
+: m_Rule(25)
+, Ambiguous_Cast(std::move(Ambiguous_Cast_0))
+, Cast_Expression(std::move(Cast_Expression_1)) {
+}
+#endif
+
+Ansi_C::Cast_Expression_n::~Cast_Expression_n() { }
+
+// Rule 116
+Ansi_C::Type_Name_n::Type_Name_n(const util::syntax_ptr<class Specifier_Qualifier_List_n>& Specifier_Qualifier_List_0, const util::syntax_ptr<class optional_Abstract_Declarator_n>& optional_Abstract_Declarator_1)
+: m_Rule(116)
+, Specifier_Qualifier_List(Specifier_Qualifier_List_0)
+, optional_Abstract_Declarator(optional_Abstract_Declarator_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Type_Name_n::Type_Name_n(util::syntax_ptr<class Specifier_Qualifier_List_n>&& Specifier_Qualifier_List_0, util::syntax_ptr<class optional_Abstract_Declarator_n>&& optional_Abstract_Declarator_1)
+: m_Rule(116)
+, Specifier_Qualifier_List(std::move(Specifier_Qualifier_List_0))
+, optional_Abstract_Declarator(std::move(optional_Abstract_Declarator_1)) {
+}
+#endif
+
+Ansi_C::Type_Name_n::~Type_Name_n() { }
+
+// Rule 26
+Ansi_C::Unambiguous_Cast_n::Unambiguous_Cast_n(const util::syntax_ptr<class _openparen__n>& _openparen__0, const util::syntax_ptr<class Type_Name_n>& Type_Name_1, const util::syntax_ptr<class _closeparen__n>& _closeparen__2)
+: m_Rule(26)
+, _openparen_(_openparen__0)
+, Type_Name(Type_Name_1)
+, _closeparen_(_closeparen__2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Unambiguous_Cast_n::Unambiguous_Cast_n(util::syntax_ptr<class _openparen__n>&& _openparen__0, util::syntax_ptr<class Type_Name_n>&& Type_Name_1, util::syntax_ptr<class _closeparen__n>&& _closeparen__2)
+: m_Rule(26)
+, _openparen_(std::move(_openparen__0))
+, Type_Name(std::move(Type_Name_1))
+, _closeparen_(std::move(_closeparen__2)) {
+}
+#endif
+
+Ansi_C::Unambiguous_Cast_n::~Unambiguous_Cast_n() { }
+
+// Rule 31
+Ansi_C::Ambiguous_Cast_n::Ambiguous_Cast_n(const util::syntax_ptr<class _openparen__n>& _openparen__0, const util::syntax_ptr<class Type_Name_n>& Type_Name_1, const util::syntax_ptr<class _closeparen__n>& _closeparen__2)
+: m_Rule(31)
+, _openparen_(_openparen__0)
+, Type_Name(Type_Name_1)
+, _closeparen_(_closeparen__2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Ambiguous_Cast_n::Ambiguous_Cast_n(util::syntax_ptr<class _openparen__n>&& _openparen__0, util::syntax_ptr<class Type_Name_n>&& Type_Name_1, util::syntax_ptr<class _closeparen__n>&& _closeparen__2)
+: m_Rule(31)
+, _openparen_(std::move(_openparen__0))
+, Type_Name(std::move(Type_Name_1))
+, _closeparen_(std::move(_closeparen__2)) {
+}
+#endif
+
+Ansi_C::Ambiguous_Cast_n::~Ambiguous_Cast_n() { }
+
+// Rule 27
+Ansi_C::Unambiguous_Cast_Follow_n::Unambiguous_Cast_Follow_n(const util::syntax_ptr<class Simple_Type_Specifier_n>& Simple_Type_Specifier_0)
+: m_Rule(27)
+, Simple_Type_Specifier(Simple_Type_Specifier_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Unambiguous_Cast_Follow_n::Unambiguous_Cast_Follow_n(util::syntax_ptr<class Simple_Type_Specifier_n>&& Simple_Type_Specifier_0)
+: m_Rule(27)
+, Simple_Type_Specifier(std::move(Simple_Type_Specifier_0)) {
+}
+#endif
+
+// Rule 28
+Ansi_C::Unambiguous_Cast_Follow_n::Unambiguous_Cast_Follow_n(const util::syntax_ptr<class Type_Qualifier_n>& Type_Qualifier_0)
+: m_Rule(28)
+, Type_Qualifier(Type_Qualifier_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Unambiguous_Cast_Follow_n::Unambiguous_Cast_Follow_n(util::syntax_ptr<class Type_Qualifier_n>&& Type_Qualifier_0)
+: m_Rule(28)
+, Type_Qualifier(std::move(Type_Qualifier_0)) {
+}
+#endif
+
+// Rule 29
+Ansi_C::Unambiguous_Cast_Follow_n::Unambiguous_Cast_Follow_n(const util::syntax_ptr<class identifier_n>& identifier_0, const util::syntax_ptr<class one_of_Simple_Type_Specifier_or_Type_Qualifier_n>& one_of_Simple_Type_Specifier_or_Type_Qualifier_1)
+: m_Rule(29)
+, identifier(identifier_0)
+, one_of_Simple_Type_Specifier_or_Type_Qualifier(one_of_Simple_Type_Specifier_or_Type_Qualifier_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Unambiguous_Cast_Follow_n::Unambiguous_Cast_Follow_n(util::syntax_ptr<class identifier_n>&& identifier_0, util::syntax_ptr<class one_of_Simple_Type_Specifier_or_Type_Qualifier_n>&& one_of_Simple_Type_Specifier_or_Type_Qualifier_1)
+: m_Rule(29)
+, identifier(std::move(identifier_0))
+, one_of_Simple_Type_Specifier_or_Type_Qualifier(std::move(one_of_Simple_Type_Specifier_or_Type_Qualifier_1)) {
+}
+#endif
+
+// Rule 30
+Ansi_C::Unambiguous_Cast_Follow_n::Unambiguous_Cast_Follow_n(const util::syntax_ptr<class identifier_n>& identifier_0, const util::syntax_ptr<class optional_Abstract_Declarator_n>& optional_Abstract_Declarator_1, const util::syntax_ptr<class _closeparen__n>& _closeparen__2, const util::syntax_ptr<class one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n>& one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_3)
+: m_Rule(30)
+, identifier(identifier_0)
+, optional_Abstract_Declarator(optional_Abstract_Declarator_1)
+, _closeparen_(_closeparen__2)
+, one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant(one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_3) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Unambiguous_Cast_Follow_n::Unambiguous_Cast_Follow_n(util::syntax_ptr<class identifier_n>&& identifier_0, util::syntax_ptr<class optional_Abstract_Declarator_n>&& optional_Abstract_Declarator_1, util::syntax_ptr<class _closeparen__n>&& _closeparen__2, util::syntax_ptr<class one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n>&& one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_3)
+: m_Rule(30)
+, identifier(std::move(identifier_0))
+, optional_Abstract_Declarator(std::move(optional_Abstract_Declarator_1))
+, _closeparen_(std::move(_closeparen__2))
+, one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant(std::move(one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_3)) {
+}
+#endif
+
+Ansi_C::Unambiguous_Cast_Follow_n::~Unambiguous_Cast_Follow_n() { }
+
+// Rule 81
+Ansi_C::Simple_Type_Specifier_n::Simple_Type_Specifier_n(const util::syntax_ptr<class void_n>& void_0)
+: m_Rule(81)
+, void_2(void_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Simple_Type_Specifier_n::Simple_Type_Specifier_n(util::syntax_ptr<class void_n>&& void_0)
+: m_Rule(81)
+, void_2(std::move(void_0)) {
+}
+#endif
+
+// Rule 82
+Ansi_C::Simple_Type_Specifier_n::Simple_Type_Specifier_n(const util::syntax_ptr<class char_n>& char_0)
+: m_Rule(82)
+, char_2(char_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Simple_Type_Specifier_n::Simple_Type_Specifier_n(util::syntax_ptr<class char_n>&& char_0)
+: m_Rule(82)
+, char_2(std::move(char_0)) {
+}
+#endif
+
+// Rule 83
+Ansi_C::Simple_Type_Specifier_n::Simple_Type_Specifier_n(const util::syntax_ptr<class short_n>& short_0)
+: m_Rule(83)
+, short_2(short_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Simple_Type_Specifier_n::Simple_Type_Specifier_n(util::syntax_ptr<class short_n>&& short_0)
+: m_Rule(83)
+, short_2(std::move(short_0)) {
+}
+#endif
+
+// Rule 84
+Ansi_C::Simple_Type_Specifier_n::Simple_Type_Specifier_n(const util::syntax_ptr<class int_n>& int_0)
+: m_Rule(84)
+, int_2(int_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Simple_Type_Specifier_n::Simple_Type_Specifier_n(util::syntax_ptr<class int_n>&& int_0)
+: m_Rule(84)
+, int_2(std::move(int_0)) {
+}
+#endif
+
+// Rule 85
+Ansi_C::Simple_Type_Specifier_n::Simple_Type_Specifier_n(const util::syntax_ptr<class long_n>& long_0)
+: m_Rule(85)
+, long_2(long_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Simple_Type_Specifier_n::Simple_Type_Specifier_n(util::syntax_ptr<class long_n>&& long_0)
+: m_Rule(85)
+, long_2(std::move(long_0)) {
+}
+#endif
+
+// Rule 86
+Ansi_C::Simple_Type_Specifier_n::Simple_Type_Specifier_n(const util::syntax_ptr<class float_n>& float_0)
+: m_Rule(86)
+, float_2(float_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Simple_Type_Specifier_n::Simple_Type_Specifier_n(util::syntax_ptr<class float_n>&& float_0)
+: m_Rule(86)
+, float_2(std::move(float_0)) {
+}
+#endif
+
+// Rule 87
+Ansi_C::Simple_Type_Specifier_n::Simple_Type_Specifier_n(const util::syntax_ptr<class double_n>& double_0)
+: m_Rule(87)
+, double_2(double_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Simple_Type_Specifier_n::Simple_Type_Specifier_n(util::syntax_ptr<class double_n>&& double_0)
+: m_Rule(87)
+, double_2(std::move(double_0)) {
+}
+#endif
+
+// Rule 88
+Ansi_C::Simple_Type_Specifier_n::Simple_Type_Specifier_n(const util::syntax_ptr<class signed_n>& signed_0)
+: m_Rule(88)
+, signed_2(signed_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Simple_Type_Specifier_n::Simple_Type_Specifier_n(util::syntax_ptr<class signed_n>&& signed_0)
+: m_Rule(88)
+, signed_2(std::move(signed_0)) {
+}
+#endif
+
+// Rule 89
+Ansi_C::Simple_Type_Specifier_n::Simple_Type_Specifier_n(const util::syntax_ptr<class unsigned_n>& unsigned_0)
+: m_Rule(89)
+, unsigned_2(unsigned_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Simple_Type_Specifier_n::Simple_Type_Specifier_n(util::syntax_ptr<class unsigned_n>&& unsigned_0)
+: m_Rule(89)
+, unsigned_2(std::move(unsigned_0)) {
+}
+#endif
+
+// Rule 90
+Ansi_C::Simple_Type_Specifier_n::Simple_Type_Specifier_n(const util::syntax_ptr<class Struct_Or_Union_Specifier_n>& Struct_Or_Union_Specifier_0)
+: m_Rule(90)
+, Struct_Or_Union_Specifier(Struct_Or_Union_Specifier_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Simple_Type_Specifier_n::Simple_Type_Specifier_n(util::syntax_ptr<class Struct_Or_Union_Specifier_n>&& Struct_Or_Union_Specifier_0)
+: m_Rule(90)
+, Struct_Or_Union_Specifier(std::move(Struct_Or_Union_Specifier_0)) {
+}
+#endif
+
+// Rule 91
+Ansi_C::Simple_Type_Specifier_n::Simple_Type_Specifier_n(const util::syntax_ptr<class Enum_Specifier_n>& Enum_Specifier_0)
+: m_Rule(91)
+, Enum_Specifier(Enum_Specifier_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Simple_Type_Specifier_n::Simple_Type_Specifier_n(util::syntax_ptr<class Enum_Specifier_n>&& Enum_Specifier_0)
+: m_Rule(91)
+, Enum_Specifier(std::move(Enum_Specifier_0)) {
+}
+#endif
+
+Ansi_C::Simple_Type_Specifier_n::~Simple_Type_Specifier_n() { }
+
+// Rule 103
+Ansi_C::Type_Qualifier_n::Type_Qualifier_n(const util::syntax_ptr<class const_n>& const_0)
+: m_Rule(103)
+, const_2(const_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Type_Qualifier_n::Type_Qualifier_n(util::syntax_ptr<class const_n>&& const_0)
+: m_Rule(103)
+, const_2(std::move(const_0)) {
+}
+#endif
+
+// Rule 104
+Ansi_C::Type_Qualifier_n::Type_Qualifier_n(const util::syntax_ptr<class volatile_n>& volatile_0)
+: m_Rule(104)
+, volatile_2(volatile_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Type_Qualifier_n::Type_Qualifier_n(util::syntax_ptr<class volatile_n>&& volatile_0)
+: m_Rule(104)
+, volatile_2(std::move(volatile_0)) {
+}
+#endif
+
+Ansi_C::Type_Qualifier_n::~Type_Qualifier_n() { }
+
+// Rule 269
+Ansi_C::one_of_Simple_Type_Specifier_or_Type_Qualifier_n::one_of_Simple_Type_Specifier_or_Type_Qualifier_n(const util::syntax_ptr<class Simple_Type_Specifier_n>& Simple_Type_Specifier_0)
+: m_Rule(269)
+, Simple_Type_Specifier(Simple_Type_Specifier_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of_Simple_Type_Specifier_or_Type_Qualifier_n::one_of_Simple_Type_Specifier_or_Type_Qualifier_n(util::syntax_ptr<class Simple_Type_Specifier_n>&& Simple_Type_Specifier_0)
+: m_Rule(269)
+, Simple_Type_Specifier(std::move(Simple_Type_Specifier_0)) {
+}
+#endif
+
+// Rule 270
+Ansi_C::one_of_Simple_Type_Specifier_or_Type_Qualifier_n::one_of_Simple_Type_Specifier_or_Type_Qualifier_n(const util::syntax_ptr<class Type_Qualifier_n>& Type_Qualifier_0)
+: m_Rule(270)
+, Type_Qualifier(Type_Qualifier_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of_Simple_Type_Specifier_or_Type_Qualifier_n::one_of_Simple_Type_Specifier_or_Type_Qualifier_n(util::syntax_ptr<class Type_Qualifier_n>&& Type_Qualifier_0)
+: m_Rule(270)
+, Type_Qualifier(std::move(Type_Qualifier_0)) {
+}
+#endif
+
+Ansi_C::one_of_Simple_Type_Specifier_or_Type_Qualifier_n::~one_of_Simple_Type_Specifier_or_Type_Qualifier_n() { }
+
+// Rule 117
+Ansi_C::Abstract_Declarator_n::Abstract_Declarator_n(const util::syntax_ptr<class Pointer_n>& Pointer_0, const util::syntax_ptr<class optional_Direct_Abstract_Declarator_n>& optional_Direct_Abstract_Declarator_1)
+: m_Rule(117)
+, Pointer(Pointer_0)
+, optional_Direct_Abstract_Declarator(optional_Direct_Abstract_Declarator_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Abstract_Declarator_n::Abstract_Declarator_n(util::syntax_ptr<class Pointer_n>&& Pointer_0, util::syntax_ptr<class optional_Direct_Abstract_Declarator_n>&& optional_Direct_Abstract_Declarator_1)
+: m_Rule(117)
+, Pointer(std::move(Pointer_0))
+, optional_Direct_Abstract_Declarator(std::move(optional_Direct_Abstract_Declarator_1)) {
+}
+#endif
+
+// Rule 118
+Ansi_C::Abstract_Declarator_n::Abstract_Declarator_n(const util::syntax_ptr<class Direct_Abstract_Declarator_n>& Direct_Abstract_Declarator_0)
+: m_Rule(118)
+, Direct_Abstract_Declarator(Direct_Abstract_Declarator_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Abstract_Declarator_n::Abstract_Declarator_n(util::syntax_ptr<class Direct_Abstract_Declarator_n>&& Direct_Abstract_Declarator_0)
+: m_Rule(118)
+, Direct_Abstract_Declarator(std::move(Direct_Abstract_Declarator_0)) {
+}
+#endif
+
+Ansi_C::Abstract_Declarator_n::~Abstract_Declarator_n() { }
+
+// Rule 271
+Ansi_C::optional_Abstract_Declarator_n::optional_Abstract_Declarator_n(const dfa::position& pos)
+: m_Rule(271)
+, m_Position(pos) {
+}
+
+// Rule 272
+Ansi_C::optional_Abstract_Declarator_n::optional_Abstract_Declarator_n(const util::syntax_ptr<class Abstract_Declarator_n>& Abstract_Declarator_0)
+: m_Rule(272)
+, Abstract_Declarator(Abstract_Declarator_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::optional_Abstract_Declarator_n::optional_Abstract_Declarator_n(util::syntax_ptr<class Abstract_Declarator_n>&& Abstract_Declarator_0)
+: m_Rule(272)
+, Abstract_Declarator(std::move(Abstract_Declarator_0)) {
+}
+#endif
+
+Ansi_C::optional_Abstract_Declarator_n::~optional_Abstract_Declarator_n() { }
+
+Ansi_C::one_of_identifier_or_Constant_n::~one_of_identifier_or_Constant_n() { }
+
+Ansi_C::one_of_sizeof_or_one_of_identifier_or_Constant_n::~one_of_sizeof_or_one_of_identifier_or_Constant_n() { }
+
+Ansi_C::one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::~one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n() { }
+
+Ansi_C::one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::~one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n() { }
+
+Ansi_C::one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::~one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n() { }
+
+Ansi_C::one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::~one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n() { }
+
+// Rule 281
+Ansi_C::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(const util::syntax_ptr<class _plus__plus__n>& _plus__plus__0, const util::syntax_ptr<class Unary_Expression_n>& Unary_Expression_1)
+: m_Rule(281)
+, _plus__plus_(_plus__plus__0)
+, Unary_Expression(Unary_Expression_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(util::syntax_ptr<class _plus__plus__n>&& _plus__plus__0, util::syntax_ptr<class Unary_Expression_n>&& Unary_Expression_1)
+: m_Rule(281)
+, _plus__plus_(std::move(_plus__plus__0))
+, Unary_Expression(std::move(Unary_Expression_1)) {
+}
+#endif
+
+// Rule 282
+Ansi_C::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(const util::syntax_ptr<class ___n>& ___0, const util::syntax_ptr<class Unary_Expression_n>& Unary_Expression_1)
+: m_Rule(282)
+, __(___0)
+, Unary_Expression(Unary_Expression_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(util::syntax_ptr<class ___n>&& ___0, util::syntax_ptr<class Unary_Expression_n>&& Unary_Expression_1)
+: m_Rule(282)
+, __(std::move(___0))
+, Unary_Expression(std::move(Unary_Expression_1)) {
+}
+#endif
+
+// Rule 283
+Ansi_C::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(const util::syntax_ptr<class _ampersand__n>& _ampersand__0)
+: m_Rule(283)
+, _ampersand_(_ampersand__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(util::syntax_ptr<class _ampersand__n>&& _ampersand__0)
+: m_Rule(283)
+, _ampersand_(std::move(_ampersand__0)) {
+}
+#endif
+
+// Rule 284
+Ansi_C::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(const util::syntax_ptr<class _tilde__n>& _tilde__0)
+: m_Rule(284)
+, _tilde_(_tilde__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(util::syntax_ptr<class _tilde__n>&& _tilde__0)
+: m_Rule(284)
+, _tilde_(std::move(_tilde__0)) {
+}
+#endif
+
+// Rule 285
+Ansi_C::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(const util::syntax_ptr<class _exclamation__n>& _exclamation__0)
+: m_Rule(285)
+, _exclamation_(_exclamation__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(util::syntax_ptr<class _exclamation__n>&& _exclamation__0)
+: m_Rule(285)
+, _exclamation_(std::move(_exclamation__0)) {
+}
+#endif
+
+// Rule 286
+Ansi_C::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(const util::syntax_ptr<class sizeof_n>& sizeof_0)
+: m_Rule(286)
+, sizeof_2(sizeof_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(util::syntax_ptr<class sizeof_n>&& sizeof_0)
+: m_Rule(286)
+, sizeof_2(std::move(sizeof_0)) {
+}
+#endif
+
+// Rule 287
+Ansi_C::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(const util::syntax_ptr<class identifier_n>& identifier_0)
+: m_Rule(287)
+, identifier(identifier_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(util::syntax_ptr<class identifier_n>&& identifier_0)
+: m_Rule(287)
+, identifier(std::move(identifier_0)) {
+}
+#endif
+
+// Rule 288
+Ansi_C::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(const util::syntax_ptr<class Constant_n>& Constant_0)
+: m_Rule(288)
+, Constant(Constant_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(util::syntax_ptr<class Constant_n>&& Constant_0)
+: m_Rule(288)
+, Constant(std::move(Constant_0)) {
+}
+#endif
+
+Ansi_C::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::~one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n() { }
+
+// Rule 32
+Ansi_C::Ambiguous_Cast_Follow_n::Ambiguous_Cast_Follow_n(const util::syntax_ptr<class identifier_n>& identifier_0, const util::syntax_ptr<class optional_Abstract_Declarator_n>& optional_Abstract_Declarator_1, const util::syntax_ptr<class _closeparen__n>& _closeparen__2, const util::syntax_ptr<class one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n>& one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__3)
+: m_Rule(32)
+, identifier(identifier_0)
+, optional_Abstract_Declarator(optional_Abstract_Declarator_1)
+, _closeparen_(_closeparen__2)
+, one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen_(one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__3) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Ambiguous_Cast_Follow_n::Ambiguous_Cast_Follow_n(util::syntax_ptr<class identifier_n>&& identifier_0, util::syntax_ptr<class optional_Abstract_Declarator_n>&& optional_Abstract_Declarator_1, util::syntax_ptr<class _closeparen__n>&& _closeparen__2, util::syntax_ptr<class one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n>&& one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__3)
+: m_Rule(32)
+, identifier(std::move(identifier_0))
+, optional_Abstract_Declarator(std::move(optional_Abstract_Declarator_1))
+, _closeparen_(std::move(_closeparen__2))
+, one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen_(std::move(one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__3)) {
+}
+#endif
+
+Ansi_C::Ambiguous_Cast_Follow_n::~Ambiguous_Cast_Follow_n() { }
+
+Ansi_C::one_of___or__openparen__Expression__closeparen__n::~one_of___or__openparen__Expression__closeparen__n() { }
+
+Ansi_C::one_of__star__or_one_of___or__openparen__Expression__closeparen__n::~one_of__star__or_one_of___or__openparen__Expression__closeparen__n() { }
+
+// Rule 289
+Ansi_C::one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n::one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n(const util::syntax_ptr<class _plus__n>& _plus__0)
+: m_Rule(289)
+, _plus_(_plus__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n::one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n(util::syntax_ptr<class _plus__n>&& _plus__0)
+: m_Rule(289)
+, _plus_(std::move(_plus__0)) {
+}
+#endif
+
+// Rule 290
+Ansi_C::one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n::one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n(const util::syntax_ptr<class _star__n>& _star__0)
+: m_Rule(290)
+, _star_(_star__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n::one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n(util::syntax_ptr<class _star__n>&& _star__0)
+: m_Rule(290)
+, _star_(std::move(_star__0)) {
+}
+#endif
+
+// Rule 291
+Ansi_C::one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n::one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n(const util::syntax_ptr<class _minus__n>& _minus__0)
+: m_Rule(291)
+, _minus_(_minus__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n::one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n(util::syntax_ptr<class _minus__n>&& _minus__0)
+: m_Rule(291)
+, _minus_(std::move(_minus__0)) {
+}
+#endif
+
+// Rule 292
+Ansi_C::one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n::one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n(const util::syntax_ptr<class _openparen__n>& _openparen__0, const util::syntax_ptr<class Expression_n>& Expression_1, const util::syntax_ptr<class _closeparen__n>& _closeparen__2)
+: m_Rule(292)
+, _openparen_(_openparen__0)
+, Expression(Expression_1)
+, _closeparen_(_closeparen__2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n::one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n(util::syntax_ptr<class _openparen__n>&& _openparen__0, util::syntax_ptr<class Expression_n>&& Expression_1, util::syntax_ptr<class _closeparen__n>&& _closeparen__2)
+: m_Rule(292)
+, _openparen_(std::move(_openparen__0))
+, Expression(std::move(Expression_1))
+, _closeparen_(std::move(_closeparen__2)) {
+}
+#endif
+
+Ansi_C::one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n::~one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n() { }
+
+// Rule 33
+Ansi_C::Multiplicative_Expression_n::Multiplicative_Expression_n(const util::syntax_ptr<class Cast_Expression_n>& Cast_Expression_0)
+: m_Rule(33)
+, Cast_Expression(Cast_Expression_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Multiplicative_Expression_n::Multiplicative_Expression_n(util::syntax_ptr<class Cast_Expression_n>&& Cast_Expression_0)
+: m_Rule(33)
+, Cast_Expression(std::move(Cast_Expression_0)) {
+}
+#endif
+
+// Rule 34
+Ansi_C::Multiplicative_Expression_n::Multiplicative_Expression_n(const util::syntax_ptr<class Multiplicative_Expression_n>& Multiplicative_Expression_0, const util::syntax_ptr<class one_of__star__or_one_of__slash__or__percent__n>& one_of__star__or_one_of__slash__or__percent__1, const util::syntax_ptr<class Cast_Expression_n>& Cast_Expression_2)
+: m_Rule(34)
+, Multiplicative_Expression(Multiplicative_Expression_0)
+, one_of__star__or_one_of__slash__or__percent_(one_of__star__or_one_of__slash__or__percent__1)
+, Cast_Expression(Cast_Expression_2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Multiplicative_Expression_n::Multiplicative_Expression_n(util::syntax_ptr<class Multiplicative_Expression_n>&& Multiplicative_Expression_0, util::syntax_ptr<class one_of__star__or_one_of__slash__or__percent__n>&& one_of__star__or_one_of__slash__or__percent__1, util::syntax_ptr<class Cast_Expression_n>&& Cast_Expression_2)
+: m_Rule(34)
+, Multiplicative_Expression(std::move(Multiplicative_Expression_0))
+, one_of__star__or_one_of__slash__or__percent_(std::move(one_of__star__or_one_of__slash__or__percent__1))
+, Cast_Expression(std::move(Cast_Expression_2)) {
+}
+#endif
+
+Ansi_C::Multiplicative_Expression_n::~Multiplicative_Expression_n() { }
+
+Ansi_C::one_of__slash__or__percent__n::~one_of__slash__or__percent__n() { }
+
+// Rule 213
+Ansi_C::one_of__star__or_one_of__slash__or__percent__n::one_of__star__or_one_of__slash__or__percent__n(const util::syntax_ptr<class _star__n>& _star__0)
+: m_Rule(213)
+, _star_(_star__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__star__or_one_of__slash__or__percent__n::one_of__star__or_one_of__slash__or__percent__n(util::syntax_ptr<class _star__n>&& _star__0)
+: m_Rule(213)
+, _star_(std::move(_star__0)) {
+}
+#endif
+
+// Rule 214
+Ansi_C::one_of__star__or_one_of__slash__or__percent__n::one_of__star__or_one_of__slash__or__percent__n(const util::syntax_ptr<class _slash__n>& _slash__0)
+: m_Rule(214)
+, _slash_(_slash__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__star__or_one_of__slash__or__percent__n::one_of__star__or_one_of__slash__or__percent__n(util::syntax_ptr<class _slash__n>&& _slash__0)
+: m_Rule(214)
+, _slash_(std::move(_slash__0)) {
+}
+#endif
+
+// Rule 215
+Ansi_C::one_of__star__or_one_of__slash__or__percent__n::one_of__star__or_one_of__slash__or__percent__n(const util::syntax_ptr<class _percent__n>& _percent__0)
+: m_Rule(215)
+, _percent_(_percent__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__star__or_one_of__slash__or__percent__n::one_of__star__or_one_of__slash__or__percent__n(util::syntax_ptr<class _percent__n>&& _percent__0)
+: m_Rule(215)
+, _percent_(std::move(_percent__0)) {
+}
+#endif
+
+Ansi_C::one_of__star__or_one_of__slash__or__percent__n::~one_of__star__or_one_of__slash__or__percent__n() { }
+
+// Rule 35
+Ansi_C::Additive_Expression_n::Additive_Expression_n(const util::syntax_ptr<class Multiplicative_Expression_n>& Multiplicative_Expression_0)
+: m_Rule(35)
+, Multiplicative_Expression(Multiplicative_Expression_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Additive_Expression_n::Additive_Expression_n(util::syntax_ptr<class Multiplicative_Expression_n>&& Multiplicative_Expression_0)
+: m_Rule(35)
+, Multiplicative_Expression(std::move(Multiplicative_Expression_0)) {
+}
+#endif
+
+// Rule 36
+Ansi_C::Additive_Expression_n::Additive_Expression_n(const util::syntax_ptr<class Additive_Expression_n>& Additive_Expression_0, const util::syntax_ptr<class one_of__plus__or___n>& one_of__plus__or___1, const util::syntax_ptr<class Multiplicative_Expression_n>& Multiplicative_Expression_2)
+: m_Rule(36)
+, Additive_Expression(Additive_Expression_0)
+, one_of__plus__or__(one_of__plus__or___1)
+, Multiplicative_Expression(Multiplicative_Expression_2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Additive_Expression_n::Additive_Expression_n(util::syntax_ptr<class Additive_Expression_n>&& Additive_Expression_0, util::syntax_ptr<class one_of__plus__or___n>&& one_of__plus__or___1, util::syntax_ptr<class Multiplicative_Expression_n>&& Multiplicative_Expression_2)
+: m_Rule(36)
+, Additive_Expression(std::move(Additive_Expression_0))
+, one_of__plus__or__(std::move(one_of__plus__or___1))
+, Multiplicative_Expression(std::move(Multiplicative_Expression_2)) {
+}
+#endif
+
+Ansi_C::Additive_Expression_n::~Additive_Expression_n() { }
+
+// Rule 216
+Ansi_C::one_of__plus__or___n::one_of__plus__or___n(const util::syntax_ptr<class _plus__n>& _plus__0)
+: m_Rule(216)
+, _plus_(_plus__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__plus__or___n::one_of__plus__or___n(util::syntax_ptr<class _plus__n>&& _plus__0)
+: m_Rule(216)
+, _plus_(std::move(_plus__0)) {
+}
+#endif
+
+// Rule 217
+Ansi_C::one_of__plus__or___n::one_of__plus__or___n(const util::syntax_ptr<class _minus__n>& _minus__0)
+: m_Rule(217)
+, _minus_(_minus__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__plus__or___n::one_of__plus__or___n(util::syntax_ptr<class _minus__n>&& _minus__0)
+: m_Rule(217)
+, _minus_(std::move(_minus__0)) {
+}
+#endif
+
+Ansi_C::one_of__plus__or___n::~one_of__plus__or___n() { }
+
+// Rule 37
+Ansi_C::Shift_Expression_n::Shift_Expression_n(const util::syntax_ptr<class Additive_Expression_n>& Additive_Expression_0)
+: m_Rule(37)
+, Additive_Expression(Additive_Expression_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Shift_Expression_n::Shift_Expression_n(util::syntax_ptr<class Additive_Expression_n>&& Additive_Expression_0)
+: m_Rule(37)
+, Additive_Expression(std::move(Additive_Expression_0)) {
+}
+#endif
+
+// Rule 38
+Ansi_C::Shift_Expression_n::Shift_Expression_n(const util::syntax_ptr<class Shift_Expression_n>& Shift_Expression_0, const util::syntax_ptr<class one_of__lessthan__lessthan__or__greaterthan__greaterthan__n>& one_of__lessthan__lessthan__or__greaterthan__greaterthan__1, const util::syntax_ptr<class Additive_Expression_n>& Additive_Expression_2)
+: m_Rule(38)
+, Shift_Expression(Shift_Expression_0)
+, one_of__lessthan__lessthan__or__greaterthan__greaterthan_(one_of__lessthan__lessthan__or__greaterthan__greaterthan__1)
+, Additive_Expression(Additive_Expression_2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Shift_Expression_n::Shift_Expression_n(util::syntax_ptr<class Shift_Expression_n>&& Shift_Expression_0, util::syntax_ptr<class one_of__lessthan__lessthan__or__greaterthan__greaterthan__n>&& one_of__lessthan__lessthan__or__greaterthan__greaterthan__1, util::syntax_ptr<class Additive_Expression_n>&& Additive_Expression_2)
+: m_Rule(38)
+, Shift_Expression(std::move(Shift_Expression_0))
+, one_of__lessthan__lessthan__or__greaterthan__greaterthan_(std::move(one_of__lessthan__lessthan__or__greaterthan__greaterthan__1))
+, Additive_Expression(std::move(Additive_Expression_2)) {
+}
+#endif
+
+Ansi_C::Shift_Expression_n::~Shift_Expression_n() { }
+
+// Rule 218
+Ansi_C::one_of__lessthan__lessthan__or__greaterthan__greaterthan__n::one_of__lessthan__lessthan__or__greaterthan__greaterthan__n(const util::syntax_ptr<class _lessthan__lessthan__n>& _lessthan__lessthan__0)
+: m_Rule(218)
+, _lessthan__lessthan_(_lessthan__lessthan__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__lessthan__lessthan__or__greaterthan__greaterthan__n::one_of__lessthan__lessthan__or__greaterthan__greaterthan__n(util::syntax_ptr<class _lessthan__lessthan__n>&& _lessthan__lessthan__0)
+: m_Rule(218)
+, _lessthan__lessthan_(std::move(_lessthan__lessthan__0)) {
+}
+#endif
+
+// Rule 219
+Ansi_C::one_of__lessthan__lessthan__or__greaterthan__greaterthan__n::one_of__lessthan__lessthan__or__greaterthan__greaterthan__n(const util::syntax_ptr<class _greaterthan__greaterthan__n>& _greaterthan__greaterthan__0)
+: m_Rule(219)
+, _greaterthan__greaterthan_(_greaterthan__greaterthan__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__lessthan__lessthan__or__greaterthan__greaterthan__n::one_of__lessthan__lessthan__or__greaterthan__greaterthan__n(util::syntax_ptr<class _greaterthan__greaterthan__n>&& _greaterthan__greaterthan__0)
+: m_Rule(219)
+, _greaterthan__greaterthan_(std::move(_greaterthan__greaterthan__0)) {
+}
+#endif
+
+Ansi_C::one_of__lessthan__lessthan__or__greaterthan__greaterthan__n::~one_of__lessthan__lessthan__or__greaterthan__greaterthan__n() { }
+
+// Rule 39
+Ansi_C::Relational_Expression_n::Relational_Expression_n(const util::syntax_ptr<class Shift_Expression_n>& Shift_Expression_0)
+: m_Rule(39)
+, Shift_Expression(Shift_Expression_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Relational_Expression_n::Relational_Expression_n(util::syntax_ptr<class Shift_Expression_n>&& Shift_Expression_0)
+: m_Rule(39)
+, Shift_Expression(std::move(Shift_Expression_0)) {
+}
+#endif
+
+// Rule 40
+Ansi_C::Relational_Expression_n::Relational_Expression_n(const util::syntax_ptr<class Relational_Expression_n>& Relational_Expression_0, const util::syntax_ptr<class one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n>& one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__1, const util::syntax_ptr<class Shift_Expression_n>& Shift_Expression_2)
+: m_Rule(40)
+, Relational_Expression(Relational_Expression_0)
+, one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals_(one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__1)
+, Shift_Expression(Shift_Expression_2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Relational_Expression_n::Relational_Expression_n(util::syntax_ptr<class Relational_Expression_n>&& Relational_Expression_0, util::syntax_ptr<class one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n>&& one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__1, util::syntax_ptr<class Shift_Expression_n>&& Shift_Expression_2)
+: m_Rule(40)
+, Relational_Expression(std::move(Relational_Expression_0))
+, one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals_(std::move(one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__1))
+, Shift_Expression(std::move(Shift_Expression_2)) {
+}
+#endif
+
+Ansi_C::Relational_Expression_n::~Relational_Expression_n() { }
+
+Ansi_C::one_of__lessthan__equals__or__greaterthan__equals__n::~one_of__lessthan__equals__or__greaterthan__equals__n() { }
+
+Ansi_C::one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n::~one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n() { }
+
+// Rule 220
+Ansi_C::one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n::one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n(const util::syntax_ptr<class _lessthan__n>& _lessthan__0)
+: m_Rule(220)
+, _lessthan_(_lessthan__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n::one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n(util::syntax_ptr<class _lessthan__n>&& _lessthan__0)
+: m_Rule(220)
+, _lessthan_(std::move(_lessthan__0)) {
+}
+#endif
+
+// Rule 221
+Ansi_C::one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n::one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n(const util::syntax_ptr<class _greaterthan__n>& _greaterthan__0)
+: m_Rule(221)
+, _greaterthan_(_greaterthan__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n::one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n(util::syntax_ptr<class _greaterthan__n>&& _greaterthan__0)
+: m_Rule(221)
+, _greaterthan_(std::move(_greaterthan__0)) {
+}
+#endif
+
+// Rule 222
+Ansi_C::one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n::one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n(const util::syntax_ptr<class _lessthan__equals__n>& _lessthan__equals__0)
+: m_Rule(222)
+, _lessthan__equals_(_lessthan__equals__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n::one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n(util::syntax_ptr<class _lessthan__equals__n>&& _lessthan__equals__0)
+: m_Rule(222)
+, _lessthan__equals_(std::move(_lessthan__equals__0)) {
+}
+#endif
+
+// Rule 223
+Ansi_C::one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n::one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n(const util::syntax_ptr<class _greaterthan__equals__n>& _greaterthan__equals__0)
+: m_Rule(223)
+, _greaterthan__equals_(_greaterthan__equals__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n::one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n(util::syntax_ptr<class _greaterthan__equals__n>&& _greaterthan__equals__0)
+: m_Rule(223)
+, _greaterthan__equals_(std::move(_greaterthan__equals__0)) {
+}
+#endif
+
+Ansi_C::one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n::~one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n() { }
+
+// Rule 41
+Ansi_C::Equality_Expression_n::Equality_Expression_n(const util::syntax_ptr<class Relational_Expression_n>& Relational_Expression_0)
+: m_Rule(41)
+, Relational_Expression(Relational_Expression_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Equality_Expression_n::Equality_Expression_n(util::syntax_ptr<class Relational_Expression_n>&& Relational_Expression_0)
+: m_Rule(41)
+, Relational_Expression(std::move(Relational_Expression_0)) {
+}
+#endif
+
+// Rule 42
+Ansi_C::Equality_Expression_n::Equality_Expression_n(const util::syntax_ptr<class Equality_Expression_n>& Equality_Expression_0, const util::syntax_ptr<class one_of__equals__equals__or__exclamation__equals__n>& one_of__equals__equals__or__exclamation__equals__1, const util::syntax_ptr<class Relational_Expression_n>& Relational_Expression_2)
+: m_Rule(42)
+, Equality_Expression(Equality_Expression_0)
+, one_of__equals__equals__or__exclamation__equals_(one_of__equals__equals__or__exclamation__equals__1)
+, Relational_Expression(Relational_Expression_2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Equality_Expression_n::Equality_Expression_n(util::syntax_ptr<class Equality_Expression_n>&& Equality_Expression_0, util::syntax_ptr<class one_of__equals__equals__or__exclamation__equals__n>&& one_of__equals__equals__or__exclamation__equals__1, util::syntax_ptr<class Relational_Expression_n>&& Relational_Expression_2)
+: m_Rule(42)
+, Equality_Expression(std::move(Equality_Expression_0))
+, one_of__equals__equals__or__exclamation__equals_(std::move(one_of__equals__equals__or__exclamation__equals__1))
+, Relational_Expression(std::move(Relational_Expression_2)) {
+}
+#endif
+
+Ansi_C::Equality_Expression_n::~Equality_Expression_n() { }
+
+// Rule 224
+Ansi_C::one_of__equals__equals__or__exclamation__equals__n::one_of__equals__equals__or__exclamation__equals__n(const util::syntax_ptr<class _equals__equals__n>& _equals__equals__0)
+: m_Rule(224)
+, _equals__equals_(_equals__equals__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__equals__equals__or__exclamation__equals__n::one_of__equals__equals__or__exclamation__equals__n(util::syntax_ptr<class _equals__equals__n>&& _equals__equals__0)
+: m_Rule(224)
+, _equals__equals_(std::move(_equals__equals__0)) {
+}
+#endif
+
+// Rule 225
+Ansi_C::one_of__equals__equals__or__exclamation__equals__n::one_of__equals__equals__or__exclamation__equals__n(const util::syntax_ptr<class _exclamation__equals__n>& _exclamation__equals__0)
+: m_Rule(225)
+, _exclamation__equals_(_exclamation__equals__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__equals__equals__or__exclamation__equals__n::one_of__equals__equals__or__exclamation__equals__n(util::syntax_ptr<class _exclamation__equals__n>&& _exclamation__equals__0)
+: m_Rule(225)
+, _exclamation__equals_(std::move(_exclamation__equals__0)) {
+}
+#endif
+
+Ansi_C::one_of__equals__equals__or__exclamation__equals__n::~one_of__equals__equals__or__exclamation__equals__n() { }
+
+// Rule 43
+Ansi_C::And_Expression_n::And_Expression_n(const util::syntax_ptr<class Equality_Expression_n>& Equality_Expression_0)
+: m_Rule(43)
+, Equality_Expression(Equality_Expression_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::And_Expression_n::And_Expression_n(util::syntax_ptr<class Equality_Expression_n>&& Equality_Expression_0)
+: m_Rule(43)
+, Equality_Expression(std::move(Equality_Expression_0)) {
+}
+#endif
+
+// Rule 44
+Ansi_C::And_Expression_n::And_Expression_n(const util::syntax_ptr<class And_Expression_n>& And_Expression_0, const util::syntax_ptr<class _ampersand__n>& _ampersand__1, const util::syntax_ptr<class Equality_Expression_n>& Equality_Expression_2)
+: m_Rule(44)
+, And_Expression(And_Expression_0)
+, _ampersand_(_ampersand__1)
+, Equality_Expression(Equality_Expression_2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::And_Expression_n::And_Expression_n(util::syntax_ptr<class And_Expression_n>&& And_Expression_0, util::syntax_ptr<class _ampersand__n>&& _ampersand__1, util::syntax_ptr<class Equality_Expression_n>&& Equality_Expression_2)
+: m_Rule(44)
+, And_Expression(std::move(And_Expression_0))
+, _ampersand_(std::move(_ampersand__1))
+, Equality_Expression(std::move(Equality_Expression_2)) {
+}
+#endif
+
+Ansi_C::And_Expression_n::~And_Expression_n() { }
+
+// Rule 45
+Ansi_C::Exclusive_Or_Expression_n::Exclusive_Or_Expression_n(const util::syntax_ptr<class And_Expression_n>& And_Expression_0)
+: m_Rule(45)
+, And_Expression(And_Expression_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Exclusive_Or_Expression_n::Exclusive_Or_Expression_n(util::syntax_ptr<class And_Expression_n>&& And_Expression_0)
+: m_Rule(45)
+, And_Expression(std::move(And_Expression_0)) {
+}
+#endif
+
+// Rule 46
+Ansi_C::Exclusive_Or_Expression_n::Exclusive_Or_Expression_n(const util::syntax_ptr<class Exclusive_Or_Expression_n>& Exclusive_Or_Expression_0, const util::syntax_ptr<class _cicumflex__n>& _cicumflex__1, const util::syntax_ptr<class And_Expression_n>& And_Expression_2)
+: m_Rule(46)
+, Exclusive_Or_Expression(Exclusive_Or_Expression_0)
+, _cicumflex_(_cicumflex__1)
+, And_Expression(And_Expression_2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Exclusive_Or_Expression_n::Exclusive_Or_Expression_n(util::syntax_ptr<class Exclusive_Or_Expression_n>&& Exclusive_Or_Expression_0, util::syntax_ptr<class _cicumflex__n>&& _cicumflex__1, util::syntax_ptr<class And_Expression_n>&& And_Expression_2)
+: m_Rule(46)
+, Exclusive_Or_Expression(std::move(Exclusive_Or_Expression_0))
+, _cicumflex_(std::move(_cicumflex__1))
+, And_Expression(std::move(And_Expression_2)) {
+}
+#endif
+
+Ansi_C::Exclusive_Or_Expression_n::~Exclusive_Or_Expression_n() { }
+
+// Rule 47
+Ansi_C::Inclusive_Or_Expression_n::Inclusive_Or_Expression_n(const util::syntax_ptr<class Exclusive_Or_Expression_n>& Exclusive_Or_Expression_0)
+: m_Rule(47)
+, Exclusive_Or_Expression(Exclusive_Or_Expression_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Inclusive_Or_Expression_n::Inclusive_Or_Expression_n(util::syntax_ptr<class Exclusive_Or_Expression_n>&& Exclusive_Or_Expression_0)
+: m_Rule(47)
+, Exclusive_Or_Expression(std::move(Exclusive_Or_Expression_0)) {
+}
+#endif
+
+// Rule 48
+Ansi_C::Inclusive_Or_Expression_n::Inclusive_Or_Expression_n(const util::syntax_ptr<class Inclusive_Or_Expression_n>& Inclusive_Or_Expression_0, const util::syntax_ptr<class _pipe__n>& _pipe__1, const util::syntax_ptr<class Exclusive_Or_Expression_n>& Exclusive_Or_Expression_2)
+: m_Rule(48)
+, Inclusive_Or_Expression(Inclusive_Or_Expression_0)
+, _pipe_(_pipe__1)
+, Exclusive_Or_Expression(Exclusive_Or_Expression_2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Inclusive_Or_Expression_n::Inclusive_Or_Expression_n(util::syntax_ptr<class Inclusive_Or_Expression_n>&& Inclusive_Or_Expression_0, util::syntax_ptr<class _pipe__n>&& _pipe__1, util::syntax_ptr<class Exclusive_Or_Expression_n>&& Exclusive_Or_Expression_2)
+: m_Rule(48)
+, Inclusive_Or_Expression(std::move(Inclusive_Or_Expression_0))
+, _pipe_(std::move(_pipe__1))
+, Exclusive_Or_Expression(std::move(Exclusive_Or_Expression_2)) {
+}
+#endif
+
+Ansi_C::Inclusive_Or_Expression_n::~Inclusive_Or_Expression_n() { }
+
+// Rule 49
+Ansi_C::Logical_And_Expression_n::Logical_And_Expression_n(const util::syntax_ptr<class Inclusive_Or_Expression_n>& Inclusive_Or_Expression_0)
+: m_Rule(49)
+, Inclusive_Or_Expression(Inclusive_Or_Expression_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Logical_And_Expression_n::Logical_And_Expression_n(util::syntax_ptr<class Inclusive_Or_Expression_n>&& Inclusive_Or_Expression_0)
+: m_Rule(49)
+, Inclusive_Or_Expression(std::move(Inclusive_Or_Expression_0)) {
+}
+#endif
+
+// Rule 50
+Ansi_C::Logical_And_Expression_n::Logical_And_Expression_n(const util::syntax_ptr<class Logical_And_Expression_n>& Logical_And_Expression_0, const util::syntax_ptr<class _ampersand__ampersand__n>& _ampersand__ampersand__1, const util::syntax_ptr<class Inclusive_Or_Expression_n>& Inclusive_Or_Expression_2)
+: m_Rule(50)
+, Logical_And_Expression(Logical_And_Expression_0)
+, _ampersand__ampersand_(_ampersand__ampersand__1)
+, Inclusive_Or_Expression(Inclusive_Or_Expression_2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Logical_And_Expression_n::Logical_And_Expression_n(util::syntax_ptr<class Logical_And_Expression_n>&& Logical_And_Expression_0, util::syntax_ptr<class _ampersand__ampersand__n>&& _ampersand__ampersand__1, util::syntax_ptr<class Inclusive_Or_Expression_n>&& Inclusive_Or_Expression_2)
+: m_Rule(50)
+, Logical_And_Expression(std::move(Logical_And_Expression_0))
+, _ampersand__ampersand_(std::move(_ampersand__ampersand__1))
+, Inclusive_Or_Expression(std::move(Inclusive_Or_Expression_2)) {
+}
+#endif
+
+Ansi_C::Logical_And_Expression_n::~Logical_And_Expression_n() { }
+
+// Rule 51
+Ansi_C::Logical_Or_Expression_n::Logical_Or_Expression_n(const util::syntax_ptr<class Logical_And_Expression_n>& Logical_And_Expression_0)
+: m_Rule(51)
+, Logical_And_Expression(Logical_And_Expression_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Logical_Or_Expression_n::Logical_Or_Expression_n(util::syntax_ptr<class Logical_And_Expression_n>&& Logical_And_Expression_0)
+: m_Rule(51)
+, Logical_And_Expression(std::move(Logical_And_Expression_0)) {
+}
+#endif
+
+// Rule 52
+Ansi_C::Logical_Or_Expression_n::Logical_Or_Expression_n(const util::syntax_ptr<class Logical_Or_Expression_n>& Logical_Or_Expression_0, const util::syntax_ptr<class _pipe__pipe__n>& _pipe__pipe__1, const util::syntax_ptr<class Logical_And_Expression_n>& Logical_And_Expression_2)
+: m_Rule(52)
+, Logical_Or_Expression(Logical_Or_Expression_0)
+, _pipe__pipe_(_pipe__pipe__1)
+, Logical_And_Expression(Logical_And_Expression_2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Logical_Or_Expression_n::Logical_Or_Expression_n(util::syntax_ptr<class Logical_Or_Expression_n>&& Logical_Or_Expression_0, util::syntax_ptr<class _pipe__pipe__n>&& _pipe__pipe__1, util::syntax_ptr<class Logical_And_Expression_n>&& Logical_And_Expression_2)
+: m_Rule(52)
+, Logical_Or_Expression(std::move(Logical_Or_Expression_0))
+, _pipe__pipe_(std::move(_pipe__pipe__1))
+, Logical_And_Expression(std::move(Logical_And_Expression_2)) {
+}
+#endif
+
+Ansi_C::Logical_Or_Expression_n::~Logical_Or_Expression_n() { }
+
+// Rule 53
+Ansi_C::Conditional_Expression_n::Conditional_Expression_n(const util::syntax_ptr<class Logical_Or_Expression_n>& Logical_Or_Expression_0)
+: m_Rule(53)
+, Logical_Or_Expression(Logical_Or_Expression_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Conditional_Expression_n::Conditional_Expression_n(util::syntax_ptr<class Logical_Or_Expression_n>&& Logical_Or_Expression_0)
+: m_Rule(53)
+, Logical_Or_Expression(std::move(Logical_Or_Expression_0)) {
+}
+#endif
+
+// Rule 54
+Ansi_C::Conditional_Expression_n::Conditional_Expression_n(const util::syntax_ptr<class Logical_Or_Expression_n>& Logical_Or_Expression_0, const util::syntax_ptr<class _question__n>& _question__1, const util::syntax_ptr<class Expression_n>& Expression_2, const util::syntax_ptr<class _colon__n>& _colon__3, const util::syntax_ptr<class Conditional_Expression_n>& Conditional_Expression_4)
+: m_Rule(54)
+, Logical_Or_Expression(Logical_Or_Expression_0)
+, _question_(_question__1)
+, Expression(Expression_2)
+, _colon_(_colon__3)
+, Conditional_Expression(Conditional_Expression_4) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Conditional_Expression_n::Conditional_Expression_n(util::syntax_ptr<class Logical_Or_Expression_n>&& Logical_Or_Expression_0, util::syntax_ptr<class _question__n>&& _question__1, util::syntax_ptr<class Expression_n>&& Expression_2, util::syntax_ptr<class _colon__n>&& _colon__3, util::syntax_ptr<class Conditional_Expression_n>&& Conditional_Expression_4)
+: m_Rule(54)
+, Logical_Or_Expression(std::move(Logical_Or_Expression_0))
+, _question_(std::move(_question__1))
+, Expression(std::move(Expression_2))
+, _colon_(std::move(_colon__3))
+, Conditional_Expression(std::move(Conditional_Expression_4)) {
+}
+#endif
+
+Ansi_C::Conditional_Expression_n::~Conditional_Expression_n() { }
+
+Ansi_C::one_of__cicumflex__equals__or__pipe__equals__n::~one_of__cicumflex__equals__or__pipe__equals__n() { }
+
+Ansi_C::one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::~one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n() { }
+
+Ansi_C::one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::~one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n() { }
+
+Ansi_C::one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::~one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n() { }
+
+Ansi_C::one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::~one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n() { }
+
+Ansi_C::one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::~one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n() { }
+
+Ansi_C::one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::~one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n() { }
+
+Ansi_C::one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::~one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n() { }
+
+Ansi_C::one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::~one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n() { }
+
+// Rule 226
+Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(const util::syntax_ptr<class _equals__n>& _equals__0)
+: m_Rule(226)
+, _equals_(_equals__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(util::syntax_ptr<class _equals__n>&& _equals__0)
+: m_Rule(226)
+, _equals_(std::move(_equals__0)) {
+}
+#endif
+
+// Rule 227
+Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(const util::syntax_ptr<class _star__equals__n>& _star__equals__0)
+: m_Rule(227)
+, _star__equals_(_star__equals__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(util::syntax_ptr<class _star__equals__n>&& _star__equals__0)
+: m_Rule(227)
+, _star__equals_(std::move(_star__equals__0)) {
+}
+#endif
+
+// Rule 228
+Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(const util::syntax_ptr<class _slash__equals__n>& _slash__equals__0)
+: m_Rule(228)
+, _slash__equals_(_slash__equals__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(util::syntax_ptr<class _slash__equals__n>&& _slash__equals__0)
+: m_Rule(228)
+, _slash__equals_(std::move(_slash__equals__0)) {
+}
+#endif
+
+// Rule 229
+Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(const util::syntax_ptr<class _percent__equals__n>& _percent__equals__0)
+: m_Rule(229)
+, _percent__equals_(_percent__equals__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(util::syntax_ptr<class _percent__equals__n>&& _percent__equals__0)
+: m_Rule(229)
+, _percent__equals_(std::move(_percent__equals__0)) {
+}
+#endif
+
+// Rule 230
+Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(const util::syntax_ptr<class _plus__equals__n>& _plus__equals__0)
+: m_Rule(230)
+, _plus__equals_(_plus__equals__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(util::syntax_ptr<class _plus__equals__n>&& _plus__equals__0)
+: m_Rule(230)
+, _plus__equals_(std::move(_plus__equals__0)) {
+}
+#endif
+
+// Rule 231
+Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(const util::syntax_ptr<class __equals__n>& __equals__0)
+: m_Rule(231)
+, __equals_(__equals__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(util::syntax_ptr<class __equals__n>&& __equals__0)
+: m_Rule(231)
+, __equals_(std::move(__equals__0)) {
+}
+#endif
+
+// Rule 232
+Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(const util::syntax_ptr<class _lessthan__lessthan__equals__n>& _lessthan__lessthan__equals__0)
+: m_Rule(232)
+, _lessthan__lessthan__equals_(_lessthan__lessthan__equals__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(util::syntax_ptr<class _lessthan__lessthan__equals__n>&& _lessthan__lessthan__equals__0)
+: m_Rule(232)
+, _lessthan__lessthan__equals_(std::move(_lessthan__lessthan__equals__0)) {
+}
+#endif
+
+// Rule 233
+Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(const util::syntax_ptr<class _greaterthan__greaterthan__equals__n>& _greaterthan__greaterthan__equals__0)
+: m_Rule(233)
+, _greaterthan__greaterthan__equals_(_greaterthan__greaterthan__equals__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(util::syntax_ptr<class _greaterthan__greaterthan__equals__n>&& _greaterthan__greaterthan__equals__0)
+: m_Rule(233)
+, _greaterthan__greaterthan__equals_(std::move(_greaterthan__greaterthan__equals__0)) {
+}
+#endif
+
+// Rule 234
+Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(const util::syntax_ptr<class _ampersand__equals__n>& _ampersand__equals__0)
+: m_Rule(234)
+, _ampersand__equals_(_ampersand__equals__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(util::syntax_ptr<class _ampersand__equals__n>&& _ampersand__equals__0)
+: m_Rule(234)
+, _ampersand__equals_(std::move(_ampersand__equals__0)) {
+}
+#endif
+
+// Rule 235
+Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(const util::syntax_ptr<class _cicumflex__equals__n>& _cicumflex__equals__0)
+: m_Rule(235)
+, _cicumflex__equals_(_cicumflex__equals__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(util::syntax_ptr<class _cicumflex__equals__n>&& _cicumflex__equals__0)
+: m_Rule(235)
+, _cicumflex__equals_(std::move(_cicumflex__equals__0)) {
+}
+#endif
+
+// Rule 236
+Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(const util::syntax_ptr<class _pipe__equals__n>& _pipe__equals__0)
+: m_Rule(236)
+, _pipe__equals_(_pipe__equals__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(util::syntax_ptr<class _pipe__equals__n>&& _pipe__equals__0)
+: m_Rule(236)
+, _pipe__equals_(std::move(_pipe__equals__0)) {
+}
+#endif
+
+Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::~one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n() { }
+
+// Rule 59
+Ansi_C::Constant_Expression_n::Constant_Expression_n(const util::syntax_ptr<class Conditional_Expression_n>& Conditional_Expression_0)
+: m_Rule(59)
+, Conditional_Expression(Conditional_Expression_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Constant_Expression_n::Constant_Expression_n(util::syntax_ptr<class Conditional_Expression_n>&& Conditional_Expression_0)
+: m_Rule(59)
+, Conditional_Expression(std::move(Conditional_Expression_0)) {
+}
+#endif
+
+Ansi_C::Constant_Expression_n::~Constant_Expression_n() { }
+
+// Rule 60
+Ansi_C::Declaration_n::Declaration_n(const util::syntax_ptr<class Declaration_Specifiers_n>& Declaration_Specifiers_0, const util::syntax_ptr<class optional_Init_Declarator_List_n>& optional_Init_Declarator_List_1, const util::syntax_ptr<class _semicolon__n>& _semicolon__2)
+: m_Rule(60)
+, Declaration_Specifiers(Declaration_Specifiers_0)
+, optional_Init_Declarator_List(optional_Init_Declarator_List_1)
+, _semicolon_(_semicolon__2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Declaration_n::Declaration_n(util::syntax_ptr<class Declaration_Specifiers_n>&& Declaration_Specifiers_0, util::syntax_ptr<class optional_Init_Declarator_List_n>&& optional_Init_Declarator_List_1, util::syntax_ptr<class _semicolon__n>&& _semicolon__2)
+: m_Rule(60)
+, Declaration_Specifiers(std::move(Declaration_Specifiers_0))
+, optional_Init_Declarator_List(std::move(optional_Init_Declarator_List_1))
+, _semicolon_(std::move(_semicolon__2)) {
+}
+#endif
+
+Ansi_C::Declaration_n::~Declaration_n() { }
+
+// Rule 61
+Ansi_C::Declaration_Specifiers_n::Declaration_Specifiers_n(const util::syntax_ptr<class list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n>& list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_0)
+: m_Rule(61)
+, list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier(list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Declaration_Specifiers_n::Declaration_Specifiers_n(util::syntax_ptr<class list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n>&& list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_0)
+: m_Rule(61)
+, list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier(std::move(list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_0)) {
+}
+#endif
+
+Ansi_C::Declaration_Specifiers_n::~Declaration_Specifiers_n() { }
+
+// Rule 63
+Ansi_C::Init_Declarator_n::Init_Declarator_n(const util::syntax_ptr<class Declarator_n>& Declarator_0, const util::syntax_ptr<class optional__equals__Initializer_n>& optional__equals__Initializer_1)
+: m_Rule(63)
+, Declarator(Declarator_0)
+, optional__equals__Initializer(optional__equals__Initializer_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Init_Declarator_n::Init_Declarator_n(util::syntax_ptr<class Declarator_n>&& Declarator_0, util::syntax_ptr<class optional__equals__Initializer_n>&& optional__equals__Initializer_1)
+: m_Rule(63)
+, Declarator(std::move(Declarator_0))
+, optional__equals__Initializer(std::move(optional__equals__Initializer_1)) {
+}
+#endif
+
+Ansi_C::Init_Declarator_n::~Init_Declarator_n() { }
+
+// Rule 185
+Ansi_C::one_of__semicolon__or__comma__n::one_of__semicolon__or__comma__n(const util::syntax_ptr<class _semicolon__n>& _semicolon__0)
+: m_Rule(185)
+, _semicolon_(_semicolon__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__semicolon__or__comma__n::one_of__semicolon__or__comma__n(util::syntax_ptr<class _semicolon__n>&& _semicolon__0)
+: m_Rule(185)
+, _semicolon_(std::move(_semicolon__0)) {
+}
+#endif
+
+// Rule 186
+Ansi_C::one_of__semicolon__or__comma__n::one_of__semicolon__or__comma__n(const util::syntax_ptr<class _comma__n>& _comma__0)
+: m_Rule(186)
+, _comma_(_comma__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__semicolon__or__comma__n::one_of__semicolon__or__comma__n(util::syntax_ptr<class _comma__n>&& _comma__0)
+: m_Rule(186)
+, _comma_(std::move(_comma__0)) {
+}
+#endif
+
+Ansi_C::one_of__semicolon__or__comma__n::~one_of__semicolon__or__comma__n() { }
+
+// Rule 176
+Ansi_C::one_of__semicolon__or_Init_Declarator_one_of__semicolon__or__comma__n::one_of__semicolon__or_Init_Declarator_one_of__semicolon__or__comma__n(const util::syntax_ptr<class _semicolon__n>& _semicolon__0)
+: m_Rule(176)
+, _semicolon_(_semicolon__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__semicolon__or_Init_Declarator_one_of__semicolon__or__comma__n::one_of__semicolon__or_Init_Declarator_one_of__semicolon__or__comma__n(util::syntax_ptr<class _semicolon__n>&& _semicolon__0)
+: m_Rule(176)
+, _semicolon_(std::move(_semicolon__0)) {
+}
+#endif
+
+// Rule 177
+Ansi_C::one_of__semicolon__or_Init_Declarator_one_of__semicolon__or__comma__n::one_of__semicolon__or_Init_Declarator_one_of__semicolon__or__comma__n(const util::syntax_ptr<class Init_Declarator_n>& Init_Declarator_0, const util::syntax_ptr<class one_of__semicolon__or__comma__n>& one_of__semicolon__or__comma__1)
+: m_Rule(177)
+, Init_Declarator(Init_Declarator_0)
+, one_of__semicolon__or__comma_(one_of__semicolon__or__comma__1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__semicolon__or_Init_Declarator_one_of__semicolon__or__comma__n::one_of__semicolon__or_Init_Declarator_one_of__semicolon__or__comma__n(util::syntax_ptr<class Init_Declarator_n>&& Init_Declarator_0, util::syntax_ptr<class one_of__semicolon__or__comma__n>&& one_of__semicolon__or__comma__1)
+: m_Rule(177)
+, Init_Declarator(std::move(Init_Declarator_0))
+, one_of__semicolon__or__comma_(std::move(one_of__semicolon__or__comma__1)) {
+}
+#endif
+
+Ansi_C::one_of__semicolon__or_Init_Declarator_one_of__semicolon__or__comma__n::~one_of__semicolon__or_Init_Declarator_one_of__semicolon__or__comma__n() { }
+
+// Rule 62
+Ansi_C::Init_Declarator_List_n::Init_Declarator_List_n(const util::syntax_ptr<class Init_Declarator_n>& Init_Declarator_0, const util::syntax_ptr<class list_of__comma__Init_Declarator_n>& list_of__comma__Init_Declarator_1)
+: m_Rule(62)
+, Init_Declarator(Init_Declarator_0)
+, list_of__comma__Init_Declarator(list_of__comma__Init_Declarator_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Init_Declarator_List_n::Init_Declarator_List_n(util::syntax_ptr<class Init_Declarator_n>&& Init_Declarator_0, util::syntax_ptr<class list_of__comma__Init_Declarator_n>&& list_of__comma__Init_Declarator_1)
+: m_Rule(62)
+, Init_Declarator(std::move(Init_Declarator_0))
+, list_of__comma__Init_Declarator(std::move(list_of__comma__Init_Declarator_1)) {
+}
+#endif
+
+Ansi_C::Init_Declarator_List_n::~Init_Declarator_List_n() { }
+
+// Rule 178
+Ansi_C::optional_Init_Declarator_List_n::optional_Init_Declarator_List_n(const dfa::position& pos)
+: m_Rule(178)
+, m_Position(pos) {
+}
+
+// Rule 179
+Ansi_C::optional_Init_Declarator_List_n::optional_Init_Declarator_List_n(const util::syntax_ptr<class Init_Declarator_List_n>& Init_Declarator_List_0)
+: m_Rule(179)
+, Init_Declarator_List(Init_Declarator_List_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::optional_Init_Declarator_List_n::optional_Init_Declarator_List_n(util::syntax_ptr<class Init_Declarator_List_n>&& Init_Declarator_List_0)
+: m_Rule(179)
+, Init_Declarator_List(std::move(Init_Declarator_List_0)) {
+}
+#endif
+
+Ansi_C::optional_Init_Declarator_List_n::~optional_Init_Declarator_List_n() { }
+
+// Rule 64
+Ansi_C::Storage_Class_Specifier_n::Storage_Class_Specifier_n(const util::syntax_ptr<class typedef_n>& typedef_0)
+: m_Rule(64)
+, typedef_2(typedef_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Storage_Class_Specifier_n::Storage_Class_Specifier_n(util::syntax_ptr<class typedef_n>&& typedef_0)
+: m_Rule(64)
+, typedef_2(std::move(typedef_0)) {
+}
+#endif
+
+// Rule 65
+Ansi_C::Storage_Class_Specifier_n::Storage_Class_Specifier_n(const util::syntax_ptr<class extern_n>& extern_0)
+: m_Rule(65)
+, extern_2(extern_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Storage_Class_Specifier_n::Storage_Class_Specifier_n(util::syntax_ptr<class extern_n>&& extern_0)
+: m_Rule(65)
+, extern_2(std::move(extern_0)) {
+}
+#endif
+
+// Rule 66
+Ansi_C::Storage_Class_Specifier_n::Storage_Class_Specifier_n(const util::syntax_ptr<class static_n>& static_0)
+: m_Rule(66)
+, static_2(static_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Storage_Class_Specifier_n::Storage_Class_Specifier_n(util::syntax_ptr<class static_n>&& static_0)
+: m_Rule(66)
+, static_2(std::move(static_0)) {
+}
+#endif
+
+// Rule 67
+Ansi_C::Storage_Class_Specifier_n::Storage_Class_Specifier_n(const util::syntax_ptr<class auto_n>& auto_0)
+: m_Rule(67)
+, auto_2(auto_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Storage_Class_Specifier_n::Storage_Class_Specifier_n(util::syntax_ptr<class auto_n>&& auto_0)
+: m_Rule(67)
+, auto_2(std::move(auto_0)) {
+}
+#endif
+
+// Rule 68
+Ansi_C::Storage_Class_Specifier_n::Storage_Class_Specifier_n(const util::syntax_ptr<class register_n>& register_0)
+: m_Rule(68)
+, register_2(register_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Storage_Class_Specifier_n::Storage_Class_Specifier_n(util::syntax_ptr<class register_n>&& register_0)
+: m_Rule(68)
+, register_2(std::move(register_0)) {
+}
+#endif
+
+Ansi_C::Storage_Class_Specifier_n::~Storage_Class_Specifier_n() { }
+
+// Rule 69
+Ansi_C::Type_Specifier_n::Type_Specifier_n(const util::syntax_ptr<class void_n>& void_0)
+: m_Rule(69)
+, void_2(void_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Type_Specifier_n::Type_Specifier_n(util::syntax_ptr<class void_n>&& void_0)
+: m_Rule(69)
+, void_2(std::move(void_0)) {
+}
+#endif
+
+// Rule 70
+Ansi_C::Type_Specifier_n::Type_Specifier_n(const util::syntax_ptr<class char_n>& char_0)
+: m_Rule(70)
+, char_2(char_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Type_Specifier_n::Type_Specifier_n(util::syntax_ptr<class char_n>&& char_0)
+: m_Rule(70)
+, char_2(std::move(char_0)) {
+}
+#endif
+
+// Rule 71
+Ansi_C::Type_Specifier_n::Type_Specifier_n(const util::syntax_ptr<class short_n>& short_0)
+: m_Rule(71)
+, short_2(short_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Type_Specifier_n::Type_Specifier_n(util::syntax_ptr<class short_n>&& short_0)
+: m_Rule(71)
+, short_2(std::move(short_0)) {
+}
+#endif
+
+// Rule 72
+Ansi_C::Type_Specifier_n::Type_Specifier_n(const util::syntax_ptr<class int_n>& int_0)
+: m_Rule(72)
+, int_2(int_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Type_Specifier_n::Type_Specifier_n(util::syntax_ptr<class int_n>&& int_0)
+: m_Rule(72)
+, int_2(std::move(int_0)) {
+}
+#endif
+
+// Rule 73
+Ansi_C::Type_Specifier_n::Type_Specifier_n(const util::syntax_ptr<class long_n>& long_0)
+: m_Rule(73)
+, long_2(long_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Type_Specifier_n::Type_Specifier_n(util::syntax_ptr<class long_n>&& long_0)
+: m_Rule(73)
+, long_2(std::move(long_0)) {
+}
+#endif
+
+// Rule 74
+Ansi_C::Type_Specifier_n::Type_Specifier_n(const util::syntax_ptr<class float_n>& float_0)
+: m_Rule(74)
+, float_2(float_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Type_Specifier_n::Type_Specifier_n(util::syntax_ptr<class float_n>&& float_0)
+: m_Rule(74)
+, float_2(std::move(float_0)) {
+}
+#endif
+
+// Rule 75
+Ansi_C::Type_Specifier_n::Type_Specifier_n(const util::syntax_ptr<class double_n>& double_0)
+: m_Rule(75)
+, double_2(double_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Type_Specifier_n::Type_Specifier_n(util::syntax_ptr<class double_n>&& double_0)
+: m_Rule(75)
+, double_2(std::move(double_0)) {
+}
+#endif
+
+// Rule 76
+Ansi_C::Type_Specifier_n::Type_Specifier_n(const util::syntax_ptr<class signed_n>& signed_0)
+: m_Rule(76)
+, signed_2(signed_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Type_Specifier_n::Type_Specifier_n(util::syntax_ptr<class signed_n>&& signed_0)
+: m_Rule(76)
+, signed_2(std::move(signed_0)) {
+}
+#endif
+
+// Rule 77
+Ansi_C::Type_Specifier_n::Type_Specifier_n(const util::syntax_ptr<class unsigned_n>& unsigned_0)
+: m_Rule(77)
+, unsigned_2(unsigned_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Type_Specifier_n::Type_Specifier_n(util::syntax_ptr<class unsigned_n>&& unsigned_0)
+: m_Rule(77)
+, unsigned_2(std::move(unsigned_0)) {
+}
+#endif
+
+// Rule 78
+Ansi_C::Type_Specifier_n::Type_Specifier_n(const util::syntax_ptr<class Struct_Or_Union_Specifier_n>& Struct_Or_Union_Specifier_0)
+: m_Rule(78)
+, Struct_Or_Union_Specifier(Struct_Or_Union_Specifier_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Type_Specifier_n::Type_Specifier_n(util::syntax_ptr<class Struct_Or_Union_Specifier_n>&& Struct_Or_Union_Specifier_0)
+: m_Rule(78)
+, Struct_Or_Union_Specifier(std::move(Struct_Or_Union_Specifier_0)) {
+}
+#endif
+
+// Rule 79
+Ansi_C::Type_Specifier_n::Type_Specifier_n(const util::syntax_ptr<class Enum_Specifier_n>& Enum_Specifier_0)
+: m_Rule(79)
+, Enum_Specifier(Enum_Specifier_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Type_Specifier_n::Type_Specifier_n(util::syntax_ptr<class Enum_Specifier_n>&& Enum_Specifier_0)
+: m_Rule(79)
+, Enum_Specifier(std::move(Enum_Specifier_0)) {
+}
+#endif
+
+// Rule 80
+Ansi_C::Type_Specifier_n::Type_Specifier_n(const util::syntax_ptr<class identifier_n>& identifier_0)
+: m_Rule(80)
+, identifier(identifier_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Type_Specifier_n::Type_Specifier_n(util::syntax_ptr<class identifier_n>&& identifier_0)
+: m_Rule(80)
+, identifier(std::move(identifier_0)) {
+}
+#endif
+
+Ansi_C::Type_Specifier_n::~Type_Specifier_n() { }
+
+// Rule 191
+Ansi_C::one_of_Type_Specifier_or_Type_Qualifier_n::one_of_Type_Specifier_or_Type_Qualifier_n(const util::syntax_ptr<class Type_Specifier_n>& Type_Specifier_0)
+: m_Rule(191)
+, Type_Specifier(Type_Specifier_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of_Type_Specifier_or_Type_Qualifier_n::one_of_Type_Specifier_or_Type_Qualifier_n(util::syntax_ptr<class Type_Specifier_n>&& Type_Specifier_0)
+: m_Rule(191)
+, Type_Specifier(std::move(Type_Specifier_0)) {
+}
+#endif
+
+// Rule 192
+Ansi_C::one_of_Type_Specifier_or_Type_Qualifier_n::one_of_Type_Specifier_or_Type_Qualifier_n(const util::syntax_ptr<class Type_Qualifier_n>& Type_Qualifier_0)
+: m_Rule(192)
+, Type_Qualifier(Type_Qualifier_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of_Type_Specifier_or_Type_Qualifier_n::one_of_Type_Specifier_or_Type_Qualifier_n(util::syntax_ptr<class Type_Qualifier_n>&& Type_Qualifier_0)
+: m_Rule(192)
+, Type_Qualifier(std::move(Type_Qualifier_0)) {
+}
+#endif
+
+Ansi_C::one_of_Type_Specifier_or_Type_Qualifier_n::~one_of_Type_Specifier_or_Type_Qualifier_n() { }
+
+// Rule 155
+Ansi_C::one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n::one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n(const util::syntax_ptr<class Storage_Class_Specifier_n>& Storage_Class_Specifier_0)
+: m_Rule(155)
+, Storage_Class_Specifier(Storage_Class_Specifier_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n::one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n(util::syntax_ptr<class Storage_Class_Specifier_n>&& Storage_Class_Specifier_0)
+: m_Rule(155)
+, Storage_Class_Specifier(std::move(Storage_Class_Specifier_0)) {
+}
+#endif
+
+// Rule 156
+Ansi_C::one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n::one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n(const util::syntax_ptr<class Type_Specifier_n>& Type_Specifier_0)
+: m_Rule(156)
+, Type_Specifier(Type_Specifier_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n::one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n(util::syntax_ptr<class Type_Specifier_n>&& Type_Specifier_0)
+: m_Rule(156)
+, Type_Specifier(std::move(Type_Specifier_0)) {
+}
+#endif
+
+// Rule 159
+Ansi_C::one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n::one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n(const util::syntax_ptr<class Type_Qualifier_n>& Type_Qualifier_0)
+: m_Rule(159)
+, Type_Qualifier(Type_Qualifier_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n::one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n(util::syntax_ptr<class Type_Qualifier_n>&& Type_Qualifier_0)
+: m_Rule(159)
+, Type_Qualifier(std::move(Type_Qualifier_0)) {
+}
+#endif
+
+Ansi_C::one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n::~one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n() { }
+
+// Rule 160
+Ansi_C::list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n_content::list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n_content(const util::syntax_ptr<class one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n>& one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_0)
+: m_Rule(160)
+, one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier(one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n_content::list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n_content(util::syntax_ptr<class one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n>&& one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_0)
+: m_Rule(160)
+, one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier(std::move(one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_0)) {
+}
+#endif
+
+Ansi_C::list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n_content::~list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n_content() { }
+
+// Rule 190
+Ansi_C::list_of__comma__Init_Declarator_n_content::list_of__comma__Init_Declarator_n_content(const util::syntax_ptr<class _comma__n>& _comma__0, const util::syntax_ptr<class Init_Declarator_n>& Init_Declarator_1)
+: m_Rule(190)
+, _comma_(_comma__0)
+, Init_Declarator(Init_Declarator_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::list_of__comma__Init_Declarator_n_content::list_of__comma__Init_Declarator_n_content(util::syntax_ptr<class _comma__n>&& _comma__0, util::syntax_ptr<class Init_Declarator_n>&& Init_Declarator_1)
+: m_Rule(190)
+, _comma_(std::move(_comma__0))
+, Init_Declarator(std::move(Init_Declarator_1)) {
+}
+#endif
+
+Ansi_C::list_of__comma__Init_Declarator_n_content::~list_of__comma__Init_Declarator_n_content() { }
+
+// Rule 105
+Ansi_C::Declarator_n::Declarator_n(const util::syntax_ptr<class optional_Pointer_n>& optional_Pointer_0, const util::syntax_ptr<class Direct_Declarator_n>& Direct_Declarator_1)
+: m_Rule(105)
+, optional_Pointer(optional_Pointer_0)
+, Direct_Declarator(Direct_Declarator_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Declarator_n::Declarator_n(util::syntax_ptr<class optional_Pointer_n>&& optional_Pointer_0, util::syntax_ptr<class Direct_Declarator_n>&& Direct_Declarator_1)
+: m_Rule(105)
+, optional_Pointer(std::move(optional_Pointer_0))
+, Direct_Declarator(std::move(Direct_Declarator_1)) {
+}
+#endif
+
+Ansi_C::Declarator_n::~Declarator_n() { }
+
+// Rule 123
+Ansi_C::Initializer_n::Initializer_n(const util::syntax_ptr<class Assignment_Expression_n>& Assignment_Expression_0)
+: m_Rule(123)
+, Assignment_Expression(Assignment_Expression_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Initializer_n::Initializer_n(util::syntax_ptr<class Assignment_Expression_n>&& Assignment_Expression_0)
+: m_Rule(123)
+, Assignment_Expression(std::move(Assignment_Expression_0)) {
+}
+#endif
+
+// Rule 124
+Ansi_C::Initializer_n::Initializer_n(const util::syntax_ptr<class _opencurly__n>& _opencurly__0, const util::syntax_ptr<class Initializer_n>& Initializer_1, const util::syntax_ptr<class list_of__comma__Initializer_n>& list_of__comma__Initializer_2, const util::syntax_ptr<class optional__comma__n>& optional__comma__3, const util::syntax_ptr<class _closecurly__n>& _closecurly__4)
+: m_Rule(124)
+, _opencurly_(_opencurly__0)
+, Initializer(Initializer_1)
+, list_of__comma__Initializer(list_of__comma__Initializer_2)
+, optional__comma_(optional__comma__3)
+, _closecurly_(_closecurly__4) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Initializer_n::Initializer_n(util::syntax_ptr<class _opencurly__n>&& _opencurly__0, util::syntax_ptr<class Initializer_n>&& Initializer_1, util::syntax_ptr<class list_of__comma__Initializer_n>&& list_of__comma__Initializer_2, util::syntax_ptr<class optional__comma__n>&& optional__comma__3, util::syntax_ptr<class _closecurly__n>&& _closecurly__4)
+: m_Rule(124)
+, _opencurly_(std::move(_opencurly__0))
+, Initializer(std::move(Initializer_1))
+, list_of__comma__Initializer(std::move(list_of__comma__Initializer_2))
+, optional__comma_(std::move(optional__comma__3))
+, _closecurly_(std::move(_closecurly__4)) {
+}
+#endif
+
+Ansi_C::Initializer_n::~Initializer_n() { }
+
+// Rule 187
+Ansi_C::optional__equals__Initializer_n::optional__equals__Initializer_n(const dfa::position& pos)
+: m_Rule(187)
+, m_Position(pos) {
+}
+
+// Rule 188
+Ansi_C::optional__equals__Initializer_n::optional__equals__Initializer_n(const util::syntax_ptr<class _equals__n>& _equals__0, const util::syntax_ptr<class Initializer_n>& Initializer_1)
+: m_Rule(188)
+, _equals_(_equals__0)
+, Initializer(Initializer_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::optional__equals__Initializer_n::optional__equals__Initializer_n(util::syntax_ptr<class _equals__n>&& _equals__0, util::syntax_ptr<class Initializer_n>&& Initializer_1)
+: m_Rule(188)
+, _equals_(std::move(_equals__0))
+, Initializer(std::move(Initializer_1)) {
+}
+#endif
+
+Ansi_C::optional__equals__Initializer_n::~optional__equals__Initializer_n() { }
+
+// Rule 92
+Ansi_C::Struct_Or_Union_Specifier_n::Struct_Or_Union_Specifier_n(const util::syntax_ptr<class one_of_struct_or_union_n>& one_of_struct_or_union_0, const util::syntax_ptr<class identifier_n>& identifier_1, const util::syntax_ptr<class optional__opencurly__list_of_Struct_Declaration__closecurly__n>& optional__opencurly__list_of_Struct_Declaration__closecurly__2)
+: m_Rule(92)
+, one_of_struct_or_union(one_of_struct_or_union_0)
+, identifier(identifier_1)
+, optional__opencurly__list_of_Struct_Declaration__closecurly_(optional__opencurly__list_of_Struct_Declaration__closecurly__2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Struct_Or_Union_Specifier_n::Struct_Or_Union_Specifier_n(util::syntax_ptr<class one_of_struct_or_union_n>&& one_of_struct_or_union_0, util::syntax_ptr<class identifier_n>&& identifier_1, util::syntax_ptr<class optional__opencurly__list_of_Struct_Declaration__closecurly__n>&& optional__opencurly__list_of_Struct_Declaration__closecurly__2)
+: m_Rule(92)
+, one_of_struct_or_union(std::move(one_of_struct_or_union_0))
+, identifier(std::move(identifier_1))
+, optional__opencurly__list_of_Struct_Declaration__closecurly_(std::move(optional__opencurly__list_of_Struct_Declaration__closecurly__2)) {
+}
+#endif
+
+// Rule 93
+Ansi_C::Struct_Or_Union_Specifier_n::Struct_Or_Union_Specifier_n(const util::syntax_ptr<class one_of_struct_or_union_n>& one_of_struct_or_union_0, const util::syntax_ptr<class _opencurly__n>& _opencurly__1, const util::syntax_ptr<class list_of_Struct_Declaration_n>& list_of_Struct_Declaration_2, const util::syntax_ptr<class _closecurly__n>& _closecurly__3)
+: m_Rule(93)
+, one_of_struct_or_union(one_of_struct_or_union_0)
+, _opencurly_(_opencurly__1)
+, list_of_Struct_Declaration(list_of_Struct_Declaration_2)
+, _closecurly_(_closecurly__3) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Struct_Or_Union_Specifier_n::Struct_Or_Union_Specifier_n(util::syntax_ptr<class one_of_struct_or_union_n>&& one_of_struct_or_union_0, util::syntax_ptr<class _opencurly__n>&& _opencurly__1, util::syntax_ptr<class list_of_Struct_Declaration_n>&& list_of_Struct_Declaration_2, util::syntax_ptr<class _closecurly__n>&& _closecurly__3)
+: m_Rule(93)
+, one_of_struct_or_union(std::move(one_of_struct_or_union_0))
+, _opencurly_(std::move(_opencurly__1))
+, list_of_Struct_Declaration(std::move(list_of_Struct_Declaration_2))
+, _closecurly_(std::move(_closecurly__3)) {
+}
+#endif
+
+Ansi_C::Struct_Or_Union_Specifier_n::~Struct_Or_Union_Specifier_n() { }
+
+// Rule 99
+Ansi_C::Enum_Specifier_n::Enum_Specifier_n(const util::syntax_ptr<class enum_n>& enum_0, const util::syntax_ptr<class optional_identifier_n>& optional_identifier_1, const util::syntax_ptr<class _opencurly__n>& _opencurly__2, const util::syntax_ptr<class Enumerator_List_n>& Enumerator_List_3, const util::syntax_ptr<class _closecurly__n>& _closecurly__4)
+: m_Rule(99)
+, enum_2(enum_0)
+, optional_identifier(optional_identifier_1)
+, _opencurly_(_opencurly__2)
+, Enumerator_List(Enumerator_List_3)
+, _closecurly_(_closecurly__4) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Enum_Specifier_n::Enum_Specifier_n(util::syntax_ptr<class enum_n>&& enum_0, util::syntax_ptr<class optional_identifier_n>&& optional_identifier_1, util::syntax_ptr<class _opencurly__n>&& _opencurly__2, util::syntax_ptr<class Enumerator_List_n>&& Enumerator_List_3, util::syntax_ptr<class _closecurly__n>&& _closecurly__4)
+: m_Rule(99)
+, enum_2(std::move(enum_0))
+, optional_identifier(std::move(optional_identifier_1))
+, _opencurly_(std::move(_opencurly__2))
+, Enumerator_List(std::move(Enumerator_List_3))
+, _closecurly_(std::move(_closecurly__4)) {
+}
+#endif
+
+// Rule 100
+Ansi_C::Enum_Specifier_n::Enum_Specifier_n(const util::syntax_ptr<class enum_n>& enum_0, const util::syntax_ptr<class identifier_n>& identifier_1)
+: m_Rule(100)
+, enum_2(enum_0)
+, identifier(identifier_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Enum_Specifier_n::Enum_Specifier_n(util::syntax_ptr<class enum_n>&& enum_0, util::syntax_ptr<class identifier_n>&& identifier_1)
+: m_Rule(100)
+, enum_2(std::move(enum_0))
+, identifier(std::move(identifier_1)) {
+}
+#endif
+
+Ansi_C::Enum_Specifier_n::~Enum_Specifier_n() { }
+
+// Rule 157
+Ansi_C::one_of_struct_or_union_n::one_of_struct_or_union_n(const util::syntax_ptr<class struct_n>& struct_0)
+: m_Rule(157)
+, struct_2(struct_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of_struct_or_union_n::one_of_struct_or_union_n(util::syntax_ptr<class struct_n>&& struct_0)
+: m_Rule(157)
+, struct_2(std::move(struct_0)) {
+}
+#endif
+
+// Rule 158
+Ansi_C::one_of_struct_or_union_n::one_of_struct_or_union_n(const util::syntax_ptr<class union_n>& union_0)
+: m_Rule(158)
+, union_2(union_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of_struct_or_union_n::one_of_struct_or_union_n(util::syntax_ptr<class union_n>&& union_0)
+: m_Rule(158)
+, union_2(std::move(union_0)) {
+}
+#endif
+
+Ansi_C::one_of_struct_or_union_n::~one_of_struct_or_union_n() { }
+
+// Rule 94
+Ansi_C::Struct_Declaration_n::Struct_Declaration_n(const util::syntax_ptr<class Specifier_Qualifier_List_n>& Specifier_Qualifier_List_0, const util::syntax_ptr<class Struct_Declarator_List_n>& Struct_Declarator_List_1, const util::syntax_ptr<class _semicolon__n>& _semicolon__2)
+: m_Rule(94)
+, Specifier_Qualifier_List(Specifier_Qualifier_List_0)
+, Struct_Declarator_List(Struct_Declarator_List_1)
+, _semicolon_(_semicolon__2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Struct_Declaration_n::Struct_Declaration_n(util::syntax_ptr<class Specifier_Qualifier_List_n>&& Specifier_Qualifier_List_0, util::syntax_ptr<class Struct_Declarator_List_n>&& Struct_Declarator_List_1, util::syntax_ptr<class _semicolon__n>&& _semicolon__2)
+: m_Rule(94)
+, Specifier_Qualifier_List(std::move(Specifier_Qualifier_List_0))
+, Struct_Declarator_List(std::move(Struct_Declarator_List_1))
+, _semicolon_(std::move(_semicolon__2)) {
+}
+#endif
+
+Ansi_C::Struct_Declaration_n::~Struct_Declaration_n() { }
+
+// Rule 183
+Ansi_C::list_of_Struct_Declaration_n_content::list_of_Struct_Declaration_n_content(const util::syntax_ptr<class Struct_Declaration_n>& Struct_Declaration_0)
+: m_Rule(183)
+, Struct_Declaration(Struct_Declaration_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::list_of_Struct_Declaration_n_content::list_of_Struct_Declaration_n_content(util::syntax_ptr<class Struct_Declaration_n>&& Struct_Declaration_0)
+: m_Rule(183)
+, Struct_Declaration(std::move(Struct_Declaration_0)) {
+}
+#endif
+
+Ansi_C::list_of_Struct_Declaration_n_content::~list_of_Struct_Declaration_n_content() { }
+
+// Rule 180
+Ansi_C::optional__opencurly__list_of_Struct_Declaration__closecurly__n::optional__opencurly__list_of_Struct_Declaration__closecurly__n(const dfa::position& pos)
+: m_Rule(180)
+, m_Position(pos) {
+}
+
+// Rule 181
+Ansi_C::optional__opencurly__list_of_Struct_Declaration__closecurly__n::optional__opencurly__list_of_Struct_Declaration__closecurly__n(const util::syntax_ptr<class _opencurly__n>& _opencurly__0, const util::syntax_ptr<class list_of_Struct_Declaration_n>& list_of_Struct_Declaration_1, const util::syntax_ptr<class _closecurly__n>& _closecurly__2)
+: m_Rule(181)
+, _opencurly_(_opencurly__0)
+, list_of_Struct_Declaration(list_of_Struct_Declaration_1)
+, _closecurly_(_closecurly__2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::optional__opencurly__list_of_Struct_Declaration__closecurly__n::optional__opencurly__list_of_Struct_Declaration__closecurly__n(util::syntax_ptr<class _opencurly__n>&& _opencurly__0, util::syntax_ptr<class list_of_Struct_Declaration_n>&& list_of_Struct_Declaration_1, util::syntax_ptr<class _closecurly__n>&& _closecurly__2)
+: m_Rule(181)
+, _opencurly_(std::move(_opencurly__0))
+, list_of_Struct_Declaration(std::move(list_of_Struct_Declaration_1))
+, _closecurly_(std::move(_closecurly__2)) {
+}
+#endif
+
+Ansi_C::optional__opencurly__list_of_Struct_Declaration__closecurly__n::~optional__opencurly__list_of_Struct_Declaration__closecurly__n() { }
+
+// Rule 95
+Ansi_C::Specifier_Qualifier_List_n::Specifier_Qualifier_List_n(const util::syntax_ptr<class list_of_one_of_Type_Specifier_or_Type_Qualifier_n>& list_of_one_of_Type_Specifier_or_Type_Qualifier_0)
+: m_Rule(95)
+, list_of_one_of_Type_Specifier_or_Type_Qualifier(list_of_one_of_Type_Specifier_or_Type_Qualifier_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Specifier_Qualifier_List_n::Specifier_Qualifier_List_n(util::syntax_ptr<class list_of_one_of_Type_Specifier_or_Type_Qualifier_n>&& list_of_one_of_Type_Specifier_or_Type_Qualifier_0)
+: m_Rule(95)
+, list_of_one_of_Type_Specifier_or_Type_Qualifier(std::move(list_of_one_of_Type_Specifier_or_Type_Qualifier_0)) {
+}
+#endif
+
+Ansi_C::Specifier_Qualifier_List_n::~Specifier_Qualifier_List_n() { }
+
+// Rule 96
+Ansi_C::Struct_Declarator_List_n::Struct_Declarator_List_n(const util::syntax_ptr<class Struct_Declarator_n>& Struct_Declarator_0, const util::syntax_ptr<class list_of__comma__Struct_Declarator_n>& list_of__comma__Struct_Declarator_1)
+: m_Rule(96)
+, Struct_Declarator(Struct_Declarator_0)
+, list_of__comma__Struct_Declarator(list_of__comma__Struct_Declarator_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Struct_Declarator_List_n::Struct_Declarator_List_n(util::syntax_ptr<class Struct_Declarator_n>&& Struct_Declarator_0, util::syntax_ptr<class list_of__comma__Struct_Declarator_n>&& list_of__comma__Struct_Declarator_1)
+: m_Rule(96)
+, Struct_Declarator(std::move(Struct_Declarator_0))
+, list_of__comma__Struct_Declarator(std::move(list_of__comma__Struct_Declarator_1)) {
+}
+#endif
+
+Ansi_C::Struct_Declarator_List_n::~Struct_Declarator_List_n() { }
+
+// Rule 193
+Ansi_C::list_of_one_of_Type_Specifier_or_Type_Qualifier_n_content::list_of_one_of_Type_Specifier_or_Type_Qualifier_n_content(const util::syntax_ptr<class one_of_Type_Specifier_or_Type_Qualifier_n>& one_of_Type_Specifier_or_Type_Qualifier_0)
+: m_Rule(193)
+, one_of_Type_Specifier_or_Type_Qualifier(one_of_Type_Specifier_or_Type_Qualifier_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::list_of_one_of_Type_Specifier_or_Type_Qualifier_n_content::list_of_one_of_Type_Specifier_or_Type_Qualifier_n_content(util::syntax_ptr<class one_of_Type_Specifier_or_Type_Qualifier_n>&& one_of_Type_Specifier_or_Type_Qualifier_0)
+: m_Rule(193)
+, one_of_Type_Specifier_or_Type_Qualifier(std::move(one_of_Type_Specifier_or_Type_Qualifier_0)) {
+}
+#endif
+
+Ansi_C::list_of_one_of_Type_Specifier_or_Type_Qualifier_n_content::~list_of_one_of_Type_Specifier_or_Type_Qualifier_n_content() { }
+
+// Rule 97
+Ansi_C::Struct_Declarator_n::Struct_Declarator_n(const util::syntax_ptr<class Declarator_n>& Declarator_0, const util::syntax_ptr<class optional__colon__Constant_Expression_n>& optional__colon__Constant_Expression_1)
+: m_Rule(97)
+, Declarator(Declarator_0)
+, optional__colon__Constant_Expression(optional__colon__Constant_Expression_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Struct_Declarator_n::Struct_Declarator_n(util::syntax_ptr<class Declarator_n>&& Declarator_0, util::syntax_ptr<class optional__colon__Constant_Expression_n>&& optional__colon__Constant_Expression_1)
+: m_Rule(97)
+, Declarator(std::move(Declarator_0))
+, optional__colon__Constant_Expression(std::move(optional__colon__Constant_Expression_1)) {
+}
+#endif
+
+// Rule 98
+Ansi_C::Struct_Declarator_n::Struct_Declarator_n(const util::syntax_ptr<class _colon__n>& _colon__0, const util::syntax_ptr<class Constant_Expression_n>& Constant_Expression_1)
+: m_Rule(98)
+, _colon_(_colon__0)
+, Constant_Expression(Constant_Expression_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Struct_Declarator_n::Struct_Declarator_n(util::syntax_ptr<class _colon__n>&& _colon__0, util::syntax_ptr<class Constant_Expression_n>&& Constant_Expression_1)
+: m_Rule(98)
+, _colon_(std::move(_colon__0))
+, Constant_Expression(std::move(Constant_Expression_1)) {
+}
+#endif
+
+Ansi_C::Struct_Declarator_n::~Struct_Declarator_n() { }
+
+// Rule 259
+Ansi_C::list_of__comma__Struct_Declarator_n_content::list_of__comma__Struct_Declarator_n_content(const util::syntax_ptr<class _comma__n>& _comma__0, const util::syntax_ptr<class Struct_Declarator_n>& Struct_Declarator_1)
+: m_Rule(259)
+, _comma_(_comma__0)
+, Struct_Declarator(Struct_Declarator_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::list_of__comma__Struct_Declarator_n_content::list_of__comma__Struct_Declarator_n_content(util::syntax_ptr<class _comma__n>&& _comma__0, util::syntax_ptr<class Struct_Declarator_n>&& Struct_Declarator_1)
+: m_Rule(259)
+, _comma_(std::move(_comma__0))
+, Struct_Declarator(std::move(Struct_Declarator_1)) {
+}
+#endif
+
+Ansi_C::list_of__comma__Struct_Declarator_n_content::~list_of__comma__Struct_Declarator_n_content() { }
+
+// Rule 256
+Ansi_C::optional__colon__Constant_Expression_n::optional__colon__Constant_Expression_n(const dfa::position& pos)
+: m_Rule(256)
+, m_Position(pos) {
+}
+
+// Rule 257
+Ansi_C::optional__colon__Constant_Expression_n::optional__colon__Constant_Expression_n(const util::syntax_ptr<class _colon__n>& _colon__0, const util::syntax_ptr<class Constant_Expression_n>& Constant_Expression_1)
+: m_Rule(257)
+, _colon_(_colon__0)
+, Constant_Expression(Constant_Expression_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::optional__colon__Constant_Expression_n::optional__colon__Constant_Expression_n(util::syntax_ptr<class _colon__n>&& _colon__0, util::syntax_ptr<class Constant_Expression_n>&& Constant_Expression_1)
+: m_Rule(257)
+, _colon_(std::move(_colon__0))
+, Constant_Expression(std::move(Constant_Expression_1)) {
+}
+#endif
+
+Ansi_C::optional__colon__Constant_Expression_n::~optional__colon__Constant_Expression_n() { }
+
+// Rule 167
+Ansi_C::optional_identifier_n::optional_identifier_n(const dfa::position& pos)
+: m_Rule(167)
+, m_Position(pos) {
+}
+
+// Rule 168
+Ansi_C::optional_identifier_n::optional_identifier_n(const util::syntax_ptr<class identifier_n>& identifier_0)
+: m_Rule(168)
+, identifier(identifier_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::optional_identifier_n::optional_identifier_n(util::syntax_ptr<class identifier_n>&& identifier_0)
+: m_Rule(168)
+, identifier(std::move(identifier_0)) {
+}
+#endif
+
+Ansi_C::optional_identifier_n::~optional_identifier_n() { }
+
+// Rule 101
+Ansi_C::Enumerator_List_n::Enumerator_List_n(const util::syntax_ptr<class Enumerator_n>& Enumerator_0, const util::syntax_ptr<class list_of__comma__Enumerator_n>& list_of__comma__Enumerator_1)
+: m_Rule(101)
+, Enumerator(Enumerator_0)
+, list_of__comma__Enumerator(list_of__comma__Enumerator_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Enumerator_List_n::Enumerator_List_n(util::syntax_ptr<class Enumerator_n>&& Enumerator_0, util::syntax_ptr<class list_of__comma__Enumerator_n>&& list_of__comma__Enumerator_1)
+: m_Rule(101)
+, Enumerator(std::move(Enumerator_0))
+, list_of__comma__Enumerator(std::move(list_of__comma__Enumerator_1)) {
+}
+#endif
+
+Ansi_C::Enumerator_List_n::~Enumerator_List_n() { }
+
+// Rule 102
+Ansi_C::Enumerator_n::Enumerator_n(const util::syntax_ptr<class identifier_n>& identifier_0, const util::syntax_ptr<class optional__equals__Constant_Expression_n>& optional__equals__Constant_Expression_1)
+: m_Rule(102)
+, identifier(identifier_0)
+, optional__equals__Constant_Expression(optional__equals__Constant_Expression_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Enumerator_n::Enumerator_n(util::syntax_ptr<class identifier_n>&& identifier_0, util::syntax_ptr<class optional__equals__Constant_Expression_n>&& optional__equals__Constant_Expression_1)
+: m_Rule(102)
+, identifier(std::move(identifier_0))
+, optional__equals__Constant_Expression(std::move(optional__equals__Constant_Expression_1)) {
+}
+#endif
+
+Ansi_C::Enumerator_n::~Enumerator_n() { }
+
+// Rule 208
+Ansi_C::list_of__comma__Enumerator_n_content::list_of__comma__Enumerator_n_content(const util::syntax_ptr<class _comma__n>& _comma__0, const util::syntax_ptr<class Enumerator_n>& Enumerator_1)
+: m_Rule(208)
+, _comma_(_comma__0)
+, Enumerator(Enumerator_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::list_of__comma__Enumerator_n_content::list_of__comma__Enumerator_n_content(util::syntax_ptr<class _comma__n>&& _comma__0, util::syntax_ptr<class Enumerator_n>&& Enumerator_1)
+: m_Rule(208)
+, _comma_(std::move(_comma__0))
+, Enumerator(std::move(Enumerator_1)) {
+}
+#endif
+
+Ansi_C::list_of__comma__Enumerator_n_content::~list_of__comma__Enumerator_n_content() { }
+
+// Rule 205
+Ansi_C::optional__equals__Constant_Expression_n::optional__equals__Constant_Expression_n(const dfa::position& pos)
+: m_Rule(205)
+, m_Position(pos) {
+}
+
+// Rule 206
+Ansi_C::optional__equals__Constant_Expression_n::optional__equals__Constant_Expression_n(const util::syntax_ptr<class _equals__n>& _equals__0, const util::syntax_ptr<class Constant_Expression_n>& Constant_Expression_1)
+: m_Rule(206)
+, _equals_(_equals__0)
+, Constant_Expression(Constant_Expression_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::optional__equals__Constant_Expression_n::optional__equals__Constant_Expression_n(util::syntax_ptr<class _equals__n>&& _equals__0, util::syntax_ptr<class Constant_Expression_n>&& Constant_Expression_1)
+: m_Rule(206)
+, _equals_(std::move(_equals__0))
+, Constant_Expression(std::move(Constant_Expression_1)) {
+}
+#endif
+
+Ansi_C::optional__equals__Constant_Expression_n::~optional__equals__Constant_Expression_n() { }
+
+// Rule 111
+Ansi_C::Pointer_n::Pointer_n(const util::syntax_ptr<class _star__n>& _star__0, const util::syntax_ptr<class list_of_Type_Qualifier_n>& list_of_Type_Qualifier_1)
+: m_Rule(111)
+, _star_(_star__0)
+, list_of_Type_Qualifier(list_of_Type_Qualifier_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Pointer_n::Pointer_n(util::syntax_ptr<class _star__n>&& _star__0, util::syntax_ptr<class list_of_Type_Qualifier_n>&& list_of_Type_Qualifier_1)
+: m_Rule(111)
+, _star_(std::move(_star__0))
+, list_of_Type_Qualifier(std::move(list_of_Type_Qualifier_1)) {
+}
+#endif
+
+// Rule 112
+Ansi_C::Pointer_n::Pointer_n(const util::syntax_ptr<class _star__n>& _star__0, const util::syntax_ptr<class list_of_Type_Qualifier_n>& list_of_Type_Qualifier_1, const util::syntax_ptr<class Pointer_n>& Pointer_2)
+: m_Rule(112)
+, _star_(_star__0)
+, list_of_Type_Qualifier(list_of_Type_Qualifier_1)
+, Pointer(Pointer_2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Pointer_n::Pointer_n(util::syntax_ptr<class _star__n>&& _star__0, util::syntax_ptr<class list_of_Type_Qualifier_n>&& list_of_Type_Qualifier_1, util::syntax_ptr<class Pointer_n>&& Pointer_2)
+: m_Rule(112)
+, _star_(std::move(_star__0))
+, list_of_Type_Qualifier(std::move(list_of_Type_Qualifier_1))
+, Pointer(std::move(Pointer_2)) {
+}
+#endif
+
+Ansi_C::Pointer_n::~Pointer_n() { }
+
+// Rule 165
+Ansi_C::optional_Pointer_n::optional_Pointer_n(const dfa::position& pos)
+: m_Rule(165)
+, m_Position(pos) {
+}
+
+// Rule 166
+Ansi_C::optional_Pointer_n::optional_Pointer_n(const util::syntax_ptr<class Pointer_n>& Pointer_0)
+: m_Rule(166)
+, Pointer(Pointer_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::optional_Pointer_n::optional_Pointer_n(util::syntax_ptr<class Pointer_n>&& Pointer_0)
+: m_Rule(166)
+, Pointer(std::move(Pointer_0)) {
+}
+#endif
+
+Ansi_C::optional_Pointer_n::~optional_Pointer_n() { }
+
+// Rule 106
+Ansi_C::Direct_Declarator_n::Direct_Declarator_n(const util::syntax_ptr<class identifier_n>& identifier_0)
+: m_Rule(106)
+, identifier(identifier_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Direct_Declarator_n::Direct_Declarator_n(util::syntax_ptr<class identifier_n>&& identifier_0)
+: m_Rule(106)
+, identifier(std::move(identifier_0)) {
+}
+#endif
+
+// Rule 107
+Ansi_C::Direct_Declarator_n::Direct_Declarator_n(const util::syntax_ptr<class _openparen__n>& _openparen__0, const util::syntax_ptr<class Declarator_n>& Declarator_1, const util::syntax_ptr<class _closeparen__n>& _closeparen__2)
+: m_Rule(107)
+, _openparen_(_openparen__0)
+, Declarator(Declarator_1)
+, _closeparen_(_closeparen__2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Direct_Declarator_n::Direct_Declarator_n(util::syntax_ptr<class _openparen__n>&& _openparen__0, util::syntax_ptr<class Declarator_n>&& Declarator_1, util::syntax_ptr<class _closeparen__n>&& _closeparen__2)
+: m_Rule(107)
+, _openparen_(std::move(_openparen__0))
+, Declarator(std::move(Declarator_1))
+, _closeparen_(std::move(_closeparen__2)) {
+}
+#endif
+
+// Rule 108
+Ansi_C::Direct_Declarator_n::Direct_Declarator_n(const util::syntax_ptr<class Direct_Declarator_n>& Direct_Declarator_0, const util::syntax_ptr<class _opensquare__n>& _opensquare__1, const util::syntax_ptr<class optional_Constant_Expression_n>& optional_Constant_Expression_2, const util::syntax_ptr<class _closesquare__n>& _closesquare__3)
+: m_Rule(108)
+, Direct_Declarator(Direct_Declarator_0)
+, _opensquare_(_opensquare__1)
+, optional_Constant_Expression(optional_Constant_Expression_2)
+, _closesquare_(_closesquare__3) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Direct_Declarator_n::Direct_Declarator_n(util::syntax_ptr<class Direct_Declarator_n>&& Direct_Declarator_0, util::syntax_ptr<class _opensquare__n>&& _opensquare__1, util::syntax_ptr<class optional_Constant_Expression_n>&& optional_Constant_Expression_2, util::syntax_ptr<class _closesquare__n>&& _closesquare__3)
+: m_Rule(108)
+, Direct_Declarator(std::move(Direct_Declarator_0))
+, _opensquare_(std::move(_opensquare__1))
+, optional_Constant_Expression(std::move(optional_Constant_Expression_2))
+, _closesquare_(std::move(_closesquare__3)) {
+}
+#endif
+
+// Rule 109
+Ansi_C::Direct_Declarator_n::Direct_Declarator_n(const util::syntax_ptr<class Direct_Declarator_n>& Direct_Declarator_0, const util::syntax_ptr<class _openparen__n>& _openparen__1, const util::syntax_ptr<class one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n>& one_of_unknown_item_Parameter_Type_List_or_Identifier_List_2, const util::syntax_ptr<class _closeparen__n>& _closeparen__3)
+: m_Rule(109)
+, Direct_Declarator(Direct_Declarator_0)
+, _openparen_(_openparen__1)
+, one_of_unknown_item_Parameter_Type_List_or_Identifier_List(one_of_unknown_item_Parameter_Type_List_or_Identifier_List_2)
+, _closeparen_(_closeparen__3) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Direct_Declarator_n::Direct_Declarator_n(util::syntax_ptr<class Direct_Declarator_n>&& Direct_Declarator_0, util::syntax_ptr<class _openparen__n>&& _openparen__1, util::syntax_ptr<class one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n>&& one_of_unknown_item_Parameter_Type_List_or_Identifier_List_2, util::syntax_ptr<class _closeparen__n>&& _closeparen__3)
+: m_Rule(109)
+, Direct_Declarator(std::move(Direct_Declarator_0))
+, _openparen_(std::move(_openparen__1))
+, one_of_unknown_item_Parameter_Type_List_or_Identifier_List(std::move(one_of_unknown_item_Parameter_Type_List_or_Identifier_List_2))
+, _closeparen_(std::move(_closeparen__3)) {
+}
+#endif
+
+// Rule 110
+Ansi_C::Direct_Declarator_n::Direct_Declarator_n(const util::syntax_ptr<class Direct_Declarator_n>& Direct_Declarator_0, const util::syntax_ptr<class _openparen__n>& _openparen__1, const util::syntax_ptr<class _closeparen__n>& _closeparen__2)
+: m_Rule(110)
+, Direct_Declarator(Direct_Declarator_0)
+, _openparen_(_openparen__1)
+, _closeparen_(_closeparen__2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Direct_Declarator_n::Direct_Declarator_n(util::syntax_ptr<class Direct_Declarator_n>&& Direct_Declarator_0, util::syntax_ptr<class _openparen__n>&& _openparen__1, util::syntax_ptr<class _closeparen__n>&& _closeparen__2)
+: m_Rule(110)
+, Direct_Declarator(std::move(Direct_Declarator_0))
+, _openparen_(std::move(_openparen__1))
+, _closeparen_(std::move(_closeparen__2)) {
+}
+#endif
+
+Ansi_C::Direct_Declarator_n::~Direct_Declarator_n() { }
+
+// Rule 197
+Ansi_C::optional_Constant_Expression_n::optional_Constant_Expression_n(const dfa::position& pos)
+: m_Rule(197)
+, m_Position(pos) {
+}
+
+// Rule 198
+Ansi_C::optional_Constant_Expression_n::optional_Constant_Expression_n(const util::syntax_ptr<class Constant_Expression_n>& Constant_Expression_0)
+: m_Rule(198)
+, Constant_Expression(Constant_Expression_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::optional_Constant_Expression_n::optional_Constant_Expression_n(util::syntax_ptr<class Constant_Expression_n>&& Constant_Expression_0)
+: m_Rule(198)
+, Constant_Expression(std::move(Constant_Expression_0)) {
+}
+#endif
+
+Ansi_C::optional_Constant_Expression_n::~optional_Constant_Expression_n() { }
+
+// Rule 113
+Ansi_C::Parameter_Type_List_n::Parameter_Type_List_n(const util::syntax_ptr<class Parameter_Declarator_n>& Parameter_Declarator_0, const util::syntax_ptr<class list_of__comma__Parameter_Declarator_n>& list_of__comma__Parameter_Declarator_1, const util::syntax_ptr<class optional__comma___dot__dot__dot__n>& optional__comma___dot__dot__dot__2)
+: m_Rule(113)
+, Parameter_Declarator(Parameter_Declarator_0)
+, list_of__comma__Parameter_Declarator(list_of__comma__Parameter_Declarator_1)
+, optional__comma___dot__dot__dot_(optional__comma___dot__dot__dot__2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Parameter_Type_List_n::Parameter_Type_List_n(util::syntax_ptr<class Parameter_Declarator_n>&& Parameter_Declarator_0, util::syntax_ptr<class list_of__comma__Parameter_Declarator_n>&& list_of__comma__Parameter_Declarator_1, util::syntax_ptr<class optional__comma___dot__dot__dot__n>&& optional__comma___dot__dot__dot__2)
+: m_Rule(113)
+, Parameter_Declarator(std::move(Parameter_Declarator_0))
+, list_of__comma__Parameter_Declarator(std::move(list_of__comma__Parameter_Declarator_1))
+, optional__comma___dot__dot__dot_(std::move(optional__comma___dot__dot__dot__2)) {
+}
+#endif
+
+Ansi_C::Parameter_Type_List_n::~Parameter_Type_List_n() { }
+
+// Rule 115
+Ansi_C::Identifier_List_n::Identifier_List_n(const util::syntax_ptr<class identifier_n>& identifier_0, const util::syntax_ptr<class list_of__comma__identifier_n>& list_of__comma__identifier_1)
+: m_Rule(115)
+, identifier(identifier_0)
+, list_of__comma__identifier(list_of__comma__identifier_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Identifier_List_n::Identifier_List_n(util::syntax_ptr<class identifier_n>&& identifier_0, util::syntax_ptr<class list_of__comma__identifier_n>&& list_of__comma__identifier_1)
+: m_Rule(115)
+, identifier(std::move(identifier_0))
+, list_of__comma__identifier(std::move(list_of__comma__identifier_1)) {
+}
+#endif
+
+Ansi_C::Identifier_List_n::~Identifier_List_n() { }
+
+// Rule 195
+Ansi_C::one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n::one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n(const util::syntax_ptr<class Parameter_Type_List_n>& Parameter_Type_List_0)
+: m_Rule(195)
+, Parameter_Type_List(Parameter_Type_List_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n::one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n(util::syntax_ptr<class Parameter_Type_List_n>&& Parameter_Type_List_0)
+: m_Rule(195)
+, Parameter_Type_List(std::move(Parameter_Type_List_0)) {
+}
+#endif
+
+// Rule 196
+Ansi_C::one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n::one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n(const util::syntax_ptr<class Identifier_List_n>& Identifier_List_0)
+: m_Rule(196)
+, Identifier_List(Identifier_List_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n::one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n(util::syntax_ptr<class Identifier_List_n>&& Identifier_List_0)
+: m_Rule(196)
+, Identifier_List(std::move(Identifier_List_0)) {
+}
+#endif
+
+Ansi_C::one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n::~one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n() { }
+
+// Rule 171
+Ansi_C::list_of_Type_Qualifier_n_content::list_of_Type_Qualifier_n_content(const util::syntax_ptr<class Type_Qualifier_n>& Type_Qualifier_0)
+: m_Rule(171)
+, Type_Qualifier(Type_Qualifier_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::list_of_Type_Qualifier_n_content::list_of_Type_Qualifier_n_content(util::syntax_ptr<class Type_Qualifier_n>&& Type_Qualifier_0)
+: m_Rule(171)
+, Type_Qualifier(std::move(Type_Qualifier_0)) {
+}
+#endif
+
+Ansi_C::list_of_Type_Qualifier_n_content::~list_of_Type_Qualifier_n_content() { }
+
+// Rule 114
+Ansi_C::Parameter_Declarator_n::Parameter_Declarator_n(const util::syntax_ptr<class Declaration_Specifiers_n>& Declaration_Specifiers_0, const util::syntax_ptr<class optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n>& optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_1)
+: m_Rule(114)
+, Declaration_Specifiers(Declaration_Specifiers_0)
+, optional_one_of_unknown_item_Declarator_or_Abstract_Declarator(optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Parameter_Declarator_n::Parameter_Declarator_n(util::syntax_ptr<class Declaration_Specifiers_n>&& Declaration_Specifiers_0, util::syntax_ptr<class optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n>&& optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_1)
+: m_Rule(114)
+, Declaration_Specifiers(std::move(Declaration_Specifiers_0))
+, optional_one_of_unknown_item_Declarator_or_Abstract_Declarator(std::move(optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_1)) {
+}
+#endif
+
+Ansi_C::Parameter_Declarator_n::~Parameter_Declarator_n() { }
+
+// Rule 251
+Ansi_C::list_of__comma__Parameter_Declarator_n_content::list_of__comma__Parameter_Declarator_n_content(const util::syntax_ptr<class _comma__n>& _comma__0, const util::syntax_ptr<class Parameter_Declarator_n>& Parameter_Declarator_1)
+: m_Rule(251)
+, _comma_(_comma__0)
+, Parameter_Declarator(Parameter_Declarator_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::list_of__comma__Parameter_Declarator_n_content::list_of__comma__Parameter_Declarator_n_content(util::syntax_ptr<class _comma__n>&& _comma__0, util::syntax_ptr<class Parameter_Declarator_n>&& Parameter_Declarator_1)
+: m_Rule(251)
+, _comma_(std::move(_comma__0))
+, Parameter_Declarator(std::move(Parameter_Declarator_1)) {
+}
+#endif
+
+Ansi_C::list_of__comma__Parameter_Declarator_n_content::~list_of__comma__Parameter_Declarator_n_content() { }
+
+// Rule 267
+Ansi_C::optional__comma___dot__dot__dot__n::optional__comma___dot__dot__dot__n(const dfa::position& pos)
+: m_Rule(267)
+, m_Position(pos) {
+}
+
+// Rule 268
+Ansi_C::optional__comma___dot__dot__dot__n::optional__comma___dot__dot__dot__n(const util::syntax_ptr<class _comma__n>& _comma__0, const util::syntax_ptr<class _dot__dot__dot__n>& _dot__dot__dot__1)
+: m_Rule(268)
+, _comma_(_comma__0)
+, _dot__dot__dot_(_dot__dot__dot__1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::optional__comma___dot__dot__dot__n::optional__comma___dot__dot__dot__n(util::syntax_ptr<class _comma__n>&& _comma__0, util::syntax_ptr<class _dot__dot__dot__n>&& _dot__dot__dot__1)
+: m_Rule(268)
+, _comma_(std::move(_comma__0))
+, _dot__dot__dot_(std::move(_dot__dot__dot__1)) {
+}
+#endif
+
+Ansi_C::optional__comma___dot__dot__dot__n::~optional__comma___dot__dot__dot__n() { }
+
+// Rule 277
+Ansi_C::one_of__comma__or__closeparen__n::one_of__comma__or__closeparen__n(const util::syntax_ptr<class _comma__n>& _comma__0)
+: m_Rule(277)
+, _comma_(_comma__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__comma__or__closeparen__n::one_of__comma__or__closeparen__n(util::syntax_ptr<class _comma__n>&& _comma__0)
+: m_Rule(277)
+, _comma_(std::move(_comma__0)) {
+}
+#endif
+
+// Rule 278
+Ansi_C::one_of__comma__or__closeparen__n::one_of__comma__or__closeparen__n(const util::syntax_ptr<class _closeparen__n>& _closeparen__0)
+: m_Rule(278)
+, _closeparen_(_closeparen__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of__comma__or__closeparen__n::one_of__comma__or__closeparen__n(util::syntax_ptr<class _closeparen__n>&& _closeparen__0)
+: m_Rule(278)
+, _closeparen_(std::move(_closeparen__0)) {
+}
+#endif
+
+Ansi_C::one_of__comma__or__closeparen__n::~one_of__comma__or__closeparen__n() { }
+
+// Rule 248
+Ansi_C::one_of_unknown_item_Declarator_or_Abstract_Declarator_n::one_of_unknown_item_Declarator_or_Abstract_Declarator_n(const util::syntax_ptr<class Declarator_n>& Declarator_0)
+: m_Rule(248)
+, Declarator(Declarator_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of_unknown_item_Declarator_or_Abstract_Declarator_n::one_of_unknown_item_Declarator_or_Abstract_Declarator_n(util::syntax_ptr<class Declarator_n>&& Declarator_0)
+: m_Rule(248)
+, Declarator(std::move(Declarator_0)) {
+}
+#endif
+
+// Rule 249
+Ansi_C::one_of_unknown_item_Declarator_or_Abstract_Declarator_n::one_of_unknown_item_Declarator_or_Abstract_Declarator_n(const util::syntax_ptr<class Abstract_Declarator_n>& Abstract_Declarator_0)
+: m_Rule(249)
+, Abstract_Declarator(Abstract_Declarator_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of_unknown_item_Declarator_or_Abstract_Declarator_n::one_of_unknown_item_Declarator_or_Abstract_Declarator_n(util::syntax_ptr<class Abstract_Declarator_n>&& Abstract_Declarator_0)
+: m_Rule(249)
+, Abstract_Declarator(std::move(Abstract_Declarator_0)) {
+}
+#endif
+
+Ansi_C::one_of_unknown_item_Declarator_or_Abstract_Declarator_n::~one_of_unknown_item_Declarator_or_Abstract_Declarator_n() { }
+
+// Rule 246
+Ansi_C::optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n::optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n(const dfa::position& pos)
+: m_Rule(246)
+, m_Position(pos) {
+}
+
+// Rule 247
+Ansi_C::optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n::optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n(const util::syntax_ptr<class one_of_unknown_item_Declarator_or_Abstract_Declarator_n>& one_of_unknown_item_Declarator_or_Abstract_Declarator_0)
+: m_Rule(247)
+, one_of_unknown_item_Declarator_or_Abstract_Declarator(one_of_unknown_item_Declarator_or_Abstract_Declarator_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n::optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n(util::syntax_ptr<class one_of_unknown_item_Declarator_or_Abstract_Declarator_n>&& one_of_unknown_item_Declarator_or_Abstract_Declarator_0)
+: m_Rule(247)
+, one_of_unknown_item_Declarator_or_Abstract_Declarator(std::move(one_of_unknown_item_Declarator_or_Abstract_Declarator_0)) {
+}
+#endif
+
+Ansi_C::optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n::~optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n() { }
+
+// Rule 212
+Ansi_C::list_of__comma__identifier_n_content::list_of__comma__identifier_n_content(const util::syntax_ptr<class _comma__n>& _comma__0, const util::syntax_ptr<class identifier_n>& identifier_1)
+: m_Rule(212)
+, _comma_(_comma__0)
+, identifier(identifier_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::list_of__comma__identifier_n_content::list_of__comma__identifier_n_content(util::syntax_ptr<class _comma__n>&& _comma__0, util::syntax_ptr<class identifier_n>&& identifier_1)
+: m_Rule(212)
+, _comma_(std::move(_comma__0))
+, identifier(std::move(identifier_1)) {
+}
+#endif
+
+Ansi_C::list_of__comma__identifier_n_content::~list_of__comma__identifier_n_content() { }
+
+// Rule 119
+Ansi_C::Direct_Abstract_Declarator_n::Direct_Abstract_Declarator_n(const util::syntax_ptr<class _openparen__n>& _openparen__0, const util::syntax_ptr<class optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n>& optional_one_of_Abstract_Declarator_or_Parameter_Type_List_1, const util::syntax_ptr<class _closeparen__n>& _closeparen__2)
+: m_Rule(119)
+, _openparen_(_openparen__0)
+, optional_one_of_Abstract_Declarator_or_Parameter_Type_List(optional_one_of_Abstract_Declarator_or_Parameter_Type_List_1)
+, _closeparen_(_closeparen__2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Direct_Abstract_Declarator_n::Direct_Abstract_Declarator_n(util::syntax_ptr<class _openparen__n>&& _openparen__0, util::syntax_ptr<class optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n>&& optional_one_of_Abstract_Declarator_or_Parameter_Type_List_1, util::syntax_ptr<class _closeparen__n>&& _closeparen__2)
+: m_Rule(119)
+, _openparen_(std::move(_openparen__0))
+, optional_one_of_Abstract_Declarator_or_Parameter_Type_List(std::move(optional_one_of_Abstract_Declarator_or_Parameter_Type_List_1))
+, _closeparen_(std::move(_closeparen__2)) {
+}
+#endif
+
+// Rule 120
+Ansi_C::Direct_Abstract_Declarator_n::Direct_Abstract_Declarator_n(const util::syntax_ptr<class _opensquare__n>& _opensquare__0, const util::syntax_ptr<class optional_Constant_Expression_n>& optional_Constant_Expression_1, const util::syntax_ptr<class _closesquare__n>& _closesquare__2)
+: m_Rule(120)
+, _opensquare_(_opensquare__0)
+, optional_Constant_Expression(optional_Constant_Expression_1)
+, _closesquare_(_closesquare__2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Direct_Abstract_Declarator_n::Direct_Abstract_Declarator_n(util::syntax_ptr<class _opensquare__n>&& _opensquare__0, util::syntax_ptr<class optional_Constant_Expression_n>&& optional_Constant_Expression_1, util::syntax_ptr<class _closesquare__n>&& _closesquare__2)
+: m_Rule(120)
+, _opensquare_(std::move(_opensquare__0))
+, optional_Constant_Expression(std::move(optional_Constant_Expression_1))
+, _closesquare_(std::move(_closesquare__2)) {
+}
+#endif
+
+// Rule 121
+Ansi_C::Direct_Abstract_Declarator_n::Direct_Abstract_Declarator_n(const util::syntax_ptr<class Direct_Abstract_Declarator_n>& Direct_Abstract_Declarator_0, const util::syntax_ptr<class _opensquare__n>& _opensquare__1, const util::syntax_ptr<class optional_Constant_Expression_n>& optional_Constant_Expression_2, const util::syntax_ptr<class _closesquare__n>& _closesquare__3)
+: m_Rule(121)
+, Direct_Abstract_Declarator(Direct_Abstract_Declarator_0)
+, _opensquare_(_opensquare__1)
+, optional_Constant_Expression(optional_Constant_Expression_2)
+, _closesquare_(_closesquare__3) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Direct_Abstract_Declarator_n::Direct_Abstract_Declarator_n(util::syntax_ptr<class Direct_Abstract_Declarator_n>&& Direct_Abstract_Declarator_0, util::syntax_ptr<class _opensquare__n>&& _opensquare__1, util::syntax_ptr<class optional_Constant_Expression_n>&& optional_Constant_Expression_2, util::syntax_ptr<class _closesquare__n>&& _closesquare__3)
+: m_Rule(121)
+, Direct_Abstract_Declarator(std::move(Direct_Abstract_Declarator_0))
+, _opensquare_(std::move(_opensquare__1))
+, optional_Constant_Expression(std::move(optional_Constant_Expression_2))
+, _closesquare_(std::move(_closesquare__3)) {
+}
+#endif
+
+// Rule 122
+Ansi_C::Direct_Abstract_Declarator_n::Direct_Abstract_Declarator_n(const util::syntax_ptr<class Direct_Abstract_Declarator_n>& Direct_Abstract_Declarator_0, const util::syntax_ptr<class _openparen__n>& _openparen__1, const util::syntax_ptr<class optional_Parameter_Type_List_n>& optional_Parameter_Type_List_2, const util::syntax_ptr<class _closeparen__n>& _closeparen__3)
+: m_Rule(122)
+, Direct_Abstract_Declarator(Direct_Abstract_Declarator_0)
+, _openparen_(_openparen__1)
+, optional_Parameter_Type_List(optional_Parameter_Type_List_2)
+, _closeparen_(_closeparen__3) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Direct_Abstract_Declarator_n::Direct_Abstract_Declarator_n(util::syntax_ptr<class Direct_Abstract_Declarator_n>&& Direct_Abstract_Declarator_0, util::syntax_ptr<class _openparen__n>&& _openparen__1, util::syntax_ptr<class optional_Parameter_Type_List_n>&& optional_Parameter_Type_List_2, util::syntax_ptr<class _closeparen__n>&& _closeparen__3)
+: m_Rule(122)
+, Direct_Abstract_Declarator(std::move(Direct_Abstract_Declarator_0))
+, _openparen_(std::move(_openparen__1))
+, optional_Parameter_Type_List(std::move(optional_Parameter_Type_List_2))
+, _closeparen_(std::move(_closeparen__3)) {
+}
+#endif
+
+Ansi_C::Direct_Abstract_Declarator_n::~Direct_Abstract_Declarator_n() { }
+
+// Rule 265
+Ansi_C::optional_Direct_Abstract_Declarator_n::optional_Direct_Abstract_Declarator_n(const dfa::position& pos)
+: m_Rule(265)
+, m_Position(pos) {
+}
+
+// Rule 266
+Ansi_C::optional_Direct_Abstract_Declarator_n::optional_Direct_Abstract_Declarator_n(const util::syntax_ptr<class Direct_Abstract_Declarator_n>& Direct_Abstract_Declarator_0)
+: m_Rule(266)
+, Direct_Abstract_Declarator(Direct_Abstract_Declarator_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::optional_Direct_Abstract_Declarator_n::optional_Direct_Abstract_Declarator_n(util::syntax_ptr<class Direct_Abstract_Declarator_n>&& Direct_Abstract_Declarator_0)
+: m_Rule(266)
+, Direct_Abstract_Declarator(std::move(Direct_Abstract_Declarator_0)) {
+}
+#endif
+
+Ansi_C::optional_Direct_Abstract_Declarator_n::~optional_Direct_Abstract_Declarator_n() { }
+
+// Rule 263
+Ansi_C::one_of_Abstract_Declarator_or_Parameter_Type_List_n::one_of_Abstract_Declarator_or_Parameter_Type_List_n(const util::syntax_ptr<class Abstract_Declarator_n>& Abstract_Declarator_0)
+: m_Rule(263)
+, Abstract_Declarator(Abstract_Declarator_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of_Abstract_Declarator_or_Parameter_Type_List_n::one_of_Abstract_Declarator_or_Parameter_Type_List_n(util::syntax_ptr<class Abstract_Declarator_n>&& Abstract_Declarator_0)
+: m_Rule(263)
+, Abstract_Declarator(std::move(Abstract_Declarator_0)) {
+}
+#endif
+
+// Rule 264
+Ansi_C::one_of_Abstract_Declarator_or_Parameter_Type_List_n::one_of_Abstract_Declarator_or_Parameter_Type_List_n(const util::syntax_ptr<class Parameter_Type_List_n>& Parameter_Type_List_0)
+: m_Rule(264)
+, Parameter_Type_List(Parameter_Type_List_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::one_of_Abstract_Declarator_or_Parameter_Type_List_n::one_of_Abstract_Declarator_or_Parameter_Type_List_n(util::syntax_ptr<class Parameter_Type_List_n>&& Parameter_Type_List_0)
+: m_Rule(264)
+, Parameter_Type_List(std::move(Parameter_Type_List_0)) {
+}
+#endif
+
+Ansi_C::one_of_Abstract_Declarator_or_Parameter_Type_List_n::~one_of_Abstract_Declarator_or_Parameter_Type_List_n() { }
+
+// Rule 261
+Ansi_C::optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n::optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n(const dfa::position& pos)
+: m_Rule(261)
+, m_Position(pos) {
+}
+
+// Rule 262
+Ansi_C::optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n::optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n(const util::syntax_ptr<class one_of_Abstract_Declarator_or_Parameter_Type_List_n>& one_of_Abstract_Declarator_or_Parameter_Type_List_0)
+: m_Rule(262)
+, one_of_Abstract_Declarator_or_Parameter_Type_List(one_of_Abstract_Declarator_or_Parameter_Type_List_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n::optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n(util::syntax_ptr<class one_of_Abstract_Declarator_or_Parameter_Type_List_n>&& one_of_Abstract_Declarator_or_Parameter_Type_List_0)
+: m_Rule(262)
+, one_of_Abstract_Declarator_or_Parameter_Type_List(std::move(one_of_Abstract_Declarator_or_Parameter_Type_List_0)) {
+}
+#endif
+
+Ansi_C::optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n::~optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n() { }
+
+// Rule 279
+Ansi_C::optional_Parameter_Type_List_n::optional_Parameter_Type_List_n(const dfa::position& pos)
+: m_Rule(279)
+, m_Position(pos) {
+}
+
+// Rule 280
+Ansi_C::optional_Parameter_Type_List_n::optional_Parameter_Type_List_n(const util::syntax_ptr<class Parameter_Type_List_n>& Parameter_Type_List_0)
+: m_Rule(280)
+, Parameter_Type_List(Parameter_Type_List_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::optional_Parameter_Type_List_n::optional_Parameter_Type_List_n(util::syntax_ptr<class Parameter_Type_List_n>&& Parameter_Type_List_0)
+: m_Rule(280)
+, Parameter_Type_List(std::move(Parameter_Type_List_0)) {
+}
+#endif
+
+Ansi_C::optional_Parameter_Type_List_n::~optional_Parameter_Type_List_n() { }
+
+// Rule 255
+Ansi_C::list_of__comma__Initializer_n_content::list_of__comma__Initializer_n_content(const util::syntax_ptr<class _comma__n>& _comma__0, const util::syntax_ptr<class Initializer_n>& Initializer_1)
+: m_Rule(255)
+, _comma_(_comma__0)
+, Initializer(Initializer_1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::list_of__comma__Initializer_n_content::list_of__comma__Initializer_n_content(util::syntax_ptr<class _comma__n>&& _comma__0, util::syntax_ptr<class Initializer_n>&& Initializer_1)
+: m_Rule(255)
+, _comma_(std::move(_comma__0))
+, Initializer(std::move(Initializer_1)) {
+}
+#endif
+
+Ansi_C::list_of__comma__Initializer_n_content::~list_of__comma__Initializer_n_content() { }
+
+// Rule 275
+Ansi_C::optional__comma__n::optional__comma__n(const dfa::position& pos)
+: m_Rule(275)
+, m_Position(pos) {
+}
+
+// Rule 276
+Ansi_C::optional__comma__n::optional__comma__n(const util::syntax_ptr<class _comma__n>& _comma__0)
+: m_Rule(276)
+, _comma_(_comma__0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::optional__comma__n::optional__comma__n(util::syntax_ptr<class _comma__n>&& _comma__0)
+: m_Rule(276)
+, _comma_(std::move(_comma__0)) {
+}
+#endif
+
+Ansi_C::optional__comma__n::~optional__comma__n() { }
+
+// Rule 125
+Ansi_C::Statement_n::Statement_n(const util::syntax_ptr<class Labeled_Statement_n>& Labeled_Statement_0)
+: m_Rule(125)
+, Labeled_Statement(Labeled_Statement_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Statement_n::Statement_n(util::syntax_ptr<class Labeled_Statement_n>&& Labeled_Statement_0)
+: m_Rule(125)
+, Labeled_Statement(std::move(Labeled_Statement_0)) {
+}
+#endif
+
+// Rule 126
+Ansi_C::Statement_n::Statement_n(const util::syntax_ptr<class Compound_Statement_n>& Compound_Statement_0)
+: m_Rule(126)
+, Compound_Statement(Compound_Statement_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Statement_n::Statement_n(util::syntax_ptr<class Compound_Statement_n>&& Compound_Statement_0)
+: m_Rule(126)
+, Compound_Statement(std::move(Compound_Statement_0)) {
+}
+#endif
+
+// Rule 127
+Ansi_C::Statement_n::Statement_n(const util::syntax_ptr<class Expression_Statement_n>& Expression_Statement_0)
+: m_Rule(127)
+, Expression_Statement(Expression_Statement_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Statement_n::Statement_n(util::syntax_ptr<class Expression_Statement_n>&& Expression_Statement_0)
+: m_Rule(127)
+, Expression_Statement(std::move(Expression_Statement_0)) {
+}
+#endif
+
+// Rule 128
+Ansi_C::Statement_n::Statement_n(const util::syntax_ptr<class Selection_Statement_n>& Selection_Statement_0)
+: m_Rule(128)
+, Selection_Statement(Selection_Statement_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Statement_n::Statement_n(util::syntax_ptr<class Selection_Statement_n>&& Selection_Statement_0)
+: m_Rule(128)
+, Selection_Statement(std::move(Selection_Statement_0)) {
+}
+#endif
+
+// Rule 129
+Ansi_C::Statement_n::Statement_n(const util::syntax_ptr<class Iteration_Statement_n>& Iteration_Statement_0)
+: m_Rule(129)
+, Iteration_Statement(Iteration_Statement_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Statement_n::Statement_n(util::syntax_ptr<class Iteration_Statement_n>&& Iteration_Statement_0)
+: m_Rule(129)
+, Iteration_Statement(std::move(Iteration_Statement_0)) {
+}
+#endif
+
+// Rule 130
+Ansi_C::Statement_n::Statement_n(const util::syntax_ptr<class Jump_Statement_n>& Jump_Statement_0)
+: m_Rule(130)
+, Jump_Statement(Jump_Statement_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Statement_n::Statement_n(util::syntax_ptr<class Jump_Statement_n>&& Jump_Statement_0)
+: m_Rule(130)
+, Jump_Statement(std::move(Jump_Statement_0)) {
+}
+#endif
+
+Ansi_C::Statement_n::~Statement_n() { }
+
+// Rule 131
+Ansi_C::Labeled_Statement_n::Labeled_Statement_n(const util::syntax_ptr<class identifier_n>& identifier_0, const util::syntax_ptr<class _colon__n>& _colon__1, const util::syntax_ptr<class Statement_n>& Statement_2)
+: m_Rule(131)
+, identifier(identifier_0)
+, _colon_(_colon__1)
+, Statement(Statement_2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Labeled_Statement_n::Labeled_Statement_n(util::syntax_ptr<class identifier_n>&& identifier_0, util::syntax_ptr<class _colon__n>&& _colon__1, util::syntax_ptr<class Statement_n>&& Statement_2)
+: m_Rule(131)
+, identifier(std::move(identifier_0))
+, _colon_(std::move(_colon__1))
+, Statement(std::move(Statement_2)) {
+}
+#endif
+
+// Rule 132
+Ansi_C::Labeled_Statement_n::Labeled_Statement_n(const util::syntax_ptr<class case_n>& case_0, const util::syntax_ptr<class Constant_Expression_n>& Constant_Expression_1, const util::syntax_ptr<class _colon__n>& _colon__2, const util::syntax_ptr<class Statement_n>& Statement_3)
+: m_Rule(132)
+, case_2(case_0)
+, Constant_Expression(Constant_Expression_1)
+, _colon_(_colon__2)
+, Statement(Statement_3) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Labeled_Statement_n::Labeled_Statement_n(util::syntax_ptr<class case_n>&& case_0, util::syntax_ptr<class Constant_Expression_n>&& Constant_Expression_1, util::syntax_ptr<class _colon__n>&& _colon__2, util::syntax_ptr<class Statement_n>&& Statement_3)
+: m_Rule(132)
+, case_2(std::move(case_0))
+, Constant_Expression(std::move(Constant_Expression_1))
+, _colon_(std::move(_colon__2))
+, Statement(std::move(Statement_3)) {
+}
+#endif
+
+// Rule 133
+Ansi_C::Labeled_Statement_n::Labeled_Statement_n(const util::syntax_ptr<class default_n>& default_0, const util::syntax_ptr<class _colon__n>& _colon__1, const util::syntax_ptr<class Statement_n>& Statement_2)
+: m_Rule(133)
+, default_2(default_0)
+, _colon_(_colon__1)
+, Statement(Statement_2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Labeled_Statement_n::Labeled_Statement_n(util::syntax_ptr<class default_n>&& default_0, util::syntax_ptr<class _colon__n>&& _colon__1, util::syntax_ptr<class Statement_n>&& Statement_2)
+: m_Rule(133)
+, default_2(std::move(default_0))
+, _colon_(std::move(_colon__1))
+, Statement(std::move(Statement_2)) {
+}
+#endif
+
+Ansi_C::Labeled_Statement_n::~Labeled_Statement_n() { }
+
+// Rule 134
+Ansi_C::Compound_Statement_n::Compound_Statement_n(const util::syntax_ptr<class _opencurly__n>& _opencurly__0, const util::syntax_ptr<class optional_Declaration_List_n>& optional_Declaration_List_1, const util::syntax_ptr<class optional_Statement_List_n>& optional_Statement_List_2, const util::syntax_ptr<class _closecurly__n>& _closecurly__3)
+: m_Rule(134)
+, _opencurly_(_opencurly__0)
+, optional_Declaration_List(optional_Declaration_List_1)
+, optional_Statement_List(optional_Statement_List_2)
+, _closecurly_(_closecurly__3) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Compound_Statement_n::Compound_Statement_n(util::syntax_ptr<class _opencurly__n>&& _opencurly__0, util::syntax_ptr<class optional_Declaration_List_n>&& optional_Declaration_List_1, util::syntax_ptr<class optional_Statement_List_n>&& optional_Statement_List_2, util::syntax_ptr<class _closecurly__n>&& _closecurly__3)
+: m_Rule(134)
+, _opencurly_(std::move(_opencurly__0))
+, optional_Declaration_List(std::move(optional_Declaration_List_1))
+, optional_Statement_List(std::move(optional_Statement_List_2))
+, _closecurly_(std::move(_closecurly__3)) {
+}
+#endif
+
+Ansi_C::Compound_Statement_n::~Compound_Statement_n() { }
+
+// Rule 137
+Ansi_C::Expression_Statement_n::Expression_Statement_n(const util::syntax_ptr<class optional_Expression_n>& optional_Expression_0, const util::syntax_ptr<class _semicolon__n>& _semicolon__1)
+: m_Rule(137)
+, optional_Expression(optional_Expression_0)
+, _semicolon_(_semicolon__1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Expression_Statement_n::Expression_Statement_n(util::syntax_ptr<class optional_Expression_n>&& optional_Expression_0, util::syntax_ptr<class _semicolon__n>&& _semicolon__1)
+: m_Rule(137)
+, optional_Expression(std::move(optional_Expression_0))
+, _semicolon_(std::move(_semicolon__1)) {
+}
+#endif
+
+Ansi_C::Expression_Statement_n::~Expression_Statement_n() { }
+
+// Rule 138
+Ansi_C::Selection_Statement_n::Selection_Statement_n(const util::syntax_ptr<class if_n>& if_0, const util::syntax_ptr<class _openparen__n>& _openparen__1, const util::syntax_ptr<class Expression_n>& Expression_2, const util::syntax_ptr<class _closeparen__n>& _closeparen__3, const util::syntax_ptr<class Statement_n>& Statement_4)
+: m_Rule(138)
+, if_2(if_0)
+, _openparen_(_openparen__1)
+, Expression(Expression_2)
+, _closeparen_(_closeparen__3)
+, Statement(Statement_4) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Selection_Statement_n::Selection_Statement_n(util::syntax_ptr<class if_n>&& if_0, util::syntax_ptr<class _openparen__n>&& _openparen__1, util::syntax_ptr<class Expression_n>&& Expression_2, util::syntax_ptr<class _closeparen__n>&& _closeparen__3, util::syntax_ptr<class Statement_n>&& Statement_4)
+: m_Rule(138)
+, if_2(std::move(if_0))
+, _openparen_(std::move(_openparen__1))
+, Expression(std::move(Expression_2))
+, _closeparen_(std::move(_closeparen__3))
+, Statement(std::move(Statement_4)) {
+}
+#endif
+
+// Rule 139
+Ansi_C::Selection_Statement_n::Selection_Statement_n(const util::syntax_ptr<class if_n>& if_0, const util::syntax_ptr<class _openparen__n>& _openparen__1, const util::syntax_ptr<class Expression_n>& Expression_2, const util::syntax_ptr<class _closeparen__n>& _closeparen__3, const util::syntax_ptr<class Statement_n>& Statement_4, const util::syntax_ptr<class else_n>& else_5, const util::syntax_ptr<class Statement_n>& Statement_6)
+: m_Rule(139)
+, if_2(if_0)
+, _openparen_(_openparen__1)
+, Expression(Expression_2)
+, _closeparen_(_closeparen__3)
+, Statement(Statement_4)
+, else_2(else_5)
+, Statement_2(Statement_6) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Selection_Statement_n::Selection_Statement_n(util::syntax_ptr<class if_n>&& if_0, util::syntax_ptr<class _openparen__n>&& _openparen__1, util::syntax_ptr<class Expression_n>&& Expression_2, util::syntax_ptr<class _closeparen__n>&& _closeparen__3, util::syntax_ptr<class Statement_n>&& Statement_4, util::syntax_ptr<class else_n>&& else_5, util::syntax_ptr<class Statement_n>&& Statement_6)
+: m_Rule(139)
+, if_2(std::move(if_0))
+, _openparen_(std::move(_openparen__1))
+, Expression(std::move(Expression_2))
+, _closeparen_(std::move(_closeparen__3))
+, Statement(std::move(Statement_4))
+, else_2(std::move(else_5))
+, Statement_2(std::move(Statement_6)) {
+}
+#endif
+
+// Rule 140
+Ansi_C::Selection_Statement_n::Selection_Statement_n(const util::syntax_ptr<class switch_n>& switch_0, const util::syntax_ptr<class _openparen__n>& _openparen__1, const util::syntax_ptr<class Expression_n>& Expression_2, const util::syntax_ptr<class _closeparen__n>& _closeparen__3, const util::syntax_ptr<class Statement_n>& Statement_4)
+: m_Rule(140)
+, switch_2(switch_0)
+, _openparen_(_openparen__1)
+, Expression(Expression_2)
+, _closeparen_(_closeparen__3)
+, Statement(Statement_4) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Selection_Statement_n::Selection_Statement_n(util::syntax_ptr<class switch_n>&& switch_0, util::syntax_ptr<class _openparen__n>&& _openparen__1, util::syntax_ptr<class Expression_n>&& Expression_2, util::syntax_ptr<class _closeparen__n>&& _closeparen__3, util::syntax_ptr<class Statement_n>&& Statement_4)
+: m_Rule(140)
+, switch_2(std::move(switch_0))
+, _openparen_(std::move(_openparen__1))
+, Expression(std::move(Expression_2))
+, _closeparen_(std::move(_closeparen__3))
+, Statement(std::move(Statement_4)) {
+}
+#endif
+
+Ansi_C::Selection_Statement_n::~Selection_Statement_n() { }
+
+// Rule 141
+Ansi_C::Iteration_Statement_n::Iteration_Statement_n(const util::syntax_ptr<class while_n>& while_0, const util::syntax_ptr<class _openparen__n>& _openparen__1, const util::syntax_ptr<class Expression_n>& Expression_2, const util::syntax_ptr<class _closeparen__n>& _closeparen__3, const util::syntax_ptr<class Statement_n>& Statement_4)
+: m_Rule(141)
+, while_2(while_0)
+, _openparen_(_openparen__1)
+, Expression(Expression_2)
+, _closeparen_(_closeparen__3)
+, Statement(Statement_4) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Iteration_Statement_n::Iteration_Statement_n(util::syntax_ptr<class while_n>&& while_0, util::syntax_ptr<class _openparen__n>&& _openparen__1, util::syntax_ptr<class Expression_n>&& Expression_2, util::syntax_ptr<class _closeparen__n>&& _closeparen__3, util::syntax_ptr<class Statement_n>&& Statement_4)
+: m_Rule(141)
+, while_2(std::move(while_0))
+, _openparen_(std::move(_openparen__1))
+, Expression(std::move(Expression_2))
+, _closeparen_(std::move(_closeparen__3))
+, Statement(std::move(Statement_4)) {
+}
+#endif
+
+// Rule 142
+Ansi_C::Iteration_Statement_n::Iteration_Statement_n(const util::syntax_ptr<class do_n>& do_0, const util::syntax_ptr<class Statement_n>& Statement_1, const util::syntax_ptr<class while_n>& while_2, const util::syntax_ptr<class _openparen__n>& _openparen__3, const util::syntax_ptr<class Expression_n>& Expression_4, const util::syntax_ptr<class _closeparen__n>& _closeparen__5)
+: m_Rule(142)
+, do_2(do_0)
+, Statement(Statement_1)
+, while_2(while_2)
+, _openparen_(_openparen__3)
+, Expression(Expression_4)
+, _closeparen_(_closeparen__5) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Iteration_Statement_n::Iteration_Statement_n(util::syntax_ptr<class do_n>&& do_0, util::syntax_ptr<class Statement_n>&& Statement_1, util::syntax_ptr<class while_n>&& while_2, util::syntax_ptr<class _openparen__n>&& _openparen__3, util::syntax_ptr<class Expression_n>&& Expression_4, util::syntax_ptr<class _closeparen__n>&& _closeparen__5)
+: m_Rule(142)
+, do_2(std::move(do_0))
+, Statement(std::move(Statement_1))
+, while_2(std::move(while_2))
+, _openparen_(std::move(_openparen__3))
+, Expression(std::move(Expression_4))
+, _closeparen_(std::move(_closeparen__5)) {
+}
+#endif
+
+// Rule 143
+Ansi_C::Iteration_Statement_n::Iteration_Statement_n(const util::syntax_ptr<class for_n>& for_0, const util::syntax_ptr<class _openparen__n>& _openparen__1, const util::syntax_ptr<class Expression_Statement_n>& Expression_Statement_2, const util::syntax_ptr<class Expression_Statement_n>& Expression_Statement_3, const util::syntax_ptr<class optional_Expression_n>& optional_Expression_4, const util::syntax_ptr<class _closeparen__n>& _closeparen__5, const util::syntax_ptr<class Statement_n>& Statement_6)
+: m_Rule(143)
+, for_2(for_0)
+, _openparen_(_openparen__1)
+, Expression_Statement(Expression_Statement_2)
+, Expression_Statement_2(Expression_Statement_3)
+, optional_Expression(optional_Expression_4)
+, _closeparen_(_closeparen__5)
+, Statement(Statement_6) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Iteration_Statement_n::Iteration_Statement_n(util::syntax_ptr<class for_n>&& for_0, util::syntax_ptr<class _openparen__n>&& _openparen__1, util::syntax_ptr<class Expression_Statement_n>&& Expression_Statement_2, util::syntax_ptr<class Expression_Statement_n>&& Expression_Statement_3, util::syntax_ptr<class optional_Expression_n>&& optional_Expression_4, util::syntax_ptr<class _closeparen__n>&& _closeparen__5, util::syntax_ptr<class Statement_n>&& Statement_6)
+: m_Rule(143)
+, for_2(std::move(for_0))
+, _openparen_(std::move(_openparen__1))
+, Expression_Statement(std::move(Expression_Statement_2))
+, Expression_Statement_2(std::move(Expression_Statement_3))
+, optional_Expression(std::move(optional_Expression_4))
+, _closeparen_(std::move(_closeparen__5))
+, Statement(std::move(Statement_6)) {
+}
+#endif
+
+Ansi_C::Iteration_Statement_n::~Iteration_Statement_n() { }
+
+// Rule 144
+Ansi_C::Jump_Statement_n::Jump_Statement_n(const util::syntax_ptr<class goto_n>& goto_0, const util::syntax_ptr<class identifier_n>& identifier_1, const util::syntax_ptr<class _semicolon__n>& _semicolon__2)
+: m_Rule(144)
+, goto_2(goto_0)
+, identifier(identifier_1)
+, _semicolon_(_semicolon__2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Jump_Statement_n::Jump_Statement_n(util::syntax_ptr<class goto_n>&& goto_0, util::syntax_ptr<class identifier_n>&& identifier_1, util::syntax_ptr<class _semicolon__n>&& _semicolon__2)
+: m_Rule(144)
+, goto_2(std::move(goto_0))
+, identifier(std::move(identifier_1))
+, _semicolon_(std::move(_semicolon__2)) {
+}
+#endif
+
+// Rule 145
+Ansi_C::Jump_Statement_n::Jump_Statement_n(const util::syntax_ptr<class continue_n>& continue_0, const util::syntax_ptr<class _semicolon__n>& _semicolon__1)
+: m_Rule(145)
+, continue_2(continue_0)
+, _semicolon_(_semicolon__1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Jump_Statement_n::Jump_Statement_n(util::syntax_ptr<class continue_n>&& continue_0, util::syntax_ptr<class _semicolon__n>&& _semicolon__1)
+: m_Rule(145)
+, continue_2(std::move(continue_0))
+, _semicolon_(std::move(_semicolon__1)) {
+}
+#endif
+
+// Rule 146
+Ansi_C::Jump_Statement_n::Jump_Statement_n(const util::syntax_ptr<class break_n>& break_0, const util::syntax_ptr<class _semicolon__n>& _semicolon__1)
+: m_Rule(146)
+, break_2(break_0)
+, _semicolon_(_semicolon__1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Jump_Statement_n::Jump_Statement_n(util::syntax_ptr<class break_n>&& break_0, util::syntax_ptr<class _semicolon__n>&& _semicolon__1)
+: m_Rule(146)
+, break_2(std::move(break_0))
+, _semicolon_(std::move(_semicolon__1)) {
+}
+#endif
+
+// Rule 147
+Ansi_C::Jump_Statement_n::Jump_Statement_n(const util::syntax_ptr<class return_n>& return_0, const util::syntax_ptr<class _semicolon__n>& _semicolon__1)
+: m_Rule(147)
+, return_2(return_0)
+, _semicolon_(_semicolon__1) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Jump_Statement_n::Jump_Statement_n(util::syntax_ptr<class return_n>&& return_0, util::syntax_ptr<class _semicolon__n>&& _semicolon__1)
+: m_Rule(147)
+, return_2(std::move(return_0))
+, _semicolon_(std::move(_semicolon__1)) {
+}
+#endif
+
+// Rule 148
+Ansi_C::Jump_Statement_n::Jump_Statement_n(const util::syntax_ptr<class return_n>& return_0, const util::syntax_ptr<class Expression_n>& Expression_1, const util::syntax_ptr<class _semicolon__n>& _semicolon__2)
+: m_Rule(148)
+, return_2(return_0)
+, Expression(Expression_1)
+, _semicolon_(_semicolon__2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Jump_Statement_n::Jump_Statement_n(util::syntax_ptr<class return_n>&& return_0, util::syntax_ptr<class Expression_n>&& Expression_1, util::syntax_ptr<class _semicolon__n>&& _semicolon__2)
+: m_Rule(148)
+, return_2(std::move(return_0))
+, Expression(std::move(Expression_1))
+, _semicolon_(std::move(_semicolon__2)) {
+}
+#endif
+
+Ansi_C::Jump_Statement_n::~Jump_Statement_n() { }
+
+// Rule 135
+Ansi_C::Declaration_List_n::Declaration_List_n(const util::syntax_ptr<class list_of_unknown_item_Declaration_n>& list_of_unknown_item_Declaration_0)
+: m_Rule(135)
+, list_of_unknown_item_Declaration(list_of_unknown_item_Declaration_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Declaration_List_n::Declaration_List_n(util::syntax_ptr<class list_of_unknown_item_Declaration_n>&& list_of_unknown_item_Declaration_0)
+: m_Rule(135)
+, list_of_unknown_item_Declaration(std::move(list_of_unknown_item_Declaration_0)) {
+}
+#endif
+
+Ansi_C::Declaration_List_n::~Declaration_List_n() { }
+
+// Rule 172
+Ansi_C::optional_Declaration_List_n::optional_Declaration_List_n(const dfa::position& pos)
+: m_Rule(172)
+, m_Position(pos) {
+}
+
+// Rule 173
+Ansi_C::optional_Declaration_List_n::optional_Declaration_List_n(const util::syntax_ptr<class Declaration_List_n>& Declaration_List_0)
+: m_Rule(173)
+, Declaration_List(Declaration_List_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::optional_Declaration_List_n::optional_Declaration_List_n(util::syntax_ptr<class Declaration_List_n>&& Declaration_List_0)
+: m_Rule(173)
+, Declaration_List(std::move(Declaration_List_0)) {
+}
+#endif
+
+Ansi_C::optional_Declaration_List_n::~optional_Declaration_List_n() { }
+
+// Rule 136
+Ansi_C::Statement_List_n::Statement_List_n(const util::syntax_ptr<class list_of_Statement_n>& list_of_Statement_0)
+: m_Rule(136)
+, list_of_Statement(list_of_Statement_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Statement_List_n::Statement_List_n(util::syntax_ptr<class list_of_Statement_n>&& list_of_Statement_0)
+: m_Rule(136)
+, list_of_Statement(std::move(list_of_Statement_0)) {
+}
+#endif
+
+Ansi_C::Statement_List_n::~Statement_List_n() { }
+
+// Rule 237
+Ansi_C::optional_Statement_List_n::optional_Statement_List_n(const dfa::position& pos)
+: m_Rule(237)
+, m_Position(pos) {
+}
+
+// Rule 238
+Ansi_C::optional_Statement_List_n::optional_Statement_List_n(const util::syntax_ptr<class Statement_List_n>& Statement_List_0)
+: m_Rule(238)
+, Statement_List(Statement_List_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::optional_Statement_List_n::optional_Statement_List_n(util::syntax_ptr<class Statement_List_n>&& Statement_List_0)
+: m_Rule(238)
+, Statement_List(std::move(Statement_List_0)) {
+}
+#endif
+
+Ansi_C::optional_Statement_List_n::~optional_Statement_List_n() { }
+
+// Rule 174
+Ansi_C::list_of_unknown_item_Declaration_n_content::list_of_unknown_item_Declaration_n_content(const util::syntax_ptr<class Declaration_n>& Declaration_0)
+: m_Rule(174)
+, Declaration(Declaration_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::list_of_unknown_item_Declaration_n_content::list_of_unknown_item_Declaration_n_content(util::syntax_ptr<class Declaration_n>&& Declaration_0)
+: m_Rule(174)
+, Declaration(std::move(Declaration_0)) {
+}
+#endif
+
+Ansi_C::list_of_unknown_item_Declaration_n_content::~list_of_unknown_item_Declaration_n_content() { }
+
+// Rule 241
+Ansi_C::list_of_Statement_n_content::list_of_Statement_n_content(const util::syntax_ptr<class Statement_n>& Statement_0)
+: m_Rule(241)
+, Statement(Statement_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::list_of_Statement_n_content::list_of_Statement_n_content(util::syntax_ptr<class Statement_n>&& Statement_0)
+: m_Rule(241)
+, Statement(std::move(Statement_0)) {
+}
+#endif
+
+Ansi_C::list_of_Statement_n_content::~list_of_Statement_n_content() { }
+
+// Rule 239
+Ansi_C::optional_Expression_n::optional_Expression_n(const dfa::position& pos)
+: m_Rule(239)
+, m_Position(pos) {
+}
+
+// Rule 240
+Ansi_C::optional_Expression_n::optional_Expression_n(const util::syntax_ptr<class Expression_n>& Expression_0)
+: m_Rule(240)
+, Expression(Expression_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::optional_Expression_n::optional_Expression_n(util::syntax_ptr<class Expression_n>&& Expression_0)
+: m_Rule(240)
+, Expression(std::move(Expression_0)) {
+}
+#endif
+
+Ansi_C::optional_Expression_n::~optional_Expression_n() { }
+
+// Rule 149
+Ansi_C::Translation_Unit_n::Translation_Unit_n(const util::syntax_ptr<class list_of_External_Declaration_n>& list_of_External_Declaration_0)
+: m_Rule(149)
+, list_of_External_Declaration(list_of_External_Declaration_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Translation_Unit_n::Translation_Unit_n(util::syntax_ptr<class list_of_External_Declaration_n>&& list_of_External_Declaration_0)
+: m_Rule(149)
+, list_of_External_Declaration(std::move(list_of_External_Declaration_0)) {
+}
+#endif
+
+Ansi_C::Translation_Unit_n::~Translation_Unit_n() { }
+
+// Rule 150
+Ansi_C::External_Declaration_n::External_Declaration_n(const util::syntax_ptr<class Function_Definition_n>& Function_Definition_0)
+: m_Rule(150)
+, Function_Definition(Function_Definition_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::External_Declaration_n::External_Declaration_n(util::syntax_ptr<class Function_Definition_n>&& Function_Definition_0)
+: m_Rule(150)
+, Function_Definition(std::move(Function_Definition_0)) {
+}
+#endif
+
+// Rule 151
+Ansi_C::External_Declaration_n::External_Declaration_n(const util::syntax_ptr<class Declaration_n>& Declaration_0)
+: m_Rule(151)
+, Declaration(Declaration_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::External_Declaration_n::External_Declaration_n(util::syntax_ptr<class Declaration_n>&& Declaration_0)
+: m_Rule(151)
+, Declaration(std::move(Declaration_0)) {
+}
+#endif
+
+Ansi_C::External_Declaration_n::~External_Declaration_n() { }
+
+// Rule 162
+Ansi_C::list_of_External_Declaration_n_content::list_of_External_Declaration_n_content(const util::syntax_ptr<class External_Declaration_n>& External_Declaration_0)
+: m_Rule(162)
+, External_Declaration(External_Declaration_0) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::list_of_External_Declaration_n_content::list_of_External_Declaration_n_content(util::syntax_ptr<class External_Declaration_n>&& External_Declaration_0)
+: m_Rule(162)
+, External_Declaration(std::move(External_Declaration_0)) {
+}
+#endif
+
+Ansi_C::list_of_External_Declaration_n_content::~list_of_External_Declaration_n_content() { }
+
+// Rule 152
+Ansi_C::Function_Definition_n::Function_Definition_n(const util::syntax_ptr<class Declaration_Specifiers_n>& Declaration_Specifiers_0, const util::syntax_ptr<class Declarator_n>& Declarator_1, const util::syntax_ptr<class optional_Declaration_List_n>& optional_Declaration_List_2, const util::syntax_ptr<class Compound_Statement_n>& Compound_Statement_3)
+: m_Rule(152)
+, Declaration_Specifiers(Declaration_Specifiers_0)
+, Declarator(Declarator_1)
+, optional_Declaration_List(optional_Declaration_List_2)
+, Compound_Statement(Compound_Statement_3) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Function_Definition_n::Function_Definition_n(util::syntax_ptr<class Declaration_Specifiers_n>&& Declaration_Specifiers_0, util::syntax_ptr<class Declarator_n>&& Declarator_1, util::syntax_ptr<class optional_Declaration_List_n>&& optional_Declaration_List_2, util::syntax_ptr<class Compound_Statement_n>&& Compound_Statement_3)
+: m_Rule(152)
+, Declaration_Specifiers(std::move(Declaration_Specifiers_0))
+, Declarator(std::move(Declarator_1))
+, optional_Declaration_List(std::move(optional_Declaration_List_2))
+, Compound_Statement(std::move(Compound_Statement_3)) {
+}
+#endif
+
+// Rule 153
+Ansi_C::Function_Definition_n::Function_Definition_n(const util::syntax_ptr<class Declarator_n>& Declarator_0, const util::syntax_ptr<class optional_Declaration_List_n>& optional_Declaration_List_1, const util::syntax_ptr<class Compound_Statement_n>& Compound_Statement_2)
+: m_Rule(153)
+, Declarator(Declarator_0)
+, optional_Declaration_List(optional_Declaration_List_1)
+, Compound_Statement(Compound_Statement_2) {
+}
+
+#if __cplusplus >= 201103L
+Ansi_C::Function_Definition_n::Function_Definition_n(util::syntax_ptr<class Declarator_n>&& Declarator_0, util::syntax_ptr<class optional_Declaration_List_n>&& optional_Declaration_List_1, util::syntax_ptr<class Compound_Statement_n>&& Compound_Statement_2)
+: m_Rule(153)
+, Declarator(std::move(Declarator_0))
+, optional_Declaration_List(std::move(optional_Declaration_List_1))
+, Compound_Statement(std::move(Compound_Statement_2)) {
+}
+#endif
+
+Ansi_C::Function_Definition_n::~Function_Definition_n() { }
+
+Ansi_C::end_of_input_n::~end_of_input_n() { }
+
+Ansi_C::end_of_guard_n::~end_of_guard_n() { }
+
+dfa::position Ansi_C::epsilon_n::pos() const {
+    switch (m_Rule) {
+    case 154:
+        return Translation_Unit->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::epsilon_n::final_pos() const {
+    switch (m_Rule) {
+    case 154:
+        return Translation_Unit->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Constant_n::pos() const {
+    switch (m_Rule) {
+    case 0:
+        return constant_hex->pos();
+
+    case 1:
+        return constant_octal->pos();
+
+    case 2:
+        return constant_decimal->pos();
+
+    case 3:
+        return constant_float->pos();
+
+    case 4:
+        return constant_character->pos();
+
+    case 5:
+        return string_literal->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Constant_n::final_pos() const {
+    switch (m_Rule) {
+    case 0:
+        return constant_hex->final_pos();
+
+    case 1:
+        return constant_octal->final_pos();
+
+    case 2:
+        return constant_decimal->final_pos();
+
+    case 3:
+        return constant_float->final_pos();
+
+    case 4:
+        return constant_character->final_pos();
+
+    case 5:
+        return string_literal->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Primary_Expression_n::pos() const {
+    switch (m_Rule) {
+    case 6:
+        return identifier->pos();
+
+    case 7:
+        return Constant->pos();
+
+    case 8:
+        return _openparen_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Primary_Expression_n::final_pos() const {
+    switch (m_Rule) {
+    case 6:
+        return identifier->final_pos();
+
+    case 7:
+        return Constant->final_pos();
+
+    case 8:
+        return _closeparen_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Expression_n::pos() const {
+    switch (m_Rule) {
+    case 57:
+        return Assignment_Expression->pos();
+
+    case 58:
+        return Expression->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Expression_n::final_pos() const {
+    switch (m_Rule) {
+    case 57:
+        return Assignment_Expression->final_pos();
+
+    case 58:
+        return Assignment_Expression->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Postfix_Expression_n::pos() const {
+    switch (m_Rule) {
+    case 9:
+        return Primary_Expression->pos();
+
+    case 10:
+        return Postfix_Expression->pos();
+
+    case 11:
+        return Postfix_Expression->pos();
+
+    case 12:
+        return Postfix_Expression->pos();
+
+    case 13:
+        return Postfix_Expression->pos();
+
+    case 14:
+        return Postfix_Expression->pos();
+
+    case 15:
+        return Postfix_Expression->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Postfix_Expression_n::final_pos() const {
+    switch (m_Rule) {
+    case 9:
+        return Primary_Expression->final_pos();
+
+    case 10:
+        return _closesquare_->final_pos();
+
+    case 11:
+        return _closeparen_->final_pos();
+
+    case 12:
+        return identifier->final_pos();
+
+    case 13:
+        return identifier->final_pos();
+
+    case 14:
+        return _plus__plus_->final_pos();
+
+    case 15:
+        return __->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Argument_Expression_List_n::pos() const {
+    switch (m_Rule) {
+    case 16:
+        return Assignment_Expression->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Argument_Expression_List_n::final_pos() const {
+    switch (m_Rule) {
+    case 16:
+        return list_of__comma__Assignment_Expression->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_Argument_Expression_List_n::pos() const {
+    switch (m_Rule) {
+    case 252:
+        return m_Position;
+
+    case 253:
+        return Argument_Expression_List->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_Argument_Expression_List_n::final_pos() const {
+    switch (m_Rule) {
+    case 252:
+        return m_Position;
+
+    case 253:
+        return Argument_Expression_List->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Assignment_Expression_n::pos() const {
+    switch (m_Rule) {
+    case 55:
+        return Conditional_Expression->pos();
+
+    case 56:
+        return Unary_Expression->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Assignment_Expression_n::final_pos() const {
+    switch (m_Rule) {
+    case 55:
+        return Conditional_Expression->final_pos();
+
+    case 56:
+        return Assignment_Expression->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of__comma__Assignment_Expression_n_content::pos() const {
+    switch (m_Rule) {
+    case 273:
+        return m_Position;
+
+    case 274:
+        return _comma_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of__comma__Assignment_Expression_n_content::final_pos() const {
+    switch (m_Rule) {
+    case 273:
+        return m_Position;
+
+    case 274:
+        return Assignment_Expression->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of__comma__Assignment_Expression_n::pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.front()->pos();
+}
+
+dfa::position Ansi_C::list_of__comma__Assignment_Expression_n::final_pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.back()->final_pos();
+}
+
+dfa::position Ansi_C::Unary_Expression_n::pos() const {
+    switch (m_Rule) {
+    case 17:
+        return Postfix_Expression->pos();
+
+    case 18:
+        return _plus__plus_->pos();
+
+    case 19:
+        return __->pos();
+
+    case 20:
+        return one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation_->pos();
+
+    case 21:
+        return sizeof_2->pos();
+
+    case 22:
+        return sizeof_2->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Unary_Expression_n::final_pos() const {
+    switch (m_Rule) {
+    case 17:
+        return Postfix_Expression->final_pos();
+
+    case 18:
+        return Unary_Expression->final_pos();
+
+    case 19:
+        return Unary_Expression->final_pos();
+
+    case 20:
+        return Cast_Expression->final_pos();
+
+    case 21:
+        return Unary_Expression->final_pos();
+
+    case 22:
+        return _closeparen_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__tilde__or__exclamation__n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__tilde__or__exclamation__n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of___or_one_of__tilde__or__exclamation__n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of___or_one_of__tilde__or__exclamation__n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n::pos() const {
+    switch (m_Rule) {
+    case 199:
+        return _ampersand_->pos();
+
+    case 200:
+        return _star_->pos();
+
+    case 201:
+        return _plus_->pos();
+
+    case 202:
+        return _minus_->pos();
+
+    case 203:
+        return _tilde_->pos();
+
+    case 204:
+        return _exclamation_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n::final_pos() const {
+    switch (m_Rule) {
+    case 199:
+        return _ampersand_->final_pos();
+
+    case 200:
+        return _star_->final_pos();
+
+    case 201:
+        return _plus_->final_pos();
+
+    case 202:
+        return _minus_->final_pos();
+
+    case 203:
+        return _tilde_->final_pos();
+
+    case 204:
+        return _exclamation_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Cast_Expression_n::pos() const {
+    switch (m_Rule) {
+    case 23:
+        return Unary_Expression->pos();
+
+    case 24:
+        return Unambiguous_Cast->pos();
+
+    case 25:
+        return Ambiguous_Cast->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Cast_Expression_n::final_pos() const {
+    switch (m_Rule) {
+    case 23:
+        return Unary_Expression->final_pos();
+
+    case 24:
+        return Cast_Expression->final_pos();
+
+    case 25:
+        return Cast_Expression->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Type_Name_n::pos() const {
+    switch (m_Rule) {
+    case 116:
+        return Specifier_Qualifier_List->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Type_Name_n::final_pos() const {
+    switch (m_Rule) {
+    case 116:
+        return optional_Abstract_Declarator->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Unambiguous_Cast_n::pos() const {
+    switch (m_Rule) {
+    case 26:
+        return _openparen_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Unambiguous_Cast_n::final_pos() const {
+    switch (m_Rule) {
+    case 26:
+        return _closeparen_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Ambiguous_Cast_n::pos() const {
+    switch (m_Rule) {
+    case 31:
+        return _openparen_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Ambiguous_Cast_n::final_pos() const {
+    switch (m_Rule) {
+    case 31:
+        return _closeparen_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Unambiguous_Cast_Follow_n::pos() const {
+    switch (m_Rule) {
+    case 27:
+        return Simple_Type_Specifier->pos();
+
+    case 28:
+        return Type_Qualifier->pos();
+
+    case 29:
+        return identifier->pos();
+
+    case 30:
+        return identifier->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Unambiguous_Cast_Follow_n::final_pos() const {
+    switch (m_Rule) {
+    case 27:
+        return Simple_Type_Specifier->final_pos();
+
+    case 28:
+        return Type_Qualifier->final_pos();
+
+    case 29:
+        return one_of_Simple_Type_Specifier_or_Type_Qualifier->final_pos();
+
+    case 30:
+        return one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Simple_Type_Specifier_n::pos() const {
+    switch (m_Rule) {
+    case 81:
+        return void_2->pos();
+
+    case 82:
+        return char_2->pos();
+
+    case 83:
+        return short_2->pos();
+
+    case 84:
+        return int_2->pos();
+
+    case 85:
+        return long_2->pos();
+
+    case 86:
+        return float_2->pos();
+
+    case 87:
+        return double_2->pos();
+
+    case 88:
+        return signed_2->pos();
+
+    case 89:
+        return unsigned_2->pos();
+
+    case 90:
+        return Struct_Or_Union_Specifier->pos();
+
+    case 91:
+        return Enum_Specifier->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Simple_Type_Specifier_n::final_pos() const {
+    switch (m_Rule) {
+    case 81:
+        return void_2->final_pos();
+
+    case 82:
+        return char_2->final_pos();
+
+    case 83:
+        return short_2->final_pos();
+
+    case 84:
+        return int_2->final_pos();
+
+    case 85:
+        return long_2->final_pos();
+
+    case 86:
+        return float_2->final_pos();
+
+    case 87:
+        return double_2->final_pos();
+
+    case 88:
+        return signed_2->final_pos();
+
+    case 89:
+        return unsigned_2->final_pos();
+
+    case 90:
+        return Struct_Or_Union_Specifier->final_pos();
+
+    case 91:
+        return Enum_Specifier->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Type_Qualifier_n::pos() const {
+    switch (m_Rule) {
+    case 103:
+        return const_2->pos();
+
+    case 104:
+        return volatile_2->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Type_Qualifier_n::final_pos() const {
+    switch (m_Rule) {
+    case 103:
+        return const_2->final_pos();
+
+    case 104:
+        return volatile_2->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of_Simple_Type_Specifier_or_Type_Qualifier_n::pos() const {
+    switch (m_Rule) {
+    case 269:
+        return Simple_Type_Specifier->pos();
+
+    case 270:
+        return Type_Qualifier->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of_Simple_Type_Specifier_or_Type_Qualifier_n::final_pos() const {
+    switch (m_Rule) {
+    case 269:
+        return Simple_Type_Specifier->final_pos();
+
+    case 270:
+        return Type_Qualifier->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Abstract_Declarator_n::pos() const {
+    switch (m_Rule) {
+    case 117:
+        return Pointer->pos();
+
+    case 118:
+        return Direct_Abstract_Declarator->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Abstract_Declarator_n::final_pos() const {
+    switch (m_Rule) {
+    case 117:
+        return optional_Direct_Abstract_Declarator->final_pos();
+
+    case 118:
+        return Direct_Abstract_Declarator->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_Abstract_Declarator_n::pos() const {
+    switch (m_Rule) {
+    case 271:
+        return m_Position;
+
+    case 272:
+        return Abstract_Declarator->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_Abstract_Declarator_n::final_pos() const {
+    switch (m_Rule) {
+    case 271:
+        return m_Position;
+
+    case 272:
+        return Abstract_Declarator->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of_identifier_or_Constant_n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of_identifier_or_Constant_n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of_sizeof_or_one_of_identifier_or_Constant_n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of_sizeof_or_one_of_identifier_or_Constant_n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::pos() const {
+    switch (m_Rule) {
+    case 281:
+        return _plus__plus_->pos();
+
+    case 282:
+        return __->pos();
+
+    case 283:
+        return _ampersand_->pos();
+
+    case 284:
+        return _tilde_->pos();
+
+    case 285:
+        return _exclamation_->pos();
+
+    case 286:
+        return sizeof_2->pos();
+
+    case 287:
+        return identifier->pos();
+
+    case 288:
+        return Constant->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n::final_pos() const {
+    switch (m_Rule) {
+    case 281:
+        return Unary_Expression->final_pos();
+
+    case 282:
+        return Unary_Expression->final_pos();
+
+    case 283:
+        return _ampersand_->final_pos();
+
+    case 284:
+        return _tilde_->final_pos();
+
+    case 285:
+        return _exclamation_->final_pos();
+
+    case 286:
+        return sizeof_2->final_pos();
+
+    case 287:
+        return identifier->final_pos();
+
+    case 288:
+        return Constant->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Ambiguous_Cast_Follow_n::pos() const {
+    switch (m_Rule) {
+    case 32:
+        return identifier->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Ambiguous_Cast_Follow_n::final_pos() const {
+    switch (m_Rule) {
+    case 32:
+        return one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of___or__openparen__Expression__closeparen__n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of___or__openparen__Expression__closeparen__n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__star__or_one_of___or__openparen__Expression__closeparen__n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__star__or_one_of___or__openparen__Expression__closeparen__n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n::pos() const {
+    switch (m_Rule) {
+    case 289:
+        return _plus_->pos();
+
+    case 290:
+        return _star_->pos();
+
+    case 291:
+        return _minus_->pos();
+
+    case 292:
+        return _openparen_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n::final_pos() const {
+    switch (m_Rule) {
+    case 289:
+        return _plus_->final_pos();
+
+    case 290:
+        return _star_->final_pos();
+
+    case 291:
+        return _minus_->final_pos();
+
+    case 292:
+        return _closeparen_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Multiplicative_Expression_n::pos() const {
+    switch (m_Rule) {
+    case 33:
+        return Cast_Expression->pos();
+
+    case 34:
+        return Multiplicative_Expression->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Multiplicative_Expression_n::final_pos() const {
+    switch (m_Rule) {
+    case 33:
+        return Cast_Expression->final_pos();
+
+    case 34:
+        return Cast_Expression->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__slash__or__percent__n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__slash__or__percent__n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__star__or_one_of__slash__or__percent__n::pos() const {
+    switch (m_Rule) {
+    case 213:
+        return _star_->pos();
+
+    case 214:
+        return _slash_->pos();
+
+    case 215:
+        return _percent_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__star__or_one_of__slash__or__percent__n::final_pos() const {
+    switch (m_Rule) {
+    case 213:
+        return _star_->final_pos();
+
+    case 214:
+        return _slash_->final_pos();
+
+    case 215:
+        return _percent_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Additive_Expression_n::pos() const {
+    switch (m_Rule) {
+    case 35:
+        return Multiplicative_Expression->pos();
+
+    case 36:
+        return Additive_Expression->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Additive_Expression_n::final_pos() const {
+    switch (m_Rule) {
+    case 35:
+        return Multiplicative_Expression->final_pos();
+
+    case 36:
+        return Multiplicative_Expression->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__plus__or___n::pos() const {
+    switch (m_Rule) {
+    case 216:
+        return _plus_->pos();
+
+    case 217:
+        return _minus_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__plus__or___n::final_pos() const {
+    switch (m_Rule) {
+    case 216:
+        return _plus_->final_pos();
+
+    case 217:
+        return _minus_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Shift_Expression_n::pos() const {
+    switch (m_Rule) {
+    case 37:
+        return Additive_Expression->pos();
+
+    case 38:
+        return Shift_Expression->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Shift_Expression_n::final_pos() const {
+    switch (m_Rule) {
+    case 37:
+        return Additive_Expression->final_pos();
+
+    case 38:
+        return Additive_Expression->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__lessthan__lessthan__or__greaterthan__greaterthan__n::pos() const {
+    switch (m_Rule) {
+    case 218:
+        return _lessthan__lessthan_->pos();
+
+    case 219:
+        return _greaterthan__greaterthan_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__lessthan__lessthan__or__greaterthan__greaterthan__n::final_pos() const {
+    switch (m_Rule) {
+    case 218:
+        return _lessthan__lessthan_->final_pos();
+
+    case 219:
+        return _greaterthan__greaterthan_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Relational_Expression_n::pos() const {
+    switch (m_Rule) {
+    case 39:
+        return Shift_Expression->pos();
+
+    case 40:
+        return Relational_Expression->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Relational_Expression_n::final_pos() const {
+    switch (m_Rule) {
+    case 39:
+        return Shift_Expression->final_pos();
+
+    case 40:
+        return Shift_Expression->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__lessthan__equals__or__greaterthan__equals__n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__lessthan__equals__or__greaterthan__equals__n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n::pos() const {
+    switch (m_Rule) {
+    case 220:
+        return _lessthan_->pos();
+
+    case 221:
+        return _greaterthan_->pos();
+
+    case 222:
+        return _lessthan__equals_->pos();
+
+    case 223:
+        return _greaterthan__equals_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n::final_pos() const {
+    switch (m_Rule) {
+    case 220:
+        return _lessthan_->final_pos();
+
+    case 221:
+        return _greaterthan_->final_pos();
+
+    case 222:
+        return _lessthan__equals_->final_pos();
+
+    case 223:
+        return _greaterthan__equals_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Equality_Expression_n::pos() const {
+    switch (m_Rule) {
+    case 41:
+        return Relational_Expression->pos();
+
+    case 42:
+        return Equality_Expression->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Equality_Expression_n::final_pos() const {
+    switch (m_Rule) {
+    case 41:
+        return Relational_Expression->final_pos();
+
+    case 42:
+        return Relational_Expression->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__equals__equals__or__exclamation__equals__n::pos() const {
+    switch (m_Rule) {
+    case 224:
+        return _equals__equals_->pos();
+
+    case 225:
+        return _exclamation__equals_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__equals__equals__or__exclamation__equals__n::final_pos() const {
+    switch (m_Rule) {
+    case 224:
+        return _equals__equals_->final_pos();
+
+    case 225:
+        return _exclamation__equals_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::And_Expression_n::pos() const {
+    switch (m_Rule) {
+    case 43:
+        return Equality_Expression->pos();
+
+    case 44:
+        return And_Expression->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::And_Expression_n::final_pos() const {
+    switch (m_Rule) {
+    case 43:
+        return Equality_Expression->final_pos();
+
+    case 44:
+        return Equality_Expression->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Exclusive_Or_Expression_n::pos() const {
+    switch (m_Rule) {
+    case 45:
+        return And_Expression->pos();
+
+    case 46:
+        return Exclusive_Or_Expression->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Exclusive_Or_Expression_n::final_pos() const {
+    switch (m_Rule) {
+    case 45:
+        return And_Expression->final_pos();
+
+    case 46:
+        return And_Expression->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Inclusive_Or_Expression_n::pos() const {
+    switch (m_Rule) {
+    case 47:
+        return Exclusive_Or_Expression->pos();
+
+    case 48:
+        return Inclusive_Or_Expression->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Inclusive_Or_Expression_n::final_pos() const {
+    switch (m_Rule) {
+    case 47:
+        return Exclusive_Or_Expression->final_pos();
+
+    case 48:
+        return Exclusive_Or_Expression->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Logical_And_Expression_n::pos() const {
+    switch (m_Rule) {
+    case 49:
+        return Inclusive_Or_Expression->pos();
+
+    case 50:
+        return Logical_And_Expression->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Logical_And_Expression_n::final_pos() const {
+    switch (m_Rule) {
+    case 49:
+        return Inclusive_Or_Expression->final_pos();
+
+    case 50:
+        return Inclusive_Or_Expression->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Logical_Or_Expression_n::pos() const {
+    switch (m_Rule) {
+    case 51:
+        return Logical_And_Expression->pos();
+
+    case 52:
+        return Logical_Or_Expression->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Logical_Or_Expression_n::final_pos() const {
+    switch (m_Rule) {
+    case 51:
+        return Logical_And_Expression->final_pos();
+
+    case 52:
+        return Logical_And_Expression->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Conditional_Expression_n::pos() const {
+    switch (m_Rule) {
+    case 53:
+        return Logical_Or_Expression->pos();
+
+    case 54:
+        return Logical_Or_Expression->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Conditional_Expression_n::final_pos() const {
+    switch (m_Rule) {
+    case 53:
+        return Logical_Or_Expression->final_pos();
+
+    case 54:
+        return Conditional_Expression->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__cicumflex__equals__or__pipe__equals__n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__cicumflex__equals__or__pipe__equals__n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::pos() const {
+    switch (m_Rule) {
+    case 226:
+        return _equals_->pos();
+
+    case 227:
+        return _star__equals_->pos();
+
+    case 228:
+        return _slash__equals_->pos();
+
+    case 229:
+        return _percent__equals_->pos();
+
+    case 230:
+        return _plus__equals_->pos();
+
+    case 231:
+        return __equals_->pos();
+
+    case 232:
+        return _lessthan__lessthan__equals_->pos();
+
+    case 233:
+        return _greaterthan__greaterthan__equals_->pos();
+
+    case 234:
+        return _ampersand__equals_->pos();
+
+    case 235:
+        return _cicumflex__equals_->pos();
+
+    case 236:
+        return _pipe__equals_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n::final_pos() const {
+    switch (m_Rule) {
+    case 226:
+        return _equals_->final_pos();
+
+    case 227:
+        return _star__equals_->final_pos();
+
+    case 228:
+        return _slash__equals_->final_pos();
+
+    case 229:
+        return _percent__equals_->final_pos();
+
+    case 230:
+        return _plus__equals_->final_pos();
+
+    case 231:
+        return __equals_->final_pos();
+
+    case 232:
+        return _lessthan__lessthan__equals_->final_pos();
+
+    case 233:
+        return _greaterthan__greaterthan__equals_->final_pos();
+
+    case 234:
+        return _ampersand__equals_->final_pos();
+
+    case 235:
+        return _cicumflex__equals_->final_pos();
+
+    case 236:
+        return _pipe__equals_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Constant_Expression_n::pos() const {
+    switch (m_Rule) {
+    case 59:
+        return Conditional_Expression->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Constant_Expression_n::final_pos() const {
+    switch (m_Rule) {
+    case 59:
+        return Conditional_Expression->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Declaration_n::pos() const {
+    switch (m_Rule) {
+    case 60:
+        return Declaration_Specifiers->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Declaration_n::final_pos() const {
+    switch (m_Rule) {
+    case 60:
+        return _semicolon_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Declaration_Specifiers_n::pos() const {
+    switch (m_Rule) {
+    case 61:
+        return list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Declaration_Specifiers_n::final_pos() const {
+    switch (m_Rule) {
+    case 61:
+        return list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Init_Declarator_n::pos() const {
+    switch (m_Rule) {
+    case 63:
+        return Declarator->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Init_Declarator_n::final_pos() const {
+    switch (m_Rule) {
+    case 63:
+        return optional__equals__Initializer->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__semicolon__or__comma__n::pos() const {
+    switch (m_Rule) {
+    case 185:
+        return _semicolon_->pos();
+
+    case 186:
+        return _comma_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__semicolon__or__comma__n::final_pos() const {
+    switch (m_Rule) {
+    case 185:
+        return _semicolon_->final_pos();
+
+    case 186:
+        return _comma_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__semicolon__or_Init_Declarator_one_of__semicolon__or__comma__n::pos() const {
+    switch (m_Rule) {
+    case 176:
+        return _semicolon_->pos();
+
+    case 177:
+        return Init_Declarator->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__semicolon__or_Init_Declarator_one_of__semicolon__or__comma__n::final_pos() const {
+    switch (m_Rule) {
+    case 176:
+        return _semicolon_->final_pos();
+
+    case 177:
+        return one_of__semicolon__or__comma_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Init_Declarator_List_n::pos() const {
+    switch (m_Rule) {
+    case 62:
+        return Init_Declarator->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Init_Declarator_List_n::final_pos() const {
+    switch (m_Rule) {
+    case 62:
+        return list_of__comma__Init_Declarator->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_Init_Declarator_List_n::pos() const {
+    switch (m_Rule) {
+    case 178:
+        return m_Position;
+
+    case 179:
+        return Init_Declarator_List->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_Init_Declarator_List_n::final_pos() const {
+    switch (m_Rule) {
+    case 178:
+        return m_Position;
+
+    case 179:
+        return Init_Declarator_List->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Storage_Class_Specifier_n::pos() const {
+    switch (m_Rule) {
+    case 64:
+        return typedef_2->pos();
+
+    case 65:
+        return extern_2->pos();
+
+    case 66:
+        return static_2->pos();
+
+    case 67:
+        return auto_2->pos();
+
+    case 68:
+        return register_2->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Storage_Class_Specifier_n::final_pos() const {
+    switch (m_Rule) {
+    case 64:
+        return typedef_2->final_pos();
+
+    case 65:
+        return extern_2->final_pos();
+
+    case 66:
+        return static_2->final_pos();
+
+    case 67:
+        return auto_2->final_pos();
+
+    case 68:
+        return register_2->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Type_Specifier_n::pos() const {
+    switch (m_Rule) {
+    case 69:
+        return void_2->pos();
+
+    case 70:
+        return char_2->pos();
+
+    case 71:
+        return short_2->pos();
+
+    case 72:
+        return int_2->pos();
+
+    case 73:
+        return long_2->pos();
+
+    case 74:
+        return float_2->pos();
+
+    case 75:
+        return double_2->pos();
+
+    case 76:
+        return signed_2->pos();
+
+    case 77:
+        return unsigned_2->pos();
+
+    case 78:
+        return Struct_Or_Union_Specifier->pos();
+
+    case 79:
+        return Enum_Specifier->pos();
+
+    case 80:
+        return identifier->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Type_Specifier_n::final_pos() const {
+    switch (m_Rule) {
+    case 69:
+        return void_2->final_pos();
+
+    case 70:
+        return char_2->final_pos();
+
+    case 71:
+        return short_2->final_pos();
+
+    case 72:
+        return int_2->final_pos();
+
+    case 73:
+        return long_2->final_pos();
+
+    case 74:
+        return float_2->final_pos();
+
+    case 75:
+        return double_2->final_pos();
+
+    case 76:
+        return signed_2->final_pos();
+
+    case 77:
+        return unsigned_2->final_pos();
+
+    case 78:
+        return Struct_Or_Union_Specifier->final_pos();
+
+    case 79:
+        return Enum_Specifier->final_pos();
+
+    case 80:
+        return identifier->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of_Type_Specifier_or_Type_Qualifier_n::pos() const {
+    switch (m_Rule) {
+    case 191:
+        return Type_Specifier->pos();
+
+    case 192:
+        return Type_Qualifier->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of_Type_Specifier_or_Type_Qualifier_n::final_pos() const {
+    switch (m_Rule) {
+    case 191:
+        return Type_Specifier->final_pos();
+
+    case 192:
+        return Type_Qualifier->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n::pos() const {
+    switch (m_Rule) {
+    case 155:
+        return Storage_Class_Specifier->pos();
+
+    case 156:
+        return Type_Specifier->pos();
+
+    case 159:
+        return Type_Qualifier->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n::final_pos() const {
+    switch (m_Rule) {
+    case 155:
+        return Storage_Class_Specifier->final_pos();
+
+    case 156:
+        return Type_Specifier->final_pos();
+
+    case 159:
+        return Type_Qualifier->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n_content::pos() const {
+    switch (m_Rule) {
+    case 160:
+        return one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier->pos();
+
+    case 161:
+        return one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n_content::final_pos() const {
+    switch (m_Rule) {
+    case 160:
+        return one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier->final_pos();
+
+    case 161:
+        return one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n::pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.front()->pos();
+}
+
+dfa::position Ansi_C::list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n::final_pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.back()->final_pos();
+}
+
+dfa::position Ansi_C::list_of__comma__Init_Declarator_n_content::pos() const {
+    switch (m_Rule) {
+    case 189:
+        return m_Position;
+
+    case 190:
+        return _comma_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of__comma__Init_Declarator_n_content::final_pos() const {
+    switch (m_Rule) {
+    case 189:
+        return m_Position;
+
+    case 190:
+        return Init_Declarator->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of__comma__Init_Declarator_n::pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.front()->pos();
+}
+
+dfa::position Ansi_C::list_of__comma__Init_Declarator_n::final_pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.back()->final_pos();
+}
+
+dfa::position Ansi_C::Declarator_n::pos() const {
+    switch (m_Rule) {
+    case 105:
+        return optional_Pointer->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Declarator_n::final_pos() const {
+    switch (m_Rule) {
+    case 105:
+        return Direct_Declarator->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Initializer_n::pos() const {
+    switch (m_Rule) {
+    case 123:
+        return Assignment_Expression->pos();
+
+    case 124:
+        return _opencurly_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Initializer_n::final_pos() const {
+    switch (m_Rule) {
+    case 123:
+        return Assignment_Expression->final_pos();
+
+    case 124:
+        return _closecurly_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional__equals__Initializer_n::pos() const {
+    switch (m_Rule) {
+    case 187:
+        return m_Position;
+
+    case 188:
+        return _equals_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional__equals__Initializer_n::final_pos() const {
+    switch (m_Rule) {
+    case 187:
+        return m_Position;
+
+    case 188:
+        return Initializer->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Struct_Or_Union_Specifier_n::pos() const {
+    switch (m_Rule) {
+    case 92:
+        return one_of_struct_or_union->pos();
+
+    case 93:
+        return one_of_struct_or_union->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Struct_Or_Union_Specifier_n::final_pos() const {
+    switch (m_Rule) {
+    case 92:
+        return optional__opencurly__list_of_Struct_Declaration__closecurly_->final_pos();
+
+    case 93:
+        return _closecurly_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Enum_Specifier_n::pos() const {
+    switch (m_Rule) {
+    case 99:
+        return enum_2->pos();
+
+    case 100:
+        return enum_2->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Enum_Specifier_n::final_pos() const {
+    switch (m_Rule) {
+    case 99:
+        return _closecurly_->final_pos();
+
+    case 100:
+        return identifier->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of_struct_or_union_n::pos() const {
+    switch (m_Rule) {
+    case 157:
+        return struct_2->pos();
+
+    case 158:
+        return union_2->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of_struct_or_union_n::final_pos() const {
+    switch (m_Rule) {
+    case 157:
+        return struct_2->final_pos();
+
+    case 158:
+        return union_2->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Struct_Declaration_n::pos() const {
+    switch (m_Rule) {
+    case 94:
+        return Specifier_Qualifier_List->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Struct_Declaration_n::final_pos() const {
+    switch (m_Rule) {
+    case 94:
+        return _semicolon_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of_Struct_Declaration_n_content::pos() const {
+    switch (m_Rule) {
+    case 182:
+        return m_Position;
+
+    case 183:
+        return Struct_Declaration->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of_Struct_Declaration_n_content::final_pos() const {
+    switch (m_Rule) {
+    case 182:
+        return m_Position;
+
+    case 183:
+        return Struct_Declaration->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of_Struct_Declaration_n::pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.front()->pos();
+}
+
+dfa::position Ansi_C::list_of_Struct_Declaration_n::final_pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.back()->final_pos();
+}
+
+dfa::position Ansi_C::optional__opencurly__list_of_Struct_Declaration__closecurly__n::pos() const {
+    switch (m_Rule) {
+    case 180:
+        return m_Position;
+
+    case 181:
+        return _opencurly_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional__opencurly__list_of_Struct_Declaration__closecurly__n::final_pos() const {
+    switch (m_Rule) {
+    case 180:
+        return m_Position;
+
+    case 181:
+        return _closecurly_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Specifier_Qualifier_List_n::pos() const {
+    switch (m_Rule) {
+    case 95:
+        return list_of_one_of_Type_Specifier_or_Type_Qualifier->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Specifier_Qualifier_List_n::final_pos() const {
+    switch (m_Rule) {
+    case 95:
+        return list_of_one_of_Type_Specifier_or_Type_Qualifier->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Struct_Declarator_List_n::pos() const {
+    switch (m_Rule) {
+    case 96:
+        return Struct_Declarator->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Struct_Declarator_List_n::final_pos() const {
+    switch (m_Rule) {
+    case 96:
+        return list_of__comma__Struct_Declarator->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of_one_of_Type_Specifier_or_Type_Qualifier_n_content::pos() const {
+    switch (m_Rule) {
+    case 193:
+        return one_of_Type_Specifier_or_Type_Qualifier->pos();
+
+    case 194:
+        return one_of_Type_Specifier_or_Type_Qualifier->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of_one_of_Type_Specifier_or_Type_Qualifier_n_content::final_pos() const {
+    switch (m_Rule) {
+    case 193:
+        return one_of_Type_Specifier_or_Type_Qualifier->final_pos();
+
+    case 194:
+        return one_of_Type_Specifier_or_Type_Qualifier->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of_one_of_Type_Specifier_or_Type_Qualifier_n::pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.front()->pos();
+}
+
+dfa::position Ansi_C::list_of_one_of_Type_Specifier_or_Type_Qualifier_n::final_pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.back()->final_pos();
+}
+
+dfa::position Ansi_C::Struct_Declarator_n::pos() const {
+    switch (m_Rule) {
+    case 97:
+        return Declarator->pos();
+
+    case 98:
+        return _colon_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Struct_Declarator_n::final_pos() const {
+    switch (m_Rule) {
+    case 97:
+        return optional__colon__Constant_Expression->final_pos();
+
+    case 98:
+        return Constant_Expression->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of__comma__Struct_Declarator_n_content::pos() const {
+    switch (m_Rule) {
+    case 258:
+        return m_Position;
+
+    case 259:
+        return _comma_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of__comma__Struct_Declarator_n_content::final_pos() const {
+    switch (m_Rule) {
+    case 258:
+        return m_Position;
+
+    case 259:
+        return Struct_Declarator->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of__comma__Struct_Declarator_n::pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.front()->pos();
+}
+
+dfa::position Ansi_C::list_of__comma__Struct_Declarator_n::final_pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.back()->final_pos();
+}
+
+dfa::position Ansi_C::optional__colon__Constant_Expression_n::pos() const {
+    switch (m_Rule) {
+    case 256:
+        return m_Position;
+
+    case 257:
+        return _colon_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional__colon__Constant_Expression_n::final_pos() const {
+    switch (m_Rule) {
+    case 256:
+        return m_Position;
+
+    case 257:
+        return Constant_Expression->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_identifier_n::pos() const {
+    switch (m_Rule) {
+    case 167:
+        return m_Position;
+
+    case 168:
+        return identifier->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_identifier_n::final_pos() const {
+    switch (m_Rule) {
+    case 167:
+        return m_Position;
+
+    case 168:
+        return identifier->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Enumerator_List_n::pos() const {
+    switch (m_Rule) {
+    case 101:
+        return Enumerator->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Enumerator_List_n::final_pos() const {
+    switch (m_Rule) {
+    case 101:
+        return list_of__comma__Enumerator->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Enumerator_n::pos() const {
+    switch (m_Rule) {
+    case 102:
+        return identifier->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Enumerator_n::final_pos() const {
+    switch (m_Rule) {
+    case 102:
+        return optional__equals__Constant_Expression->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of__comma__Enumerator_n_content::pos() const {
+    switch (m_Rule) {
+    case 207:
+        return m_Position;
+
+    case 208:
+        return _comma_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of__comma__Enumerator_n_content::final_pos() const {
+    switch (m_Rule) {
+    case 207:
+        return m_Position;
+
+    case 208:
+        return Enumerator->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of__comma__Enumerator_n::pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.front()->pos();
+}
+
+dfa::position Ansi_C::list_of__comma__Enumerator_n::final_pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.back()->final_pos();
+}
+
+dfa::position Ansi_C::optional__equals__Constant_Expression_n::pos() const {
+    switch (m_Rule) {
+    case 205:
+        return m_Position;
+
+    case 206:
+        return _equals_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional__equals__Constant_Expression_n::final_pos() const {
+    switch (m_Rule) {
+    case 205:
+        return m_Position;
+
+    case 206:
+        return Constant_Expression->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Pointer_n::pos() const {
+    switch (m_Rule) {
+    case 111:
+        return _star_->pos();
+
+    case 112:
+        return _star_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Pointer_n::final_pos() const {
+    switch (m_Rule) {
+    case 111:
+        return list_of_Type_Qualifier->final_pos();
+
+    case 112:
+        return Pointer->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_Pointer_n::pos() const {
+    switch (m_Rule) {
+    case 165:
+        return m_Position;
+
+    case 166:
+        return Pointer->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_Pointer_n::final_pos() const {
+    switch (m_Rule) {
+    case 165:
+        return m_Position;
+
+    case 166:
+        return Pointer->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Direct_Declarator_n::pos() const {
+    switch (m_Rule) {
+    case 106:
+        return identifier->pos();
+
+    case 107:
+        return _openparen_->pos();
+
+    case 108:
+        return Direct_Declarator->pos();
+
+    case 109:
+        return Direct_Declarator->pos();
+
+    case 110:
+        return Direct_Declarator->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Direct_Declarator_n::final_pos() const {
+    switch (m_Rule) {
+    case 106:
+        return identifier->final_pos();
+
+    case 107:
+        return _closeparen_->final_pos();
+
+    case 108:
+        return _closesquare_->final_pos();
+
+    case 109:
+        return _closeparen_->final_pos();
+
+    case 110:
+        return _closeparen_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_Constant_Expression_n::pos() const {
+    switch (m_Rule) {
+    case 197:
+        return m_Position;
+
+    case 198:
+        return Constant_Expression->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_Constant_Expression_n::final_pos() const {
+    switch (m_Rule) {
+    case 197:
+        return m_Position;
+
+    case 198:
+        return Constant_Expression->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Parameter_Type_List_n::pos() const {
+    switch (m_Rule) {
+    case 113:
+        return Parameter_Declarator->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Parameter_Type_List_n::final_pos() const {
+    switch (m_Rule) {
+    case 113:
+        return optional__comma___dot__dot__dot_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Identifier_List_n::pos() const {
+    switch (m_Rule) {
+    case 115:
+        return identifier->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Identifier_List_n::final_pos() const {
+    switch (m_Rule) {
+    case 115:
+        return list_of__comma__identifier->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n::pos() const {
+    switch (m_Rule) {
+    case 195:
+        return Parameter_Type_List->pos();
+
+    case 196:
+        return Identifier_List->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n::final_pos() const {
+    switch (m_Rule) {
+    case 195:
+        return Parameter_Type_List->final_pos();
+
+    case 196:
+        return Identifier_List->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of_Type_Qualifier_n_content::pos() const {
+    switch (m_Rule) {
+    case 170:
+        return m_Position;
+
+    case 171:
+        return Type_Qualifier->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of_Type_Qualifier_n_content::final_pos() const {
+    switch (m_Rule) {
+    case 170:
+        return m_Position;
+
+    case 171:
+        return Type_Qualifier->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of_Type_Qualifier_n::pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.front()->pos();
+}
+
+dfa::position Ansi_C::list_of_Type_Qualifier_n::final_pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.back()->final_pos();
+}
+
+dfa::position Ansi_C::Parameter_Declarator_n::pos() const {
+    switch (m_Rule) {
+    case 114:
+        return Declaration_Specifiers->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Parameter_Declarator_n::final_pos() const {
+    switch (m_Rule) {
+    case 114:
+        return optional_one_of_unknown_item_Declarator_or_Abstract_Declarator->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of__comma__Parameter_Declarator_n_content::pos() const {
+    switch (m_Rule) {
+    case 250:
+        return m_Position;
+
+    case 251:
+        return _comma_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of__comma__Parameter_Declarator_n_content::final_pos() const {
+    switch (m_Rule) {
+    case 250:
+        return m_Position;
+
+    case 251:
+        return Parameter_Declarator->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of__comma__Parameter_Declarator_n::pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.front()->pos();
+}
+
+dfa::position Ansi_C::list_of__comma__Parameter_Declarator_n::final_pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.back()->final_pos();
+}
+
+dfa::position Ansi_C::optional__comma___dot__dot__dot__n::pos() const {
+    switch (m_Rule) {
+    case 267:
+        return m_Position;
+
+    case 268:
+        return _comma_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional__comma___dot__dot__dot__n::final_pos() const {
+    switch (m_Rule) {
+    case 267:
+        return m_Position;
+
+    case 268:
+        return _dot__dot__dot_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__comma__or__closeparen__n::pos() const {
+    switch (m_Rule) {
+    case 277:
+        return _comma_->pos();
+
+    case 278:
+        return _closeparen_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of__comma__or__closeparen__n::final_pos() const {
+    switch (m_Rule) {
+    case 277:
+        return _comma_->final_pos();
+
+    case 278:
+        return _closeparen_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of_unknown_item_Declarator_or_Abstract_Declarator_n::pos() const {
+    switch (m_Rule) {
+    case 248:
+        return Declarator->pos();
+
+    case 249:
+        return Abstract_Declarator->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of_unknown_item_Declarator_or_Abstract_Declarator_n::final_pos() const {
+    switch (m_Rule) {
+    case 248:
+        return Declarator->final_pos();
+
+    case 249:
+        return Abstract_Declarator->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n::pos() const {
+    switch (m_Rule) {
+    case 246:
+        return m_Position;
+
+    case 247:
+        return one_of_unknown_item_Declarator_or_Abstract_Declarator->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n::final_pos() const {
+    switch (m_Rule) {
+    case 246:
+        return m_Position;
+
+    case 247:
+        return one_of_unknown_item_Declarator_or_Abstract_Declarator->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of__comma__identifier_n_content::pos() const {
+    switch (m_Rule) {
+    case 211:
+        return m_Position;
+
+    case 212:
+        return _comma_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of__comma__identifier_n_content::final_pos() const {
+    switch (m_Rule) {
+    case 211:
+        return m_Position;
+
+    case 212:
+        return identifier->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of__comma__identifier_n::pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.front()->pos();
+}
+
+dfa::position Ansi_C::list_of__comma__identifier_n::final_pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.back()->final_pos();
+}
+
+dfa::position Ansi_C::Direct_Abstract_Declarator_n::pos() const {
+    switch (m_Rule) {
+    case 119:
+        return _openparen_->pos();
+
+    case 120:
+        return _opensquare_->pos();
+
+    case 121:
+        return Direct_Abstract_Declarator->pos();
+
+    case 122:
+        return Direct_Abstract_Declarator->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Direct_Abstract_Declarator_n::final_pos() const {
+    switch (m_Rule) {
+    case 119:
+        return _closeparen_->final_pos();
+
+    case 120:
+        return _closesquare_->final_pos();
+
+    case 121:
+        return _closesquare_->final_pos();
+
+    case 122:
+        return _closeparen_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_Direct_Abstract_Declarator_n::pos() const {
+    switch (m_Rule) {
+    case 265:
+        return m_Position;
+
+    case 266:
+        return Direct_Abstract_Declarator->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_Direct_Abstract_Declarator_n::final_pos() const {
+    switch (m_Rule) {
+    case 265:
+        return m_Position;
+
+    case 266:
+        return Direct_Abstract_Declarator->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of_Abstract_Declarator_or_Parameter_Type_List_n::pos() const {
+    switch (m_Rule) {
+    case 263:
+        return Abstract_Declarator->pos();
+
+    case 264:
+        return Parameter_Type_List->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::one_of_Abstract_Declarator_or_Parameter_Type_List_n::final_pos() const {
+    switch (m_Rule) {
+    case 263:
+        return Abstract_Declarator->final_pos();
+
+    case 264:
+        return Parameter_Type_List->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n::pos() const {
+    switch (m_Rule) {
+    case 261:
+        return m_Position;
+
+    case 262:
+        return one_of_Abstract_Declarator_or_Parameter_Type_List->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n::final_pos() const {
+    switch (m_Rule) {
+    case 261:
+        return m_Position;
+
+    case 262:
+        return one_of_Abstract_Declarator_or_Parameter_Type_List->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_Parameter_Type_List_n::pos() const {
+    switch (m_Rule) {
+    case 279:
+        return m_Position;
+
+    case 280:
+        return Parameter_Type_List->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_Parameter_Type_List_n::final_pos() const {
+    switch (m_Rule) {
+    case 279:
+        return m_Position;
+
+    case 280:
+        return Parameter_Type_List->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of__comma__Initializer_n_content::pos() const {
+    switch (m_Rule) {
+    case 254:
+        return m_Position;
+
+    case 255:
+        return _comma_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of__comma__Initializer_n_content::final_pos() const {
+    switch (m_Rule) {
+    case 254:
+        return m_Position;
+
+    case 255:
+        return Initializer->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of__comma__Initializer_n::pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.front()->pos();
+}
+
+dfa::position Ansi_C::list_of__comma__Initializer_n::final_pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.back()->final_pos();
+}
+
+dfa::position Ansi_C::optional__comma__n::pos() const {
+    switch (m_Rule) {
+    case 275:
+        return m_Position;
+
+    case 276:
+        return _comma_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional__comma__n::final_pos() const {
+    switch (m_Rule) {
+    case 275:
+        return m_Position;
+
+    case 276:
+        return _comma_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Statement_n::pos() const {
+    switch (m_Rule) {
+    case 125:
+        return Labeled_Statement->pos();
+
+    case 126:
+        return Compound_Statement->pos();
+
+    case 127:
+        return Expression_Statement->pos();
+
+    case 128:
+        return Selection_Statement->pos();
+
+    case 129:
+        return Iteration_Statement->pos();
+
+    case 130:
+        return Jump_Statement->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Statement_n::final_pos() const {
+    switch (m_Rule) {
+    case 125:
+        return Labeled_Statement->final_pos();
+
+    case 126:
+        return Compound_Statement->final_pos();
+
+    case 127:
+        return Expression_Statement->final_pos();
+
+    case 128:
+        return Selection_Statement->final_pos();
+
+    case 129:
+        return Iteration_Statement->final_pos();
+
+    case 130:
+        return Jump_Statement->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Labeled_Statement_n::pos() const {
+    switch (m_Rule) {
+    case 131:
+        return identifier->pos();
+
+    case 132:
+        return case_2->pos();
+
+    case 133:
+        return default_2->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Labeled_Statement_n::final_pos() const {
+    switch (m_Rule) {
+    case 131:
+        return Statement->final_pos();
+
+    case 132:
+        return Statement->final_pos();
+
+    case 133:
+        return Statement->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Compound_Statement_n::pos() const {
+    switch (m_Rule) {
+    case 134:
+        return _opencurly_->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Compound_Statement_n::final_pos() const {
+    switch (m_Rule) {
+    case 134:
+        return _closecurly_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Expression_Statement_n::pos() const {
+    switch (m_Rule) {
+    case 137:
+        return optional_Expression->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Expression_Statement_n::final_pos() const {
+    switch (m_Rule) {
+    case 137:
+        return _semicolon_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Selection_Statement_n::pos() const {
+    switch (m_Rule) {
+    case 138:
+        return if_2->pos();
+
+    case 139:
+        return if_2->pos();
+
+    case 140:
+        return switch_2->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Selection_Statement_n::final_pos() const {
+    switch (m_Rule) {
+    case 138:
+        return Statement->final_pos();
+
+    case 139:
+        return Statement_2->final_pos();
+
+    case 140:
+        return Statement->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Iteration_Statement_n::pos() const {
+    switch (m_Rule) {
+    case 141:
+        return while_2->pos();
+
+    case 142:
+        return do_2->pos();
+
+    case 143:
+        return for_2->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Iteration_Statement_n::final_pos() const {
+    switch (m_Rule) {
+    case 141:
+        return Statement->final_pos();
+
+    case 142:
+        return _closeparen_->final_pos();
+
+    case 143:
+        return Statement->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Jump_Statement_n::pos() const {
+    switch (m_Rule) {
+    case 144:
+        return goto_2->pos();
+
+    case 145:
+        return continue_2->pos();
+
+    case 146:
+        return break_2->pos();
+
+    case 147:
+        return return_2->pos();
+
+    case 148:
+        return return_2->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Jump_Statement_n::final_pos() const {
+    switch (m_Rule) {
+    case 144:
+        return _semicolon_->final_pos();
+
+    case 145:
+        return _semicolon_->final_pos();
+
+    case 146:
+        return _semicolon_->final_pos();
+
+    case 147:
+        return _semicolon_->final_pos();
+
+    case 148:
+        return _semicolon_->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Declaration_List_n::pos() const {
+    switch (m_Rule) {
+    case 135:
+        return list_of_unknown_item_Declaration->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Declaration_List_n::final_pos() const {
+    switch (m_Rule) {
+    case 135:
+        return list_of_unknown_item_Declaration->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_Declaration_List_n::pos() const {
+    switch (m_Rule) {
+    case 172:
+        return m_Position;
+
+    case 173:
+        return Declaration_List->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_Declaration_List_n::final_pos() const {
+    switch (m_Rule) {
+    case 172:
+        return m_Position;
+
+    case 173:
+        return Declaration_List->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Statement_List_n::pos() const {
+    switch (m_Rule) {
+    case 136:
+        return list_of_Statement->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Statement_List_n::final_pos() const {
+    switch (m_Rule) {
+    case 136:
+        return list_of_Statement->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_Statement_List_n::pos() const {
+    switch (m_Rule) {
+    case 237:
+        return m_Position;
+
+    case 238:
+        return Statement_List->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_Statement_List_n::final_pos() const {
+    switch (m_Rule) {
+    case 237:
+        return m_Position;
+
+    case 238:
+        return Statement_List->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of_unknown_item_Declaration_n_content::pos() const {
+    switch (m_Rule) {
+    case 174:
+        return Declaration->pos();
+
+    case 175:
+        return Declaration->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of_unknown_item_Declaration_n_content::final_pos() const {
+    switch (m_Rule) {
+    case 174:
+        return Declaration->final_pos();
+
+    case 175:
+        return Declaration->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of_unknown_item_Declaration_n::pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.front()->pos();
+}
+
+dfa::position Ansi_C::list_of_unknown_item_Declaration_n::final_pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.back()->final_pos();
+}
+
+dfa::position Ansi_C::list_of_Statement_n_content::pos() const {
+    switch (m_Rule) {
+    case 241:
+        return Statement->pos();
+
+    case 242:
+        return Statement->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of_Statement_n_content::final_pos() const {
+    switch (m_Rule) {
+    case 241:
+        return Statement->final_pos();
+
+    case 242:
+        return Statement->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of_Statement_n::pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.front()->pos();
+}
+
+dfa::position Ansi_C::list_of_Statement_n::final_pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.back()->final_pos();
+}
+
+dfa::position Ansi_C::optional_Expression_n::pos() const {
+    switch (m_Rule) {
+    case 239:
+        return m_Position;
+
+    case 240:
+        return Expression->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::optional_Expression_n::final_pos() const {
+    switch (m_Rule) {
+    case 239:
+        return m_Position;
+
+    case 240:
+        return Expression->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Translation_Unit_n::pos() const {
+    switch (m_Rule) {
+    case 149:
+        return list_of_External_Declaration->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Translation_Unit_n::final_pos() const {
+    switch (m_Rule) {
+    case 149:
+        return list_of_External_Declaration->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::External_Declaration_n::pos() const {
+    switch (m_Rule) {
+    case 150:
+        return Function_Definition->pos();
+
+    case 151:
+        return Declaration->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::External_Declaration_n::final_pos() const {
+    switch (m_Rule) {
+    case 150:
+        return Function_Definition->final_pos();
+
+    case 151:
+        return Declaration->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of_External_Declaration_n_content::pos() const {
+    switch (m_Rule) {
+    case 162:
+        return External_Declaration->pos();
+
+    case 163:
+        return External_Declaration->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of_External_Declaration_n_content::final_pos() const {
+    switch (m_Rule) {
+    case 162:
+        return External_Declaration->final_pos();
+
+    case 163:
+        return External_Declaration->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::list_of_External_Declaration_n::pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.front()->pos();
+}
+
+dfa::position Ansi_C::list_of_External_Declaration_n::final_pos() const {
+    if (m_Data.empty()) return m_Position;
+    return m_Data.back()->final_pos();
+}
+
+dfa::position Ansi_C::Function_Definition_n::pos() const {
+    switch (m_Rule) {
+    case 152:
+        return Declaration_Specifiers->pos();
+
+    case 153:
+        return Declarator->pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::Function_Definition_n::final_pos() const {
+    switch (m_Rule) {
+    case 152:
+        return Compound_Statement->final_pos();
+
+    case 153:
+        return Compound_Statement->final_pos();
+
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::end_of_input_n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::end_of_input_n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::end_of_guard_n::pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+dfa::position Ansi_C::end_of_guard_n::final_pos() const {
+    switch (m_Rule) {
+    default:
+        return dfa::position(-1, -1, -1);
+    }
+}
+
+Ansi_C::parser_actions::node Ansi_C::parser_actions::shift(const dfa::lexeme_container& lexeme) {
+    switch (lexeme->matched()) {
+    case 0: // auto
+        return node(new auto_n(lexeme));
+
+    case 1: // break
+        return node(new break_n(lexeme));
+
+    case 2: // case
+        return node(new case_n(lexeme));
+
+    case 3: // char
+        return node(new char_n(lexeme));
+
+    case 4: // const
+        return node(new const_n(lexeme));
+
+    case 5: // continue
+        return node(new continue_n(lexeme));
+
+    case 6: // default
+        return node(new default_n(lexeme));
+
+    case 7: // do
+        return node(new do_n(lexeme));
+
+    case 8: // double
+        return node(new double_n(lexeme));
+
+    case 9: // else
+        return node(new else_n(lexeme));
+
+    case 10: // enum
+        return node(new enum_n(lexeme));
+
+    case 11: // extern
+        return node(new extern_n(lexeme));
+
+    case 12: // float
+        return node(new float_n(lexeme));
+
+    case 13: // for
+        return node(new for_n(lexeme));
+
+    case 14: // goto
+        return node(new goto_n(lexeme));
+
+    case 15: // if
+        return node(new if_n(lexeme));
+
+    case 16: // int
+        return node(new int_n(lexeme));
+
+    case 17: // long
+        return node(new long_n(lexeme));
+
+    case 18: // register
+        return node(new register_n(lexeme));
+
+    case 19: // return
+        return node(new return_n(lexeme));
+
+    case 20: // short
+        return node(new short_n(lexeme));
+
+    case 21: // signed
+        return node(new signed_n(lexeme));
+
+    case 22: // sizeof
+        return node(new sizeof_n(lexeme));
+
+    case 23: // static
+        return node(new static_n(lexeme));
+
+    case 24: // struct
+        return node(new struct_n(lexeme));
+
+    case 25: // switch
+        return node(new switch_n(lexeme));
+
+    case 26: // typedef
+        return node(new typedef_n(lexeme));
+
+    case 27: // union
+        return node(new union_n(lexeme));
+
+    case 28: // unsigned
+        return node(new unsigned_n(lexeme));
+
+    case 29: // void
+        return node(new void_n(lexeme));
+
+    case 30: // volatile
+        return node(new volatile_n(lexeme));
+
+    case 31: // while
+        return node(new while_n(lexeme));
+
+    case 32: // identifier
+        return node(new identifier_n(lexeme));
+
+    case 33: // constant_hex
+        return node(new constant_hex_n(lexeme));
+
+    case 34: // constant_octal
+        return node(new constant_octal_n(lexeme));
+
+    case 35: // constant_decimal
+        return node(new constant_decimal_n(lexeme));
+
+    case 36: // constant_character
+        return node(new constant_character_n(lexeme));
+
+    case 37: // constant_float
+        return node(new constant_float_n(lexeme));
+
+    case 38: // string_literal
+        return node(new string_literal_n(lexeme));
+
+    case 39: // comment
+        return node(new comment_n(lexeme));
+
+    case 40: // whitespace
+        return node(new whitespace_n(lexeme));
+
+    case 41: // doc_comment
+        return node(new doc_comment_n(lexeme));
+
+    case 42: // _openparen_
+        return node(new _openparen__n(lexeme));
+
+    case 43: // _closeparen_
+        return node(new _closeparen__n(lexeme));
+
+    case 44: // _opensquare_
+        return node(new _opensquare__n(lexeme));
+
+    case 45: // _closesquare_
+        return node(new _closesquare__n(lexeme));
+
+    case 46: // _dot_
+        return node(new _dot__n(lexeme));
+
+    case 47: // __greaterthan_
+        return node(new __greaterthan__n(lexeme));
+
+    case 48: // _plus__plus_
+        return node(new _plus__plus__n(lexeme));
+
+    case 49: // __
+        return node(new ___n(lexeme));
+
+    case 50: // _comma_
+        return node(new _comma__n(lexeme));
+
+    case 51: // _ampersand_
+        return node(new _ampersand__n(lexeme));
+
+    case 52: // _star_
+        return node(new _star__n(lexeme));
+
+    case 53: // _plus_
+        return node(new _plus__n(lexeme));
+
+    case 54: // _minus_
+        return node(new _minus__n(lexeme));
+
+    case 55: // _tilde_
+        return node(new _tilde__n(lexeme));
+
+    case 56: // _exclamation_
+        return node(new _exclamation__n(lexeme));
+
+    case 57: // _slash_
+        return node(new _slash__n(lexeme));
+
+    case 58: // _percent_
+        return node(new _percent__n(lexeme));
+
+    case 59: // _lessthan__lessthan_
+        return node(new _lessthan__lessthan__n(lexeme));
+
+    case 60: // _greaterthan__greaterthan_
+        return node(new _greaterthan__greaterthan__n(lexeme));
+
+    case 61: // _lessthan_
+        return node(new _lessthan__n(lexeme));
+
+    case 62: // _greaterthan_
+        return node(new _greaterthan__n(lexeme));
+
+    case 63: // _lessthan__equals_
+        return node(new _lessthan__equals__n(lexeme));
+
+    case 64: // _greaterthan__equals_
+        return node(new _greaterthan__equals__n(lexeme));
+
+    case 65: // _equals__equals_
+        return node(new _equals__equals__n(lexeme));
+
+    case 66: // _exclamation__equals_
+        return node(new _exclamation__equals__n(lexeme));
+
+    case 67: // _cicumflex_
+        return node(new _cicumflex__n(lexeme));
+
+    case 68: // _pipe_
+        return node(new _pipe__n(lexeme));
+
+    case 69: // _ampersand__ampersand_
+        return node(new _ampersand__ampersand__n(lexeme));
+
+    case 70: // _pipe__pipe_
+        return node(new _pipe__pipe__n(lexeme));
+
+    case 71: // _question_
+        return node(new _question__n(lexeme));
+
+    case 72: // _colon_
+        return node(new _colon__n(lexeme));
+
+    case 73: // _equals_
+        return node(new _equals__n(lexeme));
+
+    case 74: // _star__equals_
+        return node(new _star__equals__n(lexeme));
+
+    case 75: // _slash__equals_
+        return node(new _slash__equals__n(lexeme));
+
+    case 76: // _percent__equals_
+        return node(new _percent__equals__n(lexeme));
+
+    case 77: // _plus__equals_
+        return node(new _plus__equals__n(lexeme));
+
+    case 78: // __equals_
+        return node(new __equals__n(lexeme));
+
+    case 79: // _lessthan__lessthan__equals_
+        return node(new _lessthan__lessthan__equals__n(lexeme));
+
+    case 80: // _greaterthan__greaterthan__equals_
+        return node(new _greaterthan__greaterthan__equals__n(lexeme));
+
+    case 81: // _ampersand__equals_
+        return node(new _ampersand__equals__n(lexeme));
+
+    case 82: // _cicumflex__equals_
+        return node(new _cicumflex__equals__n(lexeme));
+
+    case 83: // _pipe__equals_
+        return node(new _pipe__equals__n(lexeme));
+
+    case 84: // _semicolon_
+        return node(new _semicolon__n(lexeme));
+
+    case 85: // _opencurly_
+        return node(new _opencurly__n(lexeme));
+
+    case 86: // _closecurly_
+        return node(new _closecurly__n(lexeme));
+
+    case 87: // _dot__dot__dot_
+        return node(new _dot__dot__dot__n(lexeme));
+
+    default:
+        return node(new terminal(lexeme));
+    }
+}
+
+Ansi_C::parser_actions::node Ansi_C::parser_actions::reduce(int nonterminal, int rule, const reduce_list& reduce, const dfa::position& lookaheadPosition) {
+    switch (rule) {
+    case 154:
+    {
+        return node(new epsilon_n(reduce[0].cast_to<Translation_Unit_n>()));
+    }
+
+    case 0:
+    {
+        return node(new Constant_n(reduce[0].cast_to<constant_hex_n>()));
+    }
+
+    case 1:
+    {
+        return node(new Constant_n(reduce[0].cast_to<constant_octal_n>()));
+    }
+
+    case 2:
+    {
+        return node(new Constant_n(reduce[0].cast_to<constant_decimal_n>()));
+    }
+
+    case 3:
+    {
+        return node(new Constant_n(reduce[0].cast_to<constant_float_n>()));
+    }
+
+    case 4:
+    {
+        return node(new Constant_n(reduce[0].cast_to<constant_character_n>()));
+    }
+
+    case 5:
+    {
+        return node(new Constant_n(reduce[0].cast_to<string_literal_n>()));
+    }
+
+    case 6:
+    {
+        return node(new Primary_Expression_n(reduce[0].cast_to<identifier_n>()));
+    }
+
+    case 7:
+    {
+        return node(new Primary_Expression_n(reduce[0].cast_to<Constant_n>()));
+    }
+
+    case 8:
+    {
+        return node(new Primary_Expression_n(reduce[2].cast_to<_openparen__n>(), reduce[1].cast_to<Expression_n>(), reduce[0].cast_to<_closeparen__n>()));
+    }
+
+    case 57:
+    {
+        return node(new Expression_n(reduce[0].cast_to<Assignment_Expression_n>()));
+    }
+
+    case 58:
+    {
+        return node(new Expression_n(reduce[2].cast_to<Expression_n>(), reduce[1].cast_to<_comma__n>(), reduce[0].cast_to<Assignment_Expression_n>()));
+    }
+
+    case 9:
+    {
+        return node(new Postfix_Expression_n(reduce[0].cast_to<Primary_Expression_n>()));
+    }
+
+    case 10:
+    {
+        return node(new Postfix_Expression_n(reduce[3].cast_to<Postfix_Expression_n>(), reduce[2].cast_to<_opensquare__n>(), reduce[1].cast_to<Expression_n>(), reduce[0].cast_to<_closesquare__n>()));
+    }
+
+    case 11:
+    {
+        return node(new Postfix_Expression_n(reduce[3].cast_to<Postfix_Expression_n>(), reduce[2].cast_to<_openparen__n>(), reduce[1].cast_to<optional_Argument_Expression_List_n>(), reduce[0].cast_to<_closeparen__n>()));
+    }
+
+    case 12:
+    {
+        return node(new Postfix_Expression_n(reduce[2].cast_to<Postfix_Expression_n>(), reduce[1].cast_to<_dot__n>(), reduce[0].cast_to<identifier_n>()));
+    }
+
+    case 13:
+    {
+        return node(new Postfix_Expression_n(reduce[2].cast_to<Postfix_Expression_n>(), reduce[1].cast_to<__greaterthan__n>(), reduce[0].cast_to<identifier_n>()));
+    }
+
+    case 14:
+    {
+        return node(new Postfix_Expression_n(reduce[1].cast_to<Postfix_Expression_n>(), reduce[0].cast_to<_plus__plus__n>()));
+    }
+
+    case 15:
+    {
+        return node(new Postfix_Expression_n(reduce[1].cast_to<Postfix_Expression_n>(), reduce[0].cast_to<___n>()));
+    }
+
+    case 16:
+    {
+        return node(new Argument_Expression_List_n(reduce[1].cast_to<Assignment_Expression_n>(), reduce[0].cast_to<list_of__comma__Assignment_Expression_n>()));
+    }
+
+    case 252:
+    {
+        return node(new optional_Argument_Expression_List_n(lookaheadPosition));
+    }
+
+    case 253:
+    {
+        return node(new optional_Argument_Expression_List_n(reduce[0].cast_to<Argument_Expression_List_n>()));
+    }
+
+    case 55:
+    {
+        return node(new Assignment_Expression_n(reduce[0].cast_to<Conditional_Expression_n>()));
+    }
+
+    case 56:
+    {
+        return node(new Assignment_Expression_n(reduce[2].cast_to<Unary_Expression_n>(), reduce[1].cast_to<one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n>(), reduce[0].cast_to<Assignment_Expression_n>()));
+    }
+
+    case 273:
+    {
+        return node(new list_of__comma__Assignment_Expression_n());
+    }
+
+    case 274:
+    {
+        util::syntax_ptr<class list_of__comma__Assignment_Expression_n_content> content(new list_of__comma__Assignment_Expression_n_content(reduce[1].cast_to<_comma__n>(), reduce[0].cast_to<Assignment_Expression_n>()));
+        util::syntax_ptr<class list_of__comma__Assignment_Expression_n> list(reduce[2].cast_to<list_of__comma__Assignment_Expression_n>());
+#if __cplusplus >= 201103L
+        const_cast<list_of__comma__Assignment_Expression_n*>(list.item())->add_child(std::move(content));
+#else
+        const_cast<list_of__comma__Assignment_Expression_n*>(list.item())->add_child(content);
+#endif
+        return list.cast_to<syntax_node>();
+    }
+
+    case 17:
+    {
+        return node(new Unary_Expression_n(reduce[0].cast_to<Postfix_Expression_n>()));
+    }
+
+    case 18:
+    {
+        return node(new Unary_Expression_n(reduce[1].cast_to<_plus__plus__n>(), reduce[0].cast_to<Unary_Expression_n>()));
+    }
+
+    case 19:
+    {
+        return node(new Unary_Expression_n(reduce[1].cast_to<___n>(), reduce[0].cast_to<Unary_Expression_n>()));
+    }
+
+    case 20:
+    {
+        return node(new Unary_Expression_n(reduce[1].cast_to<one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n>(), reduce[0].cast_to<Cast_Expression_n>()));
+    }
+
+    case 21:
+    {
+        return node(new Unary_Expression_n(reduce[1].cast_to<sizeof_n>(), reduce[0].cast_to<Unary_Expression_n>()));
+    }
+
+    case 22:
+    {
+        return node(new Unary_Expression_n(reduce[4].cast_to<sizeof_n>(), reduce[2].cast_to<_openparen__n>(), reduce[1].cast_to<Type_Name_n>(), reduce[0].cast_to<_closeparen__n>()));
+    }
+
+    case 199:
+    {
+        return node(new one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(reduce[0].cast_to<_ampersand__n>()));
+    }
+
+    case 200:
+    {
+        return node(new one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(reduce[0].cast_to<_star__n>()));
+    }
+
+    case 201:
+    {
+        return node(new one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(reduce[0].cast_to<_plus__n>()));
+    }
+
+    case 202:
+    {
+        return node(new one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(reduce[0].cast_to<_minus__n>()));
+    }
+
+    case 203:
+    {
+        return node(new one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(reduce[0].cast_to<_tilde__n>()));
+    }
+
+    case 204:
+    {
+        return node(new one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(reduce[0].cast_to<_exclamation__n>()));
+    }
+
+    case 23:
+    {
+        return node(new Cast_Expression_n(reduce[0].cast_to<Unary_Expression_n>()));
+    }
+
+    case 24:
+    {
+        return node(new Cast_Expression_n(reduce[1].cast_to<Unambiguous_Cast_n>(), reduce[0].cast_to<Cast_Expression_n>()));
+    }
+
+    case 25:
+    {
+        return node(new Cast_Expression_n(reduce[1].cast_to<Ambiguous_Cast_n>(), reduce[0].cast_to<Cast_Expression_n>()));
+    }
+
+    case 116:
+    {
+        return node(new Type_Name_n(reduce[1].cast_to<Specifier_Qualifier_List_n>(), reduce[0].cast_to<optional_Abstract_Declarator_n>()));
+    }
+
+    case 243:
+    {
+    }
+
+    case 26:
+    {
+        return node(new Unambiguous_Cast_n(reduce[3].cast_to<_openparen__n>(), reduce[1].cast_to<Type_Name_n>(), reduce[0].cast_to<_closeparen__n>()));
+    }
+
+    case 31:
+    {
+        return node(new Ambiguous_Cast_n(reduce[3].cast_to<_openparen__n>(), reduce[1].cast_to<Type_Name_n>(), reduce[0].cast_to<_closeparen__n>()));
+    }
+
+    case 27:
+    {
+        return node(new Unambiguous_Cast_Follow_n(reduce[0].cast_to<Simple_Type_Specifier_n>()));
+    }
+
+    case 28:
+    {
+        return node(new Unambiguous_Cast_Follow_n(reduce[0].cast_to<Type_Qualifier_n>()));
+    }
+
+    case 29:
+    {
+        return node(new Unambiguous_Cast_Follow_n(reduce[1].cast_to<identifier_n>(), reduce[0].cast_to<one_of_Simple_Type_Specifier_or_Type_Qualifier_n>()));
+    }
+
+    case 30:
+    {
+        return node(new Unambiguous_Cast_Follow_n(reduce[3].cast_to<identifier_n>(), reduce[2].cast_to<optional_Abstract_Declarator_n>(), reduce[1].cast_to<_closeparen__n>(), reduce[0].cast_to<one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n>()));
+    }
+
+    case 244:
+    {
+    }
+
+    case 81:
+    {
+        return node(new Simple_Type_Specifier_n(reduce[0].cast_to<void_n>()));
+    }
+
+    case 82:
+    {
+        return node(new Simple_Type_Specifier_n(reduce[0].cast_to<char_n>()));
+    }
+
+    case 83:
+    {
+        return node(new Simple_Type_Specifier_n(reduce[0].cast_to<short_n>()));
+    }
+
+    case 84:
+    {
+        return node(new Simple_Type_Specifier_n(reduce[0].cast_to<int_n>()));
+    }
+
+    case 85:
+    {
+        return node(new Simple_Type_Specifier_n(reduce[0].cast_to<long_n>()));
+    }
+
+    case 86:
+    {
+        return node(new Simple_Type_Specifier_n(reduce[0].cast_to<float_n>()));
+    }
+
+    case 87:
+    {
+        return node(new Simple_Type_Specifier_n(reduce[0].cast_to<double_n>()));
+    }
+
+    case 88:
+    {
+        return node(new Simple_Type_Specifier_n(reduce[0].cast_to<signed_n>()));
+    }
+
+    case 89:
+    {
+        return node(new Simple_Type_Specifier_n(reduce[0].cast_to<unsigned_n>()));
+    }
+
+    case 90:
+    {
+        return node(new Simple_Type_Specifier_n(reduce[0].cast_to<Struct_Or_Union_Specifier_n>()));
+    }
+
+    case 91:
+    {
+        return node(new Simple_Type_Specifier_n(reduce[0].cast_to<Enum_Specifier_n>()));
+    }
+
+    case 103:
+    {
+        return node(new Type_Qualifier_n(reduce[0].cast_to<const_n>()));
+    }
+
+    case 104:
+    {
+        return node(new Type_Qualifier_n(reduce[0].cast_to<volatile_n>()));
+    }
+
+    case 269:
+    {
+        return node(new one_of_Simple_Type_Specifier_or_Type_Qualifier_n(reduce[0].cast_to<Simple_Type_Specifier_n>()));
+    }
+
+    case 270:
+    {
+        return node(new one_of_Simple_Type_Specifier_or_Type_Qualifier_n(reduce[0].cast_to<Type_Qualifier_n>()));
+    }
+
+    case 117:
+    {
+        return node(new Abstract_Declarator_n(reduce[1].cast_to<Pointer_n>(), reduce[0].cast_to<optional_Direct_Abstract_Declarator_n>()));
+    }
+
+    case 118:
+    {
+        return node(new Abstract_Declarator_n(reduce[0].cast_to<Direct_Abstract_Declarator_n>()));
+    }
+
+    case 271:
+    {
+        return node(new optional_Abstract_Declarator_n(lookaheadPosition));
+    }
+
+    case 272:
+    {
+        return node(new optional_Abstract_Declarator_n(reduce[0].cast_to<Abstract_Declarator_n>()));
+    }
+
+    case 281:
+    {
+        return node(new one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(reduce[1].cast_to<_plus__plus__n>(), reduce[0].cast_to<Unary_Expression_n>()));
+    }
+
+    case 282:
+    {
+        return node(new one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(reduce[1].cast_to<___n>(), reduce[0].cast_to<Unary_Expression_n>()));
+    }
+
+    case 283:
+    {
+        return node(new one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(reduce[0].cast_to<_ampersand__n>()));
+    }
+
+    case 284:
+    {
+        return node(new one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(reduce[0].cast_to<_tilde__n>()));
+    }
+
+    case 285:
+    {
+        return node(new one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(reduce[0].cast_to<_exclamation__n>()));
+    }
+
+    case 286:
+    {
+        return node(new one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(reduce[0].cast_to<sizeof_n>()));
+    }
+
+    case 287:
+    {
+        return node(new one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(reduce[0].cast_to<identifier_n>()));
+    }
+
+    case 288:
+    {
+        return node(new one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(reduce[0].cast_to<Constant_n>()));
+    }
+
+    case 32:
+    {
+        return node(new Ambiguous_Cast_Follow_n(reduce[3].cast_to<identifier_n>(), reduce[2].cast_to<optional_Abstract_Declarator_n>(), reduce[1].cast_to<_closeparen__n>(), reduce[0].cast_to<one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n>()));
+    }
+
+    case 245:
+    {
+    }
+
+    case 289:
+    {
+        return node(new one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n(reduce[0].cast_to<_plus__n>()));
+    }
+
+    case 290:
+    {
+        return node(new one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n(reduce[0].cast_to<_star__n>()));
+    }
+
+    case 291:
+    {
+        return node(new one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n(reduce[0].cast_to<_minus__n>()));
+    }
+
+    case 292:
+    {
+        return node(new one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n(reduce[2].cast_to<_openparen__n>(), reduce[1].cast_to<Expression_n>(), reduce[0].cast_to<_closeparen__n>()));
+    }
+
+    case 33:
+    {
+        return node(new Multiplicative_Expression_n(reduce[0].cast_to<Cast_Expression_n>()));
+    }
+
+    case 34:
+    {
+        return node(new Multiplicative_Expression_n(reduce[2].cast_to<Multiplicative_Expression_n>(), reduce[1].cast_to<one_of__star__or_one_of__slash__or__percent__n>(), reduce[0].cast_to<Cast_Expression_n>()));
+    }
+
+    case 213:
+    {
+        return node(new one_of__star__or_one_of__slash__or__percent__n(reduce[0].cast_to<_star__n>()));
+    }
+
+    case 214:
+    {
+        return node(new one_of__star__or_one_of__slash__or__percent__n(reduce[0].cast_to<_slash__n>()));
+    }
+
+    case 215:
+    {
+        return node(new one_of__star__or_one_of__slash__or__percent__n(reduce[0].cast_to<_percent__n>()));
+    }
+
+    case 35:
+    {
+        return node(new Additive_Expression_n(reduce[0].cast_to<Multiplicative_Expression_n>()));
+    }
+
+    case 36:
+    {
+        return node(new Additive_Expression_n(reduce[2].cast_to<Additive_Expression_n>(), reduce[1].cast_to<one_of__plus__or___n>(), reduce[0].cast_to<Multiplicative_Expression_n>()));
+    }
+
+    case 216:
+    {
+        return node(new one_of__plus__or___n(reduce[0].cast_to<_plus__n>()));
+    }
+
+    case 217:
+    {
+        return node(new one_of__plus__or___n(reduce[0].cast_to<_minus__n>()));
+    }
+
+    case 37:
+    {
+        return node(new Shift_Expression_n(reduce[0].cast_to<Additive_Expression_n>()));
+    }
+
+    case 38:
+    {
+        return node(new Shift_Expression_n(reduce[2].cast_to<Shift_Expression_n>(), reduce[1].cast_to<one_of__lessthan__lessthan__or__greaterthan__greaterthan__n>(), reduce[0].cast_to<Additive_Expression_n>()));
+    }
+
+    case 218:
+    {
+        return node(new one_of__lessthan__lessthan__or__greaterthan__greaterthan__n(reduce[0].cast_to<_lessthan__lessthan__n>()));
+    }
+
+    case 219:
+    {
+        return node(new one_of__lessthan__lessthan__or__greaterthan__greaterthan__n(reduce[0].cast_to<_greaterthan__greaterthan__n>()));
+    }
+
+    case 39:
+    {
+        return node(new Relational_Expression_n(reduce[0].cast_to<Shift_Expression_n>()));
+    }
+
+    case 40:
+    {
+        return node(new Relational_Expression_n(reduce[2].cast_to<Relational_Expression_n>(), reduce[1].cast_to<one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n>(), reduce[0].cast_to<Shift_Expression_n>()));
+    }
+
+    case 220:
+    {
+        return node(new one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n(reduce[0].cast_to<_lessthan__n>()));
+    }
+
+    case 221:
+    {
+        return node(new one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n(reduce[0].cast_to<_greaterthan__n>()));
+    }
+
+    case 222:
+    {
+        return node(new one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n(reduce[0].cast_to<_lessthan__equals__n>()));
+    }
+
+    case 223:
+    {
+        return node(new one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n(reduce[0].cast_to<_greaterthan__equals__n>()));
+    }
+
+    case 41:
+    {
+        return node(new Equality_Expression_n(reduce[0].cast_to<Relational_Expression_n>()));
+    }
+
+    case 42:
+    {
+        return node(new Equality_Expression_n(reduce[2].cast_to<Equality_Expression_n>(), reduce[1].cast_to<one_of__equals__equals__or__exclamation__equals__n>(), reduce[0].cast_to<Relational_Expression_n>()));
+    }
+
+    case 224:
+    {
+        return node(new one_of__equals__equals__or__exclamation__equals__n(reduce[0].cast_to<_equals__equals__n>()));
+    }
+
+    case 225:
+    {
+        return node(new one_of__equals__equals__or__exclamation__equals__n(reduce[0].cast_to<_exclamation__equals__n>()));
+    }
+
+    case 43:
+    {
+        return node(new And_Expression_n(reduce[0].cast_to<Equality_Expression_n>()));
+    }
+
+    case 44:
+    {
+        return node(new And_Expression_n(reduce[2].cast_to<And_Expression_n>(), reduce[1].cast_to<_ampersand__n>(), reduce[0].cast_to<Equality_Expression_n>()));
+    }
+
+    case 45:
+    {
+        return node(new Exclusive_Or_Expression_n(reduce[0].cast_to<And_Expression_n>()));
+    }
+
+    case 46:
+    {
+        return node(new Exclusive_Or_Expression_n(reduce[2].cast_to<Exclusive_Or_Expression_n>(), reduce[1].cast_to<_cicumflex__n>(), reduce[0].cast_to<And_Expression_n>()));
+    }
+
+    case 47:
+    {
+        return node(new Inclusive_Or_Expression_n(reduce[0].cast_to<Exclusive_Or_Expression_n>()));
+    }
+
+    case 48:
+    {
+        return node(new Inclusive_Or_Expression_n(reduce[2].cast_to<Inclusive_Or_Expression_n>(), reduce[1].cast_to<_pipe__n>(), reduce[0].cast_to<Exclusive_Or_Expression_n>()));
+    }
+
+    case 49:
+    {
+        return node(new Logical_And_Expression_n(reduce[0].cast_to<Inclusive_Or_Expression_n>()));
+    }
+
+    case 50:
+    {
+        return node(new Logical_And_Expression_n(reduce[2].cast_to<Logical_And_Expression_n>(), reduce[1].cast_to<_ampersand__ampersand__n>(), reduce[0].cast_to<Inclusive_Or_Expression_n>()));
+    }
+
+    case 51:
+    {
+        return node(new Logical_Or_Expression_n(reduce[0].cast_to<Logical_And_Expression_n>()));
+    }
+
+    case 52:
+    {
+        return node(new Logical_Or_Expression_n(reduce[2].cast_to<Logical_Or_Expression_n>(), reduce[1].cast_to<_pipe__pipe__n>(), reduce[0].cast_to<Logical_And_Expression_n>()));
+    }
+
+    case 53:
+    {
+        return node(new Conditional_Expression_n(reduce[0].cast_to<Logical_Or_Expression_n>()));
+    }
+
+    case 54:
+    {
+        return node(new Conditional_Expression_n(reduce[4].cast_to<Logical_Or_Expression_n>(), reduce[3].cast_to<_question__n>(), reduce[2].cast_to<Expression_n>(), reduce[1].cast_to<_colon__n>(), reduce[0].cast_to<Conditional_Expression_n>()));
+    }
+
+    case 226:
+    {
+        return node(new one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(reduce[0].cast_to<_equals__n>()));
+    }
+
+    case 227:
+    {
+        return node(new one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(reduce[0].cast_to<_star__equals__n>()));
+    }
+
+    case 228:
+    {
+        return node(new one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(reduce[0].cast_to<_slash__equals__n>()));
+    }
+
+    case 229:
+    {
+        return node(new one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(reduce[0].cast_to<_percent__equals__n>()));
+    }
+
+    case 230:
+    {
+        return node(new one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(reduce[0].cast_to<_plus__equals__n>()));
+    }
+
+    case 231:
+    {
+        return node(new one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(reduce[0].cast_to<__equals__n>()));
+    }
+
+    case 232:
+    {
+        return node(new one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(reduce[0].cast_to<_lessthan__lessthan__equals__n>()));
+    }
+
+    case 233:
+    {
+        return node(new one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(reduce[0].cast_to<_greaterthan__greaterthan__equals__n>()));
+    }
+
+    case 234:
+    {
+        return node(new one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(reduce[0].cast_to<_ampersand__equals__n>()));
+    }
+
+    case 235:
+    {
+        return node(new one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(reduce[0].cast_to<_cicumflex__equals__n>()));
+    }
+
+    case 236:
+    {
+        return node(new one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(reduce[0].cast_to<_pipe__equals__n>()));
+    }
+
+    case 59:
+    {
+        return node(new Constant_Expression_n(reduce[0].cast_to<Conditional_Expression_n>()));
+    }
+
+    case 60:
+    {
+        return node(new Declaration_n(reduce[3].cast_to<Declaration_Specifiers_n>(), reduce[1].cast_to<optional_Init_Declarator_List_n>(), reduce[0].cast_to<_semicolon__n>()));
+    }
+
+    case 61:
+    {
+        return node(new Declaration_Specifiers_n(reduce[0].cast_to<list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n>()));
+    }
+
+    case 63:
+    {
+        return node(new Init_Declarator_n(reduce[1].cast_to<Declarator_n>(), reduce[0].cast_to<optional__equals__Initializer_n>()));
+    }
+
+    case 185:
+    {
+        return node(new one_of__semicolon__or__comma__n(reduce[0].cast_to<_semicolon__n>()));
+    }
+
+    case 186:
+    {
+        return node(new one_of__semicolon__or__comma__n(reduce[0].cast_to<_comma__n>()));
+    }
+
+    case 176:
+    {
+        return node(new one_of__semicolon__or_Init_Declarator_one_of__semicolon__or__comma__n(reduce[0].cast_to<_semicolon__n>()));
+    }
+
+    case 177:
+    {
+        return node(new one_of__semicolon__or_Init_Declarator_one_of__semicolon__or__comma__n(reduce[1].cast_to<Init_Declarator_n>(), reduce[0].cast_to<one_of__semicolon__or__comma__n>()));
+    }
+
+    case 169:
+    {
+    }
+
+    case 62:
+    {
+        return node(new Init_Declarator_List_n(reduce[1].cast_to<Init_Declarator_n>(), reduce[0].cast_to<list_of__comma__Init_Declarator_n>()));
+    }
+
+    case 178:
+    {
+        return node(new optional_Init_Declarator_List_n(lookaheadPosition));
+    }
+
+    case 179:
+    {
+        return node(new optional_Init_Declarator_List_n(reduce[0].cast_to<Init_Declarator_List_n>()));
+    }
+
+    case 64:
+    {
+        return node(new Storage_Class_Specifier_n(reduce[0].cast_to<typedef_n>()));
+    }
+
+    case 65:
+    {
+        return node(new Storage_Class_Specifier_n(reduce[0].cast_to<extern_n>()));
+    }
+
+    case 66:
+    {
+        return node(new Storage_Class_Specifier_n(reduce[0].cast_to<static_n>()));
+    }
+
+    case 67:
+    {
+        return node(new Storage_Class_Specifier_n(reduce[0].cast_to<auto_n>()));
+    }
+
+    case 68:
+    {
+        return node(new Storage_Class_Specifier_n(reduce[0].cast_to<register_n>()));
+    }
+
+    case 69:
+    {
+        return node(new Type_Specifier_n(reduce[0].cast_to<void_n>()));
+    }
+
+    case 70:
+    {
+        return node(new Type_Specifier_n(reduce[0].cast_to<char_n>()));
+    }
+
+    case 71:
+    {
+        return node(new Type_Specifier_n(reduce[0].cast_to<short_n>()));
+    }
+
+    case 72:
+    {
+        return node(new Type_Specifier_n(reduce[0].cast_to<int_n>()));
+    }
+
+    case 73:
+    {
+        return node(new Type_Specifier_n(reduce[0].cast_to<long_n>()));
+    }
+
+    case 74:
+    {
+        return node(new Type_Specifier_n(reduce[0].cast_to<float_n>()));
+    }
+
+    case 75:
+    {
+        return node(new Type_Specifier_n(reduce[0].cast_to<double_n>()));
+    }
+
+    case 76:
+    {
+        return node(new Type_Specifier_n(reduce[0].cast_to<signed_n>()));
+    }
+
+    case 77:
+    {
+        return node(new Type_Specifier_n(reduce[0].cast_to<unsigned_n>()));
+    }
+
+    case 78:
+    {
+        return node(new Type_Specifier_n(reduce[0].cast_to<Struct_Or_Union_Specifier_n>()));
+    }
+
+    case 79:
+    {
+        return node(new Type_Specifier_n(reduce[0].cast_to<Enum_Specifier_n>()));
+    }
+
+    case 80:
+    {
+        return node(new Type_Specifier_n(reduce[0].cast_to<identifier_n>()));
+    }
+
+    case 191:
+    {
+        return node(new one_of_Type_Specifier_or_Type_Qualifier_n(reduce[0].cast_to<Type_Specifier_n>()));
+    }
+
+    case 192:
+    {
+        return node(new one_of_Type_Specifier_or_Type_Qualifier_n(reduce[0].cast_to<Type_Qualifier_n>()));
+    }
+
+    case 155:
+    {
+        return node(new one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n(reduce[0].cast_to<Storage_Class_Specifier_n>()));
+    }
+
+    case 156:
+    {
+        return node(new one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n(reduce[0].cast_to<Type_Specifier_n>()));
+    }
+
+    case 159:
+    {
+        return node(new one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n(reduce[0].cast_to<Type_Qualifier_n>()));
+    }
+
+    case 160:
+    {
+        util::syntax_ptr<class list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n_content> content(new list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n_content(reduce[0].cast_to<one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n>()));
+        util::syntax_ptr<class list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n> list(new list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n());
+        const_cast<list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n*>(list.item())->set_position(lookaheadPosition);
+#if __cplusplus >= 201103L
+        const_cast<list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n*>(list.item())->add_child(std::move(content));
+#else
+        const_cast<list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n*>(list.item())->add_child(content);
+#endif
+        return list.cast_to<syntax_node>();
+    }
+
+    case 161:
+    {
+        util::syntax_ptr<class list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n_content> content(new list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n_content(reduce[0].cast_to<one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n>()));
+        util::syntax_ptr<class list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n> list(reduce[1].cast_to<list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n>());
+#if __cplusplus >= 201103L
+        const_cast<list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n*>(list.item())->add_child(std::move(content));
+#else
+        const_cast<list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n*>(list.item())->add_child(content);
+#endif
+        return list.cast_to<syntax_node>();
+    }
+
+    case 189:
+    {
+        return node(new list_of__comma__Init_Declarator_n());
+    }
+
+    case 190:
+    {
+        util::syntax_ptr<class list_of__comma__Init_Declarator_n_content> content(new list_of__comma__Init_Declarator_n_content(reduce[1].cast_to<_comma__n>(), reduce[0].cast_to<Init_Declarator_n>()));
+        util::syntax_ptr<class list_of__comma__Init_Declarator_n> list(reduce[2].cast_to<list_of__comma__Init_Declarator_n>());
+#if __cplusplus >= 201103L
+        const_cast<list_of__comma__Init_Declarator_n*>(list.item())->add_child(std::move(content));
+#else
+        const_cast<list_of__comma__Init_Declarator_n*>(list.item())->add_child(content);
+#endif
+        return list.cast_to<syntax_node>();
+    }
+
+    case 105:
+    {
+        return node(new Declarator_n(reduce[1].cast_to<optional_Pointer_n>(), reduce[0].cast_to<Direct_Declarator_n>()));
+    }
+
+    case 123:
+    {
+        return node(new Initializer_n(reduce[0].cast_to<Assignment_Expression_n>()));
+    }
+
+    case 124:
+    {
+        return node(new Initializer_n(reduce[4].cast_to<_opencurly__n>(), reduce[3].cast_to<Initializer_n>(), reduce[2].cast_to<list_of__comma__Initializer_n>(), reduce[1].cast_to<optional__comma__n>(), reduce[0].cast_to<_closecurly__n>()));
+    }
+
+    case 187:
+    {
+        return node(new optional__equals__Initializer_n(lookaheadPosition));
+    }
+
+    case 188:
+    {
+        return node(new optional__equals__Initializer_n(reduce[1].cast_to<_equals__n>(), reduce[0].cast_to<Initializer_n>()));
+    }
+
+    case 92:
+    {
+        return node(new Struct_Or_Union_Specifier_n(reduce[2].cast_to<one_of_struct_or_union_n>(), reduce[1].cast_to<identifier_n>(), reduce[0].cast_to<optional__opencurly__list_of_Struct_Declaration__closecurly__n>()));
+    }
+
+    case 93:
+    {
+        return node(new Struct_Or_Union_Specifier_n(reduce[3].cast_to<one_of_struct_or_union_n>(), reduce[2].cast_to<_opencurly__n>(), reduce[1].cast_to<list_of_Struct_Declaration_n>(), reduce[0].cast_to<_closecurly__n>()));
+    }
+
+    case 99:
+    {
+        return node(new Enum_Specifier_n(reduce[4].cast_to<enum_n>(), reduce[3].cast_to<optional_identifier_n>(), reduce[2].cast_to<_opencurly__n>(), reduce[1].cast_to<Enumerator_List_n>(), reduce[0].cast_to<_closecurly__n>()));
+    }
+
+    case 100:
+    {
+        return node(new Enum_Specifier_n(reduce[1].cast_to<enum_n>(), reduce[0].cast_to<identifier_n>()));
+    }
+
+    case 157:
+    {
+        return node(new one_of_struct_or_union_n(reduce[0].cast_to<struct_n>()));
+    }
+
+    case 158:
+    {
+        return node(new one_of_struct_or_union_n(reduce[0].cast_to<union_n>()));
+    }
+
+    case 94:
+    {
+        return node(new Struct_Declaration_n(reduce[3].cast_to<Specifier_Qualifier_List_n>(), reduce[1].cast_to<Struct_Declarator_List_n>(), reduce[0].cast_to<_semicolon__n>()));
+    }
+
+    case 182:
+    {
+        return node(new list_of_Struct_Declaration_n());
+    }
+
+    case 183:
+    {
+        util::syntax_ptr<class list_of_Struct_Declaration_n_content> content(new list_of_Struct_Declaration_n_content(reduce[0].cast_to<Struct_Declaration_n>()));
+        util::syntax_ptr<class list_of_Struct_Declaration_n> list(reduce[1].cast_to<list_of_Struct_Declaration_n>());
+#if __cplusplus >= 201103L
+        const_cast<list_of_Struct_Declaration_n*>(list.item())->add_child(std::move(content));
+#else
+        const_cast<list_of_Struct_Declaration_n*>(list.item())->add_child(content);
+#endif
+        return list.cast_to<syntax_node>();
+    }
+
+    case 180:
+    {
+        return node(new optional__opencurly__list_of_Struct_Declaration__closecurly__n(lookaheadPosition));
+    }
+
+    case 181:
+    {
+        return node(new optional__opencurly__list_of_Struct_Declaration__closecurly__n(reduce[2].cast_to<_opencurly__n>(), reduce[1].cast_to<list_of_Struct_Declaration_n>(), reduce[0].cast_to<_closecurly__n>()));
+    }
+
+    case 95:
+    {
+        return node(new Specifier_Qualifier_List_n(reduce[0].cast_to<list_of_one_of_Type_Specifier_or_Type_Qualifier_n>()));
+    }
+
+    case 96:
+    {
+        return node(new Struct_Declarator_List_n(reduce[1].cast_to<Struct_Declarator_n>(), reduce[0].cast_to<list_of__comma__Struct_Declarator_n>()));
+    }
+
+    case 210:
+    {
+    }
+
+    case 193:
+    {
+        util::syntax_ptr<class list_of_one_of_Type_Specifier_or_Type_Qualifier_n_content> content(new list_of_one_of_Type_Specifier_or_Type_Qualifier_n_content(reduce[0].cast_to<one_of_Type_Specifier_or_Type_Qualifier_n>()));
+        util::syntax_ptr<class list_of_one_of_Type_Specifier_or_Type_Qualifier_n> list(new list_of_one_of_Type_Specifier_or_Type_Qualifier_n());
+        const_cast<list_of_one_of_Type_Specifier_or_Type_Qualifier_n*>(list.item())->set_position(lookaheadPosition);
+#if __cplusplus >= 201103L
+        const_cast<list_of_one_of_Type_Specifier_or_Type_Qualifier_n*>(list.item())->add_child(std::move(content));
+#else
+        const_cast<list_of_one_of_Type_Specifier_or_Type_Qualifier_n*>(list.item())->add_child(content);
+#endif
+        return list.cast_to<syntax_node>();
+    }
+
+    case 194:
+    {
+        util::syntax_ptr<class list_of_one_of_Type_Specifier_or_Type_Qualifier_n_content> content(new list_of_one_of_Type_Specifier_or_Type_Qualifier_n_content(reduce[0].cast_to<one_of_Type_Specifier_or_Type_Qualifier_n>()));
+        util::syntax_ptr<class list_of_one_of_Type_Specifier_or_Type_Qualifier_n> list(reduce[1].cast_to<list_of_one_of_Type_Specifier_or_Type_Qualifier_n>());
+#if __cplusplus >= 201103L
+        const_cast<list_of_one_of_Type_Specifier_or_Type_Qualifier_n*>(list.item())->add_child(std::move(content));
+#else
+        const_cast<list_of_one_of_Type_Specifier_or_Type_Qualifier_n*>(list.item())->add_child(content);
+#endif
+        return list.cast_to<syntax_node>();
+    }
+
+    case 97:
+    {
+        return node(new Struct_Declarator_n(reduce[1].cast_to<Declarator_n>(), reduce[0].cast_to<optional__colon__Constant_Expression_n>()));
+    }
+
+    case 98:
+    {
+        return node(new Struct_Declarator_n(reduce[1].cast_to<_colon__n>(), reduce[0].cast_to<Constant_Expression_n>()));
+    }
+
+    case 258:
+    {
+        return node(new list_of__comma__Struct_Declarator_n());
+    }
+
+    case 259:
+    {
+        util::syntax_ptr<class list_of__comma__Struct_Declarator_n_content> content(new list_of__comma__Struct_Declarator_n_content(reduce[1].cast_to<_comma__n>(), reduce[0].cast_to<Struct_Declarator_n>()));
+        util::syntax_ptr<class list_of__comma__Struct_Declarator_n> list(reduce[2].cast_to<list_of__comma__Struct_Declarator_n>());
+#if __cplusplus >= 201103L
+        const_cast<list_of__comma__Struct_Declarator_n*>(list.item())->add_child(std::move(content));
+#else
+        const_cast<list_of__comma__Struct_Declarator_n*>(list.item())->add_child(content);
+#endif
+        return list.cast_to<syntax_node>();
+    }
+
+    case 256:
+    {
+        return node(new optional__colon__Constant_Expression_n(lookaheadPosition));
+    }
+
+    case 257:
+    {
+        return node(new optional__colon__Constant_Expression_n(reduce[1].cast_to<_colon__n>(), reduce[0].cast_to<Constant_Expression_n>()));
+    }
+
+    case 167:
+    {
+        return node(new optional_identifier_n(lookaheadPosition));
+    }
+
+    case 168:
+    {
+        return node(new optional_identifier_n(reduce[0].cast_to<identifier_n>()));
+    }
+
+    case 101:
+    {
+        return node(new Enumerator_List_n(reduce[1].cast_to<Enumerator_n>(), reduce[0].cast_to<list_of__comma__Enumerator_n>()));
+    }
+
+    case 102:
+    {
+        return node(new Enumerator_n(reduce[1].cast_to<identifier_n>(), reduce[0].cast_to<optional__equals__Constant_Expression_n>()));
+    }
+
+    case 207:
+    {
+        return node(new list_of__comma__Enumerator_n());
+    }
+
+    case 208:
+    {
+        util::syntax_ptr<class list_of__comma__Enumerator_n_content> content(new list_of__comma__Enumerator_n_content(reduce[1].cast_to<_comma__n>(), reduce[0].cast_to<Enumerator_n>()));
+        util::syntax_ptr<class list_of__comma__Enumerator_n> list(reduce[2].cast_to<list_of__comma__Enumerator_n>());
+#if __cplusplus >= 201103L
+        const_cast<list_of__comma__Enumerator_n*>(list.item())->add_child(std::move(content));
+#else
+        const_cast<list_of__comma__Enumerator_n*>(list.item())->add_child(content);
+#endif
+        return list.cast_to<syntax_node>();
+    }
+
+    case 205:
+    {
+        return node(new optional__equals__Constant_Expression_n(lookaheadPosition));
+    }
+
+    case 206:
+    {
+        return node(new optional__equals__Constant_Expression_n(reduce[1].cast_to<_equals__n>(), reduce[0].cast_to<Constant_Expression_n>()));
+    }
+
+    case 111:
+    {
+        return node(new Pointer_n(reduce[1].cast_to<_star__n>(), reduce[0].cast_to<list_of_Type_Qualifier_n>()));
+    }
+
+    case 112:
+    {
+        return node(new Pointer_n(reduce[2].cast_to<_star__n>(), reduce[1].cast_to<list_of_Type_Qualifier_n>(), reduce[0].cast_to<Pointer_n>()));
+    }
+
+    case 165:
+    {
+        return node(new optional_Pointer_n(lookaheadPosition));
+    }
+
+    case 166:
+    {
+        return node(new optional_Pointer_n(reduce[0].cast_to<Pointer_n>()));
+    }
+
+    case 106:
+    {
+        return node(new Direct_Declarator_n(reduce[0].cast_to<identifier_n>()));
+    }
+
+    case 107:
+    {
+        return node(new Direct_Declarator_n(reduce[2].cast_to<_openparen__n>(), reduce[1].cast_to<Declarator_n>(), reduce[0].cast_to<_closeparen__n>()));
+    }
+
+    case 108:
+    {
+        return node(new Direct_Declarator_n(reduce[3].cast_to<Direct_Declarator_n>(), reduce[2].cast_to<_opensquare__n>(), reduce[1].cast_to<optional_Constant_Expression_n>(), reduce[0].cast_to<_closesquare__n>()));
+    }
+
+    case 109:
+    {
+        return node(new Direct_Declarator_n(reduce[3].cast_to<Direct_Declarator_n>(), reduce[2].cast_to<_openparen__n>(), reduce[1].cast_to<one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n>(), reduce[0].cast_to<_closeparen__n>()));
+    }
+
+    case 110:
+    {
+        return node(new Direct_Declarator_n(reduce[2].cast_to<Direct_Declarator_n>(), reduce[1].cast_to<_openparen__n>(), reduce[0].cast_to<_closeparen__n>()));
+    }
+
+    case 197:
+    {
+        return node(new optional_Constant_Expression_n(lookaheadPosition));
+    }
+
+    case 198:
+    {
+        return node(new optional_Constant_Expression_n(reduce[0].cast_to<Constant_Expression_n>()));
+    }
+
+    case 113:
+    {
+        return node(new Parameter_Type_List_n(reduce[2].cast_to<Parameter_Declarator_n>(), reduce[1].cast_to<list_of__comma__Parameter_Declarator_n>(), reduce[0].cast_to<optional__comma___dot__dot__dot__n>()));
+    }
+
+    case 209:
+    {
+    }
+
+    case 115:
+    {
+        return node(new Identifier_List_n(reduce[1].cast_to<identifier_n>(), reduce[0].cast_to<list_of__comma__identifier_n>()));
+    }
+
+    case 195:
+    {
+        return node(new one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n(reduce[0].cast_to<Parameter_Type_List_n>()));
+    }
+
+    case 196:
+    {
+        return node(new one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n(reduce[0].cast_to<Identifier_List_n>()));
+    }
+
+    case 170:
+    {
+        return node(new list_of_Type_Qualifier_n());
+    }
+
+    case 171:
+    {
+        util::syntax_ptr<class list_of_Type_Qualifier_n_content> content(new list_of_Type_Qualifier_n_content(reduce[0].cast_to<Type_Qualifier_n>()));
+        util::syntax_ptr<class list_of_Type_Qualifier_n> list(reduce[1].cast_to<list_of_Type_Qualifier_n>());
+#if __cplusplus >= 201103L
+        const_cast<list_of_Type_Qualifier_n*>(list.item())->add_child(std::move(content));
+#else
+        const_cast<list_of_Type_Qualifier_n*>(list.item())->add_child(content);
+#endif
+        return list.cast_to<syntax_node>();
+    }
+
+    case 114:
+    {
+        return node(new Parameter_Declarator_n(reduce[1].cast_to<Declaration_Specifiers_n>(), reduce[0].cast_to<optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n>()));
+    }
+
+    case 250:
+    {
+        return node(new list_of__comma__Parameter_Declarator_n());
+    }
+
+    case 251:
+    {
+        util::syntax_ptr<class list_of__comma__Parameter_Declarator_n_content> content(new list_of__comma__Parameter_Declarator_n_content(reduce[1].cast_to<_comma__n>(), reduce[0].cast_to<Parameter_Declarator_n>()));
+        util::syntax_ptr<class list_of__comma__Parameter_Declarator_n> list(reduce[2].cast_to<list_of__comma__Parameter_Declarator_n>());
+#if __cplusplus >= 201103L
+        const_cast<list_of__comma__Parameter_Declarator_n*>(list.item())->add_child(std::move(content));
+#else
+        const_cast<list_of__comma__Parameter_Declarator_n*>(list.item())->add_child(content);
+#endif
+        return list.cast_to<syntax_node>();
+    }
+
+    case 267:
+    {
+        return node(new optional__comma___dot__dot__dot__n(lookaheadPosition));
+    }
+
+    case 268:
+    {
+        return node(new optional__comma___dot__dot__dot__n(reduce[1].cast_to<_comma__n>(), reduce[0].cast_to<_dot__dot__dot__n>()));
+    }
+
+    case 277:
+    {
+        return node(new one_of__comma__or__closeparen__n(reduce[0].cast_to<_comma__n>()));
+    }
+
+    case 278:
+    {
+        return node(new one_of__comma__or__closeparen__n(reduce[0].cast_to<_closeparen__n>()));
+    }
+
+    case 260:
+    {
+    }
+
+    case 248:
+    {
+        return node(new one_of_unknown_item_Declarator_or_Abstract_Declarator_n(reduce[0].cast_to<Declarator_n>()));
+    }
+
+    case 249:
+    {
+        return node(new one_of_unknown_item_Declarator_or_Abstract_Declarator_n(reduce[0].cast_to<Abstract_Declarator_n>()));
+    }
+
+    case 246:
+    {
+        return node(new optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n(lookaheadPosition));
+    }
+
+    case 247:
+    {
+        return node(new optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n(reduce[0].cast_to<one_of_unknown_item_Declarator_or_Abstract_Declarator_n>()));
+    }
+
+    case 211:
+    {
+        return node(new list_of__comma__identifier_n());
+    }
+
+    case 212:
+    {
+        util::syntax_ptr<class list_of__comma__identifier_n_content> content(new list_of__comma__identifier_n_content(reduce[1].cast_to<_comma__n>(), reduce[0].cast_to<identifier_n>()));
+        util::syntax_ptr<class list_of__comma__identifier_n> list(reduce[2].cast_to<list_of__comma__identifier_n>());
+#if __cplusplus >= 201103L
+        const_cast<list_of__comma__identifier_n*>(list.item())->add_child(std::move(content));
+#else
+        const_cast<list_of__comma__identifier_n*>(list.item())->add_child(content);
+#endif
+        return list.cast_to<syntax_node>();
+    }
+
+    case 119:
+    {
+        return node(new Direct_Abstract_Declarator_n(reduce[2].cast_to<_openparen__n>(), reduce[1].cast_to<optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n>(), reduce[0].cast_to<_closeparen__n>()));
+    }
+
+    case 120:
+    {
+        return node(new Direct_Abstract_Declarator_n(reduce[2].cast_to<_opensquare__n>(), reduce[1].cast_to<optional_Constant_Expression_n>(), reduce[0].cast_to<_closesquare__n>()));
+    }
+
+    case 121:
+    {
+        return node(new Direct_Abstract_Declarator_n(reduce[3].cast_to<Direct_Abstract_Declarator_n>(), reduce[2].cast_to<_opensquare__n>(), reduce[1].cast_to<optional_Constant_Expression_n>(), reduce[0].cast_to<_closesquare__n>()));
+    }
+
+    case 122:
+    {
+        return node(new Direct_Abstract_Declarator_n(reduce[3].cast_to<Direct_Abstract_Declarator_n>(), reduce[2].cast_to<_openparen__n>(), reduce[1].cast_to<optional_Parameter_Type_List_n>(), reduce[0].cast_to<_closeparen__n>()));
+    }
+
+    case 265:
+    {
+        return node(new optional_Direct_Abstract_Declarator_n(lookaheadPosition));
+    }
+
+    case 266:
+    {
+        return node(new optional_Direct_Abstract_Declarator_n(reduce[0].cast_to<Direct_Abstract_Declarator_n>()));
+    }
+
+    case 263:
+    {
+        return node(new one_of_Abstract_Declarator_or_Parameter_Type_List_n(reduce[0].cast_to<Abstract_Declarator_n>()));
+    }
+
+    case 264:
+    {
+        return node(new one_of_Abstract_Declarator_or_Parameter_Type_List_n(reduce[0].cast_to<Parameter_Type_List_n>()));
+    }
+
+    case 261:
+    {
+        return node(new optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n(lookaheadPosition));
+    }
+
+    case 262:
+    {
+        return node(new optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n(reduce[0].cast_to<one_of_Abstract_Declarator_or_Parameter_Type_List_n>()));
+    }
+
+    case 279:
+    {
+        return node(new optional_Parameter_Type_List_n(lookaheadPosition));
+    }
+
+    case 280:
+    {
+        return node(new optional_Parameter_Type_List_n(reduce[0].cast_to<Parameter_Type_List_n>()));
+    }
+
+    case 254:
+    {
+        return node(new list_of__comma__Initializer_n());
+    }
+
+    case 255:
+    {
+        util::syntax_ptr<class list_of__comma__Initializer_n_content> content(new list_of__comma__Initializer_n_content(reduce[1].cast_to<_comma__n>(), reduce[0].cast_to<Initializer_n>()));
+        util::syntax_ptr<class list_of__comma__Initializer_n> list(reduce[2].cast_to<list_of__comma__Initializer_n>());
+#if __cplusplus >= 201103L
+        const_cast<list_of__comma__Initializer_n*>(list.item())->add_child(std::move(content));
+#else
+        const_cast<list_of__comma__Initializer_n*>(list.item())->add_child(content);
+#endif
+        return list.cast_to<syntax_node>();
+    }
+
+    case 275:
+    {
+        return node(new optional__comma__n(lookaheadPosition));
+    }
+
+    case 276:
+    {
+        return node(new optional__comma__n(reduce[0].cast_to<_comma__n>()));
+    }
+
+    case 125:
+    {
+        return node(new Statement_n(reduce[0].cast_to<Labeled_Statement_n>()));
+    }
+
+    case 126:
+    {
+        return node(new Statement_n(reduce[0].cast_to<Compound_Statement_n>()));
+    }
+
+    case 127:
+    {
+        return node(new Statement_n(reduce[0].cast_to<Expression_Statement_n>()));
+    }
+
+    case 128:
+    {
+        return node(new Statement_n(reduce[0].cast_to<Selection_Statement_n>()));
+    }
+
+    case 129:
+    {
+        return node(new Statement_n(reduce[0].cast_to<Iteration_Statement_n>()));
+    }
+
+    case 130:
+    {
+        return node(new Statement_n(reduce[0].cast_to<Jump_Statement_n>()));
+    }
+
+    case 131:
+    {
+        return node(new Labeled_Statement_n(reduce[2].cast_to<identifier_n>(), reduce[1].cast_to<_colon__n>(), reduce[0].cast_to<Statement_n>()));
+    }
+
+    case 132:
+    {
+        return node(new Labeled_Statement_n(reduce[3].cast_to<case_n>(), reduce[2].cast_to<Constant_Expression_n>(), reduce[1].cast_to<_colon__n>(), reduce[0].cast_to<Statement_n>()));
+    }
+
+    case 133:
+    {
+        return node(new Labeled_Statement_n(reduce[2].cast_to<default_n>(), reduce[1].cast_to<_colon__n>(), reduce[0].cast_to<Statement_n>()));
+    }
+
+    case 134:
+    {
+        return node(new Compound_Statement_n(reduce[3].cast_to<_opencurly__n>(), reduce[2].cast_to<optional_Declaration_List_n>(), reduce[1].cast_to<optional_Statement_List_n>(), reduce[0].cast_to<_closecurly__n>()));
+    }
+
+    case 137:
+    {
+        return node(new Expression_Statement_n(reduce[1].cast_to<optional_Expression_n>(), reduce[0].cast_to<_semicolon__n>()));
+    }
+
+    case 138:
+    {
+        return node(new Selection_Statement_n(reduce[4].cast_to<if_n>(), reduce[3].cast_to<_openparen__n>(), reduce[2].cast_to<Expression_n>(), reduce[1].cast_to<_closeparen__n>(), reduce[0].cast_to<Statement_n>()));
+    }
+
+    case 139:
+    {
+        return node(new Selection_Statement_n(reduce[6].cast_to<if_n>(), reduce[5].cast_to<_openparen__n>(), reduce[4].cast_to<Expression_n>(), reduce[3].cast_to<_closeparen__n>(), reduce[2].cast_to<Statement_n>(), reduce[1].cast_to<else_n>(), reduce[0].cast_to<Statement_n>()));
+    }
+
+    case 140:
+    {
+        return node(new Selection_Statement_n(reduce[4].cast_to<switch_n>(), reduce[3].cast_to<_openparen__n>(), reduce[2].cast_to<Expression_n>(), reduce[1].cast_to<_closeparen__n>(), reduce[0].cast_to<Statement_n>()));
+    }
+
+    case 141:
+    {
+        return node(new Iteration_Statement_n(reduce[4].cast_to<while_n>(), reduce[3].cast_to<_openparen__n>(), reduce[2].cast_to<Expression_n>(), reduce[1].cast_to<_closeparen__n>(), reduce[0].cast_to<Statement_n>()));
+    }
+
+    case 142:
+    {
+        return node(new Iteration_Statement_n(reduce[5].cast_to<do_n>(), reduce[4].cast_to<Statement_n>(), reduce[3].cast_to<while_n>(), reduce[2].cast_to<_openparen__n>(), reduce[1].cast_to<Expression_n>(), reduce[0].cast_to<_closeparen__n>()));
+    }
+
+    case 143:
+    {
+        return node(new Iteration_Statement_n(reduce[6].cast_to<for_n>(), reduce[5].cast_to<_openparen__n>(), reduce[4].cast_to<Expression_Statement_n>(), reduce[3].cast_to<Expression_Statement_n>(), reduce[2].cast_to<optional_Expression_n>(), reduce[1].cast_to<_closeparen__n>(), reduce[0].cast_to<Statement_n>()));
+    }
+
+    case 144:
+    {
+        return node(new Jump_Statement_n(reduce[2].cast_to<goto_n>(), reduce[1].cast_to<identifier_n>(), reduce[0].cast_to<_semicolon__n>()));
+    }
+
+    case 145:
+    {
+        return node(new Jump_Statement_n(reduce[1].cast_to<continue_n>(), reduce[0].cast_to<_semicolon__n>()));
+    }
+
+    case 146:
+    {
+        return node(new Jump_Statement_n(reduce[1].cast_to<break_n>(), reduce[0].cast_to<_semicolon__n>()));
+    }
+
+    case 147:
+    {
+        return node(new Jump_Statement_n(reduce[1].cast_to<return_n>(), reduce[0].cast_to<_semicolon__n>()));
+    }
+
+    case 148:
+    {
+        return node(new Jump_Statement_n(reduce[2].cast_to<return_n>(), reduce[1].cast_to<Expression_n>(), reduce[0].cast_to<_semicolon__n>()));
+    }
+
+    case 135:
+    {
+        return node(new Declaration_List_n(reduce[0].cast_to<list_of_unknown_item_Declaration_n>()));
+    }
+
+    case 172:
+    {
+        return node(new optional_Declaration_List_n(lookaheadPosition));
+    }
+
+    case 173:
+    {
+        return node(new optional_Declaration_List_n(reduce[0].cast_to<Declaration_List_n>()));
+    }
+
+    case 136:
+    {
+        return node(new Statement_List_n(reduce[0].cast_to<list_of_Statement_n>()));
+    }
+
+    case 237:
+    {
+        return node(new optional_Statement_List_n(lookaheadPosition));
+    }
+
+    case 238:
+    {
+        return node(new optional_Statement_List_n(reduce[0].cast_to<Statement_List_n>()));
+    }
+
+    case 184:
+    {
+    }
+
+    case 174:
+    {
+        util::syntax_ptr<class list_of_unknown_item_Declaration_n_content> content(new list_of_unknown_item_Declaration_n_content(reduce[0].cast_to<Declaration_n>()));
+        util::syntax_ptr<class list_of_unknown_item_Declaration_n> list(new list_of_unknown_item_Declaration_n());
+        const_cast<list_of_unknown_item_Declaration_n*>(list.item())->set_position(lookaheadPosition);
+#if __cplusplus >= 201103L
+        const_cast<list_of_unknown_item_Declaration_n*>(list.item())->add_child(std::move(content));
+#else
+        const_cast<list_of_unknown_item_Declaration_n*>(list.item())->add_child(content);
+#endif
+        return list.cast_to<syntax_node>();
+    }
+
+    case 175:
+    {
+        util::syntax_ptr<class list_of_unknown_item_Declaration_n_content> content(new list_of_unknown_item_Declaration_n_content(reduce[0].cast_to<Declaration_n>()));
+        util::syntax_ptr<class list_of_unknown_item_Declaration_n> list(reduce[2].cast_to<list_of_unknown_item_Declaration_n>());
+#if __cplusplus >= 201103L
+        const_cast<list_of_unknown_item_Declaration_n*>(list.item())->add_child(std::move(content));
+#else
+        const_cast<list_of_unknown_item_Declaration_n*>(list.item())->add_child(content);
+#endif
+        return list.cast_to<syntax_node>();
+    }
+
+    case 241:
+    {
+        util::syntax_ptr<class list_of_Statement_n_content> content(new list_of_Statement_n_content(reduce[0].cast_to<Statement_n>()));
+        util::syntax_ptr<class list_of_Statement_n> list(new list_of_Statement_n());
+        const_cast<list_of_Statement_n*>(list.item())->set_position(lookaheadPosition);
+#if __cplusplus >= 201103L
+        const_cast<list_of_Statement_n*>(list.item())->add_child(std::move(content));
+#else
+        const_cast<list_of_Statement_n*>(list.item())->add_child(content);
+#endif
+        return list.cast_to<syntax_node>();
+    }
+
+    case 242:
+    {
+        util::syntax_ptr<class list_of_Statement_n_content> content(new list_of_Statement_n_content(reduce[0].cast_to<Statement_n>()));
+        util::syntax_ptr<class list_of_Statement_n> list(reduce[1].cast_to<list_of_Statement_n>());
+#if __cplusplus >= 201103L
+        const_cast<list_of_Statement_n*>(list.item())->add_child(std::move(content));
+#else
+        const_cast<list_of_Statement_n*>(list.item())->add_child(content);
+#endif
+        return list.cast_to<syntax_node>();
+    }
+
+    case 239:
+    {
+        return node(new optional_Expression_n(lookaheadPosition));
+    }
+
+    case 240:
+    {
+        return node(new optional_Expression_n(reduce[0].cast_to<Expression_n>()));
+    }
+
+    case 149:
+    {
+        return node(new Translation_Unit_n(reduce[0].cast_to<list_of_External_Declaration_n>()));
+    }
+
+    case 150:
+    {
+        return node(new External_Declaration_n(reduce[0].cast_to<Function_Definition_n>()));
+    }
+
+    case 151:
+    {
+        return node(new External_Declaration_n(reduce[0].cast_to<Declaration_n>()));
+    }
+
+    case 162:
+    {
+        util::syntax_ptr<class list_of_External_Declaration_n_content> content(new list_of_External_Declaration_n_content(reduce[0].cast_to<External_Declaration_n>()));
+        util::syntax_ptr<class list_of_External_Declaration_n> list(new list_of_External_Declaration_n());
+        const_cast<list_of_External_Declaration_n*>(list.item())->set_position(lookaheadPosition);
+#if __cplusplus >= 201103L
+        const_cast<list_of_External_Declaration_n*>(list.item())->add_child(std::move(content));
+#else
+        const_cast<list_of_External_Declaration_n*>(list.item())->add_child(content);
+#endif
+        return list.cast_to<syntax_node>();
+    }
+
+    case 163:
+    {
+        util::syntax_ptr<class list_of_External_Declaration_n_content> content(new list_of_External_Declaration_n_content(reduce[0].cast_to<External_Declaration_n>()));
+        util::syntax_ptr<class list_of_External_Declaration_n> list(reduce[1].cast_to<list_of_External_Declaration_n>());
+#if __cplusplus >= 201103L
+        const_cast<list_of_External_Declaration_n*>(list.item())->add_child(std::move(content));
+#else
+        const_cast<list_of_External_Declaration_n*>(list.item())->add_child(content);
+#endif
+        return list.cast_to<syntax_node>();
+    }
+
+    case 152:
+    {
+        return node(new Function_Definition_n(reduce[4].cast_to<Declaration_Specifiers_n>(), reduce[2].cast_to<Declarator_n>(), reduce[1].cast_to<optional_Declaration_List_n>(), reduce[0].cast_to<Compound_Statement_n>()));
+    }
+
+    case 153:
+    {
+        return node(new Function_Definition_n(reduce[2].cast_to<Declarator_n>(), reduce[1].cast_to<optional_Declaration_List_n>(), reduce[0].cast_to<Compound_Statement_n>()));
+    }
+
+    case 164:
+    {
+    }
+
+    default:
+        return node();
+    }
+}
+
+Ansi_C::parser_events::value Ansi_C::parser_events::reduce(int nonterminal, int rule, const value_list& values) {
+    switch (nonterminal) {
+    case 1:
+        return reduce_Constant(rule, values);
+
+    case 2:
+        return reduce_Primary_Expression(rule, values);
+
+    case 3:
+        return reduce_Expression(rule, values);
+
+    case 4:
+        return reduce_Postfix_Expression(rule, values);
+
+    case 5:
+        return reduce_Argument_Expression_List(rule, values);
+
+    case 6:
+        return reduce_optional_Argument_Expression_List(rule, values);
+
+    case 7:
+        return reduce_Assignment_Expression(rule, values);
+
+    case 8:
+        return reduce_list_of__comma__Assignment_Expression(rule, values);
+
+    case 9:
+        return reduce_Unary_Expression(rule, values);
+
+    case 10:
+        return reduce_one_of__tilde__or__exclamation_(rule, values);
+
+    case 11:
+        return reduce_one_of___or_one_of__tilde__or__exclamation_(rule, values);
+
+    case 12:
+        return reduce_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation_(rule, values);
+
+    case 13:
+        return reduce_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation_(rule, values);
+
+    case 14:
+        return reduce_one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation_(rule, values);
+
+    case 15:
+        return reduce_Cast_Expression(rule, values);
+
+    case 16:
+        return reduce_Type_Name(rule, values);
+
+    case 18:
+        return reduce_Unambiguous_Cast(rule, values);
+
+    case 19:
+        return reduce_Ambiguous_Cast(rule, values);
+
+    case 20:
+        return reduce_Unambiguous_Cast_Follow(rule, values);
+
+    case 22:
+        return reduce_Simple_Type_Specifier(rule, values);
+
+    case 23:
+        return reduce_Type_Qualifier(rule, values);
+
+    case 24:
+        return reduce_one_of_Simple_Type_Specifier_or_Type_Qualifier(rule, values);
+
+    case 25:
+        return reduce_Abstract_Declarator(rule, values);
+
+    case 26:
+        return reduce_optional_Abstract_Declarator(rule, values);
+
+    case 27:
+        return reduce_one_of_identifier_or_Constant(rule, values);
+
+    case 28:
+        return reduce_one_of_sizeof_or_one_of_identifier_or_Constant(rule, values);
+
+    case 29:
+        return reduce_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant(rule, values);
+
+    case 30:
+        return reduce_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant(rule, values);
+
+    case 31:
+        return reduce_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant(rule, values);
+
+    case 32:
+        return reduce_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant(rule, values);
+
+    case 33:
+        return reduce_one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant(rule, values);
+
+    case 34:
+        return reduce_Ambiguous_Cast_Follow(rule, values);
+
+    case 36:
+        return reduce_one_of___or__openparen__Expression__closeparen_(rule, values);
+
+    case 37:
+        return reduce_one_of__star__or_one_of___or__openparen__Expression__closeparen_(rule, values);
+
+    case 38:
+        return reduce_one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen_(rule, values);
+
+    case 39:
+        return reduce_Multiplicative_Expression(rule, values);
+
+    case 40:
+        return reduce_one_of__slash__or__percent_(rule, values);
+
+    case 41:
+        return reduce_one_of__star__or_one_of__slash__or__percent_(rule, values);
+
+    case 42:
+        return reduce_Additive_Expression(rule, values);
+
+    case 43:
+        return reduce_one_of__plus__or__(rule, values);
+
+    case 44:
+        return reduce_Shift_Expression(rule, values);
+
+    case 45:
+        return reduce_one_of__lessthan__lessthan__or__greaterthan__greaterthan_(rule, values);
+
+    case 46:
+        return reduce_Relational_Expression(rule, values);
+
+    case 47:
+        return reduce_one_of__lessthan__equals__or__greaterthan__equals_(rule, values);
+
+    case 48:
+        return reduce_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals_(rule, values);
+
+    case 49:
+        return reduce_one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals_(rule, values);
+
+    case 50:
+        return reduce_Equality_Expression(rule, values);
+
+    case 51:
+        return reduce_one_of__equals__equals__or__exclamation__equals_(rule, values);
+
+    case 52:
+        return reduce_And_Expression(rule, values);
+
+    case 53:
+        return reduce_Exclusive_Or_Expression(rule, values);
+
+    case 54:
+        return reduce_Inclusive_Or_Expression(rule, values);
+
+    case 55:
+        return reduce_Logical_And_Expression(rule, values);
+
+    case 56:
+        return reduce_Logical_Or_Expression(rule, values);
+
+    case 57:
+        return reduce_Conditional_Expression(rule, values);
+
+    case 58:
+        return reduce_one_of__cicumflex__equals__or__pipe__equals_(rule, values);
+
+    case 59:
+        return reduce_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals_(rule, values);
+
+    case 60:
+        return reduce_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals_(rule, values);
+
+    case 61:
+        return reduce_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals_(rule, values);
+
+    case 62:
+        return reduce_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals_(rule, values);
+
+    case 63:
+        return reduce_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals_(rule, values);
+
+    case 64:
+        return reduce_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals_(rule, values);
+
+    case 65:
+        return reduce_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals_(rule, values);
+
+    case 66:
+        return reduce_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals_(rule, values);
+
+    case 67:
+        return reduce_one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals_(rule, values);
+
+    case 68:
+        return reduce_Constant_Expression(rule, values);
+
+    case 69:
+        return reduce_Declaration(rule, values);
+
+    case 70:
+        return reduce_Declaration_Specifiers(rule, values);
+
+    case 71:
+        return reduce_Init_Declarator(rule, values);
+
+    case 72:
+        return reduce_one_of__semicolon__or__comma_(rule, values);
+
+    case 73:
+        return reduce_one_of__semicolon__or_Init_Declarator_one_of__semicolon__or__comma_(rule, values);
+
+    case 75:
+        return reduce_Init_Declarator_List(rule, values);
+
+    case 76:
+        return reduce_optional_Init_Declarator_List(rule, values);
+
+    case 77:
+        return reduce_Storage_Class_Specifier(rule, values);
+
+    case 78:
+        return reduce_Type_Specifier(rule, values);
+
+    case 79:
+        return reduce_one_of_Type_Specifier_or_Type_Qualifier(rule, values);
+
+    case 80:
+        return reduce_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier(rule, values);
+
+    case 81:
+        return reduce_list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier(rule, values);
+
+    case 82:
+        return reduce_list_of__comma__Init_Declarator(rule, values);
+
+    case 83:
+        return reduce_Declarator(rule, values);
+
+    case 84:
+        return reduce_Initializer(rule, values);
+
+    case 85:
+        return reduce_optional__equals__Initializer(rule, values);
+
+    case 86:
+        return reduce_Struct_Or_Union_Specifier(rule, values);
+
+    case 87:
+        return reduce_Enum_Specifier(rule, values);
+
+    case 88:
+        return reduce_one_of_struct_or_union(rule, values);
+
+    case 89:
+        return reduce_Struct_Declaration(rule, values);
+
+    case 90:
+        return reduce_list_of_Struct_Declaration(rule, values);
+
+    case 91:
+        return reduce_optional__opencurly__list_of_Struct_Declaration__closecurly_(rule, values);
+
+    case 92:
+        return reduce_Specifier_Qualifier_List(rule, values);
+
+    case 93:
+        return reduce_Struct_Declarator_List(rule, values);
+
+    case 95:
+        return reduce_list_of_one_of_Type_Specifier_or_Type_Qualifier(rule, values);
+
+    case 96:
+        return reduce_Struct_Declarator(rule, values);
+
+    case 97:
+        return reduce_list_of__comma__Struct_Declarator(rule, values);
+
+    case 98:
+        return reduce_optional__colon__Constant_Expression(rule, values);
+
+    case 99:
+        return reduce_optional_identifier(rule, values);
+
+    case 100:
+        return reduce_Enumerator_List(rule, values);
+
+    case 101:
+        return reduce_Enumerator(rule, values);
+
+    case 102:
+        return reduce_list_of__comma__Enumerator(rule, values);
+
+    case 103:
+        return reduce_optional__equals__Constant_Expression(rule, values);
+
+    case 104:
+        return reduce_Pointer(rule, values);
+
+    case 105:
+        return reduce_optional_Pointer(rule, values);
+
+    case 106:
+        return reduce_Direct_Declarator(rule, values);
+
+    case 107:
+        return reduce_optional_Constant_Expression(rule, values);
+
+    case 108:
+        return reduce_Parameter_Type_List(rule, values);
+
+    case 110:
+        return reduce_Identifier_List(rule, values);
+
+    case 111:
+        return reduce_one_of_unknown_item_Parameter_Type_List_or_Identifier_List(rule, values);
+
+    case 112:
+        return reduce_list_of_Type_Qualifier(rule, values);
+
+    case 113:
+        return reduce_Parameter_Declarator(rule, values);
+
+    case 114:
+        return reduce_list_of__comma__Parameter_Declarator(rule, values);
+
+    case 115:
+        return reduce_optional__comma___dot__dot__dot_(rule, values);
+
+    case 116:
+        return reduce_one_of__comma__or__closeparen_(rule, values);
+
+    case 118:
+        return reduce_one_of_unknown_item_Declarator_or_Abstract_Declarator(rule, values);
+
+    case 119:
+        return reduce_optional_one_of_unknown_item_Declarator_or_Abstract_Declarator(rule, values);
+
+    case 120:
+        return reduce_list_of__comma__identifier(rule, values);
+
+    case 121:
+        return reduce_Direct_Abstract_Declarator(rule, values);
+
+    case 122:
+        return reduce_optional_Direct_Abstract_Declarator(rule, values);
+
+    case 123:
+        return reduce_one_of_Abstract_Declarator_or_Parameter_Type_List(rule, values);
+
+    case 124:
+        return reduce_optional_one_of_Abstract_Declarator_or_Parameter_Type_List(rule, values);
+
+    case 125:
+        return reduce_optional_Parameter_Type_List(rule, values);
+
+    case 126:
+        return reduce_list_of__comma__Initializer(rule, values);
+
+    case 127:
+        return reduce_optional__comma_(rule, values);
+
+    case 128:
+        return reduce_Statement(rule, values);
+
+    case 129:
+        return reduce_Labeled_Statement(rule, values);
+
+    case 130:
+        return reduce_Compound_Statement(rule, values);
+
+    case 131:
+        return reduce_Expression_Statement(rule, values);
+
+    case 132:
+        return reduce_Selection_Statement(rule, values);
+
+    case 133:
+        return reduce_Iteration_Statement(rule, values);
+
+    case 134:
+        return reduce_Jump_Statement(rule, values);
+
+    case 135:
+        return reduce_Declaration_List(rule, values);
+
+    case 136:
+        return reduce_optional_Declaration_List(rule, values);
+
+    case 137:
+        return reduce_Statement_List(rule, values);
+
+    case 138:
+        return reduce_optional_Statement_List(rule, values);
+
+    case 140:
+        return reduce_list_of_unknown_item_Declaration(rule, values);
+
+    case 141:
+        return reduce_list_of_Statement(rule, values);
+
+    case 142:
+        return reduce_optional_Expression(rule, values);
+
+    case 143:
+        return reduce_Translation_Unit(rule, values);
+
+    case 144:
+        return reduce_External_Declaration(rule, values);
+
+    case 145:
+        return reduce_list_of_External_Declaration(rule, values);
+
+    case 146:
+        return reduce_Function_Definition(rule, values);
+
+    default:
+        return lr::parser_events::reduce(nonterminal, rule, values);
+    }
+}
+
+const Ansi_C::ast_parser_type Ansi_C::ast_parser(&lr_tables, false);
+const Ansi_C::event_parser_type Ansi_C::event_parser(&lr_tables, false);
+const Ansi_C::tape_parser_type Ansi_C::tape_parser(&lr_tables, false);
@@ -0,0 +1,6786 @@
+///
+/// /root/repo/Examples/AnsiC.tp.h
+/// Parser file generated by TameParse at Wed 2026/10/14 18:54:28
+///
+
+#ifndef TAMEPARSE_PARSER__SLASH_ROOT_SLASH_REPO_SLASH_EXAMPLES_SLASH_ANSIC_DOT_TP
+#define TAMEPARSE_PARSER__SLASH_ROOT_SLASH_REPO_SLASH_EXAMPLES_SLASH_ANSIC_DOT_TP
+
+#include "TameParse/Util/syntax_ptr.h"
+#include "TameParse/Dfa/lexer.h"
+#include "TameParse/Lr/parser.h"
+#include "TameParse/Lr/event_parser.h"
+#include "TameParse/Lr/syntax_tape.h"
+#include "TameParse/Lr/parser_tables.h"
+#include "TameParse/Lr/compact_parser_tables.h"
+
+class Ansi_C {
+
+public:
+    class t {
+    public:
+        static const int auto_ = 0;
+        static const int break_ = 1;
+        static const int case_ = 2;
+        static const int char_ = 3;
+        static const int const_ = 4;
+        static const int continue_ = 5;
+        static const int default_ = 6;
+        static const int do_ = 7;
+        static const int double_ = 8;
+        static const int else_ = 9;
+        static const int enum_ = 10;
+        static const int extern_ = 11;
+        static const int float_ = 12;
+        static const int for_ = 13;
+        static const int goto_ = 14;
+        static const int if_ = 15;
+        static const int int_ = 16;
+        static const int long_ = 17;
+        static const int register_ = 18;
+        static const int return_ = 19;
+        static const int short_ = 20;
+        static const int signed_ = 21;
+        static const int sizeof_ = 22;
+        static const int static_ = 23;
+        static const int struct_ = 24;
+        static const int switch_ = 25;
+        static const int typedef_ = 26;
+        static const int union_ = 27;
+        static const int unsigned_ = 28;
+        static const int void_ = 29;
+        static const int volatile_ = 30;
+        static const int while_ = 31;
+        static const int identifier = 32;
+        static const int constant_hex = 33;
+        static const int constant_octal = 34;
+        static const int constant_decimal = 35;
+        static const int constant_character = 36;
+        static const int constant_float = 37;
+        static const int string_literal = 38;
+        static const int comment = 39;
+        static const int whitespace = 40;
+        static const int doc_comment = 41;
+        static const int _openparen_ = 42;
+        static const int _closeparen_ = 43;
+        static const int _opensquare_ = 44;
+        static const int _closesquare_ = 45;
+        static const int _dot_ = 46;
+        static const int __greaterthan_ = 47;
+        static const int _plus__plus_ = 48;
+        static const int __ = 49;
+        static const int _comma_ = 50;
+        static const int _ampersand_ = 51;
+        static const int _star_ = 52;
+        static const int _plus_ = 53;
+        static const int _minus_ = 54;
+        static const int _tilde_ = 55;
+        static const int _exclamation_ = 56;
+        static const int _slash_ = 57;
+        static const int _percent_ = 58;
+        static const int _lessthan__lessthan_ = 59;
+        static const int _greaterthan__greaterthan_ = 60;
+        static const int _lessthan_ = 61;
+        static const int _greaterthan_ = 62;
+        static const int _lessthan__equals_ = 63;
+        static const int _greaterthan__equals_ = 64;
+        static const int _equals__equals_ = 65;
+        static const int _exclamation__equals_ = 66;
+        static const int _cicumflex_ = 67;
+        static const int _pipe_ = 68;
+        static const int _ampersand__ampersand_ = 69;
+        static const int _pipe__pipe_ = 70;
+        static const int _question_ = 71;
+        static const int _colon_ = 72;
+        static const int _equals_ = 73;
+        static const int _star__equals_ = 74;
+        static const int _slash__equals_ = 75;
+        static const int _percent__equals_ = 76;
+        static const int _plus__equals_ = 77;
+        static const int __equals_ = 78;
+        static const int _lessthan__lessthan__equals_ = 79;
+        static const int _greaterthan__greaterthan__equals_ = 80;
+        static const int _ampersand__equals_ = 81;
+        static const int _cicumflex__equals_ = 82;
+        static const int _pipe__equals_ = 83;
+        static const int _semicolon_ = 84;
+        static const int _opencurly_ = 85;
+        static const int _closecurly_ = 86;
+        static const int _dot__dot__dot_ = 87;
+    };
+
+public:
+    class nt {
+    public:
+        static const int Constant = 1;
+        static const int Primary_Expression = 2;
+        static const int Expression = 3;
+        static const int Postfix_Expression = 4;
+        static const int Argument_Expression_List = 5;
+        static const int Assignment_Expression = 7;
+        static const int Unary_Expression = 9;
+        static const int Cast_Expression = 15;
+        static const int Type_Name = 16;
+        static const int Unambiguous_Cast = 18;
+        static const int Ambiguous_Cast = 19;
+        static const int Unambiguous_Cast_Follow = 20;
+        static const int Simple_Type_Specifier = 22;
+        static const int Type_Qualifier = 23;
+        static const int Abstract_Declarator = 25;
+        static const int Ambiguous_Cast_Follow = 34;
+        static const int Multiplicative_Expression = 39;
+        static const int Additive_Expression = 42;
+        static const int Shift_Expression = 44;
+        static const int Relational_Expression = 46;
+        static const int Equality_Expression = 50;
+        static const int And_Expression = 52;
+        static const int Exclusive_Or_Expression = 53;
+        static const int Inclusive_Or_Expression = 54;
+        static const int Logical_And_Expression = 55;
+        static const int Logical_Or_Expression = 56;
+        static const int Conditional_Expression = 57;
+        static const int Constant_Expression = 68;
+        static const int Declaration = 69;
+        static const int Declaration_Specifiers = 70;
+        static const int Init_Declarator = 71;
+        static const int Init_Declarator_List = 75;
+        static const int Storage_Class_Specifier = 77;
+        static const int Type_Specifier = 78;
+        static const int Declarator = 83;
+        static const int Initializer = 84;
+        static const int Struct_Or_Union_Specifier = 86;
+        static const int Enum_Specifier = 87;
+        static const int Struct_Declaration = 89;
+        static const int Specifier_Qualifier_List = 92;
+        static const int Struct_Declarator_List = 93;
+        static const int Struct_Declarator = 96;
+        static const int Enumerator_List = 100;
+        static const int Enumerator = 101;
+        static const int Pointer = 104;
+        static const int Direct_Declarator = 106;
+        static const int Parameter_Type_List = 108;
+        static const int Identifier_List = 110;
+        static const int Parameter_Declarator = 113;
+        static const int Direct_Abstract_Declarator = 121;
+        static const int Statement = 128;
+        static const int Labeled_Statement = 129;
+        static const int Compound_Statement = 130;
+        static const int Expression_Statement = 131;
+        static const int Selection_Statement = 132;
+        static const int Iteration_Statement = 133;
+        static const int Jump_Statement = 134;
+        static const int Declaration_List = 135;
+        static const int Statement_List = 137;
+        static const int Translation_Unit = 143;
+        static const int External_Declaration = 144;
+        static const int Function_Definition = 146;
+    };
+
+public:
+    static const int number_of_symbol_sets = 64;
+
+        static const int number_of_lexer_states = 219;
+
+public:
+    static const dfa::lexer lexer;
+
+    static size_t tokenize(dfa::token_cursor& cursor, dfa::token* tokens, size_t maxTokens);
+    static void tokenize_all(const int* begin, const int* end, std::vector<dfa::token>& tokens);
+
+public:
+    static const lr::small_parser_tables lr_tables;
+
+    static const bool skipped_symbols[];
+    static const int count_skipped_symbols;
+
+    inline static dfa::lexeme_stream* skip_ignored(dfa::lexeme_stream* stream) {
+        stream->skip_symbols(skipped_symbols, count_skipped_symbols);
+        return stream;
+    }
+
+public:
+    class syntax_node {
+    public:
+        virtual ~syntax_node();
+        virtual std::wstring to_string();
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+    };
+
+    class terminal : public syntax_node {
+    private:
+        dfa::lexeme_container m_Lexeme;
+
+    public:
+        terminal(const dfa::lexeme_container& lexeme);
+
+        inline const dfa::lexeme_container& get_lexeme() const { return m_Lexeme; }
+
+        template<class symbol_type> inline std::basic_string<symbol_type> content() const { return m_Lexeme->content<symbol_type>(); }
+
+        virtual dfa::position pos() const;
+
+        virtual dfa::position final_pos() const;
+    };
+
+    class auto_n;
+
+    class break_n;
+
+    class case_n;
+
+    class char_n;
+
+    class const_n;
+
+    class continue_n;
+
+    class default_n;
+
+    class do_n;
+
+    class double_n;
+
+    class else_n;
+
+    class enum_n;
+
+    class extern_n;
+
+    class float_n;
+
+    class for_n;
+
+    class goto_n;
+
+    class if_n;
+
+    class int_n;
+
+    class long_n;
+
+    class register_n;
+
+    class return_n;
+
+    class short_n;
+
+    class signed_n;
+
+    class sizeof_n;
+
+    class static_n;
+
+    class struct_n;
+
+    class switch_n;
+
+    class typedef_n;
+
+    class union_n;
+
+    class unsigned_n;
+
+    class void_n;
+
+    class volatile_n;
+
+    class while_n;
+
+    class identifier_n;
+
+    class constant_hex_n;
+
+    class constant_octal_n;
+
+    class constant_decimal_n;
+
+    class constant_character_n;
+
+    class constant_float_n;
+
+    class string_literal_n;
+
+    class comment_n;
+
+    class whitespace_n;
+
+    class doc_comment_n;
+
+    class _openparen__n;
+
+    class _closeparen__n;
+
+    class _opensquare__n;
+
+    class _closesquare__n;
+
+    class _dot__n;
+
+    class __greaterthan__n;
+
+    class _plus__plus__n;
+
+    class ___n;
+
+    class _comma__n;
+
+    class _ampersand__n;
+
+    class _star__n;
+
+    class _plus__n;
+
+    class _minus__n;
+
+    class _tilde__n;
+
+    class _exclamation__n;
+
+    class _slash__n;
+
+    class _percent__n;
+
+    class _lessthan__lessthan__n;
+
+    class _greaterthan__greaterthan__n;
+
+    class _lessthan__n;
+
+    class _greaterthan__n;
+
+    class _lessthan__equals__n;
+
+    class _greaterthan__equals__n;
+
+    class _equals__equals__n;
+
+    class _exclamation__equals__n;
+
+    class _cicumflex__n;
+
+    class _pipe__n;
+
+    class _ampersand__ampersand__n;
+
+    class _pipe__pipe__n;
+
+    class _question__n;
+
+    class _colon__n;
+
+    class _equals__n;
+
+    class _star__equals__n;
+
+    class _slash__equals__n;
+
+    class _percent__equals__n;
+
+    class _plus__equals__n;
+
+    class __equals__n;
+
+    class _lessthan__lessthan__equals__n;
+
+    class _greaterthan__greaterthan__equals__n;
+
+    class _ampersand__equals__n;
+
+    class _cicumflex__equals__n;
+
+    class _pipe__equals__n;
+
+    class _semicolon__n;
+
+    class _opencurly__n;
+
+    class _closecurly__n;
+
+    class _dot__dot__dot__n;
+
+    class epsilon_n;
+
+    class Constant_n;
+
+    class Primary_Expression_n;
+
+    class Expression_n;
+
+    class Postfix_Expression_n;
+
+    class Argument_Expression_List_n;
+
+    class optional_Argument_Expression_List_n;
+
+    class Assignment_Expression_n;
+
+    class list_of__comma__Assignment_Expression_n;
+
+    class Unary_Expression_n;
+
+    class one_of__tilde__or__exclamation__n;
+
+    class one_of___or_one_of__tilde__or__exclamation__n;
+
+    class one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n;
+
+    class one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n;
+
+    class one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n;
+
+    class Cast_Expression_n;
+
+    class Type_Name_n;
+
+    class Unambiguous_Cast_n;
+
+    class Ambiguous_Cast_n;
+
+    class Unambiguous_Cast_Follow_n;
+
+    class Simple_Type_Specifier_n;
+
+    class Type_Qualifier_n;
+
+    class one_of_Simple_Type_Specifier_or_Type_Qualifier_n;
+
+    class Abstract_Declarator_n;
+
+    class optional_Abstract_Declarator_n;
+
+    class one_of_identifier_or_Constant_n;
+
+    class one_of_sizeof_or_one_of_identifier_or_Constant_n;
+
+    class one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n;
+
+    class one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n;
+
+    class one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n;
+
+    class one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n;
+
+    class one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n;
+
+    class Ambiguous_Cast_Follow_n;
+
+    class one_of___or__openparen__Expression__closeparen__n;
+
+    class one_of__star__or_one_of___or__openparen__Expression__closeparen__n;
+
+    class one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n;
+
+    class Multiplicative_Expression_n;
+
+    class one_of__slash__or__percent__n;
+
+    class one_of__star__or_one_of__slash__or__percent__n;
+
+    class Additive_Expression_n;
+
+    class one_of__plus__or___n;
+
+    class Shift_Expression_n;
+
+    class one_of__lessthan__lessthan__or__greaterthan__greaterthan__n;
+
+    class Relational_Expression_n;
+
+    class one_of__lessthan__equals__or__greaterthan__equals__n;
+
+    class one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n;
+
+    class one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n;
+
+    class Equality_Expression_n;
+
+    class one_of__equals__equals__or__exclamation__equals__n;
+
+    class And_Expression_n;
+
+    class Exclusive_Or_Expression_n;
+
+    class Inclusive_Or_Expression_n;
+
+    class Logical_And_Expression_n;
+
+    class Logical_Or_Expression_n;
+
+    class Conditional_Expression_n;
+
+    class one_of__cicumflex__equals__or__pipe__equals__n;
+
+    class one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n;
+
+    class one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n;
+
+    class one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n;
+
+    class one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n;
+
+    class one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n;
+
+    class one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n;
+
+    class one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n;
+
+    class one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n;
+
+    class one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n;
+
+    class Constant_Expression_n;
+
+    class Declaration_n;
+
+    class Declaration_Specifiers_n;
+
+    class Init_Declarator_n;
+
+    class one_of__semicolon__or__comma__n;
+
+    class one_of__semicolon__or_Init_Declarator_one_of__semicolon__or__comma__n;
+
+    class Init_Declarator_List_n;
+
+    class optional_Init_Declarator_List_n;
+
+    class Storage_Class_Specifier_n;
+
+    class Type_Specifier_n;
+
+    class one_of_Type_Specifier_or_Type_Qualifier_n;
+
+    class one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n;
+
+    class list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n;
+
+    class list_of__comma__Init_Declarator_n;
+
+    class Declarator_n;
+
+    class Initializer_n;
+
+    class optional__equals__Initializer_n;
+
+    class Struct_Or_Union_Specifier_n;
+
+    class Enum_Specifier_n;
+
+    class one_of_struct_or_union_n;
+
+    class Struct_Declaration_n;
+
+    class list_of_Struct_Declaration_n;
+
+    class optional__opencurly__list_of_Struct_Declaration__closecurly__n;
+
+    class Specifier_Qualifier_List_n;
+
+    class Struct_Declarator_List_n;
+
+    class list_of_one_of_Type_Specifier_or_Type_Qualifier_n;
+
+    class Struct_Declarator_n;
+
+    class list_of__comma__Struct_Declarator_n;
+
+    class optional__colon__Constant_Expression_n;
+
+    class optional_identifier_n;
+
+    class Enumerator_List_n;
+
+    class Enumerator_n;
+
+    class list_of__comma__Enumerator_n;
+
+    class optional__equals__Constant_Expression_n;
+
+    class Pointer_n;
+
+    class optional_Pointer_n;
+
+    class Direct_Declarator_n;
+
+    class optional_Constant_Expression_n;
+
+    class Parameter_Type_List_n;
+
+    class Identifier_List_n;
+
+    class one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n;
+
+    class list_of_Type_Qualifier_n;
+
+    class Parameter_Declarator_n;
+
+    class list_of__comma__Parameter_Declarator_n;
+
+    class optional__comma___dot__dot__dot__n;
+
+    class one_of__comma__or__closeparen__n;
+
+    class one_of_unknown_item_Declarator_or_Abstract_Declarator_n;
+
+    class optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n;
+
+    class list_of__comma__identifier_n;
+
+    class Direct_Abstract_Declarator_n;
+
+    class optional_Direct_Abstract_Declarator_n;
+
+    class one_of_Abstract_Declarator_or_Parameter_Type_List_n;
+
+    class optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n;
+
+    class optional_Parameter_Type_List_n;
+
+    class list_of__comma__Initializer_n;
+
+    class optional__comma__n;
+
+    class Statement_n;
+
+    class Labeled_Statement_n;
+
+    class Compound_Statement_n;
+
+    class Expression_Statement_n;
+
+    class Selection_Statement_n;
+
+    class Iteration_Statement_n;
+
+    class Jump_Statement_n;
+
+    class Declaration_List_n;
+
+    class optional_Declaration_List_n;
+
+    class Statement_List_n;
+
+    class optional_Statement_List_n;
+
+    class list_of_unknown_item_Declaration_n;
+
+    class list_of_Statement_n;
+
+    class optional_Expression_n;
+
+    class Translation_Unit_n;
+
+    class External_Declaration_n;
+
+    class list_of_External_Declaration_n;
+
+    class Function_Definition_n;
+
+    class end_of_input_n;
+
+    class end_of_guard_n;
+
+    // auto
+    class auto_n : public terminal {
+    public:
+        auto_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // break
+    class break_n : public terminal {
+    public:
+        break_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // case
+    class case_n : public terminal {
+    public:
+        case_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // char
+    class char_n : public terminal {
+    public:
+        char_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // const
+    class const_n : public terminal {
+    public:
+        const_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // continue
+    class continue_n : public terminal {
+    public:
+        continue_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // default
+    class default_n : public terminal {
+    public:
+        default_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // do
+    class do_n : public terminal {
+    public:
+        do_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // double
+    class double_n : public terminal {
+    public:
+        double_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // else
+    class else_n : public terminal {
+    public:
+        else_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // enum
+    class enum_n : public terminal {
+    public:
+        enum_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // extern
+    class extern_n : public terminal {
+    public:
+        extern_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // float
+    class float_n : public terminal {
+    public:
+        float_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // for
+    class for_n : public terminal {
+    public:
+        for_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // goto
+    class goto_n : public terminal {
+    public:
+        goto_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // if
+    class if_n : public terminal {
+    public:
+        if_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // int
+    class int_n : public terminal {
+    public:
+        int_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // long
+    class long_n : public terminal {
+    public:
+        long_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // register
+    class register_n : public terminal {
+    public:
+        register_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // return
+    class return_n : public terminal {
+    public:
+        return_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // short
+    class short_n : public terminal {
+    public:
+        short_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // signed
+    class signed_n : public terminal {
+    public:
+        signed_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // sizeof
+    class sizeof_n : public terminal {
+    public:
+        sizeof_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // static
+    class static_n : public terminal {
+    public:
+        static_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // struct
+    class struct_n : public terminal {
+    public:
+        struct_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // switch
+    class switch_n : public terminal {
+    public:
+        switch_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // typedef
+    class typedef_n : public terminal {
+    public:
+        typedef_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // union
+    class union_n : public terminal {
+    public:
+        union_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // unsigned
+    class unsigned_n : public terminal {
+    public:
+        unsigned_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // void
+    class void_n : public terminal {
+    public:
+        void_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // volatile
+    class volatile_n : public terminal {
+    public:
+        volatile_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // while
+    class while_n : public terminal {
+    public:
+        while_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // identifier
+    class identifier_n : public terminal {
+    public:
+        identifier_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // constant_hex
+    class constant_hex_n : public terminal {
+    public:
+        constant_hex_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // constant_octal
+    class constant_octal_n : public terminal {
+    public:
+        constant_octal_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // constant_decimal
+    class constant_decimal_n : public terminal {
+    public:
+        constant_decimal_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // constant_character
+    class constant_character_n : public terminal {
+    public:
+        constant_character_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // constant_float
+    class constant_float_n : public terminal {
+    public:
+        constant_float_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // string_literal
+    class string_literal_n : public terminal {
+    public:
+        string_literal_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // comment
+    class comment_n : public terminal {
+    public:
+        comment_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // whitespace
+    class whitespace_n : public terminal {
+    public:
+        whitespace_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // doc_comment
+    class doc_comment_n : public terminal {
+    public:
+        doc_comment_n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _openparen_
+    class _openparen__n : public terminal {
+    public:
+        _openparen__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _closeparen_
+    class _closeparen__n : public terminal {
+    public:
+        _closeparen__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _opensquare_
+    class _opensquare__n : public terminal {
+    public:
+        _opensquare__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _closesquare_
+    class _closesquare__n : public terminal {
+    public:
+        _closesquare__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _dot_
+    class _dot__n : public terminal {
+    public:
+        _dot__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // __greaterthan_
+    class __greaterthan__n : public terminal {
+    public:
+        __greaterthan__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _plus__plus_
+    class _plus__plus__n : public terminal {
+    public:
+        _plus__plus__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // __
+    class ___n : public terminal {
+    public:
+        ___n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _comma_
+    class _comma__n : public terminal {
+    public:
+        _comma__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _ampersand_
+    class _ampersand__n : public terminal {
+    public:
+        _ampersand__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _star_
+    class _star__n : public terminal {
+    public:
+        _star__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _plus_
+    class _plus__n : public terminal {
+    public:
+        _plus__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _minus_
+    class _minus__n : public terminal {
+    public:
+        _minus__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _tilde_
+    class _tilde__n : public terminal {
+    public:
+        _tilde__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _exclamation_
+    class _exclamation__n : public terminal {
+    public:
+        _exclamation__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _slash_
+    class _slash__n : public terminal {
+    public:
+        _slash__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _percent_
+    class _percent__n : public terminal {
+    public:
+        _percent__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _lessthan__lessthan_
+    class _lessthan__lessthan__n : public terminal {
+    public:
+        _lessthan__lessthan__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _greaterthan__greaterthan_
+    class _greaterthan__greaterthan__n : public terminal {
+    public:
+        _greaterthan__greaterthan__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _lessthan_
+    class _lessthan__n : public terminal {
+    public:
+        _lessthan__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _greaterthan_
+    class _greaterthan__n : public terminal {
+    public:
+        _greaterthan__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _lessthan__equals_
+    class _lessthan__equals__n : public terminal {
+    public:
+        _lessthan__equals__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _greaterthan__equals_
+    class _greaterthan__equals__n : public terminal {
+    public:
+        _greaterthan__equals__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _equals__equals_
+    class _equals__equals__n : public terminal {
+    public:
+        _equals__equals__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _exclamation__equals_
+    class _exclamation__equals__n : public terminal {
+    public:
+        _exclamation__equals__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _cicumflex_
+    class _cicumflex__n : public terminal {
+    public:
+        _cicumflex__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _pipe_
+    class _pipe__n : public terminal {
+    public:
+        _pipe__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _ampersand__ampersand_
+    class _ampersand__ampersand__n : public terminal {
+    public:
+        _ampersand__ampersand__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _pipe__pipe_
+    class _pipe__pipe__n : public terminal {
+    public:
+        _pipe__pipe__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _question_
+    class _question__n : public terminal {
+    public:
+        _question__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _colon_
+    class _colon__n : public terminal {
+    public:
+        _colon__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _equals_
+    class _equals__n : public terminal {
+    public:
+        _equals__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _star__equals_
+    class _star__equals__n : public terminal {
+    public:
+        _star__equals__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _slash__equals_
+    class _slash__equals__n : public terminal {
+    public:
+        _slash__equals__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _percent__equals_
+    class _percent__equals__n : public terminal {
+    public:
+        _percent__equals__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _plus__equals_
+    class _plus__equals__n : public terminal {
+    public:
+        _plus__equals__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // __equals_
+    class __equals__n : public terminal {
+    public:
+        __equals__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _lessthan__lessthan__equals_
+    class _lessthan__lessthan__equals__n : public terminal {
+    public:
+        _lessthan__lessthan__equals__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _greaterthan__greaterthan__equals_
+    class _greaterthan__greaterthan__equals__n : public terminal {
+    public:
+        _greaterthan__greaterthan__equals__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _ampersand__equals_
+    class _ampersand__equals__n : public terminal {
+    public:
+        _ampersand__equals__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _cicumflex__equals_
+    class _cicumflex__equals__n : public terminal {
+    public:
+        _cicumflex__equals__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _pipe__equals_
+    class _pipe__equals__n : public terminal {
+    public:
+        _pipe__equals__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _semicolon_
+    class _semicolon__n : public terminal {
+    public:
+        _semicolon__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _opencurly_
+    class _opencurly__n : public terminal {
+    public:
+        _opencurly__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _closecurly_
+    class _closecurly__n : public terminal {
+    public:
+        _closecurly__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    // _dot__dot__dot_
+    class _dot__dot__dot__n : public terminal {
+    public:
+        _dot__dot__dot__n(const dfa::lexeme_container& lex) : terminal(lex) { }
+    };
+
+    class epsilon_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 154
+        const util::syntax_ptr<Translation_Unit_n> Translation_Unit;
+
+    public:
+        epsilon_n(const util::syntax_ptr<class Translation_Unit_n>& Translation_Unit_0);
+#if __cplusplus >= 201103L
+        epsilon_n(util::syntax_ptr<class Translation_Unit_n>&& Translation_Unit_0);
+#endif
+
+    public:
+        virtual ~epsilon_n();
+    };
+
+    class Constant_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 0
+        const util::syntax_ptr<constant_hex_n> constant_hex;
+
+    public:
+        Constant_n(const util::syntax_ptr<class constant_hex_n>& constant_hex_0);
+#if __cplusplus >= 201103L
+        Constant_n(util::syntax_ptr<class constant_hex_n>&& constant_hex_0);
+#endif
+
+    public:
+        // Rule 1
+        const util::syntax_ptr<constant_octal_n> constant_octal;
+
+    public:
+        Constant_n(const util::syntax_ptr<class constant_octal_n>& constant_octal_0);
+#if __cplusplus >= 201103L
+        Constant_n(util::syntax_ptr<class constant_octal_n>&& constant_octal_0);
+#endif
+
+    public:
+        // Rule 2
+        const util::syntax_ptr<constant_decimal_n> constant_decimal;
+
+    public:
+        Constant_n(const util::syntax_ptr<class constant_decimal_n>& constant_decimal_0);
+#if __cplusplus >= 201103L
+        Constant_n(util::syntax_ptr<class constant_decimal_n>&& constant_decimal_0);
+#endif
+
+    public:
+        // Rule 3
+        const util::syntax_ptr<constant_float_n> constant_float;
+
+    public:
+        Constant_n(const util::syntax_ptr<class constant_float_n>& constant_float_0);
+#if __cplusplus >= 201103L
+        Constant_n(util::syntax_ptr<class constant_float_n>&& constant_float_0);
+#endif
+
+    public:
+        // Rule 4
+        const util::syntax_ptr<constant_character_n> constant_character;
+
+    public:
+        Constant_n(const util::syntax_ptr<class constant_character_n>& constant_character_0);
+#if __cplusplus >= 201103L
+        Constant_n(util::syntax_ptr<class constant_character_n>&& constant_character_0);
+#endif
+
+    public:
+        // Rule 5
+        const util::syntax_ptr<string_literal_n> string_literal;
+
+    public:
+        Constant_n(const util::syntax_ptr<class string_literal_n>& string_literal_0);
+#if __cplusplus >= 201103L
+        Constant_n(util::syntax_ptr<class string_literal_n>&& string_literal_0);
+#endif
+
+    public:
+        virtual ~Constant_n();
+    };
+
+    class Primary_Expression_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 6
+        const util::syntax_ptr<identifier_n> identifier;
+
+    public:
+        Primary_Expression_n(const util::syntax_ptr<class identifier_n>& identifier_0);
+#if __cplusplus >= 201103L
+        Primary_Expression_n(util::syntax_ptr<class identifier_n>&& identifier_0);
+#endif
+
+    public:
+        // Rule 7
+        const util::syntax_ptr<Constant_n> Constant;
+
+    public:
+        Primary_Expression_n(const util::syntax_ptr<class Constant_n>& Constant_0);
+#if __cplusplus >= 201103L
+        Primary_Expression_n(util::syntax_ptr<class Constant_n>&& Constant_0);
+#endif
+
+    public:
+        // Rule 8
+        const util::syntax_ptr<_openparen__n> _openparen_;
+        const util::syntax_ptr<Expression_n> Expression;
+        const util::syntax_ptr<_closeparen__n> _closeparen_;
+
+    public:
+        Primary_Expression_n(const util::syntax_ptr<class _openparen__n>& _openparen__0, const util::syntax_ptr<class Expression_n>& Expression_1, const util::syntax_ptr<class _closeparen__n>& _closeparen__2);
+#if __cplusplus >= 201103L
+        Primary_Expression_n(util::syntax_ptr<class _openparen__n>&& _openparen__0, util::syntax_ptr<class Expression_n>&& Expression_1, util::syntax_ptr<class _closeparen__n>&& _closeparen__2);
+#endif
+
+    public:
+        virtual ~Primary_Expression_n();
+    };
+
+    class Expression_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 57
+        const util::syntax_ptr<Assignment_Expression_n> Assignment_Expression;
+
+    public:
+        Expression_n(const util::syntax_ptr<class Assignment_Expression_n>& Assignment_Expression_0);
+#if __cplusplus >= 201103L
+        Expression_n(util::syntax_ptr<class Assignment_Expression_n>&& Assignment_Expression_0);
+#endif
+
+    public:
+        // Rule 58
+        const util::syntax_ptr<Expression_n> Expression;
+        const util::syntax_ptr<_comma__n> _comma_;
+        // Assignment_Expression declared in another rule
+
+    public:
+        Expression_n(const util::syntax_ptr<class Expression_n>& Expression_0, const util::syntax_ptr<class _comma__n>& _comma__1, const util::syntax_ptr<class Assignment_Expression_n>& Assignment_Expression_2);
+#if __cplusplus >= 201103L
+        Expression_n(util::syntax_ptr<class Expression_n>&& Expression_0, util::syntax_ptr<class _comma__n>&& _comma__1, util::syntax_ptr<class Assignment_Expression_n>&& Assignment_Expression_2);
+#endif
+
+    public:
+        virtual ~Expression_n();
+    };
+
+    class Postfix_Expression_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 9
+        const util::syntax_ptr<Primary_Expression_n> Primary_Expression;
+
+    public:
+        Postfix_Expression_n(const util::syntax_ptr<class Primary_Expression_n>& Primary_Expression_0);
+#if __cplusplus >= 201103L
+        Postfix_Expression_n(util::syntax_ptr<class Primary_Expression_n>&& Primary_Expression_0);
+#endif
+
+    public:
+        // Rule 10
+        const util::syntax_ptr<Postfix_Expression_n> Postfix_Expression;
+        const util::syntax_ptr<_opensquare__n> _opensquare_;
+        const util::syntax_ptr<Expression_n> Expression;
+        const util::syntax_ptr<_closesquare__n> _closesquare_;
+
+    public:
+        Postfix_Expression_n(const util::syntax_ptr<class Postfix_Expression_n>& Postfix_Expression_0, const util::syntax_ptr<class _opensquare__n>& _opensquare__1, const util::syntax_ptr<class Expression_n>& Expression_2, const util::syntax_ptr<class _closesquare__n>& _closesquare__3);
+#if __cplusplus >= 201103L
+        Postfix_Expression_n(util::syntax_ptr<class Postfix_Expression_n>&& Postfix_Expression_0, util::syntax_ptr<class _opensquare__n>&& _opensquare__1, util::syntax_ptr<class Expression_n>&& Expression_2, util::syntax_ptr<class _closesquare__n>&& _closesquare__3);
+#endif
+
+    public:
+        // Rule 11
+        // Postfix_Expression declared in another rule
+        const util::syntax_ptr<_openparen__n> _openparen_;
+        const util::syntax_ptr<optional_Argument_Expression_List_n> optional_Argument_Expression_List;
+        const util::syntax_ptr<_closeparen__n> _closeparen_;
+
+    public:
+        Postfix_Expression_n(const util::syntax_ptr<class Postfix_Expression_n>& Postfix_Expression_0, const util::syntax_ptr<class _openparen__n>& _openparen__1, const util::syntax_ptr<class optional_Argument_Expression_List_n>& optional_Argument_Expression_List_2, const util::syntax_ptr<class _closeparen__n>& _closeparen__3);
+#if __cplusplus >= 201103L
+        Postfix_Expression_n(util::syntax_ptr<class Postfix_Expression_n>&& Postfix_Expression_0, util::syntax_ptr<class _openparen__n>&& _openparen__1, util::syntax_ptr<class optional_Argument_Expression_List_n>&& optional_Argument_Expression_List_2, util::syntax_ptr<class _closeparen__n>&& _closeparen__3);
+#endif
+
+    public:
+        // Rule 12
+        // Postfix_Expression declared in another rule
+        const util::syntax_ptr<_dot__n> _dot_;
+        const util::syntax_ptr<identifier_n> identifier;
+
+    public:
+        Postfix_Expression_n(const util::syntax_ptr<class Postfix_Expression_n>& Postfix_Expression_0, const util::syntax_ptr<class _dot__n>& _dot__1, const util::syntax_ptr<class identifier_n>& identifier_2);
+#if __cplusplus >= 201103L
+        Postfix_Expression_n(util::syntax_ptr<class Postfix_Expression_n>&& Postfix_Expression_0, util::syntax_ptr<class _dot__n>&& _dot__1, util::syntax_ptr<class identifier_n>&& identifier_2);
+#endif
+
+    public:
+        // Rule 13
+        // Postfix_Expression declared in another rule
+        const util::syntax_ptr<__greaterthan__n> __greaterthan_;
+        // identifier declared in another rule
+
+    public:
+        Postfix_Expression_n(const util::syntax_ptr<class Postfix_Expression_n>& Postfix_Expression_0, const util::syntax_ptr<class __greaterthan__n>& __greaterthan__1, const util::syntax_ptr<class identifier_n>& identifier_2);
+#if __cplusplus >= 201103L
+        Postfix_Expression_n(util::syntax_ptr<class Postfix_Expression_n>&& Postfix_Expression_0, util::syntax_ptr<class __greaterthan__n>&& __greaterthan__1, util::syntax_ptr<class identifier_n>&& identifier_2);
+#endif
+
+    public:
+        // Rule 14
+        // Postfix_Expression declared in another rule
+        const util::syntax_ptr<_plus__plus__n> _plus__plus_;
+
+    public:
+        Postfix_Expression_n(const util::syntax_ptr<class Postfix_Expression_n>& Postfix_Expression_0, const util::syntax_ptr<class _plus__plus__n>& _plus__plus__1);
+#if __cplusplus >= 201103L
+        Postfix_Expression_n(util::syntax_ptr<class Postfix_Expression_n>&& Postfix_Expression_0, util::syntax_ptr<class _plus__plus__n>&& _plus__plus__1);
+#endif
+
+    public:
+        // Rule 15
+        // Postfix_Expression declared in another rule
+        const util::syntax_ptr<___n> __;
+
+    public:
+        Postfix_Expression_n(const util::syntax_ptr<class Postfix_Expression_n>& Postfix_Expression_0, const util::syntax_ptr<class ___n>& ___1);
+#if __cplusplus >= 201103L
+        Postfix_Expression_n(util::syntax_ptr<class Postfix_Expression_n>&& Postfix_Expression_0, util::syntax_ptr<class ___n>&& ___1);
+#endif
+
+    public:
+        virtual ~Postfix_Expression_n();
+    };
+
+    class Argument_Expression_List_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 16
+        const util::syntax_ptr<Assignment_Expression_n> Assignment_Expression;
+        const util::syntax_ptr<list_of__comma__Assignment_Expression_n> list_of__comma__Assignment_Expression;
+
+    public:
+        Argument_Expression_List_n(const util::syntax_ptr<class Assignment_Expression_n>& Assignment_Expression_0, const util::syntax_ptr<class list_of__comma__Assignment_Expression_n>& list_of__comma__Assignment_Expression_1);
+#if __cplusplus >= 201103L
+        Argument_Expression_List_n(util::syntax_ptr<class Assignment_Expression_n>&& Assignment_Expression_0, util::syntax_ptr<class list_of__comma__Assignment_Expression_n>&& list_of__comma__Assignment_Expression_1);
+#endif
+
+    public:
+        virtual ~Argument_Expression_List_n();
+    };
+
+    class optional_Argument_Expression_List_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 252
+        dfa::position m_Position;
+    public:
+        optional_Argument_Expression_List_n(const dfa::position& pos);
+
+    public:
+        // Rule 253
+        const util::syntax_ptr<Argument_Expression_List_n> Argument_Expression_List;
+
+    public:
+        optional_Argument_Expression_List_n(const util::syntax_ptr<class Argument_Expression_List_n>& Argument_Expression_List_0);
+#if __cplusplus >= 201103L
+        optional_Argument_Expression_List_n(util::syntax_ptr<class Argument_Expression_List_n>&& Argument_Expression_List_0);
+#endif
+
+    public:
+        virtual ~optional_Argument_Expression_List_n();
+    };
+
+    class Assignment_Expression_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 55
+        const util::syntax_ptr<Conditional_Expression_n> Conditional_Expression;
+
+    public:
+        Assignment_Expression_n(const util::syntax_ptr<class Conditional_Expression_n>& Conditional_Expression_0);
+#if __cplusplus >= 201103L
+        Assignment_Expression_n(util::syntax_ptr<class Conditional_Expression_n>&& Conditional_Expression_0);
+#endif
+
+    public:
+        // Rule 56
+        const util::syntax_ptr<Unary_Expression_n> Unary_Expression;
+        const util::syntax_ptr<one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n> one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals_;
+        const util::syntax_ptr<Assignment_Expression_n> Assignment_Expression;
+
+    public:
+        Assignment_Expression_n(const util::syntax_ptr<class Unary_Expression_n>& Unary_Expression_0, const util::syntax_ptr<class one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n>& one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__1, const util::syntax_ptr<class Assignment_Expression_n>& Assignment_Expression_2);
+#if __cplusplus >= 201103L
+        Assignment_Expression_n(util::syntax_ptr<class Unary_Expression_n>&& Unary_Expression_0, util::syntax_ptr<class one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n>&& one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__1, util::syntax_ptr<class Assignment_Expression_n>&& Assignment_Expression_2);
+#endif
+
+    public:
+        virtual ~Assignment_Expression_n();
+    };
+
+    class list_of__comma__Assignment_Expression_n_content : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 273
+        dfa::position m_Position;
+    public:
+        // Rule 274
+        const util::syntax_ptr<_comma__n> _comma_;
+        const util::syntax_ptr<Assignment_Expression_n> Assignment_Expression;
+
+    public:
+        list_of__comma__Assignment_Expression_n_content(const util::syntax_ptr<class _comma__n>& _comma__0, const util::syntax_ptr<class Assignment_Expression_n>& Assignment_Expression_1);
+#if __cplusplus >= 201103L
+        list_of__comma__Assignment_Expression_n_content(util::syntax_ptr<class _comma__n>&& _comma__0, util::syntax_ptr<class Assignment_Expression_n>&& Assignment_Expression_1);
+#endif
+
+    public:
+        virtual ~list_of__comma__Assignment_Expression_n_content();
+    };
+
+    class list_of__comma__Assignment_Expression_n : public syntax_node {
+    public:
+        typedef util::syntax_ptr<class list_of__comma__Assignment_Expression_n_content> node_type;
+        typedef std::vector<node_type> data_type;
+        typedef data_type::const_iterator iterator;
+
+    private:
+        data_type m_Data;
+        dfa::position m_Position;
+
+    public:
+        inline operator const data_type&() const { return m_Data; }
+        inline const list_of__comma__Assignment_Expression_n_content* operator[](size_t index) const { return m_Data[index].item(); }
+        inline const size_t size() const { return m_Data.size(); }
+        inline iterator begin() const { return m_Data.begin(); }
+        inline iterator end() const { return m_Data.end(); }
+
+        inline void add_child(const node_type& newChild) { m_Data.push_back(newChild); }
+#if __cplusplus >= 201103L
+        inline void add_child(node_type&& newChild) { m_Data.push_back(std::move(newChild)); }
+#endif
+        inline void set_position(const dfa::position& newPos) { m_Position = newPos; }
+
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+    };
+
+    class Unary_Expression_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 17
+        const util::syntax_ptr<Postfix_Expression_n> Postfix_Expression;
+
+    public:
+        Unary_Expression_n(const util::syntax_ptr<class Postfix_Expression_n>& Postfix_Expression_0);
+#if __cplusplus >= 201103L
+        Unary_Expression_n(util::syntax_ptr<class Postfix_Expression_n>&& Postfix_Expression_0);
+#endif
+
+    public:
+        // Rule 18
+        const util::syntax_ptr<_plus__plus__n> _plus__plus_;
+        const util::syntax_ptr<Unary_Expression_n> Unary_Expression;
+
+    public:
+        Unary_Expression_n(const util::syntax_ptr<class _plus__plus__n>& _plus__plus__0, const util::syntax_ptr<class Unary_Expression_n>& Unary_Expression_1);
+#if __cplusplus >= 201103L
+        Unary_Expression_n(util::syntax_ptr<class _plus__plus__n>&& _plus__plus__0, util::syntax_ptr<class Unary_Expression_n>&& Unary_Expression_1);
+#endif
+
+    public:
+        // Rule 19
+        const util::syntax_ptr<___n> __;
+        // Unary_Expression declared in another rule
+
+    public:
+        Unary_Expression_n(const util::syntax_ptr<class ___n>& ___0, const util::syntax_ptr<class Unary_Expression_n>& Unary_Expression_1);
+#if __cplusplus >= 201103L
+        Unary_Expression_n(util::syntax_ptr<class ___n>&& ___0, util::syntax_ptr<class Unary_Expression_n>&& Unary_Expression_1);
+#endif
+
+    public:
+        // Rule 20
+        const util::syntax_ptr<one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n> one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation_;
+        const util::syntax_ptr<Cast_Expression_n> Cast_Expression;
+
+    public:
+        Unary_Expression_n(const util::syntax_ptr<class one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n>& one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__0, const util::syntax_ptr<class Cast_Expression_n>& Cast_Expression_1);
+#if __cplusplus >= 201103L
+        Unary_Expression_n(util::syntax_ptr<class one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n>&& one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__0, util::syntax_ptr<class Cast_Expression_n>&& Cast_Expression_1);
+#endif
+
+    public:
+        // Rule 21
+        const util::syntax_ptr<sizeof_n> sizeof_2;
+        // Unary_Expression declared in another rule
+
+    public:
+        Unary_Expression_n(const util::syntax_ptr<class sizeof_n>& sizeof_0, const util::syntax_ptr<class Unary_Expression_n>& Unary_Expression_1);
+#if __cplusplus >= 201103L
+        Unary_Expression_n(util::syntax_ptr<class sizeof_n>&& sizeof_0, util::syntax_ptr<class Unary_Expression_n>&& Unary_Expression_1);
+#endif
+
+    public:
+        // Rule 22
+        // sizeof_2 declared in another rule
+        const util::syntax_ptr<_openparen__n> _openparen_;
+        const util::syntax_ptr<Type_Name_n> Type_Name;
+        const util::syntax_ptr<_closeparen__n> _closeparen_;
+
+    public:
+        Unary_Expression_n(const util::syntax_ptr<class sizeof_n>& sizeof_0, const util::syntax_ptr<class _openparen__n>& _openparen__1, const util::syntax_ptr<class Type_Name_n>& Type_Name_2, const util::syntax_ptr<class _closeparen__n>& _closeparen__3);
+#if __cplusplus >= 201103L
+        Unary_Expression_n(util::syntax_ptr<class sizeof_n>&& sizeof_0, util::syntax_ptr<class _openparen__n>&& _openparen__1, util::syntax_ptr<class Type_Name_n>&& Type_Name_2, util::syntax_ptr<class _closeparen__n>&& _closeparen__3);
+#endif
+
+    public:
+        virtual ~Unary_Expression_n();
+    };
+
+    class one_of__tilde__or__exclamation__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of__tilde__or__exclamation__n();
+    };
+
+    class one_of___or_one_of__tilde__or__exclamation__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of___or_one_of__tilde__or__exclamation__n();
+    };
+
+    class one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n();
+    };
+
+    class one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n();
+    };
+
+    class one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 199
+        const util::syntax_ptr<_ampersand__n> _ampersand_;
+
+    public:
+        one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(const util::syntax_ptr<class _ampersand__n>& _ampersand__0);
+#if __cplusplus >= 201103L
+        one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(util::syntax_ptr<class _ampersand__n>&& _ampersand__0);
+#endif
+
+    public:
+        // Rule 200
+        const util::syntax_ptr<_star__n> _star_;
+
+    public:
+        one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(const util::syntax_ptr<class _star__n>& _star__0);
+#if __cplusplus >= 201103L
+        one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(util::syntax_ptr<class _star__n>&& _star__0);
+#endif
+
+    public:
+        // Rule 201
+        const util::syntax_ptr<_plus__n> _plus_;
+
+    public:
+        one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(const util::syntax_ptr<class _plus__n>& _plus__0);
+#if __cplusplus >= 201103L
+        one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(util::syntax_ptr<class _plus__n>&& _plus__0);
+#endif
+
+    public:
+        // Rule 202
+        const util::syntax_ptr<_minus__n> _minus_;
+
+    public:
+        one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(const util::syntax_ptr<class _minus__n>& _minus__0);
+#if __cplusplus >= 201103L
+        one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(util::syntax_ptr<class _minus__n>&& _minus__0);
+#endif
+
+    public:
+        // Rule 203
+        const util::syntax_ptr<_tilde__n> _tilde_;
+
+    public:
+        one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(const util::syntax_ptr<class _tilde__n>& _tilde__0);
+#if __cplusplus >= 201103L
+        one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(util::syntax_ptr<class _tilde__n>&& _tilde__0);
+#endif
+
+    public:
+        // Rule 204
+        const util::syntax_ptr<_exclamation__n> _exclamation_;
+
+    public:
+        one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(const util::syntax_ptr<class _exclamation__n>& _exclamation__0);
+#if __cplusplus >= 201103L
+        one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n(util::syntax_ptr<class _exclamation__n>&& _exclamation__0);
+#endif
+
+    public:
+        virtual ~one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation__n();
+    };
+
+    class Cast_Expression_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 23
+        const util::syntax_ptr<Unary_Expression_n> Unary_Expression;
+
+    public:
+        Cast_Expression_n(const util::syntax_ptr<class Unary_Expression_n>& Unary_Expression_0);
+#if __cplusplus >= 201103L
+        Cast_Expression_n(util::syntax_ptr<class Unary_Expression_n>&& Unary_Expression_0);
+#endif
+
+    public:
+        // Rule 24
+        const util::syntax_ptr<Unambiguous_Cast_n> Unambiguous_Cast;
+        const util::syntax_ptr<Cast_Expression_n> Cast_Expression;
+
+    public:
+        Cast_Expression_n(const util::syntax_ptr<class Unambiguous_Cast_n>& Unambiguous_Cast_0, const util::syntax_ptr<class Cast_Expression_n>& Cast_Expression_1);
+#if __cplusplus >= 201103L
+        Cast_Expression_n(util::syntax_ptr<class Unambiguous_Cast_n>&& Unambiguous_Cast_0, util::syntax_ptr<class Cast_Expression_n>&& Cast_Expression_1);
+#endif
+
+    public:
+        // Rule 25
+        const util::syntax_ptr<Ambiguous_Cast_n> Ambiguous_Cast;
+        // Cast_Expression declared in another rule
+
+    public:
+        Cast_Expression_n(const util::syntax_ptr<class Ambiguous_Cast_n>& Ambiguous_Cast_0, const util::syntax_ptr<class Cast_Expression_n>& Cast_Expression_1);
+#if __cplusplus >= 201103L
+        Cast_Expression_n(util::syntax_ptr<class Ambiguous_Cast_n>&& Ambiguous_Cast_0, util::syntax_ptr<class Cast_Expression_n>&& Cast_Expression_1);
+#endif
+
+    public:
+        virtual ~Cast_Expression_n();
+    };
+
+    class Type_Name_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 116
+        const util::syntax_ptr<Specifier_Qualifier_List_n> Specifier_Qualifier_List;
+        const util::syntax_ptr<optional_Abstract_Declarator_n> optional_Abstract_Declarator;
+
+    public:
+        Type_Name_n(const util::syntax_ptr<class Specifier_Qualifier_List_n>& Specifier_Qualifier_List_0, const util::syntax_ptr<class optional_Abstract_Declarator_n>& optional_Abstract_Declarator_1);
+#if __cplusplus >= 201103L
+        Type_Name_n(util::syntax_ptr<class Specifier_Qualifier_List_n>&& Specifier_Qualifier_List_0, util::syntax_ptr<class optional_Abstract_Declarator_n>&& optional_Abstract_Declarator_1);
+#endif
+
+    public:
+        virtual ~Type_Name_n();
+    };
+
+    class Unambiguous_Cast_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 26
+        const util::syntax_ptr<_openparen__n> _openparen_;
+        const util::syntax_ptr<Type_Name_n> Type_Name;
+        const util::syntax_ptr<_closeparen__n> _closeparen_;
+
+    public:
+        Unambiguous_Cast_n(const util::syntax_ptr<class _openparen__n>& _openparen__0, const util::syntax_ptr<class Type_Name_n>& Type_Name_1, const util::syntax_ptr<class _closeparen__n>& _closeparen__2);
+#if __cplusplus >= 201103L
+        Unambiguous_Cast_n(util::syntax_ptr<class _openparen__n>&& _openparen__0, util::syntax_ptr<class Type_Name_n>&& Type_Name_1, util::syntax_ptr<class _closeparen__n>&& _closeparen__2);
+#endif
+
+    public:
+        virtual ~Unambiguous_Cast_n();
+    };
+
+    class Ambiguous_Cast_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 31
+        const util::syntax_ptr<_openparen__n> _openparen_;
+        const util::syntax_ptr<Type_Name_n> Type_Name;
+        const util::syntax_ptr<_closeparen__n> _closeparen_;
+
+    public:
+        Ambiguous_Cast_n(const util::syntax_ptr<class _openparen__n>& _openparen__0, const util::syntax_ptr<class Type_Name_n>& Type_Name_1, const util::syntax_ptr<class _closeparen__n>& _closeparen__2);
+#if __cplusplus >= 201103L
+        Ambiguous_Cast_n(util::syntax_ptr<class _openparen__n>&& _openparen__0, util::syntax_ptr<class Type_Name_n>&& Type_Name_1, util::syntax_ptr<class _closeparen__n>&& _closeparen__2);
+#endif
+
+    public:
+        virtual ~Ambiguous_Cast_n();
+    };
+
+    class Unambiguous_Cast_Follow_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 27
+        const util::syntax_ptr<Simple_Type_Specifier_n> Simple_Type_Specifier;
+
+    public:
+        Unambiguous_Cast_Follow_n(const util::syntax_ptr<class Simple_Type_Specifier_n>& Simple_Type_Specifier_0);
+#if __cplusplus >= 201103L
+        Unambiguous_Cast_Follow_n(util::syntax_ptr<class Simple_Type_Specifier_n>&& Simple_Type_Specifier_0);
+#endif
+
+    public:
+        // Rule 28
+        const util::syntax_ptr<Type_Qualifier_n> Type_Qualifier;
+
+    public:
+        Unambiguous_Cast_Follow_n(const util::syntax_ptr<class Type_Qualifier_n>& Type_Qualifier_0);
+#if __cplusplus >= 201103L
+        Unambiguous_Cast_Follow_n(util::syntax_ptr<class Type_Qualifier_n>&& Type_Qualifier_0);
+#endif
+
+    public:
+        // Rule 29
+        const util::syntax_ptr<identifier_n> identifier;
+        const util::syntax_ptr<one_of_Simple_Type_Specifier_or_Type_Qualifier_n> one_of_Simple_Type_Specifier_or_Type_Qualifier;
+
+    public:
+        Unambiguous_Cast_Follow_n(const util::syntax_ptr<class identifier_n>& identifier_0, const util::syntax_ptr<class one_of_Simple_Type_Specifier_or_Type_Qualifier_n>& one_of_Simple_Type_Specifier_or_Type_Qualifier_1);
+#if __cplusplus >= 201103L
+        Unambiguous_Cast_Follow_n(util::syntax_ptr<class identifier_n>&& identifier_0, util::syntax_ptr<class one_of_Simple_Type_Specifier_or_Type_Qualifier_n>&& one_of_Simple_Type_Specifier_or_Type_Qualifier_1);
+#endif
+
+    public:
+        // Rule 30
+        // identifier declared in another rule
+        const util::syntax_ptr<optional_Abstract_Declarator_n> optional_Abstract_Declarator;
+        const util::syntax_ptr<_closeparen__n> _closeparen_;
+        const util::syntax_ptr<one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n> one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant;
+
+    public:
+        Unambiguous_Cast_Follow_n(const util::syntax_ptr<class identifier_n>& identifier_0, const util::syntax_ptr<class optional_Abstract_Declarator_n>& optional_Abstract_Declarator_1, const util::syntax_ptr<class _closeparen__n>& _closeparen__2, const util::syntax_ptr<class one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n>& one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_3);
+#if __cplusplus >= 201103L
+        Unambiguous_Cast_Follow_n(util::syntax_ptr<class identifier_n>&& identifier_0, util::syntax_ptr<class optional_Abstract_Declarator_n>&& optional_Abstract_Declarator_1, util::syntax_ptr<class _closeparen__n>&& _closeparen__2, util::syntax_ptr<class one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n>&& one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_3);
+#endif
+
+    public:
+        virtual ~Unambiguous_Cast_Follow_n();
+    };
+
+    class Simple_Type_Specifier_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 81
+        const util::syntax_ptr<void_n> void_2;
+
+    public:
+        Simple_Type_Specifier_n(const util::syntax_ptr<class void_n>& void_0);
+#if __cplusplus >= 201103L
+        Simple_Type_Specifier_n(util::syntax_ptr<class void_n>&& void_0);
+#endif
+
+    public:
+        // Rule 82
+        const util::syntax_ptr<char_n> char_2;
+
+    public:
+        Simple_Type_Specifier_n(const util::syntax_ptr<class char_n>& char_0);
+#if __cplusplus >= 201103L
+        Simple_Type_Specifier_n(util::syntax_ptr<class char_n>&& char_0);
+#endif
+
+    public:
+        // Rule 83
+        const util::syntax_ptr<short_n> short_2;
+
+    public:
+        Simple_Type_Specifier_n(const util::syntax_ptr<class short_n>& short_0);
+#if __cplusplus >= 201103L
+        Simple_Type_Specifier_n(util::syntax_ptr<class short_n>&& short_0);
+#endif
+
+    public:
+        // Rule 84
+        const util::syntax_ptr<int_n> int_2;
+
+    public:
+        Simple_Type_Specifier_n(const util::syntax_ptr<class int_n>& int_0);
+#if __cplusplus >= 201103L
+        Simple_Type_Specifier_n(util::syntax_ptr<class int_n>&& int_0);
+#endif
+
+    public:
+        // Rule 85
+        const util::syntax_ptr<long_n> long_2;
+
+    public:
+        Simple_Type_Specifier_n(const util::syntax_ptr<class long_n>& long_0);
+#if __cplusplus >= 201103L
+        Simple_Type_Specifier_n(util::syntax_ptr<class long_n>&& long_0);
+#endif
+
+    public:
+        // Rule 86
+        const util::syntax_ptr<float_n> float_2;
+
+    public:
+        Simple_Type_Specifier_n(const util::syntax_ptr<class float_n>& float_0);
+#if __cplusplus >= 201103L
+        Simple_Type_Specifier_n(util::syntax_ptr<class float_n>&& float_0);
+#endif
+
+    public:
+        // Rule 87
+        const util::syntax_ptr<double_n> double_2;
+
+    public:
+        Simple_Type_Specifier_n(const util::syntax_ptr<class double_n>& double_0);
+#if __cplusplus >= 201103L
+        Simple_Type_Specifier_n(util::syntax_ptr<class double_n>&& double_0);
+#endif
+
+    public:
+        // Rule 88
+        const util::syntax_ptr<signed_n> signed_2;
+
+    public:
+        Simple_Type_Specifier_n(const util::syntax_ptr<class signed_n>& signed_0);
+#if __cplusplus >= 201103L
+        Simple_Type_Specifier_n(util::syntax_ptr<class signed_n>&& signed_0);
+#endif
+
+    public:
+        // Rule 89
+        const util::syntax_ptr<unsigned_n> unsigned_2;
+
+    public:
+        Simple_Type_Specifier_n(const util::syntax_ptr<class unsigned_n>& unsigned_0);
+#if __cplusplus >= 201103L
+        Simple_Type_Specifier_n(util::syntax_ptr<class unsigned_n>&& unsigned_0);
+#endif
+
+    public:
+        // Rule 90
+        const util::syntax_ptr<Struct_Or_Union_Specifier_n> Struct_Or_Union_Specifier;
+
+    public:
+        Simple_Type_Specifier_n(const util::syntax_ptr<class Struct_Or_Union_Specifier_n>& Struct_Or_Union_Specifier_0);
+#if __cplusplus >= 201103L
+        Simple_Type_Specifier_n(util::syntax_ptr<class Struct_Or_Union_Specifier_n>&& Struct_Or_Union_Specifier_0);
+#endif
+
+    public:
+        // Rule 91
+        const util::syntax_ptr<Enum_Specifier_n> Enum_Specifier;
+
+    public:
+        Simple_Type_Specifier_n(const util::syntax_ptr<class Enum_Specifier_n>& Enum_Specifier_0);
+#if __cplusplus >= 201103L
+        Simple_Type_Specifier_n(util::syntax_ptr<class Enum_Specifier_n>&& Enum_Specifier_0);
+#endif
+
+    public:
+        virtual ~Simple_Type_Specifier_n();
+    };
+
+    class Type_Qualifier_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 103
+        const util::syntax_ptr<const_n> const_2;
+
+    public:
+        Type_Qualifier_n(const util::syntax_ptr<class const_n>& const_0);
+#if __cplusplus >= 201103L
+        Type_Qualifier_n(util::syntax_ptr<class const_n>&& const_0);
+#endif
+
+    public:
+        // Rule 104
+        const util::syntax_ptr<volatile_n> volatile_2;
+
+    public:
+        Type_Qualifier_n(const util::syntax_ptr<class volatile_n>& volatile_0);
+#if __cplusplus >= 201103L
+        Type_Qualifier_n(util::syntax_ptr<class volatile_n>&& volatile_0);
+#endif
+
+    public:
+        virtual ~Type_Qualifier_n();
+    };
+
+    class one_of_Simple_Type_Specifier_or_Type_Qualifier_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 269
+        const util::syntax_ptr<Simple_Type_Specifier_n> Simple_Type_Specifier;
+
+    public:
+        one_of_Simple_Type_Specifier_or_Type_Qualifier_n(const util::syntax_ptr<class Simple_Type_Specifier_n>& Simple_Type_Specifier_0);
+#if __cplusplus >= 201103L
+        one_of_Simple_Type_Specifier_or_Type_Qualifier_n(util::syntax_ptr<class Simple_Type_Specifier_n>&& Simple_Type_Specifier_0);
+#endif
+
+    public:
+        // Rule 270
+        const util::syntax_ptr<Type_Qualifier_n> Type_Qualifier;
+
+    public:
+        one_of_Simple_Type_Specifier_or_Type_Qualifier_n(const util::syntax_ptr<class Type_Qualifier_n>& Type_Qualifier_0);
+#if __cplusplus >= 201103L
+        one_of_Simple_Type_Specifier_or_Type_Qualifier_n(util::syntax_ptr<class Type_Qualifier_n>&& Type_Qualifier_0);
+#endif
+
+    public:
+        virtual ~one_of_Simple_Type_Specifier_or_Type_Qualifier_n();
+    };
+
+    class Abstract_Declarator_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 117
+        const util::syntax_ptr<Pointer_n> Pointer;
+        const util::syntax_ptr<optional_Direct_Abstract_Declarator_n> optional_Direct_Abstract_Declarator;
+
+    public:
+        Abstract_Declarator_n(const util::syntax_ptr<class Pointer_n>& Pointer_0, const util::syntax_ptr<class optional_Direct_Abstract_Declarator_n>& optional_Direct_Abstract_Declarator_1);
+#if __cplusplus >= 201103L
+        Abstract_Declarator_n(util::syntax_ptr<class Pointer_n>&& Pointer_0, util::syntax_ptr<class optional_Direct_Abstract_Declarator_n>&& optional_Direct_Abstract_Declarator_1);
+#endif
+
+    public:
+        // Rule 118
+        const util::syntax_ptr<Direct_Abstract_Declarator_n> Direct_Abstract_Declarator;
+
+    public:
+        Abstract_Declarator_n(const util::syntax_ptr<class Direct_Abstract_Declarator_n>& Direct_Abstract_Declarator_0);
+#if __cplusplus >= 201103L
+        Abstract_Declarator_n(util::syntax_ptr<class Direct_Abstract_Declarator_n>&& Direct_Abstract_Declarator_0);
+#endif
+
+    public:
+        virtual ~Abstract_Declarator_n();
+    };
+
+    class optional_Abstract_Declarator_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 271
+        dfa::position m_Position;
+    public:
+        optional_Abstract_Declarator_n(const dfa::position& pos);
+
+    public:
+        // Rule 272
+        const util::syntax_ptr<Abstract_Declarator_n> Abstract_Declarator;
+
+    public:
+        optional_Abstract_Declarator_n(const util::syntax_ptr<class Abstract_Declarator_n>& Abstract_Declarator_0);
+#if __cplusplus >= 201103L
+        optional_Abstract_Declarator_n(util::syntax_ptr<class Abstract_Declarator_n>&& Abstract_Declarator_0);
+#endif
+
+    public:
+        virtual ~optional_Abstract_Declarator_n();
+    };
+
+    class one_of_identifier_or_Constant_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of_identifier_or_Constant_n();
+    };
+
+    class one_of_sizeof_or_one_of_identifier_or_Constant_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of_sizeof_or_one_of_identifier_or_Constant_n();
+    };
+
+    class one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n();
+    };
+
+    class one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n();
+    };
+
+    class one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n();
+    };
+
+    class one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n();
+    };
+
+    class one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 281
+        const util::syntax_ptr<_plus__plus__n> _plus__plus_;
+        const util::syntax_ptr<Unary_Expression_n> Unary_Expression;
+
+    public:
+        one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(const util::syntax_ptr<class _plus__plus__n>& _plus__plus__0, const util::syntax_ptr<class Unary_Expression_n>& Unary_Expression_1);
+#if __cplusplus >= 201103L
+        one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(util::syntax_ptr<class _plus__plus__n>&& _plus__plus__0, util::syntax_ptr<class Unary_Expression_n>&& Unary_Expression_1);
+#endif
+
+    public:
+        // Rule 282
+        const util::syntax_ptr<___n> __;
+        // Unary_Expression declared in another rule
+
+    public:
+        one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(const util::syntax_ptr<class ___n>& ___0, const util::syntax_ptr<class Unary_Expression_n>& Unary_Expression_1);
+#if __cplusplus >= 201103L
+        one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(util::syntax_ptr<class ___n>&& ___0, util::syntax_ptr<class Unary_Expression_n>&& Unary_Expression_1);
+#endif
+
+    public:
+        // Rule 283
+        const util::syntax_ptr<_ampersand__n> _ampersand_;
+
+    public:
+        one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(const util::syntax_ptr<class _ampersand__n>& _ampersand__0);
+#if __cplusplus >= 201103L
+        one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(util::syntax_ptr<class _ampersand__n>&& _ampersand__0);
+#endif
+
+    public:
+        // Rule 284
+        const util::syntax_ptr<_tilde__n> _tilde_;
+
+    public:
+        one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(const util::syntax_ptr<class _tilde__n>& _tilde__0);
+#if __cplusplus >= 201103L
+        one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(util::syntax_ptr<class _tilde__n>&& _tilde__0);
+#endif
+
+    public:
+        // Rule 285
+        const util::syntax_ptr<_exclamation__n> _exclamation_;
+
+    public:
+        one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(const util::syntax_ptr<class _exclamation__n>& _exclamation__0);
+#if __cplusplus >= 201103L
+        one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(util::syntax_ptr<class _exclamation__n>&& _exclamation__0);
+#endif
+
+    public:
+        // Rule 286
+        const util::syntax_ptr<sizeof_n> sizeof_2;
+
+    public:
+        one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(const util::syntax_ptr<class sizeof_n>& sizeof_0);
+#if __cplusplus >= 201103L
+        one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(util::syntax_ptr<class sizeof_n>&& sizeof_0);
+#endif
+
+    public:
+        // Rule 287
+        const util::syntax_ptr<identifier_n> identifier;
+
+    public:
+        one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(const util::syntax_ptr<class identifier_n>& identifier_0);
+#if __cplusplus >= 201103L
+        one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(util::syntax_ptr<class identifier_n>&& identifier_0);
+#endif
+
+    public:
+        // Rule 288
+        const util::syntax_ptr<Constant_n> Constant;
+
+    public:
+        one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(const util::syntax_ptr<class Constant_n>& Constant_0);
+#if __cplusplus >= 201103L
+        one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n(util::syntax_ptr<class Constant_n>&& Constant_0);
+#endif
+
+    public:
+        virtual ~one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant_n();
+    };
+
+    class Ambiguous_Cast_Follow_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 32
+        const util::syntax_ptr<identifier_n> identifier;
+        const util::syntax_ptr<optional_Abstract_Declarator_n> optional_Abstract_Declarator;
+        const util::syntax_ptr<_closeparen__n> _closeparen_;
+        const util::syntax_ptr<one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n> one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen_;
+
+    public:
+        Ambiguous_Cast_Follow_n(const util::syntax_ptr<class identifier_n>& identifier_0, const util::syntax_ptr<class optional_Abstract_Declarator_n>& optional_Abstract_Declarator_1, const util::syntax_ptr<class _closeparen__n>& _closeparen__2, const util::syntax_ptr<class one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n>& one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__3);
+#if __cplusplus >= 201103L
+        Ambiguous_Cast_Follow_n(util::syntax_ptr<class identifier_n>&& identifier_0, util::syntax_ptr<class optional_Abstract_Declarator_n>&& optional_Abstract_Declarator_1, util::syntax_ptr<class _closeparen__n>&& _closeparen__2, util::syntax_ptr<class one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n>&& one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__3);
+#endif
+
+    public:
+        virtual ~Ambiguous_Cast_Follow_n();
+    };
+
+    class one_of___or__openparen__Expression__closeparen__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of___or__openparen__Expression__closeparen__n();
+    };
+
+    class one_of__star__or_one_of___or__openparen__Expression__closeparen__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of__star__or_one_of___or__openparen__Expression__closeparen__n();
+    };
+
+    class one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 289
+        const util::syntax_ptr<_plus__n> _plus_;
+
+    public:
+        one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n(const util::syntax_ptr<class _plus__n>& _plus__0);
+#if __cplusplus >= 201103L
+        one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n(util::syntax_ptr<class _plus__n>&& _plus__0);
+#endif
+
+    public:
+        // Rule 290
+        const util::syntax_ptr<_star__n> _star_;
+
+    public:
+        one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n(const util::syntax_ptr<class _star__n>& _star__0);
+#if __cplusplus >= 201103L
+        one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n(util::syntax_ptr<class _star__n>&& _star__0);
+#endif
+
+    public:
+        // Rule 291
+        const util::syntax_ptr<_minus__n> _minus_;
+
+    public:
+        one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n(const util::syntax_ptr<class _minus__n>& _minus__0);
+#if __cplusplus >= 201103L
+        one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n(util::syntax_ptr<class _minus__n>&& _minus__0);
+#endif
+
+    public:
+        // Rule 292
+        const util::syntax_ptr<_openparen__n> _openparen_;
+        const util::syntax_ptr<Expression_n> Expression;
+        const util::syntax_ptr<_closeparen__n> _closeparen_;
+
+    public:
+        one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n(const util::syntax_ptr<class _openparen__n>& _openparen__0, const util::syntax_ptr<class Expression_n>& Expression_1, const util::syntax_ptr<class _closeparen__n>& _closeparen__2);
+#if __cplusplus >= 201103L
+        one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n(util::syntax_ptr<class _openparen__n>&& _openparen__0, util::syntax_ptr<class Expression_n>&& Expression_1, util::syntax_ptr<class _closeparen__n>&& _closeparen__2);
+#endif
+
+    public:
+        virtual ~one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen__n();
+    };
+
+    class Multiplicative_Expression_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 33
+        const util::syntax_ptr<Cast_Expression_n> Cast_Expression;
+
+    public:
+        Multiplicative_Expression_n(const util::syntax_ptr<class Cast_Expression_n>& Cast_Expression_0);
+#if __cplusplus >= 201103L
+        Multiplicative_Expression_n(util::syntax_ptr<class Cast_Expression_n>&& Cast_Expression_0);
+#endif
+
+    public:
+        // Rule 34
+        const util::syntax_ptr<Multiplicative_Expression_n> Multiplicative_Expression;
+        const util::syntax_ptr<one_of__star__or_one_of__slash__or__percent__n> one_of__star__or_one_of__slash__or__percent_;
+        // Cast_Expression declared in another rule
+
+    public:
+        Multiplicative_Expression_n(const util::syntax_ptr<class Multiplicative_Expression_n>& Multiplicative_Expression_0, const util::syntax_ptr<class one_of__star__or_one_of__slash__or__percent__n>& one_of__star__or_one_of__slash__or__percent__1, const util::syntax_ptr<class Cast_Expression_n>& Cast_Expression_2);
+#if __cplusplus >= 201103L
+        Multiplicative_Expression_n(util::syntax_ptr<class Multiplicative_Expression_n>&& Multiplicative_Expression_0, util::syntax_ptr<class one_of__star__or_one_of__slash__or__percent__n>&& one_of__star__or_one_of__slash__or__percent__1, util::syntax_ptr<class Cast_Expression_n>&& Cast_Expression_2);
+#endif
+
+    public:
+        virtual ~Multiplicative_Expression_n();
+    };
+
+    class one_of__slash__or__percent__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of__slash__or__percent__n();
+    };
+
+    class one_of__star__or_one_of__slash__or__percent__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 213
+        const util::syntax_ptr<_star__n> _star_;
+
+    public:
+        one_of__star__or_one_of__slash__or__percent__n(const util::syntax_ptr<class _star__n>& _star__0);
+#if __cplusplus >= 201103L
+        one_of__star__or_one_of__slash__or__percent__n(util::syntax_ptr<class _star__n>&& _star__0);
+#endif
+
+    public:
+        // Rule 214
+        const util::syntax_ptr<_slash__n> _slash_;
+
+    public:
+        one_of__star__or_one_of__slash__or__percent__n(const util::syntax_ptr<class _slash__n>& _slash__0);
+#if __cplusplus >= 201103L
+        one_of__star__or_one_of__slash__or__percent__n(util::syntax_ptr<class _slash__n>&& _slash__0);
+#endif
+
+    public:
+        // Rule 215
+        const util::syntax_ptr<_percent__n> _percent_;
+
+    public:
+        one_of__star__or_one_of__slash__or__percent__n(const util::syntax_ptr<class _percent__n>& _percent__0);
+#if __cplusplus >= 201103L
+        one_of__star__or_one_of__slash__or__percent__n(util::syntax_ptr<class _percent__n>&& _percent__0);
+#endif
+
+    public:
+        virtual ~one_of__star__or_one_of__slash__or__percent__n();
+    };
+
+    class Additive_Expression_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 35
+        const util::syntax_ptr<Multiplicative_Expression_n> Multiplicative_Expression;
+
+    public:
+        Additive_Expression_n(const util::syntax_ptr<class Multiplicative_Expression_n>& Multiplicative_Expression_0);
+#if __cplusplus >= 201103L
+        Additive_Expression_n(util::syntax_ptr<class Multiplicative_Expression_n>&& Multiplicative_Expression_0);
+#endif
+
+    public:
+        // Rule 36
+        const util::syntax_ptr<Additive_Expression_n> Additive_Expression;
+        const util::syntax_ptr<one_of__plus__or___n> one_of__plus__or__;
+        // Multiplicative_Expression declared in another rule
+
+    public:
+        Additive_Expression_n(const util::syntax_ptr<class Additive_Expression_n>& Additive_Expression_0, const util::syntax_ptr<class one_of__plus__or___n>& one_of__plus__or___1, const util::syntax_ptr<class Multiplicative_Expression_n>& Multiplicative_Expression_2);
+#if __cplusplus >= 201103L
+        Additive_Expression_n(util::syntax_ptr<class Additive_Expression_n>&& Additive_Expression_0, util::syntax_ptr<class one_of__plus__or___n>&& one_of__plus__or___1, util::syntax_ptr<class Multiplicative_Expression_n>&& Multiplicative_Expression_2);
+#endif
+
+    public:
+        virtual ~Additive_Expression_n();
+    };
+
+    class one_of__plus__or___n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 216
+        const util::syntax_ptr<_plus__n> _plus_;
+
+    public:
+        one_of__plus__or___n(const util::syntax_ptr<class _plus__n>& _plus__0);
+#if __cplusplus >= 201103L
+        one_of__plus__or___n(util::syntax_ptr<class _plus__n>&& _plus__0);
+#endif
+
+    public:
+        // Rule 217
+        const util::syntax_ptr<_minus__n> _minus_;
+
+    public:
+        one_of__plus__or___n(const util::syntax_ptr<class _minus__n>& _minus__0);
+#if __cplusplus >= 201103L
+        one_of__plus__or___n(util::syntax_ptr<class _minus__n>&& _minus__0);
+#endif
+
+    public:
+        virtual ~one_of__plus__or___n();
+    };
+
+    class Shift_Expression_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 37
+        const util::syntax_ptr<Additive_Expression_n> Additive_Expression;
+
+    public:
+        Shift_Expression_n(const util::syntax_ptr<class Additive_Expression_n>& Additive_Expression_0);
+#if __cplusplus >= 201103L
+        Shift_Expression_n(util::syntax_ptr<class Additive_Expression_n>&& Additive_Expression_0);
+#endif
+
+    public:
+        // Rule 38
+        const util::syntax_ptr<Shift_Expression_n> Shift_Expression;
+        const util::syntax_ptr<one_of__lessthan__lessthan__or__greaterthan__greaterthan__n> one_of__lessthan__lessthan__or__greaterthan__greaterthan_;
+        // Additive_Expression declared in another rule
+
+    public:
+        Shift_Expression_n(const util::syntax_ptr<class Shift_Expression_n>& Shift_Expression_0, const util::syntax_ptr<class one_of__lessthan__lessthan__or__greaterthan__greaterthan__n>& one_of__lessthan__lessthan__or__greaterthan__greaterthan__1, const util::syntax_ptr<class Additive_Expression_n>& Additive_Expression_2);
+#if __cplusplus >= 201103L
+        Shift_Expression_n(util::syntax_ptr<class Shift_Expression_n>&& Shift_Expression_0, util::syntax_ptr<class one_of__lessthan__lessthan__or__greaterthan__greaterthan__n>&& one_of__lessthan__lessthan__or__greaterthan__greaterthan__1, util::syntax_ptr<class Additive_Expression_n>&& Additive_Expression_2);
+#endif
+
+    public:
+        virtual ~Shift_Expression_n();
+    };
+
+    class one_of__lessthan__lessthan__or__greaterthan__greaterthan__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 218
+        const util::syntax_ptr<_lessthan__lessthan__n> _lessthan__lessthan_;
+
+    public:
+        one_of__lessthan__lessthan__or__greaterthan__greaterthan__n(const util::syntax_ptr<class _lessthan__lessthan__n>& _lessthan__lessthan__0);
+#if __cplusplus >= 201103L
+        one_of__lessthan__lessthan__or__greaterthan__greaterthan__n(util::syntax_ptr<class _lessthan__lessthan__n>&& _lessthan__lessthan__0);
+#endif
+
+    public:
+        // Rule 219
+        const util::syntax_ptr<_greaterthan__greaterthan__n> _greaterthan__greaterthan_;
+
+    public:
+        one_of__lessthan__lessthan__or__greaterthan__greaterthan__n(const util::syntax_ptr<class _greaterthan__greaterthan__n>& _greaterthan__greaterthan__0);
+#if __cplusplus >= 201103L
+        one_of__lessthan__lessthan__or__greaterthan__greaterthan__n(util::syntax_ptr<class _greaterthan__greaterthan__n>&& _greaterthan__greaterthan__0);
+#endif
+
+    public:
+        virtual ~one_of__lessthan__lessthan__or__greaterthan__greaterthan__n();
+    };
+
+    class Relational_Expression_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 39
+        const util::syntax_ptr<Shift_Expression_n> Shift_Expression;
+
+    public:
+        Relational_Expression_n(const util::syntax_ptr<class Shift_Expression_n>& Shift_Expression_0);
+#if __cplusplus >= 201103L
+        Relational_Expression_n(util::syntax_ptr<class Shift_Expression_n>&& Shift_Expression_0);
+#endif
+
+    public:
+        // Rule 40
+        const util::syntax_ptr<Relational_Expression_n> Relational_Expression;
+        const util::syntax_ptr<one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n> one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals_;
+        // Shift_Expression declared in another rule
+
+    public:
+        Relational_Expression_n(const util::syntax_ptr<class Relational_Expression_n>& Relational_Expression_0, const util::syntax_ptr<class one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n>& one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__1, const util::syntax_ptr<class Shift_Expression_n>& Shift_Expression_2);
+#if __cplusplus >= 201103L
+        Relational_Expression_n(util::syntax_ptr<class Relational_Expression_n>&& Relational_Expression_0, util::syntax_ptr<class one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n>&& one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__1, util::syntax_ptr<class Shift_Expression_n>&& Shift_Expression_2);
+#endif
+
+    public:
+        virtual ~Relational_Expression_n();
+    };
+
+    class one_of__lessthan__equals__or__greaterthan__equals__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of__lessthan__equals__or__greaterthan__equals__n();
+    };
+
+    class one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n();
+    };
+
+    class one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 220
+        const util::syntax_ptr<_lessthan__n> _lessthan_;
+
+    public:
+        one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n(const util::syntax_ptr<class _lessthan__n>& _lessthan__0);
+#if __cplusplus >= 201103L
+        one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n(util::syntax_ptr<class _lessthan__n>&& _lessthan__0);
+#endif
+
+    public:
+        // Rule 221
+        const util::syntax_ptr<_greaterthan__n> _greaterthan_;
+
+    public:
+        one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n(const util::syntax_ptr<class _greaterthan__n>& _greaterthan__0);
+#if __cplusplus >= 201103L
+        one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n(util::syntax_ptr<class _greaterthan__n>&& _greaterthan__0);
+#endif
+
+    public:
+        // Rule 222
+        const util::syntax_ptr<_lessthan__equals__n> _lessthan__equals_;
+
+    public:
+        one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n(const util::syntax_ptr<class _lessthan__equals__n>& _lessthan__equals__0);
+#if __cplusplus >= 201103L
+        one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n(util::syntax_ptr<class _lessthan__equals__n>&& _lessthan__equals__0);
+#endif
+
+    public:
+        // Rule 223
+        const util::syntax_ptr<_greaterthan__equals__n> _greaterthan__equals_;
+
+    public:
+        one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n(const util::syntax_ptr<class _greaterthan__equals__n>& _greaterthan__equals__0);
+#if __cplusplus >= 201103L
+        one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n(util::syntax_ptr<class _greaterthan__equals__n>&& _greaterthan__equals__0);
+#endif
+
+    public:
+        virtual ~one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals__n();
+    };
+
+    class Equality_Expression_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 41
+        const util::syntax_ptr<Relational_Expression_n> Relational_Expression;
+
+    public:
+        Equality_Expression_n(const util::syntax_ptr<class Relational_Expression_n>& Relational_Expression_0);
+#if __cplusplus >= 201103L
+        Equality_Expression_n(util::syntax_ptr<class Relational_Expression_n>&& Relational_Expression_0);
+#endif
+
+    public:
+        // Rule 42
+        const util::syntax_ptr<Equality_Expression_n> Equality_Expression;
+        const util::syntax_ptr<one_of__equals__equals__or__exclamation__equals__n> one_of__equals__equals__or__exclamation__equals_;
+        // Relational_Expression declared in another rule
+
+    public:
+        Equality_Expression_n(const util::syntax_ptr<class Equality_Expression_n>& Equality_Expression_0, const util::syntax_ptr<class one_of__equals__equals__or__exclamation__equals__n>& one_of__equals__equals__or__exclamation__equals__1, const util::syntax_ptr<class Relational_Expression_n>& Relational_Expression_2);
+#if __cplusplus >= 201103L
+        Equality_Expression_n(util::syntax_ptr<class Equality_Expression_n>&& Equality_Expression_0, util::syntax_ptr<class one_of__equals__equals__or__exclamation__equals__n>&& one_of__equals__equals__or__exclamation__equals__1, util::syntax_ptr<class Relational_Expression_n>&& Relational_Expression_2);
+#endif
+
+    public:
+        virtual ~Equality_Expression_n();
+    };
+
+    class one_of__equals__equals__or__exclamation__equals__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 224
+        const util::syntax_ptr<_equals__equals__n> _equals__equals_;
+
+    public:
+        one_of__equals__equals__or__exclamation__equals__n(const util::syntax_ptr<class _equals__equals__n>& _equals__equals__0);
+#if __cplusplus >= 201103L
+        one_of__equals__equals__or__exclamation__equals__n(util::syntax_ptr<class _equals__equals__n>&& _equals__equals__0);
+#endif
+
+    public:
+        // Rule 225
+        const util::syntax_ptr<_exclamation__equals__n> _exclamation__equals_;
+
+    public:
+        one_of__equals__equals__or__exclamation__equals__n(const util::syntax_ptr<class _exclamation__equals__n>& _exclamation__equals__0);
+#if __cplusplus >= 201103L
+        one_of__equals__equals__or__exclamation__equals__n(util::syntax_ptr<class _exclamation__equals__n>&& _exclamation__equals__0);
+#endif
+
+    public:
+        virtual ~one_of__equals__equals__or__exclamation__equals__n();
+    };
+
+    class And_Expression_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 43
+        const util::syntax_ptr<Equality_Expression_n> Equality_Expression;
+
+    public:
+        And_Expression_n(const util::syntax_ptr<class Equality_Expression_n>& Equality_Expression_0);
+#if __cplusplus >= 201103L
+        And_Expression_n(util::syntax_ptr<class Equality_Expression_n>&& Equality_Expression_0);
+#endif
+
+    public:
+        // Rule 44
+        const util::syntax_ptr<And_Expression_n> And_Expression;
+        const util::syntax_ptr<_ampersand__n> _ampersand_;
+        // Equality_Expression declared in another rule
+
+    public:
+        And_Expression_n(const util::syntax_ptr<class And_Expression_n>& And_Expression_0, const util::syntax_ptr<class _ampersand__n>& _ampersand__1, const util::syntax_ptr<class Equality_Expression_n>& Equality_Expression_2);
+#if __cplusplus >= 201103L
+        And_Expression_n(util::syntax_ptr<class And_Expression_n>&& And_Expression_0, util::syntax_ptr<class _ampersand__n>&& _ampersand__1, util::syntax_ptr<class Equality_Expression_n>&& Equality_Expression_2);
+#endif
+
+    public:
+        virtual ~And_Expression_n();
+    };
+
+    class Exclusive_Or_Expression_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 45
+        const util::syntax_ptr<And_Expression_n> And_Expression;
+
+    public:
+        Exclusive_Or_Expression_n(const util::syntax_ptr<class And_Expression_n>& And_Expression_0);
+#if __cplusplus >= 201103L
+        Exclusive_Or_Expression_n(util::syntax_ptr<class And_Expression_n>&& And_Expression_0);
+#endif
+
+    public:
+        // Rule 46
+        const util::syntax_ptr<Exclusive_Or_Expression_n> Exclusive_Or_Expression;
+        const util::syntax_ptr<_cicumflex__n> _cicumflex_;
+        // And_Expression declared in another rule
+
+    public:
+        Exclusive_Or_Expression_n(const util::syntax_ptr<class Exclusive_Or_Expression_n>& Exclusive_Or_Expression_0, const util::syntax_ptr<class _cicumflex__n>& _cicumflex__1, const util::syntax_ptr<class And_Expression_n>& And_Expression_2);
+#if __cplusplus >= 201103L
+        Exclusive_Or_Expression_n(util::syntax_ptr<class Exclusive_Or_Expression_n>&& Exclusive_Or_Expression_0, util::syntax_ptr<class _cicumflex__n>&& _cicumflex__1, util::syntax_ptr<class And_Expression_n>&& And_Expression_2);
+#endif
+
+    public:
+        virtual ~Exclusive_Or_Expression_n();
+    };
+
+    class Inclusive_Or_Expression_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 47
+        const util::syntax_ptr<Exclusive_Or_Expression_n> Exclusive_Or_Expression;
+
+    public:
+        Inclusive_Or_Expression_n(const util::syntax_ptr<class Exclusive_Or_Expression_n>& Exclusive_Or_Expression_0);
+#if __cplusplus >= 201103L
+        Inclusive_Or_Expression_n(util::syntax_ptr<class Exclusive_Or_Expression_n>&& Exclusive_Or_Expression_0);
+#endif
+
+    public:
+        // Rule 48
+        const util::syntax_ptr<Inclusive_Or_Expression_n> Inclusive_Or_Expression;
+        const util::syntax_ptr<_pipe__n> _pipe_;
+        // Exclusive_Or_Expression declared in another rule
+
+    public:
+        Inclusive_Or_Expression_n(const util::syntax_ptr<class Inclusive_Or_Expression_n>& Inclusive_Or_Expression_0, const util::syntax_ptr<class _pipe__n>& _pipe__1, const util::syntax_ptr<class Exclusive_Or_Expression_n>& Exclusive_Or_Expression_2);
+#if __cplusplus >= 201103L
+        Inclusive_Or_Expression_n(util::syntax_ptr<class Inclusive_Or_Expression_n>&& Inclusive_Or_Expression_0, util::syntax_ptr<class _pipe__n>&& _pipe__1, util::syntax_ptr<class Exclusive_Or_Expression_n>&& Exclusive_Or_Expression_2);
+#endif
+
+    public:
+        virtual ~Inclusive_Or_Expression_n();
+    };
+
+    class Logical_And_Expression_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 49
+        const util::syntax_ptr<Inclusive_Or_Expression_n> Inclusive_Or_Expression;
+
+    public:
+        Logical_And_Expression_n(const util::syntax_ptr<class Inclusive_Or_Expression_n>& Inclusive_Or_Expression_0);
+#if __cplusplus >= 201103L
+        Logical_And_Expression_n(util::syntax_ptr<class Inclusive_Or_Expression_n>&& Inclusive_Or_Expression_0);
+#endif
+
+    public:
+        // Rule 50
+        const util::syntax_ptr<Logical_And_Expression_n> Logical_And_Expression;
+        const util::syntax_ptr<_ampersand__ampersand__n> _ampersand__ampersand_;
+        // Inclusive_Or_Expression declared in another rule
+
+    public:
+        Logical_And_Expression_n(const util::syntax_ptr<class Logical_And_Expression_n>& Logical_And_Expression_0, const util::syntax_ptr<class _ampersand__ampersand__n>& _ampersand__ampersand__1, const util::syntax_ptr<class Inclusive_Or_Expression_n>& Inclusive_Or_Expression_2);
+#if __cplusplus >= 201103L
+        Logical_And_Expression_n(util::syntax_ptr<class Logical_And_Expression_n>&& Logical_And_Expression_0, util::syntax_ptr<class _ampersand__ampersand__n>&& _ampersand__ampersand__1, util::syntax_ptr<class Inclusive_Or_Expression_n>&& Inclusive_Or_Expression_2);
+#endif
+
+    public:
+        virtual ~Logical_And_Expression_n();
+    };
+
+    class Logical_Or_Expression_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 51
+        const util::syntax_ptr<Logical_And_Expression_n> Logical_And_Expression;
+
+    public:
+        Logical_Or_Expression_n(const util::syntax_ptr<class Logical_And_Expression_n>& Logical_And_Expression_0);
+#if __cplusplus >= 201103L
+        Logical_Or_Expression_n(util::syntax_ptr<class Logical_And_Expression_n>&& Logical_And_Expression_0);
+#endif
+
+    public:
+        // Rule 52
+        const util::syntax_ptr<Logical_Or_Expression_n> Logical_Or_Expression;
+        const util::syntax_ptr<_pipe__pipe__n> _pipe__pipe_;
+        // Logical_And_Expression declared in another rule
+
+    public:
+        Logical_Or_Expression_n(const util::syntax_ptr<class Logical_Or_Expression_n>& Logical_Or_Expression_0, const util::syntax_ptr<class _pipe__pipe__n>& _pipe__pipe__1, const util::syntax_ptr<class Logical_And_Expression_n>& Logical_And_Expression_2);
+#if __cplusplus >= 201103L
+        Logical_Or_Expression_n(util::syntax_ptr<class Logical_Or_Expression_n>&& Logical_Or_Expression_0, util::syntax_ptr<class _pipe__pipe__n>&& _pipe__pipe__1, util::syntax_ptr<class Logical_And_Expression_n>&& Logical_And_Expression_2);
+#endif
+
+    public:
+        virtual ~Logical_Or_Expression_n();
+    };
+
+    class Conditional_Expression_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 53
+        const util::syntax_ptr<Logical_Or_Expression_n> Logical_Or_Expression;
+
+    public:
+        Conditional_Expression_n(const util::syntax_ptr<class Logical_Or_Expression_n>& Logical_Or_Expression_0);
+#if __cplusplus >= 201103L
+        Conditional_Expression_n(util::syntax_ptr<class Logical_Or_Expression_n>&& Logical_Or_Expression_0);
+#endif
+
+    public:
+        // Rule 54
+        // Logical_Or_Expression declared in another rule
+        const util::syntax_ptr<_question__n> _question_;
+        const util::syntax_ptr<Expression_n> Expression;
+        const util::syntax_ptr<_colon__n> _colon_;
+        const util::syntax_ptr<Conditional_Expression_n> Conditional_Expression;
+
+    public:
+        Conditional_Expression_n(const util::syntax_ptr<class Logical_Or_Expression_n>& Logical_Or_Expression_0, const util::syntax_ptr<class _question__n>& _question__1, const util::syntax_ptr<class Expression_n>& Expression_2, const util::syntax_ptr<class _colon__n>& _colon__3, const util::syntax_ptr<class Conditional_Expression_n>& Conditional_Expression_4);
+#if __cplusplus >= 201103L
+        Conditional_Expression_n(util::syntax_ptr<class Logical_Or_Expression_n>&& Logical_Or_Expression_0, util::syntax_ptr<class _question__n>&& _question__1, util::syntax_ptr<class Expression_n>&& Expression_2, util::syntax_ptr<class _colon__n>&& _colon__3, util::syntax_ptr<class Conditional_Expression_n>&& Conditional_Expression_4);
+#endif
+
+    public:
+        virtual ~Conditional_Expression_n();
+    };
+
+    class one_of__cicumflex__equals__or__pipe__equals__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of__cicumflex__equals__or__pipe__equals__n();
+    };
+
+    class one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n();
+    };
+
+    class one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n();
+    };
+
+    class one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n();
+    };
+
+    class one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n();
+    };
+
+    class one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n();
+    };
+
+    class one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n();
+    };
+
+    class one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n();
+    };
+
+    class one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n();
+    };
+
+    class one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 226
+        const util::syntax_ptr<_equals__n> _equals_;
+
+    public:
+        one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(const util::syntax_ptr<class _equals__n>& _equals__0);
+#if __cplusplus >= 201103L
+        one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(util::syntax_ptr<class _equals__n>&& _equals__0);
+#endif
+
+    public:
+        // Rule 227
+        const util::syntax_ptr<_star__equals__n> _star__equals_;
+
+    public:
+        one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(const util::syntax_ptr<class _star__equals__n>& _star__equals__0);
+#if __cplusplus >= 201103L
+        one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(util::syntax_ptr<class _star__equals__n>&& _star__equals__0);
+#endif
+
+    public:
+        // Rule 228
+        const util::syntax_ptr<_slash__equals__n> _slash__equals_;
+
+    public:
+        one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(const util::syntax_ptr<class _slash__equals__n>& _slash__equals__0);
+#if __cplusplus >= 201103L
+        one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(util::syntax_ptr<class _slash__equals__n>&& _slash__equals__0);
+#endif
+
+    public:
+        // Rule 229
+        const util::syntax_ptr<_percent__equals__n> _percent__equals_;
+
+    public:
+        one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(const util::syntax_ptr<class _percent__equals__n>& _percent__equals__0);
+#if __cplusplus >= 201103L
+        one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(util::syntax_ptr<class _percent__equals__n>&& _percent__equals__0);
+#endif
+
+    public:
+        // Rule 230
+        const util::syntax_ptr<_plus__equals__n> _plus__equals_;
+
+    public:
+        one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(const util::syntax_ptr<class _plus__equals__n>& _plus__equals__0);
+#if __cplusplus >= 201103L
+        one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(util::syntax_ptr<class _plus__equals__n>&& _plus__equals__0);
+#endif
+
+    public:
+        // Rule 231
+        const util::syntax_ptr<__equals__n> __equals_;
+
+    public:
+        one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(const util::syntax_ptr<class __equals__n>& __equals__0);
+#if __cplusplus >= 201103L
+        one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(util::syntax_ptr<class __equals__n>&& __equals__0);
+#endif
+
+    public:
+        // Rule 232
+        const util::syntax_ptr<_lessthan__lessthan__equals__n> _lessthan__lessthan__equals_;
+
+    public:
+        one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(const util::syntax_ptr<class _lessthan__lessthan__equals__n>& _lessthan__lessthan__equals__0);
+#if __cplusplus >= 201103L
+        one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(util::syntax_ptr<class _lessthan__lessthan__equals__n>&& _lessthan__lessthan__equals__0);
+#endif
+
+    public:
+        // Rule 233
+        const util::syntax_ptr<_greaterthan__greaterthan__equals__n> _greaterthan__greaterthan__equals_;
+
+    public:
+        one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(const util::syntax_ptr<class _greaterthan__greaterthan__equals__n>& _greaterthan__greaterthan__equals__0);
+#if __cplusplus >= 201103L
+        one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(util::syntax_ptr<class _greaterthan__greaterthan__equals__n>&& _greaterthan__greaterthan__equals__0);
+#endif
+
+    public:
+        // Rule 234
+        const util::syntax_ptr<_ampersand__equals__n> _ampersand__equals_;
+
+    public:
+        one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(const util::syntax_ptr<class _ampersand__equals__n>& _ampersand__equals__0);
+#if __cplusplus >= 201103L
+        one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(util::syntax_ptr<class _ampersand__equals__n>&& _ampersand__equals__0);
+#endif
+
+    public:
+        // Rule 235
+        const util::syntax_ptr<_cicumflex__equals__n> _cicumflex__equals_;
+
+    public:
+        one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(const util::syntax_ptr<class _cicumflex__equals__n>& _cicumflex__equals__0);
+#if __cplusplus >= 201103L
+        one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(util::syntax_ptr<class _cicumflex__equals__n>&& _cicumflex__equals__0);
+#endif
+
+    public:
+        // Rule 236
+        const util::syntax_ptr<_pipe__equals__n> _pipe__equals_;
+
+    public:
+        one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(const util::syntax_ptr<class _pipe__equals__n>& _pipe__equals__0);
+#if __cplusplus >= 201103L
+        one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n(util::syntax_ptr<class _pipe__equals__n>&& _pipe__equals__0);
+#endif
+
+    public:
+        virtual ~one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals__n();
+    };
+
+    class Constant_Expression_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 59
+        const util::syntax_ptr<Conditional_Expression_n> Conditional_Expression;
+
+    public:
+        Constant_Expression_n(const util::syntax_ptr<class Conditional_Expression_n>& Conditional_Expression_0);
+#if __cplusplus >= 201103L
+        Constant_Expression_n(util::syntax_ptr<class Conditional_Expression_n>&& Conditional_Expression_0);
+#endif
+
+    public:
+        virtual ~Constant_Expression_n();
+    };
+
+    class Declaration_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 60
+        const util::syntax_ptr<Declaration_Specifiers_n> Declaration_Specifiers;
+        const util::syntax_ptr<optional_Init_Declarator_List_n> optional_Init_Declarator_List;
+        const util::syntax_ptr<_semicolon__n> _semicolon_;
+
+    public:
+        Declaration_n(const util::syntax_ptr<class Declaration_Specifiers_n>& Declaration_Specifiers_0, const util::syntax_ptr<class optional_Init_Declarator_List_n>& optional_Init_Declarator_List_1, const util::syntax_ptr<class _semicolon__n>& _semicolon__2);
+#if __cplusplus >= 201103L
+        Declaration_n(util::syntax_ptr<class Declaration_Specifiers_n>&& Declaration_Specifiers_0, util::syntax_ptr<class optional_Init_Declarator_List_n>&& optional_Init_Declarator_List_1, util::syntax_ptr<class _semicolon__n>&& _semicolon__2);
+#endif
+
+    public:
+        virtual ~Declaration_n();
+    };
+
+    class Declaration_Specifiers_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 61
+        const util::syntax_ptr<list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n> list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier;
+
+    public:
+        Declaration_Specifiers_n(const util::syntax_ptr<class list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n>& list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_0);
+#if __cplusplus >= 201103L
+        Declaration_Specifiers_n(util::syntax_ptr<class list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n>&& list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_0);
+#endif
+
+    public:
+        virtual ~Declaration_Specifiers_n();
+    };
+
+    class Init_Declarator_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 63
+        const util::syntax_ptr<Declarator_n> Declarator;
+        const util::syntax_ptr<optional__equals__Initializer_n> optional__equals__Initializer;
+
+    public:
+        Init_Declarator_n(const util::syntax_ptr<class Declarator_n>& Declarator_0, const util::syntax_ptr<class optional__equals__Initializer_n>& optional__equals__Initializer_1);
+#if __cplusplus >= 201103L
+        Init_Declarator_n(util::syntax_ptr<class Declarator_n>&& Declarator_0, util::syntax_ptr<class optional__equals__Initializer_n>&& optional__equals__Initializer_1);
+#endif
+
+    public:
+        virtual ~Init_Declarator_n();
+    };
+
+    class one_of__semicolon__or__comma__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 185
+        const util::syntax_ptr<_semicolon__n> _semicolon_;
+
+    public:
+        one_of__semicolon__or__comma__n(const util::syntax_ptr<class _semicolon__n>& _semicolon__0);
+#if __cplusplus >= 201103L
+        one_of__semicolon__or__comma__n(util::syntax_ptr<class _semicolon__n>&& _semicolon__0);
+#endif
+
+    public:
+        // Rule 186
+        const util::syntax_ptr<_comma__n> _comma_;
+
+    public:
+        one_of__semicolon__or__comma__n(const util::syntax_ptr<class _comma__n>& _comma__0);
+#if __cplusplus >= 201103L
+        one_of__semicolon__or__comma__n(util::syntax_ptr<class _comma__n>&& _comma__0);
+#endif
+
+    public:
+        virtual ~one_of__semicolon__or__comma__n();
+    };
+
+    class one_of__semicolon__or_Init_Declarator_one_of__semicolon__or__comma__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 176
+        const util::syntax_ptr<_semicolon__n> _semicolon_;
+
+    public:
+        one_of__semicolon__or_Init_Declarator_one_of__semicolon__or__comma__n(const util::syntax_ptr<class _semicolon__n>& _semicolon__0);
+#if __cplusplus >= 201103L
+        one_of__semicolon__or_Init_Declarator_one_of__semicolon__or__comma__n(util::syntax_ptr<class _semicolon__n>&& _semicolon__0);
+#endif
+
+    public:
+        // Rule 177
+        const util::syntax_ptr<Init_Declarator_n> Init_Declarator;
+        const util::syntax_ptr<one_of__semicolon__or__comma__n> one_of__semicolon__or__comma_;
+
+    public:
+        one_of__semicolon__or_Init_Declarator_one_of__semicolon__or__comma__n(const util::syntax_ptr<class Init_Declarator_n>& Init_Declarator_0, const util::syntax_ptr<class one_of__semicolon__or__comma__n>& one_of__semicolon__or__comma__1);
+#if __cplusplus >= 201103L
+        one_of__semicolon__or_Init_Declarator_one_of__semicolon__or__comma__n(util::syntax_ptr<class Init_Declarator_n>&& Init_Declarator_0, util::syntax_ptr<class one_of__semicolon__or__comma__n>&& one_of__semicolon__or__comma__1);
+#endif
+
+    public:
+        virtual ~one_of__semicolon__or_Init_Declarator_one_of__semicolon__or__comma__n();
+    };
+
+    class Init_Declarator_List_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 62
+        const util::syntax_ptr<Init_Declarator_n> Init_Declarator;
+        const util::syntax_ptr<list_of__comma__Init_Declarator_n> list_of__comma__Init_Declarator;
+
+    public:
+        Init_Declarator_List_n(const util::syntax_ptr<class Init_Declarator_n>& Init_Declarator_0, const util::syntax_ptr<class list_of__comma__Init_Declarator_n>& list_of__comma__Init_Declarator_1);
+#if __cplusplus >= 201103L
+        Init_Declarator_List_n(util::syntax_ptr<class Init_Declarator_n>&& Init_Declarator_0, util::syntax_ptr<class list_of__comma__Init_Declarator_n>&& list_of__comma__Init_Declarator_1);
+#endif
+
+    public:
+        virtual ~Init_Declarator_List_n();
+    };
+
+    class optional_Init_Declarator_List_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 178
+        dfa::position m_Position;
+    public:
+        optional_Init_Declarator_List_n(const dfa::position& pos);
+
+    public:
+        // Rule 179
+        const util::syntax_ptr<Init_Declarator_List_n> Init_Declarator_List;
+
+    public:
+        optional_Init_Declarator_List_n(const util::syntax_ptr<class Init_Declarator_List_n>& Init_Declarator_List_0);
+#if __cplusplus >= 201103L
+        optional_Init_Declarator_List_n(util::syntax_ptr<class Init_Declarator_List_n>&& Init_Declarator_List_0);
+#endif
+
+    public:
+        virtual ~optional_Init_Declarator_List_n();
+    };
+
+    class Storage_Class_Specifier_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 64
+        const util::syntax_ptr<typedef_n> typedef_2;
+
+    public:
+        Storage_Class_Specifier_n(const util::syntax_ptr<class typedef_n>& typedef_0);
+#if __cplusplus >= 201103L
+        Storage_Class_Specifier_n(util::syntax_ptr<class typedef_n>&& typedef_0);
+#endif
+
+    public:
+        // Rule 65
+        const util::syntax_ptr<extern_n> extern_2;
+
+    public:
+        Storage_Class_Specifier_n(const util::syntax_ptr<class extern_n>& extern_0);
+#if __cplusplus >= 201103L
+        Storage_Class_Specifier_n(util::syntax_ptr<class extern_n>&& extern_0);
+#endif
+
+    public:
+        // Rule 66
+        const util::syntax_ptr<static_n> static_2;
+
+    public:
+        Storage_Class_Specifier_n(const util::syntax_ptr<class static_n>& static_0);
+#if __cplusplus >= 201103L
+        Storage_Class_Specifier_n(util::syntax_ptr<class static_n>&& static_0);
+#endif
+
+    public:
+        // Rule 67
+        const util::syntax_ptr<auto_n> auto_2;
+
+    public:
+        Storage_Class_Specifier_n(const util::syntax_ptr<class auto_n>& auto_0);
+#if __cplusplus >= 201103L
+        Storage_Class_Specifier_n(util::syntax_ptr<class auto_n>&& auto_0);
+#endif
+
+    public:
+        // Rule 68
+        const util::syntax_ptr<register_n> register_2;
+
+    public:
+        Storage_Class_Specifier_n(const util::syntax_ptr<class register_n>& register_0);
+#if __cplusplus >= 201103L
+        Storage_Class_Specifier_n(util::syntax_ptr<class register_n>&& register_0);
+#endif
+
+    public:
+        virtual ~Storage_Class_Specifier_n();
+    };
+
+    class Type_Specifier_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 69
+        const util::syntax_ptr<void_n> void_2;
+
+    public:
+        Type_Specifier_n(const util::syntax_ptr<class void_n>& void_0);
+#if __cplusplus >= 201103L
+        Type_Specifier_n(util::syntax_ptr<class void_n>&& void_0);
+#endif
+
+    public:
+        // Rule 70
+        const util::syntax_ptr<char_n> char_2;
+
+    public:
+        Type_Specifier_n(const util::syntax_ptr<class char_n>& char_0);
+#if __cplusplus >= 201103L
+        Type_Specifier_n(util::syntax_ptr<class char_n>&& char_0);
+#endif
+
+    public:
+        // Rule 71
+        const util::syntax_ptr<short_n> short_2;
+
+    public:
+        Type_Specifier_n(const util::syntax_ptr<class short_n>& short_0);
+#if __cplusplus >= 201103L
+        Type_Specifier_n(util::syntax_ptr<class short_n>&& short_0);
+#endif
+
+    public:
+        // Rule 72
+        const util::syntax_ptr<int_n> int_2;
+
+    public:
+        Type_Specifier_n(const util::syntax_ptr<class int_n>& int_0);
+#if __cplusplus >= 201103L
+        Type_Specifier_n(util::syntax_ptr<class int_n>&& int_0);
+#endif
+
+    public:
+        // Rule 73
+        const util::syntax_ptr<long_n> long_2;
+
+    public:
+        Type_Specifier_n(const util::syntax_ptr<class long_n>& long_0);
+#if __cplusplus >= 201103L
+        Type_Specifier_n(util::syntax_ptr<class long_n>&& long_0);
+#endif
+
+    public:
+        // Rule 74
+        const util::syntax_ptr<float_n> float_2;
+
+    public:
+        Type_Specifier_n(const util::syntax_ptr<class float_n>& float_0);
+#if __cplusplus >= 201103L
+        Type_Specifier_n(util::syntax_ptr<class float_n>&& float_0);
+#endif
+
+    public:
+        // Rule 75
+        const util::syntax_ptr<double_n> double_2;
+
+    public:
+        Type_Specifier_n(const util::syntax_ptr<class double_n>& double_0);
+#if __cplusplus >= 201103L
+        Type_Specifier_n(util::syntax_ptr<class double_n>&& double_0);
+#endif
+
+    public:
+        // Rule 76
+        const util::syntax_ptr<signed_n> signed_2;
+
+    public:
+        Type_Specifier_n(const util::syntax_ptr<class signed_n>& signed_0);
+#if __cplusplus >= 201103L
+        Type_Specifier_n(util::syntax_ptr<class signed_n>&& signed_0);
+#endif
+
+    public:
+        // Rule 77
+        const util::syntax_ptr<unsigned_n> unsigned_2;
+
+    public:
+        Type_Specifier_n(const util::syntax_ptr<class unsigned_n>& unsigned_0);
+#if __cplusplus >= 201103L
+        Type_Specifier_n(util::syntax_ptr<class unsigned_n>&& unsigned_0);
+#endif
+
+    public:
+        // Rule 78
+        const util::syntax_ptr<Struct_Or_Union_Specifier_n> Struct_Or_Union_Specifier;
+
+    public:
+        Type_Specifier_n(const util::syntax_ptr<class Struct_Or_Union_Specifier_n>& Struct_Or_Union_Specifier_0);
+#if __cplusplus >= 201103L
+        Type_Specifier_n(util::syntax_ptr<class Struct_Or_Union_Specifier_n>&& Struct_Or_Union_Specifier_0);
+#endif
+
+    public:
+        // Rule 79
+        const util::syntax_ptr<Enum_Specifier_n> Enum_Specifier;
+
+    public:
+        Type_Specifier_n(const util::syntax_ptr<class Enum_Specifier_n>& Enum_Specifier_0);
+#if __cplusplus >= 201103L
+        Type_Specifier_n(util::syntax_ptr<class Enum_Specifier_n>&& Enum_Specifier_0);
+#endif
+
+    public:
+        // Rule 80
+        const util::syntax_ptr<identifier_n> identifier;
+
+    public:
+        Type_Specifier_n(const util::syntax_ptr<class identifier_n>& identifier_0);
+#if __cplusplus >= 201103L
+        Type_Specifier_n(util::syntax_ptr<class identifier_n>&& identifier_0);
+#endif
+
+    public:
+        virtual ~Type_Specifier_n();
+    };
+
+    class one_of_Type_Specifier_or_Type_Qualifier_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 191
+        const util::syntax_ptr<Type_Specifier_n> Type_Specifier;
+
+    public:
+        one_of_Type_Specifier_or_Type_Qualifier_n(const util::syntax_ptr<class Type_Specifier_n>& Type_Specifier_0);
+#if __cplusplus >= 201103L
+        one_of_Type_Specifier_or_Type_Qualifier_n(util::syntax_ptr<class Type_Specifier_n>&& Type_Specifier_0);
+#endif
+
+    public:
+        // Rule 192
+        const util::syntax_ptr<Type_Qualifier_n> Type_Qualifier;
+
+    public:
+        one_of_Type_Specifier_or_Type_Qualifier_n(const util::syntax_ptr<class Type_Qualifier_n>& Type_Qualifier_0);
+#if __cplusplus >= 201103L
+        one_of_Type_Specifier_or_Type_Qualifier_n(util::syntax_ptr<class Type_Qualifier_n>&& Type_Qualifier_0);
+#endif
+
+    public:
+        virtual ~one_of_Type_Specifier_or_Type_Qualifier_n();
+    };
+
+    class one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 155
+        const util::syntax_ptr<Storage_Class_Specifier_n> Storage_Class_Specifier;
+
+    public:
+        one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n(const util::syntax_ptr<class Storage_Class_Specifier_n>& Storage_Class_Specifier_0);
+#if __cplusplus >= 201103L
+        one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n(util::syntax_ptr<class Storage_Class_Specifier_n>&& Storage_Class_Specifier_0);
+#endif
+
+    public:
+        // Rule 156
+        const util::syntax_ptr<Type_Specifier_n> Type_Specifier;
+
+    public:
+        one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n(const util::syntax_ptr<class Type_Specifier_n>& Type_Specifier_0);
+#if __cplusplus >= 201103L
+        one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n(util::syntax_ptr<class Type_Specifier_n>&& Type_Specifier_0);
+#endif
+
+    public:
+        // Rule 159
+        const util::syntax_ptr<Type_Qualifier_n> Type_Qualifier;
+
+    public:
+        one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n(const util::syntax_ptr<class Type_Qualifier_n>& Type_Qualifier_0);
+#if __cplusplus >= 201103L
+        one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n(util::syntax_ptr<class Type_Qualifier_n>&& Type_Qualifier_0);
+#endif
+
+    public:
+        virtual ~one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n();
+    };
+
+    class list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n_content : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 160
+        const util::syntax_ptr<one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n> one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier;
+
+    public:
+        list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n_content(const util::syntax_ptr<class one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n>& one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_0);
+#if __cplusplus >= 201103L
+        list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n_content(util::syntax_ptr<class one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n>&& one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_0);
+#endif
+
+    public:
+        // Rule 161
+        // one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier declared in another rule
+
+    public:
+        virtual ~list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n_content();
+    };
+
+    class list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n : public syntax_node {
+    public:
+        typedef util::syntax_ptr<class list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n_content> node_type;
+        typedef std::vector<node_type> data_type;
+        typedef data_type::const_iterator iterator;
+
+    private:
+        data_type m_Data;
+        dfa::position m_Position;
+
+    public:
+        inline operator const data_type&() const { return m_Data; }
+        inline const list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier_n_content* operator[](size_t index) const { return m_Data[index].item(); }
+        inline const size_t size() const { return m_Data.size(); }
+        inline iterator begin() const { return m_Data.begin(); }
+        inline iterator end() const { return m_Data.end(); }
+
+        inline void add_child(const node_type& newChild) { m_Data.push_back(newChild); }
+#if __cplusplus >= 201103L
+        inline void add_child(node_type&& newChild) { m_Data.push_back(std::move(newChild)); }
+#endif
+        inline void set_position(const dfa::position& newPos) { m_Position = newPos; }
+
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+    };
+
+    class list_of__comma__Init_Declarator_n_content : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 189
+        dfa::position m_Position;
+    public:
+        // Rule 190
+        const util::syntax_ptr<_comma__n> _comma_;
+        const util::syntax_ptr<Init_Declarator_n> Init_Declarator;
+
+    public:
+        list_of__comma__Init_Declarator_n_content(const util::syntax_ptr<class _comma__n>& _comma__0, const util::syntax_ptr<class Init_Declarator_n>& Init_Declarator_1);
+#if __cplusplus >= 201103L
+        list_of__comma__Init_Declarator_n_content(util::syntax_ptr<class _comma__n>&& _comma__0, util::syntax_ptr<class Init_Declarator_n>&& Init_Declarator_1);
+#endif
+
+    public:
+        virtual ~list_of__comma__Init_Declarator_n_content();
+    };
+
+    class list_of__comma__Init_Declarator_n : public syntax_node {
+    public:
+        typedef util::syntax_ptr<class list_of__comma__Init_Declarator_n_content> node_type;
+        typedef std::vector<node_type> data_type;
+        typedef data_type::const_iterator iterator;
+
+    private:
+        data_type m_Data;
+        dfa::position m_Position;
+
+    public:
+        inline operator const data_type&() const { return m_Data; }
+        inline const list_of__comma__Init_Declarator_n_content* operator[](size_t index) const { return m_Data[index].item(); }
+        inline const size_t size() const { return m_Data.size(); }
+        inline iterator begin() const { return m_Data.begin(); }
+        inline iterator end() const { return m_Data.end(); }
+
+        inline void add_child(const node_type& newChild) { m_Data.push_back(newChild); }
+#if __cplusplus >= 201103L
+        inline void add_child(node_type&& newChild) { m_Data.push_back(std::move(newChild)); }
+#endif
+        inline void set_position(const dfa::position& newPos) { m_Position = newPos; }
+
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+    };
+
+    class Declarator_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 105
+        const util::syntax_ptr<optional_Pointer_n> optional_Pointer;
+        const util::syntax_ptr<Direct_Declarator_n> Direct_Declarator;
+
+    public:
+        Declarator_n(const util::syntax_ptr<class optional_Pointer_n>& optional_Pointer_0, const util::syntax_ptr<class Direct_Declarator_n>& Direct_Declarator_1);
+#if __cplusplus >= 201103L
+        Declarator_n(util::syntax_ptr<class optional_Pointer_n>&& optional_Pointer_0, util::syntax_ptr<class Direct_Declarator_n>&& Direct_Declarator_1);
+#endif
+
+    public:
+        virtual ~Declarator_n();
+    };
+
+    class Initializer_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 123
+        const util::syntax_ptr<Assignment_Expression_n> Assignment_Expression;
+
+    public:
+        Initializer_n(const util::syntax_ptr<class Assignment_Expression_n>& Assignment_Expression_0);
+#if __cplusplus >= 201103L
+        Initializer_n(util::syntax_ptr<class Assignment_Expression_n>&& Assignment_Expression_0);
+#endif
+
+    public:
+        // Rule 124
+        const util::syntax_ptr<_opencurly__n> _opencurly_;
+        const util::syntax_ptr<Initializer_n> Initializer;
+        const util::syntax_ptr<list_of__comma__Initializer_n> list_of__comma__Initializer;
+        const util::syntax_ptr<optional__comma__n> optional__comma_;
+        const util::syntax_ptr<_closecurly__n> _closecurly_;
+
+    public:
+        Initializer_n(const util::syntax_ptr<class _opencurly__n>& _opencurly__0, const util::syntax_ptr<class Initializer_n>& Initializer_1, const util::syntax_ptr<class list_of__comma__Initializer_n>& list_of__comma__Initializer_2, const util::syntax_ptr<class optional__comma__n>& optional__comma__3, const util::syntax_ptr<class _closecurly__n>& _closecurly__4);
+#if __cplusplus >= 201103L
+        Initializer_n(util::syntax_ptr<class _opencurly__n>&& _opencurly__0, util::syntax_ptr<class Initializer_n>&& Initializer_1, util::syntax_ptr<class list_of__comma__Initializer_n>&& list_of__comma__Initializer_2, util::syntax_ptr<class optional__comma__n>&& optional__comma__3, util::syntax_ptr<class _closecurly__n>&& _closecurly__4);
+#endif
+
+    public:
+        virtual ~Initializer_n();
+    };
+
+    class optional__equals__Initializer_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 187
+        dfa::position m_Position;
+    public:
+        optional__equals__Initializer_n(const dfa::position& pos);
+
+    public:
+        // Rule 188
+        const util::syntax_ptr<_equals__n> _equals_;
+        const util::syntax_ptr<Initializer_n> Initializer;
+
+    public:
+        optional__equals__Initializer_n(const util::syntax_ptr<class _equals__n>& _equals__0, const util::syntax_ptr<class Initializer_n>& Initializer_1);
+#if __cplusplus >= 201103L
+        optional__equals__Initializer_n(util::syntax_ptr<class _equals__n>&& _equals__0, util::syntax_ptr<class Initializer_n>&& Initializer_1);
+#endif
+
+    public:
+        virtual ~optional__equals__Initializer_n();
+    };
+
+    class Struct_Or_Union_Specifier_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 92
+        const util::syntax_ptr<one_of_struct_or_union_n> one_of_struct_or_union;
+        const util::syntax_ptr<identifier_n> identifier;
+        const util::syntax_ptr<optional__opencurly__list_of_Struct_Declaration__closecurly__n> optional__opencurly__list_of_Struct_Declaration__closecurly_;
+
+    public:
+        Struct_Or_Union_Specifier_n(const util::syntax_ptr<class one_of_struct_or_union_n>& one_of_struct_or_union_0, const util::syntax_ptr<class identifier_n>& identifier_1, const util::syntax_ptr<class optional__opencurly__list_of_Struct_Declaration__closecurly__n>& optional__opencurly__list_of_Struct_Declaration__closecurly__2);
+#if __cplusplus >= 201103L
+        Struct_Or_Union_Specifier_n(util::syntax_ptr<class one_of_struct_or_union_n>&& one_of_struct_or_union_0, util::syntax_ptr<class identifier_n>&& identifier_1, util::syntax_ptr<class optional__opencurly__list_of_Struct_Declaration__closecurly__n>&& optional__opencurly__list_of_Struct_Declaration__closecurly__2);
+#endif
+
+    public:
+        // Rule 93
+        // one_of_struct_or_union declared in another rule
+        const util::syntax_ptr<_opencurly__n> _opencurly_;
+        const util::syntax_ptr<list_of_Struct_Declaration_n> list_of_Struct_Declaration;
+        const util::syntax_ptr<_closecurly__n> _closecurly_;
+
+    public:
+        Struct_Or_Union_Specifier_n(const util::syntax_ptr<class one_of_struct_or_union_n>& one_of_struct_or_union_0, const util::syntax_ptr<class _opencurly__n>& _opencurly__1, const util::syntax_ptr<class list_of_Struct_Declaration_n>& list_of_Struct_Declaration_2, const util::syntax_ptr<class _closecurly__n>& _closecurly__3);
+#if __cplusplus >= 201103L
+        Struct_Or_Union_Specifier_n(util::syntax_ptr<class one_of_struct_or_union_n>&& one_of_struct_or_union_0, util::syntax_ptr<class _opencurly__n>&& _opencurly__1, util::syntax_ptr<class list_of_Struct_Declaration_n>&& list_of_Struct_Declaration_2, util::syntax_ptr<class _closecurly__n>&& _closecurly__3);
+#endif
+
+    public:
+        virtual ~Struct_Or_Union_Specifier_n();
+    };
+
+    class Enum_Specifier_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 99
+        const util::syntax_ptr<enum_n> enum_2;
+        const util::syntax_ptr<optional_identifier_n> optional_identifier;
+        const util::syntax_ptr<_opencurly__n> _opencurly_;
+        const util::syntax_ptr<Enumerator_List_n> Enumerator_List;
+        const util::syntax_ptr<_closecurly__n> _closecurly_;
+
+    public:
+        Enum_Specifier_n(const util::syntax_ptr<class enum_n>& enum_0, const util::syntax_ptr<class optional_identifier_n>& optional_identifier_1, const util::syntax_ptr<class _opencurly__n>& _opencurly__2, const util::syntax_ptr<class Enumerator_List_n>& Enumerator_List_3, const util::syntax_ptr<class _closecurly__n>& _closecurly__4);
+#if __cplusplus >= 201103L
+        Enum_Specifier_n(util::syntax_ptr<class enum_n>&& enum_0, util::syntax_ptr<class optional_identifier_n>&& optional_identifier_1, util::syntax_ptr<class _opencurly__n>&& _opencurly__2, util::syntax_ptr<class Enumerator_List_n>&& Enumerator_List_3, util::syntax_ptr<class _closecurly__n>&& _closecurly__4);
+#endif
+
+    public:
+        // Rule 100
+        // enum_2 declared in another rule
+        const util::syntax_ptr<identifier_n> identifier;
+
+    public:
+        Enum_Specifier_n(const util::syntax_ptr<class enum_n>& enum_0, const util::syntax_ptr<class identifier_n>& identifier_1);
+#if __cplusplus >= 201103L
+        Enum_Specifier_n(util::syntax_ptr<class enum_n>&& enum_0, util::syntax_ptr<class identifier_n>&& identifier_1);
+#endif
+
+    public:
+        virtual ~Enum_Specifier_n();
+    };
+
+    class one_of_struct_or_union_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 157
+        const util::syntax_ptr<struct_n> struct_2;
+
+    public:
+        one_of_struct_or_union_n(const util::syntax_ptr<class struct_n>& struct_0);
+#if __cplusplus >= 201103L
+        one_of_struct_or_union_n(util::syntax_ptr<class struct_n>&& struct_0);
+#endif
+
+    public:
+        // Rule 158
+        const util::syntax_ptr<union_n> union_2;
+
+    public:
+        one_of_struct_or_union_n(const util::syntax_ptr<class union_n>& union_0);
+#if __cplusplus >= 201103L
+        one_of_struct_or_union_n(util::syntax_ptr<class union_n>&& union_0);
+#endif
+
+    public:
+        virtual ~one_of_struct_or_union_n();
+    };
+
+    class Struct_Declaration_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 94
+        const util::syntax_ptr<Specifier_Qualifier_List_n> Specifier_Qualifier_List;
+        const util::syntax_ptr<Struct_Declarator_List_n> Struct_Declarator_List;
+        const util::syntax_ptr<_semicolon__n> _semicolon_;
+
+    public:
+        Struct_Declaration_n(const util::syntax_ptr<class Specifier_Qualifier_List_n>& Specifier_Qualifier_List_0, const util::syntax_ptr<class Struct_Declarator_List_n>& Struct_Declarator_List_1, const util::syntax_ptr<class _semicolon__n>& _semicolon__2);
+#if __cplusplus >= 201103L
+        Struct_Declaration_n(util::syntax_ptr<class Specifier_Qualifier_List_n>&& Specifier_Qualifier_List_0, util::syntax_ptr<class Struct_Declarator_List_n>&& Struct_Declarator_List_1, util::syntax_ptr<class _semicolon__n>&& _semicolon__2);
+#endif
+
+    public:
+        virtual ~Struct_Declaration_n();
+    };
+
+    class list_of_Struct_Declaration_n_content : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 182
+        dfa::position m_Position;
+    public:
+        // Rule 183
+        const util::syntax_ptr<Struct_Declaration_n> Struct_Declaration;
+
+    public:
+        list_of_Struct_Declaration_n_content(const util::syntax_ptr<class Struct_Declaration_n>& Struct_Declaration_0);
+#if __cplusplus >= 201103L
+        list_of_Struct_Declaration_n_content(util::syntax_ptr<class Struct_Declaration_n>&& Struct_Declaration_0);
+#endif
+
+    public:
+        virtual ~list_of_Struct_Declaration_n_content();
+    };
+
+    class list_of_Struct_Declaration_n : public syntax_node {
+    public:
+        typedef util::syntax_ptr<class list_of_Struct_Declaration_n_content> node_type;
+        typedef std::vector<node_type> data_type;
+        typedef data_type::const_iterator iterator;
+
+    private:
+        data_type m_Data;
+        dfa::position m_Position;
+
+    public:
+        inline operator const data_type&() const { return m_Data; }
+        inline const list_of_Struct_Declaration_n_content* operator[](size_t index) const { return m_Data[index].item(); }
+        inline const size_t size() const { return m_Data.size(); }
+        inline iterator begin() const { return m_Data.begin(); }
+        inline iterator end() const { return m_Data.end(); }
+
+        inline void add_child(const node_type& newChild) { m_Data.push_back(newChild); }
+#if __cplusplus >= 201103L
+        inline void add_child(node_type&& newChild) { m_Data.push_back(std::move(newChild)); }
+#endif
+        inline void set_position(const dfa::position& newPos) { m_Position = newPos; }
+
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+    };
+
+    class optional__opencurly__list_of_Struct_Declaration__closecurly__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 180
+        dfa::position m_Position;
+    public:
+        optional__opencurly__list_of_Struct_Declaration__closecurly__n(const dfa::position& pos);
+
+    public:
+        // Rule 181
+        const util::syntax_ptr<_opencurly__n> _opencurly_;
+        const util::syntax_ptr<list_of_Struct_Declaration_n> list_of_Struct_Declaration;
+        const util::syntax_ptr<_closecurly__n> _closecurly_;
+
+    public:
+        optional__opencurly__list_of_Struct_Declaration__closecurly__n(const util::syntax_ptr<class _opencurly__n>& _opencurly__0, const util::syntax_ptr<class list_of_Struct_Declaration_n>& list_of_Struct_Declaration_1, const util::syntax_ptr<class _closecurly__n>& _closecurly__2);
+#if __cplusplus >= 201103L
+        optional__opencurly__list_of_Struct_Declaration__closecurly__n(util::syntax_ptr<class _opencurly__n>&& _opencurly__0, util::syntax_ptr<class list_of_Struct_Declaration_n>&& list_of_Struct_Declaration_1, util::syntax_ptr<class _closecurly__n>&& _closecurly__2);
+#endif
+
+    public:
+        virtual ~optional__opencurly__list_of_Struct_Declaration__closecurly__n();
+    };
+
+    class Specifier_Qualifier_List_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 95
+        const util::syntax_ptr<list_of_one_of_Type_Specifier_or_Type_Qualifier_n> list_of_one_of_Type_Specifier_or_Type_Qualifier;
+
+    public:
+        Specifier_Qualifier_List_n(const util::syntax_ptr<class list_of_one_of_Type_Specifier_or_Type_Qualifier_n>& list_of_one_of_Type_Specifier_or_Type_Qualifier_0);
+#if __cplusplus >= 201103L
+        Specifier_Qualifier_List_n(util::syntax_ptr<class list_of_one_of_Type_Specifier_or_Type_Qualifier_n>&& list_of_one_of_Type_Specifier_or_Type_Qualifier_0);
+#endif
+
+    public:
+        virtual ~Specifier_Qualifier_List_n();
+    };
+
+    class Struct_Declarator_List_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 96
+        const util::syntax_ptr<Struct_Declarator_n> Struct_Declarator;
+        const util::syntax_ptr<list_of__comma__Struct_Declarator_n> list_of__comma__Struct_Declarator;
+
+    public:
+        Struct_Declarator_List_n(const util::syntax_ptr<class Struct_Declarator_n>& Struct_Declarator_0, const util::syntax_ptr<class list_of__comma__Struct_Declarator_n>& list_of__comma__Struct_Declarator_1);
+#if __cplusplus >= 201103L
+        Struct_Declarator_List_n(util::syntax_ptr<class Struct_Declarator_n>&& Struct_Declarator_0, util::syntax_ptr<class list_of__comma__Struct_Declarator_n>&& list_of__comma__Struct_Declarator_1);
+#endif
+
+    public:
+        virtual ~Struct_Declarator_List_n();
+    };
+
+    class list_of_one_of_Type_Specifier_or_Type_Qualifier_n_content : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 193
+        const util::syntax_ptr<one_of_Type_Specifier_or_Type_Qualifier_n> one_of_Type_Specifier_or_Type_Qualifier;
+
+    public:
+        list_of_one_of_Type_Specifier_or_Type_Qualifier_n_content(const util::syntax_ptr<class one_of_Type_Specifier_or_Type_Qualifier_n>& one_of_Type_Specifier_or_Type_Qualifier_0);
+#if __cplusplus >= 201103L
+        list_of_one_of_Type_Specifier_or_Type_Qualifier_n_content(util::syntax_ptr<class one_of_Type_Specifier_or_Type_Qualifier_n>&& one_of_Type_Specifier_or_Type_Qualifier_0);
+#endif
+
+    public:
+        // Rule 194
+        // one_of_Type_Specifier_or_Type_Qualifier declared in another rule
+
+    public:
+        virtual ~list_of_one_of_Type_Specifier_or_Type_Qualifier_n_content();
+    };
+
+    class list_of_one_of_Type_Specifier_or_Type_Qualifier_n : public syntax_node {
+    public:
+        typedef util::syntax_ptr<class list_of_one_of_Type_Specifier_or_Type_Qualifier_n_content> node_type;
+        typedef std::vector<node_type> data_type;
+        typedef data_type::const_iterator iterator;
+
+    private:
+        data_type m_Data;
+        dfa::position m_Position;
+
+    public:
+        inline operator const data_type&() const { return m_Data; }
+        inline const list_of_one_of_Type_Specifier_or_Type_Qualifier_n_content* operator[](size_t index) const { return m_Data[index].item(); }
+        inline const size_t size() const { return m_Data.size(); }
+        inline iterator begin() const { return m_Data.begin(); }
+        inline iterator end() const { return m_Data.end(); }
+
+        inline void add_child(const node_type& newChild) { m_Data.push_back(newChild); }
+#if __cplusplus >= 201103L
+        inline void add_child(node_type&& newChild) { m_Data.push_back(std::move(newChild)); }
+#endif
+        inline void set_position(const dfa::position& newPos) { m_Position = newPos; }
+
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+    };
+
+    class Struct_Declarator_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 97
+        const util::syntax_ptr<Declarator_n> Declarator;
+        const util::syntax_ptr<optional__colon__Constant_Expression_n> optional__colon__Constant_Expression;
+
+    public:
+        Struct_Declarator_n(const util::syntax_ptr<class Declarator_n>& Declarator_0, const util::syntax_ptr<class optional__colon__Constant_Expression_n>& optional__colon__Constant_Expression_1);
+#if __cplusplus >= 201103L
+        Struct_Declarator_n(util::syntax_ptr<class Declarator_n>&& Declarator_0, util::syntax_ptr<class optional__colon__Constant_Expression_n>&& optional__colon__Constant_Expression_1);
+#endif
+
+    public:
+        // Rule 98
+        const util::syntax_ptr<_colon__n> _colon_;
+        const util::syntax_ptr<Constant_Expression_n> Constant_Expression;
+
+    public:
+        Struct_Declarator_n(const util::syntax_ptr<class _colon__n>& _colon__0, const util::syntax_ptr<class Constant_Expression_n>& Constant_Expression_1);
+#if __cplusplus >= 201103L
+        Struct_Declarator_n(util::syntax_ptr<class _colon__n>&& _colon__0, util::syntax_ptr<class Constant_Expression_n>&& Constant_Expression_1);
+#endif
+
+    public:
+        virtual ~Struct_Declarator_n();
+    };
+
+    class list_of__comma__Struct_Declarator_n_content : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 258
+        dfa::position m_Position;
+    public:
+        // Rule 259
+        const util::syntax_ptr<_comma__n> _comma_;
+        const util::syntax_ptr<Struct_Declarator_n> Struct_Declarator;
+
+    public:
+        list_of__comma__Struct_Declarator_n_content(const util::syntax_ptr<class _comma__n>& _comma__0, const util::syntax_ptr<class Struct_Declarator_n>& Struct_Declarator_1);
+#if __cplusplus >= 201103L
+        list_of__comma__Struct_Declarator_n_content(util::syntax_ptr<class _comma__n>&& _comma__0, util::syntax_ptr<class Struct_Declarator_n>&& Struct_Declarator_1);
+#endif
+
+    public:
+        virtual ~list_of__comma__Struct_Declarator_n_content();
+    };
+
+    class list_of__comma__Struct_Declarator_n : public syntax_node {
+    public:
+        typedef util::syntax_ptr<class list_of__comma__Struct_Declarator_n_content> node_type;
+        typedef std::vector<node_type> data_type;
+        typedef data_type::const_iterator iterator;
+
+    private:
+        data_type m_Data;
+        dfa::position m_Position;
+
+    public:
+        inline operator const data_type&() const { return m_Data; }
+        inline const list_of__comma__Struct_Declarator_n_content* operator[](size_t index) const { return m_Data[index].item(); }
+        inline const size_t size() const { return m_Data.size(); }
+        inline iterator begin() const { return m_Data.begin(); }
+        inline iterator end() const { return m_Data.end(); }
+
+        inline void add_child(const node_type& newChild) { m_Data.push_back(newChild); }
+#if __cplusplus >= 201103L
+        inline void add_child(node_type&& newChild) { m_Data.push_back(std::move(newChild)); }
+#endif
+        inline void set_position(const dfa::position& newPos) { m_Position = newPos; }
+
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+    };
+
+    class optional__colon__Constant_Expression_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 256
+        dfa::position m_Position;
+    public:
+        optional__colon__Constant_Expression_n(const dfa::position& pos);
+
+    public:
+        // Rule 257
+        const util::syntax_ptr<_colon__n> _colon_;
+        const util::syntax_ptr<Constant_Expression_n> Constant_Expression;
+
+    public:
+        optional__colon__Constant_Expression_n(const util::syntax_ptr<class _colon__n>& _colon__0, const util::syntax_ptr<class Constant_Expression_n>& Constant_Expression_1);
+#if __cplusplus >= 201103L
+        optional__colon__Constant_Expression_n(util::syntax_ptr<class _colon__n>&& _colon__0, util::syntax_ptr<class Constant_Expression_n>&& Constant_Expression_1);
+#endif
+
+    public:
+        virtual ~optional__colon__Constant_Expression_n();
+    };
+
+    class optional_identifier_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 167
+        dfa::position m_Position;
+    public:
+        optional_identifier_n(const dfa::position& pos);
+
+    public:
+        // Rule 168
+        const util::syntax_ptr<identifier_n> identifier;
+
+    public:
+        optional_identifier_n(const util::syntax_ptr<class identifier_n>& identifier_0);
+#if __cplusplus >= 201103L
+        optional_identifier_n(util::syntax_ptr<class identifier_n>&& identifier_0);
+#endif
+
+    public:
+        virtual ~optional_identifier_n();
+    };
+
+    class Enumerator_List_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 101
+        const util::syntax_ptr<Enumerator_n> Enumerator;
+        const util::syntax_ptr<list_of__comma__Enumerator_n> list_of__comma__Enumerator;
+
+    public:
+        Enumerator_List_n(const util::syntax_ptr<class Enumerator_n>& Enumerator_0, const util::syntax_ptr<class list_of__comma__Enumerator_n>& list_of__comma__Enumerator_1);
+#if __cplusplus >= 201103L
+        Enumerator_List_n(util::syntax_ptr<class Enumerator_n>&& Enumerator_0, util::syntax_ptr<class list_of__comma__Enumerator_n>&& list_of__comma__Enumerator_1);
+#endif
+
+    public:
+        virtual ~Enumerator_List_n();
+    };
+
+    class Enumerator_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 102
+        const util::syntax_ptr<identifier_n> identifier;
+        const util::syntax_ptr<optional__equals__Constant_Expression_n> optional__equals__Constant_Expression;
+
+    public:
+        Enumerator_n(const util::syntax_ptr<class identifier_n>& identifier_0, const util::syntax_ptr<class optional__equals__Constant_Expression_n>& optional__equals__Constant_Expression_1);
+#if __cplusplus >= 201103L
+        Enumerator_n(util::syntax_ptr<class identifier_n>&& identifier_0, util::syntax_ptr<class optional__equals__Constant_Expression_n>&& optional__equals__Constant_Expression_1);
+#endif
+
+    public:
+        virtual ~Enumerator_n();
+    };
+
+    class list_of__comma__Enumerator_n_content : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 207
+        dfa::position m_Position;
+    public:
+        // Rule 208
+        const util::syntax_ptr<_comma__n> _comma_;
+        const util::syntax_ptr<Enumerator_n> Enumerator;
+
+    public:
+        list_of__comma__Enumerator_n_content(const util::syntax_ptr<class _comma__n>& _comma__0, const util::syntax_ptr<class Enumerator_n>& Enumerator_1);
+#if __cplusplus >= 201103L
+        list_of__comma__Enumerator_n_content(util::syntax_ptr<class _comma__n>&& _comma__0, util::syntax_ptr<class Enumerator_n>&& Enumerator_1);
+#endif
+
+    public:
+        virtual ~list_of__comma__Enumerator_n_content();
+    };
+
+    class list_of__comma__Enumerator_n : public syntax_node {
+    public:
+        typedef util::syntax_ptr<class list_of__comma__Enumerator_n_content> node_type;
+        typedef std::vector<node_type> data_type;
+        typedef data_type::const_iterator iterator;
+
+    private:
+        data_type m_Data;
+        dfa::position m_Position;
+
+    public:
+        inline operator const data_type&() const { return m_Data; }
+        inline const list_of__comma__Enumerator_n_content* operator[](size_t index) const { return m_Data[index].item(); }
+        inline const size_t size() const { return m_Data.size(); }
+        inline iterator begin() const { return m_Data.begin(); }
+        inline iterator end() const { return m_Data.end(); }
+
+        inline void add_child(const node_type& newChild) { m_Data.push_back(newChild); }
+#if __cplusplus >= 201103L
+        inline void add_child(node_type&& newChild) { m_Data.push_back(std::move(newChild)); }
+#endif
+        inline void set_position(const dfa::position& newPos) { m_Position = newPos; }
+
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+    };
+
+    class optional__equals__Constant_Expression_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 205
+        dfa::position m_Position;
+    public:
+        optional__equals__Constant_Expression_n(const dfa::position& pos);
+
+    public:
+        // Rule 206
+        const util::syntax_ptr<_equals__n> _equals_;
+        const util::syntax_ptr<Constant_Expression_n> Constant_Expression;
+
+    public:
+        optional__equals__Constant_Expression_n(const util::syntax_ptr<class _equals__n>& _equals__0, const util::syntax_ptr<class Constant_Expression_n>& Constant_Expression_1);
+#if __cplusplus >= 201103L
+        optional__equals__Constant_Expression_n(util::syntax_ptr<class _equals__n>&& _equals__0, util::syntax_ptr<class Constant_Expression_n>&& Constant_Expression_1);
+#endif
+
+    public:
+        virtual ~optional__equals__Constant_Expression_n();
+    };
+
+    class Pointer_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 111
+        const util::syntax_ptr<_star__n> _star_;
+        const util::syntax_ptr<list_of_Type_Qualifier_n> list_of_Type_Qualifier;
+
+    public:
+        Pointer_n(const util::syntax_ptr<class _star__n>& _star__0, const util::syntax_ptr<class list_of_Type_Qualifier_n>& list_of_Type_Qualifier_1);
+#if __cplusplus >= 201103L
+        Pointer_n(util::syntax_ptr<class _star__n>&& _star__0, util::syntax_ptr<class list_of_Type_Qualifier_n>&& list_of_Type_Qualifier_1);
+#endif
+
+    public:
+        // Rule 112
+        // _star_ declared in another rule
+        // list_of_Type_Qualifier declared in another rule
+        const util::syntax_ptr<Pointer_n> Pointer;
+
+    public:
+        Pointer_n(const util::syntax_ptr<class _star__n>& _star__0, const util::syntax_ptr<class list_of_Type_Qualifier_n>& list_of_Type_Qualifier_1, const util::syntax_ptr<class Pointer_n>& Pointer_2);
+#if __cplusplus >= 201103L
+        Pointer_n(util::syntax_ptr<class _star__n>&& _star__0, util::syntax_ptr<class list_of_Type_Qualifier_n>&& list_of_Type_Qualifier_1, util::syntax_ptr<class Pointer_n>&& Pointer_2);
+#endif
+
+    public:
+        virtual ~Pointer_n();
+    };
+
+    class optional_Pointer_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 165
+        dfa::position m_Position;
+    public:
+        optional_Pointer_n(const dfa::position& pos);
+
+    public:
+        // Rule 166
+        const util::syntax_ptr<Pointer_n> Pointer;
+
+    public:
+        optional_Pointer_n(const util::syntax_ptr<class Pointer_n>& Pointer_0);
+#if __cplusplus >= 201103L
+        optional_Pointer_n(util::syntax_ptr<class Pointer_n>&& Pointer_0);
+#endif
+
+    public:
+        virtual ~optional_Pointer_n();
+    };
+
+    class Direct_Declarator_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 106
+        const util::syntax_ptr<identifier_n> identifier;
+
+    public:
+        Direct_Declarator_n(const util::syntax_ptr<class identifier_n>& identifier_0);
+#if __cplusplus >= 201103L
+        Direct_Declarator_n(util::syntax_ptr<class identifier_n>&& identifier_0);
+#endif
+
+    public:
+        // Rule 107
+        const util::syntax_ptr<_openparen__n> _openparen_;
+        const util::syntax_ptr<Declarator_n> Declarator;
+        const util::syntax_ptr<_closeparen__n> _closeparen_;
+
+    public:
+        Direct_Declarator_n(const util::syntax_ptr<class _openparen__n>& _openparen__0, const util::syntax_ptr<class Declarator_n>& Declarator_1, const util::syntax_ptr<class _closeparen__n>& _closeparen__2);
+#if __cplusplus >= 201103L
+        Direct_Declarator_n(util::syntax_ptr<class _openparen__n>&& _openparen__0, util::syntax_ptr<class Declarator_n>&& Declarator_1, util::syntax_ptr<class _closeparen__n>&& _closeparen__2);
+#endif
+
+    public:
+        // Rule 108
+        const util::syntax_ptr<Direct_Declarator_n> Direct_Declarator;
+        const util::syntax_ptr<_opensquare__n> _opensquare_;
+        const util::syntax_ptr<optional_Constant_Expression_n> optional_Constant_Expression;
+        const util::syntax_ptr<_closesquare__n> _closesquare_;
+
+    public:
+        Direct_Declarator_n(const util::syntax_ptr<class Direct_Declarator_n>& Direct_Declarator_0, const util::syntax_ptr<class _opensquare__n>& _opensquare__1, const util::syntax_ptr<class optional_Constant_Expression_n>& optional_Constant_Expression_2, const util::syntax_ptr<class _closesquare__n>& _closesquare__3);
+#if __cplusplus >= 201103L
+        Direct_Declarator_n(util::syntax_ptr<class Direct_Declarator_n>&& Direct_Declarator_0, util::syntax_ptr<class _opensquare__n>&& _opensquare__1, util::syntax_ptr<class optional_Constant_Expression_n>&& optional_Constant_Expression_2, util::syntax_ptr<class _closesquare__n>&& _closesquare__3);
+#endif
+
+    public:
+        // Rule 109
+        // Direct_Declarator declared in another rule
+        // _openparen_ declared in another rule
+        const util::syntax_ptr<one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n> one_of_unknown_item_Parameter_Type_List_or_Identifier_List;
+        // _closeparen_ declared in another rule
+
+    public:
+        Direct_Declarator_n(const util::syntax_ptr<class Direct_Declarator_n>& Direct_Declarator_0, const util::syntax_ptr<class _openparen__n>& _openparen__1, const util::syntax_ptr<class one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n>& one_of_unknown_item_Parameter_Type_List_or_Identifier_List_2, const util::syntax_ptr<class _closeparen__n>& _closeparen__3);
+#if __cplusplus >= 201103L
+        Direct_Declarator_n(util::syntax_ptr<class Direct_Declarator_n>&& Direct_Declarator_0, util::syntax_ptr<class _openparen__n>&& _openparen__1, util::syntax_ptr<class one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n>&& one_of_unknown_item_Parameter_Type_List_or_Identifier_List_2, util::syntax_ptr<class _closeparen__n>&& _closeparen__3);
+#endif
+
+    public:
+        // Rule 110
+        // Direct_Declarator declared in another rule
+        // _openparen_ declared in another rule
+        // _closeparen_ declared in another rule
+
+    public:
+        Direct_Declarator_n(const util::syntax_ptr<class Direct_Declarator_n>& Direct_Declarator_0, const util::syntax_ptr<class _openparen__n>& _openparen__1, const util::syntax_ptr<class _closeparen__n>& _closeparen__2);
+#if __cplusplus >= 201103L
+        Direct_Declarator_n(util::syntax_ptr<class Direct_Declarator_n>&& Direct_Declarator_0, util::syntax_ptr<class _openparen__n>&& _openparen__1, util::syntax_ptr<class _closeparen__n>&& _closeparen__2);
+#endif
+
+    public:
+        virtual ~Direct_Declarator_n();
+    };
+
+    class optional_Constant_Expression_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 197
+        dfa::position m_Position;
+    public:
+        optional_Constant_Expression_n(const dfa::position& pos);
+
+    public:
+        // Rule 198
+        const util::syntax_ptr<Constant_Expression_n> Constant_Expression;
+
+    public:
+        optional_Constant_Expression_n(const util::syntax_ptr<class Constant_Expression_n>& Constant_Expression_0);
+#if __cplusplus >= 201103L
+        optional_Constant_Expression_n(util::syntax_ptr<class Constant_Expression_n>&& Constant_Expression_0);
+#endif
+
+    public:
+        virtual ~optional_Constant_Expression_n();
+    };
+
+    class Parameter_Type_List_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 113
+        const util::syntax_ptr<Parameter_Declarator_n> Parameter_Declarator;
+        const util::syntax_ptr<list_of__comma__Parameter_Declarator_n> list_of__comma__Parameter_Declarator;
+        const util::syntax_ptr<optional__comma___dot__dot__dot__n> optional__comma___dot__dot__dot_;
+
+    public:
+        Parameter_Type_List_n(const util::syntax_ptr<class Parameter_Declarator_n>& Parameter_Declarator_0, const util::syntax_ptr<class list_of__comma__Parameter_Declarator_n>& list_of__comma__Parameter_Declarator_1, const util::syntax_ptr<class optional__comma___dot__dot__dot__n>& optional__comma___dot__dot__dot__2);
+#if __cplusplus >= 201103L
+        Parameter_Type_List_n(util::syntax_ptr<class Parameter_Declarator_n>&& Parameter_Declarator_0, util::syntax_ptr<class list_of__comma__Parameter_Declarator_n>&& list_of__comma__Parameter_Declarator_1, util::syntax_ptr<class optional__comma___dot__dot__dot__n>&& optional__comma___dot__dot__dot__2);
+#endif
+
+    public:
+        virtual ~Parameter_Type_List_n();
+    };
+
+    class Identifier_List_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 115
+        const util::syntax_ptr<identifier_n> identifier;
+        const util::syntax_ptr<list_of__comma__identifier_n> list_of__comma__identifier;
+
+    public:
+        Identifier_List_n(const util::syntax_ptr<class identifier_n>& identifier_0, const util::syntax_ptr<class list_of__comma__identifier_n>& list_of__comma__identifier_1);
+#if __cplusplus >= 201103L
+        Identifier_List_n(util::syntax_ptr<class identifier_n>&& identifier_0, util::syntax_ptr<class list_of__comma__identifier_n>&& list_of__comma__identifier_1);
+#endif
+
+    public:
+        virtual ~Identifier_List_n();
+    };
+
+    class one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 195
+        const util::syntax_ptr<Parameter_Type_List_n> Parameter_Type_List;
+
+    public:
+        one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n(const util::syntax_ptr<class Parameter_Type_List_n>& Parameter_Type_List_0);
+#if __cplusplus >= 201103L
+        one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n(util::syntax_ptr<class Parameter_Type_List_n>&& Parameter_Type_List_0);
+#endif
+
+    public:
+        // Rule 196
+        const util::syntax_ptr<Identifier_List_n> Identifier_List;
+
+    public:
+        one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n(const util::syntax_ptr<class Identifier_List_n>& Identifier_List_0);
+#if __cplusplus >= 201103L
+        one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n(util::syntax_ptr<class Identifier_List_n>&& Identifier_List_0);
+#endif
+
+    public:
+        virtual ~one_of_unknown_item_Parameter_Type_List_or_Identifier_List_n();
+    };
+
+    class list_of_Type_Qualifier_n_content : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 170
+        dfa::position m_Position;
+    public:
+        // Rule 171
+        const util::syntax_ptr<Type_Qualifier_n> Type_Qualifier;
+
+    public:
+        list_of_Type_Qualifier_n_content(const util::syntax_ptr<class Type_Qualifier_n>& Type_Qualifier_0);
+#if __cplusplus >= 201103L
+        list_of_Type_Qualifier_n_content(util::syntax_ptr<class Type_Qualifier_n>&& Type_Qualifier_0);
+#endif
+
+    public:
+        virtual ~list_of_Type_Qualifier_n_content();
+    };
+
+    class list_of_Type_Qualifier_n : public syntax_node {
+    public:
+        typedef util::syntax_ptr<class list_of_Type_Qualifier_n_content> node_type;
+        typedef std::vector<node_type> data_type;
+        typedef data_type::const_iterator iterator;
+
+    private:
+        data_type m_Data;
+        dfa::position m_Position;
+
+    public:
+        inline operator const data_type&() const { return m_Data; }
+        inline const list_of_Type_Qualifier_n_content* operator[](size_t index) const { return m_Data[index].item(); }
+        inline const size_t size() const { return m_Data.size(); }
+        inline iterator begin() const { return m_Data.begin(); }
+        inline iterator end() const { return m_Data.end(); }
+
+        inline void add_child(const node_type& newChild) { m_Data.push_back(newChild); }
+#if __cplusplus >= 201103L
+        inline void add_child(node_type&& newChild) { m_Data.push_back(std::move(newChild)); }
+#endif
+        inline void set_position(const dfa::position& newPos) { m_Position = newPos; }
+
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+    };
+
+    class Parameter_Declarator_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 114
+        const util::syntax_ptr<Declaration_Specifiers_n> Declaration_Specifiers;
+        const util::syntax_ptr<optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n> optional_one_of_unknown_item_Declarator_or_Abstract_Declarator;
+
+    public:
+        Parameter_Declarator_n(const util::syntax_ptr<class Declaration_Specifiers_n>& Declaration_Specifiers_0, const util::syntax_ptr<class optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n>& optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_1);
+#if __cplusplus >= 201103L
+        Parameter_Declarator_n(util::syntax_ptr<class Declaration_Specifiers_n>&& Declaration_Specifiers_0, util::syntax_ptr<class optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n>&& optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_1);
+#endif
+
+    public:
+        virtual ~Parameter_Declarator_n();
+    };
+
+    class list_of__comma__Parameter_Declarator_n_content : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 250
+        dfa::position m_Position;
+    public:
+        // Rule 251
+        const util::syntax_ptr<_comma__n> _comma_;
+        const util::syntax_ptr<Parameter_Declarator_n> Parameter_Declarator;
+
+    public:
+        list_of__comma__Parameter_Declarator_n_content(const util::syntax_ptr<class _comma__n>& _comma__0, const util::syntax_ptr<class Parameter_Declarator_n>& Parameter_Declarator_1);
+#if __cplusplus >= 201103L
+        list_of__comma__Parameter_Declarator_n_content(util::syntax_ptr<class _comma__n>&& _comma__0, util::syntax_ptr<class Parameter_Declarator_n>&& Parameter_Declarator_1);
+#endif
+
+    public:
+        virtual ~list_of__comma__Parameter_Declarator_n_content();
+    };
+
+    class list_of__comma__Parameter_Declarator_n : public syntax_node {
+    public:
+        typedef util::syntax_ptr<class list_of__comma__Parameter_Declarator_n_content> node_type;
+        typedef std::vector<node_type> data_type;
+        typedef data_type::const_iterator iterator;
+
+    private:
+        data_type m_Data;
+        dfa::position m_Position;
+
+    public:
+        inline operator const data_type&() const { return m_Data; }
+        inline const list_of__comma__Parameter_Declarator_n_content* operator[](size_t index) const { return m_Data[index].item(); }
+        inline const size_t size() const { return m_Data.size(); }
+        inline iterator begin() const { return m_Data.begin(); }
+        inline iterator end() const { return m_Data.end(); }
+
+        inline void add_child(const node_type& newChild) { m_Data.push_back(newChild); }
+#if __cplusplus >= 201103L
+        inline void add_child(node_type&& newChild) { m_Data.push_back(std::move(newChild)); }
+#endif
+        inline void set_position(const dfa::position& newPos) { m_Position = newPos; }
+
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+    };
+
+    class optional__comma___dot__dot__dot__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 267
+        dfa::position m_Position;
+    public:
+        optional__comma___dot__dot__dot__n(const dfa::position& pos);
+
+    public:
+        // Rule 268
+        const util::syntax_ptr<_comma__n> _comma_;
+        const util::syntax_ptr<_dot__dot__dot__n> _dot__dot__dot_;
+
+    public:
+        optional__comma___dot__dot__dot__n(const util::syntax_ptr<class _comma__n>& _comma__0, const util::syntax_ptr<class _dot__dot__dot__n>& _dot__dot__dot__1);
+#if __cplusplus >= 201103L
+        optional__comma___dot__dot__dot__n(util::syntax_ptr<class _comma__n>&& _comma__0, util::syntax_ptr<class _dot__dot__dot__n>&& _dot__dot__dot__1);
+#endif
+
+    public:
+        virtual ~optional__comma___dot__dot__dot__n();
+    };
+
+    class one_of__comma__or__closeparen__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 277
+        const util::syntax_ptr<_comma__n> _comma_;
+
+    public:
+        one_of__comma__or__closeparen__n(const util::syntax_ptr<class _comma__n>& _comma__0);
+#if __cplusplus >= 201103L
+        one_of__comma__or__closeparen__n(util::syntax_ptr<class _comma__n>&& _comma__0);
+#endif
+
+    public:
+        // Rule 278
+        const util::syntax_ptr<_closeparen__n> _closeparen_;
+
+    public:
+        one_of__comma__or__closeparen__n(const util::syntax_ptr<class _closeparen__n>& _closeparen__0);
+#if __cplusplus >= 201103L
+        one_of__comma__or__closeparen__n(util::syntax_ptr<class _closeparen__n>&& _closeparen__0);
+#endif
+
+    public:
+        virtual ~one_of__comma__or__closeparen__n();
+    };
+
+    class one_of_unknown_item_Declarator_or_Abstract_Declarator_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 248
+        const util::syntax_ptr<Declarator_n> Declarator;
+
+    public:
+        one_of_unknown_item_Declarator_or_Abstract_Declarator_n(const util::syntax_ptr<class Declarator_n>& Declarator_0);
+#if __cplusplus >= 201103L
+        one_of_unknown_item_Declarator_or_Abstract_Declarator_n(util::syntax_ptr<class Declarator_n>&& Declarator_0);
+#endif
+
+    public:
+        // Rule 249
+        const util::syntax_ptr<Abstract_Declarator_n> Abstract_Declarator;
+
+    public:
+        one_of_unknown_item_Declarator_or_Abstract_Declarator_n(const util::syntax_ptr<class Abstract_Declarator_n>& Abstract_Declarator_0);
+#if __cplusplus >= 201103L
+        one_of_unknown_item_Declarator_or_Abstract_Declarator_n(util::syntax_ptr<class Abstract_Declarator_n>&& Abstract_Declarator_0);
+#endif
+
+    public:
+        virtual ~one_of_unknown_item_Declarator_or_Abstract_Declarator_n();
+    };
+
+    class optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 246
+        dfa::position m_Position;
+    public:
+        optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n(const dfa::position& pos);
+
+    public:
+        // Rule 247
+        const util::syntax_ptr<one_of_unknown_item_Declarator_or_Abstract_Declarator_n> one_of_unknown_item_Declarator_or_Abstract_Declarator;
+
+    public:
+        optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n(const util::syntax_ptr<class one_of_unknown_item_Declarator_or_Abstract_Declarator_n>& one_of_unknown_item_Declarator_or_Abstract_Declarator_0);
+#if __cplusplus >= 201103L
+        optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n(util::syntax_ptr<class one_of_unknown_item_Declarator_or_Abstract_Declarator_n>&& one_of_unknown_item_Declarator_or_Abstract_Declarator_0);
+#endif
+
+    public:
+        virtual ~optional_one_of_unknown_item_Declarator_or_Abstract_Declarator_n();
+    };
+
+    class list_of__comma__identifier_n_content : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 211
+        dfa::position m_Position;
+    public:
+        // Rule 212
+        const util::syntax_ptr<_comma__n> _comma_;
+        const util::syntax_ptr<identifier_n> identifier;
+
+    public:
+        list_of__comma__identifier_n_content(const util::syntax_ptr<class _comma__n>& _comma__0, const util::syntax_ptr<class identifier_n>& identifier_1);
+#if __cplusplus >= 201103L
+        list_of__comma__identifier_n_content(util::syntax_ptr<class _comma__n>&& _comma__0, util::syntax_ptr<class identifier_n>&& identifier_1);
+#endif
+
+    public:
+        virtual ~list_of__comma__identifier_n_content();
+    };
+
+    class list_of__comma__identifier_n : public syntax_node {
+    public:
+        typedef util::syntax_ptr<class list_of__comma__identifier_n_content> node_type;
+        typedef std::vector<node_type> data_type;
+        typedef data_type::const_iterator iterator;
+
+    private:
+        data_type m_Data;
+        dfa::position m_Position;
+
+    public:
+        inline operator const data_type&() const { return m_Data; }
+        inline const list_of__comma__identifier_n_content* operator[](size_t index) const { return m_Data[index].item(); }
+        inline const size_t size() const { return m_Data.size(); }
+        inline iterator begin() const { return m_Data.begin(); }
+        inline iterator end() const { return m_Data.end(); }
+
+        inline void add_child(const node_type& newChild) { m_Data.push_back(newChild); }
+#if __cplusplus >= 201103L
+        inline void add_child(node_type&& newChild) { m_Data.push_back(std::move(newChild)); }
+#endif
+        inline void set_position(const dfa::position& newPos) { m_Position = newPos; }
+
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+    };
+
+    class Direct_Abstract_Declarator_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 119
+        const util::syntax_ptr<_openparen__n> _openparen_;
+        const util::syntax_ptr<optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n> optional_one_of_Abstract_Declarator_or_Parameter_Type_List;
+        const util::syntax_ptr<_closeparen__n> _closeparen_;
+
+    public:
+        Direct_Abstract_Declarator_n(const util::syntax_ptr<class _openparen__n>& _openparen__0, const util::syntax_ptr<class optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n>& optional_one_of_Abstract_Declarator_or_Parameter_Type_List_1, const util::syntax_ptr<class _closeparen__n>& _closeparen__2);
+#if __cplusplus >= 201103L
+        Direct_Abstract_Declarator_n(util::syntax_ptr<class _openparen__n>&& _openparen__0, util::syntax_ptr<class optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n>&& optional_one_of_Abstract_Declarator_or_Parameter_Type_List_1, util::syntax_ptr<class _closeparen__n>&& _closeparen__2);
+#endif
+
+    public:
+        // Rule 120
+        const util::syntax_ptr<_opensquare__n> _opensquare_;
+        const util::syntax_ptr<optional_Constant_Expression_n> optional_Constant_Expression;
+        const util::syntax_ptr<_closesquare__n> _closesquare_;
+
+    public:
+        Direct_Abstract_Declarator_n(const util::syntax_ptr<class _opensquare__n>& _opensquare__0, const util::syntax_ptr<class optional_Constant_Expression_n>& optional_Constant_Expression_1, const util::syntax_ptr<class _closesquare__n>& _closesquare__2);
+#if __cplusplus >= 201103L
+        Direct_Abstract_Declarator_n(util::syntax_ptr<class _opensquare__n>&& _opensquare__0, util::syntax_ptr<class optional_Constant_Expression_n>&& optional_Constant_Expression_1, util::syntax_ptr<class _closesquare__n>&& _closesquare__2);
+#endif
+
+    public:
+        // Rule 121
+        const util::syntax_ptr<Direct_Abstract_Declarator_n> Direct_Abstract_Declarator;
+        // _opensquare_ declared in another rule
+        // optional_Constant_Expression declared in another rule
+        // _closesquare_ declared in another rule
+
+    public:
+        Direct_Abstract_Declarator_n(const util::syntax_ptr<class Direct_Abstract_Declarator_n>& Direct_Abstract_Declarator_0, const util::syntax_ptr<class _opensquare__n>& _opensquare__1, const util::syntax_ptr<class optional_Constant_Expression_n>& optional_Constant_Expression_2, const util::syntax_ptr<class _closesquare__n>& _closesquare__3);
+#if __cplusplus >= 201103L
+        Direct_Abstract_Declarator_n(util::syntax_ptr<class Direct_Abstract_Declarator_n>&& Direct_Abstract_Declarator_0, util::syntax_ptr<class _opensquare__n>&& _opensquare__1, util::syntax_ptr<class optional_Constant_Expression_n>&& optional_Constant_Expression_2, util::syntax_ptr<class _closesquare__n>&& _closesquare__3);
+#endif
+
+    public:
+        // Rule 122
+        // Direct_Abstract_Declarator declared in another rule
+        // _openparen_ declared in another rule
+        const util::syntax_ptr<optional_Parameter_Type_List_n> optional_Parameter_Type_List;
+        // _closeparen_ declared in another rule
+
+    public:
+        Direct_Abstract_Declarator_n(const util::syntax_ptr<class Direct_Abstract_Declarator_n>& Direct_Abstract_Declarator_0, const util::syntax_ptr<class _openparen__n>& _openparen__1, const util::syntax_ptr<class optional_Parameter_Type_List_n>& optional_Parameter_Type_List_2, const util::syntax_ptr<class _closeparen__n>& _closeparen__3);
+#if __cplusplus >= 201103L
+        Direct_Abstract_Declarator_n(util::syntax_ptr<class Direct_Abstract_Declarator_n>&& Direct_Abstract_Declarator_0, util::syntax_ptr<class _openparen__n>&& _openparen__1, util::syntax_ptr<class optional_Parameter_Type_List_n>&& optional_Parameter_Type_List_2, util::syntax_ptr<class _closeparen__n>&& _closeparen__3);
+#endif
+
+    public:
+        virtual ~Direct_Abstract_Declarator_n();
+    };
+
+    class optional_Direct_Abstract_Declarator_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 265
+        dfa::position m_Position;
+    public:
+        optional_Direct_Abstract_Declarator_n(const dfa::position& pos);
+
+    public:
+        // Rule 266
+        const util::syntax_ptr<Direct_Abstract_Declarator_n> Direct_Abstract_Declarator;
+
+    public:
+        optional_Direct_Abstract_Declarator_n(const util::syntax_ptr<class Direct_Abstract_Declarator_n>& Direct_Abstract_Declarator_0);
+#if __cplusplus >= 201103L
+        optional_Direct_Abstract_Declarator_n(util::syntax_ptr<class Direct_Abstract_Declarator_n>&& Direct_Abstract_Declarator_0);
+#endif
+
+    public:
+        virtual ~optional_Direct_Abstract_Declarator_n();
+    };
+
+    class one_of_Abstract_Declarator_or_Parameter_Type_List_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 263
+        const util::syntax_ptr<Abstract_Declarator_n> Abstract_Declarator;
+
+    public:
+        one_of_Abstract_Declarator_or_Parameter_Type_List_n(const util::syntax_ptr<class Abstract_Declarator_n>& Abstract_Declarator_0);
+#if __cplusplus >= 201103L
+        one_of_Abstract_Declarator_or_Parameter_Type_List_n(util::syntax_ptr<class Abstract_Declarator_n>&& Abstract_Declarator_0);
+#endif
+
+    public:
+        // Rule 264
+        const util::syntax_ptr<Parameter_Type_List_n> Parameter_Type_List;
+
+    public:
+        one_of_Abstract_Declarator_or_Parameter_Type_List_n(const util::syntax_ptr<class Parameter_Type_List_n>& Parameter_Type_List_0);
+#if __cplusplus >= 201103L
+        one_of_Abstract_Declarator_or_Parameter_Type_List_n(util::syntax_ptr<class Parameter_Type_List_n>&& Parameter_Type_List_0);
+#endif
+
+    public:
+        virtual ~one_of_Abstract_Declarator_or_Parameter_Type_List_n();
+    };
+
+    class optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 261
+        dfa::position m_Position;
+    public:
+        optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n(const dfa::position& pos);
+
+    public:
+        // Rule 262
+        const util::syntax_ptr<one_of_Abstract_Declarator_or_Parameter_Type_List_n> one_of_Abstract_Declarator_or_Parameter_Type_List;
+
+    public:
+        optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n(const util::syntax_ptr<class one_of_Abstract_Declarator_or_Parameter_Type_List_n>& one_of_Abstract_Declarator_or_Parameter_Type_List_0);
+#if __cplusplus >= 201103L
+        optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n(util::syntax_ptr<class one_of_Abstract_Declarator_or_Parameter_Type_List_n>&& one_of_Abstract_Declarator_or_Parameter_Type_List_0);
+#endif
+
+    public:
+        virtual ~optional_one_of_Abstract_Declarator_or_Parameter_Type_List_n();
+    };
+
+    class optional_Parameter_Type_List_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 279
+        dfa::position m_Position;
+    public:
+        optional_Parameter_Type_List_n(const dfa::position& pos);
+
+    public:
+        // Rule 280
+        const util::syntax_ptr<Parameter_Type_List_n> Parameter_Type_List;
+
+    public:
+        optional_Parameter_Type_List_n(const util::syntax_ptr<class Parameter_Type_List_n>& Parameter_Type_List_0);
+#if __cplusplus >= 201103L
+        optional_Parameter_Type_List_n(util::syntax_ptr<class Parameter_Type_List_n>&& Parameter_Type_List_0);
+#endif
+
+    public:
+        virtual ~optional_Parameter_Type_List_n();
+    };
+
+    class list_of__comma__Initializer_n_content : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 254
+        dfa::position m_Position;
+    public:
+        // Rule 255
+        const util::syntax_ptr<_comma__n> _comma_;
+        const util::syntax_ptr<Initializer_n> Initializer;
+
+    public:
+        list_of__comma__Initializer_n_content(const util::syntax_ptr<class _comma__n>& _comma__0, const util::syntax_ptr<class Initializer_n>& Initializer_1);
+#if __cplusplus >= 201103L
+        list_of__comma__Initializer_n_content(util::syntax_ptr<class _comma__n>&& _comma__0, util::syntax_ptr<class Initializer_n>&& Initializer_1);
+#endif
+
+    public:
+        virtual ~list_of__comma__Initializer_n_content();
+    };
+
+    class list_of__comma__Initializer_n : public syntax_node {
+    public:
+        typedef util::syntax_ptr<class list_of__comma__Initializer_n_content> node_type;
+        typedef std::vector<node_type> data_type;
+        typedef data_type::const_iterator iterator;
+
+    private:
+        data_type m_Data;
+        dfa::position m_Position;
+
+    public:
+        inline operator const data_type&() const { return m_Data; }
+        inline const list_of__comma__Initializer_n_content* operator[](size_t index) const { return m_Data[index].item(); }
+        inline const size_t size() const { return m_Data.size(); }
+        inline iterator begin() const { return m_Data.begin(); }
+        inline iterator end() const { return m_Data.end(); }
+
+        inline void add_child(const node_type& newChild) { m_Data.push_back(newChild); }
+#if __cplusplus >= 201103L
+        inline void add_child(node_type&& newChild) { m_Data.push_back(std::move(newChild)); }
+#endif
+        inline void set_position(const dfa::position& newPos) { m_Position = newPos; }
+
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+    };
+
+    class optional__comma__n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 275
+        dfa::position m_Position;
+    public:
+        optional__comma__n(const dfa::position& pos);
+
+    public:
+        // Rule 276
+        const util::syntax_ptr<_comma__n> _comma_;
+
+    public:
+        optional__comma__n(const util::syntax_ptr<class _comma__n>& _comma__0);
+#if __cplusplus >= 201103L
+        optional__comma__n(util::syntax_ptr<class _comma__n>&& _comma__0);
+#endif
+
+    public:
+        virtual ~optional__comma__n();
+    };
+
+    class Statement_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 125
+        const util::syntax_ptr<Labeled_Statement_n> Labeled_Statement;
+
+    public:
+        Statement_n(const util::syntax_ptr<class Labeled_Statement_n>& Labeled_Statement_0);
+#if __cplusplus >= 201103L
+        Statement_n(util::syntax_ptr<class Labeled_Statement_n>&& Labeled_Statement_0);
+#endif
+
+    public:
+        // Rule 126
+        const util::syntax_ptr<Compound_Statement_n> Compound_Statement;
+
+    public:
+        Statement_n(const util::syntax_ptr<class Compound_Statement_n>& Compound_Statement_0);
+#if __cplusplus >= 201103L
+        Statement_n(util::syntax_ptr<class Compound_Statement_n>&& Compound_Statement_0);
+#endif
+
+    public:
+        // Rule 127
+        const util::syntax_ptr<Expression_Statement_n> Expression_Statement;
+
+    public:
+        Statement_n(const util::syntax_ptr<class Expression_Statement_n>& Expression_Statement_0);
+#if __cplusplus >= 201103L
+        Statement_n(util::syntax_ptr<class Expression_Statement_n>&& Expression_Statement_0);
+#endif
+
+    public:
+        // Rule 128
+        const util::syntax_ptr<Selection_Statement_n> Selection_Statement;
+
+    public:
+        Statement_n(const util::syntax_ptr<class Selection_Statement_n>& Selection_Statement_0);
+#if __cplusplus >= 201103L
+        Statement_n(util::syntax_ptr<class Selection_Statement_n>&& Selection_Statement_0);
+#endif
+
+    public:
+        // Rule 129
+        const util::syntax_ptr<Iteration_Statement_n> Iteration_Statement;
+
+    public:
+        Statement_n(const util::syntax_ptr<class Iteration_Statement_n>& Iteration_Statement_0);
+#if __cplusplus >= 201103L
+        Statement_n(util::syntax_ptr<class Iteration_Statement_n>&& Iteration_Statement_0);
+#endif
+
+    public:
+        // Rule 130
+        const util::syntax_ptr<Jump_Statement_n> Jump_Statement;
+
+    public:
+        Statement_n(const util::syntax_ptr<class Jump_Statement_n>& Jump_Statement_0);
+#if __cplusplus >= 201103L
+        Statement_n(util::syntax_ptr<class Jump_Statement_n>&& Jump_Statement_0);
+#endif
+
+    public:
+        virtual ~Statement_n();
+    };
+
+    class Labeled_Statement_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 131
+        const util::syntax_ptr<identifier_n> identifier;
+        const util::syntax_ptr<_colon__n> _colon_;
+        const util::syntax_ptr<Statement_n> Statement;
+
+    public:
+        Labeled_Statement_n(const util::syntax_ptr<class identifier_n>& identifier_0, const util::syntax_ptr<class _colon__n>& _colon__1, const util::syntax_ptr<class Statement_n>& Statement_2);
+#if __cplusplus >= 201103L
+        Labeled_Statement_n(util::syntax_ptr<class identifier_n>&& identifier_0, util::syntax_ptr<class _colon__n>&& _colon__1, util::syntax_ptr<class Statement_n>&& Statement_2);
+#endif
+
+    public:
+        // Rule 132
+        const util::syntax_ptr<case_n> case_2;
+        const util::syntax_ptr<Constant_Expression_n> Constant_Expression;
+        // _colon_ declared in another rule
+        // Statement declared in another rule
+
+    public:
+        Labeled_Statement_n(const util::syntax_ptr<class case_n>& case_0, const util::syntax_ptr<class Constant_Expression_n>& Constant_Expression_1, const util::syntax_ptr<class _colon__n>& _colon__2, const util::syntax_ptr<class Statement_n>& Statement_3);
+#if __cplusplus >= 201103L
+        Labeled_Statement_n(util::syntax_ptr<class case_n>&& case_0, util::syntax_ptr<class Constant_Expression_n>&& Constant_Expression_1, util::syntax_ptr<class _colon__n>&& _colon__2, util::syntax_ptr<class Statement_n>&& Statement_3);
+#endif
+
+    public:
+        // Rule 133
+        const util::syntax_ptr<default_n> default_2;
+        // _colon_ declared in another rule
+        // Statement declared in another rule
+
+    public:
+        Labeled_Statement_n(const util::syntax_ptr<class default_n>& default_0, const util::syntax_ptr<class _colon__n>& _colon__1, const util::syntax_ptr<class Statement_n>& Statement_2);
+#if __cplusplus >= 201103L
+        Labeled_Statement_n(util::syntax_ptr<class default_n>&& default_0, util::syntax_ptr<class _colon__n>&& _colon__1, util::syntax_ptr<class Statement_n>&& Statement_2);
+#endif
+
+    public:
+        virtual ~Labeled_Statement_n();
+    };
+
+    class Compound_Statement_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 134
+        const util::syntax_ptr<_opencurly__n> _opencurly_;
+        const util::syntax_ptr<optional_Declaration_List_n> optional_Declaration_List;
+        const util::syntax_ptr<optional_Statement_List_n> optional_Statement_List;
+        const util::syntax_ptr<_closecurly__n> _closecurly_;
+
+    public:
+        Compound_Statement_n(const util::syntax_ptr<class _opencurly__n>& _opencurly__0, const util::syntax_ptr<class optional_Declaration_List_n>& optional_Declaration_List_1, const util::syntax_ptr<class optional_Statement_List_n>& optional_Statement_List_2, const util::syntax_ptr<class _closecurly__n>& _closecurly__3);
+#if __cplusplus >= 201103L
+        Compound_Statement_n(util::syntax_ptr<class _opencurly__n>&& _opencurly__0, util::syntax_ptr<class optional_Declaration_List_n>&& optional_Declaration_List_1, util::syntax_ptr<class optional_Statement_List_n>&& optional_Statement_List_2, util::syntax_ptr<class _closecurly__n>&& _closecurly__3);
+#endif
+
+    public:
+        virtual ~Compound_Statement_n();
+    };
+
+    class Expression_Statement_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 137
+        const util::syntax_ptr<optional_Expression_n> optional_Expression;
+        const util::syntax_ptr<_semicolon__n> _semicolon_;
+
+    public:
+        Expression_Statement_n(const util::syntax_ptr<class optional_Expression_n>& optional_Expression_0, const util::syntax_ptr<class _semicolon__n>& _semicolon__1);
+#if __cplusplus >= 201103L
+        Expression_Statement_n(util::syntax_ptr<class optional_Expression_n>&& optional_Expression_0, util::syntax_ptr<class _semicolon__n>&& _semicolon__1);
+#endif
+
+    public:
+        virtual ~Expression_Statement_n();
+    };
+
+    class Selection_Statement_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 138
+        const util::syntax_ptr<if_n> if_2;
+        const util::syntax_ptr<_openparen__n> _openparen_;
+        const util::syntax_ptr<Expression_n> Expression;
+        const util::syntax_ptr<_closeparen__n> _closeparen_;
+        const util::syntax_ptr<Statement_n> Statement;
+
+    public:
+        Selection_Statement_n(const util::syntax_ptr<class if_n>& if_0, const util::syntax_ptr<class _openparen__n>& _openparen__1, const util::syntax_ptr<class Expression_n>& Expression_2, const util::syntax_ptr<class _closeparen__n>& _closeparen__3, const util::syntax_ptr<class Statement_n>& Statement_4);
+#if __cplusplus >= 201103L
+        Selection_Statement_n(util::syntax_ptr<class if_n>&& if_0, util::syntax_ptr<class _openparen__n>&& _openparen__1, util::syntax_ptr<class Expression_n>&& Expression_2, util::syntax_ptr<class _closeparen__n>&& _closeparen__3, util::syntax_ptr<class Statement_n>&& Statement_4);
+#endif
+
+    public:
+        // Rule 139
+        // if_2 declared in another rule
+        // _openparen_ declared in another rule
+        // Expression declared in another rule
+        // _closeparen_ declared in another rule
+        // Statement declared in another rule
+        const util::syntax_ptr<else_n> else_2;
+        const util::syntax_ptr<Statement_n> Statement_2;
+
+    public:
+        Selection_Statement_n(const util::syntax_ptr<class if_n>& if_0, const util::syntax_ptr<class _openparen__n>& _openparen__1, const util::syntax_ptr<class Expression_n>& Expression_2, const util::syntax_ptr<class _closeparen__n>& _closeparen__3, const util::syntax_ptr<class Statement_n>& Statement_4, const util::syntax_ptr<class else_n>& else_5, const util::syntax_ptr<class Statement_n>& Statement_6);
+#if __cplusplus >= 201103L
+        Selection_Statement_n(util::syntax_ptr<class if_n>&& if_0, util::syntax_ptr<class _openparen__n>&& _openparen__1, util::syntax_ptr<class Expression_n>&& Expression_2, util::syntax_ptr<class _closeparen__n>&& _closeparen__3, util::syntax_ptr<class Statement_n>&& Statement_4, util::syntax_ptr<class else_n>&& else_5, util::syntax_ptr<class Statement_n>&& Statement_6);
+#endif
+
+    public:
+        // Rule 140
+        const util::syntax_ptr<switch_n> switch_2;
+        // _openparen_ declared in another rule
+        // Expression declared in another rule
+        // _closeparen_ declared in another rule
+        // Statement declared in another rule
+
+    public:
+        Selection_Statement_n(const util::syntax_ptr<class switch_n>& switch_0, const util::syntax_ptr<class _openparen__n>& _openparen__1, const util::syntax_ptr<class Expression_n>& Expression_2, const util::syntax_ptr<class _closeparen__n>& _closeparen__3, const util::syntax_ptr<class Statement_n>& Statement_4);
+#if __cplusplus >= 201103L
+        Selection_Statement_n(util::syntax_ptr<class switch_n>&& switch_0, util::syntax_ptr<class _openparen__n>&& _openparen__1, util::syntax_ptr<class Expression_n>&& Expression_2, util::syntax_ptr<class _closeparen__n>&& _closeparen__3, util::syntax_ptr<class Statement_n>&& Statement_4);
+#endif
+
+    public:
+        virtual ~Selection_Statement_n();
+    };
+
+    class Iteration_Statement_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 141
+        const util::syntax_ptr<while_n> while_2;
+        const util::syntax_ptr<_openparen__n> _openparen_;
+        const util::syntax_ptr<Expression_n> Expression;
+        const util::syntax_ptr<_closeparen__n> _closeparen_;
+        const util::syntax_ptr<Statement_n> Statement;
+
+    public:
+        Iteration_Statement_n(const util::syntax_ptr<class while_n>& while_0, const util::syntax_ptr<class _openparen__n>& _openparen__1, const util::syntax_ptr<class Expression_n>& Expression_2, const util::syntax_ptr<class _closeparen__n>& _closeparen__3, const util::syntax_ptr<class Statement_n>& Statement_4);
+#if __cplusplus >= 201103L
+        Iteration_Statement_n(util::syntax_ptr<class while_n>&& while_0, util::syntax_ptr<class _openparen__n>&& _openparen__1, util::syntax_ptr<class Expression_n>&& Expression_2, util::syntax_ptr<class _closeparen__n>&& _closeparen__3, util::syntax_ptr<class Statement_n>&& Statement_4);
+#endif
+
+    public:
+        // Rule 142
+        const util::syntax_ptr<do_n> do_2;
+        // Statement declared in another rule
+        // while_2 declared in another rule
+        // _openparen_ declared in another rule
+        // Expression declared in another rule
+        // _closeparen_ declared in another rule
+
+    public:
+        Iteration_Statement_n(const util::syntax_ptr<class do_n>& do_0, const util::syntax_ptr<class Statement_n>& Statement_1, const util::syntax_ptr<class while_n>& while_2, const util::syntax_ptr<class _openparen__n>& _openparen__3, const util::syntax_ptr<class Expression_n>& Expression_4, const util::syntax_ptr<class _closeparen__n>& _closeparen__5);
+#if __cplusplus >= 201103L
+        Iteration_Statement_n(util::syntax_ptr<class do_n>&& do_0, util::syntax_ptr<class Statement_n>&& Statement_1, util::syntax_ptr<class while_n>&& while_2, util::syntax_ptr<class _openparen__n>&& _openparen__3, util::syntax_ptr<class Expression_n>&& Expression_4, util::syntax_ptr<class _closeparen__n>&& _closeparen__5);
+#endif
+
+    public:
+        // Rule 143
+        const util::syntax_ptr<for_n> for_2;
+        // _openparen_ declared in another rule
+        const util::syntax_ptr<Expression_Statement_n> Expression_Statement;
+        const util::syntax_ptr<Expression_Statement_n> Expression_Statement_2;
+        const util::syntax_ptr<optional_Expression_n> optional_Expression;
+        // _closeparen_ declared in another rule
+        // Statement declared in another rule
+
+    public:
+        Iteration_Statement_n(const util::syntax_ptr<class for_n>& for_0, const util::syntax_ptr<class _openparen__n>& _openparen__1, const util::syntax_ptr<class Expression_Statement_n>& Expression_Statement_2, const util::syntax_ptr<class Expression_Statement_n>& Expression_Statement_3, const util::syntax_ptr<class optional_Expression_n>& optional_Expression_4, const util::syntax_ptr<class _closeparen__n>& _closeparen__5, const util::syntax_ptr<class Statement_n>& Statement_6);
+#if __cplusplus >= 201103L
+        Iteration_Statement_n(util::syntax_ptr<class for_n>&& for_0, util::syntax_ptr<class _openparen__n>&& _openparen__1, util::syntax_ptr<class Expression_Statement_n>&& Expression_Statement_2, util::syntax_ptr<class Expression_Statement_n>&& Expression_Statement_3, util::syntax_ptr<class optional_Expression_n>&& optional_Expression_4, util::syntax_ptr<class _closeparen__n>&& _closeparen__5, util::syntax_ptr<class Statement_n>&& Statement_6);
+#endif
+
+    public:
+        virtual ~Iteration_Statement_n();
+    };
+
+    class Jump_Statement_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 144
+        const util::syntax_ptr<goto_n> goto_2;
+        const util::syntax_ptr<identifier_n> identifier;
+        const util::syntax_ptr<_semicolon__n> _semicolon_;
+
+    public:
+        Jump_Statement_n(const util::syntax_ptr<class goto_n>& goto_0, const util::syntax_ptr<class identifier_n>& identifier_1, const util::syntax_ptr<class _semicolon__n>& _semicolon__2);
+#if __cplusplus >= 201103L
+        Jump_Statement_n(util::syntax_ptr<class goto_n>&& goto_0, util::syntax_ptr<class identifier_n>&& identifier_1, util::syntax_ptr<class _semicolon__n>&& _semicolon__2);
+#endif
+
+    public:
+        // Rule 145
+        const util::syntax_ptr<continue_n> continue_2;
+        // _semicolon_ declared in another rule
+
+    public:
+        Jump_Statement_n(const util::syntax_ptr<class continue_n>& continue_0, const util::syntax_ptr<class _semicolon__n>& _semicolon__1);
+#if __cplusplus >= 201103L
+        Jump_Statement_n(util::syntax_ptr<class continue_n>&& continue_0, util::syntax_ptr<class _semicolon__n>&& _semicolon__1);
+#endif
+
+    public:
+        // Rule 146
+        const util::syntax_ptr<break_n> break_2;
+        // _semicolon_ declared in another rule
+
+    public:
+        Jump_Statement_n(const util::syntax_ptr<class break_n>& break_0, const util::syntax_ptr<class _semicolon__n>& _semicolon__1);
+#if __cplusplus >= 201103L
+        Jump_Statement_n(util::syntax_ptr<class break_n>&& break_0, util::syntax_ptr<class _semicolon__n>&& _semicolon__1);
+#endif
+
+    public:
+        // Rule 147
+        const util::syntax_ptr<return_n> return_2;
+        // _semicolon_ declared in another rule
+
+    public:
+        Jump_Statement_n(const util::syntax_ptr<class return_n>& return_0, const util::syntax_ptr<class _semicolon__n>& _semicolon__1);
+#if __cplusplus >= 201103L
+        Jump_Statement_n(util::syntax_ptr<class return_n>&& return_0, util::syntax_ptr<class _semicolon__n>&& _semicolon__1);
+#endif
+
+    public:
+        // Rule 148
+        // return_2 declared in another rule
+        const util::syntax_ptr<Expression_n> Expression;
+        // _semicolon_ declared in another rule
+
+    public:
+        Jump_Statement_n(const util::syntax_ptr<class return_n>& return_0, const util::syntax_ptr<class Expression_n>& Expression_1, const util::syntax_ptr<class _semicolon__n>& _semicolon__2);
+#if __cplusplus >= 201103L
+        Jump_Statement_n(util::syntax_ptr<class return_n>&& return_0, util::syntax_ptr<class Expression_n>&& Expression_1, util::syntax_ptr<class _semicolon__n>&& _semicolon__2);
+#endif
+
+    public:
+        virtual ~Jump_Statement_n();
+    };
+
+    class Declaration_List_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 135
+        const util::syntax_ptr<list_of_unknown_item_Declaration_n> list_of_unknown_item_Declaration;
+
+    public:
+        Declaration_List_n(const util::syntax_ptr<class list_of_unknown_item_Declaration_n>& list_of_unknown_item_Declaration_0);
+#if __cplusplus >= 201103L
+        Declaration_List_n(util::syntax_ptr<class list_of_unknown_item_Declaration_n>&& list_of_unknown_item_Declaration_0);
+#endif
+
+    public:
+        virtual ~Declaration_List_n();
+    };
+
+    class optional_Declaration_List_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 172
+        dfa::position m_Position;
+    public:
+        optional_Declaration_List_n(const dfa::position& pos);
+
+    public:
+        // Rule 173
+        const util::syntax_ptr<Declaration_List_n> Declaration_List;
+
+    public:
+        optional_Declaration_List_n(const util::syntax_ptr<class Declaration_List_n>& Declaration_List_0);
+#if __cplusplus >= 201103L
+        optional_Declaration_List_n(util::syntax_ptr<class Declaration_List_n>&& Declaration_List_0);
+#endif
+
+    public:
+        virtual ~optional_Declaration_List_n();
+    };
+
+    class Statement_List_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 136
+        const util::syntax_ptr<list_of_Statement_n> list_of_Statement;
+
+    public:
+        Statement_List_n(const util::syntax_ptr<class list_of_Statement_n>& list_of_Statement_0);
+#if __cplusplus >= 201103L
+        Statement_List_n(util::syntax_ptr<class list_of_Statement_n>&& list_of_Statement_0);
+#endif
+
+    public:
+        virtual ~Statement_List_n();
+    };
+
+    class optional_Statement_List_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 237
+        dfa::position m_Position;
+    public:
+        optional_Statement_List_n(const dfa::position& pos);
+
+    public:
+        // Rule 238
+        const util::syntax_ptr<Statement_List_n> Statement_List;
+
+    public:
+        optional_Statement_List_n(const util::syntax_ptr<class Statement_List_n>& Statement_List_0);
+#if __cplusplus >= 201103L
+        optional_Statement_List_n(util::syntax_ptr<class Statement_List_n>&& Statement_List_0);
+#endif
+
+    public:
+        virtual ~optional_Statement_List_n();
+    };
+
+    class list_of_unknown_item_Declaration_n_content : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 174
+        const util::syntax_ptr<Declaration_n> Declaration;
+
+    public:
+        list_of_unknown_item_Declaration_n_content(const util::syntax_ptr<class Declaration_n>& Declaration_0);
+#if __cplusplus >= 201103L
+        list_of_unknown_item_Declaration_n_content(util::syntax_ptr<class Declaration_n>&& Declaration_0);
+#endif
+
+    public:
+        // Rule 175
+        // Declaration declared in another rule
+
+    public:
+        virtual ~list_of_unknown_item_Declaration_n_content();
+    };
+
+    class list_of_unknown_item_Declaration_n : public syntax_node {
+    public:
+        typedef util::syntax_ptr<class list_of_unknown_item_Declaration_n_content> node_type;
+        typedef std::vector<node_type> data_type;
+        typedef data_type::const_iterator iterator;
+
+    private:
+        data_type m_Data;
+        dfa::position m_Position;
+
+    public:
+        inline operator const data_type&() const { return m_Data; }
+        inline const list_of_unknown_item_Declaration_n_content* operator[](size_t index) const { return m_Data[index].item(); }
+        inline const size_t size() const { return m_Data.size(); }
+        inline iterator begin() const { return m_Data.begin(); }
+        inline iterator end() const { return m_Data.end(); }
+
+        inline void add_child(const node_type& newChild) { m_Data.push_back(newChild); }
+#if __cplusplus >= 201103L
+        inline void add_child(node_type&& newChild) { m_Data.push_back(std::move(newChild)); }
+#endif
+        inline void set_position(const dfa::position& newPos) { m_Position = newPos; }
+
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+    };
+
+    class list_of_Statement_n_content : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 241
+        const util::syntax_ptr<Statement_n> Statement;
+
+    public:
+        list_of_Statement_n_content(const util::syntax_ptr<class Statement_n>& Statement_0);
+#if __cplusplus >= 201103L
+        list_of_Statement_n_content(util::syntax_ptr<class Statement_n>&& Statement_0);
+#endif
+
+    public:
+        // Rule 242
+        // Statement declared in another rule
+
+    public:
+        virtual ~list_of_Statement_n_content();
+    };
+
+    class list_of_Statement_n : public syntax_node {
+    public:
+        typedef util::syntax_ptr<class list_of_Statement_n_content> node_type;
+        typedef std::vector<node_type> data_type;
+        typedef data_type::const_iterator iterator;
+
+    private:
+        data_type m_Data;
+        dfa::position m_Position;
+
+    public:
+        inline operator const data_type&() const { return m_Data; }
+        inline const list_of_Statement_n_content* operator[](size_t index) const { return m_Data[index].item(); }
+        inline const size_t size() const { return m_Data.size(); }
+        inline iterator begin() const { return m_Data.begin(); }
+        inline iterator end() const { return m_Data.end(); }
+
+        inline void add_child(const node_type& newChild) { m_Data.push_back(newChild); }
+#if __cplusplus >= 201103L
+        inline void add_child(node_type&& newChild) { m_Data.push_back(std::move(newChild)); }
+#endif
+        inline void set_position(const dfa::position& newPos) { m_Position = newPos; }
+
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+    };
+
+    class optional_Expression_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 239
+        dfa::position m_Position;
+    public:
+        optional_Expression_n(const dfa::position& pos);
+
+    public:
+        // Rule 240
+        const util::syntax_ptr<Expression_n> Expression;
+
+    public:
+        optional_Expression_n(const util::syntax_ptr<class Expression_n>& Expression_0);
+#if __cplusplus >= 201103L
+        optional_Expression_n(util::syntax_ptr<class Expression_n>&& Expression_0);
+#endif
+
+    public:
+        virtual ~optional_Expression_n();
+    };
+
+    class Translation_Unit_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 149
+        const util::syntax_ptr<list_of_External_Declaration_n> list_of_External_Declaration;
+
+    public:
+        Translation_Unit_n(const util::syntax_ptr<class list_of_External_Declaration_n>& list_of_External_Declaration_0);
+#if __cplusplus >= 201103L
+        Translation_Unit_n(util::syntax_ptr<class list_of_External_Declaration_n>&& list_of_External_Declaration_0);
+#endif
+
+    public:
+        virtual ~Translation_Unit_n();
+    };
+
+    class External_Declaration_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 150
+        const util::syntax_ptr<Function_Definition_n> Function_Definition;
+
+    public:
+        External_Declaration_n(const util::syntax_ptr<class Function_Definition_n>& Function_Definition_0);
+#if __cplusplus >= 201103L
+        External_Declaration_n(util::syntax_ptr<class Function_Definition_n>&& Function_Definition_0);
+#endif
+
+    public:
+        // Rule 151
+        const util::syntax_ptr<Declaration_n> Declaration;
+
+    public:
+        External_Declaration_n(const util::syntax_ptr<class Declaration_n>& Declaration_0);
+#if __cplusplus >= 201103L
+        External_Declaration_n(util::syntax_ptr<class Declaration_n>&& Declaration_0);
+#endif
+
+    public:
+        virtual ~External_Declaration_n();
+    };
+
+    class list_of_External_Declaration_n_content : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 162
+        const util::syntax_ptr<External_Declaration_n> External_Declaration;
+
+    public:
+        list_of_External_Declaration_n_content(const util::syntax_ptr<class External_Declaration_n>& External_Declaration_0);
+#if __cplusplus >= 201103L
+        list_of_External_Declaration_n_content(util::syntax_ptr<class External_Declaration_n>&& External_Declaration_0);
+#endif
+
+    public:
+        // Rule 163
+        // External_Declaration declared in another rule
+
+    public:
+        virtual ~list_of_External_Declaration_n_content();
+    };
+
+    class list_of_External_Declaration_n : public syntax_node {
+    public:
+        typedef util::syntax_ptr<class list_of_External_Declaration_n_content> node_type;
+        typedef std::vector<node_type> data_type;
+        typedef data_type::const_iterator iterator;
+
+    private:
+        data_type m_Data;
+        dfa::position m_Position;
+
+    public:
+        inline operator const data_type&() const { return m_Data; }
+        inline const list_of_External_Declaration_n_content* operator[](size_t index) const { return m_Data[index].item(); }
+        inline const size_t size() const { return m_Data.size(); }
+        inline iterator begin() const { return m_Data.begin(); }
+        inline iterator end() const { return m_Data.end(); }
+
+        inline void add_child(const node_type& newChild) { m_Data.push_back(newChild); }
+#if __cplusplus >= 201103L
+        inline void add_child(node_type&& newChild) { m_Data.push_back(std::move(newChild)); }
+#endif
+        inline void set_position(const dfa::position& newPos) { m_Position = newPos; }
+
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+    };
+
+    class Function_Definition_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        // Rule 152
+        const util::syntax_ptr<Declaration_Specifiers_n> Declaration_Specifiers;
+        const util::syntax_ptr<Declarator_n> Declarator;
+        const util::syntax_ptr<optional_Declaration_List_n> optional_Declaration_List;
+        const util::syntax_ptr<Compound_Statement_n> Compound_Statement;
+
+    public:
+        Function_Definition_n(const util::syntax_ptr<class Declaration_Specifiers_n>& Declaration_Specifiers_0, const util::syntax_ptr<class Declarator_n>& Declarator_1, const util::syntax_ptr<class optional_Declaration_List_n>& optional_Declaration_List_2, const util::syntax_ptr<class Compound_Statement_n>& Compound_Statement_3);
+#if __cplusplus >= 201103L
+        Function_Definition_n(util::syntax_ptr<class Declaration_Specifiers_n>&& Declaration_Specifiers_0, util::syntax_ptr<class Declarator_n>&& Declarator_1, util::syntax_ptr<class optional_Declaration_List_n>&& optional_Declaration_List_2, util::syntax_ptr<class Compound_Statement_n>&& Compound_Statement_3);
+#endif
+
+    public:
+        // Rule 153
+        // Declarator declared in another rule
+        // optional_Declaration_List declared in another rule
+        // Compound_Statement declared in another rule
+
+    public:
+        Function_Definition_n(const util::syntax_ptr<class Declarator_n>& Declarator_0, const util::syntax_ptr<class optional_Declaration_List_n>& optional_Declaration_List_1, const util::syntax_ptr<class Compound_Statement_n>& Compound_Statement_2);
+#if __cplusplus >= 201103L
+        Function_Definition_n(util::syntax_ptr<class Declarator_n>&& Declarator_0, util::syntax_ptr<class optional_Declaration_List_n>&& optional_Declaration_List_1, util::syntax_ptr<class Compound_Statement_n>&& Compound_Statement_2);
+#endif
+
+    public:
+        virtual ~Function_Definition_n();
+    };
+
+    class end_of_input_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~end_of_input_n();
+    };
+
+    class end_of_guard_n : public syntax_node {
+    private:
+        int m_Rule;
+
+    public:
+        virtual dfa::position pos() const;
+        virtual dfa::position final_pos() const;
+
+    public:
+        virtual ~end_of_guard_n();
+    };
+
+    class parser_actions {
+    public:
+        typedef util::syntax_ptr<syntax_node> node;
+        typedef lr::parser<node, parser_actions> parser;
+        typedef parser::reduce_list reduce_list;
+
+    private:
+        dfa::lexeme_stream* m_Stream;
+        bool m_OwnStream;
+
+        parser_actions(parser_actions& noCopying);
+        parser_actions& operator=(const parser_actions& noCopying);
+
+    public:
+        parser_actions(dfa::lexeme_stream* stream, bool ownStream = false)
+        : m_Stream(stream)
+        , m_OwnStream(ownStream) { }
+
+        ~parser_actions() {
+            if (m_OwnStream && m_Stream) {
+                delete m_Stream;
+                m_Stream = NULL;
+            }
+        }
+
+        inline dfa::lexeme* read() {
+            dfa::lexeme* result = NULL;
+            (*m_Stream) >> result;
+            return result;
+        }
+
+        node shift(const dfa::lexeme_container& lexeme);
+
+        node reduce(int nonterminal, int rule, const reduce_list& reduce, const dfa::position& lookaheadPosition);
+    };
+
+public:
+    class parser_events : public lr::parser_events {
+    public:
+        virtual value reduce(int nonterminal, int rule, const value_list& values);
+
+        virtual value reduce_Constant(int rule, const value_list& values) {
+            return lr::parser_events::reduce(1, rule, values);
+        }
+
+        virtual value reduce_Primary_Expression(int rule, const value_list& values) {
+            return lr::parser_events::reduce(2, rule, values);
+        }
+
+        virtual value reduce_Expression(int rule, const value_list& values) {
+            return lr::parser_events::reduce(3, rule, values);
+        }
+
+        virtual value reduce_Postfix_Expression(int rule, const value_list& values) {
+            return lr::parser_events::reduce(4, rule, values);
+        }
+
+        virtual value reduce_Argument_Expression_List(int rule, const value_list& values) {
+            return lr::parser_events::reduce(5, rule, values);
+        }
+
+        virtual value reduce_optional_Argument_Expression_List(int rule, const value_list& values) {
+            return lr::parser_events::reduce(6, rule, values);
+        }
+
+        virtual value reduce_Assignment_Expression(int rule, const value_list& values) {
+            return lr::parser_events::reduce(7, rule, values);
+        }
+
+        virtual value reduce_list_of__comma__Assignment_Expression(int rule, const value_list& values) {
+            return lr::parser_events::reduce(8, rule, values);
+        }
+
+        virtual value reduce_Unary_Expression(int rule, const value_list& values) {
+            return lr::parser_events::reduce(9, rule, values);
+        }
+
+        virtual value reduce_one_of__tilde__or__exclamation_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(10, rule, values);
+        }
+
+        virtual value reduce_one_of___or_one_of__tilde__or__exclamation_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(11, rule, values);
+        }
+
+        virtual value reduce_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(12, rule, values);
+        }
+
+        virtual value reduce_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(13, rule, values);
+        }
+
+        virtual value reduce_one_of__ampersand__or_one_of__star__or_one_of__plus__or_one_of___or_one_of__tilde__or__exclamation_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(14, rule, values);
+        }
+
+        virtual value reduce_Cast_Expression(int rule, const value_list& values) {
+            return lr::parser_events::reduce(15, rule, values);
+        }
+
+        virtual value reduce_Type_Name(int rule, const value_list& values) {
+            return lr::parser_events::reduce(16, rule, values);
+        }
+
+        virtual value reduce_Unambiguous_Cast(int rule, const value_list& values) {
+            return lr::parser_events::reduce(18, rule, values);
+        }
+
+        virtual value reduce_Ambiguous_Cast(int rule, const value_list& values) {
+            return lr::parser_events::reduce(19, rule, values);
+        }
+
+        virtual value reduce_Unambiguous_Cast_Follow(int rule, const value_list& values) {
+            return lr::parser_events::reduce(20, rule, values);
+        }
+
+        virtual value reduce_Simple_Type_Specifier(int rule, const value_list& values) {
+            return lr::parser_events::reduce(22, rule, values);
+        }
+
+        virtual value reduce_Type_Qualifier(int rule, const value_list& values) {
+            return lr::parser_events::reduce(23, rule, values);
+        }
+
+        virtual value reduce_one_of_Simple_Type_Specifier_or_Type_Qualifier(int rule, const value_list& values) {
+            return lr::parser_events::reduce(24, rule, values);
+        }
+
+        virtual value reduce_Abstract_Declarator(int rule, const value_list& values) {
+            return lr::parser_events::reduce(25, rule, values);
+        }
+
+        virtual value reduce_optional_Abstract_Declarator(int rule, const value_list& values) {
+            return lr::parser_events::reduce(26, rule, values);
+        }
+
+        virtual value reduce_one_of_identifier_or_Constant(int rule, const value_list& values) {
+            return lr::parser_events::reduce(27, rule, values);
+        }
+
+        virtual value reduce_one_of_sizeof_or_one_of_identifier_or_Constant(int rule, const value_list& values) {
+            return lr::parser_events::reduce(28, rule, values);
+        }
+
+        virtual value reduce_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant(int rule, const value_list& values) {
+            return lr::parser_events::reduce(29, rule, values);
+        }
+
+        virtual value reduce_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant(int rule, const value_list& values) {
+            return lr::parser_events::reduce(30, rule, values);
+        }
+
+        virtual value reduce_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant(int rule, const value_list& values) {
+            return lr::parser_events::reduce(31, rule, values);
+        }
+
+        virtual value reduce_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant(int rule, const value_list& values) {
+            return lr::parser_events::reduce(32, rule, values);
+        }
+
+        virtual value reduce_one_of__plus__plus__Unary_Expression_or_one_of____Unary_Expression_or_one_of__ampersand__or_one_of__tilde__or_one_of__exclamation__or_one_of_sizeof_or_one_of_identifier_or_Constant(int rule, const value_list& values) {
+            return lr::parser_events::reduce(33, rule, values);
+        }
+
+        virtual value reduce_Ambiguous_Cast_Follow(int rule, const value_list& values) {
+            return lr::parser_events::reduce(34, rule, values);
+        }
+
+        virtual value reduce_one_of___or__openparen__Expression__closeparen_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(36, rule, values);
+        }
+
+        virtual value reduce_one_of__star__or_one_of___or__openparen__Expression__closeparen_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(37, rule, values);
+        }
+
+        virtual value reduce_one_of__plus__or_one_of__star__or_one_of___or__openparen__Expression__closeparen_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(38, rule, values);
+        }
+
+        virtual value reduce_Multiplicative_Expression(int rule, const value_list& values) {
+            return lr::parser_events::reduce(39, rule, values);
+        }
+
+        virtual value reduce_one_of__slash__or__percent_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(40, rule, values);
+        }
+
+        virtual value reduce_one_of__star__or_one_of__slash__or__percent_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(41, rule, values);
+        }
+
+        virtual value reduce_Additive_Expression(int rule, const value_list& values) {
+            return lr::parser_events::reduce(42, rule, values);
+        }
+
+        virtual value reduce_one_of__plus__or__(int rule, const value_list& values) {
+            return lr::parser_events::reduce(43, rule, values);
+        }
+
+        virtual value reduce_Shift_Expression(int rule, const value_list& values) {
+            return lr::parser_events::reduce(44, rule, values);
+        }
+
+        virtual value reduce_one_of__lessthan__lessthan__or__greaterthan__greaterthan_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(45, rule, values);
+        }
+
+        virtual value reduce_Relational_Expression(int rule, const value_list& values) {
+            return lr::parser_events::reduce(46, rule, values);
+        }
+
+        virtual value reduce_one_of__lessthan__equals__or__greaterthan__equals_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(47, rule, values);
+        }
+
+        virtual value reduce_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(48, rule, values);
+        }
+
+        virtual value reduce_one_of__lessthan__or_one_of__greaterthan__or_one_of__lessthan__equals__or__greaterthan__equals_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(49, rule, values);
+        }
+
+        virtual value reduce_Equality_Expression(int rule, const value_list& values) {
+            return lr::parser_events::reduce(50, rule, values);
+        }
+
+        virtual value reduce_one_of__equals__equals__or__exclamation__equals_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(51, rule, values);
+        }
+
+        virtual value reduce_And_Expression(int rule, const value_list& values) {
+            return lr::parser_events::reduce(52, rule, values);
+        }
+
+        virtual value reduce_Exclusive_Or_Expression(int rule, const value_list& values) {
+            return lr::parser_events::reduce(53, rule, values);
+        }
+
+        virtual value reduce_Inclusive_Or_Expression(int rule, const value_list& values) {
+            return lr::parser_events::reduce(54, rule, values);
+        }
+
+        virtual value reduce_Logical_And_Expression(int rule, const value_list& values) {
+            return lr::parser_events::reduce(55, rule, values);
+        }
+
+        virtual value reduce_Logical_Or_Expression(int rule, const value_list& values) {
+            return lr::parser_events::reduce(56, rule, values);
+        }
+
+        virtual value reduce_Conditional_Expression(int rule, const value_list& values) {
+            return lr::parser_events::reduce(57, rule, values);
+        }
+
+        virtual value reduce_one_of__cicumflex__equals__or__pipe__equals_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(58, rule, values);
+        }
+
+        virtual value reduce_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(59, rule, values);
+        }
+
+        virtual value reduce_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(60, rule, values);
+        }
+
+        virtual value reduce_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(61, rule, values);
+        }
+
+        virtual value reduce_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(62, rule, values);
+        }
+
+        virtual value reduce_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(63, rule, values);
+        }
+
+        virtual value reduce_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(64, rule, values);
+        }
+
+        virtual value reduce_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(65, rule, values);
+        }
+
+        virtual value reduce_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(66, rule, values);
+        }
+
+        virtual value reduce_one_of__equals__or_one_of__star__equals__or_one_of__slash__equals__or_one_of__percent__equals__or_one_of__plus__equals__or_one_of___equals__or_one_of__lessthan__lessthan__equals__or_one_of__greaterthan__greaterthan__equals__or_one_of__ampersand__equals__or_one_of__cicumflex__equals__or__pipe__equals_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(67, rule, values);
+        }
+
+        virtual value reduce_Constant_Expression(int rule, const value_list& values) {
+            return lr::parser_events::reduce(68, rule, values);
+        }
+
+        virtual value reduce_Declaration(int rule, const value_list& values) {
+            return lr::parser_events::reduce(69, rule, values);
+        }
+
+        virtual value reduce_Declaration_Specifiers(int rule, const value_list& values) {
+            return lr::parser_events::reduce(70, rule, values);
+        }
+
+        virtual value reduce_Init_Declarator(int rule, const value_list& values) {
+            return lr::parser_events::reduce(71, rule, values);
+        }
+
+        virtual value reduce_one_of__semicolon__or__comma_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(72, rule, values);
+        }
+
+        virtual value reduce_one_of__semicolon__or_Init_Declarator_one_of__semicolon__or__comma_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(73, rule, values);
+        }
+
+        virtual value reduce_Init_Declarator_List(int rule, const value_list& values) {
+            return lr::parser_events::reduce(75, rule, values);
+        }
+
+        virtual value reduce_optional_Init_Declarator_List(int rule, const value_list& values) {
+            return lr::parser_events::reduce(76, rule, values);
+        }
+
+        virtual value reduce_Storage_Class_Specifier(int rule, const value_list& values) {
+            return lr::parser_events::reduce(77, rule, values);
+        }
+
+        virtual value reduce_Type_Specifier(int rule, const value_list& values) {
+            return lr::parser_events::reduce(78, rule, values);
+        }
+
+        virtual value reduce_one_of_Type_Specifier_or_Type_Qualifier(int rule, const value_list& values) {
+            return lr::parser_events::reduce(79, rule, values);
+        }
+
+        virtual value reduce_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier(int rule, const value_list& values) {
+            return lr::parser_events::reduce(80, rule, values);
+        }
+
+        virtual value reduce_list_of_one_of_Storage_Class_Specifier_or_one_of_Type_Specifier_or_Type_Qualifier(int rule, const value_list& values) {
+            return lr::parser_events::reduce(81, rule, values);
+        }
+
+        virtual value reduce_list_of__comma__Init_Declarator(int rule, const value_list& values) {
+            return lr::parser_events::reduce(82, rule, values);
+        }
+
+        virtual value reduce_Declarator(int rule, const value_list& values) {
+            return lr::parser_events::reduce(83, rule, values);
+        }
+
+        virtual value reduce_Initializer(int rule, const value_list& values) {
+            return lr::parser_events::reduce(84, rule, values);
+        }
+
+        virtual value reduce_optional__equals__Initializer(int rule, const value_list& values) {
+            return lr::parser_events::reduce(85, rule, values);
+        }
+
+        virtual value reduce_Struct_Or_Union_Specifier(int rule, const value_list& values) {
+            return lr::parser_events::reduce(86, rule, values);
+        }
+
+        virtual value reduce_Enum_Specifier(int rule, const value_list& values) {
+            return lr::parser_events::reduce(87, rule, values);
+        }
+
+        virtual value reduce_one_of_struct_or_union(int rule, const value_list& values) {
+            return lr::parser_events::reduce(88, rule, values);
+        }
+
+        virtual value reduce_Struct_Declaration(int rule, const value_list& values) {
+            return lr::parser_events::reduce(89, rule, values);
+        }
+
+        virtual value reduce_list_of_Struct_Declaration(int rule, const value_list& values) {
+            return lr::parser_events::reduce(90, rule, values);
+        }
+
+        virtual value reduce_optional__opencurly__list_of_Struct_Declaration__closecurly_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(91, rule, values);
+        }
+
+        virtual value reduce_Specifier_Qualifier_List(int rule, const value_list& values) {
+            return lr::parser_events::reduce(92, rule, values);
+        }
+
+        virtual value reduce_Struct_Declarator_List(int rule, const value_list& values) {
+            return lr::parser_events::reduce(93, rule, values);
+        }
+
+        virtual value reduce_list_of_one_of_Type_Specifier_or_Type_Qualifier(int rule, const value_list& values) {
+            return lr::parser_events::reduce(95, rule, values);
+        }
+
+        virtual value reduce_Struct_Declarator(int rule, const value_list& values) {
+            return lr::parser_events::reduce(96, rule, values);
+        }
+
+        virtual value reduce_list_of__comma__Struct_Declarator(int rule, const value_list& values) {
+            return lr::parser_events::reduce(97, rule, values);
+        }
+
+        virtual value reduce_optional__colon__Constant_Expression(int rule, const value_list& values) {
+            return lr::parser_events::reduce(98, rule, values);
+        }
+
+        virtual value reduce_optional_identifier(int rule, const value_list& values) {
+            return lr::parser_events::reduce(99, rule, values);
+        }
+
+        virtual value reduce_Enumerator_List(int rule, const value_list& values) {
+            return lr::parser_events::reduce(100, rule, values);
+        }
+
+        virtual value reduce_Enumerator(int rule, const value_list& values) {
+            return lr::parser_events::reduce(101, rule, values);
+        }
+
+        virtual value reduce_list_of__comma__Enumerator(int rule, const value_list& values) {
+            return lr::parser_events::reduce(102, rule, values);
+        }
+
+        virtual value reduce_optional__equals__Constant_Expression(int rule, const value_list& values) {
+            return lr::parser_events::reduce(103, rule, values);
+        }
+
+        virtual value reduce_Pointer(int rule, const value_list& values) {
+            return lr::parser_events::reduce(104, rule, values);
+        }
+
+        virtual value reduce_optional_Pointer(int rule, const value_list& values) {
+            return lr::parser_events::reduce(105, rule, values);
+        }
+
+        virtual value reduce_Direct_Declarator(int rule, const value_list& values) {
+            return lr::parser_events::reduce(106, rule, values);
+        }
+
+        virtual value reduce_optional_Constant_Expression(int rule, const value_list& values) {
+            return lr::parser_events::reduce(107, rule, values);
+        }
+
+        virtual value reduce_Parameter_Type_List(int rule, const value_list& values) {
+            return lr::parser_events::reduce(108, rule, values);
+        }
+
+        virtual value reduce_Identifier_List(int rule, const value_list& values) {
+            return lr::parser_events::reduce(110, rule, values);
+        }
+
+        virtual value reduce_one_of_unknown_item_Parameter_Type_List_or_Identifier_List(int rule, const value_list& values) {
+            return lr::parser_events::reduce(111, rule, values);
+        }
+
+        virtual value reduce_list_of_Type_Qualifier(int rule, const value_list& values) {
+            return lr::parser_events::reduce(112, rule, values);
+        }
+
+        virtual value reduce_Parameter_Declarator(int rule, const value_list& values) {
+            return lr::parser_events::reduce(113, rule, values);
+        }
+
+        virtual value reduce_list_of__comma__Parameter_Declarator(int rule, const value_list& values) {
+            return lr::parser_events::reduce(114, rule, values);
+        }
+
+        virtual value reduce_optional__comma___dot__dot__dot_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(115, rule, values);
+        }
+
+        virtual value reduce_one_of__comma__or__closeparen_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(116, rule, values);
+        }
+
+        virtual value reduce_one_of_unknown_item_Declarator_or_Abstract_Declarator(int rule, const value_list& values) {
+            return lr::parser_events::reduce(118, rule, values);
+        }
+
+        virtual value reduce_optional_one_of_unknown_item_Declarator_or_Abstract_Declarator(int rule, const value_list& values) {
+            return lr::parser_events::reduce(119, rule, values);
+        }
+
+        virtual value reduce_list_of__comma__identifier(int rule, const value_list& values) {
+            return lr::parser_events::reduce(120, rule, values);
+        }
+
+        virtual value reduce_Direct_Abstract_Declarator(int rule, const value_list& values) {
+            return lr::parser_events::reduce(121, rule, values);
+        }
+
+        virtual value reduce_optional_Direct_Abstract_Declarator(int rule, const value_list& values) {
+            return lr::parser_events::reduce(122, rule, values);
+        }
+
+        virtual value reduce_one_of_Abstract_Declarator_or_Parameter_Type_List(int rule, const value_list& values) {
+            return lr::parser_events::reduce(123, rule, values);
+        }
+
+        virtual value reduce_optional_one_of_Abstract_Declarator_or_Parameter_Type_List(int rule, const value_list& values) {
+            return lr::parser_events::reduce(124, rule, values);
+        }
+
+        virtual value reduce_optional_Parameter_Type_List(int rule, const value_list& values) {
+            return lr::parser_events::reduce(125, rule, values);
+        }
+
+        virtual value reduce_list_of__comma__Initializer(int rule, const value_list& values) {
+            return lr::parser_events::reduce(126, rule, values);
+        }
+
+        virtual value reduce_optional__comma_(int rule, const value_list& values) {
+            return lr::parser_events::reduce(127, rule, values);
+        }
+
+        virtual value reduce_Statement(int rule, const value_list& values) {
+            return lr::parser_events::reduce(128, rule, values);
+        }
+
+        virtual value reduce_Labeled_Statement(int rule, const value_list& values) {
+            return lr::parser_events::reduce(129, rule, values);
+        }
+
+        virtual value reduce_Compound_Statement(int rule, const value_list& values) {
+            return lr::parser_events::reduce(130, rule, values);
+        }
+
+        virtual value reduce_Expression_Statement(int rule, const value_list& values) {
+            return lr::parser_events::reduce(131, rule, values);
+        }
+
+        virtual value reduce_Selection_Statement(int rule, const value_list& values) {
+            return lr::parser_events::reduce(132, rule, values);
+        }
+
+        virtual value reduce_Iteration_Statement(int rule, const value_list& values) {
+            return lr::parser_events::reduce(133, rule, values);
+        }
+
+        virtual value reduce_Jump_Statement(int rule, const value_list& values) {
+            return lr::parser_events::reduce(134, rule, values);
+        }
+
+        virtual value reduce_Declaration_List(int rule, const value_list& values) {
+            return lr::parser_events::reduce(135, rule, values);
+        }
+
+        virtual value reduce_optional_Declaration_List(int rule, const value_list& values) {
+            return lr::parser_events::reduce(136, rule, values);
+        }
+
+        virtual value reduce_Statement_List(int rule, const value_list& values) {
+            return lr::parser_events::reduce(137, rule, values);
+        }
+
+        virtual value reduce_optional_Statement_List(int rule, const value_list& values) {
+            return lr::parser_events::reduce(138, rule, values);
+        }
+
+        virtual value reduce_list_of_unknown_item_Declaration(int rule, const value_list& values) {
+            return lr::parser_events::reduce(140, rule, values);
+        }
+
+        virtual value reduce_list_of_Statement(int rule, const value_list& values) {
+            return lr::parser_events::reduce(141, rule, values);
+        }
+
+        virtual value reduce_optional_Expression(int rule, const value_list& values) {
+            return lr::parser_events::reduce(142, rule, values);
+        }
+
+        virtual value reduce_Translation_Unit(int rule, const value_list& values) {
+            return lr::parser_events::reduce(143, rule, values);
+        }
+
+        virtual value reduce_External_Declaration(int rule, const value_list& values) {
+            return lr::parser_events::reduce(144, rule, values);
+        }
+
+        virtual value reduce_list_of_External_Declaration(int rule, const value_list& values) {
+            return lr::parser_events::reduce(145, rule, values);
+        }
+
+        virtual value reduce_Function_Definition(int rule, const value_list& values) {
+            return lr::parser_events::reduce(146, rule, values);
+        }
+    };
+
+public:
+    typedef util::syntax_ptr<syntax_node> syntax_node_container;
+    typedef lr::parser<syntax_node_container, parser_actions, lr::no_parser_trace, lr::small_parser_tables> ast_parser_type;
+    static const ast_parser_type ast_parser;
+
+    typedef lr::parser<lr::parser_events::value, lr::event_parser_actions, lr::no_parser_trace, lr::small_parser_tables> event_parser_type;
+    static const event_parser_type event_parser;
+
+    typedef lr::parser<int, lr::tape_parser_actions, lr::no_parser_trace, lr::small_parser_tables> tape_parser_type;
+    static const tape_parser_type tape_parser;
+
+    typedef lr::lazy_syntax_tree<syntax_node_container, parser_actions> lazy_tree;
+
+public:
+    typedef ast_parser_type::state state;
+    typedef event_parser_type::state event_state;
+    typedef tape_parser_type::state tape_state;
+    inline static state* create_Translation_Unit(parser_actions* actions) {
+        return ast_parser.create_parser(actions, 0);
+    }
+
+    inline static state* create_Translation_Unit(dfa::lexeme_stream* stream, bool deleteStream = false) {
+        return ast_parser.create_parser(new parser_actions(stream, deleteStream), 0);
+    }
+
+    template<typename char_type, typename traits> inline static state* create_Translation_Unit(std::basic_istream<char_type, traits>& input) {
+        return create_Translation_Unit(skip_ignored(lexer.create_stream_from<char_type, traits>(input)), true);
+    }
+
+    template<typename char_type, typename custom_stream_alike> inline static state* create_Translation_Unit(custom_stream_alike& input) {
+        return create_Translation_Unit(skip_ignored(lexer.create_stream_from<char_type, custom_stream_alike>(input)), true);
+    }
+
+    inline static event_state* create_Translation_Unit_events(dfa::lexeme_stream* stream, parser_events* events, bool deleteStream = false) {
+        return event_parser.create_parser(new lr::event_parser_actions(stream, events, deleteStream), 0);
+    }
+
+    template<typename char_type, typename traits> inline static event_state* create_Translation_Unit_events(std::basic_istream<char_type, traits>& input, parser_events* events) {
+        return create_Translation_Unit_events(skip_ignored(lexer.create_stream_from<char_type, traits>(input)), events, true);
+    }
+
+    inline static tape_state* create_Translation_Unit_tape(dfa::lexeme_stream* stream, lr::syntax_tape* tape, bool deleteStream = false) {
+        return tape_parser.create_parser(new lr::tape_parser_actions(stream, tape, deleteStream), 0);
+    }
+
+    template<typename char_type, typename traits> inline static tape_state* create_Translation_Unit_tape(std::basic_istream<char_type, traits>& input, lr::syntax_tape* tape) {
+        return create_Translation_Unit_tape(skip_ignored(lexer.create_stream_from<char_type, traits>(input)), tape, true);
+    }
+
+};
+
+#endif
@@ -0,0 +1,71 @@
+/*
+ * Checks that stdin contains a valid JSON object, using the parser generated by
+ * the C output stage (which doesn't need the TameParse library)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "json_c.h"
+
+/* The deepest nesting this checker will accept */
+#define MAX_STACK 1024
+
+int main(void) {
+    static JSON_stack_entry stack[MAX_STACK];
+
+    char*       input       = NULL;
+    size_t      length      = 0;
+    size_t      capacity    = 0;
+    size_t      pos;
+    size_t      line        = 1;
+    size_t      column      = 1;
+    JSON_token  error;
+    JSON_result result;
+
+    /* Read the whole of stdin */
+    for (;;) {
+        size_t read;
+
+        if (length == capacity) {
+            char* grown;
+
+            capacity    = capacity ? capacity * 2 : 4096;
+            grown       = (char*) realloc(input, capacity);
+            if (!grown) {
+                free(input);
+                fprintf(stderr, "Out of memory\n");
+                return 2;
+            }
+            input = grown;
+        }
+
+        read = fread(input + length, 1, capacity - length, stdin);
+        if (read == 0) break;
+        length += read;
+    }
+
+    /* No callbacks are needed to check the syntax */
+    result = JSON_parse(input, length, JSON_start_Object, stack, MAX_STACK, NULL, NULL, &error);
+
+    if (result == JSON_overflow) {
+        fprintf(stderr, "Input is nested too deeply\n");
+    } else if (result == JSON_reject) {
+        for (pos = 0; pos < error.offset; ++pos) {
+            if (input[pos] == '\n') {
+                ++line;
+                column = 1;
+            } else {
+                ++column;
+            }
+        }
+
+        if (error.offset >= length) {
+            fprintf(stderr, "Syntax error: unexpected end of file\n");
+        } else {
+            fprintf(stderr, "Syntax error on line %lu, column %lu\n", (unsigned long) line, (unsigned long) column);
+        }
+    }
+
+    free(input);
+    return result == JSON_accept ? 0 : 1;
+}
@@ -10,14 +10,83 @@
 using namespace std;
 
 void pretty_print(const JSON::Object_n* obj, int indentAmount = 0);
-void pretty_print(const JSON::Value_n* value, int indentAmount);
+void pretty_print(const JSON::Value_n* value, int indentAmount = 0);
+
+//
+// Checks that stdin contains valid JSON without building an AST
+//
+int validate() {
+    // The default events just keep track of the lexemes on the parser stack
+    JSON::parser_events events;
+    JSON::event_state* parser = JSON::create_Object_events<char>(cin, &events);
+
+    if (!parser->parse()) {
+        if (parser->look().item()) {
+            cerr << "Syntax error on line " << parser->look()->pos().line() << ", column " << parser->look()->pos().column() << endl;
+        } else {
+            cerr << "Syntax error: unexpected end of file" << endl;
+        }
+
+        delete parser;
+        return 1;
+    }
+
+    delete parser;
+    return 0;
+}
+
+//
+// Receives each value in a file of JSON lines as soon as it has been parsed
+//
+class print_lines : public JSON::stream_events {
+public:
+    virtual bool completed_list_of_Value(const util::syntax_ptr<JSON::list_of_Value_n_content>& item) {
+        pretty_print(item->Value);
+        cout << endl;
+
+        // Returning true drops the value from the tree, so memory use doesn't grow with the size of the input
+        return true;
+    }
+};
+
+//
+// Pretty prints each value in a file of JSON lines from stdin, without keeping the whole file in memory
+//
+int pretty_print_lines() {
+    print_lines events;
+    JSON::state* parser = JSON::create_Lines_streaming<char>(cin, &events);
+
+    if (!parser->parse()) {
+        if (parser->look().item()) {
+            cerr << "Syntax error on line " << parser->look()->pos().line() << ", column " << parser->look()->pos().column() << endl;
+        } else {
+            cerr << "Syntax error: unexpected end of file" << endl;
+        }
+
+        delete parser;
+        return 1;
+    }
+
+    delete parser;
+    return 0;
+}
 
 //
 // Parses stdin as JSON and pretty prints it to stdout
 //
 int main(int argc, const char** argv) {
-    // Create the parser - unicode from wcin
-    JSON::state* parser = JSON::create_Object<wchar_t>(wcin);
+    // --validate only checks the syntax
+    if (argc > 1 && string(argv[1]) == "--validate") {
+        return validate();
+    }
+
+    // --lines prints each value in a file of JSON lines as it is parsed
+    if (argc > 1 && string(argv[1]) == "--lines") {
+        return pretty_print_lines();
+    }
+
+    // Create the parser - the lexer matches UTF-8, so this reads the bytes from cin without widening them
+    JSON::state* parser = JSON::create_Object<char>(cin);
 
     // Generate the AST
     bool success = parser->parse();
@@ -41,9 +110,9 @@ int main(int argc, const char** argv) {
     const JSON::Object_n* root = static_cast<const JSON::Object_n*>(parser->get_item().item());
 
     // Pretty-print the result
-    wcout << endl;
+    cout << endl;
     pretty_print(root);
-    wcout << endl;
+    cout << endl;
 
     // Exit success
     return 0;
@@ -53,47 +122,47 @@ int main(int argc, const char** argv) {
 // A fairly simple JSON pretty printer
 // ===
 
-wstring indent(int amount) {
+string indent(int amount) {
     if (amount > 0) {
-        return wstring(amount, L' ');
+        return string(amount, ' ');
     } else {
-        return wstring();
+        return string();
     }
 }
 
 void pretty_print(const JSON::Array_n* array, int indentAmount) {
-    wcout << L"[";
+    cout << "[";
 
     if (array->first) {
         // First array element
-        wcout << endl << indent(indentAmount+2);
+        cout << endl << indent(indentAmount+2);
         pretty_print(array->first, indentAmount+2);
 
         // Remainder of the elements
         // Using 'auto' would be sensible here, but we'll do it the old-fashioned way
         // (',' Value)* generates a AST type of 'list_of__comma__Value_n'
         for (JSON::list_of__comma__Value_n::iterator value = array->remainder->begin(); value != array->remainder->end(); ++value) {
-            wcout << L"," << endl << indent(indentAmount+2);
+            cout << "," << endl << indent(indentAmount+2);
             pretty_print((*value)->Value, indentAmount+2);
         }
     }
 
-    wcout << L"]";
+    cout << "]";
 }
 
 void pretty_print(const JSON::Value_n* value, int indentAmount) {
     // Print the various different items that can be in a value
     // The _2 names are generated by the tool to avoid clashes with other objects
     if (value->string_2) {
-        wcout << value->string_2->content<wchar_t>();
+        cout << value->string_2->content<char>();
     } else if (value->number) {
-        wcout << value->number->content<wchar_t>();
+        cout << value->number->content<char>();
     } else if (value->true_2) {
-        wcout << L"true";
+        cout << "true";
     } else if (value->false_2) {
-        wcout << L"false";
+        cout << "false";
     } else if (value->null) {
-        wcout << L"null";
+        cout << "null";
     } else if (value->Object) {
         pretty_print(value->Object, indentAmount);
     } else if (value->Array) {
@@ -102,25 +171,25 @@ void pretty_print(const JSON::Value_n* value, int indentAmount) {
 }
 
 void pretty_print(const JSON::Pair_n* pair, int indentAmount) {
-    wcout << pair->name->content<wchar_t>() << L": ";
+    cout << pair->name->content<char>() << ": ";
     pretty_print(pair->value, indentAmount+2);
 }
 
 void pretty_print(const JSON::Object_n* obj, int indentAmount) {
-    wcout << L"{";
+    cout << "{";
 
     // obj->first indicates the presence of a list of objects
     if (obj->first) {
-        wcout << endl << indent(indentAmount+2);
+        cout << endl << indent(indentAmount+2);
         pretty_print(obj->first, indentAmount+2);
 
         for (JSON::list_of__comma__Pair_n::iterator pair = obj->pairs->begin(); pair != obj->pairs->end(); ++pair) {
-            wcout << L"," << endl << indent(indentAmount+2);
+            cout << "," << endl << indent(indentAmount+2);
             pretty_print((*pair)->Pair, indentAmount + 2);
         }        
 
-        wcout << endl << indent(indentAmount);
+        cout << endl << indent(indentAmount);
     }
 
-    wcout << L"}";
+    cout << "}";
 }
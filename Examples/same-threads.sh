@@ -0,0 +1,55 @@
+#!/bin/sh
+#
+# Checks that the parsers generated for the examples are the same whatever the number of threads used to build them
+
+# The directory containing the definitions to generate
+definition_dir=`cd ${srcdir} && pwd`
+
+# Name of the tameparse runner
+tameparse=`pwd`/../parsetool/tameparse
+
+# Directory the generated parsers are written to
+output_dir=`mktemp -d` || exit 1
+trap 'rm -rf "${output_dir}"' EXIT
+
+success=1
+
+# Each line is the file to generate, followed by the language and the start symbol to use
+while read definition_file language start_symbol
+do
+	for threads in 1 4
+	do
+		# The output files are named the same way for each thread count, as the name appears in the generated code
+		mkdir -p "${output_dir}/${threads}"
+		( cd "${output_dir}/${threads}" && ${tameparse} --threads ${threads} -L "${language}" -S "${start_symbol}" -o parser "${definition_dir}/${definition_file}" ) > /dev/null
+		if [ "$?" -ne "0" ]; then
+			echo "${definition_file}: could not generate a parser with ${threads} threads"
+			success=0
+		fi
+	done
+
+	# The time each file was generated is written near the top, so that line is left out of the comparison
+	for generated_file in "${output_dir}/1"/*
+	do
+		generated_name=`basename "${generated_file}"`
+		grep -v "generated by TameParse at" "${output_dir}/1/${generated_name}" > "${output_dir}/serial"
+		grep -v "generated by TameParse at" "${output_dir}/4/${generated_name}" > "${output_dir}/threaded"
+
+		if ! cmp -s "${output_dir}/serial" "${output_dir}/threaded"; then
+			echo "${definition_file}: ${generated_name} generated with 4 threads is different to the one generated with 1 thread"
+			success=0
+		fi
+	done
+
+	rm -rf "${output_dir}/1" "${output_dir}/4"
+done <<EOF
+AnsiC.tp Ansi-C <Translation-Unit>
+C99.tp C99 <Translation-Unit>
+Pascal.tp Pascal <Program>
+ContextSensitive.tp ContextSensitive <Context-Sensitive>
+EOF
+
+# Return failure if any of the parsers were different
+if [ "$success" -ne "1" ]; then
+	exit 1
+fi
@@ -29,6 +29,11 @@
 
 using namespace compiler;
 
+/// \brief Creates an empty lexer data object, which has only the default mode
+lexer_data::lexer_data()
+: m_Modes(1) {
+}
+
 /// \brief Adds a new lexer definition to this object
 void lexer_data::add_definition(const std::wstring& term, const lexer_item& newItem) {
     m_Definitions[term].push_back(newItem);
@@ -78,3 +83,38 @@ lexer_data::iterator lexer_data::begin_expr() const {
 lexer_data::iterator lexer_data::end_expr() const {
     return m_Expressions.end();
 }
+
+/// \brief Returns the identifier of the lexer mode with the specified name, adding it if it doesn't exist yet
+int lexer_data::add_mode(const std::wstring& name) {
+    for (int mode = 0; mode < count_modes(); ++mode) {
+        if (m_Modes[mode] == name) return mode;
+    }
+    
+    m_Modes.push_back(name);
+    return count_modes() - 1;
+}
+
+/// \brief Works out the lexer mode that each terminal symbol is matched in
+std::vector<int> lexer_data::symbol_modes(int numSymbols) const {
+    // -2 marks symbols that haven't been seen yet
+    std::vector<int> modes((size_t) numSymbols, -2);
+    
+    for (iterator itemList = begin(); itemList != end(); ++itemList) {
+        for (item_list::const_iterator item = itemList->second.begin(); item != itemList->second.end(); ++item) {
+            if (item->symbol < 0 || item->symbol >= numSymbols) continue;
+            
+            int& mode = modes[item->symbol];
+            if (mode == -2) {
+                mode = item->mode;
+            } else if (mode != item->mode) {
+                mode = -1;
+            }
+        }
+    }
+    
+    for (std::vector<int>::iterator mode = modes.begin(); mode != modes.end(); ++mode) {
+        if (*mode == -2) *mode = -1;
+    }
+    
+    return modes;
+}
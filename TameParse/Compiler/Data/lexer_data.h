@@ -54,8 +54,17 @@ namespace compiler {
 
         /// \brief The expressions in this lexer data
         mutable definition_map m_Expressions;
+        
+        /// \brief The names of the lexer modes, in the order of their initial states
+        ///
+        /// The first mode is the default mode, which has an empty name.
+        std::vector<std::wstring> m_Modes;
 
     public:
+        /// \brief Creates an empty lexer data object, which has only the default mode
+        lexer_data();
+        
+
         /// \brief Adds a new lexer definition to this object
         void add_definition(const std::wstring& term, const lexer_item& newItem);
 
@@ -85,6 +94,23 @@ namespace compiler {
 
         /// \brief Returns all of the expressions for a particular value
         const item_list& get_expressions(const std::wstring& term) const;
+        
+        /// \brief Returns the identifier of the lexer mode with the specified name, adding it if it doesn't exist yet
+        ///
+        /// The empty name is the default mode, which is always 0. Each mode becomes an initial state of the lexer.
+        int add_mode(const std::wstring& name);
+        
+        /// \brief The number of lexer modes (which is always at least 1)
+        inline int count_modes() const { return (int) m_Modes.size(); }
+        
+        /// \brief The name of the lexer mode with the specified identifier
+        inline const std::wstring& mode_name(int mode) const { return m_Modes[mode]; }
+        
+        /// \brief Works out the lexer mode that each terminal symbol is matched in
+        ///
+        /// The result has an entry for each of the symbols from 0 to numSymbols-1, which is -1 for symbols that are
+        /// matched in more than one mode or aren't defined here. See lr::lexer_mode_table.
+        std::vector<int> symbol_modes(int numSymbols) const;
 
     };
 }
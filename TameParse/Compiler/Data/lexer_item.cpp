@@ -40,11 +40,12 @@ lexer_item::lexer_item(item_type ty, const std::wstring& def, bool insensitive,
 , definition_type(language_unit::unit_null)
 , is_weak(false)
 , filename(fn)
-, position(pos) {
+, position(pos)
+, mode(0) {
 }
 
 /// \brief Creates a new lexer item
-lexer_item::lexer_item(item_type ty, const std::wstring& def, bool insensitive, bool sensitive, int sym, unit_type def_type, bool weak, const std::wstring* fn, const dfa::position& pos) 
+lexer_item::lexer_item(item_type ty, const std::wstring& def, bool insensitive, bool sensitive, int sym, unit_type def_type, bool weak, const std::wstring* fn, const dfa::position& pos, int itemMode) 
 : type(ty)
 , definition(def)
 , case_insensitive(insensitive)
@@ -53,7 +54,8 @@ lexer_item::lexer_item(item_type ty, const std::wstring& def, bool insensitive,
 , definition_type(def_type)
 , is_weak(weak)
 , filename(fn)
-, position(pos) {
+, position(pos)
+, mode(itemMode) {
 }
 
 /// \brief Copies a lexer item
@@ -66,7 +68,8 @@ lexer_item::lexer_item(const lexer_item& copyFrom)
 , definition_type(copyFrom.definition_type)
 , is_weak(copyFrom.is_weak)
 , filename(copyFrom.filename)
-, position(copyFrom.position) {
+, position(copyFrom.position)
+, mode(copyFrom.mode) {
 }
 
 /// \brief Assigns a lexer item
@@ -84,6 +87,7 @@ lexer_item& lexer_item::operator=(const lexer_item& assignFrom) {
     is_weak             = assignFrom.is_weak;
     filename            = assignFrom.filename;
     position            = assignFrom.position;
+    mode                = assignFrom.mode;
     
     return *this;
 }
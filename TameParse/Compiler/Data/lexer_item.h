@@ -77,12 +77,15 @@ namespace compiler {
 
         /// \brief The position where this symbol is defined
         dfa::position position;
+        
+        /// \brief The lexer mode that this item is matched in (0 for the default mode, see lexer_data::add_mode)
+        int mode;
 
         /// \brief Creates a new lexer item
         lexer_item(item_type type, const std::wstring& definition, bool case_insensitive, bool case_sensitive, const std::wstring* filename, const dfa::position& pos);
 
         /// \brief Creates a new lexer item
-        lexer_item(item_type type, const std::wstring& definition, bool case_insensitive, bool case_sensitive, int symbol, unit_type definition_type, bool is_weak, const std::wstring* filename, const dfa::position& pos);
+        lexer_item(item_type type, const std::wstring& definition, bool case_insensitive, bool case_sensitive, int symbol, unit_type definition_type, bool is_weak, const std::wstring* filename, const dfa::position& pos, int mode = 0);
         
         /// \brief Copies a lexer item
         lexer_item(const lexer_item& copyFrom);
@@ -0,0 +1,779 @@
+//
+//  c.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include <time.h>
+#include <sstream>
+#include <algorithm>
+#include <locale>
+
+#include "TameParse/Compiler/OutputStages/c.h"
+
+using namespace std;
+using namespace dfa;
+using namespace contextfree;
+using namespace compiler;
+
+typedef lr::parser_tables::action action;
+
+/// \brief Creates a new output stage
+output_c::output_c(console_container& console, const std::wstring& filename, lexer_stage* lexer, language_stage* language, lr_parser_stage* parser, const std::wstring& filenamePrefix, const std::wstring& className)
+: output_stage(console, filename, lexer, language, parser)
+, m_FilenamePrefix(filenamePrefix)
+, m_SourceFile(NULL)
+, m_HeaderFile(NULL)
+, m_Encoder(NULL) {
+    // Keywords (ANSI-C)
+    static const char* keywords[] = {
+        "auto", "break", "case", "char", "const", "continue", "default", "do", "double", "else", "enum", "extern",
+        "float", "for", "goto", "if", "int", "long", "register", "return", "short", "signed", "sizeof", "static",
+        "struct", "switch", "typedef", "union", "unsigned", "void", "volatile", "while",
+        
+        // C99
+        "inline", "restrict", "_Bool", "_Complex", "_Imaginary",
+        
+        // Keywords in C++ (the header can be included from C++)
+        "bool", "class", "delete", "new", "namespace", "private", "protected", "public", "template", "this", "throw",
+        "try", "catch", "virtual", "operator", "friend", "true", "false",
+        NULL
+    };
+    
+    for (int keyword = 0; keywords[keyword]; ++keyword) {
+        m_ReservedWords.insert(keywords[keyword]);
+    }
+    
+    m_Prefix = get_identifier(className, true);
+}
+
+/// \brief Destructor
+output_c::~output_c() {
+    if (m_SourceFile) delete m_SourceFile;
+    if (m_HeaderFile) delete m_HeaderFile;
+    if (m_Encoder)    delete m_Encoder;
+}
+
+/// \brief The current locale
+static std::locale loc;
+
+/// \brief Converts a string to upper case
+static string toupper(const string& s) {
+    string res = s;
+    for (string::iterator c = res.begin(); c != res.end(); ++c) {
+        *c = std::toupper(*c, loc);
+    }
+    return res;
+}
+
+/// \brief Chooses a name that hasn't been used before, starting from baseName
+static string unique_name(const string& baseName, set<string>& used) {
+    string name = baseName;
+    
+    for (int variant = 2; used.find(name) != used.end(); ++variant) {
+        stringstream varName;
+        varName << baseName << "_" << variant;
+        name = varName.str();
+    }
+    
+    used.insert(name);
+    return name;
+}
+
+
+//              ===================
+//               String converters
+//              ===================
+
+/// \brief Returns a valid C identifier for the specified symbol name
+std::string output_c::get_identifier(const std::wstring& name, bool allowReserved) {
+    // Empty string if the name is empty
+    if (name.size() == 0) return "_";
+    
+    // Strip out any quotes that the name might have
+    wstring stripped = name;
+    
+    if (name.size() >= 2) {
+        wchar_t first   = name[0];
+        wchar_t last    = name[name.size()-1];
+        
+        if ((first == L'\'' && last == L'\'') || (first == L'"' && last == L'"') || (first == L'<' && last == L'>')) {
+            stripped = name.substr(1, name.size()-2);
+        }
+    }
+    
+    // Punctuation characters are written out as names
+    static const struct { wchar_t c; const char* name; } punctuation[] = {
+        { L'<', "_lessthan_" },     { L'>', "_greaterthan_" },  { L'\'', "_quote_" },       { L'"', "_doublequote_" },
+        { L'&', "_ampersand_" },    { L':', "_colon_" },        { L'=', "_equals_" },       { L'!', "_exclamation_" },
+        { L'@', "_at_" },           { L'#', "_hash_" },         { L'$', "_dollar_" },       { L'%', "_percent_" },
+        { L'^', "_cicumflex_" },    { L'*', "_star_" },         { L'(', "_openparen_" },    { L')', "_closeparen_" },
+        { L'+', "_plus_" },         { L'/', "_slash_" },        { L'\\', "_backslash_" },   { L'|', "_pipe_" },
+        { L';', "_semicolon_" },    { L'.', "_dot_" },          { L',', "_comma_" },        { L'?', "_question_" },
+        { L'~', "_tilde_" },        { L'{', "_opencurly_" },    { L'}', "_closecurly_" },   { L'[', "_opensquare_" },
+        { L']', "_closesquare_" },  { 0, NULL }
+    };
+    
+    stringstream res;
+    for (wstring::const_iterator wideChar = stripped.begin(); wideChar != stripped.end(); ++wideChar) {
+        wchar_t c = *wideChar;
+        if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (res.tellp() > 0 && c >= '0' && c <= '9')) {
+            res << (char) c;
+            continue;
+        }
+        
+        // The language encourages '-' as part of identifiers, so it's only named when it's on its own
+        if (c == L'-' && stripped.size() == 1) {
+            res << "_minus_";
+            continue;
+        }
+        
+        int punct = 0;
+        while (punctuation[punct].name && punctuation[punct].c != c) ++punct;
+        
+        // We use '_' as a placeholder for everything else
+        res << (punctuation[punct].name ? punctuation[punct].name : "_");
+    }
+    
+    // Ensure that this doesn't match any reserved words
+    while (!allowReserved && m_ReservedWords.find(res.str()) != m_ReservedWords.end()) {
+        res << "_";
+    }
+    
+    return res.str();
+}
+
+/// \brief Returns true if the specified name should be considered 'valid'
+bool output_c::name_is_valid(const std::wstring& name) {
+    if (name.empty()) return false;
+    return m_ReservedWords.find(get_identifier(name, true)) == m_ReservedWords.end();
+}
+
+
+//              ================
+//               General output
+//              ================
+
+/// \brief Returns true if the C parser can represent this language, or sets reason and returns false
+bool output_c::can_write_c_parser(wstring& reason) {
+    // The lexer must have a single mode and recognise every symbol with its DFA
+    if (count_lexer_modes() > 1) {
+        reason = L"the language uses lexer modes";
+        return false;
+    }
+    
+    if (lexer_keywords().count_slots() > 0) {
+        reason = L"the lexer uses a keyword table";
+        return false;
+    }
+    
+    // The parser must only use the actions the driver knows how to perform
+    const lr::parser_tables& tables = get_parser_tables();
+    
+    if (tables.count_end_of_guards() > 0) {
+        reason = L"the language uses guards";
+        return false;
+    }
+    
+    for (int stateId = 0; stateId < tables.count_states(); ++stateId) {
+        for (int pass = 0; pass < 2; ++pass) {
+            const action*   actions = pass == 0 ? tables.terminal_actions()[stateId] : tables.nonterminal_actions()[stateId];
+            int             count   = pass == 0 ? tables.action_counts()[stateId].numTerminals : tables.action_counts()[stateId].numNonterminals;
+            
+            for (int actionNum = 0; actionNum < count; ++actionNum) {
+                switch (actions[actionNum].type) {
+                    case lr::lr_action::act_shift:
+                    case lr::lr_action::act_ignore:
+                    case lr::lr_action::act_reduce:
+                    case lr::lr_action::act_accept:
+                    case lr::lr_action::act_goto:
+                        break;
+                    
+                    case lr::lr_action::act_guard:
+                        reason = L"the language uses guards";
+                        return false;
+                    
+                    case lr::lr_action::act_shiftstrong:
+                    case lr::lr_action::act_weakreduce:
+                        reason = L"the language uses weak symbols";
+                        return false;
+                    
+                    case lr::lr_action::act_shiftreduce:
+                        reason = L"the parser uses combined shift-reduce actions";
+                        return false;
+                    
+                    default:
+                        reason = L"the parser uses actions that can only be performed by the C++ parser";
+                        return false;
+                }
+            }
+        }
+    }
+    
+    return true;
+}
+
+/// \brief Compiles the parser, or reports an error if the language uses a feature the C parser can't support
+void output_c::compile() {
+    wstring reason;
+    if (!can_write_c_parser(reason)) {
+        cons().report_error(error(error::sev_error, filename(), L"UNSUPPORTED_C_PARSER", L"Can't generate a C parser because " + reason, position(-1, -1, -1)));
+        return;
+    }
+    
+    output_stage::compile();
+}
+
+/// \brief Writes out a header to the specified file
+void output_c::write_header(const std::wstring& filename, std::ostream* target) {
+    // Get the current time
+    char        timeString[128];
+    time_t      nowTime     = time(NULL);
+    struct tm*  nowLocal    = localtime(&nowTime);
+    
+    strftime(timeString, 127, "%a %Y/%m/%d %H:%M:%S", nowLocal);
+    
+    (*target) << "/*\n";
+    (*target) << " * " << cons().convert_filename(filename) << "\n";
+    (*target) << " * Parser file generated by TameParse at " << timeString << "\n";
+    (*target) << " */\n\n";
+}
+
+/// \brief About to begin writing out output
+void output_c::begin_output() {
+    if (m_SourceFile) delete m_SourceFile;
+    if (m_HeaderFile) delete m_HeaderFile;
+    if (m_Encoder)    delete m_Encoder;
+    
+    // Tables use the smallest type that will hold their values unless the c-tables option says otherwise
+    wstring tableStyle = cons().get_option(L"c-tables");
+    
+    if (tableStyle == L"int") {
+        m_Encoder = new c_array_encoder("int");
+    } else {
+        if (!tableStyle.empty() && tableStyle != L"narrow") {
+            wstringstream msg;
+            msg << L"Unknown C table style: " << tableStyle << L" (use narrow or int)";
+            cons().report_error(error(error::sev_error, filename(), L"UNKNOWN_C_TABLE_STYLE", msg.str(), position(-1, -1, -1)));
+        }
+        m_Encoder = new c_array_encoder();
+    }
+    
+    // Create the source files
+    wstring sourceFilename = m_FilenamePrefix + L".c";
+    wstring headerFilename = m_FilenamePrefix + L".h";
+    
+    m_SourceFile = cons().open_binary_file_for_writing(sourceFilename);
+    m_HeaderFile = cons().open_binary_file_for_writing(headerFilename);
+    
+    write_header(sourceFilename, m_SourceFile);
+    write_header(headerFilename, m_HeaderFile);
+    
+    // The header can be included from C++
+    *m_HeaderFile << "#ifndef TAMEPARSE_C_PARSER_" << toupper(get_identifier(m_FilenamePrefix, true)) << "\n";
+    *m_HeaderFile << "#define TAMEPARSE_C_PARSER_" << toupper(get_identifier(m_FilenamePrefix, true)) << "\n";
+    *m_HeaderFile << "\n";
+    *m_HeaderFile << "#include <stddef.h>\n";
+    *m_HeaderFile << "\n";
+    *m_HeaderFile << "#ifdef __cplusplus\n";
+    *m_HeaderFile << "extern \"C\" {\n";
+    *m_HeaderFile << "#endif\n";
+    
+    *m_SourceFile << "#include \"" << cons().convert_filename(headerFilename) << "\"\n";
+}
+
+/// \brief Finishing writing out output
+void output_c::end_output() {
+    header_declarations();
+    
+    source_read_symbols();
+    source_lexer();
+    source_parser();
+    
+    *m_HeaderFile << "\n";
+    *m_HeaderFile << "#ifdef __cplusplus\n";
+    *m_HeaderFile << "}\n";
+    *m_HeaderFile << "#endif\n";
+    *m_HeaderFile << "\n#endif\n";
+}
+
+/// \brief Writes out the types and functions declared by the header file
+void output_c::header_declarations() {
+    const string& p = m_Prefix;
+    
+    *m_HeaderFile   << "\n/* A token read from the input by " << p << "_lex (the symbol is -1 if no token could be matched) */\n"
+                    << "typedef struct " << p << "_token {\n"
+                    << "    int     symbol;\n"
+                    << "    size_t  offset;\n"
+                    << "    size_t  length;\n"
+                    << "} " << p << "_token;\n"
+                    << "\n/* An entry on the parser stack */\n"
+                    << "typedef struct " << p << "_stack_entry {\n"
+                    << "    int     state;\n"
+                    << "    void*   value;\n"
+                    << "} " << p << "_stack_entry;\n"
+                    << "\n"
+                    << "/*\n"
+                    << " * The semantic actions for the parser (either function can be NULL, in which case the value is NULL)\n"
+                    << " *\n"
+                    << " * shift is called for each token that the parser accepts. reduce is called with the items that match a rule,\n"
+                    << " * in the order they appear in the rule.\n"
+                    << " */\n"
+                    << "typedef struct " << p << "_callbacks {\n"
+                    << "    void*   context;\n"
+                    << "    void*   (*shift)(void* context, const " << p << "_token* token);\n"
+                    << "    void*   (*reduce)(void* context, int nonterminal, int rule, " << p << "_stack_entry* items, int count);\n"
+                    << "} " << p << "_callbacks;\n"
+                    << "\n/* The result of a parse */\n"
+                    << "typedef enum " << p << "_result {\n"
+                    << "    " << p << "_accept,\n"
+                    << "    " << p << "_reject,\n"
+                    << "    " << p << "_overflow\n"
+                    << "} " << p << "_result;\n"
+                    << "\n"
+                    << "/*\n"
+                    << " * Reads the token starting at pos in a UTF-8 buffer\n"
+                    << " *\n"
+                    << " * Returns 0 at the end of the input. Characters that don't start a token produce a token with symbol -1.\n"
+                    << " */\n"
+                    << "int " << p << "_lex(const char* input, size_t length, size_t pos, " << p << "_token* token);\n"
+                    << "\n"
+                    << "/*\n"
+                    << " * Parses a UTF-8 buffer, starting in one of the start states\n"
+                    << " *\n"
+                    << " * The parser never allocates memory: the stack is supplied by the caller, and the result is overflow if it\n"
+                    << " * fills up. If the parse is accepted, result is set to the value for the start symbol. If it is rejected,\n"
+                    << " * errorToken is set to the token that couldn't be parsed (which has symbol -1 and length 0 at the end of\n"
+                    << " * the input). result and errorToken can be NULL.\n"
+                    << " */\n"
+                    << p << "_result " << p << "_parse(const char* input, size_t length, int startState, " << p << "_stack_entry* stack, int stackCapacity, const " << p << "_callbacks* callbacks, void** result, " << p << "_token* errorToken);\n";
+}
+
+
+//              =========
+//               Symbols
+//              =========
+
+/// \brief Defines the symbols associated with this language
+void output_c::define_symbols() {
+    set<string> used;
+    
+    // The terminal symbols
+    *m_HeaderFile << "\n/* Terminal symbols */\n"
+                  << "enum {";
+    
+    bool first = true;
+    for (terminal_symbol_iterator term = begin_terminal_symbol(); term != end_terminal_symbol(); ++term) {
+        string name = unique_name(m_Prefix + "_t_" + get_identifier(term->name, true), used);
+        *m_HeaderFile << (first ? "\n" : ",\n") << "    " << name << " = " << term->identifier;
+        first = false;
+    }
+    
+    *m_HeaderFile << "\n};\n";
+    
+    // The nonterminal symbols (only the named nonterminals: nonterminals generated for EBNF items are left out)
+    *m_HeaderFile << "\n/* Nonterminal symbols */\n"
+                  << "enum {";
+    
+    first = true;
+    for (nonterminal_symbol_iterator nonterm = begin_nonterminal_symbol(); nonterm != end_nonterminal_symbol(); ++nonterm) {
+        if (nonterm->item->type() != item::nonterminal) continue;
+        
+        string shortName = nonterm->name.empty() ? string("_unnamed") : get_identifier(nonterm->name, true);
+        string name      = unique_name(m_Prefix + "_nt_" + shortName, used);
+        
+        *m_HeaderFile << (first ? "\n" : ",\n") << "    " << name << " = " << nonterm->identifier;
+        first = false;
+    }
+    
+    *m_HeaderFile << "\n};\n";
+    
+    // The start states
+    *m_HeaderFile << "\n/* Start states for " << m_Prefix << "_parse */\n"
+                  << "enum {";
+    
+    const vector<wstring>& startSymbols = get_start_symbols();
+    for (size_t startState = 0; startState < startSymbols.size(); ++startState) {
+        string name = unique_name(m_Prefix + "_start_" + get_identifier(startSymbols[startState], true), used);
+        *m_HeaderFile << (startState == 0 ? "\n" : ",\n") << "    " << name << " = " << startState;
+    }
+    
+    *m_HeaderFile << "\n};\n";
+}
+
+
+//              ==================
+//               Lexer generation
+//              ==================
+
+/// \brief Writes out the lexer tables
+///
+/// ASCII characters are mapped to symbol sets using a table. Anything else is found with a binary search of the
+/// remaining ranges. The state machine is a flat table with a row for each state and a column for each symbol set.
+void output_c::define_lexer_tables() {
+    output_table asciiSets("ascii_sets");
+    output_table rangeLower("range_lower");
+    output_table rangeUpper("range_upper");
+    output_table rangeSet("range_set");
+    output_table transitions("lexer_transitions");
+    output_table accept("lexer_accept");
+    
+    build_symbol_map_tables(asciiSets, rangeLower, rangeUpper, rangeSet);
+    build_flat_lexer_table(transitions);
+    build_lexer_accept_table(accept);
+    
+    *m_SourceFile << "\n/* Symbol sets for ASCII characters (plus 1: 0 means the character isn't in a set) */";
+    m_Encoder->write(asciiSets, *m_SourceFile);
+    
+    *m_SourceFile << "\n/* Symbol sets for the other characters (sorted ranges, which include lower and exclude upper) */\n"
+                  << "#define NUM_RANGES " << rangeSet.size() << "\n";
+    m_Encoder->write(rangeLower, *m_SourceFile);
+    m_Encoder->write(rangeUpper, *m_SourceFile);
+    m_Encoder->write(rangeSet, *m_SourceFile);
+    
+    *m_SourceFile << "\n/* Lexer state machine (plus 1: 0 means that the character is rejected) */\n"
+                  << "#define NUM_SYMBOL_SETS " << count_lexer_symbol_sets() << "\n";
+    m_Encoder->write(transitions, *m_SourceFile);
+    
+    *m_SourceFile << "\n/* Symbol accepted by each lexer state (plus 1: 0 means that the state doesn't accept) */";
+    m_Encoder->write(accept, *m_SourceFile);
+}
+
+/// \brief Writes out the function that reads the symbols for the next character in the input
+void output_c::source_read_symbols() {
+    *m_SourceFile   << "\n/* Reads the symbols that the lexer matches for the character at pos, and sets next to the following character */\n"
+                    << "static int read_symbols(const unsigned char* input, size_t length, size_t pos, size_t* next, unsigned long* symbols) {\n";
+    
+    // A UTF-8 lexer matches the bytes in the input
+    if (!cons().get_option(L"utf8-lexer").empty()) {
+        *m_SourceFile   << "    (void) length;\n"
+                        << "    symbols[0]  = input[pos];\n"
+                        << "    *next       = pos + 1;\n"
+                        << "    return 1;\n"
+                        << "}\n";
+        return;
+    }
+    
+    // Otherwise, decode the UTF-8 (invalid sequences are read as a single byte)
+    *m_SourceFile   << "    unsigned long   c       = input[pos];\n"
+                    << "    int             extra   = 0;\n"
+                    << "    int             byte;\n"
+                    << "\n"
+                    << "    if      (c >= 0xf0 && c < 0xf8) { extra = 3; c &= 0x07; }\n"
+                    << "    else if (c >= 0xe0 && c < 0xf0) { extra = 2; c &= 0x0f; }\n"
+                    << "    else if (c >= 0xc0 && c < 0xe0) { extra = 1; c &= 0x1f; }\n"
+                    << "\n"
+                    << "    if (pos + extra >= length) {\n"
+                    << "        extra = 0;\n"
+                    << "    }\n"
+                    << "\n"
+                    << "    for (byte = 1; byte <= extra; ++byte) {\n"
+                    << "        if ((input[pos + byte] & 0xc0) != 0x80) {\n"
+                    << "            extra = 0;\n"
+                    << "            break;\n"
+                    << "        }\n"
+                    << "        c = (c << 6) | (input[pos + byte] & 0x3f);\n"
+                    << "    }\n"
+                    << "\n"
+                    << "    if (extra == 0) {\n"
+                    << "        c = input[pos];\n"
+                    << "    }\n"
+                    << "\n"
+                    << "    *next = pos + 1 + extra;\n";
+    
+    // Characters outside the basic multilingual plane are matched as surrogate pairs unless they're disabled
+    if (cons().get_option(L"no-surrogates").empty()) {
+        *m_SourceFile   << "\n"
+                        << "    if (c > 0xffff) {\n"
+                        << "        c           -= 0x10000;\n"
+                        << "        symbols[0]  = 0xd800 + (c >> 10);\n"
+                        << "        symbols[1]  = 0xdc00 + (c & 0x3ff);\n"
+                        << "        return 2;\n"
+                        << "    }\n";
+    }
+    
+    *m_SourceFile   << "\n"
+                    << "    symbols[0] = c;\n"
+                    << "    return 1;\n"
+                    << "}\n";
+}
+
+/// \brief Writes out the lexer function
+void output_c::source_lexer() {
+    const string& p = m_Prefix;
+    
+    *m_SourceFile   << "\n/* Returns the symbol set containing a symbol, or -1 */\n"
+                    << "static long symbol_set(unsigned long symbol) {\n"
+                    << "    long first  = 0;\n"
+                    << "    long last   = NUM_RANGES;\n"
+                    << "\n"
+                    << "    if (symbol < 128) return (long) ascii_sets[symbol] - 1;\n"
+                    << "\n"
+                    << "    while (first < last) {\n"
+                    << "        long mid = first + (last - first) / 2;\n"
+                    << "\n"
+                    << "        if      (symbol < (unsigned long) range_lower[mid])     last    = mid;\n"
+                    << "        else if (symbol >= (unsigned long) range_upper[mid])    first   = mid + 1;\n"
+                    << "        else                                                    return (long) range_set[mid];\n"
+                    << "    }\n"
+                    << "\n"
+                    << "    return -1;\n"
+                    << "}\n";
+    
+    *m_SourceFile   << "\nint " << p << "_lex(const char* input, size_t length, size_t pos, " << p << "_token* token) {\n"
+                    << "    const unsigned char*    bytes           = (const unsigned char*) input;\n"
+                    << "    unsigned long           symbols[2];\n"
+                    << "    size_t                  cur             = pos;\n"
+                    << "    size_t                  next;\n"
+                    << "    size_t                  acceptEnd       = pos;\n"
+                    << "    long                    acceptSymbol    = -1;\n"
+                    << "    long                    state           = 0;\n"
+                    << "\n"
+                    << "    if (pos >= length) return 0;\n"
+                    << "\n"
+                    << "    /* Find the longest match */\n"
+                    << "    while (cur < length) {\n"
+                    << "        int count   = read_symbols(bytes, length, cur, &next, symbols);\n"
+                    << "        int symNum;\n"
+                    << "\n"
+                    << "        for (symNum = 0; symNum < count && state >= 0; ++symNum) {\n"
+                    << "            long set = symbol_set(symbols[symNum]);\n"
+                    << "            state = set < 0 ? -1 : (long) lexer_transitions[state * NUM_SYMBOL_SETS + set] - 1;\n"
+                    << "        }\n"
+                    << "\n"
+                    << "        if (state < 0) break;\n"
+                    << "\n"
+                    << "        cur = next;\n"
+                    << "        if (lexer_accept[state]) {\n"
+                    << "            acceptSymbol    = (long) lexer_accept[state] - 1;\n"
+                    << "            acceptEnd       = cur;\n"
+                    << "        }\n"
+                    << "    }\n"
+                    << "\n"
+                    << "    /* Characters that don't start a token are returned one at a time */\n"
+                    << "    if (acceptSymbol < 0) {\n"
+                    << "        read_symbols(bytes, length, pos, &acceptEnd, symbols);\n"
+                    << "    }\n"
+                    << "\n"
+                    << "    token->symbol   = (int) acceptSymbol;\n"
+                    << "    token->offset   = pos;\n"
+                    << "    token->length   = acceptEnd - pos;\n"
+                    << "    return 1;\n"
+                    << "}\n";
+}
+
+
+//              ===================
+//               Parser generation
+//              ===================
+
+/// \brief Writes out the parser tables
+///
+/// The actions for each state are sorted by symbol and found with a binary search.
+void output_c::define_parser_tables() {
+    const lr::parser_tables& tables = get_parser_tables();
+    
+    *m_SourceFile   << "\n/* Parser actions */\n"
+                    << "enum {\n"
+                    << "    act_shift   = " << lr::lr_action::act_shift << ",\n"
+                    << "    act_ignore  = " << lr::lr_action::act_ignore << ",\n"
+                    << "    act_reduce  = " << lr::lr_action::act_reduce << ",\n"
+                    << "    act_accept  = " << lr::lr_action::act_accept << ",\n"
+                    << "    act_goto    = " << lr::lr_action::act_goto << "\n"
+                    << "};\n";
+    
+    for (int pass = 0; pass < 2; ++pass) {
+        string tableName = pass == 0 ? "terminal" : "nonterminal";
+        
+        output_table first(tableName + "_first");
+        output_table symbols(tableName + "_symbol");
+        output_table types(tableName + "_type");
+        output_table next(tableName + "_next");
+        
+        build_parser_action_tables(pass == 0, first, symbols, types, next);
+        
+        *m_SourceFile << "\n/* Actions for the " << tableName << " symbols (each state's actions start at " << tableName << "_first[state]) */";
+        m_Encoder->write(first, *m_SourceFile);
+        m_Encoder->write(symbols, *m_SourceFile);
+        m_Encoder->write(types, *m_SourceFile);
+        m_Encoder->write(next, *m_SourceFile);
+        
+        *m_SourceFile   << "\n/* Returns the index of the action for a " << tableName << " symbol in a state, or -1 */\n"
+                        << "static long find_" << tableName << "(int state, int symbol) {\n"
+                        << "    long first  = (long) " << tableName << "_first[state];\n"
+                        << "    long last   = (long) " << tableName << "_first[state + 1];\n"
+                        << "\n"
+                        << "    while (first < last) {\n"
+                        << "        long mid = first + (last - first) / 2;\n"
+                        << "\n"
+                        << "        if      ((int) " << tableName << "_symbol[mid] < symbol)    first   = mid + 1;\n"
+                        << "        else if ((int) " << tableName << "_symbol[mid] > symbol)    last    = mid;\n"
+                        << "        else                                        return mid;\n"
+                        << "    }\n"
+                        << "\n"
+                        << "    return -1;\n"
+                        << "}\n";
+    }
+    
+    // Default reductions and the rules
+    output_table defaultReduce("default_reduce");
+    output_table defaultGoto("default_goto");
+    output_table ruleNonterminal("rule_nonterminal");
+    output_table ruleId("rule_id");
+    output_table ruleLength("rule_length");
+    
+    build_default_reduction_table(defaultReduce);
+    build_default_goto_table(defaultGoto);
+    build_reduce_rule_tables(ruleNonterminal, ruleId, ruleLength);
+    
+    *m_SourceFile << "\n/* The rule each state reduces without looking at the lookahead (plus 1: 0 means that there isn't one) */";
+    m_Encoder->write(defaultReduce, *m_SourceFile);
+    
+    *m_SourceFile << "\n/* The state to go to for each nonterminal in states with no goto action for it (plus 1: 0 means that there isn't one) */";
+    m_Encoder->write(defaultGoto, *m_SourceFile);
+    *m_SourceFile << "\n#define NUM_DEFAULT_GOTOS " << defaultGoto.size() << "\n";
+    
+    *m_SourceFile << "\n/* The rules reduced by the parser */";
+    m_Encoder->write(ruleNonterminal, *m_SourceFile);
+    m_Encoder->write(ruleId, *m_SourceFile);
+    m_Encoder->write(ruleLength, *m_SourceFile);
+    
+    *m_SourceFile << "\n#define END_OF_INPUT " << tables.end_of_input() << "\n";
+}
+
+/// \brief Writes out the parser function
+void output_c::source_parser() {
+    const string& p = m_Prefix;
+    
+    *m_SourceFile   << "\n" << p << "_result " << p << "_parse(const char* input, size_t length, int startState, " << p << "_stack_entry* stack, int stackCapacity, const " << p << "_callbacks* callbacks, void** result, " << p << "_token* errorToken) {\n"
+                    << "    " << p << "_token   look;\n"
+                    << "    int     haveLook    = 0;\n"
+                    << "    int     atEnd       = 0;\n"
+                    << "    size_t  pos         = 0;\n"
+                    << "    int     top         = 0;\n"
+                    << "\n"
+                    << "    if (stackCapacity < 1) return " << p << "_overflow;\n"
+                    << "\n"
+                    << "    stack[0].state = startState;\n"
+                    << "    stack[0].value = NULL;\n"
+                    << "\n"
+                    << "    for (;;) {\n"
+                    << "        int     state   = stack[top].state;\n"
+                    << "        int     type    = -1;\n"
+                    << "        long    next    = 0;\n"
+                    << "        long    index;\n"
+                    << "\n"
+                    << "        if (default_reduce[state]) {\n"
+                    << "            /* States with a default reduction don't need the lookahead */\n"
+                    << "            type = act_reduce;\n"
+                    << "            next = (long) default_reduce[state] - 1;\n"
+                    << "        } else {\n"
+                    << "            /* Read the lookahead if necessary */\n"
+                    << "            if (!haveLook) {\n"
+                    << "                atEnd       = !" << p << "_lex(input, length, pos, &look);\n"
+                    << "                haveLook    = 1;\n"
+                    << "\n"
+                    << "                if (atEnd) {\n"
+                    << "                    look.symbol = -1;\n"
+                    << "                    look.offset = length;\n"
+                    << "                    look.length = 0;\n"
+                    << "                }\n"
+                    << "            }\n"
+                    << "\n"
+                    << "            if (atEnd)                  index = find_nonterminal(state, END_OF_INPUT);\n"
+                    << "            else if (look.symbol >= 0)  index = find_terminal(state, look.symbol);\n"
+                    << "            else                        index = -1;\n"
+                    << "\n"
+                    << "            if (index >= 0) {\n"
+                    << "                type = atEnd ? nonterminal_type[index] : terminal_type[index];\n"
+                    << "                next = atEnd ? (long) nonterminal_next[index] : (long) terminal_next[index];\n"
+                    << "            }\n"
+                    << "        }\n"
+                    << "\n"
+                    << "        switch (type) {\n"
+                    << "        case act_shift:\n"
+                    << "            if (top + 1 >= stackCapacity) return " << p << "_overflow;\n"
+                    << "\n"
+                    << "            ++top;\n"
+                    << "            stack[top].state = (int) next;\n"
+                    << "            stack[top].value = callbacks && callbacks->shift ? callbacks->shift(callbacks->context, &look) : NULL;\n"
+                    << "\n"
+                    << "            pos         = look.offset + look.length;\n"
+                    << "            haveLook    = 0;\n"
+                    << "            break;\n"
+                    << "\n"
+                    << "        case act_ignore:\n"
+                    << "            pos         = look.offset + look.length;\n"
+                    << "            haveLook    = 0;\n"
+                    << "            break;\n"
+                    << "\n"
+                    << "        case act_reduce:\n"
+                    << "        {\n"
+                    << "            int     nonterminal = (int) rule_nonterminal[next];\n"
+                    << "            int     count       = (int) rule_length[next];\n"
+                    << "            long    gotoState   = -1;\n"
+                    << "            void*   value;\n"
+                    << "\n"
+                    << "            if (top - count + 1 >= stackCapacity) return " << p << "_overflow;\n"
+                    << "\n"
+                    << "            /* The most common goto for each nonterminal is only stored in default_goto */\n"
+                    << "            top     -= count;\n"
+                    << "            index   = find_nonterminal(stack[top].state, nonterminal);\n"
+                    << "            if (index >= 0 && nonterminal_type[index] == act_goto)                  gotoState = (long) nonterminal_next[index];\n"
+                    << "            else if (nonterminal < NUM_DEFAULT_GOTOS && default_goto[nonterminal])  gotoState = (long) default_goto[nonterminal] - 1;\n"
+                    << "\n"
+                    << "            if (gotoState < 0) {\n"
+                    << "                top += count;\n"
+                    << "                goto reject;\n"
+                    << "            }\n"
+                    << "\n"
+                    << "            value = callbacks && callbacks->reduce ? callbacks->reduce(callbacks->context, nonterminal, (int) rule_id[next], stack + top + 1, count) : NULL;\n"
+                    << "\n"
+                    << "            ++top;\n"
+                    << "            stack[top].state = (int) gotoState;\n"
+                    << "            stack[top].value = value;\n"
+                    << "            break;\n"
+                    << "        }\n"
+                    << "\n"
+                    << "        case act_accept:\n"
+                    << "            if (result) *result = stack[top].value;\n"
+                    << "            return " << p << "_accept;\n"
+                    << "\n"
+                    << "        default:\n"
+                    << "            goto reject;\n"
+                    << "        }\n"
+                    << "    }\n"
+                    << "\n"
+                    << "reject:\n"
+                    << "    if (errorToken) {\n"
+                    << "        if (haveLook) {\n"
+                    << "            *errorToken = look;\n"
+                    << "        } else {\n"
+                    << "            errorToken->symbol = -1;\n"
+                    << "            errorToken->offset = pos;\n"
+                    << "            errorToken->length = 0;\n"
+                    << "        }\n"
+                    << "    }\n"
+                    << "\n"
+                    << "    return " << p << "_reject;\n"
+                    << "}\n";
+}
@@ -0,0 +1,121 @@
+//
+//  c.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _COMPILER_OUTPUT_C_H
+#define _COMPILER_OUTPUT_C_H
+
+#include <string>
+#include <iostream>
+#include <set>
+
+#include "TameParse/Compiler/output_stage.h"
+
+namespace compiler {
+    ///
+    /// \brief Output stage that generates a parser in C
+    ///
+    /// The generated parser is self-contained: it doesn't need the TameParse headers, the standard C++ library or
+    /// any memory allocation. The tables are written out as arrays using the smallest integer type that will hold
+    /// their values, and the driver is a plain loop over them. The caller supplies the input as a UTF-8 buffer, the
+    /// stack as an array and the semantic actions as a structure of function pointers.
+    ///
+    /// Only the features that the direct-coded C++ parser supports are available: languages that use guards, weak
+    /// symbols, lexer modes or the keyword table are reported as errors.
+    ///
+    class output_c : public output_stage {
+    private:
+        /// \brief The prefix for the output files
+        std::wstring m_FilenamePrefix;
+        
+        /// \brief The prefix for the identifiers in the generated code (derived from the class name)
+        std::string m_Prefix;
+        
+        /// \brief The source file
+        std::ostream* m_SourceFile;
+        
+        /// \brief The header file
+        std::ostream* m_HeaderFile;
+        
+        /// \brief Reserved words in C
+        std::set<std::string> m_ReservedWords;
+        
+        /// \brief Writes out the tables (chosen by the c-tables option)
+        table_encoder* m_Encoder;
+    
+    public:
+        /// \brief Creates a new output stage
+        output_c(console_container& console, const std::wstring& filename, lexer_stage* lexer, language_stage* language, lr_parser_stage* parser, const std::wstring& filenamePrefix, const std::wstring& className);
+        
+        /// \brief Destructor
+        virtual ~output_c();
+        
+        /// \brief Compiles the parser, or reports an error if the language uses a feature the C parser can't support
+        virtual void compile();
+    
+    protected:
+        /// \brief Returns a valid C identifier for the specified symbol name
+        virtual std::string get_identifier(const std::wstring& name, bool allowReserved);
+        
+        /// \brief Writes out a header to the specified file
+        virtual void write_header(const std::wstring& filename, std::ostream* target);
+        
+        /// \brief Returns true if the specified name should be considered 'valid'
+        virtual bool name_is_valid(const std::wstring& name);
+    
+    private:
+        /// \brief Returns true if the C parser can represent this language, or sets reason and returns false
+        bool can_write_c_parser(std::wstring& reason);
+        
+        /// \brief Writes out the types and functions declared by the header file
+        void header_declarations();
+        
+        /// \brief Writes out the function that reads the symbols for the next character in the input
+        void source_read_symbols();
+        
+        /// \brief Writes out the lexer function
+        void source_lexer();
+        
+        /// \brief Writes out the parser function
+        void source_parser();
+    
+    protected:
+        /// \brief About to begin writing out output
+        virtual void begin_output();
+        
+        /// \brief Finishing writing out output
+        virtual void end_output();
+        
+        /// \brief Defines the symbols associated with this language
+        virtual void define_symbols();
+        
+        /// \brief Writes out the lexer tables
+        virtual void define_lexer_tables();
+        
+        /// \brief Writes out the parser tables
+        virtual void define_parser_tables();
+    };
+}
+
+#endif
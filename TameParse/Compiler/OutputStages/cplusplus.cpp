@@ -27,13 +27,18 @@
 
 #include <time.h>
 #include <sstream>
+#include <map>
 #include <algorithm>
 #include <locale>
 
 #include "TameParse/Compiler/OutputStages/cplusplus.h"
+#include "TameParse/Lr/compact_parser_tables.h"
+#include "TameParse/Lr/unit_rule_rewriter.h"
+#include "TameParse/Util/parallel.h"
 
 using namespace std;
 using namespace dfa;
+using namespace util;
 using namespace contextfree;
 using namespace compiler;
 
@@ -50,7 +55,10 @@ output_cplusplus::output_cplusplus(console_container& console, const std::wstrin
 , m_ClassName(className)
 , m_Namespace(namespaceName)
 , m_SourceFile(NULL)
-, m_HeaderFile(NULL) {
+, m_HeaderFile(NULL)
+, m_SplitOutput(false)
+, m_ParserTablesType("lr::parser_tables")
+, m_PooledAst(false) {
     // Keywords (ANSI-C)
     m_ReservedWords.insert("auto");
     m_ReservedWords.insert("break");
@@ -156,6 +164,7 @@ output_cplusplus::output_cplusplus(console_container& console, const std::wstrin
     m_ReservedWords.insert("nonterminal");
     m_ReservedWords.insert("reduce_list");
     m_ReservedWords.insert("syntax_node");
+    m_ReservedWords.insert("visitor");
     m_ReservedWords.insert("node");
     m_ReservedWords.insert("content");
     m_ReservedWords.insert("state");
@@ -199,8 +208,9 @@ output_cplusplus::output_cplusplus(console_container& console, const std::wstrin
 
 /// \brief Destructor
 output_cplusplus::~output_cplusplus() {
-    if (m_SourceFile)               delete m_SourceFile;
-    if (m_HeaderFile)               delete m_HeaderFile;
+    for (size_t fileNum = 0; fileNum < m_OutputFiles.size(); ++fileNum) {
+        delete m_OutputFiles[fileNum].second;
+    }
 }
 
 /// \brief The current locale
@@ -389,42 +399,67 @@ void output_cplusplus::write_header(const std::wstring& filename, std::ostream*
     
     (*target) << "///\n";
     (*target) << "/// " << cons().convert_filename(filename) << "\n";
-    (*target) << "/// Parser file generated by TameParse at " << timeString << "\n";
+    if (m_SplitOutput) {
+        // Leave out the time so that the files only change when their content does
+        (*target) << "/// Parser file generated by TameParse\n";
+    } else {
+        (*target) << "/// Parser file generated by TameParse at " << timeString << "\n";
+    }
     (*target) << "///\n\n";
 }
 
 /// \brief About to begin writing out output
 void output_cplusplus::begin_output() {
     // Clean up if there are existing files for any reasom
-    if (m_SourceFile) delete m_SourceFile;
-    if (m_HeaderFile) delete m_HeaderFile;
+    for (size_t fileNum = 0; fileNum < m_OutputFiles.size(); ++fileNum) {
+        delete m_OutputFiles[fileNum].second;
+    }
+    m_OutputFiles.clear();
 
-    m_SourceFile = NULL;
-    m_HeaderFile = NULL;
+    // The tables and AST definitions can be put in their own files, so that they only need to be recompiled when
+    // they change
+    m_SplitOutput = !cons().get_option(L"split-output").empty();
 
     // Create the source files
-    wstring sourceFilename = m_FilenamePrefix + L".cpp";
     wstring headerFilename = m_FilenamePrefix + L".h";
 
-    // Open the files for writing
-    m_SourceFile = cons().open_binary_file_for_writing(sourceFilename);
-    m_HeaderFile = cons().open_binary_file_for_writing(headerFilename);
+    // Generate the files in memory: they're written out by write_files() once they're finished
+    m_HeaderFile = create_output_file(headerFilename);
 
-    // TODO: check for errors (file streams will be NULL)
+    m_SourceParts[main_source] = create_output_file(m_FilenamePrefix + L".cpp");
+    if (m_SplitOutput) {
+        m_SourceParts[tables_source]    = create_output_file(m_FilenamePrefix + L"_tables.cpp");
+        m_SourceParts[ast_source]       = create_output_file(m_FilenamePrefix + L"_ast.cpp");
+    } else {
+        m_SourceParts[tables_source]    = m_SourceParts[main_source];
+        m_SourceParts[ast_source]       = m_SourceParts[main_source];
+    }
 
     // Write out a header
-    write_header(sourceFilename, m_SourceFile);
-    write_header(headerFilename, m_HeaderFile);
+    for (size_t fileNum = 0; fileNum < m_OutputFiles.size(); ++fileNum) {
+        write_header(m_OutputFiles[fileNum].first, m_OutputFiles[fileNum].second);
+    }
 
     // Write out the boilerplate at the start of the header (declare the class)
     *m_HeaderFile << "#ifndef TAMEPARSE_PARSER_" << toupper(get_identifier(m_FilenamePrefix, true)) << "\n";
     *m_HeaderFile << "#define TAMEPARSE_PARSER_" << toupper(get_identifier(m_FilenamePrefix, true)) << "\n";
     *m_HeaderFile << "\n";
 
+    // AST nodes can be allocated from an arena if the pooled-ast option is set
+    m_PooledAst = !cons().get_option(L"pooled-ast").empty();
+
     *m_HeaderFile << "#include \"TameParse/Util/syntax_ptr.h\"\n";
+    *m_HeaderFile << "#include \"TameParse/Util/prefetch.h\"\n";
+    if (m_PooledAst) {
+        *m_HeaderFile << "#include \"TameParse/Util/arena.h\"\n";
+        *m_HeaderFile << "#include \"TameParse/Util/small_vector.h\"\n";
+    }
     *m_HeaderFile << "#include \"TameParse/Dfa/lexer.h\"\n";
     *m_HeaderFile << "#include \"TameParse/Lr/parser.h\"\n";
+    *m_HeaderFile << "#include \"TameParse/Lr/event_parser.h\"\n";
+    *m_HeaderFile << "#include \"TameParse/Lr/syntax_tape.h\"\n";
     *m_HeaderFile << "#include \"TameParse/Lr/parser_tables.h\"\n";
+    *m_HeaderFile << "#include \"TameParse/Lr/compact_parser_tables.h\"\n";
     *m_HeaderFile << "\n";
     
     if (!m_Namespace.empty()) {
@@ -435,12 +470,30 @@ void output_cplusplus::begin_output() {
     // Add to the list of used class names
     m_UsedClassNames.insert(get_identifier(m_ClassName, false));
     
-    // Write out the boilerplate at the start of the source file (include the header)
-    *m_SourceFile << "#include \"" << cons().convert_filename(headerFilename) << "\"\n";
+    // Write out the boilerplate at the start of the source files (include the header)
+    for (size_t fileNum = 1; fileNum < m_OutputFiles.size(); ++fileNum) {
+        ostream& sourceFile = *m_OutputFiles[fileNum].second;
 
-    if (!m_Namespace.empty()) {
-        *m_SourceFile << "using namespace " << get_identifier(m_Namespace, false) << ";\n";
+        sourceFile << "#include \"" << cons().convert_filename(headerFilename) << "\"\n";
+
+        if (!m_Namespace.empty()) {
+            sourceFile << "using namespace " << get_identifier(m_Namespace, false) << ";\n";
+        }
     }
+
+    select_source(main_source);
+}
+
+/// \brief Creates a new in-memory output file with the specified name
+std::ostringstream* output_cplusplus::create_output_file(const std::wstring& filename) {
+    ostringstream* text = new ostringstream();
+    m_OutputFiles.push_back(make_pair(filename, text));
+    return text;
+}
+
+/// \brief Chooses the part of the source that the following code is written to
+void output_cplusplus::select_source(source_part part) {
+    m_SourceFile = m_SourceParts[part];
 }
 
 /// \brief Finishing writing out output
@@ -453,6 +506,88 @@ void output_cplusplus::end_output() {
     }
 
     *m_HeaderFile << "\n#endif\n";    // End of the conditional
+
+    write_files();
+}
+
+/// \brief Task that writes generated text to a file
+class write_text_task {
+public:
+    /// \brief The text to write for each task
+    vector<const string*> text;
+
+    /// \brief The file to write for each task
+    vector<ostream*> file;
+
+    void operator()(size_t index) {
+        file[index]->write(text[index]->data(), (streamsize) text[index]->size());
+        file[index]->flush();
+    }
+};
+
+/// \brief Returns true if the file with the specified name already contains exactly the specified text
+static bool file_contains(console& cons, const wstring& filename, const string& text) {
+    istream* existing = cons.open_file(filename);
+    if (!existing) return false;
+
+    bool    same = existing->good();
+    char    buffer[4096];
+    size_t  pos  = 0;
+
+    while (same && existing->good()) {
+        existing->read(buffer, sizeof(buffer));
+        size_t count = (size_t) existing->gcount();
+
+        same = pos + count <= text.size() && text.compare(pos, count, buffer, count) == 0;
+        pos += count;
+    }
+
+    delete existing;
+    return same && pos == text.size();
+}
+
+/// \brief Writes the generated source and header out to their files
+void output_cplusplus::write_files() {
+    vector<string>      texts;
+    vector<wstring>     filenames;
+    write_text_task     task;
+
+    for (size_t fileNum = 0; fileNum < m_OutputFiles.size(); ++fileNum) {
+        string text = m_OutputFiles[fileNum].second->str();
+
+        // When the output is split, files that haven't changed are left alone so they don't need to be recompiled
+        if (m_SplitOutput && file_contains(cons(), m_OutputFiles[fileNum].first, text)) {
+            continue;
+        }
+
+        texts.push_back(text);
+        filenames.push_back(m_OutputFiles[fileNum].first);
+    }
+
+    // The files are opened here, as the console might not be safe to use from multiple threads
+    bool ok = true;
+    for (size_t fileNum = 0; fileNum < filenames.size(); ++fileNum) {
+        ostream* file = cons().open_binary_file_for_writing(filenames[fileNum]);
+
+        if (!file || !file->good()) {
+            cons().report_error(error(error::sev_error, filename(), L"CANT_WRITE_OUTPUT", L"Could not open " + filenames[fileNum] + L" for writing", position(-1, -1, -1)));
+            if (file) delete file;
+            ok = false;
+            continue;
+        }
+
+        task.text.push_back(&texts[fileNum]);
+        task.file.push_back(file);
+    }
+
+    // Large tables can make these files tens of megabytes long, so they're written at the same time
+    if (ok && !task.file.empty()) {
+        util::parallel_for(task.file.size(), (unsigned int) task.file.size(), task);
+    }
+
+    for (size_t fileNum = 0; fileNum < task.file.size(); ++fileNum) {
+        delete task.file[fileNum];
+    }
 }
 
 
@@ -570,19 +705,72 @@ void output_cplusplus::source_symbol_map() {
     *m_SourceFile << "\n#include \"TameParse/Dfa/hard_coded_symbol_table.h\"\n";
 
     // Build up a symbol table from the symbol sets
-    symbol_table<wchar_t> symbolLevels;
+    symbol_table<wchar_t>   symbolLevels;
+    int                     outsideSet = symbol_set::null;
 
     // Iterate through the symbol ranges
     for (symbol_map_iterator symbolMap = begin_symbol_map(); symbolMap != end_symbol_map(); ++symbolMap) {
         symbolLevels.add_range(symbolMap->symbolRange, symbolMap->identifier);
+        
+        // Remember the set for characters outside the basic multilingual plane (these only occur if surrogates are disabled)
+        if (symbolMap->symbolRange.lower() <= 0x10000 && symbolMap->symbolRange.upper() > 0x10000) {
+            outsideSet = symbolMap->identifier;
+        }
     }
 
-    // Convert to a hard coded table and write out
-    *m_SourceFile << "\nstatic const int s_SymbolMapTable[] = {";
-
+    // Work out the size of the table with shared blocks
+    vector<unsigned char>   bmpBlocks;
+    vector<int>             bmpSets;
+    symbolLevels.to_bmp_blocks(bmpBlocks, bmpSets);
+    
+    size_t  bmpSize = bmpBlocks.size() + sizeof(int) * bmpSets.size();
+    
     // Convert to a hard-coded table
     size_t  size;
-    int*    hcst = symbolLevels.table.to_hard_coded_table(size);
+    int*    hcst        = symbolLevels.table.to_hard_coded_table(size);
+    size_t  rangedSize  = sizeof(int) * (256 + size);
+    
+    // The table with shared blocks needs fewer lookups, so use it unless it's much larger than the ranged table
+    if (bmpSize <= c_MaxBmpSymbolMapSize || bmpSize <= rangedSize * 2) {
+        delete[] hcst;
+        
+        *m_SourceFile << "\nstatic const unsigned char s_SymbolMapBlocks[256] = {";
+        
+        for (size_t blockNum = 0; blockNum < bmpBlocks.size(); ++blockNum) {
+            if ((blockNum % 16) == 0) {
+                *m_SourceFile << "\n        ";
+            }
+            
+            *m_SourceFile << dec << (int) bmpBlocks[blockNum];
+            if (blockNum+1 < bmpBlocks.size()) {
+                *m_SourceFile << ", ";
+            }
+        }
+        
+        *m_SourceFile << "\n    };\n";
+        *m_SourceFile << "\nstatic const int s_SymbolMapSets[] = {";
+        
+        for (size_t setPos = 0; setPos < bmpSets.size(); ++setPos) {
+            if ((setPos % 16) == 0) {
+                *m_SourceFile << "\n        ";
+            }
+            
+            *m_SourceFile << dec << bmpSets[setPos];
+            if (setPos+1 < bmpSets.size()) {
+                *m_SourceFile << ", ";
+            }
+        }
+        
+        *m_SourceFile << "\n    };\n";
+        
+        // Add the symbol table class
+        *m_SourceFile << "\ntypedef dfa::hard_coded_bmp_symbol_table<wchar_t> lexer_symbol_map;\n";
+        *m_SourceFile << "static const lexer_symbol_map s_SymbolMap(s_SymbolMapBlocks, s_SymbolMapSets, " << outsideSet << ");\n";
+        return;
+    }
+
+    // Write out the ranged table
+    *m_SourceFile << "\nstatic const int s_SymbolMapTable[] = {";
 
     // Write it out
     for (size_t tablePos = 0; tablePos < size; ++tablePos) {
@@ -604,8 +792,27 @@ void output_cplusplus::source_symbol_map() {
     // Finished the table
     *m_SourceFile << "\n    };\n";
     
+    // Write out the flat table for the first 256 characters
+    *m_SourceFile << "\nstatic const int s_SymbolMapFast[256] = {";
+    
+    for (int chr = 0; chr < 256; ++chr) {
+        // Add newlines
+        if ((chr % 16) == 0) {
+            *m_SourceFile << "\n        ";
+        }
+        
+        // Write out this entry
+        *m_SourceFile << dec << symbolLevels.lookup((wchar_t) chr);
+        if (chr+1 < 256) {
+            *m_SourceFile << ", ";
+        }
+    }
+    
+    *m_SourceFile << "\n    };\n";
+    
     // Add the symbol table class
-    *m_SourceFile << "\nstatic const dfa::hard_coded_symbol_table<wchar_t, 2> s_SymbolMap(s_SymbolMapTable);\n";
+    *m_SourceFile << "\ntypedef dfa::hard_coded_fast_symbol_table<wchar_t, 2> lexer_symbol_map;\n";
+    *m_SourceFile << "static const lexer_symbol_map s_SymbolMap(s_SymbolMapFast, s_SymbolMapTable);\n";
 }
 
 /// \brief Writes out the header items for the lexer state machine
@@ -614,10 +821,35 @@ void output_cplusplus::header_lexer_state_machine() {
     *m_HeaderFile << "\n        static const int number_of_lexer_states = " << count_lexer_states() << ";\n";
     *m_HeaderFile << "\npublic:\n";
     *m_HeaderFile << "    static const dfa::lexer lexer;\n";
+    
+    // UTF-8 lexers match bytes, so the parser should be given narrow streams (create_X<char>)
+    *m_HeaderFile << "    static const bool utf8_lexer = " << (cons().get_option(L"utf8-lexer").empty() ? "false" : "true") << ";\n";
+    
+    // Functions that run the lexer over a whole buffer without creating any lexemes
+    *m_HeaderFile << "\n";
+    *m_HeaderFile << "    static size_t tokenize(dfa::token_cursor& cursor, dfa::token* tokens, size_t maxTokens);\n";
+    *m_HeaderFile << "    static void tokenize_all(const int* begin, const int* end, std::vector<dfa::token>& tokens);\n";
+
+    // Write out the initial states for the named lexer modes, which can be passed to dfa::lexeme_stream::set_mode
+    if (count_lexer_modes() > 1) {
+        *m_HeaderFile << "\n    class mode {\n";
+        *m_HeaderFile << "    public:\n";
+        *m_HeaderFile << "        static const int default_mode = 0;\n";
+        
+        for (int mode = 1; mode < count_lexer_modes(); ++mode) {
+            *m_HeaderFile << "        static const int " << get_identifier(lexer_mode_name(mode), false) << " = " << mode << ";\n";
+        }
+        
+        *m_HeaderFile << "    };\n";
+        m_UsedClassNames.insert("mode");
+    }
 
     // Add to the list of used class names
     m_UsedClassNames.insert("number_of_lexer_states");
     m_UsedClassNames.insert("lexer");
+    m_UsedClassNames.insert("utf8_lexer");
+    m_UsedClassNames.insert("tokenize");
+    m_UsedClassNames.insert("tokenize_all");
 }
 
 /// \brief Writes out the source code for the lexer state machine
@@ -625,76 +857,126 @@ void output_cplusplus::source_lexer_state_machine() {
     // Need to include the state machine class
     *m_SourceFile << "\n#include \"TameParse/Dfa/state_machine.h\"\n";
 
-    // Begin writing out the state machine table
-    // TODO: support table styles other than 'compact' (the flat table is faster for all character types and more compact for some lexer types)
-    *m_SourceFile << "\nstatic const dfa::state_machine_compact_table<false>::entry s_LexerStateMachine[] = {\n";
-
-    // Set the current position
-    int entryPos = 0;
-
-    // Entry offset for each state
-    vector<int> stateToEntryOffset;
-    stateToEntryOffset.push_back(entryPos);
-
-    // Current state ID (initially -1)
-    int stateId = -1;
-
-    // Iterate through all of the transitions
+    // Gather the transitions for each state
+    vector<comb_vector::row> rows;
+    int numTransitions = 0;
+    
     for (lexer_state_transition_iterator transit = begin_lexer_state_transition(); transit != end_lexer_state_transition(); ++transit) {
-        // Deal with changes to the current state
-        if (transit->stateIdentifier != stateId) {
-            // Update the current state ID
-            stateId = transit->stateIdentifier;
-
-            // Write out entry offsets
-            while (stateId >= (int)stateToEntryOffset.size()) {
-                stateToEntryOffset.push_back(entryPos);
+        while (transit->stateIdentifier >= (int) rows.size()) {
+            rows.push_back(comb_vector::row());
+        }
+        
+        rows[transit->stateIdentifier].push_back(comb_vector::cell(transit->symbolSet, transit->newState));
+        ++numTransitions;
+    }
+    
+    // The number of states in the lexer
+    int numStates = (int) rows.size();
+    
+    // Work out the size of each representation of the table
+    comb_vector packed(rows);
+    
+    int     numFlatStates   = count_lexer_states();
+    int     numSets         = count_lexer_symbol_sets();
+    size_t  flatCellSize    = numFlatStates < 0xff ? 1 : numFlatStates < 0xffff ? 2 : sizeof(int);
+    size_t  flatSize        = flatCellSize * (size_t) numFlatStates * (size_t) numSets;
+    size_t  compactSize     = sizeof(state_machine_compact_table<false>::entry) * numTransitions + sizeof(void*) * numStates;
+    size_t  combSize        = comb_vector::size_for(packed.count_rows(), packed.count_cells());
+    
+    // Pick the representation to use
+    wstring style = cons().get_option(L"lexer-tables");
+    
+    if (style.empty() || style == L"auto") {
+        // Flat tables need a single load per character, but are only worthwhile if they aren't much larger than the
+        // alternatives. Comb tables are also constant time, so are preferred to the compact tables when they are smaller.
+        size_t smallest = combSize < compactSize ? combSize : compactSize;
+        
+        if (flatSize <= c_MaxAutoFlatLexerSize && flatSize <= smallest * c_MaxAutoFlatLexerRatio) {
+            style = L"flat";
+        } else if (combSize < compactSize) {
+            style = L"comb";
+        } else {
+            style = L"compact";
+        }
+    }
+    
+    // Write out the states that the lexer can skip through
+    dfa::skip_state* skip = find_lexer_skip_states();
+    
+    if (skip) {
+        *m_SourceFile << "\n#include \"TameParse/Dfa/skip_state.h\"\n";
+        *m_SourceFile << "\nstatic const dfa::skip_state s_SkipStates[] = {";
+        
+        for (int stateId = 0; stateId < numFlatStates; ++stateId) {
+            if (stateId > 0) {
+                *m_SourceFile << ", ";
             }
-
-            // Write out comments
-            *m_SourceFile << "\n\n        // State " << stateId << "\n        ";
+            if ((stateId%2) == 0) {
+                *m_SourceFile << "\n        ";
+            }
+            
+            // States that aren't skip states just need a count of 0
+            const dfa::skip_state& state = skip[stateId];
+            
+            *m_SourceFile << "{ " << state.count << ", { ";
+            for (int rangeNum = 0; rangeNum < dfa::skip_state::max_ranges; ++rangeNum) {
+                if (rangeNum > 0) *m_SourceFile << ", ";
+                *m_SourceFile << (state.count > 0 ? state.lower[rangeNum] : 0);
+            }
+            
+            *m_SourceFile << " }, { ";
+            for (int rangeNum = 0; rangeNum < dfa::skip_state::max_ranges; ++rangeNum) {
+                if (rangeNum > 0) *m_SourceFile << ", ";
+                *m_SourceFile << (state.count > 0 ? state.upper[rangeNum] : 0);
+            }
+            
+            *m_SourceFile << " }, { ";
+            for (int exitNum = 0; exitNum < dfa::skip_state::max_ascii_exits; ++exitNum) {
+                if (exitNum > 0) *m_SourceFile << ", ";
+                *m_SourceFile << (state.count > 0 ? state.ascii[exitNum] : 0x7f);
+            }
+            *m_SourceFile << " } }";
         }
-
-        // Write out some formatting
-        if (entryPos > 0) {
-            *m_SourceFile << ", ";
-            if ((entryPos%10) == 0) {
+        
+        *m_SourceFile << "\n    };\n";
+    }
+    
+    // Write out the states where the lexer can accept a lexeme without reading another symbol
+    bool* commit = find_lexer_commit_states();
+    
+    if (commit) {
+        *m_SourceFile << "\nstatic const bool s_CommitStates[] = {";
+        
+        for (int stateId = 0; stateId < numFlatStates; ++stateId) {
+            if (stateId > 0) {
+                *m_SourceFile << ", ";
+            }
+            if ((stateId%16) == 0) {
                 *m_SourceFile << "\n        ";
             }
+            
+            *m_SourceFile << (commit[stateId] ? "true" : "false");
         }
-
-        // Write out this transition
-        *m_SourceFile << "{ " << transit->symbolSet << ", " << transit->newState << " }";
-
-        // Update the lexer state position
-        ++entryPos;
+        
+        *m_SourceFile << "\n    };\n";
     }
-
-    // Finish off the table
-    *m_SourceFile << "\n    };\n";
-
-    // Add a final state to point to the end of the array
-    stateToEntryOffset.push_back(entryPos);
-
-    // Write out the rows table
-    *m_SourceFile << "\nstatic const dfa::state_machine_compact_table<false>::entry* s_LexerStates[" << stateToEntryOffset.size()-1 << "] = {\n        ";
-
-    // Write the actual rows
-    bool first = true;
-    for (vector<int>::iterator offset = stateToEntryOffset.begin(); offset != stateToEntryOffset.end()-1; ++offset) {
-        // Commas between entries
-        if (!first) *m_SourceFile << ", ";
-
-        // Entries point to a position in the state machine table
-        *m_SourceFile << "s_LexerStateMachine + " << *offset;
-
-        // No longer the first entry
-        first = false;
+    
+    if (style == L"flat") {
+        source_lexer_flat_tables(numFlatStates, numSets, flatCellSize);
+    } else if (style == L"direct") {
+        source_lexer_direct_code(numFlatStates, skip);
+    } else if (style == L"comb") {
+        source_lexer_comb_tables(packed);
+    } else if (style == L"compact") {
+        source_lexer_compact_tables();
+    } else {
+        wstringstream msg;
+        msg << L"Unknown lexer table style: " << style << L" (use flat, compact, comb, direct or auto)";
+        cons().report_error(error(error::sev_error, filename(), L"UNKNOWN_LEXER_TABLE_STYLE", msg.str(), position(-1, -1, -1)));
+        
+        source_lexer_compact_tables();
     }
 
-    // Finish off the table
-    *m_SourceFile << "\n    };\n";
-
     // Write out the table of state actions
     *m_SourceFile << "\nstatic const int s_AcceptingStates[] = {\n        ";
 
@@ -717,73 +999,498 @@ void output_cplusplus::source_lexer_state_machine() {
     // Finish up the acceptance table
     *m_SourceFile << "\n    };\n";
 
-    // Create a state machine
-    *m_SourceFile << "\ntypedef dfa::state_machine_tables<wchar_t, dfa::hard_coded_symbol_table<wchar_t, 2> > lexer_state_machine;\n";
-    *m_SourceFile << "static const lexer_state_machine s_StateMachine(s_SymbolMap, s_LexerStates, " << stateToEntryOffset.size()-1 << ");\n";
-
-    // Create the lexer itself
-    *m_SourceFile << "\ntypedef dfa::dfa_lexer_base<const lexer_state_machine&, 0, 0, false, const lexer_state_machine&> lexer_definition;\n";
-    *m_SourceFile << "static lexer_definition s_LexerDefinition(s_StateMachine, " << stateToEntryOffset.size()-1 << ", s_AcceptingStates);\n";
+    // Write out the keyword table, if there is one
+    const dfa::keyword_table& keywords = lexer_keywords();
+    
+    if (keywords.count_slots() > 0) {
+        *m_SourceFile << "\nstatic const dfa::keyword_table::entry s_KeywordSlots[] = {\n        ";
+        for (int slot = 0; slot < keywords.count_slots(); ++slot) {
+            const dfa::keyword_table::entry& entry = keywords.get_slot(slot);
+            
+            if (slot > 0) {
+                *m_SourceFile << ", ";
+                if ((slot % 8) == 0) *m_SourceFile << "\n        ";
+            }
+            *m_SourceFile << "{ " << entry.baseSymbol << ", " << entry.keywordSymbol << ", " << entry.textOffset << ", " << entry.length << (entry.foldCase ? ", true }" : ", false }");
+        }
+        *m_SourceFile << "\n    };\n";
+        
+        *m_SourceFile << "\nstatic const int s_KeywordText[] = {\n        ";
+        for (int pos = 0; pos < keywords.text_length(); ++pos) {
+            if (pos > 0) {
+                *m_SourceFile << ", ";
+                if ((pos % 16) == 0) *m_SourceFile << "\n        ";
+            }
+            *m_SourceFile << keywords.text()[pos];
+        }
+        *m_SourceFile << "\n    };\n";
+        
+        *m_SourceFile << "\nstatic const dfa::keyword_table s_Keywords(" << keywords.seed() << "u, " << keywords.count_slots() - 1 << "u, " << keywords.min_length() << ", " << keywords.max_length() << ", s_KeywordSlots, s_KeywordText" << (keywords.fold_case() ? ", true" : "") << ");\n";
+    }
+    
+    // Create the lexer itself (direct-coded lexers supply their own runner)
+    *m_SourceFile << "\ntypedef dfa::dfa_lexer_base<const lexer_state_machine&, 0, 0, false, const lexer_state_machine&";
+    if (style == L"direct") {
+        *m_SourceFile << ", lexer_direct_runner";
+    }
+    *m_SourceFile << "> lexer_definition;\n";
+    *m_SourceFile << "static lexer_definition s_LexerDefinition(s_StateMachine, " << numStates << ", s_AcceptingStates";
+    if (commit) {
+        *m_SourceFile << ", " << (skip ? "s_SkipStates" : "NULL") << ", " << (keywords.count_slots() > 0 ? "&s_Keywords" : "NULL") << ", s_CommitStates";
+    } else if (keywords.count_slots() > 0) {
+        *m_SourceFile << ", " << (skip ? "s_SkipStates" : "NULL") << ", &s_Keywords";
+    } else if (skip) {
+        *m_SourceFile << ", s_SkipStates";
+    }
+    *m_SourceFile << ");\n";
+    
+    delete[] skip;
+    delete[] commit;
 
     // Finally, the lexer class itself
     *m_SourceFile << "\nconst dfa::lexer " << get_identifier(m_ClassName, false) << "::lexer(&s_LexerDefinition, false);\n";
-}
-
-/// \brief Defines the symbols associated with this language
-void output_cplusplus::define_lexer_tables() {
-    header_symbol_map();
-    header_lexer_state_machine();
 
-    source_symbol_map();
-    source_lexer_state_machine();
+    // The tokenize functions call the lexer definition directly, so the state machine can be inlined
+    *m_SourceFile   << "\nsize_t " << get_identifier(m_ClassName, false) << "::tokenize(dfa::token_cursor& cursor, dfa::token* tokens, size_t maxTokens) {\n"
+                    << "    return s_LexerDefinition.lexer_definition::tokenize(cursor, tokens, maxTokens);\n"
+                    << "}\n"
+                    << "\nvoid " << get_identifier(m_ClassName, false) << "::tokenize_all(const int* begin, const int* end, std::vector<dfa::token>& tokens) {\n"
+                    << "    s_LexerDefinition.tokenize_all(begin, end, tokens);\n"
+                    << "}\n";
 }
 
-//              ===================
-//               Parser generation
-//              ===================
+/// \brief Writes out the lexer state machine using the compact table representation
+void output_cplusplus::source_lexer_compact_tables() {
+    // Gather the text of the transitions for each state (each entry is terminated by a '\0')
+    vector<string>  rows;
+    vector<int>     rowSizes;
+    
+    for (lexer_state_transition_iterator transit = begin_lexer_state_transition(); transit != end_lexer_state_transition(); ++transit) {
+        while (transit->stateIdentifier >= (int) rows.size()) {
+            rows.push_back(string());
+            rowSizes.push_back(0);
+        }
+        
+        string& row = rows[transit->stateIdentifier];
+        row += "{ ";
+        append_int(row, transit->symbolSet);
+        row += ", ";
+        append_int(row, transit->newState);
+        row += " }";
+        row += '\0';
+        
+        ++rowSizes[transit->stateIdentifier];
+    }
+    
+    // There is always at least one state
+    if (rows.empty()) {
+        rows.push_back(string());
+        rowSizes.push_back(0);
+    }
+    
+    int numStates = (int) rows.size();
+    
+    // States with the same transitions as an earlier state can share its entries. This needs a separate table of
+    // the end of the entries for each state, so it's only worthwhile if it saves more entries than there are states.
+    vector<int>         sameAs((size_t) numStates, -1);
+    map<string, int>    stateWithRow;
+    int                 numSharedEntries = 0;
+    
+    for (int stateId = 0; stateId < numStates; ++stateId) {
+        if (rows[stateId].empty()) continue;
+        
+        map<string, int>::iterator found = stateWithRow.find(rows[stateId]);
+        if (found == stateWithRow.end()) {
+            stateWithRow[rows[stateId]] = stateId;
+        } else {
+            sameAs[stateId]     = found->second;
+            numSharedEntries    += rowSizes[stateId];
+        }
+    }
+    
+    bool shareRows = numSharedEntries > numStates;
+    
+    // Begin writing out the state machine table
+    *m_SourceFile << "\nstatic const dfa::state_machine_compact_table<false>::entry s_LexerStateMachine[] = {\n";
 
-/// \brief Defines the parser tables for this language
-void output_cplusplus::define_parser_tables() {
-    header_parser_tables();
-    source_parser_tables();
-}
+    // Set the current position
+    int entryPos = 0;
 
-/// \brief Type of an action
-typedef lr::parser_tables::action action;
+    // Entry offset for each state
+    vector<int> stateToEntryOffset;
+    
+    // Write out the entries for each state
+    for (int stateId = 0; stateId < numStates; ++stateId) {
+        // States that share their entries refer to the earlier state
+        if (shareRows && sameAs[stateId] >= 0) {
+            stateToEntryOffset.push_back(stateToEntryOffset[sameAs[stateId]]);
+            continue;
+        }
+        
+        stateToEntryOffset.push_back(entryPos);
+        if (rows[stateId].empty()) continue;
+        
+        // Write out comments
+        *m_SourceFile << "\n\n        // State " << stateId << "\n        ";
+        
+        // Write out each transition
+        const string& row = rows[stateId];
+        for (size_t entryStart = 0; entryStart < row.size(); entryStart = row.find('\0', entryStart) + 1) {
+            // Write out some formatting
+            if (entryPos > 0) {
+                *m_SourceFile << ", ";
+                if ((entryPos%10) == 0) {
+                    *m_SourceFile << "\n        ";
+                }
+            }
+            
+            // Write out this transition
+            *m_SourceFile << row.c_str() + entryStart;
+            
+            // Update the lexer state position
+            ++entryPos;
+        }
+    }
 
-/// \brief Writes out an action table
-template<class get_count> void write_action_table(string tableName, const lr::parser_tables::action* const* actionTable, const lr::parser_tables& tables, ostream& output) {
-    // Count getter object
-    get_count gc;
+    // Finish off the table
+    *m_SourceFile << "\n    };\n";
 
-    // Start the table
-    output << "static lr::parser_tables::action " << tableName << "_data[] = {";
+    // Add a final state to point to the end of the array
+    stateToEntryOffset.push_back(entryPos);
 
-    // Iterate through the states
+    // Write out the rows table (the final entry marks the end of the last state)
+    *m_SourceFile << "\nstatic const dfa::state_machine_compact_table<false>::entry* const s_LexerStates[" << stateToEntryOffset.size() << "] = {\n        ";
+
+    // Write the actual rows
     bool first = true;
-    int count = 0;
-    for (int state = 0; state < tables.count_states(); ++state) {
-        // Add the actions for this state
-        int numActions = gc(tables, state);
-        
-        bool showingState = true;
-        output << "\n\n    // State " << state << "\n    ";
+    for (vector<int>::iterator offset = stateToEntryOffset.begin(); offset != stateToEntryOffset.end(); ++offset) {
+        // Commas between entries
+        if (!first) *m_SourceFile << ", ";
 
-        // Write out each action for this state
-        for (int actionId = 0; actionId < numActions; ++actionId) {
-            // Comma if this is not the first item
-            if (!first) {
-                output << ", ";
-            }
+        // Entries point to a position in the state machine table
+        *m_SourceFile << "s_LexerStateMachine + " << *offset;
 
-            // Add newlines for formatting
-            if ((count%5) == 0 && !showingState) {
-                output << "\n    ";
-            }
+        // No longer the first entry
+        first = false;
+    }
 
-            // Write out this action
+    // Finish off the table
+    *m_SourceFile << "\n    };\n";
+    
+    // Shared entries don't end where the next state begins, so the ends need their own table
+    if (shareRows) {
+        *m_SourceFile << "\nstatic const dfa::state_machine_compact_table<false>::entry* const s_LexerStateEnds[" << numStates << "] = {\n        ";
+        
+        for (int stateId = 0; stateId < numStates; ++stateId) {
+            if (stateId > 0) *m_SourceFile << ", ";
+            *m_SourceFile << "s_LexerStateMachine + " << stateToEntryOffset[stateId] + rowSizes[stateId];
+        }
+        
+        *m_SourceFile << "\n    };\n";
+    }
+
+    // Create a state machine
+    *m_SourceFile << "\ntypedef dfa::state_machine_tables<wchar_t, lexer_symbol_map> lexer_state_machine;\n";
+    *m_SourceFile << "static const lexer_state_machine s_StateMachine(s_SymbolMap, s_LexerStates, " << (shareRows ? "s_LexerStateEnds, " : "") << numStates << ");\n";
+}
+
+/// \brief Writes out an array of integers to the source file
+static void write_int_table(const string& tableName, const int* values, int count, ostream& output) {
+    static const c_array_encoder intEncoder("int", -1);
+    
+    output_table table(tableName);
+    for (int pos = 0; pos < count; ++pos) {
+        table.push_back(values[pos]);
+    }
+    
+    intEncoder.write(table, output);
+}
+
+/// \brief Writes out the lexer state machine using the flat table representation
+void output_cplusplus::source_lexer_flat_tables(int numStates, int numSets, size_t cellSize) {
+    // Build the table: entries are the new state plus one, with 0 indicating a rejection
+    vector<int> table((size_t) numStates * (size_t) numSets, 0);
+    
+    for (lexer_state_transition_iterator transit = begin_lexer_state_transition(); transit != end_lexer_state_transition(); ++transit) {
+        table[(size_t) transit->stateIdentifier * (size_t) numSets + transit->symbolSet] = transit->newState + 1;
+    }
+    
+    // Use the smallest type that can store every entry
+    string cellType = cellSize == 1 ? "unsigned char" : cellSize == 2 ? "unsigned short" : "int";
+    
+    *m_SourceFile << "\nstatic const " << cellType << " s_LexerStateMachine[] = {";
+    
+    // This table can be very large, so its text is built up without using the stream
+    string text;
+    text.reserve(table.size() * 6);
+    
+    for (size_t pos = 0; pos < table.size(); ++pos) {
+        // Each state starts on a new line
+        if ((pos % numSets) == 0) {
+            text += "\n\n        // State ";
+            append_int(text, (long) (pos / numSets));
+            text += "\n        ";
+        } else if ((pos % numSets) % 16 == 0) {
+            text += "\n        ";
+        }
+        
+        append_int(text, table[pos]);
+        if (pos+1 < table.size()) {
+            text += ", ";
+        }
+    }
+    
+    // Always write at least one entry so the array is valid
+    if (table.empty()) {
+        text += "\n        0";
+    }
+    
+    text += "\n    };\n";
+    m_SourceFile->write(text.data(), (streamsize) text.size());
+    
+    // Create a state machine
+    *m_SourceFile << "\ntypedef dfa::state_machine_flat_tables<wchar_t, lexer_symbol_map, " << cellType << "> lexer_state_machine;\n";
+    *m_SourceFile << "static const lexer_state_machine s_StateMachine(s_SymbolMap, s_LexerStateMachine, " << numStates << ", " << numSets << ");\n";
+}
+
+/// \brief Writes out the lexer state machine as code, with a label for each state
+///
+/// This generates a runner for dfa_lexer_base in the style of re2c: each state becomes a label followed by a switch
+/// statement on the symbol set of the next character, and accepting states record the accepted symbol before their
+/// label, so the transitions are compiled jumps rather than table lookups. States that loop back to themselves on all
+/// but a few symbols (see dfa::skip_state) get an extra label for the loop, which searches for the next exit symbol
+/// once a few symbols have been read.
+void output_cplusplus::source_lexer_direct_code(int numStates, const dfa::skip_state* skip) {
+    // Find the symbol accepted by each state
+    vector<int> accept((size_t) numStates, -1);
+    
+    for (lexer_state_action_iterator act = begin_lexer_state_action(); act != end_lexer_state_action(); ++act) {
+        if (act->accepting && act->stateId >= 0 && act->stateId < numStates) {
+            accept[act->stateId] = act->acceptSymbolId;
+        }
+    }
+    
+    // Group the symbol sets for each state by the state that they move to
+    typedef map<int, vector<int> > sets_for_state;
+    
+    vector<sets_for_state>  transitions((size_t) numStates);
+    vector<bool>            isTarget((size_t) numStates, false);
+    
+    for (lexer_state_transition_iterator transit = begin_lexer_state_transition(); transit != end_lexer_state_transition(); ++transit) {
+        transitions[transit->stateIdentifier][transit->newState].push_back(transit->symbolSet);
+        isTarget[transit->newState] = true;
+    }
+    
+    // The state machine just translates symbols for the runner
+    *m_SourceFile << "\ntypedef dfa::state_machine_direct_code<wchar_t, lexer_symbol_map> lexer_state_machine;\n";
+    *m_SourceFile << "static const lexer_state_machine s_StateMachine(s_SymbolMap, " << numStates << ");\n";
+    
+    // Begin the runner class (in an anonymous namespace so that several lexers can be linked into the same program)
+    *m_SourceFile << "\nnamespace {\n";
+    *m_SourceFile << "    class lexer_direct_runner {\n";
+    *m_SourceFile << "    public:\n";
+    *m_SourceFile << "        static int run(const lexer_state_machine& stateMachine, const int*, const dfa::skip_state*, int state, const int*& pos, const int* end, int& acceptSymbol, const int*& acceptPos) {\n";
+    *m_SourceFile << "            const int* next = pos;\n";
+    
+    // Jump to the initial state
+    *m_SourceFile << "\n            switch (state) {\n";
+    for (int stateId = 0; stateId < numStates; ++stateId) {
+        *m_SourceFile << "            case " << stateId << ": goto state_" << stateId << ";\n";
+    }
+    *m_SourceFile << "            default: return -1;\n";
+    *m_SourceFile << "            }\n";
+    
+    // Write out each state
+    for (int stateId = 0; stateId < numStates; ++stateId) {
+        *m_SourceFile << "\n";
+        
+        // Skip states search for the next exit when they loop back to themselves, once a few symbols have been read
+        bool isSkip = skip && skip[stateId].count > 0;
+        if (isSkip) {
+            *m_SourceFile << "        loop_" << stateId << ":\n";
+            *m_SourceFile << "            if (next - pos >= dfa::skip_state::min_run) {\n";
+            *m_SourceFile << "                next = dfa::find_exit(s_SkipStates[" << stateId << "], next, end);\n";
+            *m_SourceFile << "            }\n";
+        }
+        
+        // Accepting states record the symbol when they are entered from another state
+        if (accept[stateId] >= 0 && isTarget[stateId]) {
+            *m_SourceFile << "        accept_" << stateId << ":\n";
+            *m_SourceFile << "            acceptPos       = next;\n";
+            *m_SourceFile << "            acceptSymbol    = " << accept[stateId] << ";\n";
+        }
+        
+        *m_SourceFile << "        state_" << stateId << ":\n";
+        *m_SourceFile << "            if (next == end) { pos = next; return " << stateId << "; }\n";
+        
+        // States with no transitions reject the next symbol
+        if (transitions[stateId].empty()) {
+            *m_SourceFile << "            ++next;\n";
+            *m_SourceFile << "            pos = next;\n";
+            *m_SourceFile << "            return -1;\n";
+            continue;
+        }
+        
+        *m_SourceFile << "            switch (stateMachine.set_for_symbol((wchar_t) *(next++))) {\n";
+        
+        for (sets_for_state::const_iterator target = transitions[stateId].begin(); target != transitions[stateId].end(); ++target) {
+            *m_SourceFile << "            ";
+            
+            int count = 0;
+            for (vector<int>::const_iterator set = target->second.begin(); set != target->second.end(); ++set, ++count) {
+                if (count > 0 && (count % 8) == 0) {
+                    *m_SourceFile << "\n            ";
+                }
+                *m_SourceFile << "case " << *set << ": ";
+            }
+            
+            if (isSkip && target->first == stateId) {
+                *m_SourceFile << "goto loop_" << target->first << ";\n";
+            } else if (accept[target->first] >= 0) {
+                *m_SourceFile << "goto accept_" << target->first << ";\n";
+            } else {
+                *m_SourceFile << "goto state_" << target->first << ";\n";
+            }
+        }
+        
+        *m_SourceFile << "            default: pos = next; return -1;\n";
+        *m_SourceFile << "            }\n";
+    }
+    
+    // Finish the runner
+    *m_SourceFile << "        }\n";
+    *m_SourceFile << "    };\n";
+    *m_SourceFile << "}\n";
+}
+
+/// \brief Writes out the lexer state machine using the row-displacement table representation
+void output_cplusplus::source_lexer_comb_tables(const comb_vector& packed) {
+    write_int_table("s_LexerBase", packed.base(), packed.count_rows(), *m_SourceFile);
+    write_int_table("s_LexerCheck", packed.check(), packed.count_cells(), *m_SourceFile);
+    write_int_table("s_LexerNext", packed.value(), packed.count_cells(), *m_SourceFile);
+    
+    // Create a state machine
+    *m_SourceFile << "\ntypedef dfa::state_machine_comb_tables<wchar_t, lexer_symbol_map> lexer_state_machine;\n";
+    *m_SourceFile << "static const lexer_state_machine s_StateMachine(s_SymbolMap, s_LexerBase, s_LexerCheck, s_LexerNext, " << packed.count_rows() << ", " << packed.count_cells() << ");\n";
+}
+
+/// \brief Defines the symbols associated with this language
+void output_cplusplus::define_lexer_tables() {
+    header_symbol_map();
+    header_lexer_state_machine();
+
+    select_source(tables_source);
+    source_symbol_map();
+    source_lexer_state_machine();
+    select_source(main_source);
+}
+
+//              ===================
+//               Parser generation
+//              ===================
+
+/// \brief Defines the parser tables for this language
+void output_cplusplus::define_parser_tables() {
+    // Store the tables in narrower integers if all of the states, symbols and rules will fit
+    wstring style   = cons().get_option(L"parser-tables");
+    bool    fits    = lr::small_parser_tables::can_represent(get_parser_tables());
+    
+    if (style.empty() || style == L"auto") {
+        m_ParserTablesType = fits ? "lr::small_parser_tables" : "lr::parser_tables";
+    } else if (style == L"compact") {
+        if (fits) {
+            m_ParserTablesType = "lr::small_parser_tables";
+        } else {
+            cons().report_error(error(error::sev_warning, filename(), L"PARSER_TOO_LARGE_FOR_COMPACT_TABLES", L"The parser has too many states or symbols to use compact tables", position(-1, -1, -1)));
+            m_ParserTablesType = "lr::parser_tables";
+        }
+    } else if (style == L"wide") {
+        m_ParserTablesType = "lr::parser_tables";
+    } else {
+        wstringstream msg;
+        msg << L"Unknown parser table style: " << style << L" (use wide, compact or auto)";
+        cons().report_error(error(error::sev_error, filename(), L"UNKNOWN_PARSER_TABLE_STYLE", msg.str(), position(-1, -1, -1)));
+        
+        m_ParserTablesType = "lr::parser_tables";
+    }
+    
+    header_parser_tables();
+
+    select_source(tables_source);
+    source_parser_tables();
+    select_source(main_source);
+}
+
+/// \brief Type of an action
+typedef lr::parser_tables::action action;
+
+/// \brief Writes out an action table
+///
+/// States with exactly the same actions share a single row of the table
+template<class get_count> void write_action_table(string tableName, const string& tablesType, const lr::parser_tables::action* const* actionTable, const lr::parser_tables& tables, ostream& output) {
+    // Count getter object
+    get_count gc;
+
+    // Start the table
+    output << "static const " << tablesType << "::action " << tableName << "_data[] = {";
+
+    // The text for the actions is built up without using the stream, as there can be a very large number of them
+    string text;
+    
+    // The position of the row for each state, and the rows that have been written so far
+    vector<int>         rowPos;
+    map<string, int>    rowForActions;
+
+    // Iterate through the states
+    bool first = true;
+    int count = 0;
+    for (int state = 0; state < tables.count_states(); ++state) {
+        // Add the actions for this state
+        int numActions = gc(tables, state);
+        
+        // Build the text for the actions in this state
+        string actions;
+        for (int actionId = 0; actionId < numActions; ++actionId) {
             const action& thisAction = actionTable[state][actionId];
-            output << "{ " << thisAction.type << ", " << thisAction.nextState << ", " << thisAction.symbolId << " }";
+            actions += "{ ";
+            append_int(actions, thisAction.type);
+            actions += ", ";
+            append_int(actions, thisAction.nextState);
+            actions += ", ";
+            append_int(actions, thisAction.symbolId);
+            actions += " }";
+            actions += '\0';
+        }
+        
+        // Share the row of an earlier state if it had the same actions
+        map<string, int>::iterator sameRow = rowForActions.find(actions);
+        if (sameRow != rowForActions.end()) {
+            rowPos.push_back(sameRow->second);
+            continue;
+        }
+        
+        rowForActions[actions] = count;
+        rowPos.push_back(count);
+        
+        bool showingState = true;
+        text += "\n\n    // State ";
+        append_int(text, state);
+        text += "\n    ";
+
+        // Write out each action for this state
+        for (size_t actionStart = 0; actionStart < actions.size(); actionStart = actions.find('\0', actionStart) + 1) {
+            // Comma if this is not the first item
+            if (!first) {
+                text += ", ";
+            }
+
+            // Add newlines for formatting
+            if ((count%5) == 0 && !showingState) {
+                text += "\n    ";
+            }
+
+            // Write out this action
+            text += actions.c_str() + actionStart;
 
             // Move on
             first = false;
@@ -791,12 +1498,13 @@ template<class get_count> void write_action_table(string tableName, const lr::pa
             ++count;
         }
     }
-    output << "\n};\n";
+    
+    text += "\n};\n";
+    output.write(text.data(), (streamsize) text.size());
     
     // Output the final table
-    output << "static lr::parser_tables::action* " << tableName << "[] = {";
+    output << "static const " << tablesType << "::action* const " << tableName << "[] = {";
 
-    int pos = 0;
     count   = 0;
     first   = true;
     
@@ -812,11 +1520,7 @@ template<class get_count> void write_action_table(string tableName, const lr::pa
         }
 
         // Output this state
-        output << tableName << "_data + " << pos;
-        
-        // Add the actions for this state
-        int numActions = gc(tables, state);
-        pos += numActions;
+        output << tableName << "_data + " << rowPos[state];
         
         // Move on
         ++count;
@@ -826,6 +1530,19 @@ template<class get_count> void write_action_table(string tableName, const lr::pa
     output << "\n};\n";
 }
 
+/// \brief Writes out a row-displacement index for an action table, returning the name of the index or "NULL" if there isn't one
+static string write_action_index(const string& tableName, const comb_vector* index, ostream& output) {
+    if (!index) return "NULL";
+    
+    write_int_table(tableName + "_base", index->base(), index->count_rows(), output);
+    write_int_table(tableName + "_check", index->check(), index->count_cells(), output);
+    write_int_table(tableName + "_offset", index->value(), index->count_cells(), output);
+    
+    output << "static const util::comb_vector " << tableName << "(" << tableName << "_base, " << tableName << "_check, " << tableName << "_offset, " << index->count_rows() << ", " << index->count_cells() << ");\n";
+    
+    return "&" + tableName;
+}
+
 /// \brief Functor that returns the number of actions for a given terminal object
 class count_terminal_actions {
 public:
@@ -846,7 +1563,24 @@ public:
 void output_cplusplus::header_parser_tables() {
     *m_HeaderFile   << "\n"
                 << "public:\n"
-                << "    static const lr::parser_tables lr_tables;\n";
+                << "    static const " << m_ParserTablesType << " lr_tables;\n"
+                << "\n"
+                << "    static const bool skipped_symbols[];\n"
+                << "    static const int count_skipped_symbols;\n"
+                << "\n"
+                << "    inline static dfa::lexeme_stream* skip_ignored(dfa::lexeme_stream* stream) {\n";
+    
+    // Streams return every lexeme when trivia is being kept
+    if (cons().get_option(L"keep-trivia").empty()) {
+        *m_HeaderFile << "        stream->skip_symbols(skipped_symbols, count_skipped_symbols);\n";
+    }
+    
+    *m_HeaderFile   << "        return stream;\n"
+                    << "    }\n";
+    
+    m_UsedClassNames.insert("skipped_symbols");
+    m_UsedClassNames.insert("count_skipped_symbols");
+    m_UsedClassNames.insert("skip_ignored");
 }
 
 /// \brief Writes out the source code for the parser tables
@@ -862,17 +1596,52 @@ void output_cplusplus::source_parser_tables() {
     
     // Need to include the parser tables file
     *m_SourceFile << "\n#include \"TameParse/Lr/parser_tables.h\"\n";
+    *m_SourceFile << "#include \"TameParse/Lr/compact_parser_tables.h\"\n";
     
     // Write out the terminal actions
     *m_SourceFile << "\n";
-    write_action_table<count_terminal_actions>("s_TerminalActions", tables.terminal_actions(), tables, *m_SourceFile);
+    write_action_table<count_terminal_actions>("s_TerminalActions", m_ParserTablesType, tables.terminal_actions(), tables, *m_SourceFile);
     
     // ... and the nonterminal actions
     *m_SourceFile << "\n";
-    write_action_table<count_nonterminal_actions>("s_NonterminalActions", tables.nonterminal_actions(), tables, *m_SourceFile);
+    write_action_table<count_nonterminal_actions>("s_NonterminalActions", m_ParserTablesType, tables.nonterminal_actions(), tables, *m_SourceFile);
+    
+    // Write out the default reductions (states that have these have no terminal actions)
+    *m_SourceFile << "\nstatic const " << m_ParserTablesType << "::action s_DefaultReductions[] = {";
+    
+    for (int stateId=0; stateId < tables.count_states(); ++stateId) {
+        // Comma
+        if (stateId > 0) {
+            *m_SourceFile << ", ";
+        }
+        
+        // Newline
+        if ((stateId%5) == 0) {
+            *m_SourceFile << "\n    ";
+        }
+        
+        // Write out the default reduction for this state
+        const action& defaultReduction = tables.default_reductions()[stateId];
+        *m_SourceFile << "{ " << defaultReduction.type << ", " << defaultReduction.nextState << ", " << defaultReduction.symbolId << " }";
+    }
+    
+    *m_SourceFile << "\n};\n";
+    
+    // Index the actions so the parser can find them without searching (re-using the indexes built with the tables if there are any)
+    comb_vector* newTerminalIndex           = tables.terminal_index() ? NULL : tables.create_terminal_index();
+    comb_vector* newNonterminalIndex        = tables.nonterminal_index() ? NULL : tables.create_nonterminal_index();
+    
+    const comb_vector* terminalIndex        = newTerminalIndex ? newTerminalIndex : tables.terminal_index();
+    const comb_vector* nonterminalIndex     = newNonterminalIndex ? newNonterminalIndex : tables.nonterminal_index();
+    
+    string terminalIndexName                = write_action_index("s_TerminalIndex", terminalIndex, *m_SourceFile);
+    string nonterminalIndexName             = write_action_index("s_NonterminalIndex", nonterminalIndex, *m_SourceFile);
+    
+    delete newTerminalIndex;
+    delete newNonterminalIndex;
     
     // Write out the action counts
-    *m_SourceFile << "\nstatic lr::parser_tables::action_count s_ActionCounts[] = {";
+    *m_SourceFile << "\nstatic const " << m_ParserTablesType << "::action_count s_ActionCounts[] = {";
     
     first   = true;
     count   = 0;
@@ -898,7 +1667,7 @@ void output_cplusplus::source_parser_tables() {
     *m_SourceFile << "\n};\n";
     
     // Write out the end guard states
-    *m_SourceFile << "\nstatic int s_EndGuardStates[] = {";
+    *m_SourceFile << "\nstatic const int s_EndGuardStates[] = {";
     
     first   = true;
     count   = 0;
@@ -924,7 +1693,7 @@ void output_cplusplus::source_parser_tables() {
     *m_SourceFile << "\n};\n";
 
     // Write out the reduce rules
-    *m_SourceFile << "\nstatic lr::parser_tables::reduce_rule s_ReduceRules[] = {";
+    *m_SourceFile << "\nstatic const " << m_ParserTablesType << "::reduce_rule s_ReduceRules[] = {";
     
     first   = true;
     count   = 0;
@@ -951,7 +1720,7 @@ void output_cplusplus::source_parser_tables() {
     *m_SourceFile << "\n};\n";
     
     // Finally, the weak to strong equivalence table
-    *m_SourceFile << "\nstatic lr::parser_tables::symbol_equivalent s_WeakToStrong[] = {";
+    *m_SourceFile << "\nstatic const " << m_ParserTablesType << "::symbol_equivalent s_WeakToStrong[] = {";
     
     first   = true;
     count   = 0;
@@ -976,15 +1745,99 @@ void output_cplusplus::source_parser_tables() {
     
     *m_SourceFile << "\n};\n";
     
-    // Generate the parser tables
-    *m_SourceFile   << "\nconst lr::parser_tables " << get_identifier(m_ClassName, false) << "::lr_tables(" 
+    // The same table indexed directly by symbol, so weak symbols can be shifted without a search
+    int numStrongForWeak = tables.count_strong_for_weak();
+    
+    if (numStrongForWeak > 0) {
+        *m_SourceFile << "\nstatic const int s_StrongForWeak[] = {";
+        
+        for (int symbolId = 0; symbolId < numStrongForWeak; ++symbolId) {
+            if (symbolId > 0)           *m_SourceFile << ", ";
+            if ((symbolId%20) == 0)     *m_SourceFile << "\n    ";
+            
+            *m_SourceFile << tables.strong_for_weak_table()[symbolId];
+        }
+        
+        *m_SourceFile << "\n};\n";
+    }
+    
+    // The most common goto for each nonterminal, which isn't stored with the nonterminal actions
+    int numDefaultGotos = tables.default_gotos() ? tables.count_default_gotos() : 0;
+    
+    if (numDefaultGotos > 0) {
+        *m_SourceFile << "\nstatic const int s_DefaultGotos[] = {";
+        
+        for (int nonterminal = 0; nonterminal < numDefaultGotos; ++nonterminal) {
+            if (nonterminal > 0)            *m_SourceFile << ", ";
+            if ((nonterminal%20) == 0)      *m_SourceFile << "\n    ";
+            
+            *m_SourceFile << tables.default_gotos()[nonterminal];
+        }
+        
+        *m_SourceFile << "\n};\n";
+    }
+    
+    // A byte of flags for each state, so the parser can tell which states have guards and so on without a search
+    // (compact tables don't use these)
+    bool writeStateFlags = m_ParserTablesType == "lr::parser_tables" && tables.state_flag_table() != NULL;
+    
+    if (writeStateFlags) {
+        *m_SourceFile << "\nstatic const unsigned char s_StateFlags[] = {";
+        
+        for (int stateId = 0; stateId < tables.count_states(); ++stateId) {
+            if (stateId > 0)            *m_SourceFile << ", ";
+            if ((stateId%20) == 0)      *m_SourceFile << "\n    ";
+            
+            *m_SourceFile << (int) tables.state_flag_table()[stateId];
+        }
+        
+        *m_SourceFile << "\n};\n";
+    }
+    
+    // Generate the parser tables (parser_tables is told not to copy the indexes, compact tables never do)
+    *m_SourceFile   << "\nconst " << m_ParserTablesType << " " << get_identifier(m_ClassName, false) << "::lr_tables(" 
                     << tables.count_states() << ", " << tables.end_of_input() << ", " 
                     << tables.end_of_guard() 
                     << ", s_TerminalActions, s_NonterminalActions, s_ActionCounts, s_EndGuardStates, " 
                     << tables.count_end_of_guards() << ", " << tables.count_reduce_rules() << ", "
                     << "s_ReduceRules, " << tables.count_weak_to_strong() << ", "
-                    << "s_WeakToStrong"
+                    << "s_WeakToStrong, s_DefaultReductions, "
+                    << terminalIndexName << ", " << nonterminalIndexName
+                    << (m_ParserTablesType == "lr::parser_tables" ? ", false" : "")
+                    << ", " << numStrongForWeak << ", " << (numStrongForWeak > 0 ? "s_StrongForWeak" : "NULL")
+                    << ", " << numDefaultGotos << ", " << (numDefaultGotos > 0 ? "s_DefaultGotos" : "NULL")
+                    << (writeStateFlags ? ", s_StateFlags" : "")
                     << ");\n";
+    
+    // Write out the symbols that are ignored in every state, so the lexer can skip them
+    vector<int> ignored;
+    tables.find_ignored_symbols(ignored);
+    
+    int numSkipped = ignored.empty() ? 0 : ignored.back() + 1;
+    
+    *m_SourceFile << "\nconst bool " << get_identifier(m_ClassName, false) << "::skipped_symbols[] = {";
+    
+    vector<int>::const_iterator nextIgnored = ignored.begin();
+    for (int symbolId = 0; symbolId < numSkipped || symbolId == 0; ++symbolId) {
+        // Comma
+        if (symbolId > 0) {
+            *m_SourceFile << ", ";
+        }
+        
+        // Newline
+        if ((symbolId%10) == 0) {
+            *m_SourceFile << "\n    ";
+        }
+        
+        // Write out whether or not this symbol is skipped
+        bool skipped = nextIgnored != ignored.end() && *nextIgnored == symbolId;
+        if (skipped) ++nextIgnored;
+        
+        *m_SourceFile << (skipped ? "true" : "false");
+    }
+    
+    *m_SourceFile   << "\n};\n"
+                    << "const int " << get_identifier(m_ClassName, false) << "::count_skipped_symbols = " << numSkipped << ";\n";
 
     // Add to the list of used class names
     m_UsedClassNames.insert("lr_tables");
@@ -996,33 +1849,73 @@ void output_cplusplus::source_parser_tables() {
 
 /// \brief Writes out the AST tables
 void output_cplusplus::define_ast_tables() {
+    find_unit_rules();
+
     header_ast_forward_declarations();
     header_ast_class_declarations();
+    header_ast_visitor();
+    header_stream_events();
     header_parser_actions();
+    header_parser_events();
 
+    select_source(ast_source);
     source_ast_class_definitions();
     source_ast_class_constructors();
     source_ast_position_functions();
+    source_ast_visitor();
+    select_source(main_source);
+
     source_shift_actions();
+    source_unit_rule_restore();
     source_reduce_actions();
+    source_event_reduce();
 
     // Output the parser definition
     *m_HeaderFile   << "\npublic:\n"
                     << "    typedef util::syntax_ptr<syntax_node> syntax_node_container;\n"
-                    << "    typedef lr::parser<syntax_node_container, parser_actions> ast_parser_type;\n"
-                    << "    static const ast_parser_type ast_parser;\n";
+                    << "    typedef lr::parser<syntax_node_container, parser_actions, lr::no_parser_trace, " << m_ParserTablesType << "> ast_parser_type;\n"
+                    << "    static const ast_parser_type ast_parser;\n"
+                    << "\n"
+                    << "    typedef lr::parser<lr::parser_events::value, lr::event_parser_actions, lr::no_parser_trace, " << m_ParserTablesType << "> event_parser_type;\n"
+                    << "    static const event_parser_type event_parser;\n"
+                    << "\n"
+                    << "    typedef lr::parser<int, lr::tape_parser_actions, lr::no_parser_trace, " << m_ParserTablesType << "> tape_parser_type;\n"
+                    << "    static const tape_parser_type tape_parser;\n"
+                    << "\n"
+                    << "    typedef lr::lazy_syntax_tree<syntax_node_container, parser_actions> lazy_tree;\n"
+                    << "    typedef lr::replayed_syntax_tree<syntax_node_container, parser_actions> replayed_tree;\n"
+                    << "\n"
+                    << "    // Builds the AST for a syntax tape that was written with lr::syntax_tape::write() (NULL if it can't be read)\n"
+                    << "    inline static syntax_node_container read_ast(std::istream& source) {\n"
+                    << "        lr::syntax_tape tape;\n"
+                    << "        if (!tape.read(source) || tape.size() == 0) return syntax_node_container();\n"
+                    << "\n"
+                    << "        parser_actions actions(NULL);\n"
+                    << "        lazy_tree tree(tape, actions);\n"
+                    << "        return tree.get(tape.size() - 1);\n"
+                    << "    }\n";
     
-    *m_SourceFile   << "\nconst " << get_identifier(m_ClassName, false) << "::ast_parser_type " << get_identifier(m_ClassName, false) << "::ast_parser(&lr_tables, false);\n";
+    *m_SourceFile   << "\nconst " << get_identifier(m_ClassName, false) << "::ast_parser_type " << get_identifier(m_ClassName, false) << "::ast_parser(&lr_tables, false);\n"
+                    << "const " << get_identifier(m_ClassName, false) << "::event_parser_type " << get_identifier(m_ClassName, false) << "::event_parser(&lr_tables, false);\n"
+                    << "const " << get_identifier(m_ClassName, false) << "::tape_parser_type " << get_identifier(m_ClassName, false) << "::tape_parser(&lr_tables, false);\n";
 
     // Generate functions for creating new parsers
     header_start_symbols();
+    
+    // Generate the direct-coded parser if it's wanted
+    define_direct_parser();
+    
+    // ... and the static parser
+    define_static_parser();
 }
 
 /// \brief Writes out inline functions to generate initial parser states for specific start symbols
 void output_cplusplus::header_start_symbols() {
     // Begin writing out the definitions
     *m_HeaderFile   << "\npublic:\n"
-                    << "    typedef ast_parser_type::state state;\n";
+                    << "    typedef ast_parser_type::state state;\n"
+                    << "    typedef event_parser_type::state event_state;\n"
+                    << "    typedef tape_parser_type::state tape_state;\n";
 
     // Fetch the start symbols
     const vector<wstring>& startSymbols = get_start_symbols();
@@ -1044,11 +1937,33 @@ void output_cplusplus::header_start_symbols() {
                         << "    }\n"
                         << "\n"
                         << "    template<typename char_type, typename traits> inline static state* create_" << startName << "(std::basic_istream<char_type, traits>& input) {\n"
-                        << "        return create_" << startName << "(lexer.create_stream_from<char_type, traits>(input), true);\n"
+                        << "        return create_" << startName << "(skip_ignored(lexer.create_stream_from<char_type, traits>(input)), true);\n"
                         << "    }\n"
                         << "\n"
                         << "    template<typename char_type, typename custom_stream_alike> inline static state* create_" << startName << "(custom_stream_alike& input) {\n"
-                        << "        return create_" << startName << "(lexer.create_stream_from<char_type, custom_stream_alike>(input), true);\n"
+                        << "        return create_" << startName << "(skip_ignored(lexer.create_stream_from<char_type, custom_stream_alike>(input)), true);\n"
+                        << "    }\n"
+                        << "\n"
+                        << "    template<typename char_type, typename traits> inline static state* create_" << startName << "_streaming(std::basic_istream<char_type, traits>& input, stream_events* events) {\n"
+                        << "        parser_actions* actions = new parser_actions(skip_ignored(lexer.create_stream_from<char_type, traits>(input)), true);\n"
+                        << "        actions->set_stream_events(events);\n"
+                        << "        return create_" << startName << "(actions);\n"
+                        << "    }\n"
+                        << "\n"
+                        << "    inline static event_state* create_" << startName << "_events(dfa::lexeme_stream* stream, parser_events* events, bool deleteStream = false) {\n"
+                        << "        return event_parser.create_parser(new lr::event_parser_actions(stream, events, deleteStream), " << initialState << ");\n"
+                        << "    }\n"
+                        << "\n"
+                        << "    template<typename char_type, typename traits> inline static event_state* create_" << startName << "_events(std::basic_istream<char_type, traits>& input, parser_events* events) {\n"
+                        << "        return create_" << startName << "_events(skip_ignored(lexer.create_stream_from<char_type, traits>(input)), events, true);\n"
+                        << "    }\n"
+                        << "\n"
+                        << "    inline static tape_state* create_" << startName << "_tape(dfa::lexeme_stream* stream, lr::syntax_tape* tape, bool deleteStream = false) {\n"
+                        << "        return tape_parser.create_parser(new lr::tape_parser_actions(stream, tape, deleteStream), " << initialState << ");\n"
+                        << "    }\n"
+                        << "\n"
+                        << "    template<typename char_type, typename traits> inline static tape_state* create_" << startName << "_tape(std::basic_istream<char_type, traits>& input, lr::syntax_tape* tape) {\n"
+                        << "        return create_" << startName << "_tape(skip_ignored(lexer.create_stream_from<char_type, traits>(input)), tape, true);\n"
                         << "    }\n";
 
         // Move the initial state on
@@ -1058,15 +1973,21 @@ void output_cplusplus::header_start_symbols() {
 
 /// \brief Writes out the forward declarations for the classes that represent items in the grammar
 void output_cplusplus::header_ast_forward_declarations() {
-    // Write out the AST syntax base class
+    // Write out the AST syntax base class (pooled nodes can be allocated from an arena)
     *m_HeaderFile   << "\n"
                     << "public:\n"
-                    << "    class syntax_node {\n"
+                    << "    class visitor;\n"
+                    << "\n"
+                    << "    class syntax_node" << (m_PooledAst ? " : public util::arena_object" : "") << " {\n"
                     << "    public:\n"
                     << "        virtual ~syntax_node();\n"
                     << "        virtual std::wstring to_string();\n"
                     << "        virtual dfa::position pos() const;\n"
                     << "        virtual dfa::position final_pos() const;\n"
+                    << "\n"
+                    << "        virtual bool accept_visit(visitor& v) const;\n"
+                    << "        virtual void accept_leave(visitor& v) const;\n"
+                    << "        virtual void child_nodes(std::vector<const syntax_node*>& children) const;\n"
                     << "    };\n";
 
     // Create a class that will represent a terminal item
@@ -1085,6 +2006,9 @@ void output_cplusplus::header_ast_forward_declarations() {
                     << "        virtual dfa::position pos() const;\n"
                     << "\n"
                     << "        virtual dfa::position final_pos() const;\n"
+                    << "\n"
+                    << "        virtual bool accept_visit(visitor& v) const;\n"
+                    << "        virtual void accept_leave(visitor& v) const;\n"
                     << "    };\n";
     
     // Iterate through the terminals
@@ -1131,10 +2055,13 @@ void output_cplusplus::header_ast_class_declarations() {
         name += s_TypeSuffix;
 
         // Declare a class for this item
-        *m_HeaderFile   << "\n    // " << get_identifier(terminals().name_for_symbol(term->identifier), true) << "\n"
+        *m_HeaderFile   << "\n    // " << get_identifier(term->name, true) << "\n"
                         << "    class " << name << " : public terminal {\n"
                         << "    public:\n"
                         << "        " << name << "(const dfa::lexeme_container& lex) : terminal(lex) { }\n"
+                        << "\n"
+                        << "        virtual bool accept_visit(visitor& v) const;\n"
+                        << "        virtual void accept_leave(visitor& v) const;\n"
                         << "    };\n";
     }
 
@@ -1173,7 +2100,11 @@ void output_cplusplus::header_ast_class_declarations() {
                                     << "\n"
                                     << "    public:\n"
                                     << "        virtual dfa::position pos() const;\n"
-                                    << "        virtual dfa::position final_pos() const;\n";
+                                    << "        virtual dfa::position final_pos() const;\n"
+                                    << "\n"
+                                    << "        virtual bool accept_visit(visitor& v) const;\n"
+                                    << "        virtual void accept_leave(visitor& v) const;\n"
+                                    << "        virtual void child_nodes(std::vector<const syntax_node*>& children) const;\n";
         }
 
         // Get the definition for this item
@@ -1253,12 +2184,13 @@ void output_cplusplus::header_ast_class_declarations() {
 
             // Declare a constructor for this rule
             if (declareConstructor) {
-                *m_HeaderFile   << "\n    public:\n"
-                                << "        " << ntContentClass << "(";
-                
+                // Build up the parameter lists: one taking references, and one that can move the items out of temporaries
+                stringstream    copyParameters;
+                stringstream    moveParameters;
+                bool            first = true;
+                int             index = 0;
+
                 // Iterate through the items in this rule
-                bool    first = true;
-                int     index = 0;
                 for (ast_rule_item_list::const_iterator ruleItem = ruleDefn->second.begin(); ruleItem != ruleDefn->second.end(); ++ruleItem) {
                     // Ignore guards
                     if (ruleItem->item->type() == item::guard) continue;
@@ -1272,11 +2204,13 @@ void output_cplusplus::header_ast_class_declarations() {
 
                     // Add to the list of parameters
                     if (!first) {
-                        *m_HeaderFile << ", ";
+                        copyParameters << ", ";
+                        moveParameters << ", ";
                     }
 
                     // Declare as a reference to the syntax pointer
-                    *m_HeaderFile << "const util::syntax_ptr<class " << typeName << s_TypeSuffix << ">& " << typeName << "_" << index;
+                    copyParameters << "const util::syntax_ptr<class " << typeName << s_TypeSuffix << ">& " << typeName << "_" << index;
+                    moveParameters << "util::syntax_ptr<class " << typeName << s_TypeSuffix << ">&& " << typeName << "_" << index;
 
                     // No longer the first rule
                     first = false;
@@ -1285,10 +2219,18 @@ void output_cplusplus::header_ast_class_declarations() {
 
                 // If there were no valid items, then we need to add a position to this constructor
                 if (!validItems) {
-                    *m_HeaderFile << "const dfa::position& pos";
+                    copyParameters << "const dfa::position& pos";
                 }
 
-                *m_HeaderFile << ");\n";
+                *m_HeaderFile   << "\n    public:\n"
+                                << "        " << ntContentClass << "(" << copyParameters.str() << ");\n";
+
+                // Items constructed from temporaries (as they are when reducing) can take over the references to their children
+                if (validItems) {
+                    *m_HeaderFile   << "#if __cplusplus >= 201103L\n"
+                                    << "        " << ntContentClass << "(" << moveParameters.str() << ");\n"
+                                    << "#endif\n";
+                }
             }
         }
 
@@ -1303,7 +2245,16 @@ void output_cplusplus::header_ast_class_declarations() {
                             << "    class " << ntName << " : public syntax_node {\n"
                             << "    public:\n"
                             << "        typedef util::syntax_ptr<class " << ntName << s_ContentSuffix << "> node_type;\n"
-                            << "        typedef std::vector<node_type> data_type;\n"
+                            << "        typedef ";
+            
+            // Pooled ASTs keep the first few items inside the node
+            if (m_PooledAst) {
+                *m_HeaderFile << "util::small_vector<node_type, " << c_PooledAstInlineItems << ">";
+            } else {
+                *m_HeaderFile << "std::vector<node_type>";
+            }
+            
+            *m_HeaderFile   << " data_type;\n"
                             << "        typedef data_type::const_iterator iterator;\n"
                             << "\n"
                             << "    private:\n"
@@ -1318,10 +2269,17 @@ void output_cplusplus::header_ast_class_declarations() {
                             << "        inline iterator end() const { return m_Data.end(); }\n"
                             << "\n"
                             << "        inline void add_child(const node_type& newChild) { m_Data.push_back(newChild); }\n"
+                            << "#if __cplusplus >= 201103L\n"
+                            << "        inline void add_child(node_type&& newChild) { m_Data.push_back(std::move(newChild)); }\n"
+                            << "#endif\n"
                             << "        inline void set_position(const dfa::position& newPos) { m_Position = newPos; }\n"
                             << "\n"
                             << "        virtual dfa::position pos() const;\n"
                             << "        virtual dfa::position final_pos() const;\n"
+                            << "\n"
+                            << "        virtual bool accept_visit(visitor& v) const;\n"
+                            << "        virtual void accept_leave(visitor& v) const;\n"
+                            << "        virtual void child_nodes(std::vector<const syntax_node*>& children) const;\n"
                             << "    };\n";
         }
     }
@@ -1334,12 +2292,17 @@ void output_cplusplus::source_ast_class_definitions() {
                     << get_identifier(m_ClassName, false) << "::syntax_node::~syntax_node() { }\n"
                     << "std::wstring " << get_identifier(m_ClassName, false) << "::syntax_node::to_string() { return L\"syntax_node\"; }\n"
                     << "dfa::position " << get_identifier(m_ClassName, false) << "::syntax_node::pos() const { return dfa::position(-1, -1, -1); }\n"
-                    << "dfa::position " << get_identifier(m_ClassName, false) << "::syntax_node::final_pos() const { return dfa::position(-1, -1, -1); }\n";
+                    << "dfa::position " << get_identifier(m_ClassName, false) << "::syntax_node::final_pos() const { return dfa::position(-1, -1, -1); }\n"
+                    << "bool " << get_identifier(m_ClassName, false) << "::syntax_node::accept_visit(visitor& v) const { return v.visit(this); }\n"
+                    << "void " << get_identifier(m_ClassName, false) << "::syntax_node::accept_leave(visitor& v) const { v.leave(this); }\n"
+                    << "void " << get_identifier(m_ClassName, false) << "::syntax_node::child_nodes(std::vector<const syntax_node*>& children) const { }\n";
 
     // Write out the definition of a terminal symbol
     *m_SourceFile << "\n" << get_identifier(m_ClassName, false) << "::terminal::terminal(const dfa::lexeme_container& lexeme) : m_Lexeme(lexeme) { }\n";
     *m_SourceFile << "\ndfa::position " << get_identifier(m_ClassName, false) << "::terminal::pos() const { return m_Lexeme->pos(); }\n";
     *m_SourceFile << "\ndfa::position " << get_identifier(m_ClassName, false) << "::terminal::final_pos() const { return m_Lexeme->final_pos(); }\n";
+    *m_SourceFile << "\nbool " << get_identifier(m_ClassName, false) << "::terminal::accept_visit(visitor& v) const { return v.visit(this); }\n";
+    *m_SourceFile << "void " << get_identifier(m_ClassName, false) << "::terminal::accept_leave(visitor& v) const { v.leave(this); }\n";
 }
 
 /// \brief Writes out the constructors for each nonterminal symbol
@@ -1389,11 +2352,14 @@ void output_cplusplus::source_ast_class_constructors() {
 
             // Write out the declaration for this constructor
             *m_SourceFile << "\n// Rule " << ruleDefn->first << "\n";
-            *m_SourceFile << get_identifier(m_ClassName, false) << "::" << ntName << "::" << ntName << "(";
 
-            // Generate the parameters for the constructor by iterating through the items in the rule
-            bool    first = true;
-            int     index = 0;
+            // Generate the parameters and initialisers for the constructor by iterating through the items in the rule
+            stringstream    copyParameters;
+            stringstream    moveParameters;
+            stringstream    copyInitialisers;
+            stringstream    moveInitialisers;
+            bool            first = true;
+            int             index = 0;
             for (ast_rule_item_list::const_iterator ruleItem = ruleDefn->second.begin(); ruleItem != ruleDefn->second.end(); ++ruleItem) {
                 // Ignore guards
                 if (ruleItem->item->type() == item::guard) continue;
@@ -1407,11 +2373,19 @@ void output_cplusplus::source_ast_class_constructors() {
 
                 // Add to the list of parameters
                 if (!first) {
-                    *m_SourceFile << ", ";
+                    copyParameters << ", ";
+                    moveParameters << ", ";
                 }
 
                 // Declare as a reference to the syntax pointer
-                *m_SourceFile << "const util::syntax_ptr<class " << typeName << s_TypeSuffix << ">& " << typeName << "_" << index;
+                copyParameters << "const util::syntax_ptr<class " << typeName << s_TypeSuffix << ">& " << typeName << "_" << index;
+                moveParameters << "util::syntax_ptr<class " << typeName << s_TypeSuffix << ">&& " << typeName << "_" << index;
+
+                // Initialise the variable from the parameter
+                copyInitialisers    << "\n"
+                                    << ", " << varName << "(" << typeName << "_" << index << ")";
+                moveInitialisers    << "\n"
+                                    << ", " << varName << "(std::move(" << typeName << "_" << index << "))";
 
                 // No longer the first rule
                 first = false;
@@ -1420,10 +2394,11 @@ void output_cplusplus::source_ast_class_constructors() {
 
             // If there were no valid items, then we need to add a position to this constructor
             if (index == 0) {
-                *m_SourceFile << "const dfa::position& pos";
+                copyParameters << "const dfa::position& pos";
             }
 
-            *m_SourceFile << ")\n";
+            // Write out the constructor
+            *m_SourceFile << get_identifier(m_ClassName, false) << "::" << ntName << "::" << ntName << "(" << copyParameters.str() << ")\n";
 
             // Write out the initializers
             *m_SourceFile << ": m_Rule(" << ruleDefn->first << ")";
@@ -1433,30 +2408,19 @@ void output_cplusplus::source_ast_class_constructors() {
                 *m_SourceFile << "\n, m_Position(pos)";
             }
 
-            // Fill in the initialisers from the rule
-            index = 0;
-            for (ast_rule_item_list::const_iterator ruleItem = ruleDefn->second.begin(); ruleItem != ruleDefn->second.end(); ++ruleItem) {
-                // Ignore guards
-                if (ruleItem->item->type() == item::guard) continue;
-
-                // Ignore repetitions
-                if (ruleItem->isEbnfRepetition) continue;
-
-                // Get the variable name and type for this item 
-                string varName  = get_identifier(ruleItem->uniqueName, false);
-                string typeName = class_name_for_item(ruleItem->item);
-
-                // Declare as a reference to the syntax pointer
-                *m_SourceFile   << "\n"
-                                << ", " << varName << "(" << typeName << "_" << index << ")";
-
-                // Index moves on
-                index++;
-            }
-
             // Write out the body of the constructor
-            *m_SourceFile   << " {\n"
+            *m_SourceFile   << copyInitialisers.str() << " {\n"
                             << "}\n";
+
+            // Write out the version of the constructor that moves its parameters
+            if (index > 0) {
+                *m_SourceFile   << "\n#if __cplusplus >= 201103L\n"
+                                << get_identifier(m_ClassName, false) << "::" << ntName << "::" << ntName << "(" << moveParameters.str() << ")\n"
+                                << ": m_Rule(" << ruleDefn->first << ")"
+                                << moveInitialisers.str() << " {\n"
+                                << "}\n"
+                                << "#endif\n";
+            }
         }
 
         // Write out a destructor for this nonterminal
@@ -1589,35 +2553,225 @@ void output_cplusplus::source_ast_position_functions() {
     }
 }
 
-/// \brief Writes out the parser actions to the header file
-void output_cplusplus::header_parser_actions() {
-    // Declare the parser actions class
-    *m_HeaderFile   << "\n"
-                    << "    class parser_actions {\n"
-                    << "    public:\n"
-                    << "        typedef util::syntax_ptr<syntax_node> node;\n"
+/// \brief Fills in the names of the AST classes that a visitor is called for, paired with the name of their base class
+void output_cplusplus::visited_classes(std::vector<std::pair<std::string, std::string> >& classes) {
+    // Terminals
+    for (terminal_symbol_iterator term = begin_terminal_symbol(); term != end_terminal_symbol(); ++term) {
+        classes.push_back(make_pair(class_name_for_item(term->item) + s_TypeSuffix, string("terminal")));
+    }
+
+    // Nonterminals (repeating items have a content class as well as the container)
+    for (nonterminal_symbol_iterator nonterm = begin_nonterminal_symbol(); nonterm != end_nonterminal_symbol(); ++nonterm) {
+        if (nonterm->item->type() == item::guard) continue;
+
+        string ntName = class_name_for_item(nonterm->item) + s_TypeSuffix;
+        classes.push_back(make_pair(ntName, string("syntax_node")));
+
+        if (nonterm->item->type() == item::repeat || nonterm->item->type() == item::repeat_zero_or_one) {
+            classes.push_back(make_pair(ntName + s_ContentSuffix, string("syntax_node")));
+        }
+    }
+}
+
+/// \brief Writes out the visitor class for the AST
+void output_cplusplus::header_ast_visitor() {
+    // The visitor has a visit and leave function for every node class, which fall back to the function for the base class
+    *m_HeaderFile   << "\n"
+                    << "    class visitor {\n"
+                    << "    public:\n"
+                    << "        virtual ~visitor();\n"
+                    << "\n"
+                    << "        // Called before the children of a node are visited: return false to skip them\n"
+                    << "        virtual bool visit(const syntax_node* node);\n"
+                    << "        virtual bool visit(const terminal* node);\n";
+
+    vector<pair<string, string> > classes;
+    visited_classes(classes);
+
+    for (vector<pair<string, string> >::const_iterator visited = classes.begin(); visited != classes.end(); ++visited) {
+        *m_HeaderFile << "        virtual bool visit(const " << visited->first << "* node);\n";
+    }
+
+    *m_HeaderFile   << "\n"
+                    << "        // Called after the children of a node have been visited (or skipped)\n"
+                    << "        virtual void leave(const syntax_node* node);\n"
+                    << "        virtual void leave(const terminal* node);\n";
+
+    for (vector<pair<string, string> >::const_iterator visited = classes.begin(); visited != classes.end(); ++visited) {
+        *m_HeaderFile << "        virtual void leave(const " << visited->first << "* node);\n";
+    }
+
+    *m_HeaderFile   << "\n"
+                    << "        // Visits the tree starting at root in order, without recursing\n"
+                    << "        void walk(const syntax_node* root);\n"
+                    << "    };\n";
+}
+
+/// \brief Writes out the functions that let visitors walk the AST to the source file
+void output_cplusplus::source_ast_visitor() {
+    string className = get_identifier(m_ClassName, false);
+
+    // Terminals dispatch to the visitor function for their class
+    for (terminal_symbol_iterator term = begin_terminal_symbol(); term != end_terminal_symbol(); ++term) {
+        string name = class_name_for_item(term->item) + s_TypeSuffix;
+
+        *m_SourceFile   << "\n"
+                        << "bool " << className << "::" << name << "::accept_visit(visitor& v) const { return v.visit(this); }\n"
+                        << "void " << className << "::" << name << "::accept_leave(visitor& v) const { v.leave(this); }\n";
+    }
+
+    // Nonterminals also supply their children, in the order they appeared in the rule that was matched
+    for (nonterminal_symbol_iterator nonterm = begin_nonterminal_symbol(); nonterm != end_nonterminal_symbol(); ++nonterm) {
+        // Guards have no definitions written out for them
+        if (nonterm->item->type() == item::guard) {
+            continue;
+        }
+
+        string  ntName          = class_name_for_item(nonterm->item) + s_TypeSuffix;
+        bool    repeatingItem   = nonterm->item->type() == item::repeat || nonterm->item->type() == item::repeat_zero_or_one;
+        string  ntContentClass  = repeatingItem ? ntName + s_ContentSuffix : ntName;
+
+        const ast_nonterminal& ntDefn = get_ast_nonterminal(nonterm->identifier);
+
+        *m_SourceFile   << "\n"
+                        << "bool " << className << "::" << ntContentClass << "::accept_visit(visitor& v) const { return v.visit(this); }\n"
+                        << "void " << className << "::" << ntContentClass << "::accept_leave(visitor& v) const { v.leave(this); }\n"
+                        << "\n"
+                        << "void " << className << "::" << ntContentClass << "::child_nodes(std::vector<const syntax_node*>& children) const {\n"
+                        << "    switch (m_Rule) {";
+
+        for (ast_nonterminal_rules::const_iterator ruleDefn = ntDefn.rules.begin(); ruleDefn != ntDefn.rules.end(); ++ruleDefn) {
+            *m_SourceFile << "\n    case " << ruleDefn->first << ":\n";
+
+            for (ast_rule_item_list::const_iterator ruleItem = ruleDefn->second.begin(); ruleItem != ruleDefn->second.end(); ++ruleItem) {
+                // Guards and the repeating part of a closure don't have variables
+                if (ruleItem->item->type() == item::guard) continue;
+                if (ruleItem->isEbnfRepetition) continue;
+
+                string varName = get_identifier(ruleItem->uniqueName, false);
+                *m_SourceFile << "        if (" << varName << ".item()) children.push_back(" << varName << ".item());\n";
+            }
+
+            *m_SourceFile << "        break;\n";
+        }
+
+        *m_SourceFile   << "    }\n"
+                        << "}\n";
+
+        // The container for repeating items has the content items as its children
+        if (repeatingItem) {
+            *m_SourceFile   << "\n"
+                            << "bool " << className << "::" << ntName << "::accept_visit(visitor& v) const { return v.visit(this); }\n"
+                            << "void " << className << "::" << ntName << "::accept_leave(visitor& v) const { v.leave(this); }\n"
+                            << "\n"
+                            << "void " << className << "::" << ntName << "::child_nodes(std::vector<const syntax_node*>& children) const {\n"
+                            << "    for (iterator child = m_Data.begin(); child != m_Data.end(); ++child) {\n"
+                            << "        children.push_back(child->item());\n"
+                            << "    }\n"
+                            << "}\n";
+        }
+    }
+
+    // The default visitor functions call the function for the base class of each node
+    *m_SourceFile   << "\n"
+                    << className << "::visitor::~visitor() { }\n"
+                    << "\n"
+                    << "bool " << className << "::visitor::visit(const syntax_node* node) { return true; }\n"
+                    << "void " << className << "::visitor::leave(const syntax_node* node) { }\n"
+                    << "bool " << className << "::visitor::visit(const terminal* node) { return visit(static_cast<const syntax_node*>(node)); }\n"
+                    << "void " << className << "::visitor::leave(const terminal* node) { leave(static_cast<const syntax_node*>(node)); }\n";
+
+    vector<pair<string, string> > classes;
+    visited_classes(classes);
+
+    for (vector<pair<string, string> >::const_iterator visited = classes.begin(); visited != classes.end(); ++visited) {
+        *m_SourceFile   << "bool " << className << "::visitor::visit(const " << visited->first << "* node) { return visit(static_cast<const " << visited->second << "*>(node)); }\n"
+                        << "void " << className << "::visitor::leave(const " << visited->first << "* node) { leave(static_cast<const " << visited->second << "*>(node)); }\n";
+    }
+
+    // Walk the tree with an explicit stack, so that deeply nested nodes don't use up the call stack
+    *m_SourceFile   << "\n"
+                    << "void " << className << "::visitor::walk(const syntax_node* root) {\n"
+                    << "    // Nodes waiting to be visited: the flag is set once a node's children have been added, so it is left when it is next removed\n"
+                    << "    std::vector<std::pair<const syntax_node*, bool> > pending;\n"
+                    << "    std::vector<const syntax_node*> children;\n"
+                    << "\n"
+                    << "    if (root) pending.push_back(std::make_pair(root, false));\n"
+                    << "\n"
+                    << "    while (!pending.empty()) {\n"
+                    << "        std::pair<const syntax_node*, bool> next = pending.back();\n"
+                    << "        pending.pop_back();\n"
+                    << "\n"
+                    << "        // Leave nodes whose children have been visited, or that asked for their children to be skipped\n"
+                    << "        if (next.second || !next.first->accept_visit(*this)) {\n"
+                    << "            next.first->accept_leave(*this);\n"
+                    << "            continue;\n"
+                    << "        }\n"
+                    << "\n"
+                    << "        pending.push_back(std::make_pair(next.first, true));\n"
+                    << "\n"
+                    << "        // Add the children in reverse, so the first is visited next, and start fetching them while this node is processed\n"
+                    << "        children.clear();\n"
+                    << "        next.first->child_nodes(children);\n"
+                    << "\n"
+                    << "        for (std::vector<const syntax_node*>::reverse_iterator child = children.rbegin(); child != children.rend(); ++child) {\n"
+                    << "            TAMEPARSE_PREFETCH(*child);\n"
+                    << "            pending.push_back(std::make_pair(*child, false));\n"
+                    << "        }\n"
+                    << "    }\n"
+                    << "}\n";
+}
+
+/// \brief Writes out the parser actions to the header file
+void output_cplusplus::header_parser_actions() {
+    // Declare the parser actions class
+    *m_HeaderFile   << "\n"
+                    << "    class parser_actions {\n"
+                    << "    public:\n"
+                    << "        typedef util::syntax_ptr<syntax_node> node;\n"
                     << "        typedef lr::parser<node, parser_actions> parser;\n"
                     << "        typedef parser::reduce_list reduce_list;\n"
                     << "\n"
                     << "    private:\n"
                     << "        dfa::lexeme_stream* m_Stream;\n"
                     << "        bool m_OwnStream;\n"
-                    << "\n"
+                    << "        stream_events* m_Events;\n";
+    if (m_PooledAst) {
+        *m_HeaderFile << "        util::arena* m_Pool;\n";
+    }
+    *m_HeaderFile   << "\n"
                     << "        parser_actions(parser_actions& noCopying);\n"
                     << "        parser_actions& operator=(const parser_actions& noCopying);\n"
                     << "\n"
-                    << "    public:\n"
-                    << "        parser_actions(dfa::lexeme_stream* stream, bool ownStream = false)\n"
-                    << "        : m_Stream(stream)\n"
-                    << "        , m_OwnStream(ownStream) { }\n"
-                    << "\n"
-                    << "        ~parser_actions() {\n"
+                    << "    public:\n";
+    
+    // Pooled ASTs are allocated from an arena supplied by the caller, which must outlast the tree
+    if (m_PooledAst) {
+        *m_HeaderFile   << "        parser_actions(dfa::lexeme_stream* stream, bool ownStream = false, util::arena* pool = NULL)\n"
+                        << "        : m_Stream(stream)\n"
+                        << "        , m_OwnStream(ownStream)\n"
+                        << "        , m_Events(NULL)\n"
+                        << "        , m_Pool(pool) { }\n"
+                        << "\n"
+                        << "        inline util::arena* get_pool() const { return m_Pool; }\n"
+                        << "\n";
+    } else {
+        *m_HeaderFile   << "        parser_actions(dfa::lexeme_stream* stream, bool ownStream = false)\n"
+                        << "        : m_Stream(stream)\n"
+                        << "        , m_OwnStream(ownStream)\n"
+                        << "        , m_Events(NULL) { }\n"
+                        << "\n";
+    }
+    
+    *m_HeaderFile   << "        ~parser_actions() {\n"
                     << "            if (m_OwnStream && m_Stream) {\n"
                     << "                delete m_Stream;\n"
                     << "                m_Stream = NULL;\n"
                     << "            }\n"
                     << "        }\n"
                     << "\n"
+                    << "        inline void set_stream_events(stream_events* events) { m_Events = events; }\n"
+                    << "\n"
                     << "        inline dfa::lexeme* read() {\n"
                     << "            dfa::lexeme* result = NULL;\n"
                     << "            (*m_Stream) >> result;\n"
@@ -1626,8 +2780,123 @@ void output_cplusplus::header_parser_actions() {
                     << "\n"
                     << "        node shift(const dfa::lexeme_container& lexeme);\n"
                     << "\n"
-                    << "        node reduce(int nonterminal, int rule, const reduce_list& reduce, const dfa::position& lookaheadPosition);\n"
-                    << "    };\n";
+                    << "        node reduce(int nonterminal, int rule, const reduce_list& reduce, const dfa::position& lookaheadPosition);\n";
+
+    // Nodes for nonterminals whose unit rules are skipped by the parser are rebuilt by these functions
+    if (!m_UnitRulesForNonterminal.empty()) {
+        *m_HeaderFile << "\n"
+                      << "    private:\n";
+
+        for (map<int, vector<int> >::const_iterator unitNt = m_UnitRulesForNonterminal.begin(); unitNt != m_UnitRulesForNonterminal.end(); ++unitNt) {
+            const item_container& nonterminal = gram().item_with_identifier(unitNt->first);
+            *m_HeaderFile << "        util::syntax_ptr<class " << class_name_for_item(nonterminal) << s_TypeSuffix << "> " << restore_function_name(nonterminal) << "(const node& item);\n";
+        }
+    }
+
+    *m_HeaderFile   << "    };\n";
+}
+
+/// \brief Writes out the class that receives the items added to repeating nodes while parsing
+void output_cplusplus::header_stream_events() {
+    // Each repeating nonterminal gets a callback that is passed its items as they are completed. Returning true from
+    // one of these drops the item from the list, so a long list (the values in a file of JSON lines, say) can be 
+    // processed without keeping the whole tree in memory.
+    *m_HeaderFile   << "\n"
+                    << "    class stream_events {\n"
+                    << "    public:\n"
+                    << "        virtual ~stream_events() { }\n";
+
+    for (nonterminal_symbol_iterator nonterm = begin_nonterminal_symbol(); nonterm != end_nonterminal_symbol(); ++nonterm) {
+        if (nonterm->item->type() != item::repeat && nonterm->item->type() != item::repeat_zero_or_one) continue;
+
+        string ntName = class_name_for_item(nonterm->item);
+        *m_HeaderFile   << "\n"
+                        << "        virtual bool completed_" << ntName << "(const util::syntax_ptr<class " << ntName << s_TypeSuffix << s_ContentSuffix << ">& item) { return false; }\n";
+    }
+
+    *m_HeaderFile   << "    };\n";
+}
+
+/// \brief Fills in the unit rules that the parser will skip, if the eliminate-unit-rules option is set
+void output_cplusplus::find_unit_rules() {
+    m_UnitRulesForNonterminal.clear();
+    if (cons().get_option(L"eliminate-unit-rules").empty()) return;
+
+    for (nonterminal_symbol_iterator nonterm = begin_nonterminal_symbol(); nonterm != end_nonterminal_symbol(); ++nonterm) {
+        const ast_nonterminal& ntDefn = get_ast_nonterminal(nonterm->identifier);
+
+        for (ast_nonterminal_rules::const_iterator ruleDefn = ntDefn.rules.begin(); ruleDefn != ntDefn.rules.end(); ++ruleDefn) {
+            if (lr::unit_rule_rewriter::is_unit_rule(*gram().rule_with_identifier(ruleDefn->first))) {
+                m_UnitRulesForNonterminal[nonterm->identifier].push_back(ruleDefn->first);
+            }
+        }
+    }
+}
+
+/// \brief Returns the name of the function that rebuilds the node for a nonterminal whose unit rules were skipped
+string output_cplusplus::restore_function_name(const item_container& nonterminal) {
+    return "restore_" + class_name_for_item(nonterminal) + s_TypeSuffix;
+}
+
+/// \brief True if the nonterminal with the specified identifier can be rebuilt from an item for the target nonterminal
+static bool reaches_by_unit_rules(int fromId, int targetId, const map<int, vector<int> >& unitRules, const grammar& gram, set<int>& visited) {
+    if (fromId == targetId)                 return true;
+    if (!visited.insert(fromId).second)     return false;
+
+    map<int, vector<int> >::const_iterator fromRules = unitRules.find(fromId);
+    if (fromRules == unitRules.end())       return false;
+
+    for (vector<int>::const_iterator ruleId = fromRules->second.begin(); ruleId != fromRules->second.end(); ++ruleId) {
+        int innerId = gram.identifier_for_item(gram.rule_with_identifier(*ruleId)->items()[0]);
+        if (reaches_by_unit_rules(innerId, targetId, unitRules, gram, visited)) return true;
+    }
+
+    return false;
+}
+
+/// \brief Writes out the functions that rebuild the nodes for nonterminals whose unit rules were skipped
+///
+/// The parser supplies the node for the inner nonterminal in place of the outer one when it skips a unit rule, so
+/// whenever one of these nonterminals is used its node is checked and the missing levels are constructed.
+void output_cplusplus::source_unit_rule_restore() {
+    string className = get_identifier(m_ClassName, false);
+
+    for (map<int, vector<int> >::const_iterator unitNt = m_UnitRulesForNonterminal.begin(); unitNt != m_UnitRulesForNonterminal.end(); ++unitNt) {
+        const item_container&   nonterminal = gram().item_with_identifier(unitNt->first);
+        string                  ntName      = class_name_for_item(nonterminal) + s_TypeSuffix;
+
+        *m_SourceFile   << "\n"
+                        << "util::syntax_ptr<class " << className << "::" << ntName << "> " << className << "::parser_actions::" << restore_function_name(nonterminal) << "(const node& item) {\n"
+                        << "    if (dynamic_cast<const " << ntName << "*>(item.item())) return item.cast_to<" << ntName << ">();\n";
+
+        for (vector<int>::const_iterator ruleId = unitNt->second.begin(); ruleId != unitNt->second.end(); ++ruleId) {
+            const item_container&   innerItem   = gram().rule_with_identifier(*ruleId)->items()[0];
+            int                     innerId     = gram().identifier_for_item(innerItem);
+            string                  innerName   = class_name_for_item(innerItem) + s_TypeSuffix;
+
+            // Rebuild the inner item first if it can be skipped as well (unless that would lead back here)
+            set<int> visited;
+            bool     restoreInner = m_UnitRulesForNonterminal.find(innerId) != m_UnitRulesForNonterminal.end() 
+                                    && !reaches_by_unit_rules(innerId, unitNt->first, m_UnitRulesForNonterminal, gram(), visited);
+
+            *m_SourceFile << "    {\n";
+            if (restoreInner) {
+                *m_SourceFile << "        util::syntax_ptr<class " << innerName << "> inner = " << restore_function_name(innerItem) << "(item);\n";
+            } else {
+                *m_SourceFile << "        util::syntax_ptr<class " << innerName << "> inner = dynamic_cast<const " << innerName << "*>(item.item()) ? item.cast_to<" << innerName << ">() : util::syntax_ptr<class " << innerName << ">();\n";
+            }
+            *m_SourceFile   << "        if (inner.item()) return util::syntax_ptr<class " << ntName << ">(" << new_ast_node() << ntName << "(inner));\n"
+                            << "    }\n";
+        }
+
+        *m_SourceFile   << "    return util::syntax_ptr<class " << ntName << ">();\n"
+                        << "}\n";
+    }
+}
+
+/// \brief The expression that allocates a new AST node in the generated parser actions
+std::string output_cplusplus::new_ast_node() const {
+    return m_PooledAst ? "new (m_Pool) " : "new ";
 }
 
 /// \brief Writes out the shift actions to the source file
@@ -1648,13 +2917,13 @@ void output_cplusplus::source_shift_actions() {
         name += s_TypeSuffix;
 
         // Declare a shift action for this symbol
-        *m_SourceFile   << "\n    case " << term->identifier << ": // " << get_identifier(terminals().name_for_symbol(term->identifier), true) << "\n"
-                        << "        return node(new " << name << "(lexeme));\n";
+        *m_SourceFile   << "\n    case " << term->identifier << ": // " << get_identifier(term->name, true) << "\n"
+                        << "        return node(" << new_ast_node() << name << "(lexeme));\n";
     }
                     
     // Default actions is to create an empty node
     *m_SourceFile   << "\n    default:\n"
-                    << "        return node(new terminal(lexeme));\n"
+                    << "        return node(" << new_ast_node() << "terminal(lexeme));\n"
                     << "    }\n"
                     << "}\n";
 }
@@ -1727,10 +2996,10 @@ void output_cplusplus::source_reduce_actions() {
             if (hasConstructor || nonterm->item->type() == item::repeat) {
                 if (nonterm->item->type() == item::repeat || nonterm->item->type() == item::repeat_zero_or_one) {
                     // For repeating items, we construct the content into a variable
-                    *m_SourceFile << "        util::syntax_ptr<class " << ntContentClass << "> content(new " << ntContentClass << "(";
+                    *m_SourceFile << "        util::syntax_ptr<class " << ntContentClass << "> content(" << new_ast_node() << ntContentClass << "(";
                 } else {
                     // For non-repeating items, just return the item directly
-                    *m_SourceFile << "        return node(new " << ntContentClass << "(";
+                    *m_SourceFile << "        return node(" << new_ast_node() << ntContentClass << "(";
                 }
 
                 // Generate the constructor parameters
@@ -1757,8 +3026,12 @@ void output_cplusplus::source_reduce_actions() {
                     // The reduce list is passed in in reverse
                     size_t reduceIndex = ruleDefn->second.size() - index - 1;
 
-                    // Cast to the type
-                    *m_SourceFile  << "reduce[" << reduceIndex << "].cast_to<" << typeName << s_TypeSuffix << ">()";
+                    // Cast to the type (rebuilding any levels that the parser skipped)
+                    if (!ruleItem.isTerminal && m_UnitRulesForNonterminal.find(gram().identifier_for_item(ruleItem.item)) != m_UnitRulesForNonterminal.end()) {
+                        *m_SourceFile  << restore_function_name(ruleItem.item) << "(reduce[" << reduceIndex << "])";
+                    } else {
+                        *m_SourceFile  << "reduce[" << reduceIndex << "].cast_to<" << typeName << s_TypeSuffix << ">()";
+                    }
                 }
 
                 // If there aren't any valid items, then pass in the lookahead position (these items will take a position parameter)
@@ -1774,7 +3047,7 @@ void output_cplusplus::source_reduce_actions() {
                 // The constructor is delcared for the item that contains the repetition
                 if (!hasConstructor && nonterm->item->type() == item::repeat_zero_or_one) {
                     // This is the empty rule in a zero-or-more repetition: create an empty item
-                    *m_SourceFile << "        return node(new " << ntName << "());\n";
+                    *m_SourceFile << "        return node(" << new_ast_node() << ntName << "());\n";
                 } else {
                     // Get the node where the definition is being built up
                     *m_SourceFile << "        util::syntax_ptr<class " << ntName << "> list(";
@@ -1785,15 +3058,22 @@ void output_cplusplus::source_reduce_actions() {
                         *m_SourceFile << "reduce[" << ruleDefn->second.size()-1 << "].cast_to<" << ntName << ">());\n";
                     } else {
                         // Need to create a new item
-                        *m_SourceFile << "new " << ntName << "());\n";
+                        *m_SourceFile << new_ast_node() << ntName << "());\n";
 
                         // Set the position (hideous const cast, sigh)
                         *m_SourceFile << "        const_cast<" << ntName << "*>(list.item())->set_position(lookaheadPosition);\n";
                     }
 
+                    // Items that the stream events consume are dropped instead of being added to the list
+                    *m_SourceFile << "        if (m_Events && m_Events->completed_" << class_name_for_item(nonterm->item) << "(content)) return list.cast_to<syntax_node>();\n";
+
                     // Add the content as a child item
                     // Hideous const cast :-(
-                    *m_SourceFile << "        const_cast<" << ntName << "*>(list.item())->add_child(content);\n";
+                    *m_SourceFile   << "#if __cplusplus >= 201103L\n"
+                                    << "        const_cast<" << ntName << "*>(list.item())->add_child(std::move(content));\n"
+                                    << "#else\n"
+                                    << "        const_cast<" << ntName << "*>(list.item())->add_child(content);\n"
+                                    << "#endif\n";
 
                     // Cast to a node and return
                     *m_SourceFile << "        return list.cast_to<syntax_node>();\n";
@@ -1811,3 +3091,507 @@ void output_cplusplus::source_reduce_actions() {
                     << "    }\n"
                     << "}\n";
 }
+
+/// \brief True if the generated parser_events class should have a callback for the specified nonterminal item
+static bool has_event_callback(const item_container& nonterminal) {
+    switch (nonterminal->type()) {
+    case item::guard:
+    case item::empty:
+    case item::eoi:
+    case item::eog:
+        return false;
+
+    default:
+        return true;
+    }
+}
+
+/// \brief Writes out the parser events class to the header file
+void output_cplusplus::header_parser_events() {
+    // The events class adds a callback for each nonterminal to the generic events class
+    *m_HeaderFile   << "\n"
+                    << "public:\n"
+                    << "    class parser_events : public lr::parser_events {\n"
+                    << "    public:\n"
+                    << "        virtual value reduce(int nonterminal, int rule, const value_list& values);\n";
+
+    // Declare a callback for each nonterminal. These do the same as the generic events class by default
+    for (nonterminal_symbol_iterator nonterm = begin_nonterminal_symbol(); nonterm != end_nonterminal_symbol(); ++nonterm) {
+        // Guards and the special items are never reported
+        if (!has_event_callback(nonterm->item)) continue;
+
+        *m_HeaderFile   << "\n"
+                        << "        virtual value reduce_" << class_name_for_item(nonterm->item) << "(int rule, const value_list& values) {\n"
+                        << "            return lr::parser_events::reduce(" << nonterm->identifier << ", rule, values);\n"
+                        << "        }\n";
+    }
+
+    *m_HeaderFile   << "    };\n";
+}
+
+/// \brief Writes out the function that dispatches reduce events to the source file
+void output_cplusplus::source_event_reduce() {
+    string className = get_identifier(m_ClassName, false);
+
+    // Declare the reduce function
+    *m_SourceFile   << "\n"
+                    << className << "::parser_events::value " << className << "::parser_events::reduce(int nonterminal, int rule, const value_list& values) {\n"
+                    << "    switch (nonterminal) {";
+
+    // Pass each nonterminal on to its callback
+    for (nonterminal_symbol_iterator nonterm = begin_nonterminal_symbol(); nonterm != end_nonterminal_symbol(); ++nonterm) {
+        if (!has_event_callback(nonterm->item)) continue;
+
+        *m_SourceFile   << "\n    case " << nonterm->identifier << ":\n"
+                        << "        return reduce_" << class_name_for_item(nonterm->item) << "(rule, values);\n";
+    }
+
+    // Anything else uses the default behaviour
+    *m_SourceFile   << "\n    default:\n"
+                    << "        return lr::parser_events::reduce(nonterminal, rule, values);\n"
+                    << "    }\n"
+                    << "}\n";
+}
+
+//              =====================
+//               Direct-coded parser
+//              =====================
+
+/// \brief Returns true if a direct-coded parser can perform every action in the parser tables, or sets reason and returns false
+///
+/// The direct-coded parser only performs shift, ignore, reduce, accept and goto actions, and always takes the first
+/// action for a symbol, so the tables must not need guards, weak symbols or any other action that depends on the
+/// lookahead beyond the next symbol.
+bool output_cplusplus::can_write_direct_parser(wstring& reason) {
+    const lr::parser_tables& tables = get_parser_tables();
+    
+    // The parser must not be too large
+    int maxStates = c_DefaultMaxDirectParserStates;
+    
+    wstring maxStatesOption = cons().get_option(L"direct-parser-max-states");
+    if (!maxStatesOption.empty()) {
+        maxStates = (int) wcstol(maxStatesOption.c_str(), NULL, 10);
+    }
+    
+    if (tables.count_states() > maxStates) {
+        wstringstream msg;
+        msg << L"the parser has " << tables.count_states() << L" states (the limit is " << maxStates << L")";
+        reason = msg.str();
+        return false;
+    }
+    
+    // Guards need the parser to look further ahead
+    if (tables.count_end_of_guards() > 0) {
+        reason = L"the language uses guards";
+        return false;
+    }
+    
+    // Check the type of every action
+    for (int stateId = 0; stateId < tables.count_states(); ++stateId) {
+        for (int pass = 0; pass < 2; ++pass) {
+            const action*   actions = pass == 0 ? tables.terminal_actions()[stateId] : tables.nonterminal_actions()[stateId];
+            int             count   = pass == 0 ? tables.action_counts()[stateId].numTerminals : tables.action_counts()[stateId].numNonterminals;
+            
+            for (int actionNum = 0; actionNum < count; ++actionNum) {
+                switch (actions[actionNum].type) {
+                    case lr::lr_action::act_shift:
+                    case lr::lr_action::act_ignore:
+                    case lr::lr_action::act_reduce:
+                    case lr::lr_action::act_accept:
+                    case lr::lr_action::act_goto:
+                        break;
+                        
+                    case lr::lr_action::act_guard:
+                        reason = L"the language uses guards";
+                        return false;
+                        
+                    case lr::lr_action::act_shiftstrong:
+                    case lr::lr_action::act_weakreduce:
+                        reason = L"the language uses weak symbols";
+                        return false;
+                        
+                    case lr::lr_action::act_shiftreduce:
+                        reason = L"the parser uses combined shift-reduce actions";
+                        return false;
+                        
+                    default:
+                        reason = L"the parser uses actions that can only be performed by the table-driven parser";
+                        return false;
+                }
+            }
+        }
+    }
+    
+    return true;
+}
+
+/// \brief Writes out a parser with its state machine compiled into code, if the direct-parser option is set
+void output_cplusplus::define_direct_parser() {
+    // Nothing to do unless the option is set
+    if (cons().get_option(L"direct-parser").empty()) {
+        return;
+    }
+    
+    // The table-driven parser is always available, so languages that can't be direct-coded just get a warning
+    wstring reason;
+    if (!can_write_direct_parser(reason)) {
+        cons().report_error(error(error::sev_warning, filename(), L"NO_DIRECT_PARSER", L"Not generating a direct-coded parser because " + reason, position(-1, -1, -1)));
+        return;
+    }
+    
+    header_direct_parser();
+    source_direct_parser();
+}
+
+/// \brief Writes out the declaration of the direct-coded parser class
+void output_cplusplus::header_direct_parser() {
+    m_UsedClassNames.insert("direct_parser");
+    
+    *m_HeaderFile   << "\npublic:\n"
+                    << "    class direct_parser {\n"
+                    << "    public:\n"
+                    << "        typedef parser_actions::node node;\n"
+                    << "        typedef parser_actions::reduce_list reduce_list;\n"
+                    << "\n"
+                    << "    private:\n"
+                    << "        parser_actions* m_Actions;\n"
+                    << "        std::vector<int> m_States;\n"
+                    << "        std::vector<node> m_Items;\n"
+                    << "        dfa::lexeme_container m_Lookahead;\n"
+                    << "\n"
+                    << "        direct_parser(const direct_parser& noCopying);\n"
+                    << "        direct_parser& operator=(const direct_parser& noCopying);\n"
+                    << "\n"
+                    << "        inline void next() {\n"
+                    << "            m_Lookahead = dfa::lexeme_container(m_Actions->read(), true);\n"
+                    << "        }\n"
+                    << "\n"
+                    << "        inline void shift(int newState) {\n"
+                    << "            m_States.push_back(newState);\n"
+                    << "            m_Items.push_back(m_Actions->shift(m_Lookahead));\n"
+                    << "            next();\n"
+                    << "        }\n"
+                    << "\n"
+                    << "        inline void reduce(int nonterminal, int rule, int length);\n"
+                    << "        static int goto_state(int state, int nonterminal);\n"
+                    << "\n"
+                    << "    public:\n"
+                    << "        direct_parser(parser_actions* actions, int initialState)\n"
+                    << "        : m_Actions(actions)\n"
+                    << "        , m_Lookahead((dfa::lexeme*) NULL, false) {\n"
+                    << "            m_States.push_back(initialState);\n"
+                    << "            m_Items.push_back(node());\n"
+                    << "        }\n"
+                    << "\n"
+                    << "        ~direct_parser() {\n"
+                    << "            delete m_Actions;\n"
+                    << "        }\n"
+                    << "\n"
+                    << "        bool parse();\n"
+                    << "\n"
+                    << "        inline const dfa::lexeme_container& look() const { return m_Lookahead; }\n"
+                    << "        inline const node& get_item() const { return m_Items.back(); }\n"
+                    << "    };\n";
+    
+    // Functions to create a direct-coded parser for each start symbol
+    const vector<wstring>& startSymbols = get_start_symbols();
+    
+    int initialState = 0;
+    for (vector<wstring>::const_iterator startSymbol = startSymbols.begin(); startSymbol != startSymbols.end(); ++startSymbol, ++initialState) {
+        string startName = get_identifier(*startSymbol, true);
+        
+        *m_HeaderFile   << "\n"
+                        << "    inline static direct_parser* create_" << startName << "_direct(dfa::lexeme_stream* stream, bool deleteStream = false) {\n"
+                        << "        return new direct_parser(new parser_actions(stream, deleteStream), " << initialState << ");\n"
+                        << "    }\n"
+                        << "\n"
+                        << "    template<typename char_type, typename traits> inline static direct_parser* create_" << startName << "_direct(std::basic_istream<char_type, traits>& input) {\n"
+                        << "        return create_" << startName << "_direct(skip_ignored(lexer.create_stream_from<char_type, traits>(input)), true);\n"
+                        << "    }\n";
+    }
+}
+
+/// \brief Writes out a parser whose actions read from the generated lexer directly, if the static-parser option is set
+///
+/// The ordinary parser reads lexemes through the virtual dfa::lexeme_stream interface, as its actions can be used with
+/// any lexer. The static parser's actions know the type of the generated lexer, and the whole parser is instantiated
+/// in the source file alongside the lexer tables and the shift and reduce actions, so none of the calls made while
+/// parsing need to go through a virtual function.
+void output_cplusplus::define_static_parser() {
+    if (cons().get_option(L"static-parser").empty()) {
+        return;
+    }
+    
+    string className        = get_identifier(m_ClassName, false);
+    string poolParameter    = m_PooledAst ? ", util::arena* pool" : "";
+    string poolArgument     = m_PooledAst ? ", pool" : "";
+    
+    m_UsedClassNames.insert("static_parser_actions");
+    m_UsedClassNames.insert("static_parser_type");
+    
+    // Declare the actions class and a parse function for each start symbol
+    *m_HeaderFile   << "\npublic:\n"
+                    << "    class static_parser_actions;\n"
+                    << "    typedef lr::parser<syntax_node_container, static_parser_actions, lr::no_parser_trace, " << m_ParserTablesType << "> static_parser_type;\n";
+    
+    const vector<wstring>& startSymbols = get_start_symbols();
+    
+    for (vector<wstring>::const_iterator startSymbol = startSymbols.begin(); startSymbol != startSymbols.end(); ++startSymbol) {
+        string startName = get_identifier(*startSymbol, true);
+        
+        *m_HeaderFile   << "\n"
+                        << "    static bool parse_" << startName << "(const int* begin, const int* end, syntax_node_container& result, dfa::position* errorPosition = NULL" << poolParameter << (m_PooledAst ? " = NULL" : "") << ");\n";
+    }
+    
+    // The actions read lexemes using the concrete type of the lexer's streams (this needs the lexer definition, so
+    // it goes with the tables when the output is split)
+    select_source(tables_source);
+
+    *m_SourceFile   << "\n"
+                    << "class " << className << "::static_parser_actions : public " << className << "::parser_actions {\n"
+                    << "private:\n"
+                    << "    lexer_definition::stream* m_Lexemes;\n"
+                    << "\n"
+                    << "public:\n"
+                    << "    static_parser_actions(lexer_definition::stream* lexemes" << poolParameter << ")\n"
+                    << "    : parser_actions(NULL, false" << poolArgument << ")\n"
+                    << "    , m_Lexemes(lexemes) { }\n"
+                    << "\n"
+                    << "    ~static_parser_actions() {\n"
+                    << "        delete m_Lexemes;\n"
+                    << "    }\n"
+                    << "\n"
+                    << "    inline dfa::lexeme* read() {\n"
+                    << "        dfa::lexeme* result = NULL;\n"
+                    << "        m_Lexemes->read(result);\n"
+                    << "        return result;\n"
+                    << "    }\n"
+                    << "};\n"
+                    << "\n"
+                    << "static const " << className << "::static_parser_type s_StaticParser(&" << className << "::lr_tables, false);\n";
+    
+    int initialState = 0;
+    for (vector<wstring>::const_iterator startSymbol = startSymbols.begin(); startSymbol != startSymbols.end(); ++startSymbol, ++initialState) {
+        string startName = get_identifier(*startSymbol, true);
+        
+        *m_SourceFile   << "\n"
+                        << "bool " << className << "::parse_" << startName << "(const int* begin, const int* end, syntax_node_container& result, dfa::position* errorPosition" << poolParameter << ") {\n"
+                        << "    lexer_definition::stream* lexemes = s_LexerDefinition.create_static_stream(new dfa::buffer_symbol_stream(begin, end));\n"
+                        << "    skip_ignored(lexemes);\n"
+                        << "    static_parser_type::state* state = s_StaticParser.create_parser(new static_parser_actions(lexemes" << poolArgument << "), " << initialState << ");\n"
+                        << "\n"
+                        << "    bool accepted = state->parse();\n"
+                        << "    if (accepted) {\n"
+                        << "        result = state->get_item();\n"
+                        << "    } else if (errorPosition && state->look().item()) {\n"
+                        << "        *errorPosition = state->look()->pos();\n"
+                        << "    }\n"
+                        << "\n"
+                        << "    delete state;\n"
+                        << "    return accepted;\n"
+                        << "}\n";
+    }
+
+    select_source(main_source);
+}
+
+/// \brief Writes the code that performs a parser action to the specified stream
+static void write_direct_action(const lr::parser_tables::action& act, const lr::parser_tables& tables, ostream& output) {
+    switch (act.type) {
+        case lr::lr_action::act_shift:
+            output << "shift(" << act.nextState << "); continue;\n";
+            break;
+            
+        case lr::lr_action::act_ignore:
+            output << "next(); continue;\n";
+            break;
+            
+        case lr::lr_action::act_reduce:
+        {
+            const lr::parser_tables::reduce_rule& rule = tables.rule(act.nextState);
+            output << "reduce(" << rule.identifier << ", " << rule.ruleId << ", " << rule.length << "); continue;\n";
+            break;
+        }
+            
+        case lr::lr_action::act_accept:
+            output << "return true;\n";
+            break;
+            
+        default:
+            output << "return false;\n";
+            break;
+    }
+}
+
+/// \brief Identifies how a direct-coded parser performs an action (actions that are written the same way are equal)
+typedef pair<int, int> direct_action_key;
+
+/// \brief Writes out the parse function for the direct-coded parser
+///
+/// This generates a switch statement with a case for each state. Each case switches on the lookahead and performs
+/// the action for it, so the parser doesn't need to search the tables. The reduce function is defined in the same
+/// file as the parser actions, so rules are reduced with constant arguments that the compiler can inline.
+void output_cplusplus::source_direct_parser() {
+    const lr::parser_tables&    tables      = get_parser_tables();
+    string                      className   = get_identifier(m_ClassName, false);
+    
+    // The goto function
+    *m_SourceFile   << "\nint " << className << "::direct_parser::goto_state(int state, int nonterminal) {\n"
+                    << "    switch (state) {\n";
+    
+    for (int stateId = 0; stateId < tables.count_states(); ++stateId) {
+        const action*   actions = tables.nonterminal_actions()[stateId];
+        int             count   = tables.action_counts()[stateId].numNonterminals;
+        bool            first   = true;
+        int             lastSym = -1;
+        
+        for (int actionNum = 0; actionNum < count; ++actionNum) {
+            // Only the first goto for each nonterminal is used
+            if (actions[actionNum].type != lr::lr_action::act_goto) continue;
+            if (!first && actions[actionNum].symbolId == lastSym) continue;
+            
+            if (first) {
+                *m_SourceFile << "    case " << stateId << ":\n"
+                              << "        switch (nonterminal) {\n";
+                first = false;
+            }
+            
+            *m_SourceFile << "        case " << actions[actionNum].symbolId << ": return " << actions[actionNum].nextState << ";\n";
+            lastSym = actions[actionNum].symbolId;
+        }
+        
+        if (!first) {
+            *m_SourceFile << "        }\n"
+                          << "        break;\n";
+        }
+    }
+    
+    *m_SourceFile   << "    }\n"
+                    << "\n";
+    
+    // Nonterminals with a default goto go there from any state that didn't have its own goto for them
+    bool anyDefaults = false;
+    
+    for (int nonterminal = 0; nonterminal < tables.count_default_gotos(); ++nonterminal) {
+        int defaultGoto = tables.default_goto(nonterminal);
+        if (defaultGoto < 0) continue;
+        
+        if (!anyDefaults) {
+            *m_SourceFile << "    switch (nonterminal) {\n";
+            anyDefaults = true;
+        }
+        
+        *m_SourceFile << "    case " << nonterminal << ": return " << defaultGoto << ";\n";
+    }
+    
+    if (anyDefaults) {
+        *m_SourceFile << "    }\n"
+                      << "\n";
+    }
+    
+    *m_SourceFile   << "    return -1;\n"
+                    << "}\n";
+    
+    // The reduce function
+    *m_SourceFile   << "\ninline void " << className << "::direct_parser::reduce(int nonterminal, int rule, int length) {\n"
+                    << "    static const dfa::position eofPos(-1, -1, -1);\n"
+                    << "\n"
+                    << "    reduce_list items;\n"
+                    << "    items.reserve(length);\n"
+                    << "    for (int x = 0; x < length; ++x) {\n"
+                    << "        items.push_back(m_Items.back());\n"
+                    << "        m_Items.pop_back();\n"
+                    << "        m_States.pop_back();\n"
+                    << "    }\n"
+                    << "\n"
+                    << "    int newState = goto_state(m_States.back(), nonterminal);\n"
+                    << "    if (newState < 0) return;\n"
+                    << "\n"
+                    << "    node result = m_Actions->reduce(nonterminal, rule, items, m_Lookahead.item() ? m_Lookahead->pos() : eofPos);\n"
+                    << "    m_States.push_back(newState);\n"
+                    << "    m_Items.push_back(result);\n"
+                    << "}\n";
+    
+    // The parse function
+    *m_SourceFile   << "\nbool " << className << "::direct_parser::parse() {\n"
+                    << "    next();\n"
+                    << "\n"
+                    << "    for (;;) {\n"
+                    << "        switch (m_States.back()) {\n";
+    
+    for (int stateId = 0; stateId < tables.count_states(); ++stateId) {
+        *m_SourceFile << "        case " << stateId << ":\n";
+        
+        // States with a default reduction don't need to look at the lookahead
+        if (tables.has_default_reduction(stateId)) {
+            *m_SourceFile << "            ";
+            write_direct_action(*tables.default_reduction(stateId), tables, *m_SourceFile);
+            continue;
+        }
+        
+        // The action at the end of the input (only the first action for a symbol is used)
+        const action*   ntActions   = tables.nonterminal_actions()[stateId];
+        int             ntCount     = tables.action_counts()[stateId].numNonterminals;
+        const action*   eoiAction   = NULL;
+        
+        for (int actionNum = 0; actionNum < ntCount; ++actionNum) {
+            if (ntActions[actionNum].symbolId == tables.end_of_input()) {
+                eoiAction = ntActions + actionNum;
+                break;
+            }
+        }
+        
+        *m_SourceFile << "            if (!m_Lookahead.item()) {\n"
+                      << "                ";
+        if (eoiAction) {
+            write_direct_action(*eoiAction, tables, *m_SourceFile);
+        } else {
+            *m_SourceFile << "return false;\n";
+        }
+        *m_SourceFile << "            }\n";
+        
+        // Group the terminals by the action they perform
+        const action*   termActions = tables.terminal_actions()[stateId];
+        int             termCount   = tables.action_counts()[stateId].numTerminals;
+        
+        typedef map<direct_action_key, vector<int> > terminals_for_action;
+        terminals_for_action    terminals;
+        map<direct_action_key, const action*> actionForKey;
+        
+        for (int actionNum = 0; actionNum < termCount; ++actionNum) {
+            const action& act = termActions[actionNum];
+            
+            // Only the first action for each symbol is used
+            if (actionNum > 0 && termActions[actionNum-1].symbolId == act.symbolId) continue;
+            
+            direct_action_key key(act.type, act.nextState);
+            terminals[key].push_back(act.symbolId);
+            actionForKey[key] = &act;
+        }
+        
+        *m_SourceFile << "            switch (m_Lookahead->matched()) {\n";
+        
+        for (terminals_for_action::const_iterator group = terminals.begin(); group != terminals.end(); ++group) {
+            *m_SourceFile << "            ";
+            
+            int count = 0;
+            for (vector<int>::const_iterator term = group->second.begin(); term != group->second.end(); ++term, ++count) {
+                if (count > 0 && (count % 8) == 0) {
+                    *m_SourceFile << "\n            ";
+                }
+                *m_SourceFile << "case " << *term << ": ";
+            }
+            
+            write_direct_action(*actionForKey[group->first], tables, *m_SourceFile);
+        }
+        
+        *m_SourceFile << "            default: return false;\n"
+                      << "            }\n";
+    }
+    
+    *m_SourceFile   << "        default:\n"
+                    << "            return false;\n"
+                    << "        }\n"
+                    << "    }\n"
+                    << "}\n";
+}
@@ -34,6 +34,7 @@
 
 #include "TameParse/Compiler/output_stage.h"
 #include "TameParse/Dfa/symbol_table.h"
+#include "TameParse/Util/comb_vector.h"
 
 namespace compiler {
     ///
@@ -50,12 +51,38 @@ namespace compiler {
         /// \brief The namespace the class should be put in (or the empty string for no namespace)
         std::wstring m_Namespace;
 
-        /// \brief The source file
+        /// \brief The parts of the source that are written to separate files when the split-output option is set
+        enum source_part {
+            /// \brief The parser actions and everything else that isn't in one of the other parts
+            main_source,
+
+            /// \brief The lexer and parser tables (and the static parser, which needs the lexer definition)
+            tables_source,
+
+            /// \brief The definitions of the AST classes
+            ast_source,
+
+            /// \brief The number of parts
+            num_source_parts
+        };
+
+        /// \brief The source file that is currently being written to (see select_source)
+        ///
+        /// The source and header are generated in memory, and written out to the files together once they're complete.
         std::ostream* m_SourceFile;
 
         /// \brief The header file
         std::ostream* m_HeaderFile;
 
+        /// \brief The stream for each part of the source (these are all the same stream unless split-output is set)
+        std::ostream* m_SourceParts[num_source_parts];
+
+        /// \brief The names of the generated files, and the streams their text is generated in (the header is first)
+        std::vector<std::pair<std::wstring, std::ostringstream*> > m_OutputFiles;
+
+        /// \brief True if the split-output option is set
+        bool m_SplitOutput;
+
         /// \brief Maps item IDs to their class identifiers
         std::map<int, std::string> m_ClassNameForItem;
 
@@ -65,7 +92,35 @@ namespace compiler {
         /// \brief The used class (and other identifier) names for the class (which should not be re-used)
         std::set<std::string> m_UsedClassNames;
 
+        /// \brief The C++ type used for the parser tables (lr::parser_tables, or lr::small_parser_tables if the tables fit)
+        std::string m_ParserTablesType;
+
+        /// \brief True if the AST classes should be generated so that they can be allocated from an arena (the pooled-ast option)
+        bool m_PooledAst;
+
+        /// \brief Maps nonterminal identifiers to the unit rules that the parser can skip for them (the eliminate-unit-rules option)
+        ///
+        /// The nodes for these nonterminals are rebuilt when they're used, as the parser will supply the inner item instead.
+        std::map<int, std::vector<int> > m_UnitRulesForNonterminal;
+
     public:
+        /// \brief The largest flat lexer table (in bytes) that will be used when the lexer table style is 'auto'
+        static const size_t c_MaxAutoFlatLexerSize = 64*1024;
+
+        /// \brief How many times larger than the smallest alternative a flat lexer table can be when the style is 'auto'
+        static const size_t c_MaxAutoFlatLexerRatio = 4;
+
+        /// \brief The largest symbol map (in bytes) that will always be written as a table with shared blocks of 256 characters
+        ///
+        /// Larger symbol maps only use shared blocks if they are no more than twice the size of the equivalent ranged table.
+        static const size_t c_MaxBmpSymbolMapSize = 16*1024;
+
+        /// \brief The largest number of parser states for which a direct-coded parser will be generated, unless the direct-parser-max-states option is set
+        static const int c_DefaultMaxDirectParserStates = 2000;
+
+        /// \brief The number of items that repeating AST nodes store without allocating any memory when the pooled-ast option is set
+        static const int c_PooledAstInlineItems = 4;
+
         /// \brief Creates a new output stage
         output_cplusplus(console_container& console, const std::wstring& filename, lexer_stage* lexer, language_stage* language, lr_parser_stage* parser, const std::wstring& filenamePrefix, const std::wstring& className, const std::wstring& namespaceName);
 
@@ -82,6 +137,15 @@ namespace compiler {
         /// \brief Writes out a header to the specified file
         virtual void write_header(const std::wstring& filename, std::ostream* target);
 
+        /// \brief Writes the generated source and header out to their files
+        virtual void write_files();
+
+        /// \brief Creates a new in-memory output file with the specified name
+        std::ostringstream* create_output_file(const std::wstring& filename);
+
+        /// \brief Chooses the part of the source that the following code is written to
+        void select_source(source_part part);
+
         /// \brief Returns true if the specified name should be considered 'valid'
         ///
         /// This is used when generating unique names for rules (and may be used in
@@ -107,12 +171,42 @@ namespace compiler {
         /// \brief Writes out the source code for the lexer state machine
         void source_lexer_state_machine();
 
+        /// \brief Writes out the lexer state machine using the compact table representation
+        void source_lexer_compact_tables();
+
+        /// \brief Writes out the lexer state machine using the row-displacement table representation
+        void source_lexer_comb_tables(const util::comb_vector& packed);
+
+        /// \brief Writes out the lexer state machine using the flat table representation, with cells of the specified size in bytes
+        void source_lexer_flat_tables(int numStates, int numSets, size_t cellSize);
+
+        /// \brief Writes out the lexer state machine as code, with a label for each state
+        void source_lexer_direct_code(int numStates, const dfa::skip_state* skip);
+
+        /// \brief Returns the start of an expression that allocates an AST node ('new ', or 'new (m_Pool) ' for pooled ASTs)
+        std::string new_ast_node() const;
+
         /// \brief Writes out the header items for the parser tables
         void header_parser_tables();
 
         /// \brief Writes out the source code for the parser tables
         void source_parser_tables();
 
+        /// \brief Returns true if a direct-coded parser can perform every action in the parser tables, or sets reason and returns false
+        bool can_write_direct_parser(std::wstring& reason);
+
+        /// \brief Writes out a parser with its state machine compiled into code, if the direct-parser option is set
+        void define_direct_parser();
+
+        /// \brief Writes out the declaration of the direct-coded parser class
+        void header_direct_parser();
+
+        /// \brief Writes out the parse function for the direct-coded parser
+        void source_direct_parser();
+
+        /// \brief Writes out a parser whose actions read from the generated lexer directly, if the static-parser option is set
+        void define_static_parser();
+
         /// \brief Writes out the forward declarations for the classes that represent nonterminals
         void header_ast_forward_declarations();
 
@@ -128,15 +222,42 @@ namespace compiler {
         /// \brief Writes out the functions for getting the file positions of each symbol
         void source_ast_position_functions();
 
+        /// \brief Fills in the names of the AST classes that a visitor is called for, paired with the name of their base class
+        void visited_classes(std::vector<std::pair<std::string, std::string> >& classes);
+
+        /// \brief Writes out the visitor class for the AST
+        void header_ast_visitor();
+
+        /// \brief Writes out the functions that let visitors walk the AST to the source file
+        void source_ast_visitor();
+
+        /// \brief Fills in the unit rules that the parser will skip, if the eliminate-unit-rules option is set
+        void find_unit_rules();
+
+        /// \brief Returns the name of the function that rebuilds the node for a nonterminal whose unit rules were skipped
+        std::string restore_function_name(const contextfree::item_container& nonterminal);
+
+        /// \brief Writes out the class that receives the items added to repeating nodes while parsing
+        void header_stream_events();
+
         /// \brief Writes out the parser actions to the header file
         void header_parser_actions();
 
         /// \brief Writes out the shift actions to the source file
         void source_shift_actions();
 
+        /// \brief Writes out the functions that rebuild the nodes for nonterminals whose unit rules were skipped
+        void source_unit_rule_restore();
+
         /// \brief Writes out the reduce actions to the source file
         void source_reduce_actions();
 
+        /// \brief Writes out the parser events class to the header file
+        void header_parser_events();
+
+        /// \brief Writes out the function that dispatches reduce events to the source file
+        void source_event_reduce();
+
         /// \brief Writes out inline functions to generate initial parser states for specific start symbols
         void header_start_symbols();
 
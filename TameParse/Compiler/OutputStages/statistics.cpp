@@ -0,0 +1,327 @@
+//
+//  statistics.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include <sstream>
+#include <algorithm>
+
+#include "TameParse/Compiler/OutputStages/statistics.h"
+#include "TameParse/Lr/compact_parser_tables.h"
+#include "TameParse/Dfa/state_machine.h"
+#include "TameParse/Util/comb_vector.h"
+
+using namespace std;
+using namespace dfa;
+using namespace lr;
+using namespace util;
+using namespace compiler;
+
+/// \brief The width of the labels in the report
+static const size_t c_LabelWidth = 32;
+
+/// \brief Creates a new output stage
+output_statistics::output_statistics(console_container& console, const std::wstring& filename, lexer_stage* lexer, language_stage* language, lr_parser_stage* parser, std::wostream& target)
+: output_stage(console, filename, lexer, language, parser)
+, m_Target(target) {
+}
+
+/// \brief Destructor
+output_statistics::~output_statistics() {
+}
+
+/// \brief Writes out a line of the report
+void output_statistics::write_line(const std::wstring& label, const std::wstring& value) {
+    wstring paddedLabel = label;
+    if (paddedLabel.size() < c_LabelWidth) {
+        paddedLabel.append(c_LabelWidth - paddedLabel.size(), L' ');
+    }
+    
+    m_Target << L"  " << paddedLabel << value << endl;
+}
+
+/// \brief Writes out a line of the report
+void output_statistics::write_line(const std::wstring& label, size_t value) {
+    wstringstream valueString;
+    valueString << value;
+    write_line(label, valueString.str());
+}
+
+/// \brief About to begin writing out output
+void output_statistics::begin_output() {
+    m_Target << endl << L"== Parser statistics:" << endl;
+}
+
+/// \brief Writes out the number of symbols and rules in the grammar
+void output_statistics::define_symbols() {
+    size_t numTerminals     = 0;
+    size_t numNonterminals  = 0;
+    
+    for (terminal_symbol_iterator term = begin_terminal_symbol(); term != end_terminal_symbol(); ++term) {
+        ++numTerminals;
+    }
+    for (nonterminal_symbol_iterator nonterm = begin_nonterminal_symbol(); nonterm != end_nonterminal_symbol(); ++nonterm) {
+        ++numNonterminals;
+    }
+    
+    m_Target << endl << L"Grammar:" << endl;
+    write_line(L"terminals", numTerminals);
+    write_line(L"nonterminals", numNonterminals);
+    write_line(L"rules", (size_t) get_parser_tables().count_reduce_rules());
+}
+
+/// \brief Returns the size in bytes of an element of the specified C type
+static size_t c_type_size(const string& type) {
+    if (type.find("char") != string::npos)  return 1;
+    if (type.find("short") != string::npos) return sizeof(short);
+    if (type.find("long") != string::npos)  return sizeof(long);
+    return sizeof(int);
+}
+
+/// \brief Returns the size in bytes of the array that an encoder will write for the specified table
+static size_t c_table_size(const table_encoder& encoder, const output_table& table) {
+    // Empty tables are written with a single element
+    size_t numElements = table.empty() ? 1 : table.size();
+    return numElements * c_type_size(encoder.element_type(table));
+}
+
+/// \brief Writes out the size of the lexer, and of its tables in each encoding
+void output_statistics::define_lexer_tables() {
+    // Gather the transitions for each state
+    vector<comb_vector::row> rows;
+    size_t numTransitions = 0;
+    
+    for (lexer_state_transition_iterator transit = begin_lexer_state_transition(); transit != end_lexer_state_transition(); ++transit) {
+        while (transit->stateIdentifier >= (int) rows.size()) {
+            rows.push_back(comb_vector::row());
+        }
+        
+        rows[transit->stateIdentifier].push_back(comb_vector::cell(transit->symbolSet, transit->newState));
+        ++numTransitions;
+    }
+    
+    size_t numAccepting = 0;
+    for (lexer_state_action_iterator action = begin_lexer_state_action(); action != end_lexer_state_action(); ++action) {
+        if (action->accepting) ++numAccepting;
+    }
+    
+    int numStates   = count_lexer_states();
+    int numSets     = count_lexer_symbol_sets();
+    
+    m_Target << endl << L"Lexer:" << endl;
+    write_line(L"states", (size_t) numStates);
+    write_line(L"symbol sets", (size_t) numSets);
+    write_line(L"transitions", numTransitions);
+    write_line(L"accepting states", numAccepting);
+    write_line(L"modes", (size_t) count_lexer_modes());
+    
+    // These are worked out in the same way as output_cplusplus does when choosing a style for --lexer-tables auto
+    comb_vector packed(rows);
+    
+    size_t flatCellSize = numStates < 0xff ? 1 : numStates < 0xffff ? 2 : sizeof(int);
+    
+    // The C output stage always uses a flat table, along with a symbol map made up of ranges
+    vector<output_table>    cTables(6);
+    c_array_encoder         narrowEncoder;
+    size_t                  narrowSize = 0;
+    
+    build_symbol_map_tables(cTables[0], cTables[1], cTables[2], cTables[3]);
+    build_flat_lexer_table(cTables[4]);
+    build_lexer_accept_table(cTables[5]);
+    
+    for (vector<output_table>::const_iterator table = cTables.begin(); table != cTables.end(); ++table) {
+        narrowSize += c_table_size(narrowEncoder, *table);
+    }
+    
+    m_Target << endl << L"Lexer table size (bytes):" << endl;
+    write_line(L"flat", flatCellSize * (size_t) numStates * (size_t) numSets);
+    write_line(L"compact", sizeof(state_machine_compact_table<false>::entry) * numTransitions + sizeof(void*) * rows.size());
+    write_line(L"comb", comb_vector::size_for(packed.count_rows(), packed.count_cells()));
+    write_line(L"C (narrow)", narrowSize);
+}
+
+/// \brief Writes out the size of the parser, and of its tables in each encoding
+void output_statistics::define_parser_tables() {
+    report_parser_actions();
+    report_parser_sizes();
+    report_largest_states();
+}
+
+/// \brief Writes out the number of each kind of parser action and how they are distributed between states
+void output_statistics::report_parser_actions() {
+    const parser_tables& tables = get_parser_tables();
+    
+    size_t          numTerminalActions      = 0;
+    size_t          numNonterminalActions   = 0;
+    size_t          numGuards               = 0;
+    size_t          numWeakReductions       = 0;
+    size_t          numShiftReductions      = 0;
+    size_t          numDefaultReductions    = 0;
+    vector<size_t>  histogram;
+    
+    for (int stateId = 0; stateId < tables.count_states(); ++stateId) {
+        const parser_tables::action_count& count = tables.action_counts()[stateId];
+        
+        numTerminalActions      += (size_t) count.numTerminals;
+        numNonterminalActions   += (size_t) count.numNonterminals;
+        
+        for (int actionId = 0; actionId < count.numTerminals; ++actionId) {
+            int type = tables.terminal_actions()[stateId][actionId].type;
+            
+            if (type == lr_action::act_guard)       ++numGuards;
+            if (type == lr_action::act_weakreduce)  ++numWeakReductions;
+            if (type == lr_action::act_shiftreduce) ++numShiftReductions;
+        }
+        
+        if (tables.has_default_reduction(stateId)) ++numDefaultReductions;
+        
+        // Bucket 0 is for states with no actions, and bucket n for states with 2^(n-1) to 2^n - 1 actions
+        size_t numActions   = (size_t) (count.numTerminals + count.numNonterminals);
+        size_t bucket       = 0;
+        while (numActions >> bucket) ++bucket;
+        
+        if (bucket >= histogram.size()) histogram.resize(bucket + 1, 0);
+        ++histogram[bucket];
+    }
+    
+    m_Target << endl << L"Parser:" << endl;
+    write_line(L"states", (size_t) tables.count_states());
+    write_line(L"terminal actions", numTerminalActions);
+    write_line(L"nonterminal actions", numNonterminalActions);
+    write_line(L"guard actions", numGuards);
+    write_line(L"weak reductions", numWeakReductions);
+    write_line(L"shift-reduce actions", numShiftReductions);
+    write_line(L"default reductions", numDefaultReductions);
+    write_line(L"states with end of guard", (size_t) tables.count_end_of_guards());
+    
+    m_Target << endl << L"Actions per state:" << endl;
+    for (size_t bucket = 0; bucket < histogram.size(); ++bucket) {
+        if (histogram[bucket] == 0) continue;
+        
+        wstringstream label;
+        if (bucket <= 1) {
+            label << bucket;
+        } else {
+            label << (1 << (bucket - 1)) << L"-" << (1 << bucket) - 1;
+        }
+        
+        write_line(label.str(), histogram[bucket]);
+    }
+}
+
+/// \brief Writes out the size of the parser tables in each encoding
+void output_statistics::report_parser_sizes() {
+    const parser_tables& tables = get_parser_tables();
+    
+    // The compact tables are the same as the wide ones, except that the actions, counts and rules use narrower types
+    size_t wideSize = tables.size();
+    size_t numActions = 0;
+    
+    for (int stateId = 0; stateId < tables.count_states(); ++stateId) {
+        numActions += (size_t) (tables.action_counts()[stateId].numTerminals + tables.action_counts()[stateId].numNonterminals);
+    }
+    if (tables.default_reductions()) {
+        numActions += (size_t) tables.count_states();
+    }
+    
+    size_t compactSize = wideSize 
+        - sizeof(parser_tables) + sizeof(small_parser_tables)
+        - (sizeof(parser_tables::action) - sizeof(small_parser_tables::action)) * numActions
+        - (sizeof(parser_tables::action_count) - sizeof(small_parser_tables::action_count)) * (size_t) tables.count_states()
+        - (sizeof(parser_tables::reduce_rule) - sizeof(small_parser_tables::reduce_rule)) * (size_t) tables.count_reduce_rules();
+    
+    // Build the tables written by the C output stage
+    vector<output_table> cTables(12);
+    
+    build_parser_action_tables(true, cTables[0], cTables[1], cTables[2], cTables[3]);
+    build_parser_action_tables(false, cTables[4], cTables[5], cTables[6], cTables[7]);
+    build_default_reduction_table(cTables[8]);
+    build_reduce_rule_tables(cTables[9], cTables[10], cTables[11]);
+    
+    c_array_encoder narrowEncoder;
+    c_array_encoder intEncoder("int");
+    size_t          narrowSize  = 0;
+    size_t          intSize     = 0;
+    
+    for (vector<output_table>::const_iterator table = cTables.begin(); table != cTables.end(); ++table) {
+        narrowSize  += c_table_size(narrowEncoder, *table);
+        intSize     += c_table_size(intEncoder, *table);
+    }
+    
+    m_Target << endl << L"Parser table size (bytes):" << endl;
+    write_line(L"wide", wideSize);
+    if (small_parser_tables::can_represent(tables)) {
+        write_line(L"compact", compactSize);
+    } else {
+        write_line(L"compact", L"(too large)");
+    }
+    write_line(L"C (narrow)", narrowSize);
+    write_line(L"C (int)", intSize);
+}
+
+/// \brief Orders states so that the ones with the most actions come first
+class most_actions_first {
+private:
+    const parser_tables* m_Tables;
+    
+public:
+    explicit most_actions_first(const parser_tables* tables) : m_Tables(tables) { }
+    
+    inline int count(int stateId) const {
+        return m_Tables->action_counts()[stateId].numTerminals + m_Tables->action_counts()[stateId].numNonterminals;
+    }
+    
+    inline bool operator()(int a, int b) const {
+        int countA = count(a);
+        int countB = count(b);
+        
+        if (countA != countB) return countA > countB;
+        return a < b;
+    }
+};
+
+/// \brief Writes out the states with the most actions
+void output_statistics::report_largest_states() {
+    const parser_tables& tables = get_parser_tables();
+    
+    vector<int> states;
+    for (int stateId = 0; stateId < tables.count_states(); ++stateId) {
+        states.push_back(stateId);
+    }
+    
+    size_t numLargest = min(states.size(), (size_t) c_NumLargestStates);
+    partial_sort(states.begin(), states.begin() + numLargest, states.end(), most_actions_first(&tables));
+    
+    m_Target << endl << L"Largest states:" << endl;
+    for (size_t stateNum = 0; stateNum < numLargest; ++stateNum) {
+        const parser_tables::action_count& count = tables.action_counts()[states[stateNum]];
+        
+        wstringstream label;
+        wstringstream value;
+        
+        label << L"#" << states[stateNum];
+        value << count.numTerminals + count.numNonterminals << L" (" << count.numTerminals << L" terminal, " << count.numNonterminals << L" nonterminal)";
+        
+        write_line(label.str(), value.str());
+    }
+}
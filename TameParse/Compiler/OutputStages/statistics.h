@@ -0,0 +1,89 @@
+//
+//  statistics.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _COMPILER_OUTPUT_STATISTICS_H
+#define _COMPILER_OUTPUT_STATISTICS_H
+
+#include <string>
+#include <iostream>
+
+#include "TameParse/Compiler/output_stage.h"
+
+namespace compiler {
+    ///
+    /// \brief Output stage that writes a summary of the size of the generated lexer and parser
+    ///
+    /// Rather than generating a parser, this reports the number of states and actions, how the actions are distributed
+    /// between the states and how large the tables would be in each of the encodings that the other output stages can
+    /// use. This is much shorter than the full tables written by --show-parser, and is intended to help decide which
+    /// options to use to make the tables smaller.
+    ///
+    class output_statistics : public output_stage {
+    private:
+        /// \brief The stream that the report is written to
+        std::wostream& m_Target;
+    
+    public:
+        /// \brief The number of states listed in the 'largest states' section of the report
+        static const int c_NumLargestStates = 10;
+        
+        /// \brief Creates a new output stage
+        output_statistics(console_container& console, const std::wstring& filename, lexer_stage* lexer, language_stage* language, lr_parser_stage* parser, std::wostream& target);
+        
+        /// \brief Destructor
+        virtual ~output_statistics();
+    
+    private:
+        /// \brief Writes out a line of the report
+        void write_line(const std::wstring& label, const std::wstring& value);
+        
+        /// \brief Writes out a line of the report
+        void write_line(const std::wstring& label, size_t value);
+        
+        /// \brief Writes out the number of each kind of parser action and how they are distributed between states
+        void report_parser_actions();
+        
+        /// \brief Writes out the size of the parser tables in each encoding
+        void report_parser_sizes();
+        
+        /// \brief Writes out the states with the most actions
+        void report_largest_states();
+    
+    protected:
+        /// \brief About to begin writing out output
+        virtual void begin_output();
+        
+        /// \brief Writes out the number of symbols and rules in the grammar
+        virtual void define_symbols();
+        
+        /// \brief Writes out the size of the lexer, and of its tables in each encoding
+        virtual void define_lexer_tables();
+        
+        /// \brief Writes out the size of the parser, and of its tables in each encoding
+        virtual void define_parser_tables();
+    };
+}
+
+#endif
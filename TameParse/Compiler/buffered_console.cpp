@@ -0,0 +1,165 @@
+//
+//  buffered_console.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#include "TameParse/Compiler/buffered_console.h"
+
+using namespace std;
+using namespace compiler;
+
+/// \brief Creates a console that will send its results to the specified console
+buffered_console::buffered_console(console& parent)
+: m_Parent(&parent)
+, m_ExitCode(0)
+, m_Replayed(false) {
+}
+
+/// \brief Creates a new, empty, buffer for the same parent console
+console* buffered_console::clone() const {
+    return new buffered_console(*m_Parent);
+}
+
+/// \brief Sends the messages and errors stored so far to the parent console, and clears this one
+void buffered_console::replay() {
+    // Pass on the text
+    m_Parent->verbose_stream() << m_Verbose.str();
+    m_Parent->message_stream() << m_Messages.str();
+    
+    // Followed by the errors
+    for (vector<error>::const_iterator err = m_Errors.begin(); err != m_Errors.end(); ++err) {
+        m_Parent->report_error(*err);
+    }
+    
+    // And the profiles
+    for (vector<stage_profile>::const_iterator profile = m_Profiles.begin(); profile != m_Profiles.end(); ++profile) {
+        m_Parent->record_profile(*profile);
+    }
+    
+    // Reset the buffers
+    m_Verbose.str(wstring());
+    m_Messages.str(wstring());
+    m_Errors.clear();
+    m_Profiles.clear();
+    m_ExitCode = 0;
+    
+    // Anything reported from now on goes straight to the parent
+    m_Replayed = true;
+}
+
+/// \brief Stores an error to be reported later
+void buffered_console::report_error(const error& error) {
+    if (m_Replayed) {
+        m_Parent->report_error(error);
+        return;
+    }
+    
+    // Set the exit code the same way as std_console
+    if (error.sev() >= error::sev_error) {
+        m_ExitCode = error.sev();
+    }
+    
+    // Don't store errors that the parent console would throw away
+    if (!m_Parent->shows_errors(error.sev())) return;
+    
+    m_Errors.push_back(error);
+}
+
+/// \brief True if the parent console will show errors with the specified severity
+bool buffered_console::shows_errors(error::severity sev) const {
+    return m_Parent->shows_errors(sev);
+}
+
+/// \brief The exit code that the errors reported to this console will produce (or the parent's exit code)
+int buffered_console::exit_code() {
+    if (m_ExitCode) return m_ExitCode;
+    return m_Parent->exit_code();
+}
+
+/// \brief The stream where messages are stored
+std::wostream& buffered_console::message_stream() {
+    if (m_Replayed) return m_Parent->message_stream();
+    return m_Messages;
+}
+
+/// \brief The stream where verbose messages are stored
+std::wostream& buffered_console::verbose_stream() {
+    if (m_Replayed) return m_Parent->verbose_stream();
+    return m_Verbose;
+}
+
+/// \brief Stores a profile to be recorded later
+void buffered_console::record_profile(const stage_profile& profile) {
+    if (m_Replayed) {
+        m_Parent->record_profile(profile);
+        return;
+    }
+    
+    m_Profiles.push_back(profile);
+}
+
+/// \brief Retrieves the value of an option from the parent console
+std::wstring buffered_console::get_option(const std::wstring& name) const {
+    return m_Parent->get_option(name);
+}
+
+/// \brief Retrieves the values of an option from the parent console
+std::vector<std::wstring> buffered_console::get_option_list(const std::wstring& name) {
+    return m_Parent->get_option_list(name);
+}
+
+/// \brief The name of the initial input file
+const std::wstring& buffered_console::input_file() const {
+    return m_Parent->input_file();
+}
+
+/// \brief Converts a filename using the parent console
+std::string buffered_console::convert_filename(const std::wstring& filename) {
+    return m_Parent->convert_filename(filename);
+}
+
+/// \brief Finds the real path for a file using the parent console
+std::wstring buffered_console::real_path(const std::wstring& pathname) {
+    return m_Parent->real_path(pathname);
+}
+
+/// \brief Splits a path using the parent console
+std::vector<std::wstring> buffered_console::split_path(const std::wstring& pathname) {
+    return m_Parent->split_path(pathname);
+}
+
+/// \brief Retrieves the time that a file was last modified using the parent console
+bool buffered_console::last_write_time(const std::wstring& filename, std::time_t& result) {
+    return m_Parent->last_write_time(filename, result);
+}
+
+/// \brief Opens a file for reading using the parent console
+std::istream* buffered_console::open_file(const std::wstring& filename) {
+    return m_Parent->open_file(filename);
+}
+
+/// \brief Opens a file for writing using the parent console
+std::ostream* buffered_console::open_binary_file_for_writing(const std::wstring& filename) {
+    return m_Parent->open_binary_file_for_writing(filename);
+}
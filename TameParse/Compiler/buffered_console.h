@@ -0,0 +1,135 @@
+//
+//  buffered_console.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _COMPILER_BUFFERED_CONSOLE_H
+#define _COMPILER_BUFFERED_CONSOLE_H
+
+#include <sstream>
+#include <vector>
+
+#include "TameParse/Compiler/console.h"
+
+namespace compiler {
+    ///
+    /// \brief Console that stores the errors and messages reported to it until they are passed on to another console
+    ///
+    /// This is used to run compilation stages on separate threads: each stage is given its own buffered console,
+    /// and the results are replayed to the real console in a fixed order once the stages have finished, so the
+    /// output does not depend on how the threads were scheduled.
+    ///
+    /// Options and file operations are passed straight through to the parent console, which must be safe to call
+    /// from more than one thread for these operations (std_console is).
+    ///
+    class buffered_console : public console {
+    private:
+        /// \brief The console that the results are sent to when replay() is called
+        console* m_Parent;
+        
+        /// \brief The errors that have been reported, in order
+        std::vector<error> m_Errors;
+        
+        /// \brief Text written to the message stream
+        std::wstringstream m_Messages;
+        
+        /// \brief Text written to the verbose stream
+        std::wstringstream m_Verbose;
+        
+        /// \brief The profiles that have been recorded, in order
+        std::vector<stage_profile> m_Profiles;
+        
+        /// \brief The exit code implied by the errors reported to this console
+        int m_ExitCode;
+        
+        /// \brief True once replay() has been called: everything is sent directly to the parent after this
+        bool m_Replayed;
+        
+    public:
+        /// \brief Creates a console that will send its results to the specified console
+        ///
+        /// The parent console is not copied, and must remain valid for as long as this one.
+        explicit buffered_console(console& parent);
+        
+        /// \brief Creates a new, empty, buffer for the same parent console
+        virtual console* clone() const;
+        
+        /// \brief Sends the messages and errors stored so far to the parent console, and clears this one
+        ///
+        /// The verbose and message text are written first, followed by the errors in the order that they were reported
+        /// and then the profiles in the order that they were recorded.
+        /// Anything reported to this console after it has been replayed is sent to the parent straight away, so stages
+        /// that were compiled with a buffered console can carry on being used once their results have been replayed.
+        void replay();
+        
+    public:
+        /// \brief Stores an error to be reported later
+        virtual void report_error(const error& error);
+        
+        /// \brief True if the parent console will show errors with the specified severity
+        virtual bool shows_errors(error::severity sev) const;
+        
+        /// \brief The exit code that the errors reported to this console will produce (or the parent's exit code)
+        virtual int exit_code();
+        
+        /// \brief The stream where messages are stored
+        virtual std::wostream& message_stream();
+        
+        /// \brief The stream where verbose messages are stored
+        virtual std::wostream& verbose_stream();
+        
+        /// \brief Stores a profile to be recorded later
+        virtual void record_profile(const stage_profile& profile);
+        
+    public:
+        /// \brief Retrieves the value of an option from the parent console
+        virtual std::wstring get_option(const std::wstring& name) const;
+        
+        /// \brief Retrieves the values of an option from the parent console
+        virtual std::vector<std::wstring> get_option_list(const std::wstring& name);
+        
+        /// \brief The name of the initial input file
+        virtual const std::wstring& input_file() const;
+        
+        /// \brief Converts a filename using the parent console
+        virtual std::string convert_filename(const std::wstring& filename);
+        
+        /// \brief Finds the real path for a file using the parent console
+        virtual std::wstring real_path(const std::wstring& pathname);
+        
+        /// \brief Splits a path using the parent console
+        virtual std::vector<std::wstring> split_path(const std::wstring& pathname);
+        
+        /// \brief Retrieves the time that a file was last modified using the parent console
+        virtual bool last_write_time(const std::wstring& filename, std::time_t& result);
+        
+        /// \brief Opens a file for reading using the parent console
+        virtual std::istream* open_file(const std::wstring& filename);
+        
+        /// \brief Opens a file for writing using the parent console
+        virtual std::ostream* open_binary_file_for_writing(const std::wstring& filename);
+    };
+}
+
+#endif
@@ -25,6 +25,8 @@
 //  IN THE SOFTWARE.
 //
 
+#include <cstdlib>
+
 #include "TameParse/Compiler/compilation_stage.h"
 
 using namespace compiler;
@@ -34,3 +36,18 @@ compilation_stage::compilation_stage(console_container& console, const std::wstr
 : m_Console(console)
 , m_Filename(filename) {
 }
+
+/// \brief Destructor
+compilation_stage::~compilation_stage() {
+}
+
+/// \brief The number of threads that this stage should use for work that can be done in parallel
+unsigned int compilation_stage::max_threads() const {
+    std::wstring threads = cons().get_option(L"threads");
+    if (threads.empty()) return 0;
+    
+    long value = wcstol(threads.c_str(), NULL, 10);
+    if (value < 0) return 0;
+    
+    return (unsigned int) value;
+}
@@ -54,6 +54,9 @@ namespace compiler {
         /// \brief Creates a new compilation stage which will use the specified console object
         compilation_stage(console_container& console, const std::wstring& filename);
         
+        /// \brief Destructor
+        virtual ~compilation_stage();
+        
         /// \brief Performs the actions associated with this compilation stage
         virtual void compile() = 0;
         
@@ -66,6 +69,12 @@ namespace compiler {
         
         /// \brief A console container for this stage
         inline console_container cons_container() const { return m_Console; }
+        
+        /// \brief The number of threads that this stage should use for work that can be done in parallel
+        ///
+        /// This is set by the 'threads' option, and is 0 (meaning one thread per processor core) if the option is not
+        /// set or is not a number.
+        unsigned int max_threads() const;
     };
 }
 
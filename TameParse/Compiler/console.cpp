@@ -54,6 +54,17 @@ std::string console::convert_filename(const std::wstring& filename) {
     return latin1Filename;
 }
 
+/// \brief Records the profile of a compilation stage that has finished
+///
+/// The default implementation discards the profile
+void console::record_profile(const stage_profile& profile) {
+}
+
+/// \brief True if errors with the specified severity will be shown
+bool console::shows_errors(error::severity sev) const {
+    return true;
+}
+
 /// \brief Returns true if the options are valid and the parser can start
 bool console::can_start() const {
     return true;
@@ -92,6 +103,13 @@ std::wstring console::real_path(const std::wstring& pathname) {
     return pathname;
 }
 
+/// \brief Retrieves the time that the file with the specified name was last modified
+///
+/// The default implementation doesn't know how to do this, and always returns false
+bool console::last_write_time(const std::wstring& filename, std::time_t& result) {
+    return false;
+}
+
 /// \brief Splits a path into its components
 ///
 /// The default implementation assumes UNIX-style paths.
@@ -28,11 +28,13 @@
 #ifndef _COMPILER_CONSOLE_H
 #define _COMPILER_CONSOLE_H
 
+#include <ctime>
 #include <iostream>
 #include <string>
 #include <vector>
 
 #include "TameParse/Compiler/error.h"
+#include "TameParse/Compiler/stage_profile.h"
 #include "TameParse/Util/container.h"
 
 namespace compiler {
@@ -68,6 +70,13 @@ namespace compiler {
         /// \brief Reports an error to the console
         virtual void report_error(const error& error) = 0;
         
+        /// \brief True if errors with the specified severity will be shown
+        ///
+        /// Stages can check this before building the description of an error, so that they don't spend time formatting
+        /// messages that will be thrown away. Errors and anything more severe must always be reported, as they set the
+        /// exit code. The default implementation shows everything.
+        virtual bool shows_errors(error::severity sev) const;
+        
         /// \brief Returns the exit code that the application should use (if there's an error, this will be non-zero)
         virtual int exit_code() = 0;
         
@@ -79,6 +88,11 @@ namespace compiler {
         /// console is configured to)
         virtual std::wostream& verbose_stream() = 0;
         
+        /// \brief Records the profile of a compilation stage that has finished
+        ///
+        /// The default implementation discards the profile
+        virtual void record_profile(const stage_profile& profile);
+        
     public:
         /// \brief Retrieves the value of the option with the specified name.
         ///
@@ -118,6 +132,12 @@ namespace compiler {
         /// The default implementation assumes UNIX-style paths.
         virtual std::vector<std::wstring> split_path(const std::wstring& pathname);
         
+        /// \brief Retrieves the time that the file with the specified name was last modified
+        ///
+        /// Returns false if the file doesn't exist or the time can't be determined. The default implementation always
+        /// returns false, so anything that depends on file times must treat this as 'the file may have changed'.
+        virtual bool last_write_time(const std::wstring& filename, std::time_t& result);
+        
         /// \brief Opens a text file with the specified name for reading
         ///
         /// The caller should delete the stream once it has finished with it. Streams are generally expected to contain UTF-8
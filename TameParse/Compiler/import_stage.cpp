@@ -31,14 +31,34 @@
 
 #include "TameParse/Compiler/import_stage.h"
 #include "TameParse/Compiler/parser_stage.h"
+#include "TameParse/Compiler/buffered_console.h"
+#include "TameParse/Util/parallel.h"
 
 using namespace std;
 using namespace language;
 using namespace compiler;
 
+/// \brief Parses each of a list of files
+class parse_files_task {
+private:
+    /// \brief The stages that parse the files
+    const vector<parser_stage*>& m_Stages;
+    
+public:
+    parse_files_task(const vector<parser_stage*>& stages)
+    : m_Stages(stages) {
+    }
+    
+    /// \brief Parses the file with the specified index
+    void operator()(size_t index) {
+        m_Stages[index]->compile();
+    }
+};
+
 /// \brief Creates a new import stage
-import_stage::import_stage(console_container& console, const std::wstring& filename, definition_file_container rootFile) 
-: compilation_stage(console, filename) {
+import_stage::import_stage(console_container& console, const std::wstring& filename, definition_file_container rootFile, parser_stage::definition_cache* cache) 
+: compilation_stage(console, filename)
+, m_Cache(cache) {
     // Add the root file to the stage for file list
     wstring realPath = console->real_path(filename);
     
@@ -52,7 +72,7 @@ import_stage::~import_stage() {
 
 /// \brief Performs the actions associated with this compilation stage
 void import_stage::compile() {
-    console_container consContainer = cons_container();
+    profile_scope       profile(cons(), L"import", filename());
     
     // Create a stack of definitions to look for import statements in
     typedef pair<wstring, definition_file_container> stack_entry;
@@ -76,6 +96,31 @@ void import_stage::compile() {
         // Ignore files with no data
         if (!nextFile.second.item()) continue;
         
+        // Parse the new files imported by this file at the same time, each reporting to its own console
+        map<wstring, parser_stage*>     parsedFiles;
+        map<wstring, buffered_console*> parsedConsoles;
+        vector<parser_stage*>           parsers;
+        
+        for (definition_file::iterator defn = nextFile.second->begin(); defn != nextFile.second->end(); ++defn) {
+            if (!(*defn)->import()) continue;
+            
+            wstring importFile  = (*defn)->import()->import_filename();
+            wstring realPath    = cons().real_path(importFile);
+            
+            if (imported.find(realPath) != imported.end() || parsedFiles.find(realPath) != parsedFiles.end()) continue;
+            
+            buffered_console*   importConsole = new buffered_console(cons());
+            console_container   importContainer(importConsole, true);
+            parser_stage*       importStage   = new parser_stage(importContainer, importFile, m_Cache);
+            
+            parsedFiles[realPath]       = importStage;
+            parsedConsoles[realPath]    = importConsole;
+            parsers.push_back(importStage);
+        }
+        
+        parse_files_task parseFiles(parsers);
+        util::parallel_for(parsers.size(), max_threads(), parseFiles);
+        
         // Look for import statements
         for (definition_file::iterator defn = nextFile.second->begin(); defn != nextFile.second->end(); ++defn) {
             if ((*defn)->import()) {
@@ -89,16 +134,16 @@ void import_stage::compile() {
                 // Mark as processed
                 imported.insert(realPath);
 
-                // Load in this file
-                parser_stage importStage(consContainer, importFile);
-                importStage.compile();
+                // Report the results of loading in this file
+                parser_stage* importStage = parsedFiles[realPath];
+                parsedConsoles[realPath]->replay();
 
                 // Add to the result
-                m_DefinitionForFile[realPath]   = importStage.definition_file();
+                m_DefinitionForFile[realPath]   = importStage->definition_file();
                 m_ShortNameForFile[realPath]    = importFile;
 
                 // Process any imports that the new file might contain
-                toImport.push(stack_entry(realPath, importStage.definition_file()));
+                toImport.push(stack_entry(realPath, importStage->definition_file()));
             }
             
             if ((*defn)->language()) {
@@ -121,9 +166,17 @@ void import_stage::compile() {
                 }
             }
         }
+        
+        // Finished with the parsers (the definitions they produced are reference counted)
+        for (vector<parser_stage*>::iterator parser = parsers.begin(); parser != parsers.end(); ++parser) {
+            delete *parser;
+        }
     }
     
     // Output some statistics
     size_t numDefns = m_LanguageBlock.size();
     cons().verbose_stream() << L"    Found " << numDefns << L" language definition" << (numDefns == 1?L"":L"s") << endl;
+    
+    profile->add_counter(L"files", (long) m_DefinitionForFile.size());
+    profile->add_counter(L"languages", (long) numDefns);
 }
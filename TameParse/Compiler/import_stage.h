@@ -32,6 +32,7 @@
 #include <map>
 
 #include "TameParse/Compiler/compilation_stage.h"
+#include "TameParse/Compiler/parser_stage.h"
 #include "TameParse/Language/definition_file.h"
 
 namespace compiler {
@@ -52,6 +53,9 @@ namespace compiler {
         /// \brief Iterator for retrieving a list of language name, block pairs
         typedef language_block_map::const_iterator language_iterator;
 
+        /// \brief Iterator for retrieving the real paths of the files that were imported, along with their short names
+        typedef string_map::const_iterator file_iterator;
+
     private:
         /// \brief The definition file containers that are imported by this object
         definition_map m_DefinitionForFile;
@@ -64,15 +68,24 @@ namespace compiler {
         
         /// \brief Maps language names to the filenames that they are defined in
         string_map m_LanguageFile;
+        
+        /// \brief NULL, or the cache of files that have already been parsed
+        parser_stage::definition_cache* m_Cache;
 
     public:
         /// \brief Creates a new import stage
-        import_stage(console_container& console, const std::wstring& filename, language::definition_file_container rootFile);
+        ///
+        /// If a cache is supplied, imported files whose contents haven't changed since they were stored there are not
+        /// parsed again.
+        import_stage(console_container& console, const std::wstring& filename, language::definition_file_container rootFile, parser_stage::definition_cache* cache = NULL);
 
         /// \brief Destructor
         virtual ~import_stage();
 
         /// \brief Performs the actions associated with this compilation stage
+        ///
+        /// The files imported by each file are parsed in parallel. Their results are reported in the same order as
+        /// they would be if they were parsed one at a time.
         virtual void compile();
 
     public:
@@ -104,6 +117,12 @@ namespace compiler {
 
         /// \brief An iterator that returns the item after the last language in this object
         inline language_iterator end_language() const { return m_LanguageBlock.end(); }
+
+        /// \brief An iterator that returns the first file read by this object (including the file it was created with)
+        inline file_iterator begin_file() const { return m_ShortNameForFile.begin(); }
+
+        /// \brief An iterator that returns the item after the last file read by this object
+        inline file_iterator end_file() const { return m_ShortNameForFile.end(); }
     };
 }
 
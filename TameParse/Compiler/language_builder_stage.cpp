@@ -26,7 +26,10 @@
 //
 
 #include "TameParse/Compiler/language_builder_stage.h"
+#include "TameParse/Compiler/buffered_console.h"
+#include "TameParse/Util/parallel.h"
 
+using namespace std;
 using namespace dfa;
 using namespace language;
 using namespace compiler;
@@ -50,14 +53,53 @@ language_builder_stage::~language_builder_stage() {
     // The import stage doesn't belong to this object, so we don't free it here
 }
 
+/// \brief Compiles each of a list of families of language stages
+///
+/// A family is a language along with every language that inherits from it. The stages in a family are compiled in
+/// order on the same thread, so each language can build on the results of the language it inherits from: the stages
+/// share reference-counted objects, so they can't be used on separate threads. Separate families are independent of
+/// each other and can be compiled on separate threads.
+class compile_languages_task {
+private:
+    /// \brief The stages to compile
+    const vector<language_stage*>& m_Stages;
+    
+    /// \brief The indexes of the stages in each family, with every language after the one it inherits from
+    const vector<vector<size_t> >& m_Families;
+    
+public:
+    compile_languages_task(const vector<language_stage*>& stages, const vector<vector<size_t> >& families)
+    : m_Stages(stages)
+    , m_Families(families) {
+    }
+    
+    /// \brief Compiles the family with the specified index
+    void operator()(size_t index) {
+        const vector<size_t>& family = m_Families[index];
+        
+        for (vector<size_t>::const_iterator stage = family.begin(); stage != family.end(); ++stage) {
+            m_Stages[*stage]->compile();
+        }
+    }
+};
+
 /// \brief Performs the actions associated with this compilation stage
+///
+/// Languages that don't inherit from one another are compiled in parallel. Each one reports to its own buffered
+/// console, and these are replayed in the order that the languages were declared, so the errors are reported in the
+/// same order as they would be if the languages were compiled one at a time. A language that inherits from another
+/// one builds on the results of the stage that compiled it rather than compiling it again.
 void language_builder_stage::compile() {
     // Sanity check
     if (!m_ImportStage) {
         cons().report_error(error(error::sev_bug, filename(), L"BUG_NO_IMPORT_STAGE", L"Import stage missing", position(-1, -1, -1)));
     }
 
-    console_container consContainer(cons_container());
+    // The stages to compile, and the consoles that will receive their results
+    vector<language_stage*>         stages;
+    vector<const language_block*>   blocks;
+    vector<buffered_console*>       consoles;
+    map<wstring, size_t>            indexForName;
 
     // Run through all of the language blocks in the import stage
     for (import_stage::language_iterator language = m_ImportStage->begin_language(); language != m_ImportStage->end_language(); ++language) {
@@ -73,11 +115,81 @@ void language_builder_stage::compile() {
         }
 
         // Create a language stage to compile this language
-        language_stage* stage       = new language_stage(consContainer, languageFileName, languageBlock, m_ImportStage);
-        m_Languages[languageName]   = stage;
+        buffered_console*   languageConsole = new buffered_console(cons());
+        console_container   consContainer(languageConsole, true);
+        language_stage*     stage           = new language_stage(consContainer, languageFileName, languageBlock, m_ImportStage);
+        m_Languages[languageName]           = stage;
 
-        // Compile it
-        stage->compile();
+        indexForName[languageName]          = stages.size();
+        stages.push_back(stage);
+        blocks.push_back(languageBlock);
+        consoles.push_back(languageConsole);
+    }
+    
+    // Find the stage for the language that each language inherits from (only the first one is used)
+    vector<int> baseIndex(stages.size(), -1);
+    
+    for (size_t stageNum = 0; stageNum < stages.size(); ++stageNum) {
+        if (blocks[stageNum]->inherits().empty()) continue;
+        
+        map<wstring, size_t>::const_iterator base = indexForName.find(blocks[stageNum]->inherits().front());
+        if (base != indexForName.end()) baseIndex[stageNum] = (int) base->second;
+    }
+    
+    // Find the language at the root of each family, and how far each language is from it
+    vector<size_t>  root(stages.size());
+    vector<size_t>  depth(stages.size(), 0);
+    size_t          maxDepth = 0;
+    
+    for (size_t stageNum = 0; stageNum < stages.size(); ++stageNum) {
+        root[stageNum] = stageNum;
+        
+        while (baseIndex[root[stageNum]] >= 0 && depth[stageNum] <= stages.size()) {
+            root[stageNum] = (size_t) baseIndex[root[stageNum]];
+            ++depth[stageNum];
+        }
+        
+        // Languages in an inheritance loop are left to compile their own copies of the languages they inherit from
+        // TODO: inheritance loops should produce an error (other than a stack overflow)
+        if (depth[stageNum] > stages.size()) {
+            root[stageNum]  = stageNum;
+            depth[stageNum] = 0;
+        }
+        
+        if (depth[stageNum] > maxDepth) maxDepth = depth[stageNum];
+    }
+    
+    // Languages that inherit from another language build on the stage that compiles it
+    for (size_t stageNum = 0; stageNum < stages.size(); ++stageNum) {
+        if (depth[stageNum] > 0) {
+            stages[stageNum]->set_base_language(stages[baseIndex[stageNum]]);
+        }
+    }
+    
+    // Group the languages into families, in order of their depth so that every language comes after its base
+    vector<vector<size_t> > families;
+    vector<int>             familyForRoot(stages.size(), -1);
+    
+    for (size_t familyDepth = 0; familyDepth <= maxDepth; ++familyDepth) {
+        for (size_t stageNum = 0; stageNum < stages.size(); ++stageNum) {
+            if (depth[stageNum] != familyDepth) continue;
+            
+            if (familyForRoot[root[stageNum]] < 0) {
+                familyForRoot[root[stageNum]] = (int) families.size();
+                families.push_back(vector<size_t>());
+            }
+            
+            families[familyForRoot[root[stageNum]]].push_back(stageNum);
+        }
+    }
+    
+    // Compile them
+    compile_languages_task task(stages, families);
+    util::parallel_for(families.size(), max_threads(), task);
+    
+    // Report the results (the consoles are owned by the stages, which will use them to report anything else directly)
+    for (vector<buffered_console*>::iterator languageConsole = consoles.begin(); languageConsole != consoles.end(); ++languageConsole) {
+        (*languageConsole)->replay();
     }
     
     // It's an error for no languages to be defined (as we won't be able to define anything)
@@ -0,0 +1,179 @@
+//
+//  language_compiler.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#include <sstream>
+
+#include "TameParse/Compiler/language_compiler.h"
+#include "TameParse/Compiler/import_stage.h"
+#include "TameParse/Compiler/language_builder_stage.h"
+#include "TameParse/Compiler/lexer_stage.h"
+#include "TameParse/Compiler/lr_parser_stage.h"
+#include "TameParse/Language/language_parser.h"
+
+using namespace std;
+using namespace dfa;
+using namespace lr;
+using namespace language;
+using namespace compiler;
+
+/// \brief Compiles a language from the definition in the specified text, returning NULL if it can't be compiled
+compiled_language* language_compiler::compile_language(console_container& console, const std::wstring& filename, const std::wstring& definitionText, const std::wstring& languageName, const std::vector<std::wstring>& startSymbols) {
+    // Parse the definition
+    language_parser parser;
+    parser.set_filename(filename);
+    
+    if (!parser.parse(definitionText)) {
+        typedef language_parser::error_list error_list;
+        const error_list& errors = parser.errors();
+        
+        if (!errors.empty()) {
+            for (error_list::const_iterator nextError = errors.begin(); nextError != errors.end(); ++nextError) {
+                console->report_error(*nextError);
+            }
+        } else {
+            console->report_error(error(error::sev_bug, filename, L"BUG_CANT_REPORT_SYNTAX", L"Unknown syntax error", position(-1, -1, -1)));
+        }
+        return NULL;
+    }
+    
+    definition_file_container definition = parser.file_definition();
+    
+    // Load the imports
+    import_stage importStage(console, filename, definition);
+    importStage.compile();
+    if (console->exit_code()) return NULL;
+    
+    // Work out which language to build, using the same rules as the parser generator
+    wstring             buildLanguageName   = languageName;
+    vector<wstring>     buildStartSymbols   = startSymbols;
+    const parser_block* parserBlock         = NULL;
+    int                 languageCount       = 0;
+    wstring             onlyLanguage;
+    
+    for (definition_file::iterator defnBlock = definition->begin(); defnBlock != definition->end(); ++defnBlock) {
+        if ((*defnBlock)->parser() && !parserBlock) {
+            parserBlock = (*defnBlock)->parser();
+        }
+        
+        if ((*defnBlock)->language()) {
+            ++languageCount;
+            onlyLanguage = (*defnBlock)->language()->identifier();
+        }
+    }
+    
+    if (buildLanguageName.empty() && buildStartSymbols.empty() && parserBlock) {
+        buildLanguageName   = parserBlock->language_name();
+        buildStartSymbols   = parserBlock->start_symbols();
+    }
+    
+    if (buildLanguageName.empty() && languageCount == 1) {
+        buildLanguageName = onlyLanguage;
+    }
+    
+    if (buildLanguageName.empty()) {
+        console->report_error(error(error::sev_error, filename, L"NO_LANGUAGE_SPECIFIED", L"Could not determine which language block to compile", position(-1, -1, -1)));
+        return NULL;
+    }
+    
+    if (buildStartSymbols.empty()) {
+        console->report_error(error(error::sev_error, filename, L"NO_START_SYMBOLS", L"Could not determine a start symbol for the language", position(-1, -1, -1)));
+        return NULL;
+    }
+    
+    // Build the grammars and NDFAs
+    language_builder_stage builderStage(console, filename, &importStage);
+    builderStage.compile();
+    if (console->exit_code()) return NULL;
+    
+    language_stage* languageStage = builderStage.language_with_name(buildLanguageName);
+    if (!languageStage) {
+        wstringstream msg;
+        msg << L"Could not find the target language '" << buildLanguageName << L"'";
+        console->report_error(error(error::sev_error, filename, L"MISSING_TARGET_LANGUAGE", msg.str(), position(-1, -1, -1)));
+        return NULL;
+    }
+    
+    // Build the lexer and the parser
+    wstring languageFile = importStage.file_with_language(buildLanguageName);
+    
+    lexer_stage lexerStage(console, languageFile, languageStage);
+    lexerStage.compile();
+    if (console->exit_code() || !lexerStage.dfa()) return NULL;
+    
+    lr_parser_stage parserStage(console, languageFile, languageStage, &lexerStage, buildStartSymbols);
+    parserStage.compile();
+    if (console->exit_code() || !parserStage.get_tables()) return NULL;
+    
+    // The stages own what they've built, so the result gets its own copy that doesn't depend on them
+    lexer* compiledLexer = lexerStage.keywords().empty() ? new lexer(*lexerStage.dfa()) : new lexer(*lexerStage.dfa(), lexerStage.keywords());
+    
+    // Parsers switch between the lexer modes if there are any (see lexer_mode_table)
+    vector<int> terminalModes;
+    if (languageStage->lexer()->count_modes() > 1) {
+        terminalModes = languageStage->lexer()->symbol_modes(languageStage->terminals()->count_symbols());
+    }
+    
+    return new compiled_language(compiledLexer, new parser_tables(*parserStage.get_tables()), true, terminalModes);
+}
+
+#if __cplusplus >= 201103L
+
+/// \brief Compiles a language as for compile_language, returning a shareable handle
+language_compiler::language_ptr language_compiler::compile_shared(console_container& console, const std::wstring& filename, const std::wstring& definitionText, const std::wstring& languageName, const std::vector<std::wstring>& startSymbols) {
+    return language_ptr(compile_language(console, filename, definitionText, languageName, startSymbols));
+}
+
+/// \brief Compiles a language on a background thread, returning a future that will contain the result of compile_shared
+future<language_compiler::language_ptr> language_compiler::compile_in_background(console& console, const std::wstring& filename, const std::wstring& definitionText, const std::wstring& languageName, const std::vector<std::wstring>& startSymbols) {
+    // The container is created on the background thread, so its reference count is never shared with this one
+    compiler::console* target = &console;
+    
+    return async(launch::async, [target, filename, definitionText, languageName, startSymbols]() {
+        console_container cons(target, false);
+        return compile_shared(cons, filename, definitionText, languageName, startSymbols);
+    });
+}
+
+/// \brief Creates a handle with no language
+live_language::live_language() {
+}
+
+/// \brief Creates a handle for the specified language
+live_language::live_language(const language_compiler::language_ptr& language)
+: m_Current(language) {
+}
+
+/// \brief The current version of the language (which may be empty)
+language_compiler::language_ptr live_language::current() const {
+    return atomic_load(&m_Current);
+}
+
+/// \brief Replaces the language that new sessions will use, returning the previous version
+language_compiler::language_ptr live_language::replace(const language_compiler::language_ptr& newLanguage) {
+    return atomic_exchange(&m_Current, newLanguage);
+}
+
+#endif
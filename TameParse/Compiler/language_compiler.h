@@ -0,0 +1,111 @@
+//
+//  language_compiler.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _COMPILER_LANGUAGE_COMPILER_H
+#define _COMPILER_LANGUAGE_COMPILER_H
+
+#include <string>
+#include <vector>
+
+#if __cplusplus >= 201103L
+#include <future>
+#include <memory>
+#endif
+
+#include "TameParse/Compiler/console.h"
+#include "TameParse/Lr/compiled_language.h"
+
+namespace compiler {
+    ///
+    /// \brief Compiles language definitions into lexers and parsers that can be used at runtime
+    ///
+    /// This runs the same stages as the parser generator does before it writes out its output: the definition is parsed, 
+    /// its imports are loaded, and the lexer and parser tables are built for one of its languages. Errors are reported 
+    /// to the supplied console, in the same way as they are by the parser generator.
+    ///
+    class language_compiler {
+    public:
+#if __cplusplus >= 201103L
+        /// \brief Handle to a compiled language that can be shared between threads
+        typedef std::shared_ptr<const lr::compiled_language> language_ptr;
+#endif
+        
+    public:
+        /// \brief Compiles a language from the definition in the specified text, returning NULL if it can't be compiled
+        ///
+        /// The filename is used when reporting errors and to find any imported files. If languageName is empty, then
+        /// the language is taken from the parser block in the definition, or is the only language in the definition.
+        /// If startSymbols is empty then the start symbols are also taken from the parser block. The result is NULL if
+        /// the console reports an error, so the console should not already have an error when this is called.
+        ///
+        /// The caller should delete the result once it has finished with it.
+        static lr::compiled_language* compile_language(console_container& console, const std::wstring& filename, const std::wstring& definitionText, const std::wstring& languageName = std::wstring(), const std::vector<std::wstring>& startSymbols = std::vector<std::wstring>());
+        
+#if __cplusplus >= 201103L
+        /// \brief Compiles a language as for compile_language, returning a shareable handle (which is empty if the language can't be compiled)
+        static language_ptr compile_shared(console_container& console, const std::wstring& filename, const std::wstring& definitionText, const std::wstring& languageName = std::wstring(), const std::vector<std::wstring>& startSymbols = std::vector<std::wstring>());
+        
+        /// \brief Compiles a language on a background thread, returning a future that will contain the result of compile_shared
+        ///
+        /// Errors are reported to the supplied console from the background thread, so it must not be used by any other
+        /// thread and must not be destroyed until the result is ready.
+        static std::future<language_ptr> compile_in_background(console& console, const std::wstring& filename, const std::wstring& definitionText, const std::wstring& languageName = std::wstring(), const std::vector<std::wstring>& startSymbols = std::vector<std::wstring>());
+#endif
+    };
+    
+#if __cplusplus >= 201103L
+    ///
+    /// \brief Handle to the current version of a language, which can be replaced while parsers are using it
+    ///
+    /// Each parse session should call current() once when it starts and keep the result until it has finished: 
+    /// replacing the language has no effect on sessions that are already running, and the old version is destroyed
+    /// once the last of them has finished. Neither operation waits for the sessions or for any compilation.
+    ///
+    class live_language {
+    private:
+        /// \brief The current version of the language (only accessed atomically)
+        language_compiler::language_ptr m_Current;
+        
+        live_language(const live_language& copyFrom);
+        live_language& operator=(const live_language& copyFrom);
+        
+    public:
+        /// \brief Creates a handle with no language
+        live_language();
+        
+        /// \brief Creates a handle for the specified language
+        explicit live_language(const language_compiler::language_ptr& language);
+        
+        /// \brief The current version of the language (which may be empty)
+        language_compiler::language_ptr current() const;
+        
+        /// \brief Replaces the language that new sessions will use, returning the previous version
+        language_compiler::language_ptr replace(const language_compiler::language_ptr& newLanguage);
+    };
+#endif
+}
+
+#endif
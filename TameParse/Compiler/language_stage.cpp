@@ -29,6 +29,7 @@
 
 #include "TameParse/Compiler/language_stage.h"
 #include "TameParse/Compiler/precedence_block_rewriter.h"
+#include "TameParse/ContextFree/alternative_inliner.h"
 #include "TameParse/Language/process.h"
 #include "TameParse/Language/formatter.h"
 
@@ -44,7 +45,8 @@ language_stage::language_stage(console_container& console, const std::wstring& f
 : compilation_stage(console, filename)
 , m_Language(block)
 , m_Import(importStage)
-, m_InheritsFrom(NULL) {
+, m_InheritsFrom(NULL)
+, m_BaseLanguage(NULL) {
 }
 
 /// \brief Destructor
@@ -59,6 +61,12 @@ language_stage::~language_stage() {
     if (m_InheritsFrom) {
         delete m_InheritsFrom;
     }
+    
+    // Destroy the stages for any embedded languages
+    for (map<wstring, language_stage*>::iterator embedded = m_EmbeddedLanguages.begin(); embedded != m_EmbeddedLanguages.end(); ++embedded) {
+        delete embedded->second;
+    }
+    m_EmbeddedLanguages.clear();
 }
 
 /// \brief Removes any terminal symbols used in the specified rule from the unused list
@@ -88,9 +96,14 @@ void language_stage::process_rule_symbols(const contextfree::rule& rule) {
 
 /// \brief Compiles the language, creating the dictionary of terminals, the lexer and the grammar
 void language_stage::compile() {
+    profile_scope profile(cons(), L"language", filename(), m_Language->identifier());
+    
 #ifndef TAMEPARSE_BOOTSTRAP
     // If this language inherits from another, then try to import it and if it exists, compile it first
-    if (!m_Language->inherits().empty()) {
+    if (!m_Language->inherits().empty() && m_BaseLanguage) {
+        // Build on the results of the stage that has already compiled the inherited language
+        m_BaseLanguage->export_to(this);
+    } else if (!m_Language->inherits().empty()) {
         // The language block supports multiple items to inherit from, but this stage will only compile the first one
         const wstring& inheritFrom = m_Language->inherits().front();
 
@@ -245,6 +258,9 @@ void language_stage::compile() {
                 // Process only the block types that belong in this pass
                 if (blockType != *thisType || lex->is_weak() != isWeak) continue;
                 
+                // Find the lexer mode that these symbols are matched in
+                int mode = m_Lexer.add_mode(lex->mode());
+                
                 // Add the symbols to the lexer
                 for (lexer_block::iterator lexerItem = lex->begin(); lexerItem != lex->end(); ++lexerItem) {
                     // Get the ID that we'll define for this symbol
@@ -325,14 +341,14 @@ void language_stage::compile() {
                             wstring withoutSlashes = (*lexerItem)->definition().substr(1, (*lexerItem)->definition().size()-2);
                             
                             // Add to the lexer
-                            m_Lexer.add_definition((*lexerItem)->identifier(), lexer_item(lexer_item::regex, withoutSlashes, ci, cs, symId, blockType, isWeak, ourFilename, (*lexerItem)->definition_pos()));
+                            m_Lexer.add_definition((*lexerItem)->identifier(), lexer_item(lexer_item::regex, withoutSlashes, ci, cs, symId, blockType, isWeak, ourFilename, (*lexerItem)->definition_pos(), mode));
                             break;
                         }
                             
                         case lexeme_definition::literal:
                         {
                             // Add as a literal to the lexer
-                            m_Lexer.add_definition((*lexerItem)->identifier(), lexer_item(lexer_item::literal, (*lexerItem)->identifier(), ci, cs, symId, blockType, isWeak, ourFilename, (*lexerItem)->definition_pos()));
+                            m_Lexer.add_definition((*lexerItem)->identifier(), lexer_item(lexer_item::literal, (*lexerItem)->identifier(), ci, cs, symId, blockType, isWeak, ourFilename, (*lexerItem)->definition_pos(), mode));
                             break;
                         }
 
@@ -342,7 +358,7 @@ void language_stage::compile() {
                             // Add as a literal to the lexer
                             // We can do both characters and strings here (dequote_string will work on both kinds of item)
                             wstring dequoted = process::dequote_string((*lexerItem)->definition());
-                            m_Lexer.add_definition((*lexerItem)->identifier(), lexer_item(lexer_item::literal, dequoted, ci, cs, symId, blockType, isWeak, ourFilename, (*lexerItem)->definition_pos()));
+                            m_Lexer.add_definition((*lexerItem)->identifier(), lexer_item(lexer_item::literal, dequoted, ci, cs, symId, blockType, isWeak, ourFilename, (*lexerItem)->definition_pos(), mode));
                             break;
                         }
 
@@ -536,6 +552,11 @@ void language_stage::compile() {
         }
     }
 
+    // Inline alternatives if requested: this gives the parser fewer reductions to perform, in exchange for more rules
+    if (!cons().get_option(L"inline-alternatives").empty()) {
+        inline_alternatives();
+    }
+    
     // Display a summary of what the grammar and lexer contains if we're in verbose mode
     wostream& summary = cons().verbose_stream();
     
@@ -544,6 +565,46 @@ void language_stage::compile() {
     summary << L"          ... which are implicitly defined: " << implicitCount << endl;
     summary << L"          ... which are ignored:            " << (int)m_IgnoredSymbols.size() << endl;
     summary << L"    Number of nonterminals:                 " << m_Grammar.max_item_identifier() << endl;
+    
+    profile->add_counter(L"terminals", m_Terminals.count_symbols());
+    profile->add_counter(L"weak_terminals", (long) m_WeakSymbols.size());
+    profile->add_counter(L"ignored_terminals", (long) m_IgnoredSymbols.size());
+    profile->add_counter(L"nonterminals", m_Grammar.max_item_identifier());
+    profile->add_counter(L"rules", m_Grammar.max_rule_identifier());
+}
+
+/// \brief Replaces the alternative items in the rules of the grammar with the rules they contain
+void language_stage::inline_alternatives() {
+    alternative_inliner inliner;
+    int                 numItems = m_Grammar.max_item_identifier();
+    
+    for (int itemId = 0; itemId < numItems; ++itemId) {
+        if (m_Grammar.item_with_identifier(itemId)->type() != item::nonterminal) continue;
+        
+        rule_list&  rules = m_Grammar.rules_for_nonterminal(itemId);
+        rule_list   inlined;
+        
+        for (rule_list::const_iterator sourceRule = rules.begin(); sourceRule != rules.end(); ++sourceRule) {
+            size_t firstNew = inlined.size();
+            inliner.inline_rule(*sourceRule, inlined);
+            
+            // The new rules are defined in the same place as the rule they were generated from
+            symbol_map::const_iterator definition = m_RuleDefinition.find((*sourceRule)->identifier(m_Grammar));
+            if (definition == m_RuleDefinition.end()) continue;
+            
+            block_file definedAt = definition->second;
+            for (size_t newRule = firstNew; newRule < inlined.size(); ++newRule) {
+                m_RuleDefinition[inlined[newRule]->identifier(m_Grammar)] = definedAt;
+            }
+        }
+        
+        rules.swap(inlined);
+    }
+    
+    // The cached FIRST and FOLLOW sets refer to the old rules
+    m_Grammar.clear_caches();
+    
+    cons().verbose_stream() << L"    Number of alternatives inlined:         " << inliner.count_inlined() << endl;
 }
 
 /// \brief Reports which terminal symbols are unused in this language (and any languages that it inherits from)
@@ -593,8 +654,9 @@ int language_stage::add_ebnf_lexer_items(language::ebnf_item* item) {
             
         case ebnf_item::ebnf_terminal:
         {
-            // Nothing to do if this item is from another language
+            // Items from another language are matched in a lexer mode for that language
             if (item->source_identifier().size() > 0) {
+                count += add_embedded_terminal(item, ourFilename);
                 break;
             }
             
@@ -628,6 +690,12 @@ int language_stage::add_ebnf_lexer_items(language::ebnf_item* item) {
         case ebnf_item::ebnf_terminal_character:
         case ebnf_item::ebnf_terminal_string:
         {
+            // Items from another language are matched in a lexer mode for that language
+            if (item->source_identifier().size() > 0) {
+                count += add_embedded_terminal(item, ourFilename);
+                break;
+            }
+            
             // Strings and characters always create a new definition in the lexer if they don't already exist
             if (m_Terminals.symbol_for_name(item->identifier()) >= 0) {
                 // Already defined in the lexer
@@ -660,6 +728,134 @@ int language_stage::add_ebnf_lexer_items(language::ebnf_item* item) {
     return count;
 }
 
+/// \brief Adds the lexer symbols of another language to this one, in a lexer mode with the same name as that language
+const language_stage* language_stage::embed_language(const wstring& languageName, ebnf_item* usedBy) {
+    // Each language only needs to be embedded once
+    map<wstring, language_stage*>::iterator existing = m_EmbeddedLanguages.find(languageName);
+    if (existing != m_EmbeddedLanguages.end()) {
+        return existing->second;
+    }
+    
+#ifndef TAMEPARSE_BOOTSTRAP
+    const language_block* embedBlock = m_Import->language_with_name(languageName);
+    
+    if (!embedBlock || embedBlock == m_Language) {
+        wstringstream msg;
+        if (!embedBlock) {
+            msg << L"Unable to find language '" << languageName << "'";
+        } else {
+            msg << L"A language cannot use its own terminals through its name: " << languageName;
+        }
+        cons().report_error(error(error::sev_error, filename(), L"CANT_FIND_LANGUAGE", msg.str(), usedBy->start_pos()));
+        
+        // Only report the error once
+        m_EmbeddedLanguages[languageName] = NULL;
+        return NULL;
+    }
+    
+    // Compile the other language
+    console_container   consCopy(cons_container());
+    language_stage*     embedded = new language_stage(consCopy, m_Import->file_with_language(languageName), embedBlock, m_Import);
+    
+    m_EmbeddedLanguages[languageName] = embedded;
+    embedded->compile();
+    
+    const lexer_data* embeddedLexer = embedded->lexer();
+    
+    // Its expressions can be used by its symbols (expressions with the same name in this language take precedence)
+    for (lexer_data::iterator expression = embeddedLexer->begin_expr(); expression != embeddedLexer->end_expr(); ++expression) {
+        if (!m_Lexer.get_expressions(expression->first).empty()) continue;
+        
+        for (lexer_data::item_list::const_iterator item = expression->second.begin(); item != expression->second.end(); ++item) {
+            m_Lexer.add_expression(expression->first, *item);
+        }
+    }
+    
+    // Add the symbols in the order of their IDs in the other language, so they keep the same priorities relative to each other
+    map<int, lexer_data::iterator> symbolOrder;
+    for (lexer_data::iterator definition = embeddedLexer->begin(); definition != embeddedLexer->end(); ++definition) {
+        if (definition->second.empty()) continue;
+        symbolOrder[definition->second.front().symbol] = definition;
+    }
+    
+    for (map<int, lexer_data::iterator>::const_iterator symbol = symbolOrder.begin(); symbol != symbolOrder.end(); ++symbol) {
+        const wstring&                  name        = symbol->second->first;
+        const lexer_data::item_list&    items       = symbol->second->second;
+        wstring                         qualified   = languageName + L"." + name;
+        int                             embeddedId  = symbol->first;
+        
+        // A language that this one inherits from may already have added this symbol
+        if (m_Terminals.symbol_for_name(qualified) >= 0) continue;
+        
+        int symId = m_Terminals.add_symbol(qualified);
+        
+        for (lexer_data::item_list::const_iterator item = items.begin(); item != items.end(); ++item) {
+            lexer_item embeddedItem(*item);
+            
+            embeddedItem.symbol = symId;
+            embeddedItem.mode   = m_Lexer.add_mode(item->mode == 0 ? languageName : languageName + L"." + embeddedLexer->mode_name(item->mode));
+            
+            m_Lexer.add_definition(qualified, embeddedItem);
+        }
+        
+        // Copy the information about the symbol
+        m_TypeForTerminal[symId] = items.front().definition_type;
+        
+        if (embedded->m_WeakSymbols.find(embeddedId) != embedded->m_WeakSymbols.end()) {
+            m_WeakSymbols.insert(symId);
+        }
+        if (embedded->m_IgnoredSymbols.find(embeddedId) != embedded->m_IgnoredSymbols.end()) {
+            m_IgnoredSymbols.insert(symId);
+        }
+        
+        symbol_map::const_iterator definedAt = embedded->m_TerminalDefinition.find(embeddedId);
+        if (definedAt != embedded->m_TerminalDefinition.end()) {
+            m_TerminalDefinition[symId] = definedAt->second;
+        }
+    }
+    
+    return embedded;
+#else
+    // Importing not supported in the bootstrapper
+    cons().report_error(error(error::sev_error, filename(), L"CANT_EMBED_WHEN_BOOTSTRAPPING", L"Terminals from other languages are not supported in the bootstrapper", usedBy->start_pos()));
+    
+    m_EmbeddedLanguages[languageName] = NULL;
+    return NULL;
+#endif
+}
+
+/// \brief Defines a terminal item that refers to a symbol from another language (Language.terminal)
+int language_stage::add_embedded_terminal(ebnf_item* item, wstring* ourFilename) {
+    // Add the symbols from the other language
+    if (!embed_language(item->source_identifier(), item)) {
+        return 0;
+    }
+    
+    // Nothing to do if the symbol is defined by the other language
+    wstring qualified = item->source_identifier() + L"." + item->identifier();
+    if (m_Terminals.symbol_for_name(qualified) >= 0) {
+        return 0;
+    }
+    
+    // Named terminals must be defined by the other language
+    if (item->get_type() == ebnf_item::ebnf_terminal) {
+        wstringstream msg;
+        msg << L"Language '" << item->source_identifier() << L"' does not define the terminal: " << item->identifier();
+        cons().report_error(error(error::sev_error, filename(), L"MISSING_EMBEDDED_TERMINAL", msg.str(), item->start_pos()));
+        return 0;
+    }
+    
+    // Strings and characters that the other language doesn't use are defined in its mode, as it would define them
+    int     symId   = m_Terminals.add_symbol(qualified);
+    wstring dequote = process::dequote_string(item->identifier());
+    
+    m_Lexer.add_definition(qualified, lexer_item(lexer_item::literal, dequote, false, false, symId, language_unit::unit_keywords_definition, true, ourFilename, item->start_pos(), m_Lexer.add_mode(item->source_identifier())));
+    m_TypeForTerminal[symId] = language_unit::unit_keywords_definition;
+    m_WeakSymbols.insert(symId);
+    
+    return 1;
+}
+
 /// \brief Attaches attributes to the last item in the specified rule
 void language_stage::append_attribute(contextfree::rule& target, const rule_item_data::rule_attributes& attr) {
     // Nothing to do if this item has no attributes
@@ -684,7 +880,13 @@ void language_stage::compile_item(rule& rule, ebnf_item* item, wstring* ourFilen
         case ebnf_item::ebnf_terminal_string:
         {
             // Get the ID of this terminal. We can just use the identifier supplied in the item, as it will be unique
-            int terminalId = m_Terminals.symbol_for_name(item->identifier());
+            // (terminals from other languages are named after the language, see embed_language)
+            int terminalId;
+            if (item->source_identifier().empty()) {
+                terminalId = m_Terminals.symbol_for_name(item->identifier());
+            } else {
+                terminalId = m_Terminals.symbol_for_name(item->source_identifier() + L"." + item->identifier());
+            }
             
             // Add a new terminal item
             rule << item_container(new terminal(terminalId), true);
@@ -863,7 +1065,7 @@ template<class sm> static void copy_symbols(map<wstring, wstring*>& filenames, c
 }
 
 /// \brief Exports the results of this language stage into another
-void language_stage::export_to(language_stage* target) {
+void language_stage::export_to(language_stage* target) const {
     // Copy the items that can be simply copied
     target->m_Terminals             = m_Terminals;
     target->m_Lexer                 = m_Lexer;
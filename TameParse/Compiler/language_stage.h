@@ -81,6 +81,12 @@ namespace compiler {
         /// \brief Null, or the language stage that this inherits from
         language_stage* m_InheritsFrom;
         
+        /// \brief Null, or an already compiled stage for the language that this inherits from (not owned by this object)
+        const language_stage* m_BaseLanguage;
+        
+        /// \brief The stages for the languages whose lexers are used by this one, or NULL for languages that couldn't be found
+        std::map<std::wstring, language_stage*> m_EmbeddedLanguages;
+        
         /// \brief The dictionary of terminals defined by the language
         contextfree::terminal_dictionary m_Terminals;
         
@@ -139,6 +145,13 @@ namespace compiler {
         /// \brief Destructor
         virtual ~language_stage();
         
+        /// \brief Sets an already compiled stage for the language that this one inherits from
+        ///
+        /// When this is set, compile() builds on a copy of the results of the base stage instead of compiling the
+        /// inherited language again. The copy shares reference-counted objects with the base stage, so the two stages
+        /// must not be used on separate threads at the same time.
+        inline void set_base_language(const language_stage* base) { m_BaseLanguage = base; }
+        
         /// \brief Compiles the language, creating the dictionary of terminals, the lexer and the grammar
         void compile();
 
@@ -150,6 +163,18 @@ namespace compiler {
         ///
         /// Returns the number of new items that were defined
         int add_ebnf_lexer_items(language::ebnf_item* item);
+        
+        /// \brief Adds the lexer symbols of another language to this one, in a lexer mode with the same name as that language
+        ///
+        /// This is done the first time that a terminal from the language (Language.terminal) is used in the grammar. The
+        /// symbols are named Language.terminal in this language, and any named modes of the other language become
+        /// modes called Language.mode. Returns NULL if the language can't be found.
+        const language_stage* embed_language(const std::wstring& languageName, language::ebnf_item* usedBy);
+        
+        /// \brief Defines a terminal item that refers to a symbol from another language (Language.terminal)
+        ///
+        /// Returns the number of new items that were defined
+        int add_embedded_terminal(language::ebnf_item* item, std::wstring* ourFilename);
 
         /// \brief Compiles an EBNF item from the language into a context-free grammar item onto the end of the specified rule
         ///
@@ -166,7 +191,15 @@ namespace compiler {
         /// the m_UsedIgnoredSymbols set.
         void process_rule_symbols(const contextfree::rule& rule);
         
+        /// \brief Replaces the alternative items in the rules of the grammar with the rules they contain
+        ///
+        /// This is done when the 'inline-alternatives' option is set; see contextfree::alternative_inliner.
+        void inline_alternatives();
+        
     public:
+        /// \brief The name of the language compiled by this stage
+        inline const std::wstring& language_name() const                    { return m_Language->identifier(); }
+        
         /// \brief The grammar generated by this stage
         inline const contextfree::grammar* grammar() const                  { return &m_Grammar; }
 
@@ -269,7 +302,7 @@ namespace compiler {
         /// of this object into the target object (making them identical). The 
         /// target object can then compile the differences to create the final 
         /// language.
-        void export_to(language_stage* target);
+        void export_to(language_stage* target) const;
     };
 }
 
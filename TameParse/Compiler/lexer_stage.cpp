@@ -31,6 +31,8 @@
 
 #include <sstream>
 #include "TameParse/Compiler/lexer_stage.h"
+#include "TameParse/Util/unicode.h"
+#include "TameParse/Util/stopwatch.h"
 
 using namespace std;
 using namespace dfa;
@@ -198,7 +200,8 @@ lexer_stage::lexer_stage(console_container& console, const std::wstring& filenam
 , m_Language(languageCompiler)
 , m_WeakSymbols(languageCompiler->grammar())
 , m_Dfa(NULL)
-, m_Lexer(NULL) {
+, m_Lexer(NULL)
+, m_GrammarGate(NULL) {
 }
 
 /// \brief Destroys the lexer compiler
@@ -268,15 +271,202 @@ void lexer_stage::check_regex(dfa::ndfa_regex* ndfa, const std::wstring& regex,
     }
 }
 
+/// \brief Returns the highest priority action in a list, or NULL if the list is empty
+static const accept_action* highest_action(const ndfa::accept_action_list& actions) {
+    if (actions.empty()) return NULL;
+    
+    const accept_action* highest = actions.front();
+    for (ndfa::accept_action_list::const_iterator action = actions.begin(); action != actions.end(); ++action) {
+        if (*highest < **action) {
+            highest = *action;
+        }
+    }
+    
+    return highest;
+}
+
+/// \brief Converts the text of a literal to the form that the keyword table stores it in
+static symbol_string keyword_text(const symbol_string& text, bool foldCase) {
+    if (!foldCase) return text;
+    
+    symbol_string result;
+    for (symbol_string::const_iterator symbol = text.begin(); symbol != text.end(); ++symbol) {
+        result += (symbol_string::value_type) keyword_table::fold(*symbol);
+    }
+    
+    return result;
+}
+
+/// \brief True if the keyword table matches exactly the same spellings of some case insensitive text as the NDFA does
+///
+/// The keyword table only folds ASCII letters, so this is false if the text contains any other symbol that has an
+/// upper or lower case equivalent.
+static bool keyword_table_can_fold(const symbol_string& text) {
+    util::unicode unicode;
+    
+    for (symbol_string::const_iterator symbol = text.begin(); symbol != text.end(); ++symbol) {
+        int         folded = keyword_table::fold(*symbol);
+        symbol_set  original(folded);
+        symbol_set  expected(folded);
+        
+        if (folded >= 'a' && folded <= 'z') expected |= symbol_set(folded - ('a' - 'A'));
+        
+        if ((original | unicode.to_lower(original) | unicode.to_upper(original)) != expected) return false;
+    }
+    
+    return true;
+}
+
+/// \brief Adds the literals that can be recognised with the keyword table to m_Keywords, and the remaining literals to the NDFA
+///
+/// A literal can be moved out of the DFA if, when its text is read from the initial state for its mode, the NDFA already
+/// accepts a symbol with a lower priority (typically an identifier). In this case adding the literal to the NDFA wouldn't
+/// change the length of any lexeme, only the symbol that's accepted when the text is exactly the literal, so the lexer
+/// can match the other symbol and look the text up afterwards. The text must not produce the same symbol in any other
+/// mode, as the keyword table doesn't know which mode the lexer is in.
+///
+/// Case insensitive literals are stored in lower case, and the keyword table folds lexemes to lower case to find them.
+/// These can only be moved if the NDFA doesn't distinguish between any of their spellings, and if no other literal has
+/// the same text when case is ignored (as otherwise the keyword table could choose a different literal to the NDFA).
+///
+/// This must be called after all of the other symbols have been added to the NDFA.
+void lexer_stage::add_keywords(ndfa_regex* ndfa, const vector<const lexer_item*>& literals, const vector<int>& modeStates) {
+    typedef pair<int, symbol_string>                    keyword_key;
+    typedef map<keyword_key, const lexer_item*>         keyword_map;
+    
+    keyword_map             keywords;
+    vector<const lexer_item*> remaining;
+    
+    // Count the literals with the same folded text as each case insensitive literal
+    map<symbol_string, int> foldedCount;
+    
+    for (vector<const lexer_item*>::const_iterator literal = literals.begin(); literal != literals.end(); ++literal) {
+        if ((*literal)->case_insensitive) {
+            foldedCount[keyword_text(ndfa_regex::convert((*literal)->definition), true)] = 0;
+        }
+    }
+    
+    if (!foldedCount.empty()) {
+        for (vector<const lexer_item*>::const_iterator literal = literals.begin(); literal != literals.end(); ++literal) {
+            map<symbol_string, int>::iterator found = foldedCount.find(keyword_text(ndfa_regex::convert((*literal)->definition), true));
+            if (found != foldedCount.end()) ++found->second;
+        }
+    }
+    
+    for (vector<const lexer_item*>::const_iterator literal = literals.begin(); literal != literals.end(); ++literal) {
+        const lexer_item*       item    = *literal;
+        symbol_string           text    = ndfa_regex::convert(item->definition);
+        language_accept_action  action(item->symbol, item->definition_type, item->is_weak);
+        
+        if (text.empty()) {
+            remaining.push_back(item);
+            continue;
+        }
+        
+        // Literals that are the same as a case insensitive literal apart from case must stay in the NDFA
+        map<symbol_string, int>::const_iterator folded = foldedCount.find(keyword_text(text, true));
+        if (folded != foldedCount.end() && folded->second > 1) {
+            remaining.push_back(item);
+            continue;
+        }
+        
+        if (item->case_insensitive && (!keyword_table_can_fold(text) || !ndfa->ignores_case(modeStates[item->mode], text.data(), text.data() + text.size()))) {
+            remaining.push_back(item);
+            continue;
+        }
+        
+        // Find the symbol that would be matched instead of this literal
+        ndfa::accept_action_list    actions;
+        ndfa->actions_for_string(modeStates[item->mode], text.data(), text.data() + text.size(), actions);
+        
+        const accept_action* base = highest_action(actions);
+        if (!base || !(*base < action)) {
+            remaining.push_back(item);
+            continue;
+        }
+        
+        // The text mustn't match the same symbol in any other mode
+        bool otherMode = false;
+        for (int mode = 0; mode < (int) modeStates.size() && !otherMode; ++mode) {
+            if (mode == item->mode) continue;
+            
+            // Only the spelling used in the literal is checked, so a case insensitive literal can't be moved if the case matters
+            if (item->case_insensitive && !ndfa->ignores_case(modeStates[mode], text.data(), text.data() + text.size())) {
+                otherMode = true;
+                break;
+            }
+            
+            ndfa::accept_action_list modeActions;
+            ndfa->actions_for_string(modeStates[mode], text.data(), text.data() + text.size(), modeActions);
+            
+            const accept_action* modeBase = highest_action(modeActions);
+            if (modeBase && modeBase->symbol() == base->symbol()) {
+                otherMode = true;
+            }
+        }
+        
+        if (otherMode) {
+            remaining.push_back(item);
+            continue;
+        }
+        
+        // If there's more than one literal with the same text, only the highest priority one can ever be generated
+        keyword_key             key(base->symbol(), keyword_text(text, item->case_insensitive));
+        keyword_map::iterator   existing = keywords.find(key);
+        
+        if (existing == keywords.end()) {
+            keywords[key] = item;
+        } else {
+            language_accept_action existingAction(existing->second->symbol, existing->second->definition_type, existing->second->is_weak);
+            if (existingAction < action) {
+                existing->second = item;
+            }
+        }
+    }
+    
+    // Build the keyword table
+    keyword_hash_table::keyword_list keywordList;
+    
+    for (keyword_map::const_iterator kw = keywords.begin(); kw != keywords.end(); ++kw) {
+        keyword_hash_table::keyword newKeyword;
+        
+        newKeyword.baseSymbol       = kw->first.first;
+        newKeyword.text.assign(kw->first.second.begin(), kw->first.second.end());
+        newKeyword.keywordSymbol    = kw->second->symbol;
+        newKeyword.foldCase         = kw->second->case_insensitive;
+        keywordList.push_back(newKeyword);
+        
+        // Weak keywords are equivalent to the symbol they replace (the DFA can't tell weak_symbols about this as they're not in it)
+        if (kw->second->is_weak) {
+            wait_for_grammar();
+            
+            item_set weak(m_Language->grammar());
+            weak.insert(item_container(new terminal(kw->second->symbol), true));
+            m_WeakSymbols.add_symbols(item_container(new terminal(kw->first.first), true), weak);
+        }
+    }
+    
+    m_Keywords = keyword_hash_table(keywordList);
+    
+    // Everything else goes in the NDFA as normal
+    for (vector<const lexer_item*>::const_iterator literal = remaining.begin(); literal != remaining.end(); ++literal) {
+        ndfa->set_case_insensitive((*literal)->case_insensitive);
+        ndfa->add_literal(modeStates[(*literal)->mode], (*literal)->definition, language_accept_action((*literal)->symbol, (*literal)->definition_type, (*literal)->is_weak));
+    }
+}
+
 /// \brief Compiles the lexer
 void lexer_stage::compile() {
+    profile_scope profile(cons(), L"lexer", filename(), m_Language->language_name());
+    
     // Grab the input
     const lexer_data*       lex             = m_Language->lexer();
     terminal_dictionary*    terminals       = m_Language->terminals();
     const set<int>*         weakSymbolIds   = m_Language->weak_symbols();
     
-    // Reset the weak symbols
-    m_WeakSymbols = lr::weak_symbols(m_Language->grammar());
+    // Reset the weak symbols and keywords
+    m_WeakSymbols   = lr::weak_symbols(m_Language->grammar());
+    m_Keywords      = keyword_hash_table();
     
     // Sanity check
     if (!lex || !terminals || !weakSymbolIds) {
@@ -290,13 +480,34 @@ void lexer_stage::compile() {
     // Create the ndfa
     typedef lexer_data::item_list item_list;
     ndfa_lexer_compiler*    stage0 = new ndfa_lexer_compiler(lex);
+    
+    // Characters outside the basic multilingual plane are matched as UTF-16 surrogate pairs unless they're disabled
+    if (!cons().get_option(L"no-surrogates").empty()) {
+        stage0->set_use_surrogates(false);
+    }
+    
+    // A UTF-8 lexer matches the bytes of the input rather than the characters, so it can read narrow streams directly
+    bool utf8 = !cons().get_option(L"utf8-lexer").empty();
+    stage0->set_use_utf8(utf8);
 
     ndfa::builder   ignoreBuilder   = stage0->get_cons();
+    ignoreBuilder.set_generate_utf8(utf8);
     bool            firstIgnore     = true;
     int             ignoreSymbol    = -1;
     const set<int>* usedIgnored     = m_Language->used_ignored_symbols();
+    
+    // Literals might be recognised with the keyword table instead of the DFA: these are added to the NDFA last
+    bool                        useKeywords = !cons().get_option(L"keyword-table").empty();
+    vector<const lexer_item*>   literals;
 
     ignoreBuilder.push();
+    
+    // Each lexer mode starts in a different initial state (the default mode uses the initial state of the NDFA)
+    vector<int> modeStates;
+    modeStates.push_back(0);
+    for (int mode = 1; mode < lex->count_modes(); ++mode) {
+        modeStates.push_back(stage0->add_state());
+    }
 
     // Iterate through all of the expressions defined in the language
     for (lexer_data::iterator itemList = lex->begin_expr(); itemList != lex->end_expr(); ++itemList) {
@@ -324,8 +535,9 @@ void lexer_stage::compile() {
             bool    blandIgnore = false;
 
             // We modify ignore symbols if they aren't used in the grammar so that they all map to a single place
-            // This may prove confusing if the user wishes to use the lexer independently
-            if (item->definition_type == language_unit::unit_ignore_definition) {
+            // This may prove confusing if the user wishes to use the lexer independently. Only symbols in the default
+            // mode are combined, as the combined symbol is matched in that mode.
+            if (item->definition_type == language_unit::unit_ignore_definition && item->mode == 0) {
                 // If this is an ignored item with no syntactic meaning, give it the same symbol ID as the first ignored item we encountered
                 if (usedIgnored->find(symbolId) == usedIgnored->end()) {
                     blandIgnore = true;
@@ -358,7 +570,7 @@ void lexer_stage::compile() {
                     } else {
                         // Add as a new symbol
                         stage0->set_case_insensitive(item->case_insensitive);
-                        stage0->add_regex(0, item->definition, language_accept_action(symbolId, item->definition_type, item->is_weak));
+                        stage0->add_regex(modeStates[item->mode], item->definition, language_accept_action(symbolId, item->definition_type, item->is_weak));
                     }
                     break;
 
@@ -374,9 +586,12 @@ void lexer_stage::compile() {
                         ignoreBuilder.pop();
 
                         firstIgnore = false;
+                    } else if (useKeywords && item->definition_type != language_unit::unit_ignore_definition) {
+                        // Decide whether or not this is a keyword once everything else is in the NDFA
+                        literals.push_back(&*item);
                     } else {
                         stage0->set_case_insensitive(item->case_insensitive);
-                        stage0->add_literal(0, item->definition, language_accept_action(symbolId, item->definition_type, item->is_weak));
+                        stage0->add_literal(modeStates[item->mode], item->definition, language_accept_action(symbolId, item->definition_type, item->is_weak));
                     }
                     break;
             }
@@ -402,12 +617,23 @@ void lexer_stage::compile() {
         // Set the symbol
         ignoreBuilder >> language_accept_action(ignoreSymbol, language_unit::unit_ignore_definition, false);
     }
+    
+    // Move as many literals as possible into the keyword table
+    if (useKeywords) {
+        add_keywords(stage0, literals, modeStates);
+        
+        cons().verbose_stream() << L"    Number of keywords in the table:         " << m_Keywords.count_keywords() << endl;
+        profile->add_counter(L"keywords", m_Keywords.count_keywords());
+    }
 
     // Write out some stats about the ndfa
     cons().verbose_stream() << L"    Number states in the NDFA:              " << stage0->count_states() << endl;
+    profile->add_counter(L"ndfa_states", stage0->count_states());
     
     // Compile the NDFA to a NDFA without overlapping symbol sets
-    dfa::ndfa* stage1 = stage0->to_ndfa_with_unique_symbols();
+    util::stopwatch uniqueTimer;
+    dfa::ndfa*      stage1 = stage0->to_ndfa_with_unique_symbols();
+    profile->add_timing(L"phase.unique_symbols", uniqueTimer.seconds());
     
     if (!stage1) {
         cons().report_error(error(error::sev_bug, filename(), L"BUG_DFA_FAILED_TO_CONVERT", L"Failed to create an NDFA with unique symbols", position(-1, -1, -1)));
@@ -417,15 +643,41 @@ void lexer_stage::compile() {
     // Write some information about the first stage
     cons().verbose_stream() << L"    Initial number of character sets:       " << stage0->symbols().count_sets() << endl;
     cons().verbose_stream() << L"    Final number of character sets:         " << stage1->symbols().count_sets() << endl;
+    profile->add_counter(L"initial_symbol_sets", stage0->symbols().count_sets());
+    profile->add_counter(L"unique_symbol_sets", stage1->symbols().count_sets());
 
     delete stage0;
     stage0 = NULL;
     
-    // Compile the NDFA to a DFA
-    dfa::ndfa* stage2 = stage1->to_dfa();
+    // Remove the states that only lead to another state via an epsilon transition
+    // The initial states for each mode become states 0, 1, 2, etc.
+    util::stopwatch epsilonTimer;
+    dfa::ndfa*      reduced = stage1->to_ndfa_without_epsilon_states(modeStates);
+    profile->add_timing(L"phase.remove_epsilon", epsilonTimer.seconds());
     delete stage1;
     stage1 = NULL;
     
+    vector<int> reducedModeStates;
+    for (int mode = 0; mode < (int) modeStates.size(); ++mode) {
+        reducedModeStates.push_back(mode);
+    }
+    
+    cons().verbose_stream() << L"    Number states without epsilon states:   " << reduced->count_states() << endl;
+    profile->add_counter(L"reduced_ndfa_states", reduced->count_states());
+    
+    // Compile the NDFA to a DFA
+    // The modes can be built on separate threads.
+    util::stopwatch dfaTimer;
+    dfa::ndfa*      stage2;
+    if (cons().get_option(L"parallel-lexer").empty()) {
+        stage2 = reduced->to_dfa(reducedModeStates);
+    } else {
+        stage2 = reduced->to_dfa(reducedModeStates, max_threads());
+    }
+    profile->add_timing(L"phase.subset_construction", dfaTimer.seconds());
+    delete reduced;
+    reduced = NULL;
+    
     if (!stage2) {
         cons().report_error(error(error::sev_bug, filename(), L"BUG_DFA_FAILED_TO_COMPILE", L"Failed to compile DFA", position(-1, -1, -1)));
         return;
@@ -463,6 +715,11 @@ void lexer_stage::compile() {
         unusedTerminals.erase(highest->symbol());
     }
     
+    // Keywords are generated by the keyword table rather than the DFA
+    for (int slot = 0; slot < m_Keywords.count_slots(); ++slot) {
+        unusedTerminals.erase(m_Keywords.get_slot(slot).keywordSymbol);
+    }
+    
     // Report warnings for any terminals that are never generated by the lexer
     for (set<int>::const_iterator unusedSymbol = unusedTerminals.begin(); unusedSymbol != unusedTerminals.end(); ++unusedSymbol) {
         // Don't report ignored symbols if they can never be generated
@@ -499,6 +756,8 @@ void lexer_stage::compile() {
     
     // Build up the weak symbols set if there are any
     if (weakSymbolIds->size() > 0) {
+        wait_for_grammar();
+        
         // Build up the weak symbol set as a series of items
         item_set weakSymSet(m_Language->grammar());
         
@@ -517,30 +776,43 @@ void lexer_stage::compile() {
         int finalSymCount = terminals->count_symbols();
         
         cons().verbose_stream() << L"    Number of extra weak symbols:           " << finalSymCount - initialSymCount << endl;
+        profile->add_counter(L"extra_weak_symbols", finalSymCount - initialSymCount);
     }
     
     // Compact the resulting DFA
     cons().verbose_stream() << L"    Number of states in the lexer DFA:      " << stage2->count_states() << endl;
+    profile->add_counter(L"dfa_states", stage2->count_states());
 
     dfa::ndfa* stage3;
 
     if (cons().get_option(L"disable-compact-dfa").empty()) {
-        stage3 = stage2->to_compact_dfa();
+        vector<int> dfaModeStates;
+        for (int mode = 0; mode < lex->count_modes(); ++mode) {
+            dfaModeStates.push_back(mode);
+        }
+        
+        util::stopwatch compactTimer;
+        stage3 = stage2->to_compact_dfa(dfaModeStates);
+        profile->add_timing(L"phase.compact_dfa", compactTimer.seconds());
         delete stage2;
         stage2 = NULL;
     
         // Write some information about the DFA we just produced
         cons().verbose_stream() << L"    Number of states in the compacted DFA:  " << stage3->count_states() << endl;
+        profile->add_counter(L"compact_dfa_states", stage3->count_states());
     } else {
         stage3 = stage2;
         stage2 = NULL;
     }
     
     // Eliminate any unnecessary symbol sets
-    dfa::ndfa* stage4;
+    dfa::ndfa*  stage4;
+    int         unmergedSets = stage3->symbols().count_sets();
     
     if (cons().get_option(L"disable-merged-dfa").empty()) {
+        util::stopwatch mergeTimer;
         stage4 = stage3->to_ndfa_with_merged_symbols();
+        profile->add_timing(L"phase.merge_symbols", mergeTimer.seconds());
         delete stage3;
         stage3 = NULL;
     } else {
@@ -550,13 +822,58 @@ void lexer_stage::compile() {
     
     // Write some information about the DFA we just produced
     cons().verbose_stream() << L"    Number of symbols in the compacted DFA: " << stage4->symbols().count_sets() << endl;
+    cons().verbose_stream() << L"    Symbol classes merged:                  " << unmergedSets - stage4->symbols().count_sets() << endl;
+    profile->add_counter(L"symbol_classes", stage4->symbols().count_sets());
+    profile->add_counter(L"merged_symbol_classes", unmergedSets - stage4->symbols().count_sets());
+    
+    // Put the states that lead to one another close together (the initial state for each mode keeps its ID)
+    if (cons().get_option(L"disable-state-layout").empty()) {
+        dfa::ndfa* ordered = stage4->to_ndfa_in_traversal_order(lex->count_modes());
+        delete stage4;
+        stage4 = ordered;
+    }
     
     m_Dfa = stage4;
     
+    // Report how large each way of storing the state machine would be
+    lexer_table_sizes tableSizes(*m_Dfa);
+    
+    cons().verbose_stream() << L"    Size of the symbol map:                 " << tableSizes.symbolMap << L" bytes" << endl;
+    profile->add_counter(L"symbol_map_bytes", (long) tableSizes.symbolMap);
+    
+    const lexer_table_sizes::table_style styles[] = { lexer_table_sizes::flat, lexer_table_sizes::comb, lexer_table_sizes::compact };
+    for (int styleNum = 0; styleNum < 3; ++styleNum) {
+        lexer_table_sizes::table_style style = styles[styleNum];
+        
+        // Line up the sizes with the other statistics
+        wstringstream label;
+        label << L"    Size of the " << lexer_table_sizes::name(style) << L" table:";
+        label << wstring(44 - label.str().size(), L' ');
+        
+        // Flat tables can't be used if there are too many states
+        if (style == lexer_table_sizes::flat && tableSizes.flatTable == 0) {
+            cons().verbose_stream() << label.str() << L"(too many states)" << endl;
+            continue;
+        }
+        
+        cons().verbose_stream() << label.str() << tableSizes.table_size(style) << L" bytes (" << tableSizes.cache_lines(style) << L" cache lines)" << endl;
+        
+        wstringstream counter;
+        counter << lexer_table_sizes::name(style) << L"_table_bytes";
+        profile->add_counter(counter.str(), (long) tableSizes.table_size(style));
+    }
+    
+    cons().verbose_stream() << L"    Preferred table style:                  " << lexer_table_sizes::name(tableSizes.preferred()) << endl;
+    
     // Build the final lexer
-    m_Lexer = new lexer(*m_Dfa);
+    if (m_Keywords.empty()) {
+        m_Lexer = new lexer(*m_Dfa);
+    } else {
+        m_Lexer = new lexer(*m_Dfa, m_Keywords);
+    }
     
     // Write some parting words
     // (Well, this is really kibibytes but I can't take blibblebytes seriously as a unit of measurement)
     cons().verbose_stream() << L"    Approximate size of final lexer:        " << (m_Lexer->size() + 512) / 1024 << L" kilobytes" << endl;
+    profile->add_counter(L"lexer_bytes", (long) m_Lexer->size());
 }
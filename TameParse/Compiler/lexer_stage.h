@@ -33,9 +33,11 @@
 #include "TameParse/Compiler/language_stage.h"
 #include "TameParse/Dfa/ndfa_regex.h"
 #include "TameParse/Dfa/lexer.h"
+#include "TameParse/Dfa/keyword_table.h"
 #include "TameParse/ContextFree/terminal_dictionary.h"
 #include "TameParse/Compiler/compilation_stage.h"
 #include "TameParse/Lr/weak_symbols.h"
+#include "TameParse/Util/parallel.h"
 
 namespace compiler {
     ///
@@ -55,6 +57,12 @@ namespace compiler {
         /// \brief The weak symbols object
         lr::weak_symbols m_WeakSymbols;
         
+        /// \brief The literals that are recognised by looking up the text of the lexemes matched by the DFA
+        dfa::keyword_hash_table m_Keywords;
+        
+        /// \brief A gate to wait at before changing the grammar or the terminal dictionary of the language, or NULL
+        util::gate* m_GrammarGate;
+        
     public:
         /// \brief Creates a new lexer compiler
         ///
@@ -68,14 +76,30 @@ namespace compiler {
         
         /// \brief Compiles the lexer (the language compiler must have completed its work by this point)
         void compile();
+        
+        /// \brief Sets a gate that this stage waits at before it changes the grammar or the terminals of the language
+        ///
+        /// Weak symbols are added to the grammar and can create new terminals, but everything else that compile() does
+        /// only reads the language. Another stage that reads the grammar (building the parser states, say) can run at
+        /// the same time as this one if it opens the gate once it has finished with it. Pass NULL to never wait.
+        inline void set_grammar_gate(util::gate* gate) { m_GrammarGate = gate; }
 
     private:
+        /// \brief Waits for the grammar gate to open, if there is one
+        inline void wait_for_grammar() { if (m_GrammarGate) m_GrammarGate->wait(); }
+        
         /// \brief Reports any errors that might have occurred in the specified regular expression
         void check_regex(dfa::ndfa_regex* ndfa, const std::wstring& regex, const std::wstring* filename, const dfa::position& pos);
+        
+        /// \brief Adds the literals that can be recognised with the keyword table to m_Keywords, and the remaining literals to the NDFA
+        void add_keywords(dfa::ndfa_regex* ndfa, const std::vector<const lexer_item*>& literals, const std::vector<int>& modeStates);
 
     public:
         /// \brief The DFA generated by this stage
         inline const dfa::ndfa* dfa() const { return m_Dfa; }
+        
+        /// \brief The keywords that the lexer recognises after the DFA has matched a lexeme (empty unless the keyword-table option is set)
+        inline const dfa::keyword_hash_table& keywords() const { return m_Keywords; }
 
         /// \brief The weak symbols action rewriter generated by this stage
         inline const lr::weak_symbols* weak_symbols() const { return &m_WeakSymbols; }
@@ -32,6 +32,8 @@
 #include "TameParse/Language/formatter.h"
 #include "TameParse/Lr/ast_parser.h"
 #include "TameParse/Lr/lr1_rewriter.h"
+#include "TameParse/Lr/unit_rule_rewriter.h"
+#include "TameParse/Lr/guard_resolver.h"
 #include "TameParse/Compiler/conflict_attribute_rewriter.h"
 
 using namespace std;
@@ -49,7 +51,11 @@ lr_parser_stage::lr_parser_stage(console_container& console, const std::wstring&
 , m_StartSymbols(startSymbols)
 , m_StartPosition(position(-1,-1,-1))
 , m_Parser(NULL)
-, m_Tables(NULL) {
+, m_Tables(NULL)
+, m_PreviousParser(NULL)
+, m_PruneGrammar(false)
+, m_StatesSeconds(0)
+, m_PropagationCount(0) {
     // Add empty positions for each symbol
     for (size_t x=0; x<m_StartSymbols.size(); ++x) {
         m_SymbolStartPosition.push_back(position(-1,-1,-1));
@@ -64,7 +70,11 @@ lr_parser_stage::lr_parser_stage(console_container& console, const std::wstring&
 , m_StartPosition(parserBlock->start_pos())
 , m_StartSymbols(parserBlock->start_symbols())
 , m_Parser(NULL)
-, m_Tables(NULL) {
+, m_Tables(NULL)
+, m_PreviousParser(NULL)
+, m_PruneGrammar(false)
+, m_StatesSeconds(0)
+, m_PropagationCount(0) {
     // Make all the symbols begin in the same place as this block
     // TODO: actually record where the symbols are specified
     for (size_t x=0; x<m_StartSymbols.size(); ++x) {
@@ -102,18 +112,19 @@ static void warn_clashing_guards(console& cons, const language_stage* language,
         typedef map<item_container, set<item_container> > guard_to_symbol;
         guard_to_symbol guardForSymbol;
 
-        // Search for guard actions 
-        const lr_action_set& actions = builder->actions_for_state(stateId);
+        // Search for guard actions (using the compact actions, which are all that is kept in low memory mode)
+        compact_action_list actions;
+        builder->compact_actions_for_state(stateId, actions);
 
-        for (lr_action_set::const_iterator nextAction = actions.begin(); nextAction != actions.end(); ++nextAction) {
+        for (compact_action_list::const_iterator nextAction = actions.begin(); nextAction != actions.end(); ++nextAction) {
             // Ignore actions that are not guard actions
-            if ((*nextAction)->type() != lr_action::act_guard) continue;
+            if (nextAction->type != lr_action::act_guard) continue;
 
             // Ignore the action if it's not on a terminal symbol
-            if ((*nextAction)->item()->type() != item::terminal) continue;
+            if (!nextAction->is_terminal()) continue;
 
             // The guard item is the nonterminal of the action rule
-            guardForSymbol[(*nextAction)->item()].insert((*nextAction)->rule()->nonterminal());
+            guardForSymbol[nextAction->item(builder->gram())].insert(builder->gram().rule_with_identifier(nextAction->rule)->nonterminal());
         }
 
         // Warn of any guards that have conflicting actions
@@ -213,8 +224,16 @@ static void warn_clashing_guards(console& cons, const language_stage* language,
 
 /// \brief Compiles the parser specified by the parameters to this stage
 void lr_parser_stage::compile() {
+    if (build_states()) {
+        build_tables();
+    }
+}
+
+/// \brief Builds the states of the parser and their lookaheads, returning false if this failed
+bool lr_parser_stage::build_states() {
     // Verbose message to say which stage we're at
     cons().verbose_stream() << L"  = Building parser" << endl;
+    util::stopwatch timer;
 
     // Recycle the parser generator if it already exists
     if (m_Parser) {
@@ -230,22 +249,22 @@ void lr_parser_stage::compile() {
     // Sanity check (language)
     if (!m_Language) {
         cons().report_error(error(error::sev_bug, filename(), L"BUG_NO_LANGUAGE", L"Language compiler stage was not supplied to parser stage", m_StartPosition));
-        return;
+        return false;
     }
 
     if (!m_Language->lexer()) {
         cons().report_error(error(error::sev_bug, filename(), L"BUG_NO_LANGUAGE_LEXER", L"Language compiler stage has not generated a lexer", m_StartPosition));
-        return;
+        return false;
     }
 
     if (!m_Language->terminals()) {
         cons().report_error(error(error::sev_bug, filename(), L"BUG_NO_LANGUAGE_TERMINALS", L"Language compiler stage has not generated a terminal dictionary", m_StartPosition));      
-        return;
+        return false;
     }
 
     if (!m_Language->weak_symbols()) {
         cons().report_error(error(error::sev_bug, filename(), L"BUG_NO_LANGUAGE_WEAK_SYMBOLS", L"Language compiler stage has not the set of weak symbols", m_StartPosition));
-        return;
+        return false;
     }
 
     if (!m_Language->ignored_symbols()) {
@@ -254,27 +273,27 @@ void lr_parser_stage::compile() {
 
     if (!m_Language->grammar()) {
         cons().report_error(error(error::sev_bug, filename(), L"BUG_NO_LANGUAGE_GRAMMAR", L"Language compiler stage has not generated a grammar", m_StartPosition));        
-        return;
+        return false;
     }
 
-    // Sanity check (lexer)
+    // Sanity check (lexer: the weak symbols are only filled in once it has been compiled, which need not have
+    // happened yet)
     if (!m_LexerCompiler) {
         cons().report_error(error(error::sev_bug, filename(), L"BUG_NO_LEXER", L"Lexer compiler stage was not supplied to parser stage", m_StartPosition));
-        return;
-    }
-
-    if (!m_LexerCompiler->dfa()) {
-        cons().report_error(error(error::sev_bug, filename(), L"BUG_NO_LEXER_DFA", L"Lexer compiler stage has not generate a DFA", m_StartPosition));
-        return;
+        return false;
     }
 
     if (!m_LexerCompiler->weak_symbols()) {
         cons().report_error(error(error::sev_bug, filename(), L"BUG_NO_LEXER_DFA", L"Lexer compiler stage has not generate a weak symbols rewriter", m_StartPosition));
-        return;
+        return false;
     }
 
     // Create a new parser builder
     m_Parser = new lalr_builder(*m_Language->grammar(), *m_Language->terminals());
+    
+    if (!cons().get_option(L"minimal-lr1").empty()) {
+        m_Parser->set_construction_algorithm(lalr_builder::construct_minimal_lr1);
+    }
 
     // Get the nonterminal items corresponding to the start symbols
     vector<item_container> startItems;
@@ -300,7 +319,13 @@ void lr_parser_stage::compile() {
     // Give up if there are no symbols defined
     if (startItems.empty()) {
         cons().report_error(error(error::sev_error, filename(), L"NO_START_SYMBOLS", L"No start symbols are defined", m_StartPosition));
-        return;
+        return false;
+    }
+    
+    // Remove any rules that can't be used from these start symbols
+    if (m_PruneGrammar) {
+        int numPruned = m_Language->grammar()->prune(startItems);
+        cons().verbose_stream() << L"  = Removed " << numPruned << L" rules that can't be used from the start symbols" << endl;
     }
     
     // Generate the ignore actions
@@ -318,29 +343,89 @@ void lr_parser_stage::compile() {
         m_InitialStates.push_back(m_Parser->add_initial_state(*initialItem));
     }
 
-    // Add any language rewriters that might be defined
+    // Add any language rewriters that might be defined (the names are used when profiling how long each one takes)
     typedef language_stage::rewriter_list rewriter_list;
+    vector<wstring>& rewriterNames = m_RewriterNames;
+    rewriterNames.clear();
     for (rewriter_list::const_iterator languageRewriter = m_Language->action_rewriters()->begin(); languageRewriter != m_Language->action_rewriters()->end(); ++languageRewriter) {
+        wstringstream rewriterName;
+        rewriterName << L"rewriter.language_" << rewriterNames.size();
+        
         m_Parser->add_rewriter(*languageRewriter);
+        rewriterNames.push_back(rewriterName.str());
     }
     
     // Add the weak symbols and ignore items actions
     // TODO: it might be good to have a way to supply extra rewriters from other stages instead of just having them
     // hardcoded here. This is good enough for now, though.
     m_Parser->add_rewriter(action_rewriter_container(m_LexerCompiler->weak_symbols(), false));
+    rewriterNames.push_back(L"rewriter.weak_symbols");
     m_Parser->add_rewriter(action_rewriter_container(new conflict_attribute_rewriter(&m_Language->get_rule_item_data())));
+    rewriterNames.push_back(L"rewriter.conflict_attributes");
     if (!cons().get_option(L"enable-lr1-resolver").empty()) {
         m_Parser->add_rewriter(action_rewriter_container(new lr1_rewriter()));
+        rewriterNames.push_back(L"rewriter.lr1_resolver");
     }
     m_Parser->add_rewriter(ignoreContainer);
+    rewriterNames.push_back(L"rewriter.ignored_symbols");
+    if (!cons().get_option(L"eliminate-unit-rules").empty()) {
+        m_Parser->add_rewriter(action_rewriter_container(new unit_rule_rewriter()));
+        rewriterNames.push_back(L"rewriter.unit_rules");
+    }
+    if (!cons().get_option(L"resolve-guards").empty()) {
+        m_Parser->add_rewriter(action_rewriter_container(new guard_resolver()));
+        rewriterNames.push_back(L"rewriter.guards");
+    }
 
     // Build the parser
-    m_Parser->complete_parser();
+    if (m_PreviousParser) {
+        m_Parser->complete_parser(*m_PreviousParser, max_threads());
+        cons().verbose_stream() << L"  = Reused " << m_Parser->count_reused_states() << L" of " << m_Parser->count_states() << L" states from the previous parser" << endl;
+    } else {
+        m_Parser->complete_parser(max_threads());
+    }
+    
+    // In low memory mode, discard anything that isn't needed to build the tables as soon as possible
+    m_PropagationCount = m_Parser->count_propagations();
+    
+    if (!cons().get_option(L"low-memory").empty()) {
+        // Keep only the compact actions for each state once they've been generated
+        m_Parser->set_keep_actions(false);
+        
+        // The lookahead sources are only needed when describing conflicts or displaying the propagation tables
+        if (cons().get_option(L"show-conflict-details").empty() && cons().get_option(L"show-propagation").empty()) {
+            m_Parser->discard_lookahead_sources();
+        }
+    }
+    
+    // build_tables() adds this to its profile
+    m_StatesSeconds = timer.seconds();
+    return true;
+}
 
+/// \brief Finds the conflicts in the parser built by build_states() and builds its tables
+void lr_parser_stage::build_tables() {
+    profile_scope profile(cons(), L"lr_parser", filename(), m_Language ? m_Language->language_name() : wstring());
+    profile->add_seconds(m_StatesSeconds);
+    
+    // Nothing to do if the states weren't built
+    if (!m_Parser || !m_Language) return;
+    
+    // The lexer must have been compiled by now, as the actions depend on its weak symbols
+    if (!m_LexerCompiler || !m_LexerCompiler->dfa()) {
+        cons().report_error(error(error::sev_bug, filename(), L"BUG_NO_LEXER_DFA", L"Lexer compiler stage has not generate a DFA", m_StartPosition));
+        return;
+    }
+
+    // Generate the actions for every state (this and checking for conflicts are the parts of building the tables that can use several threads)
+    m_Parser->compute_all_actions(max_threads());
+    
     // Get any conflicts that might exist
-    conflict_list conflictList;
+    conflict_list   conflictList;
+    util::stopwatch conflictTimer;
     cons().verbose_stream() << L"  = Checking for conflicts" << endl;
-    conflict::find_conflicts(*m_Parser, conflictList);
+    conflict::find_conflicts(*m_Parser, conflictList, max_threads());
+    double          conflictSeconds = conflictTimer.seconds();
 
     // Report the conflicts
     error::severity shiftReduceSev  = error::sev_warning;
@@ -364,9 +449,15 @@ void lr_parser_stage::compile() {
         if ((*conflict)->first_shift_item() != (*conflict)->last_shift_item()) {
             // Shift/reduce conflict: we report the 'shift' part of the conflict as the first line
             for (lr0_item_set::const_iterator shiftItem = (*conflict)->first_shift_item(); shiftItem != (*conflict)->last_shift_item(); ++shiftItem) {
+                // Work out the severity of the message
+                error::severity sev = shiftItem == (*conflict)->first_shift_item() ? shiftReduceSev : error::sev_detail;
+                
+                // Don't format messages that won't be shown
+                if (sev == error::sev_detail && !showDetail) continue;
+                if (!cons().shows_errors(sev)) continue;
+                
                 // Start building the message
-                wstringstream   shiftMessage;
-                error::severity sev = shiftReduceSev;
+                wstringstream shiftMessage;
 
                 // Message is different if this is the initial message for this conflict vs a detail message
                 if (shiftItem == (*conflict)->first_shift_item()) {
@@ -376,7 +467,6 @@ void lr_parser_stage::compile() {
                 } else {
                     // Displaying additional items
                     shiftMessage << L"  in:";
-                    sev = error::sev_detail;
                 }
 
                 // Add the item being shifted
@@ -387,44 +477,46 @@ void lr_parser_stage::compile() {
                 position        rulePos     = m_Language->rule_definition_pos(ruleId);
                 const wstring&  ruleFile    = m_Language->rule_definition_file(ruleId);
                 
-                if (sev != error::sev_detail || showDetail) {
-                    cons().report_error(error(sev, ruleFile, L"CONFLICT_SHIFT_REDUCE", shiftMessage.str(), rulePos));
-                }
+                cons().report_error(error(sev, ruleFile, L"CONFLICT_SHIFT_REDUCE", shiftMessage.str(), rulePos));
             }
         }
 
         // Display the reductions for this conflict
         for (conflict::reduce_iterator reduceItem = (*conflict)->first_reduce_item(); reduceItem != (*conflict)->last_reduce_item(); ++reduceItem) {
-            // Start building the message
-            wstring         reduceCode      = L"DETAIL_REDUCE";
-            error::severity reductionSev    = error::sev_detail;
-            wstringstream   reduceMessage;
-
             // This is a reduce/reduce conflict if this is the first conflict in the list (ie, no other shift or reduce items)
-            if (reduceItem == (*conflict)->first_reduce_item() && (*conflict)->first_shift_item() == (*conflict)->last_shift_item()) {
-                // This is a reduce/reduce conflict
-                reductionSev = reduceReduceSev;
-                reduceCode = L"CONFLICT_REDUCE_REDUCE";
-                reduceMessage << L"Reduce/reduce conflict on";
-                reduceMessage << L" '" << formatter::to_string(*(*conflict)->token(), *m_Language->grammar(), *m_Language->terminals()) << L"':";
-            } else {
-                // Displaying additional items
-                reduceMessage << L"or reduce:";
-            }
+            bool            reduceReduce    = reduceItem == (*conflict)->first_reduce_item() && (*conflict)->first_shift_item() == (*conflict)->last_shift_item();
+            error::severity reductionSev    = reduceReduce ? reduceReduceSev : error::sev_detail;
+            
+            // Don't format messages that won't be shown
+            if (cons().shows_errors(reductionSev)) {
+                // Start building the message
+                wstring         reduceCode      = L"DETAIL_REDUCE";
+                wstringstream   reduceMessage;
+
+                if (reduceReduce) {
+                    // This is a reduce/reduce conflict
+                    reduceCode = L"CONFLICT_REDUCE_REDUCE";
+                    reduceMessage << L"Reduce/reduce conflict on";
+                    reduceMessage << L" '" << formatter::to_string(*(*conflict)->token(), *m_Language->grammar(), *m_Language->terminals()) << L"':";
+                } else {
+                    // Displaying additional items
+                    reduceMessage << L"or reduce:";
+                }
 
-            // Add the item being reduced
-            reduceMessage << L" " << formatter::to_string(*reduceItem->first->rule(), *m_Language->grammar(), *m_Language->terminals());
+                // Add the item being reduced
+                reduceMessage << L" " << formatter::to_string(*reduceItem->first->rule(), *m_Language->grammar(), *m_Language->terminals());
             
-            // Display the message for this item
-            int             ruleId      = reduceItem->first->rule()->identifier(*m_Language->grammar());
-            position        rulePos     = m_Language->rule_definition_pos(ruleId);
-            const wstring&  ruleFile    = m_Language->rule_definition_file(ruleId);
-            cons().report_error(error(reductionSev, ruleFile, reduceCode, reduceMessage.str(), rulePos));
+                // Display the message for this item
+                int             ruleId      = reduceItem->first->rule()->identifier(*m_Language->grammar());
+                position        rulePos     = m_Language->rule_definition_pos(ruleId);
+                const wstring&  ruleFile    = m_Language->rule_definition_file(ruleId);
+                cons().report_error(error(reductionSev, ruleFile, reduceCode, reduceMessage.str(), rulePos));
+            }
 
             // For reduce/reduce conflicts, display the context in which the reduction can occur
             if (showDetail) {
                 set<item_container> displayedNonterminals;
-                report_reduce_conflict(reduceItem, reduceItem->first->rule()->nonterminal(), displayedNonterminals, 0);
+                report_reduce_conflict(**conflict, reduceItem, reduceItem->first->rule()->nonterminal(), displayedNonterminals, 0);
             }
         }
 
@@ -448,8 +540,23 @@ void lr_parser_stage::compile() {
     warn_clashing_guards(cons(), m_Language, m_Parser);
     
     // Build an actual AST parser so we can display some stats
+    util::stopwatch tablesTimer;
     m_Tables = new parser_tables(*m_Parser, m_LexerCompiler->weak_symbols());
     
+    // Shift actions that lead to a state with a default reduction can perform the reduction straight away
+    int numShiftReduce = 0;
+    if (!cons().get_option(L"shift-reduce").empty()) {
+        numShiftReduce = m_Tables->combine_shift_reduce();
+        cons().verbose_stream() << L"    Number of combined shift-reduce actions: " << numShiftReduce << endl;
+    }
+    
+    // Put the states that lead to one another close together
+    if (cons().get_option(L"disable-state-layout").empty()) {
+        order_states_by_traversal();
+    }
+    
+    double tablesSeconds = tablesTimer.seconds();
+    
     // Display some stats
     int totalActions = 0;
     for (int stateId = 0; stateId < m_Tables->count_states(); ++stateId) {
@@ -460,10 +567,68 @@ void lr_parser_stage::compile() {
     cons().verbose_stream() << L"    Total number of parse actions:          " << totalActions << endl;
     cons().verbose_stream() << L"    Average number of actions per state:    " << totalActions / m_Tables->count_states() << endl;
     cons().verbose_stream() << L"    Approximate size of final parse tables: " << m_Tables->size()/1024 << L" kilobytes" << endl;
+    
+    // Record the size of the parser in the profile
+    profile->add_counter(L"lr0_states", m_Parser->count_states());
+    profile->add_counter(L"reused_states", m_Parser->count_reused_states());
+    profile->add_counter(L"propagation_edges", (long) m_PropagationCount);
+    profile->add_counter(L"conflicts", (long) conflictList.size());
+    profile->add_counter(L"actions", totalActions);
+    profile->add_counter(L"shift_reduce_actions", numShiftReduce);
+    profile->add_counter(L"table_bytes", (long) m_Tables->size());
+    
+    for (size_t rewriterIndex = 0; rewriterIndex < m_RewriterNames.size(); ++rewriterIndex) {
+        profile->add_timing(m_RewriterNames[rewriterIndex], m_Parser->rewriter_seconds(rewriterIndex));
+    }
+    
+    profile->add_timing(L"phase.lr0_states", m_Parser->states_seconds());
+    profile->add_timing(L"phase.lookaheads", m_Parser->lookahead_seconds());
+    profile->add_timing(L"phase.conflicts", conflictSeconds);
+    profile->add_timing(L"phase.tables", tablesSeconds);
+    
+    // The tables are all that's needed from here on in low memory mode (the actions are generated again if needed)
+    if (!cons().get_option(L"low-memory").empty()) {
+        m_Parser->clear_caches();
+        
+        long peakMemory = stage_profile::peak_process_memory();
+        if (peakMemory >= 0) {
+            cons().verbose_stream() << L"    Peak memory used:                       " << peakMemory/1024 << L" kilobytes" << endl;
+        }
+    }
+}
+
+/// \brief Renumbers the states in the parser tables so that the most frequently used states are next to each other
+bool lr_parser_stage::order_states_by_frequency(const map<int, long>& frequencies) {
+    if (!m_Tables) return false;
+    
+    return m_Tables->renumber_states(parser_tables::order_states_by_frequency(m_Tables->count_states(), count_fixed_states(), frequencies));
+}
+
+/// \brief Renumbers the states in the parser tables so that each state is close to the states that lead to it
+bool lr_parser_stage::order_states_by_traversal() {
+    if (!m_Tables) return false;
+    
+    return m_Tables->renumber_states(m_Tables->order_states_by_traversal(count_fixed_states()));
+}
+
+/// \brief The number of states at the start of the tables that must keep their IDs
+int lr_parser_stage::count_fixed_states() const {
+    // The initial states are created first, so they are always the lowest-numbered states
+    int numFixed = 0;
+    for (vector<int>::const_iterator initialState = m_InitialStates.begin(); initialState != m_InitialStates.end(); ++initialState) {
+        if (*initialState >= numFixed) numFixed = *initialState + 1;
+    }
+    
+    return numFixed;
 }
 
 /// \brief Reports errors for a particular reduce conflict (the 'in' and 'to' messages)
-void lr_parser_stage::report_reduce_conflict(lr::conflict::reduce_iterator& reduceItem, item_container nonterminal, set<item_container>& displayedNonterminals, int level) {
+void lr_parser_stage::report_reduce_conflict(const lr::conflict& conf, lr::conflict::reduce_iterator& reduceItem, item_container nonterminal, set<item_container>& displayedNonterminals, int level) {
+    // Nothing to do if detail messages aren't being shown
+    if (!cons().shows_errors(error::sev_detail)) {
+        return;
+    }
+    
     // Only display the set for a given target nonterminal once
     if (displayedNonterminals.find(nonterminal) != displayedNonterminals.end()) {
         return;
@@ -473,7 +638,8 @@ void lr_parser_stage::report_reduce_conflict(lr::conflict::reduce_iterator& redu
     displayedNonterminals.insert(nonterminal);
     
     // For reduce/reduce conflicts, display the context in which the reduction can occur
-    for (conflict::possible_reduce_states::const_iterator possibleState = reduceItem->second.begin(); possibleState != reduceItem->second.end(); ++possibleState) {
+    const conflict::possible_reduce_states& possibleStates = conf.reduce_states(reduceItem);
+    for (conflict::possible_reduce_states::const_iterator possibleState = possibleStates.begin(); possibleState != possibleStates.end(); ++possibleState) {
         // Generate a detail message for this item
         const conflict::lr_item_id& itemId = *possibleState;
         
@@ -499,6 +665,6 @@ void lr_parser_stage::report_reduce_conflict(lr::conflict::reduce_iterator& redu
         cons().report_error(error(error::sev_detail, reducedRuleFile, L"DETAIL_REDUCE_IN", detailMessage.str(), reducedRulePos));
         
         // Display the set for the nonterminals for this rule
-        report_reduce_conflict(reduceItem, item->rule()->nonterminal(), displayedNonterminals, level+1);
+        report_reduce_conflict(conf, reduceItem, item->rule()->nonterminal(), displayedNonterminals, level+1);
     }
 }
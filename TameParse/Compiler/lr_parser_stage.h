@@ -28,6 +28,7 @@
 #ifndef _COMPILER_LR_PARSER_STAGE_H
 #define _COMPILER_LR_PARSER_STAGE_H
 
+#include <map>
 #include <string>
 
 #include "TameParse/Compiler/compilation_stage.h"
@@ -70,6 +71,21 @@ namespace compiler {
         
         /// \brief The parser tables for the final parser
         lr::parser_tables* m_Tables;
+        
+        /// \brief A builder for an earlier version of this language whose states can be reused, or NULL
+        const lr::lalr_builder* m_PreviousParser;
+        
+        /// \brief True if the rules that can't be used from the start symbols should be removed from the grammar
+        bool m_PruneGrammar;
+        
+        /// \brief The names of the rewriters added to the parser by build_states(), in order (used for profiling)
+        std::vector<std::wstring> m_RewriterNames;
+        
+        /// \brief The time taken by build_states(), in seconds (included in the profile recorded by build_tables())
+        double m_StatesSeconds;
+        
+        /// \brief The number of lookahead propagations in the parser (recorded before they can be discarded in low memory mode)
+        size_t m_PropagationCount;
 
     public:
         /// \brief Constructor, without using a parser block
@@ -79,14 +95,60 @@ namespace compiler {
         lr_parser_stage(console_container& console, const std::wstring& filename, language_stage* languageCompiler, lexer_stage* lexerCompiler, language::parser_block* parserBlock);
 
         /// \brief Destructor
-        ~lr_parser_stage();
+        virtual ~lr_parser_stage();
 
         /// \brief Compiles the parser specified by the parameters to this stage
+        ///
+        /// This is the same as calling build_states() followed by build_tables()
         void compile();
-
+        
+        /// \brief Builds the states of the parser and their lookaheads, returning false if this failed
+        ///
+        /// This only needs the language stage: it doesn't read anything generated by the lexer stage, so it can be run
+        /// at the same time as that stage, provided that the lexer waits for it to finish before adding its weak
+        /// symbols to the grammar (see lexer_stage::set_grammar_gate()).
+        bool build_states();
+        
+        /// \brief Finds the conflicts in the parser built by build_states() and builds its tables
+        ///
+        /// The lexer stage must have finished compiling before this is called, as the actions for each state depend on
+        /// the weak symbols that it generates.
+        void build_tables();
+        
+        /// \brief Supplies the parser built for an earlier version of the language
+        ///
+        /// When set, compile() only recalculates the closures of states that depend on nonterminals whose rules have
+        /// changed since the previous parser was built. The previous parser (along with the language stage that owns
+        /// its grammar) must stay valid until compile() has finished. Pass NULL to build every state from scratch.
+        inline void set_previous_parser(const lr::lalr_builder* previous) { m_PreviousParser = previous; }
+
+        /// \brief Sets whether or not compile() should remove the rules that can't be used from the start symbols
+        ///
+        /// This modifies the grammar that belongs to the language stage, so it should only be set when this is the only
+        /// parser that will be built for the language (other start symbols may need the rules that are removed). The
+        /// item and rule identifiers in the grammar are not changed.
+        inline void set_prune_grammar(bool prune) { m_PruneGrammar = prune; }
+
+        /// \brief Renumbers the states in the parser tables so that the most frequently used states are next to each other
+        ///
+        /// The frequencies map state IDs in the tables built by compile() to the number of times they were used (typically
+        /// collected by counting_parser_trace). The initial states keep their IDs, so the parser can still be started 
+        /// from the state for each start symbol. Returns false if the tables couldn't be renumbered.
+        bool order_states_by_frequency(const std::map<int, long>& frequencies);
+        
+        /// \brief Renumbers the states in the parser tables so that each state is close to the states that lead to it
+        ///
+        /// compile() calls this unless the 'disable-state-layout' option is set. It needs no profile, and 
+        /// order_states_by_frequency keeps this order for states that are used equally often. The initial states keep
+        /// their IDs. Returns false if the tables couldn't be renumbered.
+        bool order_states_by_traversal();
+    
     private:
+        /// \brief The number of states at the start of the tables that must keep their IDs
+        int count_fixed_states() const;
+        
         /// \brief Reports errors for a particular reduce conflict (the 'in' and 'to' messages)
-        void report_reduce_conflict(lr::conflict::reduce_iterator& reduceItem, contextfree::item_container nonterminal, std::set<contextfree::item_container>& displayedNonterminals, int level);
+        void report_reduce_conflict(const lr::conflict& conf, lr::conflict::reduce_iterator& reduceItem, contextfree::item_container nonterminal, std::set<contextfree::item_container>& displayedNonterminals, int level);
         
     public:
         /// \brief Returns the parser built by this stage
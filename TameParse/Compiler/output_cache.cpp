@@ -0,0 +1,250 @@
+//
+//  output_cache.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include <sstream>
+#include <memory>
+
+#include "TameParse/Compiler/output_cache.h"
+
+using namespace std;
+using namespace compiler;
+
+/// \brief Copies the contents of one stream into another, returning false if anything fails
+static bool copy_stream(istream& from, ostream& to) {
+    char buffer[4096];
+
+    while (from.good()) {
+        from.read(buffer, sizeof(buffer));
+        to.write(buffer, from.gcount());
+    }
+
+    return from.eof() && !to.fail();
+}
+
+/// \brief Creates an empty store
+output_cache::memory_store::memory_store(size_t maxEntries)
+: m_MaxEntries(maxEntries) {
+}
+
+/// \brief The contents of the files stored with the specified key, or NULL if there is no such entry
+const std::vector<std::string>* output_cache::memory_store::find(hash_code key) const {
+    map<hash_code, vector<string> >::const_iterator found = m_Entries.find(key);
+    if (found == m_Entries.end()) return NULL;
+    return &found->second;
+}
+
+/// \brief Stores the contents of some files with the specified key
+void output_cache::memory_store::store(hash_code key, const std::vector<std::string>& contents) {
+    if (m_Entries.size() >= m_MaxEntries && m_Entries.find(key) == m_Entries.end()) {
+        m_Entries.clear();
+    }
+    
+    m_Entries[key] = contents;
+}
+
+/// \brief Creates a cache that stores its files in the specified directory, and in memory if memory is not NULL
+output_cache::output_cache(console_container& console, const std::wstring& directory, memory_store* memory)
+: m_Console(console)
+, m_Directory(directory)
+, m_Hash(14695981039346656037ULL)
+, m_Memory(memory) {
+    // Make sure cache files are always inside the directory
+    if (!m_Directory.empty() && m_Directory[m_Directory.size()-1] != L'/') {
+        m_Directory += L'/';
+    }
+}
+
+/// \brief Adds some bytes to the hash
+void output_cache::add_bytes(const char* bytes, size_t count) {
+    // FNV-1a
+    for (size_t pos = 0; pos < count; ++pos) {
+        m_Hash = (m_Hash ^ (unsigned char) bytes[pos]) * 1099511628211ULL;
+    }
+}
+
+/// \brief Adds a string to the key for this cache
+void output_cache::add_string(const std::wstring& value) {
+    // Include the length so that different sequences of strings can't produce the same sequence of bytes
+    wstringstream withLength;
+    withLength << value.size() << L':' << value;
+
+    string bytes = m_Console->convert_filename(withLength.str());
+    add_bytes(bytes.c_str(), bytes.size());
+}
+
+/// \brief Adds the contents of a file to the key for this cache
+///
+/// Returns false if the file could not be read.
+bool output_cache::add_file(const std::wstring& filename) {
+    auto_ptr<istream> file(m_Console->open_file(filename));
+    if (!file.get()) return false;
+
+    char    buffer[4096];
+    size_t  total = 0;
+
+    while (file->good()) {
+        file->read(buffer, sizeof(buffer));
+        add_bytes(buffer, (size_t) file->gcount());
+        total += (size_t) file->gcount();
+    }
+
+    // Finish with the length of the file, so the next thing added can't be mistaken for part of it
+    char* lengthBytes = (char*) &total;
+    add_bytes(lengthBytes, sizeof(total));
+
+    return file->eof();
+}
+
+/// \brief The key for the cache entry, as a hexadecimal string
+std::wstring output_cache::key() const {
+    wstringstream result;
+    result.fill(L'0');
+    result.width(16);
+    result << hex << m_Hash;
+    return result.str();
+}
+
+/// \brief Returns the name of the cache file for the output file with the specified index (or the index file if index is -1)
+std::wstring output_cache::cache_filename(int index) const {
+    wstringstream result;
+    result << m_Directory << key();
+    if (index >= 0) {
+        result << L'.' << index;
+    }
+    return result.str();
+}
+
+/// \brief Copies the cached versions of the specified output files into place
+///
+/// Returns false (and leaves the output files alone) if there is no complete cache entry for the current key.
+bool output_cache::restore(const std::vector<std::wstring>& outputFiles) {
+    // Use the entry in memory if there is one
+    const vector<string>* inMemory = m_Memory ? m_Memory->find(m_Hash) : NULL;
+    
+    if (inMemory && inMemory->size() == outputFiles.size()) {
+        for (size_t fileNum = 0; fileNum < outputFiles.size(); ++fileNum) {
+            auto_ptr<ostream> target(m_Console->open_binary_file_for_writing(outputFiles[fileNum]));
+            
+            if (target.get()) {
+                target->write((*inMemory)[fileNum].data(), (streamsize) (*inMemory)[fileNum].size());
+            }
+            
+            if (!target.get() || target->fail()) {
+                m_Console->report_error(error(error::sev_warning, outputFiles[fileNum], L"CANT_RESTORE_FROM_CACHE", L"Could not copy the cached version of this file", dfa::position(-1, -1, -1)));
+                return false;
+            }
+        }
+        
+        return true;
+    }
+    
+    // Nothing more to do if there's no directory
+    if (m_Directory.empty()) return false;
+    
+    // The index file must exist and agree about the number of files in this entry
+    auto_ptr<istream> index(m_Console->open_file(cache_filename(-1)));
+    if (!index.get()) return false;
+
+    size_t numFiles = 0;
+    (*index) >> numFiles;
+    if (index->fail() || numFiles != outputFiles.size()) return false;
+
+    // Open all of the cached files before touching any of the outputs
+    vector<istream*>    cached;
+    bool                ok = true;
+
+    for (size_t fileNum = 0; fileNum < outputFiles.size(); ++fileNum) {
+        istream* cachedFile = m_Console->open_file(cache_filename((int) fileNum));
+        if (!cachedFile) {
+            ok = false;
+            break;
+        }
+        cached.push_back(cachedFile);
+    }
+
+    // Copy them to the output files
+    for (size_t fileNum = 0; ok && fileNum < outputFiles.size(); ++fileNum) {
+        auto_ptr<ostream> target(m_Console->open_binary_file_for_writing(outputFiles[fileNum]));
+
+        if (!target.get() || target->fail() || !copy_stream(*cached[fileNum], *target)) {
+            m_Console->report_error(error(error::sev_warning, outputFiles[fileNum], L"CANT_RESTORE_FROM_CACHE", L"Could not copy the cached version of this file", dfa::position(-1, -1, -1)));
+            ok = false;
+        }
+    }
+
+    for (vector<istream*>::iterator toDelete = cached.begin(); toDelete != cached.end(); ++toDelete) {
+        delete *toDelete;
+    }
+
+    return ok;
+}
+
+/// \brief Stores copies of the specified output files in the cache
+///
+/// Returns false if the files could not be stored.
+bool output_cache::store(const std::vector<std::wstring>& outputFiles) {
+    // Keep the files in memory if there's a store for them
+    if (m_Memory) {
+        vector<string> contents(outputFiles.size());
+        
+        for (size_t fileNum = 0; fileNum < outputFiles.size(); ++fileNum) {
+            auto_ptr<istream>   source(m_Console->open_file(outputFiles[fileNum]));
+            ostringstream       content;
+            
+            if (!source.get() || !copy_stream(*source, content)) {
+                m_Console->report_error(error(error::sev_warning, outputFiles[fileNum], L"CANT_WRITE_CACHE", L"Could not read this file to cache it", dfa::position(-1, -1, -1)));
+                return false;
+            }
+            
+            contents[fileNum] = content.str();
+        }
+        
+        m_Memory->store(m_Hash, contents);
+    }
+    
+    // Nothing more to do if there's no directory
+    if (m_Directory.empty()) return true;
+    
+    // Copy each file into the cache
+    for (size_t fileNum = 0; fileNum < outputFiles.size(); ++fileNum) {
+        auto_ptr<istream> source(m_Console->open_file(outputFiles[fileNum]));
+        auto_ptr<ostream> target(m_Console->open_binary_file_for_writing(cache_filename((int) fileNum)));
+
+        if (!source.get() || !target.get() || target->fail() || !copy_stream(*source, *target)) {
+            m_Console->report_error(error(error::sev_warning, cache_filename((int) fileNum), L"CANT_WRITE_CACHE", L"Could not write to the output cache", dfa::position(-1, -1, -1)));
+            return false;
+        }
+    }
+
+    // Write the index last: the entry can be used once this exists
+    auto_ptr<ostream> index(m_Console->open_binary_file_for_writing(cache_filename(-1)));
+    if (!index.get() || index->fail()) {
+        m_Console->report_error(error(error::sev_warning, cache_filename(-1), L"CANT_WRITE_CACHE", L"Could not write to the output cache", dfa::position(-1, -1, -1)));
+        return false;
+    }
+
+    (*index) << outputFiles.size() << "\n";
+    return !index->fail();
+}
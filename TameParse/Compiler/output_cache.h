@@ -0,0 +1,123 @@
+//
+//  output_cache.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _COMPILER_OUTPUT_CACHE_H
+#define _COMPILER_OUTPUT_CACHE_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "TameParse/Compiler/console.h"
+
+namespace compiler {
+    ///
+    /// \brief Content-addressed cache of the files generated by the parser generator
+    ///
+    /// The cache is keyed on a hash of everything that can affect the output: callers add the contents of the input
+    /// files and the values of any relevant options before calling restore() or store(). If the key is unchanged then
+    /// restore() can copy the previously generated files into place without running the lexer or parser builders.
+    ///
+    /// Each entry consists of one cache file per output file, plus an index file that is written last so that partially
+    /// written entries are not used. Entries can also be kept in a memory_store, for processes that stay resident
+    /// between runs of the parser generator: the directory can be empty to only use the memory store.
+    ///
+    class output_cache {
+    public:
+        /// \brief Type of the hash code used to identify cache entries
+        typedef uint64_t hash_code;
+        
+        ///
+        /// \brief Cache entries kept in memory
+        ///
+        /// Once it holds the maximum number of entries, the whole store is emptied before adding a new one.
+        ///
+        class memory_store {
+        private:
+            /// \brief The contents of the output files for each cache key
+            std::map<hash_code, std::vector<std::string> > m_Entries;
+            
+            /// \brief The largest number of entries to keep
+            size_t m_MaxEntries;
+            
+        public:
+            /// \brief Creates an empty store
+            explicit memory_store(size_t maxEntries = 256);
+            
+            /// \brief The contents of the files stored with the specified key, or NULL if there is no such entry
+            const std::vector<std::string>* find(hash_code key) const;
+            
+            /// \brief Stores the contents of some files with the specified key
+            void store(hash_code key, const std::vector<std::string>& contents);
+        };
+
+    private:
+        /// \brief The console used to read and write files
+        mutable console_container m_Console;
+
+        /// \brief The directory where the cached files are stored
+        std::wstring m_Directory;
+
+        /// \brief The hash of the data added so far
+        hash_code m_Hash;
+        
+        /// \brief NULL, or the entries kept in memory
+        memory_store* m_Memory;
+
+        /// \brief Adds some bytes to the hash
+        void add_bytes(const char* bytes, size_t count);
+
+        /// \brief Returns the name of the cache file for the output file with the specified index (or the index file if index is -1)
+        std::wstring cache_filename(int index) const;
+
+    public:
+        /// \brief Creates a cache that stores its files in the specified directory, and in memory if memory is not NULL
+        output_cache(console_container& console, const std::wstring& directory, memory_store* memory = NULL);
+
+        /// \brief Adds a string to the key for this cache
+        void add_string(const std::wstring& value);
+
+        /// \brief Adds the contents of a file to the key for this cache
+        ///
+        /// Returns false if the file could not be read.
+        bool add_file(const std::wstring& filename);
+
+        /// \brief The key for the cache entry, as a hexadecimal string
+        std::wstring key() const;
+
+        /// \brief Copies the cached versions of the specified output files into place
+        ///
+        /// Returns false (and leaves the output files alone) if there is no complete cache entry for the current key.
+        bool restore(const std::vector<std::wstring>& outputFiles);
+
+        /// \brief Stores copies of the specified output files in the cache
+        ///
+        /// Returns false if the files could not be stored.
+        bool store(const std::vector<std::wstring>& outputFiles);
+    };
+}
+
+#endif
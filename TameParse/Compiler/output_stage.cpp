@@ -27,6 +27,7 @@
 
 #include <string>
 #include <sstream>
+#include <algorithm>
 
 #include "TameParse/Compiler/output_stage.h"
 
@@ -40,11 +41,13 @@ output_stage::output_stage(console_container& console, const std::wstring& filen
 : compilation_stage(console, filename)
 , m_LexerStage(lexer)
 , m_LanguageStage(language)
-, m_ParserStage(parser) {
+, m_ParserStage(parser)
+, m_Tables(NULL) {
 }
 
 /// \brief Destructor
 output_stage::~output_stage() {
+    delete m_Tables;
 }
 
 /// \brief Compiles the parser specified by this stage
@@ -52,7 +55,14 @@ output_stage::~output_stage() {
 /// Subclasses can override this if they want to substantially change the way that the
 /// compiler is generated.
 void output_stage::compile() {
+    profile_scope profile(cons(), L"output", filename());
+    
     // TODO: sanity check
+    
+    // Give the terminals dense identifiers if requested
+    if (!cons().get_option(L"dense-terminals").empty()) {
+        renumber_terminals();
+    }
 
     // Start writing the output
     begin_output();
@@ -73,6 +83,51 @@ void output_stage::compile() {
     end_output();
 }
 
+/// \brief Gives the terminal symbols dense identifiers, with the ones the parser uses most often first
+void output_stage::renumber_terminals() {
+    const lr::parser_tables* tables = m_ParserStage->get_tables();
+    if (!tables) return;
+    
+    vector<int> newIds = lr::parser_tables::order_terminals_by_use(*tables, terminals().count_symbols());
+    
+    // Renumber a copy of the tables, so the parser stage is left as it was
+    delete m_Tables;
+    m_Tables = new lr::parser_tables(*tables);
+    
+    if (!m_Tables->renumber_terminals(newIds)) {
+        cons().report_error(error(error::sev_bug, filename(), L"BUG_CANT_RENUMBER_TERMINALS", L"Could not renumber the terminal symbols", position(-1, -1, -1)));
+        
+        delete m_Tables;
+        m_Tables = NULL;
+        return;
+    }
+    
+    // The keyword table hashes the symbols, so it has to be built again
+    const keyword_table&            keywords = m_LexerStage->keywords();
+    keyword_hash_table::keyword_list keywordList;
+    
+    for (int slot = 0; slot < keywords.count_slots(); ++slot) {
+        const keyword_table::entry& entry = keywords.get_slot(slot);
+        if (entry.baseSymbol < 0) continue;
+        
+        keyword_hash_table::keyword newKeyword;
+        newKeyword.baseSymbol       = newIds[entry.baseSymbol];
+        newKeyword.keywordSymbol    = newIds[entry.keywordSymbol];
+        newKeyword.foldCase         = entry.foldCase;
+        newKeyword.text.assign(keywords.text() + entry.textOffset, keywords.text() + entry.textOffset + entry.length);
+        
+        keywordList.push_back(newKeyword);
+    }
+    
+    m_Keywords      = keyword_hash_table(keywordList);
+    m_TerminalIds   = newIds;
+    
+    // Regenerate anything that refers to the old identifiers
+    m_TerminalSymbols.clear();
+    m_LexerActions.clear();
+    m_RulesForNonterminal.clear();
+}
+
 /// \brief Defines the symbols associated with this language
 void output_stage::define_symbols() {
     // TODO: remove me!
@@ -114,7 +169,7 @@ void output_stage::generate_terminal_symbols() {
 
     // Fill in the terminal symbols
     for (int symbolId = 0; symbolId < terminals().count_symbols(); ++symbolId) {
-        m_TerminalSymbols.push_back(terminal_symbol(terminals().name_for_symbol(symbolId), symbolId, item_container(new terminal(symbolId))));
+        m_TerminalSymbols.push_back(terminal_symbol(terminals().name_for_symbol(symbolId), terminal_id(symbolId), item_container(new terminal(symbolId))));
     }
 }
 
@@ -238,7 +293,7 @@ void output_stage::generate_lexer_actions() {
         }
 
         // Write out this action
-        m_LexerActions.push_back(lexer_state_action(stateId, true, highest->symbol()));
+        m_LexerActions.push_back(lexer_state_action(stateId, true, terminal_id(highest->symbol())));
     }
 }
 
@@ -517,7 +572,9 @@ void output_stage::generate_ast_rules() {
                 }
 
                 // Add a new item for this rule
-                ruleList.push_back(ast_rule_item((*ruleItem)->type() == item::terminal, (*ruleItem)->symbol(), *ruleItem, uniqueName, isEbnfRepeat));
+                bool isTerminal = (*ruleItem)->type() == item::terminal;
+                int  symbolId   = isTerminal ? terminal_id((*ruleItem)->symbol()) : (*ruleItem)->symbol();
+                ruleList.push_back(ast_rule_item(isTerminal, symbolId, *ruleItem, uniqueName, isEbnfRepeat));
             }
         }
     }
@@ -534,3 +591,110 @@ const output_stage::ast_nonterminal& output_stage::get_ast_nonterminal(int nonte
 
     return m_RulesForNonterminal[nonterminalId];
 }
+
+/// \brief Builds the symbol map as the symbol set (plus 1) for each ASCII character, and the sorted ranges for the other characters
+void output_stage::build_symbol_map_tables(output_table& ascii, output_table& rangeLower, output_table& rangeUpper, output_table& rangeSet) {
+    typedef pair<pair<int, int>, int> sorted_range;
+    vector<sorted_range> ranges;
+
+    ascii.assign(128, 0);
+
+    for (symbol_map_iterator symbolRange = begin_symbol_map(); symbolRange != end_symbol_map(); ++symbolRange) {
+        int lower = symbolRange->symbolRange.lower();
+        int upper = symbolRange->symbolRange.upper();
+
+        for (int c = lower; c < upper && c < 128; ++c) {
+            ascii[c] = symbolRange->identifier + 1;
+        }
+
+        if (upper > 128) {
+            ranges.push_back(sorted_range(pair<int, int>(lower < 128 ? 128 : lower, upper), symbolRange->identifier));
+        }
+    }
+
+    sort(ranges.begin(), ranges.end());
+
+    for (vector<sorted_range>::const_iterator range = ranges.begin(); range != ranges.end(); ++range) {
+        rangeLower.push_back(range->first.first);
+        rangeUpper.push_back(range->first.second);
+        rangeSet.push_back(range->second);
+    }
+}
+
+/// \brief Builds the lexer state machine as a flat table, with a row for each state and a column for each symbol set
+void output_stage::build_flat_lexer_table(output_table& transitions) {
+    int numSets = count_lexer_symbol_sets();
+
+    transitions.assign((size_t) count_lexer_states() * numSets, 0);
+
+    for (lexer_state_transition_iterator transit = begin_lexer_state_transition(); transit != end_lexer_state_transition(); ++transit) {
+        transitions[(size_t) transit->stateIdentifier * numSets + transit->symbolSet] = transit->newState + 1;
+    }
+}
+
+/// \brief Builds a table of the symbol accepted by each lexer state (plus 1, or 0 for states that don't accept)
+void output_stage::build_lexer_accept_table(output_table& accept) {
+    accept.assign((size_t) count_lexer_states(), 0);
+
+    for (lexer_state_action_iterator stateAction = begin_lexer_state_action(); stateAction != end_lexer_state_action(); ++stateAction) {
+        if (stateAction->accepting) {
+            accept[stateAction->stateId] = stateAction->acceptSymbolId + 1;
+        }
+    }
+}
+
+/// \brief Builds the actions for the terminal or nonterminal symbols in each parser state
+void output_stage::build_parser_action_tables(bool terminals, output_table& first, output_table& symbols, output_table& types, output_table& next) {
+    typedef lr::parser_tables::action action;
+    const lr::parser_tables& tables = get_parser_tables();
+
+    for (int stateId = 0; stateId < tables.count_states(); ++stateId) {
+        const action*   actions = terminals ? tables.terminal_actions()[stateId] : tables.nonterminal_actions()[stateId];
+        int             count   = terminals ? tables.action_counts()[stateId].numTerminals : tables.action_counts()[stateId].numNonterminals;
+
+        first.push_back((long) symbols.size());
+
+        for (int actionNum = 0; actionNum < count; ++actionNum) {
+            // Only the first action for each symbol is used
+            if (actionNum > 0 && actions[actionNum-1].symbolId == actions[actionNum].symbolId) continue;
+
+            symbols.push_back(actions[actionNum].symbolId);
+            types.push_back(actions[actionNum].type);
+            next.push_back(actions[actionNum].nextState);
+        }
+    }
+
+    first.push_back((long) symbols.size());
+}
+
+/// \brief Builds a table of the rule that each parser state reduces by default (plus 1, or 0 for no default)
+void output_stage::build_default_reduction_table(output_table& defaultReduce) {
+    const lr::parser_tables& tables = get_parser_tables();
+
+    for (int stateId = 0; stateId < tables.count_states(); ++stateId) {
+        defaultReduce.push_back(tables.has_default_reduction(stateId) ? tables.default_reduction(stateId)->nextState + 1 : 0);
+    }
+}
+
+/// \brief Builds a table of the state that the parser goes to for each nonterminal in states that have no goto action
+/// for it (plus 1, or 0 for no default)
+void output_stage::build_default_goto_table(output_table& defaultGoto) {
+    const lr::parser_tables& tables = get_parser_tables();
+
+    for (int nonterminal = 0; nonterminal < tables.count_default_gotos(); ++nonterminal) {
+        defaultGoto.push_back(tables.default_goto(nonterminal) + 1);
+    }
+}
+
+/// \brief Builds the nonterminal, grammar rule identifier and length of each rule that the parser can reduce
+void output_stage::build_reduce_rule_tables(output_table& nonterminals, output_table& ruleIds, output_table& lengths) {
+    const lr::parser_tables& tables = get_parser_tables();
+
+    for (int ruleNum = 0; ruleNum < tables.count_reduce_rules(); ++ruleNum) {
+        const lr::parser_tables::reduce_rule& rule = tables.rule(ruleNum);
+
+        nonterminals.push_back(rule.identifier);
+        ruleIds.push_back(rule.ruleId);
+        lengths.push_back(rule.length);
+    }
+}
@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "TameParse/Dfa/range.h"
+#include "TameParse/Dfa/skip_state.h"
 
 #include "TameParse/ContextFree/grammar.h"
 #include "TameParse/ContextFree/terminal_dictionary.h"
@@ -40,6 +41,7 @@
 #include "TameParse/Lr/parser_tables.h"
 
 #include "TameParse/Compiler/output_stage_data.h"
+#include "TameParse/Compiler/output_table.h"
 #include "TameParse/Compiler/compilation_stage.h"
 #include "TameParse/Compiler/language_stage.h"
 #include "TameParse/Compiler/lr_parser_stage.h"
@@ -59,6 +61,15 @@ namespace compiler {
 
         /// \brief The LR parser that should be compiled
         lr_parser_stage* m_ParserStage;
+        
+        /// \brief The identifier that each terminal symbol is given in the output (empty if they keep their identifiers)
+        std::vector<int> m_TerminalIds;
+        
+        /// \brief The parser tables with the terminals renumbered, or NULL if the tables from the parser stage are written
+        lr::parser_tables* m_Tables;
+        
+        /// \brief The keyword table with the terminals renumbered
+        dfa::keyword_hash_table m_Keywords;
 
     public:
         /// \brief Creates a new output stage
@@ -142,8 +153,16 @@ namespace compiler {
         void generate_lexer_actions();
 
         void generate_ast_rules();
+        
+        /// \brief Gives the terminal symbols dense identifiers, with the ones the parser uses most often first
+        void renumber_terminals();
 
     protected:
+        /// \brief The identifier that the specified terminal symbol has in the output
+        ///
+        /// This is the same as its identifier in the terminal dictionary unless the dense-terminals option is set.
+        inline int terminal_id(int symbolId) const { return m_TerminalIds.empty() ? symbolId : m_TerminalIds[symbolId]; }
+        
         /// \brief Returns a name for a grammar rule
         std::wstring name_for_rule(const contextfree::rule_container& thisRule);
 
@@ -198,6 +217,29 @@ namespace compiler {
         /// \brief The total number of states in the lexer
         inline int count_lexer_states() { return m_LexerStage->dfa()->count_states(); }
 
+        /// \brief The states in the lexer that can be skipped through, or NULL if there aren't any (see dfa::find_skip_states)
+        ///
+        /// The result has count_lexer_states() entries, and should be freed with delete[]
+        inline dfa::skip_state* find_lexer_skip_states() { return dfa::find_skip_states(*m_LexerStage->dfa()); }
+        
+        /// \brief The states in the lexer where a lexeme can be accepted without reading another symbol, or NULL if there
+        /// aren't any (see dfa::find_commit_states)
+        ///
+        /// The result has count_lexer_states() entries, and should be freed with delete[]
+        inline bool* find_lexer_commit_states() { return dfa::find_commit_states(*m_LexerStage->dfa()); }
+        
+        /// \brief The keywords that the lexer looks up after the DFA has matched a lexeme (see dfa::keyword_table)
+        inline const dfa::keyword_table& lexer_keywords() {
+            if (m_TerminalIds.empty()) return m_LexerStage->keywords();
+            return m_Keywords;
+        }
+        
+        /// \brief The number of lexer modes (the first states in the lexer are the initial states for each mode)
+        inline int count_lexer_modes() { return m_LanguageStage->lexer()->count_modes(); }
+        
+        /// \brief The name of a lexer mode (the default mode, 0, has an empty name)
+        inline const std::wstring& lexer_mode_name(int mode) { return m_LanguageStage->lexer()->mode_name(mode); }
+
         /// \brief The first item in the symbol map
         symbol_map_iterator begin_symbol_map();
 
@@ -224,7 +266,10 @@ namespace compiler {
         inline const lr::lalr_builder& get_lalr_builder() { return *m_ParserStage->get_parser(); }
 
         /// \brief The parser tables built by the parser generator
-        inline const lr::parser_tables& get_parser_tables() { return *m_ParserStage->get_tables(); }
+        inline const lr::parser_tables& get_parser_tables() { 
+            if (m_Tables) return *m_Tables;
+            return *m_ParserStage->get_tables(); 
+        }
 
         /// \brief Retrieves the start symbols that are possible for this parser
         ///
@@ -237,6 +282,43 @@ namespace compiler {
 
         /// \brief Returns the AST definition for the specified nonterminal
         const ast_nonterminal& get_ast_nonterminal(int nonterminalId);
+
+    protected:
+        // Tables built from the lexer and parser data, which can be written out with a table_encoder.
+        //
+        // Where a table needs a value that means 'none', this is 0 and the other values are stored plus 1, so that
+        // the tables contain no negative values.
+
+        /// \brief Builds the symbol map as the symbol set (plus 1) for each ASCII character, and the sorted ranges for the other characters
+        ///
+        /// Each range includes its lower bound and excludes its upper bound.
+        void build_symbol_map_tables(output_table& ascii, output_table& rangeLower, output_table& rangeUpper, output_table& rangeSet);
+
+        /// \brief Builds the lexer state machine as a flat table, with a row for each state and a column for each symbol set
+        ///
+        /// The entries are the new state plus 1, or 0 if the symbol set is rejected.
+        void build_flat_lexer_table(output_table& transitions);
+
+        /// \brief Builds a table of the symbol accepted by each lexer state (plus 1, or 0 for states that don't accept)
+        void build_lexer_accept_table(output_table& accept);
+
+        /// \brief Builds the actions for the terminal or nonterminal symbols in each parser state
+        ///
+        /// The actions for state s are at the indexes between first[s] and first[s+1], sorted by symbol. Only the
+        /// first action for each symbol is included, as it is the only one that a parser without weak symbols or
+        /// guards will perform. Types are values from lr::lr_action::action_type, and next is the new state for
+        /// shift and goto actions, or the rule for reduce actions.
+        void build_parser_action_tables(bool terminals, output_table& first, output_table& symbols, output_table& types, output_table& next);
+
+        /// \brief Builds a table of the rule that each parser state reduces by default (plus 1, or 0 for no default)
+        void build_default_reduction_table(output_table& defaultReduce);
+
+        /// \brief Builds a table of the state that the parser goes to for each nonterminal in states that have no goto
+        /// action for it (plus 1, or 0 for no default)
+        void build_default_goto_table(output_table& defaultGoto);
+
+        /// \brief Builds the nonterminal, grammar rule identifier and length of each rule that the parser can reduce
+        void build_reduce_rule_tables(output_table& nonterminals, output_table& ruleIds, output_table& lengths);
     };
 }
 
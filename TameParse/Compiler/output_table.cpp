@@ -0,0 +1,140 @@
+//
+//  output_table.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include "TameParse/Compiler/output_table.h"
+
+using namespace std;
+using namespace compiler;
+
+/// \brief Appends the decimal representation of a value to a string
+void compiler::append_int(std::string& text, long value) {
+    char            digits[24];
+    char*           pos         = digits + sizeof(digits);
+    unsigned long   magnitude   = value < 0 ? 0ul - (unsigned long) value : (unsigned long) value;
+    
+    // Write the digits backwards from the end of the buffer
+    do {
+        *--pos      = (char) ('0' + magnitude % 10);
+        magnitude   /= 10;
+    } while (magnitude != 0);
+    
+    if (value < 0) *--pos = '-';
+    
+    text.append(pos, digits + sizeof(digits));
+}
+
+/// \brief Creates an empty table
+output_table::output_table(const std::string& name)
+: m_Name(name) {
+}
+
+/// \brief The smallest value in this table (0 if it is empty)
+long output_table::min_value() const {
+    if (m_Values.empty()) return 0;
+    
+    long result = m_Values[0];
+    for (iterator value = begin(); value != end(); ++value) {
+        if (*value < result) result = *value;
+    }
+    
+    return result;
+}
+
+/// \brief The largest value in this table (0 if it is empty)
+long output_table::max_value() const {
+    if (m_Values.empty()) return 0;
+    
+    long result = m_Values[0];
+    for (iterator value = begin(); value != end(); ++value) {
+        if (*value > result) result = *value;
+    }
+    
+    return result;
+}
+
+/// \brief Destructor
+table_encoder::~table_encoder() {
+}
+
+/// \brief Creates an encoder for arrays with the specified element type (empty to use the smallest type)
+c_array_encoder::c_array_encoder(const std::string& elementType, long emptyValue)
+: m_ElementType(elementType)
+, m_EmptyValue(emptyValue) {
+}
+
+/// \brief Returns the smallest standard integer type in C that can hold values in the specified range
+std::string c_array_encoder::smallest_type(long minValue, long maxValue) {
+    if (minValue >= 0) {
+        if (maxValue <= 0xff)   return "unsigned char";
+        if (maxValue <= 0xffff) return "unsigned short";
+        return "unsigned long";
+    }
+    
+    if (minValue >= -0x80 && maxValue <= 0x7f)      return "signed char";
+    if (minValue >= -0x8000 && maxValue <= 0x7fff)  return "short";
+    return "long";
+}
+
+/// \brief The type of the elements used when writing the specified table
+std::string c_array_encoder::element_type(const output_table& table) const {
+    if (!m_ElementType.empty()) return m_ElementType;
+    return smallest_type(table.min_value(), table.max_value());
+}
+
+/// \brief Writes out the specified table
+void c_array_encoder::write(const output_table& table, std::ostream& output) const {
+    // Build the text of the table and write it in one go (about 8 characters per entry is usually enough)
+    string text;
+    text.reserve(64 + table.size() * 8);
+    
+    text += "\nstatic const ";
+    text += element_type(table);
+    text += " ";
+    text += table.name();
+    text += "[] = {";
+    
+    for (size_t pos = 0; pos < table.size(); ++pos) {
+        // Add newlines
+        if ((pos % 16) == 0) {
+            text += "\n        ";
+        }
+        
+        // Write out this entry
+        append_int(text, table[pos]);
+        if (pos+1 < table.size()) {
+            text += ", ";
+        }
+    }
+    
+    // Always write at least one entry so the array is valid
+    if (table.empty()) {
+        text += "\n        ";
+        append_int(text, m_EmptyValue);
+    }
+    
+    text += "\n    };\n";
+    
+    output.write(text.data(), (streamsize) text.size());
+}
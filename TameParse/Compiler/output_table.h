@@ -0,0 +1,147 @@
+//
+//  output_table.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _COMPILER_OUTPUT_TABLE_H
+#define _COMPILER_OUTPUT_TABLE_H
+
+#include <string>
+#include <vector>
+#include <iostream>
+
+namespace compiler {
+    /// \brief Appends the decimal representation of a value to a string
+    ///
+    /// Generated tables can contain millions of values, and this is much faster than formatting each of them with an
+    /// ostream. Code that writes large tables builds up their text with this and then writes it out in one go.
+    void append_int(std::string& text, long value);
+    
+    ///
+    /// \brief A table of integers that an output stage writes out as part of a generated parser
+    ///
+    /// Output stages fill these in from the lexer and parser data (see the build_ functions in output_stage), and then
+    /// write them with a table_encoder. Separating the two means that the way that tables are represented in the
+    /// generated code can be changed without changing the code that works out what they contain.
+    ///
+    class output_table {
+    public:
+        typedef std::vector<long>           value_list;
+        typedef value_list::const_iterator  iterator;
+    
+    private:
+        /// \brief The name of this table in the generated code
+        std::string m_Name;
+        
+        /// \brief The values in this table
+        value_list m_Values;
+    
+    public:
+        /// \brief Creates an empty table
+        explicit output_table(const std::string& name = std::string());
+        
+        /// \brief The name of this table in the generated code
+        inline const std::string& name() const { return m_Name; }
+        
+        /// \brief Changes the name of this table
+        inline void set_name(const std::string& name) { m_Name = name; }
+        
+        /// \brief Adds a value to the end of this table
+        inline void push_back(long value) { m_Values.push_back(value); }
+        
+        /// \brief Sets the values in this table to count copies of value
+        inline void assign(size_t count, long value) { m_Values.assign(count, value); }
+        
+        /// \brief The value at the specified index
+        inline long& operator[](size_t index) { return m_Values[index]; }
+        
+        /// \brief The value at the specified index
+        inline long operator[](size_t index) const { return m_Values[index]; }
+        
+        /// \brief The number of values in this table
+        inline size_t size() const { return m_Values.size(); }
+        
+        /// \brief True if this table has no values
+        inline bool empty() const { return m_Values.empty(); }
+        
+        /// \brief The first value in this table
+        inline iterator begin() const { return m_Values.begin(); }
+        
+        /// \brief The value after the last value in this table
+        inline iterator end() const { return m_Values.end(); }
+        
+        /// \brief The smallest value in this table (0 if it is empty)
+        long min_value() const;
+        
+        /// \brief The largest value in this table (0 if it is empty)
+        long max_value() const;
+    };
+    
+    ///
+    /// \brief Writes output tables as source code
+    ///
+    /// Each strategy for representing a table is a subclass, so that new ones can be added (and compared) without
+    /// changing the output stages that use them.
+    ///
+    class table_encoder {
+    public:
+        /// \brief Destructor
+        virtual ~table_encoder();
+        
+        /// \brief The type of the elements used when writing the specified table
+        virtual std::string element_type(const output_table& table) const = 0;
+        
+        /// \brief Writes out the specified table
+        virtual void write(const output_table& table, std::ostream& output) const = 0;
+    };
+    
+    ///
+    /// \brief Writes tables as static constant arrays in C or C++
+    ///
+    /// The elements can have a fixed type, or use the smallest standard integer type that can hold every value in the
+    /// table. Smaller tables take less space in the cache, at the cost of a conversion when they are read.
+    ///
+    class c_array_encoder : public table_encoder {
+    private:
+        /// \brief The type of the elements, or the empty string to use the smallest type that will fit
+        std::string m_ElementType;
+        
+        /// \brief The value written out for tables with no entries (C doesn't allow empty arrays)
+        long m_EmptyValue;
+    
+    public:
+        /// \brief Creates an encoder for arrays with the specified element type (empty to use the smallest type)
+        explicit c_array_encoder(const std::string& elementType = std::string(), long emptyValue = 0);
+        
+        /// \brief Returns the smallest standard integer type in C that can hold values in the specified range
+        static std::string smallest_type(long minValue, long maxValue);
+        
+        /// \brief The type of the elements used when writing the specified table
+        virtual std::string element_type(const output_table& table) const;
+        
+        /// \brief Writes out the specified table
+        virtual void write(const output_table& table, std::ostream& output) const;
+    };
+}
+
+#endif
@@ -0,0 +1,204 @@
+//
+//  parser_profile_stage.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#include <sstream>
+
+#include "TameParse/Compiler/parser_profile_stage.h"
+#include "TameParse/Lr/counting_parser_trace.h"
+#include "TameParse/Util/utf8reader.h"
+
+using namespace std;
+using namespace util;
+using namespace dfa;
+using namespace lr;
+using namespace compiler;
+
+/// \brief The first line of a parser profile file
+static const char* c_ProfileHeader = "# TameParse parser profile";
+
+/// \brief Parser that counts the states that are used
+typedef parser<int, simple_parser_actions, counting_parser_trace> counting_parser;
+
+/// \brief Creates a new profile stage for the specified lexer and parser
+parser_profile_stage::parser_profile_stage(console_container& console, const std::wstring& filename, lexer_stage* lexer, lr_parser_stage* parser)
+: compilation_stage(console, filename)
+, m_Lexer(lexer)
+, m_Parser(parser) {
+}
+
+/// \brief Collects the state frequencies and renumbers the parser tables
+void parser_profile_stage::compile() {
+    // Find out what we've been asked to do
+    wstring         profileFile = cons().get_option(L"parser-profile");
+    wstring         writeFile   = cons().get_option(L"write-parser-profile");
+    vector<wstring> inputFiles  = cons().get_option_list(L"parser-profile-input");
+    
+    if (profileFile.empty() && writeFile.empty() && inputFiles.empty()) return;
+    
+    // Sanity check
+    if (!m_Lexer || !m_Lexer->get_lexer() || !m_Parser || !m_Parser->get_tables()) {
+        cons().report_error(error(error::sev_bug, filename(), L"BUG_PROFILE_BAD_PARAMETERS", L"Missing lexer or parser for the parser profile stage", position(-1, -1, -1)));
+        return;
+    }
+    
+    cons().verbose_stream() << L"  = Profiling parser states" << endl;
+    profile_scope profile(cons(), L"parser_profile", filename());
+    
+    m_Frequencies.clear();
+    
+    // Load the profile from an earlier run
+    if (!profileFile.empty()) {
+        istream* source = cons().open_file(profileFile);
+        
+        if (!source) {
+            cons().report_error(error(error::sev_error, profileFile, L"CANT_OPEN_PARSER_PROFILE", L"Could not open the parser profile", position(-1, -1, -1)));
+        } else if (!read_profile(*source, m_Frequencies)) {
+            cons().report_error(error(error::sev_error, profileFile, L"INVALID_PARSER_PROFILE", L"The parser profile is not in a valid format", position(-1, -1, -1)));
+        }
+        
+        delete source;
+    }
+    
+    // Parse the sample input
+    for (vector<wstring>::const_iterator inputFile = inputFiles.begin(); inputFile != inputFiles.end(); ++inputFile) {
+        profile_input(*inputFile);
+    }
+    
+    // Save the results if requested
+    if (!writeFile.empty()) {
+        ostream* target = cons().open_binary_file_for_writing(writeFile);
+        
+        if (target && !target->fail()) {
+            write_profile(*target, m_Frequencies);
+        }
+        
+        if (!target || target->fail()) {
+            cons().report_error(error(error::sev_error, writeFile, L"CANT_WRITE_PARSER_PROFILE", L"Could not write the parser profile", position(-1, -1, -1)));
+        }
+        
+        delete target;
+    }
+    
+    // Reorder the states
+    if (!m_Parser->order_states_by_frequency(m_Frequencies)) {
+        cons().report_error(error(error::sev_bug, filename(), L"BUG_CANT_RENUMBER_STATES", L"Could not renumber the parser states", position(-1, -1, -1)));
+        return;
+    }
+    
+    cons().verbose_stream() << L"    Number of profiled states:              " << m_Frequencies.size() << endl;
+    
+    profile->add_counter(L"input_files", (long) inputFiles.size());
+    profile->add_counter(L"profiled_states", (long) m_Frequencies.size());
+}
+
+/// \brief Parses a sample file, adding the states that are used to the frequency map
+void parser_profile_stage::profile_input(const std::wstring& inputFile) {
+    istream* source = cons().open_file(inputFile);
+    if (!source) {
+        cons().report_error(error(error::sev_error, inputFile, L"CANT_OPEN_PARSER_PROFILE_INPUT", L"Could not open the sample input for the parser profile", position(-1, -1, -1)));
+        return;
+    }
+    
+    // Read in as UTF-8
+    utf8reader      reader(source, true);
+    wstringstream   text;
+    
+    for (;;) {
+        wchar_t nextChar;
+        reader.get(nextChar);
+        
+        if (!reader.good()) break;
+        
+        text << nextChar;
+    }
+    
+    // Parse the input, counting the states as we go
+    parser_counters& counters = parser_counters::current();
+    counters.reset();
+    
+    counting_parser         parser(m_Parser->get_tables(), false);
+    counting_parser::state* parseState = parser.create_parser(new simple_parser_actions(m_Lexer->get_lexer()->create_stream_from(text)));
+    
+    if (!parseState->parse()) {
+        // The states used before the error are still counted
+        position errorPos(-1, -1, -1);
+        if (parseState->look().item()) {
+            errorPos = parseState->look()->pos();
+        }
+        
+        cons().report_error(error(error::sev_warning, inputFile, L"PARSER_PROFILE_INPUT_REJECTED", L"The sample input for the parser profile contains a syntax error", errorPos));
+    }
+    
+    delete parseState;
+    
+    for (parser_counters::count_map::const_iterator state = counters.statesEntered.begin(); state != counters.statesEntered.end(); ++state) {
+        m_Frequencies[state->first] += state->second;
+    }
+    
+    counters.reset();
+}
+
+/// \brief Writes a set of frequencies to a stream in the format read by read_profile
+void parser_profile_stage::write_profile(std::ostream& target, const frequency_map& frequencies) {
+    target << c_ProfileHeader << "\n";
+    
+    for (frequency_map::const_iterator state = frequencies.begin(); state != frequencies.end(); ++state) {
+        target << state->first << " " << state->second << "\n";
+    }
+}
+
+/// \brief Adds the frequencies stored in a stream to a frequency map, returning false if the stream is not a valid profile
+bool parser_profile_stage::read_profile(std::istream& source, frequency_map& frequencies) {
+    // Check the header
+    string line;
+    if (!getline(source, line) || line != c_ProfileHeader) return false;
+    
+    // Read the frequencies for each state
+    frequency_map result;
+    
+    while (getline(source, line)) {
+        // Ignore blank lines
+        if (line.find_first_not_of(" \t\r") == string::npos) continue;
+        
+        istringstream   lineStream(line);
+        int             stateId;
+        long            count;
+        string          trailing;
+        
+        if (!(lineStream >> stateId >> count))  return false;
+        if (lineStream >> trailing)             return false;
+        if (stateId < 0 || count < 0)           return false;
+        
+        result[stateId] += count;
+    }
+    
+    // Only merge the profile if it was valid
+    for (frequency_map::const_iterator state = result.begin(); state != result.end(); ++state) {
+        frequencies[state->first] += state->second;
+    }
+    
+    return true;
+}
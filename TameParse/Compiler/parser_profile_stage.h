@@ -0,0 +1,90 @@
+//
+//  parser_profile_stage.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _COMPILER_PARSER_PROFILE_STAGE_H
+#define _COMPILER_PARSER_PROFILE_STAGE_H
+
+#include <iosfwd>
+#include <map>
+#include <string>
+
+#include "TameParse/Compiler/compilation_stage.h"
+#include "TameParse/Compiler/lexer_stage.h"
+#include "TameParse/Compiler/lr_parser_stage.h"
+
+namespace compiler {
+    ///
+    /// \brief Compilation stage that renumbers the states of a parser according to how often they are used
+    ///
+    /// The frequencies are collected by parsing the sample files named by the 'parser-profile-input' option, and from a
+    /// profile written by an earlier run and named by the 'parser-profile' option. The combined frequencies can be saved
+    /// for later runs using the 'write-parser-profile' option. The most frequently used states are then moved next to
+    /// each other in the parser tables, so a generated parser touches fewer cache lines for typical input.
+    ///
+    /// Profiles refer to states by their number before the tables were renumbered, so they only apply to the same
+    /// grammar compiled with the same options.
+    ///
+    class parser_profile_stage : public compilation_stage {
+    public:
+        /// \brief Maps state IDs to the number of times they were used
+        typedef std::map<int, long> frequency_map;
+        
+    private:
+        /// \brief The lexer stage that supplies the lexer for the sample input
+        lexer_stage* m_Lexer;
+        
+        /// \brief The parser stage whose tables should be renumbered
+        lr_parser_stage* m_Parser;
+        
+        /// \brief The combined frequencies for each state
+        frequency_map m_Frequencies;
+        
+    public:
+        /// \brief Creates a new profile stage for the specified lexer and parser
+        parser_profile_stage(console_container& console, const std::wstring& filename, lexer_stage* lexer, lr_parser_stage* parser);
+        
+        /// \brief Collects the state frequencies and renumbers the parser tables
+        ///
+        /// This does nothing if none of the profile options are set.
+        virtual void compile();
+        
+        /// \brief The frequency of each state found by compile()
+        inline const frequency_map& frequencies() const { return m_Frequencies; }
+        
+    public:
+        /// \brief Writes a set of frequencies to a stream in the format read by read_profile
+        static void write_profile(std::ostream& target, const frequency_map& frequencies);
+        
+        /// \brief Adds the frequencies stored in a stream to a frequency map, returning false if the stream is not a valid profile
+        static bool read_profile(std::istream& source, frequency_map& frequencies);
+        
+    private:
+        /// \brief Parses a sample file, adding the states that are used to the frequency map
+        void profile_input(const std::wstring& inputFile);
+    };
+}
+
+#endif
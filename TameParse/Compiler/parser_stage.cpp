@@ -27,6 +27,7 @@
 
 #include <iostream>
 #include <sstream>
+#include <iterator>
 
 #include "TameParse/Util/utf8reader.h"
 #include "TameParse/Language/language_parser.h"
@@ -38,28 +39,83 @@ using namespace dfa;
 using namespace language;
 using namespace compiler;
 
-/// \brief Creates a new compilation stage which will use the specified console object
-parser_stage::parser_stage(console_container& console, const std::wstring& filename) 
-: compilation_stage(console, filename) {
+/// \brief Creates an empty cache
+parser_stage::definition_cache::definition_cache(size_t maxEntries)
+: m_MaxEntries(maxEntries) {
+}
+
+/// \brief Finds the definition parsed from the file with the specified path, provided that it had the same text
+bool parser_stage::definition_cache::find(const std::wstring& realPath, const std::string& text, definition_file_container& result) const {
+#if __cplusplus >= 201103L
+    std::lock_guard<std::mutex> lock(m_Lock);
+#endif
+    
+    map<wstring, entry>::const_iterator found = m_Entries.find(realPath);
+    if (found == m_Entries.end() || found->second.first != text) return false;
+    
+    result = found->second.second;
+    return true;
+}
+
+/// \brief Stores the definition parsed from the specified text of a file
+void parser_stage::definition_cache::store(const std::wstring& realPath, const std::string& text, const definition_file_container& definition) {
+#if __cplusplus >= 201103L
+    std::lock_guard<std::mutex> lock(m_Lock);
+#endif
+    
+    // Start again if the cache is full
+    if (m_Entries.size() >= m_MaxEntries && m_Entries.find(realPath) == m_Entries.end()) {
+        m_Entries.clear();
+    }
+    
+    m_Entries[realPath] = entry(text, definition);
+}
+
+/// \brief Creates a new compilation stage which will use the specified console object (and cache, if it's not NULL)
+parser_stage::parser_stage(console_container& console, const std::wstring& filename, definition_cache* cache) 
+: compilation_stage(console, filename)
+, m_Cache(cache) {
+}
+
+/// \brief Destructor
+parser_stage::~parser_stage() {
 }
 
 /// \brief Performs the actions associated with this compilation stage
 void parser_stage::compile() {
     // Message to say what we're doing
     cons().verbose_stream() << "  = Reading " << filename() << endl;
+    profile_scope profile(cons(), L"parser", filename());
 
     // Try to open the file
     istream* fileStream = cons().open_file(filename());
     
     // Report an error if the file could not be opened
     if (!fileStream || !fileStream->good()) {
+        delete fileStream;
         cons().report_error(error(error::sev_fatal, filename(), L"CANT_OPEN_FILE", L"Cannot read from file", position(-1, -1, -1)));
         return;
     }
     
+    // Read in the text of the file
+    string text((istreambuf_iterator<char>(*fileStream)), istreambuf_iterator<char>());
+    delete fileStream;
+    
+    // Use the cached definition if the file hasn't changed since it was last parsed
+    wstring realPath;
+    if (m_Cache) {
+        realPath = cons().real_path(filename());
+        
+        if (m_Cache->find(realPath, text, m_Definition)) {
+            profile->add_counter(L"cached", 1);
+            return;
+        }
+    }
+    
     // Attempt to parse the file
     m_Parser.set_filename(filename());
-    bool parsedOk = m_Parser.parse(*fileStream);
+    bool parsedOk   = m_Parser.parse(text);
+    m_Definition    = m_Parser.file_definition();
     
     // Report an error if we failed to parse OK
     if (!parsedOk) {
@@ -80,5 +136,7 @@ void parser_stage::compile() {
     }
     
     // Done
-    delete fileStream;
+    if (m_Cache) {
+        m_Cache->store(realPath, text, m_Definition);
+    }
 }
@@ -28,6 +28,13 @@
 #ifndef _COMPILER_PARSER_STAGE_H
 #define _COMPILER_PARSER_STAGE_H
 
+#include <map>
+#include <string>
+
+#if __cplusplus >= 201103L
+#include <mutex>
+#endif
+
 #include "TameParse/Compiler/compilation_stage.h"
 #include "TameParse/Language/language_parser.h"
 
@@ -36,19 +43,69 @@ namespace compiler {
     /// \brief Compiler stage that reads in and translates a file
     ///
     class parser_stage : public compilation_stage {
+    public:
+        ///
+        /// \brief Definition files that have already been parsed, along with the text that they were parsed from
+        ///
+        /// Processes that stay resident between compilations (such as the compile server) can share one of these
+        /// between their parser stages, so that a file is only parsed again if its contents have changed. Only files
+        /// that parsed without errors are stored. Once the cache holds the maximum number of files, it is emptied
+        /// before adding a new one. This can be used by several threads at once.
+        ///
+        class definition_cache {
+        private:
+            /// \brief The text of a file, and the definition parsed from it
+            typedef std::pair<std::string, language::definition_file_container> entry;
+            
+            /// \brief The files in the cache, indexed by their real paths
+            std::map<std::wstring, entry> m_Entries;
+            
+            /// \brief The largest number of files to keep
+            size_t m_MaxEntries;
+            
+#if __cplusplus >= 201103L
+            /// \brief Protects m_Entries
+            mutable std::mutex m_Lock;
+#endif
+            
+            definition_cache(const definition_cache& noCopying);
+            definition_cache& operator=(const definition_cache& noCopying);
+            
+        public:
+            /// \brief Creates an empty cache
+            explicit definition_cache(size_t maxEntries = 256);
+            
+            /// \brief Finds the definition parsed from the file with the specified path, provided that it had the same text
+            ///
+            /// Returns false if there is no such definition.
+            bool find(const std::wstring& realPath, const std::string& text, language::definition_file_container& result) const;
+            
+            /// \brief Stores the definition parsed from the specified text of a file
+            void store(const std::wstring& realPath, const std::string& text, const language::definition_file_container& definition);
+        };
+        
     private:
         /// \brief The language parser object
         language::language_parser m_Parser;
         
-    public:
-        /// \brief Creates a new compilation stage which will use the specified console object
-        parser_stage(console_container& console, const std::wstring& filename);
+        /// \brief The definition produced by this stage
+        language::definition_file_container m_Definition;
         
+        /// \brief NULL, or the cache of files that have already been parsed
+        definition_cache* m_Cache;
+
+    public:
+        /// \brief Creates a new compilation stage which will use the specified console object (and cache, if it's not NULL)
+        parser_stage(console_container& console, const std::wstring& filename, definition_cache* cache = NULL);
+
+        /// \brief Destructor
+        virtual ~parser_stage();
+
         /// \brief Performs the actions associated with this compilation stage
         virtual void compile();
-        
+
         /// \brief The definition produced by this stage
-        inline language::definition_file_container definition_file() { return m_Parser.file_definition(); }
+        inline language::definition_file_container definition_file() { return m_Definition; }
     };
 }
 
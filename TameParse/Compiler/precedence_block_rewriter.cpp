@@ -73,6 +73,12 @@ precedence_block_rewriter::precedence_block_rewriter(const contextfree::terminal
             // Can't add symbols that don't have an identifier
             if (symbol < 0) continue;
 
+            // Make space for this symbol
+            if ((size_t) symbol >= m_TerminalPrecedence.size()) {
+                m_TerminalPrecedence.resize(symbol + 1, no_precedence);
+                m_TerminalAssociativity.resize(symbol + 1, nonassociative);
+            }
+
             // Add this symbol
             m_TerminalPrecedence[symbol]    = currentPrecedence;
             m_TerminalAssociativity[symbol] = assoc;
@@ -97,9 +103,9 @@ int precedence_block_rewriter::get_precedence(const contextfree::item_container&
     }
 
     // Try to fetch the precedence for this symbol
-    map<int, int>::const_iterator found = m_TerminalPrecedence.find(terminal->symbol());
-    if (found != m_TerminalPrecedence.end()) {
-        return found->second;
+    int symbol = terminal->symbol();
+    if (symbol >= 0 && (size_t) symbol < m_TerminalPrecedence.size()) {
+        return m_TerminalPrecedence[symbol];
     } else {
         return precedence_rewriter::no_precedence;
     }
@@ -118,10 +124,10 @@ precedence_rewriter::associativity precedence_block_rewriter::get_associativity(
         return precedence_rewriter::nonassociative;
     }
 
-    // Try to fetch the precedence for this symbol
-    map<int, associativity>::const_iterator found = m_TerminalAssociativity.find(terminal->symbol());
-    if (found != m_TerminalAssociativity.end()) {
-        return found->second;
+    // Try to fetch the associativity for this symbol
+    int symbol = terminal->symbol();
+    if (symbol >= 0 && (size_t) symbol < m_TerminalAssociativity.size()) {
+        return m_TerminalAssociativity[symbol];
     } else {
         return precedence_rewriter::nonassociative;
     }
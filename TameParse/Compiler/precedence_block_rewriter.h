@@ -28,7 +28,7 @@
 #ifndef _COMPILER_PRECEDENCE_BLOCK_REWRITER_H
 #define _COMPILER_PRECEDENCE_BLOCK_REWRITER_H
 
-#include <map>
+#include <vector>
 
 #include "TameParse/ContextFree/terminal_dictionary.h"
 #include "TameParse/Lr/precedence_rewriter.h"
@@ -40,11 +40,11 @@ namespace compiler {
     ///
     class precedence_block_rewriter : public lr::precedence_rewriter {
     private:
-        /// \brief Maps terminal symbols to their precedence
-        std::map<int, int> m_TerminalPrecedence;
+        /// \brief The precedence of each terminal symbol, indexed by symbol identifier
+        std::vector<int> m_TerminalPrecedence;
 
-        /// \brief Maps terminal symbols to their associativity
-        std::map<int, associativity> m_TerminalAssociativity;
+        /// \brief The associativity of each terminal symbol, indexed by symbol identifier
+        std::vector<associativity> m_TerminalAssociativity;
 
     public:
         /// \brief Construcuts a new rewriter by interpreting a language block
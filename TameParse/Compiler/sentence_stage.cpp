@@ -0,0 +1,231 @@
+//
+//  sentence_stage.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include <cstdlib>
+#include <memory>
+#include <sstream>
+
+#include "TameParse/Compiler/sentence_stage.h"
+#include "TameParse/ContextFree/sentence_generator.h"
+#include "TameParse/Dfa/lexeme_samples.h"
+
+using namespace std;
+using namespace util;
+using namespace dfa;
+using namespace contextfree;
+using namespace lr;
+using namespace compiler;
+
+/// \brief The number of samples to find for each terminal
+static const int c_SamplesPerTerminal = 4;
+
+/// \brief The number of sentences to try before giving up on finding one that the parser accepts
+static const int c_MaxAttempts = 8;
+
+/// \brief The number of terminals on each line, if the lexer ignores line breaks
+static const int c_TerminalsPerLine = 12;
+
+/// \brief Reads a numeric option, returning the default value if it isn't set or is out of range
+static long numeric_option(console& cons, const wstring& name, long defaultValue, long minValue) {
+    wstring value = cons.get_option(name);
+    if (value.empty()) return defaultValue;
+    
+    long result = wcstol(value.c_str(), NULL, 10);
+    if (result < minValue) return defaultValue;
+    
+    return result;
+}
+
+/// \brief Writes a string to a stream as UTF-8
+static void write_utf8(ostream& target, const wstring& text) {
+    for (wstring::const_iterator nextChar = text.begin(); nextChar != text.end(); ++nextChar) {
+        unsigned int codePoint = (unsigned int) *nextChar;
+        
+        if (codePoint < 0x80) {
+            target.put((char) codePoint);
+        } else if (codePoint < 0x800) {
+            target.put((char) (0xc0 | (codePoint >> 6)));
+            target.put((char) (0x80 | (codePoint & 0x3f)));
+        } else if (codePoint < 0x10000) {
+            target.put((char) (0xe0 | (codePoint >> 12)));
+            target.put((char) (0x80 | ((codePoint >> 6) & 0x3f)));
+            target.put((char) (0x80 | (codePoint & 0x3f)));
+        } else {
+            target.put((char) (0xf0 | (codePoint >> 18)));
+            target.put((char) (0x80 | ((codePoint >> 12) & 0x3f)));
+            target.put((char) (0x80 | ((codePoint >> 6) & 0x3f)));
+            target.put((char) (0x80 | (codePoint & 0x3f)));
+        }
+    }
+}
+
+/// \brief Creates a stage that will write a sentence for the specified start symbol to the specified file
+sentence_stage::sentence_stage(console_container& console, const std::wstring& filename, language_stage* language, lexer_stage* lexer, lr_parser_stage* parser, const std::wstring& startSymbol, const std::wstring& targetFile)
+: compilation_stage(console, filename)
+, m_Language(language)
+, m_Lexer(lexer)
+, m_Parser(parser)
+, m_StartSymbol(startSymbol)
+, m_TargetFile(targetFile) {
+}
+
+/// \brief True if the parser accepts the specified text
+bool sentence_stage::accepts(const std::wstring& text, position& failPos) {
+    simple_parser           parser(m_Parser->get_tables(), false);
+    wstringstream           source(text);
+    simple_parser::state*   parseState  = parser.create_parser(new simple_parser_actions(m_Lexer->get_lexer()->create_stream_from(source)));
+    bool                    result      = parseState->parse();
+    
+    if (!result && parseState->look().item()) {
+        failPos = parseState->look()->pos();
+    }
+    
+    delete parseState;
+    return result;
+}
+
+/// \brief Generates the sentence and writes it to the target file
+void sentence_stage::compile() {
+    // Sanity check
+    if (!m_Language || !m_Lexer || !m_Lexer->dfa() || !m_Lexer->get_lexer() || !m_Parser || !m_Parser->get_tables()) {
+        cons().report_error(error(error::sev_bug, filename(), L"BUG_SENTENCE_BAD_PARAMETERS", L"Missing language, lexer or parser for the sentence generator", position(-1, -1, -1)));
+        return;
+    }
+    
+    cons().verbose_stream() << L"  = Generating a sentence" << endl;
+    profile_scope profile(cons(), L"sentence", filename());
+    
+    // The start symbol must be defined
+    grammar& gram = *m_Language->grammar();
+    if (!gram.nonterminal_is_defined(m_StartSymbol)) {
+        wstringstream msg;
+        msg << L"Can't generate a sentence for the undefined nonterminal '" << m_StartSymbol << L"'";
+        cons().report_error(error(error::sev_error, filename(), L"SENTENCE_UNDEFINED_START", msg.str(), position(-1, -1, -1)));
+        return;
+    }
+    
+    item_container start = gram.get_nonterminal(m_StartSymbol);
+    
+    // Find the samples for each terminal that the lexer can produce
+    const keyword_table*    keywords = m_Lexer->keywords().empty() ? NULL : &m_Lexer->keywords();
+    lexeme_samples          samples(*m_Lexer->dfa(), c_SamplesPerTerminal, keywords);
+    set<int>                terminals;
+    
+    for (lexeme_samples::iterator symbol = samples.begin(); symbol != samples.end(); ++symbol) {
+        terminals.insert(symbol->first);
+    }
+    
+    // Separate the terminals with the shortest symbol that the parser always ignores, preferring a single space
+    const set<int>* ignored     = m_Language->ignored_symbols();
+    const set<int>* usedIgnored = m_Language->used_ignored_symbols();
+    wstring         separator;
+    bool            foundSeparator = false;
+    
+    for (set<int>::const_iterator ignoredSymbol = ignored->begin(); ignoredSymbol != ignored->end(); ++ignoredSymbol) {
+        if (usedIgnored->find(*ignoredSymbol) != usedIgnored->end()) continue;
+        
+        const lexeme_samples::sample_list& ignoredSamples = samples.samples_for_symbol(*ignoredSymbol);
+        for (lexeme_samples::sample_list::const_iterator sample = ignoredSamples.begin(); sample != ignoredSamples.end(); ++sample) {
+            wstring text(sample->begin(), sample->end());
+            
+            if (!foundSeparator || text.size() < separator.size() || (text == L" " && separator != L" ")) {
+                separator       = text;
+                foundSeparator  = true;
+            }
+        }
+    }
+    
+    int     newline     = '\n';
+    int     newlineSym  = samples.symbol_for(&newline, &newline + 1);
+    bool    lineBreaks  = foundSeparator && ignored->find(newlineSym) != ignored->end() && usedIgnored->find(newlineSym) == usedIgnored->end();
+    
+    // Generate sentences until one is accepted by the parser
+    sentence_generator generator(gram, terminals, (unsigned int) numeric_option(cons(), L"sentence-seed", 1, 0));
+    generator.set_max_depth((int) numeric_option(cons(), L"sentence-depth", 8, 1));
+    
+    size_t      targetSize  = (size_t) numeric_option(cons(), L"sentence-size", 1000, 1);
+    vector<int> sentence;
+    bool        accepted    = false;
+    position    failPos(-1, -1, -1);
+    int         attemptNum;
+    
+    for (attemptNum = 0; attemptNum < c_MaxAttempts && !accepted; ++attemptNum) {
+        sentence.clear();
+        if (!generator.generate(*start, targetSize, sentence)) {
+            wstringstream msg;
+            msg << L"The nonterminal '" << m_StartSymbol << L"' can't generate any sentences that the lexer can match";
+            cons().report_error(error(error::sev_error, filename(), L"SENTENCE_NOT_POSSIBLE", msg.str(), position(-1, -1, -1)));
+            return;
+        }
+        
+        // Use the samples for each terminal in turn
+        map<int, size_t>    nextSample;
+        wstringstream       text;
+        
+        for (size_t terminalNum = 0; terminalNum < sentence.size(); ++terminalNum) {
+            if (terminalNum > 0) {
+                if (lineBreaks && terminalNum % c_TerminalsPerLine == 0) {
+                    text << L'\n';
+                } else {
+                    text << separator;
+                }
+            }
+            
+            const lexeme_samples::sample_list&  terminalSamples = samples.samples_for_symbol(sentence[terminalNum]);
+            const lexeme_samples::sample&       sample          = terminalSamples[nextSample[sentence[terminalNum]]++ % terminalSamples.size()];
+            
+            for (lexeme_samples::sample::const_iterator symbol = sample.begin(); symbol != sample.end(); ++symbol) {
+                text << (wchar_t) *symbol;
+            }
+        }
+        
+        if (lineBreaks) text << L'\n';
+        
+        m_Sentence  = text.str();
+        accepted    = accepts(m_Sentence, failPos);
+    }
+    
+    if (!accepted) {
+        cons().report_error(error(error::sev_warning, m_TargetFile, L"SENTENCE_REJECTED", L"The parser did not accept any of the generated sentences: the last one will be written anyway", failPos));
+    }
+    
+    // Write out the sentence
+    auto_ptr<ostream> target(cons().open_binary_file_for_writing(m_TargetFile));
+    if (target.get() && !target->fail()) {
+        write_utf8(*target, m_Sentence);
+    }
+    
+    if (!target.get() || target->fail()) {
+        cons().report_error(error(error::sev_error, m_TargetFile, L"CANT_WRITE_SENTENCE", L"Could not write the generated sentence", position(-1, -1, -1)));
+        return;
+    }
+    
+    cons().verbose_stream() << L"    Number of terminals in the sentence:    " << sentence.size() << endl;
+    cons().verbose_stream() << L"    Number of characters in the sentence:   " << m_Sentence.size() << endl;
+    
+    profile->add_counter(L"terminals", (long) sentence.size());
+    profile->add_counter(L"characters", (long) m_Sentence.size());
+    profile->add_counter(L"attempts", (long) attemptNum);
+}
@@ -0,0 +1,88 @@
+//
+//  sentence_stage.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _COMPILER_SENTENCE_STAGE_H
+#define _COMPILER_SENTENCE_STAGE_H
+
+#include <string>
+
+#include "TameParse/Compiler/compilation_stage.h"
+#include "TameParse/Compiler/language_stage.h"
+#include "TameParse/Compiler/lexer_stage.h"
+#include "TameParse/Compiler/lr_parser_stage.h"
+
+namespace compiler {
+    ///
+    /// \brief Compilation stage that writes a randomly generated sentence in a language to a file
+    ///
+    /// The terminals of the sentence come from a contextfree::sentence_generator, and the text for each terminal is
+    /// taken in turn from the samples that the lexer DFA has for it. The terminals are separated by the shortest
+    /// symbol that the parser always ignores (usually a space), with a line break every few terminals if the lexer
+    /// ignores those too. Each sentence is checked by parsing it, and another one is generated if the parser rejects
+    /// it (which can happen for languages that use guards).
+    ///
+    /// The 'sentence-size' option sets the target number of terminals (1000 by default), 'sentence-depth' sets how
+    /// many times a nonterminal can be nested inside itself (8 by default), and 'sentence-seed' chooses a different
+    /// sentence. The same options always produce the same sentence.
+    ///
+    class sentence_stage : public compilation_stage {
+    private:
+        /// \brief The language that the sentence is generated from
+        language_stage* m_Language;
+        
+        /// \brief The lexer stage that supplies the samples for each terminal
+        lexer_stage* m_Lexer;
+        
+        /// \brief The parser stage used to check the sentence
+        lr_parser_stage* m_Parser;
+        
+        /// \brief The nonterminal to generate a sentence for
+        std::wstring m_StartSymbol;
+        
+        /// \brief The file that the sentence is written to
+        std::wstring m_TargetFile;
+        
+        /// \brief The sentence that was generated
+        std::wstring m_Sentence;
+    
+    public:
+        /// \brief Creates a stage that will write a sentence for the specified start symbol to the specified file
+        ///
+        /// The parser must be built for the same start symbol (as its first start symbol).
+        sentence_stage(console_container& console, const std::wstring& filename, language_stage* language, lexer_stage* lexer, lr_parser_stage* parser, const std::wstring& startSymbol, const std::wstring& targetFile);
+        
+        /// \brief Generates the sentence and writes it to the target file
+        virtual void compile();
+        
+        /// \brief The sentence generated by compile()
+        inline const std::wstring& sentence() const { return m_Sentence; }
+    
+    private:
+        /// \brief True if the parser accepts the specified text
+        bool accepts(const std::wstring& text, dfa::position& failPos);
+    };
+}
+
+#endif
@@ -0,0 +1,171 @@
+//
+//  stage_profile.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#include <cstdio>
+#include <iomanip>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+#include "TameParse/Compiler/stage_profile.h"
+#include "TameParse/Compiler/console.h"
+
+using namespace std;
+using namespace compiler;
+
+/// \brief Creates a profile for the specified stage, and starts timing it
+stage_profile::stage_profile(const std::wstring& stage, const std::wstring& filename, const std::wstring& language)
+: m_Stage(stage)
+, m_Filename(filename)
+, m_Language(language)
+, m_Seconds(0)
+, m_EarlierSeconds(0)
+, m_PeakMemory(-1) {
+}
+
+/// \brief Stops timing the stage, and records the peak memory used so far
+void stage_profile::finish() {
+    m_Seconds       = m_Stopwatch.seconds() + m_EarlierSeconds;
+    m_PeakMemory    = peak_process_memory();
+}
+
+/// \brief Adds time spent on the stage before this profile was created (for stages that run in several parts)
+void stage_profile::add_seconds(double seconds) {
+    m_EarlierSeconds += seconds;
+}
+
+/// \brief Adds a counter to this profile
+void stage_profile::add_counter(const std::wstring& name, long value) {
+    m_Counters.push_back(counter(name, value));
+}
+
+/// \brief Adds a timing (in seconds) to this profile
+void stage_profile::add_timing(const std::wstring& name, double seconds) {
+    m_Timings.push_back(timing(name, seconds));
+}
+
+/// \brief The peak memory (resident set size) used by this process so far, in bytes, or -1 if this is not available
+long stage_profile::peak_process_memory() {
+#if defined(__unix__) || defined(__APPLE__)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return -1;
+    
+#if defined(__APPLE__)
+    // OS X reports the size in bytes...
+    return (long) usage.ru_maxrss;
+#else
+    // ... everything else uses kilobytes
+    return (long) usage.ru_maxrss * 1024;
+#endif
+#else
+    return -1;
+#endif
+}
+
+/// \brief Writes a string as a quoted JSON string
+static void write_json_string(std::ostream& target, const std::wstring& value) {
+    target << '"';
+    
+    for (wstring::const_iterator chr = value.begin(); chr != value.end(); ++chr) {
+        unsigned long c = (unsigned long) *chr;
+        
+        if (c == '"' || c == '\\') {
+            target << '\\' << (char) c;
+        } else if (c >= 0x20 && c < 0x7f) {
+            target << (char) c;
+        } else {
+            // Everything else is written as a \u escape (characters outside the BMP become a surrogate pair)
+            char escape[16];
+            
+            if (c >= 0x10000 && c <= 0x10ffff) {
+                c -= 0x10000;
+                sprintf(escape, "\\u%04lx\\u%04lx", 0xd800 + (c >> 10), 0xdc00 + (c & 0x3ff));
+            } else {
+                sprintf(escape, "\\u%04lx", c & 0xffff);
+            }
+            
+            target << escape;
+        }
+    }
+    
+    target << '"';
+}
+
+/// \brief Writes a list of profiles as a JSON document
+void stage_profile::write_json(std::ostream& target, const std::vector<stage_profile>& profiles) {
+    target << "{\n  \"stages\": [";
+    
+    for (vector<stage_profile>::const_iterator profile = profiles.begin(); profile != profiles.end(); ++profile) {
+        if (profile != profiles.begin()) target << ",";
+        
+        target << "\n    {\n      \"stage\": ";
+        write_json_string(target, profile->stage());
+        target << ",\n      \"file\": ";
+        write_json_string(target, profile->filename());
+        target << ",\n      \"language\": ";
+        write_json_string(target, profile->language());
+        target << ",\n      \"seconds\": " << fixed << setprecision(6) << profile->seconds();
+        target << ",\n      \"peak_memory\": " << profile->peak_memory();
+        
+        // Counters
+        target << ",\n      \"counters\": {";
+        for (counter_list::const_iterator count = profile->counters().begin(); count != profile->counters().end(); ++count) {
+            if (count != profile->counters().begin()) target << ",";
+            target << "\n        ";
+            write_json_string(target, count->first);
+            target << ": " << count->second;
+        }
+        if (!profile->counters().empty()) target << "\n      ";
+        target << "}";
+        
+        // Timings
+        target << ",\n      \"timings\": {";
+        for (timing_list::const_iterator time = profile->timings().begin(); time != profile->timings().end(); ++time) {
+            if (time != profile->timings().begin()) target << ",";
+            target << "\n        ";
+            write_json_string(target, time->first);
+            target << ": " << fixed << setprecision(6) << time->second;
+        }
+        if (!profile->timings().empty()) target << "\n      ";
+        target << "}\n    }";
+    }
+    
+    if (!profiles.empty()) target << "\n  ";
+    target << "]\n}\n";
+}
+
+/// \brief Starts profiling a stage
+profile_scope::profile_scope(console& target, const std::wstring& stage, const std::wstring& filename, const std::wstring& language)
+: m_Console(target)
+, m_Profile(stage, filename, language) {
+}
+
+/// \brief Finishes the profile and sends it to the console
+profile_scope::~profile_scope() {
+    m_Profile.finish();
+    m_Console.record_profile(m_Profile);
+}
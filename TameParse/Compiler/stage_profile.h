@@ -0,0 +1,167 @@
+//
+//  stage_profile.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _COMPILER_STAGE_PROFILE_H
+#define _COMPILER_STAGE_PROFILE_H
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "TameParse/Util/stopwatch.h"
+
+namespace compiler {
+    class console;
+    
+    ///
+    /// \brief Record of the cost of running a single compilation stage
+    ///
+    /// Stages fill one of these in as they run and pass it to console::record_profile() when they finish (usually via
+    /// profile_scope). A profile contains the wall time for the stage, the peak memory used by the process when the
+    /// stage finished, and any counters or timings that the stage thinks describe the size of the work it did.
+    ///
+    class stage_profile {
+    public:
+        /// \brief A named counter
+        typedef std::pair<std::wstring, long> counter;
+        
+        /// \brief A named time, in seconds
+        typedef std::pair<std::wstring, double> timing;
+        
+        /// \brief List of counters
+        typedef std::vector<counter> counter_list;
+        
+        /// \brief List of timings
+        typedef std::vector<timing> timing_list;
+        
+    private:
+        /// \brief The name of the stage that this profile is for
+        std::wstring m_Stage;
+        
+        /// \brief The file that the stage was compiling
+        std::wstring m_Filename;
+        
+        /// \brief The language that the stage was compiling (empty if the stage is not specific to a language)
+        std::wstring m_Language;
+        
+        /// \brief Measures the time since the stage started
+        util::stopwatch m_Stopwatch;
+        
+        /// \brief The time taken by the stage, in seconds (set by finish())
+        double m_Seconds;
+        
+        /// \brief Time spent on the stage before this profile was created, in seconds
+        double m_EarlierSeconds;
+        
+        /// \brief The peak memory used by the process, in bytes, when the stage finished (-1 if this is not known)
+        long m_PeakMemory;
+        
+        /// \brief The counters for this stage, in the order they were added
+        counter_list m_Counters;
+        
+        /// \brief The timings for this stage, in the order they were added
+        timing_list m_Timings;
+        
+    public:
+        /// \brief Creates a profile for the specified stage, and starts timing it
+        stage_profile(const std::wstring& stage, const std::wstring& filename, const std::wstring& language = std::wstring());
+        
+        /// \brief Stops timing the stage, and records the peak memory used so far
+        void finish();
+        
+        /// \brief Adds time spent on the stage before this profile was created (for stages that run in several parts)
+        void add_seconds(double seconds);
+        
+        /// \brief Adds a counter to this profile
+        void add_counter(const std::wstring& name, long value);
+        
+        /// \brief Adds a timing (in seconds) to this profile
+        void add_timing(const std::wstring& name, double seconds);
+        
+        /// \brief The name of the stage that this profile is for
+        inline const std::wstring& stage() const { return m_Stage; }
+        
+        /// \brief The file that the stage was compiling
+        inline const std::wstring& filename() const { return m_Filename; }
+        
+        /// \brief The language that the stage was compiling (empty if the stage is not specific to a language)
+        inline const std::wstring& language() const { return m_Language; }
+        
+        /// \brief The time taken by the stage, in seconds
+        inline double seconds() const { return m_Seconds; }
+        
+        /// \brief The peak memory used by the process when the stage finished, in bytes (-1 if this is not known)
+        inline long peak_memory() const { return m_PeakMemory; }
+        
+        /// \brief The counters for this stage
+        inline const counter_list& counters() const { return m_Counters; }
+        
+        /// \brief The timings for this stage
+        inline const timing_list& timings() const { return m_Timings; }
+        
+    public:
+        /// \brief The peak memory (resident set size) used by this process so far, in bytes, or -1 if this is not available
+        static long peak_process_memory();
+        
+        /// \brief Writes a list of profiles as a JSON document
+        ///
+        /// The document is an object with a single 'stages' member, containing an object for each profile in order.
+        /// Each of these has 'stage', 'file', 'language', 'seconds' and 'peak_memory' members, followed by 'counters' and
+        /// 'timings' objects mapping names to values. The output only uses ASCII characters.
+        static void write_json(std::ostream& target, const std::vector<stage_profile>& profiles);
+    };
+    
+    ///
+    /// \brief Profiles a compilation stage until it goes out of scope
+    ///
+    /// The profile is finished and sent to the console when this object is destroyed, so it is recorded however the
+    /// stage returns.
+    ///
+    class profile_scope {
+    private:
+        /// \brief The console that should receive the profile
+        console& m_Console;
+        
+        /// \brief The profile being built up
+        stage_profile m_Profile;
+        
+        profile_scope(const profile_scope& noCopying);
+        profile_scope& operator=(const profile_scope& noCopying);
+        
+    public:
+        /// \brief Starts profiling a stage
+        profile_scope(console& target, const std::wstring& stage, const std::wstring& filename, const std::wstring& language = std::wstring());
+        
+        /// \brief Finishes the profile and sends it to the console
+        ~profile_scope();
+        
+        /// \brief The profile being built up
+        inline stage_profile* operator->() { return &m_Profile; }
+    };
+}
+
+#endif
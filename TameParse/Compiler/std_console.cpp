@@ -49,58 +49,84 @@ public:
 /// \brief Static null stream object
 static nullstream s_NullStream;
 
+/// \brief The number of characters of errors that are stored before they are written out
+static const size_t c_ErrorBatchSize = 16384;
+
 /// \brief Creates a standard console with the specified input filename
 std_console::std_console(const std::wstring& inputFilename)
 : m_InputFilename(inputFilename)
 , m_ExitCode(0) {
 }
 
+/// \brief Creates a copy of a console (errors that are waiting to be written are not copied)
+std_console::std_console(const std_console& copyFrom)
+: console(copyFrom)
+, m_InputFilename(copyFrom.m_InputFilename)
+, m_ExitCode(copyFrom.m_ExitCode)
+, m_Profiles(copyFrom.m_Profiles) {
+}
+
+/// \brief Writes out any errors that are waiting
+std_console::~std_console() {
+    flush_errors();
+}
+
 /// \brief Creates a copy of this console
 console* std_console::clone() const {
     std_console* res = new std_console(m_InputFilename);
     res->m_ExitCode = m_ExitCode;
+    res->m_Profiles = m_Profiles;
     return res;
 }
 
-/// \brief Reports an error to the console
-void std_console::report_error(const error& error) {
-    // Errors go to wcerr by default
-    wostream* out = &wcerr;
-    
+/// \brief True if errors with the specified severity will be shown with the current options
+bool std_console::shows_errors(error::severity sev) const {
     // Suppress warnings if the options are set
-    if (error.sev() != error::sev_detail && error.sev() <= error::sev_warning && !get_option(L"suppress-warnings").empty()) {
-        // TODO: suppress sev_detail messages if the last non-detail error was a warning
-        return;
+    // TODO: suppress sev_detail messages if the last non-detail error was a warning
+    if (sev != error::sev_detail && sev <= error::sev_warning && !get_option(L"suppress-warnings").empty()) {
+        return false;
     }
     
-    // Use the verbose stream if this is not a warning or error message
-    if (error.sev() < error::sev_detail) {
-        out = &verbose_stream();
+    // Messages that aren't warnings or errors go to the verbose stream
+    if (sev < error::sev_detail) {
+        return !get_option(L"verbose").empty();
     }
     
+    return true;
+}
+
+/// \brief Reports an error to the console
+void std_console::report_error(const error& error) {
     // Set the exit code if the error is severe enough
     if (error.sev() >= error::sev_error) {
         m_ExitCode = error.sev();
     }
     
+    // Nothing else to do if this error won't be shown
+    if (!shows_errors(error.sev())) {
+        return;
+    }
+    
     // Write a formatted error message, beginning with the file that suffered the failure
+    wstringstream out;
+    
     if (!error.filename().empty()) {
-        *out << error.filename() << L":";
+        out << error.filename() << L":";
     } else {
-        *out << L":";
+        out << L":";
     }
     
     // Write out the line number if it's >= 0
     if (error.pos().line() >= 0) {
-        *out << error.pos().line()+1 << L":";
+        out << error.pos().line()+1 << L":";
     } else {
-        *out << L":";
+        out << L":";
     }
 
     if (error.pos().column() >= 0) {
-        *out << error.pos().column()+1 << L":";
+        out << error.pos().column()+1 << L":";
     } else {
-        *out << L":";
+        out << L":";
     }
     
     // Write out the error severity
@@ -110,42 +136,65 @@ void std_console::report_error(const error& error) {
             break;
             
         case error::sev_detail:
-            *out << L"    ";
+            out << L"    ";
             break;
             
         case error::sev_warning:
-            *out << L" warning:";
+            out << L" warning:";
             break;
             
         case error::sev_error:
-            *out << L" error:";
+            out << L" error:";
             break;
             
         case error::sev_fatal:
-            *out << L" failure:";
+            out << L" failure:";
             break;
             
         case error::sev_bug:
-            *out << L" compiler failure:";
+            out << L" compiler failure:";
             break;
             
         default:
-            *out << L" unknown:";
+            out << L" unknown:";
             break;
     }
     
     // If the options are set to add the error code then do so
     if (!get_option(L"show-error-codes").empty()) {
-        *out << L" [" << error.identifier() << L"]";
+        out << L" [" << error.identifier() << L"]";
     }
 
     // Write out the error description
-    *out << L" " << error.description() << endl;
+    out << L" " << error.description() << L"\n";
+    
+    // Messages that aren't warnings or errors go to the verbose stream straight away
+    if (error.sev() < error::sev_detail) {
+        verbose_stream() << out.str() << flush;
+        return;
+    }
+    
+    // Warnings and errors are written out in batches
+    m_PendingErrors += out.str();
+    if (m_PendingErrors.size() >= c_ErrorBatchSize) {
+        flush_errors();
+    }
+}
+
+/// \brief Writes any errors that are waiting to be written to wcerr
+void std_console::flush_errors() {
+    if (m_PendingErrors.empty()) return;
+    
+    wcerr << m_PendingErrors << flush;
+    m_PendingErrors.clear();
 }
 
 /// \brief Retrieves a stream where log messages can be sent to (these are generally always displayed, but may be
 /// suppressed if the console has a 'silent' mode)
 std::wostream& std_console::message_stream() {
+    // Keep the messages in order with any errors that are waiting
+    flush_errors();
+    
     // Output to null if silent is set
     if (!get_option(L"silent").empty()) {
         return s_NullStream;
@@ -158,6 +207,9 @@ std::wostream& std_console::message_stream() {
 /// \brief Retrieves a stream where verbose messages can be sent to (these are generally not displayed unless the
 /// console is configured to)
 std::wostream& std_console::verbose_stream() {
+    // Keep the messages in order with any errors that are waiting
+    flush_errors();
+    
     // Output to null if verbose is not set
     if (get_option(L"verbose").empty()) {
         return s_NullStream;
@@ -228,3 +280,24 @@ int std_console::exit_code() {
     return m_ExitCode;
 }
 
+/// \brief Stores the profile of a compilation stage that has finished
+void std_console::record_profile(const stage_profile& profile) {
+    m_Profiles.push_back(profile);
+}
+
+/// \brief Writes the profiles recorded so far as a JSON report, if the profile-report option names a file
+void std_console::write_profile_report() {
+    wstring reportFilename = get_option(L"profile-report");
+    if (reportFilename.empty()) return;
+    
+    ostream* report = open_binary_file_for_writing(reportFilename);
+    if (report && !report->fail()) {
+        stage_profile::write_json(*report, m_Profiles);
+    }
+    
+    if (!report || report->fail()) {
+        report_error(error(error::sev_error, reportFilename, L"CANT_WRITE_PROFILE_REPORT", L"Could not write the profile report", dfa::position(-1, -1, -1)));
+    }
+    
+    delete report;
+}
@@ -34,6 +34,11 @@ namespace compiler {
     ///
     /// \brief Most basic console implementation using the standard C++ I/O routines
     ///
+    /// Warnings and errors are written to wcerr in batches rather than one line at a time, which matters for grammars
+    /// that produce a lot of warnings. Any waiting errors are written out before the message or verbose streams are
+    /// used, so the two kinds of output still appear in the order that they were produced, and when the console is
+    /// destroyed.
+    ///
     class std_console : public console {
     private:
         /// \brief A filename that this console should read from
@@ -42,10 +47,22 @@ namespace compiler {
         /// \brief The exit code to use
         int m_ExitCode;
         
+        /// \brief The profiles of the stages that have finished, in the order that they were recorded
+        std::vector<stage_profile> m_Profiles;
+        
+        /// \brief Formatted errors that haven't been written to wcerr yet
+        std::wstring m_PendingErrors;
+        
     public:
         /// \brief Creates a standard console with the specified input filename
         std_console(const std::wstring& inputFilename);
         
+        /// \brief Creates a copy of a console (errors that are waiting to be written are not copied)
+        std_console(const std_console& copyFrom);
+        
+        /// \brief Writes out any errors that are waiting
+        virtual ~std_console();
+        
         /// \brief Creates a copy of this console
         virtual console* clone() const;
         
@@ -53,6 +70,12 @@ namespace compiler {
         /// \brief Reports an error to the console
         virtual void report_error(const error& error);
         
+        /// \brief True if errors with the specified severity will be shown with the current options
+        virtual bool shows_errors(error::severity sev) const;
+        
+        /// \brief Writes any errors that are waiting to be written to wcerr
+        void flush_errors();
+        
         /// \brief Retrieves a stream where log messages can be sent to (these are generally always displayed, but may be
         /// suppressed if the console has a 'silent' mode)
         virtual std::wostream& message_stream();
@@ -64,6 +87,17 @@ namespace compiler {
         /// \brief Returns the exit code that the application should use (if there's an error, this will be non-zero)
         virtual int exit_code();
         
+        /// \brief Stores the profile of a compilation stage that has finished
+        virtual void record_profile(const stage_profile& profile);
+        
+        /// \brief The profiles of the stages that have finished, in the order that they were recorded
+        inline const std::vector<stage_profile>& profiles() const { return m_Profiles; }
+        
+        /// \brief Writes the profiles recorded so far as a JSON report, if the profile-report option names a file
+        ///
+        /// Nothing is written if the option is not set. An error is reported if the file could not be written.
+        void write_profile_report();
+        
     public:
         /// \brief Retrieves the value of the option with the specified name.
         ///
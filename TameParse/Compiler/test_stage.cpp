@@ -25,10 +25,18 @@
 //  IN THE SOFTWARE.
 //
 
+#include <algorithm>
+#include <cwchar>
+#include <iomanip>
 #include <sstream>
 
 #include "TameParse/Util/utf8reader.h"
+#include "TameParse/Util/parallel.h"
+#include "TameParse/Util/stopwatch.h"
+#include "TameParse/Util/allocation_counter.h"
+#include "TameParse/Lr/counting_parser_trace.h"
 #include "TameParse/Compiler/test_stage.h"
+#include "TameParse/Compiler/buffered_console.h"
 #include "TameParse/Language/test_block.h"
 
 using namespace std;
@@ -47,6 +55,14 @@ test_stage::test_stage(console_container& console, const std::wstring& filename,
 
 /// \brief Destructor
 test_stage::~test_stage() {
+    // Delete the parsers (before the lexers and languages that they refer to)
+    for (parser_map::iterator deadParser = m_Parsers.begin(); deadParser != m_Parsers.end(); ++deadParser) {
+        if (deadParser->second) {
+            delete deadParser->second;
+        }
+    }
+    m_Parsers.clear();
+
     // Delete the lexers
     for (lexer_map::iterator deadLexer = m_Lexers.begin(); deadLexer != m_Lexers.end(); ++deadLexer) {
         if (deadLexer->second) {
@@ -64,111 +80,363 @@ test_stage::~test_stage() {
     m_Languages.clear();
 }
 
-/// \brief Retrieves the language stage for the language with the specified name
-language_stage* test_stage::get_language(const std::wstring& languageName, const dfa::position& pos) {
-    // Try to retrieve the existing language
-    language_map::iterator found = m_Languages.find(languageName);
-    if (found != m_Languages.end()) {
-        return found->second;
+/// \brief The stages built for a language that has tests
+class test_language {
+public:
+    /// \brief The name of the language
+    wstring name;
+    
+    /// \brief The file that the language is defined in
+    wstring filename;
+    
+    /// \brief The definition of the language
+    const language_block* block;
+    
+    /// \brief The nonterminals that are tested, in the order that they are first used
+    vector<wstring> nonterminals;
+    
+    /// \brief The console that the stages for this language report to
+    buffered_console* buffer;
+    
+    /// \brief Container for the console (which is owned by the stages once they are created)
+    console_container consoleContainer;
+    
+    /// \brief The compiled language
+    language_stage* language;
+    
+    /// \brief The lexer for the language
+    lexer_stage* lexer;
+    
+    /// \brief The parser for each of the nonterminals
+    vector<lr_parser_stage*> parsers;
+    
+    test_language(console& parent, const wstring& languageName, const wstring& languageFile, const language_block* languageBlock)
+    : name(languageName)
+    , filename(languageFile)
+    , block(languageBlock)
+    , buffer(new buffered_console(parent))
+    , consoleContainer(buffer, true)
+    , language(NULL)
+    , lexer(NULL) {
     }
-
-    // Retrieve the language for this test
-    const language_block*   language        = m_Import->language_with_name(languageName);
-    wstring                 languageFile    = m_Import->file_with_language(languageName);
-
-    // Error if the language could not be found
-    if (!language) {
-        wstringstream msg;
-        msg << L"Unable to find language '" << languageName << "'";
-        cons().report_error(error(error::sev_error, filename(), L"CANT_FIND_LANGUAGE", msg.str(), pos));
-        return m_Languages[languageName] = NULL;
+};
+
+/// \brief Builds the language, lexer and parsers for a list of languages
+///
+/// Every language is compiled separately (languages that are inherited from are compiled again by each language that
+/// inherits them), so the languages can be built on separate threads.
+class build_test_languages {
+private:
+    /// \brief The languages to build
+    vector<test_language>& m_Languages;
+    
+    /// \brief The import stage where languages should be loaded from
+    const import_stage* m_Import;
+    
+public:
+    build_test_languages(vector<test_language>& languages, const import_stage* import)
+    : m_Languages(languages)
+    , m_Import(import) {
     }
+    
+    /// \brief Builds the language with the specified index
+    void operator()(size_t index) {
+        test_language& target = m_Languages[index];
+        
+        // Compile the language
+        target.language = new language_stage(target.consoleContainer, target.filename, target.block, m_Import);
+        target.language->compile();
+        
+        // Report any unused symbols in this language
+        target.language->report_unused_symbols();
+        
+        // Create the lexer stage for this language
+        target.lexer = new lexer_stage(target.consoleContainer, target.filename, target.language);
+        target.lexer->compile();
+        
+        // Create a parser for each nonterminal that is tested
+        for (vector<wstring>::const_iterator nonterminal = target.nonterminals.begin(); nonterminal != target.nonterminals.end(); ++nonterminal) {
+            vector<wstring> startSymbols;
+            startSymbols.push_back(*nonterminal);
+
+            lr_parser_stage* parser = new lr_parser_stage(target.consoleContainer, target.filename, target.language, target.lexer, startSymbols);
+            parser->compile();
+            
+            target.parsers.push_back(parser);
+        }
+    }
+};
 
-    // Create a new language stage
-    console_container   cons    = cons_container();
-    language_stage*     stage   = new language_stage(cons, languageFile, language, m_Import);
-
-    // Compile it
-    stage->compile();
-
-    // TODO: return NULL if there was a compile error
-
-    // Return it
-    return m_Languages[languageName] = stage;
-}
+/// \brief Parser that counts the actions it performs (used to find the peak lookahead of a test)
+typedef parser<int, simple_parser_actions, counting_parser_trace> counting_parser;
 
-/// \brief Retrieves the lexer for the language with the specified name
-lexer_stage* test_stage::get_lexer(const std::wstring& languageName, const dfa::position& pos) {
-    // Try to retrieve the existing lexer
-    lexer_map::iterator found = m_Lexers.find(languageName);
-    if (found != m_Lexers.end()) {
-        return found->second;
+/// \brief The throughput of a test, measured by parsing its input repeatedly
+class test_throughput {
+public:
+    /// \brief The number of times the input was parsed (0 if the throughput wasn't measured)
+    long parses;
+    
+    /// \brief The number of lexemes read by all of the parses
+    long lexemes;
+    
+    /// \brief The size of the input of all of the parses, in bytes of UTF-8
+    long bytes;
+    
+    /// \brief The time taken by all of the parses, in seconds
+    double seconds;
+    
+    /// \brief The number of allocations made by all of the parses
+    long allocations;
+    
+    /// \brief The furthest that the parser looked ahead of its current position
+    int maxLookahead;
+    
+    test_throughput()
+    : parses(0)
+    , lexemes(0)
+    , bytes(0)
+    , seconds(0)
+    , allocations(0)
+    , maxLookahead(0) {
     }
-
-    // Get the language stage corresponding to this lexer
-    language_stage* language        = get_language(languageName, pos);
-    wstring         languageFile    = m_Import->file_with_language(languageName);
-    if (!language) {
-        // Value is null if the language couldn't be generated for any reason
-        return m_Lexers[languageName] = NULL;
+    
+    /// \brief Adds the throughput of another test to this one
+    void add(const test_throughput& other) {
+        parses          += other.parses;
+        lexemes         += other.lexemes;
+        bytes           += other.bytes;
+        seconds         += other.seconds;
+        allocations     += other.allocations;
+        maxLookahead    = max(maxLookahead, other.maxLookahead);
     }
     
-    // Report any unused symbols in this language
-    language->report_unused_symbols();
-
-    // Create the lexer stage for this language
-    console_container   cons    = cons_container();
-    lexer_stage*        stage   = new lexer_stage(cons, languageFile, language);
-
-    // Compile it
-    stage->compile();
-
-    // TODO: return NULL if there was a compile error
-
-    // Return it
-    return m_Lexers[languageName] = stage;
+    /// \brief Writes out a description of this throughput
+    void write(wostream& target) const {
+        if (seconds > 0) {
+            target << fixed << setprecision(0) << lexemes / seconds << L" lexemes/s, " << bytes / seconds << L" bytes/s";
+        } else {
+            target << L"- lexemes/s, - bytes/s";
+        }
+        
+        if (allocation_counter::is_enabled()) {
+            target << L", " << fixed << setprecision(1) << (double) allocations / parses << L" allocations/parse";
+        }
+        
+        target << L", peak lookahead " << maxLookahead;
+    }
+};
+
+/// \brief Encodes the specified text as UTF-8, storing one byte in each character of the result
+///
+/// This is the input expected by a lexer built with the utf8-lexer option, which matches bytes rather than
+/// characters. UTF-16 surrogate pairs (as produced by utf8reader) are combined into a single 4-byte sequence.
+static wstring utf8_bytes(const wstring& text) {
+    wstring bytes;
+    bytes.reserve(text.size());
+    
+    for (wstring::const_iterator nextChar = text.begin(); nextChar != text.end(); ++nextChar) {
+        unsigned long codePoint = (unsigned long) *nextChar;
+        
+        // Combine surrogate pairs
+        if (codePoint >= 0xd800 && codePoint < 0xdc00 && nextChar+1 != text.end()) {
+            unsigned long low = (unsigned long) *(nextChar+1);
+            if (low >= 0xdc00 && low < 0xe000) {
+                codePoint = 0x10000 + ((codePoint - 0xd800) << 10) + (low - 0xdc00);
+                ++nextChar;
+            }
+        }
+        
+        if (codePoint < 0x80) {
+            bytes += (wchar_t) codePoint;
+        } else if (codePoint < 0x800) {
+            bytes += (wchar_t) (0xc0 | (codePoint >> 6));
+            bytes += (wchar_t) (0x80 | (codePoint & 0x3f));
+        } else if (codePoint < 0x10000) {
+            bytes += (wchar_t) (0xe0 | (codePoint >> 12));
+            bytes += (wchar_t) (0x80 | ((codePoint >> 6) & 0x3f));
+            bytes += (wchar_t) (0x80 | (codePoint & 0x3f));
+        } else {
+            bytes += (wchar_t) (0xf0 | (codePoint >> 18));
+            bytes += (wchar_t) (0x80 | ((codePoint >> 12) & 0x3f));
+            bytes += (wchar_t) (0x80 | ((codePoint >> 6) & 0x3f));
+            bytes += (wchar_t) (0x80 | (codePoint & 0x3f));
+        }
+    }
+    
+    return bytes;
 }
 
-/// \brief Retrieves the parser for the language with the specified name
-lr_parser_stage* test_stage::get_parser(const std::wstring& languageName, const std::wstring& nonterminalName, const dfa::position& pos) {
-    // Try to retrieve the existing parser
-    pair<wstring, wstring> parserName(languageName, nonterminalName);
-
-    parser_map::iterator found = m_Parsers.find(parserName);
-    if (found != m_Parsers.end()) {
-        return found->second;
+/// \brief A single test, and its result
+class test_run {
+public:
+    /// \brief The definition of this test
+    test_definition* definition;
+    
+    /// \brief The text to parse
+    wstring text;
+    
+    /// \brief The symbols to pass to the lexer (the UTF-8 bytes of the text if the lexer matches UTF-8)
+    wstring input;
+    
+    /// \brief True if the text could not be loaded from its file
+    bool fileMissing;
+    
+    /// \brief The lexer to use, or NULL if the test can't be run
+    lexer_stage* lexer;
+    
+    /// \brief The parser to use, or NULL if the test can't be run
+    lr_parser_stage* parser;
+    
+    /// \brief True if the test passed
+    bool result;
+    
+    /// \brief True if the parser stopped at a lexeme (rather than at the end of the input)
+    bool hasFailLexeme;
+    
+    /// \brief The position of the lexeme where the parser stopped
+    position failLexemePos;
+    
+    /// \brief The time taken to lex and parse the test, in seconds
+    double seconds;
+    
+    /// \brief Counts of the lexemes that the parser read
+    lexer_counters lexemes;
+    
+    /// \brief The throughput found by parsing the input repeatedly (if requested)
+    test_throughput throughput;
+    
+    test_run(test_definition* defn)
+    : definition(defn)
+    , fileMissing(false)
+    , lexer(NULL)
+    , parser(NULL)
+    , result(false)
+    , hasFailLexeme(false)
+    , failLexemePos(-1, -1, -1)
+    , seconds(0) {
     }
-
-    // Get the name of the file that the language is defined in
-    wstring         languageFile    = m_Import->file_with_language(languageName);
-
-    // Get the lexer for this language
-    lexer_stage*    lexer = get_lexer(languageName, pos);
-
-    // Get the language block
-    language_stage* language = get_language(languageName, pos);
-
-    if (!lexer || !language) {
-        // Value is null if the language couldn't be generated for any reason
-        return m_Parsers[parserName] = NULL;
+};
+
+/// \brief Runs the parsers for a list of tests
+///
+/// The lexers and parse tables are only read while parsing, so the tests can be run on separate threads.
+class run_tests {
+private:
+    /// \brief The tests to run
+    vector<test_run>& m_Tests;
+    
+public:
+    run_tests(vector<test_run>& tests)
+    : m_Tests(tests) {
     }
+    
+    /// \brief Runs the test with the specified index
+    void operator()(size_t index) {
+        test_run& test = m_Tests[index];
+        if (!test.lexer || !test.parser || !test.parser->get_tables()) return;
+        
+        // Time the lexer and parser together
+        util::stopwatch timer;
+        
+        // Create the parser
+        simple_parser parser(test.parser->get_tables(), false);
 
-    // Create a parser for this language
-    vector<wstring>     startSymbols;
-    console_container   cons(cons_container());
-    startSymbols.push_back(nonterminalName);
+        // Create the lexeme stream
+        wstringstream   testText(test.input);
+        lexeme_stream*  stream = new counting_lexeme_stream(test.lexer->get_lexer()->create_stream_from(testText), test.lexemes);
 
-    lr_parser_stage* parser = new lr_parser_stage(cons, languageFile, language, lexer, startSymbols);
+        // Create the parser state
+        simple_parser::state* parseState = parser.create_parser(new simple_parser_actions(stream));
 
-    // Compile it
-    parser->compile();
+        // Run the test
+        test.result     = parseState->parse();
+        test.seconds    = timer.seconds();
 
-    // TODO: return NULL if there was a compile error
+        // The result is inverted if the test type is a no match test
+        if (test.definition->type() == test_definition::no_match) {
+            // We expect to not be able to parse this
+            test.result = !test.result;
+        }
+        
+        // Remember where the parser stopped
+        if (parseState->look().item()) {
+            test.hasFailLexeme = true;
+            test.failLexemePos = parseState->look()->pos();
+        }
 
-    // Return it
-    return m_Parsers[parserName] = parser;
+        // Done with the parser
+        delete parseState;
+    }
+};
+
+/// \brief Measures the throughput of the lexer and parser for a test by parsing its input repeatedly
+///
+/// The input is parsed at least minParses times, and then until at least minBytes bytes have been parsed. The input is
+/// replayed rather than repeated within a single parse, as the grammar usually can't accept a repeated input. Only
+/// tests that passed are measured, as the others don't read all of their input.
+static void measure_throughput(test_run& test, long minParses, long minBytes) {
+    if (!test.result || test.definition->type() == test_definition::no_match) return;
+    if (!test.lexer || !test.parser || !test.parser->get_tables()) return;
+    
+    const lexer*        testLexer   = test.lexer->get_lexer();
+    const parser_tables* tables     = test.parser->get_tables();
+    long                size        = (long) utf8_bytes(test.text).size();
+    
+    // Find the peak lookahead with a parser that counts its actions (this is kept out of the timing)
+    parser_counters& counters = parser_counters::current();
+    counters.reset();
+    
+    counting_parser         countingParser(tables, false);
+    wstringstream           countingText(test.input);
+    counting_parser::state* countingState = countingParser.create_parser(new simple_parser_actions(testLexer->create_stream_from(countingText)));
+    
+    countingState->parse();
+    delete countingState;
+    
+    // Work out how many times to parse the input
+    long parses = max(minParses, 1L);
+    if (size > 0 && parses * size < minBytes) {
+        parses = (minBytes + size - 1) / size;
+    }
+    
+    // Parse it, counting the lexemes and allocations
+    lexer_counters  lexemes;
+    simple_parser   timedParser(tables, false);
+    long            initialAllocations = allocation_counter::allocations();
+    util::stopwatch timer;
+    
+    for (long parseNum = 0; parseNum < parses; ++parseNum) {
+        wstringstream           testText(test.input);
+        lexeme_stream*          stream      = new counting_lexeme_stream(testLexer->create_stream_from(testText), lexemes);
+        simple_parser::state*   parseState  = timedParser.create_parser(new simple_parser_actions(stream));
+        
+        parseState->parse();
+        delete parseState;
+    }
+    
+    test.throughput.seconds         = timer.seconds();
+    test.throughput.allocations     = allocation_counter::allocations() - initialAllocations;
+    test.throughput.parses          = parses;
+    test.throughput.lexemes         = lexemes.lexemes;
+    test.throughput.bytes           = size * parses;
+    test.throughput.maxLookahead    = counters.maxLookahead;
 }
 
+/// \brief A block of tests
+struct test_block_run {
+    /// \brief The block
+    const test_block* tests;
+    
+    /// \brief The language that is being tested, or -1 if it couldn't be found
+    int languageIndex;
+    
+    /// \brief The index of the first test in this block
+    size_t firstTest;
+    
+    /// \brief The index after the last test in this block
+    size_t endTest;
+};
+
 /// \brief Performs the actions associated with this compilation stage
 void test_stage::compile() {
     // Sanity check
@@ -184,10 +452,13 @@ void test_stage::compile() {
     
     // Output the stage name
     cons().verbose_stream() << L"  = Running tests" << endl;
+    profile_scope profile(cons(), L"tests", filename());
 
-    // Iterate through the definitions
-    bool firstTestSet   = true;
-    bool runAnyTests    = false;
+    // Find the languages and tests to build
+    vector<test_language>   languages;
+    vector<test_run>        testRuns;
+    vector<test_block_run>  blocks;
+    map<wstring, int>       languageIndex;
 
     for (definition_file::iterator defn = m_Definition->begin(); defn != m_Definition->end(); ++defn) {
         // Retrieve the tests for this block
@@ -196,15 +467,149 @@ void test_stage::compile() {
         // Ignore blocks that aren't test blocks
         if (!tests) continue;
 
+        // Retrieve the language for this test
+        test_block_run block;
+        block.tests         = tests;
+        block.languageIndex = -1;
+        block.firstTest     = testRuns.size();
+
+        map<wstring, int>::iterator existingLanguage = languageIndex.find(tests->language());
+        if (existingLanguage != languageIndex.end()) {
+            block.languageIndex = existingLanguage->second;
+        } else {
+            const language_block* language = m_Import->language_with_name(tests->language());
+            
+            if (language) {
+                block.languageIndex = (int) languages.size();
+                languageIndex[tests->language()] = block.languageIndex;
+                languages.push_back(test_language(cons(), tests->language(), m_Import->file_with_language(tests->language()), language));
+            }
+        }
+
+        // Gather the tests themselves
+        if (block.languageIndex >= 0) {
+            test_language& language = languages[block.languageIndex];
+
+            for (test_block::iterator testDefn = tests->begin(); testDefn != tests->end(); ++testDefn) {
+                // Compile a language for this nonterminal if one doesn't exist already
+                // TODO: deal with nonterminals in other languages
+                if (find(language.nonterminals.begin(), language.nonterminals.end(), (*testDefn)->nonterminal()) == language.nonterminals.end()) {
+                    language.nonterminals.push_back((*testDefn)->nonterminal());
+                }
+
+                // Get the text to be tested
+                // TODO: deal with 'from' items
+                test_run run(*testDefn);
+
+                if ((*testDefn)->type() == test_definition::match_from_file) {
+                    // Read from the supplied file (which we assume is in UTF-8 format)
+                    istream* fromFile = cons().open_file((*testDefn)->test_string());
+
+                    // Error if the file doesn't exist (this is reported along with the test results)
+                    if (!fromFile) {
+                        run.fileMissing = true;
+                    } else {
+                        // Read in as UTF-8
+                        utf8reader      reader(fromFile, true);
+                        wstringstream   testText;
+
+                        for (;;) {
+                            // Get the next character
+                            wchar_t nextChar;
+                            reader.get(nextChar);
+
+                            // Stop at the end (or if the stream goes ungood for any reason)
+                            if (!reader.good()) break;
+
+                            // Store this character
+                            testText << nextChar;
+                        }
+
+                        run.text = testText.str();
+                    }
+                } else {
+                    // Just use the literal test string
+                    run.text = (*testDefn)->test_string();
+                }
+
+                testRuns.push_back(run);
+            }
+        }
+
+        block.endTest = testRuns.size();
+        blocks.push_back(block);
+    }
+
+    // Build the languages
+    build_test_languages buildLanguages(languages, m_Import);
+    util::parallel_for(languages.size(), max_threads(), buildLanguages);
+
+    // Report any errors in the order that the languages were used, and take ownership of the stages
+    for (vector<test_language>::iterator language = languages.begin(); language != languages.end(); ++language) {
+        language->buffer->replay();
+
+        m_Languages[language->name] = language->language;
+        m_Lexers[language->name]    = language->lexer;
+
+        for (size_t parserNum = 0; parserNum < language->parsers.size(); ++parserNum) {
+            m_Parsers[make_pair(language->name, language->nonterminals[parserNum])] = language->parsers[parserNum];
+        }
+    }
+
+    // Attach the lexers and parsers to the tests (a UTF-8 lexer reads the encoded bytes of the text)
+    bool utf8 = !cons().get_option(L"utf8-lexer").empty();
+    
+    for (vector<test_block_run>::iterator block = blocks.begin(); block != blocks.end(); ++block) {
+        if (block->languageIndex < 0) continue;
+
+        for (size_t testNum = block->firstTest; testNum < block->endTest; ++testNum) {
+            test_run& run = testRuns[testNum];
+            if (run.fileMissing) continue;
+
+            run.lexer   = languages[block->languageIndex].lexer;
+            run.parser  = m_Parsers[make_pair(block->tests->language(), run.definition->nonterminal())];
+            run.input   = utf8 ? utf8_bytes(run.text) : run.text;
+        }
+    }
+
+    // Run the tests
+    run_tests runTests(testRuns);
+    util::stopwatch runTime;
+    util::parallel_for(testRuns.size(), max_threads(), runTests);
+    
+    profile->add_counter(L"languages", (long) languages.size());
+    profile->add_counter(L"tests", (long) testRuns.size());
+    profile->add_timing(L"run_tests", runTime.seconds());
+    
+    // Measure the throughput if requested (one test at a time, so that the tests don't compete for the processor)
+    wstring throughputParses    = cons().get_option(L"test-throughput");
+    wstring throughputSize      = cons().get_option(L"test-throughput-size");
+    bool    showThroughput      = !throughputParses.empty() || !throughputSize.empty();
+    
+    if (showThroughput) {
+        long minParses  = wcstol(throughputParses.c_str(), NULL, 10);
+        long minBytes   = wcstol(throughputSize.c_str(), NULL, 10);
+        
+        util::stopwatch throughputTime;
+        for (vector<test_run>::iterator run = testRuns.begin(); run != testRuns.end(); ++run) {
+            measure_throughput(*run, minParses, minBytes);
+        }
+        profile->add_timing(L"throughput", throughputTime.seconds());
+    }
+
+    // Report the results
+    bool firstTestSet   = true;
+    bool runAnyTests    = false;
+    bool showTiming     = !cons().get_option(L"show-test-timing").empty();
+
+    for (vector<test_block_run>::iterator block = blocks.begin(); block != blocks.end(); ++block) {
+        const test_block* tests = block->tests;
+
         // Flag up that we've hit at least one test block
         runAnyTests = true;
 
-        // Retrieve the language for this test
-        const language_block*   language        = m_Import->language_with_name(tests->language());
-        wstring                 languageFile    = m_Import->file_with_language(tests->language());
-
         // Error if the language could not be found
-        if (!language) {
+        if (block->languageIndex < 0) {
             wstringstream msg;
             msg << L"Unable to find language '" << tests->language() << "'";
             cons().report_error(error(error::sev_error, filename(), L"CANT_FIND_LANGUAGE", msg.str(), tests->start_pos()));
@@ -222,74 +627,40 @@ void test_stage::compile() {
         int passed  = 0;
         int failed  = 0;
 
-        // Get the lexer for this language
-        lexer_stage* lexer = get_lexer(tests->language(), tests->start_pos());
+        // Do nothing more if the lexer doesn't exist (failed to build)
+        // The lexer compiler should have reported an error so this should be OK
+        lexer_stage* lexer = languages[block->languageIndex].lexer;
         if (!lexer || !lexer->get_lexer()) {
-            // Do nothing more if the lexer doesn't exist (failed to build)
-            // The lexer compiler should have reported an error so this should be OK
             continue;
         }
 
         // Test IDs for given test names
         map<wstring, int> testIds;
+        
+        // The slowest test in this block
+        wstring slowestName;
+        double  slowestTime = -1;
+        
+        // The throughput of all the tests in this block
+        test_throughput blockThroughput;
 
-        // Run the tests themselves
-        for (test_block::iterator testDefn = tests->begin(); testDefn != tests->end(); ++testDefn) {
-            // Compile a language for this nonterminal if one doesn't exist already
-            // TODO: deal with nonterminals in other languages
-            lr_parser_stage* parserStage = get_parser(tests->language(), (*testDefn)->nonterminal(), tests->start_pos());
-
-            // Get the text to be tested
-            // TODO: deal with 'from' items
-            wstringstream testText;
-
-            if ((*testDefn)->type() == test_definition::match_from_file) {
-                // Read from the supplied file (which we assume is in UTF-8 format)
-                istream* fromFile = cons().open_file((*testDefn)->test_string());
-
-                // Error if the file doesn't exist
-                if (!fromFile) {
-                    cons().report_error(error(error::sev_error, (*testDefn)->test_string(), L"TEST_FILE_NOT_FOUND", L"File not found", position(-1, -1, -1)));
-                    continue;
-                }
-
-                // Read in as UTF-8
-                utf8reader reader(fromFile, true);
-
-                for (;;) {
-                    // Get the next character
-                    wchar_t nextChar;
-                    reader.get(nextChar);
-
-                    // Stop at the end (or if the stream goes ungood for any reason)
-                    if (!reader.good()) break;
+        for (size_t testNum = block->firstTest; testNum < block->endTest; ++testNum) {
+            test_run&           run         = testRuns[testNum];
+            test_definition*    testDefn    = run.definition;
 
-                    // Store this character
-                    testText << nextChar;
-                }
-            } else {
-                // Just use the literal test string
-                testText << (*testDefn)->test_string();
+            // Error if the file doesn't exist
+            if (run.fileMissing) {
+                cons().report_error(error(error::sev_error, testDefn->test_string(), L"TEST_FILE_NOT_FOUND", L"File not found", position(-1, -1, -1)));
+                continue;
             }
 
-            // Create the parser
-            simple_parser parser(parserStage->get_tables(), false);
-
-            // Create the lexeme stream
-            lexeme_stream* stream = lexer->get_lexer()->create_stream_from(testText);
-
-            // Create the parser state
-            simple_parser::state* parseState = parser.create_parser(new simple_parser_actions(stream));
-
-            // Run the test
-            bool result = parseState->parse();
-
-            // The result is inverted if the test type is a no match test
-            if ((*testDefn)->type() == test_definition::no_match) {
-                // We expect to not be able to parse this
-                result = !result;
+            // Skip tests whose parser could not be built (the parser stage will have reported why)
+            if (!run.parser || !run.parser->get_tables()) {
+                continue;
             }
 
+            bool result = run.result;
+
             // Work out a name for this test
             wstringstream testName;
 
@@ -297,12 +668,12 @@ void test_stage::compile() {
             testName << tests->language() << L".";
 
             // Followed up by the identifier or the nonterminal if none is available
-            if (!(*testDefn)->identifier().empty()) {
+            if (!testDefn->identifier().empty()) {
                 // Use the test identifier instead if one is supplied
-                testName << (*testDefn)->identifier();
+                testName << testDefn->identifier();
             } else {
                 // Use the nonterminal
-                testName << (*testDefn)->nonterminal();
+                testName << testDefn->nonterminal();
             }
 
             // Finally, get the identifier so identically named tests can be handled
@@ -314,34 +685,59 @@ void test_stage::compile() {
             wstring finalName(testName.str());
             testMessages    << L"      " << finalName 
                             << wstring(54 - finalName.size(), L'.')
-                            << (result?L"ok":L"FAILED")
-                            << endl;
+                            << (result?L"ok":L"FAILED");
+            
+            // Write out the time taken and the throughput if requested
+            if (showTiming) {
+                testMessages << wstring(result?5:1, L' ') << setw(10) << fixed << setprecision(3) << run.seconds * 1000.0 << L"ms "
+                             << setw(8) << run.lexemes.lexemes << L" lexemes ";
+                if (run.seconds > 0) {
+                    testMessages << setw(12) << setprecision(0) << run.lexemes.lexemes / run.seconds << L" lexemes/s";
+                } else {
+                    testMessages << setw(12) << L"-" << L" lexemes/s";
+                }
+                
+                if (run.seconds > slowestTime) {
+                    slowestTime = run.seconds;
+                    slowestName = finalName;
+                }
+            }
+            testMessages << endl;
+            
+            // Write out the throughput if it was measured
+            if (run.throughput.parses > 0) {
+                testMessages << L"        " << run.throughput.parses << L" parses: ";
+                run.throughput.write(testMessages);
+                testMessages << endl;
+                
+                blockThroughput.add(run.throughput);
+            }
 
             // For 'from' tests, report the line number of any failure
-            if (!result && (*testDefn)->type() == test_definition::match_from_file) {
+            if (!result && testDefn->type() == test_definition::match_from_file) {
                 position failPos(-1, -1, -1);
-                if (parseState->look().item()) {
-                    failPos = parseState->look()->pos();
+                if (run.hasFailLexeme) {
+                    failPos = run.failLexemePos;
                 }
 
-                cons().report_error(error(error::sev_warning, (*testDefn)->test_string(), L"TEST_SYNTAX_ERROR", L"Syntax error in test file", failPos));
+                cons().report_error(error(error::sev_warning, testDefn->test_string(), L"TEST_SYNTAX_ERROR", L"Syntax error in test file", failPos));
             } else if (!result) {
                 // For other tests, report which line failed
-                cons().report_error(error(error::sev_error, filename(), L"THIS_TEST_FAILED", L"Test failed", (*testDefn)->test_string_position()));
+                cons().report_error(error(error::sev_error, filename(), L"THIS_TEST_FAILED", L"Test failed", testDefn->test_string_position()));
 
                 // Report where in the test the failure occurred if we can
-                if ((*testDefn)->type() != test_definition::no_match) {
-                    position failPos = (*testDefn)->test_string_position();
+                if (testDefn->type() != test_definition::no_match) {
+                    position failPos = testDefn->test_string_position();
 
-                    if (parseState->look().item()) {
+                    if (run.hasFailLexeme) {
                         // Failed at a specific item
-                        position itemPos = parseState->look()->pos();
+                        position itemPos = run.failLexemePos;
 
                         // Adjust the position
                         failPos = position(failPos.offset() + itemPos.offset(), failPos.line() + itemPos.line(), (itemPos.line()==0?failPos.column():0)+itemPos.column());
                     } else {
                         // Failed at the end of the definition
-                        failPos = (*testDefn)->end_pos();
+                        failPos = testDefn->end_pos();
                     }
 
                     // Report the failure
@@ -355,9 +751,6 @@ void test_stage::compile() {
             } else {
                 ++failed;
             }
-
-            // Done with the parser
-            delete parseState;
         }
         
         // Write the messages. We use the verbose stream if the tests mostly passed
@@ -370,6 +763,21 @@ void test_stage::compile() {
         // Final message
         cons().message_stream() << L"    " << tests->language() << L": " << passed << L"/" << (passed+failed) << L" passed" << endl;
         
+        // Point out the slowest test so it stands out
+        if (showTiming && slowestTime >= 0) {
+            wstringstream slowest;
+            slowest << L"    Slowest test: " << slowestName << L" (" << fixed << setprecision(3) << slowestTime * 1000.0 << L"ms)";
+            cons().message_stream() << slowest.str() << endl;
+        }
+        
+        // Summarise the throughput for the language
+        if (showThroughput && blockThroughput.parses > 0) {
+            wstringstream throughput;
+            throughput << L"    " << tests->language() << L" throughput: ";
+            blockThroughput.write(throughput);
+            cons().message_stream() << throughput.str() << endl;
+        }
+        
         // Warning if there are no tests for this language
         if (passed == 0 && failed == 0) {
             cons().report_error(error(error::sev_warning, filename(), L"NO_TESTS_TO_RUN", L"Found an empty test block", tests->start_pos()));
@@ -67,16 +67,6 @@ namespace compiler {
         /// \brief Parsers for the nonterminals and languages that have tests
         parser_map m_Parsers;
 
-     private:
-        /// \brief Retrieves the language stage for the language with the specified name
-        language_stage* get_language(const std::wstring& languageName, const dfa::position& pos);
-
-        /// \brief Retrieves the lexer for the language with the specified name
-        lexer_stage* get_lexer(const std::wstring& languageName, const dfa::position& pos);
-        
-        /// \brief Retrieves the parser for the language with the specified name
-        lr_parser_stage* get_parser(const std::wstring& languageName, const std::wstring& nonterminalName, const dfa::position& pos);
-
     public:
         /// \brief Creates a new test stage that will run the tests in the specified definition file
         test_stage(console_container& console, const std::wstring& filename, const language::definition_file_container& definition, const import_stage* import);
@@ -85,6 +75,9 @@ namespace compiler {
         virtual ~test_stage();
 
         /// \brief Performs the actions associated with this compilation stage
+        ///
+        /// The languages that have tests are built in parallel, followed by the tests themselves. The results are
+        /// reported in the same order as the tests appear in the definition file.
         virtual void compile();
     };
 }
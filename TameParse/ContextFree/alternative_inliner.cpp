@@ -0,0 +1,152 @@
+//
+//  alternative_inliner.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#include "TameParse/ContextFree/alternative_inliner.h"
+#include "TameParse/ContextFree/ebnf_items.h"
+
+using namespace std;
+using namespace contextfree;
+
+/// \brief Creates an inliner that will replace each rule by at most maxRules rules
+alternative_inliner::alternative_inliner(size_t maxRules)
+: m_MaxRules(maxRules)
+, m_Inlined(0) {
+}
+
+/// \brief Appends the rules that should replace the specified rule to a list
+void alternative_inliner::inline_rule(const rule_container& source, rule_list& target) {
+    const rule& sourceRule  = *source;
+    bool        changed     = false;
+    
+    // The rules that have been generated so far: each item is appended to all of these, and alternatives multiply them
+    rule_list partial;
+    partial.push_back(rule_container(new rule(sourceRule.nonterminal()), true));
+    
+    for (size_t pos = 0; pos < sourceRule.items().size(); ++pos) {
+        const item_container&   thisItem    = sourceRule.items()[pos];
+        int                     key         = sourceRule.get_key(pos);
+        
+        // Try to inline alternatives
+        if (thisItem->type() == item::alternative && key == 0) {
+            const ebnf* alternate = thisItem->cast_ebnf();
+            
+            // Inline anything inside the alternatives first, so nested alternatives are flattened as well
+            rule_list choices;
+            for (ebnf::rule_iterator choice = alternate->first_rule(); choice != alternate->last_rule(); ++choice) {
+                inline_rule(*choice, choices);
+            }
+            
+            if (!choices.empty() && partial.size() * choices.size() <= m_MaxRules) {
+                // Each of the rules so far gets a copy for each choice
+                rule_list expanded;
+                
+                for (rule_list::const_iterator soFar = partial.begin(); soFar != partial.end(); ++soFar) {
+                    for (rule_list::const_iterator choice = choices.begin(); choice != choices.end(); ++choice) {
+                        rule_container newRule(new rule(**soFar), true);
+                        (*newRule) << **choice;
+                        expanded.push_back(newRule);
+                    }
+                }
+                
+                partial.swap(expanded);
+                changed = true;
+                ++m_Inlined;
+                continue;
+            }
+        }
+        
+        // Other items are appended to every rule, after inlining anything inside them
+        item_container newItem = inline_item(thisItem);
+        if (newItem.item() != thisItem.item()) changed = true;
+        
+        for (rule_list::iterator soFar = partial.begin(); soFar != partial.end(); ++soFar) {
+            (**soFar) << newItem;
+            if (key != 0) (*soFar)->set_key((*soFar)->items().size() - 1, key);
+        }
+    }
+    
+    // Keep the original rule if nothing was inlined
+    if (!changed) {
+        target.push_back(source);
+        return;
+    }
+    
+    // Add the new rules, leaving out any duplicates (which can happen for alternatives like (a | a))
+    for (rule_list::const_iterator newRule = partial.begin(); newRule != partial.end(); ++newRule) {
+        bool duplicate = false;
+        
+        for (rule_list::const_iterator existing = target.begin(); existing != target.end(); ++existing) {
+            if (**existing == **newRule) {
+                duplicate = true;
+                break;
+            }
+        }
+        
+        if (!duplicate) target.push_back(*newRule);
+    }
+}
+
+/// \brief Returns an item with the alternatives inside it inlined, or the same item if nothing changed
+item_container alternative_inliner::inline_item(const item_container& source) {
+    // Only EBNF items contain rules (guards are left alone: inlining doesn't make them any faster to evaluate)
+    item::kind type = source->type();
+    if (type != item::optional && type != item::repeat && type != item::repeat_zero_or_one && type != item::alternative) {
+        return source;
+    }
+    
+    const ebnf* sourceEbnf = source->cast_ebnf();
+    if (!sourceEbnf) return source;
+    
+    // Items that appear in more than one place only need to be rewritten once
+    item_map<item_container>::type::const_iterator found = m_Rewritten.find(source);
+    if (found != m_Rewritten.end()) return found->second;
+    
+    // Inline the rules in this item
+    rule_list   newRules;
+    bool        changed = false;
+    
+    for (ebnf::rule_iterator sourceRule = sourceEbnf->first_rule(); sourceRule != sourceEbnf->last_rule(); ++sourceRule) {
+        size_t before = newRules.size();
+        inline_rule(*sourceRule, newRules);
+        
+        if (newRules.size() != before + 1 || newRules.back().item() != sourceRule->item()) changed = true;
+    }
+    
+    // Create a new item of the same kind if the rules have changed
+    item_container result = source;
+    
+    if (changed) {
+        switch (type) {
+            case item::optional:            result = item_container(new ebnf_optional(newRules), true);             break;
+            case item::repeat:              result = item_container(new ebnf_repeating(newRules), true);            break;
+            case item::repeat_zero_or_one:  result = item_container(new ebnf_repeating_optional(newRules), true);   break;
+            default:                        result = item_container(new ebnf_alternate(newRules), true);            break;
+        }
+    }
+    
+    m_Rewritten[source] = result;
+    return result;
+}
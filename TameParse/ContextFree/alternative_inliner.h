@@ -0,0 +1,82 @@
+//
+//  alternative_inliner.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _CONTEXTFREE_ALTERNATIVE_INLINER_H
+#define _CONTEXTFREE_ALTERNATIVE_INLINER_H
+
+#include <map>
+
+#include "TameParse/ContextFree/rule.h"
+#include "TameParse/ContextFree/item.h"
+
+namespace contextfree {
+    ///
+    /// \brief Rewrites rules so that they contain the rules of their alternative items instead of the items themselves
+    ///
+    /// An alternative item such as (a | b) behaves like a hidden nonterminal, so the parser has to perform an extra
+    /// reduction for it, and the syntax tree gets an extra node. Inlining the alternative replaces a rule like
+    /// 'x = p (a | b) q' with the rules 'x = p a q' and 'x = p b q', which describe the same language without the
+    /// extra reduction. The rules inside optional and repeating items are rewritten in the same way, so (a | b)* becomes
+    /// a single left-recursive list with one reduction for each item.
+    ///
+    /// Rules can grow exponentially with the number of alternatives they contain, so alternatives are left in place once
+    /// a rule would be replaced by more than a fixed number of rules. Alternatives with attributes (which have a key in
+    /// the rule that contains them) and anything inside a guard are also left alone.
+    ///
+    class alternative_inliner {
+    public:
+        /// \brief The default maximum number of rules that a single rule can be replaced by
+        static const size_t default_max_rules = 16;
+        
+    private:
+        /// \brief The maximum number of rules that a single rule can be replaced by
+        size_t m_MaxRules;
+        
+        /// \brief The number of alternative items that have been inlined
+        int m_Inlined;
+        
+        /// \brief EBNF items that have already been rewritten, mapped to the items they were replaced with
+        item_map<item_container>::type m_Rewritten;
+        
+    public:
+        /// \brief Creates an inliner that will replace each rule by at most maxRules rules
+        explicit alternative_inliner(size_t maxRules = default_max_rules);
+        
+        /// \brief Appends the rules that should replace the specified rule to a list
+        ///
+        /// The original rule is appended unchanged if it has nothing to inline. The new rules have the same nonterminal
+        /// as the original, and the items copied into them keep their keys.
+        void inline_rule(const rule_container& source, rule_list& target);
+        
+        /// \brief Returns an item with the alternatives inside it inlined, or the same item if nothing changed
+        item_container inline_item(const item_container& source);
+        
+        /// \brief The number of alternative items that have been inlined so far
+        inline int count_inlined() const { return m_Inlined; }
+    };
+}
+
+#endif
@@ -96,7 +96,7 @@ bool ebnf::operator==(const item& compareTo) const {
     
     // Compare types
     int ourType     = type();
-    int theirType   = compareTo.type();
+    int theirType   = compareTo.tag().kind;
     if (ourType != theirType) return false;
     
     // Turn into an EBNF item
@@ -125,7 +125,7 @@ bool ebnf::operator<(const item& compareTo) const {
     
     // Compare types
     int ourType     = type();
-    int theirType   = compareTo.type();
+    int theirType   = compareTo.tag().kind;
     if (ourType < theirType) return true;
     if (ourType > theirType) return false;
     
@@ -179,19 +179,19 @@ item::kind ebnf_optional::type() const {
 /// The 'empty' and 'follow' items can be used to create special meaning (empty indicates the first set should be extended to include
 /// anything after in the rule, follow indicates that the first set should also contain any lookahead for the rule)
 item_set ebnf_optional::first(const grammar& gram) const {
-    // Result is the empty item, plus the first item in the rule
+    // Result is the empty item, plus the first item in each rule
     item_set result(gram);
     result.insert(the_empty_item);
     
-    // Get the rule
-    const rule& r = *get_rule();
-    
-    // Add items if the rule has a first item
-    if (r.items().size() > 0) {
-        const item_set& ruleItems = gram.first(*(r.items()[0]));
-        result.merge(ruleItems);
-    } else {
-        result.insert(the_empty_item);
+    // Add items for the rules that have a first item (there's usually only one rule, but there can be more if
+    // alternatives have been inlined)
+    for (rule_iterator nextRule = first_rule(); nextRule != last_rule(); ++nextRule) {
+        const rule& r = **nextRule;
+        
+        if (r.items().size() > 0) {
+            const item_set& ruleItems = gram.first(*(r.items()[0]));
+            result.merge(ruleItems);
+        }
     }
     
     return result;
@@ -211,7 +211,10 @@ void ebnf_optional::closure(const lr::lr1_item& item, lr::lr1_item_set& state, c
     
     // Add new items
     insert_closure_item(lr1_item_container(new lr1_item(&gram, empty_rule, 0, follow), true), state, gram);
-    insert_closure_item(lr1_item_container(new lr1_item(&gram, get_rule(), 0, follow), true), state, gram);
+    
+    for (rule_iterator nextRule = first_rule(); nextRule != last_rule(); ++nextRule) {
+        insert_closure_item(lr1_item_container(new lr1_item(&gram, *nextRule, 0, follow), true), state, gram);
+    }
 }
 
 /// \brief Creates a clone of this item
@@ -232,16 +235,17 @@ item::kind ebnf_repeating::type() const {
 /// The 'empty' and 'follow' items can be used to create special meaning (empty indicates the first set should be extended to include
 /// anything after in the rule, follow indicates that the first set should also contain any lookahead for the rule)
 item_set ebnf_repeating::first(const grammar& gram) const {
-    // Result is the first item in the rule
+    // Result is the first item in each rule
     item_set result(gram);
     
-    // Get the rule
-    const rule& r = *get_rule();
-    
-    // Add items if the rule has a first item
-    if (r.items().size() > 0) {
-        const item_set& ruleItems = gram.first(*(r.items()[0]));
-        result.merge(ruleItems);
+    for (rule_iterator nextRule = first_rule(); nextRule != last_rule(); ++nextRule) {
+        const rule& r = **nextRule;
+        
+        // Add items if the rule has a first item
+        if (r.items().size() > 0) {
+            const item_set& ruleItems = gram.first(*(r.items()[0]));
+            result.merge(ruleItems);
+        }
     }
     
     return result;
@@ -252,17 +256,18 @@ void ebnf_repeating::closure(const lr::lr1_item& item, lr::lr1_item_set& state,
     // Use the item_container from the item to save on copying
     const item_container& ourItem = item.rule()->items()[item.offset()];
     
-    // Just the rule in this item, or a repetition
-    rule_container many_rule(new rule(ourItem), true);
-    (*many_rule) << ourItem << get_rule();
-    
     // Work out the follow set
     item_set follow(gram);
     fill_follow(follow, item, gram);
     
-    // Add new items
-    insert_closure_item(lr1_item_container(new lr1_item(&gram, get_rule(), 0, follow), true), state, gram);
-    insert_closure_item(lr1_item_container(new lr1_item(&gram, many_rule, 0, follow), true), state, gram);
+    // Each rule in this item, or a repetition followed by that rule
+    for (rule_iterator nextRule = first_rule(); nextRule != last_rule(); ++nextRule) {
+        rule_container many_rule(new rule(ourItem), true);
+        (*many_rule) << ourItem << *nextRule;
+        
+        insert_closure_item(lr1_item_container(new lr1_item(&gram, *nextRule, 0, follow), true), state, gram);
+        insert_closure_item(lr1_item_container(new lr1_item(&gram, many_rule, 0, follow), true), state, gram);
+    }
 }
 
 /// \brief Creates a clone of this item
@@ -283,19 +288,18 @@ item::kind ebnf_repeating_optional::type() const {
 /// The 'empty' and 'follow' items can be used to create special meaning (empty indicates the first set should be extended to include
 /// anything after in the rule, follow indicates that the first set should also contain any lookahead for the rule)
 item_set ebnf_repeating_optional::first(const grammar& gram) const {
-    // Result is the empty item, plus the first item in the rule
+    // Result is the empty item, plus the first item in each rule
     item_set result(gram);
     result.insert(the_empty_item);
     
-    // Get the rule
-    const rule& r = *get_rule();
-    
-    // Add items if the rule has a first item
-    if (r.items().size() > 0) {
-        const item_set& ruleItems = gram.first(*(r.items()[0]));
-        result.merge(ruleItems);
-    } else {
-        result.insert(the_empty_item);
+    for (rule_iterator nextRule = first_rule(); nextRule != last_rule(); ++nextRule) {
+        const rule& r = **nextRule;
+        
+        // Add items if the rule has a first item
+        if (r.items().size() > 0) {
+            const item_set& ruleItems = gram.first(*(r.items()[0]));
+            result.merge(ruleItems);
+        }
     }
     
     return result;    
@@ -306,10 +310,8 @@ void ebnf_repeating_optional::closure(const lr::lr1_item& item, lr::lr1_item_set
     // Use the item_container from the item to save on copying
     const item_container& ourItem = item.rule()->items()[item.offset()];
     
-    // Empty, or a repetition
+    // Empty, or a repetition followed by one of the rules in this item
     rule_container empty_rule(new rule(ourItem), true);
-    rule_container many_rule(new rule(ourItem), true);
-    (*many_rule) << ourItem << get_rule();
     
     // Work out the follow set
     item_set follow(gram);
@@ -317,7 +319,13 @@ void ebnf_repeating_optional::closure(const lr::lr1_item& item, lr::lr1_item_set
     
     // Add new items
     insert_closure_item(lr1_item_container(new lr1_item(&gram, empty_rule, 0, follow), true), state, gram);
-    insert_closure_item(lr1_item_container(new lr1_item(&gram, many_rule, 0, follow), true), state, gram);
+    
+    for (rule_iterator nextRule = first_rule(); nextRule != last_rule(); ++nextRule) {
+        rule_container many_rule(new rule(ourItem), true);
+        (*many_rule) << ourItem << *nextRule;
+        
+        insert_closure_item(lr1_item_container(new lr1_item(&gram, many_rule, 0, follow), true), state, gram);
+    }
 }
 
 /// \brief Adds a new rule
@@ -121,6 +121,7 @@ namespace contextfree {
     public:
         inline ebnf_optional() : ebnf() { }
         inline ebnf_optional(const rule& optionalRule) : ebnf(optionalRule) { }
+        inline explicit ebnf_optional(const rule_list& rules) : ebnf(rules) { }
         
         /// \brief Creates a clone of this item
         virtual item* clone() const;
@@ -151,6 +152,7 @@ namespace contextfree {
     public:
         inline ebnf_repeating() : ebnf() { }
         inline ebnf_repeating(const rule& repeatingRule) : ebnf(repeatingRule) { }
+        inline explicit ebnf_repeating(const rule_list& rules) : ebnf(rules) { }
         
         /// \brief Creates a clone of this item
         virtual item* clone() const;
@@ -181,6 +183,7 @@ namespace contextfree {
     public:
         inline ebnf_repeating_optional() : ebnf() { }
         inline ebnf_repeating_optional(const rule& repeatingRule) : ebnf(repeatingRule) { }
+        inline explicit ebnf_repeating_optional(const rule_list& rules) : ebnf(rules) { }
         
         /// \brief Creates a clone of this item
         virtual item* clone() const;
@@ -211,6 +214,7 @@ namespace contextfree {
     public:
         inline ebnf_alternate() : ebnf() { }
         inline ebnf_alternate(const rule& firstRule) : ebnf(firstRule) { }
+        inline explicit ebnf_alternate(const rule_list& rules) : ebnf(rules) { }
         
         /// \brief Adds a new rule
         rule_container add_rule();
@@ -26,7 +26,12 @@
 //
 
 #include "TameParse/ContextFree/grammar.h"
+#include "TameParse/ContextFree/ebnf_items.h"
+#include "TameParse/ContextFree/guard.h"
 #include "TameParse/Lr/lr_item.h"
+#include "TameParse/Util/parallel.h"
+
+#include <set>
 
 using namespace std;
 using namespace contextfree;
@@ -37,11 +42,12 @@ static const rule_list empty_rule_set;
 // An empty item
 static empty_item an_empty_item;
 
-// An item container with an empty item in it
-static item_container an_empty_item_c(&an_empty_item, false);
+// An item container with an empty item in it (one per thread, as copying it changes its reference count)
+static TAMEPARSE_THREAD_LOCAL item_container an_empty_item_c(&an_empty_item, false);
 
 /// \brief Creates an empty grammar
-grammar::grammar() {
+grammar::grammar()
+: m_FirstSetsComputed(false) {
     m_EpsilonSet = new item_set(this);
     m_EpsilonSet->insert(an_empty_item_c);
 }
@@ -77,6 +83,7 @@ grammar& grammar::operator=(const grammar& assignFrom) {
     m_CachedFirstSets.clear();
     m_CachedFollowSets.clear();
     m_CachedItemSets.clear();
+    m_FirstSetsComputed = false;
     
     // Finished
     return *this;
@@ -84,19 +91,21 @@ grammar& grammar::operator=(const grammar& assignFrom) {
 
 /// \brief Returns the rules for the nonterminal with the specified identifier
 rule_list& grammar::rules_for_nonterminal(int id) {
+    // Nonterminal identifiers are item identifiers, so they are small and dense
+    if (id >= (int) m_Nonterminals.size()) {
+        m_Nonterminals.resize(id + 1);
+    }
+    
     return m_Nonterminals[id];
 }
 
 /// \brief Returns the rules for the nonterminal with the specified identifier (or an empty rule set if the nonterminal is not defined)
 const rule_list& grammar::rules_for_nonterminal(int id) const {
-    // Try to find this identifier
-    nonterminal_rule_map::const_iterator found = m_Nonterminals.find(id);
-    
-    // Use the empty rule set if it couldn't be found
-    if (found == m_Nonterminals.end()) return empty_rule_set;
+    // Use the empty rule set if there are no rules for this identifier
+    if (id < 0 || id >= (int) m_Nonterminals.size()) return empty_rule_set;
     
     // Return the set that we found
-    return found->second;
+    return m_Nonterminals[id];
 }
 
 /// \brief Returns the rules for the nonterminal with the specified name
@@ -120,10 +129,14 @@ int grammar::id_for_nonterminal(const wstring& name) {
         // Store as an item
         item_container newNonterminal(new nonterminal(newIdentifier), true);
         m_ItemIdentifiers[newNonterminal]   = newIdentifier;
-        m_ItemForIdentifier[newIdentifier]  = newNonterminal;
+        m_ItemForIdentifier.push_back(newNonterminal);
         
         // Store this rule
         found = m_NameToNonterminal.insert(pair<wstring, int>(name, newIdentifier)).first;
+        
+        if (newIdentifier >= (int) m_NonterminalToName.size()) {
+            m_NonterminalToName.resize(newIdentifier + 1);
+        }
         m_NonterminalToName[newIdentifier] = name;
     }
     
@@ -152,7 +165,7 @@ int grammar::identifier_for_rule(const rule_container& rule) const {
     // Create a new rule if we haven't set an ID for this one yet
     int newId                   = (int) m_RuleIdentifiers.size();
     m_RuleIdentifiers[rule]     = newId;
-    m_RuleForIdentifier[newId]  = rule;
+    m_RuleForIdentifier.push_back(rule);
     
     return newId;
 }
@@ -160,12 +173,11 @@ int grammar::identifier_for_rule(const rule_container& rule) const {
 /// \brief Returns the rule for a particular identifier
 const rule_container& grammar::rule_with_identifier(int id) const {
     // Empty rule that we use when we fail
-    static rule             empty_rule(an_empty_item);
-    static rule_container   empty_rule_container(&empty_rule, false);
+    static rule                                 empty_rule(an_empty_item);
+    static TAMEPARSE_THREAD_LOCAL rule_container empty_rule_container(&empty_rule, false);
     
     // Try to find this ID
-    identifier_rule_map::const_iterator found = m_RuleForIdentifier.find(id);
-    if (found != m_RuleForIdentifier.end()) return found->second;
+    if (id >= 0 && id < (int) m_RuleForIdentifier.size()) return m_RuleForIdentifier[id];
     
     // Return the placeholder rule container if it wasn't found
     return empty_rule_container;
@@ -182,7 +194,7 @@ int grammar::identifier_for_item(const item_container& item) const {
     // Create a new rule if we haven't set an ID for this one yet
     int newId                   = (int) m_ItemIdentifiers.size();
     m_ItemIdentifiers[item]     = newId;
-    m_ItemForIdentifier[newId]  = item;
+    m_ItemForIdentifier.push_back(item);
     
     return newId;
 }
@@ -190,12 +202,11 @@ int grammar::identifier_for_item(const item_container& item) const {
 /// \brief Returns the item that has the specified identifier
 const item_container& grammar::item_with_identifier(int id) const {
     // Empty rule that we use when we fail
-    static empty_item       empty;
-    static item_container   empty_container(&empty, false);
+    static empty_item                           empty;
+    static TAMEPARSE_THREAD_LOCAL item_container empty_container(&empty, false);
     
     // Try to find this ID
-    identifier_item_map::const_iterator found = m_ItemForIdentifier.find(id);
-    if (found != m_ItemForIdentifier.end()) return found->second;
+    if (id >= 0 && id < (int) m_ItemForIdentifier.size()) return m_ItemForIdentifier[id];
     
     // Return the placeholder rule container if it wasn't found
     return empty_container;
@@ -210,21 +221,29 @@ void grammar::clear_caches() const {
     m_CachedFirstSets.clear();
     m_CachedFollowSets.clear();
     m_CachedItemSets.clear();
+    m_FirstSetsComputed = false;
 }
 
-/// \brief Returns the cached LR(1) item set for the item with the specified ID
+/// \brief Returns the cached LR(1) item set for the item with the specified ID, or NULL if it hasn't been stored yet
 ///
-/// This will be empty after the cache has been cleared.
-lr::lr1_item_set& grammar::cached_set_for_item(int id) const {
-    // Try to find the cached item set
-    lr1_item_set_cache::iterator found = m_CachedItemSets.find(id);
+/// This will be NULL after the cache has been cleared.
+const lr::lr1_item_set* grammar::cached_set_for_item(int id) const {
+    lr1_item_set_cache::const_iterator found = m_CachedItemSets.find(id);
+    if (found == m_CachedItemSets.end()) return NULL;
     
-    // Create a new item set if not found
+    return found->second;
+}
+
+/// \brief Stores the LR(1) item set for the item with the specified ID, and returns the cached copy
+const lr::lr1_item_set& grammar::store_cached_set_for_item(int id, const lr::lr1_item_set& itemSet) const {
+    // Create a new item set if there isn't one already
+    lr1_item_set_cache::iterator found = m_CachedItemSets.find(id);
     if (found == m_CachedItemSets.end()) {
         found = m_CachedItemSets.insert(pair<int, lr::lr1_item_set*>(id, new lr::lr1_item_set())).first;
     }
     
-    // Return the result
+    // Replace its contents
+    *(found->second) = itemSet;
     return *(found->second);
 }
 
@@ -242,6 +261,14 @@ const item_set& grammar::first(const item_container& item) const {
     // Return the value we found if it's already in the cache
     if (found != m_CachedFirstSets.end()) return found->second;
     
+    // Fill in the sets for all of the nonterminals the first time that anything is requested
+    if (!m_FirstSetsComputed) {
+        fill_first();
+        
+        found = m_CachedFirstSets.find(item);
+        if (found != m_CachedFirstSets.end()) return found->second;
+    }
+    
     // Not found: create an empty item set so recursive calls to this method terminate
     found = m_CachedFirstSets.insert(pair<item_container, item_set>(item, item_set(this))).first;
     
@@ -252,6 +279,176 @@ const item_set& grammar::first(const item_container& item) const {
     return found->second;
 }
 
+/// \brief Divides a graph into strongly connected components
+///
+/// Components are appended to the result in reverse topological order, so every component appears after all of
+/// the components that it has edges to. The traversal uses an explicit call stack, as the chains can be long
+/// for large grammars.
+static void strongly_connected_components(const vector<vector<int> >& edges, vector<vector<int> >& components) {
+    const int               numNodes    = (int) edges.size();
+    const int               complete    = numNodes + 1;
+    vector<int>             lowLink(numNodes, 0);
+    vector<int>             depth(numNodes, 0);
+    vector<int>             sccStack;
+    vector<pair<int, int> > callStack;
+    
+    for (int startNode = 0; startNode < numNodes; ++startNode) {
+        if (lowLink[startNode] != 0) continue;
+        
+        // Visit the first node
+        sccStack.push_back(startNode);
+        lowLink[startNode] = depth[startNode] = (int) sccStack.size();
+        callStack.push_back(pair<int, int>(startNode, 0));
+        
+        while (!callStack.empty()) {
+            int node = callStack.back().first;
+            
+            if (callStack.back().second < (int) edges[node].size()) {
+                // Move on to the next node that this one depends on
+                int nextNode = edges[node][callStack.back().second++];
+                
+                if (lowLink[nextNode] == 0) {
+                    sccStack.push_back(nextNode);
+                    lowLink[nextNode] = depth[nextNode] = (int) sccStack.size();
+                    callStack.push_back(pair<int, int>(nextNode, 0));
+                } else if (lowLink[nextNode] < lowLink[node]) {
+                    lowLink[node] = lowLink[nextNode];
+                }
+                continue;
+            }
+            
+            // This is the root of a component if nothing below it reached further up the stack
+            if (lowLink[node] == depth[node]) {
+                components.push_back(vector<int>());
+                
+                for (;;) {
+                    int member = sccStack.back();
+                    sccStack.pop_back();
+                    lowLink[member] = complete;
+                    components.back().push_back(member);
+                    
+                    if (member == node) break;
+                }
+            }
+            
+            // Return to the parent node
+            callStack.pop_back();
+            
+            if (!callStack.empty()) {
+                int parent = callStack.back().first;
+                if (lowLink[node] < lowLink[parent]) lowLink[parent] = lowLink[node];
+            }
+        }
+    }
+}
+
+/// \brief Finds the nonterminals and EBNF items that the FIRST set of a rule can depend on
+static void first_dependencies(const rule& rule, set<int>& nonterminals, item_list& ebnfItems) {
+    for (size_t pos = 0; pos < rule.items().size(); ++pos) {
+        const item_container& thisItem = rule.items()[pos];
+        
+        if (thisItem->type() == item::nonterminal) {
+            nonterminals.insert(thisItem->symbol());
+            continue;
+        }
+        
+        // EBNF items depend on the items in their child rules
+        const ebnf* ebnfItem = thisItem->cast_ebnf();
+        if (ebnfItem) {
+            ebnfItems.push_back(thisItem);
+            
+            for (ebnf::rule_iterator subRule = ebnfItem->first_rule(); subRule != ebnfItem->last_rule(); ++subRule) {
+                first_dependencies(**subRule, nonterminals, ebnfItems);
+            }
+        }
+    }
+}
+
+/// \brief Fills in the FIRST set cache for every nonterminal in this grammar
+void grammar::fill_first() const {
+    // Calls to first() made while this is running use the cache directly
+    m_FirstSetsComputed = true;
+    
+    // Assign a node to each nonterminal that has rules
+    map<int, int>           nodeForNonterminal;
+    vector<item_container>  nonterminalForNode;
+    vector<item_list>       ebnfForNode;
+    
+    for (int nextNt = 0; nextNt < (int) m_Nonterminals.size(); ++nextNt) {
+        if (m_Nonterminals[nextNt].empty()) continue;
+        
+        nodeForNonterminal[nextNt] = (int) nonterminalForNode.size();
+        nonterminalForNode.push_back(m_Nonterminals[nextNt].front()->nonterminal());
+    }
+    
+    // Build the dependency graph
+    const int               numNodes = (int) nonterminalForNode.size();
+    vector<vector<int> >    edges(numNodes);
+    vector<bool>            recursive(numNodes, false);
+    
+    ebnfForNode.resize(numNodes);
+    
+    for (int nextNt = 0; nextNt < (int) m_Nonterminals.size(); ++nextNt) {
+        if (m_Nonterminals[nextNt].empty()) continue;
+        
+        int         node = nodeForNonterminal[nextNt];
+        set<int>    dependsOn;
+        
+        for (rule_list::const_iterator ruleIt = m_Nonterminals[nextNt].begin(); ruleIt != m_Nonterminals[nextNt].end(); ++ruleIt) {
+            first_dependencies(**ruleIt, dependsOn, ebnfForNode[node]);
+        }
+        
+        for (set<int>::const_iterator dependency = dependsOn.begin(); dependency != dependsOn.end(); ++dependency) {
+            map<int, int>::const_iterator target = nodeForNonterminal.find(*dependency);
+            if (target == nodeForNonterminal.end()) continue;
+            
+            if (target->second == node) recursive[node] = true;
+            edges[node].push_back(target->second);
+        }
+    }
+    
+    // Solve the components in dependency order
+    vector<vector<int> > components;
+    strongly_connected_components(edges, components);
+    
+    for (vector<vector<int> >::const_iterator component = components.begin(); component != components.end(); ++component) {
+        // Components with no recursion only need to be computed once, as everything they depend on is complete
+        if (component->size() == 1 && !recursive[component->front()]) {
+            first(nonterminalForNode[component->front()]);
+            continue;
+        }
+        
+        // Start the recursive nonterminals with empty sets
+        for (vector<int>::const_iterator member = component->begin(); member != component->end(); ++member) {
+            m_CachedFirstSets.insert(item_set_map::value_type(nonterminalForNode[*member], item_set(this)));
+        }
+        
+        // Iterate until the sets stop growing
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            
+            // The sets for EBNF items in these rules are recalculated on each pass, as they depend on the partial results
+            for (vector<int>::const_iterator member = component->begin(); member != component->end(); ++member) {
+                const item_list& ebnfItems = ebnfForNode[*member];
+                
+                for (item_list::const_iterator ebnfItem = ebnfItems.begin(); ebnfItem != ebnfItems.end(); ++ebnfItem) {
+                    m_CachedFirstSets.erase(*ebnfItem);
+                }
+            }
+            
+            for (vector<int>::const_iterator member = component->begin(); member != component->end(); ++member) {
+                const item_container&   nonterminal = nonterminalForNode[*member];
+                item_set                nextFirst   = nonterminal->first(*this);
+                
+                if (m_CachedFirstSets.find(nonterminal)->second.merge(nextFirst)) {
+                    changed = true;
+                }
+            }
+        }
+    }
+}
+
 /// \brief Computes the first set for the specified rule (or retrieves the cached version)
 item_set grammar::first_for_rule(const rule& rule) const {
     // Return a set containing only the empty item if the rule is 0 items long
@@ -291,43 +488,56 @@ const item_set& grammar::follow(const item_container& nonterminal) const {
         item_map<item_set>::type dependencies;
         
         // Iterate through all of the rules in this grammar and build up the follow set for each one
-        for (nonterminal_rule_map::const_iterator nextNt = m_Nonterminals.begin(); nextNt != m_Nonterminals.end(); ++nextNt) {
-            for (rule_list::const_iterator ruleIt = nextNt->second.begin(); ruleIt != nextNt->second.end(); ++ruleIt) {
+        for (int nextNt = 0; nextNt < (int) m_Nonterminals.size(); ++nextNt) {
+            for (rule_list::const_iterator ruleIt = m_Nonterminals[nextNt].begin(); ruleIt != m_Nonterminals[nextNt].end(); ++ruleIt) {
                 fill_follow(**ruleIt, dependencies);
             }
         }
         
-        // Fill in all of the dependencies
-        bool changed = true;
-        while (changed) {
-            changed = false;
+        // Number the items that have follow sets
+        item_map<int>::type                 nodeForItem;
+        vector<item_set_map::iterator>      followForNode;
+        
+        for (item_set_map::iterator followSet = m_CachedFollowSets.begin(); followSet != m_CachedFollowSets.end(); ++followSet) {
+            nodeForItem[followSet->first] = (int) followForNode.size();
+            followForNode.push_back(followSet);
+        }
+        
+        // Each item includes the follow sets of the nonterminals it can appear at the end of
+        vector<vector<int> > edges(followForNode.size());
+        
+        for (item_map<item_set>::type::iterator depend = dependencies.begin(); depend != dependencies.end(); ++depend) {
+            int node = nodeForItem[depend->first];
             
-            // Iterate through all of the dependencies
-            for (item_map<item_set>::type::iterator depend = dependencies.begin(); depend != dependencies.end(); ++depend) {
-                // First item is the nonterminal that depends on other nonterminal
-                const item_container& nonterminal = depend->first;
+            for (item_set::iterator dependency = depend->second.begin(); dependency != depend->second.end(); ++dependency) {
+                item_map<int>::type::const_iterator target = nodeForItem.find(*dependency);
+                if (target == nodeForItem.end() || target->second == node) continue;
                 
-                // Iterate through each nonterminal for this item
-                for (item_set::iterator dependency = depend->second.begin(); dependency != depend->second.end(); ++dependency) {
-                    if (*dependency == nonterminal) continue;
-                    
-                    // Get the follow set for this dependency
-                    item_set_map::iterator follow = m_CachedFollowSets.find(*dependency);
-
-                    if (follow != m_CachedFollowSets.end()) {
-                        // Add the items contained within this set to this dependency, and set changed if any of them cause a change
-                        item_set_map::iterator ntFollow    = m_CachedFollowSets.find(nonterminal);
-                        
-                        if (ntFollow == m_CachedFollowSets.end()) {
-                            ntFollow = m_CachedFollowSets.insert(item_set_map::value_type(nonterminal, item_set(this))).first;
-                        }
-                        
-                        if (ntFollow->second.merge(follow->second)) {
-                            changed = true;
-                        }
-                    }
+                edges[node].push_back(target->second);
+            }
+        }
+        
+        // Every item in a strongly connected component has the same follow set, and components are produced
+        // after everything that they include, so a single pass is enough
+        vector<vector<int> > components;
+        strongly_connected_components(edges, components);
+        
+        for (vector<vector<int> >::const_iterator component = components.begin(); component != components.end(); ++component) {
+            item_set& rootFollow = followForNode[component->front()]->second;
+            
+            for (vector<int>::const_iterator member = component->begin(); member != component->end(); ++member) {
+                if (member != component->begin()) {
+                    rootFollow.merge(followForNode[*member]->second);
+                }
+                
+                for (vector<int>::const_iterator target = edges[*member].begin(); target != edges[*member].end(); ++target) {
+                    rootFollow.merge(followForNode[*target]->second);
                 }
             }
+            
+            for (vector<int>::const_iterator member = component->begin() + 1; member != component->end(); ++member) {
+                followForNode[*member]->second = rootFollow;
+            }
         }
     }
     
@@ -394,6 +604,150 @@ void grammar::fill_follow(const rule& rule, item_map<item_set>::type& dependenci
     }
 }
 
+static bool rule_is_productive(const rule& rule, const set<int>& productive);
+
+/// \brief True if an item can match some input, given the nonterminals that are already known to be able to
+static bool item_is_productive(const item_container& it, const set<int>& productive) {
+    switch (it->type()) {
+        case item::nonterminal:
+            return productive.find(it->symbol()) != productive.end();
+            
+        case item::optional:
+        case item::repeat_zero_or_one:
+            // These can always match the empty string
+            return true;
+            
+        case item::guard:
+        {
+            const guard* itemGuard = it->cast_guard();
+            return !itemGuard || rule_is_productive(*itemGuard->get_rule(), productive);
+        }
+            
+        default:
+            break;
+    }
+    
+    // Other EBNF items can match if any of their rules can
+    const ebnf* ebnfItem = it->cast_ebnf();
+    if (ebnfItem) {
+        for (ebnf::rule_iterator ebnfRule = ebnfItem->first_rule(); ebnfRule != ebnfItem->last_rule(); ++ebnfRule) {
+            if (rule_is_productive(**ebnfRule, productive)) return true;
+        }
+        
+        return false;
+    }
+    
+    // Terminals and the special items always match
+    return true;
+}
+
+/// \brief True if every item in a rule can match some input
+static bool rule_is_productive(const rule& rule, const set<int>& productive) {
+    for (rule::iterator ruleItem = rule.begin(); ruleItem != rule.end(); ++ruleItem) {
+        if (!item_is_productive(*ruleItem, productive)) return false;
+    }
+    
+    return true;
+}
+
+/// \brief Adds the nonterminals that are referred to by a rule (including within EBNF items and guards) to a list
+static void add_referenced_nonterminals(const rule& rule, vector<int>& nonterminals) {
+    for (rule::iterator ruleItem = rule.begin(); ruleItem != rule.end(); ++ruleItem) {
+        const item_container& it = *ruleItem;
+        
+        if (it->type() == item::nonterminal) {
+            nonterminals.push_back(it->symbol());
+        } else if (it->cast_guard()) {
+            add_referenced_nonterminals(*it->cast_guard()->get_rule(), nonterminals);
+        } else if (it->cast_ebnf()) {
+            const ebnf* ebnfItem = it->cast_ebnf();
+            for (ebnf::rule_iterator ebnfRule = ebnfItem->first_rule(); ebnfRule != ebnfItem->last_rule(); ++ebnfRule) {
+                add_referenced_nonterminals(**ebnfRule, nonterminals);
+            }
+        }
+    }
+}
+
+/// \brief Removes the rules that can't take part in a parse that begins at one of the specified start symbols
+int grammar::prune(const item_list& startSymbols) {
+    // Find the nonterminals that can match some input (iterating until nothing changes)
+    set<int>    productive;
+    bool        changed = true;
+    
+    while (changed) {
+        changed = false;
+        
+        for (int nextNt = 0; nextNt < (int) m_Nonterminals.size(); ++nextNt) {
+            if (productive.find(nextNt) != productive.end()) continue;
+            
+            for (rule_list::const_iterator nextRule = m_Nonterminals[nextNt].begin(); nextRule != m_Nonterminals[nextNt].end(); ++nextRule) {
+                if (rule_is_productive(**nextRule, productive)) {
+                    productive.insert(nextNt);
+                    changed = true;
+                    break;
+                }
+            }
+        }
+    }
+    
+    // Find the nonterminals that can be reached from the start symbols using the rules that can match
+    set<int>    reachable;
+    vector<int> pending;
+    
+    for (item_list::const_iterator startSymbol = startSymbols.begin(); startSymbol != startSymbols.end(); ++startSymbol) {
+        if ((*startSymbol)->type() == item::nonterminal) {
+            pending.push_back((*startSymbol)->symbol());
+        }
+    }
+    
+    while (!pending.empty()) {
+        int nonterminalId = pending.back();
+        pending.pop_back();
+        
+        if (!reachable.insert(nonterminalId).second) continue;
+        
+        if (nonterminalId < 0 || nonterminalId >= (int) m_Nonterminals.size()) continue;
+        
+        const rule_list& rules = m_Nonterminals[nonterminalId];
+        
+        for (rule_list::const_iterator nextRule = rules.begin(); nextRule != rules.end(); ++nextRule) {
+            if (rule_is_productive(**nextRule, productive)) {
+                add_referenced_nonterminals(**nextRule, pending);
+            }
+        }
+    }
+    
+    // Remove the rules that can't be used
+    int numRemoved = 0;
+    
+    for (int nextNt = 0; nextNt < (int) m_Nonterminals.size(); ++nextNt) {
+        rule_list& rules = m_Nonterminals[nextNt];
+        
+        if (reachable.find(nextNt) == reachable.end()) {
+            numRemoved += (int) rules.size();
+            rules.clear();
+            continue;
+        }
+        
+        rule_list keep;
+        for (rule_list::const_iterator nextRule = rules.begin(); nextRule != rules.end(); ++nextRule) {
+            if (rule_is_productive(**nextRule, productive)) {
+                keep.push_back(*nextRule);
+            } else {
+                ++numRemoved;
+            }
+        }
+        
+        rules.swap(keep);
+    }
+    
+    if (numRemoved > 0) {
+        clear_caches();
+    }
+    
+    return numRemoved;
+}
+
 /// \brief Appends an item to the rule that this is building
 grammar::builder& grammar::builder::operator<<(const item& item) {
     m_Target << item;
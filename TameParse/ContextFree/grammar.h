@@ -30,8 +30,10 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 #include "TameParse/Util/container.h"
+#include "TameParse/Util/hash_map.h"
 
 #include "TameParse/ContextFree/item.h"
 #include "TameParse/ContextFree/rule.h"
@@ -56,20 +58,20 @@ namespace contextfree {
     ///
     class grammar {
     public:
-        /// \brief Map of nonterminal identifiers to rules
-        typedef std::map<int, rule_list> nonterminal_rule_map;
+        /// \brief The rules for each nonterminal, indexed by nonterminal identifier
+        typedef std::vector<rule_list> nonterminal_rule_map;
         
         /// \brief Map of rules to identifiers (filled in on request)
         typedef rule_map<int>::type rule_identifier_map;
         
-        /// \brief Map of identifiers to rules
-        typedef std::map<int, rule_container> identifier_rule_map;
+        /// \brief The rule for each rule identifier
+        typedef std::vector<rule_container> identifier_rule_map;
         
-        /// \brief Class that can map identifiers to their string equivalent
-        typedef std::map<int, std::wstring> identifier_to_string;
+        /// \brief The string equivalent of each identifier (empty for identifiers with no name)
+        typedef std::vector<std::wstring> identifier_to_string;
         
         /// \brief Class that can map strings to the equivalent identifiers
-        typedef std::map<std::wstring, int> string_to_identifier;
+        typedef util::hash_map<std::wstring, int>::type string_to_identifier;
         
         /// \brief Item to list of items map, used for things like first and follow sets
         typedef item_map<item_set>::type item_set_map;
@@ -77,8 +79,8 @@ namespace contextfree {
         /// \brief Map of items to identifiers
         typedef item_map<int>::type item_identifier_map;
         
-        /// \brief Map of identifiers to items
-        typedef std::map<int, item_container> identifier_item_map;
+        /// \brief The item for each item identifier
+        typedef std::vector<item_container> identifier_item_map;
 
         /// \brief Map of item identifiers to LR(1) item sets
         typedef std::map<int, lr::lr1_item_set*> lr1_item_set_cache;
@@ -103,6 +105,9 @@ namespace contextfree {
         /// \brief Cached map of FIRST sets for this grammar
         mutable item_set_map m_CachedFirstSets;
         
+        /// \brief True if the FIRST sets for every nonterminal have been filled in to m_CachedFirstSets
+        mutable bool m_FirstSetsComputed;
+        
         /// \brief Cached map of FOLLOW sets for this grammar
         mutable item_set_map m_CachedFollowSets;
 
@@ -143,8 +148,7 @@ namespace contextfree {
         
         /// \brief Returns the name for the nonterminal with the specified identifier
         inline std::wstring name_for_nonterminal(int id) const {
-            identifier_to_string::const_iterator found = m_NonterminalToName.find(id);
-            if (found != m_NonterminalToName.end()) return found->second;
+            if (id >= 0 && id < (int) m_NonterminalToName.size()) return m_NonterminalToName[id];
             return L"";
         }
         
@@ -181,10 +185,14 @@ namespace contextfree {
         /// to make this call at the appropriate time.
         void clear_caches() const;
 
-        /// \brief Returns the cached LR(1) item set for the item with the specified ID
+        /// \brief Returns the cached LR(1) item set for the item with the specified ID, or NULL if it hasn't been stored yet
         ///
-        /// This will be empty after the cache has been cleared.
-        lr::lr1_item_set& cached_set_for_item(int id) const;
+        /// This will be NULL after the cache has been cleared. Looking up a set that has been stored doesn't change the
+        /// cache, so this can be called on several threads at once as long as nothing is being stored.
+        const lr::lr1_item_set* cached_set_for_item(int id) const;
+        
+        /// \brief Stores the LR(1) item set for the item with the specified ID, and returns the cached copy
+        const lr::lr1_item_set& store_cached_set_for_item(int id, const lr::lr1_item_set& itemSet) const;
         
         /// \brief Retrieves the cached value, or calculates the set FIRST(item)
         ///
@@ -206,7 +214,23 @@ namespace contextfree {
         /// The returned set will contain an empty (epsilon) item if the rule can have no symbols in it.
         item_set first_for_rule(const rule& rule) const;
         
+        /// \brief Removes the rules that can't take part in a parse that begins at one of the specified start symbols
+        ///
+        /// A rule is removed if its nonterminal can't be reached from any of the start symbols, or if it contains an
+        /// item that can never match any input (such as a nonterminal whose rules all refer back to itself). The rules
+        /// inside EBNF items and guards are left alone, but are followed when working out which nonterminals are
+        /// reachable. Identifiers for the rules and items are unchanged, and the caches are cleared if anything was
+        /// removed. Returns the number of rules that were removed.
+        int prune(const item_list& startSymbols);
+        
     private:
+        /// \brief Fills in the FIRST set cache for every nonterminal in this grammar
+        ///
+        /// The nonterminals are divided into strongly connected components using the dependencies between their
+        /// rules, and the components are solved in dependency order. Only mutually recursive nonterminals need
+        /// to be iterated to a fixed point: everything else is computed exactly once.
+        void fill_first() const;
+        
         /// \brief Updates the follow set cache using the content of a particular rule
         void fill_follow(const rule& rule, item_map<item_set>::type& dependencies) const;
         
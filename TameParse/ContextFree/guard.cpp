@@ -36,7 +36,7 @@ using namespace contextfree;
 
 /// \brief Creates a guard item that matches the rule with the specified identifier
 guard::guard(int priority)
-: item(symbol_set::null)
+: item(symbol_set::null, item::guard)
 , m_Priority(priority)
 , m_Rule(NULL, true) {
     // Create an item container pointing at this object (won't free this item)
@@ -49,7 +49,7 @@ guard::guard(int priority)
 
 /// \brief Creates a new guard item by copying a rule
 guard::guard(const contextfree::rule& copyFrom, int priority)
-: item(symbol_set::null)
+: item(symbol_set::null, item::guard)
 , m_Priority(priority)
 , m_Rule(NULL, true) {
     // Create an item container pointing at this object (won't free this item)
@@ -62,7 +62,7 @@ guard::guard(const contextfree::rule& copyFrom, int priority)
 
 /// \brief Creates a new guard by copying an old one
 guard::guard(const guard& copyFrom)
-: item(symbol_set::null)
+: item(symbol_set::null, item::guard)
 , m_Priority(copyFrom.m_Priority)
 , m_Rule(NULL, true) {
     // Create an item container pointing at this object (won't free this item)
@@ -117,7 +117,7 @@ bool guard::operator==(const item& compareTo) const {
     if (&compareTo == this) return true;
     
     // Compare types
-    if (item::guard != compareTo.type()) return false;
+    if (item::guard != compareTo.tag().kind) return false;
     
     // Cast the comparison to a guard object
     const guard* compareGuard = compareTo.cast_guard();
@@ -142,8 +142,8 @@ bool guard::operator<(const item& compareTo) const {
     if (&compareTo == this) return false;
     
     // Compare types
-    if (item::guard < compareTo.type()) return true;
-    if (item::guard > compareTo.type()) return false;
+    if (item::guard < compareTo.tag().kind) return true;
+    if (item::guard > compareTo.tag().kind) return false;
     
     // Cast the comparison to a guard object
     const guard* compareGuard = compareTo.cast_guard();
@@ -28,6 +28,7 @@
 #include "TameParse/ContextFree/item.h"
 #include "TameParse/Lr/lr_item.h"
 #include "TameParse/Lr/lr1_item_set.h"
+#include "TameParse/Util/parallel.h"
 
 using namespace lr;
 using namespace contextfree;
@@ -47,29 +48,29 @@ item::~item() {
 
 /// \brief Compares this item to another. Returns true if they are the same
 bool item::operator==(const item& compareTo) const {
-    return compareTo.type() == type() && compareTo.symbol() == symbol();
+    return compareTo.tag() == tag();
 }
 
 /// \brief Orders this item relative to another item
 bool item::operator<(const item& compareTo) const {
-    // Compare types
-    int ourType     = type();
-    int theirType   = compareTo.type();
-    if (ourType < theirType) return true;
-    if (ourType > theirType) return false;
-    
-    // Compare symbols if the types are same
-    return symbol() < compareTo.symbol();
+    // Compare types, then symbols if the types are the same
+    return tag() < compareTo.tag();
 }
 
 /// \brief Comparison function, returns true if a is less than b
 bool item::compare(const item& a, const item& b) {
     // Compare the kinds
-    kind aKind = a.type();
-    kind bKind = b.type();
+    item_tag aTag = a.tag();
+    item_tag bTag = b.tag();
+    int      aKind = aTag.kind;
+    
+    if (aKind < bTag.kind) return true;
+    if (aKind > bTag.kind) return false;
     
-    if (aKind < bKind) return true;
-    if (aKind > bKind) return false;
+    // Simple items are ordered by their symbols (the empty, end of input and end of guard items always have the same symbol)
+    if (is_simple(aKind)) {
+        return aTag.symbol < bTag.symbol;
+    }
     
     // For objects with an 'other' type, use RTTI to compare the underlying types
     if (aKind >= other) {
@@ -86,25 +87,12 @@ bool item::compare(const item& a, const item& b) {
         return a < b;
     }
     
-    // For well-known kinds we can just compare the symbols
-    switch (aKind) {
-        case terminal:
-        case nonterminal:
-        {
-            int aSym = a.symbol();
-            int bSym = b.symbol();
-            
-            return aSym < bSym;
-        }
-            
-        default:
-            // For other types, we call through to the comparison operator
-            return a < b;
-    }
+    // For EBNF items and guards, we call through to the comparison operator
+    return a < b;
 }
 
 static const empty_item the_empty_item;
-static item_container   an_empty_item_c((item*) &the_empty_item, false);
+static TAMEPARSE_THREAD_LOCAL item_container an_empty_item_c((item*) &the_empty_item, false);
 
 /// \brief Fills in the items that follow this one
 void item::fill_follow(item_set& follow, const lr::lr1_item& item, const grammar& gram) const {
@@ -179,25 +167,25 @@ void item::closure(const lr1_item& item, lr1_item_set& state, const grammar& gra
 }
 
 static const end_of_input an_eoi_item;
-static item_container an_eoi_item_c((item*)&an_eoi_item, false);
+static TAMEPARSE_THREAD_LOCAL item_container an_eoi_item_c((item*)&an_eoi_item, false);
 
 /// \brief Like closure, except this will use the grammar closure cache to improve performance
 void item::cache_closure(const lr::lr1_item& it, lr::lr1_item_set& state, const grammar& gram) const {
-    // If we're already trying to cache this item, then use the standard closure algorithm
-    if (m_CachingClosure) {
-        closure(it, state, gram);
-        return;
-    }
-    
-    // Mark this item as caching
-    m_CachingClosure = true;
-    
     // Fetch some information about this item
-    int             itemId      = gram.identifier_for_item(item_container(const_cast<item*>(this), false));
-    lr1_item_set&   cachedSet   = gram.cached_set_for_item(itemId);    
+    int                     itemId      = gram.identifier_for_item(item_container(const_cast<item*>(this), false));
+    const lr1_item_set*     cachedSet   = gram.cached_set_for_item(itemId);
     
-    // Build the cache if it isn't full yet
-    if (cachedSet.empty()) {
+    // Build the cache if it isn't there yet (once it is, this only reads from the grammar and the cache)
+    if (!cachedSet) {
+        // If we're already trying to cache this item, then use the standard closure algorithm
+        if (m_CachingClosure) {
+            closure(it, state, gram);
+            return;
+        }
+        
+        // Mark this item as caching
+        m_CachingClosure = true;
+        
         // Create a follow set containing the end-of-input character (which we use as a placeholder)
         item_set emptyFollow(gram);
         emptyFollow.insert(an_eoi_item_c);
@@ -214,7 +202,10 @@ void item::cache_closure(const lr::lr1_item& it, lr::lr1_item_set& state, const
         closure(fakeItem, closed, gram);
         
         // Store as the cached set
-        cachedSet = closed;
+        cachedSet = &gram.store_cached_set_for_item(itemId, closed);
+        
+        // Caching is finished for this object
+        m_CachingClosure = false;
     }
     
     // Fill in the follow set for this item
@@ -222,7 +213,7 @@ void item::cache_closure(const lr::lr1_item& it, lr::lr1_item_set& state, const
     fill_follow(follow, it, gram);
     
     // Generate the closure for this item via the cache ('$' gets substituted for the follow set)
-    for (lr1_item_set::const_iterator cachedItem = cachedSet.begin(); cachedItem != cachedSet.end(); ++cachedItem) {
+    for (lr1_item_set::const_iterator cachedItem = cachedSet->begin(); cachedItem != cachedSet->end(); ++cachedItem) {
         // Get the lookahead for this item
         const item_set& itemLookahead = (*cachedItem)->lookahead();
         
@@ -245,9 +236,6 @@ void item::cache_closure(const lr::lr1_item& it, lr::lr1_item_set& state, const
             state.insert(*cachedItem);
         }
     }
-    
-    // Caching is finished for this object
-    m_CachingClosure = false;
 }
 
 /// \brief True if a transition (new state) should be generated for this item
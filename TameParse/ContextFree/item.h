@@ -80,6 +80,29 @@ namespace contextfree {
     
     /// \brief Maps items to a type of value (item_map<T>::type gives the map type, this structure is useless by itself)
     template<typename Value> struct item_map { typedef std::map<item_container, Value> type; };
+    
+    ///
+    /// \brief Compact representation of an item, made up of its kind and its symbol
+    ///
+    /// Tags are compared without calling any virtual methods, which is how the maps and sets keyed on items order
+    /// the well-known kinds. Only the simple kinds of item (see item::is_simple) are identified by their tag: EBNF
+    /// items and guards have the same tag as any other item of their kind and are ordered by their rules instead.
+    ///
+    struct item_tag {
+        /// \brief The kind of item (an item::kind value)
+        int kind;
+        
+        /// \brief The symbol identifier of the item
+        int symbol;
+        
+        inline bool operator==(const item_tag& compareTo) const { return kind == compareTo.kind && symbol == compareTo.symbol; }
+        inline bool operator!=(const item_tag& compareTo) const { return !operator==(compareTo); }
+        
+        inline bool operator<(const item_tag& compareTo) const {
+            if (kind != compareTo.kind) return kind < compareTo.kind;
+            return symbol < compareTo.symbol;
+        }
+    };
 
     ///
     /// \brief Abstract base class for items in a rule in a context free grammar
@@ -89,6 +112,9 @@ namespace contextfree {
         /// \brief The symbol for this item
         int m_Symbol;
         
+        /// \brief The kind of this item, or -1 if it is only known by calling type()
+        int m_Kind;
+        
         /// \brief Set to true while this object is caching its closure
         mutable bool m_CachingClosure;
         
@@ -100,7 +126,10 @@ namespace contextfree {
        
     public:
         /// \brief Standard constructor
-        explicit inline item(int symbol) : m_Symbol(symbol) { }
+        explicit inline item(int symbol) : m_Symbol(symbol), m_Kind(-1), m_CachingClosure(false) { }
+        
+        /// \brief Constructor for items whose kind is fixed, which can then be compared without calling type()
+        inline item(int symbol, int itemKind) : m_Symbol(symbol), m_Kind(itemKind), m_CachingClosure(false) { }
         
         /// \brief Destructor
         virtual ~item();
@@ -197,6 +226,19 @@ namespace contextfree {
         /// In all other cases, this is a reference to the definition of an item within the grammar.
         inline int symbol() const { return m_Symbol; }
         
+        /// \brief The compact tag for this item
+        ///
+        /// This only calls type() for items that didn't supply their kind when they were constructed.
+        inline item_tag tag() const {
+            item_tag result;
+            result.kind     = m_Kind >= 0 ? m_Kind : (int) type();
+            result.symbol   = m_Symbol;
+            return result;
+        }
+        
+        /// \brief True if items of the specified kind are completely identified by their tag
+        static inline bool is_simple(int itemKind) { return itemKind < guard; }
+        
         /// \brief Computes the set FIRST(item) for this item (when used in the specified grammar)
         ///
         /// This set will always include the item itself by definition. Things like non-terminals should include themselves and the first
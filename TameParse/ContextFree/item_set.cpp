@@ -26,11 +26,27 @@
 //
 
 #include <cstdlib>
+#include <cstring>
 
 #include "TameParse/ContextFree/item_set.h"
 
 using namespace contextfree;
 
+/// \brief Counts the number of bits set in a word
+static inline size_t count_bits(unsigned int bits) {
+#if defined(__GNUC__)
+    return (size_t) __builtin_popcount(bits);
+#else
+    // Kerningham's method
+    size_t result = 0;
+    while (bits) {
+        ++result;
+        bits &= bits-1;
+    }
+    return result;
+#endif
+}
+
 /// \brief Item set representing the empty set (cannot be modified)
 const item_set item_set::empty_set(NULL);
 
@@ -63,12 +79,14 @@ item_set::item_set(const item_set& copyFrom)
 , m_MaxItem(copyFrom.m_MaxItem)
 , m_Size(copyFrom.m_Size)
 , m_Items(NULL) {
-    // Fill in the items
-    if (m_MaxItem > 0) {
+    if (copyFrom.m_Items) {
+        // Copy the bitset
         m_Items = (unsigned int*) malloc(sizeof(unsigned int)*m_MaxItem);
-
-        for (int item = 0; item < m_MaxItem; ++item) {
-            m_Items[item] = copyFrom.m_Items[item];
+        memcpy(m_Items, copyFrom.m_Items, sizeof(unsigned int)*m_MaxItem);
+    } else {
+        // Copy the small set
+        for (size_t item = 0; item < m_Size; ++item) {
+            m_Small[item] = copyFrom.m_Small[item];
         }
     }
 }
@@ -84,10 +102,21 @@ item_set& item_set::operator=(const item_set& assignFrom) {
     // Update the number of items
     m_MaxItem   = assignFrom.m_MaxItem;
     m_Size      = assignFrom.m_Size;
-    m_Items     = (unsigned int*) realloc(m_Items, sizeof(unsigned int)*m_MaxItem);
-
-    for (int item=0; item < m_MaxItem; ++item) {
-        m_Items[item] = assignFrom.m_Items[item];
+    
+    if (assignFrom.m_Items) {
+        // Copy the bitset
+        m_Items = (unsigned int*) realloc(m_Items, sizeof(unsigned int)*m_MaxItem);
+        memcpy(m_Items, assignFrom.m_Items, sizeof(unsigned int)*m_MaxItem);
+    } else {
+        // Copy the small set
+        if (m_Items) {
+            free(m_Items);
+            m_Items = NULL;
+        }
+        
+        for (size_t item = 0; item < m_Size; ++item) {
+            m_Small[item] = assignFrom.m_Small[item];
+        }
     }
     
     return *this;
@@ -103,18 +132,101 @@ item_set::~item_set() {
 
  /// \brief Recalculates the size (number of items) in this object
 void item_set::count_size() {
-    // Size is initially 0
-    m_Size = 0;
-
+    // Small sets always know their size
+    if (!m_Items) return;
+    
     // Iterate through the items
+    size_t size = 0;
     for (int item = 0; item < m_MaxItem; ++item) {
-        // Count the number of bits set in this item (Kerningham's method)
-        unsigned int bits = m_Items[item];
-        while (bits) {
-            ++m_Size;
-            bits &= bits-1;
+        size += count_bits(m_Items[item]);
+    }
+    
+    m_Size = size;
+}
+
+/// \brief Switches a small set to the bitset representation
+void item_set::convert_to_bitset() {
+    if (m_Items || m_MaxItem <= 0) return;
+    
+    // Allocate the bitset
+    m_Items = (unsigned int*) malloc(sizeof(unsigned int)*m_MaxItem);
+    memset(m_Items, 0, sizeof(unsigned int)*m_MaxItem);
+    
+    // Set the bits for the items in the small set
+    for (size_t item = 0; item < m_Size; ++item) {
+        m_Items[m_Small[item]>>5] |= 1u << (m_Small[item]&0x1f);
+    }
+}
+
+/// \brief Returns the bits for a word of this set, in either representation
+unsigned int item_set::word(int index) const {
+    if (m_Items) return m_Items[index];
+    
+    unsigned int result = 0;
+    for (size_t item = 0; item < m_Size; ++item) {
+        if ((m_Small[item]>>5) == index) {
+            result |= 1u << (m_Small[item]&0x1f);
         }
     }
+    
+    return result;
+}
+
+/// \brief Compares the contents of this set to another with the same m_MaxItem, returning <0, 0 or >0
+///
+/// Sets are ordered by comparing their bitsets a word at a time, whichever representation they are using
+int item_set::compare_words(const item_set& compareTo) const {
+    if (m_Items && compareTo.m_Items) {
+        // Skip over the identical prefix of the two bitsets (memcmp is usually vectorised)
+        int item = 0;
+        while (item < m_MaxItem && m_Items[item] == compareTo.m_Items[item]) {
+            // Compare several words at once when possible
+            int remaining = m_MaxItem - item;
+            if (remaining >= 8 && memcmp(m_Items + item, compareTo.m_Items + item, sizeof(unsigned int)*8) == 0) {
+                item += 8;
+            } else {
+                ++item;
+            }
+        }
+        
+        if (item >= m_MaxItem) return 0;
+        return m_Items[item] < compareTo.m_Items[item] ? -1 : 1;
+    }
+    
+    if (!m_Items && !compareTo.m_Items) {
+        // Only the words containing items in either set can differ
+        size_t ours     = 0;
+        size_t theirs   = 0;
+        
+        while (ours < m_Size || theirs < compareTo.m_Size) {
+            // Find the next word that contains an item
+            int ourWord     = ours < m_Size ? m_Small[ours]>>5 : m_MaxItem;
+            int theirWord   = theirs < compareTo.m_Size ? compareTo.m_Small[theirs]>>5 : m_MaxItem;
+            int nextWord    = ourWord < theirWord ? ourWord : theirWord;
+            
+            // Compare the bits in this word
+            unsigned int ourBits    = word(nextWord);
+            unsigned int theirBits  = compareTo.word(nextWord);
+            
+            if (ourBits != theirBits) return ourBits < theirBits ? -1 : 1;
+            
+            // Move past this word
+            while (ours < m_Size && (m_Small[ours]>>5) == nextWord) ++ours;
+            while (theirs < compareTo.m_Size && (compareTo.m_Small[theirs]>>5) == nextWord) ++theirs;
+        }
+        
+        return 0;
+    }
+    
+    // Mixed representations
+    for (int item = 0; item < m_MaxItem; ++item) {
+        unsigned int ourBits    = word(item);
+        unsigned int theirBits  = compareTo.word(item);
+        
+        if (ourBits != theirBits) return ourBits < theirBits ? -1 : 1;
+    }
+    
+    return 0;
 }
 
 /// \brief Adds a new item to an item set
@@ -131,6 +243,34 @@ bool item_set::insert(int itemId) {
     int setId   = itemId >> 5;
     int bit     = itemId&0x1f;
 
+    if (!m_Items) {
+        // Find where this item belongs in the small set
+        size_t pos = 0;
+        while (pos < m_Size && m_Small[pos] < itemId) ++pos;
+        
+        // Nothing to do if the item is already present
+        if (pos < m_Size && m_Small[pos] == itemId) return false;
+        
+        // Update the size of the bitset that this set represents
+        if (setId >= m_MaxItem) {
+            m_MaxItem = setId + 1;
+        }
+        
+        if (m_Size < (size_t) small_set_size) {
+            // Insert into the small set
+            for (size_t move = m_Size; move > pos; --move) {
+                m_Small[move] = m_Small[move-1];
+            }
+            
+            m_Small[pos] = itemId;
+            ++m_Size;
+            return true;
+        }
+        
+        // The small set is full: switch to a bitset
+        convert_to_bitset();
+    }
+
     // Allocate space if necessary
     if (setId >= m_MaxItem) {
         int oldMax  = m_MaxItem;
@@ -157,6 +297,22 @@ bool item_set::insert(int itemId) {
 ///
 /// Returns true if the item was in the set
 bool item_set::erase(int itemId) {
+    if (!m_Items) {
+        // Find the item in the small set
+        size_t pos = 0;
+        while (pos < m_Size && m_Small[pos] != itemId) ++pos;
+        
+        if (pos >= m_Size) return false;
+        
+        // Remove it
+        for (++pos; pos < m_Size; ++pos) {
+            m_Small[pos-1] = m_Small[pos];
+        }
+        
+        m_Size--;
+        return true;
+    }
+    
     // Get the set and bit the item is in
     int setId   = itemId >> 5;
     int bit     = itemId&0x1f;
@@ -189,44 +345,75 @@ bool item_set::erase(const item_container& oldItem) {
 
 /// \brief Merges this item set with another
 bool item_set::merge(const item_set& mergeWith) {
+    // Nothing to do if we're merging with ourselves
+    if (&mergeWith == this) return false;
+    
+    // Small sets are merged an item at a time
+    if (!mergeWith.m_Items) {
+        bool changed = false;
+        
+        for (size_t item = 0; item < mergeWith.m_Size; ++item) {
+            if (insert(mergeWith.m_Small[item])) changed = true;
+        }
+        
+        // The size of the merged set is the larger of the two
+        if (mergeWith.m_MaxItem > m_MaxItem) {
+            int oldMax  = m_MaxItem;
+            m_MaxItem   = mergeWith.m_MaxItem;
+            
+            if (m_Items) {
+                m_Items = (unsigned int*) realloc(m_Items, sizeof(unsigned int)*m_MaxItem);
+                for (int item = oldMax; item < m_MaxItem; ++item) m_Items[item] = 0;
+            }
+        }
+        
+        return changed;
+    }
+    
     // Resize the item set if necessary
     if (mergeWith.m_MaxItem > m_MaxItem) {
         int oldMax  = m_MaxItem;
         m_MaxItem   = mergeWith.m_MaxItem;
-        m_Items     = (unsigned int*) realloc(m_Items, sizeof(unsigned int)*m_MaxItem);
-
-        for (int item = oldMax; item < m_MaxItem; ++item) m_Items[item] = 0;
+        
+        if (m_Items) {
+            m_Items = (unsigned int*) realloc(m_Items, sizeof(unsigned int)*m_MaxItem);
+            for (int item = oldMax; item < m_MaxItem; ++item) m_Items[item] = 0;
+        }
     }
-
-    // Remember if the size has changed
-    bool sizeChanged = false;
-
-    // Iterate through the items in the set we're merging with
+    
+    // Merging a bitset always produces a bitset
+    convert_to_bitset();
+    if (!m_Items) return false;
+
+    // Combine the words, counting the newly added bits as we go. This loop has no branches, so the compiler
+    // can vectorise it.
+    const unsigned int* theirs  = mergeWith.m_Items;
+    unsigned int*       ours    = m_Items;
+    size_t              added   = 0;
+    
     for (int item = 0; item < mergeWith.m_MaxItem; ++item) {
-        // Get the items in this set
-        unsigned int bits = mergeWith.m_Items[item];
-
-        // Trivially ignore the case where the bits are zero
-        if (!bits) continue;
-
-        // If the same sets of bits are set in both, then there is nothing to do
-        if ((bits & ~m_Items[item]) == 0) continue;
-
-        // The number of bits in this item will have changed
-        sizeChanged     = true;
-        m_Items[item]   |= bits;
+        unsigned int newBits = theirs[item] & ~ours[item];
+        
+        ours[item]  |= newBits;
+        added       += count_bits(newBits);
     }
-
-    // Recalculate the size if it has changed
-    if (sizeChanged) {
-        count_size();
-    }
-
-    return sizeChanged;
+    
+    // Update the size
+    m_Size += added;
+    return added != 0;
 }
 
 /// \brief True if this set contains the specified item
 bool item_set::contains(int itemId) const {
+    if (!m_Items) {
+        // Search the small set
+        for (size_t item = 0; item < m_Size; ++item) {
+            if (m_Small[item] == itemId) return true;
+        }
+        
+        return false;
+    }
+    
     // Get the set and bit the item is in
     int setId   = itemId >> 5;
     int bit     = itemId&0x1f;
@@ -237,7 +424,7 @@ bool item_set::contains(int itemId) const {
     }
 
     // Check this bit
-    return (m_Items[setId] & (1<<bit)) != 0;
+    return (m_Items[setId] & (1u<<bit)) != 0;
 }
 
 /// \brief True if this set contains the specified item
@@ -252,6 +439,11 @@ item_set::const_iterator item_set::begin() const {
     if (m_MaxItem == 0) {
         return const_iterator(*this, 0);
     }
+    
+    // Small sets are in order
+    if (!m_Items) {
+        return const_iterator(*this, m_Size > 0 ? m_Small[0] : m_MaxItem<<5);
+    }
 
     // Need to find the first item
     if (m_Items[0]&1) {
@@ -265,6 +457,15 @@ item_set::const_iterator item_set::begin() const {
 ///
 /// Returns m_MaxSet<<5 if the item is the last in the set
 int item_set::next_item_id(int itemId) const {
+    // Small sets are in order, so the next item is the first one that's larger
+    if (!m_Items) {
+        for (size_t item = 0; item < m_Size; ++item) {
+            if (m_Small[item] > itemId) return m_Small[item];
+        }
+        
+        return m_MaxItem<<5;
+    }
+    
     // Get the set and the bit of this item
     int             set     = itemId>>5;
     int             bit     = itemId&0x1f;
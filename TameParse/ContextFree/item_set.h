@@ -41,20 +41,33 @@ namespace contextfree {
     ///
     /// \brief Class representing a set of context-free items
     ///
+    /// Small sets (such as most lookahead sets) store their item identifiers inline, in ascending order. Once a set
+    /// grows beyond small_set_size items, it switches to a bitset representation. The two representations behave
+    /// identically: in particular, the ordering of sets does not depend on the representation in use.
+    ///
     class item_set {
+    public:
+        /// \brief The number of items that can be stored before this set switches to a bitset
+        static const int small_set_size = 4;
+        
     private:
         /// \brief The grammar that these items come from
         const grammar* m_Grammar;
         
-        /// \brief The number of items in the m_Items array (1/32nd of the maximum item ID that can be stored in this set)
+        /// \brief The number of words in the bitset for this item (1/32nd of the maximum item ID that can be stored in this set)
+        ///
+        /// This is maintained for small sets too, so that sets can be compared without regard to their representation
         int m_MaxItem;
 
         /// \brief The size of this set (number of bits set)
         size_t m_Size;
         
-        /// \brief Bits indicating which items are in this set (bit n = item n from the grammar)
+        /// \brief Bits indicating which items are in this set (bit n = item n from the grammar), or NULL if this is a small set
         unsigned int* m_Items;
         
+        /// \brief The identifiers of the items in this set, in ascending order, if m_Items is NULL
+        int m_Small[small_set_size];
+        
     public:
         /// \brief Item set representing the empty set (cannot be modified, not associated with a grammar)
         static const item_set empty_set;
@@ -86,6 +99,15 @@ namespace contextfree {
         /// \brief Recalculates the size (number of items) in this object
         void count_size();
         
+        /// \brief Switches a small set to the bitset representation
+        void convert_to_bitset();
+        
+        /// \brief Returns the bits for a word of this set, in either representation
+        unsigned int word(int index) const;
+        
+        /// \brief Compares the contents of this set to another with the same m_MaxItem, returning <0, 0 or >0
+        int compare_words(const item_set& compareTo) const;
+        
     public:
         /// \brief Adds the item with the specified identifier to this item.
         ///
@@ -126,16 +148,12 @@ namespace contextfree {
     public:
         /// \brief Returns true if this item set is equal to another
         inline bool operator==(const item_set& compareTo) const {
-            // Compare the m_MaxItem first
-            if (compareTo.m_MaxItem != m_MaxItem) return false;
-
+            // Compare the m_MaxItem and size first
+            if (compareTo.m_MaxItem != m_MaxItem)   return false;
+            if (compareTo.m_Size != m_Size)         return false;
+            
             // Compare the elements
-            for (int item = 0; item < m_MaxItem; ++item) {
-                if (m_Items[item] != compareTo.m_Items[item]) return false;
-            }
-
-            // Sets match
-            return true;
+            return compare_words(compareTo) == 0;
         }
 
         /// \brief Returns true if this item set is not equal to another
@@ -148,13 +166,7 @@ namespace contextfree {
             if (compareTo.m_MaxItem < m_MaxItem) return false;
 
             // Compare the elements
-            for (int item = 0; item < m_MaxItem; ++item) {
-                if (m_Items[item] < compareTo.m_Items[item]) return true;
-                if (m_Items[item] > compareTo.m_Items[item]) return false;
-            }
-
-            // Sets match
-            return false;
+            return compare_words(compareTo) < 0;
         }
 
         /// \brief Orders this set relative to another
@@ -0,0 +1,337 @@
+//
+//  sentence_generator.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include "TameParse/ContextFree/sentence_generator.h"
+#include "TameParse/ContextFree/ebnf_items.h"
+
+using namespace std;
+using namespace contextfree;
+
+/// \brief Adds two costs together, limiting the result to no_sentence
+static inline int add_cost(int a, int b) {
+    int result = a + b;
+    return result > sentence_generator::no_sentence ? sentence_generator::no_sentence : result;
+}
+
+/// \brief Creates a generator for the specified grammar, which generates sentences using only the specified terminals
+sentence_generator::sentence_generator(const grammar& gram, const set<int>& terminals, unsigned int seed)
+: m_Grammar(gram)
+, m_Terminals(terminals)
+, m_MaxDepth(8)
+, m_Breadth(4)
+, m_RepeatDepth(0)
+, m_TargetSize(0)
+, m_Random(seed ? seed : 1) {
+}
+
+/// \brief Returns a random number between 0 and range-1
+unsigned int sentence_generator::random(unsigned int range) {
+    // xorshift, so the same seed gives the same sentences on every platform
+    m_Random ^= m_Random << 13;
+    m_Random ^= m_Random >> 17;
+    m_Random ^= m_Random << 5;
+    
+    return range ? m_Random % range : 0;
+}
+
+/// \brief Generates a sentence for the specified item with roughly the specified number of terminals
+bool sentence_generator::generate(const item& start, size_t targetSize, vector<int>& sentence) {
+    if (cost(start) >= no_sentence) return false;
+    
+    // Try again with more repetitions if a sentence is much smaller than the target, keeping the largest one
+    vector<int> largest;
+    vector<int> attempt;
+    
+    m_TargetSize = targetSize;
+    for (int attemptNum = 0, breadth = 4; attemptNum < 8; ++attemptNum, breadth *= 2) {
+        attempt.clear();
+        m_Depth.clear();
+        m_Breadth       = breadth;
+        m_RepeatDepth   = 0;
+        
+        expand(start, attempt);
+        
+        if (attemptNum == 0 || attempt.size() > largest.size()) {
+            largest.swap(attempt);
+        }
+        
+        if (largest.size() * 2 >= targetSize) break;
+    }
+    
+    sentence.insert(sentence.end(), largest.begin(), largest.end());
+    return true;
+}
+
+/// \brief The size of the smallest expansion of the specified item, or no_sentence if it can't generate any sentences
+int sentence_generator::cost(const item& it) {
+    switch (it.type()) {
+        case item::empty:
+        case item::eoi:
+        case item::eog:
+        case item::guard:
+        case item::optional:
+        case item::repeat_zero_or_one:
+            // These can all be left out of the sentence
+            return 0;
+        
+        case item::terminal:
+            return m_Terminals.find(it.symbol()) != m_Terminals.end() ? 1 : no_sentence;
+        
+        case item::nonterminal:
+        {
+            // Work out the costs for this nonterminal and the ones it refers to if they aren't known yet
+            map<int, int>::const_iterator found = m_Cost.find(it.symbol());
+            if (found == m_Cost.end()) {
+                find_costs(it);
+                found = m_Cost.find(it.symbol());
+            }
+            
+            return found->second;
+        }
+        
+        case item::repeat:
+        case item::alternative:
+        {
+            // The smallest of the rules in this item
+            const ebnf* ebnfItem    = it.cast_ebnf();
+            int         result      = no_sentence;
+            
+            if (!ebnfItem) return no_sentence;
+            
+            for (ebnf::rule_iterator nextRule = ebnfItem->first_rule(); nextRule != ebnfItem->last_rule(); ++nextRule) {
+                int ruleCost = cost(**nextRule);
+                if (ruleCost < result) result = ruleCost;
+            }
+            
+            return result;
+        }
+        
+        default:
+            // Other kinds of item can't be generated
+            return no_sentence;
+    }
+}
+
+/// \brief The size of the smallest expansion of a rule
+int sentence_generator::cost(const rule& rule) {
+    int result = 0;
+    
+    for (rule::iterator nextItem = rule.begin(); nextItem != rule.end() && result < no_sentence; ++nextItem) {
+        result = add_cost(result, cost(**nextItem));
+    }
+    
+    return result;
+}
+
+/// \brief The size of the smallest expansion of the best rule in a list
+int sentence_generator::cost(const rule_list& rules) {
+    int result = no_sentence;
+    
+    for (rule_list::const_iterator nextRule = rules.begin(); nextRule != rules.end(); ++nextRule) {
+        int ruleCost = cost(**nextRule);
+        if (ruleCost < result) result = ruleCost;
+    }
+    
+    return result;
+}
+
+/// \brief Finds the nonterminals that can be reached from the specified rule
+void sentence_generator::find_nonterminals(const rule& rule, vector<int>& nonterminals) {
+    for (rule::iterator nextItem = rule.begin(); nextItem != rule.end(); ++nextItem) {
+        const item& it = **nextItem;
+        
+        if (it.type() == item::nonterminal) {
+            // Nonterminals start out unable to generate anything
+            if (m_Cost.find(it.symbol()) == m_Cost.end()) {
+                m_Cost[it.symbol()] = no_sentence;
+                nonterminals.push_back(it.symbol());
+            }
+        } else if (it.type() != item::guard) {
+            // Look inside EBNF items (guards don't add anything to the sentence)
+            const ebnf* ebnfItem = it.cast_ebnf();
+            if (!ebnfItem) continue;
+            
+            for (ebnf::rule_iterator nextRule = ebnfItem->first_rule(); nextRule != ebnfItem->last_rule(); ++nextRule) {
+                find_nonterminals(**nextRule, nonterminals);
+            }
+        }
+    }
+}
+
+/// \brief Works out the costs of all the nonterminals that can be reached from the specified item
+void sentence_generator::find_costs(const item& start) {
+    // Find the nonterminals that haven't been seen before
+    vector<int> nonterminals;
+    
+    m_Cost[start.symbol()] = no_sentence;
+    nonterminals.push_back(start.symbol());
+    
+    for (size_t nonterminalNum = 0; nonterminalNum < nonterminals.size(); ++nonterminalNum) {
+        const rule_list& rules = m_Grammar.rules_for_nonterminal(nonterminals[nonterminalNum]);
+        
+        for (rule_list::const_iterator nextRule = rules.begin(); nextRule != rules.end(); ++nextRule) {
+            find_nonterminals(**nextRule, nonterminals);
+        }
+    }
+    
+    // Reduce the costs until they stop changing. Each nonterminal costs one more than its smallest rule, so the smallest
+    // rules never lead back to the nonterminal that they belong to
+    for (bool changed = true; changed; ) {
+        changed = false;
+        
+        for (vector<int>::const_iterator nonterminal = nonterminals.begin(); nonterminal != nonterminals.end(); ++nonterminal) {
+            int newCost = add_cost(cost(m_Grammar.rules_for_nonterminal(*nonterminal)), 1);
+            
+            if (newCost < m_Cost[*nonterminal]) {
+                m_Cost[*nonterminal]    = newCost;
+                changed                 = true;
+            }
+        }
+    }
+}
+
+/// \brief The cost of a rule, which is remembered once the costs of the nonterminals are known
+int sentence_generator::rule_cost(const rule& rule) {
+    map<const class rule*, int>::const_iterator found = m_RuleCost.find(&rule);
+    if (found != m_RuleCost.end()) return found->second;
+    
+    int result = cost(rule);
+    m_RuleCost[&rule] = result;
+    return result;
+}
+
+/// \brief Chooses the rule to expand from a list, or returns NULL if none of them can generate a sentence
+const rule* sentence_generator::choose(rule_list::const_iterator begin, rule_list::const_iterator end, bool smallest) {
+    const rule* best        = NULL;
+    int         bestCost    = no_sentence;
+    int         numRules    = 0;
+    
+    for (rule_list::const_iterator nextRule = begin; nextRule != end; ++nextRule) {
+        int ruleCost = rule_cost(**nextRule);
+        if (ruleCost >= no_sentence) continue;
+        
+        ++numRules;
+        if (ruleCost < bestCost) {
+            best        = nextRule->item();
+            bestCost    = ruleCost;
+        }
+    }
+    
+    // Use the smallest rule half the time even when a larger one is allowed, so that recursive rules don't make the
+    // sentence grow too quickly
+    if (!best || smallest || numRules == 1 || random(2) == 0) {
+        return best;
+    }
+    
+    // Otherwise pick any of the rules that can generate a sentence
+    int chosen = (int) random((unsigned int) numRules);
+    for (rule_list::const_iterator nextRule = begin; nextRule != end; ++nextRule) {
+        if (rule_cost(**nextRule) >= no_sentence) continue;
+        if (chosen-- == 0) return nextRule->item();
+    }
+    
+    return best;
+}
+
+/// \brief Appends a random expansion of an item to a sentence
+void sentence_generator::expand(const item& it, vector<int>& sentence) {
+    switch (it.type()) {
+        case item::terminal:
+            sentence.push_back(it.symbol());
+            break;
+        
+        case item::nonterminal:
+        {
+            // Use the smallest rule once the nonterminal is nested too deeply inside itself
+            const rule_list&    rules   = m_Grammar.rules_for_nonterminal(it.symbol());
+            int&                depth   = m_Depth[it.symbol()];
+            const rule*         chosen  = choose(rules.begin(), rules.end(), depth >= m_MaxDepth || finished(sentence));
+            
+            if (chosen) {
+                ++depth;
+                expand(*chosen, sentence);
+                --depth;
+            }
+            break;
+        }
+        
+        case item::optional:
+        {
+            if (finished(sentence) || random(2) == 0) break;
+            
+            const ebnf* ebnfItem    = it.cast_ebnf();
+            const rule* chosen      = ebnfItem ? choose(ebnfItem->first_rule(), ebnfItem->last_rule(), false) : NULL;
+            
+            if (chosen) expand(*chosen, sentence);
+            break;
+        }
+        
+        case item::repeat:
+        case item::repeat_zero_or_one:
+        {
+            const ebnf* ebnfItem = it.cast_ebnf();
+            if (!ebnfItem) break;
+            
+            int minCount = it.type() == item::repeat ? 1 : 0;
+            
+            // Lists inside other lists are repeated fewer times
+            ++m_RepeatDepth;
+            unsigned int expected = (unsigned int) (m_Breadth / m_RepeatDepth);
+            if (expected < 1) expected = 1;
+            
+            for (int count = 0; ; ++count) {
+                if (count >= minCount && (finished(sentence) || random(expected + 1) == 0)) break;
+                
+                const rule* chosen = choose(ebnfItem->first_rule(), ebnfItem->last_rule(), finished(sentence));
+                if (!chosen) break;
+                
+                expand(*chosen, sentence);
+            }
+            
+            --m_RepeatDepth;
+            break;
+        }
+        
+        case item::alternative:
+        {
+            const ebnf* ebnfItem    = it.cast_ebnf();
+            const rule* chosen      = ebnfItem ? choose(ebnfItem->first_rule(), ebnfItem->last_rule(), finished(sentence)) : NULL;
+            
+            if (chosen) expand(*chosen, sentence);
+            break;
+        }
+        
+        default:
+            // Guards and the other items don't add anything to the sentence
+            break;
+    }
+}
+
+/// \brief Appends a random expansion of a rule to a sentence
+void sentence_generator::expand(const rule& rule, vector<int>& sentence) {
+    for (rule::iterator nextItem = rule.begin(); nextItem != rule.end(); ++nextItem) {
+        expand(**nextItem, sentence);
+    }
+}
@@ -0,0 +1,146 @@
+//
+//  sentence_generator.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _CONTEXTFREE_SENTENCE_GENERATOR_H
+#define _CONTEXTFREE_SENTENCE_GENERATOR_H
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "TameParse/ContextFree/grammar.h"
+#include "TameParse/ContextFree/item.h"
+#include "TameParse/ContextFree/rule.h"
+
+namespace contextfree {
+    ///
+    /// \brief Generates random sentences in the language of a grammar
+    ///
+    /// A sentence is generated by expanding the start symbol with randomly chosen rules. Two limits stop it from growing
+    /// without bound: a nonterminal that is already being expanded more than the maximum depth times over (such as an
+    /// expression nested inside too many other expressions) is expanded using its smallest rule, and once the sentence
+    /// has reached the target size every item is completed in the smallest way possible. The smallest rules are worked
+    /// out in advance so that this always finishes.
+    ///
+    /// Repeating items are repeated a random number of times, with fewer repetitions inside other repeating items. If
+    /// the first sentence is much smaller than the target, the generator tries again with more repetitions, so
+    /// generate() produces sentences of roughly the target size for grammars that contain lists.
+    ///
+    /// Guards are ignored, as are terminals that aren't in the set passed to the constructor, so the generated sentences
+    /// are in the language described by the rules but may not always be accepted by a parser that uses guards to choose
+    /// between ambiguous rules. The same seed always produces the same sentences.
+    ///
+    class sentence_generator {
+    private:
+        /// \brief The grammar that sentences are generated from
+        const grammar& m_Grammar;
+        
+        /// \brief The terminals that can appear in a sentence
+        std::set<int> m_Terminals;
+        
+        /// \brief The size of the smallest expansion of each nonterminal (counting nonterminals as well as terminals)
+        std::map<int, int> m_Cost;
+        
+        /// \brief The cost of each rule that has been chosen from
+        std::map<const rule*, int> m_RuleCost;
+        
+        /// \brief The number of times each nonterminal is being expanded while generating a sentence
+        std::map<int, int> m_Depth;
+        
+        /// \brief The maximum number of times a nonterminal can be nested inside itself before it is expanded using its smallest rule
+        int m_MaxDepth;
+        
+        /// \brief The average number of times an outermost repeating item is repeated
+        int m_Breadth;
+        
+        /// \brief The number of repeating items being expanded
+        int m_RepeatDepth;
+        
+        /// \brief The number of terminals after which items are completed in the smallest way possible
+        size_t m_TargetSize;
+        
+        /// \brief The state of the random number generator
+        unsigned int m_Random;
+    
+    public:
+        /// \brief Value used for the cost of an item that can't generate a sentence
+        static const int no_sentence = 0x3fffffff;
+        
+        /// \brief Creates a generator for the specified grammar, which generates sentences using only the specified terminals
+        sentence_generator(const grammar& gram, const std::set<int>& terminals, unsigned int seed = 1);
+        
+        /// \brief Sets the maximum number of times a nonterminal can be nested inside itself
+        inline void set_max_depth(int maxDepth) { m_MaxDepth = maxDepth; }
+        
+        /// \brief The maximum number of times a nonterminal can be nested inside itself
+        inline int max_depth() const { return m_MaxDepth; }
+        
+        /// \brief Generates a sentence for the specified item with roughly the specified number of terminals
+        ///
+        /// The terminals of the sentence are appended to the sentence vector. Returns false if the item can't generate
+        /// any sentences. Calling this again continues with the same sequence of random numbers, so it produces a
+        /// different sentence.
+        bool generate(const item& start, size_t targetSize, std::vector<int>& sentence);
+        
+        /// \brief The size of the smallest expansion of the specified item, or no_sentence if it can't generate any sentences
+        ///
+        /// Nonterminals are counted as well as terminals, so that expanding the smallest rule for a nonterminal always
+        /// leads to items with a smaller size.
+        int cost(const item& it);
+    
+    private:
+        /// \brief Returns a random number between 0 and range-1
+        unsigned int random(unsigned int range);
+        
+        /// \brief The size of the smallest expansion of a rule
+        int cost(const rule& rule);
+        
+        /// \brief The size of the smallest expansion of the best rule in a list
+        int cost(const rule_list& rules);
+        
+        /// \brief Works out the costs of all the nonterminals that can be reached from the specified item
+        void find_costs(const item& start);
+        
+        /// \brief Finds the nonterminals that can be reached from the specified rule
+        void find_nonterminals(const rule& rule, std::vector<int>& nonterminals);
+        
+        /// \brief The cost of a rule, which is remembered once the costs of the nonterminals are known
+        int rule_cost(const rule& rule);
+        
+        /// \brief Chooses the rule to expand from a list, or returns NULL if none of them can generate a sentence
+        const rule* choose(rule_list::const_iterator begin, rule_list::const_iterator end, bool smallest);
+        
+        /// \brief Appends a random expansion of an item to a sentence
+        void expand(const item& it, std::vector<int>& sentence);
+        
+        /// \brief Appends a random expansion of a rule to a sentence
+        void expand(const rule& rule, std::vector<int>& sentence);
+        
+        /// \brief True if items should be completed in the smallest way possible
+        inline bool finished(const std::vector<int>& sentence) const { return sentence.size() >= m_TargetSize; }
+    };
+}
+
+#endif
@@ -36,7 +36,7 @@ using namespace contextfree;
 
 /// \brief Creates a terminal that matches the specified symbol
 terminal::terminal(int sym)
-: item(sym) {
+: item(sym, item::terminal) {
 }
 
 /// \brief Creates a clone of this item
@@ -65,7 +65,7 @@ item_set terminal::first(const grammar& gram) const {
 
 /// \brief Creates a non-terminal item that matches the specified symbol
 nonterminal::nonterminal(int sym)
-: item(sym) {
+: item(sym, item::nonterminal) {
 }
 
 /// \brief Creates a clone of this item
@@ -78,10 +78,6 @@ item::kind nonterminal::type() const {
     return item::nonterminal;
 }
 
-/// \brief Constant empty item
-static const empty_item an_empty_item;
-static item_container an_empty_item_c((item*)&an_empty_item, false);
-
 /// \brief Computes the closure of this rule in the specified grammar
 void nonterminal::closure(const lr1_item& item, lr1_item_set& state, const grammar& gram) const {
     // Get the rules for this nonterminal
@@ -117,40 +113,9 @@ item_set nonterminal::first(const grammar& gram) const {
     // Ask the grammar for the rules for this nonterminal
     const rule_list& rules = gram.rules_for_nonterminal(symbol());
     
-    // Merge in the first set for each of the initial symbols
+    // Merge in the first set for each of the rules
     for (rule_list::const_iterator nextRule = rules.begin(); nextRule != rules.end(); ++nextRule) {
-        // Get the items for this rule
-        const item_list& ruleItems = (*nextRule)->items();
-        
-        // Add the empty item if this is an empty rule
-        if (ruleItems.size() == 0) {
-            result.insert(an_empty_item_c);
-            continue;
-        }
-        
-        // Get the first set for the first item in this rule
-        const item_set& ruleFirst = gram.first(ruleItems[0]);
-
-        // Insert into the result
-        result.merge(ruleFirst);
-
-        if (ruleFirst.contains(an_empty_item_c)) {
-            // If there's an empty item, then merge the first sets from the later parts of the rule
-            int pos;
-            for (pos = 1; pos < (int) ruleItems.size(); ++pos) {
-                // Remove the empty item from the current set
-                result.erase(an_empty_item);
-                
-                // Get the first set for the next item
-                const item_set& nextFirst = gram.first(*(ruleItems[pos]));
-                
-                // Merge it with the current set
-                result.merge(nextFirst);
-                
-                // Stop if there's no longer an empty item
-                if (!nextFirst.contains(an_empty_item_c)) break;
-            }
-        }
+        result.merge(gram.first_for_rule(**nextRule));
     }
 
     return result;
@@ -158,17 +123,17 @@ item_set nonterminal::first(const grammar& gram) const {
 
 /// \brief Creates a terminal that matches the specified symbol
 empty_item::empty_item() 
-: item(symbol_set::null) {
+: item(symbol_set::null, item::empty) {
 }
 
 /// \brief Compares this item to another. Returns true if they are the same
 bool empty_item::operator==(const item& compareTo) const {
-    return compareTo.type() == item::empty;
+    return compareTo.tag().kind == item::empty;
 }
 
 /// \brief Orders this item relative to another item
 bool empty_item::operator<(const item& compareTo) const {
-    return item::empty < compareTo.type();
+    return item::empty < compareTo.tag().kind;
 }
 
 /// \brief Creates a clone of this item
@@ -213,17 +178,17 @@ bool empty_item::generate_transition() const {
 
 /// \brief Creates a terminal that matches the specified symbol
 end_of_input::end_of_input() 
-: item(symbol_set::null) {
+: item(symbol_set::null, item::eoi) {
 }
 
 /// \brief Compares this item to another. Returns true if they are the same
 bool end_of_input::operator==(const item& compareTo) const {
-    return compareTo.type() == item::eoi;
+    return compareTo.tag().kind == item::eoi;
 }
 
 /// \brief Orders this item relative to another item
 bool end_of_input::operator<(const item& compareTo) const {
-    return item::eoi < compareTo.type();
+    return item::eoi < compareTo.tag().kind;
 }
 
 /// \brief Creates a clone of this item
@@ -252,17 +217,17 @@ item_set end_of_input::first(const grammar& gram) const {
 
 /// \brief Creates a terminal that matches the specified symbol
 end_of_guard::end_of_guard() 
-: item(symbol_set::null) {
+: item(symbol_set::null, item::eog) {
 }
 
 /// \brief Compares this item to another. Returns true if they are the same
 bool end_of_guard::operator==(const item& compareTo) const {
-    return compareTo.type() == item::eog;
+    return compareTo.tag().kind == item::eog;
 }
 
 /// \brief Orders this item relative to another item
 bool end_of_guard::operator<(const item& compareTo) const {
-    return item::eog < compareTo.type();
+    return item::eog < compareTo.tag().kind;
 }
 
 /// \brief Creates a clone of this item
@@ -31,7 +31,25 @@ using namespace contextfree;
 
 /// \brief Creates a new terminal dictionary
 terminal_dictionary::terminal_dictionary()
-: m_MaxSymbol(0) {
+: m_MaxSymbol(0)
+, m_NumNamed(0) {
+}
+
+/// \brief Associates a name with the specified symbol
+void terminal_dictionary::set_name(int symbol, const std::wstring& name) {
+    // Symbols are allocated densely, so the names are stored in a table indexed by symbol
+    if (symbol >= (int) m_SymbolToName.size()) {
+        m_SymbolToName.resize(symbol + 1);
+        m_Named.resize(symbol + 1, false);
+    }
+    
+    if (!m_Named[symbol]) {
+        m_Named[symbol] = true;
+        ++m_NumNamed;
+    }
+    
+    m_NameToSymbol[name]    = symbol;
+    m_SymbolToName[symbol]  = name;
 }
 
 /// \brief Adds a new anonymous symbol and returns its identifier
@@ -48,8 +66,7 @@ int terminal_dictionary::add_symbol(const std::wstring& name) {
     int newSymbol = add_symbol();
     
     // Associate the name with this symbol
-    m_NameToSymbol[name]        = newSymbol;
-    m_SymbolToName[newSymbol]   = name;
+    set_name(newSymbol, name);
     
     return newSymbol;
 }
@@ -60,8 +77,7 @@ void terminal_dictionary::add_symbol(const std::wstring& name, int value) {
     if (value >= m_MaxSymbol) m_MaxSymbol = value + 1;
     
     // Associate this name with this symbol
-    m_NameToSymbol[name]    = value;
-    m_SymbolToName[value]   = name;
+    set_name(value, name);
 }
 
 /// \brief Splits the symbol with the specified identifier, adding a new symbol and marking the original as its parent
@@ -77,6 +93,13 @@ int terminal_dictionary::split(int symbol) {
     
     // Add to the split, if the parent isn't -1
     if (parentId >= 0) {
+        if (newSymbol >= (int) m_ParentFor.size()) {
+            m_ParentFor.resize(newSymbol + 1, -1);
+        }
+        if (parentId >= (int) m_ChildrenFor.size()) {
+            m_ChildrenFor.resize(parentId + 1);
+        }
+        
         m_ParentFor[newSymbol] = parentId;
         m_ChildrenFor[parentId].insert(newSymbol);
     }
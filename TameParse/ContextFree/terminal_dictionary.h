@@ -29,8 +29,10 @@
 #define _CONTEXTFREE_TERMINAL_DICTIONARY_H
 
 #include <string>
-#include <map>
 #include <set>
+#include <vector>
+
+#include "TameParse/Util/hash_map.h"
 
 namespace contextfree {
     ///
@@ -42,10 +44,10 @@ namespace contextfree {
     class terminal_dictionary {
     public:
         /// \brief Class mapping strings to the associated terminal identifiers
-        typedef std::map<std::wstring, int> name_to_symbol;
+        typedef util::hash_map<std::wstring, int>::type name_to_symbol;
         
-        /// \brief Class mapping symbol identifiers to their names
-        typedef std::map<int, std::wstring> symbol_to_name;
+        /// \brief The name of each symbol, indexed by symbol identifier
+        typedef std::vector<std::wstring> symbol_to_name;
         
         /// \brief Class mapping symbols to a 'parent' symbol
         ///
@@ -53,14 +55,15 @@ namespace contextfree {
         /// that different symbols will appear in the accepting states. To map symbols from both lexers, it's necessary to
         /// split the individual symbols, into 'A-or-B' and 'B-or-C' symbols.
         ///
-        /// Any given symbol can have one parent, but multiple child symbols
-        typedef std::map<int, int> symbol_to_parent;
+        /// Any given symbol can have one parent, but multiple child symbols. This is indexed by symbol identifier, and
+        /// contains -1 for symbols that don't have a parent.
+        typedef std::vector<int> symbol_to_parent;
         
         /// \brief Set of symbols
         typedef std::set<int> symbol_set;
         
-        /// \brief Maps a symbol to its child symbols
-        typedef std::map<int, symbol_set> symbol_to_children;
+        /// \brief The child symbols of each symbol, indexed by symbol identifier
+        typedef std::vector<symbol_set> symbol_to_children;
         
     private:
         /// \brief Maximum used symbol
@@ -72,6 +75,12 @@ namespace contextfree {
         /// \brief Table of symbol names
         symbol_to_name m_SymbolToName;
         
+        /// \brief True for the symbols that have been given a name
+        std::vector<bool> m_Named;
+        
+        /// \brief The number of symbols that have a name
+        int m_NumNamed;
+        
         /// \brief Maps symbols to their parent symbols
         symbol_to_parent m_ParentFor;
         
@@ -82,6 +91,10 @@ namespace contextfree {
         /// \brief Creates a new terminal dictionary
         terminal_dictionary();
         
+    private:
+        /// \brief Associates a name with the specified symbol
+        void set_name(int symbol, const std::wstring& name);
+        
     public:
         /// \brief Adds a new anonymous symbol and returns its identifier
         int add_symbol();
@@ -99,30 +112,27 @@ namespace contextfree {
         int split(int symbol);
         
         /// \brief Total number of symbols defined in this dictionary
-        inline int count_symbols() const { return (int)m_SymbolToName.size(); }
+        inline int count_symbols() const { return m_NumNamed; }
         
     public:
         /// \brief Returns the parent of the specified symbol (identical to the symbol if it wasn't split off from another symbol)
         inline int parent_of(int symbol) const {
-            symbol_to_parent::const_iterator found = m_ParentFor.find(symbol);
-            if (found == m_ParentFor.end()) return symbol;
-            return found->second;
+            if (symbol < 0 || symbol >= (int) m_ParentFor.size() || m_ParentFor[symbol] < 0) return symbol;
+            return m_ParentFor[symbol];
         }
         
         /// \brief Returns the set of symbols that are children of the specified symbol (or the empty set if it has no children)
         inline const symbol_set& children_of(int symbol) const {
             static symbol_set empty;
-            symbol_to_children::const_iterator found = m_ChildrenFor.find(symbol);
-            if (found == m_ChildrenFor.end()) return empty;
-            return found->second;
+            if (symbol < 0 || symbol >= (int) m_ChildrenFor.size()) return empty;
+            return m_ChildrenFor[symbol];
         }
 
         /// \brief Retrieves the name for the specified symbol (or the empty string if it has no associated name)
         inline const std::wstring& name_for_symbol(int symbol) const {
             static std::wstring emptyString;
             
-            symbol_to_name::const_iterator found = m_SymbolToName.find(symbol);
-            if (found == m_SymbolToName.end()) {
+            if (symbol < 0 || symbol >= (int) m_Named.size() || !m_Named[symbol]) {
                 int parentId = parent_of(symbol);
                 if (parentId != symbol) {
                     return name_for_symbol(parentId);
@@ -131,7 +141,7 @@ namespace contextfree {
                 return emptyString;
             }
             
-            return found->second;
+            return m_SymbolToName[symbol];
         }
         
         /// \brief Retrieves the symbol with the specified name, or -1 if there is no symbol with this name
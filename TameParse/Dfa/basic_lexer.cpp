@@ -25,8 +25,16 @@
 //  IN THE SOFTWARE.
 //
 
+#include <algorithm>
+
+#if __cplusplus >= 201103L
+#include <thread>
+#endif
+
 #include "TameParse/Dfa/basic_lexer.h"
+#include "TameParse/Util/utf8reader.h"
 
+using namespace std;
 using namespace dfa;
 
 /// \brief Destructor
@@ -35,11 +43,580 @@ basic_lexer::~basic_lexer() { }
 /// \brief Destructor
 lexer_symbol_stream::~lexer_symbol_stream() { }
 
+/// \brief Reads up to max symbols from this stream into the specified buffer
+size_t lexer_symbol_stream::read(int* dest, size_t max) {
+    size_t count = 0;
+    
+    while (count < max) {
+        int next;
+        (*this) >> next;
+        
+        if (next == symbol_set::end_of_input) break;
+        
+        dest[count] = next;
+        ++count;
+    }
+    
+    return count;
+}
+
+/// \brief Retrieves the buffer containing the symbols for this stream, if they are all available in memory
+bool lexer_symbol_stream::stable_buffer(const int*& begin, const int*& end) const {
+    // By default, streams don't have a buffer
+    return false;
+}
+
+/// \brief Creates a stream that will read the symbols between begin and end
+buffer_symbol_stream::buffer_symbol_stream(const int* begin, const int* end)
+: m_Next(begin)
+, m_End(end) {
+}
+
+/// \brief Reads the next symbol from this stream
+lexer_symbol_stream& buffer_symbol_stream::operator>>(int& result) {
+    if (m_Next == m_End) {
+        result = symbol_set::end_of_input;
+    } else {
+        result = *m_Next;
+        ++m_Next;
+    }
+    
+    return *this;
+}
+
+/// \brief Reads up to max symbols from this stream into the specified buffer
+size_t buffer_symbol_stream::read(int* dest, size_t max) {
+    size_t available = (size_t) (m_End - m_Next);
+    if (max > available) max = available;
+    
+    std::copy(m_Next, m_Next + max, dest);
+    m_Next += max;
+    
+    return max;
+}
+
+/// \brief Retrieves the buffer containing the symbols for this stream
+bool buffer_symbol_stream::stable_buffer(const int*& begin, const int*& end) const {
+    begin   = m_Next;
+    end     = m_End;
+    return true;
+}
+
+/// \brief Creates a stream that reads from the specified file
+file_symbol_stream::file_symbol_stream(util::mapped_file* file, encoding enc)
+: m_File(file)
+, m_Next(file->begin())
+, m_End(file->end())
+, m_Encoding(enc)
+, m_DecodedPos(0)
+, m_DecodedCount(0) {
+}
+
+/// \brief Destructor
+file_symbol_stream::~file_symbol_stream() {
+    delete m_File;
+}
+
+/// \brief Decodes up to max UTF-8 characters into dest, returning the number of characters that were decoded
+size_t file_symbol_stream::decode_utf8(int* dest, size_t max) {
+    bool    bad     = false;
+    size_t  count   = util::utf8reader::decode(m_Next, m_End, dest, max, bad);
+    
+    if (count == 0) {
+        // Either we're at the end of the file, or the rest of the file can't be decoded
+        m_Next = m_End;
+    }
+    
+    return count;
+}
+
+/// \brief Reads the next symbol from this stream
+lexer_symbol_stream& file_symbol_stream::operator>>(int& result) {
+    if (m_Encoding == bytes) {
+        if (m_Next == m_End) {
+            result = symbol_set::end_of_input;
+        } else {
+            result = *m_Next;
+            ++m_Next;
+        }
+        
+        return *this;
+    }
+    
+    // Decode the next few characters if we've run out
+    if (m_DecodedPos == m_DecodedCount) {
+        m_DecodedPos    = 0;
+        m_DecodedCount  = decode_utf8(m_Decoded, sizeof(m_Decoded)/sizeof(m_Decoded[0]));
+        
+        if (m_DecodedCount == 0) {
+            result = symbol_set::end_of_input;
+            return *this;
+        }
+    }
+    
+    result = m_Decoded[m_DecodedPos];
+    ++m_DecodedPos;
+    
+    return *this;
+}
+
+/// \brief Reads up to max symbols from this stream into the specified buffer
+size_t file_symbol_stream::read(int* dest, size_t max) {
+    if (m_Encoding == bytes) {
+        // Bytes can be copied straight from the file
+        size_t available = (size_t) (m_End - m_Next);
+        if (max > available) max = available;
+        
+        std::copy(m_Next, m_Next + max, dest);
+        m_Next += max;
+        
+        return max;
+    }
+    
+    // Return any characters left over from operator>> first
+    size_t count = 0;
+    while (count < max && m_DecodedPos < m_DecodedCount) {
+        dest[count] = m_Decoded[m_DecodedPos];
+        ++count;
+        ++m_DecodedPos;
+    }
+    
+    if (max - count >= 2) {
+        // Decode the rest directly into the destination
+        count += decode_utf8(dest + count, max - count);
+    } else if (count == 0 && max == 1) {
+        // Not enough space for a surrogate pair: fall back to reading a single character
+        (*this) >> dest[0];
+        if (dest[0] != symbol_set::end_of_input) count = 1;
+    }
+    
+    return count;
+}
+
+/// \brief Creates a new lexer that will read from the file with the specified name
+lexeme_stream* basic_lexer::create_stream_from_file(const std::string& filename, file_symbol_stream::encoding enc) const {
+    util::mapped_file* file = new util::mapped_file(filename);
+    
+    if (!file->is_open()) {
+        delete file;
+        return NULL;
+    }
+    
+    return create_stream(new file_symbol_stream(file, enc));
+}
+
+/// \brief Creates a new lexer that will read from a buffer of symbols in memory, lexing it on up to maxThreads threads
+lexeme_stream* basic_lexer::create_parallel_stream_from_symbols(const int* begin, const int* end, unsigned int maxThreads) const {
+    // By default, lexers can't run in parallel
+    return create_stream_from_symbols(begin, end);
+}
+
+/// \brief Creates a new lexer that will read from a buffer of symbols in memory, only tracking the offset of each lexeme
+lexeme_stream* basic_lexer::create_offset_stream_from_symbols(const int* begin, const int* end) const {
+    // By default, lexers always track lines
+    return create_stream_from_symbols(begin, end);
+}
+
+/// \brief Creates an object that runs the state machine for this lexer directly over buffers of symbols
+chunk_lexer* basic_lexer::create_chunk_lexer() const {
+    // By default, lexers don't expose their state machine
+    return NULL;
+}
+
+/// \brief Creates a new lexer that carries on from a checkpoint taken from a stream reading the same buffer
+lexeme_stream* basic_lexer::create_stream_from_checkpoint(const int* begin, const int* end, const lexer_checkpoint& checkpoint) const {
+    // By default, lexers can't restart from a checkpoint
+    return NULL;
+}
+
+/// \brief Splits the symbols after a cursor into tokens, writing up to maxTokens of them to an array
+size_t basic_lexer::tokenize(token_cursor& cursor, token* tokens, size_t maxTokens) const {
+    if (cursor.at_end() || maxTokens == 0) return 0;
+    
+    // Read lexemes from a stream that starts at the cursor
+    lexeme_stream* stream = create_stream_from_checkpoint(cursor.begin(), cursor.end(), cursor.checkpoint());
+    if (!stream) return 0;
+    
+    size_t count = 0;
+    while (count < maxTokens) {
+        lexeme* next = NULL;
+        (*stream) >> next;
+        if (!next) break;
+        
+        token& result = tokens[count++];
+        
+        result.symbol   = next->matched();
+        result.offset   = next->pos().offset();
+        result.length   = (int) next->length();
+        result.line     = next->pos().line();
+        result.column   = next->pos().column();
+        
+        delete next;
+    }
+    
+    // Move the cursor to wherever the stream stopped
+    lexer_checkpoint finished;
+    if (stream->checkpoint(finished)) {
+        cursor.restart(finished);
+    }
+    
+    delete stream;
+    return count;
+}
+
+/// \brief Tokenizes everything after a cursor, appending the tokens to the specified vector
+static void tokenize_rest(const basic_lexer& lexer, token_cursor& cursor, vector<token>& tokens) {
+    // Start with a guess at the number of tokens, and grow the vector if it turns out to be too small
+    size_t blockSize = (cursor.end() - cursor.next()) / 4 + 16;
+    
+    while (!cursor.at_end()) {
+        size_t start = tokens.size();
+        tokens.resize(start + blockSize);
+        
+        size_t count = lexer.tokenize(cursor, &tokens[start], blockSize);
+        tokens.resize(start + count);
+        
+        // Give up on lexers that can't tokenize
+        if (count == 0) break;
+    }
+}
+
+/// \brief Splits a buffer of symbols into tokens, appending them to the specified vector
+void basic_lexer::tokenize_all(const int* begin, const int* end, vector<token>& tokens) const {
+    token_cursor cursor(begin, end);
+    tokenize_rest(*this, cursor, tokens);
+}
+
+/// \brief Splits several buffers of symbols into tokens, appending them all to the same vector
+void basic_lexer::tokenize_batch(const int* const* begins, const int* const* ends, size_t count, vector<token>& tokens, vector<size_t>& firstToken) const {
+    if (count == 0) return;
+    
+    token_cursor cursor(begins[0], ends[0]);
+    firstToken.reserve(firstToken.size() + count);
+    
+    for (size_t input = 0; input < count; ++input) {
+        cursor.reset(begins[input], ends[input]);
+        
+        firstToken.push_back(tokens.size());
+        tokenize_rest(*this, cursor, tokens);
+    }
+}
+
+/// \brief Destructor
+chunk_lexer::~chunk_lexer() { }
+
+/// \brief True if the specified symbol is a newline
+static inline bool is_newline(int symbol) {
+    return symbol == 0x0a || symbol == 0x0b || symbol == 0x0c || symbol == 0x0d || symbol == 0x85 || symbol == 0x2028 || symbol == 0x2029;
+}
+
+/// \brief Creates a stream that lexes the specified buffer, using up to maxThreads threads
+parallel_lexeme_stream::parallel_lexeme_stream(chunk_lexer* lexer, const int* begin, const int* end, unsigned int maxThreads)
+: m_Lexer(lexer)
+, m_Begin(begin)
+, m_End(end)
+, m_Next(begin)
+, m_Chunk(0)
+, m_Token(0)
+, m_Synchronised(false) {
+#if __cplusplus >= 201103L
+    if (maxThreads == 0) maxThreads = thread::hardware_concurrency();
+#else
+    maxThreads = 1;
+#endif
+    
+    // Work out how many chunks to use
+    size_t length       = (size_t) (end - begin);
+    size_t numChunks    = length / c_MinimumChunkSize;
+    if (numChunks > maxThreads) numChunks = maxThreads;
+    
+    // Small inputs are just lexed as they are read
+    if (numChunks <= 1) return;
+    
+    // Choose where each chunk starts. Starting just after a newline means that a lexeme is likely to start there
+    vector<const int*> starts;
+    starts.push_back(begin);
+    
+    for (size_t chunkIndex = 1; chunkIndex < numChunks; ++chunkIndex) {
+        const int* start = begin + (length * chunkIndex) / numChunks;
+        const int* limit = start + c_NewlineSearchLength;
+        if (limit > end) limit = end;
+        
+        for (const int* pos = start; pos < limit; ++pos) {
+            if (is_newline(*pos)) {
+                start = pos + 1;
+                break;
+            }
+        }
+        
+        // Never split a CR+LF sequence (the position would be wrong)
+        if (start < end && start[-1] == 0x0d && *start == 0x0a) ++start;
+        
+        if (start > starts.back() && start < end) {
+            starts.push_back(start);
+        }
+    }
+    
+    // Lex the first chunk on this thread and the rest in parallel
+    m_Chunks.resize(starts.size());
+    for (size_t chunkIndex = 0; chunkIndex < starts.size(); ++chunkIndex) {
+        m_Chunks[chunkIndex].start = starts[chunkIndex];
+    }
+    
+#if __cplusplus >= 201103L
+    vector<thread> workers;
+#endif
+    
+    for (size_t chunkIndex = 1; chunkIndex < starts.size(); ++chunkIndex) {
+        const int*  stop            = chunkIndex + 1 < starts.size() ? starts[chunkIndex+1] : end;
+        int         initialState    = m_Lexer->state_after(starts[chunkIndex][-1]);
+        
+#if __cplusplus >= 201103L
+        workers.push_back(thread(lex_chunk, m_Lexer, &m_Chunks[chunkIndex], stop, end, initialState));
+#else
+        lex_chunk(m_Lexer, &m_Chunks[chunkIndex], stop, end, initialState);
+#endif
+    }
+    
+    lex_chunk(m_Lexer, &m_Chunks[0], starts.size() > 1 ? starts[1] : end, end, m_Lexer->first_state());
+    
+#if __cplusplus >= 201103L
+    for (vector<thread>::iterator worker = workers.begin(); worker != workers.end(); ++worker) {
+        worker->join();
+    }
+#endif
+    
+    // The first chunk always begins with the first lexeme
+    synchronise();
+}
+
+/// \brief Destructor
+parallel_lexeme_stream::~parallel_lexeme_stream() {
+    delete m_Lexer;
+}
+
+/// \brief Lexes a chunk, stopping at the first lexeme that begins at or after stop
+void parallel_lexeme_stream::lex_chunk(const chunk_lexer* lexer, chunk* target, const int* stop, const int* end, int initialState) {
+    position_tracker    position;
+    const int*          pos         = target->start;
+    int                 state       = initialState;
+    
+    while (pos < stop) {
+        token next;
+        
+        next.start      = pos;
+        next.matched    = lexer->match(state, pos, end, next.length);
+        next.pos        = position.current_position();
+        
+        target->tokens.push_back(next);
+        
+        position.update_position(pos, pos + next.length);
+        pos     += next.length;
+        state   = lexer->state_after(pos[-1]);
+    }
+    
+    target->end         = pos;
+    target->endPosition = position;
+}
+
+/// \brief Orders tokens by where they start
+bool parallel_lexeme_stream::token_before(const token& tok, const int* pos) {
+    return tok.start < pos;
+}
+
+/// \brief Finds a token in the chunks that begins at m_Next, and reads from there if there is one
+void parallel_lexeme_stream::synchronise() {
+    if (m_Chunks.empty() || m_Next == m_End) return;
+    
+    // The last chunk that starts before the next lexeme covers it (chunks only ever end after the next one has started)
+    while (m_Chunk + 1 < m_Chunks.size() && m_Chunks[m_Chunk + 1].start <= m_Next) {
+        ++m_Chunk;
+    }
+    
+    // Look for a token that starts in the same place as the next lexeme
+    const token_list&           tokens  = m_Chunks[m_Chunk].tokens;
+    token_list::const_iterator  found   = lower_bound(tokens.begin(), tokens.end(), m_Next, token_before);
+    
+    if (found == tokens.end() || found->start != m_Next) return;
+    
+    // Everything after this point is the same as a sequential lexer would produce
+    m_Synchronised  = true;
+    m_Token         = (size_t) (found - tokens.begin());
+    m_SyncAbsolute  = m_Position.current_position();
+    m_SyncRelative  = found->pos;
+}
+
+/// \brief Converts a position relative to the current chunk to an absolute position
+position parallel_lexeme_stream::absolute(const position& relative) const {
+    stream_offset offset    = relative.offset() - m_SyncRelative.offset() + m_SyncAbsolute.offset();
+    stream_offset line      = relative.line() - m_SyncRelative.line() + m_SyncAbsolute.line();
+    stream_offset column    = relative.column();
+    
+    // Columns are only offset on the line where we started reading from the chunk
+    if (relative.line() == m_SyncRelative.line()) {
+        column += m_SyncAbsolute.column() - m_SyncRelative.column();
+    }
+    
+    return position(offset, line, column);
+}
+
+/// \brief Fills in the contents of the specified pointer with the next lexeme (or NULL if the end of input has been reached)
+lexeme_stream& parallel_lexeme_stream::operator>>(lexeme*& result) {
+    if (m_Next == m_End) {
+        result = NULL;
+        return *this;
+    }
+    
+    if (m_Synchronised) {
+        // Use the next token from the current chunk
+        const chunk& current    = m_Chunks[m_Chunk];
+        const token& next       = current.tokens[m_Token];
+        
+        result = new lexeme(next.start, next.length, absolute(next.pos), next.matched);
+        
+        m_Next = next.start + next.length;
+        ++m_Token;
+        
+        // Move on to the next chunk once this one runs out
+        if (m_Token >= current.tokens.size()) {
+            m_Position      = position_tracker(absolute(current.endPosition.current_position()), current.endPosition.seen_return());
+            m_Synchronised  = false;
+            synchronise();
+        }
+        
+        return *this;
+    }
+    
+    // Match the next lexeme directly
+    int     state   = m_Next == m_Begin ? m_Lexer->first_state() : m_Lexer->state_after(m_Next[-1]);
+    size_t  length;
+    int     matched = m_Lexer->match(state, m_Next, m_End, length);
+    
+    result = new lexeme(m_Next, length, m_Position.current_position(), matched);
+    
+    m_Position.update_position(m_Next, m_Next + length);
+    m_Next += length;
+    
+    // See if we've reached a point where we can use one of the chunks
+    synchronise();
+    
+    return *this;
+}
+
+/// \brief Creates a new set of counters, all set to zero
+lexer_counters::lexer_counters() {
+    reset();
+}
+
+/// \brief Sets all of the counters back to zero
+void lexer_counters::reset() {
+    lexemes         = 0;
+    symbols         = 0;
+    longestLexeme   = 0;
+    
+    lexemesForSymbol.clear();
+}
+
+/// \brief Creates a new stream that reads from source and adds to the specified counters
+counting_lexeme_stream::counting_lexeme_stream(lexeme_stream* source, lexer_counters& counters)
+: m_Source(source)
+, m_Counters(&counters) {
+}
+
+/// \brief Destructor
+counting_lexeme_stream::~counting_lexeme_stream() {
+    delete m_Source;
+}
+
+/// \brief Fills in the contents of the specified pointer with the next lexeme (or NULL if the end of input has been reached)
+lexeme_stream& counting_lexeme_stream::operator>>(lexeme*& result) {
+    (*m_Source) >> result;
+    if (!result) return *this;
+    
+    long length = (long) result->length();
+    
+    ++m_Counters->lexemes;
+    m_Counters->symbols += length;
+    if (length > m_Counters->longestLexeme) {
+        m_Counters->longestLexeme = length;
+    }
+    
+    int matched = result->matched();
+    if (matched >= 0) {
+        if ((size_t) matched >= m_Counters->lexemesForSymbol.size()) {
+            m_Counters->lexemesForSymbol.resize(matched + 1, 0);
+        }
+        ++m_Counters->lexemesForSymbol[matched];
+    }
+    
+    return *this;
+}
+
+/// \brief Sets the initial state of the source stream
+void counting_lexeme_stream::set_initial_state(int initialState) {
+    m_Source->set_initial_state(initialState);
+}
+
+/// \brief Retrieves a checkpoint from the source stream
+bool counting_lexeme_stream::checkpoint(lexer_checkpoint& result) const {
+    return m_Source->checkpoint(result);
+}
+
+/// \brief Asks the source stream to skip the specified symbols
+bool counting_lexeme_stream::skip_symbols(const bool* skip, int numSymbols) {
+    return m_Source->skip_symbols(skip, numSymbols);
+}
+
+/// \brief Switches the source stream into a different lexer mode
+bool counting_lexeme_stream::set_mode(int mode) {
+    return m_Source->set_mode(mode);
+}
+
+/// \brief Limits the length of the lexemes matched by the source stream
+bool counting_lexeme_stream::set_max_lexeme_length(int maxLength) {
+    return m_Source->set_max_lexeme_length(maxLength);
+}
+
+/// \brief Restricts the symbols matched by the source stream
+bool counting_lexeme_stream::set_valid_symbols(const unsigned int* valid, int numSymbols) {
+    return m_Source->set_valid_symbols(valid, numSymbols);
+}
+
 /// \brief Sets the initial state to be used by the next run through of the state machine
 void lexeme_stream::set_initial_state(int initialState) {
     // Default action is to do nothing
 }
 
+/// \brief Retrieves a checkpoint describing the state of this stream before the next lexeme
+bool lexeme_stream::checkpoint(lexer_checkpoint& result) const {
+    // Streams don't support checkpoints by default
+    return false;
+}
+
+/// \brief Asks this stream to skip over any lexeme whose symbol has a true entry in the specified array
+bool lexeme_stream::skip_symbols(const bool* skip, int numSymbols) {
+    // Streams return every lexeme by default
+    return false;
+}
+
+/// \brief Switches this stream into a different lexer mode
+bool lexeme_stream::set_mode(int mode) {
+    // Streams only have the default mode unless they say otherwise
+    return false;
+}
+
+/// \brief Limits the number of symbols this stream will read while matching a single lexeme
+bool lexeme_stream::set_max_lexeme_length(int maxLength) {
+    // Streams don't limit the length of lexemes unless they say otherwise
+    return false;
+}
+
+/// \brief Restricts the lexemes that this stream returns to the symbols with a set bit in the specified array
+bool lexeme_stream::set_valid_symbols(const unsigned int* valid, int numSymbols) {
+    // Streams match every symbol unless they say otherwise
+    return false;
+}
+
 /// \brief Destructor
 lexeme_stream::~lexeme_stream() {
 }
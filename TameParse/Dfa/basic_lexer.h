@@ -29,15 +29,193 @@
 #define _DFA_BASIC_LEXER_H
 
 #include <iostream>
+#include <string>
 #include <vector>
+#include <algorithm>
 
 #include "TameParse/Dfa/symbol_set.h"
 #include "TameParse/Dfa/ndfa_regex.h"
 #include "TameParse/Dfa/state_machine.h"
 #include "TameParse/Dfa/lexeme.h"
 #include "TameParse/Dfa/position.h"
+#include "TameParse/Dfa/skip_state.h"
+#include "TameParse/Dfa/keyword_table.h"
+#include "TameParse/Util/mapped_file.h"
+#include "TameParse/Util/utf8reader.h"
+#include "TameParse/Util/constexpr.h"
 
 namespace dfa {
+    ///
+    /// \brief The state of a lexeme stream between two lexemes
+    ///
+    /// A stream can be restarted from a checkpoint by basic_lexer::create_stream_from_checkpoint, and will then produce
+    /// the same lexemes as the stream that the checkpoint was taken from.
+    ///
+    class lexer_checkpoint {
+    private:
+        /// \brief The position of the next lexeme
+        position m_Position;
+        
+        /// \brief The initial state of the lexer for the next lexeme
+        int m_InitialState;
+        
+        /// \brief The mode that the lexer was in
+        int m_Mode;
+        
+        /// \brief True if the last symbol before the checkpoint was a carriage return
+        bool m_SeenReturn;
+        
+    public:
+        /// \brief Creates a checkpoint for the start of the input
+        inline lexer_checkpoint()
+        : m_InitialState(0)
+        , m_Mode(0)
+        , m_SeenReturn(false) {
+        }
+        
+        /// \brief Creates a checkpoint
+        inline lexer_checkpoint(const position& pos, int initialState, bool seenReturn, int mode = 0)
+        : m_Position(pos)
+        , m_InitialState(initialState)
+        , m_Mode(mode)
+        , m_SeenReturn(seenReturn) {
+        }
+        
+        /// \brief The offset in symbols of the next lexeme from the start of the input
+        inline stream_offset offset() const { return m_Position.offset(); }
+        
+        /// \brief The position of the next lexeme
+        inline const position& pos() const { return m_Position; }
+        
+        /// \brief The initial state of the lexer for the next lexeme
+        inline int initial_state() const { return m_InitialState; }
+        
+        /// \brief The mode that the lexer was in (see lexeme_stream::set_mode)
+        inline int mode() const { return m_Mode; }
+        
+        /// \brief True if the last symbol before the checkpoint was a carriage return
+        inline bool seen_return() const { return m_SeenReturn; }
+        
+        /// \brief True if lexing continues in the same way from this checkpoint as from another one (given the same symbols)
+        inline bool same_state(const lexer_checkpoint& compareTo) const {
+            return m_InitialState == compareTo.m_InitialState && m_Mode == compareTo.m_Mode && m_SeenReturn == compareTo.m_SeenReturn;
+        }
+    };
+    
+    ///
+    /// \brief A lexeme written by basic_lexer::tokenize()
+    ///
+    /// Unlike a lexeme, this is a plain value that doesn't refer to the symbols it was matched from: offset and
+    /// length give the range of symbols in the buffer that was tokenized.
+    ///
+    /// The 64-bit fields come first so that tokens are packed without any padding.
+    ///
+    struct token {
+        /// \brief The offset of the first symbol in this token
+        stream_offset offset;
+        
+        /// \brief The line that this token starts on
+        stream_offset line;
+        
+        /// \brief The column that this token starts at
+        stream_offset column;
+        
+        /// \brief The symbol that was matched, or -1 if the symbol at this offset was rejected
+        int symbol;
+        
+        /// \brief The number of symbols in this token
+        int length;
+    };
+    
+    ///
+    /// \brief How far basic_lexer::tokenize() has got through a buffer of symbols
+    ///
+    class token_cursor {
+    private:
+        /// \brief The start of the buffer
+        const int* m_Begin;
+        
+        /// \brief The next symbol to be tokenized
+        const int* m_Next;
+        
+        /// \brief The end of the buffer
+        const int* m_End;
+        
+        /// \brief The position of the next symbol
+        position_tracker m_Position;
+        
+        /// \brief The initial state of the lexer for the next token
+        int m_State;
+        
+        /// \brief The mode that the lexer is in
+        int m_Mode;
+        
+    public:
+        /// \brief Creates a cursor at the start of the specified buffer
+        inline token_cursor(const int* begin, const int* end)
+        : m_Begin(begin)
+        , m_Next(begin)
+        , m_End(end)
+        , m_State(0)
+        , m_Mode(0) {
+        }
+        
+        /// \brief The start of the buffer
+        inline const int* begin() const { return m_Begin; }
+        
+        /// \brief The next symbol to be tokenized
+        inline const int* next() const { return m_Next; }
+        
+        /// \brief The end of the buffer
+        inline const int* end() const { return m_End; }
+        
+        /// \brief True once the whole buffer has been tokenized
+        inline bool at_end() const { return m_Next == m_End; }
+        
+        /// \brief The position of the next symbol
+        inline position pos() const { return m_Position.current_position(); }
+        
+        /// \brief The initial state of the lexer for the next token
+        inline int state() const { return m_State; }
+        
+        /// \brief The mode that the lexer is in
+        inline int mode() const { return m_Mode; }
+        
+        /// \brief Switches the lexer into a different mode, starting with the next token (see lexeme_stream::set_mode)
+        inline void set_mode(int mode) {
+            m_Mode  = mode;
+            m_State = mode;
+        }
+        
+        /// \brief A checkpoint that can be used to restart a lexeme stream at this cursor
+        inline lexer_checkpoint checkpoint() const { return lexer_checkpoint(m_Position.current_position(), m_State, m_Position.seen_return(), m_Mode); }
+        
+        /// \brief Moves over a token of the specified length, and sets the initial state for the next one
+        inline void advance(size_t length, int nextState) {
+            m_Position.update_position(m_Next, m_Next + length);
+            m_Next  += length;
+            m_State = nextState;
+        }
+        
+        /// \brief Moves the cursor to the start of a different buffer, so that one cursor can tokenize many buffers
+        inline void reset(const int* begin, const int* end) {
+            m_Begin     = begin;
+            m_Next      = begin;
+            m_End       = end;
+            m_Position  = position_tracker();
+            m_State     = 0;
+            m_Mode      = 0;
+        }
+        
+        /// \brief Moves the cursor to a checkpoint in the same buffer
+        inline void restart(const lexer_checkpoint& checkpoint) {
+            m_Next      = m_Begin + checkpoint.offset();
+            m_Position  = position_tracker(checkpoint.pos(), checkpoint.seen_return());
+            m_State     = checkpoint.initial_state();
+            m_Mode      = checkpoint.mode();
+        }
+    };
+    
     ///
     /// \brief Abstract base class that represents a session with a lexer
     ///
@@ -56,6 +234,52 @@ namespace dfa {
         /// Might not do anything, the meaning of the 'initialState' is defined by the implementation of the lexer. However, the default initial 
         /// state is always 0.
         virtual void set_initial_state(int initialState);
+        
+        /// \brief Retrieves a checkpoint describing the state of this stream before the next lexeme
+        ///
+        /// Returns false if this stream doesn't support checkpoints (which is the default)
+        virtual bool checkpoint(lexer_checkpoint& result) const;
+        
+        /// \brief Asks this stream to skip over any lexeme whose symbol has a true entry in the specified array
+        ///
+        /// This is used for symbols that the parser ignores in every state (see parser_tables::find_ignored_symbols): 
+        /// skipping them here saves creating a lexeme that the parser will only throw away. The array must remain 
+        /// valid for as long as this stream is in use, and passing NULL turns skipping off again.
+        ///
+        /// Returns false if this stream can't skip symbols (which is the default): the lexemes are then returned as usual.
+        virtual bool skip_symbols(const bool* skip, int numSymbols);
+        
+        /// \brief Switches this stream into a different lexer mode
+        ///
+        /// A lexer with several modes has an initial state for each one, numbered from 0 (the default mode): these are
+        /// the named lexer blocks in a language definition, or the initial states passed to ndfa::to_dfa. All of the
+        /// modes share the same tables. Unlike set_initial_state, which only affects the next lexeme, the stream stays
+        /// in the new mode until this is called again, so switching modes costs one call rather than one per lexeme.
+        ///
+        /// Returns false if this stream doesn't support modes (which is the default)
+        virtual bool set_mode(int mode);
+        
+        /// \brief Limits the number of symbols this stream will read while matching a single lexeme (0 for no limit)
+        ///
+        /// Once a lexeme would need more than maxLength symbols, the stream stops reading and returns the first
+        /// maxLength + 1 symbols as a lexeme that doesn't match any symbol. This bounds the amount of input that is
+        /// buffered for pathological lexemes such as unterminated strings: a parser with a matching parser_limits
+        /// reports these lexemes as parser_result::limit_exceeded.
+        ///
+        /// Returns false if this stream can't limit the length of lexemes (which is the default)
+        virtual bool set_max_lexeme_length(int maxLength);
+        
+        /// \brief Restricts the lexemes that this stream returns to the symbols with a set bit in the specified array
+        ///
+        /// Bit n%32 of word n/32 is set if symbol n is valid. The stream returns the longest lexeme that matches a valid
+        /// symbol, and where the DFA accepts several symbols for the same text, it picks the highest ranked valid one.
+        /// If no valid symbol matches, the lexeme is the one that would have been returned without a restriction, so
+        /// the parser can report the error as usual. Parsers call this before reading each lexeme with the terminals
+        /// that are valid in their current state (see lr::parser_tables::valid_terminals): the array must remain valid
+        /// until the next lexeme has been read, and passing NULL removes the restriction.
+        ///
+        /// Returns false if this stream can't restrict the symbols it matches (which is the default)
+        virtual bool set_valid_symbols(const unsigned int* valid, int numSymbols);
     };
     
     ///
@@ -70,8 +294,351 @@ namespace dfa {
         ///
         /// The result should be symbol_set::end_of_input when the end of input is reached 
         virtual lexer_symbol_stream& operator>>(int& result) = 0;
+        
+        /// \brief Reads up to max symbols from this stream into the specified buffer
+        ///
+        /// Returns the number of symbols that were read, which will be 0 once the end of input has been reached (and
+        /// may be less than max if the end of input was reached during the call, or if no more input was available
+        /// without waiting). The end of input marker itself is never stored in the buffer. The default implementation
+        /// calls operator>> repeatedly: streams that can supply symbols more efficiently in blocks should override it.
+        virtual size_t read(int* dest, size_t max);
+        
+        /// \brief Retrieves the buffer containing the symbols for this stream, if they are all available in memory
+        ///
+        /// Streams that read from a buffer that will remain valid and unchanged for the lifetime of the stream can
+        /// implement this to return true and set begin and end to the symbols that it would return. Lexers can use this
+        /// to generate lexemes that refer to the buffer instead of copying each symbol. The default implementation
+        /// returns false.
+        virtual bool stable_buffer(const int*& begin, const int*& end) const;
+    };
+    
+    ///
+    /// \brief Symbol stream that reads from a buffer of symbols in memory
+    ///
+    /// The buffer is not copied, and must remain valid for as long as this stream and any lexemes generated from it
+    /// exist. Lexers built from DFAs will generate lexemes that refer directly to this buffer.
+    ///
+    class buffer_symbol_stream : public lexer_symbol_stream {
+    private:
+        /// \brief The next symbol to be read
+        const int* m_Next;
+        
+        /// \brief The end of the buffer
+        const int* m_End;
+        
+    public:
+        /// \brief Creates a stream that will read the symbols between begin and end
+        buffer_symbol_stream(const int* begin, const int* end);
+        
+        /// \brief Reads the next symbol from this stream
+        virtual lexer_symbol_stream& operator>>(int& result);
+        
+        /// \brief Reads up to max symbols from this stream into the specified buffer
+        virtual size_t read(int* dest, size_t max);
+        
+        /// \brief Retrieves the buffer containing the symbols for this stream
+        virtual bool stable_buffer(const int*& begin, const int*& end) const;
+    };
+    
+    ///
+    /// \brief Symbol stream that reads the contents of a file that has been mapped into memory
+    ///
+    class file_symbol_stream : public lexer_symbol_stream {
+    public:
+        /// \brief The ways that the bytes in a file can be turned into symbols
+        enum encoding {
+            /// \brief Each byte in the file is a symbol
+            bytes,
+            
+            /// \brief The file is decoded as UTF-8
+            ///
+            /// As with util::utf8reader, characters outside the basic multilingual plane are returned as UTF-16 
+            /// surrogate pairs, and the stream ends if an invalid sequence is encountered.
+            utf8
+        };
+        
+    private:
+        /// \brief The file that this is reading from
+        util::mapped_file* m_File;
+        
+        /// \brief The next byte to read
+        const unsigned char* m_Next;
+        
+        /// \brief The end of the file
+        const unsigned char* m_End;
+        
+        /// \brief The encoding of the file
+        encoding m_Encoding;
+        
+        /// \brief Characters that have been decoded but not yet returned by operator>>
+        int m_Decoded[16];
+        
+        /// \brief Index of the next character to return from m_Decoded
+        size_t m_DecodedPos;
+        
+        /// \brief Number of characters in m_Decoded
+        size_t m_DecodedCount;
+        
+        /// \brief Disabled copy constructor
+        file_symbol_stream(const file_symbol_stream& copyFrom);
+        
+        /// \brief Disabled assignment
+        file_symbol_stream& operator=(const file_symbol_stream& assignFrom);
+        
+        /// \brief Decodes up to max UTF-8 characters into dest, returning the number of characters that were decoded
+        ///
+        /// The result is 0 at the end of the file, or if the input is invalid. max must be at least 2.
+        size_t decode_utf8(int* dest, size_t max);
+        
+    public:
+        /// \brief Creates a stream that reads from the specified file
+        ///
+        /// This takes ownership of the file, which will be deleted when this stream is destroyed.
+        file_symbol_stream(util::mapped_file* file, encoding enc);
+        
+        /// \brief Destructor
+        virtual ~file_symbol_stream();
+        
+        /// \brief Reads the next symbol from this stream
+        virtual lexer_symbol_stream& operator>>(int& result);
+        
+        /// \brief Reads up to max symbols from this stream into the specified buffer
+        virtual size_t read(int* dest, size_t max);
+    };
+    
+    ///
+    /// \brief Interface used by parallel_lexeme_stream and push_lexer to run the state machine for a lexer
+    ///
+    class chunk_lexer {
+    public:
+        /// \brief Destructor
+        virtual ~chunk_lexer();
+        
+        /// \brief The state that the lexer starts in at the beginning of the input
+        virtual int first_state() const = 0;
+        
+        /// \brief The state that the lexer starts in for a lexeme that follows the specified symbol
+        virtual int state_after(int lastSymbol) const = 0;
+        
+        /// \brief Finds the longest lexeme beginning at start, starting in initialState and reading no further than end
+        ///
+        /// The result is the symbol that was matched, or -1 if nothing was matched. length is set to the number of
+        /// symbols in the lexeme, which is always at least 1.
+        virtual int match(int initialState, const int* start, const int* end, size_t& length) const = 0;
+        
+        /// \brief As for match(), but also reports whether the lexeme could be longer if there were more symbols after end
+        ///
+        /// complete is set to false if the state machine was still running when it reached end: the result is then only
+        /// the longest lexeme among the symbols seen so far, and reading more symbols could change it.
+        virtual int match_partial(int initialState, const int* start, const int* end, size_t& length, bool& complete) const = 0;
     };
     
+    ///
+    /// \brief Lexeme stream that lexes a buffer in memory by splitting it into chunks that are processed in parallel
+    ///
+    /// Every chunk after the first starts at a guess at where a lexeme begins: just after a newline if there is one
+    /// nearby. Each chunk is lexed on its own thread from that point as if a lexeme really did begin there. The 
+    /// lexemes are then read back in order: once the end of the lexemes from one chunk is reached, the next chunk is 
+    /// used from the first lexeme that starts at the same place. As the state of the lexer at the start of a lexeme
+    /// only depends on the symbol before it, everything from that lexeme onwards is the same as a sequential lexer 
+    /// would have produced. If the chunks don't line up, lexemes are matched one at a time until they do.
+    ///
+    /// The lexemes refer to the buffer, which must remain valid for as long as they do. Calls to set_initial_state()
+    /// are ignored.
+    ///
+    class parallel_lexeme_stream : public lexeme_stream {
+    private:
+        /// \brief A lexeme found while lexing a chunk
+        struct token {
+            /// \brief The first symbol in this lexeme
+            const int* start;
+            
+            /// \brief The number of symbols in this lexeme
+            size_t length;
+            
+            /// \brief The symbol that was matched, or -1
+            int matched;
+            
+            /// \brief The position of this lexeme, relative to the start of the chunk
+            position pos;
+        };
+        
+        /// \brief The lexemes in a chunk, in order
+        typedef std::vector<token> token_list;
+        
+        /// \brief A chunk of the input
+        struct chunk {
+            /// \brief Where lexing of this chunk began
+            const int* start;
+            
+            /// \brief The end of the last lexeme in this chunk (which can be beyond the start of the next chunk)
+            const int* end;
+            
+            /// \brief The lexemes in this chunk
+            token_list tokens;
+            
+            /// \brief The position at the end of this chunk, relative to its start
+            position_tracker endPosition;
+        };
+        
+        /// \brief Chunks are never smaller than this number of symbols
+        static const size_t c_MinimumChunkSize = 65536;
+        
+        /// \brief Maximum number of symbols to search for a newline when choosing where to start a chunk
+        static const size_t c_NewlineSearchLength = 4096;
+        
+        /// \brief The lexer used to run the state machine
+        chunk_lexer* m_Lexer;
+        
+        /// \brief The start of the buffer
+        const int* m_Begin;
+        
+        /// \brief The end of the buffer
+        const int* m_End;
+        
+        /// \brief The chunks in the buffer, or empty if it is lexed sequentially
+        std::vector<chunk> m_Chunks;
+        
+        /// \brief The start of the next lexeme to be returned
+        const int* m_Next;
+        
+        /// \brief The position of m_Next (only kept up to date while lexemes are being read from outside of a chunk)
+        position_tracker m_Position;
+        
+        /// \brief The chunk that lexemes are being read from
+        size_t m_Chunk;
+        
+        /// \brief The next token to read from m_Chunk
+        size_t m_Token;
+        
+        /// \brief True if the next lexeme is the token at m_Token
+        bool m_Synchronised;
+        
+        /// \brief The actual position of the token where reading from this chunk began
+        position m_SyncAbsolute;
+        
+        /// \brief The relative position of the token where reading from this chunk began
+        position m_SyncRelative;
+        
+        parallel_lexeme_stream(const parallel_lexeme_stream& copyFrom);
+        parallel_lexeme_stream& operator=(const parallel_lexeme_stream& copyFrom);
+        
+    private:
+        /// \brief Lexes a chunk, stopping at the first lexeme that begins at or after stop
+        static void lex_chunk(const chunk_lexer* lexer, chunk* target, const int* stop, const int* end, int initialState);
+        
+        /// \brief Orders tokens by where they start
+        static bool token_before(const token& tok, const int* pos);
+        
+        /// \brief Finds a token in the chunks that begins at m_Next, and reads from there if there is one
+        void synchronise();
+        
+        /// \brief Converts a position relative to the current chunk to an absolute position
+        position absolute(const position& relative) const;
+        
+    public:
+        /// \brief Creates a stream that lexes the specified buffer, using up to maxThreads threads
+        ///
+        /// The lexer is deleted when this stream is. If maxThreads is 0 then one thread is used for each processor core.
+        /// The buffer is lexed sequentially if it is too small to split, or if C++11 thread support is unavailable.
+        parallel_lexeme_stream(chunk_lexer* lexer, const int* begin, const int* end, unsigned int maxThreads = 0);
+        
+        /// \brief Destructor
+        virtual ~parallel_lexeme_stream();
+        
+        /// \brief Fills in the contents of the specified pointer with the next lexeme (or NULL if the end of input has been reached)
+        virtual lexeme_stream& operator>>(lexeme*& result);
+    };
+    
+    ///
+    /// \brief Counts of the lexemes read through a counting_lexeme_stream
+    ///
+    class lexer_counters {
+    public:
+        /// \brief The number of lexemes that were read
+        long lexemes;
+        
+        /// \brief The total number of input symbols in the lexemes that were read
+        long symbols;
+        
+        /// \brief The number of symbols in the longest lexeme that was read
+        long longestLexeme;
+        
+        /// \brief The number of lexemes that matched each terminal symbol, indexed by the symbol ID
+        ///
+        /// Lexemes that didn't match a symbol (those with a negative ID) are only counted in the overall total
+        std::vector<long> lexemesForSymbol;
+        
+    public:
+        /// \brief Creates a new set of counters, all set to zero
+        lexer_counters();
+        
+        /// \brief Sets all of the counters back to zero
+        void reset();
+    };
+    
+    ///
+    /// \brief Lexeme stream that counts the lexemes read from another stream
+    ///
+    /// This can be placed between a lexer and a parser (alongside counting_parser_trace) to find out what the lexer is
+    /// spending its time on.
+    ///
+    class counting_lexeme_stream : public lexeme_stream {
+    private:
+        /// \brief The stream that lexemes are read from
+        lexeme_stream* m_Source;
+        
+        /// \brief The counters to update
+        lexer_counters* m_Counters;
+        
+        counting_lexeme_stream(const counting_lexeme_stream& noCopying);
+        counting_lexeme_stream& operator=(const counting_lexeme_stream& noCopying);
+        
+    public:
+        /// \brief Creates a new stream that reads from source (which is deleted along with this object) and adds to the
+        /// specified counters (which must remain valid for as long as this object)
+        counting_lexeme_stream(lexeme_stream* source, lexer_counters& counters);
+        
+        /// \brief Destructor
+        virtual ~counting_lexeme_stream();
+        
+        /// \brief Fills in the contents of the specified pointer with the next lexeme (or NULL if the end of input has been reached)
+        virtual lexeme_stream& operator>>(lexeme*& result);
+        
+        /// \brief Sets the initial state of the source stream
+        virtual void set_initial_state(int initialState);
+        
+        /// \brief Retrieves a checkpoint from the source stream
+        virtual bool checkpoint(lexer_checkpoint& result) const;
+        
+        /// \brief Asks the source stream to skip the specified symbols
+        virtual bool skip_symbols(const bool* skip, int numSymbols);
+        
+        /// \brief Switches the source stream into a different lexer mode
+        virtual bool set_mode(int mode);
+        
+        /// \brief Limits the length of the lexemes matched by the source stream
+        virtual bool set_max_lexeme_length(int maxLength);
+        
+        /// \brief Restricts the symbols matched by the source stream
+        virtual bool set_valid_symbols(const unsigned int* valid, int numSymbols);
+    };
+    
+    /// \brief Converts a character read from a stream into a lexer symbol
+    ///
+    /// Narrow characters are treated as unsigned bytes, so the bytes of UTF-8 text are read as the symbols 0x80-0xff
+    /// rather than as negative numbers (which lexers treat as the end of the input).
+    template<typename Char> inline int stream_symbol(Char next)     { return (int)(unsigned)next; }
+    inline int stream_symbol(char next)                             { return (int)(unsigned char)next; }
+    inline int stream_symbol(signed char next)                      { return (int)(unsigned char)next; }
+    
+    /// \brief True if a stream can supply another character without waiting for more input
+    ///
+    /// Streams that can't tell are assumed to always need to wait, so they are read a character at a time.
+    template<typename stream> inline bool stream_has_input(stream&)      { return false; }
+    template<typename char_type, typename traits> inline bool stream_has_input(std::basic_istream<char_type, traits>& str) { return str.rdbuf() && str.rdbuf()->in_avail() > 0; }
+    inline bool stream_has_input(util::utf8reader& str)             { return str.has_input(); }
+    
     ///
     /// \brief Abstract base class that runs a state machine to turn the contents of a stream into a series of lexemes
     ///
@@ -96,10 +663,32 @@ namespace dfa {
                 if (!m_Stream.good()) {
                     result = symbol_set::end_of_input;
                 } else {
-                    result = (int)(unsigned)next;
+                    result = stream_symbol(next);
                 }
                 return *this;
             }
+            
+            /// \brief Reads up to max symbols from this stream into the specified buffer
+            ///
+            /// This waits for the first symbol, but after that only reads the symbols that the stream already has
+            /// buffered. Pipes, terminals and sockets only supply input as it arrives, so waiting for a whole block
+            /// would stop the lexer from returning lexemes that could already be matched.
+            virtual size_t read(int* dest, size_t max) {
+                Char    next;
+                size_t  count = 0;
+                
+                while (count < max) {
+                    if (count > 0 && !stream_has_input(m_Stream)) break;
+                    
+                    m_Stream.get(next);
+                    if (!m_Stream.good()) break;
+                    
+                    dest[count] = stream_symbol(next);
+                    ++count;
+                }
+                
+                return count;
+            }
         };
         
     public:
@@ -116,6 +705,9 @@ namespace dfa {
         /// \brief Estimated size in bytes of this lexer
         virtual size_t size() const = 0;
         
+        /// \brief The number of bytes used by this lexer (the same as size())
+        inline size_t memory_usage() const { return size(); }
+        
         /// \brief Creates a new lexer that will read from the specified stream (which must not be destroyed while the lexer is in use)
         template<typename char_type, typename traits> inline lexeme_stream* create_stream_from(std::basic_istream<char_type, traits>& input) const {
             return create_stream(new stream_stream<std::basic_istream<char_type, traits>, char_type>(input));
@@ -125,6 +717,121 @@ namespace dfa {
         template<typename char_type, typename custom_stream_alike> inline lexeme_stream* create_stream_from(custom_stream_alike& input) const {
             return create_stream(new stream_stream<custom_stream_alike, char_type>(input));
         }
+        
+        /// \brief Creates a new lexer that will read from a buffer of symbols in memory
+        ///
+        /// The buffer must remain valid for as long as the lexer and the lexemes it produces are in use: lexers that
+        /// support it will produce lexemes that refer to this buffer rather than copying the symbols.
+        inline lexeme_stream* create_stream_from_symbols(const int* begin, const int* end) const {
+            return create_stream(new buffer_symbol_stream(begin, end));
+        }
+        
+        /// \brief Creates a new lexer that will read from a buffer of symbols in memory, lexing it on up to maxThreads threads
+        ///
+        /// The lexemes are the same as those produced by create_stream_from_symbols. Lexers that can't lex in parallel
+        /// just return the result of that call, which is what this does by default. If maxThreads is 0, then one thread
+        /// is used for each processor core.
+        virtual lexeme_stream* create_parallel_stream_from_symbols(const int* begin, const int* end, unsigned int maxThreads = 0) const;
+        
+        /// \brief Creates a new lexer that will read from a buffer of symbols in memory, only tracking the offset of each lexeme
+        ///
+        /// The lexemes have positions with a line and column of -1: a line_index for the same buffer can be used to find
+        /// them when they are needed. Lexers that can't do this just return the result of create_stream_from_symbols,
+        /// which is what this does by default.
+        virtual lexeme_stream* create_offset_stream_from_symbols(const int* begin, const int* end) const;
+        
+        /// \brief Creates a new lexer that carries on from a checkpoint taken from a stream reading the same buffer
+        ///
+        /// begin should be the start of the whole buffer: lexing restarts at the offset in the checkpoint, and the lexeme
+        /// positions carry on from the position in the checkpoint. The buffer may have been edited after the checkpoint
+        /// as long as the symbols before it were not changed. Returns NULL for lexers that don't support checkpoints
+        /// (which is the default).
+        virtual lexeme_stream* create_stream_from_checkpoint(const int* begin, const int* end, const lexer_checkpoint& checkpoint) const;
+        
+        /// \brief Creates an object that runs the state machine for this lexer directly over buffers of symbols
+        ///
+        /// The caller should delete the result. Returns NULL for lexers that aren't built from a state machine (which is
+        /// the default).
+        virtual chunk_lexer* create_chunk_lexer() const;
+        
+        /// \brief Creates a new lexer that will read from the file with the specified name
+        ///
+        /// The file is mapped into memory where possible, so its contents are read as the lexer reaches them. The
+        /// result is NULL if the file cannot be opened.
+        lexeme_stream* create_stream_from_file(const std::string& filename, file_symbol_stream::encoding enc = file_symbol_stream::utf8) const;
+        
+        /// \brief Splits the symbols after a cursor into tokens, writing up to maxTokens of them to an array
+        ///
+        /// Returns the number of tokens written, and moves the cursor on past them: this can be called repeatedly
+        /// with the same cursor until it reaches the end of the buffer. The tokens are the same as the lexemes
+        /// produced by create_stream_from_symbols. The default implementation reads them from a stream created by
+        /// create_stream_from_checkpoint, and so does nothing for lexers that don't support checkpoints: lexers built
+        /// from a DFA match the tokens directly, without creating any lexemes.
+        virtual size_t tokenize(token_cursor& cursor, token* tokens, size_t maxTokens) const;
+        
+        /// \brief Splits a buffer of symbols into tokens, appending them to the specified vector
+        void tokenize_all(const int* begin, const int* end, std::vector<token>& tokens) const;
+        
+        /// \brief Splits several buffers of symbols into tokens, appending them all to the same vector
+        ///
+        /// This is meant for lexing large numbers of short strings: no lexemes are created and the same cursor is
+        /// reset for each buffer, so nothing is allocated per string once the vector is large enough. The tokens for
+        /// each buffer have offsets and positions relative to the start of that buffer. The index in tokens of the
+        /// first token of each buffer is appended to firstToken (the tokens for the last buffer run to the end).
+        void tokenize_batch(const int* const* begins, const int* const* ends, size_t count, std::vector<token>& tokens, std::vector<size_t>& firstToken) const;
+    };
+    
+    ///
+    /// \brief Runs a table-driven state machine on behalf of a dfa_lexer_base
+    ///
+    /// dfa_lexer_base calls run() whenever it needs to move the state machine over a run of symbols. Other runners can
+    /// be supplied to dfa_lexer_base to replace the table lookups: output_cplusplus uses this to generate lexers whose
+    /// transitions are compiled into code. A runner only needs to provide a static run() method with this signature.
+    ///
+    /// If skip is not NULL, it has an entry for each state describing the states that can be skipped through (see
+    /// skip_state). When the state machine loops back to one of these states after reading a few symbols, this runner
+    /// searches for the next exit symbol instead of running the state machine on each of the symbols before it.
+    ///
+    template<typename state_machine_ref> class dfa_table_runner {
+    public:
+        /// \brief Runs the state machine from the specified state over the symbols from pos to end
+        ///
+        /// This stops after the state machine rejects a symbol or when pos reaches end, and returns the final state
+        /// (which is negative if a symbol was rejected). pos is updated to point after the last symbol that was read.
+        /// Whenever the state machine enters an accepting state, acceptPos and acceptSymbol are set to the position
+        /// after the symbol that was just read and the symbol that was accepted.
+        static inline int run(state_machine_ref stateMachine, const int* accept, const skip_state* skip, int state, const int*& pos, const int* end, int& acceptSymbol, const int*& acceptPos) {
+            // Without any skip states, the state machine can scan the whole span in its own loop
+            if (!skip) {
+                return stateMachine.run_span(state, pos, end, accept, acceptSymbol, acceptPos);
+            }
+            
+            const int* next = pos;
+            
+            while (next != end) {
+                // Run the state machine (use the faster 'unsafe' mode, we check the state later ourselves)
+                int lastState = state;
+                state = stateMachine.run_unsafe(state, *next);
+                ++next;
+                
+                // Stop processing if the state machine rejects this character (this is why we can use the unsafe mode, at least assuming the state machine doesn't transition to a state that's too high)
+                if (state < 0) break;
+                
+                // Skip ahead to the next exit symbol if this state looped back to itself, and the run isn't just starting
+                if (next - pos >= skip_state::min_run && state == lastState && skip && skip[state].count > 0) {
+                    next = find_exit(skip[state], next, end);
+                }
+                
+                // If this is an accepting state, mark it as such
+                if (accept[state] >= 0) {
+                    acceptPos       = next;
+                    acceptSymbol    = accept[state];
+                }
+            }
+            
+            pos = next;
+            return state;
+        }
     };
     
     ///
@@ -136,7 +843,9 @@ namespace dfa {
     /// firstState indicates the state that the lexer starts in before it has received any input. newlineState indicates the state the lexer moves into
     /// if the last lexeme ends with a newline character.
     ///
-    template<typename state_machine, int firstState = 0, int newlineState = 0, bool deleteTables = true, typename state_machine_ref = const state_machine&> class dfa_lexer_base : public basic_lexer {
+    /// runner is the class used to move the state machine over the symbols that are being matched (see dfa_table_runner)
+    ///
+    template<typename state_machine, int firstState = 0, int newlineState = 0, bool deleteTables = true, typename state_machine_ref = const state_machine&, typename runner = dfa_table_runner<state_machine_ref> > class dfa_lexer_base : public basic_lexer {
     private:
         /// \brief The state machine for this lexer
         ///
@@ -149,10 +858,64 @@ namespace dfa {
         /// \brief Array containing a list of possible accept actions for accepting states
         const int* m_Accept;
         
+        /// \brief NULL, or an array describing the states that the state machine can skip through
+        const skip_state* m_Skip;
+        
+        /// \brief NULL, or an array indicating the states where a lexeme can be accepted without reading another symbol
+        const bool* m_Commit;
+        
+        /// \brief NULL, or the table used to reclassify lexemes whose text is a keyword (not owned by this object)
+        const keyword_table* m_Keywords;
+        
+        /// \brief NULL, or the symbols accepted by each state that accepts more than one, from the highest ranked down
+        ///
+        /// Each list ends with -1, and states that accept a single symbol have a NULL entry. These are only used by
+        /// streams that are restricted to some valid symbols (see lexeme_stream::set_valid_symbols), and are only
+        /// available for lexers built from a DFA.
+        const int* const* m_Candidates;
+        
         dfa_lexer_base& operator=(const dfa_lexer_base& copyFrom);
         dfa_lexer_base(const dfa_lexer_base& copyFrom);
         
     private:
+        /// \brief True if the first accept action should be preferred to the second
+        static inline bool higher_rank(const accept_action* first, const accept_action* second) {
+            return (*second) < (*first);
+        }
+        
+        /// \brief Lists the symbols accepted by each state of a DFA that accepts more than one, or returns NULL if there are none
+        static const int* const* find_candidates(const ndfa& dfa) {
+            int**   candidates  = new int*[dfa.count_states()];
+            bool    anyFound    = false;
+            
+            for (int stateId = 0; stateId < dfa.count_states(); ++stateId) {
+                const ndfa::accept_action_list& actions = dfa.actions_for_state(stateId);
+                
+                candidates[stateId] = NULL;
+                if (actions.size() < 2) continue;
+                
+                // Actions with the same rank keep their order, so the first candidate is the symbol in the accept array
+                std::vector<accept_action*> ranked(actions.begin(), actions.end());
+                std::stable_sort(ranked.begin(), ranked.end(), higher_rank);
+                
+                int* symbols = new int[ranked.size() + 1];
+                for (size_t x = 0; x < ranked.size(); ++x) {
+                    symbols[x] = ranked[x]->symbol();
+                }
+                symbols[ranked.size()] = -1;
+                
+                candidates[stateId] = symbols;
+                anyFound            = true;
+            }
+            
+            if (!anyFound) {
+                delete[] candidates;
+                return NULL;
+            }
+            
+            return candidates;
+        }
+        
         /// \brief Fills in an entry in the accept array
         template<typename iterator> inline void fill_accept(int& target, iterator begin, iterator end) {
             // Default is -1
@@ -177,9 +940,14 @@ namespace dfa {
         /// \brief Constructs a lexer from a DFA
         ///
         /// A DFA is an NDFA which has been transformed by to_ndfa_with_unique_symbols() and to_dfa(), in that order.
-        dfa_lexer_base(const ndfa& dfa)
+        /// If keywords is not NULL, it must remain valid until this lexer is destroyed.
+        dfa_lexer_base(const ndfa& dfa, const keyword_table* keywords = NULL)
         : m_StateMachine(dfa)
-        , m_MaxState(dfa.count_states()) {
+        , m_MaxState(dfa.count_states())
+        , m_Skip(find_skip_states(dfa))
+        , m_Commit(find_commit_states(dfa))
+        , m_Keywords(keywords)
+        , m_Candidates(find_candidates(dfa)) {
             // Allocate space for the accepting states
             int* accept = new int[m_MaxState];
             m_Accept    = accept;
@@ -191,10 +959,18 @@ namespace dfa {
         }
 
         /// \brief Constructs a lexer from a state machine
-        dfa_lexer_base(state_machine_ref stateMachine, int maxState, const int* accept)
+        ///
+        /// skip can be NULL, or a table built by find_skip_states() for the DFA that the state machine was built from.
+        /// keywords can be NULL, or a table of keywords to be recognised among the lexemes matched by the DFA. commit
+        /// can be NULL, or a table built by find_commit_states().
+        TAMEPARSE_CONSTEXPR dfa_lexer_base(state_machine_ref stateMachine, int maxState, const int* accept, const skip_state* skip = NULL, const keyword_table* keywords = NULL, const bool* commit = NULL)
         : m_StateMachine(stateMachine)
         , m_MaxState(maxState)
-        , m_Accept(accept) {
+        , m_Accept(accept)
+        , m_Skip(skip)
+        , m_Commit(commit)
+        , m_Keywords(keywords)
+        , m_Candidates(NULL) {
         }
 
         /// \brief Destructor
@@ -203,9 +979,198 @@ namespace dfa {
             if (deleteTables && m_Accept) {
                 delete[] m_Accept;
             }
+            
+            if (deleteTables && m_Skip) {
+                delete[] m_Skip;
+            }
+            
+            if (deleteTables && m_Commit) {
+                delete[] m_Commit;
+            }
+            
+            if (deleteTables && m_Candidates) {
+                for (int stateId = 0; stateId < m_MaxState; ++stateId) {
+                    delete[] m_Candidates[stateId];
+                }
+                delete[] m_Candidates;
+            }
         }
         
     private:
+        /// \brief The initial state for a lexeme, given the last symbol in the lexeme before it
+        static inline int state_after(int lastChar) {
+            if (newlineState != 0) {
+                // Use the newline state if the last character in the lexeme is a newline
+                if (lastChar == 0x0a || lastChar == 0x0b || lastChar == 0x0c || lastChar == 0x0d || lastChar == 0x85 || lastChar == 0x2028 || lastChar == 0x2029) {
+                    return newlineState;
+                }
+            }
+            
+            return 0;
+        }
+        
+        /// \brief Finds the longest lexeme at the start of a buffer, returning the symbol it matched and setting its length
+        ///
+        /// If nothing is matched, this rejects a single symbol and returns -1. If keywords is not NULL, then the symbol is
+        /// replaced by a keyword symbol if the lexeme is a keyword. If complete is not NULL, it is set to false if the
+        /// state machine could have carried on if there were more symbols after end (which it can't if it finished in
+        /// one of the states marked in commit).
+        static inline int longest_match(state_machine_ref stateMachine, const int* accept, const skip_state* skip, const bool* commit, const keyword_table* keywords, int state, const int* start, const int* end, size_t& length, bool* complete = NULL) {
+            int         acceptSymbol    = -1;
+            const int*  acceptPos       = NULL;
+            
+            // Run the state machine until it rejects or we run out of symbols
+            const int* pos      = start;
+            int finalState      = runner::run(stateMachine, accept, skip, state, pos, end, acceptSymbol, acceptPos);
+            
+            if (complete) *complete = finalState < 0 || pos != end || (commit && commit[finalState]);
+            
+            // Always reject at least one character
+            if (acceptPos == NULL) acceptPos = start + 1;
+            
+            // Look up keywords
+            if (keywords && acceptSymbol >= 0) {
+                acceptSymbol = keywords->classify(acceptSymbol, start, acceptPos);
+            }
+            
+            length = acceptPos - start;
+            return acceptSymbol;
+        }
+        
+        /// \brief True if a symbol has a set bit in an array of valid symbols
+        static inline bool is_valid(const unsigned int* valid, int numValid, int symbol) {
+            return symbol >= 0 && symbol < numValid && (valid[symbol>>5] & (1u<<(symbol&31))) != 0;
+        }
+        
+        /// \brief Returns the symbol that a lexeme from start to end is given if the DFA accepts it as the specified symbol,
+        /// or -1 if that isn't valid
+        ///
+        /// Keywords take precedence as usual, but the symbol that the DFA accepted is used if the keyword isn't valid.
+        static inline int valid_symbol(const keyword_table* keywords, const unsigned int* valid, int numValid, int symbol, const int* start, const int* end) {
+            if (keywords) {
+                int keyword = keywords->classify(symbol, start, end);
+                if (keyword != symbol && is_valid(valid, numValid, keyword)) return keyword;
+            }
+            
+            return is_valid(valid, numValid, symbol) ? symbol : -1;
+        }
+        
+        /// \brief Runs the state machine over the symbols from pos to end a symbol at a time, noting the longest lexeme for a
+        /// valid symbol as well as the longest lexeme for any symbol
+        ///
+        /// This behaves like runner::run, but also sets validPos and validSymbol whenever the state machine enters a state
+        /// that accepts a valid symbol. Candidates are tried from the highest ranked down, so validSymbol is the highest
+        /// ranked valid symbol for the lexeme that ends at validPos. start is the start of the lexeme.
+        static inline int run_valid(state_machine_ref stateMachine, const int* accept, const int* const* candidates, const keyword_table* keywords, const unsigned int* valid, int numValid,
+                                    int state, const int* start, const int*& pos, const int* end, int& acceptSymbol, const int*& acceptPos, int& validSymbol, const int*& validPos) {
+            while (pos != end) {
+                // Move on a single symbol, so that every accepting state can be checked
+                int         stepSymbol  = -1;
+                const int*  stepPos     = NULL;
+                
+                state = runner::run(stateMachine, accept, NULL, state, pos, pos + 1, stepSymbol, stepPos);
+                if (state < 0) break;
+                if (!stepPos) continue;
+                
+                acceptSymbol    = stepSymbol;
+                acceptPos       = stepPos;
+                
+                // Find the highest ranked candidate that is valid
+                const int*  candidate   = candidates ? candidates[state] : NULL;
+                int         chosen      = -1;
+                
+                if (candidate) {
+                    for (; *candidate >= 0 && chosen < 0; ++candidate) {
+                        chosen = valid_symbol(keywords, valid, numValid, *candidate, start, stepPos);
+                    }
+                } else {
+                    chosen = valid_symbol(keywords, valid, numValid, stepSymbol, start, stepPos);
+                }
+                
+                if (chosen >= 0) {
+                    validSymbol = chosen;
+                    validPos    = stepPos;
+                }
+            }
+            
+            return state;
+        }
+        
+        /// \brief Finds the longest lexeme for a valid symbol at the start of a buffer, returning its symbol and setting its length
+        ///
+        /// If no valid symbol can be matched, this returns the same as longest_match().
+        static inline int longest_valid_match(state_machine_ref stateMachine, const int* accept, const int* const* candidates, const bool* commit, const keyword_table* keywords, 
+                                              const unsigned int* valid, int numValid, int state, const int* start, const int* end, size_t& length, bool* complete = NULL) {
+            int         acceptSymbol    = -1;
+            const int*  acceptPos       = NULL;
+            int         validSymbol     = -1;
+            const int*  validPos        = NULL;
+            
+            // Run the state machine until it rejects or we run out of symbols
+            const int* pos      = start;
+            int finalState      = run_valid(stateMachine, accept, candidates, keywords, valid, numValid, state, start, pos, end, acceptSymbol, acceptPos, validSymbol, validPos);
+            
+            if (complete) *complete = finalState < 0 || pos != end || (commit && commit[finalState]);
+            
+            // Use the valid symbol if there was one
+            if (validPos) {
+                length = validPos - start;
+                return validSymbol;
+            }
+            
+            // Otherwise, behave as if there were no restriction
+            if (acceptPos == NULL) acceptPos = start + 1;
+            
+            if (keywords && acceptSymbol >= 0) {
+                acceptSymbol = keywords->classify(acceptSymbol, start, acceptPos);
+            }
+            
+            length = acceptPos - start;
+            return acceptSymbol;
+        }
+        
+        ///
+        /// \brief Runs the state machine for this lexer on behalf of a parallel_lexeme_stream
+        ///
+        class dfa_chunk_lexer : public chunk_lexer {
+        private:
+            /// \brief The state machine for this lexer
+            state_machine_ref m_StateMachine;
+            
+            /// \brief Array of symbols that are accepted in each state
+            const int* m_Accept;
+            
+            /// \brief NULL, or the states that can be skipped through
+            const skip_state* m_Skip;
+            
+            /// \brief NULL, or the states where a lexeme can be accepted without reading another symbol
+            const bool* m_Commit;
+            
+            /// \brief NULL, or the keywords to recognise
+            const keyword_table* m_Keywords;
+            
+        public:
+            dfa_chunk_lexer(state_machine_ref sm, const int* acc, const skip_state* skip, const bool* commit, const keyword_table* keywords)
+            : m_StateMachine(sm)
+            , m_Accept(acc)
+            , m_Skip(skip)
+            , m_Commit(commit)
+            , m_Keywords(keywords) {
+            }
+            
+            virtual int first_state() const { return firstState; }
+            
+            virtual int state_after(int lastSymbol) const { return dfa_lexer_base::state_after(lastSymbol); }
+            
+            virtual int match(int initialState, const int* start, const int* end, size_t& length) const {
+                return longest_match(m_StateMachine, m_Accept, m_Skip, m_Commit, m_Keywords, initialState, start, end, length);
+            }
+            
+            virtual int match_partial(int initialState, const int* start, const int* end, size_t& length, bool& complete) const {
+                return longest_match(m_StateMachine, m_Accept, m_Skip, m_Commit, m_Keywords, initialState, start, end, length, &complete);
+            }
+        };
+        
         ///
         /// \brief A lexeme stream that reads from a DFA
         ///
@@ -217,30 +1182,231 @@ namespace dfa {
             /// \brief Array of symbols that are accepted in each state
             const int* m_Accept;
             
+            /// \brief NULL, or the states that the state machine can skip through
+            const skip_state* m_SkipStates;
+            
+            /// \brief NULL, or the states where a lexeme can be accepted without reading another symbol
+            const bool* m_CommitStates;
+            
+            /// \brief NULL, or the keywords to recognise
+            const keyword_table* m_Keywords;
+            
+            /// \brief NULL, or the symbols accepted by states that accept more than one
+            const int* const* m_Candidates;
+            
             /// \brief The stream that this will read symbols from
             lexer_symbol_stream* m_Stream;
             
             /// \brief The position tracker
             position_tracker m_Position;
             
+            /// \brief Number of symbols requested from the symbol stream each time the buffer needs to be refilled
+            static const int c_ReadBlockSize = 256;
+            
             /// \brief Type of the buffer
             typedef std::vector<int> buffer;
             
             /// \brief Buffer of characters waiting to be processed by this stream
+            ///
+            /// Only the symbols between m_BufferStart and m_BufferEnd are waiting to be processed. Consuming a lexeme
+            /// just moves m_BufferStart on: the remaining symbols are only moved back to the start of the buffer when
+            /// there isn't enough space left to read the next block. The buffer only grows when a single lexeme
+            /// requires more lookahead than it can hold.
             buffer m_Buffer;
             
+            /// \brief Index of the first symbol in the buffer that is waiting to be processed
+            size_t m_BufferStart;
+            
+            /// \brief Index after the last symbol in the buffer that is waiting to be processed
+            size_t m_BufferEnd;
+            
             /// \brief The initial state to use before retrieving the next lexeme
             int m_InitialState;
             
+            /// \brief The lexer mode, which is the initial state used after each lexeme
+            int m_Mode;
+            
+            /// \brief NULL, or the next symbol to read if the stream supplied a stable buffer
+            const int* m_StableNext;
+            
+            /// \brief NULL, or the end of the stable buffer
+            const int* m_StableEnd;
+            
+            /// \brief False if this stream only tracks the offset of each lexeme
+            bool m_TrackLines;
+            
+            /// \brief NULL, or an array indicating which symbols should be skipped rather than returned as lexemes
+            const bool* m_Skip;
+            
+            /// \brief The number of entries in m_Skip
+            int m_NumSkip;
+            
+            /// \brief The largest number of symbols that can be read while matching a lexeme, or 0 for no limit
+            size_t m_MaxLength;
+            
+            /// \brief NULL, or bits indicating the symbols that the next lexeme should match if it can
+            const unsigned int* m_Valid;
+            
+            /// \brief The number of symbols covered by m_Valid
+            int m_NumValid;
+            
+            /// \brief True if lexemes matching the specified symbol should be skipped
+            inline bool is_skipped(int symbol) const {
+                return m_Skip && symbol >= 0 && symbol < m_NumSkip && m_Skip[symbol];
+            }
+            
+            /// \brief Moves the position on past a lexeme
+            inline void update_position(const int* start, const int* end) {
+                if (m_TrackLines) {
+                    m_Position.update_position(start, end);
+                } else {
+                    m_Position.update_offset(end - start);
+                }
+            }
+            
         private:
+            /// \brief Chooses the initial state for the next lexeme, given the last symbol in the lexeme that was just accepted
+            inline void choose_initial_state(int lastChar) {
+                m_InitialState = m_Mode == 0 ? state_after(lastChar) : m_Mode;
+            }
+            
+            /// \brief Reads the next block of symbols from the stream into the buffer
+            ///
+            /// Returns false if there are no more symbols to read
+            inline bool fill_buffer() {
+                // Make space for the next block if the buffer is full
+                if (m_Buffer.size() - m_BufferEnd < (size_t) c_ReadBlockSize) {
+                    size_t waiting = m_BufferEnd - m_BufferStart;
+                    
+                    if (m_BufferStart > 0) {
+                        // Move the symbols that are still waiting to the start of the buffer
+                        std::copy(m_Buffer.begin() + m_BufferStart, m_Buffer.begin() + m_BufferEnd, m_Buffer.begin());
+                        m_BufferStart   = 0;
+                        m_BufferEnd     = waiting;
+                    }
+                    
+                    if (m_Buffer.size() - m_BufferEnd < (size_t) c_ReadBlockSize) {
+                        // The lookahead for the current lexeme fills the buffer: make it bigger
+                        m_Buffer.resize(m_Buffer.size() * 2);
+                    }
+                }
+                
+                // Read the next block
+                size_t numRead = m_Stream->read(&m_Buffer[m_BufferEnd], c_ReadBlockSize);
+                m_BufferEnd += numRead;
+                
+                return numRead > 0;
+            }
+            
+            /// \brief Reads the next lexeme directly from the stable buffer
+            ///
+            /// The lexemes generated by this call refer to the buffer rather than copying it.
+            inline void read_stable(lexeme*& result) {
+                for (;;) {
+                    // Nothing to do if we've reached the end of the buffer
+                    const int* start = m_StableNext;
+                    if (start == m_StableEnd) {
+                        result = NULL;
+                        return;
+                    }
+                    
+                    // Find the longest match for the next lexeme (reading at most one symbol past the length limit)
+                    const int*  end             = m_MaxLength > 0 && (size_t) (m_StableEnd - start) > m_MaxLength ? start + m_MaxLength + 1 : m_StableEnd;
+                    size_t      length;
+                    bool        complete;
+                    int         acceptSymbol;
+                    
+                    if (m_Valid) {
+                        acceptSymbol = longest_valid_match(m_StateMachine, m_Accept, m_Candidates, m_CommitStates, m_Keywords, m_Valid, m_NumValid, m_InitialState, start, end, length, &complete);
+                    } else {
+                        acceptSymbol = longest_match(m_StateMachine, m_Accept, m_SkipStates, m_CommitStates, m_Keywords, m_InitialState, start, end, length, &complete);
+                    }
+                    
+                    // Lexemes that need more symbols than the limit are returned as a rejected lexeme of the maximum length
+                    if (!complete && end != m_StableEnd) {
+                        acceptSymbol    = -1;
+                        length          = m_MaxLength + 1;
+                    }
+                    
+                    const int*  acceptPos       = start + length;
+                    
+                    // Create a lexeme that refers to the buffer, unless this symbol is being skipped
+                    bool skipped = is_skipped(acceptSymbol);
+                    if (!skipped) {
+                        result = new lexeme(start, acceptPos - start, m_Position.current_position(), acceptSymbol);
+                    }
+                    
+                    // Update the state and position
+                    choose_initial_state(acceptPos[-1]);
+                    update_position(start, acceptPos);
+                    m_StableNext = acceptPos;
+                    
+                    if (!skipped) return;
+                }
+            }
             
         public:
             /// \brief Creates a new stream that works with the specified state machine, list of accepting actions and symbol stream
-            dfa_stream(state_machine_ref sm, const int* acc, lexer_symbol_stream* str)
+            ///
+            /// If trackLines is false, the lexemes will only have an offset, and their line and column will be -1.
+            dfa_stream(state_machine_ref sm, const int* acc, const skip_state* skip, const bool* commit, const keyword_table* keywords, const int* const* candidates, lexer_symbol_stream* str, bool trackLines = true)
             : m_StateMachine(sm)
             , m_Accept(acc)
+            , m_SkipStates(skip)
+            , m_CommitStates(commit)
+            , m_Keywords(keywords)
+            , m_Candidates(candidates)
             , m_Stream(str)
-            , m_InitialState(firstState) {
+            , m_Position(trackLines ? position() : position(0, -1, -1))
+            , m_BufferStart(0)
+            , m_BufferEnd(0)
+            , m_InitialState(firstState)
+            , m_Mode(0)
+            , m_StableNext(NULL)
+            , m_StableEnd(NULL)
+            , m_TrackLines(trackLines)
+            , m_Skip(NULL)
+            , m_NumSkip(0)
+            , m_MaxLength(0)
+            , m_Valid(NULL)
+            , m_NumValid(0) {
+                // Read directly from the stream's buffer if it has one
+                if (!m_Stream->stable_buffer(m_StableNext, m_StableEnd)) {
+                    m_StableNext    = NULL;
+                    m_StableEnd     = NULL;
+                    
+                    m_Buffer.resize(c_ReadBlockSize * 4);
+                }
+            }
+            
+            /// \brief Creates a new stream that carries on from a checkpoint, reading from the specified symbol stream
+            dfa_stream(state_machine_ref sm, const int* acc, const skip_state* skip, const bool* commit, const keyword_table* keywords, const int* const* candidates, lexer_symbol_stream* str, const lexer_checkpoint& checkpoint)
+            : m_StateMachine(sm)
+            , m_Accept(acc)
+            , m_SkipStates(skip)
+            , m_CommitStates(commit)
+            , m_Keywords(keywords)
+            , m_Candidates(candidates)
+            , m_Stream(str)
+            , m_Position(checkpoint.pos(), checkpoint.seen_return())
+            , m_BufferStart(0)
+            , m_BufferEnd(0)
+            , m_InitialState(checkpoint.initial_state())
+            , m_Mode(checkpoint.mode())
+            , m_StableNext(NULL)
+            , m_StableEnd(NULL)
+            , m_TrackLines(checkpoint.pos().has_line())
+            , m_Skip(NULL)
+            , m_NumSkip(0)
+            , m_MaxLength(0)
+            , m_Valid(NULL)
+            , m_NumValid(0) {
+                if (!m_Stream->stable_buffer(m_StableNext, m_StableEnd)) {
+                    m_StableNext    = NULL;
+                    m_StableEnd     = NULL;
+                    
+                    m_Buffer.resize(c_ReadBlockSize * 4);
+                }
             }
             
             /// \brief Destructor
@@ -248,6 +1414,12 @@ namespace dfa {
                 delete m_Stream;
             }
             
+            /// \brief Retrieves a checkpoint describing the state of this stream before the next lexeme
+            virtual bool checkpoint(lexer_checkpoint& result) const {
+                result = lexer_checkpoint(m_Position.current_position(), m_InitialState, m_Position.seen_return(), m_Mode);
+                return true;
+            }
+            
             /// \brief Sets the initial state to be used by the next run through of the state machine
             ///
             /// Might not do anything, the meaning of the 'initialState' is defined by the implementation of the lexer. However, the default initial 
@@ -255,86 +1427,179 @@ namespace dfa {
             virtual void set_initial_state(int initialState) {
                 m_InitialState = initialState;
             }
+            
+            /// \brief Skips over any lexeme whose symbol has a true entry in the specified array
+            virtual bool skip_symbols(const bool* skip, int numSymbols) {
+                m_Skip      = skip;
+                m_NumSkip   = skip ? numSymbols : 0;
+                return true;
+            }
+            
+            /// \brief Switches this stream into a different lexer mode
+            virtual bool set_mode(int mode) {
+                m_Mode          = mode;
+                m_InitialState  = mode;
+                return true;
+            }
+            
+            /// \brief Limits the number of symbols this stream will read while matching a single lexeme (0 for no limit)
+            virtual bool set_max_lexeme_length(int maxLength) {
+                m_MaxLength = maxLength > 0 ? (size_t) maxLength : 0;
+                return true;
+            }
+            
+            /// \brief Restricts the lexemes that this stream returns to the symbols with a set bit in the specified array
+            virtual bool set_valid_symbols(const unsigned int* valid, int numSymbols) {
+                m_Valid     = valid;
+                m_NumValid  = valid ? numSymbols : 0;
+                return true;
+            }
 
             /// \brief Fills in the contents of the specified pointer with the next lexeme (or NULL if the end of input has been reached)
             virtual lexeme_stream& operator>>(lexeme*& result) {
-                // Create the initial lexer state
-                int     state           = m_InitialState;
-                int     pos             = 0;
-                int     acceptSymbol    = -1;
-                int     acceptPos       = -1;
-                bool    atEof           = false;
+                read(result);
+                return *this;
+            }
+            
+            /// \brief Fills in the contents of the specified pointer with the next lexeme (or NULL if the end of input has been reached)
+            ///
+            /// This does the same as operator>>, but can be called directly by code that knows the type of the stream,
+            /// so the state machine can be inlined into the caller.
+            inline void read(lexeme*& result) {
+                // Use the stable buffer if there is one
+                if (m_StableNext) {
+                    read_stable(result);
+                    return;
+                }
                 
                 for (;;) {
-                    // Add to the end of the buffer if it is empty
-                    if (pos == (int) m_Buffer.size()) {
-                        // Get the next symbol
-                        int nextSym;
-                        (*m_Stream) >> nextSym;
+                    // Create the initial lexer state
+                    int     state           = m_InitialState;
+                    size_t  pos             = m_BufferStart;
+                    int     acceptSymbol    = -1;
+                    size_t  acceptPos       = 0;
+                    int     validSymbol     = -1;
+                    size_t  validPos        = 0;
+                    bool    tooLong         = false;
+                    
+                    for (;;) {
+                        // Refill the buffer in blocks if we've run out of symbols
+                        if (pos == m_BufferEnd) {
+                            // No need to read any more if the lexeme can't be any longer
+                            if (m_CommitStates && pos != m_BufferStart && m_CommitStates[state]) break;
+                            
+                            // fill_buffer() may move the symbols in the buffer
+                            size_t offset       = pos - m_BufferStart;
+                            size_t acceptOffset = acceptPos - m_BufferStart;
+                            size_t validOffset  = validPos - m_BufferStart;
+                            
+                            bool moreSymbols    = fill_buffer();
+                            
+                            pos                 = m_BufferStart + offset;
+                            if (acceptPos != 0) acceptPos = m_BufferStart + acceptOffset;
+                            if (validPos != 0)  validPos = m_BufferStart + validOffset;
+                            
+                            // Stop once we reach the end of the input
+                            if (!moreSymbols) break;
+                        }
                         
-                        // Stop once we reach the end of file marker
-                        if (nextSym == symbol_set::end_of_input) {
-                            atEof = true;
-                            break;
+                        // Run the state machine over the symbols that are available in the buffer (reading at most one symbol
+                        // past the length limit)
+                        const int*  symbols     = &m_Buffer[0];
+                        const int*  next        = symbols + pos;
+                        const int*  end         = symbols + m_BufferEnd;
+                        const int*  lastAccept  = acceptPos != 0 ? symbols + acceptPos : NULL;
+                        const int*  lastValid   = validPos != 0 ? symbols + validPos : NULL;
+                        
+                        if (m_MaxLength > 0 && m_BufferEnd - m_BufferStart > m_MaxLength) {
+                            end = symbols + m_BufferStart + m_MaxLength + 1;
                         }
                         
-                        // Push this as the next symbol
-                        m_Buffer.push_back(nextSym);
+                        if (m_Valid) {
+                            state = run_valid(m_StateMachine, m_Accept, m_Candidates, m_Keywords, m_Valid, m_NumValid, state, symbols + m_BufferStart, next, end, acceptSymbol, lastAccept, validSymbol, lastValid);
+                        } else {
+                            state = runner::run(m_StateMachine, m_Accept, m_SkipStates, state, next, end, acceptSymbol, lastAccept);
+                        }
+                        
+                        pos = next - symbols;
+                        if (lastAccept) acceptPos = lastAccept - symbols;
+                        if (lastValid)  validPos = lastValid - symbols;
+                        
+                        if (state < 0) break;
+                        
+                        // Give up on lexemes that need more symbols than the limit
+                        if (m_MaxLength > 0 && pos - m_BufferStart > m_MaxLength) {
+                            tooLong = true;
+                            break;
+                        }
                     }
                     
-                    // Get the current symbol
-                    int curSym = m_Buffer[pos];
+                    // If the buffer is empty, then the result is always NULL 
+                    if (m_BufferStart == m_BufferEnd) {
+                        result = NULL;
+                        return;
+                    }
                     
-                    // The position moves on here
-                    ++pos;
+                    // Lexemes that were too long are returned as a rejected lexeme of the maximum length
+                    if (tooLong) {
+                        acceptSymbol    = -1;
+                        acceptPos       = m_BufferStart + m_MaxLength + 1;
+                        validPos        = 0;
+                    }
                     
-                    // Run the state machine (use the faster 'unsafe' mode, we check the state later ourselves)
-                    state = m_StateMachine.run_unsafe(state, curSym);
+                    // If nothing was accepted, then reject at least one character
+                    if (acceptPos == 0) acceptPos = m_BufferStart + 1;
                     
-                    // Stop processing if the state machine rejects this character (this is why we can use the unsafe mode, at least assuming the state machine doesn't transition to a state that's too high)
-                    if (state < 0) break;
+                    // Prefer the longest lexeme for a valid symbol (which has already been checked against the keywords)
+                    if (validPos != 0) {
+                        acceptSymbol    = validSymbol;
+                        acceptPos       = validPos;
+                    }
                     
-                    // If this is an accepting state, mark it as such
-                    if (m_Accept[state] >= 0) {
-                        acceptPos       = pos;
-                        acceptSymbol    = m_Accept[state];
+                    // Look up keywords
+                    else if (m_Keywords && acceptSymbol >= 0) {
+                        acceptSymbol = m_Keywords->classify(acceptSymbol, &m_Buffer[m_BufferStart], &m_Buffer[0] + acceptPos);
                     }
-                }
-                
-                // If the buffer is empty, then the result is always NULL 
-                if (m_Buffer.empty()) {
-                    result = NULL;
-                    return *this;
-                }
-                
-                // If the accept position is -1 or 0, change it to 1 so we reject at least one character
-                if (acceptPos <= 0) acceptPos = 1;
-                
-                // Create the lexeme for this item
-                result = new lexeme(m_Buffer.begin(), m_Buffer.begin() + acceptPos, m_Position.current_position(), acceptSymbol, acceptPos);
-                
-                // Choose the new initial state
-                m_InitialState = 0;
-                if (newlineState != m_InitialState) {
-                    // Use the newline state if the last character in the lexeme is a newline
-                    int lastChar = m_Buffer[acceptPos-1];
-                    if (lastChar == 0x0a || lastChar == 0x0b || lastChar == 0x0c || lastChar == 0x0d || lastChar == 0x85 || lastChar == 0x2028 || lastChar == 0x2029) {
-                        m_InitialState = newlineState;
+                    
+                    // Create the lexeme for this item, unless this symbol is being skipped
+                    buffer::const_iterator lexemeStart  = m_Buffer.begin() + m_BufferStart;
+                    buffer::const_iterator lexemeEnd    = m_Buffer.begin() + acceptPos;
+                    
+                    bool skipped = is_skipped(acceptSymbol);
+                    if (!skipped) {
+                        result = new lexeme(lexemeStart, lexemeEnd, m_Position.current_position(), acceptSymbol, acceptPos - m_BufferStart);
                     }
+                    
+                    // Choose the new initial state
+                    choose_initial_state(m_Buffer[acceptPos-1]);
+                    
+                    // Update the position to point after the accepted lexeme
+                    update_position(&m_Buffer[m_BufferStart], &m_Buffer[0] + acceptPos);
+                    
+                    // Consume the accepted symbols
+                    m_BufferStart = acceptPos;
+                    if (m_BufferStart == m_BufferEnd) {
+                        m_BufferStart = m_BufferEnd = 0;
+                    }
+                    
+                    // Carry on to the next lexeme if this one was skipped
+                    if (!skipped) return;
                 }
-                
-                // Update the position to point after the accepted lexeme
-                m_Position.update_position(m_Buffer.begin(), m_Buffer.begin() + acceptPos);
-                
-                // Delete the accepted symbols from the buffer
-                m_Buffer.erase(m_Buffer.begin(), m_Buffer.begin() + acceptPos);
-                
-                // Done
-                return *this;
             }
         };
         
     public:
+        /// \brief The type of the lexeme streams created by this lexer
+        typedef dfa_stream stream;
+        
+        /// \brief Creates a new lexer to process the specified symbol stream, returning the stream with its actual type
+        ///
+        /// Callers that know the type of this lexer can use this to call stream::read() directly rather than going
+        /// through the virtual operator>>.
+        inline stream* create_static_stream(lexer_symbol_stream* symbols) const {
+            return new dfa_stream(m_StateMachine, m_Accept, m_Skip, m_Commit, m_Keywords, m_Candidates, symbols);
+        }
+        
         ///
         /// \brief Creates a new lexer to process the specified symbol stream
         ///
@@ -342,12 +1607,58 @@ namespace dfa {
         ///
         virtual lexeme_stream* create_stream(lexer_symbol_stream* stream) const {
             if (!stream) return NULL;
-            return new dfa_stream(m_StateMachine, m_Accept, stream);
+            return new dfa_stream(m_StateMachine, m_Accept, m_Skip, m_Commit, m_Keywords, m_Candidates, stream);
+        }
+        
+        /// \brief Creates a new lexer that will read from a buffer of symbols in memory, only tracking the offset of each lexeme
+        virtual lexeme_stream* create_offset_stream_from_symbols(const int* begin, const int* end) const {
+            return new dfa_stream(m_StateMachine, m_Accept, m_Skip, m_Commit, m_Keywords, m_Candidates, new buffer_symbol_stream(begin, end), false);
+        }
+        
+        /// \brief Creates a new lexer that will read from a buffer of symbols in memory, lexing it on up to maxThreads threads
+        virtual lexeme_stream* create_parallel_stream_from_symbols(const int* begin, const int* end, unsigned int maxThreads = 0) const {
+            return new parallel_lexeme_stream(new dfa_chunk_lexer(m_StateMachine, m_Accept, m_Skip, m_Commit, m_Keywords), begin, end, maxThreads);
+        }
+        
+        /// \brief Creates an object that runs the state machine for this lexer directly over buffers of symbols
+        virtual chunk_lexer* create_chunk_lexer() const {
+            return new dfa_chunk_lexer(m_StateMachine, m_Accept, m_Skip, m_Commit, m_Keywords);
+        }
+        
+        /// \brief Creates a new lexer that carries on from a checkpoint taken from a stream reading the same buffer
+        virtual lexeme_stream* create_stream_from_checkpoint(const int* begin, const int* end, const lexer_checkpoint& checkpoint) const {
+            return new dfa_stream(m_StateMachine, m_Accept, m_Skip, m_Commit, m_Keywords, m_Candidates, new buffer_symbol_stream(begin + checkpoint.offset(), end), checkpoint);
+        }
+        
+        /// \brief Splits the symbols after a cursor into tokens, writing up to maxTokens of them to an array
+        virtual size_t tokenize(token_cursor& cursor, token* tokens, size_t maxTokens) const {
+            size_t count = 0;
+            
+            while (count < maxTokens && !cursor.at_end()) {
+                // Match the next token
+                size_t  length;
+                int     symbol  = longest_match(m_StateMachine, m_Accept, m_Skip, m_Commit, m_Keywords, cursor.state(), cursor.next(), cursor.end(), length);
+                
+                // Store it
+                position    pos     = cursor.pos();
+                token&      result  = tokens[count++];
+                
+                result.symbol   = symbol;
+                result.offset   = pos.offset();
+                result.length   = (int) length;
+                result.line     = pos.line();
+                result.column   = pos.column();
+                
+                // Move on to the next token
+                cursor.advance(length, cursor.mode() == 0 ? state_after(cursor.next()[length-1]) : cursor.mode());
+            }
+            
+            return count;
         }
         
         /// \brief Estimated size in bytes of this lexer
         virtual size_t size() const {
-            return m_StateMachine.size();
+            return m_StateMachine.size() + (m_Keywords ? m_Keywords->size() : 0);
         }
     };
     
@@ -364,7 +1675,41 @@ namespace dfa {
         /// \brief Constructs a lexer from a DFA
         ///
         /// A DFA is an NDFA which has been transformed by to_ndfa_with_unique_symbols() and to_dfa(), in that order.
-        inline dfa_lexer(const ndfa& dfa) : base(dfa) {
+        inline dfa_lexer(const ndfa& dfa, const keyword_table* keywords = NULL) : base(dfa, keywords) {
+        }
+    };
+    
+    ///
+    /// \brief A lexer that is built from a DFA, using a packed_state_machine
+    ///
+    /// This is faster and smaller than a dfa_lexer for DFAs that have few enough states to fit in a cell_type: use
+    /// packed_state_machine::fits() to check this before creating one.
+    ///
+    template<typename char_type, typename cell_type = unsigned short, int firstState = 0, int newlineState = 0> class packed_dfa_lexer : public dfa_lexer_base<packed_state_machine<char_type, cell_type>, firstState, newlineState> {
+    public:
+        typedef dfa_lexer_base<packed_state_machine<char_type, cell_type>, firstState, newlineState> base;
+        
+        /// \brief True if the specified DFA has few enough states to be used with this lexer
+        static inline bool fits(const ndfa& dfa) { return packed_state_machine<char_type, cell_type>::fits(dfa); }
+        
+        /// \brief Constructs a lexer from a DFA
+        inline packed_dfa_lexer(const ndfa& dfa, const keyword_table* keywords = NULL) : base(dfa, keywords) {
+        }
+    };
+    
+    ///
+    /// \brief A lexer that is built from a DFA, using a comb_state_machine
+    ///
+    /// This has constant-time transitions like a packed_dfa_lexer, but uses space proportional to the number of
+    /// transitions rather than to the number of states multiplied by the number of symbol sets, so it is suitable
+    /// for DFAs with too many states to be packed.
+    ///
+    template<typename char_type, int firstState = 0, int newlineState = 0> class comb_dfa_lexer : public dfa_lexer_base<comb_state_machine<char_type>, firstState, newlineState> {
+    public:
+        typedef dfa_lexer_base<comb_state_machine<char_type>, firstState, newlineState> base;
+        
+        /// \brief Constructs a lexer from a DFA
+        inline comb_dfa_lexer(const ndfa& dfa, const keyword_table* keywords = NULL) : base(dfa, keywords) {
         }
     };
 }
@@ -0,0 +1,207 @@
+//
+//  binary_lexer.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#include <ostream>
+
+#include "TameParse/Dfa/binary_lexer.h"
+#include "TameParse/Dfa/symbol_table.h"
+
+using namespace std;
+using namespace util;
+using namespace dfa;
+
+/// \brief Value of the first word in a binary lexer ('TPDL' when written little-endian)
+static const int c_BinaryMagic      = 0x4c445054;
+
+/// \brief Version of the binary format written by write_binary
+static const int c_BinaryVersion    = 1;
+
+/// \brief Number of entries in the flat part of the symbol translator
+static const int c_FastSize         = 256;
+
+/// \brief Words in the header of the binary format
+enum binary_header {
+    hdr_magic,
+    hdr_version,
+    hdr_num_states,
+    hdr_num_cells,
+    hdr_symbol_table_size,
+    
+    hdr_size
+};
+
+/// \brief Writes out an array of ints in binary form
+static inline void write_ints(ostream& target, const int* values, size_t count) {
+    if (count == 0) return;
+    target.write((const char*) values, (streamsize) (sizeof(int) * count));
+}
+
+/// \brief Creates a lexer from the tables found in some binary data
+binary_lexer::binary_lexer(const int* fastSymbols, const int* symbolTable, const int* base, const int* check, const int* next, int numStates, int numCells, const int* accept)
+: m_Translator(fastSymbols, symbolTable)
+, m_StateMachine(m_Translator, base, check, next, numStates, numCells)
+, m_Lexer(m_StateMachine, numStates, accept) {
+}
+
+/// \brief Writes a lexer for the specified DFA to a stream in the format read by from_binary
+void binary_lexer::write_binary(std::ostream& target, const ndfa& dfa) {
+    // Build the symbol translator
+    symbol_table<wchar_t> symbolLevels;
+    
+    for (symbol_map::iterator symbolSet = dfa.symbols().begin(); symbolSet != dfa.symbols().end(); ++symbolSet) {
+        for (symbol_set::iterator symbolRange = symbolSet->first->begin(); symbolRange != symbolSet->first->end(); ++symbolRange) {
+            // Special symbols can't appear in the input stream
+            if (symbolRange->upper() <= 0) continue;
+            
+            int lower = symbolRange->lower() < 0 ? 0 : symbolRange->lower();
+            symbolLevels.add_range(range<int>(lower, symbolRange->upper()), symbolSet->second);
+        }
+    }
+    
+    size_t  symbolTableSize;
+    int*    symbolTable = symbolLevels.table.to_hard_coded_table(symbolTableSize);
+    
+    int fastSymbols[c_FastSize];
+    for (int chr = 0; chr < c_FastSize; ++chr) {
+        fastSymbols[chr] = symbolLevels.lookup((wchar_t) chr);
+    }
+    
+    // Pack the transitions and find the accepting symbol for each state
+    int                         numStates = dfa.count_states();
+    vector<comb_vector::row>    rows((size_t) numStates);
+    vector<int>                 accept((size_t) numStates, -1);
+    
+    for (int stateId = 0; stateId < numStates; ++stateId) {
+        const state& thisState = dfa.get_state(stateId);
+        
+        for (state::iterator transit = thisState.begin(); transit != thisState.end(); ++transit) {
+            rows[stateId].push_back(comb_vector::cell(transit->symbol_set(), transit->new_state()));
+        }
+        
+        // Use the highest ranked action, as dfa_lexer_base does
+        const ndfa::accept_action_list& actions = dfa.actions_for_state(stateId);
+        if (actions.empty()) continue;
+        
+        const accept_action* highest = actions.front();
+        for (ndfa::accept_action_list::const_iterator action = actions.begin(); action != actions.end(); ++action) {
+            if ((*highest) < **action) {
+                highest = *action;
+            }
+        }
+        
+        accept[stateId] = highest->symbol();
+    }
+    
+    comb_vector packed(rows);
+    
+    // Write out the header
+    int header[hdr_size];
+    
+    header[hdr_magic]               = c_BinaryMagic;
+    header[hdr_version]             = c_BinaryVersion;
+    header[hdr_num_states]          = numStates;
+    header[hdr_num_cells]           = packed.count_cells();
+    header[hdr_symbol_table_size]   = (int) symbolTableSize;
+    
+    write_ints(target, header, hdr_size);
+    
+    // Write out the tables
+    write_ints(target, fastSymbols, c_FastSize);
+    write_ints(target, symbolTable, symbolTableSize);
+    write_ints(target, packed.base(), (size_t) packed.count_rows());
+    write_ints(target, packed.check(), (size_t) packed.count_cells());
+    write_ints(target, packed.value(), (size_t) packed.count_cells());
+    if (numStates > 0) write_ints(target, &accept[0], (size_t) numStates);
+    
+    delete[] symbolTable;
+}
+
+/// \brief Creates a lexer that refers directly to data written by write_binary, or returns NULL if the data is not valid
+binary_lexer* binary_lexer::from_binary(const void* data, size_t size) {
+    // Every table is made up of ints, so the data must be aligned
+    if (!data || ((size_t) data) % sizeof(int) != 0)    return NULL;
+    if (size < sizeof(int) * hdr_size)                  return NULL;
+    
+    // Check the header
+    const int* header = (const int*) data;
+    
+    if (header[hdr_magic] != c_BinaryMagic || header[hdr_version] != c_BinaryVersion) return NULL;
+    
+    // The lexer must have an initial state, and the symbol table must at least have a default value and a range
+    if (header[hdr_num_states] <= 0 || header[hdr_num_cells] < 0 || header[hdr_symbol_table_size] < 2) return NULL;
+    
+    size_t numStates        = (size_t) header[hdr_num_states];
+    size_t numCells         = (size_t) header[hdr_num_cells];
+    size_t symbolTableSize  = (size_t) header[hdr_symbol_table_size];
+    
+    // Work out where each table is
+    const int* fastSymbols  = header + hdr_size;
+    const int* symbolTable  = fastSymbols + c_FastSize;
+    const int* base         = symbolTable + symbolTableSize;
+    const int* check        = base + numStates;
+    const int* next         = check + numCells;
+    const int* accept       = next + numCells;
+    
+    size_t numInts = hdr_size + c_FastSize + symbolTableSize + 2*numStates + 2*numCells;
+    if (size / sizeof(int) < numInts) return NULL;
+    
+    return new binary_lexer(fastSymbols, symbolTable, base, check, next, (int) numStates, (int) numCells, accept);
+}
+
+/// \brief Creates a new lexer to process the specified symbol stream
+lexeme_stream* binary_lexer::create_stream(lexer_symbol_stream* stream) const {
+    return m_Lexer.create_stream(stream);
+}
+
+/// \brief Creates a new lexer that will read from a buffer of symbols in memory, lexing it on up to maxThreads threads
+lexeme_stream* binary_lexer::create_parallel_stream_from_symbols(const int* begin, const int* end, unsigned int maxThreads) const {
+    return m_Lexer.create_parallel_stream_from_symbols(begin, end, maxThreads);
+}
+
+/// \brief Creates a new lexer that will read from a buffer of symbols in memory, only tracking the offset of each lexeme
+lexeme_stream* binary_lexer::create_offset_stream_from_symbols(const int* begin, const int* end) const {
+    return m_Lexer.create_offset_stream_from_symbols(begin, end);
+}
+
+/// \brief Creates a new lexer that carries on from a checkpoint taken from a stream reading the same buffer
+lexeme_stream* binary_lexer::create_stream_from_checkpoint(const int* begin, const int* end, const lexer_checkpoint& checkpoint) const {
+    return m_Lexer.create_stream_from_checkpoint(begin, end, checkpoint);
+}
+
+/// \brief Creates an object that runs the state machine for this lexer directly over buffers of symbols
+chunk_lexer* binary_lexer::create_chunk_lexer() const {
+    return m_Lexer.create_chunk_lexer();
+}
+
+/// \brief Splits the symbols after a cursor into tokens, writing up to maxTokens of them to an array
+size_t binary_lexer::tokenize(token_cursor& cursor, token* tokens, size_t maxTokens) const {
+    return m_Lexer.tokenize(cursor, tokens, maxTokens);
+}
+
+/// \brief Estimated size in bytes of this lexer
+size_t binary_lexer::size() const {
+    return sizeof(*this) + m_Lexer.size();
+}
@@ -0,0 +1,112 @@
+//
+//  binary_lexer.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _DFA_BINARY_LEXER_H
+#define _DFA_BINARY_LEXER_H
+
+#include <iosfwd>
+
+#include "TameParse/Dfa/basic_lexer.h"
+#include "TameParse/Dfa/hard_coded_symbol_table.h"
+
+namespace dfa {
+    ///
+    /// \brief Lexer that runs tables stored in a block of binary data, such as a mapped file
+    ///
+    /// The binary format contains the same tables as the parser generator writes out as C++ source: the symbol
+    /// translator (a flat table for the first 256 characters and a hard-coded symbol table for the rest), the 
+    /// state machine as a row-displacement table and the accepting symbol for each state. Each table is a flat
+    /// array of native-endian integers, so loading a lexer requires no allocation or fixups beyond checking the
+    /// header.
+    ///
+    class binary_lexer : public basic_lexer {
+    public:
+        /// \brief The symbol translator used by binary lexers
+        typedef hard_coded_fast_symbol_table<wchar_t, 2> translator;
+        
+        /// \brief The state machine used by binary lexers
+        typedef state_machine_comb_tables<wchar_t, translator> lexer_state_machine;
+        
+        /// \brief The lexer that runs the state machine
+        typedef dfa_lexer_base<const lexer_state_machine&, 0, 0, false, const lexer_state_machine&> lexer_definition;
+        
+    private:
+        /// \brief Translates characters into symbol sets
+        translator m_Translator;
+        
+        /// \brief The state machine for this lexer
+        lexer_state_machine m_StateMachine;
+        
+        /// \brief The lexer definition
+        lexer_definition m_Lexer;
+        
+        /// \brief Creates a lexer from the tables found in some binary data
+        binary_lexer(const int* fastSymbols, const int* symbolTable, const int* base, const int* check, const int* next, int numStates, int numCells, const int* accept);
+        
+        /// \brief Disabled copy constructor
+        binary_lexer(const binary_lexer& copyFrom);
+        
+        /// \brief Disabled assignment
+        binary_lexer& operator=(const binary_lexer& assignFrom);
+        
+    public:
+        /// \brief Writes a lexer for the specified DFA to a stream (which should be opened in binary mode) in the format read by from_binary
+        ///
+        /// As with dfa_lexer, the DFA must have been processed by to_ndfa_with_unique_symbols() and to_dfa(). Only the
+        /// lower 16 bits of each symbol are significant, as with the lexers generated as C++ source.
+        static void write_binary(std::ostream& target, const ndfa& dfa);
+        
+        /// \brief Creates a lexer that refers directly to data written by write_binary, or returns NULL if the data is not valid
+        ///
+        /// The data must be aligned to an int and must remain valid until the result is destroyed. Only the structure of
+        /// the data is checked: the contents are assumed to be tables that were written by write_binary.
+        static binary_lexer* from_binary(const void* data, size_t size);
+        
+    public:
+        /// \brief Creates a new lexer to process the specified symbol stream
+        virtual lexeme_stream* create_stream(lexer_symbol_stream* stream) const;
+        
+        /// \brief Creates a new lexer that will read from a buffer of symbols in memory, lexing it on up to maxThreads threads
+        virtual lexeme_stream* create_parallel_stream_from_symbols(const int* begin, const int* end, unsigned int maxThreads = 0) const;
+        
+        /// \brief Creates a new lexer that will read from a buffer of symbols in memory, only tracking the offset of each lexeme
+        virtual lexeme_stream* create_offset_stream_from_symbols(const int* begin, const int* end) const;
+        
+        /// \brief Creates a new lexer that carries on from a checkpoint taken from a stream reading the same buffer
+        virtual lexeme_stream* create_stream_from_checkpoint(const int* begin, const int* end, const lexer_checkpoint& checkpoint) const;
+        
+        /// \brief Creates an object that runs the state machine for this lexer directly over buffers of symbols
+        virtual chunk_lexer* create_chunk_lexer() const;
+        
+        /// \brief Splits the symbols after a cursor into tokens, writing up to maxTokens of them to an array
+        virtual size_t tokenize(token_cursor& cursor, token* tokens, size_t maxTokens) const;
+        
+        /// \brief Estimated size in bytes of this lexer
+        virtual size_t size() const;
+    };
+}
+
+#endif
@@ -0,0 +1,68 @@
+//
+//  frozen_ndfa.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include "TameParse/Dfa/frozen_ndfa.h"
+
+using namespace std;
+using namespace dfa;
+
+/// \brief Makes a frozen copy of the specified NDFA, treating the specified symbol set as epsilon (-1 if there are no epsilon transitions)
+frozen_ndfa::frozen_ndfa(const ndfa& source, int epsilonSymbolSet)
+: m_First(1, 0)
+, m_EpsilonFirst(1, 0)
+, m_Actions(source.count_states(), NULL)
+, m_Epsilon(epsilonSymbolSet) {
+    // Count the transitions so the arrays only need to be allocated once
+    size_t numTransitions = 0;
+    for (int stateId = 0; stateId < source.count_states(); ++stateId) {
+        numTransitions += (size_t) source.get_state(stateId).count_transitions();
+    }
+    
+    m_First.reserve(source.count_states() + 1);
+    m_EpsilonFirst.reserve(source.count_states() + 1);
+    m_Transitions.reserve(numTransitions + 1);
+    
+    for (int stateId = 0; stateId < source.count_states(); ++stateId) {
+        const state& thisState = source.get_state(stateId);
+        
+        for (state::iterator transit = thisState.begin(); transit != thisState.end(); ++transit) {
+            if (transit->symbol_set() == epsilonSymbolSet) {
+                m_EpsilonTarget.push_back(transit->new_state());
+            } else {
+                m_Transitions.push_back(*transit);
+            }
+        }
+        
+        m_First.push_back((int) m_Transitions.size());
+        m_EpsilonFirst.push_back((int) m_EpsilonTarget.size());
+        
+        const ndfa::accept_action_list& actions = source.actions_for_state(stateId);
+        if (!actions.empty()) m_Actions[stateId] = &actions;
+    }
+    
+    // begin() and end() take the address of the first element, so make sure there is one
+    m_Transitions.push_back(transition(-1, -1));
+    m_EpsilonTarget.push_back(-1);
+}
@@ -0,0 +1,97 @@
+//
+//  frozen_ndfa.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _DFA_FROZEN_NDFA_H
+#define _DFA_FROZEN_NDFA_H
+
+#include <vector>
+
+#include "TameParse/Dfa/ndfa.h"
+#include "TameParse/Dfa/transition.h"
+
+namespace dfa {
+    ///
+    /// \brief Read-only copy of the transitions and accepting actions of an NDFA, stored in flat arrays
+    ///
+    /// The states in an ndfa keep their transitions in separate sets, which is convenient while it is being built but
+    /// slow to walk through. The transformations that go over the same transitions many times (such as ndfa::to_dfa)
+    /// make one of these first: the transitions for all of the states are stored one after
+    /// another in a single array (in the same order as the state iterates them), with an array of offsets giving
+    /// where each state begins. Epsilon transitions are kept separately, as they are only needed for closures.
+    ///
+    /// This refers to the accepting actions of the NDFA rather than copying them, so the NDFA must not be changed or
+    /// destroyed while this object is in use.
+    ///
+    class frozen_ndfa {
+    private:
+        /// \brief The index in m_Transitions of the first transition for each state (with an extra entry at the end)
+        std::vector<int> m_First;
+        
+        /// \brief The transitions that aren't epsilon transitions, grouped by state
+        std::vector<transition> m_Transitions;
+        
+        /// \brief The index in m_EpsilonTarget of the first epsilon transition for each state (with an extra entry at the end)
+        std::vector<int> m_EpsilonFirst;
+        
+        /// \brief The targets of the epsilon transitions, grouped by state
+        std::vector<int> m_EpsilonTarget;
+        
+        /// \brief The accepting actions for each state (NULL if a state has none)
+        std::vector<const ndfa::accept_action_list*> m_Actions;
+        
+        /// \brief The symbol set used for epsilon transitions (-1 if there is none)
+        int m_Epsilon;
+    
+    public:
+        /// \brief Makes a frozen copy of the specified NDFA, treating the specified symbol set as epsilon (-1 if there are no epsilon transitions)
+        frozen_ndfa(const ndfa& source, int epsilonSymbolSet);
+        
+        /// \brief The number of states
+        inline int count_states() const { return (int) m_Actions.size(); }
+        
+        /// \brief The symbol set used for epsilon transitions (-1 if there is none)
+        inline int epsilon() const { return m_Epsilon; }
+        
+        /// \brief The first transition for the specified state
+        inline const transition* begin(int stateId) const { return &m_Transitions[0] + m_First[stateId]; }
+        
+        /// \brief The transition after the last transition for the specified state
+        inline const transition* end(int stateId) const { return &m_Transitions[0] + m_First[stateId+1]; }
+        
+        /// \brief The number of transitions (not counting epsilon transitions) from the specified state
+        inline int count_transitions(int stateId) const { return m_First[stateId+1] - m_First[stateId]; }
+        
+        /// \brief The target of the first epsilon transition for the specified state
+        inline const int* begin_epsilon(int stateId) const { return &m_EpsilonTarget[0] + m_EpsilonFirst[stateId]; }
+        
+        /// \brief The target after the last epsilon transition for the specified state
+        inline const int* end_epsilon(int stateId) const { return &m_EpsilonTarget[0] + m_EpsilonFirst[stateId+1]; }
+        
+        /// \brief The accepting actions for the specified state (NULL if there are none)
+        inline const ndfa::accept_action_list* actions(int stateId) const { return m_Actions[stateId]; }
+    };
+}
+
+#endif
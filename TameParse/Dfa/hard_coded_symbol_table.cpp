@@ -34,9 +34,11 @@ using namespace dfa;
 /// \brief Test class to highlight any compilation errors in the class in debug builds
 static int some_ints[] = { 1,2,3 };
 static hard_coded_symbol_table<wchar_t, 2> s_WideCharSymbolTableTest(some_ints);
+static hard_coded_fast_symbol_table<wchar_t, 2> s_WideCharFastSymbolTableTest(some_ints, some_ints);
 
 static void lookup_test() {
     s_WideCharSymbolTableTest.lookup(L'x');
+    s_WideCharFastSymbolTableTest.lookup(L'x');
 }
 
 #endif
@@ -30,6 +30,8 @@
 
 #include <cstdlib>
 
+#include "TameParse/Util/constexpr.h"
+
 namespace dfa {
     ///
     /// \brief Looks up a symbol at a particular level in the table
@@ -70,10 +72,10 @@ namespace dfa {
         int highest = lowHigh>>8;
         
         // Return the default value if the symbol is out of range
-        if ((int) symbol < lowest || (int) symbol >= highest) return table[offset + 0];
+        int pos         = ((unsigned int) symbol&0xff);
+        if (pos < lowest || pos >= highest) return table[offset + 0];
         
         // Look up the symbol set
-        int pos         = ((unsigned int) symbol&0xff);
         int symbolSet   = table[offset + 2 + (pos - lowest)];
         
         // Use the default symbol if the offset is -1
@@ -112,7 +114,7 @@ namespace dfa {
 
     public:
         /// \brief Constructs a new hard-coded symbol table with the specified table
-        explicit hard_coded_symbol_table(const int* table)
+        explicit TAMEPARSE_CONSTEXPR hard_coded_symbol_table(const int* table)
         : m_Table(table) { }
 
         /// \brief Returns the symbol set for a particular character
@@ -120,6 +122,75 @@ namespace dfa {
             return hcst_lookup_sym<char_size-1>(m_Table, 0, (unsigned int) symbol);
         }
     };
+    
+    ///
+    /// \brief Hard-coded symbol translator table with a flat table for the first 256 characters
+    ///
+    /// This is the hard-coded equivalent of fast_symbol_level. Characters less than 256 are looked up directly in a
+    /// table of 256 symbol sets, and the remaining characters are looked up in a table with the same format as is 
+    /// used by hard_coded_symbol_table.
+    ///
+    template<typename char_type, size_t char_size> class hard_coded_fast_symbol_table {
+    private:
+        /// \brief The symbol sets for the first 256 characters
+        const int* m_Fast;
+        
+        /// \brief The hard-coded symbol table for the remaining characters
+        const int* m_Table;
+        
+    public:
+        /// \brief Constructs a new hard-coded symbol table with the specified tables
+        TAMEPARSE_CONSTEXPR hard_coded_fast_symbol_table(const int* fast, const int* table)
+        : m_Fast(fast)
+        , m_Table(table) { }
+        
+        /// \brief Returns the symbol set for a particular character
+        inline int lookup(char_type symbol) const {
+            unsigned int sym = (unsigned int) symbol;
+            if (sym < 256) return m_Fast[sym];
+            
+            return hcst_lookup_sym<char_size-1>(m_Table, 0, sym);
+        }
+    };
+    
+    ///
+    /// \brief Hard-coded symbol translator table for characters in the basic multilingual plane
+    ///
+    /// The symbol sets are stored in blocks of 256 characters, and a table of 256 block numbers is indexed by the
+    /// upper 8 bits of each character. Blocks with the same contents are only stored once, so for most languages this
+    /// is small, and looking up a character needs at most two loads and no range checks. The first block is always
+    /// the block for the characters less than 256, so these can be looked up directly.
+    ///
+    /// All characters outside the basic multilingual plane are in the same set. Lexers built with surrogate pairs
+    /// (the default) never see these characters.
+    ///
+    template<typename char_type> class hard_coded_bmp_symbol_table {
+    private:
+        /// \brief The number of the block in m_Sets for each value of the upper 8 bits of a character
+        const unsigned char* m_Blocks;
+        
+        /// \brief The symbol sets, in blocks of 256 characters
+        const int* m_Sets;
+        
+        /// \brief The symbol set for characters outside the basic multilingual plane
+        int m_Outside;
+        
+    public:
+        /// \brief Constructs a new hard-coded symbol table with the specified tables
+        TAMEPARSE_CONSTEXPR hard_coded_bmp_symbol_table(const unsigned char* blocks, const int* sets, int outside)
+        : m_Blocks(blocks)
+        , m_Sets(sets)
+        , m_Outside(outside) { }
+        
+        /// \brief Returns the symbol set for a particular character
+        inline int lookup(char_type symbol) const {
+            unsigned int sym = (unsigned int) symbol;
+            if (sym < 256) return m_Sets[sym];
+            if (sym > 0xffff) return m_Outside;
+            
+            return m_Sets[(((unsigned int) m_Blocks[sym >> 8]) << 8) | (sym & 0xff)];
+        }
+    };
 }
 
 #endif
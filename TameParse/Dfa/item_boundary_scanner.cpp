@@ -0,0 +1,125 @@
+//
+//  item_boundary_scanner.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include "TameParse/Dfa/item_boundary_scanner.h"
+#include "TameParse/Dfa/position.h"
+
+using namespace std;
+using namespace dfa;
+
+/// \brief Skips any whitespace at the start of a range of symbols
+static inline const int* skip_whitespace(const int* begin, const int* end) {
+    while (begin != end && item_boundary_scanner::is_whitespace(*begin)) {
+        ++begin;
+    }
+    return begin;
+}
+
+/// \brief Destructor
+item_boundary_scanner::~item_boundary_scanner() {
+}
+
+/// \brief Finds the first item between begin and end
+bool line_boundary_scanner::next_item(const int* begin, const int* end, const int*& itemBegin, const int*& itemEnd) const {
+    // Blank lines are made up entirely of whitespace, so skipping it also skips them
+    itemBegin = skip_whitespace(begin, end);
+    if (itemBegin == end) return false;
+    
+    itemEnd = find_newline(itemBegin, end);
+    return true;
+}
+
+/// \brief Creates a scanner that only splits items after their closing bracket
+bracket_boundary_scanner::bracket_boundary_scanner() {
+}
+
+/// \brief Creates a scanner that also splits items after a terminator symbol
+bracket_boundary_scanner::bracket_boundary_scanner(int terminator)
+: m_Terminators(1, terminator) {
+}
+
+/// \brief Creates a scanner that also splits items after any of the specified terminator symbols
+bracket_boundary_scanner::bracket_boundary_scanner(const basic_string<int>& terminators)
+: m_Terminators(terminators) {
+}
+
+/// \brief Finds the first item between begin and end
+bool bracket_boundary_scanner::next_item(const int* begin, const int* end, const int*& itemBegin, const int*& itemEnd) const {
+    itemBegin = skip_whitespace(begin, end);
+    if (itemBegin == end) return false;
+    
+    int depth = 0;
+    int quote = 0;
+    
+    for (const int* pos = itemBegin; pos != end; ++pos) {
+        int symbol = *pos;
+        
+        if (quote) {
+            // Inside a literal, only the closing quote matters
+            if (symbol == '\\') {
+                if (pos + 1 == end) break;
+                ++pos;
+            } else if (symbol == quote) {
+                quote = 0;
+            }
+            continue;
+        }
+        
+        switch (symbol) {
+            case '"':
+            case '\'':
+                quote = symbol;
+                break;
+            
+            case '(':
+            case '[':
+            case '{':
+                ++depth;
+                break;
+            
+            case ')':
+            case ']':
+            case '}':
+                // Stray closing brackets end the item as well (the parser will report the error)
+                if (depth > 0) --depth;
+                if (depth == 0) {
+                    itemEnd = pos + 1;
+                    return true;
+                }
+                break;
+            
+            default:
+                if (depth == 0 && m_Terminators.find(symbol) != basic_string<int>::npos) {
+                    itemEnd = pos + 1;
+                    return true;
+                }
+                break;
+        }
+    }
+    
+    // The last item doesn't have to be terminated
+    itemEnd = end;
+    return true;
+}
@@ -0,0 +1,101 @@
+//
+//  item_boundary_scanner.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _DFA_ITEM_BOUNDARY_SCANNER_H
+#define _DFA_ITEM_BOUNDARY_SCANNER_H
+
+#include <string>
+
+namespace dfa {
+    ///
+    /// \brief Splits a buffer of symbols into a list of independent top-level items
+    ///
+    /// This is used by lr::compiled_language::parse_items to divide an input, such as a file of JSON records or a list
+    /// of declarations, into pieces that can be parsed at the same time. Scanners are meant to be much cheaper than
+    /// lexing: they only look at the symbols, so they must be able to find the end of an item without knowing anything
+    /// about the language other than how items are separated.
+    ///
+    class item_boundary_scanner {
+    public:
+        /// \brief Destructor
+        virtual ~item_boundary_scanner();
+        
+        /// \brief Finds the first item between begin and end
+        ///
+        /// Returns false if there are no more items. Otherwise, itemBegin and itemEnd are set to the range of symbols
+        /// in the item, and the next call should start at itemEnd.
+        virtual bool next_item(const int* begin, const int* end, const int*& itemBegin, const int*& itemEnd) const = 0;
+        
+        /// \brief True if the specified symbol is whitespace that can be skipped between items
+        static inline bool is_whitespace(int symbol) {
+            return symbol == ' ' || (symbol >= 0x09 && symbol <= 0x0d) || symbol == 0x85 || symbol == 0xa0 || symbol == 0x2028 || symbol == 0x2029 || symbol == 0xfeff;
+        }
+    };
+    
+    ///
+    /// \brief Scanner for inputs with one item on each line (such as JSON lines files)
+    ///
+    /// Blank lines are skipped. The newline at the end of each line is not part of its item.
+    ///
+    class line_boundary_scanner : public item_boundary_scanner {
+    public:
+        /// \brief Finds the first item between begin and end
+        virtual bool next_item(const int* begin, const int* end, const int*& itemBegin, const int*& itemEnd) const;
+    };
+    
+    ///
+    /// \brief Scanner for items that are either bracketed or end with a terminator symbol
+    ///
+    /// Parentheses, square brackets and braces are counted. An item ends after the bracket that closes its outermost
+    /// pair (so a sequence of JSON objects or C function definitions is split after each closing brace), or after a
+    /// terminator symbol that is not inside any brackets (such as the semicolon after a C declaration). Brackets and
+    /// terminators inside string or character literals are ignored: these are delimited by double or single quotes,
+    /// and a backslash escapes the symbol after it.
+    ///
+    /// Comments are not recognised, and an item that carries on after its closing bracket (such as a struct
+    /// declaration followed by a variable name) will be split in two. Languages where these matter need their own
+    /// scanner.
+    ///
+    class bracket_boundary_scanner : public item_boundary_scanner {
+    private:
+        /// \brief The symbols that end an item when they're not inside brackets
+        std::basic_string<int> m_Terminators;
+    
+    public:
+        /// \brief Creates a scanner that only splits items after their closing bracket
+        bracket_boundary_scanner();
+        
+        /// \brief Creates a scanner that also splits items after a terminator symbol
+        explicit bracket_boundary_scanner(int terminator);
+        
+        /// \brief Creates a scanner that also splits items after any of the specified terminator symbols
+        explicit bracket_boundary_scanner(const std::basic_string<int>& terminators);
+        
+        /// \brief Finds the first item between begin and end
+        virtual bool next_item(const int* begin, const int* end, const int*& itemBegin, const int*& itemEnd) const;
+    };
+}
+
+#endif
@@ -0,0 +1,176 @@
+//
+//  keyword_table.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#include <algorithm>
+
+#include "TameParse/Dfa/keyword_table.h"
+
+using namespace std;
+using namespace dfa;
+
+/// \brief The number of seeds to try for each table size before making the table larger
+static const unsigned int c_SeedsPerSize = 256;
+
+/// \brief The number of symbols in the text table
+int keyword_table::text_length() const {
+    int length = 0;
+    
+    for (int slot = 0; slot < count_slots(); ++slot) {
+        if (m_Entries[slot].baseSymbol < 0) continue;
+        length = max(length, m_Entries[slot].textOffset + m_Entries[slot].length);
+    }
+    
+    return length;
+}
+
+/// \brief Creates an empty table
+keyword_hash_table::keyword_hash_table()
+: keyword_table(0, 0, 1, 0, NULL, NULL) {
+}
+
+/// \brief Builds a table containing the specified keywords
+///
+/// The table starts with at least twice as many slots as there are keywords. Seeds are tried in order until one is
+/// found that puts every keyword in a different slot; if none of the seeds work, the table size is doubled.
+keyword_hash_table::keyword_hash_table(const keyword_list& keywords)
+: keyword_table(0, 0, 1, 0, NULL, NULL) {
+    // Put the text of all of the keywords together, and work out the range of lengths
+    vector<int> offsets;
+    
+    for (keyword_list::const_iterator kw = keywords.begin(); kw != keywords.end(); ++kw) {
+        offsets.push_back((int) m_Symbols.size());
+        if (kw->text.empty()) continue;
+        
+        // Case insensitive keywords are stored in lower case
+        for (vector<int>::const_iterator symbol = kw->text.begin(); symbol != kw->text.end(); ++symbol) {
+            m_Symbols.push_back(kw->foldCase ? fold(*symbol) : *symbol);
+        }
+        if (kw->foldCase) m_FoldCase = true;
+        
+        if (m_MaxLength < m_MinLength) {
+            m_MinLength = m_MaxLength = (int) kw->text.size();
+        } else {
+            m_MinLength = min(m_MinLength, (int) kw->text.size());
+            m_MaxLength = max(m_MaxLength, (int) kw->text.size());
+        }
+    }
+    
+    // Nothing else to do if there are no keywords
+    if (empty()) return;
+    
+    // Search for a seed that doesn't produce any collisions
+    unsigned int numSlots = 1;
+    while (numSlots < keywords.size() * 2) numSlots <<= 1;
+    
+    for (;;) {
+        for (unsigned int seed = 0; seed < c_SeedsPerSize; ++seed) {
+            // Try to fill in the slots with this seed
+            bool collision = false;
+            entry emptySlot = { -1, -1, 0, 0, false };
+            m_Slots.assign(numSlots, emptySlot);
+            
+            for (size_t index = 0; index < keywords.size(); ++index) {
+                const keyword& kw = keywords[index];
+                if (kw.text.empty()) continue;
+                
+                const int*  begin   = &m_Symbols[offsets[index]];
+                const int*  end     = begin + kw.text.size();
+                entry&      slot    = m_Slots[hash(seed, kw.baseSymbol, begin, end) & (numSlots - 1)];
+                
+                if (slot.baseSymbol >= 0) {
+                    collision = true;
+                    break;
+                }
+                
+                slot.baseSymbol     = kw.baseSymbol;
+                slot.keywordSymbol  = kw.keywordSymbol;
+                slot.textOffset     = offsets[index];
+                slot.length         = (int) kw.text.size();
+                slot.foldCase       = kw.foldCase;
+            }
+            
+            // Use this seed if every keyword got its own slot
+            if (!collision) {
+                m_Seed = seed;
+                m_Mask = numSlots - 1;
+                refer_to_tables();
+                return;
+            }
+        }
+        
+        // Try a larger table
+        numSlots <<= 1;
+    }
+}
+
+/// \brief Creates a copy of an existing table
+keyword_hash_table::keyword_hash_table(const keyword_table& copyFrom)
+: keyword_table(copyFrom.seed(), 0, copyFrom.min_length(), copyFrom.max_length(), NULL, NULL, copyFrom.fold_case()) {
+    if (copyFrom.count_slots() > 0) {
+        m_Mask = (unsigned int) copyFrom.count_slots() - 1;
+        m_Slots.assign(&copyFrom.get_slot(0), &copyFrom.get_slot(0) + copyFrom.count_slots());
+        m_Symbols.assign(copyFrom.text(), copyFrom.text() + copyFrom.text_length());
+    }
+    
+    refer_to_tables();
+}
+
+/// \brief Creates a copy of an existing table
+keyword_hash_table::keyword_hash_table(const keyword_hash_table& copyFrom)
+: keyword_table(copyFrom)
+, m_Slots(copyFrom.m_Slots)
+, m_Symbols(copyFrom.m_Symbols) {
+    refer_to_tables();
+}
+
+/// \brief Assigns the contents of another table to this one
+keyword_hash_table& keyword_hash_table::operator=(const keyword_hash_table& assignFrom) {
+    if (&assignFrom == this) return *this;
+    
+    keyword_table::operator=(assignFrom);
+    m_Slots     = assignFrom.m_Slots;
+    m_Symbols   = assignFrom.m_Symbols;
+    refer_to_tables();
+    
+    return *this;
+}
+
+/// \brief Updates the pointers in the base class to refer to the tables in this object
+void keyword_hash_table::refer_to_tables() {
+    m_Entries   = m_Slots.empty() ? NULL : &m_Slots[0];
+    m_Text      = m_Symbols.empty() ? NULL : &m_Symbols[0];
+}
+
+/// \brief The number of keywords in this table
+int keyword_hash_table::count_keywords() const {
+    int count = 0;
+    
+    for (vector<entry>::const_iterator slot = m_Slots.begin(); slot != m_Slots.end(); ++slot) {
+        if (slot->baseSymbol >= 0) ++count;
+    }
+    
+    return count;
+}
@@ -0,0 +1,249 @@
+//
+//  keyword_table.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+
+#ifndef _DFA_KEYWORD_TABLE_H
+#define _DFA_KEYWORD_TABLE_H
+
+#include <cstdlib>
+#include <vector>
+
+#include "TameParse/Util/constexpr.h"
+
+namespace dfa {
+    ///
+    /// \brief Perfect hash table that reclassifies lexemes whose text is a keyword
+    ///
+    /// Languages with many keywords defined as literals need a DFA state for every prefix of every keyword, even though
+    /// the keywords are usually also matched by an identifier expression. A lexer can leave the keywords out of its DFA
+    /// and match them as identifiers instead, and then use this table to replace the symbol with the keyword symbol
+    /// when the text of the lexeme is one of the keywords.
+    ///
+    /// Each entry maps a base symbol (the identifier) and some text onto a keyword symbol. The table size is a power of
+    /// two, and the seed for the hash function is chosen so that no two keywords share a slot, so classifying a lexeme
+    /// takes a single hash and comparison.
+    ///
+    /// Case insensitive keywords are stored in lower case. If the table contains any, a lexeme that doesn't match a
+    /// keyword exactly is folded to lower case and looked up a second time, so the DFA doesn't need to contain both cases
+    /// of every keyword. Only the ASCII letters are folded.
+    ///
+    /// This class only refers to its tables, so that lexers written out as source code can define them as static
+    /// arrays. Use keyword_hash_table to build a new table.
+    ///
+    class keyword_table {
+    public:
+        /// \brief A slot in the hash table
+        struct entry {
+            /// \brief The symbol that must be matched for this entry to apply, or -1 if this slot is empty
+            int baseSymbol;
+            
+            /// \brief The symbol that replaces the base symbol if the text matches
+            int keywordSymbol;
+            
+            /// \brief Offset of the text of this keyword in the text table
+            int textOffset;
+            
+            /// \brief Number of symbols in the text of this keyword
+            int length;
+            
+            /// \brief True if the text of this keyword is in lower case, and it should match lexemes in any case
+            bool foldCase;
+        };
+    
+    protected:
+        /// \brief The seed for the hash function
+        unsigned int m_Seed;
+        
+        /// \brief Mask applied to the hash to find a slot (the number of slots minus one)
+        unsigned int m_Mask;
+        
+        /// \brief The length of the shortest keyword
+        int m_MinLength;
+        
+        /// \brief The length of the longest keyword
+        int m_MaxLength;
+        
+        /// \brief The slots in the table (m_Mask + 1 of them)
+        const entry* m_Entries;
+        
+        /// \brief The text of the keywords
+        const int* m_Text;
+        
+        /// \brief True if any of the keywords are case insensitive
+        bool m_FoldCase;
+    
+    public:
+        /// \brief Creates a table that refers to the specified hash table entries and text
+        TAMEPARSE_CONSTEXPR keyword_table(unsigned int seed, unsigned int mask, int minLength, int maxLength, const entry* entries, const int* text, bool foldCase = false)
+        : m_Seed(seed)
+        , m_Mask(mask)
+        , m_MinLength(minLength)
+        , m_MaxLength(maxLength)
+        , m_Entries(entries)
+        , m_Text(text)
+        , m_FoldCase(foldCase) {
+        }
+        
+        /// \brief Converts an ASCII upper case letter to lower case, leaving any other symbol unchanged
+        static inline int fold(int symbol) {
+            return (symbol >= 'A' && symbol <= 'Z') ? symbol + ('a' - 'A') : symbol;
+        }
+        
+        /// \brief Hashes the text of a lexeme that matched the specified symbol (folding it to lower case if foldCase is true)
+        static inline unsigned int hash(unsigned int seed, int symbol, const int* begin, const int* end, bool foldCase = false) {
+            // FNV-1a, with the seed and symbol mixed in to the initial value
+            unsigned int result = (seed ^ ((unsigned int) symbol * 0x9e3779b9u)) * 16777619u;
+            
+            for (const int* pos = begin; pos != end; ++pos) {
+                result = (result ^ (unsigned int) (foldCase ? fold(*pos) : *pos)) * 16777619u;
+            }
+            
+            return result ^ (result >> 15);
+        }
+        
+        /// \brief Returns the keyword symbol for a lexeme with the specified symbol and text, or the symbol itself if the text is not a keyword
+        inline int classify(int symbol, const int* begin, const int* end) const {
+            // Most lexemes can be rejected on their length alone
+            int length = (int) (end - begin);
+            if (length < m_MinLength || length > m_MaxLength) return symbol;
+            
+            // Check the only slot that the keyword could be in
+            const entry& slot = m_Entries[hash(m_Seed, symbol, begin, end) & m_Mask];
+            if (matches(slot, symbol, begin, end, false)) return slot.keywordSymbol;
+            
+            // Case insensitive keywords are stored in lower case, so they might be found in the slot for the folded text
+            if (m_FoldCase) {
+                const entry& foldedSlot = m_Entries[hash(m_Seed, symbol, begin, end, true) & m_Mask];
+                if (foldedSlot.foldCase && matches(foldedSlot, symbol, begin, end, true)) return foldedSlot.keywordSymbol;
+            }
+            
+            return symbol;
+        }
+        
+        /// \brief True if the specified slot contains a keyword for a lexeme with the specified symbol and text
+        inline bool matches(const entry& slot, int symbol, const int* begin, const int* end, bool foldCase) const {
+            if (slot.baseSymbol != symbol || slot.length != (int) (end - begin)) return false;
+            
+            const int* text = m_Text + slot.textOffset;
+            for (const int* pos = begin; pos != end; ++pos, ++text) {
+                if ((foldCase ? fold(*pos) : *pos) != *text) return false;
+            }
+            
+            return true;
+        }
+        
+        /// \brief The seed for the hash function
+        inline unsigned int seed() const { return m_Seed; }
+        
+        /// \brief The number of slots in the table
+        inline int count_slots() const { return m_Entries ? (int) m_Mask + 1 : 0; }
+        
+        /// \brief The slot with the specified index
+        inline const entry& get_slot(int index) const { return m_Entries[index]; }
+        
+        /// \brief The length of the shortest keyword
+        inline int min_length() const { return m_MinLength; }
+        
+        /// \brief The length of the longest keyword
+        inline int max_length() const { return m_MaxLength; }
+        
+        /// \brief The number of symbols in the text table
+        int text_length() const;
+        
+        /// \brief The text table
+        inline const int* text() const { return m_Text; }
+        
+        /// \brief True if this table contains any case insensitive keywords
+        inline bool fold_case() const { return m_FoldCase; }
+        
+        /// \brief Estimated size in bytes of this table
+        inline size_t size() const { return count_slots() * sizeof(entry) + text_length() * sizeof(int); }
+    };
+    
+    ///
+    /// \brief A keyword_table that owns its tables, built from a list of keywords
+    ///
+    class keyword_hash_table : public keyword_table {
+    public:
+        /// \brief A keyword to be put in the table
+        struct keyword {
+            /// \brief The symbol matched by the lexemes that can be this keyword
+            int baseSymbol;
+            
+            /// \brief The text of the keyword
+            std::vector<int> text;
+            
+            /// \brief The symbol that lexemes with this text become
+            int keywordSymbol;
+            
+            /// \brief True if this keyword should match lexemes in any case
+            bool foldCase;
+            
+            /// \brief Creates a case sensitive keyword with no text
+            inline keyword() : baseSymbol(-1), keywordSymbol(-1), foldCase(false) { }
+        };
+        
+        /// \brief A list of keywords
+        typedef std::vector<keyword> keyword_list;
+    
+    private:
+        /// \brief The slots in the table
+        std::vector<entry> m_Slots;
+        
+        /// \brief The text of the keywords
+        std::vector<int> m_Symbols;
+        
+        /// \brief Updates the pointers in the base class to refer to the tables in this object
+        void refer_to_tables();
+    
+    public:
+        /// \brief Creates an empty table
+        keyword_hash_table();
+        
+        /// \brief Builds a table containing the specified keywords
+        ///
+        /// No two keywords should have the same base symbol and text (after case insensitive keywords have been folded to
+        /// lower case). Keywords with no text are ignored.
+        explicit keyword_hash_table(const keyword_list& keywords);
+        
+        /// \brief Creates a copy of an existing table
+        explicit keyword_hash_table(const keyword_table& copyFrom);
+        
+        /// \brief Creates a copy of an existing table
+        keyword_hash_table(const keyword_hash_table& copyFrom);
+        
+        /// \brief Assigns the contents of another table to this one
+        keyword_hash_table& operator=(const keyword_hash_table& assignFrom);
+        
+        /// \brief True if this table contains no keywords
+        inline bool empty() const { return m_MaxLength < m_MinLength; }
+        
+        /// \brief The number of keywords in this table
+        int count_keywords() const;
+    };
+}
+
+#endif
@@ -0,0 +1,619 @@
+//
+//  lazy_dfa_lexer.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#include <algorithm>
+#include <stdint.h>
+
+#include "TameParse/Dfa/lazy_dfa_lexer.h"
+#include "TameParse/Util/hash_map.h"
+
+using namespace std;
+using namespace dfa;
+
+///
+/// \brief The DFA states that a single stream has reached so far
+///
+/// States are identified by the sorted set of NDFA states that they represent, in the same way as ndfa::to_dfa.
+/// Transitions are worked out the first time they are followed. Emptying the cache discards every state, so state
+/// IDs are only valid until the next call to next() or initial().
+///
+class lazy_dfa_lexer::state_cache {
+private:
+    /// \brief Value in the transition table for transitions that haven't been worked out yet
+    static const int c_Unknown = -2;
+    
+    /// \brief Estimated number of bytes used by each state in addition to its NDFA states and transitions
+    static const size_t c_StateOverhead = 64;
+    
+    /// \brief A state that has been built
+    struct cached_state {
+        /// \brief The NDFA states that make up this state
+        vector<int> nfaStates;
+        
+        /// \brief The symbol accepted in this state (-1 if it is not an accepting state)
+        int accept;
+    };
+    
+    /// \brief Maps hash codes for sets of NDFA states onto the states with that hash
+    typedef util::hash_map<uint64_t, vector<int> >::type states_for_hash;
+    
+    /// \brief The lexer that this cache belongs to
+    const lazy_dfa_lexer& m_Lexer;
+    
+    /// \brief The states that have been built
+    vector<cached_state> m_States;
+    
+    /// \brief The transition table, with a row of m_NumSets entries for each state
+    vector<int> m_Transitions;
+    
+    /// \brief The states with each hash code
+    states_for_hash m_StatesForHash;
+    
+    /// \brief The initial state for each mode (-1 if it hasn't been built yet)
+    vector<int> m_Modes;
+    
+    /// \brief Estimated number of bytes used by the states in this cache
+    size_t m_Size;
+    
+    /// \brief The number of times this cache has been emptied
+    int m_Resets;
+    
+    /// \brief Scratch space: an NDFA state is in the set being built if its entry matches m_Stamp
+    vector<unsigned int> m_InSet;
+    
+    /// \brief The stamp for the set currently being built
+    unsigned int m_Stamp;
+    
+    /// \brief Scratch space: the NDFA states reached by a transition
+    vector<int> m_Moves;
+    
+    /// \brief Scratch space: the closure of m_Moves
+    vector<int> m_Target;
+    
+    /// \brief Computes a hash code for a sorted set of states
+    static uint64_t hash(const vector<int>& states) {
+        // FNV-1a
+        uint64_t result = 14695981039346656037ULL;
+        for (vector<int>::const_iterator stateIt = states.begin(); stateIt != states.end(); ++stateIt) {
+            result = (result ^ (uint64_t) (unsigned int) *stateIt) * 1099511628211ULL;
+        }
+        return result;
+    }
+    
+    /// \brief Stores the sorted epsilon closure of the specified NDFA states in result
+    void close(const vector<int>& states, vector<int>& result) {
+        result.clear();
+        
+        ++m_Stamp;
+        for (vector<int>::const_iterator stateIt = states.begin(); stateIt != states.end(); ++stateIt) {
+            const vector<int>& stateClosure = m_Lexer.m_Closure[*stateIt];
+            
+            for (vector<int>::const_iterator closeIt = stateClosure.begin(); closeIt != stateClosure.end(); ++closeIt) {
+                if (m_InSet[*closeIt] == m_Stamp) continue;
+                
+                m_InSet[*closeIt] = m_Stamp;
+                result.push_back(*closeIt);
+            }
+        }
+        
+        // A single closure is already sorted
+        if (states.size() > 1) {
+            sort(result.begin(), result.end());
+        }
+    }
+    
+    /// \brief Discards all of the states in this cache
+    void reset() {
+        m_States.clear();
+        m_Transitions.clear();
+        m_StatesForHash.clear();
+        m_Modes.assign(m_Modes.size(), -1);
+        
+        m_Size = 0;
+        ++m_Resets;
+    }
+    
+    /// \brief Finds or creates the state for the specified sorted set of NDFA states
+    ///
+    /// This will empty the cache first if there isn't room for a new state.
+    int find_or_add(const vector<int>& nfaStates) {
+        // Look for an existing state
+        uint64_t        setHash     = hash(nfaStates);
+        vector<int>&    withHash    = m_StatesForHash[setHash];
+        
+        for (vector<int>::const_iterator candidate = withHash.begin(); candidate != withHash.end(); ++candidate) {
+            if (m_States[*candidate].nfaStates == nfaStates) {
+                return *candidate;
+            }
+        }
+        
+        // Make room for the new state
+        size_t numSets  = (size_t) m_Lexer.m_NumSets;
+        size_t cost     = c_StateOverhead + (nfaStates.size() + numSets) * sizeof(int);
+        
+        if (!m_States.empty() && m_Size + cost > m_Lexer.m_MaxCacheSize) {
+            reset();
+        }
+        
+        // Work out the symbol accepted by the new state, using the highest ranked action
+        const accept_action*    highest = NULL;
+        bool                    isEager = false;
+        
+        for (vector<int>::const_iterator stateIt = nfaStates.begin(); stateIt != nfaStates.end(); ++stateIt) {
+            const ndfa::accept_action_list& actions = m_Lexer.m_Ndfa->actions_for_state(*stateIt);
+            
+            for (ndfa::accept_action_list::const_iterator action = actions.begin(); action != actions.end(); ++action) {
+                if (!highest || (*highest) < **action) {
+                    highest = *action;
+                }
+                
+                if ((*action)->eager()) {
+                    isEager = true;
+                }
+            }
+        }
+        
+        // Create the state
+        int newState = (int) m_States.size();
+        
+        m_States.push_back(cached_state());
+        m_States.back().nfaStates   = nfaStates;
+        m_States.back().accept      = highest ? highest->symbol() : -1;
+        
+        m_StatesForHash[setHash].push_back(newState);
+        
+        // Eager states accept immediately, so they have no transitions
+        m_Transitions.resize(m_Transitions.size() + numSets, isEager ? -1 : (int) c_Unknown);
+        
+        m_Size += cost;
+        return newState;
+    }
+    
+public:
+    /// \brief Creates an empty cache for the specified lexer
+    explicit state_cache(const lazy_dfa_lexer& lexer)
+    : m_Lexer(lexer)
+    , m_Modes(lexer.m_InitialStates.size(), -1)
+    , m_Size(0)
+    , m_Resets(0)
+    , m_InSet(lexer.m_Closure.size(), 0)
+    , m_Stamp(0) {
+    }
+    
+    /// \brief The initial state for the specified mode (-1 if there is no such mode)
+    int initial(int mode) {
+        if (mode < 0 || mode >= (int) m_Modes.size())  return -1;
+        if (m_Lexer.m_InitialStates[mode] < 0)          return -1;
+        if (m_Modes[mode] >= 0)                         return m_Modes[mode];
+        
+        m_Moves.assign(1, m_Lexer.m_InitialStates[mode]);
+        close(m_Moves, m_Target);
+        
+        int result      = find_or_add(m_Target);
+        m_Modes[mode]   = result;
+        return result;
+    }
+    
+    /// \brief The state reached from the specified state after reading a symbol (-1 if the symbol is rejected)
+    int next(int stateId, int symbol) {
+        int symbolSet = m_Lexer.m_Translator.set_for_symbol(symbol);
+        if (symbolSet < 0 || symbolSet >= m_Lexer.m_NumSets) return -1;
+        
+        // Use the transition if it has already been worked out
+        size_t  index   = (size_t) stateId * (size_t) m_Lexer.m_NumSets + (size_t) symbolSet;
+        int     cached  = m_Transitions[index];
+        if (cached != c_Unknown) return cached;
+        
+        // Find the NDFA states reached by this symbol
+        m_Moves.clear();
+        
+        const vector<int>& nfaStates = m_States[stateId].nfaStates;
+        for (vector<int>::const_iterator stateIt = nfaStates.begin(); stateIt != nfaStates.end(); ++stateIt) {
+            const state& thisState = m_Lexer.m_Ndfa->get_state(*stateIt);
+            
+            for (state::iterator transit = thisState.begin(); transit != thisState.end(); ++transit) {
+                if (transit->symbol_set() == symbolSet) {
+                    m_Moves.push_back(transit->new_state());
+                }
+            }
+        }
+        
+        // Find the state that they make up
+        int target = -1;
+        
+        if (!m_Moves.empty()) {
+            close(m_Moves, m_Target);
+            
+            int resets  = m_Resets;
+            target      = find_or_add(m_Target);
+            
+            // Nothing to record if the source state was discarded to make room for the target
+            if (resets != m_Resets) return target;
+        }
+        
+        m_Transitions[index] = target;
+        return target;
+    }
+    
+    /// \brief The symbol accepted by the specified state (-1 if it is not an accepting state)
+    inline int accept(int stateId) const {
+        return m_States[stateId].accept;
+    }
+};
+
+///
+/// \brief A lexeme stream that runs a lazy DFA
+///
+class lazy_dfa_lexer::lazy_stream : public lexeme_stream {
+private:
+    /// \brief The states that this stream has reached
+    state_cache m_Cache;
+    
+    /// \brief The stream that this will read symbols from
+    lexer_symbol_stream* m_Stream;
+    
+    /// \brief The position tracker
+    position_tracker m_Position;
+    
+    /// \brief Number of symbols requested from the symbol stream each time the buffer needs to be refilled
+    static const int c_ReadBlockSize = 256;
+    
+    /// \brief Buffer of symbols waiting to be processed by this stream (see dfa_lexer_base::dfa_stream)
+    vector<int> m_Buffer;
+    
+    /// \brief Index of the first symbol in the buffer that is waiting to be processed
+    size_t m_BufferStart;
+    
+    /// \brief Index after the last symbol in the buffer that is waiting to be processed
+    size_t m_BufferEnd;
+    
+    /// \brief NULL, or the next symbol to read if the stream supplied a stable buffer
+    const int* m_StableNext;
+    
+    /// \brief NULL, or the end of the stable buffer
+    const int* m_StableEnd;
+    
+    /// \brief The mode to start in before retrieving the next lexeme
+    int m_InitialState;
+    
+    /// \brief The lexer mode, which is the initial state used after each lexeme
+    int m_Mode;
+    
+    /// \brief NULL, or an array indicating which symbols should be skipped rather than returned as lexemes
+    const bool* m_Skip;
+    
+    /// \brief The number of entries in m_Skip
+    int m_NumSkip;
+    
+    /// \brief True if lexemes matching the specified symbol should be skipped
+    inline bool is_skipped(int symbol) const {
+        return m_Skip && symbol >= 0 && symbol < m_NumSkip && m_Skip[symbol];
+    }
+    
+    /// \brief Runs the state machine from the specified state over the symbols from pos to end
+    ///
+    /// This behaves in the same way as dfa_table_runner::run
+    inline int run(int stateId, const int*& pos, const int* end, int& acceptSymbol, const int*& acceptPos) {
+        const int* next = pos;
+        
+        while (stateId >= 0 && next != end) {
+            stateId = m_Cache.next(stateId, *next);
+            ++next;
+            
+            if (stateId < 0) break;
+            
+            int accept = m_Cache.accept(stateId);
+            if (accept >= 0) {
+                acceptPos       = next;
+                acceptSymbol    = accept;
+            }
+        }
+        
+        pos = next;
+        return stateId;
+    }
+    
+    /// \brief Reads the next block of symbols from the stream into the buffer
+    ///
+    /// Returns false if there are no more symbols to read
+    bool fill_buffer() {
+        // Make space for the next block if the buffer is full
+        if (m_Buffer.size() - m_BufferEnd < (size_t) c_ReadBlockSize) {
+            size_t waiting = m_BufferEnd - m_BufferStart;
+            
+            if (m_BufferStart > 0) {
+                // Move the symbols that are still waiting to the start of the buffer
+                copy(m_Buffer.begin() + m_BufferStart, m_Buffer.begin() + m_BufferEnd, m_Buffer.begin());
+                m_BufferStart   = 0;
+                m_BufferEnd     = waiting;
+            }
+            
+            if (m_Buffer.size() - m_BufferEnd < (size_t) c_ReadBlockSize) {
+                // The lookahead for the current lexeme fills the buffer: make it bigger
+                m_Buffer.resize(m_Buffer.size() * 2);
+            }
+        }
+        
+        // Read the next block
+        size_t numRead = m_Stream->read(&m_Buffer[m_BufferEnd], c_ReadBlockSize);
+        m_BufferEnd += numRead;
+        
+        return numRead > 0;
+    }
+    
+    /// \brief Reads the next lexeme directly from the stable buffer
+    void read_stable(lexeme*& result) {
+        for (;;) {
+            // Nothing to do if we've reached the end of the buffer
+            const int* start = m_StableNext;
+            if (start == m_StableEnd) {
+                result = NULL;
+                return;
+            }
+            
+            // Find the longest match for the next lexeme
+            int         acceptSymbol    = -1;
+            const int*  acceptPos       = NULL;
+            const int*  pos             = start;
+            
+            run(m_Cache.initial(m_InitialState), pos, m_StableEnd, acceptSymbol, acceptPos);
+            
+            // Always reject at least one symbol
+            if (acceptPos == NULL) acceptPos = start + 1;
+            
+            // Create a lexeme that refers to the buffer, unless this symbol is being skipped
+            bool skipped = is_skipped(acceptSymbol);
+            if (!skipped) {
+                result = new lexeme(start, acceptPos - start, m_Position.current_position(), acceptSymbol);
+            }
+            
+            // Update the state and position
+            m_InitialState = m_Mode;
+            m_Position.update_position(start, acceptPos);
+            m_StableNext = acceptPos;
+            
+            if (!skipped) return;
+        }
+    }
+    
+    /// \brief Reads the next lexeme from the buffer, refilling it from the stream as needed
+    void read_buffered(lexeme*& result) {
+        for (;;) {
+            int     stateId         = m_Cache.initial(m_InitialState);
+            size_t  pos             = m_BufferStart;
+            int     acceptSymbol    = -1;
+            size_t  acceptPos       = 0;
+            
+            for (;;) {
+                // Refill the buffer in blocks if we've run out of symbols
+                if (pos == m_BufferEnd) {
+                    // fill_buffer() may move the symbols in the buffer
+                    size_t offset       = pos - m_BufferStart;
+                    size_t acceptOffset = acceptPos - m_BufferStart;
+                    
+                    bool moreSymbols    = fill_buffer();
+                    
+                    pos                 = m_BufferStart + offset;
+                    if (acceptPos != 0) acceptPos = m_BufferStart + acceptOffset;
+                    
+                    // Stop once we reach the end of the input
+                    if (!moreSymbols) break;
+                }
+                
+                // Run the state machine over the symbols that are available in the buffer
+                const int*  symbols     = &m_Buffer[0];
+                const int*  next        = symbols + pos;
+                const int*  lastAccept  = acceptPos != 0 ? symbols + acceptPos : NULL;
+                
+                stateId = run(stateId, next, symbols + m_BufferEnd, acceptSymbol, lastAccept);
+                
+                pos = next - symbols;
+                if (lastAccept) acceptPos = lastAccept - symbols;
+                
+                if (stateId < 0) break;
+            }
+            
+            // If the buffer is empty, then the result is always NULL
+            if (m_BufferStart == m_BufferEnd) {
+                result = NULL;
+                return;
+            }
+            
+            // If nothing was accepted, then reject at least one symbol
+            if (acceptPos == 0) acceptPos = m_BufferStart + 1;
+            
+            // Create the lexeme for this item, unless this symbol is being skipped
+            bool skipped = is_skipped(acceptSymbol);
+            if (!skipped) {
+                result = new lexeme(m_Buffer.begin() + m_BufferStart, m_Buffer.begin() + acceptPos, m_Position.current_position(), acceptSymbol, acceptPos - m_BufferStart);
+            }
+            
+            // Update the state and the position, and consume the accepted symbols
+            m_InitialState = m_Mode;
+            m_Position.update_position(&m_Buffer[m_BufferStart], &m_Buffer[0] + acceptPos);
+            
+            m_BufferStart = acceptPos;
+            if (m_BufferStart == m_BufferEnd) {
+                m_BufferStart = m_BufferEnd = 0;
+            }
+            
+            if (!skipped) return;
+        }
+    }
+    
+public:
+    /// \brief Creates a stream for the specified lexer, which carries on from a checkpoint
+    lazy_stream(const lazy_dfa_lexer& lexer, lexer_symbol_stream* stream, const lexer_checkpoint& checkpoint)
+    : m_Cache(lexer)
+    , m_Stream(stream)
+    , m_Position(checkpoint.pos(), checkpoint.seen_return())
+    , m_BufferStart(0)
+    , m_BufferEnd(0)
+    , m_StableNext(NULL)
+    , m_StableEnd(NULL)
+    , m_InitialState(checkpoint.initial_state())
+    , m_Mode(checkpoint.mode())
+    , m_Skip(NULL)
+    , m_NumSkip(0) {
+        // Read directly from the stream's buffer if it has one
+        if (!m_Stream->stable_buffer(m_StableNext, m_StableEnd)) {
+            m_StableNext    = NULL;
+            m_StableEnd     = NULL;
+            
+            m_Buffer.resize(c_ReadBlockSize * 4);
+        }
+    }
+    
+    /// \brief Destructor
+    virtual ~lazy_stream() {
+        delete m_Stream;
+    }
+    
+    /// \brief Retrieves a checkpoint describing the state of this stream before the next lexeme
+    virtual bool checkpoint(lexer_checkpoint& result) const {
+        result = lexer_checkpoint(m_Position.current_position(), m_InitialState, m_Position.seen_return(), m_Mode);
+        return true;
+    }
+    
+    /// \brief Sets the mode to start in for the next lexeme
+    virtual void set_initial_state(int initialState) {
+        m_InitialState = initialState;
+    }
+    
+    /// \brief Skips over any lexeme whose symbol has a true entry in the specified array
+    virtual bool skip_symbols(const bool* skip, int numSymbols) {
+        m_Skip      = skip;
+        m_NumSkip   = skip ? numSymbols : 0;
+        return true;
+    }
+    
+    /// \brief Switches this stream into a different lexer mode
+    virtual bool set_mode(int mode) {
+        m_Mode          = mode;
+        m_InitialState  = mode;
+        return true;
+    }
+    
+    /// \brief Fills in the contents of the specified pointer with the next lexeme (or NULL if the end of input has been reached)
+    virtual lexeme_stream& operator>>(lexeme*& result) {
+        if (m_StableNext) {
+            read_stable(result);
+        } else {
+            read_buffered(result);
+        }
+        
+        return *this;
+    }
+};
+
+/// \brief Creates a lexer that runs over the specified NDFA, starting in NDFA state 0
+lazy_dfa_lexer::lazy_dfa_lexer(ndfa* nfa, size_t maxCacheSize)
+: m_Ndfa(nfa)
+, m_Translator(nfa->symbols())
+, m_InitialStates(1, 0)
+, m_MaxCacheSize(maxCacheSize) {
+    prepare();
+}
+
+/// \brief Creates a lexer that runs over the specified NDFA, with a mode for each of the specified states
+lazy_dfa_lexer::lazy_dfa_lexer(ndfa* nfa, const vector<int>& initialStates, size_t maxCacheSize)
+: m_Ndfa(nfa)
+, m_Translator(nfa->symbols())
+, m_InitialStates(initialStates)
+, m_MaxCacheSize(maxCacheSize) {
+    prepare();
+}
+
+/// \brief Destructor
+lazy_dfa_lexer::~lazy_dfa_lexer() {
+    delete m_Ndfa;
+}
+
+/// \brief Works out the epsilon closures and symbol sets for the NDFA
+void lazy_dfa_lexer::prepare() {
+    m_NumSets   = m_Ndfa->symbols().count_sets();
+    m_Epsilon   = m_Ndfa->symbols().find_identifier_for_symbols(epsilon());
+    
+    // Work out the closure of each state
+    int             numStates = m_Ndfa->count_states();
+    vector<int>     inClosure(numStates, -1);
+    vector<int>     waiting;
+    
+    m_Closure.resize(numStates);
+    
+    for (int stateId = 0; stateId < numStates; ++stateId) {
+        vector<int>& closure = m_Closure[stateId];
+        
+        inClosure[stateId] = stateId;
+        waiting.push_back(stateId);
+        
+        while (!waiting.empty()) {
+            int nextState = waiting.back();
+            waiting.pop_back();
+            closure.push_back(nextState);
+            
+            if (m_Epsilon < 0) continue;
+            
+            const state& thisState = m_Ndfa->get_state(nextState);
+            for (state::iterator transit = thisState.begin(); transit != thisState.end(); ++transit) {
+                if (transit->symbol_set() != m_Epsilon)             continue;
+                if (inClosure[transit->new_state()] == stateId)     continue;
+                
+                inClosure[transit->new_state()] = stateId;
+                waiting.push_back(transit->new_state());
+            }
+        }
+        
+        sort(closure.begin(), closure.end());
+    }
+    
+    // Ignore any modes that don't refer to a state in the NDFA
+    for (vector<int>::iterator initial = m_InitialStates.begin(); initial != m_InitialStates.end(); ++initial) {
+        if (*initial < 0 || *initial >= numStates) *initial = -1;
+    }
+}
+
+/// \brief Creates a new lexer to process the specified symbol stream
+lexeme_stream* lazy_dfa_lexer::create_stream(lexer_symbol_stream* stream) const {
+    if (!stream) return NULL;
+    return new lazy_stream(*this, stream, lexer_checkpoint());
+}
+
+/// \brief Creates a new lexer that carries on from a checkpoint taken from a stream reading the same buffer
+lexeme_stream* lazy_dfa_lexer::create_stream_from_checkpoint(const int* begin, const int* end, const lexer_checkpoint& checkpoint) const {
+    return new lazy_stream(*this, new buffer_symbol_stream(begin + checkpoint.offset(), end), checkpoint);
+}
+
+/// \brief Estimated size in bytes of this lexer (not counting the state caches, which are bounded by the cache size)
+size_t lazy_dfa_lexer::size() const {
+    size_t result = sizeof(*this) + m_Translator.size();
+    
+    for (vector<vector<int> >::const_iterator closure = m_Closure.begin(); closure != m_Closure.end(); ++closure) {
+        result += closure->size() * sizeof(int);
+    }
+    
+    return result;
+}
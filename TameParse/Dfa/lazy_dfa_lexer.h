@@ -0,0 +1,118 @@
+//
+//  lazy_dfa_lexer.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _DFA_LAZY_DFA_LEXER_H
+#define _DFA_LAZY_DFA_LEXER_H
+
+#include <vector>
+
+#include "TameParse/Dfa/ndfa.h"
+#include "TameParse/Dfa/basic_lexer.h"
+#include "TameParse/Dfa/symbol_translator.h"
+
+namespace dfa {
+    ///
+    /// \brief Lexer that builds the states of its DFA from an NDFA while it is lexing, instead of all in advance
+    ///
+    /// Converting an NDFA with large character classes into a DFA can produce far more states than a particular input
+    /// will ever reach. This lexer runs over the NDFA directly: each DFA state is worked out the first time a stream
+    /// reaches it, and kept in a cache belonging to that stream. When the cache grows larger than its limit, it is
+    /// emptied and the states are rebuilt as the input needs them again, so the memory used is bounded and the cost
+    /// of building the DFA is proportional to the input that is actually lexed.
+    ///
+    /// The states reached by a stream (and hence the lexemes it produces) are the same as those of the DFA built by
+    /// ndfa::to_dfa, with state n in that DFA corresponding to mode n here.
+    ///
+    class lazy_dfa_lexer : public basic_lexer {
+    public:
+        /// \brief The default limit on the number of bytes in the state cache for each stream
+        static const size_t c_DefaultCacheSize = 1024*1024;
+        
+    private:
+        class state_cache;
+        class lazy_stream;
+        
+        /// \brief The NDFA that this lexer runs over (which has unique symbols)
+        const ndfa* m_Ndfa;
+        
+        /// \brief Maps input symbols to the symbol sets used by the NDFA
+        symbol_translator<int> m_Translator;
+        
+        /// \brief The number of symbol sets in the NDFA
+        int m_NumSets;
+        
+        /// \brief The symbol set used for epsilon transitions (or -1 if there are none)
+        int m_Epsilon;
+        
+        /// \brief The NDFA states for each lexer mode
+        std::vector<int> m_InitialStates;
+        
+        /// \brief The sorted epsilon closure of each state in the NDFA
+        std::vector<std::vector<int> > m_Closure;
+        
+        /// \brief The maximum number of bytes in the state cache for each stream
+        size_t m_MaxCacheSize;
+        
+        /// \brief Disabled copy constructor
+        lazy_dfa_lexer(const lazy_dfa_lexer& copyFrom);
+        
+        /// \brief Disabled assignment
+        lazy_dfa_lexer& operator=(const lazy_dfa_lexer& assignFrom);
+        
+    public:
+        /// \brief Creates a lexer that runs over the specified NDFA, starting in NDFA state 0
+        ///
+        /// The NDFA must have been created by to_ndfa_with_unique_symbols(), and is destroyed along with this lexer.
+        explicit lazy_dfa_lexer(ndfa* nfa, size_t maxCacheSize = c_DefaultCacheSize);
+        
+        /// \brief Creates a lexer that runs over the specified NDFA, with a mode for each of the specified states
+        ///
+        /// The NDFA must have been created by to_ndfa_with_unique_symbols(), and is destroyed along with this lexer.
+        lazy_dfa_lexer(ndfa* nfa, const std::vector<int>& initialStates, size_t maxCacheSize = c_DefaultCacheSize);
+        
+        /// \brief Destructor
+        virtual ~lazy_dfa_lexer();
+        
+    private:
+        /// \brief Works out the epsilon closures and symbol sets for the NDFA
+        void prepare();
+        
+    public:
+        /// \brief Creates a new lexer to process the specified symbol stream
+        virtual lexeme_stream* create_stream(lexer_symbol_stream* stream) const;
+        
+        /// \brief Creates a new lexer that carries on from a checkpoint taken from a stream reading the same buffer
+        virtual lexeme_stream* create_stream_from_checkpoint(const int* begin, const int* end, const lexer_checkpoint& checkpoint) const;
+        
+        /// \brief Estimated size in bytes of this lexer (not counting the state caches, which are bounded by the cache size)
+        virtual size_t size() const;
+        
+        /// \brief The maximum number of bytes in the state cache for each stream
+        inline size_t max_cache_size() const { return m_MaxCacheSize; }
+    };
+}
+
+#endif
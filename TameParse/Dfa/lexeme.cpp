@@ -25,28 +25,222 @@
 //  IN THE SOFTWARE.
 //
 
+#include <new>
+#include <vector>
+
 #include "TameParse/Dfa/lexeme.h"
+#include "TameParse/Util/constexpr.h"
+#include "TameParse/Util/memory_resource.h"
+#include "TameParse/Util/parallel.h"
 
+using namespace util;
 using namespace dfa;
 
+namespace {
+    /// \brief Size of the header before each lexeme, which records the resource it was allocated from
+    ///
+    /// The header is NULL for lexemes allocated from the heap (which can go on the free list)
+    static const size_t c_HeaderSize = (sizeof(memory_resource*) + arena::c_Alignment - 1) & ~(arena::c_Alignment - 1);
+    
+    /// \brief Size of a block of memory for a lexeme, including its header
+    static const size_t c_BlockSize = c_HeaderSize + sizeof(lexeme);
+    
+    ///
+    /// \brief Free list of lexeme objects for a single thread
+    ///
+    /// Lexemes are not shared between threads, so each thread keeps its own list and no locking is needed. A lexeme
+    /// that is freed on a different thread from the one that allocated it just ends up on that thread's list.
+    ///
+    class lexeme_pool {
+    private:
+        /// \brief A lexeme on the free list
+        struct free_lexeme {
+            free_lexeme* next;
+        };
+        
+        /// \brief The most lexemes that are kept on the free list (the rest are returned to the heap)
+        static const size_t c_MaxFree = 1024;
+        
+        /// \brief The first lexeme on the free list
+        free_lexeme* m_First;
+        
+        /// \brief The number of lexemes on the free list
+        size_t m_Count;
+        
+        /// \brief True once the pool has been destroyed (lexemes freed after that go straight back to the heap)
+        bool m_Destroyed;
+        
+    public:
+        /// \brief Creates an empty pool
+        TAMEPARSE_CONSTEXPR lexeme_pool()
+        : m_First(NULL)
+        , m_Count(0)
+        , m_Destroyed(false) {
+        }
+        
+        /// \brief Returns the free lexemes to the heap
+        ~lexeme_pool() {
+            m_Destroyed = true;
+            
+            while (m_First) {
+                free_lexeme* next = m_First->next;
+                ::operator delete(m_First);
+                m_First = next;
+            }
+            m_Count = 0;
+        }
+        
+        /// \brief Allocates memory for a lexeme and its header
+        inline void* allocate() {
+            if (!m_First) return ::operator new(c_BlockSize);
+            
+            free_lexeme* result = m_First;
+            m_First = result->next;
+            --m_Count;
+            
+            return result;
+        }
+        
+        /// \brief Frees memory allocated for a lexeme and its header
+        inline void free(void* mem) {
+            if (m_Destroyed || m_Count >= c_MaxFree) {
+                ::operator delete(mem);
+                return;
+            }
+            
+            free_lexeme* freed = static_cast<free_lexeme*>(mem);
+            freed->next = m_First;
+            m_First     = freed;
+            ++m_Count;
+        }
+    };
+    
+    /// \brief The lexemes freed on this thread
+    static TAMEPARSE_THREAD_LOCAL lexeme_pool s_FreeLexemes;
+}
+
+/// \brief Allocates a lexeme, re-using one that was freed on this thread if possible
+void* lexeme::operator new(size_t size) {
+    memory_resource*    resource = NULL;
+    char*               block;
+    
+    if (memory_resource::current_is_heap()) {
+        // Lexemes from the heap come from the free list if they're the right size
+        if (size == sizeof(lexeme)) {
+            block = static_cast<char*>(s_FreeLexemes.allocate());
+        } else {
+            block = static_cast<char*>(::operator new(c_HeaderSize + size));
+        }
+    } else {
+        // Other resources supply the memory themselves
+        resource    = memory_resource::current();
+        block       = static_cast<char*>(resource->allocate(c_HeaderSize + size));
+    }
+    
+    *reinterpret_cast<memory_resource**>(block) = resource;
+    return block + c_HeaderSize;
+}
+
+/// \brief Frees a lexeme, keeping it on the free list for this thread if it isn't already full
+void lexeme::operator delete(void* mem, size_t size) {
+    if (!mem) return;
+    
+    char*               block       = static_cast<char*>(mem) - c_HeaderSize;
+    memory_resource*    resource    = *reinterpret_cast<memory_resource**>(block);
+    
+    if (resource) {
+        resource->deallocate(block, c_HeaderSize + size);
+    } else if (size != sizeof(lexeme)) {
+        ::operator delete(block);
+    } else {
+        s_FreeLexemes.free(block);
+    }
+}
+
 /// \brief Creates a nonsensical empty lexeme
 lexeme::lexeme()
-: m_Matched(-1) {
+: m_View(NULL)
+, m_ViewLength(0)
+, m_Original((lexeme*) NULL)
+, m_Matched(-1)
+, m_InternedId(-1) {
     
 }
 
 /// \brief Copy constructor
 lexeme::lexeme(const lexeme& copyFrom) 
 : m_Position(copyFrom.m_Position) 
-, m_Symbols(copyFrom.m_Symbols)
-, m_Matched(copyFrom.m_Matched) {
+, m_Symbols(copyFrom.m_View ? symbols() : copyFrom.m_Symbols)
+, m_View(copyFrom.m_View)
+, m_ViewLength(copyFrom.m_ViewLength)
+, m_Original(copyFrom.m_Original)
+, m_Matched(copyFrom.m_Matched)
+, m_InternedId(copyFrom.m_InternedId) {
+    if (copyFrom.is_inline()) {
+        store_inline(copyFrom.m_Inline, copyFrom.m_ViewLength);
+    }
 }
 
 /// \brief Creates a new lexeme
 lexeme::lexeme(const symbols& syms, const position& pos, int matched) 
 : m_Position(pos)
-, m_Symbols(syms)
-, m_Matched(matched) {
+, m_View(NULL)
+, m_ViewLength(0)
+, m_Original((lexeme*) NULL)
+, m_Matched(matched)
+, m_InternedId(-1) {
+    if (syms.size() <= c_InlineSymbols) {
+        store_inline(syms.data(), syms.size());
+    } else {
+        m_Symbols = syms;
+    }
+}
+
+/// \brief Creates a new lexeme that refers to symbols stored in an external buffer
+lexeme::lexeme(const int* view, size_t length, const position& pos, int matched)
+: m_Position(pos)
+, m_View(view)
+, m_ViewLength(length)
+, m_Original((lexeme*) NULL)
+, m_Matched(matched)
+, m_InternedId(-1) {
+}
+
+/// \brief Refers to the symbols of the specified lexeme rather than storing a copy
+void lexeme::share_symbols(const util::intrusive_container<lexeme>& original) {
+    m_View          = original->begin();
+    m_ViewLength    = original->length();
+    
+    // Short lexemes are copied, and symbols in an external buffer don't need the original lexeme to keep them alive
+    if (original->is_inline()) {
+        store_inline(original->m_Inline, original->m_ViewLength);
+    } else if (original->m_Original.item()) {
+        m_Original = original->m_Original;
+    } else if (!original->m_View) {
+        m_Original = original;
+    }
+}
+
+/// \brief Creates a lexeme with the same symbols and position as another one, but which matches a different symbol
+lexeme::lexeme(const util::intrusive_container<lexeme>& original, int matched)
+: m_Position(original->m_Position)
+, m_View(NULL)
+, m_ViewLength(0)
+, m_Original((lexeme*) NULL)
+, m_Matched(matched)
+, m_InternedId(original->m_InternedId) {
+    share_symbols(original);
+}
+
+/// \brief Creates a lexeme at the specified position that shares the symbols of an interned lexeme
+lexeme::lexeme(const util::intrusive_container<lexeme>& interned, const position& pos, int matched, int internedId)
+: m_Position(pos)
+, m_View(NULL)
+, m_ViewLength(0)
+, m_Original((lexeme*) NULL)
+, m_Matched(matched)
+, m_InternedId(internedId) {
+    share_symbols(interned);
 }
 
 /// \brief Destructor
@@ -58,13 +252,25 @@ lexeme* lexeme::clone() const {
     return new lexeme(*this);
 }
 
+/// \brief The number of bytes used by this lexeme
+size_t lexeme::memory_usage() const {
+    size_t total = sizeof(*this);
+    
+    // Long lexemes (and views whose content has been requested) keep their symbols in a string
+    if (!m_Symbols.empty()) {
+        total += (m_Symbols.capacity() + 1) * sizeof(int);
+    }
+    
+    return total;
+}
+
 /// \brief The final position of this lexeme
 ///
 /// Note that the line count will be off by 1 if the symbol preceeding this lexeme is a carriage return
 position lexeme::final_pos() const {
     // Use a position tracker to calculate the final position
     position_tracker tracker(m_Position);
-    tracker.update_position(m_Symbols.begin(), m_Symbols.end());
+    tracker.update_position(begin(), end());
 
     return tracker.current_position();
 }
@@ -74,10 +280,49 @@ bool lexeme::operator<(const lexeme& compareTo) const {
     if (m_Matched < compareTo.m_Matched) return true;
     if (m_Matched > compareTo.m_Matched) return false;
     
-    if (m_Symbols < compareTo.m_Symbols) return true;
-    if (m_Symbols > compareTo.m_Symbols) return false;
+    if (std::lexicographical_compare(begin(), end(), compareTo.begin(), compareTo.end())) return true;
+    if (std::lexicographical_compare(compareTo.begin(), compareTo.end(), begin(), end())) return false;
     
     if (m_Position < compareTo.m_Position) return true;
     
     return false;
 }
+
+/// \brief Identifies lexemes written by write() (the last byte is the version of the format)
+///
+/// Version 2 stores positions as 64-bit values: lexemes written with version 1 can't be read back.
+static const int c_LexemeFormat = 0x544c5802;
+
+/// \brief Writes the symbol, position and content of this lexeme to a binary stream
+void lexeme::write(std::ostream& target) const {
+    int             header[3]   = { c_LexemeFormat, m_Matched, (int) length() };
+    stream_offset   where[3]    = { m_Position.offset(), m_Position.line(), m_Position.column() };
+    
+    target.write((const char*) header, sizeof(header));
+    target.write((const char*) where, sizeof(where));
+    if (length() > 0) {
+        target.write((const char*) begin(), length() * sizeof(int));
+    }
+}
+
+/// \brief Reads a lexeme that was written by write(), returning NULL if the stream is invalid
+lexeme* lexeme::read(std::istream& source) {
+    int             header[3];
+    stream_offset   where[3];
+    
+    // Lexemes written in a different format would be misread, so reject them before reading the position
+    source.read((char*) header, sizeof(header));
+    if (!source.good() || header[0] != c_LexemeFormat || header[2] < 0) return NULL;
+    
+    source.read((char*) where, sizeof(where));
+    if (!source.good()) return NULL;
+    
+    // Read the symbols into a buffer, then create a lexeme that stores them in the usual way
+    std::vector<int> syms((size_t) header[2]);
+    if (!syms.empty()) {
+        source.read((char*) &syms[0], syms.size() * sizeof(int));
+        if (source.fail()) return NULL;
+    }
+    
+    return new lexeme(syms.begin(), syms.end(), position(where[0], where[1], where[2]), header[1], syms.size());
+}
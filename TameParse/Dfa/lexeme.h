@@ -29,32 +29,78 @@
 #define _DFA_LEXEME_H
 
 #include <string>
+#include <algorithm>
+#include <iostream>
 
 #include "TameParse/Util/container.h"
+#include "TameParse/Util/refcounted.h"
 #include "TameParse/Dfa/position.h"
 
 namespace dfa {
     ///
     /// \brief Representation of a lexeme (a symbol accepted by a lexer)
     ///
-    class lexeme {
+    ///
+    /// Short lexemes are stored in the object itself rather than in a separate string, and lexeme objects that are
+    /// released are kept on a free list for each thread (see operator new), so most lexemes don't need to allocate any
+    /// memory at all.
+    ///
+    class lexeme : public util::refcounted {
     public:
         /// \brief Type representing the symbols in a lexeme (we use an integer string as the basic symbol type of our lexer is int)
         typedef std::basic_string<int> symbols;
         
+        /// \brief Iterator that can be used to read the symbols in a lexeme without converting them to a string
+        typedef const int* symbol_iterator;
+        
+        /// \brief The longest lexeme that is stored in the object itself rather than in a string
+        static const size_t c_InlineSymbols = 8;
+        
     private:
         /// \brief The position that this lexeme was at in the source file
         position m_Position;
         
         /// \brief The symbols that make up this lexeme
-        symbols m_Symbols;
+        ///
+        /// For lexemes that refer to an external buffer, this is left empty until content() is called
+        mutable symbols m_Symbols;
+        
+        /// \brief NULL, or the location of the symbols for this lexeme in a buffer owned by something else
+        ///
+        /// Short lexemes point this at m_Inline
+        const int* m_View;
+        
+        /// \brief The number of symbols in m_View
+        size_t m_ViewLength;
+        
+        /// \brief The symbols of lexemes that are short enough to be stored without a separate allocation
+        int m_Inline[c_InlineSymbols];
+        
+        /// \brief For retagged lexemes that refer to the symbols stored in another lexeme, the lexeme that owns them
+        util::intrusive_container<lexeme> m_Original;
         
         /// \brief The symbol ID that was matched by this lexeme
         int m_Matched;
         
+        /// \brief The ID of the interned string with the same symbols as this lexeme, or -1 (see lexeme_interner)
+        int m_InternedId;
+        
         /// \brief Disabled assignment
         lexeme& operator=(const lexeme& assignFrom);
         
+        /// \brief True if the symbols for this lexeme are stored in m_Inline
+        inline bool is_inline() const { return m_View == m_Inline; }
+        
+        /// \brief Refers to the symbols of the specified lexeme rather than storing a copy
+        void share_symbols(const util::intrusive_container<lexeme>& original);
+        
+        /// \brief Stores the specified symbols in m_Inline (there must be no more than c_InlineSymbols of them)
+        inline void store_inline(const int* syms, size_t length) {
+            std::copy(syms, syms + length, m_Inline);
+            m_View          = m_Inline;
+            m_ViewLength    = length;
+        }
+        
     public:
         /// \brief Creates a nonsensical empty lexeme
         lexeme();
@@ -65,29 +111,90 @@ namespace dfa {
         /// \brief Creates a new lexeme
         lexeme(const symbols& syms, const position& pos, int matched);
         
+        /// \brief Creates a new lexeme that refers to symbols stored in an external buffer
+        ///
+        /// The symbols are not copied: the buffer must remain valid and unchanged for as long as this lexeme (or any
+        /// clone of it) exists. The symbols are only copied into a string if the content() call is made.
+        lexeme(const int* view, size_t length, const position& pos, int matched);
+        
+        /// \brief Creates a lexeme with the same symbols and position as another one, but which matches a different symbol
+        ///
+        /// The symbols are not copied: the new lexeme refers to the same symbols as the original, and keeps a reference
+        /// to the original if it is the one that stores them. The parser uses this to substitute a strong symbol for a
+        /// weak one.
+        lexeme(const util::intrusive_container<lexeme>& original, int matched);
+        
+        /// \brief Creates a lexeme at the specified position that shares the symbols of an interned lexeme
+        ///
+        /// This is used by lexeme_interner: the new lexeme has the same symbols and interned ID as the interned one, and
+        /// keeps a reference to it if it is the one that stores the symbols.
+        lexeme(const util::intrusive_container<lexeme>& interned, const position& pos, int matched, int internedId);
+        
         /// \brief Creates a new lexeme from a sequence of symbols
         template<typename iterator_type> lexeme(iterator_type begin, iterator_type end, const position& pos, int matched, size_t length = 0)
         : m_Position(pos)
+        , m_Symbols()
+        , m_View(NULL)
+        , m_ViewLength(0)
+        , m_Original((lexeme*) NULL)
         , m_Matched(matched)
-        , m_Symbols() {
-            // Reserve space for the symbols if we can
-            if (length != 0) m_Symbols.reserve(length);
+        , m_InternedId(-1) {
+            size_t count = 0;
             
-            // Store the symbols in turn
+            // Store the symbols in turn, moving them to a string if there are too many to store inline
             for (iterator_type symbol=begin; symbol != end; ++symbol) {
+                if (count < c_InlineSymbols) {
+                    m_Inline[count++] = (int)*symbol;
+                    continue;
+                }
+                
+                if (m_Symbols.empty()) {
+                    // Reserve space for the symbols if we can
+                    if (length != 0) m_Symbols.reserve(length);
+                    m_Symbols.assign(m_Inline, m_Inline + count);
+                }
+                
                 m_Symbols += (int)*symbol;
             }
+            
+            if (m_Symbols.empty()) {
+                m_View          = m_Inline;
+                m_ViewLength    = count;
+            }
         }
         
         /// \brief Destructor
         virtual ~lexeme();
         
+        /// \brief Allocates a lexeme, re-using one that was freed on this thread if possible
+        ///
+        /// Parsers create and release a lexeme for every token, so this saves a trip to the heap for most of them.
+        /// Subclasses that are a different size to lexeme are allocated in the usual way. If the current
+        /// util::memory_resource for this thread isn't the heap, the lexeme is allocated from that instead.
+        static void* operator new(size_t size);
+        
+        /// \brief Frees a lexeme, keeping it on the free list for this thread if it isn't already full
+        static void operator delete(void* mem, size_t size);
+        
         /// \brief Clone operator (so subclasses can store extra data if they need to)
         virtual lexeme* clone() const;
         
+        /// \brief The number of bytes used by this lexeme
+        ///
+        /// Symbols that are stored in an external buffer or by another lexeme are not included.
+        virtual size_t memory_usage() const;
+        
         /// \brief Ordering operator
         virtual bool operator<(const lexeme& compareTo) const;
         
+        /// \brief Writes the symbol, position and content of this lexeme to a binary stream
+        ///
+        /// The lexeme is written in the native byte order, so it should be read back on the same kind of machine.
+        void write(std::ostream& target) const;
+        
+        /// \brief Reads a lexeme that was written by write(), returning NULL if the stream is invalid
+        static lexeme* read(std::istream& source);
+        
         /// \brief Returns true if lexeme a is less than lexeme b
         inline static bool compare(const lexeme* a, const lexeme* b) {
             if (a == b) return false;
@@ -101,8 +208,34 @@ namespace dfa {
         /// \brief The ID of the symbol that was matched
         inline int matched() const { return m_Matched; }
         
+        /// \brief The ID of the interned string with the same symbols as this lexeme, or -1 if it was not interned
+        ///
+        /// Lexemes interned by the same lexeme_interner have the same ID if and only if they have the same symbols, so
+        /// this can be used to compare them without comparing their content.
+        inline int interned_id() const { return m_InternedId; }
+        
         /// \brief The content that makes up this lexeme
-        inline const symbols& content() const { return m_Symbols; }
+        ///
+        /// For lexemes that refer to an external buffer, this will copy the symbols the first time it is called. Use
+        /// begin() and end() or the templated version of content() to avoid the copy.
+        inline const symbols& content() const { 
+            if (m_View && m_Symbols.size() != m_ViewLength) {
+                m_Symbols.assign(m_View, m_View + m_ViewLength);
+            }
+            return m_Symbols; 
+        }
+        
+        /// \brief The number of symbols in this lexeme
+        inline size_t length() const { return m_View ? m_ViewLength : m_Symbols.size(); }
+        
+        /// \brief True if this lexeme refers to symbols in an external buffer rather than storing its own copy
+        inline bool is_view() const { return m_View != NULL && !is_inline(); }
+        
+        /// \brief The first symbol in this lexeme
+        inline symbol_iterator begin() const { return m_View ? m_View : m_Symbols.data(); }
+        
+        /// \brief The symbol after the last symbol in this lexeme
+        inline symbol_iterator end() const { return begin() + length(); }
         
         /// \brief The initial location of this lexeme
         inline const position& pos() const { return m_Position; }
@@ -118,10 +251,10 @@ namespace dfa {
         template<typename symbol_type> inline std::basic_string<symbol_type> content() const {
             // Create the result and reserve the appropriate amount of space
             std::basic_string<symbol_type> result;
-            result.reserve(m_Symbols.size());
+            result.reserve(length());
             
             // Copy the symbols across, using a simple cast operation
-            for (symbols::const_iterator symbol=m_Symbols.begin(); symbol != m_Symbols.end(); ++symbol) {
+            for (symbol_iterator symbol=begin(); symbol != end(); ++symbol) {
                 result += (symbol_type)*symbol;
             }
             
@@ -129,8 +262,8 @@ namespace dfa {
         }
     };
     
-    /// \brief Container for a lexeme
-    typedef util::container<lexeme> lexeme_container;
+    /// \brief Container for a lexeme (lexemes keep their own reference count)
+    typedef util::intrusive_container<lexeme> lexeme_container;
 }
 
 #endif
@@ -0,0 +1,76 @@
+//
+//  lexeme_interner.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include "TameParse/Dfa/lexeme_interner.h"
+
+using namespace dfa;
+
+/// \brief Creates an interner that doesn't intern any symbols
+lexeme_interner::lexeme_interner() {
+}
+
+/// \brief Interns the lexemes that match the specified terminal symbol
+void lexeme_interner::add_symbol(int symbol) {
+    if (symbol < 0) return;
+    
+    if ((size_t) symbol >= m_InternSymbol.size()) {
+        m_InternSymbol.resize((size_t) symbol + 1, false);
+    }
+    m_InternSymbol[symbol] = true;
+}
+
+/// \brief Returns the interned equivalent of the specified lexeme
+lexeme_container lexeme_interner::intern(const lexeme_container& original) {
+    if (!original.item() || !interns(original->matched())) return original;
+    
+    // Look up the content (without copying it)
+    key                 content = { original->begin(), original->length() };
+    id_map::iterator    found   = m_Ids.find(content);
+    int                 id;
+    
+    if (found != m_Ids.end()) {
+        id = found->second;
+    } else {
+        // Store a copy of the symbols for this new string (the original might refer to a buffer that won't last)
+        id = count();
+        
+        lexeme_container stored(new lexeme(original->begin(), original->end(), original->pos(), original->matched()), true);
+        m_Interned.push_back(stored);
+        
+        key storedContent = { stored->begin(), stored->length() };
+        m_Ids[storedContent] = id;
+    }
+    
+    return lexeme_container(new lexeme(m_Interned[(size_t) id], original->pos(), original->matched(), id), true);
+}
+
+/// \brief The ID of the interned string with the specified content, or -1 if nothing with that content has been interned
+int lexeme_interner::find(const int* begin, const int* end) const {
+    key                     content = { begin, (size_t) (end - begin) };
+    id_map::const_iterator  found   = m_Ids.find(content);
+    
+    if (found == m_Ids.end()) return -1;
+    return found->second;
+}
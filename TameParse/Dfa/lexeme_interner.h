@@ -0,0 +1,109 @@
+//
+//  lexeme_interner.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _DFA_LEXEME_INTERNER_H
+#define _DFA_LEXEME_INTERNER_H
+
+#include <cstdlib>
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include "TameParse/Dfa/lexeme.h"
+
+namespace dfa {
+    ///
+    /// \brief Table that maps the content of lexemes onto shared interned strings, each with a stable ID
+    ///
+    /// Identifiers tend to appear many times in the same input. Lexemes for the symbols that are added to this table
+    /// are replaced by lexemes that share the symbols of the first lexeme seen with the same content, so each distinct
+    /// identifier is only stored once. Each distinct content is also given an ID (see lexeme::interned_id()), so later
+    /// passes can compare names without comparing strings.
+    ///
+    /// A parser session can intern its lexemes as they are read (see the set_interner() call on parser states). An
+    /// interner can be shared between sessions, so IDs are consistent between the files that are parsed with it.
+    /// Interned lexemes keep the shared symbols alive, so they can outlive the interner.
+    ///
+    class lexeme_interner {
+    private:
+        /// \brief The content of an interned lexeme
+        struct key {
+            /// \brief The first symbol
+            const int* symbols;
+            
+            /// \brief The number of symbols
+            size_t length;
+        };
+        
+        /// \brief Orders keys by their content
+        class compare_keys {
+        public:
+            inline bool operator()(const key& a, const key& b) const {
+                return std::lexicographical_compare(a.symbols, a.symbols + a.length, b.symbols, b.symbols + b.length);
+            }
+        };
+        
+        /// \brief Maps content to interned IDs
+        typedef std::map<key, int, compare_keys> id_map;
+        
+        /// \brief True for each terminal symbol whose lexemes are interned
+        std::vector<bool> m_InternSymbol;
+        
+        /// \brief The ID of the interned string for each content (the keys refer to the symbols in m_Interned)
+        id_map m_Ids;
+        
+        /// \brief The lexeme that stores the symbols for each interned string, indexed by ID
+        std::vector<lexeme_container> m_Interned;
+        
+    public:
+        /// \brief Creates an interner that doesn't intern any symbols
+        lexeme_interner();
+        
+        /// \brief Interns the lexemes that match the specified terminal symbol
+        void add_symbol(int symbol);
+        
+        /// \brief True if lexemes matching the specified symbol are interned
+        inline bool interns(int symbol) const {
+            return symbol >= 0 && (size_t) symbol < m_InternSymbol.size() && m_InternSymbol[symbol];
+        }
+        
+        /// \brief Returns the interned equivalent of the specified lexeme
+        ///
+        /// The result has the same position and symbol as the original lexeme, but shares its symbols with every other
+        /// lexeme with the same content. Lexemes for symbols that aren't interned are returned unchanged.
+        lexeme_container intern(const lexeme_container& original);
+        
+        /// \brief The ID of the interned string with the specified content, or -1 if nothing with that content has been interned
+        int find(const int* begin, const int* end) const;
+        
+        /// \brief The number of distinct strings that have been interned
+        inline int count() const { return (int) m_Interned.size(); }
+        
+        /// \brief The first lexeme that was interned with the specified ID
+        inline const lexeme_container& get(int internedId) const { return m_Interned[(size_t) internedId]; }
+    };
+}
+
+#endif
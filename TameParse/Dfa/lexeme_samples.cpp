@@ -0,0 +1,200 @@
+//
+//  lexeme_samples.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include <algorithm>
+#include <deque>
+
+#include "TameParse/Dfa/lexeme_samples.h"
+
+using namespace std;
+using namespace dfa;
+
+/// \brief Returned for symbols with no samples
+const lexeme_samples::sample_list lexeme_samples::s_NoSamples;
+
+/// \brief A step in the search for samples
+struct sample_step {
+    /// \brief The state reached by this step
+    int state;
+    
+    /// \brief The index of the step before this one, or -1 for the initial state
+    int previous;
+    
+    /// \brief The symbol that leads to this state from the previous step
+    int symbol;
+    
+    sample_step(int newState, int previousStep, int viaSymbol)
+    : state(newState)
+    , previous(previousStep)
+    , symbol(viaSymbol) {
+    }
+};
+
+/// \brief Finds up to maxSamples samples for each of the symbols accepted by a DFA
+lexeme_samples::lexeme_samples(const ndfa& dfa, int maxSamples, const keyword_table* keywords, int initialState)
+: m_Dfa(&dfa)
+, m_Keywords(keywords)
+, m_InitialState(initialState) {
+    if (maxSamples <= 0 || initialState < 0 || initialState >= dfa.count_states()) return;
+    
+    // Each state is visited at most maxSamples times, which is enough to give each symbol its samples as every
+    // visit follows a different path
+    vector<int>         visits(dfa.count_states(), 0);
+    vector<sample_step> steps;
+    deque<int>          waiting;
+    
+    steps.push_back(sample_step(initialState, -1, -1));
+    waiting.push_back(0);
+    visits[initialState] = 1;
+    
+    while (!waiting.empty()) {
+        int stepId = waiting.front();
+        waiting.pop_front();
+        
+        const state& thisState = dfa.get_state(steps[stepId].state);
+        for (state::iterator transit = thisState.begin(); transit != thisState.end(); ++transit) {
+            if (visits[transit->new_state()] >= maxSamples) continue;
+            
+            int symbol = pick_symbol(dfa.symbols()[transit->symbol_set()]);
+            if (symbol < 0) continue;
+            
+            ++visits[transit->new_state()];
+            int newStep = (int) steps.size();
+            steps.push_back(sample_step(transit->new_state(), stepId, symbol));
+            waiting.push_back(newStep);
+            
+            // Nothing more to do if the new state doesn't accept anything
+            int accepted = accepted_symbol(transit->new_state());
+            if (accepted < 0) continue;
+            
+            // Build the lexeme by following the steps back to the initial state
+            sample lexeme;
+            for (int step = newStep; steps[step].previous >= 0; step = steps[step].previous) {
+                lexeme.push_back(steps[step].symbol);
+            }
+            reverse(lexeme.begin(), lexeme.end());
+            
+            // The keyword table might turn this lexeme into a different symbol
+            if (m_Keywords) {
+                accepted = m_Keywords->classify(accepted, &lexeme[0], &lexeme[0] + lexeme.size());
+            }
+            
+            sample_list& samples = m_Samples[accepted];
+            if ((int) samples.size() < maxSamples) {
+                samples.push_back(lexeme);
+            }
+        }
+    }
+    
+    // Keywords that are only in the keyword table are samples for themselves
+    if (m_Keywords) {
+        for (int slotId = 0; slotId < m_Keywords->count_slots(); ++slotId) {
+            const keyword_table::entry& slot = m_Keywords->get_slot(slotId);
+            if (slot.baseSymbol < 0) continue;
+            
+            sample_list& samples = m_Samples[slot.keywordSymbol];
+            if ((int) samples.size() < maxSamples) {
+                const int* text = m_Keywords->text() + slot.textOffset;
+                samples.push_back(sample(text, text + slot.length));
+            }
+        }
+    }
+}
+
+/// \brief The samples for the specified symbol (empty if the DFA can't produce it)
+const lexeme_samples::sample_list& lexeme_samples::samples_for_symbol(int symbol) const {
+    sample_map::const_iterator found = m_Samples.find(symbol);
+    if (found == m_Samples.end()) return s_NoSamples;
+    
+    return found->second;
+}
+
+/// \brief The symbol that the lexer would produce for a lexeme made up of the symbols from begin to end, or -1 if it isn't a single lexeme
+int lexeme_samples::symbol_for(const int* begin, const int* end) const {
+    if (begin == end || m_InitialState >= m_Dfa->count_states()) return -1;
+    
+    // Run the DFA over the symbols
+    int stateId = m_InitialState;
+    for (const int* symbol = begin; symbol != end; ++symbol) {
+        const state&    thisState   = m_Dfa->get_state(stateId);
+        int             nextState   = -1;
+        
+        for (state::iterator transit = thisState.begin(); transit != thisState.end(); ++transit) {
+            if (m_Dfa->symbols()[transit->symbol_set()][*symbol]) {
+                nextState = transit->new_state();
+                break;
+            }
+        }
+        
+        if (nextState < 0) return -1;
+        stateId = nextState;
+    }
+    
+    // The lexeme is the symbol accepted by the final state, after looking it up in the keyword table
+    int accepted = accepted_symbol(stateId);
+    if (accepted >= 0 && m_Keywords) {
+        accepted = m_Keywords->classify(accepted, begin, end);
+    }
+    
+    return accepted;
+}
+
+/// \brief Chooses a readable symbol from a set, or returns -1 if the set is empty
+int lexeme_samples::pick_symbol(const symbol_set& symbols) {
+    // The ranges to try, in order of preference
+    static const int preferred[][2] = { { 'a', 'z'+1 }, { '0', '9'+1 }, { 'A', 'Z'+1 }, { 0x21, 0x7f }, { ' ', ' '+1 }, { 0xa0, 0xd800 } };
+    static const int numPreferred   = (int) (sizeof(preferred) / sizeof(preferred[0]));
+    
+    for (int preference = 0; preference < numPreferred; ++preference) {
+        for (symbol_set::iterator range = symbols.begin(); range != symbols.end(); ++range) {
+            int lower = range->lower() > preferred[preference][0] ? range->lower() : preferred[preference][0];
+            int upper = range->upper() < preferred[preference][1] ? range->upper() : preferred[preference][1];
+            
+            if (lower < upper) return lower;
+        }
+    }
+    
+    // Use the first non-negative symbol in the set if none of the preferred ranges are present
+    for (symbol_set::iterator range = symbols.begin(); range != symbols.end(); ++range) {
+        if (range->upper() > 0) return range->lower() > 0 ? range->lower() : 0;
+    }
+    
+    return -1;
+}
+
+/// \brief The symbol for the highest ranked action of a DFA state, or -1 if it doesn't accept
+int lexeme_samples::accepted_symbol(int stateId) const {
+    const ndfa::accept_action_list& actions = m_Dfa->actions_for_state(stateId);
+    if (actions.empty()) return -1;
+    
+    accept_action* highest = actions[0];
+    for (ndfa::accept_action_list::const_iterator action = actions.begin(); action != actions.end(); ++action) {
+        if ((*highest) < **action) {
+            highest = *action;
+        }
+    }
+    
+    return highest->symbol();
+}
@@ -0,0 +1,108 @@
+//
+//  lexeme_samples.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _DFA_LEXEME_SAMPLES_H
+#define _DFA_LEXEME_SAMPLES_H
+
+#include <map>
+#include <vector>
+
+#include "TameParse/Dfa/ndfa.h"
+#include "TameParse/Dfa/keyword_table.h"
+
+namespace dfa {
+    ///
+    /// \brief Example lexemes for each of the symbols recognised by a DFA
+    ///
+    /// The samples are found by a breadth-first search from an initial state of the DFA, so the shortest lexemes for each
+    /// symbol come first. Each state can be reached by several paths, which gives symbols such as identifiers more than
+    /// one sample. Every sample is a lexeme that a lexer built from the same DFA and keyword table would return as its
+    /// symbol: the highest ranked action of the state where it ends, after the keyword table has been applied. Keywords
+    /// that are only in the keyword table use their text as their sample.
+    ///
+    /// Where a transition covers many symbols, lower case letters are preferred, followed by digits, upper case letters,
+    /// other printable ASCII characters and spaces, so the samples are readable where possible.
+    ///
+    class lexeme_samples {
+    public:
+        /// \brief The symbols that make up a sample lexeme
+        typedef std::vector<int> sample;
+        
+        /// \brief A list of samples
+        typedef std::vector<sample> sample_list;
+        
+        /// \brief Maps symbol IDs to their samples
+        typedef std::map<int, sample_list> sample_map;
+        
+        /// \brief Iterates through the symbols that have samples
+        typedef sample_map::const_iterator iterator;
+    
+    private:
+        /// \brief The DFA that the samples were found in
+        const ndfa* m_Dfa;
+        
+        /// \brief NULL, or the keywords that the lexer recognises after the DFA has matched a lexeme
+        const keyword_table* m_Keywords;
+        
+        /// \brief The initial state that the samples start from
+        int m_InitialState;
+        
+        /// \brief The samples for each symbol
+        sample_map m_Samples;
+        
+        /// \brief Returned for symbols with no samples
+        static const sample_list s_NoSamples;
+    
+    public:
+        /// \brief Finds up to maxSamples samples for each of the symbols accepted by a DFA
+        ///
+        /// The DFA and the keyword table are used by symbol_for, so they must remain valid for as long as this object.
+        lexeme_samples(const ndfa& dfa, int maxSamples, const keyword_table* keywords = NULL, int initialState = 0);
+        
+        /// \brief The samples for the specified symbol (empty if the DFA can't produce it)
+        const sample_list& samples_for_symbol(int symbol) const;
+        
+        /// \brief True if there is at least one sample for the specified symbol
+        inline bool has_samples(int symbol) const { return m_Samples.find(symbol) != m_Samples.end(); }
+        
+        /// \brief The first symbol that has samples
+        inline iterator begin() const { return m_Samples.begin(); }
+        
+        /// \brief The symbol after the last symbol that has samples
+        inline iterator end() const { return m_Samples.end(); }
+        
+        /// \brief The symbol that the lexer would produce for a lexeme made up of the symbols from begin to end, or -1 if it isn't a single lexeme
+        int symbol_for(const int* begin, const int* end) const;
+        
+        /// \brief Chooses a readable symbol from a set, or returns -1 if the set is empty
+        static int pick_symbol(const symbol_set& symbols);
+    
+    private:
+        /// \brief The symbol for the highest ranked action of a DFA state, or -1 if it doesn't accept
+        int accepted_symbol(int stateId) const;
+    };
+}
+
+#endif
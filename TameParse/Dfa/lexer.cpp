@@ -27,13 +27,131 @@
 
 #include "TameParse/Dfa/lexer.h"
 
+using namespace std;
 using namespace dfa;
 
+/// \brief Measures the tables for the specified DFA
+lexer_table_sizes::lexer_table_sizes(const ndfa& dfa)
+: numStates(dfa.count_states())
+, numSymbolSets(dfa.symbols().count_sets())
+, numTransitions(0) {
+    // The symbol map is the same whichever table is used
+    symbolMap = symbol_translator<wchar_t>(dfa.symbols()).size();
+    
+    // Build the rows of the comb vector, counting the transitions as we go
+    vector<util::comb_vector::row> rows((size_t) numStates);
+    
+    for (int stateNum = 0; stateNum < numStates; ++stateNum) {
+        const state& thisState = dfa.get_state(stateNum);
+        
+        for (state::iterator transit = thisState.begin(); transit != thisState.end(); ++transit) {
+            rows[stateNum].push_back(util::comb_vector::cell(transit->symbol_set(), transit->new_state()));
+            ++numTransitions;
+        }
+    }
+    
+    // Flat tables use the smallest cell that can hold every state
+    size_t flatCells = (size_t) numStates * (size_t) numSymbolSets;
+    
+    if (packed_state_machine<wchar_t, unsigned char>::fits(dfa)) {
+        flatTable = flatCells * sizeof(unsigned char);
+    } else if (packed_state_machine<wchar_t, unsigned short>::fits(dfa)) {
+        flatTable = flatCells * sizeof(unsigned short);
+    } else {
+        flatTable = 0;
+    }
+    
+    combTable       = util::comb_vector(rows).size();
+    compactTable    = sizeof(state_machine_compact_table<>) * (size_t) numStates + sizeof(state_machine_compact_table<>::entry) * (size_t) numTransitions;
+}
+
+/// \brief The number of bytes used by the transition table for the specified style
+size_t lexer_table_sizes::table_size(table_style style) const {
+    switch (style) {
+        case flat:      return flatTable;
+        case comb:      return combTable;
+        case compact:   return compactTable;
+    }
+    
+    return 0;
+}
+
+/// \brief The style with the smallest transition table
+lexer_table_sizes::table_style lexer_table_sizes::smallest() const {
+    table_style result = combTable <= compactTable ? comb : compact;
+    
+    if (flatTable > 0 && flatTable <= table_size(result)) {
+        result = flat;
+    }
+    
+    return result;
+}
+
+/// \brief The style a lexer should use
+lexer_table_sizes::table_style lexer_table_sizes::preferred() const {
+    table_style small = smallest();
+    
+    if (flatTable > 0 && flatTable <= c_MaxPreferredFlatSize && flatTable <= table_size(small) * c_MaxPreferredFlatRatio) {
+        return flat;
+    }
+    
+    return small;
+}
+
+/// \brief The name of a table style
+const char* lexer_table_sizes::name(table_style style) {
+    switch (style) {
+        case flat:      return "flat";
+        case comb:      return "comb";
+        case compact:   return "compact";
+    }
+    
+    return "unknown";
+}
+
+/// \brief Creates a lexer for the specified DFA, using the most suitable table representation
+///
+/// keywords can be NULL, or a keyword table that will remain valid for as long as the lexer.
+static basic_lexer* create_dfa_lexer(const ndfa& dfa, bool compact, bool utf8, const keyword_table* keywords = NULL) {
+    if (utf8) {
+        // Byte lexers use the smallest packed table that can hold all of the states
+        if (packed_dfa_lexer<unsigned char, unsigned char>::fits(dfa)) {
+            return new packed_dfa_lexer<unsigned char, unsigned char>(dfa, keywords);
+        } else if (packed_dfa_lexer<unsigned char, unsigned short>::fits(dfa)) {
+            return new packed_dfa_lexer<unsigned char, unsigned short>(dfa, keywords);
+        } else {
+            return new comb_dfa_lexer<unsigned char>(dfa, keywords);
+        }
+    } else if (compact) {
+        return new dfa_lexer<wchar_t, state_machine_compact_table<> >(dfa, keywords);
+    }
+    
+    // Flat tables are fastest, but the other representations can be much smaller if the rows are sparse
+    switch (lexer_table_sizes(dfa).preferred()) {
+        case lexer_table_sizes::flat:
+            // Use the smallest cell that can hold all of the states
+            if (packed_dfa_lexer<wchar_t, unsigned char>::fits(dfa)) {
+                return new packed_dfa_lexer<wchar_t, unsigned char>(dfa, keywords);
+            } else {
+                return new packed_dfa_lexer<wchar_t, unsigned short>(dfa, keywords);
+            }
+            
+        case lexer_table_sizes::compact:
+            return new dfa_lexer<wchar_t, state_machine_compact_table<> >(dfa, keywords);
+            
+        default:
+            // Too many states to pack, or the rows are sparse enough that overlaying them is much smaller
+            return new comb_dfa_lexer<wchar_t>(dfa, keywords);
+    }
+}
+
 /// \brief Creates a default lexer
 lexer::lexer() 
 : m_Ndfa(new ndfa_regex())
 , m_Lexer(NULL)
-, m_OwnsLexer(true) {
+, m_OwnsLexer(true)
+, m_Utf8(false)
+, m_Keywords(NULL) {
 }
 
 /// \brief Creates an instance of this class that will use the specified NDFA for building the lexer
@@ -42,7 +160,9 @@ lexer::lexer()
 lexer::lexer(ndfa_regex* ndfa)
 : m_Ndfa(ndfa)
 , m_Lexer(NULL)
-, m_OwnsLexer(true) {
+, m_OwnsLexer(true)
+, m_Utf8(false)
+, m_Keywords(NULL) {
     if (m_Ndfa == NULL) m_Ndfa = new ndfa_regex();
 }
 
@@ -53,20 +173,20 @@ lexer::lexer(ndfa_regex* ndfa)
 lexer::lexer(const ndfa& dfa)
 : m_Ndfa(NULL)
 , m_Lexer(NULL)
-, m_OwnsLexer(true) {
-    m_Lexer = new dfa_lexer<wchar_t, state_machine_flat_table>(dfa);
+, m_OwnsLexer(true)
+, m_Utf8(false)
+, m_Keywords(NULL) {
+    m_Lexer = create_dfa_lexer(dfa, false, false);
 }
 
-/// \brief Creates an instance of this class that will use the specified basic_lexer
-///
-/// The lexer supplied to this call will be destroyed when this class is destroyed
-lexer::lexer(basic_lexer* lexer, bool ownsLexer)
+/// \brief Creates an instance of this class that will use the specified DFA and keyword table for building the lexer
+lexer::lexer(const ndfa& dfa, const keyword_table& keywords)
 : m_Ndfa(NULL)
-, m_Lexer(lexer)
-, m_OwnsLexer(ownsLexer) {
-    if (m_Lexer == NULL) {
-        m_Ndfa = new ndfa_regex();
-    }
+, m_Lexer(NULL)
+, m_OwnsLexer(true)
+, m_Utf8(false)
+, m_Keywords(new keyword_hash_table(keywords)) {
+    m_Lexer = create_dfa_lexer(dfa, false, false, m_Keywords);
 }
 
 /// \brief Destructor
@@ -78,6 +198,11 @@ lexer::~lexer() {
     if (m_Lexer && m_OwnsLexer) {
         delete m_Lexer;
     }
+    
+    // The lexer refers to the keywords, so they're deleted afterwards
+    if (m_Keywords) {
+        delete m_Keywords;
+    }
 }
 
 ///
@@ -97,6 +222,66 @@ lexeme_stream* lexer::create_stream(lexer_symbol_stream* stream) const {
     return m_Lexer->create_stream(stream);
 }
 
+/// \brief Creates a new lexer that will read from a buffer of symbols in memory, lexing it on up to maxThreads threads
+lexeme_stream* lexer::create_parallel_stream_from_symbols(const int* begin, const int* end, unsigned int maxThreads) const {
+    if (!m_Lexer) {
+        // Compile this lexer if it's not compiled already
+        ((lexer*)this)->compile();
+    }
+    
+    if (!m_Lexer) return NULL;
+    
+    return m_Lexer->create_parallel_stream_from_symbols(begin, end, maxThreads);
+}
+
+/// \brief Creates a new lexer that will read from a buffer of symbols in memory, only tracking the offset of each lexeme
+lexeme_stream* lexer::create_offset_stream_from_symbols(const int* begin, const int* end) const {
+    if (!m_Lexer) {
+        // Compile this lexer if it's not compiled already
+        ((lexer*)this)->compile();
+    }
+    
+    if (!m_Lexer) return NULL;
+    
+    return m_Lexer->create_offset_stream_from_symbols(begin, end);
+}
+
+/// \brief Creates a new lexer that carries on from a checkpoint taken from a stream reading the same buffer
+lexeme_stream* lexer::create_stream_from_checkpoint(const int* begin, const int* end, const lexer_checkpoint& checkpoint) const {
+    if (!m_Lexer) {
+        // Compile this lexer if it's not compiled already
+        ((lexer*)this)->compile();
+    }
+    
+    if (!m_Lexer) return NULL;
+    
+    return m_Lexer->create_stream_from_checkpoint(begin, end, checkpoint);
+}
+
+/// \brief Creates an object that runs the state machine for this lexer directly over buffers of symbols
+chunk_lexer* lexer::create_chunk_lexer() const {
+    if (!m_Lexer) {
+        // Compile this lexer if it's not compiled already
+        ((lexer*)this)->compile();
+    }
+    
+    if (!m_Lexer) return NULL;
+    
+    return m_Lexer->create_chunk_lexer();
+}
+
+/// \brief Splits the symbols after a cursor into tokens, writing up to maxTokens of them to an array
+size_t lexer::tokenize(token_cursor& cursor, token* tokens, size_t maxTokens) const {
+    if (!m_Lexer) {
+        // Compile this lexer if it's not compiled already
+        ((lexer*)this)->compile();
+    }
+    
+    if (!m_Lexer) return 0;
+    
+    return m_Lexer->tokenize(cursor, tokens, maxTokens);
+}
+
 /// \brief Adds a new symbol to this lexer, if it isn't compiled
 void lexer::add_symbol(const symbol_string& regex, int symbolId) {
     // Can't add any new regexps once we're compiled
@@ -106,6 +291,15 @@ void lexer::add_symbol(const symbol_string& regex, int symbolId) {
     m_Ndfa->add_regex(0, regex, accept_action(symbolId, false));
 }
 
+/// \brief Sets whether or not this lexer should match UTF-8 bytes rather than characters
+void lexer::set_utf8(bool utf8) {
+    // Can't change the type of lexer once it's compiled
+    if (!m_Ndfa) return;
+    
+    m_Utf8 = utf8;
+    m_Ndfa->set_use_utf8(utf8);
+}
+
 /// \brief Compiles this lexer so that it is ready for use
 void lexer::compile(bool compact) {
     if (m_Lexer) return;
@@ -116,15 +310,14 @@ void lexer::compile(bool compact) {
     delete m_Ndfa; 
     m_Ndfa = NULL;
     
-    ndfa* dfa = symbols->to_dfa();
+    ndfa* reduced = symbols->to_ndfa_without_epsilon_states();
     delete symbols;
     
+    ndfa* dfa = reduced->to_dfa();
+    delete reduced;
+    
     // Create the lexer
-    if (compact) {
-        m_Lexer = new dfa_lexer<wchar_t, state_machine_compact_table<> >(*dfa);        
-    } else {
-        m_Lexer = new dfa_lexer<wchar_t, state_machine_flat_table>(*dfa);
-    }
+    m_Lexer = create_dfa_lexer(*dfa, compact, m_Utf8);
     
     // Done with the NDFA/DFA
     delete dfa;
@@ -164,3 +357,19 @@ size_t lexer::size() const {
     if (!m_Lexer) return 0;
     return m_Lexer->size();
 }
+
+/// \brief Prepares this lexer for use without building its DFA in advance
+void lexer::compile_lazy(size_t maxCacheSize) {
+    if (m_Lexer) return;
+    if (!m_Ndfa) return;
+    
+    // The lazy lexer runs over the NDFA once its symbols have been made unique
+    ndfa* symbols = m_Ndfa->to_ndfa_with_unique_symbols();
+    delete m_Ndfa;
+    m_Ndfa = NULL;
+    
+    ndfa* reduced = symbols->to_ndfa_without_epsilon_states();
+    delete symbols;
+    
+    m_Lexer = new lazy_dfa_lexer(reduced, maxCacheSize);
+}
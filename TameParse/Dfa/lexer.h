@@ -32,8 +32,86 @@
 
 #include "TameParse/Dfa/ndfa_regex.h"
 #include "TameParse/Dfa/basic_lexer.h"
+#include "TameParse/Dfa/lazy_dfa_lexer.h"
 
 namespace dfa {
+    ///
+    /// \brief Sizes of the tables that a compiled lexer could use to store the state machine for a DFA
+    ///
+    /// The same DFA can be stored as a flat (packed) table, as a comb vector or as a compact table, and which of these
+    /// is smallest depends on how many states and symbol classes there are and on how full the rows are. This measures
+    /// each of them so that a lexer can pick the most suitable one and so the parser generator can report the figures.
+    ///
+    struct lexer_table_sizes {
+        /// \brief The ways that a compiled lexer can store its state machine
+        enum table_style {
+            /// \brief Packed table with an entry for every state and symbol class
+            flat,
+            
+            /// \brief Overlaid rows with a check array (see util::comb_vector)
+            comb,
+            
+            /// \brief Sorted transitions for each state, found with a binary search
+            compact
+        };
+        
+        /// \brief The number of bytes in a cache line, used to estimate the cache footprint of the tables
+        static const size_t c_CacheLineSize = 64;
+        
+        /// \brief Flat tables larger than this are never preferred
+        static const size_t c_MaxPreferredFlatSize = 64*1024;
+        
+        /// \brief Flat tables are preferred when they are no more than this many times larger than the smallest table
+        static const size_t c_MaxPreferredFlatRatio = 4;
+        
+        /// \brief The number of states in the DFA
+        int numStates;
+        
+        /// \brief The number of symbol classes in the DFA
+        int numSymbolSets;
+        
+        /// \brief The number of transitions in the DFA
+        int numTransitions;
+        
+        /// \brief Bytes needed to translate characters into symbol classes
+        size_t symbolMap;
+        
+        /// \brief Bytes used by a flat table, or 0 if the DFA has too many states to be packed
+        size_t flatTable;
+        
+        /// \brief Bytes used by a comb vector
+        size_t combTable;
+        
+        /// \brief Bytes used by a compact table
+        size_t compactTable;
+        
+        /// \brief Measures the tables for the specified DFA
+        explicit lexer_table_sizes(const ndfa& dfa);
+        
+        /// \brief The number of bytes used by the transition table for the specified style
+        size_t table_size(table_style style) const;
+        
+        /// \brief Estimated number of cache lines touched when lexing with the specified style
+        ///
+        /// This assumes that the whole of the transition table and the symbol map are in use, so it is an upper bound
+        /// for most input.
+        inline size_t cache_lines(table_style style) const {
+            return (table_size(style) + symbolMap + c_CacheLineSize - 1) / c_CacheLineSize;
+        }
+        
+        /// \brief The style with the smallest transition table
+        table_style smallest() const;
+        
+        /// \brief The style a lexer should use
+        ///
+        /// Flat tables need a single load per character, so are preferred unless they are much larger than the
+        /// alternatives. Otherwise this is the smallest style.
+        table_style preferred() const;
+        
+        /// \brief The name of a table style
+        static const char* name(table_style style);
+    };
+    
     /// \brief Class used to build and run lexers
     class lexer : public basic_lexer {
     private:
@@ -46,6 +124,12 @@ namespace dfa {
         /// \brief True if this object owns its lexer
         const bool m_OwnsLexer;
         
+        /// \brief True if this lexer should match UTF-8 bytes rather than characters
+        bool m_Utf8;
+        
+        /// \brief NULL, or the keywords recognised by the compiled lexer
+        keyword_hash_table* m_Keywords;
+        
         /// \brief No copying for this class
         inline lexer(const lexer& copyFrom);
 
@@ -67,11 +151,24 @@ namespace dfa {
         /// call will produce an invalid lexer if the supplied object is not deterministic.
         explicit lexer(const ndfa& dfa);
         
+        /// \brief Creates an instance of this class that will use the specified DFA and keyword table for building the lexer
+        ///
+        /// Lexemes matched by the DFA whose text is in the keyword table will be given the keyword symbol instead of the
+        /// symbol the DFA accepted (see keyword_table). The DFA and the keyword table can both be discarded after this call.
+        lexer(const ndfa& dfa, const keyword_table& keywords);
+        
         /// \brief Creates an instance of this class that will use the specified basic_lexer
         ///
         /// The lexer supplied to this call will be destroyed when this class is destroyed
-        /// if ownsLexer is set to true.
-        lexer(basic_lexer* lexer, bool ownsLexer = true);
+        /// if ownsLexer is set to true. This is how generated parsers declare their lexers, so it can be used
+        /// to initialise static objects when the program is compiled.
+        TAMEPARSE_CONSTEXPR lexer(basic_lexer* lexer, bool ownsLexer = true)
+        : m_Ndfa(lexer ? NULL : new ndfa_regex())
+        , m_Lexer(lexer)
+        , m_OwnsLexer(ownsLexer)
+        , m_Utf8(false)
+        , m_Keywords(NULL) {
+        }
         
         /// \brief Destructor
         virtual ~lexer();
@@ -84,6 +181,31 @@ namespace dfa {
         ///
         virtual lexeme_stream* create_stream(lexer_symbol_stream* stream) const;
         
+        /// \brief Creates a new lexer that will read from a buffer of symbols in memory, lexing it on up to maxThreads threads
+        ///
+        /// If the lexer is not yet compiled, then it will be compiled by this call.
+        virtual lexeme_stream* create_parallel_stream_from_symbols(const int* begin, const int* end, unsigned int maxThreads = 0) const;
+        
+        /// \brief Creates a new lexer that will read from a buffer of symbols in memory, only tracking the offset of each lexeme
+        ///
+        /// If the lexer is not yet compiled, then it will be compiled by this call.
+        virtual lexeme_stream* create_offset_stream_from_symbols(const int* begin, const int* end) const;
+        
+        /// \brief Creates a new lexer that carries on from a checkpoint taken from a stream reading the same buffer
+        ///
+        /// If the lexer is not yet compiled, then it will be compiled by this call.
+        virtual lexeme_stream* create_stream_from_checkpoint(const int* begin, const int* end, const lexer_checkpoint& checkpoint) const;
+        
+        /// \brief Creates an object that runs the state machine for this lexer directly over buffers of symbols
+        ///
+        /// If the lexer is not yet compiled, then it will be compiled by this call.
+        virtual chunk_lexer* create_chunk_lexer() const;
+        
+        /// \brief Splits the symbols after a cursor into tokens, writing up to maxTokens of them to an array
+        ///
+        /// If the lexer is not yet compiled, then it will be compiled by this call.
+        virtual size_t tokenize(token_cursor& cursor, token* tokens, size_t maxTokens) const;
+        
         /// \brief Adds a new symbol to this lexer, if it isn't compiled
         void add_symbol(const symbol_string& regex, int symbolId);
         
@@ -93,12 +215,25 @@ namespace dfa {
         /// \brief Adds a new symbol to this lexer, if it isn't compiled
         inline void add_symbol(std::wstring regex, int symbolId) { add_symbol(ndfa_regex::convert(regex), symbolId); }
         
+        /// \brief Sets whether or not this lexer should match UTF-8 bytes rather than characters
+        ///
+        /// A UTF-8 lexer should be used with a stream that supplies undecoded bytes, such as a file_symbol_stream with
+        /// the bytes encoding. This avoids the need to decode the input, and the compiled lexer can look up each byte
+        /// in a single 256-entry table. This must be set before any symbols are added.
+        void set_utf8(bool utf8);
+        
         /// \brief Compiles this lexer so that it is ready for use
         ///
         /// Set compact to true if you want to build a compact lexer (these are smaller if the transition table is less than 
         /// 50% full, but execute more slowly)
         void compile(bool compact = false);
         
+        /// \brief Prepares this lexer for use without building its DFA in advance
+        ///
+        /// The DFA states are built while lexing instead, and each stream keeps up to maxCacheSize bytes of them (see
+        /// lazy_dfa_lexer). This is useful for lexers whose DFA would be too large to build all at once.
+        void compile_lazy(size_t maxCacheSize = lazy_dfa_lexer::c_DefaultCacheSize);
+        
     public:
         /// \brief Verifies that this lexer will compile into a valid DFA
         ///
@@ -0,0 +1,76 @@
+//
+//  line_index.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#include <algorithm>
+
+#include "TameParse/Dfa/line_index.h"
+
+using namespace std;
+using namespace dfa;
+
+/// \brief Creates an index for the specified buffer, which must remain valid while the index is in use
+line_index::line_index(const int* begin, const int* end)
+: m_Begin(begin)
+, m_End(end) {
+}
+
+/// \brief Finds where each line begins
+void line_index::build() const {
+    m_LineStarts.push_back(0);
+    
+    for (const int* pos = find_newline(m_Begin, m_End); pos != m_End; pos = find_newline(pos + 1, m_End)) {
+        // The LF in a CR/LF pair is part of the line started by the CR
+        if (*pos == 0x0a && pos != m_Begin && pos[-1] == 0x0d) continue;
+        
+        m_LineStarts.push_back((pos - m_Begin) + 1);
+    }
+}
+
+/// \brief The position of the symbol at the specified offset
+position line_index::position_for(stream_offset offset) const {
+    if (m_LineStarts.empty()) build();
+    
+    // Find the last line that starts at or before the offset
+    vector<stream_offset>::const_iterator after = upper_bound(m_LineStarts.begin(), m_LineStarts.end(), offset);
+    stream_offset line          = (after - m_LineStarts.begin()) - 1;
+    if (line < 0) line = 0;
+    
+    stream_offset lineStart     = m_LineStarts[(size_t) line];
+    stream_offset column        = offset - lineStart;
+    
+    // The LF after a CR doesn't count as a column
+    if (column > 0 && line > 0 && m_Begin + lineStart < m_End && m_Begin[lineStart] == 0x0a && m_Begin[lineStart - 1] == 0x0d) {
+        --column;
+    }
+    
+    return position(offset, line, column);
+}
+
+/// \brief The number of lines in the buffer
+stream_offset line_index::count_lines() const {
+    if (m_LineStarts.empty()) build();
+    return (stream_offset) m_LineStarts.size();
+}
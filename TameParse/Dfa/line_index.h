@@ -0,0 +1,76 @@
+//
+//  line_index.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _DFA_LINE_INDEX_H
+#define _DFA_LINE_INDEX_H
+
+#include <vector>
+
+#include "TameParse/Dfa/position.h"
+
+namespace dfa {
+    ///
+    /// \brief Finds the line and column of offsets in a buffer of symbols
+    ///
+    /// Lexers can be asked to only track the offset of each lexeme (see basic_lexer::create_offset_stream_from_symbols),
+    /// which leaves the line and column of their positions set to -1. This class fills them in when they are needed,
+    /// typically when an error is reported. The first time a position is requested, the buffer is scanned once to find
+    /// the offset where each line starts; after that each lookup is a binary search. The results are the same as the
+    /// positions produced by a lexer that tracks lines.
+    ///
+    class line_index {
+    private:
+        /// \brief The start of the buffer
+        const int* m_Begin;
+        
+        /// \brief The end of the buffer
+        const int* m_End;
+        
+        /// \brief The offsets at which each line begins, or empty if the index hasn't been built yet
+        mutable std::vector<stream_offset> m_LineStarts;
+        
+        /// \brief Finds where each line begins
+        void build() const;
+        
+    public:
+        /// \brief Creates an index for the specified buffer, which must remain valid while the index is in use
+        line_index(const int* begin, const int* end);
+        
+        /// \brief The position of the symbol at the specified offset
+        position position_for(stream_offset offset) const;
+        
+        /// \brief The number of lines in the buffer
+        stream_offset count_lines() const;
+        
+        /// \brief Returns a position with its line and column filled in
+        inline position resolve(const position& pos) const {
+            if (pos.has_line()) return pos;
+            return position_for(pos.offset());
+        }
+    };
+}
+
+#endif
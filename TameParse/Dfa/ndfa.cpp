@@ -241,14 +241,14 @@ static void add_surrogate_transition(const range<int>& surrogateRange, int curre
         nfa->add_transition(currentState, range<int>(surrogateLower.first, surrogateLower.first+1), tmpState1);
 
         // Transit to the final state for all the 'lower' symbols
-        nfa->add_transition(tmpState1, range<int>(surrogateLower.second, 0xdc00), targetState);
+        nfa->add_transition(tmpState1, range<int>(surrogateLower.second, 0xe000), targetState);
 
         // ... do the same for the 'upper' set of symbols
         int tmpState2 = nfa->add_state();
         nfa->add_transition(currentState, range<int>(surrogateHigher.first, surrogateHigher.first+1), tmpState2);
 
         // Transit to the final state for all the 'lower' symbols
-        nfa->add_transition(tmpState2, range<int>(0xd800, surrogateHigher.second+1), targetState);
+        nfa->add_transition(tmpState2, range<int>(0xdc00, surrogateHigher.second+1), targetState);
 
         // If there's a middle range, then add transitions for that as well
         if (surrogateHigher.first-1 > surrogateLower.first) {
@@ -262,6 +262,97 @@ static void add_surrogate_transition(const range<int>& surrogateRange, int curre
     }
 }
 
+/// \brief Encodes a UTF-32 value as UTF-8, returning the number of bytes
+static inline int utf8_encode(int ucs32, int* bytes) {
+    if (ucs32 < 0x80) {
+        bytes[0] = ucs32;
+        return 1;
+    } else if (ucs32 < 0x800) {
+        bytes[0] = 0xc0 | (ucs32 >> 6);
+        bytes[1] = 0x80 | (ucs32 & 0x3f);
+        return 2;
+    } else if (ucs32 < 0x10000) {
+        bytes[0] = 0xe0 | (ucs32 >> 12);
+        bytes[1] = 0x80 | ((ucs32 >> 6) & 0x3f);
+        bytes[2] = 0x80 | (ucs32 & 0x3f);
+        return 3;
+    } else {
+        bytes[0] = 0xf0 | (ucs32 >> 18);
+        bytes[1] = 0x80 | ((ucs32 >> 12) & 0x3f);
+        bytes[2] = 0x80 | ((ucs32 >> 6) & 0x3f);
+        bytes[3] = 0x80 | (ucs32 & 0x3f);
+        return 4;
+    }
+}
+
+/// \brief Adds transitions for the UTF-8 sequences for the characters between lower and upper (inclusive)
+///
+/// All of the characters in the range must encode to the same number of bytes
+static void add_utf8_sequence(int lower, int upper, int currentState, int targetState, ndfa* nfa) {
+    int lowerBytes[4];
+    int upperBytes[4];
+    int length = utf8_encode(lower, lowerBytes);
+    
+    // Split the range until every byte can vary independently of the others
+    for (int byte = 1; byte < length; ++byte) {
+        int mask = (1 << (6*byte)) - 1;
+        
+        if ((lower & ~mask) != (upper & ~mask)) {
+            if ((lower & mask) != 0) {
+                add_utf8_sequence(lower, lower | mask, currentState, targetState, nfa);
+                add_utf8_sequence((lower | mask) + 1, upper, currentState, targetState, nfa);
+                return;
+            }
+            if ((upper & mask) != mask) {
+                add_utf8_sequence(lower, (upper & ~mask) - 1, currentState, targetState, nfa);
+                add_utf8_sequence(upper & ~mask, upper, currentState, targetState, nfa);
+                return;
+            }
+        }
+    }
+    
+    // Add a chain of transitions for each byte
+    utf8_encode(upper, upperBytes);
+    
+    int state = currentState;
+    for (int byte = 0; byte < length-1; ++byte) {
+        int nextState = nfa->add_state();
+        nfa->add_transition(state, range<int>(lowerBytes[byte], upperBytes[byte]+1), nextState);
+        state = nextState;
+    }
+    
+    nfa->add_transition(state, range<int>(lowerBytes[length-1], upperBytes[length-1]+1), targetState);
+}
+
+/// \brief Adds transitions for the UTF-8 sequences that represent the specified range of characters
+static void add_utf8_transition(const range<int>& utf8Range, int currentState, int targetState, ndfa* nfa) {
+    // Clip to the range of characters that can be encoded
+    int lower = utf8Range.lower();
+    int upper = utf8Range.upper()-1;
+    
+    if (lower < 0)          lower = 0;
+    if (upper > 0x10ffff)   upper = 0x10ffff;
+    if (lower > upper)      return;
+    
+    // Surrogate characters can't be encoded
+    if (lower <= 0xdfff && upper >= 0xd800) {
+        if (lower < 0xd800) add_utf8_transition(range<int>(lower, 0xd800), currentState, targetState, nfa);
+        if (upper > 0xdfff) add_utf8_transition(range<int>(0xe000, upper+1), currentState, targetState, nfa);
+        return;
+    }
+    
+    // Split into ranges that encode to the same number of bytes
+    static const int lengthLimits[] = { 0x7f, 0x7ff, 0xffff };
+    for (int limit = 0; limit < 3; ++limit) {
+        if (lower <= lengthLimits[limit] && upper > lengthLimits[limit]) {
+            add_utf8_sequence(lower, lengthLimits[limit], currentState, targetState, nfa);
+            lower = lengthLimits[limit]+1;
+        }
+    }
+    
+    add_utf8_sequence(lower, upper, currentState, targetState, nfa);
+}
+
 /// \brief Unicode converter
 static unicode s_Unicode;
 
@@ -276,6 +367,58 @@ inline void ndfa::builder::add_with_surrogates(const symbol_set& symbols) {
         nextState = m_Ndfa->add_state();
     }
 
+    // If generate UTF-8 is turned on, then convert any non-ASCII characters into UTF-8 sequences
+    // (Symbol sets with no non-ASCII characters, such as epsilon, are added unchanged)
+    if (m_GenerateUtf8) {
+        symbol_set ascii;
+        symbol_set multiByte;
+        
+        for (symbol_set::iterator syms = symbols.begin(); syms != symbols.end(); ++syms) {
+            // Ignore empty ranges
+            if (syms->lower() >= syms->upper()) continue;
+            
+            if (syms->upper() > 0x80) {
+                if (syms->lower() < 0x80) {
+                    // Split range
+                    ascii       |= range<int>(syms->lower(), 0x80);
+                    multiByte   |= range<int>(0x80, syms->upper());
+                } else {
+                    // Just a multi-byte range
+                    multiByte   |= *syms;
+                }
+            } else {
+                // Just an ASCII range
+                ascii |= *syms;
+            }
+        }
+        
+        // See if there were any multi-byte ranges
+        if (!multiByte.empty()) {
+            // Push before this transition
+            push();
+            
+            if (!ascii.empty()) {
+                // ASCII characters are the same in UTF-8
+                m_Ndfa->add_transition(m_CurrentState, ascii, nextState);
+            }
+            
+            // Add a sequence of transitions for each multi-byte range
+            for (symbol_set::iterator syms = multiByte.begin(); syms != multiByte.end(); ++syms) {
+                add_utf8_transition(*syms, m_CurrentState, nextState, m_Ndfa);
+            }
+            
+            // Update the current state
+            m_PreviousState = m_CurrentState;
+            m_CurrentState  = nextState;
+            
+            // Pop afterwards
+            pop();
+            
+            // Done
+            return;
+        }
+    }
+    
     // If generate surrogates is turned on, and the symbol set ends outside the surrogate range
     if (m_GenerateSurrogates) {
         // Search to see if there are any surrogate ranges
@@ -435,6 +578,98 @@ void ndfa::builder::rejoin() {
     }
 }
 
+/// \brief Finds the accepting actions of the states that this NDFA can be in after reading the symbols from begin to end, starting at initialState
+void ndfa::actions_for_string(int initialState, const int* begin, const int* end, accept_action_list& result) const {
+    // Start in the closure of the initial state
+    set<int> states;
+    states.insert(initialState);
+    closure(states);
+    
+    int epsSymbol = m_Symbols->identifier_for_symbols(epsilon());
+    
+    for (const int* symbol = begin; symbol != end && !states.empty(); ++symbol) {
+        // Follow every transition that contains this symbol
+        set<int> nextStates;
+        
+        for (set<int>::const_iterator stateId = states.begin(); stateId != states.end(); ++stateId) {
+            const state& thisState = get_state(*stateId);
+            
+            for (state::iterator transit = thisState.begin(); transit != thisState.end(); ++transit) {
+                if (transit->symbol_set() == epsSymbol) continue;
+                
+                if ((*m_Symbols)[transit->symbol_set()][*symbol]) {
+                    nextStates.insert(transit->new_state());
+                }
+            }
+        }
+        
+        closure(nextStates);
+        states.swap(nextStates);
+    }
+    
+    // Collect the actions for the states that were reached
+    for (set<int>::const_iterator stateId = states.begin(); stateId != states.end(); ++stateId) {
+        const accept_action_list& actions = actions_for_state(*stateId);
+        result.insert(result.end(), actions.begin(), actions.end());
+    }
+}
+
+/// \brief True if this NDFA reaches the same states for every spelling of the symbols from begin to end that differs only in case
+///
+/// Each symbol is compared with its upper and lower case equivalents: if all of them lead to the same set of states, then
+/// by induction so does every spelling of the whole string.
+bool ndfa::ignores_case(int initialState, const int* begin, const int* end) const {
+    // Start in the closure of the initial state
+    set<int> states;
+    states.insert(initialState);
+    closure(states);
+    
+    int epsSymbol = m_Symbols->identifier_for_symbols(epsilon());
+    
+    for (const int* symbol = begin; symbol != end && !states.empty(); ++symbol) {
+        // Find the symbols that this one is equivalent to when case is ignored
+        symbol_set  original(*symbol);
+        symbol_set  variants = original;
+        variants |= s_Unicode.to_lower(original);
+        variants |= s_Unicode.to_upper(original);
+        
+        // Follow the transitions for each of them
+        set<int>    nextStates;
+        bool        first = true;
+        
+        for (symbol_set::iterator range = variants.begin(); range != variants.end(); ++range) {
+            for (int variant = range->lower(); variant < range->upper(); ++variant) {
+                set<int> variantStates;
+                
+                for (set<int>::const_iterator stateId = states.begin(); stateId != states.end(); ++stateId) {
+                    const state& thisState = get_state(*stateId);
+                    
+                    for (state::iterator transit = thisState.begin(); transit != thisState.end(); ++transit) {
+                        if (transit->symbol_set() == epsSymbol) continue;
+                        
+                        if ((*m_Symbols)[transit->symbol_set()][variant]) {
+                            variantStates.insert(transit->new_state());
+                        }
+                    }
+                }
+                
+                closure(variantStates);
+                
+                if (first) {
+                    nextStates.swap(variantStates);
+                    first = false;
+                } else if (variantStates != nextStates) {
+                    return false;
+                }
+            }
+        }
+        
+        states.swap(nextStates);
+    }
+    
+    return true;
+}
+
 /// \brief Internal method: computes the closure of the specified set of states (modifies the set to include 
 /// all states reachable by epsilon transitions)
 void ndfa::closure(set<int>& states) const {
@@ -40,6 +40,8 @@
 #include "TameParse/Dfa/epsilon.h"
 
 namespace dfa {
+    class frozen_ndfa;
+    
     ///
     /// \brief Class representing a NDFA (non-deterministic finite state automaton)
     ///
@@ -176,6 +178,19 @@ namespace dfa {
         /// \brief Returns true if this is deterministic (was generated by a call to to_dfa)
         bool is_dfa() const { return m_IsDeterministic; }
         
+        /// \brief Finds the accepting actions of the states that this NDFA can be in after reading the symbols from begin to end, starting at initialState
+        ///
+        /// The actions are appended to result, which will refer to actions owned by this object. This runs the NDFA directly,
+        /// so it is only suitable for short strings: the lexer stage uses it to find out how a literal will be matched without
+        /// having to build a DFA.
+        void actions_for_string(int initialState, const int* begin, const int* end, accept_action_list& result) const;
+        
+        /// \brief True if this NDFA reaches the same states for every spelling of the symbols from begin to end that differs only in case
+        ///
+        /// This runs the NDFA directly in the same way as actions_for_string. The lexer stage uses it to find out if a case
+        /// insensitive literal can be moved into the keyword table.
+        bool ignores_case(int initialState, const int* begin, const int* end) const;
+        
         /// \brief Checks all of the states in this NDFA and returns true if there are no epsilon transitions and at most one
         /// transition per symbol.
         ///
@@ -217,6 +232,9 @@ namespace dfa {
 
             /// \brief True if this builder should generate surrogate characters for values >0xffff
             bool m_GenerateSurrogates;
+            
+            /// \brief True if this builder should generate UTF-8 byte sequences for values >0x7f
+            bool m_GenerateUtf8;
 
             /// \brief True if this builder should add lowercase characters to any symbol sets it receives
             bool m_AddLowercase;
@@ -240,11 +258,14 @@ namespace dfa {
             , m_NextState(-1)
             , m_Ndfa(dfa)
             , m_GenerateSurrogates(false)
+            , m_GenerateUtf8(false)
             , m_AddLowercase(false)
             , m_AddUppercase(false) {
             }
 
             /// \brief Adds a symbol set and applies surrogate processing if generate_surrogates is turned on
+            ///
+            /// If generate_utf8 is turned on, then the symbol set is converted to UTF-8 sequences instead
             void add_with_surrogates(const symbol_set& symbols);
             
         public:
@@ -256,6 +277,7 @@ namespace dfa {
             , m_Ndfa(copyFrom.m_Ndfa)
             , m_Stack(copyFrom.m_Stack)
             , m_GenerateSurrogates(copyFrom.m_GenerateSurrogates)
+            , m_GenerateUtf8(copyFrom.m_GenerateUtf8)
             , m_AddLowercase(copyFrom.m_AddLowercase)
             , m_AddUppercase(copyFrom.m_AddUppercase) { 
             }
@@ -291,6 +313,15 @@ namespace dfa {
                 m_GenerateSurrogates = generateSurrogates;
             }
             
+            /// \brief Sets whether or not this should generate transitions for UTF-8 byte sequences instead of characters
+            ///
+            /// With this turned on, the resulting state machine will accept UTF-8 encoded bytes as input rather than 
+            /// characters. Characters that can't be encoded (surrogates and characters above 0x10ffff) are discarded.
+            /// This takes precedence over generate_surrogates.
+            inline void set_generate_utf8(bool generateUtf8) {
+                m_GenerateUtf8 = generateUtf8;
+            }
+            
             /// \brief Sets whether or not lower or upper case versions of the character sets supplied to this builder should also be included.
             ///
             /// Setting both of these options creates a builder that generates a case-insensitive NDFA.
@@ -301,6 +332,9 @@ namespace dfa {
 
             /// \brief Whether or not this should generate surrogate values
             bool generate_surrogates() const { return m_GenerateSurrogates; }
+            
+            /// \brief Whether or not this should generate UTF-8 byte sequences
+            bool generate_utf8() const { return m_GenerateUtf8; }
 
             /// \brief True if this will add lowercase equivalents to everything supplied to it
             bool make_lowercase() const { return m_AddLowercase; }
@@ -397,12 +431,34 @@ namespace dfa {
         /// all states reachable by epsilon transitions)
         void closure(std::set<int>& states) const;
         
+        /// \brief Internal method: builds the states and accept actions of a DFA equivalent to this NDFA, starting at the specified initial states
+        ///
+        /// This reads the transitions from a frozen copy of this NDFA, and can be called on several threads at once.
+        void determinize(const frozen_ndfa& source, const std::vector<int>& initialState, state_list& states, accept_action_for_state& accept) const;
+        
+        friend class determinize_initial_state;
+        
     public:
         /// \brief Creates a new NDFA that is equivalent to this one, except there will be no overlapping symbol sets
         ///
         /// Note that if further transitions are added to the new NDFA, it may lose the unique symbol sets
         ndfa* to_ndfa_with_unique_symbols() const;
         
+        /// \brief Creates a new NDFA that is equivalent to this one, but without the states that only have an epsilon transition to another state
+        ///
+        /// Transitions to these states go directly to the state at the end of the chain of epsilon transitions instead.
+        /// The DFA built from the result is equivalent, but has fewer states before it is compacted, and there are fewer
+        /// NDFA states to track while building it. The initial states become states 0, 1, 2, etc in the new NDFA.
+        ndfa* to_ndfa_without_epsilon_states(const std::vector<int>& initialState) const;
+        
+        /// \brief Creates a new NDFA that is equivalent to this one, but without the states that only have an epsilon transition to another state
+        inline ndfa* to_ndfa_without_epsilon_states(int initialState = 0) const {
+            std::vector<int> initial;
+            initial.push_back(initialState);
+            
+            return to_ndfa_without_epsilon_states(initial);
+        }
+        
         /// \brief Creates a DFA from this NDFA
         inline ndfa* to_dfa(int initialState = 0) {
             std::vector<int> initial;
@@ -419,6 +475,13 @@ namespace dfa {
         /// You can supply a list of initial states to create a DFA with multiple start conditions. These will become states 0, 1, 2, etc in the final DFA.
         ndfa* to_dfa(const std::vector<int>& initialState) const;
         
+        /// \brief Creates a DFA from this NDFA, building the states reachable from each initial state on up to maxThreads threads
+        ///
+        /// The states for each initial state are built independently and then joined together, so a state that can be reached
+        /// from more than one initial state will be duplicated (to_compact_dfa will merge these). If maxThreads is 0, then one
+        /// thread is used for each processor core.
+        ndfa* to_dfa(const std::vector<int>& initialState, unsigned int maxThreads) const;
+        
         /// \brief Compacts a DFA, reducing the number of states
         ///
         /// For DFAs with only a single initial state, this may have one extra state than is required. If firstAction is set
@@ -441,6 +504,14 @@ namespace dfa {
         /// are generated from it. This is particularly effective after calling to_compact_dfa() to eliminate any redundant
         /// symbol sets.
         ndfa* to_ndfa_with_merged_symbols() const;
+        
+        /// \brief Creates a new NDFA with the same states, numbered in the order that they are first reached from the initial states
+        ///
+        /// The first numInitialStates states keep their IDs. The other states are numbered in depth-first order, 
+        /// following the transitions of each state in turn, so a state usually follows the state that leads to it and
+        /// the states of a loop are next to each other. This puts the states that are used together close together in
+        /// the tables generated from the result. States that can't be reached are left at the end in their original order.
+        ndfa* to_ndfa_in_traversal_order(int numInitialStates = 1) const;
     };
 }
     
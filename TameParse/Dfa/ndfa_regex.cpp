@@ -38,6 +38,7 @@ using namespace dfa;
 /// \brief Constructs an empty NDFA
 ndfa_regex::ndfa_regex()
 : m_ConstructSurrogates(true)
+, m_ConstructUtf8(false)
 , m_CaseInsensitive(false) {
 }
 
@@ -45,6 +46,7 @@ ndfa_regex::ndfa_regex()
 ndfa_regex::ndfa_regex(const ndfa& copyFrom)
 : ndfa(copyFrom)
 , m_ConstructSurrogates(true)
+, m_ConstructUtf8(false)
 , m_CaseInsensitive(false) { 
 }
 
@@ -52,9 +54,12 @@ ndfa_regex::ndfa_regex(const ndfa& copyFrom)
 ndfa_regex::ndfa_regex(const ndfa_regex& copyFrom)
 : ndfa(copyFrom)
 , m_ConstructSurrogates(copyFrom.m_ConstructSurrogates)
+, m_ConstructUtf8(copyFrom.m_ConstructUtf8)
 , m_CaseInsensitive(copyFrom.m_CaseInsensitive)
 , m_ExpressionMap(copyFrom.m_ExpressionMap)
-, m_LiteralExpressionMap(copyFrom.m_LiteralExpressionMap) {
+, m_LiteralExpressionMap(copyFrom.m_LiteralExpressionMap)
+, m_UnicodeCategories(copyFrom.m_UnicodeCategories)
+, m_ExpressionFragments(copyFrom.m_ExpressionFragments) {
 }
 
 /// \brief Converts a string to a symbol_string
@@ -151,6 +156,7 @@ int ndfa_regex::add_literal(int initialState, const symbol_string& literal) {
     // Create a constructor in the initial state
     builder cons = get_cons();
     cons.set_generate_surrogates(m_ConstructSurrogates);
+    cons.set_generate_utf8(m_ConstructUtf8);
     cons.set_case_options(m_CaseInsensitive, m_CaseInsensitive);
     cons.goto_state(get_state(initialState));
     
@@ -165,6 +171,7 @@ int ndfa_regex::add_regex(int initialState, const symbol_string& regex) {
     // Create a constructor in the initial state
     builder cons = get_cons();
     cons.set_generate_surrogates(m_ConstructSurrogates);
+    cons.set_generate_utf8(m_ConstructUtf8);
     cons.set_case_options(m_CaseInsensitive, m_CaseInsensitive);
     cons.goto_state(get_state(initialState));
     
@@ -205,6 +212,7 @@ int ndfa_regex::add_regex(builder& cons, const symbol_string& regex) {
 /// change this behaviour by overriding the compile_expression funciton.
 void ndfa_regex::define_expression(const symbol_string& name, const symbol_string& value) {
     m_ExpressionMap[name] = value;
+    m_ExpressionFragments.clear();
 }
 
 
@@ -216,6 +224,7 @@ void ndfa_regex::define_expression(const symbol_string& name, const symbol_strin
 /// Unlike the define_expression call, the value given here is literal rather than a regular expression.
 void ndfa_regex::define_expression_literal(const symbol_string& name, const symbol_string& value) {
     m_LiteralExpressionMap[name] = value;
+    m_ExpressionFragments.clear();
 }
 
 ///
@@ -371,7 +380,7 @@ void ndfa_regex::compile(symbol_string::const_iterator& pos, const symbol_string
 
             // Compile this expression
             cons.push();
-            compile_expression(expr, cons);
+            compile_expression_fragment(expr, cons);
             cons.pop();
             break;
         }
@@ -948,28 +957,82 @@ bool ndfa_regex::compile_expression(const symbol_string& expression, builder& co
     // Get the unicode sequence for this item
     string unicodeCategory = unicode_for_expression(expression);
     if (!unicodeCategory.empty()) {
-        // Find all of the symbols that match this category
-        unicode     someUnicode;
-        symbol_set  ourSymbols;
-
-        // Iterate through all of the unicode block
-        for (unicode::iterator block = someUnicode.begin(); block != someUnicode.end(); ++block) {
-            // Main category must match
-            if (block->type[0] != unicodeCategory[0]) continue;
-
-            // If the category has two parts, then the rest must match too
-            if (unicodeCategory.size() > 1 && block->type[1] != unicodeCategory[1]) continue;
-
-            // This matches: add the symbols ranges
-            for (const unicode::range* r = block->ranges; r->lower >= 0; ++r) {
-                ourSymbols |= range<int>(r->lower, r->upper);
-            }
+        // Load the symbols for this category the first time it's used
+        map<string, symbol_set>::const_iterator ourSymbols = m_UnicodeCategories.find(unicodeCategory);
+        
+        if (ourSymbols == m_UnicodeCategories.end()) {
+            unicode                 someUnicode;
+            const unicode::block*   category    = someUnicode.find_category(unicodeCategory);
+            
+            ourSymbols = m_UnicodeCategories.insert(make_pair(unicodeCategory, category ? unicode::symbols(*category) : symbol_set())).first;
         }
 
         // Add a transition for this symbol set
-        cons >> ourSymbols;
+        cons >> ourSymbols->second;
+        return true;
     }
 
     // Fail
     return false;
 }
+
+/// \brief Compiles a {} expression, reusing the states generated the first time it was seen
+bool ndfa_regex::compile_expression_fragment(const symbol_string& expression, builder& cons) {
+    // The generated states depend on the options set for the builder as well as the expression
+    int options = (cons.generate_surrogates()?1:0) | (cons.generate_utf8()?2:0) | (cons.make_lowercase()?4:0) | (cons.make_uppercase()?8:0);
+    fragment_key key(expression, options);
+
+    // Every use of the expression starts in a new state, reached by an epsilon transition from the current state
+    int startState = add_state();
+    add_transition(cons.current_state().identifier(), epsilon(), startState);
+
+    // Copy the existing fragment if this expression has been seen before
+    map<fragment_key, expression_fragment>::const_iterator found = m_ExpressionFragments.find(key);
+    if (found != m_ExpressionFragments.end()) {
+        const expression_fragment& fragment = found->second;
+
+        // States are added in order, so the new states are numbered consecutively from the start state
+        for (int stateNum = 1; stateNum < fragment.numStates; ++stateNum) {
+            add_state();
+        }
+
+        // Copy the transitions
+        for (vector<pair<int, pair<int, int> > >::const_iterator trans = fragment.transitions.begin(); trans != fragment.transitions.end(); ++trans) {
+            add_transition(startState + trans->first, symbols()[trans->second.first], startState + trans->second.second);
+        }
+
+        // Move to the end of the expression
+        cons.goto_state(get_state(startState + fragment.finalState));
+        return true;
+    }
+
+    // Compile the expression from the start state
+    cons.goto_state(get_state(startState));
+    if (!compile_expression(expression, cons)) {
+        return false;
+    }
+
+    // Record the fragment, provided it only refers to the states it generated
+    expression_fragment fragment;
+    fragment.numStates  = count_states() - startState;
+    fragment.finalState = cons.current_state().identifier() - startState;
+
+    if (fragment.finalState < 0 || fragment.finalState >= fragment.numStates) {
+        return true;
+    }
+
+    for (int stateNum = startState; stateNum < count_states(); ++stateNum) {
+        const state& thisState = get_state(stateNum);
+
+        for (state::iterator trans = thisState.begin(); trans != thisState.end(); ++trans) {
+            if (trans->new_state() < startState) {
+                return true;
+            }
+
+            fragment.transitions.push_back(make_pair(stateNum - startState, make_pair(trans->symbol_set(), trans->new_state() - startState)));
+        }
+    }
+
+    m_ExpressionFragments[key] = fragment;
+    return true;
+}
@@ -50,6 +50,9 @@ namespace dfa {
     private:
         /// \brief Set to true if the compiler should construct unicode surrogate sequences for characters >0xffff
         bool m_ConstructSurrogates;
+        
+        /// \brief Set to true if the compiler should construct UTF-8 byte sequences for characters >0x7f
+        bool m_ConstructUtf8;
 
         /// \brief If true, then any regexes are added in a case insensitive manner
         bool m_CaseInsensitive;
@@ -60,6 +63,32 @@ namespace dfa {
         /// \brief Maps expressions to literal strings
         std::map<symbol_string, symbol_string> m_LiteralExpressionMap;
         
+        /// \brief The symbol sets for the unicode categories that have been used by the expressions in this NDFA
+        std::map<std::string, symbol_set> m_UnicodeCategories;
+
+        ///
+        /// \brief The states and transitions generated the first time a {} expression was compiled
+        ///
+        /// State IDs are relative to the first state of the fragment, which is the state the expression was
+        /// compiled from. Transitions refer to symbol set IDs in this NDFA's symbol map.
+        ///
+        struct expression_fragment {
+            /// \brief The number of states in this fragment
+            int numStates;
+
+            /// \brief The (relative) state reached at the end of the expression
+            int finalState;
+
+            /// \brief The transitions in this fragment, as (relative) from state, symbol set, (relative) to state
+            std::vector<std::pair<int, std::pair<int, int> > > transitions;
+        };
+
+        /// \brief Identifies a fragment: the expression and the builder options that were in effect when it was compiled
+        typedef std::pair<symbol_string, int> fragment_key;
+
+        /// \brief The fragments that have been generated for the {} expressions used by this NDFA
+        std::map<fragment_key, expression_fragment> m_ExpressionFragments;
+        
     public:
         /// \brief Constructs an empty NDFA
         ndfa_regex();
@@ -172,6 +201,13 @@ namespace dfa {
         ///
         /// By default, this is turned on, as 16-bit unicode characters are far more common.
         inline void set_use_surrogates(bool useSurrogates) { m_ConstructSurrogates = useSurrogates; }
+        
+        /// \brief Sets whether or not this regular expression builder should match UTF-8 bytes instead of characters
+        ///
+        /// If this is set to true then characters >0x7f will be substituted with the equivalent UTF-8 byte sequences,
+        /// so the resulting state machine can be run directly on UTF-8 input without decoding it first. This takes
+        /// precedence over set_use_surrogates(), and is turned off by default.
+        inline void set_use_utf8(bool useUtf8) { m_ConstructUtf8 = useUtf8; }
 
         /// \brief Sets whether or not the regular expressions should be treated as case-insensitive
         inline void set_case_insensitive(bool caseInsensitive) { m_CaseInsensitive = caseInsensitive; }
@@ -267,6 +303,15 @@ namespace dfa {
         /// Returns true if the expression was successfully compiled.
         ///
         virtual bool compile_expression(const symbol_string& expression, builder& cons);
+
+        ///
+        /// \brief Compiles a {} expression, reusing the states generated the first time it was seen
+        ///
+        /// The first time an expression is encountered with a particular set of builder options, this calls
+        /// compile_expression and records the states it generated. Later uses copy these states instead of
+        /// compiling the expression again.
+        ///
+        bool compile_expression_fragment(const symbol_string& expression, builder& cons);
         
         ///
         /// \brief Returns the symbol at the specified position. Updates pos to point to the last character that makes up this symbol
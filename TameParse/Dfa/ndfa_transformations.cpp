@@ -30,10 +30,18 @@
 //
 
 #include <stack>
+#include <algorithm>
+#include <stdint.h>
+
+#if __cplusplus >= 201103L
+#include <unordered_map>
+#endif
 
 #include "TameParse/Dfa/ndfa.h"
+#include "TameParse/Dfa/frozen_ndfa.h"
 #include "TameParse/Dfa/transition.h"
 #include "TameParse/Dfa/remapped_symbol_map.h"
+#include "TameParse/Util/parallel.h"
 
 using namespace std;
 using namespace dfa;
@@ -51,58 +59,162 @@ public:
     }
 };
 
-/// \brief Creates a DFA from this NDFA
+/// \brief Set of accepting actions
+typedef set<accept_action*, order_actions> action_set;
+
+/// \brief Class used to compare sets of accepting actions
 ///
-/// Note that if further transitions are added to the DFA, it may no longer be deterministic.
-/// Use this call on the result of calling to_ndfa_with_unique_symbols.
-ndfa* ndfa::to_dfa(const vector<int>& initialState) const {
-    // Empty NDFA if no states were supplied
-    if (initialState.size() == 0) { 
-        return new ndfa();
+/// (The default ordering for sets compares the pointers rather than the actions themselves)
+class order_action_sets {
+public:
+    inline bool operator()(const action_set& a, const action_set& b) const {
+        return lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(), order_actions());
+    }
+};
+
+/// \brief Calculates epsilon closures of sets of states in an NDFA
+///
+/// The closure of each individual state is worked out the first time it's needed and then kept, so a DFA state
+/// set can be built by merging cached closures rather than by walking the epsilon transitions again.
+class epsilon_closures {
+private:
+    /// \brief The NDFA that closures are being calculated for
+    const frozen_ndfa& m_Ndfa;
+    
+    /// \brief The sorted closure of each state (empty if not calculated yet)
+    vector<vector<int> > m_Closure;
+    
+    /// \brief Scratch space: a state is in the set being built if its entry matches m_Stamp
+    vector<unsigned int> m_InSet;
+    
+    /// \brief The stamp for the set currently being built
+    unsigned int m_Stamp;
+    
+    /// \brief Scratch stack used while working out a closure
+    vector<int> m_Waiting;
+    
+    /// \brief Returns the closure of a single state
+    const vector<int>& closure_for_state(int stateId) {
+        vector<int>& result = m_Closure[stateId];
+        if (!result.empty()) return result;
+        
+        // Walk the epsilon transitions from this state
+        ++m_Stamp;
+        m_InSet[stateId] = m_Stamp;
+        m_Waiting.push_back(stateId);
+        
+        while (!m_Waiting.empty()) {
+            int nextState = m_Waiting.back();
+            m_Waiting.pop_back();
+            result.push_back(nextState);
+            
+            for (const int* target = m_Ndfa.begin_epsilon(nextState); target != m_Ndfa.end_epsilon(nextState); ++target) {
+                if (m_InSet[*target] == m_Stamp) continue;
+                
+                m_InSet[*target] = m_Stamp;
+                m_Waiting.push_back(*target);
+            }
+        }
+        
+        sort(result.begin(), result.end());
+        return result;
+    }
+    
+public:
+    /// \brief Prepares to calculate closures for the specified NDFA
+    explicit epsilon_closures(const frozen_ndfa& source)
+    : m_Ndfa(source)
+    , m_Closure(source.count_states())
+    , m_InSet(source.count_states(), 0)
+    , m_Stamp(0) {
+    }
+    
+    /// \brief Stores the sorted closure of the specified states in result
+    void close(const vector<int>& states, vector<int>& result) {
+        result.clear();
+        
+        // Make sure the closures are all available (working them out reuses the scratch space)
+        for (vector<int>::const_iterator stateIt = states.begin(); stateIt != states.end(); ++stateIt) {
+            closure_for_state(*stateIt);
+        }
+        
+        // Merge the closures
+        ++m_Stamp;
+        for (vector<int>::const_iterator stateIt = states.begin(); stateIt != states.end(); ++stateIt) {
+            const vector<int>& stateClosure = m_Closure[*stateIt];
+            
+            for (vector<int>::const_iterator closeIt = stateClosure.begin(); closeIt != stateClosure.end(); ++closeIt) {
+                if (m_InSet[*closeIt] == m_Stamp) continue;
+                
+                m_InSet[*closeIt] = m_Stamp;
+                result.push_back(*closeIt);
+            }
+        }
+        
+        // A single closure is already sorted
+        if (states.size() > 1) {
+            sort(result.begin(), result.end());
+        }
     }
     
+    /// \brief Computes a hash code for a sorted set of states
+    static uint64_t hash(const vector<int>& states) {
+        // FNV-1a
+        uint64_t result = 14695981039346656037ULL;
+        for (vector<int>::const_iterator stateIt = states.begin(); stateIt != states.end(); ++stateIt) {
+            result = (result ^ (uint64_t) (unsigned int) *stateIt) * 1099511628211ULL;
+        }
+        return result;
+    }
+};
+
+/// \brief Internal method: builds the states and accept actions of a DFA equivalent to this NDFA, starting at the specified initial states
+///
+/// This only reads from the frozen copy of this NDFA, so it can be called on several threads at once.
+void ndfa::determinize(const frozen_ndfa& source, const vector<int>& initialState, state_list& states, accept_action_for_state& accept) const {
     // Some types used by this method
-    typedef set<int>                        state_set;                                  // Set of states in this NDFA (maps onto a single state in the final NDFA)
+    typedef vector<int>                     state_set;                                  // Sorted set of states in this NDFA (maps onto a single state in the final NDFA)
     typedef pair<int, state*>               remaining_entry;                            // State that's waiting to be processed
-    typedef map<int, state_set>             transition_for_symbol;                      // Maps a symbol_set to the states that would be reached in this NDFA
+    typedef map<int, vector<int> >          transition_for_symbol;                      // Maps a symbol_set to the states that would be reached in this NDFA
+#if __cplusplus >= 201103L
+    typedef unordered_map<uint64_t, vector<int> > states_for_hash;                     // Maps hash codes for state sets onto the new states with that hash
+#else
+    typedef map<uint64_t, vector<int> >     states_for_hash;                            // Maps hash codes for state sets onto the new states with that hash
+#endif
     
-    // Create the structures for the new DFA. Symbols are preserved (and state 0 remains the same), but we regenerate everything else
-    symbol_map*                 symbols     = new symbol_map(*m_Symbols);
-    state_list*                 states      = new state_list();
-    accept_action_for_state*    accept      = new accept_action_for_state();
     vector<state_set>           stateSets;
     
-    // Get the epsilon set
-    int epsilonSymbolSet = m_Symbols->identifier_for_symbols(epsilon());
+    // Closures are cached for each state in this NDFA
+    epsilon_closures closures(source);
     
     // Create a map saying which of our states are represented in each new state
-    map<state_set, int> stateMap;
+    states_for_hash stateMap;
     
     // Create the stack of states to process
     stack<remaining_entry> remainingStates;
+    
+    // Scratch space used while building state sets
+    vector<int> initialSet(1);
+    state_set   thisStateSet;
 
     // Create the set of initial states
     for (vector<int>::const_iterator initialIt = initialState.begin(); initialIt != initialState.end(); ++initialIt) {
         // Create a set for this initial state
-        state_set thisStateSet;
-        thisStateSet.insert(*initialIt);
-        closure(thisStateSet);
+        initialSet[0] = *initialIt;
+        closures.close(initialSet, thisStateSet);
         
         // Put it in the state map
-        int stateId = (int)states->size();
+        int stateId = (int)states.size();
         
         // Generate a state for this ID
-        states->push_back(new state(stateId));
+        states.push_back(new state(stateId));
         stateSets.push_back(thisStateSet);
         
-        // Add to the map
-        if (stateMap.find(thisStateSet) == stateMap.end()) {
-            // (We create a new state if there's a duplicate initial state, but the first state we created becomes the 'canonical' one)
-            stateMap[thisStateSet] = stateId;
-        }
+        // Add to the map (we create a new state if there's a duplicate initial state, but the first state we created becomes the 'canonical' one)
+        stateMap[epsilon_closures::hash(thisStateSet)].push_back(stateId);
         
         // Add to the list of states to process
-        remainingStates.push(remaining_entry(stateId, (*states)[stateId]));
+        remainingStates.push(remaining_entry(stateId, states[stateId]));
     }
     
     // Keep processing states until we stop generating new ones
@@ -119,24 +231,17 @@ ndfa* ndfa::to_dfa(const vector<int>& initialState) const {
         const state_set& nextSet = stateSets[next.first];
         
         for (state_set::const_iterator stateIt = nextSet.begin(); stateIt != nextSet.end(); ++stateIt) {
-            // Get this state
-            state& thisState = *(*m_States)[*stateIt];
-            
-            // For each transition in this state, add to the appropriate set
-            for (state::iterator transit = thisState.begin(); transit != thisState.end(); ++transit) {
-                // Ignore the epsilon set (covered by performing the closure)
-                if (transit->symbol_set() == epsilonSymbolSet) continue;
-                
-                // Otherwise, add this transition
-                statesForSymbol[transit->symbol_set()].insert(transit->new_state());
+            // For each transition in this state, add to the appropriate set (the epsilon transitions are covered by performing the closure)
+            for (const transition* transit = source.begin(*stateIt); transit != source.end(*stateIt); ++transit) {
+                statesForSymbol[transit->symbol_set()].push_back(transit->new_state());
             }
             
             // Add the accepting actions for this state, if there are any
-            accept_action_for_state::const_iterator acceptForState = m_Accept->find(*stateIt);
-            if (acceptForState != m_Accept->end()) {
-                for (accept_action_list::const_iterator acceptIt = acceptForState->second.begin(); acceptIt != acceptForState->second.end(); ++acceptIt) {
+            const accept_action_list* acceptForState = source.actions(*stateIt);
+            if (acceptForState) {
+                for (accept_action_list::const_iterator acceptIt = acceptForState->begin(); acceptIt != acceptForState->end(); ++acceptIt) {
                     // Add a clone of this action
-                    (*accept)[next.second->identifier()].push_back((*acceptIt)->clone());
+                    accept[next.second->identifier()].push_back((*acceptIt)->clone());
                     
                     // Mark if it's eager
                     if ((*acceptIt)->eager()) {
@@ -149,36 +254,62 @@ ndfa* ndfa::to_dfa(const vector<int>& initialState) const {
         // If this state is 'eager' (ie, accepts immediately), then there's no point in generating any transitions from it
         if (isEager) continue;
         
-        // Generate the closures for epsilon transitions
-        for (transition_for_symbol::iterator transit = statesForSymbol.begin(); transit != statesForSymbol.end(); ++transit) {
-            closure(transit->second);
-        }
-        
         // Generate new transitions for each symbol
         for (transition_for_symbol::const_iterator transit = statesForSymbol.begin(); transit != statesForSymbol.end(); ++transit) {
+            // Generate the closure for epsilon transitions
+            closures.close(transit->second, thisStateSet);
+            
             // Try to find state that this transition is targeting
-            map<state_set, int>::const_iterator targetState = stateMap.find(transit->second);
+            vector<int>&    withHash    = stateMap[epsilon_closures::hash(thisStateSet)];
+            int             targetState = -1;
+            
+            for (vector<int>::const_iterator candidate = withHash.begin(); candidate != withHash.end(); ++candidate) {
+                if (stateSets[*candidate] == thisStateSet) {
+                    targetState = *candidate;
+                    break;
+                }
+            }
             
             // Create a new state if there's no existing state
-            if (targetState == stateMap.end()) {
+            if (targetState < 0) {
                 // Work on the new state ID
-                int newStateId = (int) states->size();
+                targetState = (int) states.size();
                 
                 // Add to the state map
-                targetState = stateMap.insert(pair<state_set, int>(transit->second, newStateId)).first;
+                withHash.push_back(targetState);
                 
                 // Create the new state
-                states->push_back(new state(newStateId));
-                stateSets.push_back(transit->second);
+                states.push_back(new state(targetState));
+                stateSets.push_back(thisStateSet);
                 
                 // Add the new state to the list that need processiing
-                remainingStates.push(remaining_entry(newStateId, (*states)[newStateId]));
+                remainingStates.push(remaining_entry(targetState, states[targetState]));
             }
             
             // Add this transition
-            next.second->add(transition(transit->first, targetState->second));
+            next.second->add(transition(transit->first, targetState));
         }
     }
+}
+
+/// \brief Creates a DFA from this NDFA
+///
+/// Note that if further transitions are added to the DFA, it may no longer be deterministic.
+/// Use this call on the result of calling to_ndfa_with_unique_symbols.
+ndfa* ndfa::to_dfa(const vector<int>& initialState) const {
+    // Empty NDFA if no states were supplied
+    if (initialState.size() == 0) { 
+        return new ndfa();
+    }
+    
+    // Create the structures for the new DFA. Symbols are preserved (and state 0 remains the same), but we regenerate everything else
+    symbol_map*                 symbols     = new symbol_map(*m_Symbols);
+    state_list*                 states      = new state_list();
+    accept_action_for_state*    accept      = new accept_action_for_state();
+    
+    // Build the states
+    frozen_ndfa source(*this, m_Symbols->identifier_for_symbols(epsilon()));
+    determinize(source, initialState, *states, *accept);
     
     // Create the new NDFA from the result
     ndfa* result = new ndfa(states, symbols, accept);
@@ -190,6 +321,200 @@ ndfa* ndfa::to_dfa(const vector<int>& initialState) const {
     return result;
 }
 
+namespace dfa {
+    /// \brief Determinizes the part of an NDFA reachable from a single initial state
+    class determinize_initial_state {
+    private:
+        /// \brief The NDFA being determinized
+        const ndfa& m_Ndfa;
+        
+        /// \brief The frozen copy of the NDFA, shared between the threads
+        const frozen_ndfa& m_Source;
+    
+        /// \brief The initial states
+        const vector<int>& m_InitialState;
+    
+    public:
+        /// \brief The states generated for each initial state
+        vector<ndfa::state_list> states;
+    
+        /// \brief The accepting actions for each initial state
+        vector<ndfa::accept_action_for_state> accept;
+    
+        determinize_initial_state(const ndfa& nfa, const frozen_ndfa& source, const vector<int>& initialState)
+        : m_Ndfa(nfa)
+        , m_Source(source)
+        , m_InitialState(initialState)
+        , states(initialState.size())
+        , accept(initialState.size()) {
+        }
+    
+        /// \brief Determinizes the language for the initial state with the specified index
+        void operator()(size_t index) {
+            m_Ndfa.determinize(m_Source, vector<int>(1, m_InitialState[index]), states[index], accept[index]);
+        }
+    };
+}
+
+/// \brief Creates a DFA from this NDFA, building the states reachable from each initial state on separate threads
+///
+/// The languages for the initial states are determinized independently and the results are joined together, so the
+/// resulting DFA will have separate states for each initial state even when an equivalent state is reachable from more
+/// than one of them. (to_compact_dfa will merge these again.) As with the single threaded version, the initial states
+/// become states 0, 1, 2, etc in the final DFA.
+ndfa* ndfa::to_dfa(const vector<int>& initialState, unsigned int maxThreads) const {
+    // Use the single threaded version if there's nothing to split
+    if (initialState.size() <= 1) {
+        return to_dfa(initialState);
+    }
+    
+    // The threads share a single frozen copy of this NDFA
+    frozen_ndfa                 source(*this, m_Symbols->identifier_for_symbols(epsilon()));
+    determinize_initial_state   task(*this, source, initialState);
+    util::parallel_for(initialState.size(), maxThreads, task);
+    
+    // Work out where the states for each initial state will go: the initial states come first, followed by the
+    // remaining states in order
+    vector<int> firstState;
+    int         nextState = (int) initialState.size();
+    
+    for (size_t index = 0; index < initialState.size(); ++index) {
+        firstState.push_back(nextState - 1);
+        nextState += (int) task.states[index].size() - 1;
+    }
+    
+    // Join the results together
+    symbol_map*                 symbols     = new symbol_map(*m_Symbols);
+    state_list*                 states      = new state_list(nextState, NULL);
+    accept_action_for_state*    accept      = new accept_action_for_state();
+    
+    for (size_t index = 0; index < initialState.size(); ++index) {
+        state_list& partStates  = task.states[index];
+        int         offset      = firstState[index];
+        
+        for (int stateId = 0; stateId < (int) partStates.size(); ++stateId) {
+            int newStateId = stateId == 0 ? (int) index : stateId + offset;
+            
+            // Copy the state, with its transitions moved to the new state IDs
+            state* newState = new state(newStateId);
+            for (state::iterator transit = partStates[stateId]->begin(); transit != partStates[stateId]->end(); ++transit) {
+                int target = transit->new_state() == 0 ? (int) index : transit->new_state() + offset;
+                newState->add(transition(transit->symbol_set(), target));
+            }
+            
+            (*states)[newStateId] = newState;
+            delete partStates[stateId];
+        }
+        
+        // Move the accepting actions
+        for (accept_action_for_state::iterator actions = task.accept[index].begin(); actions != task.accept[index].end(); ++actions) {
+            int newStateId = actions->first == 0 ? (int) index : actions->first + offset;
+            (*accept)[newStateId] = actions->second;
+        }
+    }
+    
+    // Create the new NDFA from the result
+    ndfa* result = new ndfa(states, symbols, accept);
+    result->m_IsDeterministic = true;
+    
+    return result;
+}
+
+/// \brief Creates a new NDFA that is equivalent to this one, but without the states that only have an epsilon transition to another state
+///
+/// The regular expression compiler generates a lot of these states (for example, at the end of each branch of an
+/// alternative, or around a repeated subexpression). Transitions to them are moved to the state at the end of the
+/// chain of epsilon transitions instead, so they can be removed: every DFA state then has a smaller set of NDFA states,
+/// and there are fewer closures to work out. to_dfa() also generates fewer states, as sets of states that only differed
+/// by the states that were removed become the same.
+///
+/// States that can't be reached from the initial states are also discarded. The initial states are kept, and become
+/// states 0, 1, 2, etc in the new NDFA in the same way as for to_dfa().
+ndfa* ndfa::to_ndfa_without_epsilon_states(const vector<int>& initialState) const {
+    // Symbols are preserved, but we regenerate everything else
+    symbol_map*                 symbols     = new symbol_map(*m_Symbols);
+    state_list*                 states      = new state_list();
+    accept_action_for_state*    accept      = new accept_action_for_state();
+    
+    int                         epsSymbol   = m_Symbols->identifier_for_symbols(epsilon());
+    
+    // Maps states in this NDFA to states in the new one
+    vector<int>                 newStateId(count_states(), -1);
+    vector<int>                 oldStateId;
+    
+    for (vector<int>::const_iterator initialIt = initialState.begin(); initialIt != initialState.end(); ++initialIt) {
+        int newId = (int) oldStateId.size();
+        if (newStateId[*initialIt] < 0) newStateId[*initialIt] = newId;
+        oldStateId.push_back(*initialIt);
+    }
+    
+    // Work out where each state that only has a single epsilon transition leads to (-1 if a state should be kept)
+    vector<int> skipTo(count_states(), -1);
+    
+    for (int stateId = 0; stateId < count_states(); ++stateId) {
+        const state& thisState = get_state(stateId);
+        
+        if (newStateId[stateId] >= 0)                                       continue;
+        if (thisState.count_transitions() != 1)                             continue;
+        if (thisState.begin()->symbol_set() != epsSymbol)                   continue;
+        if (thisState.begin()->new_state() == stateId)                      continue;
+        if (m_Accept->find(stateId) != m_Accept->end())                     continue;
+        
+        skipTo[stateId] = thisState.begin()->new_state();
+    }
+    
+    // Follow the chains to the state at the end (a chain that loops back on itself is kept as it is)
+    for (int stateId = 0; stateId < count_states(); ++stateId) {
+        if (skipTo[stateId] < 0) continue;
+        
+        int target = skipTo[stateId];
+        for (int steps = 0; steps < count_states() && skipTo[target] >= 0; ++steps) {
+            target = skipTo[target];
+        }
+        
+        if (skipTo[target] >= 0) continue;
+        skipTo[stateId] = target;
+    }
+    
+    for (int stateId = 0; stateId < count_states(); ++stateId) {
+        if (skipTo[stateId] >= 0 && skipTo[skipTo[stateId]] >= 0) skipTo[stateId] = -1;
+    }
+    
+    // Generate the states in order (new states are added to the end of the list as they're found)
+    for (int newId = 0; newId < (int) oldStateId.size(); ++newId) {
+        states->push_back(new state(newId));
+        state&          newState = *states->back();
+        const state&    oldState = get_state(oldStateId[newId]);
+        
+        for (state::iterator transit = oldState.begin(); transit != oldState.end(); ++transit) {
+            int oldTarget = skipTo[transit->new_state()] >= 0 ? skipTo[transit->new_state()] : transit->new_state();
+            
+            // Epsilon transitions back to the same state don't do anything
+            if (oldTarget == oldStateId[newId] && transit->symbol_set() == epsSymbol) continue;
+            
+            int& target = newStateId[oldTarget];
+            if (target < 0) {
+                target = (int) oldStateId.size();
+                oldStateId.push_back(oldTarget);
+            }
+            
+            newState.add(transition(transit->symbol_set(), target));
+        }
+        
+        // Copy the accepting actions
+        accept_action_for_state::const_iterator acceptForState = m_Accept->find(oldStateId[newId]);
+        if (acceptForState != m_Accept->end()) {
+            accept_action_list& newActions = (*accept)[newId];
+            
+            for (accept_action_list::const_iterator acceptIt = acceptForState->second.begin(); acceptIt != acceptForState->second.end(); ++acceptIt) {
+                newActions.push_back((*acceptIt)->clone());
+            }
+        }
+    }
+    
+    return new ndfa(states, symbols, accept);
+}
+
 /// \brief Creates a new NDFA that is equivalent to this one, except there will be no overlapping symbol sets
 ///
 /// Note that if further transitions are added to the new NDFA, it may lose the unique symbol sets
@@ -242,199 +567,245 @@ ndfa* ndfa::to_ndfa_with_unique_symbols() const {
 ndfa* ndfa::to_compact_dfa(const vector<int>& initialState, bool firstAction) const {
     // TODO: we can further compact the DFA by looking for symbol sets that always produce the same transition and merging them
     
-    // Set of states from the original (this) DFA
-    typedef set<int> state_set;
-    
-    // Vector of new states
-    typedef vector<state_set> new_states;
-
-    // Maps state IDs in the original (this) set to IDs in the 'new' set
-    typedef map<int, int> state_map;
+    // This uses Hopcroft's partition refinement algorithm. The states are stored in a single array, ordered so that
+    // each block in the partition is a contiguous range. Blocks are split by moving the states that need to be split
+    // off to the start of their range.
     
-    // Set of actions
-    typedef set<accept_action*, order_actions> action_set;
-
-    // Variables used to represent our new state machine
-    new_states  newStates;
-    state_map   oldToNew;
+    const int   numStates = count_states();
+    vector<int> blockForState(numStates, -1);
+    int         numBlocks = 0;
     
-    // Create the set of initial states. We assume that each state can only appear once in the initialState vector; the result
-    // will be incorrect if they appear more than once
+    // Each initial state becomes an initial state in the new DFA. We assume that each state can only appear once in the 
+    // initialState vector
     for (vector<int>::const_iterator initial = initialState.begin(); initial != initialState.end(); ++initial) {
-        // Each initial state becomes an initial state in the new DFA
-        newStates.push_back(state_set());
-        state_set& thisState = newStates.back();
-        
-        // Create a new state containing just this item
-        oldToNew[*initial] = (int) newStates.size()-1;
-        thisState.insert(*initial);
+        if (blockForState[*initial] >= 0) continue;
+        blockForState[*initial] = numBlocks++;
     }
     
-    // Bundle all of the non-accepting states up into a single state
-    // (If all of the remaining states are accepting then we'll end up with a free bonus state here :-/)
-    int nonAcceptingStates = (int) newStates.size();
-    newStates.push_back(state_set());
+    int numInitialBlocks = numBlocks;
     
-    // Also remember which new state contains which set of accepting actions
-    map<action_set, int> stateForActions;
+    // The remaining states start in a block for the non-accepting states, or a block for their set of accepting actions
+    int                     nonAcceptingBlock = -1;
+    map<action_set, int, order_action_sets> blockForActions;
     
-    // Iterate through the states
-    for (int stateId = 0; stateId < count_states(); ++stateId) {
+    for (int stateId = 0; stateId < numStates; ++stateId) {
         // If this state is already mapped, then ignore it
-        if (oldToNew.find(stateId) != oldToNew.end()) continue;
+        if (blockForState[stateId] >= 0) continue;
         
         // Try to fetch the accept actions for this state
         accept_action_for_state::const_iterator acceptActions = m_Accept->find(stateId);
 
         // If this state is not an accepting state then add it to the non-accepting set
         if (acceptActions == m_Accept->end() || acceptActions->second.empty()) {
-            newStates[nonAcceptingStates].insert(stateId);
-            oldToNew[stateId] = nonAcceptingStates;
+            if (nonAcceptingBlock < 0) nonAcceptingBlock = numBlocks++;
+            blockForState[stateId] = nonAcceptingBlock;
+            continue;
         }
         
-        // For accepting states, either create a new state or use an existing one
-        else {
-            // Build up a set of actions
-            action_set actions;
-            
-            if (firstAction) {
-                // Choose only the 'first' action (the one that compares 'highest')
-                accept_action* smallestAction = acceptActions->second[0];
-                for (accept_action_list::const_iterator action = acceptActions->second.begin(); 
-                     action != acceptActions->second.end(); ++action) {
-                    if ((*smallestAction) < (**action)) {
-                        smallestAction = *action;
-                    }
-                }
-                
-                // Add this action to the set
-                actions.insert(smallestAction);
-            } else {
-                // Create a set of all of the accept actions for this state
-                for (accept_action_list::const_iterator action = acceptActions->second.begin(); 
-                     action != acceptActions->second.end(); ++action) {
-                    actions.insert(*action);
+        // Build up a set of actions
+        action_set actions;
+        
+        if (firstAction) {
+            // Choose only the 'first' action (the one that compares 'highest')
+            accept_action* smallestAction = acceptActions->second[0];
+            for (accept_action_list::const_iterator action = acceptActions->second.begin(); 
+                 action != acceptActions->second.end(); ++action) {
+                if ((*smallestAction) < (**action)) {
+                    smallestAction = *action;
                 }
             }
             
-            // Get the state that's mapped to this set of actions
-            map<action_set, int>::const_iterator existingState = stateForActions.find(actions);
-            int targetState;
-            
-            if (existingState == stateForActions.end()) {
-                // Create a new state
-                targetState = (int) newStates.size()-1;
-                newStates.push_back(state_set());
-            } else {
-                // Add to the existing state
-                targetState = existingState->second;
+            // Add this action to the set
+            actions.insert(smallestAction);
+        } else {
+            // Create a set of all of the accept actions for this state
+            for (accept_action_list::const_iterator action = acceptActions->second.begin(); 
+                 action != acceptActions->second.end(); ++action) {
+                actions.insert(*action);
             }
-            
-            // Add to the appropriate state
-            newStates[targetState].insert(stateId);
-            oldToNew[stateId] = targetState;
         }
+        
+        // Use the block for this set of actions, creating it if it doesn't exist yet
+        map<action_set, int, order_action_sets>::const_iterator existingBlock = blockForActions.find(actions);
+        
+        if (existingBlock == blockForActions.end()) {
+            blockForActions[actions] = numBlocks;
+            blockForState[stateId]   = numBlocks++;
+        } else {
+            blockForState[stateId]   = existingBlock->second;
+        }
+    }
+    
+    // Lay out the states so that each block is contiguous
+    vector<int> blockStart(numBlocks+1, 0);
+    vector<int> blockEnd(numBlocks, 0);
+    vector<int> elements(numStates);
+    vector<int> position(numStates);
+    
+    for (int stateId = 0; stateId < numStates; ++stateId) {
+        ++blockStart[blockForState[stateId]+1];
+    }
+    for (int blockId = 0; blockId < numBlocks; ++blockId) {
+        blockStart[blockId+1] += blockStart[blockId];
+        blockEnd[blockId]      = blockStart[blockId];
     }
+    blockStart.pop_back();
     
-    // Now, iterate through the states until there are no changes to make
-    bool changed = true;
-    while (changed) {
-        // No changes so far this pass
-        changed = false;
+    for (int stateId = 0; stateId < numStates; ++stateId) {
+        int pos = blockEnd[blockForState[stateId]]++;
         
-        // Iterate through the set of 'new' states
-        for (int newStateId = 0; newStateId < (int) newStates.size(); ++newStateId) {
-            // Split any symbol that has a transition to more than one different (new) state
-            state_set thisState = newStates[newStateId];                        // TODO: use pointers to state sets instead
-            if (thisState.size() <= 1) continue;
-            
-            // Use the first state in the set as the template; split off any state that doesn't match it
-            map<int, int> targetStateForSymbol;
-            
-            state_set::iterator curState    = thisState.begin();
-            const state&        firstState  = get_state(*curState);
+        elements[pos]       = stateId;
+        position[stateId]   = pos;
+    }
+    
+    // Build the inverse transitions: for each state, the (symbol set, source state) pairs that lead to it
+    vector<int>             inverseStart(numStates+1, 0);
+    vector<pair<int, int> > inverse;
+    
+    for (int stateId = 0; stateId < numStates; ++stateId) {
+        const state& thisState = get_state(stateId);
+        for (state::iterator transit = thisState.begin(); transit != thisState.end(); ++transit) {
+            ++inverseStart[transit->new_state()+1];
+        }
+    }
+    for (int stateId = 0; stateId < numStates; ++stateId) {
+        inverseStart[stateId+1] += inverseStart[stateId];
+    }
+    
+    inverse.resize(inverseStart[numStates]);
+    vector<int> inverseFill(inverseStart.begin(), inverseStart.end()-1);
+    
+    for (int stateId = 0; stateId < numStates; ++stateId) {
+        const state& thisState = get_state(stateId);
+        for (state::iterator transit = thisState.begin(); transit != thisState.end(); ++transit) {
+            inverse[inverseFill[transit->new_state()]++] = pair<int, int>(transit->symbol_set(), stateId);
+        }
+    }
+    
+    // Every block starts out waiting to be used as a splitter. (The transitions aren't total, so it isn't safe to leave
+    // one of the blocks out, as is usual for Hopcroft's algorithm)
+    vector<int>     waiting;
+    vector<bool>    isWaiting(numBlocks, true);
+    vector<int>     marked(numBlocks, 0);
+    
+    for (int blockId = numBlocks-1; blockId >= 0; --blockId) {
+        waiting.push_back(blockId);
+    }
+    
+    vector<pair<int, int> > splitter;
+    vector<int>             touched;
+    
+    while (!waiting.empty()) {
+        int splitBlock = waiting.back();
+        waiting.pop_back();
+        isWaiting[splitBlock] = false;
+        
+        // Find the transitions into this block, grouped by symbol set (the block can be split while processing it, so this is a copy)
+        splitter.clear();
+        for (int pos = blockStart[splitBlock]; pos < blockEnd[splitBlock]; ++pos) {
+            int target = elements[pos];
+            splitter.insert(splitter.end(), inverse.begin() + inverseStart[target], inverse.begin() + inverseStart[target+1]);
+        }
+        
+        sort(splitter.begin(), splitter.end());
+        
+        // Split the blocks using each symbol set in turn
+        for (size_t first = 0; first < splitter.size(); ) {
+            int     symbolSet   = splitter[first].first;
+            size_t  last        = first;
             
-            for (state::iterator transit = firstState.begin(); transit != firstState.end(); ++transit) {
-                targetStateForSymbol[transit->symbol_set()] = oldToNew[transit->new_state()];
+            // Mark the states that have a transition into the splitter block on this symbol set
+            touched.clear();
+            for (; last < splitter.size() && splitter[last].first == symbolSet; ++last) {
+                int source = splitter[last].second;
+                if (last > first && splitter[last-1].second == source) continue;
+                
+                int block       = blockForState[source];
+                int markedPos   = blockStart[block] + marked[block];
+                int sourcePos   = position[source];
+                
+                // Move this state to the end of the marked states in its block
+                elements[sourcePos]             = elements[markedPos];
+                position[elements[sourcePos]]   = sourcePos;
+                elements[markedPos]             = source;
+                position[source]                = markedPos;
+                
+                if (marked[block] == 0) touched.push_back(block);
+                ++marked[block];
             }
             
-            // Iterate through the remaining states, and put any that have a different transition set into a new state
-            int splitStateId    = -1;
-            int numToMatch      = firstState.count_transitions();
-            vector<int> toRemove;
-            ++curState;
-            for (; curState != thisState.end(); ++curState) {
-                // Check through the items in this state
-                const state&    originalState   = get_state(*curState);
-                bool            different       = originalState.count_transitions() != numToMatch;
+            // Split any block where only some of the states were marked
+            for (vector<int>::const_iterator block = touched.begin(); block != touched.end(); ++block) {
+                int oldBlock    = *block;
+                int numMarked   = marked[oldBlock];
                 
-                if (!different) {
-                    // Number of transitions are the same: need to check that they are actually the same set of transitions
-                    for (state::iterator transit = originalState.begin(); transit != originalState.end(); ++transit) {
-                        // Check the target state
-                        map<int, int>::iterator originalTransition = targetStateForSymbol.find(transit->symbol_set());
-                        
-                        // ... this state is different if the first state doesn't have this symbol set
-                        if (originalTransition == targetStateForSymbol.end()) {
-                            different = true;
-                            break;
-                        }
-                        
-                        // ... this state is different if the target state is different
-                        if (originalTransition->second != oldToNew[transit->new_state()]) {
-                            different = true;
-                            break;
-                        }
-                    }
-                }
+                marked[oldBlock] = 0;
+                if (numMarked == blockEnd[oldBlock] - blockStart[oldBlock]) continue;
                 
-                // Just leave the states that are the same alone
-                if (!different) continue;
+                // The marked states become a new block
+                int newBlock = numBlocks++;
                 
-                // This state is different to the first state, so we split it off into a new set
-                if (splitStateId == -1) {
-                    // Assign a new state
-                    changed         = true;
-                    splitStateId    = (int) newStates.size()-1;
-                    newStates.push_back(state_set());
+                blockStart.push_back(blockStart[oldBlock]);
+                blockEnd.push_back(blockStart[oldBlock] + numMarked);
+                marked.push_back(0);
+                isWaiting.push_back(false);
+                
+                blockStart[oldBlock] = blockEnd[newBlock];
+                
+                for (int pos = blockStart[newBlock]; pos < blockEnd[newBlock]; ++pos) {
+                    blockForState[elements[pos]] = newBlock;
                 }
                 
-                // Move this state into the new state
-                toRemove.push_back(*curState);                  // Have to remove the state later due to iterator semantics :-/
-                newStates[splitStateId].insert(*curState);
-                oldToNew[*curState] = splitStateId;
+                // If the old block is still waiting then both halves need to be used as splitters, otherwise the
+                // smaller half is enough
+                int newSize = blockEnd[newBlock] - blockStart[newBlock];
+                int oldSize = blockEnd[oldBlock] - blockStart[oldBlock];
+                int toAdd   = (isWaiting[oldBlock] || newSize <= oldSize) ? newBlock : oldBlock;
+                
+                if (!isWaiting[toAdd]) {
+                    isWaiting[toAdd] = true;
+                    waiting.push_back(toAdd);
+                }
             }
             
-            // Remove the states that are no longer in the current state
-            for (vector<int>::iterator removeState = toRemove.begin(); removeState != toRemove.end(); ++removeState) {
-                // TODO: pointers!
-                newStates[newStateId].erase(*removeState);
-            }
+            first = last;
         }
     }
     
-    // Build the final state machine from the result
-
+    // Number the blocks: the initial states come first, followed by the other blocks in order of the first state they contain
+    vector<int> idForBlock(numBlocks, -1);
+    vector<int> templateForId;
+    
+    for (int blockId = 0; blockId < numInitialBlocks; ++blockId) {
+        idForBlock[blockId] = blockId;
+        templateForId.push_back(elements[blockStart[blockId]]);
+    }
+    
+    for (int stateId = 0; stateId < numStates; ++stateId) {
+        int blockId = blockForState[stateId];
+        if (idForBlock[blockId] >= 0) continue;
+        
+        idForBlock[blockId] = (int) templateForId.size();
+        templateForId.push_back(stateId);
+    }
+    
     // Build the transitions and accepting actions
     state_list*                 states      = new state_list();
     symbol_map*                 symbolMap   = new symbol_map(*m_Symbols);
     accept_action_for_state*    accept      = new accept_action_for_state();
     
-    for (int newStateId = 0; newStateId < (int) newStates.size(); ++newStateId) {
-        // Ignore empty states
-        if (newStates[newStateId].empty()) continue;
-        
+    for (int newStateId = 0; newStateId < (int) templateForId.size(); ++newStateId) {
         state* newState = new state(newStateId);
         states->push_back(newState);
         
         // Add the transitions for this state: we only need a single template state as the mapped transitions for each symbol
         // will be the same
-        int             templateStateId = *newStates[newStateId].begin();
+        int             templateStateId = templateForId[newStateId];
         const state&    templateState   = get_state(templateStateId);
         
         for (state::iterator originalTransit = templateState.begin(); originalTransit != templateState.end(); ++originalTransit) {
             int symbolSetId = originalTransit->symbol_set();
-            int targetState = oldToNew[originalTransit->new_state()];
+            int targetState = idForBlock[blockForState[originalTransit->new_state()]];
             
             newState->add(transition(symbolSetId, targetState));
         }
@@ -628,3 +999,81 @@ ndfa* ndfa::to_ndfa_with_merged_symbols() const {
     result->m_IsDeterministic = m_IsDeterministic;
     return result;
 }
+
+/// \brief Creates a new NDFA with the same states, numbered in the order that they are first reached from the initial states
+ndfa* ndfa::to_ndfa_in_traversal_order(int numInitialStates) const {
+    int numStates = count_states();
+    if (numInitialStates > numStates) numInitialStates = numStates;
+    if (numInitialStates < 0) numInitialStates = 0;
+    
+    // Work out the new ID for each state (-1 for states that haven't been reached yet)
+    vector<int> newIds((size_t) numStates, -1);
+    int         nextId = numInitialStates;
+    
+    for (int initialState = 0; initialState < numInitialStates; ++initialState) {
+        newIds[initialState] = initialState;
+    }
+    
+    for (int initialState = 0; initialState < numInitialStates; ++initialState) {
+        // The transitions are pushed in reverse so that they are visited in order
+        stack<int> waiting;
+        waiting.push(initialState);
+        
+        while (!waiting.empty()) {
+            int stateId = waiting.top();
+            waiting.pop();
+            
+            if (newIds[stateId] < 0) {
+                newIds[stateId] = nextId++;
+            } else if (stateId != initialState) {
+                continue;
+            }
+            
+            const state& thisState = get_state(stateId);
+            vector<int> targets;
+            for (state::iterator transit = thisState.begin(); transit != thisState.end(); ++transit) {
+                if (newIds[transit->new_state()] < 0) targets.push_back(transit->new_state());
+            }
+            
+            for (vector<int>::reverse_iterator target = targets.rbegin(); target != targets.rend(); ++target) {
+                waiting.push(*target);
+            }
+        }
+    }
+    
+    // Any states that can't be reached go at the end
+    for (int stateId = 0; stateId < numStates; ++stateId) {
+        if (newIds[stateId] < 0) newIds[stateId] = nextId++;
+    }
+    
+    // Create the states in their new order
+    vector<int> oldIds((size_t) numStates);
+    for (int stateId = 0; stateId < numStates; ++stateId) {
+        oldIds[newIds[stateId]] = stateId;
+    }
+    
+    accept_action_for_state*    newActions  = new accept_action_for_state();
+    state_list*                 newStates   = new state_list();
+    for (int newStateId = 0; newStateId < numStates; ++newStateId) {
+        const state& oldState = get_state(oldIds[newStateId]);
+        
+        state* newState = new state(newStateId);
+        newStates->push_back(newState);
+        
+        for (state::iterator transit = oldState.begin(); transit != oldState.end(); ++transit) {
+            newState->add(transition(transit->symbol_set(), newIds[transit->new_state()]));
+        }
+        
+        // Copy the actions for this state
+        const accept_action_list& oldActions    = actions_for_state(oldIds[newStateId]);
+        accept_action_list& newActionsForState  = (*newActions)[newStateId];
+        
+        for (accept_action_list::const_iterator oldAct = oldActions.begin(); oldAct != oldActions.end(); ++oldAct) {
+            newActionsForState.push_back((*oldAct)->clone());
+        }
+    }
+    
+    ndfa* result = new ndfa(newStates, new symbol_map(*m_Symbols), newActions);
+    result->m_IsDeterministic = m_IsDeterministic;
+    return result;
+}
@@ -0,0 +1,193 @@
+//
+//  pipelined_lexeme_stream.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include "TameParse/Dfa/pipelined_lexeme_stream.h"
+
+using namespace dfa;
+
+/// \brief Creates a stream that reads from the specified source stream on a separate thread
+pipelined_lexeme_stream::pipelined_lexeme_stream(lexeme_stream* source)
+: m_Source(source)
+, m_Started(false)
+#if __cplusplus >= 201103L
+, m_Current(NULL)
+, m_NextLexeme(0)
+, m_Stop(false)
+#endif
+{
+}
+
+/// \brief Destructor (stops the lexer thread)
+pipelined_lexeme_stream::~pipelined_lexeme_stream() {
+#if __cplusplus >= 201103L
+    if (m_Started) {
+        // Wait for the lexer thread to finish (it will stop once it next needs an empty batch)
+        m_Stop = true;
+        m_Thread.join();
+        
+        // Delete any lexemes that weren't read, and the batches
+        if (m_Current) {
+            for (size_t lexemeNum = m_NextLexeme; lexemeNum < m_Current->count; ++lexemeNum) {
+                delete m_Current->lexemes[lexemeNum];
+            }
+            delete m_Current;
+        }
+        
+        batch* unread;
+        while (m_Full.pop(unread)) {
+            for (size_t lexemeNum = 0; lexemeNum < unread->count; ++lexemeNum) {
+                delete unread->lexemes[lexemeNum];
+            }
+            delete unread;
+        }
+        
+        batch* empty;
+        while (m_Empty.pop(empty)) {
+            delete empty;
+        }
+    }
+#endif
+    
+    delete m_Source;
+}
+
+#if __cplusplus >= 201103L
+
+/// \brief Reads lexemes from the source into batches (runs on the lexer thread)
+void pipelined_lexeme_stream::run_lexer() {
+    for (;;) {
+        // Wait for the reader to hand back a batch (this stops the lexer from getting too far ahead)
+        batch* next;
+        while (!m_Empty.pop(next)) {
+            if (m_Stop) return;
+            std::this_thread::yield();
+        }
+        
+        if (m_Stop) {
+            m_Empty.push(next);
+            return;
+        }
+        
+        // Fill it up
+        next->count = 0;
+        next->last  = false;
+        
+        while (next->count < c_BatchSize) {
+            lexeme* lex = NULL;
+            (*m_Source) >> lex;
+            
+            if (!lex) {
+                next->last = true;
+                break;
+            }
+            
+            next->lexemes[next->count++] = lex;
+        }
+        
+        // Pass it to the reader (there is always space, as there are only c_NumBatches batches)
+        bool isLast = next->last;
+        m_Full.push(next);
+        
+        if (isLast) return;
+    }
+}
+
+#endif
+
+/// \brief Fills in the contents of the specified pointer with the next lexeme (or NULL if the end of input has been reached)
+lexeme_stream& pipelined_lexeme_stream::operator>>(lexeme*& result) {
+#if __cplusplus >= 201103L
+    if (!m_Started) {
+        // Create the batches and start the lexer thread
+        for (size_t batchNum = 0; batchNum < c_NumBatches; ++batchNum) {
+            m_Empty.push(new batch());
+        }
+        
+        m_Started   = true;
+        m_Thread    = std::thread(&pipelined_lexeme_stream::run_lexer, this);
+    }
+    
+    for (;;) {
+        // Return the next lexeme from the current batch
+        if (m_Current) {
+            if (m_NextLexeme < m_Current->count) {
+                result = m_Current->lexemes[m_NextLexeme++];
+                return *this;
+            }
+            
+            if (m_Current->last) {
+                result = NULL;
+                return *this;
+            }
+            
+            // Hand the batch back to the lexer thread
+            m_Empty.push(m_Current);
+            m_Current = NULL;
+        }
+        
+        // Wait for the next batch
+        while (!m_Full.pop(m_Current)) {
+            std::this_thread::yield();
+        }
+        m_NextLexeme = 0;
+    }
+#else
+    // Without threads, just read from the source
+    m_Started = true;
+    (*m_Source) >> result;
+    return *this;
+#endif
+}
+
+/// \brief Sets the initial state of the source stream, if no lexemes have been read yet
+void pipelined_lexeme_stream::set_initial_state(int initialState) {
+    if (!m_Started) {
+        m_Source->set_initial_state(initialState);
+    }
+}
+
+/// \brief Retrieves a checkpoint from the source stream, if no lexemes have been read yet
+bool pipelined_lexeme_stream::checkpoint(lexer_checkpoint& result) const {
+    if (m_Started) return false;
+    return m_Source->checkpoint(result);
+}
+
+/// \brief Asks the source stream to skip symbols, if no lexemes have been read yet
+bool pipelined_lexeme_stream::skip_symbols(const bool* skip, int numSymbols) {
+    if (m_Started) return false;
+    return m_Source->skip_symbols(skip, numSymbols);
+}
+
+/// \brief Switches the source stream into a different lexer mode, if no lexemes have been read yet
+bool pipelined_lexeme_stream::set_mode(int mode) {
+    if (m_Started) return false;
+    return m_Source->set_mode(mode);
+}
+
+/// \brief Limits the length of the lexemes matched by the source stream, if no lexemes have been read yet
+bool pipelined_lexeme_stream::set_max_lexeme_length(int maxLength) {
+    if (m_Started) return false;
+    return m_Source->set_max_lexeme_length(maxLength);
+}
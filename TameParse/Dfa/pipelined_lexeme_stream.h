@@ -0,0 +1,135 @@
+//
+//  pipelined_lexeme_stream.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _DFA_PIPELINED_LEXEME_STREAM_H
+#define _DFA_PIPELINED_LEXEME_STREAM_H
+
+#include "TameParse/Dfa/basic_lexer.h"
+#include "TameParse/Util/spsc_queue.h"
+
+#if __cplusplus >= 201103L
+#include <atomic>
+#include <thread>
+#endif
+
+namespace dfa {
+    ///
+    /// \brief Lexeme stream that runs another stream on its own thread, so that lexing and parsing can overlap
+    ///
+    /// The first read starts a thread that reads lexemes from the source stream and passes them to the reader in
+    /// batches through a lock-free queue. Batching means that the threads only need to synchronise once every
+    /// c_BatchSize lexemes. There are a fixed number of batches, which the reader hands back once it has finished
+    /// with them: the lexer thread waits when they are all full, so it can't get more than c_NumBatches batches ahead
+    /// of the parser.
+    ///
+    /// As the lexer runs ahead, the lexemes it has already read can't be changed: set_initial_state, set_mode and
+    /// skip_symbols are passed on to the source stream before the first read, but afterwards they have no effect
+    /// (set_mode and skip_symbols return false, as for a stream that doesn't support them). Parsers that need to feed
+    /// back into the lexer while parsing should read from the source stream directly. This stream also reads
+    /// synchronously, on the calling thread, if C++11 thread support isn't available.
+    ///
+    class pipelined_lexeme_stream : public lexeme_stream {
+    public:
+        /// \brief The number of lexemes passed between the threads at a time
+        static const size_t c_BatchSize = 128;
+        
+        /// \brief The number of batches that can be in use at once
+        static const size_t c_NumBatches = 15;
+        
+    private:
+        /// \brief A batch of lexemes
+        struct batch {
+            /// \brief The lexemes in this batch
+            lexeme* lexemes[c_BatchSize];
+            
+            /// \brief The number of lexemes in this batch
+            size_t count;
+            
+            /// \brief True if the source stream reached the end of the input after the lexemes in this batch
+            bool last;
+        };
+        
+        /// \brief The stream that the lexemes are read from
+        lexeme_stream* m_Source;
+        
+        /// \brief True once the first lexeme has been read
+        bool m_Started;
+        
+#if __cplusplus >= 201103L
+        /// \brief The batches that have been filled by the lexer thread
+        util::spsc_queue<batch*, c_NumBatches + 1> m_Full;
+        
+        /// \brief The batches that the reader has finished with
+        util::spsc_queue<batch*, c_NumBatches + 1> m_Empty;
+        
+        /// \brief The batch that is being read
+        batch* m_Current;
+        
+        /// \brief The index of the next lexeme to return from m_Current
+        size_t m_NextLexeme;
+        
+        /// \brief Set to tell the lexer thread to stop early
+        std::atomic<bool> m_Stop;
+        
+        /// \brief The lexer thread
+        std::thread m_Thread;
+        
+        /// \brief Reads lexemes from the source into batches (runs on the lexer thread)
+        void run_lexer();
+#endif
+        
+        pipelined_lexeme_stream(const pipelined_lexeme_stream& noCopying);
+        pipelined_lexeme_stream& operator=(const pipelined_lexeme_stream& noCopying);
+        
+    public:
+        /// \brief Creates a stream that reads from the specified source stream on a separate thread
+        ///
+        /// The source stream becomes owned by this object, and is deleted when it is.
+        explicit pipelined_lexeme_stream(lexeme_stream* source);
+        
+        /// \brief Destructor (stops the lexer thread)
+        virtual ~pipelined_lexeme_stream();
+        
+        /// \brief Fills in the contents of the specified pointer with the next lexeme (or NULL if the end of input has been reached)
+        virtual lexeme_stream& operator>>(lexeme*& result);
+        
+        /// \brief Sets the initial state of the source stream, if no lexemes have been read yet
+        virtual void set_initial_state(int initialState);
+        
+        /// \brief Retrieves a checkpoint from the source stream, if no lexemes have been read yet
+        virtual bool checkpoint(lexer_checkpoint& result) const;
+        
+        /// \brief Asks the source stream to skip symbols, if no lexemes have been read yet
+        virtual bool skip_symbols(const bool* skip, int numSymbols);
+        
+        /// \brief Switches the source stream into a different lexer mode, if no lexemes have been read yet
+        virtual bool set_mode(int mode);
+        
+        /// \brief Limits the length of the lexemes matched by the source stream, if no lexemes have been read yet
+        virtual bool set_max_lexeme_length(int maxLength);
+    };
+}
+
+#endif
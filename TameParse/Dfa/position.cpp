@@ -25,4 +25,84 @@
 //  IN THE SOFTWARE.
 //
 
+#if defined(__SSE2__)
+#  include <emmintrin.h>
+#endif
+
 #include "TameParse/Dfa/position.h"
+
+using namespace dfa;
+
+/// \brief True if the specified symbol might change the line number
+static inline bool is_newline(int symbol) {
+    return (symbol >= 0x0a && symbol <= 0x0d) || symbol == 0x85 || symbol == 0x2028 || symbol == 0x2029;
+}
+
+#if defined(__SSE2__)
+
+/// \brief Returns a mask with the top bit of each 32-bit lane set for the symbols in a block that are newlines
+static inline int newline_mask(__m128i symbols) {
+    // 0x0a-0x0d (LF, VT, FF, CR)
+    __m128i controls    = _mm_and_si128(_mm_cmpgt_epi32(symbols, _mm_set1_epi32(0x09)), _mm_cmplt_epi32(symbols, _mm_set1_epi32(0x0e)));
+    
+    // NEL
+    __m128i nextLine    = _mm_cmpeq_epi32(symbols, _mm_set1_epi32(0x85));
+    
+    // LS and PS only differ in the bottom bit
+    __m128i separators  = _mm_cmpeq_epi32(_mm_or_si128(symbols, _mm_set1_epi32(1)), _mm_set1_epi32(0x2029));
+    
+    return _mm_movemask_ps(_mm_castsi128_ps(_mm_or_si128(controls, _mm_or_si128(nextLine, separators))));
+}
+
+#endif
+
+/// \brief Returns the first symbol between begin and end that is a newline, or end if there isn't one
+const int* dfa::find_newline(const int* begin, const int* end) {
+    const int* pos = begin;
+    
+#if defined(__SSE2__)
+    while (end - pos >= 8) {
+        __m128i low     = _mm_loadu_si128((const __m128i*) pos);
+        __m128i high    = _mm_loadu_si128((const __m128i*) (pos + 4));
+        int     mask    = newline_mask(low) | (newline_mask(high) << 4);
+        
+        if (mask) {
+            // Move up to the first newline in this block
+            while ((mask & 1) == 0) {
+                mask >>= 1;
+                ++pos;
+            }
+            return pos;
+        }
+        
+        pos += 8;
+    }
+#endif
+    
+    while (pos != end && !is_newline(*pos)) {
+        ++pos;
+    }
+    
+    return pos;
+}
+
+/// \brief Processes a buffer of symbols, skipping over runs of symbols that aren't newlines in bulk
+void position_tracker::update_position_bulk(const int* begin, const int* end) {
+    const int* pos = begin;
+    
+    while (pos != end) {
+        // Everything up to the next newline is on the same line
+        const int* run = find_newline(pos, end);
+        
+        if (run != pos) {
+            m_CurrentPosition.advance(run - pos);
+            m_SeenReturn = false;
+        }
+        
+        if (run == end) break;
+        
+        // Newlines (and CR/LF pairs in particular) are dealt with one at a time
+        update_position(*run);
+        pos = run + 1;
+    }
+}
@@ -28,20 +28,27 @@
 #ifndef _DFA_POSITION_H
 #define _DFA_POSITION_H
 
+#include <stdint.h>
+
 namespace dfa {
+    /// \brief Type used for offsets, line numbers and column numbers in an input stream
+    ///
+    /// These are 64-bit so that streams of more than 2^31 symbols can be lexed in a single pass.
+    typedef int64_t stream_offset;
+    
     ///
     /// \brief Representation of a position in an input stream
     ///
     class position {
     private:
         /// \brief The offset in symbols from the beginning of the stream of this position
-        int m_Offset;
+        stream_offset m_Offset;
         
         /// \brief The line number of this position (number of newline sequences encountered from offset 0)
-        int m_Line;
+        stream_offset m_Line;
         
         /// \brief The column number of this position (number of symbols encountered since the last newline sequence)
-        int m_Column;
+        stream_offset m_Column;
         
     public:
         inline position()
@@ -50,7 +57,7 @@ namespace dfa {
         , m_Column(0) {
         }
         
-        inline position(int offset, int line, int column)
+        inline position(stream_offset offset, stream_offset line, stream_offset column)
         : m_Offset(offset)
         , m_Line(line)
         , m_Column(column) {
@@ -63,13 +70,13 @@ namespace dfa {
         }
         
         /// \brief The offset in symbols from the beginning of the stream of this position
-        inline int offset() const { return m_Offset; }
+        inline stream_offset offset() const { return m_Offset; }
 
         /// \brief The line number of this position (number of newline sequences encountered from offset 0)
-        inline int line() const { return m_Line; }
+        inline stream_offset line() const { return m_Line; }
 
         /// \brief The column number of this position (number of symbols encountered since the last newline sequence)
-        inline int column() const { return m_Column; }
+        inline stream_offset column() const { return m_Column; }
         
         /// \brief Moves on by a single symbol
         inline void increment() {
@@ -82,6 +89,20 @@ namespace dfa {
             ++m_Offset;
         }
         
+        /// \brief Moves on by a number of symbols on the same line
+        inline void advance(stream_offset count) {
+            m_Offset += count;
+            m_Column += count;
+        }
+        
+        /// \brief Increases the offset by a number of symbols without changing the line or column
+        inline void advance_offset(stream_offset count) {
+            m_Offset += count;
+        }
+        
+        /// \brief True if this position has a line and column (positions from lexers that only track offsets don't)
+        inline bool has_line() const { return m_Line >= 0; }
+        
         /// \brief Adds a new line to this position
         inline void newline() {
             m_Column = 0;
@@ -122,6 +143,11 @@ namespace dfa {
         inline bool operator<=(const position& compareTo) const { return !operator>(compareTo); }
     };
     
+    /// \brief Returns the first symbol between begin and end that is a newline, or end if there isn't one
+    ///
+    /// The newline symbols are LF, VT, FF, CR, NEL, LS and PS. This uses SSE2 where it's available.
+    const int* find_newline(const int* begin, const int* end);
+    
     ///
     /// \brief Class used to track position during lexing
     ///
@@ -148,6 +174,12 @@ namespace dfa {
         , m_SeenReturn(false) {
         }
         
+        /// \brief Creates a new position tracker at an existing position, which may immediately follow a carriage return character
+        inline position_tracker(const position& copyFrom, bool seenReturn)
+        : m_CurrentPosition(copyFrom)
+        , m_SeenReturn(seenReturn) {
+        }
+        
         /// \brief Copies this position tracker
         inline position_tracker(const position_tracker& copyFrom) 
         : m_CurrentPosition(copyFrom.m_CurrentPosition)
@@ -157,6 +189,9 @@ namespace dfa {
         /// \brief Returns a copy of the current position
         inline position current_position() const { return m_CurrentPosition; }
         
+        /// \brief True if the last symbol was a carriage return
+        inline bool seen_return() const { return m_SeenReturn; }
+        
         /// \brief Moves the position on by a single symbol
         inline void update_position(int symbol) {
             switch (symbol) {
@@ -174,6 +209,7 @@ namespace dfa {
                     break;
                     
                 case 0x0d:              // CR: Carriage Return
+                    m_CurrentPosition.increment_offset();
                     m_CurrentPosition.newline();
                     m_SeenReturn = true;
                     break;
@@ -183,6 +219,7 @@ namespace dfa {
                 case 0x85:              // NEL: NExt Line
                 case 0x2028:            // LS: Line Separator
                 case 0x2029:            // PS: Paragraph Separator
+                    m_CurrentPosition.increment_offset();
                     m_CurrentPosition.newline();
                     m_SeenReturn = false;
                     break;
@@ -201,6 +238,40 @@ namespace dfa {
                 update_position((int)(unsigned)*symbol);
             }
         }
+        
+        /// \brief Processes a buffer of symbols and updates the position
+        ///
+        /// This is what lexers use to move over each lexeme. Short lexemes are processed a symbol at a time, but in
+        /// longer ones runs of symbols that can't be newlines are skipped in bulk (using SSE2 where it's available), so
+        /// only the newline symbols themselves need to be looked at individually.
+        inline void update_position(const int* begin, const int* end) {
+            if (end - begin < c_MinBulkUpdate) {
+                for (const int* symbol = begin; symbol != end; ++symbol) {
+                    update_position(*symbol);
+                }
+            } else {
+                update_position_bulk(begin, end);
+            }
+        }
+        
+        /// \brief Moves the offset on by a number of symbols, leaving the line and column alone
+        ///
+        /// This is used by lexers that only track offsets: a line_index can be used to find the line and column later.
+        inline void update_offset(stream_offset count) {
+            m_CurrentPosition.advance_offset(count);
+        }
+        
+        /// \brief Processes a buffer of symbols and updates the position
+        inline void update_position(int* begin, int* end) {
+            update_position((const int*) begin, (const int*) end);
+        }
+        
+    private:
+        /// \brief The length of the shortest lexeme that update_position() will process in bulk
+        static const int c_MinBulkUpdate = 16;
+        
+        /// \brief Processes a buffer of symbols, skipping over runs of symbols that aren't newlines in bulk
+        void update_position_bulk(const int* begin, const int* end);
     };
 }
 
@@ -0,0 +1,101 @@
+//
+//  push_lexer.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include "TameParse/Dfa/push_lexer.h"
+
+using namespace dfa;
+
+/// \brief Creates a push lexer that runs the state machine for the specified lexer
+push_lexer::push_lexer(const basic_lexer& lexer)
+: m_Lexer(lexer.create_chunk_lexer())
+, m_BufferStart(0)
+, m_InitialState(0)
+, m_EndOfInput(false)
+, m_Skip(NULL)
+, m_NumSkip(0) {
+    if (m_Lexer) {
+        m_InitialState = m_Lexer->first_state();
+    }
+}
+
+/// \brief Destructor
+push_lexer::~push_lexer() {
+    delete m_Lexer;
+}
+
+/// \brief Adds some symbols to the end of the input
+void push_lexer::push(const int* begin, const int* end) {
+    // Drop the symbols that have already been matched before adding any more
+    if (m_BufferStart > 0) {
+        m_Buffer.erase(m_Buffer.begin(), m_Buffer.begin() + m_BufferStart);
+        m_BufferStart = 0;
+    }
+    
+    m_Buffer.insert(m_Buffer.end(), begin, end);
+}
+
+/// \brief Skips over any lexeme whose symbol has a true entry in the specified array
+void push_lexer::skip_symbols(const bool* skip, int numSymbols) {
+    m_Skip      = skip;
+    m_NumSkip   = skip ? numSymbols : 0;
+}
+
+/// \brief Retrieves the next lexeme, if it is available
+bool push_lexer::next(lexeme*& result) {
+    result = NULL;
+    if (!m_Lexer) return true;
+    
+    for (;;) {
+        // Once all of the symbols have been matched, wait for more unless this is the end of the input
+        if (m_BufferStart == m_Buffer.size()) {
+            return m_EndOfInput;
+        }
+        
+        // Match the next lexeme
+        const int*  start   = &m_Buffer[0] + m_BufferStart;
+        const int*  end     = &m_Buffer[0] + m_Buffer.size();
+        size_t      length;
+        bool        complete;
+        int         symbol  = m_Lexer->match_partial(m_InitialState, start, end, length, complete);
+        
+        // Wait for more symbols if the lexeme might carry on past the ones that have been pushed so far
+        if (!complete && !m_EndOfInput) {
+            return false;
+        }
+        
+        // Create the lexeme, unless this symbol is being skipped
+        bool skipped = m_Skip && symbol >= 0 && symbol < m_NumSkip && m_Skip[symbol];
+        if (!skipped) {
+            result = new lexeme(start, start + length, m_Position.current_position(), symbol, length);
+        }
+        
+        // Move on to the next lexeme
+        m_InitialState = m_Lexer->state_after(start[length-1]);
+        m_Position.update_position(start, start + length);
+        m_BufferStart += length;
+        
+        if (!skipped) return true;
+    }
+}
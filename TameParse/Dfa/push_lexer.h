@@ -0,0 +1,138 @@
+//
+//  push_lexer.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _DFA_PUSH_LEXER_H
+#define _DFA_PUSH_LEXER_H
+
+#include <vector>
+
+#include "TameParse/Dfa/basic_lexer.h"
+#include "TameParse/Dfa/position.h"
+
+namespace dfa {
+    ///
+    /// \brief Lexer that has its input pushed into it a block at a time
+    ///
+    /// lexeme_stream is a pull interface: it blocks until it can read the symbols it needs. This class works the other
+    /// way around, so that a lexer can be driven from an event loop: symbols are added with push() as they arrive, and
+    /// next() returns lexemes until it reaches one that might carry on into symbols that haven't arrived yet. It then
+    /// returns false, and can be called again after the next push(). Only the symbols for the lexeme that is waiting to
+    /// be completed are kept, so the whole of the input never needs to be buffered.
+    ///
+    /// Together with a parser created by create_push_parser(), this lets a single thread interleave many parses: push
+    /// each block of input into the lexer, call feed() to pass the completed lexemes to the parser, then call
+    /// parse_available() on the parser state and go back to waiting if it returns need_input.
+    ///
+    /// The lexemes are the same as those produced by the lexer's create_stream_from_symbols() for the whole of the
+    /// input. This only works with lexers that can create a chunk_lexer (which lexers built from a DFA can).
+    ///
+    class push_lexer {
+    private:
+        /// \brief The object used to run the lexer's state machine (NULL if the lexer doesn't support this)
+        chunk_lexer* m_Lexer;
+        
+        /// \brief The symbols that have been pushed but not yet returned as part of a lexeme
+        std::vector<int> m_Buffer;
+        
+        /// \brief Index of the first symbol in m_Buffer that hasn't been matched yet
+        size_t m_BufferStart;
+        
+        /// \brief The position of the next lexeme
+        position_tracker m_Position;
+        
+        /// \brief The state that the lexer starts in for the next lexeme
+        int m_InitialState;
+        
+        /// \brief True once end_of_input() has been called
+        bool m_EndOfInput;
+        
+        /// \brief NULL, or an array indicating which symbols should be skipped rather than returned as lexemes
+        const bool* m_Skip;
+        
+        /// \brief The number of entries in m_Skip
+        int m_NumSkip;
+        
+    private:
+        push_lexer(const push_lexer& copyFrom);
+        push_lexer& operator=(const push_lexer& copyFrom);
+        
+    public:
+        /// \brief Creates a push lexer that runs the state machine for the specified lexer
+        ///
+        /// The lexer must remain valid until this object is destroyed. Check valid() afterwards to see if it could be
+        /// used.
+        explicit push_lexer(const basic_lexer& lexer);
+        
+        /// \brief Destructor
+        virtual ~push_lexer();
+        
+        /// \brief True if the lexer passed to the constructor can be run by this object
+        inline bool valid() const { return m_Lexer != NULL; }
+        
+        /// \brief Adds some symbols to the end of the input
+        void push(const int* begin, const int* end);
+        
+        /// \brief Indicates that no more symbols will be pushed
+        inline void end_of_input() { m_EndOfInput = true; }
+        
+        /// \brief True once end_of_input() has been called
+        inline bool at_end_of_input() const { return m_EndOfInput; }
+        
+        /// \brief Skips over any lexeme whose symbol has a true entry in the specified array
+        ///
+        /// The array must remain valid until this object is destroyed or it is replaced by another call to this method.
+        void skip_symbols(const bool* skip, int numSymbols);
+        
+        /// \brief Retrieves the next lexeme, if it is available
+        ///
+        /// Returns false if more symbols need to be pushed before the next lexeme can be matched. Otherwise, result is
+        /// set to the next lexeme, or to NULL once every symbol has been matched after end_of_input() has been called.
+        /// The caller should delete the lexemes that are returned.
+        bool next(lexeme*& result);
+        
+        /// \brief Passes all of the lexemes that are available to the specified push parser state
+        ///
+        /// The parser is told about the end of the input once the last lexeme has been passed to it. Returns the number
+        /// of lexemes that were passed to the parser.
+        template<typename parser_state> inline int feed(parser_state& target) {
+            int     count = 0;
+            lexeme* lex;
+            
+            while (next(lex)) {
+                if (!lex) {
+                    target.end_of_input();
+                    break;
+                }
+                
+                target.push(lex);
+                ++count;
+            }
+            
+            return count;
+        }
+    };
+}
+
+#endif
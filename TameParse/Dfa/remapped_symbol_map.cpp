@@ -28,6 +28,8 @@
 #include <iostream>
 #include <map>
 #include <set>
+#include <vector>
+#include <algorithm>
 
 #include "TameParse/Dfa/remapped_symbol_map.h"
 #include "TameParse/Dfa/range.h"
@@ -65,122 +67,58 @@ int remapped_symbol_map::identifier_for_symbols(const symbol_set& symbols, const
 /// \brief Range of symbols
 typedef range<int> symbol_range;
 
-/// \brief Type mapping symbol ranges to the sets that contain them
-typedef map<symbol_range, set<int>, symbol_range::sort_by_lower > sets_for_range;
+/// \brief A point where a symbol set starts or stops covering the symbols
+///
+/// The first value is the symbol where this occurs, the second is the identifier of the set plus one, negated for the end of a range.
+/// Sorting these puts the points in symbol order.
+typedef pair<int, int> range_boundary;
 
-/// \brief Splits a range that exists in sets into two.
+/// \brief Factory method that generates a remapped symbol map by removing duplicates
 ///
-/// We end up with two ranges: lower..splitPoint and splitPoint..upper
-/// Returns an iterator for the start of the new ranges
-static sets_for_range::iterator split(sets_for_range& sets, symbol_range original, int splitPoint) {
-    // Get the values for this range
-    set<int> values = sets[original];
-    
-    // Remove the original range
-    sets.erase(original);
+/// This finds all the symbol sets that overlap in the original, and splits them up so that any given symbol is only in one set.
+/// It sets up the remapping so it is possible to find the new set IDs for any symbol set in the original.
+remapped_symbol_map* remapped_symbol_map::deduplicate(const symbol_map& source) {
+    // Collect the points where each range in the source starts and stops
+    vector<range_boundary>  boundaries;
+    int                     maxIdentifier = -1;
     
-    // Create the split ranges
-    sets[symbol_range(splitPoint, original.upper())] = values;
-    sets_for_range::iterator result = sets.insert(sets_for_range::value_type(symbol_range(original.lower(), splitPoint), values)).first;
-    return result;
-}
-
-/// \brief Adds the ranges in a particular symbol set 
-static void add_set(sets_for_range& sets, const symbol_set& symbols, int identifier) {
-    // Iterate through the ranges in this set
-    for (symbol_set::iterator range = symbols.begin(); range != symbols.end(); ++range) {
-        // Find the first item in the set whose lower bound is >= this range
-        sets_for_range::iterator firstGreaterThan = sets.lower_bound(*range);
+    for (symbol_map::iterator symSet = source.begin(); symSet != source.end(); ++symSet) {
+        if (symSet->second > maxIdentifier) maxIdentifier = symSet->second;
         
-        // If this isn't at the beginning, then it's possible that this set overlaps the preceeding set
-        if (firstGreaterThan != sets.begin()) {
-            // Get the previous set
-            sets_for_range::iterator preceeding = firstGreaterThan;
-            preceeding--;
+        for (symbol_set::iterator symRange = symSet->first->begin(); symRange != symSet->first->end(); ++symRange) {
+            if (symRange->lower() >= symRange->upper()) continue;
             
-            // See if there's an overlap
-            if (preceeding->first.upper() > range->lower()) {
-                // Start from the preceeding set if they do
-                firstGreaterThan = preceeding;
-            }
+            boundaries.push_back(range_boundary(symRange->lower(), symSet->second + 1));
+            boundaries.push_back(range_boundary(symRange->upper(), -(symSet->second + 1)));
         }
+    }
+    
+    sort(boundaries.begin(), boundaries.end());
+    
+    // Sweep through the boundaries in order, combining any ranges that map to the same set of symbol sets
+    map<new_symbol_set, symbol_set> setsForSets;
+    new_symbol_set                  active;
+    vector<int>                     activeCount(maxIdentifier + 1, 0);
+    
+    for (vector<range_boundary>::const_iterator boundary = boundaries.begin(); boundary != boundaries.end(); ) {
+        int point = boundary->first;
         
-        // If we're at the end of the list here, then this is an entirely new range
-        // This is also a new range if the item at firstGreaterThan doesn't overlap the range
-        // Finally, we can just add to the set for a particular range if we get an exact match
-        if (firstGreaterThan == sets.end() || !firstGreaterThan->first.overlaps(*range) || firstGreaterThan->first == *range) {
-            // Just add this range
-            sets[*range].insert(identifier);
-            continue;
+        // Update the active sets for all the boundaries at this point
+        for (; boundary != boundaries.end() && boundary->first == point; ++boundary) {
+            if (boundary->second > 0) {
+                int setId = boundary->second - 1;
+                if (activeCount[setId]++ == 0) active.insert(setId);
+            } else {
+                int setId = -boundary->second - 1;
+                if (--activeCount[setId] == 0) active.erase(setId);
+            }
         }
-
-        // We've got some overlap, but it's not exact
-        symbol_range    remaining = *range;                 // Range of characters remaining to merge in
-        set<int>        justUs;                             // Set containing only the new identifier
         
-        justUs.insert(identifier);
-
-        while (remaining.upper() != remaining.lower()) {
-            // If we're at the end, we can just add the remaining set and stop
-            if (firstGreaterThan == sets.end()) {
-                sets[remaining] = justUs;
-                break;
-            }
-            
-            // If there's a gap between the remaining set and the current position, then fill it in
-            if (firstGreaterThan->first.lower() > remaining.lower()) {
-                int newUpper = firstGreaterThan->first.lower();
-                
-                // Insert a value to fill the gap
-                firstGreaterThan = sets.insert(firstGreaterThan, sets_for_range::value_type(symbol_range(remaining.lower(), newUpper), justUs));
-                
-                // Adjust the remaining set
-                remaining = symbol_range(newUpper, remaining.upper());
-                
-                // Want the value after the one we just inserted
-                ++firstGreaterThan;
-                
-                // Start again
-                continue;
-            }
-            
-            // If there's a gap between the lowest point in the range we're currently splitting and the current range, then split there
-            if (firstGreaterThan->first.lower() < remaining.lower()) {
-                // Split the ranges and move so that the lowest point matches
-                firstGreaterThan = split(sets, firstGreaterThan->first, remaining.lower());
-                ++firstGreaterThan;
-            }
-            
-            // If the current range ends beyond the end of the remaining set, then split it
-            if (firstGreaterThan->first.upper() > remaining.upper()) {
-                firstGreaterThan = split(sets, firstGreaterThan->first, remaining.upper());
-            }
-            
-            // Current range should overlap the range specified by firstGreaterThan: add this identifier
-            firstGreaterThan->second.insert(identifier);
-            
-            // Adjust the remaining set
-            remaining = symbol_range(firstGreaterThan->first.upper(), remaining.upper());
-            
-            // Move on
-            ++firstGreaterThan;
+        // The symbols up to the next boundary are in exactly the active sets
+        if (!active.empty() && boundary != boundaries.end()) {
+            setsForSets[active] |= symbol_range(point, boundary->first);
         }
     }
-}
-
-/// \brief Factory method that generates a remapped symbol map by removing duplicates
-///
-/// This finds all the symbol sets that overlap in the original, and splits them up so that any given symbol is only in one set.
-/// It sets up the remapping so it is possible to find the new set IDs for any symbol set in the original.
-remapped_symbol_map* remapped_symbol_map::deduplicate(const symbol_map& source) {
-    // Map of symbol ranges to the symbol sets in the original that contain them
-    sets_for_range setsContainingRange;
-    
-    // Iterate through the sets in the source
-    for (symbol_map::iterator symSet = source.begin(); symSet != source.end(); ++symSet) {
-        // Add this into the sets containing this range
-        add_set(setsContainingRange, *symSet->first, symSet->second);
-    }
     
     // Create the result
     remapped_symbol_map* newSet = new remapped_symbol_map();
@@ -193,12 +131,6 @@ remapped_symbol_map* remapped_symbol_map::deduplicate(const symbol_map& source)
         newSet->identifier_for_symbols(epsilon(), epsilonSet);
     }
     
-    // Combine any ranges that map to the same symbol set
-    map<new_symbol_set, symbol_set> setsForSets;
-    for (sets_for_range::iterator range = setsContainingRange.begin(); range != setsContainingRange.end(); ++range) {
-        setsForSets[range->second] |= range->first;
-    }
-    
     // Create a new set for each range we got in the previous step
     for (map<new_symbol_set, symbol_set>::iterator setMapping = setsForSets.begin(); setMapping != setsForSets.end(); ++setMapping) {
         newSet->identifier_for_symbols(setMapping->second, setMapping->first);
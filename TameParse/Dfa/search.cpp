@@ -0,0 +1,157 @@
+//
+//  search.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include "TameParse/Dfa/search.h"
+
+using namespace std;
+using namespace dfa;
+
+/// \brief Builds the prefilter for a DFA
+search_prefilter::search_prefilter(const ndfa& dfa)
+: m_UseSkip(false) {
+    // Find the symbols that leave the first state
+    if (dfa.count_states() > 0) {
+        const state& firstState = dfa.get_state(0);
+        
+        for (state::iterator transit = firstState.begin(); transit != firstState.end(); ++transit) {
+            m_Start |= dfa.symbols()[transit->symbol_set()];
+        }
+    }
+    
+    for (int symbol = 0; symbol < 128; ++symbol) {
+        m_AsciiStart[symbol] = m_Start[symbol];
+    }
+    
+    // These are the exits for a skip state, if there are few enough of them
+    int numRanges   = 0;
+    int numAscii    = 0;
+    
+    for (symbol_set::iterator range = m_Start.begin(); range != m_Start.end(); ++range) {
+        ++numRanges;
+        if (range->lower() < 0x80) {
+            numAscii += (range->upper() < 0x80 ? range->upper() : 0x80) - range->lower();
+        }
+    }
+    
+    if (numRanges > 0 && numRanges <= skip_state::max_ranges && numAscii <= skip_state::max_ascii_exits) {
+        int numAsciiExits   = 0;
+        m_Skip.count        = 0;
+        
+        for (symbol_set::iterator range = m_Start.begin(); range != m_Start.end(); ++range, ++m_Skip.count) {
+            m_Skip.lower[m_Skip.count] = range->lower();
+            m_Skip.upper[m_Skip.count] = range->upper();
+            
+            for (int symbol = range->lower(); symbol < range->upper() && symbol < 0x7f; ++symbol) {
+                m_Skip.ascii[numAsciiExits++] = symbol;
+            }
+        }
+        
+        for (int rangeNum = m_Skip.count; rangeNum < skip_state::max_ranges; ++rangeNum) {
+            m_Skip.lower[rangeNum] = m_Skip.upper[rangeNum] = 0;
+        }
+        
+        for (; numAsciiExits < skip_state::max_ascii_exits; ++numAsciiExits) {
+            m_Skip.ascii[numAsciiExits] = 0x7f;
+        }
+        
+        m_UseSkip = true;
+    }
+    
+    // Follow the chain of states that only have a single symbol leading out of them to find the prefix
+    int stateId = 0;
+    
+    while (stateId < dfa.count_states() && m_Prefix.size() < c_MaxPrefixLength) {
+        const state& thisState = dfa.get_state(stateId);
+        
+        // Stop at accepting states and states with more than one way out
+        if (!dfa.actions_for_state(stateId).empty() || thisState.count_transitions() != 1) break;
+        
+        const symbol_set& symbols = dfa.symbols()[thisState.begin()->symbol_set()];
+        symbol_set::iterator range = symbols.begin();
+        
+        if (range == symbols.end() || range->upper() != range->lower() + 1) break;
+        if (++symbol_set::iterator(range) != symbols.end()) break;
+        
+        m_Prefix.push_back(range->lower());
+        stateId = thisState.begin()->new_state();
+    }
+}
+
+/// \brief Returns the first position between pos and end where a match might begin, or end if there isn't one
+const int* search_prefilter::next_candidate(const int* pos, const int* end) const {
+    while (pos < end) {
+        // Find the next symbol that can start a match
+        if (m_UseSkip) {
+            pos = find_exit(m_Skip, pos, end);
+            if (pos == end) break;
+            
+            // Negative symbols are always exits, but can't start a match
+            if (*pos < 0) {
+                ++pos;
+                continue;
+            }
+        } else if (!is_start(*pos)) {
+            ++pos;
+            continue;
+        }
+        
+        // Check the rest of the prefix
+        if (m_Prefix.size() > 1) {
+            if ((size_t) (end - pos) < m_Prefix.size()) return end;
+            
+            size_t offset = 1;
+            while (offset < m_Prefix.size() && pos[offset] == m_Prefix[offset]) ++offset;
+            
+            if (offset < m_Prefix.size()) {
+                ++pos;
+                continue;
+            }
+        }
+        
+        return pos;
+    }
+    
+    return end;
+}
+
+/// \brief Fills in the symbol accepted by each state of a DFA, or -1 for states that don't accept
+void dfa::fill_accept_symbols(const ndfa& dfa, vector<int>& accept) {
+    accept.assign((size_t) dfa.count_states(), -1);
+    
+    for (int stateId = 0; stateId < dfa.count_states(); ++stateId) {
+        const ndfa::accept_action_list& actions = dfa.actions_for_state(stateId);
+        if (actions.empty()) continue;
+        
+        // Use the highest ranked action
+        accept_action* highest = *actions.begin();
+        for (ndfa::accept_action_list::const_iterator action = actions.begin(); action != actions.end(); ++action) {
+            if ((*highest) < **action) {
+                highest = *action;
+            }
+        }
+        
+        accept[stateId] = highest->symbol();
+    }
+}
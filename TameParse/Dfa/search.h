@@ -0,0 +1,221 @@
+//
+//  search.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _DFA_SEARCH_H
+#define _DFA_SEARCH_H
+
+#include <vector>
+
+#include "TameParse/Dfa/ndfa.h"
+#include "TameParse/Dfa/symbol_set.h"
+#include "TameParse/Dfa/skip_state.h"
+#include "TameParse/Dfa/basic_lexer.h"
+
+namespace dfa {
+    ///
+    /// \brief A match found by searching a buffer of symbols
+    ///
+    struct search_match {
+        /// \brief The symbol accepted by the DFA for this match
+        int symbol;
+        
+        /// \brief The first symbol in the match
+        const int* begin;
+        
+        /// \brief The symbol after the last symbol in the match
+        const int* end;
+    };
+    
+    ///
+    /// \brief Finds the positions in a buffer where a match for a DFA might begin
+    ///
+    /// A match can only start with one of the symbols that leave the first state of the DFA, so a search can skip over
+    /// anything else. When there are only a few of these symbols, the skip uses find_exit(), which checks blocks of
+    /// symbols at once. If every match has to begin with the same literal (the DFA has a chain of non-accepting states
+    /// with a single symbol leading out of each of them), candidates that don't start with it are also skipped.
+    ///
+    class search_prefilter {
+    public:
+        /// \brief The longest literal prefix that is checked before running the DFA
+        static const size_t c_MaxPrefixLength = 32;
+    
+    private:
+        /// \brief The symbols that can start a match
+        symbol_set m_Start;
+        
+        /// \brief True for each ASCII symbol that can start a match
+        bool m_AsciiStart[128];
+        
+        /// \brief True if m_Skip can be used to find the symbols that can start a match
+        bool m_UseSkip;
+        
+        /// \brief Skip state whose exits are the symbols that can start a match
+        skip_state m_Skip;
+        
+        /// \brief The symbols that every match begins with
+        std::vector<int> m_Prefix;
+    
+    public:
+        /// \brief Builds the prefilter for a DFA
+        ///
+        /// A DFA is an NDFA which has been transformed by to_ndfa_with_unique_symbols() and to_dfa(), in that order.
+        explicit search_prefilter(const ndfa& dfa);
+        
+        /// \brief True if the specified symbol can start a match
+        inline bool is_start(int symbol) const {
+            if (symbol < 0)     return false;
+            if (symbol < 128)   return m_AsciiStart[symbol];
+            return m_Start[symbol];
+        }
+        
+        /// \brief Returns the first position between pos and end where a match might begin, or end if there isn't one
+        const int* next_candidate(const int* pos, const int* end) const;
+        
+        /// \brief The symbols that every match begins with (which might be empty)
+        inline const std::vector<int>& prefix() const { return m_Prefix; }
+        
+        /// \brief True if the symbols that can start a match are found with find_exit()
+        inline bool uses_skip() const { return m_UseSkip; }
+    };
+    
+    /// \brief Fills in the symbol accepted by each state of a DFA, or -1 for states that don't accept
+    ///
+    /// When a state has several actions, the highest ranked one is used, in the same way as in dfa_lexer_base.
+    void fill_accept_symbols(const ndfa& dfa, std::vector<int>& accept);
+    
+    ///
+    /// \brief Searches buffers for matches of any of the symbols accepted by a DFA
+    ///
+    /// Lexers only match at the start of their input. This class finds matches anywhere in a buffer, which is useful
+    /// for scanning logs or other text for a set of patterns. Matches are leftmost-longest: the match that starts
+    /// earliest is found first, and the longest match starting at that position is used. Matches that contain no
+    /// symbols are never reported.
+    ///
+    /// The state machine can be any of the types used by dfa_lexer_base, and it is run by runner (see
+    /// dfa_table_runner). Positions that can't start a match are skipped using a search_prefilter.
+    ///
+    template<typename state_machine, typename state_machine_ref = const state_machine&, typename runner = dfa_table_runner<state_machine_ref> > class dfa_searcher_base {
+    private:
+        /// \brief The state machine for this searcher
+        state_machine m_StateMachine;
+        
+        /// \brief The symbol accepted by each state, or -1
+        std::vector<int> m_Accept;
+        
+        /// \brief NULL, or an array describing the states that the state machine can skip through
+        skip_state* m_Skip;
+        
+        /// \brief Finds the positions where matches might begin
+        search_prefilter m_Prefilter;
+        
+        /// \brief True if the prefilter should be used
+        bool m_UsePrefilter;
+        
+        dfa_searcher_base(const dfa_searcher_base& copyFrom);
+        dfa_searcher_base& operator=(const dfa_searcher_base& copyFrom);
+    
+    public:
+        /// \brief Constructs a searcher from a DFA
+        ///
+        /// A DFA is an NDFA which has been transformed by to_ndfa_with_unique_symbols() and to_dfa(), in that order.
+        /// The prefilter can be turned off, which is mainly useful for testing.
+        dfa_searcher_base(const ndfa& dfa, bool usePrefilter = true)
+        : m_StateMachine(dfa)
+        , m_Skip(find_skip_states(dfa))
+        , m_Prefilter(dfa)
+        , m_UsePrefilter(usePrefilter) {
+            fill_accept_symbols(dfa, m_Accept);
+            if (m_Accept.empty()) m_Accept.push_back(-1);
+        }
+        
+        /// \brief Destructor
+        ~dfa_searcher_base() {
+            delete[] m_Skip;
+        }
+        
+        /// \brief The prefilter used by this searcher
+        inline const search_prefilter& prefilter() const { return m_Prefilter; }
+        
+        /// \brief Finds the first match between begin and end
+        ///
+        /// Returns false if there are no matches.
+        bool find(const int* begin, const int* end, search_match& match) const {
+            for (const int* start = begin; start < end; ++start) {
+                // Skip to the next place a match might start
+                if (m_UsePrefilter) {
+                    start = m_Prefilter.next_candidate(start, end);
+                    if (start == end) break;
+                }
+                
+                // Find the longest match starting here
+                const int*  pos             = start;
+                const int*  acceptPos       = NULL;
+                int         acceptSymbol    = -1;
+                
+                runner::run(m_StateMachine, &m_Accept[0], m_Skip, 0, pos, end, acceptSymbol, acceptPos);
+                
+                if (acceptPos != NULL) {
+                    match.symbol    = acceptSymbol;
+                    match.begin     = start;
+                    match.end       = acceptPos;
+                    return true;
+                }
+            }
+            
+            return false;
+        }
+        
+        /// \brief Finds all of the matches between begin and end that don't overlap, adding them to matches
+        ///
+        /// Returns the number of matches that were found. The search for each match starts after the end of the
+        /// previous one.
+        size_t find_all(const int* begin, const int* end, std::vector<search_match>& matches) const {
+            size_t          count = 0;
+            search_match    match;
+            
+            while (find(begin, end, match)) {
+                matches.push_back(match);
+                begin = match.end;
+                ++count;
+            }
+            
+            return count;
+        }
+    };
+    
+    ///
+    /// \brief Searcher built from a DFA, using a state_machine with the specified row type
+    ///
+    template<typename char_type, typename state_machine_row = state_machine_flat_table> class dfa_searcher : public dfa_searcher_base<state_machine<char_type, state_machine_row> > {
+    public:
+        typedef dfa_searcher_base<state_machine<char_type, state_machine_row> > base;
+        
+        /// \brief Constructs a searcher from a DFA
+        inline dfa_searcher(const ndfa& dfa, bool usePrefilter = true) : base(dfa, usePrefilter) {
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,159 @@
+//
+//  skip_state.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#if defined(__SSE2__)
+#  include <emmintrin.h>
+#endif
+
+#include "TameParse/Dfa/skip_state.h"
+
+using namespace dfa;
+
+/// \brief Finds the states in a DFA that can be skipped through, returning a table with an entry for each state
+skip_state* dfa::find_skip_states(const ndfa& dfa) {
+    int         numStates   = dfa.count_states();
+    skip_state* result      = new skip_state[numStates > 0 ? numStates : 1];
+    bool        anySkip     = false;
+    
+    for (int stateId = 0; stateId < numStates; ++stateId) {
+        skip_state& skip    = result[stateId];
+        skip.count          = 0;
+        
+        // Find the symbols that move this state back to itself
+        const state&    thisState   = dfa.get_state(stateId);
+        symbol_set      loop;
+        
+        for (state::iterator transit = thisState.begin(); transit != thisState.end(); ++transit) {
+            if (transit->new_state() == stateId) {
+                loop |= dfa.symbols()[transit->symbol_set()];
+            }
+        }
+        
+        // The exits are all of the other symbols, which must be in a few ranges and mostly outside of ASCII
+        symbol_set  exits       = ~loop;
+        int         numRanges   = 0;
+        int         numAscii    = 0;
+        
+        for (symbol_set::iterator range = exits.begin(); range != exits.end(); ++range) {
+            ++numRanges;
+            if (range->lower() < 0x80) {
+                numAscii += (range->upper() < 0x80 ? range->upper() : 0x80) - range->lower();
+            }
+        }
+        
+        if (loop.begin() == loop.end() || numRanges == 0 || numRanges > skip_state::max_ranges || numAscii > skip_state::max_ascii_exits) continue;
+        
+        int numAsciiExits = 0;
+        for (symbol_set::iterator range = exits.begin(); range != exits.end(); ++range, ++skip.count) {
+            skip.lower[skip.count] = range->lower();
+            skip.upper[skip.count] = range->upper();
+            
+            for (int symbol = range->lower(); symbol < range->upper() && symbol < 0x7f; ++symbol) {
+                skip.ascii[numAsciiExits++] = symbol;
+            }
+        }
+        
+        for (int rangeNum = skip.count; rangeNum < skip_state::max_ranges; ++rangeNum) {
+            skip.lower[rangeNum] = skip.upper[rangeNum] = 0;
+        }
+        
+        for (; numAsciiExits < skip_state::max_ascii_exits; ++numAsciiExits) {
+            skip.ascii[numAsciiExits] = 0x7f;
+        }
+        
+        anySkip = true;
+    }
+    
+    // Don't bother with a table if there's nothing to skip
+    if (!anySkip) {
+        delete[] result;
+        return NULL;
+    }
+    
+    return result;
+}
+
+/// \brief Finds the states in a DFA where a lexer can commit to the lexeme it has matched
+bool* dfa::find_commit_states(const ndfa& dfa) {
+    int     numStates   = dfa.count_states();
+    bool*   result      = new bool[numStates > 0 ? numStates : 1];
+    bool    anyCommit   = false;
+    
+    for (int stateId = 0; stateId < numStates; ++stateId) {
+        const state& thisState = dfa.get_state(stateId);
+        
+        result[stateId] = thisState.count_transitions() == 0 && !dfa.actions_for_state(stateId).empty();
+        if (result[stateId]) anyCommit = true;
+    }
+    
+    if (!anyCommit) {
+        delete[] result;
+        return NULL;
+    }
+    
+    return result;
+}
+
+/// \brief Returns the first symbol between begin and end that is an exit symbol for the specified state
+const int* dfa::find_exit(const skip_state& state, const int* begin, const int* end) {
+    const int* pos = begin;
+    
+#if defined(__SSE2__)
+    __m128i ascii0  = _mm_set1_epi8((char) state.ascii[0]);
+    __m128i ascii1  = _mm_set1_epi8((char) state.ascii[1]);
+    __m128i ascii2  = _mm_set1_epi8((char) state.ascii[2]);
+    __m128i ascii3  = _mm_set1_epi8((char) state.ascii[3]);
+    __m128i other   = _mm_set1_epi8(0x7f);
+    
+    while (end - pos >= 16) {
+        // Pack the symbols into bytes: this leaves ASCII symbols alone, turns larger symbols into 0x7f and keeps 
+        // negative symbols negative
+        __m128i words0      = _mm_packs_epi32(_mm_loadu_si128((const __m128i*) pos), _mm_loadu_si128((const __m128i*) (pos + 4)));
+        __m128i words1      = _mm_packs_epi32(_mm_loadu_si128((const __m128i*) (pos + 8)), _mm_loadu_si128((const __m128i*) (pos + 12)));
+        __m128i bytes       = _mm_packs_epi16(words0, words1);
+        
+        // Find the symbols that might be exits: the ASCII exits, and anything that wasn't ASCII to start with
+        __m128i asciiExits  = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(bytes, ascii0), _mm_cmpeq_epi8(bytes, ascii1)), _mm_or_si128(_mm_cmpeq_epi8(bytes, ascii2), _mm_cmpeq_epi8(bytes, ascii3)));
+        __m128i notAscii    = _mm_or_si128(_mm_cmpeq_epi8(bytes, other), _mm_cmplt_epi8(bytes, _mm_setzero_si128()));
+        int     mask        = _mm_movemask_epi8(_mm_or_si128(asciiExits, notAscii));
+        
+        // Check each of the possible exits against the ranges
+        for (int offset = 0; mask != 0; ++offset, mask >>= 1) {
+            if ((mask & 1) && is_exit(state, pos[offset])) {
+                return pos + offset;
+            }
+        }
+        
+        pos += 16;
+    }
+#endif
+    
+    while (pos != end && !is_exit(state, *pos)) {
+        ++pos;
+    }
+    
+    return pos;
+}
@@ -0,0 +1,108 @@
+//
+//  skip_state.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _DFA_SKIP_STATE_H
+#define _DFA_SKIP_STATE_H
+
+#include "TameParse/Dfa/ndfa.h"
+
+namespace dfa {
+    ///
+    /// \brief Describes a DFA state that moves back to itself on every symbol except for a few 'exit' symbols
+    ///
+    /// States like these are found inside block comments and string literals, where the lexer stays in the same state
+    /// until it sees one of the symbols that can end the lexeme. Once a lexer has entered one of these states, it can
+    /// search for the next exit symbol (see find_exit) rather than running the state machine on every symbol.
+    ///
+    /// The exits are stored as ranges, as a DFA that handles surrogate pairs or that only accepts characters up to a
+    /// certain value will also leave these states for whole ranges of symbols. Negative symbols are always exits.
+    ///
+    struct skip_state {
+        /// \brief The largest number of ranges of exit symbols that a skip state can have
+        static const int max_ranges = 6;
+        
+        /// \brief The largest number of exit symbols below 0x80 that a skip state can have
+        ///
+        /// States that leave on more of the ASCII characters than this usually only loop for a few symbols (in an
+        /// identifier, say), so searching for the exit would be slower than running the state machine.
+        static const int max_ascii_exits = 4;
+        
+        /// \brief The number of symbols that a lexer should have matched before it starts searching for exits
+        ///
+        /// Setting up a search takes a little while, so short runs through a skip state (short strings, say) are 
+        /// faster to run through the state machine.
+        static const int min_run = 16;
+        
+        /// \brief The number of ranges of exit symbols for this state, or 0 if this isn't a skip state
+        int count;
+        
+        /// \brief The first symbol in each range of exit symbols
+        int lower[max_ranges];
+        
+        /// \brief The symbol after the last symbol in each range of exit symbols
+        int upper[max_ranges];
+        
+        /// \brief The exit symbols below 0x7f
+        ///
+        /// find_exit compares blocks of symbols against these first, and only checks the ranges for symbols that match
+        /// or aren't ASCII. Unused entries are set to 0x7f, which is always checked against the ranges.
+        int ascii[max_ascii_exits];
+    };
+    
+    /// \brief Finds the states in a DFA that can be skipped through, returning a table with an entry for each state
+    ///
+    /// The result should be freed with delete[]. NULL is returned if none of the states in the DFA are skip states.
+    skip_state* find_skip_states(const ndfa& dfa);
+    
+    /// \brief Finds the states in a DFA where a lexer can commit to the lexeme it has matched, returning a table with an
+    /// entry for each state
+    ///
+    /// These are accepting states without any transitions: no backtracking is possible once a lexer reaches one, as
+    /// the next symbol is always rejected. A lexer can accept the lexeme straight away rather than reading (and
+    /// buffering) another symbol only to find that out, which matters for lexemes such as operators at the end of a
+    /// block of input. The result should be freed with delete[]. NULL is returned if there are no commit states.
+    bool* find_commit_states(const ndfa& dfa);
+    
+    /// \brief True if the specified symbol is an exit symbol for a skip state
+    inline bool is_exit(const skip_state& state, int symbol) {
+        if (symbol < 0) return true;
+        
+        for (int rangeNum = 0; rangeNum < state.count; ++rangeNum) {
+            if (symbol >= state.lower[rangeNum] && symbol < state.upper[rangeNum]) return true;
+        }
+        
+        return false;
+    }
+    
+    /// \brief Returns the first symbol between begin and end that is an exit symbol for the specified state (or end if
+    /// there isn't one)
+    ///
+    /// This uses SIMD instructions where they are available. Lexers only call this once they have matched at least
+    /// skip_state::min_run symbols.
+    const int* find_exit(const skip_state& state, const int* begin, const int* end);
+}
+
+#endif
@@ -29,7 +29,10 @@
 #define _DFA_STATE_MACHINE_H
 
 #include <algorithm>
+#include <vector>
 
+#include "TameParse/Util/comb_vector.h"
+#include "TameParse/Util/constexpr.h"
 #include "TameParse/Dfa/symbol_translator.h"
 #include "TameParse/Dfa/ndfa.h"
 #include "TameParse/Dfa/epsilon.h"
@@ -181,6 +184,39 @@ namespace dfa {
         }
     };
 
+    ///
+    /// \brief Runs a state machine over a span of symbols, remembering the last accepting state it passes through
+    ///
+    /// This is the loop that a lexer uses to find the longest match. It stops after the state machine rejects a symbol
+    /// or when pos reaches end, and returns the final state (which is negative if a symbol was rejected). pos is updated
+    /// to point after the last symbol that was read. Whenever the state machine enters a state whose entry in accept is
+    /// not negative, acceptPos and acceptSymbol are set to the position after the symbol just read and that entry.
+    ///
+    /// Each state machine class has a run_span() method that calls this, so that the whole scan is a single loop with
+    /// the lookups inlined into it. Classes with simple tables replace it with a loop specialised for their tables.
+    ///
+    template<class state_machine_type> inline int run_state_machine_span(const state_machine_type& stateMachine, int state, const int*& pos, const int* end, const int* accept, int& acceptSymbol, const int*& acceptPos) {
+        const int* next = pos;
+        
+        while (next != end) {
+            state = stateMachine.run_unsafe(state, *next);
+            ++next;
+            
+            // Stop at the first rejected symbol
+            if (state < 0) break;
+            
+            // Remember the most recent accepting state
+            int acceptedSymbol = accept[state];
+            if (acceptedSymbol >= 0) {
+                acceptPos       = next;
+                acceptSymbol    = acceptedSymbol;
+            }
+        }
+        
+        pos = next;
+        return state;
+    }
+
     // TODO: document the requirements for the row type class and the symbol_translator class
     
     ///
@@ -287,9 +323,223 @@ namespace dfa {
         inline int run(int state, symbol_type symbol) const {
             if (state < 0 || state >= m_MaxState) return -1;
             return run_unsafe(state, symbol);
+        }        
+        /// \brief Runs this state machine over a span of symbols (see run_state_machine_span)
+        inline int run_span(int state, const int*& pos, const int* end, const int* accept, int& acceptSymbol, const int*& acceptPos) const {
+            return run_state_machine_span(*this, state, pos, end, accept, acceptSymbol, acceptPos);
         }
     };
 
+    ///
+    /// \brief DFA stored as a single table indexed by state and symbol set, using a narrow integer type for each entry
+    ///
+    /// This is equivalent to a state_machine with a flat table, except that all of the rows are stored in a single
+    /// array and each entry is a cell_type rather than an int. For the small state machines produced for most lexers,
+    /// cell_type can be unsigned char or unsigned short, so the whole table is much more likely to fit in the cache
+    /// and each transition requires a single load from the table.
+    ///
+    /// Entries store the new state plus one, with 0 indicating a rejection, so the state machine must have fewer
+    /// states than the maximum value of cell_type. Use fits() to check this before constructing one.
+    ///
+    template<class symbol_type, class cell_type = unsigned short, class symbol_translator = symbol_translator<symbol_type> > class packed_state_machine {
+    private:
+        /// \brief The translator for the symbols
+        symbol_translator m_Translator;
+        
+        /// \brief The maximum symbol set
+        int m_MaxSet;
+        
+        /// \brief The maximum state ID
+        int m_MaxState;
+        
+        /// \brief The transition table (m_MaxSet entries per state)
+        cell_type* m_Table;
+        
+        packed_state_machine(const packed_state_machine& copyFrom);
+        packed_state_machine& operator=(const packed_state_machine& copyFrom);
+        
+    public:
+        /// \brief True if the specified DFA has few enough states to be represented by this class
+        static inline bool fits(const ndfa& dfa) {
+            return (unsigned long) dfa.count_states() < (unsigned long) (cell_type) ~(cell_type) 0;
+        }
+        
+        /// \brief Builds up a state machine from a DFA
+        ///
+        /// As with state_machine, the DFA must have been processed by to_ndfa_with_unique_symbols and to_dfa.
+        packed_state_machine(const ndfa& dfa)
+        : m_Translator(dfa.symbols())
+        , m_MaxSet(dfa.symbols().count_sets())
+        , m_MaxState(dfa.count_states()) {
+            // Allocate the table, with every transition initially rejecting
+            size_t tableSize = (size_t) m_MaxState * (size_t) m_MaxSet;
+            m_Table = new cell_type[tableSize > 0 ? tableSize : 1];
+            std::fill(m_Table, m_Table + tableSize, (cell_type) 0);
+            
+            // Fill in the transitions for each state
+            for (int stateNum=0; stateNum<m_MaxState; ++stateNum) {
+                const state&    thisState   = dfa.get_state(stateNum);
+                cell_type*      row         = m_Table + (size_t) stateNum * (size_t) m_MaxSet;
+                
+                for (state::iterator transit = thisState.begin(); transit != thisState.end(); ++transit) {
+                    row[transit->symbol_set()] = (cell_type) (transit->new_state() + 1);
+                }
+            }
+        }
+        
+        /// \brief Destructor
+        ~packed_state_machine() {
+            delete[] m_Table;
+        }
+        
+        /// \brief Size in bytes of this state machine
+        inline size_t size() const {
+            return sizeof(*this) + m_Translator.size() + sizeof(cell_type) * (size_t) m_MaxState * (size_t) m_MaxSet;
+        }
+        
+    public:
+        /// \brief Given a state and a symbol set, returns a new state
+        ///
+        /// Unlike run() this performs no bounds checking so might crash or perform strangely when supplied with invalid state IDs or symbol sets
+        inline int run_unsafe_set(int state, int symbolSet) const {
+            return (int) m_Table[state * m_MaxSet + symbolSet] - 1;
+        }
+        
+        /// \brief Given a state and a symbol, returns a new state
+        ///
+        /// Unlike run() this performs no bounds checking so might crash or perform strangely when supplied with invalid state IDs
+        inline int run_unsafe(int state, symbol_type symbol) const {
+            // Get the set this symbol is in
+            int set = m_Translator.set_for_symbol(symbol);
+            
+            // Reject symbols that have no set
+            if (set == symbol_set::null) return -1;
+            
+            // Run with this set
+            return run_unsafe_set(state, set);
+        }
+        
+        /// \brief Given a state and a symbol, returns a new state
+        inline int run(int state, symbol_type symbol) const {
+            if (state < 0 || state >= m_MaxState) return -1;
+            return run_unsafe(state, symbol);
+        }        
+        /// \brief Runs this state machine over a span of symbols (see run_state_machine_span)
+        ///
+        /// The table and the symbol translation are hoisted out of the loop, so each symbol needs a translation, a
+        /// single load from the table and a load from the accept array.
+        inline int run_span(int state, const int*& pos, const int* end, const int* accept, int& acceptSymbol, const int*& acceptPos) const {
+            const cell_type*    table   = m_Table;
+            const int           numSets = m_MaxSet;
+            const int*          next    = pos;
+            
+            while (next != end) {
+                int set = m_Translator.set_for_symbol((symbol_type) *next);
+                ++next;
+                
+                // Symbols in no set and rejecting transitions both end the scan
+                if (set == symbol_set::null) {
+                    state = -1;
+                    break;
+                }
+                
+                state = (int) table[state * numSets + set] - 1;
+                if (state < 0) break;
+                
+                // Remember the most recent accepting state
+                int acceptedSymbol = accept[state];
+                if (acceptedSymbol >= 0) {
+                    acceptPos       = next;
+                    acceptSymbol    = acceptedSymbol;
+                }
+            }
+            
+            pos = next;
+            return state;
+        }
+    };
+    
+    ///
+    /// \brief DFA stored as a row-displacement ('comb vector') table
+    ///
+    /// The rows for every state are overlaid in a single array, with a check array recording which state owns each
+    /// entry. This takes space close to that of a compact table (only the transitions that exist are stored), but
+    /// lookups take constant time, like a flat table.
+    ///
+    template<class symbol_type, class symbol_translator = symbol_translator<symbol_type> > class comb_state_machine {
+    private:
+        /// \brief The translator for the symbols
+        symbol_translator m_Translator;
+        
+        /// \brief The maximum state ID
+        int m_MaxState;
+        
+        /// \brief The transition table (rows are states, columns are symbol sets)
+        util::comb_vector m_Table;
+        
+        /// \brief Creates the rows of the comb vector for the specified DFA
+        static std::vector<util::comb_vector::row> rows_for_dfa(const ndfa& dfa) {
+            std::vector<util::comb_vector::row> rows((size_t) dfa.count_states());
+            
+            for (int stateNum=0; stateNum<dfa.count_states(); ++stateNum) {
+                const state& thisState = dfa.get_state(stateNum);
+                
+                for (state::iterator transit = thisState.begin(); transit != thisState.end(); ++transit) {
+                    rows[stateNum].push_back(util::comb_vector::cell(transit->symbol_set(), transit->new_state()));
+                }
+            }
+            
+            return rows;
+        }
+        
+    public:
+        /// \brief Builds up a state machine from a DFA
+        ///
+        /// As with state_machine, the DFA must have been processed by to_ndfa_with_unique_symbols and to_dfa.
+        comb_state_machine(const ndfa& dfa)
+        : m_Translator(dfa.symbols())
+        , m_MaxState(dfa.count_states())
+        , m_Table(rows_for_dfa(dfa)) {
+        }
+        
+        /// \brief Size in bytes of this state machine
+        inline size_t size() const {
+            return sizeof(*this) + m_Translator.size() + m_Table.size();
+        }
+        
+        /// \brief The packed transition table used by this state machine
+        inline const util::comb_vector& table() const { return m_Table; }
+        
+    public:
+        /// \brief Given a state and a symbol set, returns a new state
+        ///
+        /// Unlike run() this performs no bounds checking on the state so might crash or perform strangely when supplied with invalid state IDs
+        inline int run_unsafe_set(int state, int symbolSet) const {
+            return m_Table.lookup(state, symbolSet);
+        }
+        
+        /// \brief Given a state and a symbol, returns a new state
+        ///
+        /// Unlike run() this performs no bounds checking so might crash or perform strangely when supplied with invalid state IDs
+        inline int run_unsafe(int state, symbol_type symbol) const {
+            // Get the set this symbol is in (symbol_set::null is rejected by the table lookup)
+            int set = m_Translator.set_for_symbol(symbol);
+            
+            // Run with this set
+            return run_unsafe_set(state, set);
+        }
+        
+        /// \brief Given a state and a symbol, returns a new state
+        inline int run(int state, symbol_type symbol) const {
+            if (state < 0 || state >= m_MaxState) return -1;
+            return run_unsafe(state, symbol);
+        }        
+        /// \brief Runs this state machine over a span of symbols (see run_state_machine_span)
+        inline int run_span(int state, const int*& pos, const int* end, const int* accept, int& acceptSymbol, const int*& acceptPos) const {
+            return run_state_machine_span(*this, state, pos, end, accept, acceptSymbol, acceptPos);
+        }
+    };
+    
     ///
     /// \brief State machine used with hard-coded tables generated by the main parser generator
     ///
@@ -304,19 +554,35 @@ namespace dfa {
 
         /// \brief The state machine represented by this object
         ///
-        /// We currently only support the compact table representation. This table consists
-        /// of a series of increasing pointers. m_StateEntries[x] is the location of the
-        /// beginning of the entries for state x, and m_StateEntries[x+1] is the location of
-        /// the end of the entries for state x.
-        const entry** m_StateEntries;
+        /// We currently only support the compact table representation. m_StateEntries[x] is
+        /// the location of the beginning of the entries for state x, and m_StateEnds[x] is
+        /// the location of the end of the entries for state x.
+        const entry* const* m_StateEntries;
+        
+        /// \brief The end of the entries for each state
+        ///
+        /// For tables where each state has its own entries, this is just m_StateEntries + 1 (so
+        /// the table is a series of increasing pointers). States with the same transitions can
+        /// share their entries by supplying a separate table of end pointers.
+        const entry* const* m_StateEnds;
 
         /// \brief The maximum state ID
         const int m_MaxState;
     
     public:
-        state_machine_tables(const symbol_translator& translator, const entry** entries, int numStates)
+        /// \brief Creates a state machine where each state's entries end where the next state's begin
+        TAMEPARSE_CONSTEXPR state_machine_tables(const symbol_translator& translator, const entry* const* entries, int numStates)
+        : m_Translator(translator)
+        , m_StateEntries(entries)
+        , m_StateEnds(entries + 1)
+        , m_MaxState(numStates) {
+        }
+        
+        /// \brief Creates a state machine with a separate table of the end of the entries for each state
+        TAMEPARSE_CONSTEXPR state_machine_tables(const symbol_translator& translator, const entry* const* entries, const entry* const* ends, int numStates)
         : m_Translator(translator)
         , m_StateEntries(entries)
+        , m_StateEnds(ends)
         , m_MaxState(numStates) {
         }
 
@@ -334,7 +600,7 @@ namespace dfa {
         inline int run_unsafe_set(int state, int symbolSet) const {
             // Fetch the state position
             const entry* stateStart   = m_StateEntries[state];
-            const entry* stateEnd     = m_StateEntries[state+1];
+            const entry* stateEnd     = m_StateEnds[state];
 
             // Nothing to do if there are no entries for this state
             if (stateEnd == stateStart) return -1;
@@ -374,6 +640,200 @@ namespace dfa {
         inline int run(int state, symbol_type symbol) const {
             if (state < 0 || state >= m_MaxState) return -1;
             return run_unsafe(state, symbol);
+        }        
+        /// \brief Runs this state machine over a span of symbols (see run_state_machine_span)
+        inline int run_span(int state, const int*& pos, const int* end, const int* accept, int& acceptSymbol, const int*& acceptPos) const {
+            return run_state_machine_span(*this, state, pos, end, accept, acceptSymbol, acceptPos);
+        }
+    };
+    
+    ///
+    /// \brief State machine used with hard-coded flat tables generated by the main parser generator
+    ///
+    /// The table has one row of numSets entries for every state. Entries store the new state plus one, with 0 indicating
+    /// a rejection (as for packed_state_machine), so cell_type can be the smallest unsigned type that can hold the number
+    /// of states plus one.
+    ///
+    template<class symbol_type, class symbol_translator, class cell_type> class state_machine_flat_tables {
+    private:
+        /// \brief Translates a raw symbol into the corresponding symbol set
+        const symbol_translator& m_Translator;
+        
+        /// \brief The transition table (numSets entries per state)
+        const cell_type* m_Table;
+        
+        /// \brief The maximum state ID
+        const int m_MaxState;
+        
+        /// \brief The number of symbol sets (the size of each row)
+        const int m_NumSets;
+        
+    public:
+        TAMEPARSE_CONSTEXPR state_machine_flat_tables(const symbol_translator& translator, const cell_type* table, int numStates, int numSets)
+        : m_Translator(translator)
+        , m_Table(table)
+        , m_MaxState(numStates)
+        , m_NumSets(numSets) {
+        }
+        
+    public:
+        /// \brief Size in bytes of this table
+        inline size_t size() const {
+            return sizeof(*this) + sizeof(cell_type) * (size_t) m_MaxState * (size_t) m_NumSets;
+        }
+        
+    public:
+        /// \brief Given a state and a symbol set, returns a new state
+        ///
+        /// Unlike run() this performs no bounds checking so might crash or perform strangely when supplied with invalid state IDs or symbol sets
+        inline int run_unsafe_set(int state, int symbolSet) const {
+            return (int) m_Table[state * m_NumSets + symbolSet] - 1;
+        }
+        
+        /// \brief Given a state and a symbol, returns a new state
+        ///
+        /// Unlike run() this performs no bounds checking so might crash or perform strangely when supplied with invalid state IDs
+        inline int run_unsafe(int state, symbol_type symbol) const {
+            // Get the set this symbol is in
+            int set = m_Translator.lookup(symbol);
+            
+            // Reject symbols that have no set
+            if (set == symbol_set::null) return -1;
+            
+            // Run with this set
+            return run_unsafe_set(state, set);
+        }
+        
+        /// \brief Given a state and a symbol, returns a new state
+        inline int run(int state, symbol_type symbol) const {
+            if (state < 0 || state >= m_MaxState) return -1;
+            return run_unsafe(state, symbol);
+        }        
+        /// \brief Runs this state machine over a span of symbols (see run_state_machine_span)
+        ///
+        /// The table and the symbol translation are hoisted out of the loop, so each symbol needs a translation, a
+        /// single load from the table and a load from the accept array.
+        inline int run_span(int state, const int*& pos, const int* end, const int* accept, int& acceptSymbol, const int*& acceptPos) const {
+            const cell_type*    table   = m_Table;
+            const int           numSets = m_NumSets;
+            const int*          next    = pos;
+            
+            while (next != end) {
+                int set = m_Translator.lookup((symbol_type) *next);
+                ++next;
+                
+                // Symbols in no set and rejecting transitions both end the scan
+                if (set == symbol_set::null) {
+                    state = -1;
+                    break;
+                }
+                
+                state = (int) table[state * numSets + set] - 1;
+                if (state < 0) break;
+                
+                // Remember the most recent accepting state
+                int acceptedSymbol = accept[state];
+                if (acceptedSymbol >= 0) {
+                    acceptPos       = next;
+                    acceptSymbol    = acceptedSymbol;
+                }
+            }
+            
+            pos = next;
+            return state;
+        }
+    };
+    
+    ///
+    /// \brief State machine used with direct-coded lexers generated by the main parser generator
+    ///
+    /// The transitions for a direct-coded lexer are compiled into a runner class (see dfa_table_runner), so this only
+    /// needs to translate symbols into symbol sets on behalf of that runner.
+    ///
+    template<class symbol_type, class symbol_translator> class state_machine_direct_code {
+    private:
+        /// \brief Translates a raw symbol into the corresponding symbol set
+        const symbol_translator& m_Translator;
+        
+        /// \brief The maximum state ID
+        const int m_MaxState;
+        
+    public:
+        TAMEPARSE_CONSTEXPR state_machine_direct_code(const symbol_translator& translator, int numStates)
+        : m_Translator(translator)
+        , m_MaxState(numStates) {
+        }
+        
+    public:
+        /// \brief Size in bytes of this state machine (the size of the generated code is not included)
+        inline size_t size() const {
+            return sizeof(*this);
+        }
+        
+        /// \brief The number of states in this state machine
+        inline int count_states() const {
+            return m_MaxState;
+        }
+        
+        /// \brief Returns the symbol set for the specified symbol, or symbol_set::null if it is not in any set
+        inline int set_for_symbol(symbol_type symbol) const {
+            return m_Translator.lookup(symbol);
+        }
+    };
+    
+    ///
+    /// \brief State machine used with hard-coded row-displacement tables generated by the main parser generator
+    ///
+    /// The parser generator writes out tables in this form instead of the compact form when they are smaller.
+    ///
+    template<class symbol_type, class symbol_translator> class state_machine_comb_tables {
+    private:
+        /// \brief Translates a raw symbol into the corresponding symbol set
+        const symbol_translator& m_Translator;
+        
+        /// \brief The transition table (rows are states, columns are symbol sets)
+        const util::comb_vector m_Table;
+        
+        /// \brief The maximum state ID
+        const int m_MaxState;
+        
+    public:
+        /// \brief Creates a state machine from the base, check and next state arrays of a comb vector
+        TAMEPARSE_CONSTEXPR state_machine_comb_tables(const symbol_translator& translator, const int* base, const int* check, const int* next, int numStates, int numCells)
+        : m_Translator(translator)
+        , m_Table(base, check, next, numStates, numCells)
+        , m_MaxState(numStates) {
+        }
+        
+    public:
+        /// \brief Size in bytes of this table
+        inline size_t size() const {
+            return sizeof(*this) + m_Table.size();
+        }
+        
+    public:
+        /// \brief Given a state and a symbol set, returns a new state
+        ///
+        /// Unlike run() this performs no bounds checking on the state so might crash or perform strangely when supplied with invalid state IDs
+        inline int run_unsafe_set(int state, int symbolSet) const {
+            return m_Table.lookup(state, symbolSet);
+        }
+        
+        /// \brief Given a state and a symbol, returns a new state
+        ///
+        /// Unlike run() this performs no bounds checking so might crash or perform strangely when supplied with invalid state IDs
+        inline int run_unsafe(int state, symbol_type symbol) const {
+            return run_unsafe_set(state, m_Translator.lookup(symbol));
+        }
+        
+        /// \brief Given a state and a symbol, returns a new state
+        inline int run(int state, symbol_type symbol) const {
+            if (state < 0 || state >= m_MaxState) return -1;
+            return run_unsafe(state, symbol);
+        }        
+        /// \brief Runs this state machine over a span of symbols (see run_state_machine_span)
+        inline int run_span(int state, const int*& pos, const int* end, const int* accept, int& acceptSymbol, const int*& acceptPos) const {
+            return run_state_machine_span(*this, state, pos, end, accept, acceptSymbol, acceptPos);
         }
     };
 }
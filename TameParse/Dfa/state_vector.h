@@ -0,0 +1,247 @@
+//
+//  state_vector.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _DFA_STATE_VECTOR_H
+#define _DFA_STATE_VECTOR_H
+
+#include <algorithm>
+
+#if defined(__AVX2__)
+#  include <immintrin.h>
+#elif defined(__SSSE3__)
+#  include <tmmintrin.h>
+#endif
+
+#include "TameParse/Dfa/symbol_translator.h"
+#include "TameParse/Dfa/ndfa.h"
+
+namespace dfa {
+    ///
+    /// \brief Runs a small DFA from many states at once
+    ///
+    /// A lexer that splits its input into chunks doesn't know which state the DFA will be in at the start of each chunk
+    /// until the previous chunk has been lexed. This class runs a vector of states over a chunk at once, so starting
+    /// with every state in the DFA produces a mapping from the state at the start of the chunk to the state at the end.
+    /// Mappings for neighbouring chunks can be joined with compose() once they are known.
+    ///
+    /// The transitions are stored as a column for each symbol set, mapping each state to the next one. Rejections move
+    /// to an extra 'dead' state that maps to itself. DFAs with up to 15 states have 16-byte columns, so with SSSE3 a
+    /// whole vector of states can be advanced with a single shuffle per symbol. Larger DFAs (up to 255 states) have
+    /// 256-byte columns, which are looked up with gathers when AVX2 is available.
+    ///
+    /// As with the other state machines, the DFA must have been processed by to_ndfa_with_unique_symbols and to_dfa.
+    ///
+    template<class symbol_type, class symbol_translator = symbol_translator<symbol_type> > class state_vector_machine {
+    public:
+        /// \brief A state in a state vector
+        typedef unsigned char vector_state;
+        
+        /// \brief The largest number of states a DFA can have to be run by this class
+        static const int max_states = 255;
+        
+        /// \brief The largest number of states a DFA can have for its columns to fit in a single shuffle
+        static const int max_shuffle_states = 15;
+    
+    private:
+        /// \brief The translator for the symbols
+        symbol_translator m_Translator;
+        
+        /// \brief The number of states in the DFA (which is also the dead state)
+        int m_NumStates;
+        
+        /// \brief The number of symbol sets in the DFA (which is also the column for symbols that aren't in any set)
+        int m_NumSets;
+        
+        /// \brief The number of entries in each column (16 or 256)
+        int m_Width;
+        
+        /// \brief The columns for each symbol set, followed by the column for symbols in no set
+        ///
+        /// There are a few bytes of padding after the last column, so that gathers can load 32-bit values at any entry.
+        unsigned char* m_Columns;
+        
+        state_vector_machine(const state_vector_machine& copyFrom);
+        state_vector_machine& operator=(const state_vector_machine& copyFrom);
+        
+        /// \brief The column for the specified symbol
+        inline const unsigned char* column(symbol_type symbol) const {
+            int set = m_Translator.set_for_symbol(symbol);
+            if (set == symbol_set::null) set = m_NumSets;
+            
+            return m_Columns + (size_t) set * (size_t) m_Width;
+        }
+        
+        /// \brief Advances up to 16 states over a span of symbols using a shuffle for each symbol
+        inline void run_shuffle(vector_state* states, int count, const int* begin, const int* end) const {
+#if defined(__SSSE3__)
+            // Unused lanes are filled with the dead state, which stays where it is
+            unsigned char lanes[16];
+            std::fill(lanes, lanes + 16, (unsigned char) m_NumStates);
+            std::copy(states, states + count, lanes);
+            
+            __m128i vector = _mm_loadu_si128((const __m128i*) lanes);
+            for (const int* pos = begin; pos != end; ++pos) {
+                vector = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) column((symbol_type) *pos)), vector);
+            }
+            
+            _mm_storeu_si128((__m128i*) lanes, vector);
+            std::copy(lanes, lanes + count, states);
+#else
+            run_scalar(states, count, begin, end);
+#endif
+        }
+        
+        /// \brief Advances up to 8 states over a span of symbols using a gather for each symbol
+        inline void run_gather(vector_state* states, int count, const int* begin, const int* end) const {
+#if defined(__AVX2__)
+            unsigned char lanes[8];
+            std::fill(lanes, lanes + 8, (unsigned char) m_NumStates);
+            std::copy(states, states + count, lanes);
+            
+            // Each lane loads the 32 bits starting at its entry in the column and keeps the low byte
+            __m256i vector  = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*) lanes));
+            __m256i low     = _mm256_set1_epi32(0xff);
+            for (const int* pos = begin; pos != end; ++pos) {
+                vector = _mm256_and_si256(_mm256_i32gather_epi32((const int*) column((symbol_type) *pos), vector, 1), low);
+            }
+            
+            int result[8];
+            _mm256_storeu_si256((__m256i*) result, vector);
+            for (int lane = 0; lane < count; ++lane) {
+                states[lane] = (vector_state) result[lane];
+            }
+#else
+            run_scalar(states, count, begin, end);
+#endif
+        }
+        
+        /// \brief Advances a vector of states over a span of symbols one state at a time
+        inline void run_scalar(vector_state* states, int count, const int* begin, const int* end) const {
+            for (const int* pos = begin; pos != end; ++pos) {
+                const unsigned char* col = column((symbol_type) *pos);
+                
+                for (int lane = 0; lane < count; ++lane) {
+                    states[lane] = col[states[lane]];
+                }
+            }
+        }
+    
+    public:
+        /// \brief True if the specified DFA has few enough states to be run by this class
+        static inline bool fits(const ndfa& dfa) {
+            return dfa.count_states() <= max_states;
+        }
+        
+        /// \brief Builds the columns for a DFA
+        ///
+        /// Use fits() to check that the DFA is small enough before calling this.
+        state_vector_machine(const ndfa& dfa)
+        : m_Translator(dfa.symbols())
+        , m_NumStates(dfa.count_states())
+        , m_NumSets(dfa.symbols().count_sets())
+        , m_Width(dfa.count_states() <= max_shuffle_states ? 16 : 256) {
+            // Every entry starts out moving to the dead state, including the entries past the end of each column
+            size_t tableSize = (size_t) (m_NumSets + 1) * (size_t) m_Width;
+            m_Columns = new unsigned char[tableSize + sizeof(int)];
+            std::fill(m_Columns, m_Columns + tableSize + sizeof(int), (unsigned char) m_NumStates);
+            
+            // Fill in the transitions for each state
+            for (int stateNum = 0; stateNum < m_NumStates; ++stateNum) {
+                const state& thisState = dfa.get_state(stateNum);
+                
+                for (state::iterator transit = thisState.begin(); transit != thisState.end(); ++transit) {
+                    m_Columns[(size_t) transit->symbol_set() * (size_t) m_Width + stateNum] = (unsigned char) transit->new_state();
+                }
+            }
+        }
+        
+        /// \brief Destructor
+        ~state_vector_machine() {
+            delete[] m_Columns;
+        }
+        
+        /// \brief Size in bytes of this state machine
+        inline size_t size() const {
+            return sizeof(*this) + m_Translator.size() + (size_t) (m_NumSets + 1) * (size_t) m_Width + sizeof(int);
+        }
+        
+        /// \brief The number of states in the DFA
+        inline int count_states() const { return m_NumStates; }
+        
+        /// \brief The state that a vector entry moves to when the DFA rejects
+        inline vector_state dead_state() const { return (vector_state) m_NumStates; }
+        
+        /// \brief True if a single shuffle can advance the states in a vector (when SSSE3 is available)
+        inline bool uses_shuffle() const { return m_Width == 16; }
+        
+        /// \brief The DFA state for an entry in a state vector, or -1 if it is the dead state
+        inline int to_state(vector_state state) const {
+            return (int) state < m_NumStates ? (int) state : -1;
+        }
+        
+        /// \brief Fills in a vector with every state in the DFA (count_states() entries), in order
+        ///
+        /// Running this vector over a span of symbols produces the mapping from the state at the start of the span to
+        /// the state at the end.
+        inline void fill_all_states(vector_state* states) const {
+            for (int stateNum = 0; stateNum < m_NumStates; ++stateNum) {
+                states[stateNum] = (vector_state) stateNum;
+            }
+        }
+        
+        /// \brief Advances every state in a vector over a span of symbols
+        ///
+        /// Entries can be any DFA state or the dead state.
+        void run(vector_state* states, int count, const int* begin, const int* end) const {
+            if (uses_shuffle()) {
+                for (int first = 0; first < count; first += 16) {
+                    run_shuffle(states + first, std::min(16, count - first), begin, end);
+                }
+            } else {
+#if defined(__AVX2__)
+                for (int first = 0; first < count; first += 8) {
+                    run_gather(states + first, std::min(8, count - first), begin, end);
+                }
+#else
+                run_scalar(states, count, begin, end);
+#endif
+            }
+        }
+        
+        /// \brief Joins the mappings for two neighbouring spans of symbols
+        ///
+        /// The first mapping can contain any number of entries. Each is replaced by the entry in the second mapping
+        /// (which should have count_states() entries) for the state that it maps to. Dead states stay dead.
+        inline void compose(vector_state* first, int count, const vector_state* second) const {
+            for (int entry = 0; entry < count; ++entry) {
+                if (first[entry] < m_NumStates) {
+                    first[entry] = second[first[entry]];
+                }
+            }
+        }
+    };
+}
+
+#endif
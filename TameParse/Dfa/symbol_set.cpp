@@ -25,6 +25,8 @@
 //  IN THE SOFTWARE.
 //
 
+#include <algorithm>
+
 #include "TameParse/Dfa/symbol_set.h"
 
 using namespace std;
@@ -36,7 +38,7 @@ symbol_set::symbol_set() {
 
 /// \brief Creates set containing a range of symbols
 symbol_set::symbol_set(const symbol_range& symbol) {
-    m_Symbols.insert(symbol);
+    append(m_Symbols, symbol);
 }
 
 /// \brief Creates a new symbol set by copying an old one
@@ -53,116 +55,204 @@ symbol_set::~symbol_set() {
 }
 
 
+/// \brief Orders ranges by their upper bound
+static inline bool upper_less_than(const symbol_set::symbol_range& a, int value) {
+    return a.upper() < value;
+}
+
+/// \brief Orders ranges by their upper bound, treating ranges that end at a value as being before it
+static inline bool upper_at_most(const symbol_set::symbol_range& a, int value) {
+    return a.upper() <= value;
+}
+
+/// \brief Orders ranges by their lower bound
+static inline bool lower_less_than(const symbol_set::symbol_range& a, int value) {
+    return a.lower() < value;
+}
+
+/// \brief Orders a value relative to the lower bound of a range
+static inline bool before_lower(int value, const symbol_set::symbol_range& a) {
+    return value < a.lower();
+}
+
 /// \brief Merges this symbol set with another
 symbol_set& symbol_set::operator|=(const symbol_set& mergeWith) {
-    // Merge each of the ranges in turn
-    // TODO: this will perform a search for each range, we can take advantage of the ordering to improve performance here
-    for (symbol_store::const_iterator symRange = mergeWith.m_Symbols.begin(); symRange != mergeWith.m_Symbols.end(); ++symRange) {
-        operator|=(*symRange);
+    // Nothing to do if the other set is empty (or is this set)
+    if (mergeWith.m_Symbols.empty() || &mergeWith == this) return *this;
+    
+    // Just a copy if this set is empty
+    if (m_Symbols.empty()) {
+        m_Symbols = mergeWith.m_Symbols;
+        return *this;
     }
     
+    // Merge the two sorted lists of ranges
+    symbol_store merged;
+    merged.reserve(m_Symbols.size() + mergeWith.m_Symbols.size());
+    
+    symbol_store::const_iterator ours   = m_Symbols.begin();
+    symbol_store::const_iterator theirs = mergeWith.m_Symbols.begin();
+    
+    while (ours != m_Symbols.end() || theirs != mergeWith.m_Symbols.end()) {
+        // Take whichever range starts first
+        if (theirs == mergeWith.m_Symbols.end() || (ours != m_Symbols.end() && ours->lower() <= theirs->lower())) {
+            append(merged, *ours);
+            ++ours;
+        } else {
+            append(merged, *theirs);
+            ++theirs;
+        }
+    }
+    
+    m_Symbols.swap(merged);
     return *this;
 }
 
 /// \brief Merges this symbol set with a range of symbols
 symbol_set& symbol_set::operator|=(const symbol_range& mergeWith) {
-    // Find the first range >= the merge point
-    // We've modified the comparator used by the set so that only the lower bound is compared, so this is the first item with a lower bound >= the
-    // new range (additionally, we maintain the set in such a way that there are no overlapping ranges)
-    symbol_store::iterator firstGreaterThan = m_Symbols.lower_bound(mergeWith);
-    
-    // If this isn't at the beginning, it's possible we partially overlap the preceeding set
-    if (firstGreaterThan != m_Symbols.begin()) {
-        // Get the preceeding set
-        symbol_store::iterator previous = firstGreaterThan;
-        previous--;
-        
-        // See if we overlap
-        if (previous->upper() >= mergeWith.lower()) {
-            // They do: start merging at the earlier set
-            firstGreaterThan = previous;
-        }
-    }
+    if (mergeWith.lower() >= mergeWith.upper()) return *this;
     
-    // If we're at the end of the list, then we can just add the new range (there's no overlap)
-    if (firstGreaterThan == m_Symbols.end() || !mergeWith.can_merge(*firstGreaterThan)) {
-        m_Symbols.insert(mergeWith);
+    // Find the ranges that overlap or touch the new range
+    symbol_store::iterator firstMerged  = lower_bound(m_Symbols.begin(), m_Symbols.end(), mergeWith.lower(), upper_less_than);
+    symbol_store::iterator lastMerged   = upper_bound(firstMerged, m_Symbols.end(), mergeWith.upper(), before_lower);
+    
+    // If there are none, then we can just insert the new range
+    if (firstMerged == lastMerged) {
+        m_Symbols.insert(firstMerged, mergeWith);
         return *this;
     }
     
-    // There's some overlap between ranges
+    // Otherwise, replace the first range with the merged range and remove the rest
+    symbol_range mergedRange = mergeWith.merge(*firstMerged).merge(*(lastMerged-1));
+    
+    *firstMerged = mergedRange;
+    m_Symbols.erase(firstMerged+1, lastMerged);
     
-    // Find the first item that is > the upper value (ie, the first item we don't merge with)
-    symbol_store::iterator  finalValue  = m_Symbols.upper_bound(mergeWith.upper());
-    symbol_range            mergedRange = mergeWith;
+    return *this;
+}
 
-    // Merge any ranges that overlap
-    for (symbol_store::iterator mergeWith = firstGreaterThan; mergeWith != finalValue; ++mergeWith) {
-        mergedRange = mergedRange.merge(*mergeWith);
+/// \brief Restricts this set to the symbols common between two sets
+symbol_set& symbol_set::operator&=(const symbol_set& andWith) {
+    if (&andWith == this) return *this;
+    
+    // Intersect the two sorted lists of ranges
+    symbol_store common;
+    
+    symbol_store::const_iterator ours   = m_Symbols.begin();
+    symbol_store::const_iterator theirs = andWith.m_Symbols.begin();
+    
+    // The special symbols (which are all negative) are always kept: the intersection behaves as though it was excluding the inverse of the other set
+    for (; ours != m_Symbols.end() && ours->lower() < 0; ++ours) {
+        append(common, symbol_range(ours->lower(), min(ours->upper(), 0)));
+        
+        // Deal with any positive part of this range as normal
+        if (ours->upper() > 0) break;
     }
     
-    // Replace the merged values
-    m_Symbols.erase(firstGreaterThan, finalValue);
-    m_Symbols.insert(mergedRange);
+    while (ours != m_Symbols.end() && theirs != andWith.m_Symbols.end()) {
+        // Add the overlap between these ranges, if there is one
+        int lower = max(max(ours->lower(), theirs->lower()), 0);
+        int upper = min(ours->upper(), theirs->upper());
+        
+        if (lower < upper) {
+            append(common, symbol_range(lower, upper));
+        }
+        
+        // Move past whichever range ends first
+        if (ours->upper() < theirs->upper()) {
+            ++ours;
+        } else {
+            ++theirs;
+        }
+    }
     
+    m_Symbols.swap(common);
     return *this;
 }
 
 /// \brief Excludes a range of symbols from this set
 void symbol_set::exclude(const symbol_set& toExclude) {
-    // Exclude each of the ranges in turn
-    // TODO: this will perform a search for each range, we can take advantage of the ordering to improve performance here
-    for (symbol_store::const_iterator excluded = toExclude.m_Symbols.begin(); excluded != toExclude.m_Symbols.end(); ++excluded) {
-        exclude(*excluded);
+    if (&toExclude == this) {
+        m_Symbols.clear();
+        return;
     }
-}
-
-/// \brief Excludes a range of symbols from this set
-void symbol_set::exclude(const symbol_range& exclude) {
-    // Find the first range >= the merge point
-    symbol_store::iterator firstGreaterThan = m_Symbols.lower_bound(exclude);
-    
-    // If this isn't at the beginning, it's possible we partially overlap the preceeding set
-    if (firstGreaterThan != m_Symbols.begin()) {
-        // Get the preceeding set
-        symbol_store::iterator previous = firstGreaterThan;
-        previous--;
+    
+    if (m_Symbols.empty() || toExclude.m_Symbols.empty()) return;
+    
+    // Subtract the sorted list of excluded ranges from our ranges
+    symbol_store remaining;
+    remaining.reserve(m_Symbols.size());
+    
+    symbol_store::const_iterator excluded = toExclude.m_Symbols.begin();
+    
+    for (symbol_store::const_iterator ours = m_Symbols.begin(); ours != m_Symbols.end(); ++ours) {
+        int lower = ours->lower();
         
-        // See if we overlap
-        if (previous->upper() >= exclude.lower()) {
-            // They do: start merging at the earlier set
-            firstGreaterThan = previous;
+        // Skip excluded ranges that end before this range starts
+        while (excluded != toExclude.m_Symbols.end() && excluded->upper() <= lower) {
+            ++excluded;
+        }
+        
+        // Cut out any excluded ranges that start before this one ends
+        while (excluded != toExclude.m_Symbols.end() && excluded->lower() < ours->upper()) {
+            if (excluded->lower() > lower) {
+                remaining.push_back(symbol_range(lower, excluded->lower()));
+            }
+            
+            if (excluded->upper() >= ours->upper()) {
+                // Remainder of this range is excluded (and the excluded range might affect the next one)
+                lower = ours->upper();
+                break;
+            }
+            
+            lower = excluded->upper();
+            ++excluded;
+        }
+        
+        // Keep what's left
+        if (lower < ours->upper()) {
+            remaining.push_back(symbol_range(lower, ours->upper()));
         }
     }
     
-    // If we're at the end of the list, then there's nothing to do (there's no overlap)
-    if (firstGreaterThan == m_Symbols.end() || !exclude.can_merge(*firstGreaterThan)) {
-        return;
-    }
-    
-    // There's some overlap between ranges
-    
-    // Find the first item that is > the upper value
-    symbol_store::iterator finalValue  = m_Symbols.upper_bound(exclude.upper());
+    m_Symbols.swap(remaining);
+}
+
+/// \brief Excludes a range of symbols from this set
+void symbol_set::exclude(const symbol_range& exclude) {
+    if (exclude.lower() >= exclude.upper()) return;
     
-    // Change it to the final value in the range affected by this exclusion
-    symbol_store::iterator eraseTo = finalValue;
-    finalValue--;
+    // Find the ranges that overlap the excluded range
+    symbol_store::iterator firstOverlap = lower_bound(m_Symbols.begin(), m_Symbols.end(), exclude.lower(), upper_at_most);
+    symbol_store::iterator lastOverlap  = lower_bound(firstOverlap, m_Symbols.end(), exclude.upper(), lower_less_than);
     
-    // Get the initial and final ranges
-    symbol_range initial = *firstGreaterThan;
-    symbol_range final   = *finalValue;
+    // Nothing to do if there's no overlap
+    if (firstOverlap == lastOverlap) return;
     
-    // Erase the ranges with excluded characters
-    m_Symbols.erase(firstGreaterThan, eraseTo);
+    // Work out the ranges that are left at either end
+    symbol_range initial = *firstOverlap;
+    symbol_range final   = *(lastOverlap-1);
+    symbol_range kept[2] = { symbol_range(0, 0), symbol_range(0, 0) };
+    int          numKept = 0;
     
-    // Add new ranges
     if (initial.lower() < exclude.lower()) {
-        m_Symbols.insert(symbol_range(initial.lower(), exclude.lower()));
+        kept[numKept++] = symbol_range(initial.lower(), exclude.lower());
     }
     
     if (final.upper() > exclude.upper()) {
-        m_Symbols.insert(symbol_range(exclude.upper(), final.upper()));
+        kept[numKept++] = symbol_range(exclude.upper(), final.upper());
+    }
+    
+    // Replace the overlapping ranges with the ones that are left
+    int overlapping = (int) (lastOverlap - firstOverlap);
+    
+    if (overlapping >= numKept) {
+        copy(kept, kept + numKept, firstOverlap);
+        m_Symbols.erase(firstOverlap + numKept, lastOverlap);
+    } else {
+        // A range was split in two
+        *firstOverlap = kept[1];
+        m_Symbols.insert(firstOverlap, kept[0]);
     }
 }
 
@@ -171,12 +261,13 @@ void symbol_set::invert() {
     // The last symbol range that we've seen
     symbol_range last(0,0);
     symbol_store newRanges;
+    newRanges.reserve(m_Symbols.size() + 1);
     
     // Add the ranges that are excluded from this set (except for the range to the maximum symbol)
     for (symbol_store::iterator excludedRange = m_Symbols.begin(); excludedRange != m_Symbols.end(); ++excludedRange) {
         // Insert a range from the last known position to the next position
         if (excludedRange->lower() != last.upper()) {
-            newRanges.insert(symbol_range(last.upper(), excludedRange->lower()));
+            newRanges.push_back(symbol_range(last.upper(), excludedRange->lower()));
         }
         
         // Update the last position
@@ -185,7 +276,7 @@ void symbol_set::invert() {
     
     // Add a range from the last position to the maximum symbol number
     if (last.upper() < c_MaxSymbol) {
-        newRanges.insert(symbol_range(last.upper(), c_MaxSymbol));
+        newRanges.push_back(symbol_range(last.upper(), c_MaxSymbol));
     }
     
     // Store in this object
@@ -193,15 +284,12 @@ void symbol_set::invert() {
 }
 
 /// \brief True if the specified symbol is in this set
-bool symbol_set::operator[](int symbol) {
-    // Find the item nearest this symbol
-    symbol_store::iterator nearestValue = m_Symbols.upper_bound(symbol);
-    
-    // Doesn't exist if this is at the start
-    if (nearestValue == m_Symbols.begin()) return false;
+bool symbol_set::operator[](int symbol) const {
+    // Find the first range that ends after this symbol
+    symbol_store::const_iterator nearestValue = lower_bound(m_Symbols.begin(), m_Symbols.end(), symbol, upper_at_most);
     
-    // Move back to the first value with a value <= the symbol
-    nearestValue--;
+    // Doesn't exist if there's no such range
+    if (nearestValue == m_Symbols.end()) return false;
     
     // See if this character is contained in this range
     return (*nearestValue)[symbol];
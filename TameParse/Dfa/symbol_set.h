@@ -28,7 +28,7 @@
 #ifndef _DFA_SYMBOL_SET_H
 #define _DFA_SYMBOL_SET_H
 
-#include <set>
+#include <vector>
 
 #include "TameParse/Dfa/range.h"
 #include "TameParse/Util/container.h"
@@ -70,10 +70,26 @@ namespace dfa {
         static const int c_MaxSymbol = 0x7fffffff;
 
         /// \brief Type of a set of symbols
-        typedef std::set<symbol_range, range<int>::sort_by_lower> symbol_store;
+        ///
+        /// This is kept sorted, and the ranges never overlap or touch each other (ranges that would are merged together),
+        /// which lets the set operations be performed by merging the two lists of ranges.
+        typedef std::vector<symbol_range> symbol_store;
         
         /// \brief The symbols in this set
         symbol_store m_Symbols;
+        
+        /// \brief Appends a range to the end of a store, merging it with the last range if they touch
+        static inline void append(symbol_store& store, const symbol_range& symbols) {
+            if (symbols.lower() >= symbols.upper()) return;
+            
+            if (!store.empty() && store.back().upper() >= symbols.lower()) {
+                if (store.back().upper() < symbols.upper()) {
+                    store.back() = symbol_range(store.back().lower(), symbols.upper());
+                }
+            } else {
+                store.push_back(symbols);
+            }
+        }
 
     public:
         /// \brief Creates an empty symbol set
@@ -108,18 +124,27 @@ namespace dfa {
         /// \brief Merges this symbol set with a range of symbols
         symbol_set& operator|=(const symbol_range& mergeWith);
         
-        /// \brief Restricts this set to the symbols common between two sets
-        inline symbol_set& operator&=(const symbol_set& andWith) {
-            exclude(~andWith);
-            return *this;
+        /// \brief Reserves space for the specified number of ranges
+        inline void reserve(size_t numRanges) { m_Symbols.reserve(numRanges); }
+        
+        /// \brief Adds a range of symbols that starts at or after the start of every range already in this set
+        ///
+        /// This is much faster than |= when building a set from ranges that are sorted by their lower bound. A range
+        /// that starts earlier is merged in using |=.
+        inline void add_sorted(const symbol_range& symbols) {
+            if (m_Symbols.empty() || m_Symbols.back().lower() <= symbols.lower()) {
+                append(m_Symbols, symbols);
+            } else {
+                operator|=(symbols);
+            }
         }
         
+        /// \brief Restricts this set to the symbols common between two sets
+        symbol_set& operator&=(const symbol_set& andWith);
+        
         /// \brief Restricts this set to the symbols common between two sets
         inline symbol_set& operator&=(const symbol_range& andWith) {
-            symbol_set notRange(andWith);
-            notRange.invert();
-            exclude(notRange);
-            return *this;
+            return operator&=(symbol_set(andWith));
         }
         
         /// \brief Excludes a range of symbols from this set
@@ -167,12 +192,12 @@ namespace dfa {
         
     public:
         /// \brief True if this is an empty symbol set
-        inline bool empty() {
+        inline bool empty() const {
             return m_Symbols.empty();
         }
         
         /// \brief True if the specified symbol is in this set
-        bool operator[](int symbol);
+        bool operator[](int symbol) const;
         
         /// \brief Determines if this set represents the same as another set
         bool operator==(const symbol_set& compareTo) const;
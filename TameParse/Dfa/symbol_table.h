@@ -30,6 +30,9 @@
 
 #include <cstdlib>
 #include <cstring>
+#include <map>
+#include <vector>
+
 #include "TameParse/Dfa/symbol_map.h"
 
 namespace dfa {
@@ -359,6 +362,64 @@ namespace dfa {
         }
     };
     
+    ///
+    /// \brief Symbol level that looks up symbols less than 256 in a flat table before falling back to another level
+    ///
+    /// Most input to most lexers is ASCII, so this avoids the chain of lookups required by a multi-level table in 
+    /// the common case. The symbols are still stored in the fallback level, so it can still be converted to a hard 
+    /// coded table (which can be combined with the flat table with hard_coded_fast_symbol_table).
+    ///
+    template<typename next_level> struct fast_symbol_level {
+        /// \brief Number of entries in the flat table
+        static const int c_FastSize = 256;
+        
+        /// \brief The symbol sets for the symbols less than c_FastSize
+        int Fast[c_FastSize];
+        
+        /// \brief The table used for the remaining symbols
+        next_level Slow;
+        
+        /// \brief Creates an empty symbol level
+        fast_symbol_level() {
+            for (int index=0; index<c_FastSize; ++index) {
+                Fast[index] = symbol_set::null;
+            }
+        }
+        
+        /// \brief Sets all the symbols in the specified range to the specified symbol
+        void add_range(int base, const range<int>& range, int symbol) {
+            // Fill in the flat table
+            int startIndex  = range.lower() - base;
+            int endIndex    = range.upper() - base;
+            
+            if (startIndex < 0)         startIndex  = 0;
+            if (endIndex > c_FastSize)  endIndex    = c_FastSize;
+            
+            for (int index = startIndex; index < endIndex; ++index) {
+                Fast[index] = symbol;
+            }
+            
+            // Add to the fallback table
+            Slow.add_range(base, range, symbol);
+        }
+        
+        /// \brief Looks up a value in this table
+        inline int lookup(int val) const {
+            if ((unsigned int) val < (unsigned int) c_FastSize) return Fast[val];
+            return Slow.lookup(val);
+        }
+        
+        /// \brief The size of this item in bytes
+        inline size_t size() const {
+            return sizeof(Fast) + Slow.size();
+        }
+        
+        /// \brief Converts the fallback table to a table suitable for use with the hard_coded_symbol_table class
+        inline int* to_hard_coded_table(size_t& size) {
+            return Slow.to_hard_coded_table(size);
+        }
+    };
+    
     ///
     /// \brief Template class representing the default symbol_level definition to use for a specific character type
     ///
@@ -370,7 +431,7 @@ namespace dfa {
     ///
     /// \brief Default symbol level class for parsers accepting 16-bit unicode languages
     ///
-    template<> class symbol_level_for<wchar_t> : public symbol_level<symbol_level<int, 0xff, 0>, 0xff00, 8> {
+    template<> class symbol_level_for<wchar_t> : public fast_symbol_level<symbol_level<symbol_level<int, 0xff, 0>, 0xff00, 8> > {
     };
     
     ///
@@ -395,6 +456,36 @@ namespace dfa {
         inline void add_range(const range<int>& range, int symbol) {
             table.add_range(0, range, symbol);
         }
+        
+        /// \brief Converts the basic multilingual plane of this table to the blocks used by hard_coded_bmp_symbol_table
+        ///
+        /// blocks is set to the block number for each of the 256 possible values of the upper 8 bits of a character, and
+        /// sets to the contents of the blocks, 256 symbol sets at a time. Blocks with the same contents are shared.
+        void to_bmp_blocks(std::vector<unsigned char>& blocks, std::vector<int>& sets) const {
+            std::map<std::vector<int>, int> blockNumbers;
+            std::vector<int>                block(256);
+            
+            blocks.clear();
+            sets.clear();
+            
+            for (int upper = 0; upper < 256; ++upper) {
+                // Look up the sets for this block
+                for (int lower = 0; lower < 256; ++lower) {
+                    block[lower] = lookup((symbol_type) ((upper << 8) | lower));
+                }
+                
+                // Reuse an existing block with the same contents if there is one
+                std::map<std::vector<int>, int>::iterator found = blockNumbers.find(block);
+                
+                if (found == blockNumbers.end()) {
+                    int blockNumber = (int) blockNumbers.size();
+                    found = blockNumbers.insert(std::make_pair(block, blockNumber)).first;
+                    sets.insert(sets.end(), block.begin(), block.end());
+                }
+                
+                blocks.push_back((unsigned char) found->second);
+            }
+        }
     };
 }
 
@@ -0,0 +1,84 @@
+//
+//  token_array.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _DFA_TOKEN_ARRAY_H
+#define _DFA_TOKEN_ARRAY_H
+
+#include <vector>
+
+#include "TameParse/Dfa/basic_lexer.h"
+#include "TameParse/Dfa/lexeme.h"
+
+namespace dfa {
+    ///
+    /// \brief A buffer of symbols that has been split into tokens in advance
+    ///
+    /// This lets an input be lexed once and then parsed several times: with different start symbols, during error
+    /// recovery, or by parsers on other threads. Parser actions that are created from a token array (such as
+    /// lr::ast_parser_actions) read the tokens by index instead of running a lexer. Nothing in this object changes after
+    /// it is constructed, so any number of parsers can read it at the same time.
+    ///
+    /// The tokens refer to the symbols in the buffer rather than copying them, so the buffer must remain valid and
+    /// unchanged for as long as this object, or any lexeme created from it, is in use.
+    ///
+    class token_array {
+    private:
+        /// \brief The buffer that was split into tokens
+        const int* m_Symbols;
+        
+        /// \brief The tokens, with offsets relative to m_Symbols
+        std::vector<token> m_Tokens;
+    
+    public:
+        /// \brief Splits a buffer into tokens using the specified lexer
+        token_array(const basic_lexer& lexer, const int* begin, const int* end);
+        
+        /// \brief Creates an array from tokens that have already been found, with offsets relative to symbols
+        token_array(const int* symbols, const std::vector<token>& tokens);
+        
+        /// \brief The buffer that was split into tokens
+        inline const int* symbols() const { return m_Symbols; }
+        
+        /// \brief The number of tokens in this array
+        inline size_t size() const { return m_Tokens.size(); }
+        
+        /// \brief True if there are no tokens in this array
+        inline bool empty() const { return m_Tokens.empty(); }
+        
+        /// \brief The token at the specified index
+        inline const token& operator[](size_t index) const { return m_Tokens[index]; }
+        
+        /// \brief Creates a lexeme for the token at the specified index
+        ///
+        /// The lexeme refers to the symbols in the buffer, and comes from the same free list as the lexemes created by
+        /// a lexer, so this doesn't normally need to allocate any memory.
+        inline lexeme* create_lexeme(size_t index) const {
+            const token& tok = m_Tokens[index];
+            return new lexeme(m_Symbols + tok.offset, (size_t) tok.length, position(tok.offset, tok.line, tok.column), tok.symbol);
+        }
+    };
+}
+
+#endif
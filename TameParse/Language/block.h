@@ -29,12 +29,16 @@
 #define _LANGUAGE_BLOCK_H
 
 #include "TameParse/Dfa/position.h"
+#include "TameParse/Util/arena.h"
 
 namespace language {
     ///
     /// \brief Common superclass for a block in a language file
     ///
-    class block {
+    /// Blocks may be allocated from the arena belonging to the definition file that contains them, using
+    /// new (pool) T(...). Copies of blocks are always made on the heap.
+    ///
+    class block : public util::arena_object {
     public:
         /// \brief Position type
         typedef dfa::position position;
@@ -31,11 +31,19 @@ using namespace std;
 using namespace language;
 
 /// \brief Creates a new definition file, containing no blocks
-definition_file::definition_file() {
+definition_file::definition_file()
+: m_Arena(NULL) {
+}
+
+/// \brief Creates a new definition file whose blocks can be allocated from the specified arena
+definition_file::definition_file(util::arena* pool)
+: m_Arena(pool) {
 }
 
 /// \brief Creates a new definition file by copying an existing one
-definition_file::definition_file(const definition_file& copyFrom) {
+definition_file::definition_file(const definition_file& copyFrom)
+: block(copyFrom)
+, m_Arena(NULL) {
     (*this) = copyFrom;
 }
 
@@ -69,6 +77,10 @@ definition_file::~definition_file() {
         delete *deleteBlock;
     }
     m_Blocks.clear();
+    
+    // The memory for any blocks allocated from the arena is freed along with it
+    delete m_Arena;
+    m_Arena = NULL;
 }
 
 /// \brief Adds a new top-level block to this object; this object will be responsible for freeing the block
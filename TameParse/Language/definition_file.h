@@ -50,10 +50,18 @@ namespace language {
         /// \brief The blocks that make up this definition file
         block_list m_Blocks;
         
+        /// \brief The arena that the blocks in this file were allocated from (NULL if they are all on the heap)
+        util::arena* m_Arena;
+        
     public:
         /// \brief Creates a new definition file, containing no blocks
         definition_file();
         
+        /// \brief Creates a new definition file whose blocks can be allocated from the specified arena
+        ///
+        /// This object takes ownership of the arena, which is destroyed after the blocks have been freed.
+        explicit definition_file(util::arena* pool);
+        
         /// \brief Creates a new definition file by copying an existing one
         definition_file(const definition_file& copyFrom);
         
@@ -72,6 +80,9 @@ namespace language {
         /// \brief The final block in the definition file
         inline const iterator end() const   { return m_Blocks.end(); }
         
+        /// \brief The arena that blocks in this file should be allocated from (NULL to use the heap)
+        inline util::arena* pool() const    { return m_Arena; }
+        
     public:
         /// \brief Creates a clone of this file
         inline definition_file* clone() const { return new definition_file(*this); }
@@ -60,85 +60,106 @@ wstring formatter::to_string(const contextfree::nonterminal& nt, const contextfr
 
 /// \brief Turns a guard item into a string
 wstring formatter::to_string(const guard& nt, const grammar& gram, const terminal_dictionary& dict) {
-    // Create a stream to build the result up into
     wstringstream res;
-    
-    res << L"[=> ";
-    res << to_string(*nt.get_rule(), gram, dict, -1, false);
-    res << L"]";
-    
+    write(res, nt, gram, dict);
     return res.str();
 }
 
+/// \brief Writes a guard item to a stream
+void formatter::write(std::wostream& target, const contextfree::guard& nt, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict) {
+    target << L"[=> ";
+    write(target, *nt.get_rule(), gram, dict, -1, false);
+    target << L"]";
+}
+
 /// \brief Turns an item into a string
 wstring formatter::to_string(const contextfree::item& it, const grammar& gram, const terminal_dictionary& dict) {
+    // Terminals and nonterminals are just names, so there's no need to build them up in a stream
+    if (it.type() == item::terminal)    return dict.name_for_symbol(it.symbol());
+    if (it.type() == item::nonterminal) return gram.name_for_nonterminal(it.symbol());
+    
+    wstringstream res;
+    write(res, it, gram, dict);
+    return res.str();
+}
+
+/// \brief Writes an item to a stream
+void formatter::write(std::wostream& target, const contextfree::item& it, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict) {
     // Some item types can be represented quite simply
     switch (it.type()) {
-        case item::empty:   return L"[empty]";
-        case item::eoi:     return L"$";
-        case item::eog:     return L"%";
+        case item::empty:   target << L"[empty]";   return;
+        case item::eoi:     target << L"$";         return;
+        case item::eog:     target << L"%";         return;
         default:            break;
     }
     
     // Try to cast the item into the various different types that we know about
-    if (it.type() == item::terminal)    return dict.name_for_symbol(it.symbol());
-    if (it.type() == item::nonterminal) return gram.name_for_nonterminal(it.symbol());
+    if (it.type() == item::terminal) {
+        target << dict.name_for_symbol(it.symbol());
+        return;
+    }
+    if (it.type() == item::nonterminal) {
+        target << gram.name_for_nonterminal(it.symbol());
+        return;
+    }
     
     const guard* guar = it.cast_guard();
-    if (guar) return to_string(*guar, gram, dict);
+    if (guar) {
+        write(target, *guar, gram, dict);
+        return;
+    }
     
     // EBNF items
-    wstringstream buf;
-    
     const ebnf*                     eb      = it.cast_ebnf();
     
     if (eb && eb->type() == item::alternative) {
         // X | Y | Z form of rule
-        buf << L"(";
+        target << L"(";
         
         // Convert all of the rules in this item
         bool first = true;
         for (ebnf::rule_iterator nextRule = eb->first_rule(); nextRule != eb->last_rule(); ++nextRule) {
             // Append the '|'
-            buf << L" ";
-            if (!first) buf << L"| ";
+            target << L" ";
+            if (!first) target << L"| ";
             
             // Convert the rule to a string
-            buf << to_string(**nextRule, gram, dict, -1, false);
+            write(target, **nextRule, gram, dict, -1, false);
             
             // No longer on the first item
             first = false;
         }
         
-        buf << L" )";
-        
-        // This is the result
-        return buf.str();
+        target << L" )";
         
     } else if (eb && (eb->type() == item::optional || eb->type() == item::repeat || eb->type() == item::repeat_zero_or_one)) {
         
         // Repeating style rule: first put the contents of the rule in brackets
-        buf << L"( " << to_string(*eb->get_rule(), gram, dict, -1, false) << L" )";
+        target << L"( ";
+        write(target, *eb->get_rule(), gram, dict, -1, false);
+        target << L" )";
         
         // Now add the appropriate character
-        if (eb->type() == item::optional)           buf << L"?";
-        if (eb->type() == item::repeat)             buf << L"+";
-        if (eb->type() == item::repeat_zero_or_one) buf << L"*";
+        if (eb->type() == item::optional)           target << L"?";
+        if (eb->type() == item::repeat)             target << L"+";
+        if (eb->type() == item::repeat_zero_or_one) target << L"*";
         
-        // Done
-        return buf.str();
+    } else {
+        // Unknown item type
+        target << L"???";
     }
-    
-    // Unknown item type
-    return L"???";
 }
 
 /// \brief Turns an item set into a string
 std::wstring formatter::to_string(const contextfree::item_set& it, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict) {
-    // Start creating the result
     wstringstream res;
-    
-    res << L"(";
+    write(res, it, gram, dict);
+    return res.str();
+}
+
+/// \brief Writes an item set to a stream
+void formatter::write(std::wostream& target, const contextfree::item_set& it, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict) {
+    target << L"(";
     
     // All but the first item are preceeded by commas
     bool isFirst = true;
@@ -146,29 +167,33 @@ std::wstring formatter::to_string(const contextfree::item_set& it, const context
     for (item_set::const_iterator nextItem = it.begin(); nextItem != it.end(); ++nextItem) {
         // Add commas
         if (!isFirst) {
-            res << L", ";
+            target << L", ";
         }
         
         // Add the next item
-        res << to_string(**nextItem, gram, dict);
+        write(target, **nextItem, gram, dict);
         
         // Next item isn't the first any more
         isFirst = false;
     }
     
     // Finish up the string
-    res << L")";
-    return res.str();
+    target << L")";
 }
 
 /// \brief Turns a rule into a string, with an optional dot position
 wstring formatter::to_string(const rule& rule, const grammar& gram, const terminal_dictionary& dict, int dotPos, bool showNonterminal) {
-    // Create the stream where we'll put the result
     wstringstream res;
-    
+    write(res, rule, gram, dict, dotPos, showNonterminal);
+    return res.str();
+}
+
+/// \brief Writes a rule to a stream, with an optional 'dot position'
+void formatter::write(std::wostream& target, const contextfree::rule& rule, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict, int dotPos, bool showNonterminal) {
     // Add the nonterminal if requested
     if (showNonterminal) {
-        res << to_string(*rule.nonterminal(), gram, dict) << L" = ";
+        write(target, *rule.nonterminal(), gram, dict);
+        target << L" = ";
     }
     
     // Append the rest of the rule
@@ -176,31 +201,32 @@ wstring formatter::to_string(const rule& rule, const grammar& gram, const termin
     int pos = 0;
     for (rule::iterator nextRule = rule.begin(); nextRule != rule.end(); ++nextRule, ++pos) {
         // Space separates all except the first item
-        if (!first)         res << L" ";
+        if (!first)         target << L" ";
         
         // Add the 'dot' (we use '^' to avoid confusing ourselves with the EBNF meaning of the more traditional '*')
-        if (dotPos == pos)  res << L"^ ";
+        if (dotPos == pos)  target << L"^ ";
         
         // Append this item
-        res << to_string(**nextRule, gram, dict);
+        write(target, **nextRule, gram, dict);
         first = false;
     }
     
     // The 'dot' can appear at the end of the rule as well
     if (dotPos == pos) {
-        if (!first) res << L" ";
-        res << L"^";
+        if (!first) target << L" ";
+        target << L"^";
     }
-    
-    // Return this as the result
-    return res.str();
 }
 
 /// \brief Turns a grammar into a (large) string
 wstring formatter::to_string(const grammar& gram, const terminal_dictionary& dict) {
-    // Create the result
     wstringstream res;
+    write(res, gram, dict);
+    return res.str();
+}
 
+/// \brief Writes a grammar to a stream
+void formatter::write(std::wostream& target, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict) {
     // Flag that indicates if we've previously added a newline
     bool addedNewline = true;
 
@@ -208,7 +234,7 @@ wstring formatter::to_string(const grammar& gram, const terminal_dictionary& dic
     for (int ntId = 0; ntId < gram.max_item_identifier(); ++ntId) {
         // Add a newline between nonterminals
         if (!addedNewline) {
-            res << endl;
+            target << endl;
             addedNewline = true;
         }
         
@@ -217,13 +243,11 @@ wstring formatter::to_string(const grammar& gram, const terminal_dictionary& dic
         
         // Add them to the result
         for (rule_list::const_iterator rule = rules.begin(); rule != rules.end(); ++rule) {
-            res << to_string(**rule, gram, dict, -1, true) << endl;
+            write(target, **rule, gram, dict, -1, true);
+            target << endl;
             addedNewline = false;
         }
     }
-    
-    // Convert to a string
-    return res.str();
 }
 
 /// \brief Turns a LR(0) item into a string
@@ -231,13 +255,23 @@ std::wstring formatter::to_string(const lr::lr0_item& item, const contextfree::g
     return to_string(*item.rule(), gram, dict, item.offset(), true);
 }
 
+/// \brief Writes a LR(0) item to a stream
+void formatter::write(std::wostream& target, const lr::lr0_item& item, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict) {
+    write(target, *item.rule(), gram, dict, item.offset(), true);
+}
+
 /// \brief Turns a LR(1) item into a string
 std::wstring formatter::to_string(const lr::lr1_item& item, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict) {
     wstringstream res;
-    
+    write(res, item, gram, dict);
+    return res.str();
+}
+
+/// \brief Writes a LR(1) item to a stream
+void formatter::write(std::wostream& target, const lr::lr1_item& item, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict) {
     // Write out the LR(0) item
     const lr0_item& lr0item = item;
-    res << to_string(lr0item, gram, dict);
+    write(target, lr0item, gram, dict);
     
     // Write out the lookahead
     typedef lr1_item::lookahead_set lookahead_set;
@@ -246,40 +280,42 @@ std::wstring formatter::to_string(const lr::lr1_item& item, const contextfree::g
     
     for (lookahead_set::const_iterator nextLookahead = la.begin(); nextLookahead != la.end(); ++nextLookahead) {
         if (first) {
-            res << L" [";
+            target << L" [";
         } else {
-            res << L", ";
+            target << L", ";
         }
         
-        res << to_string(**nextLookahead, gram, dict);
+        write(target, **nextLookahead, gram, dict);
         
         first = false;
     }
     
     if (!first) {
-        res << L"]";
+        target << L"]";
     }
-    
-    return res.str();
 }
 
 /// \brief Turns a LALR state into a string
 std::wstring formatter::to_string(const lr::lalr_state& state,  const contextfree::grammar& gram, 
                                   const contextfree::terminal_dictionary& dict, bool showClosure) {
-    // Create the result as a string stream
     wstringstream res;
-    
+    write(res, state, gram, dict, showClosure);
+    return res.str();
+}
+
+/// \brief Writes a LALR state to a stream
+void formatter::write(std::wostream& target, const lr::lalr_state& state, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict, bool showClosure) {
     // Output all of the items and their lookahead
     bool first = true;
     
     for (lalr_state::iterator nextItem = state.begin(); nextItem != state.end(); ++nextItem) {
         // Insert newlines
         if (!first) {
-            res << endl;
+            target << endl;
         }
         
         // Append the LR(0) item
-        res << to_string(**nextItem, gram, dict);
+        write(target, **nextItem, gram, dict);
         
         // Append the lookahead, if any
         typedef lr1_item::lookahead_set lookahead_set;
@@ -287,19 +323,19 @@ std::wstring formatter::to_string(const lr::lalr_state& state,  const contextfre
         
         // Only append lookahead if there is more than one item
         if (la && !la->empty()) {
-            res << L" (";
+            target << L" (";
             
             // Append each LA item in turn
             bool firstLookahead = true;
             for (lookahead_set::const_iterator nextLa = la->begin(); nextLa != la->end(); ++nextLa) {
                 if (!firstLookahead) {
-                    res << L", ";
+                    target << L", ";
                 }
-                res << to_string(**nextLa, gram, dict);
+                write(target, **nextLa, gram, dict);
                 firstLookahead = false;
             }
             
-            res << L")";
+            target << L")";
         }
         
         // No longer first
@@ -310,7 +346,7 @@ std::wstring formatter::to_string(const lr::lalr_state& state,  const contextfre
     if (showClosure) {
         // Add a separator between the original text and the closure
         if (!first) {
-            res << endl << L"--";
+            target << endl << L"--";
         }
         
         // Generate the closure for this item
@@ -321,66 +357,73 @@ std::wstring formatter::to_string(const lr::lalr_state& state,  const contextfre
         for (lr1_item_set::iterator nextItem = closure.begin(); nextItem != closure.end(); ++nextItem) {
             // Newline between items
             if (!first) {
-                res << endl;
+                target << endl;
             }
             
             // Write out the next item
-            res << to_string(**nextItem, gram, dict);
+            write(target, **nextItem, gram, dict);
             
             // No longer first
             first = false;
         }
     }
-    
-    return res.str();
 }
 
 /// \brief Turns a LR action into a string
 std::wstring formatter::to_string(const lr::lr_action& act, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict) {
-    // Create a stream to contain the result
     wstringstream res;
-    
+    write(res, act, gram, dict);
+    return res.str();
+}
+
+/// \brief Writes a LR action to a stream
+void formatter::write(std::wostream& target, const lr::lr_action& act, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict) {
     // Output the action name
     switch (act.type()) {
         case lr_action::act_accept:
-            res << L"Accept ";
+            target << L"Accept ";
             break;
             
         case lr_action::act_divert:
-            res << L"Divert ";
+            target << L"Divert ";
             break;
             
         case lr_action::act_guard:
-            res << L"Guard ";
+            target << L"Guard ";
             break;
             
         case lr_action::act_goto:
-            res << L"Goto " << act.next_state() << L" ";
+            target << L"Goto " << act.next_state() << L" ";
             break;
             
         case lr_action::act_ignore:
-            res << L"Ignore ";
+            target << L"Ignore ";
             break;
             
         case lr_action::act_reduce:
-            res << L"Reduce ";
+            target << L"Reduce ";
             break;
             
         case lr_action::act_weakreduce:
-            res << L"Weak reduce ";
+            target << L"Weak reduce ";
             break;
             
         case lr_action::act_shift:
-            res << L"Shift to " << act.next_state() << L" ";
+            target << L"Shift to " << act.next_state() << L" ";
             break;
             
         case lr_action::act_shiftstrong:
-            res << L"Shift strong equivalent to " << act.next_state() << L" ";
+            target << L"Shift strong equivalent to " << act.next_state() << L" ";
+            break;
+            
+        case lr_action::act_shiftreduce:
+            target << L"Shift and reduce via " << act.next_state() << L" ";
             break;
     }
     
     // Output the symbol this action occurs on
-    res << L"on " << to_string(*act.item(), gram, dict);
+    target << L"on ";
+    write(target, *act.item(), gram, dict);
     
     // For reductions, show the rule being reduced
     switch (act.type()) {
@@ -388,77 +431,84 @@ std::wstring formatter::to_string(const lr::lr_action& act, const contextfree::g
         case lr_action::act_weakreduce:
         case lr_action::act_accept:
         case lr_action::act_guard:
-            res << L" (" << to_string(*act.rule(), gram, dict) << L")";
+            target << L" (";
+            write(target, *act.rule(), gram, dict);
+            target << L")";
             break;
             
         default:
             break;
     }
-    
-    return res.str();
 }
 
 /// \brief Turns a LALR state machine into an enormous string
 std::wstring formatter::to_string(const lr::lalr_machine& machine,  const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict, bool showClosure) {
-    // Create a stream to hold the result
     wstringstream res;
-    
+    write(res, machine, gram, dict, showClosure);
+    return res.str();
+}
+
+/// \brief Writes a LALR state machine to a stream
+void formatter::write(std::wostream& target, const lr::lalr_machine& machine, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict, bool showClosure) {
     bool first = true;
     
     // Iterate through the states
     for (lalr_machine::state_iterator nextState = machine.first_state(); nextState != machine.last_state(); ++nextState) {
-        if (!first) res << endl << endl;
+        if (!first) target << endl << endl;
         
         // Write out the state
-        res << L"State #" << (*nextState)->identifier() << endl;
-        res << to_string(**nextState, gram, dict, showClosure);
+        target << L"State #" << (*nextState)->identifier() << endl;
+        write(target, **nextState, gram, dict, showClosure);
         
         // Write out the transitions
         typedef lalr_machine::transition_set transition_set;
         const transition_set& transitions = machine.transitions_for_state((*nextState)->identifier());
         
         if (!transitions.empty()) {
-            res << endl;
+            target << endl;
             for (transition_set::const_iterator transit = transitions.begin(); transit != transitions.end(); ++transit) {
-                res << endl << to_string(*transit->first, gram, dict) << L" -> " << transit->second;
+                target << endl;
+                write(target, *transit->first, gram, dict);
+                target << L" -> " << transit->second;
             }
         }
         
         first = false;
     }
-    
-    return res.str();
 }
 
 /// \brief Turns a LALR builder into an enormous string
 std::wstring formatter::to_string(const lr::lalr_builder& builder, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict, bool showClosure) {
-    // Create a stream to hold the result
     wstringstream res;
-    
+    write(res, builder, gram, dict, showClosure);
+    return res.str();
+}
+
+/// \brief Writes a LALR builder to a stream
+void formatter::write(std::wostream& target, const lr::lalr_builder& builder, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict, bool showClosure) {
     bool first = true;
     
     // Iterate through the states
     for (lalr_machine::state_iterator nextState = builder.machine().first_state(); nextState != builder.machine().last_state(); ++nextState) {
-        if (!first) res << endl << endl;
+        if (!first) target << endl << endl;
         
         // Write out the state
-        res << L"State #" << (*nextState)->identifier() << endl;
-        res << to_string(**nextState, gram, dict, showClosure);
+        target << L"State #" << (*nextState)->identifier() << endl;
+        write(target, **nextState, gram, dict, showClosure);
         
         // Write out the actions
         const lr_action_set& actions = builder.actions_for_state((*nextState)->identifier());
         
         if (!actions.empty()) {
-            res << endl;
+            target << endl;
             for (lr_action_set::const_iterator action = actions.begin(); action != actions.end(); ++action) {
-                res << endl << to_string(**action, gram, dict);
+                target << endl;
+                write(target, **action, gram, dict);
             }
         }
         
         first = false;
     }
-    
-    return res.str();
 }
 
 /// \brief Turns a LALR conflict into a string description
@@ -30,6 +30,7 @@
 
 #include <set>
 #include <string>
+#include <iostream>
 
 #include "TameParse/ContextFree/item.h"
 
@@ -60,6 +61,10 @@ namespace language {
     ///
     /// \brief Methods for formatting language items for display
     ///
+    /// The to_string methods return the text as a string. The write methods write the same text to a stream, which is
+    /// much faster for large objects such as state machines, as the text for each part doesn't need to be built up
+    /// and copied into the text for the object that contains it.
+    ///
     class formatter {
     public:
         /// \brief Turns a terminal into a string
@@ -70,37 +75,70 @@ namespace language {
         
         /// \brief Turns a guard item into a string
         static std::wstring to_string(const contextfree::guard& nt, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict);
+
+        /// \brief Writes a guard item to a stream
+        static void write(std::wostream& target, const contextfree::guard& nt, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict);
         
         /// \brief Turns an item into a string
         static std::wstring to_string(const contextfree::item& it, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict);
+
+        /// \brief Writes an item to a stream
+        static void write(std::wostream& target, const contextfree::item& it, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict);
         
         /// \brief Turns an item set into a string
         static std::wstring to_string(const contextfree::item_set& it, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict);
+
+        /// \brief Writes an item set to a stream
+        static void write(std::wostream& target, const contextfree::item_set& it, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict);
         
         /// \brief Turns a rule into a string, with an optional 'dot position'
         static std::wstring to_string(const contextfree::rule& rule, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict, int dotPos = -1, bool showNonterminal = true);
 
+        /// \brief Writes a rule to a stream, with an optional 'dot position'
+        static void write(std::wostream& target, const contextfree::rule& rule, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict, int dotPos = -1, bool showNonterminal = true);
+
         /// \brief Turns a grammar into a (large) string
         static std::wstring to_string(const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict);
+
+        /// \brief Writes a grammar to a stream
+        static void write(std::wostream& target, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict);
         
     public:
         /// \brief Turns a LR(0) item into a string
         static std::wstring to_string(const lr::lr0_item& item, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict);
 
+        /// \brief Writes a LR(0) item to a stream
+        static void write(std::wostream& target, const lr::lr0_item& item, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict);
+
         /// \brief Turns a LR(1) item into a string
         static std::wstring to_string(const lr::lr1_item& item, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict);
 
+        /// \brief Writes a LR(1) item to a stream
+        static void write(std::wostream& target, const lr::lr1_item& item, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict);
+
         /// \brief Turns a LALR state into a string
         static std::wstring to_string(const lr::lalr_state& state,  const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict, bool showClosure = false);
+
+        /// \brief Writes a LALR state to a stream
+        static void write(std::wostream& target, const lr::lalr_state& state, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict, bool showClosure = false);
         
         /// \brief Turns a LR action into a string
         static std::wstring to_string(const lr::lr_action& act, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict);
+
+        /// \brief Writes a LR action to a stream
+        static void write(std::wostream& target, const lr::lr_action& act, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict);
         
         /// \brief Turns a LALR state machine into an enormous string
         static std::wstring to_string(const lr::lalr_machine& machine,  const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict, bool showClosure = false);
+
+        /// \brief Writes a LALR state machine to a stream
+        static void write(std::wostream& target, const lr::lalr_machine& machine, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict, bool showClosure = false);
         
         /// \brief Turns a LALR builder into an enormous string
         static std::wstring to_string(const lr::lalr_builder& builder, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict, bool showClosure = false);
+
+        /// \brief Writes a LALR builder to a stream
+        static void write(std::wostream& target, const lr::lalr_builder& builder, const contextfree::grammar& gram, const contextfree::terminal_dictionary& dict, bool showClosure = false);
         
     public:
         /// \brief Turns a LALR conflict into a string description
@@ -81,7 +81,7 @@ typedef tameparse_language::list_of_Precedence_Item_n           list_of_Preceden
 typedef tameparse_language::Equal_Precedence_Items_n            ast_Equal_Precedence_Items;
 
 /// \brief Adds a test definition to the test block
-static bool add_test_definition(test_block* target, const ast_Test_Definition* defn) {
+static bool add_test_definition(test_block* target, const ast_Test_Definition* defn, arena* pool) {
     // Sanity check
     if (!defn->Nonterminal) return false;
 
@@ -133,7 +133,7 @@ static bool add_test_definition(test_block* target, const ast_Test_Definition* d
         testStringPos.increment();
 
         // Generate the test definition
-        test_definition* newDefn = new test_definition(nonterminalLanguage, nonterminalName, type, identifier, testString, (*spec)->Test_Specification->pos(), (*spec)->Test_Specification->final_pos(), testStringPos);
+        test_definition* newDefn = new (pool) test_definition(nonterminalLanguage, nonterminalName, type, identifier, testString, (*spec)->Test_Specification->pos(), (*spec)->Test_Specification->final_pos(), testStringPos);
 
         // Add to the target
         target->add_test_definition(newDefn);
@@ -144,7 +144,7 @@ static bool add_test_definition(test_block* target, const ast_Test_Definition* d
 }
 
 /// \brief Converts a parser block into a parser_block object
-static parser_block* definition_for(const ast_Parser_Block* parserBlock) {
+static parser_block* definition_for(const ast_Parser_Block* parserBlock, arena* pool) {
     // Sanity check
     if (!parserBlock->name)             return NULL;
     if (!parserBlock->language_name)    return NULL;
@@ -156,11 +156,11 @@ static parser_block* definition_for(const ast_Parser_Block* parserBlock) {
     }
 
     // Create the parser block
-    return new parser_block(parserBlock->name->content<wchar_t>(), parserBlock->language_name->content<wchar_t>(), startSymbols, parserBlock->pos(), parserBlock->final_pos());
+    return new (pool) parser_block(parserBlock->name->content<wchar_t>(), parserBlock->language_name->content<wchar_t>(), startSymbols, parserBlock->pos(), parserBlock->final_pos());
 }
 
 /// \brief Converts a test block into a test_block
-static test_block* definition_for(const ast_Test_Block* testBlock) {
+static test_block* definition_for(const ast_Test_Block* testBlock, arena* pool) {
     // Sanity check
     if (!testBlock->language_name)  return NULL;
     if (!testBlock->tests)          return NULL;
@@ -169,14 +169,14 @@ static test_block* definition_for(const ast_Test_Block* testBlock) {
     wstring languageName = testBlock->language_name->content<wchar_t>();
 
     // Create the result
-    test_block* result = new test_block(languageName, testBlock->pos(), testBlock->final_pos());
+    test_block* result = new (pool) test_block(languageName, testBlock->pos(), testBlock->final_pos());
 
     // Iterate through the test definitions
     for (ast_list_of_Test_Definition::iterator defn = testBlock->tests->begin();
          defn != testBlock->tests->end();
          ++defn) {
          // Add this definition to this block
-        if (!add_test_definition(result, (*defn)->Test_Definition)) {
+        if (!add_test_definition(result, (*defn)->Test_Definition, pool)) {
             // Bug: couldn't get this test definition
             delete result;
             return NULL;
@@ -226,10 +226,10 @@ static ebnf_item_attributes definition_for(const ast_Semantic_Specification* spe
 }
 
 /// \brief Definition for a simple EBNF item
-static ebnf_item* definition_for(const ast_Simple_Ebnf_Item* simpleItem);
+static ebnf_item* definition_for(const ast_Simple_Ebnf_Item* simpleItem, arena* pool);
 
 /// \brief Converts a full EBNF item into an ebnf_item object
-static ebnf_item* definition_for(const ast_Ebnf_Item* ebnfItem, const ebnf_item_attributes& attr) {
+static ebnf_item* definition_for(const ast_Ebnf_Item* ebnfItem, const ebnf_item_attributes& attr, arena* pool) {
     // Stick the items together
     bool        parenthesized   = false;            // True when parenthesized
     ebnf_item*  result          = NULL;
@@ -238,7 +238,7 @@ static ebnf_item* definition_for(const ast_Ebnf_Item* ebnfItem, const ebnf_item_
          item != ebnfItem->items->end(); 
          ++item) {
         // Get the definition for this item
-        ebnf_item* nextItem = definition_for((*item)->Simple_Ebnf_Item);
+        ebnf_item* nextItem = definition_for((*item)->Simple_Ebnf_Item, pool);
         
         if (!nextItem) {
             // Bug
@@ -252,7 +252,7 @@ static ebnf_item* definition_for(const ast_Ebnf_Item* ebnfItem, const ebnf_item_
         } else {
             if (!parenthesized) {
                 // Add parentheses around the result
-                ebnf_item* paren = new ebnf_item(ebnf_item::ebnf_parenthesized, ebnf_item_attributes(), ebnfItem->pos(), ebnfItem->final_pos());
+                ebnf_item* paren = new (pool) ebnf_item(ebnf_item::ebnf_parenthesized, ebnf_item_attributes(), ebnfItem->pos(), ebnfItem->final_pos());
                 paren->add_child(result);
                 paren->add_child(nextItem);
                 result          = paren;
@@ -266,13 +266,13 @@ static ebnf_item* definition_for(const ast_Ebnf_Item* ebnfItem, const ebnf_item_
     
     // If the result is empty, replace with an empty parenthesized item
     if (!result) {
-        result = new ebnf_item(ebnf_item::ebnf_parenthesized, ebnf_item_attributes(), ebnfItem->pos(), ebnfItem->final_pos());
+        result = new (pool) ebnf_item(ebnf_item::ebnf_parenthesized, ebnf_item_attributes(), ebnfItem->pos(), ebnfItem->final_pos());
     }
     
     // Create an alternate if one is supplied
     if (ebnfItem->or_item) {
         // Get the alternative item
-        ebnf_item* alternative = definition_for(ebnfItem->or_item, ebnf_item_attributes());
+        ebnf_item* alternative = definition_for(ebnfItem->or_item, ebnf_item_attributes(), pool);
         
         if (alternative == NULL) {
             // Bug
@@ -281,7 +281,7 @@ static ebnf_item* definition_for(const ast_Ebnf_Item* ebnfItem, const ebnf_item_
         }
         
         // Create the new result item
-        ebnf_item* alternate = new ebnf_item(ebnf_item::ebnf_alternative, attr, ebnfItem->pos(), ebnfItem->final_pos());
+        ebnf_item* alternate = new (pool) ebnf_item(ebnf_item::ebnf_alternative, attr, ebnfItem->pos(), ebnfItem->final_pos());
         
         alternate->add_child(result);
         alternate->add_child(alternative);
@@ -294,7 +294,7 @@ static ebnf_item* definition_for(const ast_Ebnf_Item* ebnfItem, const ebnf_item_
 }
 
 /// \brief Converts a simple EBNF item into an ebnf_item object
-static ebnf_item* definition_for(const ast_Simple_Ebnf_Item* simpleItem) {
+static ebnf_item* definition_for(const ast_Simple_Ebnf_Item* simpleItem, arena* pool) {
     // Work out the semantics for this item
     ebnf_item_attributes attr;
 
@@ -314,7 +314,7 @@ static ebnf_item* definition_for(const ast_Simple_Ebnf_Item* simpleItem) {
         }
         
         // Create the item
-        return new ebnf_item(ebnf_item::ebnf_nonterminal, sourceIdentifier, ntIdentifier, attr, simpleItem->pos(), simpleItem->final_pos());
+        return new (pool) ebnf_item(ebnf_item::ebnf_nonterminal, sourceIdentifier, ntIdentifier, attr, simpleItem->pos(), simpleItem->final_pos());
     }
     
     else if (simpleItem->Terminal) {
@@ -350,12 +350,12 @@ static ebnf_item* definition_for(const ast_Simple_Ebnf_Item* simpleItem) {
         }
         
         // Create the item
-        return new ebnf_item(terminalType, sourceIdentifier, termIdentifier, attr, simpleItem->pos(), simpleItem->final_pos());        
+        return new (pool) ebnf_item(terminalType, sourceIdentifier, termIdentifier, attr, simpleItem->pos(), simpleItem->final_pos());        
     }
     
     else if (simpleItem->Guard) {
         // Get the internal item
-        ebnf_item* internalItem = definition_for(simpleItem->Guard->Ebnf_Item, ebnf_item_attributes());
+        ebnf_item* internalItem = definition_for(simpleItem->Guard->Ebnf_Item, ebnf_item_attributes(), pool);
         
         if (!internalItem) {
             // Bug
@@ -369,7 +369,7 @@ static ebnf_item* definition_for(const ast_Simple_Ebnf_Item* simpleItem) {
         }
         
         // Turn into a guard item
-        ebnf_item* guardItem = new ebnf_item(ebnf_item::ebnf_guard, attr);
+        ebnf_item* guardItem = new (pool) ebnf_item(ebnf_item::ebnf_guard, attr);
         guardItem->add_child(internalItem);
         
         return guardItem;
@@ -377,46 +377,46 @@ static ebnf_item* definition_for(const ast_Simple_Ebnf_Item* simpleItem) {
     
     else if (simpleItem->_star_) {
         // Item of the form X*
-        ebnf_item* starredItem = definition_for(simpleItem->Simple_Ebnf_Item);
+        ebnf_item* starredItem = definition_for(simpleItem->Simple_Ebnf_Item, pool);
         if (starredItem == NULL) {
             // Bug
             return NULL;
         }
         
-        ebnf_item* result = new ebnf_item(ebnf_item::ebnf_repeat_zero, attr, simpleItem->pos(), simpleItem->final_pos());
+        ebnf_item* result = new (pool) ebnf_item(ebnf_item::ebnf_repeat_zero, attr, simpleItem->pos(), simpleItem->final_pos());
         result->add_child(starredItem);
         return result;
     }
     
     else if (simpleItem->_plus_) {
         // Item of the form X+
-        ebnf_item* plusItem = definition_for(simpleItem->Simple_Ebnf_Item);
+        ebnf_item* plusItem = definition_for(simpleItem->Simple_Ebnf_Item, pool);
         if (plusItem == NULL) {
             // Bug
             return NULL;
         }
         
-        ebnf_item* result = new ebnf_item(ebnf_item::ebnf_repeat_one, attr, simpleItem->pos(), simpleItem->final_pos());
+        ebnf_item* result = new (pool) ebnf_item(ebnf_item::ebnf_repeat_one, attr, simpleItem->pos(), simpleItem->final_pos());
         result->add_child(plusItem);
         return result;
     }
     
     else if (simpleItem->_question_) {
         // Item of the form X?
-        ebnf_item* optionalItem = definition_for(simpleItem->Simple_Ebnf_Item);
+        ebnf_item* optionalItem = definition_for(simpleItem->Simple_Ebnf_Item, pool);
         if (optionalItem == NULL) {
             // Bug
             return NULL;
         }
         
-        ebnf_item* result = new ebnf_item(ebnf_item::ebnf_optional, attr, simpleItem->pos(), simpleItem->final_pos());
+        ebnf_item* result = new (pool) ebnf_item(ebnf_item::ebnf_optional, attr, simpleItem->pos(), simpleItem->final_pos());
         result->add_child(optionalItem);
         return result;        
     }
     
     else if (simpleItem->_openparen_) {
         // Item of the form (X)
-        return definition_for(simpleItem->Ebnf_Item, attr);
+        return definition_for(simpleItem->Ebnf_Item, attr, pool);
     }
     
     // Unknown type of item
@@ -424,16 +424,16 @@ static ebnf_item* definition_for(const ast_Simple_Ebnf_Item* simpleItem) {
 }
 
 /// \brief Processes a production definition
-static production_definition* definition_for(const ast_Production* production) {
+static production_definition* definition_for(const ast_Production* production, arena* pool) {
     // Begin a new production
-    production_definition* defn = new production_definition(production->pos(), production->final_pos());
+    production_definition* defn = new (pool) production_definition(production->pos(), production->final_pos());
     
     // Iterate through the items in this production
     for (list_of_Simple_Ebnf_Item::iterator item = production->items->begin();
          item != production->items->end();
          ++item) {
         // Get the next EBNF item
-        ebnf_item* ebnf = definition_for((*item)->Simple_Ebnf_Item);
+        ebnf_item* ebnf = definition_for((*item)->Simple_Ebnf_Item, pool);
         
         if (ebnf == NULL) {
             // Bug
@@ -450,7 +450,7 @@ static production_definition* definition_for(const ast_Production* production) {
 }
 
 /// \brief Processes a nonterminal definition
-static nonterminal_definition* definition_for(const ast_Nonterminal_Definition* nonterminal) {
+static nonterminal_definition* definition_for(const ast_Nonterminal_Definition* nonterminal, arena* pool) {
     // Get the nonterminal identifier (all types have this)
     wstring identifier = nonterminal->nonterminal_2->content<wchar_t>();
     
@@ -468,10 +468,10 @@ static nonterminal_definition* definition_for(const ast_Nonterminal_Definition*
     }
     
     // Start defining a new nonterminal
-    nonterminal_definition* nonterm = new nonterminal_definition(ntType, identifier, nonterminal->pos(), nonterminal->final_pos());
+    nonterminal_definition* nonterm = new (pool) nonterminal_definition(ntType, identifier, nonterminal->pos(), nonterminal->final_pos());
     
     // Add the productions from this nonterminal
-    production_definition* prod = definition_for(nonterminal->Production);
+    production_definition* prod = definition_for(nonterminal->Production, pool);
     
     if (prod == NULL) {
         // Doh, bug
@@ -485,7 +485,7 @@ static nonterminal_definition* definition_for(const ast_Nonterminal_Definition*
          nextProduction != nonterminal->list_of__pipe__Production->end(); 
          ++nextProduction) {
         // Get the next production
-        production_definition* prod = definition_for((*nextProduction)->Production);
+        production_definition* prod = definition_for((*nextProduction)->Production, pool);
         
         if (prod == NULL) {
             // Doh, bug
@@ -502,13 +502,13 @@ static nonterminal_definition* definition_for(const ast_Nonterminal_Definition*
 }
 
 /// \brief Turns a list of nonterminal definitions into a grammar
-static language_unit* definition_for(const list_of_Nonterminal_Definition* items) {
+static language_unit* definition_for(const list_of_Nonterminal_Definition* items, arena* pool) {
     // Start creating the new grammar block
-    grammar_block* gram = new grammar_block();
+    grammar_block* gram = new (pool) grammar_block();
     
     // Iterate through the items
     for (list_of_Nonterminal_Definition::iterator nonterminal = items->begin(); nonterminal != items->end(); ++nonterminal) {
-        nonterminal_definition* defn = definition_for((*nonterminal)->Nonterminal_Definition);
+        nonterminal_definition* defn = definition_for((*nonterminal)->Nonterminal_Definition, pool);
         
         if (defn == NULL) {
             // Doh, bug!
@@ -519,11 +519,11 @@ static language_unit* definition_for(const list_of_Nonterminal_Definition* items
         gram->add_nonterminal(defn);
     }
     
-    return new language_unit(gram);
+    return new (pool) language_unit(gram);
 }
 
 /// \brief Adds a lexeme definition to a lexer block
-static bool add_lexeme_definition(const ast_Lexeme_Definition* defn, lexer_block* lexerBlock) {
+static bool add_lexeme_definition(const ast_Lexeme_Definition* defn, lexer_block* lexerBlock, arena* pool) {
     // Sanity check
     if (!defn || !lexerBlock) {
         return false;
@@ -547,11 +547,11 @@ static bool add_lexeme_definition(const ast_Lexeme_Definition* defn, lexer_block
         }
         
         if (regex) {
-            lexerBlock->add_definition(new lexeme_definition(lexeme_definition::regex, lexemeId->content<wchar_t>(), regex->content<wchar_t>(), alternate, replace, defn->pos(), defn->final_pos(), regex->pos()));
+            lexerBlock->add_definition(new (pool) lexeme_definition(lexeme_definition::regex, lexemeId->content<wchar_t>(), regex->content<wchar_t>(), alternate, replace, defn->pos(), defn->final_pos(), regex->pos()));
         } else if (string) {
-            lexerBlock->add_definition(new lexeme_definition(lexeme_definition::string, lexemeId->content<wchar_t>(), string->content<wchar_t>(), alternate, replace, defn->pos(), defn->final_pos(), string->pos()));
+            lexerBlock->add_definition(new (pool) lexeme_definition(lexeme_definition::string, lexemeId->content<wchar_t>(), string->content<wchar_t>(), alternate, replace, defn->pos(), defn->final_pos(), string->pos()));
         } else if (character) {
-            lexerBlock->add_definition(new lexeme_definition(lexeme_definition::character, lexemeId->content<wchar_t>(), character->content<wchar_t>(), alternate, replace, defn->pos(), defn->final_pos(), character->pos()));
+            lexerBlock->add_definition(new (pool) lexeme_definition(lexeme_definition::character, lexemeId->content<wchar_t>(), character->content<wchar_t>(), alternate, replace, defn->pos(), defn->final_pos(), character->pos()));
         } else {
             // Doh, bug: fail
             delete lexerBlock;
@@ -570,7 +570,7 @@ static bool add_lexeme_definition(const ast_Lexeme_Definition* defn, lexer_block
 }
 
 /// \brief Interprets a keyword symbol definition block
-static language_unit* definition_for(const list_of_Keyword_Definition* items, const list_of_Lexer_Modifier* modifiers1, const list_of_Lexer_Symbols_Modifier* modifiers2, language_unit::unit_type type) {
+static language_unit* definition_for(const list_of_Keyword_Definition* items, const list_of_Lexer_Modifier* modifiers1, const list_of_Lexer_Symbols_Modifier* modifiers2, language_unit::unit_type type, arena* pool) {
     // Work out the modifiers
     bool isWeak             = false;
     bool isCaseInsensitive  = false;
@@ -599,13 +599,13 @@ static language_unit* definition_for(const list_of_Keyword_Definition* items, co
     }
 
     // Start building up the lexer block
-    lexer_block* lexerBlock = new lexer_block(isWeak, isCaseInsensitive, isCaseSensitive, items->pos(), items->final_pos());
+    lexer_block* lexerBlock = new (pool) lexer_block(isWeak, isCaseInsensitive, isCaseSensitive, items->pos(), items->final_pos());
     
     // Iterate through the items
     for (list_of_Keyword_Definition::iterator keyword = items->begin(); keyword != items->end(); ++keyword) {
         if ((*keyword)->Keyword_Definition->lexeme_2) {
             // Add the lexeme definition
-            if (!add_lexeme_definition((*keyword)->Keyword_Definition->lexeme_2, lexerBlock)) {
+            if (!add_lexeme_definition((*keyword)->Keyword_Definition->lexeme_2, lexerBlock, pool)) {
                 // Doh, fail
                 delete lexerBlock;
                 return NULL;
@@ -613,7 +613,7 @@ static language_unit* definition_for(const list_of_Keyword_Definition* items, co
         } else if ((*keyword)->Keyword_Definition->literal) {
             // A literal keyword defined only by its identifier
             const identifier* keywordId = (*keyword)->Keyword_Definition->literal;
-            lexerBlock->add_definition(new lexeme_definition(lexeme_definition::literal, keywordId->content<wchar_t>(), keywordId->content<wchar_t>(), false, false, (*keyword)->pos(), (*keyword)->final_pos(), keywordId->pos()));
+            lexerBlock->add_definition(new (pool) lexeme_definition(lexeme_definition::literal, keywordId->content<wchar_t>(), keywordId->content<wchar_t>(), false, false, (*keyword)->pos(), (*keyword)->final_pos(), keywordId->pos()));
         } else {
             // Unknown keyword type
             delete lexerBlock;
@@ -622,11 +622,11 @@ static language_unit* definition_for(const list_of_Keyword_Definition* items, co
     }
     
     // Create the language unit
-    return new language_unit(type, lexerBlock);
+    return new (pool) language_unit(type, lexerBlock);
 }
 
 /// \brief Interprets a lexer symbol definition block
-static language_unit* definition_for(const list_of_Lexeme_Definition* items, const list_of_Lexer_Modifier* modifiers1, const list_of_Lexer_Symbols_Modifier* modifiers2, const language_unit::unit_type type) {
+static language_unit* definition_for(const list_of_Lexeme_Definition* items, const list_of_Lexer_Modifier* modifiers1, const list_of_Lexer_Symbols_Modifier* modifiers2, const language_unit::unit_type type, const wstring& mode, arena* pool) {
     // Work out the modifiers
     bool isWeak             = false;
     bool isCaseInsensitive  = false;
@@ -655,28 +655,28 @@ static language_unit* definition_for(const list_of_Lexeme_Definition* items, con
     }
 
     // Start building up the lexer block
-    lexer_block* lexerBlock = new lexer_block(isWeak, isCaseInsensitive, isCaseSensitive, items->pos(), items->final_pos());
+    lexer_block* lexerBlock = new (pool) lexer_block(isWeak, isCaseInsensitive, isCaseSensitive, items->pos(), items->final_pos(), mode);
     
     // Iterate through the items
     for (list_of_Lexeme_Definition::iterator lexeme = items->begin(); lexeme != items->end(); ++lexeme) {
         // Add this definition
-        if (!add_lexeme_definition((*lexeme)->Lexeme_Definition, lexerBlock)) {
+        if (!add_lexeme_definition((*lexeme)->Lexeme_Definition, lexerBlock, pool)) {
             // Give up if it fails
             delete lexerBlock;
             return NULL;
         }
     }
     
-    return new language_unit(type, lexerBlock);
+    return new (pool) language_unit(type, lexerBlock);
 }
 
 /// \brief Creates a language unit from a precedence definition
-static language_unit* definition_for(const ast_Precedence_Definition* precedence) {
+static language_unit* definition_for(const ast_Precedence_Definition* precedence, arena* pool) {
     // Create the precedence block
     position start  = precedence->pos();
     position end    = precedence->final_pos();
 
-    precedence_block* precBlock = new precedence_block(start, end);
+    precedence_block* precBlock = new (pool) precedence_block(start, end);
 
     // Iterate through the items in this definition
     for (list_of_Precedence_Item::iterator item = precedence->items->begin(); item != precedence->items->end(); ++item) {
@@ -696,7 +696,7 @@ static language_unit* definition_for(const ast_Precedence_Definition* precedence
         // Get the items inside this one
         if (equalItem->Simple_Ebnf_Item) {
             // left 'x' style of item
-            ebnf_item* singleItem = definition_for(equalItem->Simple_Ebnf_Item);
+            ebnf_item* singleItem = definition_for(equalItem->Simple_Ebnf_Item, pool);
             if (!singleItem) {
                 // Oops; failed to get the item
                 delete precBlock;
@@ -712,7 +712,7 @@ static language_unit* definition_for(const ast_Precedence_Definition* precedence
         if (equalItem->terminals) {
             // left { 'x' 'y' } style of item
             for (list_of_Simple_Ebnf_Item::iterator ebnfItem = equalItem->terminals->begin(); ebnfItem != equalItem->terminals->end(); ++ebnfItem) {
-                ebnf_item* nextItem = definition_for((*ebnfItem)->Simple_Ebnf_Item);
+                ebnf_item* nextItem = definition_for((*ebnfItem)->Simple_Ebnf_Item, pool);
                 if (!nextItem) {
                     // Oops; failed to get the item
                     delete precBlock;
@@ -731,35 +731,41 @@ static language_unit* definition_for(const ast_Precedence_Definition* precedence
     }
 
     // Create the final result
-    return new language_unit(precBlock);
+    return new (pool) language_unit(precBlock);
 }
 
 /// \brief Interprets a language unit
-static language_unit* definition_for(const ast_Language_Definition* defn) {
+static language_unit* definition_for(const ast_Language_Definition* defn, arena* pool) {
     // Action depends on the typeof node in this AST node
     
     // Most of the lexer type nodes are very similar, except for the node type
     if (defn->Lexer_Symbols_Definition) {
-        return definition_for(defn->Lexer_Symbols_Definition->definitions, NULL, defn->Lexer_Symbols_Definition->modifiers, language_unit::unit_lexer_symbols);
+        return definition_for(defn->Lexer_Symbols_Definition->definitions, NULL, defn->Lexer_Symbols_Definition->modifiers, language_unit::unit_lexer_symbols, wstring(), pool);
     } else if (defn->Lexer_Definition) {
-        return definition_for(defn->Lexer_Definition->definitions, defn->Lexer_Definition->modifiers, NULL, language_unit::unit_lexer_definition);
+        // Lexer blocks can be given the name of the mode they belong to
+        wstring mode;
+        if (defn->Lexer_Definition->mode->Lexer_Mode) {
+            mode = defn->Lexer_Definition->mode->Lexer_Mode->name->content<wchar_t>();
+        }
+        
+        return definition_for(defn->Lexer_Definition->definitions, defn->Lexer_Definition->modifiers, NULL, language_unit::unit_lexer_definition, mode, pool);
     } else if (defn->Ignore_Definition) {
-        return definition_for(defn->Ignore_Definition->definitions, NULL, NULL, language_unit::unit_ignore_definition);
+        return definition_for(defn->Ignore_Definition->definitions, NULL, NULL, language_unit::unit_ignore_definition, pool);
     } else if (defn->Keywords_Definition) {
-        return definition_for(defn->Keywords_Definition->definitions, defn->Keywords_Definition->modifiers, NULL, language_unit::unit_keywords_definition);
+        return definition_for(defn->Keywords_Definition->definitions, defn->Keywords_Definition->modifiers, NULL, language_unit::unit_keywords_definition, pool);
     } else if (defn->Grammar_Definition) {
-        return definition_for(defn->Grammar_Definition->nonterminals);
+        return definition_for(defn->Grammar_Definition->nonterminals, pool);
     } else if (defn->Precedence_Definition) {
-        return definition_for(defn->Precedence_Definition);
+        return definition_for(defn->Precedence_Definition, pool);
     }
     
     return NULL;
 }
 
 /// \brief Interprets a language block
-static language_block* definition_for(const ast_Language_Block* language) {
+static language_block* definition_for(const ast_Language_Block* language, arena* pool) {
     // Create the language block
-    language_block* result = new language_block(language->name->content<wchar_t>(), language->pos(), language->final_pos());
+    language_block* result = new (pool) language_block(language->name->content<wchar_t>(), language->pos(), language->final_pos());
     
     // Deal with the inherits block, if it exists
     if (language->optional_Language_Inherits->Language_Inherits) {
@@ -773,7 +779,7 @@ static language_block* definition_for(const ast_Language_Block* language) {
          langDefinition != language->list_of_Language_Definition->end();
          ++langDefinition) {
         // Get the next definition
-        language_unit* nextUnit = definition_for((*langDefinition)->Language_Definition);
+        language_unit* nextUnit = definition_for((*langDefinition)->Language_Definition, pool);
         
         // Self-destruct if we get a failure here
         if (!nextUnit) {
@@ -791,50 +797,50 @@ static language_block* definition_for(const ast_Language_Block* language) {
 }
 
 /// \brief Interprets a top-level block
-static toplevel_block* definition_for(const ast_TopLevel_Block* toplevel) {
+static toplevel_block* definition_for(const ast_TopLevel_Block* toplevel, arena* pool) {
     // Action depends on the type of block
     
     // Language block
     if (toplevel->Language_Block) {
         // Get the definition for this language block
-        language_block* language = definition_for(toplevel->Language_Block);
+        language_block* language = definition_for(toplevel->Language_Block, pool);
         if (!language) {
             // Doh
             return NULL;
         }
         
         // Turn into a toplevel block
-        return new toplevel_block(language);
+        return new (pool) toplevel_block(language);
     }
     
     // Import block
     else if (toplevel->Import_Block) {
         // Fairly simple to convert
-        return new toplevel_block(new import_block(process::dequote_string(toplevel->Import_Block->filename->content<wchar_t>()), toplevel->pos(), toplevel->final_pos()));
+        return new (pool) toplevel_block(new (pool) import_block(process::dequote_string(toplevel->Import_Block->filename->content<wchar_t>()), toplevel->pos(), toplevel->final_pos()));
     }
 
     // Test block
     else if (toplevel->Test_Block) {
-        test_block* test = definition_for(toplevel->Test_Block);
+        test_block* test = definition_for(toplevel->Test_Block, pool);
         if (!test) {
             // Doh
             return NULL;
         }
 
         // Turn into a toplevel block
-        return new toplevel_block(test);
+        return new (pool) toplevel_block(test);
     }
     
     // Parser block
     else if (toplevel->Parser_Block) {
-        parser_block* parser = definition_for(toplevel->Parser_Block);
+        parser_block* parser = definition_for(toplevel->Parser_Block, pool);
         if (!parser) {
             // Doh
             return NULL;
         }
 
         // Turn into a toplevel block
-        return new toplevel_block(parser);
+        return new (pool) toplevel_block(parser);
     }
     
     // Failed to parse: doh, bug
@@ -843,13 +849,14 @@ static toplevel_block* definition_for(const ast_TopLevel_Block* toplevel) {
 
 /// \brief Turns a parser language object into a definition file object
 static definition_file* definition_for(const Parser_Language* language) {
-    // Create a new definition file
-    definition_file* file = new definition_file();
+    // Create a new definition file, with an arena to allocate its blocks from
+    definition_file* file = new definition_file(new arena());
+    arena* pool = file->pool();
     
     // Iterate through the top-level definitions
     for (list_of_TopLevel_Block::iterator topLevel = language->list_of_TopLevel_Block->begin(); topLevel != language->list_of_TopLevel_Block->end(); ++topLevel) {
         // Get the definition for this toplevel block
-        toplevel_block* newBlock = definition_for((*topLevel)->TopLevel_Block);
+        toplevel_block* newBlock = definition_for((*topLevel)->TopLevel_Block, pool);
         
         // Blow up if the block turns out to be NULL
         if (!newBlock) {
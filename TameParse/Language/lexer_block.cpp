@@ -30,11 +30,12 @@
 using namespace language;
 
 /// \brief Creates a new lexer block
-lexer_block::lexer_block(bool weak, bool caseInsensitive, bool caseSensitive, position start, position end)
+lexer_block::lexer_block(bool weak, bool caseInsensitive, bool caseSensitive, position start, position end, const std::wstring& mode)
 : block(start, end)
 , m_Weak(weak)
 , m_CaseSensitive(caseSensitive)
-, m_CaseInsensitive(caseInsensitive) {
+, m_CaseInsensitive(caseInsensitive)
+, m_Mode(mode) {
 }
 
 /// \brief Creates a lexer block by copying an old one
@@ -67,6 +68,8 @@ lexer_block& lexer_block::operator=(const lexer_block& copyFrom) {
         m_Lexemes.push_back(new lexeme_definition(**toCopy));
     }
     
+    m_Mode = copyFrom.m_Mode;
+    
     set_start_pos(copyFrom.start_pos());
     set_end_pos(copyFrom.end_pos());
     
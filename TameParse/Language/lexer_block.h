@@ -29,6 +29,7 @@
 #define _LANGUAGE_LEXER_BLOCK_H
 
 #include <vector>
+#include <string>
 
 #include "TameParse/Language/block.h"
 #include "TameParse/Language/lexeme_definition.h"
@@ -69,9 +70,12 @@ namespace language {
         /// parent item.
         bool m_CaseSensitive;
         
+        /// \brief The lexer mode that the symbols in this block are matched in, or the empty string for the default mode
+        std::wstring m_Mode;
+        
     public:
         /// \brief Creates a new lexer block
-        lexer_block(bool weak, bool caseInsensitive, bool caseSensitive, position start = position(), position end = position());
+        lexer_block(bool weak, bool caseInsensitive, bool caseSensitive, position start = position(), position end = position(), const std::wstring& mode = std::wstring());
         
         /// \brief Creates a lexer block by copying an old one
         lexer_block(const lexer_block& copyFrom);
@@ -104,6 +108,12 @@ namespace language {
         /// controls whether or not we should inherit or override the case sensivity 
         /// of the parent item.
         inline bool is_case_sensitive() const { return m_CaseSensitive; }
+        
+        /// \brief The lexer mode that the symbols in this block are matched in, or the empty string for the default mode
+        ///
+        /// Each named mode gets its own initial state in the lexer, and the symbols in this block are only matched
+        /// while the lexer is in that mode (see dfa::lexeme_stream::set_mode)
+        inline const std::wstring& mode() const { return m_Mode; }
     };
 }
 
@@ -26,3 +26,6 @@
 //
 
 #include "TameParse/Lr/ast_parser.h"
+
+template class lr::parser<util::astnode_container, lr::ast_parser_actions>;
+template class lr::parser<int, lr::flat_ast_parser_actions>;
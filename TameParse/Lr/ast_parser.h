@@ -29,6 +29,9 @@
 #define _LR_AST_PARSER_H
 
 #include "TameParse/Util/astnode.h"
+#include "TameParse/Util/astnode_table.h"
+#include "TameParse/Util/flat_ast.h"
+#include "TameParse/Util/arena.h"
 #include "TameParse/Dfa/lexer.h"
 #include "TameParse/Lr/parser.h"
 
@@ -57,22 +60,105 @@ namespace lr {
         /// \brief The stream of lexemes that this actions object will read from
         lexeme_stream* m_Stream;
         
+        /// \brief NULL, or the tokens that this object reads instead of a stream (not owned by this object)
+        const dfa::token_array* m_Tokens;
+        
+        /// \brief The index of the next token to read from m_Tokens
+        size_t m_NextToken;
+        
+        /// \brief The arena that AST nodes are allocated from, or NULL if they are allocated individually
+        util::arena* m_Arena;
+        
+        /// \brief NULL, or the table used to share identical subtrees
+        util::astnode_table* m_SharedNodes;
+        
+        /// \brief Creates the container for a new node, adding it to the shared node table if there is one
+        inline astnode_container add_node(astnode* newNode) {
+            // Nodes in the arena are freed along with it, rather than when they are released
+            astnode_container result(newNode, m_Arena == NULL);
+            if (m_SharedNodes) m_SharedNodes->add(result);
+            return result;
+        }
+        
         ast_parser_actions(const ast_parser_actions& copyFrom);
         ast_parser_actions& operator=(ast_parser_actions& copyFrom);
         
     public:
         /// \brief Creates a new actions object that will read from the specified stream.
         ///
-        /// The stream will be deleted when this object is deleted
-        ast_parser_actions(dfa::lexeme_stream* stream)
-        : m_Stream(stream) {
+        /// The stream will be deleted when this object is deleted.
+        ///
+        /// If useArena is true, then the AST nodes are allocated from an arena owned by this object instead of
+        /// individually. This is much faster when building large trees, but all of the nodes are destroyed along
+        /// with this object, which happens when the parser session ends (that is, when the last parser state that
+        /// uses it is deleted). The AST must not be used after that point, even if a container for it is still
+        /// held elsewhere.
+        ///
+        /// If shareNodes is true, then identical subtrees (with the same rules and the same lexeme text) are built
+        /// as a single node that is shared between all of the places where it occurs. This uses much less memory for
+        /// repetitive input, and identical subtrees can be compared by pointer, but shared nodes have the position of
+        /// the first place they occurred. See util::astnode_table.
+        explicit ast_parser_actions(dfa::lexeme_stream* stream, bool useArena = false, bool shareNodes = false)
+        : m_Stream(stream)
+        , m_Tokens(NULL)
+        , m_NextToken(0)
+        , m_Arena(useArena ? new util::arena() : NULL)
+        , m_SharedNodes(shareNodes ? new util::astnode_table() : NULL) {
+        }
+        
+        /// \brief Creates a new actions object that will read from an array of tokens instead of a stream
+        ///
+        /// The tokens must remain valid for as long as this object and the AST do. This lets the same input be parsed
+        /// several times (with different start symbols, say, or on different threads) without lexing it again.
+        explicit ast_parser_actions(const dfa::token_array& tokens, bool useArena = false, bool shareNodes = false)
+        : m_Stream(NULL)
+        , m_Tokens(&tokens)
+        , m_NextToken(0)
+        , m_Arena(useArena ? new util::arena() : NULL)
+        , m_SharedNodes(shareNodes ? new util::astnode_table() : NULL) {
         }
         
         /// \brief Destroys an existing actions object
-        ~ast_parser_actions() { delete m_Stream; }
+        ~ast_parser_actions() { 
+            delete m_Stream;
+            delete m_SharedNodes;
+            delete m_Arena;
+        }
+        
+        /// \brief The arena that AST nodes are allocated from, or NULL if they are allocated individually
+        inline const util::arena* get_arena() const { return m_Arena; }
+        
+        /// \brief The table used to share identical subtrees, or NULL if they are not being shared
+        inline const util::astnode_table* get_shared_nodes() const { return m_SharedNodes; }
+        
+        /// \brief Starts reading from a different stream, deleting the old one (used when resetting a parser to parse new input)
+        ///
+        /// Any nodes in the arena are destroyed, so the AST from the previous parse must not be used after this call.
+        inline void reset(dfa::lexeme_stream* stream) {
+            if (stream != m_Stream) delete m_Stream;
+            m_Stream    = stream;
+            m_Tokens    = NULL;
+            
+            if (m_SharedNodes) m_SharedNodes->clear();
+            if (m_Arena) m_Arena->clear();
+        }
         
-        /// \brief Reads the next symbol from the stream
+        /// \brief Starts reading from an array of tokens, deleting the old stream if there is one
+        ///
+        /// As with the other form of reset(), the AST from the previous parse must not be used after this call.
+        inline void reset(const dfa::token_array& tokens) {
+            reset((dfa::lexeme_stream*) NULL);
+            m_Tokens    = &tokens;
+            m_NextToken = 0;
+        }
+        
+        /// \brief Reads the next symbol from the stream or the token array
         inline dfa::lexeme* read() {
+            if (m_Tokens) {
+                if (m_NextToken >= m_Tokens->size()) return NULL;
+                return m_Tokens->create_lexeme(m_NextToken++);
+            }
+            
             dfa::lexeme* result = NULL;
             (*m_Stream) >> result;
             return result;
@@ -80,28 +166,149 @@ namespace lr {
         
         /// \brief Returns the item resulting from a shift action
         inline astnode_container shift(const dfa::lexeme_container& lexeme) {
-            // Create a new node from the lexeme
-            astnode* newNode = new astnode(lexeme);
+            // Use the existing node if there's one with the same text
+            if (m_SharedNodes) {
+                const astnode_container* existing = m_SharedNodes->find_terminal(*lexeme);
+                if (existing) return *existing;
+            }
             
-            // Create the container for this node
-            return astnode_container(newNode, true);
+            // Create a new node from the lexeme
+            if (m_Arena) {
+                return add_node(m_Arena->track(new (*m_Arena) astnode(lexeme)));
+            } else {
+                return add_node(new astnode(lexeme));
+            }
         }
         
         /// \brief Returns the item resulting from a reduce action
         inline astnode_container reduce(int nonterminal, int rule, const reduce_list& reduce, const dfa::position& lookaheadPosition) {
-            // Create a new nonterminal node
-            astnode* newNode = new astnode(nonterminal, rule);
-            
-            // Add the contents of the reduce list to this node
-            newNode->add_children(reduce.rbegin(), reduce.rend());
+            // Use the existing node if there's one with the same children
+            if (m_SharedNodes) {
+                const astnode_container* existing = m_SharedNodes->find_nonterminal(nonterminal, rule, reduce.rbegin(), reduce.rend());
+                if (existing) return *existing;
+            }
             
-            // Create the container for this node
-            return astnode_container(newNode, true);
+            // Create a new nonterminal node containing the items in the reduce list (allocating its children in one go)
+            if (m_Arena) {
+                return add_node(m_Arena->track(new (*m_Arena) astnode(nonterminal, rule, reduce.rbegin(), reduce.rend())));
+            } else {
+                return add_node(new astnode(nonterminal, rule, reduce.rbegin(), reduce.rend()));
+            }
         }
     };
     
     /// \brief A parser that produces an AST from the input source file
     typedef ast_parser_actions::ast_parser ast_parser;
+    
+    ///
+    /// \brief Parser actions that append the AST to a util::flat_ast instead of creating a node object for each symbol
+    ///
+    /// The item for each symbol is the index of its node in the tree. Once the parse has been accepted, the tree
+    /// should be finished using the parser's item as the root.
+    ///
+    class flat_ast_parser_actions {
+    public:
+        /// \brief Type of a lexeme stream
+        typedef dfa::lexeme_stream lexeme_stream;
+        
+        /// \brief Type of a parser that uses these actions
+        typedef parser<int, flat_ast_parser_actions> flat_ast_parser;
+        
+        /// \brief Type of a list of reduced symbols
+        typedef flat_ast_parser::reduce_list reduce_list;
+        
+    private:
+        /// \brief The stream of lexemes that this actions object will read from
+        lexeme_stream* m_Stream;
+        
+        /// \brief NULL, or the tokens that this object reads instead of a stream (not owned by this object)
+        const dfa::token_array* m_Tokens;
+        
+        /// \brief The index of the next token to read from m_Tokens
+        size_t m_NextToken;
+        
+        /// \brief The tree that nodes are added to (not owned by this object)
+        util::flat_ast* m_Tree;
+        
+        flat_ast_parser_actions(const flat_ast_parser_actions& copyFrom);
+        flat_ast_parser_actions& operator=(const flat_ast_parser_actions& copyFrom);
+        
+    public:
+        /// \brief Creates a new actions object that will read from the specified stream and add nodes to the specified tree
+        ///
+        /// The stream will be deleted when this object is deleted. The tree must remain valid for as long as the
+        /// parser session does.
+        flat_ast_parser_actions(dfa::lexeme_stream* stream, util::flat_ast* tree)
+        : m_Stream(stream)
+        , m_Tokens(NULL)
+        , m_NextToken(0)
+        , m_Tree(tree) {
+        }
+        
+        /// \brief Creates a new actions object that will read from an array of tokens and add nodes to the specified tree
+        ///
+        /// The tokens and the tree must remain valid for as long as the parser session does.
+        flat_ast_parser_actions(const dfa::token_array& tokens, util::flat_ast* tree)
+        : m_Stream(NULL)
+        , m_Tokens(&tokens)
+        , m_NextToken(0)
+        , m_Tree(tree) {
+        }
+        
+        /// \brief Destroys an existing actions object
+        ~flat_ast_parser_actions() {
+            delete m_Stream;
+        }
+        
+        /// \brief Starts reading from a different stream, deleting the old one (used when resetting a parser to parse new input)
+        ///
+        /// The tree is not changed: clear it or supply a different one first if the nodes from the previous parse are
+        /// not wanted.
+        inline void reset(dfa::lexeme_stream* stream, util::flat_ast* tree) {
+            if (stream != m_Stream) delete m_Stream;
+            m_Stream    = stream;
+            m_Tokens    = NULL;
+            m_Tree      = tree;
+        }
+        
+        /// \brief Starts reading from an array of tokens, deleting the old stream if there is one
+        inline void reset(const dfa::token_array& tokens, util::flat_ast* tree) {
+            reset(NULL, tree);
+            m_Tokens    = &tokens;
+            m_NextToken = 0;
+        }
+        
+        /// \brief Reads the next symbol from the stream or the token array
+        inline dfa::lexeme* read() {
+            if (m_Tokens) {
+                if (m_NextToken >= m_Tokens->size()) return NULL;
+                return m_Tokens->create_lexeme(m_NextToken++);
+            }
+            
+            dfa::lexeme* result = NULL;
+            (*m_Stream) >> result;
+            return result;
+        }
+        
+        /// \brief Adds a terminal node to the tree
+        inline int shift(const dfa::lexeme_container& lexeme) {
+            return m_Tree->add_terminal(lexeme->matched(), lexeme->pos().offset(), (util::flat_ast::offset_type) lexeme->length());
+        }
+        
+        /// \brief Adds a nonterminal node to the tree
+        inline int reduce(int nonterminal, int rule, const reduce_list& reduce, const dfa::position& lookaheadPosition) {
+            return m_Tree->add_nonterminal(nonterminal, rule, reduce, lookaheadPosition.offset());
+        }
+    };
+    
+    /// \brief A parser that produces a flat AST from the input source file
+    typedef flat_ast_parser_actions::flat_ast_parser flat_ast_parser;
+
+#if __cplusplus >= 201103L
+    // These parsers are instantiated once in ast_parser.cpp instead of in every file that uses them
+    extern template class parser<util::astnode_container, ast_parser_actions>;
+    extern template class parser<int, flat_ast_parser_actions>;
+#endif
 }
 
 #endif
@@ -0,0 +1,365 @@
+//
+//  compact_parser_tables.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _LR_COMPACT_PARSER_TABLES_H
+#define _LR_COMPACT_PARSER_TABLES_H
+
+#include <algorithm>
+#include <limits>
+
+#include "TameParse/Util/comb_vector.h"
+#include "TameParse/Util/constexpr.h"
+#include "TameParse/Lr/lr_action.h"
+#include "TameParse/Lr/parser_tables.h"
+
+namespace lr {
+    ///
+    /// \brief Read-only parser tables that store their actions and rules in narrower integers than parser_tables
+    ///
+    /// Generated parsers use these when all of the symbols, states and rules in a grammar will fit: with 16-bit types
+    /// an action takes 4 bytes instead of 8, and a reduce rule 6 bytes instead of 12. The parser reads the tables in
+    /// the same way as parser_tables (see the tables_type parameter of the parser class), but they can only be created
+    /// from hard-coded arrays.
+    ///
+    /// The action type is stored in the low 4 bits of a state_type, leaving the rest for the state or rule ID.
+    ///
+    template<typename symbol_type, typename state_type> class compact_parser_tables {
+    public:
+        /// \brief The number of bits available for the state in an action
+        static const int c_StateBits = (int) sizeof(state_type) * 8 - 4;
+        
+        ///
+        /// \brief Description of a parser action
+        ///
+        struct action {
+            /// \brief The type of action (same values as specified by lr_action)
+            state_type type : 4;
+            
+            /// \brief The state to enter when this symbol is matched (or the rule to reduce for reduce actions)
+            state_type nextState : c_StateBits;
+            
+            /// \brief The symbol ID (the terminal for shift or reduce actions, or the item ID from the grammar)
+            symbol_type symbolId;
+        };
+        
+        ///
+        /// \brief Description of a reduce rule
+        ///
+        struct reduce_rule {
+            /// \brief The identifier for the nonterminal that this rule reduces to (within the grammar)
+            symbol_type identifier;
+            
+            /// \brief The identifier for the rule that was reduced (within the grammar)
+            symbol_type ruleId;
+            
+            /// \brief Number of items in this rule
+            symbol_type length;
+        };
+        
+        /// \brief Iterator for actions
+        typedef const action* action_iterator;
+        
+        /// \brief Structure that counts the number of terminal and nonterminal actions a state
+        struct action_count {
+            symbol_type numTerminals;
+            symbol_type numNonterminals;
+        };
+        
+        /// \brief Structure that maps a weak symbol to its strong equivalent
+        typedef parser_tables::symbol_equivalent symbol_equivalent;
+        
+    private:
+        /// \brief The number of states in the state machine
+        int m_NumStates;
+        
+        /// \brief The nonterminal identifier for the end of input symbol
+        int m_EndOfInput;
+        
+        /// \brief The nonterminal identifier for the end of guard symbol
+        int m_EndOfGuard;
+        
+        /// \brief The actions for each terminal in each state (sorted by symbol ID)
+        const action* const* m_TerminalActions;
+        
+        /// \brief The actions for each nonterminal in each state (sorted by symbol ID)
+        const action* const* m_NonterminalActions;
+        
+        /// \brief The number of terminal and nonterminal actions in each state
+        const action_count* m_Counts;
+        
+        /// \brief Sorted list of states that have an end of guard action
+        const int* m_EndGuardStates;
+        
+        /// \brief Number of states with an end of guard action
+        int m_NumEndOfGuards;
+        
+        /// \brief Number of reduce rules
+        int m_NumRules;
+        
+        /// \brief The reduce rules
+        const reduce_rule* m_Rules;
+        
+        /// \brief Number of entries in the weak to strong table
+        int m_NumWeakToStrong;
+        
+        /// \brief Ordered list of weak symbols and their strong equivalent
+        const symbol_equivalent* m_WeakToStrong;
+        
+        /// \brief Number of entries in the strong symbol map
+        int m_NumStrongForWeak;
+        
+        /// \brief The strong equivalent of each terminal symbol up to the largest weak symbol, or NULL to search m_WeakToStrong
+        const int* m_StrongForWeak;
+        
+        /// \brief The default reduction for each state, or NULL if there are no default reductions
+        const action* m_DefaultReductions;
+        
+        /// \brief The number of entries in m_DefaultGotos
+        int m_NumDefaultGotos;
+        
+        /// \brief The state to go to for each nonterminal in states that have no goto action for it (-1 for none), or NULL
+        const int* m_DefaultGotos;
+        
+        /// \brief Row-displacement index for the terminal actions, or NULL
+        const util::comb_vector* m_TerminalIndex;
+        
+        /// \brief Row-displacement index for the nonterminal actions, or NULL
+        const util::comb_vector* m_NonterminalIndex;
+        
+    public:
+        /// \brief Creates parser tables that refer to a set of hard-coded arrays
+        ///
+        /// The arguments are the same as the hard-coded constructor of parser_tables, with copyIndexes left out. None of
+        /// them are copied, so they must last as long as this object.
+        TAMEPARSE_CONSTEXPR compact_parser_tables(int numStates, int endOfInputSymbol, int endOfGuardSymbol, const action* const* terminalActions, const action* const* nonterminalActions, const action_count* actionCounts, const int* endGuardStates, int numEndGuards, int numRules, const reduce_rule* reduceRules, int numWeakToStrong, const symbol_equivalent* weakToStrong, const action* defaultReductions = NULL, const util::comb_vector* terminalIndex = NULL, const util::comb_vector* nonterminalIndex = NULL, int numStrongForWeak = 0, const int* strongForWeak = NULL, int numDefaultGotos = 0, const int* defaultGotos = NULL)
+        : m_NumStates(numStates)
+        , m_EndOfInput(endOfInputSymbol)
+        , m_EndOfGuard(endOfGuardSymbol)
+        , m_TerminalActions(terminalActions)
+        , m_NonterminalActions(nonterminalActions)
+        , m_Counts(actionCounts)
+        , m_EndGuardStates(endGuardStates)
+        , m_NumEndOfGuards(numEndGuards)
+        , m_NumRules(numRules)
+        , m_Rules(reduceRules)
+        , m_NumWeakToStrong(numWeakToStrong)
+        , m_WeakToStrong(weakToStrong)
+        , m_NumStrongForWeak(numStrongForWeak)
+        , m_StrongForWeak(strongForWeak)
+        , m_DefaultReductions(defaultReductions)
+        , m_NumDefaultGotos(numDefaultGotos)
+        , m_DefaultGotos(defaultGotos)
+        , m_TerminalIndex(terminalIndex)
+        , m_NonterminalIndex(nonterminalIndex) {
+        }
+        
+    private:
+        /// \brief True if the specified value can be stored in a symbol_type
+        inline static bool fits_symbol(int value) {
+            return value >= (int) std::numeric_limits<symbol_type>::min() && value <= (int) std::numeric_limits<symbol_type>::max();
+        }
+        
+        /// \brief True if the specified action from a parser_tables object can be stored in an action
+        inline static bool fits_action(const parser_tables::action& act) {
+            return act.type < 16 && act.nextState < (1u << c_StateBits) && fits_symbol(act.symbolId);
+        }
+        
+        /// \brief Compares the symbol of an action to a symbol ID
+        inline static bool compare_symbols(const action& a, int symbol) {
+            return a.symbolId < symbol;
+        }
+        
+        /// \brief Finds an action
+        inline action_iterator find_action(int symbol, action_iterator actionList, int count) const {
+            return std::lower_bound(actionList, actionList + count, symbol, compare_symbols);
+        }
+        
+        /// \brief Finds an action using an index
+        inline action_iterator find_indexed_action(int stateId, int symbol, const util::comb_vector& index, action_iterator actionList, int count) const {
+            int offset = index.lookup(stateId, symbol);
+            if (offset < 0) return actionList + count;
+            
+            return actionList + offset;
+        }
+        
+    public:
+        /// \brief True if every action, rule and count in the specified tables can be stored in compact tables of this type
+        static bool can_represent(const parser_tables& tables) {
+            for (int stateId = 0; stateId < tables.count_states(); ++stateId) {
+                const parser_tables::action_count& count = tables.action_counts()[stateId];
+                if (!fits_symbol(count.numTerminals) || !fits_symbol(count.numNonterminals)) return false;
+                
+                for (int actionId = 0; actionId < count.numTerminals; ++actionId) {
+                    if (!fits_action(tables.terminal_actions()[stateId][actionId])) return false;
+                }
+                for (int actionId = 0; actionId < count.numNonterminals; ++actionId) {
+                    if (!fits_action(tables.nonterminal_actions()[stateId][actionId])) return false;
+                }
+                
+                if (tables.default_reductions() && !fits_action(tables.default_reductions()[stateId])) return false;
+            }
+            
+            for (int ruleId = 0; ruleId < tables.count_reduce_rules(); ++ruleId) {
+                const parser_tables::reduce_rule& rule = tables.rule(ruleId);
+                if (!fits_symbol(rule.identifier) || !fits_symbol(rule.ruleId) || !fits_symbol(rule.length)) return false;
+            }
+            
+            return true;
+        }
+        
+    public:
+        /// \brief Returns the reduce rule with the specified ID
+        inline const reduce_rule& rule(int ruleId) const { return m_Rules[ruleId]; }
+        
+        /// \brief An iterator pointing to the last action referring to a terminal symbol in the specified state
+        inline action_iterator last_terminal_action(int stateId) const { 
+            return m_TerminalActions[stateId] + m_Counts[stateId].numTerminals;
+        }
+        
+        /// \brief An iterator pointing to the last action referring to a non-terminal symbol in the specified state
+        inline action_iterator last_nonterminal_action(int stateId) const { 
+            return m_NonterminalActions[stateId] + m_Counts[stateId].numNonterminals;
+        }
+        
+        /// \brief Finds the first action that refers to a terminal with an ID equal or greater to that supplied 
+        /// to this function (see parser_tables::find_terminal)
+        inline action_iterator find_terminal(int stateId, int terminal) const {
+            if (m_TerminalIndex) {
+                return find_indexed_action(stateId, terminal, *m_TerminalIndex, m_TerminalActions[stateId], m_Counts[stateId].numTerminals);
+            }
+            return find_action(terminal, m_TerminalActions[stateId], m_Counts[stateId].numTerminals);
+        }
+        
+        /// \brief Finds the first action that refers to a nonterminal with an ID equal or greater to that supplied
+        /// to this function (see parser_tables::find_nonterminal)
+        inline action_iterator find_nonterminal(int stateId, int nonterminal) const {
+            if (m_NonterminalIndex) {
+                return find_indexed_action(stateId, nonterminal, *m_NonterminalIndex, m_NonterminalActions[stateId], m_Counts[stateId].numNonterminals);
+            }
+            return find_action(nonterminal, m_NonterminalActions[stateId], m_Counts[stateId].numNonterminals);
+        }
+        
+        /// \brief The state that the parser goes to for a nonterminal when the state has no goto action of its own, or -1
+        inline int default_goto(int nonterminal) const {
+            if (nonterminal < 0 || nonterminal >= m_NumDefaultGotos) return -1;
+            return m_DefaultGotos[nonterminal];
+        }
+        
+        /// \brief The state to go to after reducing a rule for the specified nonterminal in the specified state, or -1
+        /// (see parser_tables::goto_state)
+        inline int goto_state(int stateId, int nonterminal) const {
+            action_iterator last = last_nonterminal_action(stateId);
+            
+            for (action_iterator gotoAct = find_nonterminal(stateId, nonterminal); gotoAct != last && gotoAct->symbolId == nonterminal; ++gotoAct) {
+                if (gotoAct->type == lr_action::act_goto) return gotoAct->nextState;
+            }
+            
+            return default_goto(nonterminal);
+        }
+        
+        /// \brief True if the specified state always reduces the same rule, whatever the lookahead
+        inline bool has_default_reduction(int stateId) const {
+            return m_DefaultReductions && m_DefaultReductions[stateId].type == lr_action::act_reduce;
+        }
+        
+        /// \brief The default reduce action for the specified state (only valid if has_default_reduction returns true)
+        inline action_iterator default_reduction(int stateId) const {
+            return m_DefaultReductions + stateId;
+        }
+        
+        /// \brief Returns the nonterminal identifier representing the end of input symbol
+        inline int end_of_input() const { return m_EndOfInput; }
+        
+        /// \brief Returns the nonterminal identifier representing the end of guard symbol
+        inline int end_of_guard() const { return m_EndOfGuard; }
+        
+        /// \brief Returns true if the specified state has an end of guard symbol
+        inline bool has_end_of_guard(int stateId) const {
+            return std::binary_search(m_EndGuardStates, m_EndGuardStates + m_NumEndOfGuards, stateId);
+        }
+        
+        /// \brief Compact tables are only ever hard-coded, so the parser always evaluates their guards itself
+        inline const guard_dfa* compiled_guards() const { return NULL; }
+        
+        /// \brief Compact tables don't record the terminals that are valid in each state, so the lexer is never restricted
+        inline int count_valid_terminals() const { return 0; }
+        
+        /// \brief Compact tables don't record the terminals that are valid in each state, so the lexer is never restricted
+        inline const unsigned int* valid_terminals(int stateId) const { return NULL; }
+        
+        /// \brief Finds the strong symbol that is equivalent to a given weak terminal symbol
+        inline int strong_for_weak(int weakTerminal) const {
+            if (m_StrongForWeak) {
+                if (weakTerminal < 0 || weakTerminal >= m_NumStrongForWeak) return weakTerminal;
+                return m_StrongForWeak[weakTerminal];
+            }
+            
+            if (m_NumWeakToStrong == 0) return weakTerminal;
+            
+            const symbol_equivalent     search  = { weakTerminal, 0 };
+            const symbol_equivalent*    found   = std::lower_bound(m_WeakToStrong, m_WeakToStrong + m_NumWeakToStrong, search);
+            if (found != m_WeakToStrong + m_NumWeakToStrong && found->m_OriginalSymbol == weakTerminal) {
+                return found->m_MappedTo;
+            }
+            
+            return weakTerminal;
+        }
+        
+        /// \brief Returns the number of states in these tables
+        inline int count_states() const { 
+            return m_NumStates;
+        }
+        
+        /// \brief The terminal actions table (one list per state)
+        inline const action* const* terminal_actions() const { return m_TerminalActions; }
+        
+        /// \brief The non-terminal actions table (one list per state)
+        inline const action* const* nonterminal_actions() const { return m_NonterminalActions; }
+        
+        /// \brief The default reduction table, or NULL if there are no default reductions
+        inline const action* default_reductions() const { return m_DefaultReductions; }
+        
+        /// \brief The default goto for each nonterminal (count_default_gotos entries, -1 for no default), or NULL
+        inline const int* default_gotos() const { return m_DefaultGotos; }
+        
+        /// \brief The number of entries in the default_gotos table
+        inline int count_default_gotos() const { return m_NumDefaultGotos; }
+        
+        /// \brief The action count table
+        inline const action_count* action_counts() const { return m_Counts; }
+        
+        /// \brief The number of reduce rules
+        inline int count_reduce_rules() const { return m_NumRules; }
+        
+        /// \brief The reduce rules for these tables (count_reduce_rules items)
+        inline const reduce_rule* reduce_rules() const { return m_Rules; }
+    };
+    
+    /// \brief Compact tables with 16-bit symbols, and states and rules of up to 12 bits
+    typedef compact_parser_tables<short, unsigned short> small_parser_tables;
+}
+
+#endif
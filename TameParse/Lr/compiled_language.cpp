@@ -0,0 +1,289 @@
+//
+//  compiled_language.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include "TameParse/Lr/compiled_language.h"
+#include "TameParse/Dfa/binary_lexer.h"
+
+#include <algorithm>
+
+#if __cplusplus >= 201103L
+#include <atomic>
+#include <thread>
+#endif
+
+using namespace std;
+using namespace dfa;
+using namespace lr;
+
+/// \brief Creates a language from a lexer and a set of parser tables
+compiled_language::compiled_language(lexer* lex, const parser_tables* tables, bool ownsLanguage, const vector<int>& terminalModes)
+: m_Lexer(lex)
+, m_Tables(tables)
+, m_OwnsLanguage(ownsLanguage)
+, m_LexerMemory(NULL)
+, m_TablesMemory(NULL)
+, m_Parser(tables, false)
+, m_LexerModes(terminalModes.empty() ? NULL : new lexer_mode_table(*tables, terminalModes)) {
+    // The lexer would otherwise be compiled by the first call to create_stream, which may happen on any thread
+    lex->compile();
+}
+
+/// \brief Creates a language from a lexer that is ready to use and a set of parser tables
+compiled_language::compiled_language(const basic_lexer* lex, const parser_tables* tables, bool ownsLanguage, const vector<int>& terminalModes)
+: m_Lexer(lex)
+, m_Tables(tables)
+, m_OwnsLanguage(ownsLanguage)
+, m_LexerMemory(NULL)
+, m_TablesMemory(NULL)
+, m_Parser(tables, false)
+, m_LexerModes(terminalModes.empty() ? NULL : new lexer_mode_table(*tables, terminalModes)) {
+}
+
+/// \brief Destructor
+compiled_language::~compiled_language() {
+    delete m_LexerModes;
+    
+    if (m_OwnsLanguage) {
+        delete m_Lexer;
+        delete m_Tables;
+    }
+    
+    // The lexer and the tables refer to this memory, so it goes last
+    delete m_LexerMemory;
+    delete m_TablesMemory;
+}
+
+/// \brief Loads a language from a binary lexer and binary parser tables, or returns NULL if either of them is not valid
+compiled_language* compiled_language::from_binary(const void* lexerData, size_t lexerSize, const void* tablesData, size_t tablesSize, bool hugePages, int numaNode) {
+    util::placed_memory*    lexerMemory     = new util::placed_memory(lexerData, lexerSize, hugePages, numaNode);
+    util::placed_memory*    tablesMemory    = new util::placed_memory(tablesData, tablesSize, hugePages, numaNode);
+    
+    binary_lexer*           lex             = binary_lexer::from_binary(lexerMemory->begin(), lexerMemory->size());
+    parser_tables*          tables          = parser_tables::from_binary(tablesMemory->begin(), tablesMemory->size());
+    
+    if (!lex || !tables) {
+        delete lex;
+        delete tables;
+        delete lexerMemory;
+        delete tablesMemory;
+        return NULL;
+    }
+    
+    compiled_language* result   = new compiled_language((const basic_lexer*) lex, tables, true);
+    result->m_LexerMemory       = lexerMemory;
+    result->m_TablesMemory      = tablesMemory;
+    
+    return result;
+}
+
+/// \brief The number of bytes used by this language: its lexer, its parser tables and this object
+size_t compiled_language::memory_usage() const {
+    size_t result = sizeof(*this) + m_Lexer->memory_usage() + m_Tables->memory_usage();
+    if (m_LexerModes) result += m_LexerModes->memory_usage();
+    
+    return result;
+}
+
+/// \brief Creates a parser that will read from the file with the specified name, or NULL if it can't be opened
+ast_parser::state* compiled_language::create_parser(const std::string& filename, int initialState) const {
+    lexeme_stream* stream = m_Lexer->create_stream_from_file(filename);
+    if (!stream) return NULL;
+    
+    ast_parser::state* parser = m_Parser.create_parser(new ast_parser_actions(stream), initialState);
+    parser->set_mode_lexer(stream, m_LexerModes);
+    
+    return parser;
+}
+
+/// \brief Creates a parser that will read from an array of tokens, which must outlive the parser and its AST
+ast_parser::state* compiled_language::create_parser(const token_array& tokens, int initialState) const {
+    return m_Parser.create_parser(new ast_parser_actions(tokens), initialState);
+}
+
+/// \brief Parses a file into a result object
+void compiled_language::parse_file(parse_file_result& result, int initialState) const {
+    ast_parser::state* parser = create_parser(result.filename, initialState);
+    
+    result.opened = parser != NULL;
+    if (!parser) return;
+    
+    result.accepted = parser->parse();
+    
+    if (result.accepted) {
+        result.ast = parser->get_item();
+    } else if (parser->look().item()) {
+        result.error_position = parser->look()->pos();
+    }
+    
+    delete parser;
+}
+
+#if __cplusplus >= 201103L
+
+/// \brief Parses files from a result list until there are none left
+static void parse_worker(const compiled_language* language, compiled_language::result_list* results, atomic<size_t>* nextFile, int initialState) {
+    for (;;) {
+        size_t fileIndex = (*nextFile)++;
+        if (fileIndex >= results->size()) return;
+        
+        language->parse_file((*results)[fileIndex], initialState);
+    }
+}
+
+#endif
+
+/// \brief Parses each of the specified files, using up to maxThreads threads
+void compiled_language::parse_files(const std::vector<std::string>& filenames, result_list& results, int initialState, unsigned int maxThreads) const {
+    // Each result is filled in by exactly one worker, so the list must not be resized while they're running
+    results.clear();
+    results.resize(filenames.size());
+    
+    for (size_t fileIndex = 0; fileIndex < filenames.size(); ++fileIndex) {
+        results[fileIndex].filename = filenames[fileIndex];
+    }
+    
+#if __cplusplus >= 201103L
+    if (maxThreads == 0) maxThreads = thread::hardware_concurrency();
+    if (maxThreads > filenames.size()) maxThreads = (unsigned int) filenames.size();
+    
+    if (maxThreads > 1) {
+        atomic<size_t>  nextFile(0);
+        vector<thread>  workers;
+        
+        // The calling thread waits for the workers rather than working itself, so the ASTs are all created on threads that have finished
+        for (unsigned int threadIndex = 0; threadIndex < maxThreads; ++threadIndex) {
+            workers.push_back(thread(parse_worker, this, &results, &nextFile, initialState));
+        }
+        
+        for (vector<thread>::iterator worker = workers.begin(); worker != workers.end(); ++worker) {
+            worker->join();
+        }
+        
+        return;
+    }
+#endif
+    
+    // Parse on this thread
+    for (result_list::iterator result = results.begin(); result != results.end(); ++result) {
+        parse_file(*result, initialState);
+    }
+}
+
+/// \brief Parses the item described by a result object, which must have its offset, length and position set
+void compiled_language::parse_item(const int* buffer, parse_item_result& result, int initialState) const {
+    const int*      itemBegin   = buffer + result.offset;
+    const int*      itemEnd     = itemBegin + result.length;
+    
+    // Restarting from a checkpoint gives the lexemes positions relative to the whole buffer
+    lexeme_stream*  stream      = m_Lexer->create_stream_from_checkpoint(buffer, itemEnd, lexer_checkpoint(result.position, 0, false));
+    if (!stream) stream = m_Lexer->create_stream_from_symbols(itemBegin, itemEnd);
+    
+    ast_parser::state* parser = m_Parser.create_parser(new ast_parser_actions(stream), initialState);
+    parser->set_mode_lexer(stream, m_LexerModes);
+    
+    result.accepted = parser->parse();
+    
+    if (result.accepted) {
+        result.ast = parser->get_item();
+    } else if (parser->look().item()) {
+        result.error_position = parser->look()->pos();
+    }
+    
+    delete parser;
+}
+
+/// \brief The number of items that a worker thread takes from the list at once
+static const size_t c_ItemsPerChunk = 32;
+
+#if __cplusplus >= 201103L
+
+/// \brief Parses chunks of items from a result list until there are none left
+static void parse_items_worker(const compiled_language* language, const int* buffer, compiled_language::item_result_list* results, atomic<size_t>* nextItem, int initialState) {
+    for (;;) {
+        size_t firstItem = nextItem->fetch_add(c_ItemsPerChunk);
+        if (firstItem >= results->size()) return;
+        
+        size_t lastItem = min(firstItem + c_ItemsPerChunk, results->size());
+        for (size_t itemIndex = firstItem; itemIndex < lastItem; ++itemIndex) {
+            language->parse_item(buffer, (*results)[itemIndex], initialState);
+        }
+    }
+}
+
+#endif
+
+/// \brief Splits a buffer into a list of independent items, and parses them using up to maxThreads threads
+void compiled_language::parse_items(const int* begin, const int* end, const item_boundary_scanner& scanner, item_result_list& results, int initialState, unsigned int maxThreads) const {
+    results.clear();
+    
+    // Find the items, and the position of each one, in a single pass over the buffer
+    position_tracker    tracker;
+    const int*          tracked     = begin;
+    const int*          itemBegin   = begin;
+    const int*          itemEnd     = begin;
+    
+    for (const int* pos = begin; scanner.next_item(pos, end, itemBegin, itemEnd); pos = itemEnd) {
+        // Stop if the scanner isn't making any progress
+        if (itemEnd <= pos) break;
+        
+        tracker.update_position(tracked, itemBegin);
+        tracked = itemBegin;
+        
+        results.push_back(parse_item_result());
+        parse_item_result& item = results.back();
+        
+        item.offset     = itemBegin - begin;
+        item.length     = itemEnd - itemBegin;
+        item.position   = tracker.current_position();
+    }
+    
+#if __cplusplus >= 201103L
+    size_t numChunks = (results.size() + c_ItemsPerChunk - 1) / c_ItemsPerChunk;
+    
+    if (maxThreads == 0) maxThreads = thread::hardware_concurrency();
+    if (maxThreads > numChunks) maxThreads = (unsigned int) numChunks;
+    
+    if (maxThreads > 1) {
+        atomic<size_t>  nextItem(0);
+        vector<thread>  workers;
+        
+        // As with parse_files, the calling thread only waits, so the ASTs are all created on threads that have finished
+        for (unsigned int threadIndex = 0; threadIndex < maxThreads; ++threadIndex) {
+            workers.push_back(thread(parse_items_worker, this, begin, &results, &nextItem, initialState));
+        }
+        
+        for (vector<thread>::iterator worker = workers.begin(); worker != workers.end(); ++worker) {
+            worker->join();
+        }
+        
+        return;
+    }
+#endif
+    
+    // Parse on this thread
+    for (item_result_list::iterator item = results.begin(); item != results.end(); ++item) {
+        parse_item(begin, *item, initialState);
+    }
+}
@@ -0,0 +1,235 @@
+//
+//  compiled_language.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _LR_COMPILED_LANGUAGE_H
+#define _LR_COMPILED_LANGUAGE_H
+
+#include <string>
+#include <vector>
+
+#include "TameParse/Util/astnode.h"
+#include "TameParse/Util/placed_memory.h"
+#include "TameParse/Dfa/lexer.h"
+#include "TameParse/Dfa/item_boundary_scanner.h"
+#include "TameParse/Dfa/token_array.h"
+#include "TameParse/Lr/parser_tables.h"
+#include "TameParse/Lr/lexer_mode_table.h"
+#include "TameParse/Lr/ast_parser.h"
+
+namespace lr {
+    ///
+    /// \brief The result of parsing a single file with compiled_language::parse_files
+    ///
+    struct parse_file_result {
+        /// \brief The name of the file that was parsed
+        std::string filename;
+        
+        /// \brief True if the file could be opened
+        bool opened;
+        
+        /// \brief True if the parser accepted the file
+        bool accepted;
+        
+        /// \brief The AST for the file, or NULL if it was not accepted
+        util::astnode_container ast;
+        
+        /// \brief The position of the lookahead symbol when the parser rejected the file
+        dfa::position error_position;
+        
+        parse_file_result()
+        : opened(false)
+        , accepted(false)
+        , ast((util::astnode*) NULL, false)
+        , error_position(-1, -1, -1) {
+        }
+    };
+    
+    ///
+    /// \brief The result of parsing a single top-level item with compiled_language::parse_items
+    ///
+    struct parse_item_result {
+        /// \brief The offset of the first symbol of the item in the buffer that was split
+        dfa::stream_offset offset;
+        
+        /// \brief The number of symbols in the item
+        dfa::stream_offset length;
+        
+        /// \brief The position of the first symbol of the item
+        dfa::position position;
+        
+        /// \brief True if the parser accepted the item
+        bool accepted;
+        
+        /// \brief The AST for the item, or NULL if it was not accepted
+        util::astnode_container ast;
+        
+        /// \brief The position of the lookahead symbol when the parser rejected the item
+        dfa::position error_position;
+        
+        parse_item_result()
+        : offset(0)
+        , length(0)
+        , accepted(false)
+        , ast((util::astnode*) NULL, false)
+        , error_position(-1, -1, -1) {
+        }
+    };
+    
+    ///
+    /// \brief An immutable lexer and set of parser tables that can be shared between threads
+    ///
+    /// The lexer is compiled when this object is constructed, and nothing in this object is changed afterwards, so any
+    /// number of threads can create parsers from it at the same time. Each parser session builds its own lexemes and
+    /// AST nodes, which must stay with the thread that is running the session until it has finished.
+    ///
+    /// The tables are never copied: every parser that is created refers to the tables owned by this object, so it 
+    /// must outlive them.
+    ///
+    class compiled_language {
+    public:
+        /// \brief List of results from parse_files
+        typedef std::vector<parse_file_result> result_list;
+        
+        /// \brief List of results from parse_items
+        typedef std::vector<parse_item_result> item_result_list;
+        
+    private:
+        /// \brief The lexer for this language
+        const dfa::basic_lexer* m_Lexer;
+        
+        /// \brief The parser tables for this language
+        const parser_tables* m_Tables;
+        
+        /// \brief True if the lexer and tables should be deleted along with this object
+        bool m_OwnsLanguage;
+        
+        /// \brief NULL, or the memory that the lexer was loaded from (owned by this object)
+        util::placed_memory* m_LexerMemory;
+        
+        /// \brief NULL, or the memory that the tables were loaded from (owned by this object)
+        util::placed_memory* m_TablesMemory;
+        
+        /// \brief Parser that refers to m_Tables
+        ast_parser m_Parser;
+        
+        /// \brief NULL, or the lexer mode that the parser should switch to in each state (owned by this object)
+        lexer_mode_table* m_LexerModes;
+        
+        compiled_language(const compiled_language& copyFrom);
+        compiled_language& operator=(const compiled_language& copyFrom);
+        
+    public:
+        /// \brief Creates a language from a lexer and a set of parser tables
+        ///
+        /// The lexer is compiled immediately if it isn't already. If ownsLanguage is true, then the lexer and the tables
+        /// are deleted when this object is. If terminalModes is not empty, it gives the lexer mode that each terminal
+        /// is matched in (see lexer_mode_table), and the parsers created by this object switch the lexer between them.
+        compiled_language(dfa::lexer* lex, const parser_tables* tables, bool ownsLanguage = true, const std::vector<int>& terminalModes = std::vector<int>());
+        
+        /// \brief Creates a language from a lexer that is ready to use and a set of parser tables
+        ///
+        /// If the lexer is a dfa::lexer, then it must already be compiled.
+        compiled_language(const dfa::basic_lexer* lex, const parser_tables* tables, bool ownsLanguage = true, const std::vector<int>& terminalModes = std::vector<int>());
+        
+        /// \brief Loads a language from a lexer written by binary_lexer::write_binary and tables written by
+        /// parser_tables::write_binary, or returns NULL if either of them is not valid
+        ///
+        /// The data is copied, so the caller's buffers (often mapped_files) can be released once this returns. If
+        /// hugePages is true, the copies are put in 2MB huge pages where the system allows it, and if numaNode is not
+        /// negative, they are put in the memory of that NUMA node. See replicated_language for a set of copies, one
+        /// for each node.
+        static compiled_language* from_binary(const void* lexerData, size_t lexerSize, const void* tablesData, size_t tablesSize, bool hugePages = false, int numaNode = -1);
+        
+        /// \brief Destructor
+        ~compiled_language();
+        
+        /// \brief The lexer for this language
+        inline const dfa::basic_lexer& get_lexer() const { return *m_Lexer; }
+        
+        /// \brief The parser tables for this language
+        inline const parser_tables& get_tables() const { return *m_Tables; }
+        
+        /// \brief NULL, or the memory holding the binary tables for the lexer, if this language was loaded by from_binary()
+        inline const util::placed_memory* lexer_memory() const { return m_LexerMemory; }
+        
+        /// \brief NULL, or the memory holding the binary parser tables, if this language was loaded by from_binary()
+        inline const util::placed_memory* tables_memory() const { return m_TablesMemory; }
+        
+        /// \brief A parser that produces ASTs for this language
+        inline const ast_parser& get_parser() const { return m_Parser; }
+        
+        /// \brief NULL, or the lexer mode that the parser should switch to in each state
+        ///
+        /// This is set for languages whose lexer has more than one mode. The parsers created by this object already
+        /// use it, and it can be passed to parser::state::set_mode_lexer() for parsers created from get_parser().
+        inline const lexer_mode_table* lexer_modes() const { return m_LexerModes; }
+        
+        /// \brief The number of bytes used by this language: its lexer, its parser tables and this object
+        ///
+        /// The sessions created from this language are not included: use ast_parser::state::session_memory_usage() and
+        /// astnode::memory_usage() to measure them.
+        size_t memory_usage() const;
+        
+        /// \brief Creates a parser that will read from the file with the specified name, or NULL if it can't be opened
+        ast_parser::state* create_parser(const std::string& filename, int initialState = 0) const;
+        
+        /// \brief Creates a parser that will read from an array of tokens, which must outlive the parser and its AST
+        ///
+        /// The tokens can be created once with get_lexer() and parsed any number of times, from any thread.
+        ast_parser::state* create_parser(const dfa::token_array& tokens, int initialState = 0) const;
+        
+        /// \brief Parses a file into a result object
+        void parse_file(parse_file_result& result, int initialState = 0) const;
+        
+        /// \brief Parses each of the specified files, using up to maxThreads threads
+        ///
+        /// The results are in the same order as the filenames. Each worker thread runs one parser session at a time, 
+        /// so the ASTs in the results can be used from the calling thread once this returns. If maxThreads is 0, then
+        /// one thread is used for each processor core. Files are parsed one after the other on the calling thread if 
+        /// the library was built without C++11 thread support.
+        void parse_files(const std::vector<std::string>& filenames, result_list& results, int initialState = 0, unsigned int maxThreads = 0) const;
+        
+        /// \brief Parses the item described by a result object, which must have its offset, length and position set
+        ///
+        /// The offset is relative to buffer, which is the start of the symbols that were split into items. Lexers that
+        /// can't restart from a checkpoint produce positions relative to the start of the item instead.
+        void parse_item(const int* buffer, parse_item_result& result, int initialState = 0) const;
+        
+        /// \brief Splits a buffer into a list of independent items, and parses them using up to maxThreads threads
+        ///
+        /// The initial state should be the one for the language's start symbol for a single item (a record or a
+        /// declaration, say). The scanner divides the buffer into items without lexing it, then the items are shared
+        /// out between the worker threads in chunks, and each thread parses them with its own sessions. The results are
+        /// in the same order as the items in the buffer, and the positions of the lexemes in them are relative to the 
+        /// start of the buffer.
+        ///
+        /// The lexemes refer to the symbols in the buffer rather than copying them, so it must remain valid and 
+        /// unchanged for as long as the ASTs in the results are in use. As with parse_files, the items are parsed on
+        /// the calling thread if maxThreads is 1 or the library was built without C++11 thread support.
+        void parse_items(const int* begin, const int* end, const dfa::item_boundary_scanner& scanner, item_result_list& results, int initialState = 0, unsigned int maxThreads = 0) const;
+    };
+}
+
+#endif
@@ -25,7 +25,10 @@
 //  IN THE SOFTWARE.
 //
 
+#include <algorithm>
+
 #include "TameParse/Lr/conflict.h"
+#include "TameParse/Util/parallel.h"
 
 using namespace std;
 using namespace contextfree;
@@ -34,7 +37,8 @@ using namespace lr;
 /// \brief Creates a new conflict object (describing a non-conflict)
 conflict::conflict(int stateId, const item_container& token)
 : m_StateId(stateId)
-, m_Token(token) {
+, m_Token(token)
+, m_Builder(NULL) {
 }
 
 /// \brief Copy constructor
@@ -42,7 +46,9 @@ conflict::conflict(const conflict& copyFrom)
 : m_StateId(copyFrom.m_StateId)
 , m_Token(copyFrom.m_Token)
 , m_Shift(copyFrom.m_Shift)
-, m_Reduce(copyFrom.m_Reduce) {
+, m_Reduce(copyFrom.m_Reduce)
+, m_Builder(copyFrom.m_Builder)
+, m_PendingSources(copyFrom.m_PendingSources) {
 }
 
 /// \brief Destroys this conflict object
@@ -73,6 +79,10 @@ bool conflict::operator<(const conflict& compareTo) const {
     if (m_Shift < compareTo.m_Shift)        return true;
     if (m_Shift > compareTo.m_Shift)        return false;
     
+    // The reduce sets can only be compared once all of their sources are known
+    resolve_all_sources();
+    compareTo.resolve_all_sources();
+    
     if (m_Reduce < compareTo.m_Reduce)      return true;
     
     return false;
@@ -90,71 +100,113 @@ conflict::possible_reduce_states& conflict::add_reduce_item(const lr0_item_conta
     return m_Reduce[item];
 }
 
+/// \brief Adds an LR(0) item that will be reduced, whose possible states are the sources of the lookahead for 
+/// the item with the specified ID in this conflict's state
+void conflict::add_reduce_source(const lr0_item_container& item, const lalr_builder& builder, int itemId) {
+    // Make sure that the item exists in the reduce set
+    add_reduce_item(item);
+
+    // Remember to trace its sources later on
+    m_Builder = &builder;
+    m_PendingSources[item].push_back(itemId);
+}
+
+/// \brief Traces the lookahead sources for any pending items in the specified reduce set
+void conflict::resolve_sources(const lr0_item_container& item) const {
+    // Nothing to do if there are no pending items for this reduction
+    map<lr0_item_container, vector<int> >::iterator pending = m_PendingSources.find(item);
+    if (pending == m_PendingSources.end()) return;
+
+    // Work out which states can be reached by looking at the spontaneous and lookahead propagation
+    possible_reduce_states& reduceTo = m_Reduce[item];
+    for (vector<int>::const_iterator itemId = pending->second.begin(); itemId != pending->second.end(); ++itemId) {
+        m_Builder->find_lookahead_source(m_StateId, *itemId, m_Token, reduceTo);
+    }
+
+    // These items have been traced
+    m_PendingSources.erase(pending);
+}
+
+/// \brief Traces the lookahead sources for every pending item
+void conflict::resolve_all_sources() const {
+    while (!m_PendingSources.empty()) {
+        resolve_sources(m_PendingSources.begin()->first);
+    }
+}
+
+/// \brief The states and items that can be reached by the specified reduction
+const conflict::possible_reduce_states& conflict::reduce_states(const reduce_iterator& reduceItem) const {
+    resolve_sources(reduceItem->first);
+    return reduceItem->second;
+}
+
 /// \brief Adds the conflicts found in a single state of the specified LALR builder to the given target list
-static void find_conflicts(const lalr_builder& builder, int stateId, conflict_list& target) {
-    // Get the actions in this state
-    const lr_action_set& actions = builder.actions_for_state(stateId);
+///
+/// The actions are the compact actions for the state, which are sorted by this call. If shareClosure is true, the closure
+/// of the state is taken from the builder's scratch buffer; otherwise it is generated separately, which allows separate
+/// states to be checked on several threads at once.
+static void find_conflicts(const lalr_builder& builder, int stateId, compact_action_list& actions, bool shareClosure, conflict_list& target) {
+    // Sort the actions so that the actions for each item are together
+    std::sort(actions.begin(), actions.end());
     
-    // Run through these actions, and find places where there are conflicts (two actions for a single symbol)
-    typedef map<item_container, lr_action_set> items_to_actions;
-    items_to_actions actionsForItem;
-    
-    for (lr_action_set::const_iterator nextAction = actions.begin(); nextAction != actions.end(); ++nextAction) {
-        // Ignore actions that don't cause conflicts
-        bool ignore;
-        switch ((*nextAction)->type()) {
-            case lr_action::act_goto:
-            case lr_action::act_ignore:
-            case lr_action::act_accept:
-                ignore = true;
-                break;
-                
-            default:
-                ignore = false;
-                break;
-        }
-        if (ignore) continue;
-        
-        // Add this as an action for this item
-        actionsForItem[(*nextAction)->item()].insert(*nextAction);
-    }
+    // The closure of this state, if it's generated separately
+    lr1_item_set    generatedClosure;
+    bool            closureGenerated = false;
     
-    // Generate conflicts for any item with multiple actions
-    for (items_to_actions::iterator nextItem = actionsForItem.begin(); nextItem != actionsForItem.end(); ++nextItem) {
-        // Ignore items with just one action (or no actions, if that's ever possible)
-        if (nextItem->second.size() < 2) continue;
+    // Run through these actions, and find places where there are conflicts (two actions for a single symbol)
+    for (compact_action_list::const_iterator firstAction = actions.begin(); firstAction != actions.end(); ) {
+        // Count the actions for this item that might cause a conflict
+        int numActions  = 0;
+        int numWeak     = 0;
         
-        // Ignore items if all but one of the items are 'weak'
-        int numWeak = 0;
-        for (lr_action_set::const_iterator nextAction = nextItem->second.begin(); nextAction != nextItem->second.end(); ++nextAction) {
-            switch ((*nextAction)->type()) {
+        compact_action_list::const_iterator nextAction;
+        for (nextAction = firstAction; nextAction != actions.end() && nextAction->same_item(*firstAction); ++nextAction) {
+            switch (nextAction->type) {
+                // Ignore actions that don't cause conflicts
+                case lr_action::act_goto:
+                case lr_action::act_ignore:
+                case lr_action::act_accept:
+                    break;
+                    
+                // Ignore items if all but one of the items are 'weak'
                 case lr_action::act_guard:
                 case lr_action::act_weakreduce:
-                case lr_action::act_ignore:
+                    ++numActions;
                     ++numWeak;
                     break;
                     
                 default:
+                    ++numActions;
                     break;
             }
         }
         
-        if (nextItem->second.size() - numWeak < 2) continue;
+        // Move on to the next item
+        compact_action_list::const_iterator thisAction = firstAction;
+        firstAction = nextAction;
+        
+        // Ignore items with just one action (or no actions, if that's ever possible)
+        if (numActions < 2) continue;
+        if (numActions - numWeak < 2) continue;
         
         // Create a new conflict for this action
-        const item_container&   conflictToken = *nextItem->first;
+        item_container          conflictToken = thisAction->item(builder.gram());
         conflict_container      newConf(new conflict(stateId, conflictToken), true);
         
         // Fetch the items in this state
         const lalr_state& thisState = *builder.machine().state_with_id(stateId);
         
-        // Get the closure of this state
-        lr1_item_set closure;
-        builder.generate_closure(thisState, closure, &builder.gram());
-        
         // Describe the actions resulting in this conflict by going through the items in the closure of the state
         const grammar*    gram = &builder.gram();
         
+        // Get the closure of this state
+        if (!shareClosure && !closureGenerated) {
+            lalr_builder::generate_closure(thisState, generatedClosure, gram);
+            closureGenerated = true;
+        }
+        
+        const lr1_item_set& closure = shareClosure ? builder.closure_for_state(stateId) : generatedClosure;
+        
         // Iterate through the closure to get the items that can be shifted as part of this conflict
         for (lr1_item_set::const_iterator nextItem = closure.begin(); nextItem != closure.end(); ++nextItem) {
             if (!(*nextItem)->at_end()) {
@@ -212,16 +264,8 @@ static void find_conflicts(const lalr_builder& builder, int stateId, conflict_li
             // This isn't part of the conflict if it isn't being reduced based on the 
             if (!la.contains(conflictToken)) continue;
 
-            // Add a conflict for this item
-            conflict::possible_reduce_states& reduceTo = newConf->add_reduce_item(thisItem);
-
-            // Work out which states can be reached by looking at the spontaneous and lookahead propagation
-            typedef set<conflict::lr_item_id>  lr_item_id_set;
-            lr_item_id_set sourceItems;
-            builder.find_lookahead_source(stateId, itemId, conflictToken, sourceItems);
-
-            // Add to the reduce set
-            reduceTo.insert(sourceItems.begin(), sourceItems.end());
+            // Add a conflict for this item (the states it can reach are only worked out if they're asked for)
+            newConf->add_reduce_source(thisItem, builder, itemId);
         }
         
         // Ignore conflicts that contain no items at all
@@ -235,11 +279,63 @@ static void find_conflicts(const lalr_builder& builder, int stateId, conflict_li
     }
 }
 
+/// \brief Finds the conflicts in each state of a LALR builder on separate threads
+class find_state_conflicts {
+private:
+    /// \brief The builder to check
+    const lalr_builder& m_Builder;
+    
+    /// \brief The compact actions for each state
+    vector<compact_action_list>& m_Actions;
+    
+public:
+    /// \brief The conflicts found in each state
+    vector<conflict_list> conflicts;
+    
+    find_state_conflicts(const lalr_builder& builder, vector<compact_action_list>& actions)
+    : m_Builder(builder)
+    , m_Actions(actions)
+    , conflicts(actions.size()) {
+    }
+    
+    /// \brief Finds the conflicts in the state with the specified identifier
+    void operator()(size_t stateId) {
+        ::find_conflicts(m_Builder, (int) stateId, m_Actions[stateId], false, conflicts[stateId]);
+    }
+};
+
 /// \brief Adds the conflicts found in the specified LALR builder object to the passed in list
-void conflict::find_conflicts(const lalr_builder& builder, conflict_list& target) {
-    // Iterate through the states in the builder
+void conflict::find_conflicts(const lalr_builder& builder, conflict_list& target, unsigned int maxThreads) {
+    // Any rules or items that haven't been numbered yet are numbered in the same order for any number of threads
+    builder.fill_grammar_caches();
+    
+    if (maxThreads == 1) {
+        // Iterate through the states in the builder
+        compact_action_list actions;
+        
+        for (int stateId=0; stateId < builder.count_states(); ++stateId) {
+            builder.compact_actions_for_state(stateId, actions);
+            ::find_conflicts(builder, stateId, actions, true, target);
+        }
+        
+        return;
+    }
+    
+    // Fetch the actions for every state on this thread (this can update the builder's caches)
+    builder.compute_all_actions(maxThreads);
+    
+    vector<compact_action_list> actions(builder.count_states());
     for (int stateId=0; stateId < builder.count_states(); ++stateId) {
-        ::find_conflicts(builder, stateId, target);
+        builder.compact_actions_for_state(stateId, actions[stateId]);
+    }
+    
+    // Check the states on separate threads
+    find_state_conflicts task(builder, actions);
+    util::parallel_for(actions.size(), maxThreads, task);
+    
+    // Add the conflicts in the same order as they would be found by checking each state in turn
+    for (vector<conflict_list>::const_iterator stateConflicts = task.conflicts.begin(); stateConflicts != task.conflicts.end(); ++stateConflicts) {
+        target.insert(target.end(), stateConflicts->begin(), stateConflicts->end());
     }
 }
 
@@ -95,7 +95,22 @@ namespace lr {
         ///
         /// (These can be determined by finding where the appropriate lookaheads were generated spontaneously,
         /// and/or could be propagated from)
-        reduce_conflicts m_Reduce;
+        mutable reduce_conflicts m_Reduce;
+
+        /// \brief The builder that the lookahead sources for the reduce items should be traced through
+        const lalr_builder* m_Builder;
+
+        /// \brief Maps reduce items to the IDs of the items in this state whose lookahead sources haven't been traced yet
+        ///
+        /// Tracing the source of a lookahead is expensive and is only needed to explain a conflict, so it's put off
+        /// until reduce_states() is called for the item.
+        mutable std::map<lr0_item_container, std::vector<int> > m_PendingSources;
+
+        /// \brief Traces the lookahead sources for any pending items in the specified reduce set
+        void resolve_sources(const lr0_item_container& item) const;
+
+        /// \brief Traces the lookahead sources for every pending item
+        void resolve_all_sources() const;
         
         /// \brief Disabled assignment
         conflict& operator=(const conflict& assignFrom);
@@ -128,6 +143,12 @@ namespace lr {
         ///
         /// This returns an item that the caller can add the set of reduce states for this item
         possible_reduce_states& add_reduce_item(const lr0_item_container& item);
+
+        /// \brief Adds an LR(0) item that will be reduced, whose possible states are the sources of the lookahead for 
+        /// the item with the specified ID in this conflict's state
+        ///
+        /// The builder must remain valid for as long as the possible states might be requested from this object.
+        void add_reduce_source(const lr0_item_container& item, const lalr_builder& builder, int itemId);
         
     public:
         /// \brief The state ID where this conflict occurred
@@ -149,10 +170,20 @@ namespace lr {
         
         /// \brief The item after the final conflicting reduce action.
         inline reduce_iterator last_reduce_item() const { return m_Reduce.end(); }
+
+        /// \brief The states and items that can be reached by the specified reduction
+        ///
+        /// The sources of the lookahead are traced the first time this is called for a particular item. This should
+        /// be used instead of reading the set directly from the reduce iterator.
+        const possible_reduce_states& reduce_states(const reduce_iterator& reduceItem) const;
         
     public:
         /// \brief Adds the conflicts found in the specified LALR builder object to the passed in list
-        static void find_conflicts(const lalr_builder& builder, conflict_list& target);
+        ///
+        /// The states are checked using up to maxThreads threads (0 for one thread per processor core). The conflicts
+        /// are always listed in order of the state they were found in, so the result is the same for any number of
+        /// threads.
+        static void find_conflicts(const lalr_builder& builder, conflict_list& target, unsigned int maxThreads = 1);
     };
 }
 
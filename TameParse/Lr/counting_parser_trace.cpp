@@ -0,0 +1,60 @@
+//
+//  counting_parser_trace.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#include "TameParse/Lr/counting_parser_trace.h"
+#include "TameParse/Util/parallel.h"
+
+using namespace lr;
+
+/// \brief Creates a new set of counters, all set to zero
+parser_counters::parser_counters() {
+    reset();
+}
+
+/// \brief Sets all of the counters back to zero
+void parser_counters::reset() {
+    shifts              = 0;
+    reductions          = 0;
+    ignored             = 0;
+    rejected            = 0;
+    guardChecks         = 0;
+    guardMatches        = 0;
+    strongSubstitutions = 0;
+    maxLookahead        = 0;
+    stackDepth          = 0;
+    maxStackDepth       = 0;
+    
+    reductionsForRule.clear();
+    guardChecksForState.clear();
+    guardMatchesForState.clear();
+    statesEntered.clear();
+}
+
+/// \brief The counters that counting_parser_trace adds to on the calling thread
+parser_counters& parser_counters::current() {
+    static TAMEPARSE_THREAD_LOCAL parser_counters counters;
+    return counters;
+}
@@ -0,0 +1,179 @@
+//
+//  counting_parser_trace.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _LR_COUNTING_PARSER_TRACE_H
+#define _LR_COUNTING_PARSER_TRACE_H
+
+#include <map>
+#include <vector>
+
+#include "TameParse/Lr/parser.h"
+
+namespace lr {
+    ///
+    /// \brief Counts of the actions performed by parsers that use counting_parser_trace
+    ///
+    /// Every parser on a thread that uses counting_parser_trace adds to the same counters (see current()), so they
+    /// describe everything parsed since the last call to reset().
+    ///
+    class parser_counters {
+    public:
+        /// \brief Count of something for each state or symbol
+        typedef std::map<int, long> count_map;
+        
+        /// \brief The number of symbols that were shifted (including the states pushed when a guard diverts the parser)
+        long shifts;
+        
+        /// \brief The number of reductions that were performed
+        long reductions;
+        
+        /// \brief The number of symbols that were ignored
+        long ignored;
+        
+        /// \brief The number of symbols that were rejected
+        long rejected;
+        
+        /// \brief The number of times a guard was checked
+        long guardChecks;
+        
+        /// \brief The number of times a guard was matched
+        long guardMatches;
+        
+        /// \brief The number of weak symbols that were shifted as their strong equivalent
+        long strongSubstitutions;
+        
+        /// \brief The furthest that a parser has looked ahead of its current position (0 is the current symbol)
+        int maxLookahead;
+        
+        /// \brief The number of entries above the initial state on the parser stack
+        ///
+        /// This is tracked from the shifts and reductions, so it is only meaningful when a single parser is running on
+        /// the thread at a time.
+        int stackDepth;
+        
+        /// \brief The deepest that stackDepth has been
+        int maxStackDepth;
+        
+        /// \brief The number of reductions for each rule, indexed by the rule ID
+        std::vector<long> reductionsForRule;
+        
+        /// \brief The number of times each guard was checked, indexed by its initial state
+        count_map guardChecksForState;
+        
+        /// \brief The number of times each guard was matched, indexed by its initial state
+        count_map guardMatchesForState;
+        
+        /// \brief The number of times each state was entered by a shift or a goto, indexed by the state ID
+        count_map statesEntered;
+        
+    public:
+        /// \brief Creates a new set of counters, all set to zero
+        parser_counters();
+        
+        /// \brief Sets all of the counters back to zero
+        void reset();
+        
+        /// \brief The counters that counting_parser_trace adds to on the calling thread
+        static parser_counters& current();
+    };
+    
+    ///
+    /// \brief Parser trace class that counts the actions that the parser performs
+    ///
+    /// Use this as the parser_trace parameter of the parser template to find out which rules and guards a parser spends
+    /// its time on. The counts are added to parser_counters::current(). Parsers that use no_parser_trace are unaffected:
+    /// the trace calls are empty inline functions that the compiler removes.
+    ///
+    class counting_parser_trace : public no_parser_trace {
+    private:
+        /// \brief The counters to update
+        parser_counters* m_Counters;
+        
+    public:
+        inline counting_parser_trace()
+        : m_Counters(&parser_counters::current()) {
+        }
+        
+        inline void ignore(const lexeme_container& lookahead) {
+            ++m_Counters->ignored;
+        }
+        
+        inline void shift(const lexeme_container& lookahead, int newState) {
+            ++m_Counters->shifts;
+            ++m_Counters->statesEntered[newState];
+            if (++m_Counters->stackDepth > m_Counters->maxStackDepth) {
+                m_Counters->maxStackDepth = m_Counters->stackDepth;
+            }
+        }
+        
+        inline void reduce(int nonterminalId, int ruleId, int length) {
+            ++m_Counters->reductions;
+            
+            // The goto for the nonterminal replaces the symbols that are popped
+            m_Counters->stackDepth -= length - 1;
+            if (m_Counters->stackDepth > m_Counters->maxStackDepth) {
+                m_Counters->maxStackDepth = m_Counters->stackDepth;
+            }
+            
+            if (ruleId >= 0) {
+                if ((size_t) ruleId >= m_Counters->reductionsForRule.size()) {
+                    m_Counters->reductionsForRule.resize(ruleId + 1, 0);
+                }
+                ++m_Counters->reductionsForRule[ruleId];
+            }
+        }
+        
+        inline void goto_state(int newState) {
+            ++m_Counters->statesEntered[newState];
+        }
+        
+        inline void checked_guard(int initialState, int result) {
+            ++m_Counters->guardChecks;
+            ++m_Counters->guardChecksForState[initialState];
+            
+            if (result >= 0) {
+                ++m_Counters->guardMatches;
+                ++m_Counters->guardMatchesForState[initialState];
+            }
+        }
+        
+        inline void reject(const lexeme_container& lookahead) {
+            ++m_Counters->rejected;
+        }
+        
+        inline void substitute_strong(const lexeme_container& strongLexeme) {
+            ++m_Counters->strongSubstitutions;
+        }
+        
+        inline void lookahead(int offset) {
+            if (offset > m_Counters->maxLookahead) {
+                m_Counters->maxLookahead = offset;
+            }
+        }
+    };
+}
+
+#endif
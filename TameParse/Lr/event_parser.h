@@ -0,0 +1,145 @@
+//
+//  event_parser.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _LR_EVENT_PARSER_H
+#define _LR_EVENT_PARSER_H
+
+#include <vector>
+
+#include "TameParse/Dfa/lexer.h"
+#include "TameParse/Lr/parser.h"
+#include "TameParse/Lr/compact_parser_tables.h"
+
+namespace lr {
+    ///
+    /// \brief Callbacks invoked by a parser using the event_parser_actions class
+    ///
+    /// This is an alternative to building a full AST for callers that only need to react to a few rules. The value
+    /// stack holds a lexeme container for each symbol, which is all that is kept in memory during the parse. For a 
+    /// terminal, this is the lexeme that was matched. For a nonterminal, it is whatever the reduce callback returns:
+    /// by default, rules with a single symbol pass that symbol's value on, and all other rules have an empty value.
+    ///
+    class parser_events {
+    public:
+        /// \brief The value associated with a symbol on the parser stack
+        typedef dfa::lexeme_container value;
+        
+        /// \brief The values for the symbols in a rule that is being reduced
+        ///
+        /// As with the reduce list passed to parser actions, these are in reverse order: the last symbol in the rule
+        /// is at index 0.
+        typedef std::vector<value> value_list;
+        
+    public:
+        /// \brief Destructor
+        virtual ~parser_events() { }
+        
+        /// \brief Called when a terminal symbol is shifted
+        virtual void shift(const dfa::lexeme_container& lexeme) { }
+        
+        /// \brief Called when a rule is reduced, returns the value to associate with the nonterminal
+        virtual value reduce(int nonterminal, int rule, const value_list& values) {
+            if (values.size() == 1) return values[0];
+            return value();
+        }
+    };
+    
+    ///
+    /// \brief Parser actions that pass shift and reduce actions on to a parser_events object instead of building an AST
+    ///
+    class event_parser_actions {
+    public:
+        /// \brief Type of a lexeme stream
+        typedef dfa::lexeme_stream lexeme_stream;
+        
+        /// \brief Type of a parser that uses these actions
+        typedef parser<parser_events::value, event_parser_actions> event_parser;
+        
+        /// \brief Type of a list of reduced symbols
+        typedef event_parser::reduce_list reduce_list;
+        
+    private:
+        /// \brief The stream of lexemes that this actions object will read from
+        lexeme_stream* m_Stream;
+        
+        /// \brief True if the stream should be deleted along with this object
+        bool m_OwnStream;
+        
+        /// \brief The object that receives the parser events (not owned by this object)
+        parser_events* m_Events;
+        
+        event_parser_actions(const event_parser_actions& copyFrom);
+        event_parser_actions& operator=(event_parser_actions& copyFrom);
+        
+    public:
+        /// \brief Creates a new actions object that will read from the specified stream and report to the specified events object
+        ///
+        /// The events object must remain valid for as long as the parser session does.
+        event_parser_actions(lexeme_stream* stream, parser_events* events, bool ownStream = true)
+        : m_Stream(stream)
+        , m_OwnStream(ownStream)
+        , m_Events(events) {
+        }
+        
+        /// \brief Destroys an existing actions object
+        ~event_parser_actions() {
+            if (m_OwnStream) {
+                delete m_Stream;
+            }
+        }
+        
+        /// \brief Reads the next symbol from the stream
+        inline dfa::lexeme* read() {
+            dfa::lexeme* result = NULL;
+            (*m_Stream) >> result;
+            return result;
+        }
+        
+        /// \brief Reports a shift action, and returns the lexeme as the value for the terminal
+        inline parser_events::value shift(const dfa::lexeme_container& lexeme) {
+            m_Events->shift(lexeme);
+            return lexeme;
+        }
+        
+        /// \brief Reports a reduce action, and returns the value chosen by the events object
+        inline parser_events::value reduce(int nonterminal, int rule, const reduce_list& reduce, const dfa::position& lookaheadPosition) {
+            return m_Events->reduce(nonterminal, rule, reduce);
+        }
+    };
+    
+    /// \brief A parser that reports events instead of building an AST
+    typedef event_parser_actions::event_parser event_parser;
+
+#if __cplusplus >= 201103L
+    // Generated parsers declare event parsers using both kinds of table, so they are instantiated once in
+    // event_parser.cpp instead of in every file that uses one. Compact tables can't be built at runtime, so only
+    // the parser state and session are instantiated for those.
+    extern template class parser<parser_events::value, event_parser_actions>;
+    extern template class parser<parser_events::value, event_parser_actions, no_parser_trace, small_parser_tables>::state;
+    extern template class parser<parser_events::value, event_parser_actions, no_parser_trace, small_parser_tables>::session;
+#endif
+}
+
+#endif
@@ -0,0 +1,117 @@
+//
+//  green_parser.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include "TameParse/Lr/green_parser.h"
+
+using namespace util;
+using namespace dfa;
+using namespace lr;
+
+template class lr::parser<util::green_node_container, lr::green_parser_actions>;
+
+/// \brief Creates a trivia node for the specified lexeme
+green_node_container green_parser_actions::create_trivia(const unshifted& lexeme) {
+    const int* firstSymbol = lexeme.text.empty() ? NULL : &lexeme.text[0];
+    const int* lastSymbol  = firstSymbol + lexeme.text.size();
+    
+    if (m_Table) {
+        return m_Table->get_trivia(lexeme.symbol, firstSymbol, lastSymbol);
+    } else {
+        return green_node_container(new green_node(green_node::trivia, lexeme.symbol, firstSymbol, lastSymbol), true);
+    }
+}
+
+/// \brief Creates a token node
+green_node_container green_parser_actions::create_token(int symbol, const int* firstSymbol, const int* lastSymbol, const green_node::node_list& trivia) {
+    if (m_Table) {
+        return m_Table->get_token(symbol, firstSymbol, lastSymbol, trivia);
+    } else {
+        return green_node_container(new green_node(symbol, firstSymbol, lastSymbol, trivia), true);
+    }
+}
+
+/// \brief Reads the next symbol from the stream, remembering it until it is shifted
+lexeme* green_parser_actions::read() {
+    lexeme* result = NULL;
+    (*m_Stream) >> result;
+    
+    // The text is copied, as the parser may discard the lexeme before it is shifted
+    if (result) {
+        m_Unshifted.push_back(unshifted());
+        
+        unshifted& remembered   = m_Unshifted.back();
+        remembered.symbol       = result->matched();
+        remembered.offset       = result->pos().offset();
+        remembered.text.assign(result->begin(), result->end());
+    }
+    
+    return result;
+}
+
+/// \brief Returns the token resulting from a shift action, with any lexemes read before it attached as trivia
+green_node_container green_parser_actions::shift(const lexeme_container& lexeme) {
+    // Empty lexemes (for guards and symbols inserted during error recovery) weren't read from the stream, so they
+    // don't take any trivia
+    if (lexeme->length() == 0) {
+        return create_token(lexeme->matched(), NULL, NULL, green_node::node_list());
+    }
+    
+    // Find the lexeme that is being shifted (a weak symbol may have been replaced with a new lexeme for its strong
+    // equivalent, so this is done by offset)
+    std::deque<unshifted>::iterator shifted = m_Unshifted.begin();
+    while (shifted != m_Unshifted.end() && shifted->offset != lexeme->pos().offset()) {
+        ++shifted;
+    }
+    
+    // Everything read before it is trivia
+    green_node::node_list trivia;
+    if (shifted != m_Unshifted.end()) {
+        for (std::deque<unshifted>::iterator skipped = m_Unshifted.begin(); skipped != shifted; ++skipped) {
+            trivia.push_back(create_trivia(*skipped));
+        }
+        
+        m_Unshifted.erase(m_Unshifted.begin(), shifted + 1);
+    }
+    
+    return create_token(lexeme->matched(), lexeme->begin(), lexeme->end(), trivia);
+}
+
+/// \brief Completes the tree for a parse, returning a node containing the root and an end-of-input token
+green_node_container green_parser_actions::complete(const green_node_container& root) {
+    green_node::node_list trivia;
+    for (std::deque<unshifted>::iterator remaining = m_Unshifted.begin(); remaining != m_Unshifted.end(); ++remaining) {
+        trivia.push_back(create_trivia(*remaining));
+    }
+    m_Unshifted.clear();
+    
+    green_node_container    endOfInput  = create_token(c_EndOfInput, NULL, NULL, trivia);
+    green_node_container    children[2] = { root, endOfInput };
+    
+    if (m_Table) {
+        return m_Table->get_nonterminal(root->symbol(), root->rule(), children, children + 2);
+    } else {
+        return green_node_container(new green_node(root->symbol(), root->rule(), children, children + 2), true);
+    }
+}
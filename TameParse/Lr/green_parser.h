@@ -0,0 +1,157 @@
+//
+//  green_parser.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _LR_GREEN_PARSER_H
+#define _LR_GREEN_PARSER_H
+
+#include <deque>
+
+#include "TameParse/Util/green_node.h"
+#include "TameParse/Dfa/lexer.h"
+#include "TameParse/Lr/parser.h"
+
+namespace lr {
+    ///
+    /// \brief Parser actions that build a lossless green syntax tree (see util::green_node)
+    ///
+    /// Every lexeme read from the stream ends up in the tree. Lexemes that the parser doesn't shift (symbols handled
+    /// by the ignored_symbols rewriter, and any that are skipped while recovering from an error) are attached as
+    /// trivia to the next token that is shifted. Guards and symbols inserted while recovering from an error are shifted
+    /// as empty tokens with no trivia. The lexemes left over after the last token are attached to an end-of-input token
+    /// by complete(), which should be called once the parse is finished to get the full tree.
+    ///
+    /// Symbols that the lexer itself is told to skip (see dfa::lexeme_stream::skip_symbols) never reach the actions,
+    /// so the lexer should not be set up to skip anything when the tree needs to be lossless.
+    ///
+    class green_parser_actions {
+    public:
+        /// \brief Type of a green node
+        typedef util::green_node green_node;
+        
+        /// \brief Container for a green node
+        typedef util::green_node_container green_node_container;
+        
+        /// \brief Type of a lexeme stream
+        typedef dfa::lexeme_stream lexeme_stream;
+        
+        /// \brief Type of a parser that uses these actions
+        typedef parser<green_node_container, green_parser_actions> green_parser;
+        
+        /// \brief Type of a list of reduced symbols
+        typedef green_parser::reduce_list reduce_list;
+        
+        /// \brief The symbol used for the end-of-input token created by complete()
+        static const int c_EndOfInput = -1;
+    
+    private:
+        /// \brief A lexeme that has been read but not yet shifted
+        struct unshifted {
+            /// \brief The symbol that was matched
+            int symbol;
+            
+            /// \brief The offset of the lexeme
+            dfa::stream_offset offset;
+            
+            /// \brief The text of the lexeme
+            green_node::text text;
+        };
+        
+        /// \brief The stream of lexemes that this actions object will read from
+        lexeme_stream* m_Stream;
+        
+        /// \brief NULL, or the table used to share identical subtrees (not owned by this object)
+        util::green_node_table* m_Table;
+        
+        /// \brief The lexemes that have been read but not yet shifted, in the order they were read
+        std::deque<unshifted> m_Unshifted;
+        
+        /// \brief Creates a trivia node for the specified lexeme
+        green_node_container create_trivia(const unshifted& lexeme);
+        
+        /// \brief Creates a token node
+        green_node_container create_token(int symbol, const int* firstSymbol, const int* lastSymbol, const green_node::node_list& trivia);
+        
+        green_parser_actions(const green_parser_actions& copyFrom);
+        green_parser_actions& operator=(const green_parser_actions& assignFrom);
+    
+    public:
+        /// \brief Creates a new actions object that will read from the specified stream
+        ///
+        /// The stream will be deleted when this object is deleted. If table is not NULL, then the nodes are shared
+        /// through it: it must outlive this object, and can be used again for later parses or other documents.
+        explicit green_parser_actions(dfa::lexeme_stream* stream, util::green_node_table* table = NULL)
+        : m_Stream(stream)
+        , m_Table(table) {
+        }
+        
+        /// \brief Destroys an existing actions object
+        ~green_parser_actions() {
+            delete m_Stream;
+        }
+        
+        /// \brief The table used to share identical subtrees, or NULL if they are not being shared
+        inline util::green_node_table* get_table() const { return m_Table; }
+        
+        /// \brief Starts reading from a different stream, deleting the old one (used when resetting a parser to parse new input)
+        ///
+        /// Trees from earlier parses remain valid, as green nodes are not owned by the actions.
+        inline void reset(dfa::lexeme_stream* stream) {
+            if (stream != m_Stream) delete m_Stream;
+            m_Stream = stream;
+            m_Unshifted.clear();
+        }
+        
+        /// \brief Reads the next symbol from the stream, remembering it until it is shifted
+        dfa::lexeme* read();
+        
+        /// \brief Returns the token resulting from a shift action, with any lexemes read before it attached as trivia
+        green_node_container shift(const dfa::lexeme_container& lexeme);
+        
+        /// \brief Returns the item resulting from a reduce action
+        inline green_node_container reduce(int nonterminal, int rule, const reduce_list& reduce, const dfa::position& lookaheadPosition) {
+            if (m_Table) {
+                return m_Table->get_nonterminal(nonterminal, rule, reduce.rbegin(), reduce.rend());
+            } else {
+                return green_node_container(new green_node(nonterminal, rule, reduce.rbegin(), reduce.rend()), true);
+            }
+        }
+        
+        /// \brief Completes the tree for a parse, returning a node containing the root and an end-of-input token
+        ///
+        /// The end-of-input token has the symbol c_EndOfInput and no text, and its trivia are the lexemes that were
+        /// read after the last token. The result is a nonterminal node with the same item and rule as the root.
+        green_node_container complete(const green_node_container& root);
+    };
+    
+    /// \brief A parser that produces a green syntax tree from the input source file
+    typedef green_parser_actions::green_parser green_parser;
+
+#if __cplusplus >= 201103L
+    // This parser is instantiated once in green_parser.cpp instead of in every file that uses it
+    extern template class parser<util::green_node_container, green_parser_actions>;
+#endif
+}
+
+#endif
@@ -0,0 +1,429 @@
+//
+//  guard_dfa.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#include <map>
+#include <set>
+
+#include "TameParse/Lr/guard_dfa.h"
+#include "TameParse/Lr/parser_tables.h"
+
+using namespace std;
+using namespace lr;
+
+/// \brief The states pushed by the guard parser on top of the guard's initial state
+typedef vector<int> guard_stack;
+
+/// \brief The maximum number of actions that can be performed without reading a symbol before a guard is abandoned
+static const int c_MaxSteps = 4096;
+
+///
+/// \brief Works out the DFA for a single guard by simulating the guard parser for every configuration it can reach
+///
+/// The simulation follows the same steps as parser::state::evaluate_guard, but with a stack that starts at the guard's
+/// initial state. Anything that would make the result depend on more than the stack and the symbol being read means
+/// that the guard can't be compiled.
+///
+class guard_compiler {
+public:
+    /// \brief The result of running the guard parser
+    enum outcome {
+        /// \brief The symbol was shifted or ignored
+        consumed,
+        
+        /// \brief The guard was accepted
+        accepted,
+        
+        /// \brief The guard was rejected
+        rejected,
+        
+        /// \brief The guard can't be compiled into a DFA
+        unsupported
+    };
+    
+    /// \brief Actions in the tables
+    typedef parser_tables::action_iterator action_iterator;
+    
+    /// \brief Rules in the tables
+    typedef parser_tables::reduce_rule reduce_rule;
+    
+    /// \brief The DFA states, identified by the parser stack that they represent
+    typedef map<guard_stack, int> state_for_stack;
+    
+public:
+    /// \brief The guard symbol accepted by each DFA state, or -1
+    vector<int> accept;
+    
+    /// \brief The state entered at the end of input by each DFA state, or -1
+    vector<int> endOfInput;
+    
+    /// \brief The transitions for each DFA state
+    vector<vector<guard_dfa::transition> > transitions;
+    
+private:
+    /// \brief The tables being compiled
+    const parser_tables& m_Tables;
+    
+    /// \brief The guard symbol accepted by the last call to settle() or read()
+    int m_Accepted;
+    
+    /// \brief The DFA state for each parser stack that has been found so far
+    state_for_stack m_States;
+    
+    /// \brief The accepting DFA state for each guard symbol
+    map<int, int> m_AcceptStates;
+    
+    /// \brief Parser stacks that have a DFA state, but whose transitions have not been worked out yet
+    vector<guard_stack> m_Waiting;
+    
+public:
+    /// \brief Creates a compiler for the specified tables
+    explicit guard_compiler(const parser_tables& tables)
+    : m_Tables(tables)
+    , m_Accepted(-1) {
+    }
+    
+private:
+    /// \brief Reduces the specified rule, returning false if that would need a state from below the guard
+    bool reduce(guard_stack& stack, int ruleId) const {
+        const reduce_rule& rule = m_Tables.rule(ruleId);
+        if ((int) stack.size() <= rule.length) return false;
+        
+        stack.resize(stack.size() - rule.length);
+        
+        // Perform the goto action in the same way as the guard parser does
+        int state       = stack.back();
+        int gotoState   = m_Tables.goto_state(state, rule.identifier);
+        if (gotoState >= 0) {
+            stack.push_back(gotoState);
+        }
+        
+        return true;
+    }
+    
+    /// \brief Works out whether or not the specified nonterminal can be reduced, starting with the specified action
+    ///
+    /// Returns 1 if it can, 0 if it can't and -1 if the answer can't be worked out from the stack
+    int can_reduce_nonterminal(const guard_stack& stack, int nonterminal, action_iterator act) const {
+        switch (act->type) {
+            case lr_action::act_shift:
+            case lr_action::act_shiftstrong:
+            case lr_action::act_shiftreduce:
+            case lr_action::act_accept:
+                return 1;
+                
+            case lr_action::act_reduce:
+                break;
+                
+            default:
+                return -1;
+        }
+        
+        guard_stack fakeStack(stack);
+        if (!reduce(fakeStack, act->nextState)) return -1;
+        
+        for (int step = 0; step < c_MaxSteps; ++step) {
+            int state = fakeStack.back();
+            
+            // Skip any guard actions, as the parser does
+            act = m_Tables.find_nonterminal(state, nonterminal);
+            while (act != m_Tables.last_nonterminal_action(state) && act->symbolId == nonterminal && act->type == lr_action::act_guard) {
+                ++act;
+            }
+            
+            if (act == m_Tables.last_nonterminal_action(state) || act->symbolId != nonterminal) return 0;
+            
+            switch (act->type) {
+                case lr_action::act_shift:
+                case lr_action::act_shiftstrong:
+                case lr_action::act_shiftreduce:
+                case lr_action::act_accept:
+                    return 1;
+                    
+                case lr_action::act_reduce:
+                    if (!reduce(fakeStack, act->nextState)) return -1;
+                    break;
+                    
+                case lr_action::act_divert:
+                case lr_action::act_weakreduce:
+                    return -1;
+                    
+                default:
+                    return 0;
+            }
+        }
+        
+        return -1;
+    }
+    
+    /// \brief Performs the actions that don't depend on the lookahead (default reductions and the end of guard symbol)
+    ///
+    /// Returns consumed if the parser is ready to read the next symbol
+    outcome settle(guard_stack& stack) {
+        for (int step = 0; step < c_MaxSteps; ++step) {
+            int state = stack.back();
+            
+            if (m_Tables.has_default_reduction(state)) {
+                if (!reduce(stack, m_Tables.default_reduction(state)->nextState)) return unsupported;
+                continue;
+            }
+            
+            // Nothing more to do unless the end of guard symbol can be reduced
+            if (!m_Tables.has_end_of_guard(state)) return consumed;
+            
+            int             eog     = m_Tables.end_of_guard();
+            action_iterator eogAct  = m_Tables.find_nonterminal(state, eog);
+            if (eogAct == m_Tables.last_nonterminal_action(state) || eogAct->symbolId != eog) return unsupported;
+            
+            int canReduceEog = can_reduce_nonterminal(stack, eog, eogAct);
+            if (canReduceEog < 0)   return unsupported;
+            if (canReduceEog == 0)  return consumed;
+            
+            // Perform the first action for the end of guard symbol
+            switch (eogAct->type) {
+                case lr_action::act_accept:
+                    m_Accepted = m_Tables.rule(eogAct->nextState).identifier;
+                    return accepted;
+                    
+                case lr_action::act_reduce:
+                    if (!reduce(stack, eogAct->nextState)) return unsupported;
+                    break;
+                    
+                default:
+                    return unsupported;
+            }
+        }
+        
+        return unsupported;
+    }
+    
+    /// \brief Runs the guard parser until the specified symbol is consumed, or the guard is accepted or rejected
+    outcome read(guard_stack& stack, int symbol, bool isTerminal) {
+        for (int step = 0; step < c_MaxSteps; ++step) {
+            outcome settled = settle(stack);
+            if (settled != consumed) return settled;
+            
+            // Find the first action for this symbol
+            int             state   = stack.back();
+            action_iterator act     = isTerminal ? m_Tables.find_terminal(state, symbol) : m_Tables.find_nonterminal(state, symbol);
+            action_iterator end     = isTerminal ? m_Tables.last_terminal_action(state) : m_Tables.last_nonterminal_action(state);
+            
+            if (act == end || act->symbolId != symbol) return rejected;
+            
+            switch (act->type) {
+                case lr_action::act_accept:
+                    m_Accepted = m_Tables.rule(act->nextState).identifier;
+                    return accepted;
+                    
+                case lr_action::act_ignore:
+                    return consumed;
+                    
+                case lr_action::act_shift:
+                case lr_action::act_shiftstrong:
+                case lr_action::act_shiftreduce:
+                    // (settle() performs the default reduction for a shift-reduce action before the next symbol is read)
+                    stack.push_back(act->nextState);
+                    return consumed;
+                    
+                case lr_action::act_divert:
+                    // The symbol is left as lookahead for the new state
+                    stack.push_back(act->nextState);
+                    break;
+                    
+                case lr_action::act_reduce:
+                    if (!reduce(stack, act->nextState)) return unsupported;
+                    break;
+                    
+                default:
+                    // Weak reductions and guards depend on more than the current stack
+                    return unsupported;
+            }
+        }
+        
+        return unsupported;
+    }
+    
+    /// \brief Finds or creates the DFA state for the specified stack
+    int state_for(const guard_stack& stack) {
+        state_for_stack::iterator found = m_States.find(stack);
+        if (found != m_States.end()) return found->second;
+        
+        int newState = add_state();
+        m_States[stack] = newState;
+        m_Waiting.push_back(stack);
+        
+        return newState;
+    }
+    
+    /// \brief Finds or creates the DFA state that accepts the specified guard symbol
+    int accept_state(int guardSymbol) {
+        map<int, int>::iterator found = m_AcceptStates.find(guardSymbol);
+        if (found != m_AcceptStates.end()) return found->second;
+        
+        int newState = add_state();
+        accept[newState] = guardSymbol;
+        m_AcceptStates[guardSymbol] = newState;
+        
+        return newState;
+    }
+    
+    /// \brief Adds a new DFA state with no transitions
+    int add_state() {
+        accept.push_back(-1);
+        endOfInput.push_back(-1);
+        transitions.push_back(vector<guard_dfa::transition>());
+        
+        return (int) accept.size() - 1;
+    }
+    
+    /// \brief Works out the DFA state reached from the specified stack after reading a symbol, or -1 if the guard is rejected
+    ///
+    /// Returns false if the guard can't be compiled
+    bool next_state(const guard_stack& stack, int symbol, bool isTerminal, int& nextState) {
+        guard_stack nextStack(stack);
+        
+        switch (read(nextStack, symbol, isTerminal)) {
+            case consumed:  nextState = state_for(nextStack);           return true;
+            case accepted:  nextState = accept_state(m_Accepted);       return true;
+            case rejected:  nextState = -1;                             return true;
+            default:                                                    return false;
+        }
+    }
+    
+public:
+    /// \brief Builds the DFA for the guard starting at the specified state, which will always be state 0
+    ///
+    /// Returns false if the guard can't be compiled into a DFA with at most maxStates states
+    bool compile(int guardState, int maxStates) {
+        state_for(guard_stack(1, guardState));
+        
+        while (!m_Waiting.empty()) {
+            if ((int) accept.size() > maxStates) return false;
+            
+            guard_stack stack       = m_Waiting.back();
+            int         dfaState    = m_States[stack];
+            m_Waiting.pop_back();
+            
+            // Perform the actions that don't depend on the lookahead: this state might accept or reject straight away
+            switch (settle(stack)) {
+                case accepted:      accept[dfaState] = m_Accepted;  continue;
+                case rejected:                                      continue;
+                case unsupported:                                   return false;
+                default:                                            break;
+            }
+            
+            // Each terminal symbol with an action in the current state produces a transition
+            int                     state       = stack.back();
+            const parser_tables::action* first  = m_Tables.terminal_actions()[state];
+            const parser_tables::action* last   = first + m_Tables.action_counts()[state].numTerminals;
+            
+            for (const parser_tables::action* act = first; act != last; ++act) {
+                // Only need to look at the first action for each symbol
+                if (act != first && act[-1].symbolId == act->symbolId) continue;
+                
+                int nextState;
+                if (!next_state(stack, act->symbolId, true, nextState)) return false;
+                if (nextState < 0) continue;
+                
+                guard_dfa::transition newTransition;
+                newTransition.symbol    = act->symbolId;
+                newTransition.nextState = nextState;
+                transitions[dfaState].push_back(newTransition);
+            }
+            
+            // The end of input symbol has a nonterminal action
+            int endState;
+            if (!next_state(stack, m_Tables.end_of_input(), false, endState)) return false;
+            endOfInput[dfaState] = endState;
+        }
+        
+        return (int) accept.size() <= maxStates;
+    }
+};
+
+/// \brief Compiles every guard in the specified tables that can be evaluated by a DFA with at most maxStates states
+guard_dfa::guard_dfa(const parser_tables& tables, int maxStates)
+: m_MaxStates(maxStates) {
+    // Find the initial states of the guards: these are the targets of the guard actions, which are on the symbols
+    // that can begin each guard
+    set<int> guardStates;
+    
+    for (int stateId = 0; stateId < tables.count_states(); ++stateId) {
+        const parser_tables::action_count&  counts          = tables.action_counts()[stateId];
+        const parser_tables::action*        terminals       = tables.terminal_actions()[stateId];
+        const parser_tables::action*        nonterminals    = tables.nonterminal_actions()[stateId];
+        
+        for (int actionId = 0; actionId < counts.numTerminals; ++actionId) {
+            if (terminals[actionId].type == lr_action::act_guard) {
+                guardStates.insert((int) terminals[actionId].nextState);
+            }
+        }
+        
+        for (int actionId = 0; actionId < counts.numNonterminals; ++actionId) {
+            if (nonterminals[actionId].type == lr_action::act_guard) {
+                guardStates.insert((int) nonterminals[actionId].nextState);
+            }
+        }
+    }
+    
+    // Compile each guard in turn
+    m_FirstTransition.push_back(0);
+    
+    for (set<int>::const_iterator guardState = guardStates.begin(); guardState != guardStates.end(); ++guardState) {
+        guard_compiler compiler(tables);
+        if (!compiler.compile(*guardState, maxStates)) continue;
+        
+        // Append the states for this guard
+        int firstState = (int) m_Accept.size();
+        
+        m_GuardStates.push_back(*guardState);
+        m_StartStates.push_back(firstState);
+        
+        for (size_t dfaState = 0; dfaState < compiler.accept.size(); ++dfaState) {
+            m_Accept.push_back(compiler.accept[dfaState]);
+            m_EndOfInput.push_back(compiler.endOfInput[dfaState] >= 0 ? compiler.endOfInput[dfaState] + firstState : -1);
+            
+            // Transitions are generated in symbol order, as the actions are sorted
+            vector<transition>& stateTransitions = compiler.transitions[dfaState];
+            for (vector<transition>::iterator trans = stateTransitions.begin(); trans != stateTransitions.end(); ++trans) {
+                trans->nextState += firstState;
+                m_Transitions.push_back(*trans);
+            }
+            
+            m_FirstTransition.push_back((int) m_Transitions.size());
+        }
+    }
+}
+
+/// \brief Calculates the size in bytes of these automata
+size_t guard_dfa::size() const {
+    size_t total = sizeof(guard_dfa);
+    
+    total += sizeof(int) * (m_GuardStates.size() + m_StartStates.size());
+    total += sizeof(int) * (m_Accept.size() + m_EndOfInput.size() + m_FirstTransition.size());
+    total += sizeof(transition) * m_Transitions.size();
+    
+    return total;
+}
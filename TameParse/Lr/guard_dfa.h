@@ -0,0 +1,135 @@
+//
+//  guard_dfa.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _LR_GUARD_DFA_H
+#define _LR_GUARD_DFA_H
+
+#include <algorithm>
+#include <vector>
+
+namespace lr {
+    class parser_tables;
+    
+    ///
+    /// \brief Deterministic automata over terminal symbols that evaluate guards without running the parser
+    ///
+    /// A guard is checked by running the parser forward from the guard's initial state until the end of guard symbol
+    /// can be reduced. Many guards only ever look at a short sequence of terminals, and for these the parser's stack
+    /// can only be in a small number of configurations. This class works out those configurations when the tables are
+    /// built, and turns each into a state of a DFA whose transitions are the terminal symbols of the lookahead.
+    ///
+    /// Guards that need more than a fixed number of configurations (such as guards that match nested structures), and
+    /// guards that use actions whose result depends on more than the symbol being read (weak reductions, nested
+    /// guards or states from the stack below the guard) are not compiled. The parser evaluates these in the usual way.
+    ///
+    class guard_dfa {
+    public:
+        /// \brief The default maximum number of DFA states for a single guard
+        static const int c_DefaultMaxStates = 256;
+        
+        /// \brief Transition from a DFA state
+        struct transition {
+            /// \brief The terminal symbol that causes this transition
+            int symbol;
+            
+            /// \brief The DFA state that is entered after the symbol has been read
+            int nextState;
+            
+            /// \brief Orders transitions by symbol
+            inline bool operator<(const transition& compareTo) const { return symbol < compareTo.symbol; }
+        };
+        
+    private:
+        /// \brief The maximum number of DFA states that were allowed for each guard
+        int m_MaxStates;
+        
+        /// \brief Sorted list of the parser states where the compiled guards begin
+        std::vector<int> m_GuardStates;
+        
+        /// \brief The DFA state that each guard in m_GuardStates begins in
+        std::vector<int> m_StartStates;
+        
+        /// \brief The guard symbol accepted by each DFA state, or -1 if the state needs to read more lookahead
+        std::vector<int> m_Accept;
+        
+        /// \brief The DFA state entered at the end of the input, or -1 if the guard is rejected
+        std::vector<int> m_EndOfInput;
+        
+        /// \brief The index of the first transition for each DFA state (with an extra entry at the end)
+        std::vector<int> m_FirstTransition;
+        
+        /// \brief The transitions for each state, sorted by symbol
+        std::vector<transition> m_Transitions;
+        
+    public:
+        /// \brief Compiles every guard in the specified tables that can be evaluated by a DFA with at most maxStates states
+        explicit guard_dfa(const parser_tables& tables, int maxStates = c_DefaultMaxStates);
+        
+    public:
+        /// \brief The maximum number of DFA states that were allowed for each guard
+        inline int max_states() const { return m_MaxStates; }
+        
+        /// \brief The number of guards that were compiled
+        inline int count_guards() const { return (int) m_GuardStates.size(); }
+        
+        /// \brief The number of states across all of the DFAs
+        inline int count_states() const { return (int) m_Accept.size(); }
+        
+        /// \brief Calculates the size in bytes of these automata
+        size_t size() const;
+        
+        /// \brief The initial DFA state for the guard that starts at the specified parser state, or -1 if it was not compiled
+        inline int start_state(int guardState) const {
+            std::vector<int>::const_iterator found = std::lower_bound(m_GuardStates.begin(), m_GuardStates.end(), guardState);
+            if (found == m_GuardStates.end() || *found != guardState) return -1;
+            
+            return m_StartStates[found - m_GuardStates.begin()];
+        }
+        
+        /// \brief The guard symbol that is accepted when the specified DFA state is reached, or -1 if more lookahead is needed
+        inline int accepted_guard(int dfaState) const { return m_Accept[dfaState]; }
+        
+        /// \brief The DFA state reached by reading the specified terminal symbol, or -1 if the guard is rejected
+        inline int next_state(int dfaState, int terminal) const {
+            typedef std::vector<transition>::const_iterator iterator;
+            
+            iterator    first   = m_Transitions.begin() + m_FirstTransition[dfaState];
+            iterator    last    = m_Transitions.begin() + m_FirstTransition[dfaState+1];
+            transition  search;
+            
+            search.symbol = terminal;
+            iterator found = std::lower_bound(first, last, search);
+            if (found == last || found->symbol != terminal) return -1;
+            
+            return found->nextState;
+        }
+        
+        /// \brief The DFA state reached at the end of the input, or -1 if the guard is rejected
+        inline int end_of_input_state(int dfaState) const { return m_EndOfInput[dfaState]; }
+    };
+}
+
+#endif
@@ -0,0 +1,173 @@
+//
+//  guard_resolver.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#include <vector>
+
+#include "TameParse/Lr/guard_resolver.h"
+
+using namespace std;
+using namespace contextfree;
+using namespace lr;
+
+/// \brief The maximum number of reductions that will be followed when deciding a guard
+static const int c_MaxReductions = 256;
+
+/// \brief Finds the only action for the specified item in a set of actions, returning NULL if there are none or several
+static const lr_action* only_action(const lr_action_set& actions, const item& forItem) {
+    const lr_action* result = NULL;
+    
+    for (lr_action_set::const_iterator act = actions.begin(); act != actions.end(); ++act) {
+        if (*(*act)->item() != forItem) continue;
+        if (result != NULL) return NULL;
+        
+        result = &**act;
+    }
+    
+    return result;
+}
+
+/// \brief True if the guard beginning at the specified state is always matched when the specified terminal is
+/// the next symbol in the lookahead
+///
+/// This follows the actions that the guard parser would take: the terminal must be shifted, after which the end of guard
+/// symbol must lead to the guard being accepted without needing any states from below the guard. Any state that has a
+/// choice of actions for these symbols means that the guard can't be decided from the terminal alone.
+bool guard_resolver::matched_by_terminal(int guardState, const item_container& terminal, const lalr_builder& builder) const {
+    static const end_of_guard eog;
+    
+    // The actions for states that are being rewritten are not complete yet
+    if (m_Rewriting.find(guardState) != m_Rewriting.end()) return false;
+    
+    // The guard is matched before the terminal is read if it can be empty, in which case it is not this rewriter's business
+    const lr_action_set& initialActions = builder.actions_for_state(guardState);
+    
+    for (lr_action_set::const_iterator act = initialActions.begin(); act != initialActions.end(); ++act) {
+        if ((*act)->item()->type() == item::eog) return false;
+    }
+    
+    // The terminal must be shifted
+    const lr_action* shift = only_action(initialActions, *terminal);
+    if (shift == NULL || shift->type() != lr_action::act_shift) return false;
+    
+    vector<int> stack;
+    stack.push_back(guardState);
+    stack.push_back(shift->next_state());
+    
+    // Follow the reductions for the end of guard symbol until the guard is accepted
+    for (int reduction = 0; reduction < c_MaxReductions; ++reduction) {
+        if (m_Rewriting.find(stack.back()) != m_Rewriting.end()) return false;
+        
+        const lr_action* act = only_action(builder.actions_for_state(stack.back()), eog);
+        if (act == NULL) return false;
+        
+        switch (act->type()) {
+            case lr_action::act_accept:
+                return true;
+                
+            case lr_action::act_reduce:
+            {
+                // Reductions can't reach below the guard's initial state
+                size_t length = act->rule()->items().size();
+                if (length >= stack.size()) return false;
+                
+                stack.resize(stack.size() - length);
+                
+                // Perform the goto for the reduced nonterminal
+                if (m_Rewriting.find(stack.back()) != m_Rewriting.end()) return false;
+                
+                const lr_action* gotoAct = only_action(builder.actions_for_state(stack.back()), *act->rule()->nonterminal());
+                if (gotoAct == NULL || gotoAct->type() != lr_action::act_goto) return false;
+                
+                stack.push_back(gotoAct->next_state());
+                break;
+            }
+                
+            default:
+                return false;
+        }
+    }
+    
+    return false;
+}
+
+/// \brief Modifies the specified set of actions according to the rules in this rewriter
+///
+/// The guard actions that are decided by their first symbol are replaced with divert actions.
+void guard_resolver::rewrite_actions(int state, lr_action_set& actions, const lalr_builder& builder) const {
+    vector<lr_action_container> diverts;
+    
+    m_Rewriting.insert(state);
+    
+    for (lr_action_set::const_iterator act = actions.begin(); act != actions.end(); ++act) {
+        if ((*act)->type() != lr_action::act_guard) continue;
+        
+        // Only guards that have their initial symbol to themselves can be resolved
+        const item_container& terminal = (*act)->item();
+        bool otherGuard = false;
+        
+        for (lr_action_set::const_iterator other = actions.begin(); other != actions.end(); ++other) {
+            if (other != act && (*other)->type() == lr_action::act_guard && *(*other)->item() == *terminal) {
+                otherGuard = true;
+                break;
+            }
+        }
+        
+        if (otherGuard) continue;
+        
+        // The guard symbol must be shifted in this state (reductions on the guard symbol need the guard to be evaluated)
+        const lr_action* guardShift = only_action(actions, *(*act)->rule()->nonterminal());
+        if (guardShift == NULL || guardShift->type() != lr_action::act_shift) continue;
+        
+        // The guard must always be matched when the terminal is seen
+        if (!matched_by_terminal((*act)->next_state(), terminal, builder)) continue;
+        
+        diverts.push_back(lr_action_container(new lr_action(lr_action::act_divert, terminal, guardShift->next_state()), true));
+    }
+    
+    m_Rewriting.erase(state);
+    
+    // Replace every action for the resolved terminals with the divert action
+    for (vector<lr_action_container>::const_iterator divert = diverts.begin(); divert != diverts.end(); ++divert) {
+        vector<lr_action_container> replaced;
+        
+        for (lr_action_set::const_iterator act = actions.begin(); act != actions.end(); ++act) {
+            if (*(*act)->item() == *(*divert)->item()) {
+                replaced.push_back(*act);
+            }
+        }
+        
+        for (vector<lr_action_container>::const_iterator act = replaced.begin(); act != replaced.end(); ++act) {
+            actions.erase(*act);
+        }
+        
+        actions.insert(*divert);
+    }
+}
+
+/// \brief Creates a clone of this rewriter
+action_rewriter* guard_resolver::clone() const {
+    return new guard_resolver();
+}
@@ -0,0 +1,71 @@
+//
+//  guard_resolver.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _LR_GUARD_RESOLVER_H
+#define _LR_GUARD_RESOLVER_H
+
+#include <set>
+
+#include "TameParse/Lr/action_rewriter.h"
+
+namespace lr {
+    ///
+    /// \brief Action rewriter that replaces guards that are decided by their first symbol with divert actions
+    ///
+    /// A guard action makes the parser run the guard's rule forward over the lookahead whenever one of the symbols that
+    /// can begin the guard is seen. For guards like '[=> 'x' ]', or alternatives that complete after a single terminal,
+    /// seeing that terminal is enough to know that the guard will be matched. When the guard symbol is then simply
+    /// shifted, this rewriter replaces the guard action for the terminal with a divert action to the state after the
+    /// guard, so the parser never evaluates the guard for that symbol.
+    ///
+    /// The other actions for the terminal are removed at the same time: the parser would never reach them, as the guard
+    /// is always matched. Guards that need more than one symbol to decide, or that share their initial symbol with
+    /// another guard, are left alone.
+    ///
+    class guard_resolver : public action_rewriter {
+    private:
+        /// \brief The states whose actions are being rewritten by this object
+        ///
+        /// Deciding a guard requires the actions for the guard's states, which might be in the process of being
+        /// generated. The guards that depend on these states are not resolved.
+        mutable std::set<int> m_Rewriting;
+        
+    public:
+        /// \brief True if the guard beginning at the specified state is always matched when the specified terminal is
+        /// the next symbol in the lookahead
+        bool matched_by_terminal(int guardState, const contextfree::item_container& terminal, const lalr_builder& builder) const;
+        
+        /// \brief Modifies the specified set of actions according to the rules in this rewriter
+        ///
+        /// The guard actions that are decided by their first symbol are replaced with divert actions.
+        virtual void rewrite_actions(int state, lr_action_set& actions, const lalr_builder& builder) const;
+        
+        /// \brief Creates a clone of this rewriter
+        virtual action_rewriter* clone() const;
+    };
+}
+
+#endif
@@ -0,0 +1,263 @@
+//
+//  incremental_parser.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include "TameParse/Lr/incremental_parser.h"
+
+using namespace std;
+using namespace util;
+using namespace dfa;
+using namespace lr;
+
+/// \brief Converts a position relative to the start of a lexer stream into an absolute position
+static position absolute_position(const position& relative, const position& base) {
+    if (relative.line() == 0) {
+        return position(base.offset() + relative.offset(), base.line(), base.column() + relative.column());
+    } else {
+        return position(base.offset() + relative.offset(), base.line() + relative.line(), relative.column());
+    }
+}
+
+/// \brief Creates an incremental parser for the specified language, which must outlive it
+incremental_parser::incremental_parser(const compiled_language& language, int initialState)
+: m_Language(language)
+, m_InitialState(initialState)
+, m_State(NULL)
+, m_Accepted(false)
+, m_RelexedTokens(0)
+, m_ReparsedTokens(0) {
+}
+
+/// \brief Destructor
+incremental_parser::~incremental_parser() {
+    m_Snapshots.clear();
+    delete m_State;
+}
+
+/// \brief The AST for the text, or NULL if it was not accepted
+astnode_container incremental_parser::ast() const {
+    if (!m_Accepted) return astnode_container((astnode*) NULL, false);
+    return m_State->get_item();
+}
+
+/// \brief Parses a new piece of text from scratch, returning true if it was accepted
+bool incremental_parser::parse(const int* begin, const int* end) {
+    m_Text.assign(begin, end);
+    
+    // Lex the whole text
+    m_Tokens.clear();
+    m_Checkpoints.clear();
+    
+    lexeme_stream* stream = m_Language.get_lexer().create_stream_from_symbols(begin, end);
+    for (;;) {
+        lexer_checkpoint    before;
+        bool                hasCheckpoint   = stream->checkpoint(before);
+        lexeme*             next            = NULL;
+        
+        (*stream) >> next;
+        if (!next) break;
+        
+        // Store a copy of the lexeme that doesn't refer to the text, which will change
+        m_Tokens.push_back(lexeme_container(new lexeme(next->content(), next->pos(), next->matched()), true));
+        m_Checkpoints.push_back(hasCheckpoint ? before : lexer_checkpoint(next->pos(), 0, false));
+        delete next;
+    }
+    delete stream;
+    
+    m_RelexedTokens = m_Tokens.size();
+    
+    // Start a new parser
+    m_Snapshots.clear();
+    m_SnapshotTokens.clear();
+    delete m_State;
+    
+    m_State = m_Language.get_parser().create_push_parser(new ast_parser_actions(NULL), m_InitialState);
+    m_Snapshots.push_back(m_State->get_stack());
+    m_SnapshotTokens.push_back(0);
+    
+    return reparse_from(0);
+}
+
+/// \brief Replaces length symbols at the specified offset with new text and reparses
+bool incremental_parser::edit(size_t start, size_t length, const int* begin, const int* end) {
+    // The new text is the whole text if nothing has been parsed yet
+    if (!m_State) {
+        return parse(begin, end);
+    }
+    
+    // Clip the edit to the text
+    if (start > m_Text.size())          start   = m_Text.size();
+    if (start + length > m_Text.size()) length  = m_Text.size() - start;
+    
+    // Find the first token that ends at or after the start of the edit. The token before it is also lexed again, in
+    // case the edit extends it
+    size_t firstChanged = 0;
+    size_t lastToken    = m_Tokens.size();
+    
+    while (firstChanged < lastToken) {
+        size_t              middle  = (firstChanged + lastToken) / 2;
+        const lexeme_container& lex = m_Tokens[middle];
+        
+        if ((size_t) lex->pos().offset() + lex->length() < start) {
+            firstChanged = middle + 1;
+        } else {
+            lastToken = middle;
+        }
+    }
+    
+    if (firstChanged > 0) --firstChanged;
+    
+    // Work out where to start lexing
+    position    startPos;
+    if (firstChanged < m_Tokens.size()) {
+        startPos = m_Tokens[firstChanged]->pos();
+    } else if (!m_Tokens.empty()) {
+        startPos = m_Tokens.back()->final_pos();
+    }
+    
+    // Apply the edit to the text
+    long        delta   = (long) (end - begin) - (long) length;
+    size_t      editEnd = start + (end - begin);
+    
+    m_Text.erase(m_Text.begin() + start, m_Text.begin() + start + length);
+    m_Text.insert(m_Text.begin() + start, begin, end);
+    
+    // Lex until a token starts at the same place as a token after the edit, with the lexer in the same state
+    token_list          newTokens;
+    checkpoint_list     newCheckpoints;
+    size_t              oldToken    = firstChanged;
+    bool                synced      = false;
+    position            syncPos;
+    const int*          text        = m_Text.empty() ? NULL : &m_Text[0];
+    const basic_lexer&  lexer       = m_Language.get_lexer();
+    
+    // Restart from the checkpoint for the first changed token if the lexer supports it (otherwise lex from the start of
+    // the token, and work out the positions relative to it)
+    lexeme_stream*  stream      = NULL;
+    bool            relative    = false;
+    
+    if (firstChanged < m_Tokens.size()) {
+        stream = lexer.create_stream_from_checkpoint(text, text + m_Text.size(), m_Checkpoints[firstChanged]);
+    }
+    if (!stream) {
+        stream      = lexer.create_stream_from_symbols(text + startPos.offset(), text + m_Text.size());
+        relative    = true;
+    }
+    
+    for (;;) {
+        lexer_checkpoint    before;
+        bool                hasCheckpoint   = stream->checkpoint(before);
+        lexeme*             next            = NULL;
+        
+        (*stream) >> next;
+        if (!next) break;
+        
+        position pos = relative ? absolute_position(next->pos(), startPos) : next->pos();
+        if (!hasCheckpoint || relative) before = lexer_checkpoint(pos, before.initial_state(), before.seen_return(), before.mode());
+        
+        if ((size_t) pos.offset() >= editEnd) {
+            // Look for an old token that starts in the same place
+            stream_offset oldOffset = pos.offset() - delta;
+            while (oldToken < m_Tokens.size() && m_Tokens[oldToken]->pos().offset() < oldOffset) {
+                ++oldToken;
+            }
+            
+            if (oldToken < m_Tokens.size() && m_Tokens[oldToken]->pos().offset() == oldOffset && (!hasCheckpoint || m_Checkpoints[oldToken].same_state(before))) {
+                synced  = true;
+                syncPos = pos;
+                delete next;
+                break;
+            }
+        }
+        
+        newTokens.push_back(lexeme_container(new lexeme(next->content(), pos, next->matched()), true));
+        newCheckpoints.push_back(before);
+        delete next;
+    }
+    delete stream;
+    
+    m_RelexedTokens = newTokens.size();
+    
+    // Move the tokens after the point where the lexer caught up
+    if (synced) {
+        const position oldSync = m_Tokens[oldToken]->pos();
+        
+        for (size_t tokenId = oldToken; tokenId < m_Tokens.size(); ++tokenId) {
+            const lexeme_container& moved   = m_Tokens[tokenId];
+            const position&         oldPos  = moved->pos();
+            
+            // Columns only change for tokens on the same line as the end of the edit
+            stream_offset column = oldPos.line() == oldSync.line() ? oldPos.column() + syncPos.column() - oldSync.column() : oldPos.column();
+            position newPos(oldPos.offset() + delta, oldPos.line() + syncPos.line() - oldSync.line(), column);
+            
+            newTokens.push_back(lexeme_container(new lexeme(moved->content(), newPos, moved->matched()), true));
+            newCheckpoints.push_back(lexer_checkpoint(newPos, m_Checkpoints[tokenId].initial_state(), m_Checkpoints[tokenId].seen_return(), m_Checkpoints[tokenId].mode()));
+        }
+    }
+    
+    m_Tokens.erase(m_Tokens.begin() + firstChanged, m_Tokens.end());
+    m_Tokens.insert(m_Tokens.end(), newTokens.begin(), newTokens.end());
+    m_Checkpoints.erase(m_Checkpoints.begin() + firstChanged, m_Checkpoints.end());
+    m_Checkpoints.insert(m_Checkpoints.end(), newCheckpoints.begin(), newCheckpoints.end());
+    
+    // Parse from the first changed token
+    return reparse_from(firstChanged);
+}
+
+/// \brief Runs the parser over the tokens, starting from the last stack recorded at or before the specified token
+bool incremental_parser::reparse_from(size_t firstChanged) {
+    // Throw away the stacks that depend on changed tokens (the stack for the first token is always kept)
+    while (m_SnapshotTokens.back() > firstChanged) {
+        m_Snapshots.pop_back();
+        m_SnapshotTokens.pop_back();
+    }
+    
+    size_t resume = m_SnapshotTokens.back();
+    m_State->rewind(m_Snapshots.back(), (int) resume);
+    
+    // Push the remaining tokens into the parser
+    m_Accepted          = false;
+    m_ReparsedTokens    = 0;
+    
+    for (size_t tokenId = resume; tokenId < m_Tokens.size(); ++tokenId) {
+        m_State->push(m_Tokens[tokenId]);
+        ++m_ReparsedTokens;
+        
+        if (m_State->parse_available() == parser_result::reject) {
+            return false;
+        }
+        
+        // Record the stack once the parser has used all of the tokens so far (so the stack doesn't depend on any
+        // of the tokens that follow)
+        if ((size_t) m_State->input_position() == tokenId + 1) {
+            m_Snapshots.push_back(m_State->get_stack());
+            m_SnapshotTokens.push_back(tokenId + 1);
+        }
+    }
+    
+    m_State->end_of_input();
+    m_Accepted = m_State->parse_available() == parser_result::accept;
+    
+    return m_Accepted;
+}
@@ -0,0 +1,135 @@
+//
+//  incremental_parser.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _LR_INCREMENTAL_PARSER_H
+#define _LR_INCREMENTAL_PARSER_H
+
+#include <vector>
+
+#include "TameParse/Util/astnode.h"
+#include "TameParse/Dfa/lexeme.h"
+#include "TameParse/Dfa/basic_lexer.h"
+#include "TameParse/Lr/ast_parser.h"
+#include "TameParse/Lr/compiled_language.h"
+
+namespace lr {
+    ///
+    /// \brief Parser that keeps the tokens and parser states for a piece of text so it can be reparsed after editing
+    ///
+    /// After an edit, only the tokens around the edited range are lexed again: lexing restarts from the lexer checkpoint
+    /// for the token before the edit, and stops as soon as a token starts at the same place and in the same lexer state
+    /// as an unchanged token after the edit. The remaining tokens are reused. The parser
+    /// records its stack each time it has consumed all of the tokens so far, and after an edit it resumes from the
+    /// last stack recorded before the first changed token. The subtrees for everything before that point are
+    /// reused as-is, and only the rest of the input is parsed again.
+    ///
+    /// The recorded stacks share their entries with each other, so each one only costs a reference.
+    ///
+    class incremental_parser {
+    public:
+        /// \brief List of tokens
+        typedef std::vector<dfa::lexeme_container> token_list;
+        
+        /// \brief List of lexer checkpoints
+        typedef std::vector<dfa::lexer_checkpoint> checkpoint_list;
+        
+    private:
+        /// \brief The language being parsed
+        const compiled_language& m_Language;
+        
+        /// \brief The initial parser state
+        int m_InitialState;
+        
+        /// \brief The text that is being parsed
+        std::vector<int> m_Text;
+        
+        /// \brief The tokens for the text
+        token_list m_Tokens;
+        
+        /// \brief The state of the lexer before each token
+        checkpoint_list m_Checkpoints;
+        
+        /// \brief The push parser state for the text (NULL until parse() is called)
+        ast_parser::state* m_State;
+        
+        /// \brief Stacks recorded from the parser
+        std::vector<ast_parser::stack> m_Snapshots;
+        
+        /// \brief The number of tokens that had been consumed when each of the stacks in m_Snapshots was recorded
+        std::vector<size_t> m_SnapshotTokens;
+        
+        /// \brief True if the text was accepted by the parser
+        bool m_Accepted;
+        
+        /// \brief The number of tokens produced by the lexer during the last call to parse() or edit()
+        size_t m_RelexedTokens;
+        
+        /// \brief The number of tokens passed to the parser during the last call to parse() or edit()
+        size_t m_ReparsedTokens;
+        
+        incremental_parser(const incremental_parser& copyFrom);
+        incremental_parser& operator=(const incremental_parser& copyFrom);
+        
+    private:
+        /// \brief Runs the parser over the tokens, starting from the last stack recorded at or before the specified token
+        bool reparse_from(size_t firstChanged);
+        
+    public:
+        /// \brief Creates an incremental parser for the specified language, which must outlive it
+        explicit incremental_parser(const compiled_language& language, int initialState = 0);
+        
+        /// \brief Destructor
+        ~incremental_parser();
+        
+        /// \brief Parses a new piece of text from scratch, returning true if it was accepted
+        bool parse(const int* begin, const int* end);
+        
+        /// \brief Replaces length symbols at the specified offset with new text and reparses, returning true if the
+        /// result was accepted
+        ///
+        /// If parse() hasn't been called yet, the new text is parsed on its own.
+        bool edit(size_t start, size_t length, const int* begin, const int* end);
+        
+        /// \brief True if the text was accepted by the parser
+        inline bool accepted() const { return m_Accepted; }
+        
+        /// \brief The AST for the text, or NULL if it was not accepted
+        util::astnode_container ast() const;
+        
+        /// \brief The text that is being parsed
+        inline const std::vector<int>& text() const { return m_Text; }
+        
+        /// \brief The tokens for the text
+        inline const token_list& tokens() const { return m_Tokens; }
+        
+        /// \brief The number of tokens produced by the lexer during the last call to parse() or edit()
+        inline size_t relexed_tokens() const { return m_RelexedTokens; }
+        
+        /// \brief The number of tokens passed to the parser during the last call to parse() or edit()
+        inline size_t reparsed_tokens() const { return m_ReparsedTokens; }
+    };
+}
+
+#endif
@@ -34,10 +34,13 @@
 using namespace language;
 #endif
 
+#include <algorithm>
 #include <queue>
 #include <set>
 
 #include "TameParse/Lr/lalr_builder.h"
+#include "TameParse/Util/parallel.h"
+#include "TameParse/Util/stopwatch.h"
 
 using namespace std;
 using namespace contextfree;
@@ -47,7 +50,15 @@ using namespace lr;
 lalr_builder::lalr_builder(contextfree::grammar& gram, contextfree::terminal_dictionary& terminals)
 : m_Grammar(&gram)
 , m_Terminals(&terminals)
-, m_Machine(gram) {
+, m_Machine(gram)
+, m_LookaheadAlgorithm(lookahead_digraph)
+, m_ConstructionAlgorithm(construct_lalr)
+, m_KeepActions(true)
+, m_ScratchClosureState(-1)
+, m_HasSourceIndex(false)
+, m_ReusedStates(0)
+, m_StatesSeconds(0)
+, m_LookaheadSeconds(0) {
     
 }
 
@@ -95,6 +106,9 @@ void lalr_builder::create_closure(closure_set& target, const lalr_state& state,
     }
     
     // Iterate through the set of waiting items
+    // The items added by each item (reused so the set doesn't have to be created for each item)
+    lr1_item_set closureItems;
+    
     for (;!waiting.empty(); waiting.pop()) {
         const lr1_item_container& nextItem = waiting.front();
         
@@ -106,7 +120,7 @@ void lalr_builder::create_closure(closure_set& target, const lalr_state& state,
         if (offset >= (int) rule.items().size()) continue;
         
         // Get the items added by this entry. The items themselves describe how they affect a LR(0) closure
-        lr1_item_set closureItems;
+        closureItems.clear();
         rule.items()[offset]->cache_closure(*nextItem, closureItems, *gram);
         
         // Add any new items to the waiting queue
@@ -119,116 +133,566 @@ void lalr_builder::create_closure(closure_set& target, const lalr_state& state,
     }
 }
 
+/// \brief The kernels reached from a single state in the machine, together with the guards that the state can enter
+struct lalr_builder::state_expansion {
+    /// \brief The kernels reached by each transition out of the state
+    state_for_item newStates;
+    
+    /// \brief The guard items that the closure of the state is positioned before, in the order they were encountered
+    vector<item_container> guards;
+    
+    /// \brief The identifiers of the nonterminals that were expanded in the closure
+    set<int> nonterminals;
+};
+
+/// \brief Computes the closure of a state and the kernels that are reached from it
+///
+/// This only reads the state and the grammar, so the expansions for every state in a frontier can be computed
+/// before any of them are added to the machine.
+void lalr_builder::expand_state(state_expansion& target, const lalr_state& state, const grammar* gram) {
+    // Generate the closure for this state
+    closure_set closure;
+    create_closure(closure, state, gram);
+    
+    // Work out the transitions by inspecting each item in the closure (ie, generate the kernels reached from this state)
+    for (closure_set::const_iterator item = closure.begin(); item != closure.end(); ++item) {
+        // Take the item apart
+        const rule& rule    = *(*item)->rule();
+        int         offset  = (*item)->offset();
+        
+        // Items at the end of a rule don't produce any transitions
+        if (offset == (int) rule.items().size()) continue;
+        
+        // Get the item that the 'dot' is before
+        const item_container& dottedItem = rule.items()[offset];
+        
+        // Remember which nonterminals the closure depends on
+        if (dottedItem->type() == item::nonterminal) {
+            target.nonterminals.insert(dottedItem->symbol());
+        }
+        
+        // Don't produce a transition for this item if it doesn't specify that one should be produced
+        if (!dottedItem->generate_transition()) continue;
+        
+        // Other items produce a transition on the item that's being pointed at
+        // Ie, if we have an item A -> b * c d, we add a transition on 'c' to a new item A -> b c * d 
+        lr0_item                transitItem(**item, offset+1);
+        lr0_item_container      transitItemContainer(transitItem);
+        
+        // Guard items produce a guard rule initial state, which is created when the expansion is added to the machine
+        if (dottedItem->type() == item::guard) {
+            target.guards.push_back(dottedItem);
+        }
+        
+        // Add this transition for the appropriate item
+        lalr_state_container& lalrState = target.newStates[dottedItem];
+        lalrState->add(transitItemContainer, gram);
+    }
+}
+
 /// \brief Finishes building the parser (the LALR machine will contain a LALR parser after this call completes)
-void lalr_builder::complete_parser() {
-    empty_item      empty;
+void lalr_builder::complete_parser(unsigned int maxThreads) {
+    util::stopwatch statesTimer;
+    
+    // Number the rules and items in a fixed order, so the tables are the same for any number of threads
+    fill_grammar_caches();
+    
+    // Use Pager's algorithm if a more powerful parser was requested
+    if (m_ConstructionAlgorithm == construct_minimal_lr1) {
+        complete_minimal_lr1();
+        m_StatesSeconds     = statesTimer.seconds();
+        m_LookaheadSeconds  = 0;
+        return;
+    }
+    
+    // Build the states from scratch
+    complete_states(NULL, maxThreads);
+    m_StatesSeconds = statesTimer.seconds();
+    
+    // Need the lookaheads to build a complete parser
+    util::stopwatch lookaheadTimer;
+    complete_lookaheads();
+    m_LookaheadSeconds = lookaheadTimer.seconds();
+}
+
+/// \brief Finishes building the parser, reusing the states of a builder for an earlier version of the grammar
+void lalr_builder::complete_parser(const lalr_builder& previous, unsigned int maxThreads) {
+    util::stopwatch statesTimer;
+    
+    // Number the rules and items in a fixed order, so the tables are the same for any number of threads
+    fill_grammar_caches();
+    
+    // Pager's algorithm merges states according to their lookaheads, so its states can't be reused this way
+    if (m_ConstructionAlgorithm == construct_minimal_lr1) {
+        complete_minimal_lr1();
+        m_StatesSeconds     = statesTimer.seconds();
+        m_LookaheadSeconds  = 0;
+        return;
+    }
+    
+    // Build the states, copying the ones that haven't changed
+    complete_states(&previous, maxThreads);
+    m_StatesSeconds = statesTimer.seconds();
+    
+    // Need the lookaheads to build a complete parser
+    util::stopwatch lookaheadTimer;
+    complete_lookaheads();
+    m_LookaheadSeconds = lookaheadTimer.seconds();
+}
 
-    // Queue of states that still need to be processed
-    queue<int> waitingStates;
+/// \brief Returns true if the specified nonterminal has the same rules in the grammar for this builder and another
+bool lalr_builder::same_rules(const lalr_builder& previous, int nonterminalId) const {
+    // Use the const versions of the grammars so that looking up a nonterminal doesn't define it
+    const grammar&   ourGrammar     = *m_Grammar;
+    const grammar&   theirGrammar   = *previous.m_Grammar;
+    const rule_list& ourRules       = ourGrammar.rules_for_nonterminal(nonterminalId);
+    const rule_list& theirRules     = theirGrammar.rules_for_nonterminal(nonterminalId);
+    
+    if (ourRules.size() != theirRules.size()) return false;
     
-    // Begin by filling the queue of states with all the states that are defined
+    for (size_t ruleNum = 0; ruleNum < ourRules.size(); ++ruleNum) {
+        if (!(*ourRules[ruleNum] == *theirRules[ruleNum])) return false;
+    }
+    
+    return true;
+}
+
+/// \brief A kernel described by its rules and offsets, which can be compared between different grammars
+///
+/// Rules are compared by their content, but LR(0) items are ordered by their identifier in a particular grammar,
+/// so the kernels in two different builders have to be compared this way.
+typedef vector<pair<rule_container, int> > kernel_signature;
+
+/// \brief Creates the signature for a kernel
+static kernel_signature signature_for_state(const lalr_state& state) {
+    kernel_signature result;
+    
+    for (int itemId = 0; itemId < state.count_items(); ++itemId) {
+        result.push_back(make_pair(state[itemId]->rule(), state[itemId]->offset()));
+    }
+    
+    sort(result.begin(), result.end());
+    return result;
+}
+
+namespace lr {
+    /// \brief Expands the states in a frontier that weren't reused from a previous machine on separate threads
+    class expand_frontier_states {
+    private:
+        /// \brief The builder that the states belong to
+        const lalr_builder& m_Builder;
+        
+        /// \brief The states in the frontier
+        const vector<int>& m_Frontier;
+        
+        /// \brief The indexes of the states in the frontier that should be expanded
+        const vector<size_t>& m_ToExpand;
+        
+        /// \brief The expansion for each state in the frontier
+        vector<lalr_builder::state_expansion>& m_Expansions;
+        
+    public:
+        expand_frontier_states(const lalr_builder& builder, const vector<int>& frontier, const vector<size_t>& toExpand, vector<lalr_builder::state_expansion>& expansions)
+        : m_Builder(builder)
+        , m_Frontier(frontier)
+        , m_ToExpand(toExpand)
+        , m_Expansions(expansions) {
+        }
+        
+        /// \brief Expands the state with the specified index in the list to expand
+        void operator()(size_t index) {
+            size_t stateNum = m_ToExpand[index];
+            
+            lalr_builder::expand_state(m_Expansions[stateNum], *m_Builder.m_Machine.state_with_id(m_Frontier[stateNum]), m_Builder.m_Grammar);
+        }
+    };
+}
+
+/// \brief Builds the states for the machine, reusing states from the specified builder if it is not NULL
+///
+/// States are processed a frontier at a time: the closures and kernels for every state in the frontier are
+/// computed first, and the results are then added to the machine in the order that the states were discovered.
+/// The states are numbered in the same order as a breadth-first traversal of the machine.
+///
+/// A reused state is expanded using the transitions of the matching state in the previous machine. As these lead
+/// to the same kernels that expand_state() would have produced, the states are discovered in the same order and
+/// the machine is numbered identically to a full build.
+///
+/// complete_parser() fills in the grammar caches first, so the states in each frontier that aren't reused can be
+/// expanded at the same time. Every state that can be reached from the initial states only uses rules that can be
+/// reached from their kernels, so the caches only need to be filled in once.
+void lalr_builder::complete_states(const lalr_builder* previous, unsigned int maxThreads) {
+    // The states that still need to be processed
+    vector<int> frontier;
+    
+    // Begin by filling the frontier with all the states that are defined
     for (int x=0; x<m_Machine.count_states(); ++x) {
-        waitingStates.push(x);
+        frontier.push_back(x);
     }
     
     // Keep track of the highest state we've encountered (so we can establish when a state creates a new entry in the LALR machine)
     int maxState = m_Machine.count_states();
     
+    // Index the kernels of the states in the previous machine that know what their closures depend on
+    map<kernel_signature, int>  previousStates;
+    map<int, bool>              unchanged;
+    
+    if (previous) {
+        for (int stateId = 0; stateId < (int) previous->m_Dependencies.size(); ++stateId) {
+            previousStates[signature_for_state(*previous->m_Machine.state_with_id(stateId))] = stateId;
+        }
+    }
+    
+    m_Dependencies.clear();
+    m_ReusedStates = 0;
+    
     // Iterate until there are no new states
-    while (!waitingStates.empty()) {
-        // Fetch the next state to process, and remove the last state from the queue
-        int                 nextStateId = waitingStates.front();
-        const lalr_state&   nextState   = *m_Machine.state_with_id(nextStateId);
-        waitingStates.pop();
+    vector<state_expansion> expansions;
+    vector<size_t>          toExpand;
+    vector<int>             nextFrontier;
+    
+    while (!frontier.empty()) {
+        // Generate the closures and kernels for the states in the frontier
+        expansions.clear();
+        expansions.resize(frontier.size());
+        toExpand.clear();
+        
+        for (size_t stateNum = 0; stateNum < frontier.size(); ++stateNum) {
+            const lalr_state&   state       = *m_Machine.state_with_id(frontier[stateNum]);
+            state_expansion&    expansion   = expansions[stateNum];
+            
+            // See if there's an equivalent state in the previous machine
+            int previousId = -1;
+            
+            if (!previousStates.empty()) {
+                map<kernel_signature, int>::const_iterator found = previousStates.find(signature_for_state(state));
+                
+                if (found != previousStates.end()) {
+                    // The state can only be reused if none of the nonterminals in its closure have changed
+                    previousId = found->second;
+                    
+                    const set<int>& nonterminals = previous->m_Dependencies[previousId].nonterminals;
+                    for (set<int>::const_iterator nonterminalId = nonterminals.begin(); nonterminalId != nonterminals.end(); ++nonterminalId) {
+                        map<int, bool>::iterator isUnchanged = unchanged.find(*nonterminalId);
+                        if (isUnchanged == unchanged.end()) {
+                            isUnchanged = unchanged.insert(make_pair(*nonterminalId, same_rules(*previous, *nonterminalId))).first;
+                        }
+                        
+                        if (!isUnchanged->second) {
+                            previousId = -1;
+                            break;
+                        }
+                    }
+                }
+            }
+            
+            if (previousId < 0) {
+                // Generate the closure for this state once the states to reuse have been copied
+                toExpand.push_back(stateNum);
+                continue;
+            }
+            
+            // Copy the kernels reached from the previous state, moving their items over to this grammar
+            const closure_dependencies&         dependencies    = previous->m_Dependencies[previousId];
+            const lalr_machine::transition_set& transitions     = previous->m_Machine.transitions_for_state(previousId);
+            
+            for (lalr_machine::transition_set::const_iterator transit = transitions.begin(); transit != transitions.end(); ++transit) {
+                const lalr_state&       previousTarget  = *previous->m_Machine.state_with_id(transit->second);
+                lalr_state_container&   lalrState       = expansion.newStates[transit->first];
+                
+                for (int itemId = 0; itemId < previousTarget.count_items(); ++itemId) {
+                    lr0_item_container newItem(new lr0_item(m_Grammar, previousTarget[itemId]->rule(), previousTarget[itemId]->offset()), true);
+                    lalrState->add(newItem, m_Grammar);
+                }
+            }
+            
+            expansion.guards        = dependencies.guards;
+            expansion.nonterminals  = dependencies.nonterminals;
+            ++m_ReusedStates;
+        }
+        
+        // Generate the closures and kernels for the remaining states
+        expand_frontier_states task(*this, frontier, toExpand, expansions);
+        util::parallel_for(toExpand.size(), maxThreads, task);
+        
+        // Add the new states (and transitions) to the machine
+        nextFrontier.clear();
+        
+        for (size_t stateNum = 0; stateNum < frontier.size(); ++stateNum) {
+            int                 nextStateId = frontier[stateNum];
+            state_expansion&    expansion   = expansions[stateNum];
+            
+            // Remember what the closure of this state depended on, so later builds can reuse it
+            if ((int) m_Dependencies.size() <= nextStateId) {
+                m_Dependencies.resize(nextStateId+1);
+            }
+            
+            m_Dependencies[nextStateId].nonterminals.swap(expansion.nonterminals);
+            m_Dependencies[nextStateId].guards = expansion.guards;
+            
+            // Guard items produce a guard rule initial state, if there isn't one already
+            for (vector<item_container>::const_iterator guardItem = expansion.guards.begin(); guardItem != expansion.guards.end(); ++guardItem) {
+                int guardStateId = add_guard_state(*guardItem);
+                if (guardStateId < 0) continue;
+                
+                // Add this as a state to be processed
+                nextFrontier.push_back(guardStateId);
+                if (guardStateId >= maxState) {
+                    maxState = guardStateId+1;
+                }
+            }
+            
+            for (state_for_item::iterator nextState = expansion.newStates.begin(); nextState != expansion.newStates.end(); ++nextState) {
+                // Add the state that was generated for this item
+                int targetState = m_Machine.add_state(nextState->second);
+                
+                // Add a transition for this item
+                m_Machine.add_transition(nextStateId, nextState->first, targetState);
+                
+                // If this is a new state then add it to the list that need processing
+                if (targetState >= maxState) {
+                    maxState = targetState+1;
+                    nextFrontier.push_back(targetState);
+                }
+            }
+        }
+        
+        // Move on to the states discovered in this pass
+        frontier.swap(nextFrontier);
+    }
+}
+
+/// \brief Adds the initial state for a guard item, returning its identifier, or -1 if the state already exists
+int lalr_builder::add_guard_state(const item_container& guardItem) {
+    // Get the underlying guard object
+    const guard* thisGuard = guardItem->cast_guard();
+    if (thisGuard == NULL) return -1;
+    
+    // Get the rule ID
+    int ruleId = thisGuard->get_rule()->identifier(*m_Grammar);
+    
+    // Nothing to do if there's already a state defined for this rule
+    if (m_StatesForGuard.find(ruleId) != m_StatesForGuard.end()) return -1;
+    
+    // Create a state for this rule
+    lalr_state*         guardState = new lalr_state();
+    lr0_item_container  guardItemContainer(new lr0_item(m_Grammar, thisGuard->get_rule(), 0), true);
+    
+    int guardItemId = guardState->add(guardItemContainer, m_Grammar);
+    
+    // Set the lookahead to be '%' (the end of guard symbol)
+    end_of_guard eog;
+    guardState->lookahead_for(guardItemId).insert(eog);
+    
+    // Add the state
+    lalr_state_container guardStateContainer(guardState, true);
+    int guardStateId = m_Machine.add_state(guardStateContainer);
+    
+    // Store as a known state
+    m_StatesForGuard[ruleId] = guardStateId;
+    
+    return guardStateId;
+}
 
-        // Generate the closure for this state
-        closure_set closure;
-        create_closure(closure, nextState, m_Grammar);
+/// \brief Returns true if two lookahead sets have any items in common
+static bool intersects(const item_set& first, const item_set& second) {
+    const item_set& smaller = first.size() < second.size() ? first : second;
+    const item_set& larger  = first.size() < second.size() ? second : first;
+    
+    for (item_set::const_iterator lookaheadItem = smaller.begin(); lookaheadItem != smaller.end(); ++lookaheadItem) {
+        if (larger.contains(*lookaheadItem)) return true;
+    }
+    
+    return false;
+}
 
-        // Work out the transitions by inspecting each item in the closure (ie, generate the kernels reached from this state)
+/// \brief True if the lookaheads of newState can be merged into existingState without introducing a new conflict
+///
+/// This is Pager's weak compatibility test. Merging can only produce a conflict between two items if a lookahead
+/// of one of them in one state is a lookahead of the other in the other state. This is only a new conflict if the
+/// two items don't already share a lookahead in either of the states.
+bool lalr_builder::weakly_compatible(const lalr_state& existingState, const lalr_state& newState) {
+    const int numItems = newState.count_items();
+    
+    // Find the lookaheads for each item in the existing state (the states have the same kernel, but the items may be in a different order)
+    vector<const item_set*> existing(numItems, (const item_set*) NULL);
+    
+    for (int itemId = 0; itemId < numItems; ++itemId) {
+        existing[itemId] = existingState.lookahead_for(newState[itemId]);
+        if (!existing[itemId]) return false;
+    }
+    
+    for (int first = 0; first < numItems; ++first) {
+        const item_set& newFirst        = newState.lookahead_for(first);
+        const item_set& existingFirst   = *existing[first];
+        
+        for (int second = first+1; second < numItems; ++second) {
+            const item_set& newSecond       = newState.lookahead_for(second);
+            const item_set& existingSecond  = *existing[second];
+            
+            // Nothing can conflict if the merged lookaheads are disjoint
+            if (!intersects(newFirst, existingSecond) && !intersects(existingFirst, newSecond)) continue;
+            
+            // Compatible if the items already overlap in one of the states
+            if (intersects(newFirst, newSecond) || intersects(existingFirst, existingSecond)) continue;
+            
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+/// \brief Builds the states for the machine using Pager's minimal LR(1) algorithm
+///
+/// States carry their LR(1) lookaheads while the machine is being built. A state reached by a transition is merged
+/// with an existing state with the same kernel if the two are weakly compatible, otherwise it is added as a new
+/// state. When merging adds new lookaheads to a state, its transitions are generated again so the lookaheads can
+/// reach its successors (possibly moving a transition to a different state). States that can no longer be reached
+/// are removed afterwards, and the lookaheads are generated again for the final machine by complete_lookaheads().
+void lalr_builder::complete_minimal_lr1() {
+    empty_item      empty;
+    item_container  empty_c(&empty, false);
+    
+    // The states that are waiting to be expanded (again)
+    queue<int>      waiting;
+    vector<bool>    isWaiting;
+    
+    for (int stateId = 0; stateId < m_Machine.count_states(); ++stateId) {
+        waiting.push(stateId);
+        isWaiting.push_back(true);
+    }
+    
+    // The states that everything else is reached from (initial states and guards)
+    lalr_machine::identifier_list roots;
+    for (int stateId = 0; stateId < m_Machine.count_states(); ++stateId) {
+        roots.push_back(stateId);
+    }
+    
+    while (!waiting.empty()) {
+        int stateId = waiting.front();
+        waiting.pop();
+        isWaiting[stateId] = false;
+        
+        // Generate the LR(1) closure for this state
+        lr1_item_set closure;
+        generate_closure(*m_Machine.state_with_id(stateId), closure, m_Grammar);
+        
+        // Work out the kernels (with lookaheads) reached by each transition
         state_for_item newStates;
         
-        for (closure_set::const_iterator item = closure.begin(); item != closure.end(); ++item) {
-            // Take the item apart
+        for (lr1_item_set::const_iterator item = closure.begin(); item != closure.end(); ++item) {
             const rule& rule    = *(*item)->rule();
             int         offset  = (*item)->offset();
             
-            // Items at the end of a rule don't produce any transitions
             if (offset == (int) rule.items().size()) continue;
             
-            // Get the item that the 'dot' is before
             const item_container& dottedItem = rule.items()[offset];
-            
-            // Don't produce a transition for this item if it doesn't specify that one should be produced
             if (!dottedItem->generate_transition()) continue;
             
-            // Other items produce a transition on the item that's being pointed at
-            // Ie, if we have an item A -> b * c d, we add a transition on 'c' to a new item A -> b c * d 
-            lr0_item                transitItem(**item, offset+1);
-            lr0_item_container      transitItemContainer(transitItem);
-            
-            // Guard items produce a guard rule initial state, if there isn't one already
+            // Guard items produce a guard rule initial state
             if (dottedItem->type() == item::guard) {
-                // Get the underlying guard object
-                const guard* thisGuard = dottedItem->cast_guard();
-                if (thisGuard != NULL) {
-                    // Get the rule ID
-                    int ruleId = thisGuard->get_rule()->identifier(*m_Grammar);
-                    
-                    // If there's no state defined for this rule, then define a new one
-                    if (m_StatesForGuard.find(ruleId) == m_StatesForGuard.end()) {
-                        // Create a state for this rule
-                        lalr_state*         guardState = new lalr_state();
-                        lr0_item_container  guardItem(new lr0_item(m_Grammar, thisGuard->get_rule(), 0), true);
-                        
-                        int guardItemId = guardState->add(guardItem, m_Grammar);
-                        
-                        // Set the lookahead to be '%' (the end of guard symbol)
-                        end_of_guard eog;
-                        guardState->lookahead_for(guardItemId).insert(eog);
-                        
-                        // Add the state
-                        lalr_state_container guardStateContainer(guardState, true);
-                        int guardStateId = m_Machine.add_state(guardStateContainer);
-                        
-                        // Add this as a state to be processed
-                        waitingStates.push(guardStateId);
-                        
-                        // Store as a known state
-                        m_StatesForGuard[ruleId] = guardStateId;
-                    }
+                int guardStateId = add_guard_state(dottedItem);
+                
+                if (guardStateId >= 0) {
+                    roots.push_back(guardStateId);
+                    waiting.push(guardStateId);
+                    isWaiting.push_back(true);
                 }
             }
             
-            // Add this transition for the appropriate item
-            lalr_state_container& lalrState = newStates[dottedItem];
-            lalrState->add(transitItemContainer, m_Grammar);
+            // Add the item to the kernel for this transition, along with its lookahead
+            lr0_item_container      transitItem(new lr0_item((*item)->get_lr0_item(), offset+1), true);
+            lalr_state_container&   lalrState   = newStates[dottedItem];
+            int                     transitId   = lalrState->add(transitItem, m_Grammar);
+            item_set&               lookahead   = lalrState->lookahead_for(transitId);
+            
+            lookahead.merge((*item)->lookahead());
+            lookahead.erase(empty_c);
         }
         
-        // Add the new states (and transitions) to the machine
+        // Add the transitions to the machine
         for (state_for_item::iterator nextState = newStates.begin(); nextState != newStates.end(); ++nextState) {
-            // Add the state that was generated for this item
-            int targetState = m_Machine.add_state(nextState->second);
+            const lalr_state& kernel = *nextState->second;
             
-            // Add a transition for this item
-            m_Machine.add_transition(nextStateId, nextState->first, targetState);
+            // Prefer the state that this transition already leads to, then any other compatible state
+            int targetState = -1;
             
-            // If this is a new state then add it to the list that need processing
-            if (targetState >= maxState) {
-                maxState = targetState+1;
-                waitingStates.push(targetState);
+            const lalr_machine::transition_set&             transitions = m_Machine.transitions_for_state(stateId);
+            lalr_machine::transition_set::const_iterator    existing    = transitions.find(nextState->first);
+            
+            if (existing != transitions.end() && weakly_compatible(*m_Machine.state_with_id(existing->second), kernel)) {
+                targetState = existing->second;
+            } else {
+                lalr_machine::identifier_list candidates;
+                m_Machine.find_states(kernel, candidates);
+                
+                for (lalr_machine::identifier_list::const_iterator candidate = candidates.begin(); candidate != candidates.end(); ++candidate) {
+                    if (weakly_compatible(*m_Machine.state_with_id(*candidate), kernel)) {
+                        targetState = *candidate;
+                        break;
+                    }
+                }
             }
+            
+            if (targetState < 0) {
+                // No compatible state: this is a new state, which will need to be expanded
+                targetState = m_Machine.add_split_state(nextState->second);
+                
+                waiting.push(targetState);
+                isWaiting.push_back(true);
+            } else {
+                // Merge the lookaheads into the existing state, and expand it again if they changed
+                const lalr_state_container& target  = m_Machine.state_with_id(targetState);
+                bool                        changed = false;
+                
+                for (int itemId = 0; itemId < kernel.count_items(); ++itemId) {
+                    if (m_Machine.add_lookahead(targetState, target->find_identifier(kernel[itemId]), kernel.lookahead_for(itemId))) {
+                        changed = true;
+                    }
+                }
+                
+                if (changed && !isWaiting[targetState]) {
+                    waiting.push(targetState);
+                    isWaiting[targetState] = true;
+                }
+            }
+            
+            m_Machine.add_transition(stateId, nextState->first, targetState);
+        }
+    }
+    
+    // Moving transitions can leave states behind that are no longer used
+    vector<int> newIds;
+    m_Machine.remove_unreachable(roots, newIds);
+    
+    for (map<int, int>::iterator guardState = m_StatesForGuard.begin(); guardState != m_StatesForGuard.end(); ++guardState) {
+        guardState->second = newIds[guardState->second];
+    }
+    
+    // Abandoned paths may have left extra lookaheads in the states that remain: generate them again from the
+    // lookaheads of the initial states
+    set<int> rootStates;
+    for (lalr_machine::identifier_list::const_iterator root = roots.begin(); root != roots.end(); ++root) {
+        rootStates.insert(newIds[*root]);
+    }
+    
+    for (int stateId = 0; stateId < m_Machine.count_states(); ++stateId) {
+        if (rootStates.find(stateId) == rootStates.end()) {
+            m_Machine.clear_lookaheads(stateId);
         }
     }
     
-    // Need the lookaheads to build a complete parser
     complete_lookaheads();
 }
- 
+
 /// \brief Generates the lookaheads for the parser (when the machine has been built up as a LR(0) grammar)
 void lalr_builder::complete_lookaheads() {
     empty_item      empty;
     item_container  empty_c(&empty, false);
+    
+    // Any cached closures or actions are invalidated by changing the lookaheads
+    clear_caches();
 
     // Now we know all of the states, we need to generate the spontaneous items and work out how items propagate
     // We build closures for the items all over again here, which seems wasteful given than we have to do it
@@ -329,6 +793,16 @@ void lalr_builder::complete_lookaheads() {
         }
     }
 
+    // Propagate the spontaneous lookaheads to their final destinations
+    if (m_LookaheadAlgorithm == lookahead_propagate) {
+        propagate_lookaheads();
+    } else {
+        digraph_lookaheads();
+    }
+}
+
+/// \brief Propagates lookaheads along m_Propagate until no lookahead set changes
+void lalr_builder::propagate_lookaheads() {
     // Create set of items to do propagation from (we use a set rather than a queue so we don't re-add states multiple times)
     set<lr_item_id> toPropagate;
     
@@ -364,15 +838,159 @@ void lalr_builder::complete_lookaheads() {
     }
 }
 
+/// \brief Propagates lookaheads along m_Propagate using the DeRemer-Pennello digraph algorithm
+///
+/// The lookahead for an item is its spontaneous lookahead combined with the lookahead of every item that propagates
+/// to it. Items are visited depth-first along the reversed propagation relation: when a strongly connected component
+/// is completed, every item in it receives the same lookahead set. Each lookahead set is merged into its successors
+/// exactly once, rather than every time it changes.
+void lalr_builder::digraph_lookaheads() {
+    // Assign a node number to every item in the machine
+    vector<int> firstNode;
+    int         numNodes = 0;
+    
+    for (int stateId = 0; stateId < m_Machine.count_states(); ++stateId) {
+        firstNode.push_back(numNodes);
+        numNodes += m_Machine.state_with_id(stateId)->count_items();
+    }
+    
+    vector<lr_item_id> itemForNode;
+    itemForNode.reserve(numNodes);
+    for (int stateId = 0; stateId < m_Machine.count_states(); ++stateId) {
+        for (int itemId = 0; itemId < m_Machine.state_with_id(stateId)->count_items(); ++itemId) {
+            itemForNode.push_back(lr_item_id(stateId, itemId));
+        }
+    }
+    
+    // Build the relation: an item includes the lookahead of every item that propagates to it
+    vector<vector<int> > includes(numNodes);
+    
+    for (propagation::const_iterator source = m_Propagate.begin(); source != m_Propagate.end(); ++source) {
+        int sourceNode = firstNode[source->first.state_id] + source->first.item_id;
+        
+        for (set<lr_item_id>::const_iterator target = source->second.begin(); target != source->second.end(); ++target) {
+            int targetNode = firstNode[target->state_id] + target->item_id;
+            
+            // Items that propagate to themselves add nothing
+            if (targetNode != sourceNode) {
+                includes[targetNode].push_back(sourceNode);
+            }
+        }
+    }
+    
+    // The traversal uses an explicit call stack, as the propagation chains can be very long for large grammars
+    const int               complete    = numNodes + 1;
+    vector<int>             lowLink(numNodes, 0);
+    vector<int>             depth(numNodes, 0);
+    vector<int>             sccStack;
+    vector<pair<int, int> > callStack;
+    
+    for (int startNode = 0; startNode < numNodes; ++startNode) {
+        // Skip items that have already been visited, or that don't include anything
+        if (lowLink[startNode] != 0 || includes[startNode].empty()) continue;
+        
+        // Visit the first item
+        sccStack.push_back(startNode);
+        lowLink[startNode] = depth[startNode] = (int) sccStack.size();
+        callStack.push_back(pair<int, int>(startNode, 0));
+        
+        while (!callStack.empty()) {
+            int                 node    = callStack.back().first;
+            const lr_item_id&   nodeId  = itemForNode[node];
+            
+            if (callStack.back().second < (int) includes[node].size()) {
+                // Move on to the next item included by this one
+                int nextNode = includes[node][callStack.back().second++];
+                
+                if (lowLink[nextNode] == 0) {
+                    // Not visited yet: visit it before merging its lookahead
+                    sccStack.push_back(nextNode);
+                    lowLink[nextNode] = depth[nextNode] = (int) sccStack.size();
+                    callStack.push_back(pair<int, int>(nextNode, 0));
+                    continue;
+                }
+                
+                // Merge the lookahead of an item that has already been visited
+                const lr_item_id& nextId = itemForNode[nextNode];
+                if (lowLink[nextNode] < lowLink[node]) lowLink[node] = lowLink[nextNode];
+                m_Machine.add_lookahead(nodeId.state_id, nodeId.item_id, m_Machine.state_with_id(nextId.state_id)->lookahead_for(nextId.item_id));
+                continue;
+            }
+            
+            // All of the included items have been visited
+            if (lowLink[node] == depth[node]) {
+                // This is the root of a strongly connected component: every item in it has the same lookahead
+                const item_set& rootLookahead = m_Machine.state_with_id(nodeId.state_id)->lookahead_for(nodeId.item_id);
+                
+                for (;;) {
+                    int member = sccStack.back();
+                    sccStack.pop_back();
+                    lowLink[member] = complete;
+                    
+                    if (member == node) break;
+                    
+                    const lr_item_id& memberId = itemForNode[member];
+                    m_Machine.add_lookahead(memberId.state_id, memberId.item_id, rootLookahead);
+                }
+            }
+            
+            // Return to the item that included this one, and merge the lookahead into it
+            callStack.pop_back();
+            
+            if (!callStack.empty()) {
+                int                 parent      = callStack.back().first;
+                const lr_item_id&   parentId    = itemForNode[parent];
+                
+                if (lowLink[node] < lowLink[parent]) lowLink[parent] = lowLink[node];
+                m_Machine.add_lookahead(parentId.state_id, parentId.item_id, m_Machine.state_with_id(nodeId.state_id)->lookahead_for(nodeId.item_id));
+            }
+        }
+    }
+}
+
 
 /// \brief Adds a new action rewriter to this builder
 void lalr_builder::add_rewriter(const action_rewriter_container& rewriter) {
     m_ActionRewriters.push_back(rewriter);
+    m_RewriterSeconds.push_back(0);
+    m_ActionsForState.clear();
+    m_CompactActionsForState.clear();
 }
 
 /// \brief Replaces the rewriters that this builder will use
 void lalr_builder::set_rewriters(const action_rewriter_list& list) {
     m_ActionRewriters = list;
+    m_RewriterSeconds.assign(list.size(), 0);
+    m_ActionsForState.clear();
+    m_CompactActionsForState.clear();
+}
+
+/// \brief Discards the cached closures and actions for every state
+void lalr_builder::clear_caches() {
+    m_ActionsForState.clear();
+    m_CompactActionsForState.clear();
+    
+    m_ScratchClosure.clear();
+    m_ScratchClosureState = -1;
+    
+    m_PropagatedFrom.clear();
+    m_SpontaneousFrom.clear();
+    m_LookaheadSources.clear();
+    m_HasSourceIndex = false;
+}
+
+/// \brief Returns the LR(1) closure of the state with the specified identifier
+const lr1_item_set& lalr_builder::closure_for_state(int state) const {
+    // Reuse the scratch buffer if it already holds the closure for this state
+    if (m_ScratchClosureState == state) return m_ScratchClosure;
+    
+    // Expand the kernel of the state into the scratch buffer
+    m_ScratchClosure.clear();
+    m_ScratchClosureState = -1;
+    generate_closure(*m_Machine.state_with_id(state), m_ScratchClosure, m_Grammar);
+    m_ScratchClosureState = state;
+    
+    return m_ScratchClosure;
 }
 
 
@@ -395,6 +1013,9 @@ void lalr_builder::generate_closure(const lalr_state& state, lr1_item_set& closu
     }
     
     // Add the closure of the items that are waiting
+    // The items added by each item (reused so the set doesn't have to be created for each item)
+    lr1_item_set closureItems;
+    
     for (;!waitingForClosure.empty(); waitingForClosure.pop()) {
         // Get the next item for adding to the closure
         lr1_item_container& nextItem = waitingForClosure.front();
@@ -407,7 +1028,7 @@ void lalr_builder::generate_closure(const lalr_state& state, lr1_item_set& closu
         if (offset >= (int) rule.items().size()) continue;
         
         // Get the items added by this entry. The items themselves describe how they affect a LR(0) closure
-        lr1_item_set closureItems;
+        closureItems.clear();
         rule.items()[offset]->cache_closure(*nextItem, closureItems, *gram);
         
         // Add any new items to the waiting queue
@@ -453,18 +1074,26 @@ const lr_action_set& lalr_builder::actions_for_state(int state) const {
     if (existing != m_ActionsForState.end()) return existing->second;
     
     // Build up a new set
-    typedef lalr_machine::transition_set    transition_set;
-    typedef lr1_item::lookahead_set         lookahead_set;
-    
-    lr_action_set&          newSet      = m_ActionsForState[state];
-    const transition_set&   transits    = m_Machine.transitions_for_state(state);
-    const lalr_state&       thisState   = *m_Machine.state_with_id(state);
+    lr_action_set& newSet = m_ActionsForState[state];
     
-    // Create the LR(1) closure for this state
+    // Fetch the LR(1) closure for this state
     // If none of the items in the state have an empty item, then this is unnecessary (this is only required to
     // create the reductions for these items)
-    lr1_item_set closure;
-    generate_closure(thisState, closure, m_Grammar);
+    generate_actions(state, closure_for_state(state), newSet);
+    
+    // Rewrite this list of actions according to the action rewriters
+    rewrite_actions(state, newSet);
+    
+    // Return this as the result
+    return newSet;
+}
+
+/// \brief Adds the actions for the specified state to newSet, before they are passed to the rewriters
+void lalr_builder::generate_actions(int state, const lr1_item_set& closure, lr_action_set& newSet) const {
+    typedef lalr_machine::transition_set    transition_set;
+    typedef lr1_item::lookahead_set         lookahead_set;
+    
+    const transition_set& transits = m_Machine.transitions_for_state(state);
     
     // For each transition on a guarded symbol, add a guard transition to check for it
     for (transition_set::const_iterator maybeGuard = transits.begin(); maybeGuard != transits.end(); ++maybeGuard) {
@@ -533,14 +1162,185 @@ const lr_action_set& lalr_builder::actions_for_state(int state) const {
             newSet.insert(newAction);
         }
     }
+}
+
+/// \brief Passes the actions for the specified state through each of the action rewriters in turn
+void lalr_builder::rewrite_actions(int state, lr_action_set& newSet) const {
+    for (size_t rewriterIndex = 0; rewriterIndex < m_ActionRewriters.size(); ++rewriterIndex) {
+        util::stopwatch rewriteTime;
+        m_ActionRewriters[rewriterIndex]->rewrite_actions(state, newSet, *this);
+        m_RewriterSeconds[rewriterIndex] += rewriteTime.seconds();
+    }
+}
+
+/// \brief Fills in the grammar caches that are read when generating the closure of any state in the machine
+///
+/// This visits every rule that can appear in the closure of a state, starting with the rules in the kernels of the
+/// states. For each item in these rules, the identifier, FIRST set and cached closure are filled in; the items in the
+/// cached closures then supply the rules to visit next, and guard items supply their own rules.
+void lalr_builder::fill_grammar_caches() const {
+    typedef lr1_item::lookahead_set lookahead_set;
     
-    // Rewrite this list of actions according to the action rewriters
-    for (action_rewriter_list::const_iterator rewrite = m_ActionRewriters.begin(); rewrite != m_ActionRewriters.end(); ++rewrite) {
-        (*rewrite)->rewrite_actions(state, newSet, *this);
+    // The special items that closures and actions refer to
+    m_Grammar->identifier_for_item(item_container(new empty_item(), true));
+    m_Grammar->identifier_for_item(item_container(new end_of_input(), true));
+    m_Grammar->identifier_for_item(item_container(new end_of_guard(), true));
+    
+    // Rules that have been visited, and the rules that are waiting to be visited
+    set<int>                visited;
+    queue<rule_container>   waiting;
+    
+    for (int stateId = 0; stateId < m_Machine.count_states(); ++stateId) {
+        const lalr_state& state = *m_Machine.state_with_id(stateId);
+        
+        for (lalr_state::iterator lrItem = state.begin(); lrItem != state.end(); ++lrItem) {
+            if (visited.insert((*lrItem)->rule_identifier()).second) {
+                waiting.push((*lrItem)->rule());
+            }
+        }
     }
     
-    // Return this as the result
-    return newSet;
+    // The closure of each item (reused so the set doesn't have to be created for each item)
+    lr1_item_set    closure;
+    lookahead_set   noLookahead(*m_Grammar);
+    
+    for (; !waiting.empty(); waiting.pop()) {
+        const rule_container& nextRule = waiting.front();
+        
+        for (int offset = 0; offset < (int) nextRule->items().size(); ++offset) {
+            const item_container& nextItem = nextRule->items()[offset];
+            
+            // FIRST sets for items other than nonterminals are filled in as they're requested
+            m_Grammar->identifier_for_item(nextItem);
+            m_Grammar->first(nextItem);
+            
+            // Guard actions use the rule and the initial set for the guard
+            const guard* isGuard = nextItem->cast_guard();
+            if (isGuard) {
+                isGuard->initial(*m_Grammar);
+                if (visited.insert(isGuard->get_rule()->identifier(*m_Grammar)).second) {
+                    waiting.push(isGuard->get_rule());
+                }
+            }
+            
+            // Fill in the cached closure for this item, and visit the rules that it contains (closures look up the
+            // cache for every item, so terminals get an empty cached closure)
+            closure.clear();
+            nextItem->cache_closure(lr1_item(m_Grammar, nextRule, offset, noLookahead), closure, *m_Grammar);
+            
+            for (lr1_item_set::const_iterator closureItem = closure.begin(); closureItem != closure.end(); ++closureItem) {
+                if (visited.insert((*closureItem)->get_lr0_item().rule_identifier()).second) {
+                    waiting.push((*closureItem)->rule());
+                }
+            }
+        }
+    }
+}
+
+namespace lr {
+    /// \brief Generates the actions for a list of states on separate threads, without running the rewriters
+    class generate_state_actions {
+    private:
+        /// \brief The builder that the states belong to
+        const lalr_builder& m_Builder;
+        
+        /// \brief The states to generate actions for
+        const vector<int>& m_States;
+        
+    public:
+        /// \brief The actions generated for each state
+        vector<lr_action_set> actions;
+        
+        generate_state_actions(const lalr_builder& builder, const vector<int>& states)
+        : m_Builder(builder)
+        , m_States(states)
+        , actions(states.size()) {
+        }
+        
+        /// \brief Generates the actions for the state with the specified index
+        void operator()(size_t index) {
+            int             stateId = m_States[index];
+            lr1_item_set    closure;
+            
+            lalr_builder::generate_closure(*m_Builder.m_Machine.state_with_id(stateId), closure, m_Builder.m_Grammar);
+            m_Builder.generate_actions(stateId, closure, actions[index]);
+        }
+    };
+}
+
+/// \brief Generates the actions for every state in the machine, using up to maxThreads threads
+void lalr_builder::compute_all_actions(unsigned int maxThreads) const {
+    // Find the states whose actions aren't known yet
+    vector<int> missing;
+    for (int stateId = 0; stateId < m_Machine.count_states(); ++stateId) {
+        if (m_ActionsForState.find(stateId) != m_ActionsForState.end()) continue;
+        if (m_CompactActionsForState.find(stateId) != m_CompactActionsForState.end()) continue;
+        
+        missing.push_back(stateId);
+    }
+    
+    // Any rules or items that haven't been numbered yet are numbered in the same order for any number of threads
+    fill_grammar_caches();
+    
+    if (maxThreads == 1 || missing.size() <= 1) {
+        // Generate the actions on this thread (the closure for each state replaces the last one in the scratch buffer)
+        for (vector<int>::const_iterator stateId = missing.begin(); stateId != missing.end(); ++stateId) {
+            actions_for_state(*stateId);
+        }
+        return;
+    }
+    
+    // Generate the actions for the states on separate threads
+    generate_state_actions task(*this, missing);
+    util::parallel_for(missing.size(), maxThreads, task);
+    
+    // Rewrite them in order on this thread
+    for (size_t index = 0; index < missing.size(); ++index) {
+        lr_action_set& newSet = m_ActionsForState[missing[index]];
+        newSet.swap(task.actions[index]);
+        
+        rewrite_actions(missing[index], newSet);
+    }
+}
+
+/// \brief Fills in the target list with the compact representation of the actions for the specified state
+///
+/// The actions are listed in the same order as they appear in the result of actions_for_state()
+void lalr_builder::compact_actions_for_state(int state, compact_action_list& target) const {
+    // Use the compact actions if the full actions for this state have been discarded
+    map<int, compact_action_list>::const_iterator compact = m_CompactActionsForState.find(state);
+    if (compact != m_CompactActionsForState.end()) {
+        target = compact->second;
+        return;
+    }
+    
+    const lr_action_set&    actions     = actions_for_state(state);
+    
+    target.clear();
+    target.reserve(actions.size());
+    
+    for (lr_action_set::const_iterator act = actions.begin(); act != actions.end(); ++act) {
+        target.push_back(compact_action(**act, *m_Grammar));
+    }
+    
+    // Only keep the compact form if requested
+    if (!m_KeepActions) {
+        m_CompactActionsForState[state] = target;
+        m_ActionsForState.erase(state);
+    }
+}
+
+/// \brief Discards the record of where the lookaheads were generated and propagated
+void lalr_builder::discard_lookahead_sources() {
+    propagation().swap(m_Propagate);
+    propagation().swap(m_Spontaneous);
+    spontaneous_lookahead().swap(m_SpontaneousLookahead);
+    vector<closure_dependencies>().swap(m_Dependencies);
+    
+    propagation().swap(m_PropagatedFrom);
+    propagation().swap(m_SpontaneousFrom);
+    m_LookaheadSources.clear();
+    m_HasSourceIndex = false;
 }
 
 /// \brief Returns the items that the lookaheads are propagated to for a particular item in this state machine
@@ -548,6 +1348,21 @@ const std::set<lalr_builder::lr_item_id>& lalr_builder::propagations_for_item(in
     return m_Propagate[lr_item_id(state, item)];
 }
 
+/// \brief The total number of propagations (from one item to another) in this state machine
+size_t lalr_builder::count_propagations() const {
+    size_t count = 0;
+    for (propagation::const_iterator prop = m_Propagate.begin(); prop != m_Propagate.end(); ++prop) {
+        count += prop->second.size();
+    }
+    return count;
+}
+
+/// \brief The total time spent by the rewriter with the specified index (in the order they were added), in seconds
+double lalr_builder::rewriter_seconds(size_t rewriterIndex) const {
+    if (rewriterIndex >= m_RewriterSeconds.size()) return 0;
+    return m_RewriterSeconds[rewriterIndex];
+}
+
 /// \brief Returns the items that the item in the specified state generates spontaneous lookaheads for
 const std::set<lalr_builder::lr_item_id>& lalr_builder::spontaneous_for_item(int state, int item) const {
     return m_Spontaneous[lr_item_id(state, item)];
@@ -565,7 +1380,33 @@ const contextfree::item_set& lalr_builder::lookahead_for_spontaneous(int sourceS
 /// the lookahead symbol that generated the conflict, and this will add the items where the lookahead was generated to
 /// the set. This is the set of states that are reached by a reduction on the specified symbol.
 void lalr_builder::find_lookahead_source(int state, int item, contextfree::item_container lookaheadItem, std::set<lr_item_id>& sourceItems) const {
-    // TODO: could add caches so we don't have to repeatedly search the entire set of spontaneous and propagated lookaheads
+    // Reuse the result of an earlier search for the same item and lookahead
+    lookahead_source_key key(lr_item_id(state, item), lookaheadItem);
+    
+    map<lookahead_source_key, set<lr_item_id> >::const_iterator cached = m_LookaheadSources.find(key);
+    if (cached != m_LookaheadSources.end()) {
+        sourceItems.insert(cached->second.begin(), cached->second.end());
+        return;
+    }
+    
+    // Index the propagation tables by target so each item only needs to look at the items that lead to it
+    if (!m_HasSourceIndex) {
+        for (propagation::const_iterator spontaneous = m_Spontaneous.begin(); spontaneous != m_Spontaneous.end(); ++spontaneous) {
+            for (set<lr_item_id>::const_iterator target = spontaneous->second.begin(); target != spontaneous->second.end(); ++target) {
+                m_SpontaneousFrom[*target].insert(spontaneous->first);
+            }
+        }
+        
+        for (propagation::const_iterator propagate = m_Propagate.begin(); propagate != m_Propagate.end(); ++propagate) {
+            for (set<lr_item_id>::const_iterator target = propagate->second.begin(); target != propagate->second.end(); ++target) {
+                m_PropagatedFrom[*target].insert(propagate->first);
+            }
+        }
+        
+        m_HasSourceIndex = true;
+    }
+    
+    set<lr_item_id>& found = m_LookaheadSources[key];
 
     // Set of visited items (which should not be processed again)
     set<lr_item_id> visited;
@@ -586,43 +1427,31 @@ void lalr_builder::find_lookahead_source(int state, int item, contextfree::item_
         if (visited.find(nextItem) != visited.end()) continue;
         visited.insert(nextItem);
 
-        // Search through the spontaneous tables for items that generate this lookahead
-        for (propagation::const_iterator spontaneous = m_Spontaneous.begin(); spontaneous != m_Spontaneous.end(); ++spontaneous) {
-            // Search for items that target this one
-            for (set<lr_item_id>::const_iterator target = spontaneous->second.begin(); target != spontaneous->second.end(); ++target) {
-                // Ignore items that do not target this one
-                if (*target != nextItem) continue;
-
-                // Get the lookahead generated by this transition
-                const item_set& la = m_SpontaneousLookahead[source_to_target(spontaneous->first, *target)];
-
+        // Add the items that spontaneously generated this lookahead for this one
+        propagation::const_iterator spontaneous = m_SpontaneousFrom.find(nextItem);
+        if (spontaneous != m_SpontaneousFrom.end()) {
+            for (set<lr_item_id>::const_iterator source = spontaneous->second.begin(); source != spontaneous->second.end(); ++source) {
                 // Ignore it if it didn't generate the item we're looking for
-                if (!la.contains(lookaheadItem)) continue;
+                spontaneous_lookahead::const_iterator la = m_SpontaneousLookahead.find(source_to_target(*source, nextItem));
+                if (la == m_SpontaneousLookahead.end() || !la->second.contains(lookaheadItem)) continue;
                 
-                // This item does target this one: add the source to the set
-                sourceItems.insert(spontaneous->first);
-                break;
+                found.insert(*source);
             }
         }
 
-        // Search through the propagation tables for items that generate this lookahead
-        for (propagation::const_iterator propagate = m_Propagate.begin(); propagate != m_Propagate.end(); ++propagate) {
-            // Get the lookahead for this item
-            const lr1_item::lookahead_set& la = m_Machine.state_with_id(propagate->first.state_id)->lookahead_for(propagate->first.item_id);
-            
-            // Ignore items that would not have generated the lookahead symbol
-            if (!la.contains(lookaheadItem)) continue;
-            
-            // Search for items that target this one
-            for (set<lr_item_id>::const_iterator target = propagate->second.begin(); target != propagate->second.end(); ++target) {
-                // Ignore items that do not target this one
-                if (*target != nextItem) continue;
+        // Add the items that propagated this lookahead to this one, and process anything that propagates to them
+        propagation::const_iterator propagate = m_PropagatedFrom.find(nextItem);
+        if (propagate != m_PropagatedFrom.end()) {
+            for (set<lr_item_id>::const_iterator source = propagate->second.begin(); source != propagate->second.end(); ++source) {
+                // Ignore items that would not have generated the lookahead symbol
+                const lr1_item::lookahead_set& la = m_Machine.state_with_id(source->state_id)->lookahead_for(source->item_id);
+                if (!la.contains(lookaheadItem)) continue;
                 
-                // This item does target this one: add the source to the set, and process anything that propagates to here
-                sourceItems.insert(propagate->first);
-                toProcess.push(propagate->first);
-                break;
+                found.insert(*source);
+                toProcess.push(*source);
             }
         }
     }
+    
+    sourceItems.insert(found.begin(), found.end());
 }
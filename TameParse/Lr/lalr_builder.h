@@ -30,6 +30,7 @@
 
 #include <map>
 #include <set>
+#include <vector>
 
 #include "TameParse/Util/container.h"
 #include "TameParse/ContextFree/grammar.h"
@@ -87,6 +88,28 @@ namespace lr {
 
         /// \brief Maps 
         typedef std::map<source_to_target, contextfree::item_set> spontaneous_lookahead;
+        
+        /// \brief Algorithms that can be used to propagate lookaheads through the machine
+        enum lookahead_algorithm {
+            /// \brief Repeatedly copies lookaheads along the propagation table until nothing changes (the dragon book algorithm)
+            lookahead_propagate,
+            
+            /// \brief Solves the propagation relation with the DeRemer-Pennello digraph algorithm
+            lookahead_digraph
+        };
+        
+        /// \brief Ways that complete_parser() can decide which LR(1) states to merge
+        enum construction_algorithm {
+            /// \brief Every state with the same kernel is merged (a LALR(1) parser)
+            construct_lalr,
+            
+            /// \brief States with the same kernel are only merged if this can't introduce a new reduce/reduce conflict
+            ///
+            /// This is Pager's minimal LR(1) construction, using his weak compatibility test. It accepts every LR(1)
+            /// grammar, but only splits the states that would be conflicted in a LALR parser, so the machine is
+            /// normally close to the size of the LALR machine.
+            construct_minimal_lr1
+        };
 
     private:
         /// \brief The grammar that this builder will use
@@ -103,6 +126,9 @@ namespace lr {
         /// \brief List of action rewriter objects
         action_rewriter_list m_ActionRewriters;
         
+        /// \brief The total time spent in each action rewriter, in seconds (same order as m_ActionRewriters)
+        mutable std::vector<double> m_RewriterSeconds;
+        
         /// \brief Where lookaheads propagate for each item in the state machine
         ///
         /// Maps from the state, item where lookaheads should propagate from to the set of states and items where they
@@ -118,12 +144,83 @@ namespace lr {
         /// \brief Maps from pairs of items (representing source and target) to the lookahead that was spontaneously generated for them
         mutable spontaneous_lookahead m_SpontaneousLookahead;
         
+        /// \brief The reverse of m_Propagate: maps items to the items whose lookaheads propagate to them
+        ///
+        /// This and m_SpontaneousFrom are built the first time find_lookahead_source() is called, so it doesn't have
+        /// to search the whole of the propagation tables for each item, and are discarded along with the other caches.
+        mutable propagation m_PropagatedFrom;
+        
+        /// \brief The reverse of m_Spontaneous: maps items to the items that spontaneously generated lookaheads for them
+        mutable propagation m_SpontaneousFrom;
+        
+        /// \brief True if m_PropagatedFrom and m_SpontaneousFrom are up to date
+        mutable bool m_HasSourceIndex;
+        
+        /// \brief An item and a lookahead symbol that has been passed to find_lookahead_source()
+        typedef std::pair<lr_item_id, contextfree::item_container> lookahead_source_key;
+        
+        /// \brief The results of find_lookahead_source() for each item and lookahead it has been called for
+        ///
+        /// Conflicts in different states are often caused by the same items, so rewriters and conflict reports ask for
+        /// the same sources many times. This cache is discarded whenever the lookaheads change.
+        mutable std::map<lookahead_source_key, std::set<lr_item_id> > m_LookaheadSources;
+        
         /// \brief Maps state IDs to sets of LR actions
+        ///
+        /// This cache is discarded whenever the lookaheads or the set of rewriters change
         mutable std::map<int, lr_action_set> m_ActionsForState;
         
+        /// \brief Scratch buffer holding the LR(1) closure of the state most recently passed to closure_for_state()
+        ///
+        /// Only the kernels of each state are stored persistently: closures are expanded into this buffer when they
+        /// are needed, so the memory used for closures doesn't grow with the number of states. The closure fragments
+        /// for each nonterminal are memoized by the grammar, so expanding a closure again is cheap.
+        mutable lr1_item_set m_ScratchClosure;
+        
+        /// \brief The state whose closure is in m_ScratchClosure, or -1 if the buffer is empty
+        mutable int m_ScratchClosureState;
+        
+        /// \brief Maps state IDs to the compact form of their actions, for states whose full actions were discarded
+        ///
+        /// This is only filled in if m_KeepActions is false, and is discarded along with m_ActionsForState
+        mutable std::map<int, compact_action_list> m_CompactActionsForState;
+        
+        /// \brief False if compact_actions_for_state() should discard the full actions and closure for each state
+        bool m_KeepActions;
+        
         /// \brief Maps the ID of guard rules to their initial state (if they generate an accepting action, then the guard is matched)
         std::map<int, int> m_StatesForGuard;
         
+        /// \brief The algorithm used to propagate lookaheads in complete_lookaheads()
+        lookahead_algorithm m_LookaheadAlgorithm;
+        
+        /// \brief The algorithm used to build the states in complete_parser()
+        construction_algorithm m_ConstructionAlgorithm;
+        
+        /// \brief The nonterminals and guards that the closure of a state was generated from
+        ///
+        /// If none of the nonterminals has different rules in a later grammar, then a state with the same kernel will
+        /// have the same closure and transitions, which is what makes an incremental rebuild possible.
+        struct closure_dependencies {
+            /// \brief The identifiers of the nonterminals that were expanded in the closure
+            std::set<int> nonterminals;
+            
+            /// \brief The guard items that the closure of the state is positioned before
+            std::vector<contextfree::item_container> guards;
+        };
+        
+        /// \brief The dependencies for each state built by complete_parser(), indexed by state ID
+        std::vector<closure_dependencies> m_Dependencies;
+        
+        /// \brief The number of states whose transitions were copied from a previous builder
+        int m_ReusedStates;
+        
+        /// \brief The time taken by complete_parser() to build the states, in seconds
+        double m_StatesSeconds;
+        
+        /// \brief The time taken by complete_parser() to build the lookaheads, in seconds
+        double m_LookaheadSeconds;
+        
         lalr_builder(const lalr_builder& copyFrom);
         lalr_builder& operator=(const lalr_builder& copyFrom);
         
@@ -141,11 +238,55 @@ namespace lr {
         int add_initial_state(const contextfree::item_container& language);
         
         /// \brief Finishes building the parser (the LALR machine will contain a LALR parser after this call completes)
-        void complete_parser();
+        ///
+        /// The closures and kernels for the states discovered in each pass are generated using up to maxThreads
+        /// threads (0 for one thread per processor core). The rules and items in the grammar are numbered in a fixed
+        /// order first, and new states are always added to the machine in the order they were discovered, so the
+        /// result is the same for any number of threads. The minimal LR(1) construction always runs on the calling
+        /// thread.
+        void complete_parser(unsigned int maxThreads = 1);
+        
+        /// \brief Finishes building the parser, reusing the states of a builder for an earlier version of the grammar
+        ///
+        /// A state whose kernel also appears in the previous machine, and whose closure only expands nonterminals that
+        /// have the same rules in both grammars, takes its transitions from the previous machine rather than having its
+        /// closure recalculated. The lookaheads are always regenerated for the whole machine, as a change to any rule can
+        /// alter how they propagate. The result is identical to calling complete_parser().
+        ///
+        /// The previous builder (and its grammar) must remain valid until this call returns. States are only reused when
+        /// both builders use construct_lalr. States that can't be reused are expanded using up to maxThreads threads.
+        void complete_parser(const lalr_builder& previous, unsigned int maxThreads = 1);
+        
+        /// \brief The number of states whose transitions were taken from a previous builder by complete_parser()
+        inline int count_reused_states() const { return m_ReusedStates; }
+        
+        /// \brief The time that complete_parser() spent building the states, in seconds
+        ///
+        /// For the minimal LR(1) construction, the states and lookaheads are built together and this covers both.
+        inline double states_seconds() const { return m_StatesSeconds; }
+        
+        /// \brief The time that complete_parser() spent building the lookaheads, in seconds
+        inline double lookahead_seconds() const { return m_LookaheadSeconds; }
         
         /// \brief Generates the lookaheads for the parser (when the machine has been built up as a LR(0) grammar)
         void complete_lookaheads();
         
+        /// \brief The algorithm used to propagate lookaheads (lookahead_digraph by default)
+        inline lookahead_algorithm get_lookahead_algorithm() const { return m_LookaheadAlgorithm; }
+        
+        /// \brief Changes the algorithm used to propagate lookaheads
+        ///
+        /// Both algorithms produce the same lookaheads: lookahead_propagate is retained so the results can be cross-checked.
+        inline void set_lookahead_algorithm(lookahead_algorithm algorithm) { m_LookaheadAlgorithm = algorithm; }
+        
+        /// \brief The algorithm used to build the states of the machine (construct_lalr by default)
+        inline construction_algorithm get_construction_algorithm() const { return m_ConstructionAlgorithm; }
+        
+        /// \brief Changes the algorithm used to build the states of the machine
+        ///
+        /// This must be set before complete_parser() is called.
+        inline void set_construction_algorithm(construction_algorithm algorithm) { m_ConstructionAlgorithm = algorithm; }
+        
         /// \brief The LALR state machine being built up by this object
         lalr_machine& machine() { return m_Machine; }
         
@@ -170,6 +311,20 @@ namespace lr {
         /// caused by empty productions. This is also required to display (or resolve) shift/reduce conflicts
         static void generate_closure(const lalr_state& state, lr1_item_set& closure, const contextfree::grammar* gram);
         
+        /// \brief Returns the LR(1) closure of the state with the specified identifier
+        ///
+        /// This is the same as the result of generate_closure(). The closure is expanded into a scratch buffer that is
+        /// reused for every state, so the result is only valid until this is called for a different state, the
+        /// lookaheads change or clear_caches() is called. Asking for the same state again does not expand the closure
+        /// again.
+        const lr1_item_set& closure_for_state(int state) const;
+        
+        /// \brief Discards the cached closures and actions for every state
+        ///
+        /// This is done automatically when the lookaheads are regenerated. Cached actions are also discarded when
+        /// the rewriters are changed.
+        void clear_caches();
+        
     public:
         /// \brief Returns the number of states in the state machine
         inline int count_states() const { return m_Machine.count_states(); }
@@ -179,8 +334,58 @@ namespace lr {
         /// If there are conflicts, this will return multiple actions for a single symbol.
         const lr_action_set& actions_for_state(int state) const;
         
+        /// \brief Sets whether or not the full actions for a state are kept once their compact form has been generated
+        ///
+        /// When this is false, compact_actions_for_state() keeps just the compact form of the actions for each state,
+        /// and discards the full set of actions. Building parser tables for a large grammar then only
+        /// needs the full actions for one state at a time, which greatly reduces the memory required. Calling
+        /// actions_for_state() for a state afterwards will generate its actions again. The default is true.
+        inline void set_keep_actions(bool keep) { m_KeepActions = keep; }
+        
+        /// \brief Generates the actions for every state in the machine, using up to maxThreads threads
+        ///
+        /// This has the same result as calling actions_for_state() for each state in turn. Each thread only holds one
+        /// closure at a time, so the memory used for closures does not grow with the size of the machine.
+        ///
+        /// When more than one thread is used, the grammar caches are filled in first so that the closures and actions
+        /// for separate states can be generated at the same time. The action rewriters are then run on the calling
+        /// thread, one state at a time in order, as they can ask this builder for the actions of other states. If
+        /// maxThreads is 0 then one thread is used for each processor core.
+        void compute_all_actions(unsigned int maxThreads = 1) const;
+        
+        /// \brief Fills in the grammar caches that are read when generating the closure of any state in the machine
+        ///
+        /// Once this has been called, generate_closure() and the FIRST sets and cached closures of the items in the
+        /// machine only read from the grammar and the items and rules in it, so they can be used for separate states
+        /// on several threads at once.
+        ///
+        /// This also numbers the rules and items in the grammar in a fixed order. complete_parser() calls it whatever
+        /// the number of threads, so the rule numbers in the generated tables don't depend on the thread count.
+        void fill_grammar_caches() const;
+        
+        /// \brief Fills in the target list with the compact representation of the actions for the specified state
+        ///
+        /// The actions are listed in the same order as they appear in the result of actions_for_state()
+        void compact_actions_for_state(int state, compact_action_list& target) const;
+        
+        /// \brief Discards the record of where the lookaheads were generated and propagated
+        ///
+        /// These tables are only needed to describe where the lookaheads came from once complete_parser() has
+        /// finished, but can be larger than the state machine itself. Afterwards, propagations_for_item(),
+        /// spontaneous_for_item() and find_lookahead_source() find nothing, and this builder can't supply any states
+        /// when it is passed as the previous builder to complete_parser().
+        void discard_lookahead_sources();
+        
         /// \brief Returns the items that the lookaheads are propagated to for a particular item in this state machine
         const std::set<lr_item_id>& propagations_for_item(int state, int item) const;
+        
+        /// \brief The total number of propagations (from one item to another) in this state machine
+        size_t count_propagations() const;
+        
+        /// \brief The total time spent by the rewriter with the specified index (in the order they were added), in seconds
+        ///
+        /// This covers every call made while generating actions since the rewriter was added.
+        double rewriter_seconds(size_t rewriterIndex) const;
 
         /// \brief Returns the items that the item in the specified state generates spontaneous lookaheads for
         const std::set<lr_item_id>& spontaneous_for_item(int state, int item) const;
@@ -194,14 +399,52 @@ namespace lr {
         /// it is possible to see why a conflict exists. Pass in the state and item ID that the lookahead was generated for, and
         /// the lookahead symbol that generated the conflict, and this will add the items where the lookahead was generated to
         /// the set. This is the set of states that are reached by a reduction on the specified symbol.
+        ///
+        /// The results are cached until the lookaheads change, so asking about the same item again is cheap.
         void find_lookahead_source(int state, int item, contextfree::item_container lookaheadItem, std::set<lr_item_id>& sourceItems) const;
 
         /// \brief Computes the closure of a LALR state
         static void create_closure(closure_set& target, const lalr_state& state, const contextfree::grammar* gram);
         
     private:
+        /// \brief The kernels and guards reached from a single state
+        struct state_expansion;
+        
+        /// \brief Computes the closure of a state and the kernels reached from it, without altering the machine
+        static void expand_state(state_expansion& target, const lalr_state& state, const contextfree::grammar* gram);
+        
+        /// \brief Builds the states for the machine, reusing states from the specified builder if it is not NULL
+        void complete_states(const lalr_builder* previous, unsigned int maxThreads);
+        
+        /// \brief Returns true if the specified nonterminal has the same rules in the grammar for this builder and another
+        bool same_rules(const lalr_builder& previous, int nonterminalId) const;
+        
+        /// \brief Adds the initial state for a guard item, returning its identifier, or -1 if the state already exists
+        int add_guard_state(const contextfree::item_container& guardItem);
+        
+        /// \brief Builds the states for the machine using Pager's minimal LR(1) algorithm
+        void complete_minimal_lr1();
+        
+        /// \brief True if the lookaheads of newState can be merged into existingState without introducing a new conflict
+        static bool weakly_compatible(const lalr_state& existingState, const lalr_state& newState);
+        
+        /// \brief Propagates lookaheads along m_Propagate until no lookahead set changes
+        void propagate_lookaheads();
+        
+        /// \brief Propagates lookaheads along m_Propagate using the DeRemer-Pennello digraph algorithm
+        void digraph_lookaheads();
+        
         /// \brief Adds guard actions appropriate for the specified guard item
         void add_guard(const contextfree::item_container& item, lr_action_set& newSet) const;
+        
+        /// \brief Adds the actions for the specified state to newSet, before they are passed to the rewriters
+        void generate_actions(int state, const lr1_item_set& closure, lr_action_set& newSet) const;
+        
+        /// \brief Passes the actions for the specified state through each of the action rewriters in turn
+        void rewrite_actions(int state, lr_action_set& newSet) const;
+        
+        friend class expand_frontier_states;
+        friend class generate_state_actions;
     };
 }
 
@@ -55,15 +55,17 @@ int lalr_machine::add_state(container& newState) {
         return newState->identifier();
     }
     
-    // Try to find the existing state
-    state_to_identifier::iterator found = m_StateIds.find(newState);
+    // Try to find the existing state among the states with the same hash code
+    identifier_list& bucket = m_StateIds[newState->hash()];
     
-    if (found != m_StateIds.end()) {
-        // Set the identifier for the state that was passed in
-        newState->set_identifier(found->second);
-        
-        // Return the result
-        return found->second;
+    for (identifier_list::const_iterator found = bucket.begin(); found != bucket.end(); ++found) {
+        if (*m_States[*found] == *newState) {
+            // Set the identifier for the state that was passed in
+            newState->set_identifier(*found);
+            
+            // Return the result
+            return *found;
+        }
     }
     
     // The new ID is the last entry in the state table
@@ -73,7 +75,7 @@ int lalr_machine::add_state(container& newState) {
     newState->set_identifier(newId);
     
     // Store this state
-    m_StateIds[newState] = newId;
+    bucket.push_back(newId);
     m_States.push_back(newState);
     m_Transitions.push_back(transition_set());
 
@@ -81,6 +83,94 @@ int lalr_machine::add_state(container& newState) {
     return newId;
 }
 
+/// \brief Adds a new state to this machine, even if there is already a state with the same kernel
+int lalr_machine::add_split_state(container& newState) {
+    // The new ID is the last entry in the state table
+    int newId = (int) m_States.size();
+    
+    newState->set_identifier(newId);
+    
+    // Store this state after any existing states with the same kernel
+    m_StateIds[newState->hash()].push_back(newId);
+    m_States.push_back(newState);
+    m_Transitions.push_back(transition_set());
+    
+    return newId;
+}
+
+/// \brief Fills in the target list with the identifiers of every state with the same kernel as the specified state
+void lalr_machine::find_states(const lalr_state& kernel, identifier_list& target) const {
+    state_to_identifier::const_iterator bucket = m_StateIds.find(kernel.hash());
+    if (bucket == m_StateIds.end()) return;
+    
+    for (identifier_list::const_iterator found = bucket->second.begin(); found != bucket->second.end(); ++found) {
+        if (*m_States[*found] == kernel) {
+            target.push_back(*found);
+        }
+    }
+}
+
+/// \brief Removes any state that can't be reached from the specified states
+void lalr_machine::remove_unreachable(const identifier_list& roots, std::vector<int>& newIds) {
+    // Mark the states that can be reached
+    vector<bool>    reachable(m_States.size(), false);
+    vector<int>     waiting;
+    
+    for (identifier_list::const_iterator root = roots.begin(); root != roots.end(); ++root) {
+        if (*root < 0 || *root >= (int) m_States.size() || reachable[*root]) continue;
+        
+        reachable[*root] = true;
+        waiting.push_back(*root);
+    }
+    
+    while (!waiting.empty()) {
+        int stateId = waiting.back();
+        waiting.pop_back();
+        
+        for (transition_set::const_iterator trans = m_Transitions[stateId].begin(); trans != m_Transitions[stateId].end(); ++trans) {
+            if (!reachable[trans->second]) {
+                reachable[trans->second] = true;
+                waiting.push_back(trans->second);
+            }
+        }
+    }
+    
+    // Assign the new identifiers
+    newIds.clear();
+    
+    int nextId = 0;
+    for (size_t stateId = 0; stateId < m_States.size(); ++stateId) {
+        newIds.push_back(reachable[stateId] ? nextId++ : -1);
+    }
+    
+    // Nothing to do if every state is reachable
+    if (nextId == (int) m_States.size()) return;
+    
+    // Rebuild the tables
+    state_list              states;
+    transition_for_state    transitions;
+    
+    m_StateIds.clear();
+    
+    for (size_t stateId = 0; stateId < m_States.size(); ++stateId) {
+        if (newIds[stateId] < 0) continue;
+        
+        container& state = m_States[stateId];
+        state->set_identifier(newIds[stateId]);
+        
+        m_StateIds[state->hash()].push_back(newIds[stateId]);
+        states.push_back(state);
+        
+        transitions.push_back(transition_set());
+        for (transition_set::const_iterator trans = m_Transitions[stateId].begin(); trans != m_Transitions[stateId].end(); ++trans) {
+            transitions.back().insert(transition(trans->first, newIds[trans->second]));
+        }
+    }
+    
+    m_States.swap(states);
+    m_Transitions.swap(transitions);
+}
+
 /// \brief Adds a transition to this state machine
 ///
 /// Transitions involving terminals create shift actions in the final parser. Nonterminals and EBNF
@@ -91,7 +181,16 @@ void lalr_machine::add_transition(int stateId, const contextfree::item_container
     if (newStateId < 0 || newStateId >= (int) m_States.size()) return;
     
     // Set this transition
-    m_Transitions[stateId].insert(transition(item, newStateId));
+    m_Transitions[stateId][item] = newStateId;
+}
+
+/// \brief Removes the lookaheads from every item in the state with the specified ID
+void lalr_machine::clear_lookaheads(int stateId) {
+    container& state = m_States[stateId];
+    
+    for (int itemId = 0; itemId < state->count_items(); ++itemId) {
+        state->lookahead_for(itemId) = item_set(m_Grammar);
+    }
 }
 
 /// \brief Adds the specified set of lookahead items to the state with the supplied ID
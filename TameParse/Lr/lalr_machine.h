@@ -32,6 +32,10 @@
 #include <map>
 #include <vector>
 
+#if __cplusplus >= 201103L
+#include <unordered_map>
+#endif
+
 #include "TameParse/Util/container.h"
 #include "TameParse/ContextFree/item.h"
 #include "TameParse/ContextFree/grammar.h"
@@ -51,10 +55,19 @@ namespace lr {
         /// \brief State container
         typedef util::container<lalr_state> container;
         
-        /// \brief Maps unique states to identifiers
+        /// \brief List of state identifiers
+        typedef std::vector<int> identifier_list;
+        
+        /// \brief Maps the hash code of a state's kernel to the identifiers of the states with that hash
         ///
-        /// Updating lookahead or identifiers in state doesn't change them, so it's safe to do this
-        typedef std::map<container, int> state_to_identifier;
+        /// Updating lookahead or identifiers in state doesn't change the hash, so it's safe to do this. Hash
+        /// codes are 64 bits, so buckets almost always contain a single state: a full comparison is only
+        /// needed to confirm a match.
+#if __cplusplus >= 201103L
+        typedef std::unordered_map<lalr_state::hash_code, identifier_list> state_to_identifier;
+#else
+        typedef std::map<lalr_state::hash_code, identifier_list> state_to_identifier;
+#endif
         
         /// \brief List of states
         typedef std::vector<container> state_list;
@@ -75,7 +88,7 @@ namespace lr {
         /// \brief The grammar for this state machine
         contextfree::grammar* m_Grammar;
         
-        /// \brief Maps states to identifiers
+        /// \brief Maps state hash codes to identifiers
         state_to_identifier m_StateIds;
         
         /// \brief List of states. The index in this list corresponds to the identifier in m_StateIds
@@ -105,13 +118,34 @@ namespace lr {
         ///
         int add_state(container& newState);
         
+        /// \brief Adds a new state to this machine, even if there is already a state with the same kernel
+        ///
+        /// This is used when building parsers that are more powerful than LALR, where states with the same kernel
+        /// are kept apart when merging their lookaheads would cause a conflict. add_state() will return the first
+        /// state that was added with a particular kernel.
+        int add_split_state(container& newState);
+        
+        /// \brief Fills in the target list with the identifiers of every state with the same kernel as the specified state
+        void find_states(const lalr_state& kernel, identifier_list& target) const;
+        
+        /// \brief Removes any state that can't be reached from the specified states
+        ///
+        /// The remaining states keep their relative order. newIds is filled in with the new identifier for each of the
+        /// old states, or -1 for states that were removed.
+        void remove_unreachable(const identifier_list& roots, std::vector<int>& newIds);
+        
         /// \brief Adds a transition to this state machine
         ///
         /// Transitions involving terminals create shift actions in the final parser. Nonterminals and EBNF
         /// items go into the goto table for the final parser. The empty item should be ignored. Guard items
         /// are a little weird: they act like shift actions if they are matched.
+        ///
+        /// Any existing transition for the item is replaced.
         void add_transition(int stateId, const contextfree::item_container& item, int newStateId);
         
+        /// \brief Removes the lookaheads from every item in the state with the specified ID
+        void clear_lookaheads(int stateId);
+        
         /// \brief Adds the specified set of lookahead items to the state with the supplied ID and returns true if the lookahead changed
         bool add_lookahead(int stateId, const lr0_item& item, const contextfree::item_set& newLookahead);
         
@@ -25,18 +25,26 @@
 //  IN THE SOFTWARE.
 //
 
+#include <algorithm>
+
 #include "TameParse/Lr/lalr_state.h"
 
+using namespace std;
 using namespace contextfree;
 using namespace lr;
 
 /// \brief Constructs an empty state
-lalr_state::lalr_state() {
+lalr_state::lalr_state()
+: m_Hash(0)
+, m_HashValid(false) {
 }
 
 /// \brief Copies this state
 lalr_state::lalr_state(const lalr_state& copyFrom)
-: m_State(copyFrom.m_State) {
+: m_State(copyFrom.m_State)
+, m_Hash(copyFrom.m_Hash)
+, m_Kernel(copyFrom.m_Kernel)
+, m_HashValid(copyFrom.m_HashValid) {
     for (lookahead_for_item::const_iterator la=copyFrom.m_Lookahead.begin(); la != copyFrom.m_Lookahead.end(); ++la) {
         m_Lookahead.push_back(new lr1_item::lookahead_set(**la));
     }    
@@ -51,12 +59,21 @@ lalr_state::~lalr_state() {
 }
 
 bool lalr_state::operator<(const lalr_state& compareTo) const {
-    // Comparison only works on the state, not on the lookahead
-    return m_State < compareTo.m_State;
+    // Comparison only works on the kernel, not on the lookahead
+    const packed_kernel& ourKernel      = kernel();
+    const packed_kernel& theirKernel    = compareTo.kernel();
+    
+    if (ourKernel.size() < theirKernel.size()) return true;
+    if (ourKernel.size() > theirKernel.size()) return false;
+    
+    return ourKernel < theirKernel;
 }
 
 bool lalr_state::operator==(const lalr_state& compareTo) const {
-    return m_State == compareTo.m_State;
+    // States with different hash codes can't be equal
+    if (hash() != compareTo.hash()) return false;
+    
+    return m_Kernel == compareTo.m_Kernel;
 }
 
 /// \brief Adds a new item to this object. Returns true if the operation modified this container
@@ -65,6 +82,9 @@ int lalr_state::add(const container& newItem, const grammar* gram) {
     // Identifiers are the same as in the state, we assume they increase monotonically from 0
     int newId = m_State.add(newItem);
     
+    // The kernel may have changed, so the hash code needs to be recalculated
+    m_HashValid = false;
+    
     // Create a lookahead set for this item
     while (newId >= (int) m_Lookahead.size()) {
         m_Lookahead.push_back(new lr1_item::lookahead_set(gram));
@@ -89,6 +109,44 @@ int lalr_state::find_identifier(const container& item) const {
     return m_State.find_identifier(item);
 }
 
+/// \brief Recalculates m_Kernel and m_Hash if the items in this state have changed
+void lalr_state::update_kernel() const {
+    if (m_HashValid) return;
+    
+    // Pack and sort the items
+    m_Kernel.clear();
+    m_Kernel.reserve(count_items());
+    
+    for (iterator item = begin(); item != end(); ++item) {
+        m_Kernel.push_back((*item)->packed());
+    }
+    
+    sort(m_Kernel.begin(), m_Kernel.end());
+    
+    // FNV-1a over the packed items
+    hash_code result = 14695981039346656037ULL;
+    
+    for (packed_kernel::const_iterator item = m_Kernel.begin(); item != m_Kernel.end(); ++item) {
+        result = (result ^ (hash_code) *item) * 1099511628211ULL;
+    }
+    
+    // Cache the result
+    m_Hash      = result;
+    m_HashValid = true;
+}
+
+/// \brief Hash code for the kernel of this state
+lalr_state::hash_code lalr_state::hash() const {
+    update_kernel();
+    return m_Hash;
+}
+
+/// \brief The kernel of this state as a sorted list of packed items
+const packed_kernel& lalr_state::kernel() const {
+    update_kernel();
+    return m_Kernel;
+}
+
 /// \brief Returns the lookahead set for the item with the specified ID
 lr1_item::lookahead_set& lalr_state::lookahead_for(int identifier) {
     return *m_Lookahead[identifier];
@@ -29,6 +29,7 @@
 #define _LR_LALR_STATE_H
 
 #include <vector>
+#include <stdint.h>
 
 #include "TameParse/Util/container.h"
 #include "TameParse/ContextFree/grammar.h"
@@ -55,6 +56,9 @@ namespace lr {
         /// \brief Maps item IDs to LR(1) lookahead sets
         typedef std::vector<lr1_item::lookahead_set*> lookahead_for_item;
         
+        /// \brief Type of a hash code for a state
+        typedef uint64_t hash_code;
+        
     private:
         /// \brief The underlying state of this item
         state m_State;
@@ -62,6 +66,18 @@ namespace lr {
         /// \brief Contains the lookahead sets for this item
         lookahead_for_item m_Lookahead;
         
+        /// \brief The hash code for the kernel of this state (only meaningful if m_HashValid is true)
+        mutable hash_code m_Hash;
+        
+        /// \brief The packed items in the kernel of this state, in order (only meaningful if m_HashValid is true)
+        mutable packed_kernel m_Kernel;
+        
+        /// \brief True if m_Hash and m_Kernel are up to date with the items in this state
+        mutable bool m_HashValid;
+        
+        /// \brief Recalculates m_Kernel and m_Hash if the items in this state have changed
+        void update_kernel() const;
+        
         /// \brief Disabled assignment
         lalr_state& operator=(const lalr_state& assignFrom);
         
@@ -143,6 +159,18 @@ namespace lr {
         
         /// \brief Item with the specified identifier
         inline const container& operator[](int identifier) const { return m_State[identifier]; }
+        
+        /// \brief Hash code for the kernel of this state
+        ///
+        /// States that compare equal have the same hash code. As with comparison, the lookahead is not
+        /// taken into account. The hash code is calculated on first use and cached until a new item is added.
+        hash_code hash() const;
+        
+        /// \brief The kernel of this state as a sorted list of packed items
+        ///
+        /// States compare equal if their packed kernels are the same, regardless of the order that their items
+        /// were added in.
+        const packed_kernel& kernel() const;
     };
     
     /// \brief Container for LALR states
@@ -0,0 +1,217 @@
+//
+//  language_registry.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include "TameParse/Lr/language_registry.h"
+#include "TameParse/Util/mapped_file.h"
+
+using namespace std;
+using namespace lr;
+
+#if __cplusplus >= 201103L
+
+/// \brief Destructor
+language_registry::loader::~loader() {
+}
+
+/// \brief Creates a loader for the languages in the specified directory
+language_registry::file_loader::file_loader(const std::string& directory, bool hugePages)
+: m_Directory(directory)
+, m_HugePages(hugePages) {
+    if (!m_Directory.empty() && m_Directory[m_Directory.size()-1] != '/') {
+        m_Directory += '/';
+    }
+}
+
+/// \brief Loads the language with the specified name, or returns NULL if its files can't be read
+compiled_language* language_registry::file_loader::load(const std::string& name) {
+    util::mapped_file lexerFile(m_Directory + name + ".lexer");
+    util::mapped_file tablesFile(m_Directory + name + ".tables");
+    
+    if (!lexerFile.is_open() || !tablesFile.is_open()) return NULL;
+    
+    // from_binary copies the data, so the files can be closed afterwards
+    return compiled_language::from_binary(lexerFile.begin(), lexerFile.size(), tablesFile.begin(), tablesFile.size(), m_HugePages);
+}
+
+/// \brief Creates a registry that loads languages with the specified loader and keeps up to maxBytes of them in memory
+language_registry::language_registry(loader* load, size_t maxBytes, bool ownsLoader)
+: m_Loader(load)
+, m_OwnsLoader(ownsLoader)
+, m_MaxBytes(maxBytes)
+, m_UsedBytes(0)
+, m_LoadCount(0) {
+}
+
+/// \brief Destructor
+language_registry::~language_registry() {
+    if (m_OwnsLoader) {
+        delete m_Loader;
+    }
+}
+
+/// \brief Returns the language with the specified name, loading it if necessary
+language_registry::language_ptr language_registry::get(const std::string& name) {
+    unique_lock<mutex> lock(m_Lock);
+    
+    // Use the existing entry if there is one, waiting for it if another thread is loading it
+    entry_map::iterator found = m_Entries.find(name);
+    if (found != m_Entries.end()) {
+        if (found->second.loading) {
+            // The entry is removed if the load fails, and can be evicted or removed as soon as it has loaded, so
+            // the result is passed back through a copy of the handle
+            language_ptr result;
+            m_Loaded.wait(lock, [&] () {
+                entry_map::iterator current = m_Entries.find(name);
+                if (current == m_Entries.end()) return true;
+                if (current->second.loading) return false;
+                
+                result = current->second.language;
+                return true;
+            });
+            
+            if (result) {
+                entry_map::iterator current = m_Entries.find(name);
+                if (current != m_Entries.end() && current->second.language == result) {
+                    m_Recent.splice(m_Recent.begin(), m_Recent, current->second.recent);
+                }
+            }
+            
+            return result;
+        }
+        
+        // Mark as the most recently used language
+        m_Recent.splice(m_Recent.begin(), m_Recent, found->second.recent);
+        return found->second.language;
+    }
+    
+    // Create an entry to make any other threads that want this language wait for it
+    entry& loading      = m_Entries[name];
+    loading.bytes       = 0;
+    loading.loading     = true;
+    loading.recent      = m_Recent.end();
+    ++m_LoadCount;
+    
+    // Load the language without holding the lock
+    lock.unlock();
+    
+    compiled_language* loaded = NULL;
+    try {
+        loaded = m_Loader->load(name);
+    } catch (...) {
+        lock.lock();
+        m_Entries.erase(name);
+        m_Loaded.notify_all();
+        throw;
+    }
+    
+    language_ptr    result(loaded);
+    size_t          bytes = loaded ? loaded->memory_usage() : 0;
+    
+    lock.lock();
+    
+    // Entries can't be removed while they are loading, so this is still the entry created above
+    found = m_Entries.find(name);
+    
+    if (!result) {
+        m_Entries.erase(found);
+    } else {
+        found->second.language  = result;
+        found->second.bytes     = bytes;
+        found->second.loading   = false;
+        found->second.recent    = m_Recent.insert(m_Recent.begin(), name);
+        m_UsedBytes             += bytes;
+        
+        evict();
+    }
+    
+    m_Loaded.notify_all();
+    return result;
+}
+
+/// \brief Drops the least recently used languages until the rest fit in the budget (the lock must be held)
+void language_registry::evict() {
+    // The most recently used language always stays
+    while (m_UsedBytes > m_MaxBytes && m_Recent.size() > 1) {
+        entry_map::iterator oldest = m_Entries.find(m_Recent.back());
+        
+        m_UsedBytes -= oldest->second.bytes;
+        m_Recent.pop_back();
+        m_Entries.erase(oldest);
+    }
+}
+
+/// \brief Drops the language with the specified name from the registry, so that it is loaded again the next time it is needed
+void language_registry::remove(const std::string& name) {
+    lock_guard<mutex> lock(m_Lock);
+    
+    entry_map::iterator found = m_Entries.find(name);
+    if (found == m_Entries.end() || found->second.loading) return;
+    
+    m_UsedBytes -= found->second.bytes;
+    m_Recent.erase(found->second.recent);
+    m_Entries.erase(found);
+}
+
+/// \brief Changes the memory budget, evicting languages if the loaded ones no longer fit
+void language_registry::set_max_bytes(size_t maxBytes) {
+    lock_guard<mutex> lock(m_Lock);
+    
+    m_MaxBytes = maxBytes;
+    evict();
+}
+
+/// \brief The memory budget for the loaded languages
+size_t language_registry::max_bytes() const {
+    lock_guard<mutex> lock(m_Lock);
+    return m_MaxBytes;
+}
+
+/// \brief The memory used by the languages in the registry
+size_t language_registry::memory_usage() const {
+    lock_guard<mutex> lock(m_Lock);
+    return m_UsedBytes;
+}
+
+/// \brief The number of languages in the registry
+size_t language_registry::count_languages() const {
+    lock_guard<mutex> lock(m_Lock);
+    return m_Recent.size();
+}
+
+/// \brief The number of times the loader has been called
+size_t language_registry::count_loads() const {
+    lock_guard<mutex> lock(m_Lock);
+    return m_LoadCount;
+}
+
+/// \brief True if the language with the specified name is loaded
+bool language_registry::is_loaded(const std::string& name) const {
+    lock_guard<mutex> lock(m_Lock);
+    
+    entry_map::const_iterator found = m_Entries.find(name);
+    return found != m_Entries.end() && !found->second.loading;
+}
+
+#endif
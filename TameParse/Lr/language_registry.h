@@ -0,0 +1,190 @@
+//
+//  language_registry.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _LR_LANGUAGE_REGISTRY_H
+#define _LR_LANGUAGE_REGISTRY_H
+
+#include <string>
+
+#include "TameParse/Lr/compiled_language.h"
+
+#if __cplusplus >= 201103L
+#include <condition_variable>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#endif
+
+namespace lr {
+#if __cplusplus >= 201103L
+    ///
+    /// \brief Loads compiled languages by name, keeping the most recently used ones in memory
+    ///
+    /// This is intended for services that parse with many different languages (one per customer, say), where
+    /// keeping every language loaded all the time would use too much memory. get() returns a shared handle to the
+    /// language, loading it with the registry's loader if it isn't already in memory. Threads that ask for a
+    /// language that is already being loaded wait for that load to finish rather than loading it again.
+    ///
+    /// When the total memory_usage() of the loaded languages goes over the budget, the least recently used ones are
+    /// dropped from the registry. A language is only freed once the last handle to it is released, so threads that
+    /// are still parsing with an evicted language can carry on doing so. The language that was most recently asked
+    /// for is never evicted, even if it is larger than the budget on its own.
+    ///
+    class language_registry {
+    public:
+        /// \brief Shared handle to a language in the registry
+        typedef std::shared_ptr<const compiled_language> language_ptr;
+        
+        ///
+        /// \brief Class that loads the languages for a registry
+        ///
+        class loader {
+        public:
+            /// \brief Destructor
+            virtual ~loader();
+            
+            /// \brief Loads the language with the specified name, or returns NULL if it can't be loaded
+            ///
+            /// This is called without the registry's lock held, so it can be called by several threads at once for
+            /// different languages.
+            virtual compiled_language* load(const std::string& name) = 0;
+        };
+        
+        ///
+        /// \brief Loader that reads the binary lexer and parser tables for each language from a directory
+        ///
+        /// The language 'name' is loaded from the files 'name.lexer' (written by binary_lexer::write_binary) and
+        /// 'name.tables' (written by parser_tables::write_binary) in the directory.
+        ///
+        class file_loader : public loader {
+        private:
+            /// \brief The directory containing the languages (ending in a path separator, or empty)
+            std::string m_Directory;
+            
+            /// \brief True if the languages should be loaded into huge pages
+            bool m_HugePages;
+        
+        public:
+            /// \brief Creates a loader for the languages in the specified directory
+            explicit file_loader(const std::string& directory, bool hugePages = false);
+            
+            /// \brief Loads the language with the specified name, or returns NULL if its files can't be read
+            virtual compiled_language* load(const std::string& name);
+        };
+    
+    private:
+        /// \brief A language in the registry
+        struct entry {
+            /// \brief The language (NULL while it is being loaded)
+            language_ptr language;
+            
+            /// \brief The memory used by the language
+            size_t bytes;
+            
+            /// \brief True while a thread is loading the language
+            bool loading;
+            
+            /// \brief The position of this language in the list of recently used languages
+            std::list<std::string>::iterator recent;
+        };
+        
+        /// \brief Maps language names to entries
+        typedef std::map<std::string, entry> entry_map;
+        
+        /// \brief The loader for this registry
+        loader* m_Loader;
+        
+        /// \brief True if the loader should be deleted along with the registry
+        bool m_OwnsLoader;
+        
+        /// \brief The memory budget for the loaded languages, in bytes
+        size_t m_MaxBytes;
+        
+        /// \brief The memory used by the loaded languages
+        size_t m_UsedBytes;
+        
+        /// \brief The number of times the loader has been called
+        size_t m_LoadCount;
+        
+        /// \brief The languages that are loaded or being loaded
+        entry_map m_Entries;
+        
+        /// \brief The names of the loaded languages, most recently used first
+        std::list<std::string> m_Recent;
+        
+        /// \brief Lock protecting the registry
+        mutable std::mutex m_Lock;
+        
+        /// \brief Signalled when a language finishes loading
+        std::condition_variable m_Loaded;
+        
+        language_registry(const language_registry& copyFrom);
+        language_registry& operator=(const language_registry& copyFrom);
+    
+    public:
+        /// \brief Creates a registry that loads languages with the specified loader and keeps up to maxBytes of them in memory
+        language_registry(loader* load, size_t maxBytes, bool ownsLoader = true);
+        
+        /// \brief Destructor
+        ~language_registry();
+        
+        /// \brief Returns the language with the specified name, loading it if necessary
+        ///
+        /// Returns an empty handle if the language can't be loaded. Failed loads are not remembered, so the next call
+        /// will try again.
+        language_ptr get(const std::string& name);
+        
+        /// \brief Drops the language with the specified name from the registry, so that it is loaded again the next time it is needed
+        ///
+        /// Existing handles to the language stay valid. A load that is in progress is not affected.
+        void remove(const std::string& name);
+        
+        /// \brief Changes the memory budget, evicting languages if the loaded ones no longer fit
+        void set_max_bytes(size_t maxBytes);
+        
+        /// \brief The memory budget for the loaded languages
+        size_t max_bytes() const;
+        
+        /// \brief The memory used by the languages in the registry
+        size_t memory_usage() const;
+        
+        /// \brief The number of languages in the registry
+        size_t count_languages() const;
+        
+        /// \brief The number of times the loader has been called
+        size_t count_loads() const;
+        
+        /// \brief True if the language with the specified name is loaded
+        bool is_loaded(const std::string& name) const;
+    
+    private:
+        /// \brief Drops the least recently used languages until the rest fit in the budget (the lock must be held)
+        void evict();
+    };
+#endif
+}
+
+#endif
@@ -0,0 +1,61 @@
+//
+//  lexer_mode_table.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include "TameParse/Lr/lexer_mode_table.h"
+
+using namespace std;
+using namespace lr;
+
+/// \brief Creates an empty table, which never switches mode
+lexer_mode_table::lexer_mode_table() {
+}
+
+/// \brief Creates a table for the specified parser tables
+lexer_mode_table::lexer_mode_table(const parser_tables& tables, const vector<int>& terminalModes)
+: m_ModeForState(tables.count_states(), -1) {
+    if (!tables.has_expected_terminals()) return;
+    
+    for (int stateId = 0; stateId < tables.count_states(); ++stateId) {
+        int     mode        = -1;
+        bool    conflicts   = false;
+        
+        for (const int* terminal = tables.first_expected(stateId); terminal != tables.last_expected(stateId); ++terminal) {
+            // Terminals that are matched in more than one mode don't decide anything
+            if (*terminal < 0 || *terminal >= (int) terminalModes.size()) continue;
+            
+            int terminalMode = terminalModes[*terminal];
+            if (terminalMode < 0) continue;
+            
+            if (mode < 0) {
+                mode = terminalMode;
+            } else if (mode != terminalMode) {
+                conflicts = true;
+                break;
+            }
+        }
+        
+        if (!conflicts) m_ModeForState[stateId] = mode;
+    }
+}
@@ -0,0 +1,73 @@
+//
+//  lexer_mode_table.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _LR_LEXER_MODE_TABLE_H
+#define _LR_LEXER_MODE_TABLE_H
+
+#include <vector>
+
+#include "TameParse/Lr/parser_tables.h"
+
+namespace lr {
+    ///
+    /// \brief Table of the lexer mode that a parser should read its lookahead in, for each of its states
+    ///
+    /// A language that uses the lexers of other languages (see compiler::language_stage) matches the symbols of each
+    /// of them in a lexer mode of its own, so a document that mixes them can be lexed by a single DFA. This table lets
+    /// the parser switch between the modes (see parser::state::set_mode_lexer): the mode for a state is the one that
+    /// all of the terminals that it expects are matched in. States that expect terminals from more than one mode, or
+    /// only terminals that are matched in more than one mode, leave the lexer in whatever mode it is already in.
+    ///
+    class lexer_mode_table {
+    private:
+        /// \brief The mode for each state, or -1 for states that don't switch mode
+        std::vector<int> m_ModeForState;
+        
+    public:
+        /// \brief Creates an empty table, which never switches mode
+        lexer_mode_table();
+        
+        /// \brief Creates a table for the specified parser tables
+        ///
+        /// terminalModes gives the mode each terminal is matched in, or -1 for terminals that are matched in more than
+        /// one mode. The tables must have their expected terminals (see parser_tables::compile_expected_terminals()),
+        /// or no state will switch mode.
+        lexer_mode_table(const parser_tables& tables, const std::vector<int>& terminalModes);
+        
+        /// \brief The mode that the lexer should be in when reading a lookahead in the specified state, or -1 to leave it as it is
+        inline int mode_for_state(int state) const {
+            if (state < 0 || state >= (int) m_ModeForState.size()) return -1;
+            return m_ModeForState[state];
+        }
+        
+        /// \brief The number of states in this table
+        inline int count_states() const { return (int) m_ModeForState.size(); }
+        
+        /// \brief The number of bytes used by this table
+        inline size_t memory_usage() const { return sizeof(*this) + m_ModeForState.capacity() * sizeof(int); }
+    };
+}
+
+#endif
@@ -0,0 +1,122 @@
+//
+//  lookahead_buffer.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include "TameParse/Lr/lookahead_buffer.h"
+
+using namespace dfa;
+using namespace lr;
+
+/// \brief Empty container used to release the lexemes in fixed storage (without allocating a new lexeme)
+static const lexeme_container c_NoLexeme((lexeme*) NULL, false);
+
+/// \brief Creates an empty buffer that grows as needed
+lookahead_buffer::lookahead_buffer()
+: m_Storage(NULL)
+, m_Capacity(0)
+, m_First(0)
+, m_Count(0) {
+}
+
+/// \brief Creates an empty buffer that stores its lexemes in the specified array, and never grows
+lookahead_buffer::lookahead_buffer(lexeme_container* storage, size_t capacity)
+: m_Storage(storage)
+, m_Capacity(capacity)
+, m_First(0)
+, m_Count(0) {
+}
+
+/// \brief Removes the specified number of lexemes from the start of this buffer
+void lookahead_buffer::pop_front(size_t count) {
+    if (!m_Storage) {
+        m_Lexemes.erase(m_Lexemes.begin(), m_Lexemes.begin() + count);
+        return;
+    }
+    
+    // Release the lexemes as they're removed
+    for (size_t index = 0; index < count; ++index) {
+        m_Storage[storage_index(index)] = c_NoLexeme;
+    }
+    
+    m_First = storage_index(count);
+    m_Count -= count;
+}
+
+/// \brief Inserts a lexeme before the one at the specified index, returning false if the buffer is full
+bool lookahead_buffer::insert(size_t index, const lexeme_container& lexeme) {
+    if (!m_Storage) {
+        m_Lexemes.insert(m_Lexemes.begin() + index, lexeme);
+        return true;
+    }
+    
+    if (m_Count >= m_Capacity) return false;
+    
+    // Move the following lexemes up to make space
+    for (size_t pos = m_Count; pos > index; --pos) {
+        m_Storage[storage_index(pos)] = m_Storage[storage_index(pos - 1)];
+    }
+    
+    m_Storage[storage_index(index)] = lexeme;
+    ++m_Count;
+    return true;
+}
+
+/// \brief Removes the lexeme at the specified index
+void lookahead_buffer::erase(size_t index) {
+    if (!m_Storage) {
+        m_Lexemes.erase(m_Lexemes.begin() + index);
+        return;
+    }
+    
+    for (size_t pos = index; pos + 1 < m_Count; ++pos) {
+        m_Storage[storage_index(pos)] = m_Storage[storage_index(pos + 1)];
+    }
+    
+    --m_Count;
+    m_Storage[storage_index(m_Count)] = c_NoLexeme;
+}
+
+/// \brief Removes all of the lexemes from this buffer
+void lookahead_buffer::clear() {
+    if (!m_Storage) {
+        m_Lexemes.clear();
+        return;
+    }
+    
+    pop_front(m_Count);
+    m_First = 0;
+}
+
+/// \brief The number of bytes used by this buffer and the lexemes in it
+size_t lookahead_buffer::memory_usage() const {
+    size_t total = sizeof(*this);
+    if (!m_Storage) total += m_Lexemes.size() * sizeof(lexeme_container);
+    
+    for (size_t index = 0; index < size(); ++index) {
+        const lexeme* item = (*this)[index].item();
+        if (item) total += item->memory_usage();
+    }
+    
+    return total;
+}
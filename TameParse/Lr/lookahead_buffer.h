@@ -0,0 +1,127 @@
+//
+//  lookahead_buffer.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _LR_LOOKAHEAD_BUFFER_H
+#define _LR_LOOKAHEAD_BUFFER_H
+
+#include <deque>
+
+#include "TameParse/Dfa/lexeme.h"
+#include "TameParse/Util/memory_resource.h"
+
+namespace lr {
+    ///
+    /// \brief The lexemes in the lookahead of a parser session
+    ///
+    /// Lexemes are added at the end and removed from the start. By default these are kept in a deque, which grows as
+    /// needed using the memory_resource that was current when the buffer was created. Alternatively, the caller can
+    /// supply a fixed array, which is used as a ring buffer: this never allocates, but push_back() fails once the
+    /// array is full.
+    ///
+    /// In either case, adding lexemes doesn't invalidate references to the lexemes that are already in the buffer.
+    ///
+    class lookahead_buffer {
+    private:
+        /// \brief The lexemes, if no fixed storage was supplied
+        std::deque<dfa::lexeme_container, util::resource_allocator<dfa::lexeme_container> > m_Lexemes;
+        
+        /// \brief NULL, or the fixed storage supplied by the caller
+        dfa::lexeme_container* m_Storage;
+        
+        /// \brief The number of entries in m_Storage
+        size_t m_Capacity;
+        
+        /// \brief The index in m_Storage of the first lexeme
+        size_t m_First;
+        
+        /// \brief The number of lexemes in m_Storage
+        size_t m_Count;
+        
+        lookahead_buffer(const lookahead_buffer& copyFrom);
+        lookahead_buffer& operator=(const lookahead_buffer& copyFrom);
+        
+        /// \brief The entry in m_Storage for the lexeme at the specified index
+        inline size_t storage_index(size_t index) const {
+            index += m_First;
+            return index >= m_Capacity ? index - m_Capacity : index;
+        }
+    
+    public:
+        /// \brief Creates an empty buffer that grows as needed
+        lookahead_buffer();
+        
+        /// \brief Creates an empty buffer that stores its lexemes in the specified array, and never grows
+        ///
+        /// The array must remain valid for as long as this object exists.
+        lookahead_buffer(dfa::lexeme_container* storage, size_t capacity);
+        
+        /// \brief True if this buffer uses fixed storage
+        inline bool fixed() const { return m_Storage != NULL; }
+        
+        /// \brief The number of lexemes in this buffer
+        inline size_t size() const { return m_Storage ? m_Count : m_Lexemes.size(); }
+        
+        /// \brief True if no more lexemes can be added to this buffer
+        inline bool full() const { return m_Storage && m_Count >= m_Capacity; }
+        
+        /// \brief The lexeme at the specified index
+        inline const dfa::lexeme_container& operator[](size_t index) const {
+            return m_Storage ? m_Storage[storage_index(index)] : m_Lexemes[index];
+        }
+        
+        /// \brief Adds a lexeme to the end of this buffer, returning false if it is full
+        inline bool push_back(const dfa::lexeme_container& lexeme) {
+            if (!m_Storage) {
+                m_Lexemes.push_back(lexeme);
+                return true;
+            }
+            
+            if (m_Count >= m_Capacity) return false;
+            
+            m_Storage[storage_index(m_Count)] = lexeme;
+            ++m_Count;
+            return true;
+        }
+        
+        /// \brief Removes the specified number of lexemes from the start of this buffer
+        void pop_front(size_t count);
+        
+        /// \brief Inserts a lexeme before the one at the specified index, returning false if the buffer is full
+        bool insert(size_t index, const dfa::lexeme_container& lexeme);
+        
+        /// \brief Removes the lexeme at the specified index
+        void erase(size_t index);
+        
+        /// \brief Removes all of the lexemes from this buffer
+        void clear();
+        
+        /// \brief The number of bytes used by this buffer and the lexemes in it
+        ///
+        /// Fixed storage belongs to the caller, so only the lexemes stored in it are counted.
+        size_t memory_usage() const;
+    };
+}
+
+#endif
@@ -74,6 +74,14 @@ void lr1_rewriter::rewrite_actions(int stateId, lr_action_set& actions, const la
 
     // Fetch the state
     const lalr_state& state = *builder.machine().state_with_id(stateId);
+    
+    // Find the items that cause a reduction (these are the same for every conflict in the state)
+    vector<int> reducingItems;
+    for (int lrItemId = 0; lrItemId < state.count_items(); ++lrItemId) {
+        if (state[lrItemId]->at_end()) {
+            reducingItems.push_back(lrItemId);
+        }
+    }
 
     // Find items which have reduce/reduce conflicts
     // (LALR parsers can have reduce/reduce conflicts that LR(1) parsers do not)
@@ -87,18 +95,17 @@ void lr1_rewriter::rewrite_actions(int stateId, lr_action_set& actions, const la
         // Find the target states for this item and nonterminal
         map<int, set<int> > targetStateForItem;
 
-        for (int lrItemId = 0; lrItemId < state.count_items(); ++lrItemId) {
+        for (vector<int>::const_iterator reducingItem = reducingItems.begin(); reducingItem != reducingItems.end(); ++reducingItem) {
             // Fetch this item
-            const lr0_item& lrItem = *state[lrItemId];
-
-            // This item must cause a reduction
-            if (!lrItem.at_end()) continue;
+            int             lrItemId    = *reducingItem;
+            const lr0_item& lrItem      = *state[lrItemId];
 
             // It must contain the target terminal in the lookahead
             const item_set& lookahead = state.lookahead_for(lrItemId);
             if (!lookahead.contains(reduceTerminal)) continue;
 
-            // Find the lookahead source for this item
+            // Find the lookahead source for this item (the builder caches these, as the same items often cause conflicts
+            // in several states)
             typedef lalr_builder::lr_item_id lr_item_id;
             set<lr_item_id> sourceItems;
             builder.find_lookahead_source(stateId, lrItemId, reduceTerminal, sourceItems);
@@ -26,6 +26,7 @@
 //
 
 #include "TameParse/Lr/lr_action.h"
+#include "TameParse/ContextFree/grammar.h"
 
 using namespace contextfree;
 using namespace lr;
@@ -67,3 +68,34 @@ lr_action::lr_action(const lr_action& copyFrom, const contextfree::item_containe
 , m_Rule(copyFrom.m_Rule) {
 }
 
+/// \brief True if this action was created with a rule (false for shift and goto actions)
+bool lr_action::has_rule() const {
+    return (const contextfree::rule*) m_Rule != &an_empty_rule;
+}
+
+/// \brief Creates the compact representation of an action
+compact_action::compact_action(const lr_action& action, const grammar& gram)
+: item_kind((unsigned short) action.item()->type())
+, type((unsigned short) action.type())
+, symbol(action.item()->type() == item::terminal ? action.item()->symbol() : gram.identifier_for_item(action.item()))
+, next_state(action.next_state())
+, rule(action.has_rule() ? action.rule()->identifier(gram) : -1) {
+}
+
+/// \brief Retrieves the item that this action refers to
+item_container compact_action::item(const grammar& gram) const {
+    if (is_terminal()) {
+        return item_container(new terminal(symbol), true);
+    }
+    
+    return gram.item_with_identifier(symbol);
+}
+
+/// \brief Creates an lr_action equivalent to this one
+lr_action_container compact_action::to_action(const grammar& gram) const {
+    if (rule < 0) {
+        return lr_action_container(new lr_action((lr_action::action_type) type, item(gram), next_state), true);
+    } else {
+        return lr_action_container(new lr_action((lr_action::action_type) type, item(gram), next_state, gram.rule_with_identifier(rule)), true);
+    }
+}
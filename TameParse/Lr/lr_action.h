@@ -29,6 +29,7 @@
 #define _LR_LR_ACTION_H
 
 #include <set>
+#include <vector>
 
 #include "TameParse/ContextFree/item.h"
 #include "TameParse/ContextFree/rule.h"
@@ -103,7 +104,15 @@ namespace lr {
             ///
             /// If the guard rule is accepted, then the guard symbol is set as the lookahead (this is retrieved from the rule
             /// that is reduced)
-            act_guard
+            act_guard,
+            
+            /// \brief If the terminal is seen, then it is shifted and the parser immediately performs the default reduction of the state it
+            /// moves to
+            ///
+            /// This is generated by parser_tables::combine_shift_reduce for shift actions whose new state always reduces the same
+            /// (non-empty) rule, such as shifting a literal and reducing it to a primary expression. The parser doesn't need to read
+            /// another symbol or look up the actions for the intermediate state. The next state field is the same as for a shift action.
+            act_shiftreduce
         };
         
     private:
@@ -168,6 +177,9 @@ namespace lr {
         /// \brief The rule that this refers to.
         inline const contextfree::rule_container& rule() const { return m_Rule; }
         
+        /// \brief True if this action was created with a rule (false for shift and goto actions)
+        bool has_rule() const;
+        
         /// \brief Clones an existing action
         inline lr_action* clone() const {
             return new lr_action(*this);
@@ -188,6 +200,67 @@ namespace lr {
     
     /// \brief Set of LR actions
     typedef std::set<lr_action_container> lr_action_set;
+    
+    ///
+    /// \brief Compact representation of an LR action, used while building parser tables
+    ///
+    /// Items and rules are replaced by their identifiers, so these actions can be copied and compared cheaply. The
+    /// symbol is the terminal symbol for terminal items, and the grammar identifier for any other kind of item. Actions
+    /// order by item first, so sorting a list of these actions places all of the actions for an item together.
+    ///
+    struct compact_action {
+        /// \brief The kind of item that this action refers to (a contextfree::item::kind)
+        unsigned short item_kind;
+        
+        /// \brief The type of this action (an lr_action::action_type)
+        unsigned short type;
+        
+        /// \brief The terminal symbol (for terminal items) or the grammar identifier of the item
+        int symbol;
+        
+        /// \brief The state to enter if this item is seen
+        int next_state;
+        
+        /// \brief The identifier of the rule for this action, or -1 if it has no rule
+        int rule;
+        
+        /// \brief Creates the compact representation of an action
+        compact_action(const lr_action& action, const contextfree::grammar& gram);
+        
+        /// \brief True if this action refers to a terminal symbol
+        inline bool is_terminal() const { return item_kind == contextfree::item::terminal; }
+        
+        /// \brief True if this action refers to the same item as another
+        inline bool same_item(const compact_action& compareTo) const {
+            return item_kind == compareTo.item_kind && symbol == compareTo.symbol;
+        }
+        
+        /// \brief Retrieves the item that this action refers to
+        contextfree::item_container item(const contextfree::grammar& gram) const;
+        
+        /// \brief Creates an lr_action equivalent to this one
+        lr_action_container to_action(const contextfree::grammar& gram) const;
+        
+        /// \brief Orders this action
+        inline bool operator<(const compact_action& compareTo) const {
+            if (item_kind != compareTo.item_kind)   return item_kind < compareTo.item_kind;
+            if (symbol != compareTo.symbol)         return symbol < compareTo.symbol;
+            if (type != compareTo.type)             return type < compareTo.type;
+            if (next_state != compareTo.next_state) return next_state < compareTo.next_state;
+            return rule < compareTo.rule;
+        }
+        
+        /// \brief Determines whether or not this action is the same as another
+        inline bool operator==(const compact_action& compareTo) const {
+            return item_kind == compareTo.item_kind && symbol == compareTo.symbol && type == compareTo.type 
+                && next_state == compareTo.next_state && rule == compareTo.rule;
+        }
+        
+        inline bool operator!=(const compact_action& compareTo) const { return !operator==(compareTo); }
+    };
+    
+    /// \brief List of compact actions
+    typedef std::vector<compact_action> compact_action_list;
 }
 
 #endif
@@ -34,14 +34,16 @@ using namespace lr;
 lr0_item::lr0_item(const grammar* gram, const contextfree::rule& r, int offset)
 : m_Rule(r)
 , m_Offset(offset)
-, m_Grammar(gram) {
+, m_Grammar(gram)
+, m_RuleId(-1) {
 }
 
 /// \brief Creates an LR(0) item by referencing an existing rule
 lr0_item::lr0_item(const grammar* gram, contextfree::rule* r, int offset)
 : m_Rule(r)
 , m_Offset(offset)
-, m_Grammar(gram) {
+, m_Grammar(gram)
+, m_RuleId(-1) {
 }
 
 
@@ -49,14 +51,16 @@ lr0_item::lr0_item(const grammar* gram, contextfree::rule* r, int offset)
 lr0_item::lr0_item(const contextfree::grammar* gram, const contextfree::rule_container& r, int offset)
 : m_Rule(r)
 , m_Offset(offset)
-, m_Grammar(gram) {
+, m_Grammar(gram)
+, m_RuleId(-1) {
 }
 
 /// \brief Creates a copy of an existing LR(0) item
 lr0_item::lr0_item(const lr0_item& copyFrom)
 : m_Rule(copyFrom.m_Rule)
 , m_Offset(copyFrom.m_Offset)
-, m_Grammar(copyFrom.m_Grammar) {
+, m_Grammar(copyFrom.m_Grammar)
+, m_RuleId(copyFrom.m_RuleId) {
 }
 
 
@@ -64,7 +68,8 @@ lr0_item::lr0_item(const lr0_item& copyFrom)
 lr0_item::lr0_item(const lr0_item& copyFrom, int newOffset)
 : m_Rule(copyFrom.m_Rule)
 , m_Offset(newOffset)
-, m_Grammar(copyFrom.m_Grammar) {
+, m_Grammar(copyFrom.m_Grammar)
+, m_RuleId(copyFrom.m_RuleId) {
 }
 
 /// \brief Copies an LR(0) item into this one
@@ -74,6 +79,7 @@ lr0_item& lr0_item::operator=(const lr0_item& copyFrom) {
     m_Rule      = copyFrom.m_Rule;
     m_Offset    = copyFrom.m_Offset;
     m_Grammar   = copyFrom.m_Grammar;
+    m_RuleId    = copyFrom.m_RuleId;
     
     return *this;
 }
@@ -83,20 +89,14 @@ bool lr0_item::operator<(const lr0_item& compareTo) const {
     if (m_Offset < compareTo.m_Offset) return true;
     if (m_Offset > compareTo.m_Offset) return false;
     
-    int ourId   = rule()->identifier(*m_Grammar);
-    int theirId = compareTo.rule()->identifier(*m_Grammar);
-    
-    return ourId < theirId;
+    return rule_identifier() < compareTo.rule_identifier();
 }
 
 /// \brief Compares two LR(0) items
 bool lr0_item::operator==(const lr0_item& compareTo) const {
     if (m_Offset != compareTo.m_Offset) return false;
     
-    int ourId   = rule()->identifier(*m_Grammar);
-    int theirId = compareTo.rule()->identifier(*m_Grammar);
-    
-    return ourId == theirId;
+    return rule_identifier() == compareTo.rule_identifier();
 }
 
 /// \brief Constructs an LR(1) item by appending lookahead to an LR(0) item
@@ -28,6 +28,9 @@
 #ifndef _LR_LR_ITEM_H
 #define _LR_LR_ITEM_H
 
+#include <vector>
+#include <stdint.h>
+
 #include "TameParse/Util/container.h"
 #include "TameParse/ContextFree/grammar.h"
 #include "TameParse/ContextFree/item_set.h"
@@ -48,6 +51,18 @@ namespace lr {
     /// \brief Set of LR(0) items
     typedef std::set<lr0_item_container> lr0_item_set;
     
+    /// \brief An LR(0) item packed into a single integer, as (rule identifier << packed_offset_bits) | offset
+    ///
+    /// Packed items are only meaningful within a single grammar. Grammars with more than 2^20 rules or rules
+    /// longer than 4095 items can't be represented this way.
+    typedef uint32_t packed_lr0_item;
+    
+    /// \brief The number of bits used to store the offset in a packed LR(0) item
+    static const int packed_offset_bits = 12;
+    
+    /// \brief A kernel represented as a sorted list of packed items
+    typedef std::vector<packed_lr0_item> packed_kernel;
+    
     ///
     /// \brief Representation of an LR(0) item
     ///
@@ -70,6 +85,12 @@ namespace lr {
         /// \brief The offset into the rule
         int m_Offset;
         
+        /// \brief The identifier of the rule in the grammar, or -1 if it hasn't been looked up yet
+        ///
+        /// Looking up a rule identifier means searching the grammar, so this is cached the first time that
+        /// the item is compared.
+        mutable int m_RuleId;
+        
     public:
         /// \brief Creates an LR(0) item by copying a rule
         lr0_item(const contextfree::grammar* gram, const contextfree::rule& rule, int offset);
@@ -105,6 +126,17 @@ namespace lr {
         /// \brief The offset for this item
         inline int offset() const { return m_Offset; }
         
+        /// \brief The identifier of the rule for this item
+        inline int rule_identifier() const {
+            if (m_RuleId < 0) m_RuleId = m_Rule->identifier(*m_Grammar);
+            return m_RuleId;
+        }
+        
+        /// \brief This item packed into a single integer
+        inline packed_lr0_item packed() const {
+            return (((packed_lr0_item) rule_identifier()) << packed_offset_bits) | (packed_lr0_item) m_Offset;
+        }
+        
         /// \brief True if this item is at the end of the rule (ie, is in a reducing state)
         inline bool at_end() const { return offset() >= (int) rule()->items().size(); }
 
@@ -0,0 +1,128 @@
+//
+//  parse_error.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _LR_PARSE_ERROR_H
+#define _LR_PARSE_ERROR_H
+
+#include "TameParse/Dfa/position.h"
+
+namespace lr {
+    ///
+    /// \brief Description of a syntax error found by a parser that is recovering from errors
+    ///
+    class parse_error {
+    public:
+        /// \brief The ways that the parser can recover from an error
+        enum repair {
+            /// \brief One or more symbols were removed from the input
+            deleted_symbols,
+            
+            /// \brief A symbol was inserted into the input (after deleting any symbols indicated by deleted())
+            inserted_symbol,
+            
+            /// \brief States were removed from the parser stack and symbols were skipped until the parser could continue
+            skipped_to_recovery,
+            
+            /// \brief The parser was unable to recover from the error
+            not_repaired
+        };
+        
+    private:
+        /// \brief The position of the symbol that caused the error
+        dfa::position m_Position;
+        
+        /// \brief The symbol that caused the error
+        int m_Unexpected;
+        
+        /// \brief How the parser recovered from the error
+        repair m_Repair;
+        
+        /// \brief The number of symbols that were removed from the input
+        int m_Deleted;
+        
+        /// \brief The symbol that was inserted into the input, or -1
+        int m_Inserted;
+        
+        /// \brief The number of states that were popped from the parser stack
+        int m_Popped;
+        
+        /// \brief The state on top of the parser stack when the error was found, or -1
+        int m_State;
+        
+    public:
+        /// \brief Describes a new error
+        parse_error(const dfa::position& pos, int unexpected, repair repairType, int deleted = 0, int inserted = -1, int popped = 0, int state = -1)
+        : m_Position(pos)
+        , m_Unexpected(unexpected)
+        , m_Repair(repairType)
+        , m_Deleted(deleted)
+        , m_Inserted(inserted)
+        , m_Popped(popped)
+        , m_State(state) {
+        }
+        
+        /// \brief The position of the symbol that caused the error (or -1, -1, -1 for the end of input)
+        inline const dfa::position& pos() const { return m_Position; }
+        
+        /// \brief The identifier of the symbol that caused the error
+        ///
+        /// This is a terminal identifier, or the end of input symbol in the parser tables if the input ended early
+        inline int unexpected() const { return m_Unexpected; }
+        
+        /// \brief How the parser recovered from the error
+        inline repair repair_type() const { return m_Repair; }
+        
+        /// \brief The number of symbols removed from the input
+        inline int deleted() const { return m_Deleted; }
+        
+        /// \brief The terminal symbol inserted into the input, or -1 if no symbol was inserted
+        inline int inserted() const { return m_Inserted; }
+        
+        /// \brief The number of states removed from the parser stack
+        inline int popped() const { return m_Popped; }
+        
+        /// \brief The state on top of the parser stack when the error was found, or -1 if it isn't known
+        ///
+        /// parser_tables::first_expected() and last_expected() give the terminals that would have been accepted in
+        /// this state, so messages like 'expected X or Y' don't need to look at the parser actions.
+        inline int state() const { return m_State; }
+    };
+    
+    ///
+    /// \brief Callback used by parsers to report the syntax errors they recover from
+    ///
+    class parse_error_handler {
+    public:
+        /// \brief Destructor
+        virtual ~parse_error_handler() { }
+        
+        /// \brief Called when the parser finds an error
+        ///
+        /// The parser has already recovered from the error when this is called (unless the repair type is not_repaired)
+        virtual void syntax_error(const parse_error& error) = 0;
+    };
+}
+
+#endif
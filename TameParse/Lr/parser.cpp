@@ -26,3 +26,5 @@
 //
 
 #include "TameParse/Lr/parser.h"
+
+template class lr::parser<int, lr::simple_parser_actions>;
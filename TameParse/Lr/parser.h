@@ -29,14 +29,22 @@
 #define _LR_PARSER_H
 
 #include <vector>
+#include <deque>
 #include <stack>
+#include <map>
 #include <iostream>
 
 #include "TameParse/Dfa/lexeme.h"
+#include "TameParse/Dfa/lexeme_interner.h"
 #include "TameParse/Dfa/basic_lexer.h"
+#include "TameParse/Dfa/token_array.h"
 #include "TameParse/Lr/lalr_builder.h"
 #include "TameParse/Lr/parser_tables.h"
+#include "TameParse/Lr/lexer_mode_table.h"
+#include "TameParse/Lr/speculative_guard_stream.h"
+#include "TameParse/Lr/parse_error.h"
 #include "TameParse/Lr/parser_stack.h"
+#include "TameParse/Lr/lookahead_buffer.h"
 
 namespace lr {
     
@@ -51,10 +59,109 @@ namespace lr {
             reject,
             
             /// \brief The language was accepted (reached the end and was reduced to a single nonterminal)
-            accept
+            accept,
+            
+            /// \brief More lexemes need to be pushed before the parser can continue
+            ///
+            /// This is only returned by parsers created with create_push_parser()
+            need_input,
+            
+            /// \brief The fixed storage for the parser stack or the lookahead is full
+            ///
+            /// This is only returned by parsers created with create_bounded_parser(). The parse can't continue.
+            overflow,
+            
+            /// \brief A lexeme was longer, or the parser needed to look further ahead, than the parser_limits allow
+            ///
+            /// This is only returned by parsers that have been given limits with set_limits(). The parse can't continue.
+            limit_exceeded
         };
     };
     
+    ///
+    /// \brief Limits on how much input a parser will buffer while it looks ahead
+    ///
+    /// Without limits, pathological input (an unterminated string, or a guard that never finds the end of its
+    /// pattern) makes a parser buffer everything up to the end of the input. A parser with limits stops with
+    /// parser_result::limit_exceeded instead. A value of 0 means that there is no limit.
+    ///
+    /// The parser can only check the length of lexemes once the lexer has matched them: to stop the lexer itself from
+    /// buffering a long lexeme, also call lexeme_stream::set_max_lexeme_length() with the same length.
+    ///
+    class parser_limits {
+    public:
+        /// \brief The largest number of input symbols in a lexeme
+        int maxLexemeLength;
+        
+        /// \brief The largest number of lexemes that a single guard can read
+        int maxGuardLookahead;
+        
+        /// \brief The largest number of lexemes that the parser can hold in its lookahead at once
+        int maxLookahead;
+        
+    public:
+        /// \brief Creates a set of limits that don't limit anything
+        inline parser_limits()
+        : maxLexemeLength(0)
+        , maxGuardLookahead(0)
+        , maxLookahead(0) {
+        }
+        
+        /// \brief Creates a set of limits with the specified values
+        inline parser_limits(int lexemeLength, int guardLookahead, int lookahead)
+        : maxLexemeLength(lexemeLength)
+        , maxGuardLookahead(guardLookahead)
+        , maxLookahead(lookahead) {
+        }
+    };
+    
+    ///
+    /// \brief Counts how close a parser has come to its limits, and how often they were exceeded
+    ///
+    /// These are updated whether or not the parser has any limits, so they can be used to choose them.
+    ///
+    class parser_limit_counters {
+    public:
+        /// \brief The number of input symbols in the longest lexeme that was read
+        long longestLexeme;
+        
+        /// \brief The largest number of lexemes that were held in the lookahead at once
+        long deepestLookahead;
+        
+        /// \brief The largest number of lexemes that were read by a single guard
+        long deepestGuardLookahead;
+        
+        /// \brief The number of times a lexeme was longer than parser_limits::maxLexemeLength
+        long lexemesTooLong;
+        
+        /// \brief The number of times the lookahead would have held more than parser_limits::maxLookahead lexemes
+        long lookaheadExceeded;
+        
+        /// \brief The number of times a guard would have read more than parser_limits::maxGuardLookahead lexemes
+        long guardLookaheadExceeded;
+        
+        /// \brief The number of guards that were run against the lookahead (checks answered by an earlier result for the
+        /// same guard at the same position aren't counted)
+        long guardsEvaluated;
+        
+    public:
+        /// \brief Creates a new set of counters, all set to zero
+        inline parser_limit_counters() {
+            reset();
+        }
+        
+        /// \brief Sets all of the counters back to zero
+        inline void reset() {
+            longestLexeme           = 0;
+            deepestLookahead        = 0;
+            deepestGuardLookahead   = 0;
+            lexemesTooLong          = 0;
+            lookaheadExceeded       = 0;
+            guardLookaheadExceeded  = 0;
+            guardsEvaluated         = 0;
+        }
+    };
+    
     ///
     /// \brief Parser trace class that performs no actions
     ///
@@ -74,6 +181,13 @@ namespace lr {
         inline void goto_state(int newState)                                { }
         inline void checked_guard(int initialState, int result)             { }
         inline void reject(const lexeme_container& lookahead)               { }
+        inline void substitute_strong(const lexeme_container& strongLexeme) { }
+        inline void lookahead(int offset)                                   { }
+        
+        inline void reading_lexeme()                                        { }
+        inline void read_lexeme(const lexeme* nextLexeme)                   { }
+        inline void checking_guard(int initialState)                        { }
+        inline void reduced(int nonterminalId, int ruleId)                  { }
     };
     
     ///
@@ -111,15 +225,24 @@ namespace lr {
             std::wcerr << L"REJECT: " << lookahead->content<wchar_t>() << L" (" << lookahead->matched() << L")" << std::endl;
             std::wcerr << L"At line: " << lookahead->pos().line() << std::endl;
         }
+        
+        inline void substitute_strong(const lexeme_container& strongLexeme) {
+            if (level > 0) {
+                std::wcerr << L"STRONG: " << strongLexeme->content<wchar_t>() << L" (" << strongLexeme->matched() << L")" << std::endl;
+            }
+        }
     };
 
     ///
     /// \brief Generic parser implementation.
     ///
-    template<typename item_type, typename parser_actions, typename parser_trace = no_parser_trace> class parser {
+    /// The tables_type is parser_tables by default. Generated parsers for small grammars can use compact_parser_tables
+    /// instead, which stores the same tables in narrower integers.
+    ///
+    template<typename item_type, typename parser_actions, typename parser_trace = no_parser_trace, typename tables_type = parser_tables> class parser {
     private:
         /// \brief The parser tables
-        const parser_tables* m_ParserTables;
+        const tables_type* m_ParserTables;
         
         /// \brief True if this object owns the tables (and should destroy them)
         bool m_OwnsTables;
@@ -130,7 +253,13 @@ namespace lr {
         typedef dfa::lexeme_container lexeme_container;
         
         /// \brief Parser action
-        typedef parser_tables::action action;
+        typedef typename tables_type::action action;
+        
+        /// \brief Iterator for the actions in the parser tables
+        typedef typename tables_type::action_iterator action_iterator;
+        
+        /// \brief Reduce rule in the parser tables
+        typedef typename tables_type::reduce_rule reduce_rule;
         
         /// \brief The parser stack
         typedef parser_stack<item_type> stack;
@@ -142,21 +271,22 @@ namespace lr {
         class state;
         
         /// \brief Creates a parser by copying the tables
-        explicit parser(const parser_tables& tables) 
-        : m_ParserTables(new parser_tables(tables))
+        explicit parser(const tables_type& tables) 
+        : m_ParserTables(new tables_type(tables))
         , m_OwnsTables(true) { }
         
         /// \brief Creates a parser with a reference to the tables it should use.
         ///
-        /// Set destroyTables to true if the parser should delete the tables when it is destructed.
-        parser(const parser_tables* tables, bool destroyTables)
+        /// Set destroyTables to true if the parser should delete the tables when it is destructed. Generated parsers
+        /// use this to declare static parsers that can be initialised when the program is compiled.
+        TAMEPARSE_CONSTEXPR parser(const tables_type* tables, bool destroyTables)
         : m_ParserTables(tables)
         , m_OwnsTables(destroyTables) {
         }
 
         /// \brief Creates a parser from the result of the specified builder class
         parser(const lalr_builder& builder, const weak_symbols* weakSymbols) 
-        : m_ParserTables(new parser_tables(builder, weakSymbols))
+        : m_ParserTables(new tables_type(builder, weakSymbols))
         , m_OwnsTables(true) { }
         
         /// \brief Copy constructor
@@ -165,7 +295,7 @@ namespace lr {
             // (For hard-coded parsers, the tables often aren't, so there's no need to copy)
             if (copyFrom.m_OwnsTables) {
                 m_OwnsTables    = true;
-                m_ParserTables  = new parser_tables(*copyFrom.m_ParserTables);
+                m_ParserTables  = new tables_type(*copyFrom.m_ParserTables);
             } else {
                 m_OwnsTables    = false;
                 m_ParserTables  = copyFrom.m_ParserTables;
@@ -189,15 +319,25 @@ namespace lr {
         /// ensuring that the symbols remain in memory when they're needed, and are removed once there are
         /// no more states referring to them.
         ///
-        class session {
+        /// Sessions, states and their lookahead and stacks are allocated from the util::memory_resource that is
+        /// current when the state is created, so a parser can be made to allocate from an arena by creating its
+        /// state inside a util::memory_resource_scope. The resource must outlast the state.
+        ///
+        class session : public util::arena_object {
         public:
             friend class state;
             
             /// \brief Session lookahead
-            typedef std::vector<dfa::lexeme_container> lookahead_list;
+            ///
+            /// Symbols are added at the end and trimmed from the start: trimming doesn't have to move the symbols that
+            /// remain, and adding symbols doesn't invalidate references to the existing ones.
+            typedef lookahead_buffer lookahead_list;
             
         private:
             /// \brief The symbols that are in the parser lookahead
+            ///
+            /// States store their position relative to the start of this list (m_LookaheadBase is the position of the
+            /// first symbol in the input)
             lookahead_list m_Lookahead;
             
             /// \brief Set to true if we've reached the end of the file
@@ -208,18 +348,213 @@ namespace lr {
             
             /// \brief The parser actions for this session
             parser_actions* m_Actions;
+            
+            /// \brief Scratch space used by the speculative stacks created when checking whether or not symbols can be reduced
+            std::vector<int> m_SpeculativeStates;
+            
+            /// \brief Set to true when a speculative check has needed to read a state from the real parser stack
+            bool m_ReadUnderlyingStack;
+            
+            /// \brief Maps (state, symbol) pairs to the cached results of can_reduce
+            ///
+            /// The values are 0 or 1 for results that only depend on the parser tables, or c_DependsOnStack for results
+            /// that depend on what is further down the parser stack (which can't be cached)
+            typedef std::map<std::pair<int, int>, int> can_reduce_cache;
+            
+            /// \brief Value stored in a can_reduce_cache for results that can't be cached
+            static const int c_DependsOnStack = -1;
+            
+            /// \brief Cached can_reduce results, for terminal (0) and nonterminal (1) symbols
+            can_reduce_cache m_CanReduceCache[2];
+            
+            /// \brief The number of symbols that have been trimmed from the start of the lookahead
+            ///
+            /// Adding this to a position in m_Lookahead gives the position of that symbol in the input
+            int m_LookaheadBase;
+            
+            /// \brief Maps (input position, guard initial state) pairs to the result of check_guard
+            ///
+            /// The result is the accepted guard symbol, or -1 if the guard was rejected. Entries are removed once the
+            /// lookahead they refer to is trimmed.
+            typedef std::map<std::pair<int, int>, int> guard_cache;
+            
+            /// \brief The results of the guards evaluated in this session
+            guard_cache m_GuardCache;
+            
+            /// \brief True if lexemes are pushed into this session rather than being read from the parser actions
+            bool m_PushInput;
+            
+            /// \brief Set to true when a parser in a push session has tried to read past the lexemes pushed so far
+            bool m_NeedInput;
+            
+            /// \brief True if this session uses fixed storage, and shouldn't allocate while parsing
+            bool m_Bounded;
+            
+            /// \brief Set to true when the fixed storage for the lookahead is full
+            bool m_Overflow;
+            
+            /// \brief Scratch list used to pass the items for each reduction to the parser actions
+            reduce_list m_ReduceItems;
+            
+            /// \brief NULL, or the table used to intern lexemes as they are added to the lookahead (not owned by the session)
+            dfa::lexeme_interner* m_Interner;
+            
+            /// \brief The limits on the lookahead for this session
+            parser_limits m_Limits;
+            
+            /// \brief NULL, or the counters to update as lexemes are added to the lookahead (not owned by the session)
+            parser_limit_counters* m_Counters;
+            
+            /// \brief Set to true when the input has exceeded one of the limits
+            bool m_LimitExceeded;
+            
+            /// \brief NULL, or the stream that is told which terminals are valid before each lexeme is read (not owned by the session)
+            dfa::lexeme_stream* m_ContextLexer;
+            
+            /// \brief NULL, or the stream that is switched into the lexer mode for each state before a lexeme is read (not owned by the session)
+            dfa::lexeme_stream* m_ModeLexer;
+            
+            /// \brief The lexer modes to use for each state, if m_ModeLexer is not NULL (not owned by the session)
+            const lexer_mode_table* m_LexerModes;
+            
+            /// \brief NULL, or the stream whose guard results are added to the guard cache as each lexeme is read (not owned by the session)
+            const speculative_guard_stream* m_GuardSpeculator;
+            
+            /// \brief True while parse_document() is parsing one of several documents in the input
+            bool m_ParsingDocument;
+            
+            /// \brief The terminal that separates documents, or -1 if they follow each other directly
+            int m_DocumentSeparator;
+            
+            /// \brief Set to true once the end of the current document has been found, after which the lookahead is
+            /// treated as the end of the input
+            bool m_EndOfDocument;
+            
+            /// \brief Checks that a lexeme can be added to the lookahead without exceeding the limits
+            ///
+            /// Returns false, and notes that a limit was exceeded, if the lexeme is too long or the lookahead is full
+            inline bool within_limits(const dfa::lexeme* newLexeme) {
+                long length = newLexeme ? (long) newLexeme->length() : 0;
+                long depth  = (long) m_Lookahead.size() + 1;
+                
+                if (m_Limits.maxLexemeLength > 0 && length > m_Limits.maxLexemeLength) {
+                    m_LimitExceeded = true;
+                    if (m_Counters) ++m_Counters->lexemesTooLong;
+                    return false;
+                }
+                
+                if (m_Limits.maxLookahead > 0 && depth > m_Limits.maxLookahead) {
+                    m_LimitExceeded = true;
+                    if (m_Counters) ++m_Counters->lookaheadExceeded;
+                    return false;
+                }
+                
+                if (m_Counters) {
+                    if (length > m_Counters->longestLexeme)   m_Counters->longestLexeme     = length;
+                    if (depth > m_Counters->deepestLookahead) m_Counters->deepestLookahead  = depth;
+                }
+                
+                return true;
+            }
+            
+            /// \brief Adds a lexeme to the end of the lookahead, interning it if necessary. Returns false if the lookahead is full
+            inline bool add_lookahead(const lexeme_container& newLexeme) {
+                if (m_Interner) {
+                    return m_Lookahead.push_back(m_Interner->intern(newLexeme));
+                }
+                return m_Lookahead.push_back(newLexeme);
+            }
 
         public:
-            session(parser_actions* actions)
+            session(parser_actions* actions, bool pushInput = false)
             : m_Actions(actions)
             , m_EndOfFile(false)
-            , m_FirstState(NULL) {
+            , m_FirstState(NULL)
+            , m_ReadUnderlyingStack(false)
+            , m_LookaheadBase(0)
+            , m_PushInput(pushInput)
+            , m_NeedInput(false)
+            , m_Bounded(false)
+            , m_Overflow(false)
+            , m_Interner(NULL)
+            , m_Counters(NULL)
+            , m_LimitExceeded(false)
+            , m_ContextLexer(NULL)
+            , m_ModeLexer(NULL)
+            , m_LexerModes(NULL)
+            , m_GuardSpeculator(NULL)
+            , m_ParsingDocument(false)
+            , m_DocumentSeparator(-1)
+            , m_EndOfDocument(false) {
+            }
+            
+            /// \brief Creates a session whose lookahead is stored in the specified array
+            ///
+            /// Space for the scratch lists is reserved up front, and results are not cached, so a bounded session doesn't
+            /// allocate while parsing. The speculative states can use up to stackCapacity entries before needing more.
+            session(parser_actions* actions, const tables_type* tables, lexeme_container* lookahead, int lookaheadCapacity, int stackCapacity)
+            : m_Lookahead(lookahead, (size_t) lookaheadCapacity)
+            , m_Actions(actions)
+            , m_EndOfFile(false)
+            , m_FirstState(NULL)
+            , m_ReadUnderlyingStack(false)
+            , m_LookaheadBase(0)
+            , m_PushInput(false)
+            , m_NeedInput(false)
+            , m_Bounded(true)
+            , m_Overflow(false)
+            , m_Interner(NULL)
+            , m_Counters(NULL)
+            , m_LimitExceeded(false)
+            , m_ContextLexer(NULL)
+            , m_ModeLexer(NULL)
+            , m_LexerModes(NULL)
+            , m_GuardSpeculator(NULL)
+            , m_ParsingDocument(false)
+            , m_DocumentSeparator(-1)
+            , m_EndOfDocument(false) {
+                int maxLength = 0;
+                for (int ruleId = 0; ruleId < tables->count_reduce_rules(); ++ruleId) {
+                    if (tables->rule(ruleId).length > maxLength) maxLength = tables->rule(ruleId).length;
+                }
+                
+                m_ReduceItems.reserve((size_t) maxLength);
+                m_SpeculativeStates.reserve((size_t) stackCapacity);
             }
             
             ~session() {
                 // We consider that the parser owns its own actions, so we destroy them here
                 delete m_Actions;
             }
+            
+            /// \brief The number of bytes used by this session and the states that are a part of it
+            size_t memory_usage() const {
+                size_t total = sizeof(*this) - sizeof(m_Lookahead) + m_Lookahead.memory_usage();
+                
+                // Each node in a map stores an entry along with three links and a colour
+                const size_t mapNode = sizeof(typename guard_cache::value_type) + 4 * sizeof(void*);
+                total += (m_GuardCache.size() + m_CanReduceCache[0].size() + m_CanReduceCache[1].size()) * mapNode;
+                
+                total += m_SpeculativeStates.capacity() * sizeof(int);
+                total += m_ReduceItems.capacity() * sizeof(item_type);
+                if (m_Actions) total += sizeof(*m_Actions);
+                
+                // Stacks that are shared by several states (after a GLR split, for instance) are only counted once
+                for (const state* whichState = m_FirstState; whichState != NULL; whichState = whichState->m_NextState) {
+                    bool shared = false;
+                    for (const state* earlier = m_FirstState; earlier != whichState; earlier = earlier->m_NextState) {
+                        if (earlier->m_Stack.shares_entries(whichState->m_Stack)) {
+                            shared = true;
+                            break;
+                        }
+                    }
+                    
+                    total += sizeof(*whichState);
+                    if (!shared) total += whichState->m_Stack.memory_usage() - sizeof(whichState->m_Stack);
+                }
+                
+                return total;
+            }
         };
         
     public:
@@ -228,13 +563,13 @@ namespace lr {
         ///
         /// \brief Class representing a parser state
         ///
-        class state {
+        class state : public util::arena_object {
         private:
             friend class parser;
             friend class session;
             
             /// \brief The parser tables for this state
-            const parser_tables* m_Tables;
+            const tables_type* m_Tables;
             
             /// \brief The parser stack in this state
             stack m_Stack;
@@ -245,6 +580,9 @@ namespace lr {
             /// \brief The position in the lookahead of this state
             int m_LookaheadPos;
             
+            /// \brief The state that the parser stack started in
+            int m_InitialState;
+            
             /// \brief The next state in the state list
             state* m_NextState;
             
@@ -256,11 +594,14 @@ namespace lr {
             
         private:
             /// \brief States can't be assigned
-            state& operator=(const state& noAssignment) { }
+            state& operator=(const state& noAssignment);
             
         private:
             /// \brief Constructs a new state, used by the parser
-            state(const parser_tables* tables, int initialState, session* session);            
+            state(const tables_type* tables, int initialState, session* session);            
+            
+            /// \brief Constructs a new state whose stack is stored in the specified storage
+            state(const tables_type* tables, int initialState, session* session, typename stack::storage& stackStorage);
             
         public:
             /// \brief Creates a new parser state by copying an old one. Parser states can be run independently.
@@ -312,23 +653,36 @@ namespace lr {
                     state->m_Stack.push(act->nextState, state->m_Session->m_Actions->shift(lookahead));
                     
                     // Tell the trace
+                    if (act->type == lr_action::act_shiftstrong) {
+                        m_Trace.substitute_strong(lookahead);
+                    }
                     m_Trace.shift(lookahead, act->nextState);
                 }
                 
+                /// \brief Shift action for a weak symbol that should be replaced by its strong equivalent
+                inline void shift_strong(state* state, const action* act, const lexeme_container& lookahead) {
+                    // The strong lexeme shares the symbols of the lookahead rather than copying them
+                    int strongEquiv = state->m_Tables->strong_for_weak(lookahead->matched());
+                    shift(state, act, lexeme_container(new dfa::lexeme(lookahead, strongEquiv), true));
+                }
+                
                 /// \brief Reduce action
-                inline void reduce(state* state, const action* act, const parser_tables::reduce_rule& rule) {
+                inline void reduce(state* state, const action* act, const reduce_rule& rule) {
                     // Tell the trace that this is happening
                     m_Trace.reduce(rule.identifier, rule.ruleId, rule.length);
                     
                     // Pop items from the stack, and create an item for them by calling the actions
-                    reduce_list items;
+                    // (Entries that can't be reached by another copy of the stack are moved rather than copied. The list
+                    // is kept in the session so that its storage is reused by each reduction)
+                    reduce_list& items = state->m_Session->m_ReduceItems;
+                    items.clear();
                     for (int x=0; x < rule.length; ++x) {
-                        items.push_back(state->m_Stack->item);
+                        items.push_back(state->m_Stack.take_item());
                         state->m_Stack.pop();
                     }
                     
                     // Fetch the state that's now on top of the stack
-                    int gotoState = state->m_Stack->state;
+                    int gotoState = state->m_Stack.state();
                     
                     // Work out the lookahead position
                     const lexeme_container& la              = state->look();
@@ -345,24 +699,25 @@ namespace lr {
                     }
                     
                     // Get the goto action for this nonterminal
-                    for (parser_tables::action_iterator gotoAct = state->m_Tables->find_nonterminal(gotoState, rule.identifier);
-                         gotoAct != state->m_Tables->last_nonterminal_action(gotoState); 
-                         ++gotoAct) {
-                        if (gotoAct->type == lr_action::act_goto) {
-                            // Found the goto action, perform the reduction
-                            // (Note that this will perform the goto action for the next nonterminal if the nonterminal isn't in this state. This can only happen if the parser is in an invalid state)
-                            state->m_Stack.push(gotoAct->nextState, state->m_Session->m_Actions->reduce(rule.identifier, rule.ruleId, items, *lookaheadPos));
-                            
-                            // Tell the trace about this
-                            m_Trace.goto_state(gotoAct->nextState);
-                            break;
-                        }
-                    }                    
+                    // (This will be the default goto for the nonterminal if the parser is in an invalid state)
+                    int nextState = state->m_Tables->goto_state(gotoState, rule.identifier);
+                    
+                    if (nextState >= 0) {
+                        // Found the goto action, perform the reduction
+                        state->m_Stack.push(nextState, state->m_Session->m_Actions->reduce(rule.identifier, rule.ruleId, items, *lookaheadPos));
+                        
+                        // Tell the trace about this
+                        m_Trace.goto_state(nextState);
+                    }
+                    
+                    // Release the items that were reduced
+                    items.clear();
+                    m_Trace.reduced(rule.identifier, rule.ruleId);
                 }
                 
                 /// \brief Sets the current state of the parser
                 inline void set_state(state* state, int newState) {
-                    state->m_Stack->state = newState;
+                    state->m_Stack.state() = newState;
                     
                     m_Trace.goto_state(newState);
                 }
@@ -378,10 +733,11 @@ namespace lr {
                 }
                 
                 /// \brief The current state of the guard lookahead parser
-                inline int current_state(state* state) const { return state->m_Stack->state; }
+                inline int current_state(state* state) const { return state->m_Stack.state(); }
                 
                 /// \brief Returns -1 or the guard symbol matched by the lookahead with the specified initial guard state
                 inline int check_guard(state* state, int initialState) {
+                    m_Trace.checking_guard(initialState);
                     int result = state->check_guard(initialState, 0);
                     
                     m_Trace.checked_guard(initialState, result);
@@ -395,15 +751,15 @@ namespace lr {
                 }
                 
                 /// \brief Returns true if the specified terminal symbol can be reduced
-                inline bool can_reduce(int terminal, parser_tables::action_iterator act, state* state) {
+                inline bool can_reduce(int terminal, action_iterator act, state* state) {
                     // Accepting or shifting actions always return true immediately
-                    if (act->type == lr_action::act_shift || act->type == lr_action::act_shiftstrong || act->type == lr_action::act_accept) {
+                    if (act->type == lr_action::act_shift || act->type == lr_action::act_shiftstrong || act->type == lr_action::act_shiftreduce || act->type == lr_action::act_accept) {
                         return true;
                     }
 
                     // Fake reduce using the action
-                    std::stack<int> fakeStack;
-                    int             stackPos = 0;
+                    speculative_stack   fakeStack(state->m_Session->m_SpeculativeStates);
+                    int                 stackPos = 0;
 
                     state->fake_reduce(act, stackPos, fakeStack, state->m_Stack);
 
@@ -412,15 +768,15 @@ namespace lr {
                 }
                 
                 /// \brief Returns true if the specified terminal symbol can be reduced
-                inline bool can_reduce_nonterminal(int terminal, parser_tables::action_iterator act, state* state) {
+                inline bool can_reduce_nonterminal(int terminal, action_iterator act, state* state) {
                     // Accepting or shifting actions always return true immediately
-                    if (act->type == lr_action::act_shift || act->type == lr_action::act_shiftstrong || act->type == lr_action::act_accept) {
+                    if (act->type == lr_action::act_shift || act->type == lr_action::act_shiftstrong || act->type == lr_action::act_shiftreduce || act->type == lr_action::act_accept) {
                         return true;
                     }
 
                     // Fake reduce using the action
-                    std::stack<int> fakeStack;
-                    int             stackPos = 0;
+                    speculative_stack   fakeStack(state->m_Session->m_SpeculativeStates);
+                    int                 stackPos = 0;
 
                     state->fake_reduce(act, stackPos, fakeStack, state->m_Stack);
 
@@ -429,6 +785,42 @@ namespace lr {
                 }
             };
             
+            friend class trial_actions;
+            
+            ///
+            /// \brief Actions used when trying out repairs during error recovery
+            ///
+            /// These run the parser in the same way as the standard actions, except that the parser actions are not
+            /// called: empty items are pushed on to the stack instead.
+            ///
+            class trial_actions : public standard_actions {
+            public:
+                /// \brief Shift action
+                inline void shift(state* state, const action* act, const lexeme_container& lookahead) {
+                    state->m_Stack.push(act->nextState, item_type());
+                }
+                
+                /// \brief Shift action for a weak symbol (no lexeme is needed for the strong symbol, as there is no item to create)
+                inline void shift_strong(state* state, const action* act, const lexeme_container& lookahead) {
+                    shift(state, act, lookahead);
+                }
+                
+                /// \brief Reduce action
+                inline void reduce(state* state, const action* act, const reduce_rule& rule) {
+                    for (int x=0; x < rule.length; ++x) {
+                        state->m_Stack.pop();
+                    }
+                    
+                    // Perform the goto action for the nonterminal
+                    int gotoState = state->m_Stack.state();
+                    
+                    int nextState = state->m_Tables->goto_state(gotoState, rule.identifier);
+                    if (nextState >= 0) {
+                        state->m_Stack.push(nextState, item_type());
+                    }
+                }
+            };
+            
             friend class guard_actions;
             
             ///
@@ -440,12 +832,15 @@ namespace lr {
                 int             m_Offset;
                 
                 /// \brief The current stack for the guard symbol
-                std::stack<int> m_Stack;
+                ///
+                /// (Guards are checked in a nested fashion, so this can use the session's speculative scratch space)
+                speculative_stack m_Stack;
                 
             public:
-                /// \brief Creates 
-                guard_actions(int initialState, int initialOffset)
-                : m_Offset(initialOffset) {
+                /// \brief Creates the actions for a guard starting at the specified state
+                guard_actions(std::vector<int>& scratch, int initialState, int initialOffset)
+                : m_Offset(initialOffset)
+                , m_Stack(scratch) {
                     m_Stack.push(initialState);
                 }
                 
@@ -471,8 +866,13 @@ namespace lr {
                     m_Stack.push(act->nextState);
                 }
                 
+                /// \brief Shift action for a weak symbol (guards only track the state, so the symbol doesn't need replacing)
+                inline void shift_strong(state* state, const action* act, const lexeme_container& lookahead) {
+                    m_Stack.push(act->nextState);
+                }
+                
                 /// \brief Reduce action
-                inline void reduce(state* state, const action* act, const parser_tables::reduce_rule& rule) {
+                inline void reduce(state* state, const action* act, const reduce_rule& rule) {
                     // Pop items from the stack, and create an item for them by calling the actions
                     for (int x=0; x < rule.length; ++x) {
                         m_Stack.pop();
@@ -482,16 +882,10 @@ namespace lr {
                     int gotoState = m_Stack.top();
                     
                     // Get the goto action for this nonterminal
-                    for (parser_tables::action_iterator gotoAct = state->m_Tables->find_nonterminal(gotoState, rule.identifier);
-                         gotoAct != state->m_Tables->last_nonterminal_action(gotoState); 
-                         ++gotoAct) {
-                        if (gotoAct->type == lr_action::act_goto) {
-                            // Found the goto action, perform the reduction
-                            // (Note that this will perform the goto action for the next nonterminal if the nonterminal isn't in this state. This can only happen if the parser is in an invalid state)
-                            m_Stack.push(gotoAct->nextState);
-                            break;
-                        }
-                    }                    
+                    int nextState = state->m_Tables->goto_state(gotoState, rule.identifier);
+                    if (nextState >= 0) {
+                        m_Stack.push(nextState);
+                    }
                 }
                 
                 /// \brief Sets the current state of the parser
@@ -509,15 +903,15 @@ namespace lr {
                 }
                 
                 /// \brief Returns true if the specified terminal symbol can be reduced
-                bool can_reduce(int terminal, parser_tables::action_iterator act, state* state) {
+                bool can_reduce(int terminal, action_iterator act, state* state) {
                     // Accepting or shifting actions always return true immediately
-                    if (act->type == lr_action::act_shift || act->type == lr_action::act_shiftstrong || act->type == lr_action::act_accept) {
+                    if (act->type == lr_action::act_shift || act->type == lr_action::act_shiftstrong || act->type == lr_action::act_shiftreduce || act->type == lr_action::act_accept) {
                         return true;
                     }
 
                     // Fake reduce using the action
-                    std::stack<int> fakeStack   = m_Stack;
-                    int             stackPos    = 0;
+                    speculative_stack   fakeStack(m_Stack);
+                    int                 stackPos    = 0;
 
                     state->fake_reduce(act, stackPos, fakeStack, state->m_Stack);
 
@@ -526,15 +920,15 @@ namespace lr {
                 }
                 
                 /// \brief Returns true if the specified terminal symbol can be reduced
-                bool can_reduce_nonterminal(int nonterminal, parser_tables::action_iterator act, state* state) {
+                bool can_reduce_nonterminal(int nonterminal, action_iterator act, state* state) {
                     // Accepting or shifting actions always return true immediately
-                    if (act->type == lr_action::act_shift || act->type == lr_action::act_shiftstrong || act->type == lr_action::act_accept) {
+                    if (act->type == lr_action::act_shift || act->type == lr_action::act_shiftstrong || act->type == lr_action::act_shiftreduce || act->type == lr_action::act_accept) {
                         return true;
                     }
 
                     // Fake reduce using the action
-                    std::stack<int> fakeStack   = m_Stack;
-                    int             stackPos    = 0;
+                    speculative_stack   fakeStack(m_Stack);
+                    int                 stackPos    = 0;
 
                     state->fake_reduce(act, stackPos, fakeStack, state->m_Stack);
 
@@ -562,8 +956,23 @@ namespace lr {
             /// can produce an accepting state, then this will return the ID of the guard symbol that was accepted.
             /// If no accepting state is reached, this will return a negative value (generally -1)
             ///
+            /// Guards don't depend on the parser state, so the result is cached in the session: checking the same guard
+            /// at the same position in the input (from this or any other state) just looks up the earlier result.
+            ///
             int check_guard(int initialState, int initialOffset);
             
+            /// \brief Runs the parser forward to evaluate a guard (the uncached part of check_guard)
+            int evaluate_guard(int initialState, int initialOffset);
+            
+            /// \brief Adds the guard results that the speculative guard stream found for a lexeme that was just read to the guard cache
+            void add_speculative_guards(const dfa::lexeme* newLexeme);
+            
+            /// \brief Evaluates a guard using its compiled DFA, starting in the specified DFA state
+            int evaluate_compiled_guard(const guard_dfa& guards, int dfaState, int initialOffset);
+            
+            /// \brief Checks that a guard can read the specified number of lexemes without exceeding the limits
+            inline bool within_guard_limit(int depth);
+            
         public:
             ///
             /// \brief Performs the specified action
@@ -589,18 +998,23 @@ namespace lr {
             ///
             class terminal_fetcher {
             public:
-                /// \brief The parser tables action iterator type
-                typedef parser_tables::action_iterator action_iterator;
+                /// \brief The index of the can_reduce cache used for these symbols
+                static const int c_CacheIndex = 0;
                 
                 /// \brief Returns an iterator pointing to the first action referring to a terminal symbol in the specified state
-                inline static action_iterator find_symbol(const parser_tables* tables, int state, int terminal) {
+                inline static action_iterator find_symbol(const tables_type* tables, int state, int terminal) {
                     return tables->find_terminal(state, terminal);
                 }
                 
                 /// \brief Returns an iterator pointing to the last action referring to a terminal symbol in the specified state
-                inline static action_iterator last_symbol_action(const parser_tables* tables, int state) {
+                inline static action_iterator last_symbol_action(const tables_type* tables, int state) {
                     return tables->last_terminal_action(state);
                 }
+                
+                /// \brief True if terminal symbols with no actions should use the default reduction for the specified state
+                inline static bool has_default_reduction(const tables_type* tables, int state) {
+                    return tables->has_default_reduction(state);
+                }
             };
             
             ///
@@ -610,25 +1024,41 @@ namespace lr {
             ///
             class nonterminal_fetcher {
             public:
-                /// \brief The parser tables action iterator type
-                typedef parser_tables::action_iterator action_iterator;
+                /// \brief The index of the can_reduce cache used for these symbols
+                static const int c_CacheIndex = 1;
                 
                 /// \brief Returns an iterator pointing to the first action referring to a terminal symbol in the specified state
-                inline static action_iterator find_symbol(const parser_tables* tables, int state, int terminal) {
+                inline static action_iterator find_symbol(const tables_type* tables, int state, int terminal) {
                     return tables->find_nonterminal(state, terminal);
                 }
                 
                 /// \brief Returns an iterator pointing to the last action referring to a terminal symbol in the specified state
-                inline static action_iterator last_symbol_action(const parser_tables* tables, int state) {
+                inline static action_iterator last_symbol_action(const tables_type* tables, int state) {
                     return tables->last_nonterminal_action(state);
                 }
+                
+                /// \brief True if nonterminal symbols with no actions should use the default reduction for the specified state
+                ///
+                /// Nonterminal actions are never removed from the tables, so this is always false.
+                inline static bool has_default_reduction(const tables_type* tables, int state) {
+                    return false;
+                }
             };
             
+            /// \brief Returns the state on top of a speculative stack built on top of the specified position in the real stack
+            inline int speculative_state(const speculative_stack& pushed, int stackPos, const stack& underlyingStack);
+            
             /// \brief Fakes up a reduce action during can_reduce testing. act must be a reduce action
-            inline void fake_reduce(parser_tables::action_iterator act, int& stackPos, std::stack<int>& pushed, const stack& underlyingStack);
+            inline void fake_reduce(action_iterator act, int& stackPos, speculative_stack& pushed, const stack& underlyingStack);
             
             /// \brief Returns true if a reduction of the specified lexeme will result in it being shifted
-            template<class symbol_fetcher> bool can_reduce(int symbol, int stackPos, std::stack<int> pushed, const stack& underlyingStack);
+            ///
+            /// The pushed stack is modified by this call. Results that only depend on the state on top of the stack are
+            /// cached in the session.
+            template<class symbol_fetcher> bool can_reduce(int symbol, int stackPos, speculative_stack& pushed, const stack& underlyingStack);
+            
+            /// \brief Simulates the parser to find out if the specified symbol will be shifted (the uncached part of can_reduce)
+            template<class symbol_fetcher> bool simulate_can_reduce(int symbol, int stackPos, speculative_stack& pushed, const stack& underlyingStack);
             
         public:
             /// \brief Returns true if a reduction of the specified lexeme will result in it being shifted
@@ -637,7 +1067,7 @@ namespace lr {
             /// be resolved by a LR(1) parser, this will disambiguate the grammar (making it possible to choose
             /// only the action that allows the parser to continue)
             inline bool can_reduce(const lexeme_container& lexeme) {
-                return can_reduce<terminal_fetcher>(lexeme->matched(), 0, std::stack<int>());
+                return can_reduce(lexeme->matched());
             }
 
             /// \brief Returns true if a reduction of the specified terminal symbol will result in it being shifted
@@ -646,7 +1076,8 @@ namespace lr {
             /// be resolved by a LR(1) parser, this will disambiguate the grammar (making it possible to choose
             /// only the action that allows the parser to continue)
             inline bool can_reduce(int terminalId) {
-                return can_reduce<terminal_fetcher>(terminalId, 0, std::stack<int>(), m_Stack);
+                speculative_stack pushed(m_Session->m_SpeculativeStates);
+                return can_reduce<terminal_fetcher>(terminalId, 0, pushed, m_Stack);
             }
 
             /// \brief Returns true if a reduction of the lookahead will result in it being shifted
@@ -657,7 +1088,8 @@ namespace lr {
         private:
             /// \brief As for can_reduce, but with a fake nonterminal lookahead value
             inline bool can_reduce_nonterminal(int nt) {
-                return can_reduce<nonterminal_fetcher>(nt, 0, std::stack<int>(), m_Stack);
+                speculative_stack pushed(m_Session->m_SpeculativeStates);
+                return can_reduce<nonterminal_fetcher>(nt, 0, pushed, m_Stack);
             }
             
         public:
@@ -670,8 +1102,8 @@ namespace lr {
             /// a terminal symbol, and the range of actions that might apply to this particular symbol.
             template<class actions> inline result process_generic(actions& actDelegate, const lexeme_container& la, 
                                                                   int symbol, bool isTerminal,
-                                                                  parser_tables::action_iterator& act, 
-                                                                  parser_tables::action_iterator& end);
+                                                                  action_iterator& act, 
+                                                                  action_iterator& end);
 
             /// \brief Performs a single parsing action, and returns the result
             template<class actions> inline result process_generic(actions& actDelegate);
@@ -687,11 +1119,54 @@ namespace lr {
             /// in situations where it's not appropriate.
             template<class actions> bool process_guard(actions& actDelegate, const lexeme_container& la, int guardSymbol);
             
+            /// \brief Collects the actions that a GLR parse should follow from this state for the specified lookahead
+            ///
+            /// Returns false if one of the actions is a guard: guards are resolved by performing a single deterministic
+            /// step instead, as they already pick between the actions using extra lookahead.
+            template<class actions> bool glr_actions(actions& actDelegate, const lexeme_container& la, std::vector<const action*>& result);
+            
+            /// \brief Attempts to recover from a syntax error at the current lookahead, and reports it to the error handler
+            ///
+            /// Returns false if there is no way to recover from the error.
+            bool recover(parse_error_handler& errors, int maxRepairCost, int validateSymbols);
+            
+            /// \brief Returns true if the parser can continue from this state after popping some states and skipping the
+            /// specified number of symbols
+            ///
+            /// The parser must be able to shift the specified number of symbols after the skipped ones (or accept the input).
+            /// This is tested on a copy of this state, and without calling the parser actions.
+            bool trial_parse(int skip, int popped, int validateSymbols);
+            
+            /// \brief Finds a terminal symbol that can be inserted after skipping a number of symbols to repair an error
+            ///
+            /// Returns the inserted symbol, or -1 if there isn't one. If a symbol is found, it is left in the lookahead.
+            int find_insertion(int skip, int validateSymbols);
+            
+            /// \brief Adds a symbol to the lookahead at the specified offset from the current position
+            void insert_lookahead(int offset, int symbol);
+            
+            /// \brief Removes the symbol at the specified offset from the current position from the lookahead
+            void remove_lookahead(int offset);
+            
         public:
             /// \brief Performs a single parsing action, and returns the result
             inline result process() {
                 standard_actions actions;
-                return process_generic(actions);
+                m_Session->m_NeedInput = false;
+                
+                result next = process_generic(actions);
+                
+                // Parsers with fixed storage stop once it has filled up
+                if (m_Session->m_Overflow || m_Stack.overflowed()) {
+                    return parser_result::overflow;
+                }
+                
+                // Parsers with limits stop once the input exceeds them
+                if (m_Session->m_LimitExceeded) {
+                    return parser_result::limit_exceeded;
+                }
+                
+                return next;
             }
             
             /// \brief Parses the input file specified by the actions object, and returns true if it was accepted
@@ -709,6 +1184,289 @@ namespace lr {
                 }
             }
             
+            ///
+            /// \brief Parses the next document from an input containing several, and returns true if it was accepted
+            ///
+            /// This is for inputs such as JSON lines or concatenated messages, where each document is a complete
+            /// instance of the start symbol. A document ends at the separator terminal, or (if separator is -1) at the
+            /// first terminal that can't continue it. The parser treats that point as the end of the input, and then
+            /// skips the separator once the document is accepted. The result is the item returned by get_item().
+            ///
+            /// The next call carries on from the same lexer and lookahead. It empties the stack and starts again from
+            /// the initial state, which releases the item for the previous document. Use more_documents() to find
+            /// out if there is any input left. After a document is rejected, the lookahead is left at the symbol
+            /// where the error was found. This must be the only state in its session, and can't be used with a push
+            /// session.
+            ///
+            inline bool parse_document(int separator = -1) {
+                m_Stack.reset(m_InitialState);
+                
+                m_Session->m_ParsingDocument    = true;
+                m_Session->m_DocumentSeparator  = separator;
+                m_Session->m_EndOfDocument      = false;
+                
+                bool accepted = parse();
+                
+                // Move past the separator that ended this document
+                if (accepted && m_Session->m_EndOfDocument && separator >= 0) {
+                    const lexeme_container& la = look();
+                    if (la.item() && la->matched() == separator) next();
+                }
+                
+                m_Session->m_ParsingDocument    = false;
+                m_Session->m_EndOfDocument      = false;
+                return accepted;
+            }
+            
+            /// \brief True if there is input left for parse_document() to read
+            inline bool more_documents() {
+                return look().item() != NULL;
+            }
+            
+            ///
+            /// \brief Parses the input using a GLR-style algorithm, and returns true if it was accepted
+            ///
+            /// Where parse() performs the first action that applies to each lookahead symbol, this follows all of
+            /// them: when the tables contain a conflict, the state is split into several states that are run in step
+            /// with each other, one symbol at a time. States die when they reach an error, and the parse succeeds as
+            /// soon as one of them accepts, at which point this state takes on its stack.
+            ///
+            /// The states share the same parser stack, so the entries below the point where they split are never
+            /// copied. States that reach the same sequence of parser states at the same point in the input are merged,
+            /// which keeps the number of states small for grammars that are only locally ambiguous (the first state to
+            /// arrive wins, so the choice between ambiguous parse trees is arbitrary). Guards are still resolved
+            /// deterministically.
+            ///
+            /// The actions for every state are reported, so the parser actions should not have side effects beyond
+            /// building the items that are stored on the stack. This can't be used with a push session.
+            ///
+            bool parse_glr();
+            
+            ///
+            /// \brief Parses the input, recovering from any syntax errors, and returns true if it was accepted
+            ///
+            /// When a symbol is rejected, the parser tries to repair the input with the cheapest edit it can find: either
+            /// deleting symbols, or deleting symbols and then inserting a terminal, where each deleted or inserted symbol
+            /// costs 1 and edits costing more than maxRepairCost are not considered. An edit is only used if the parser
+            /// can shift the following validateSymbols symbols afterwards (or reach the end of the input). If there's
+            /// no such edit, the parser falls back to panic mode: it removes states from the stack and skips symbols
+            /// until it finds a point where it can continue.
+            ///
+            /// Each error is passed to the error handler once it has been repaired. Inserted symbols are passed to the
+            /// parser actions as empty lexemes, so the result is a complete parse tree for the repaired input. If the
+            /// parser can't recover then the handler is told and this returns false, leaving the partial result on the
+            /// stack. This can't be used with a push session.
+            ///
+            bool parse_with_recovery(parse_error_handler& errors, int maxRepairCost = 3, int validateSymbols = 3);
+            
+        public:
+            /// \brief Adds a lexeme to the end of the input of a parser created by create_push_parser()
+            ///
+            /// The lexeme will be deleted by the parser once it is no longer needed. Lexemes are shared between all of the
+            /// states in a session.
+            inline void push(dfa::lexeme* newLexeme) {
+                push(lexeme_container(newLexeme, true));
+            }
+            
+            /// \brief Adds a lexeme to the end of the input of a parser created by create_push_parser()
+            inline void push(const lexeme_container& newLexeme) {
+                if (!m_Session->within_limits(newLexeme.item())) return;
+                
+                if (!m_Session->add_lookahead(newLexeme)) {
+                    m_Session->m_Overflow = true;
+                }
+            }
+            
+            /// \brief Indicates that no more lexemes will be pushed into this parser
+            inline void end_of_input() {
+                m_Session->m_EndOfFile = true;
+            }
+            
+            /// \brief The position in the input of the current lookahead symbol (the number of symbols consumed so far)
+            inline int input_position() const {
+                return m_LookaheadPos + m_Session->m_LookaheadBase;
+            }
+            
+            /// \brief Moves a push parser back to a stack recorded from this state earlier in the session
+            ///
+            /// inputPosition should be the value of input_position() at the point where the stack was recorded. The
+            /// lookahead is discarded, so lexemes need to be pushed again from that position. This must be the only
+            /// state in its session.
+            inline void rewind(const stack& recordedStack, int inputPosition) {
+                m_Stack                     = recordedStack;
+                m_LookaheadPos              = 0;
+                
+                m_Session->m_Lookahead.clear();
+                m_Session->m_GuardCache.clear();
+                m_Session->m_LookaheadBase  = inputPosition;
+                m_Session->m_EndOfFile      = false;
+                m_Session->m_NeedInput      = false;
+                m_Session->m_Overflow       = false;
+                m_Session->m_LimitExceeded  = false;
+            }
+            
+            /// \brief Moves this state back to the start of a new parse, keeping the memory that has been allocated so far
+            ///
+            /// The stack is emptied and the lookahead is discarded, but the storage for them and any cached results that
+            /// only depend on the parser tables are kept, so a state can be reused for many short inputs without
+            /// allocating each time. The actions should be reset to read from the new input first (see get_actions()).
+            /// Any items from the previous parse are released. This must be the only state in its session.
+            inline void reset(int initialState = 0) {
+                m_Stack.reset(initialState);
+                m_LookaheadPos              = 0;
+                
+                m_Session->m_Lookahead.clear();
+                m_Session->m_GuardCache.clear();
+                m_Session->m_LookaheadBase  = 0;
+                m_Session->m_EndOfFile      = false;
+                m_Session->m_NeedInput      = false;
+                m_Session->m_Overflow       = false;
+                m_Session->m_LimitExceeded  = false;
+            }
+            
+            /// \brief As for reset(), but replaces the actions for the session, deleting the old ones
+            inline void reset(parser_actions* actions, int initialState = 0) {
+                if (actions != m_Session->m_Actions) {
+                    delete m_Session->m_Actions;
+                    m_Session->m_Actions = actions;
+                }
+                
+                reset(initialState);
+            }
+            
+            /// \brief Performs as many parser actions as possible using the lexemes that have been pushed so far
+            ///
+            /// Returns need_input if the parser needs more lexemes before it can continue, or accept or reject once the
+            /// parse has finished. Reductions are reported through the parser actions as they are completed. Actions are
+            /// only performed once all of the lookahead they depend on is available (including the lookahead needed by
+            /// any guards), so this can be called again after pushing more lexemes to carry on from the same point.
+            ///
+            /// In sessions that are not push sessions, this behaves the same as parse(), except that it returns the final
+            /// result instead of a boolean
+            inline result parse_available() {
+                for (;;) {
+                    // Perform the next action
+                    result next = process();
+                    
+                    // Keep going if there are more results
+                    if (next == parser_result::more) continue;
+                    
+                    return next;
+                }
+            }
+            
+            /// \brief The parser actions for the session that this state is a part of
+            inline parser_actions* get_actions() const {
+                return m_Session->m_Actions;
+            }
+            
+            /// \brief Interns the lexemes for the symbols in the specified table as they are read (or stops interning if it is NULL)
+            ///
+            /// This applies to the session that this state is a part of, and only affects lexemes that are read after it
+            /// is called. The interner is not owned by the session, and must last as long as the session does.
+            inline void set_interner(dfa::lexeme_interner* interner) {
+                m_Session->m_Interner = interner;
+            }
+            
+            /// \brief NULL, or the table used to intern the lexemes read by the session that this state is a part of
+            inline dfa::lexeme_interner* get_interner() const {
+                return m_Session->m_Interner;
+            }
+            
+            /// \brief Limits the amount of input that the session that this state is a part of will look ahead at
+            ///
+            /// Once a limit is exceeded, process() returns parser_result::limit_exceeded. This only affects lexemes
+            /// that are read after it is called.
+            inline void set_limits(const parser_limits& limits) {
+                m_Session->m_Limits = limits;
+            }
+            
+            /// \brief The limits on the input for the session that this state is a part of
+            inline const parser_limits& get_limits() const {
+                return m_Session->m_Limits;
+            }
+            
+            /// \brief Updates the specified counters as the session that this state is a part of reads its input (or stops
+            /// updating them if this is NULL)
+            ///
+            /// The counters are not owned by the session, and must last as long as the session does.
+            inline void set_limit_counters(parser_limit_counters* counters) {
+                m_Session->m_Counters = counters;
+            }
+            
+            /// \brief The number of guard results that the session that this state is a part of is holding on to
+            ///
+            /// Results are kept until the lookahead that they were evaluated against is trimmed.
+            inline size_t count_cached_guards() const {
+                return m_Session->m_GuardCache.size();
+            }
+            
+            /// \brief Restricts each lexeme read from the specified stream to the terminals that are valid in the parser's state
+            ///
+            /// This applies to the session that this state is a part of, and should be the stream that its actions read
+            /// from (or NULL to stop restricting the lexemes). Before a state reads its next lookahead, it passes the
+            /// terminals that are valid in that state to dfa::lexeme_stream::set_valid_symbols, so the lexer can resolve
+            /// tokens that depend on the context without needing weak symbols or guards. Lexemes that are read further
+            /// ahead than this (by guards, for instance) are not restricted. The tables must have been prepared with
+            /// parser_tables::compile_valid_terminals(), and the stream is not owned by the session.
+            inline void set_context_lexer(dfa::lexeme_stream* stream) {
+                if (m_Session->m_ContextLexer && m_Session->m_ContextLexer != stream) {
+                    m_Session->m_ContextLexer->set_valid_symbols(NULL, 0);
+                }
+                m_Session->m_ContextLexer = stream;
+            }
+            
+            /// \brief Switches the specified stream into the lexer mode for the parser's state before each lexeme is read
+            ///
+            /// This lets a single lexer with a mode for each of several languages (see lexer_mode_table) read a document
+            /// that mixes them: before a state reads its next lookahead, the stream is switched into the mode that the
+            /// terminals expected by that state are matched in. States that don't decide the mode leave the stream as it
+            /// is, so it can still be switched by hand. As with set_context_lexer(), this applies to the whole session,
+            /// lexemes read further ahead are not switched, and neither the stream nor the table are owned by the session.
+            /// Passing NULL as the stream stops switching modes.
+            inline void set_mode_lexer(dfa::lexeme_stream* stream, const lexer_mode_table* modes) {
+                m_Session->m_ModeLexer  = modes ? stream : NULL;
+                m_Session->m_LexerModes = modes;
+            }
+            
+            /// \brief Uses the guards evaluated ahead of time by the specified stream, which the actions read from
+            ///
+            /// As each lexeme is read, the results of the compiled guards that the stream evaluated on its own thread are
+            /// added to the session's guard cache, so a guard action only needs to look up its result. The stream must
+            /// be the one that the actions read their lexemes from, and must have been created for the same tables. The
+            /// results are only used when the session has no limits on the length of lexemes or the depth of the
+            /// lookahead, and not at all in bounded sessions; guards that read more lexemes than parser_limits allows are
+            /// still evaluated by the parser. The stream is not owned by the session. Passing NULL stops using it.
+            inline void set_guard_speculator(const speculative_guard_stream* stream) {
+                m_Session->m_GuardSpeculator = stream;
+            }
+            
+            /// \brief True if the parser stopped because the input exceeded one of its limits
+            inline bool limit_exceeded() const {
+                return m_Session->m_LimitExceeded;
+            }
+            
+            /// \brief True if the parser stopped because the fixed storage for its stack or its lookahead was full
+            inline bool overflowed() const {
+                return m_Session->m_Overflow || m_Stack.overflowed();
+            }
+            
+            /// \brief The number of bytes used by this state and its stack
+            ///
+            /// The items on the stack are counted by their size alone. Use session_memory_usage() to include the
+            /// lookahead and the other states in the same session.
+            inline size_t memory_usage() const {
+                return sizeof(*this) - sizeof(m_Stack) + m_Stack.memory_usage();
+            }
+            
+            /// \brief The number of bytes used by the session that this state is a part of
+            ///
+            /// This counts the lookahead (including the lexemes in it), the caches, the parser actions object and
+            /// every state in the session, with stacks that are shared by several states counted once.
+            inline size_t session_memory_usage() const {
+                return m_Session->memory_usage();
+            }
+            
             /// \brief Returns the parser stack associated with this state
             inline const stack& get_stack() const {
                 return m_Stack;
@@ -716,7 +1474,7 @@ namespace lr {
             
             /// \brief Gets the parser item on top of the stack
             inline const item_type& get_item() const {
-                return m_Stack->item;
+                return m_Stack.item();
             }
         };
         
@@ -727,8 +1485,33 @@ namespace lr {
             return new state(m_ParserTables, initialState, newSession);
         }
         
+        /// \brief Factory method that creates a new parser that has its input pushed into it
+        ///
+        /// The parser will not call read() on the actions object: instead, lexemes should be supplied by calling push()
+        /// on the state, followed by end_of_input() once there are no more. Call parse_available() to run the parser
+        /// until it needs more input. The actions will be destroyed when the state is destroyed.
+        inline state* create_push_parser(parser_actions* actions, int initialState = 0) const {
+            session* newSession = new session(actions, true);
+            return new state(m_ParserTables, initialState, newSession);
+        }
+        
+        /// \brief Factory method that creates a parser which keeps its stack and lookahead in storage supplied by the caller
+        ///
+        /// The parser stack can hold up to stackStorage.capacity() entries (including the initial state), and the lookahead
+        /// up to lookaheadCapacity lexemes. Neither grows: if either fills up, process() returns overflow and the parse
+        /// stops, so the depth of the parse is bounded. The storage must remain valid until the state has been destroyed.
+        ///
+        /// Everything else the parser needs is allocated by this call, so parse() doesn't allocate any memory itself
+        /// (the lexemes are still created by the parser actions, and parser actions such as tape_parser_actions may
+        /// need space reserving up front). The can_reduce and guard results aren't cached, as the caches would have to
+        /// grow. parse_glr() and parse_with_recovery() work with these parsers, but may allocate memory.
+        inline state* create_bounded_parser(parser_actions* actions, typename stack::storage& stackStorage, lexeme_container* lookaheadStorage, int lookaheadCapacity, int initialState = 0) const {
+            session* newSession = new session(actions, m_ParserTables, lookaheadStorage, lookaheadCapacity, stackStorage.capacity());
+            return new state(m_ParserTables, initialState, newSession, stackStorage);
+        }
+        
         /// \brief Retrieves the tables for this parser
-        inline const parser_tables& get_tables() const { return *m_ParserTables; }
+        inline const tables_type& get_tables() const { return *m_ParserTables; }
     };
     
     ///
@@ -742,6 +1525,12 @@ namespace lr {
         /// \brief The lexer associated with the object, destroyed when the object is destructed
         dfa::lexeme_stream* m_Lexer;
         
+        /// \brief NULL, or the tokens that this object reads instead of a lexer (not owned by this object)
+        const dfa::token_array* m_Tokens;
+        
+        /// \brief The index of the next token to read from m_Tokens
+        size_t m_NextToken;
+        
         simple_parser_actions(const simple_parser_actions& noCopying) { }
         simple_parser_actions& operator=(const simple_parser_actions& noCopying) { return *this; }
         
@@ -750,14 +1539,44 @@ namespace lr {
         ///
         /// The stream will be deleted when this object is deleted
         simple_parser_actions(dfa::lexeme_stream* lexer)
-        : m_Lexer(lexer) {
+        : m_Lexer(lexer)
+        , m_Tokens(NULL)
+        , m_NextToken(0) {
+        }
+        
+        /// \brief Creates a new actions object that will read from an array of tokens, starting at the specified index
+        ///
+        /// The tokens must remain valid for as long as this object does.
+        explicit simple_parser_actions(const dfa::token_array& tokens, size_t firstToken = 0)
+        : m_Lexer(NULL)
+        , m_Tokens(&tokens)
+        , m_NextToken(firstToken) {
         }
         
         /// \brief Destroys an existing actions object
         ~simple_parser_actions() { delete m_Lexer; }
         
+        /// \brief Starts reading from a different stream, deleting the old one (used when resetting a parser to parse new input)
+        inline void reset(dfa::lexeme_stream* lexer) {
+            if (lexer != m_Lexer) delete m_Lexer;
+            m_Lexer     = lexer;
+            m_Tokens    = NULL;
+        }
+        
+        /// \brief Starts reading from an array of tokens, deleting the old stream if there is one
+        inline void reset(const dfa::token_array& tokens, size_t firstToken = 0) {
+            reset(NULL);
+            m_Tokens    = &tokens;
+            m_NextToken = firstToken;
+        }
+        
         /// \brief Reads the next symbol from the stream
         inline dfa::lexeme* read() {
+            if (m_Tokens) {
+                if (m_NextToken >= m_Tokens->size()) return NULL;
+                return m_Tokens->create_lexeme(m_NextToken++);
+            }
+            
             dfa::lexeme* result = NULL;
             (*m_Lexer) >> result;
             return result;
@@ -780,4 +1599,11 @@ namespace lr {
 
 #include "parser_state.h"
 
+#if __cplusplus >= 201103L
+namespace lr {
+    // The simple parser is instantiated once in parser.cpp instead of in every file that uses it
+    extern template class parser<int, simple_parser_actions>;
+}
+#endif
+
 #endif
@@ -32,6 +32,9 @@
 
 #include <vector>
 #include <stack>
+#include <utility>
+
+#include "TameParse/Util/memory_resource.h"
 
 namespace lr {
     ///
@@ -63,9 +66,13 @@ namespace lr {
     /// You don't actually create an instance of the stack class, but rather the parser_stack::reference class.
     /// The stack is free once there are no more references to it.
     ///
+    /// A stack can also be given fixed storage for its entries by the caller. It will never grow beyond this: instead,
+    /// pushes fail once it is full and overflowed() is set, so a parser using it has a bounded depth and doesn't
+    /// allocate while it runs.
+    ///
     template<typename item_type, int initial_depth = 64> class parser_stack {
     public:
-        class entry;
+        class storage;
         
     private:
         class internal_stack;
@@ -73,43 +80,96 @@ namespace lr {
         friend class internal_stack;
 
         typedef parser_stack<item_type, initial_depth> pstack;
+        
+        /// \brief Values for the link from an entry that isn't an index of the entry below it
+        enum {
+            /// \brief Previous index of a 'head' entry
+            head = -1,
+            
+            /// \brief Previous index of an unused entry
+            empty = -2
+        };
 
     public:
         ///
-        /// \brief Structure representing an entry in a parser stack
+        /// \brief Fixed storage for the entries of a parser stack, supplied by the caller
+        ///
+        /// The states, the links between entries and the items are kept in separate arrays, in the same way as they
+        /// are for a stack that allocates its own storage. Everything is allocated when this object is created.
         ///
-        class entry {
+        class storage {
         private:
-            friend class parser_stack<item_type, initial_depth>;
             friend class parser_stack<item_type, initial_depth>::internal_stack;
             
-            /// \brief -1 for a 'head' element, -2 for an empty element, or the entry 'below' this one
-            int m_PreviousIndex;
+            /// \brief The state IDs of the entries
+            std::vector<int, util::resource_allocator<int> > m_States;
             
-        public:
-            static const int head = -1;
-            static const int empty = -2;
+            /// \brief The entry 'below' each entry (or head or empty)
+            std::vector<int, util::resource_allocator<int> > m_Previous;
+            
+            /// \brief The items of the entries
+            std::vector<item_type, util::resource_allocator<item_type> > m_Items;
             
-            inline entry()
-            : m_PreviousIndex(empty) {
+        public:
+            /// \brief Creates storage for the specified number of entries (which must be at least 1)
+            explicit storage(int capacity)
+            : m_States((size_t) capacity, 0)
+            , m_Previous((size_t) capacity, empty)
+            , m_Items((size_t) capacity) {
             }
             
-            /// \brief The item associated with this entry
-            item_type item;
+            /// \brief The number of entries in this storage
+            inline int capacity() const { return (int) m_States.size(); }
             
-            /// \brief The state ID associated with this entry
-            int state;
+            /// \brief The number of bytes used by this storage (the items are counted by their size alone)
+            inline size_t memory_usage() const {
+                return sizeof(*this) + m_States.capacity() * sizeof(int) + m_Previous.capacity() * sizeof(int) + m_Items.capacity() * sizeof(item_type);
+            }
         };
         
     private:
-        class internal_stack {
+        ///
+        /// \brief The entries shared by a set of stack references
+        ///
+        /// Entries are stored as parallel arrays rather than as an array of structures: the state IDs and the links
+        /// between entries are all that's needed to walk the stack (when checking whether or not a symbol can be
+        /// reduced, for instance), so keeping them separate from the items means that these walks don't need to
+        /// read the items in to the cache.
+        ///
+        /// The stack and its entries are allocated from the memory_resource that was current when it was created.
+        ///
+        class internal_stack : public util::arena_object {
             friend class parser_stack<item_type, initial_depth>;
             
             /// \brief The first stack reference known about by this stack
             parser_stack<item_type, initial_depth>* m_RootReference;
             
-            /// \brief A vector of entries in this stack
-            std::vector<entry> m_Stack;
+            /// \brief The state IDs owned by this stack (unused if the entries were supplied by the caller)
+            std::vector<int, util::resource_allocator<int> > m_OwnedStates;
+            
+            /// \brief The entry links owned by this stack (unused if the entries were supplied by the caller)
+            std::vector<int, util::resource_allocator<int> > m_OwnedPrevious;
+            
+            /// \brief The items owned by this stack (unused if the entries were supplied by the caller)
+            std::vector<item_type, util::resource_allocator<item_type> > m_OwnedItems;
+            
+            /// \brief The state ID of each entry
+            int* m_States;
+            
+            /// \brief head for a 'head' entry, empty for an unused entry, or the index of the entry 'below' each entry
+            int* m_Previous;
+            
+            /// \brief The item associated with each entry
+            item_type* m_Items;
+            
+            /// \brief The number of entries in the stack
+            int m_Size;
+            
+            /// \brief True if the entries were supplied by the caller, in which case the stack never grows
+            bool m_Fixed;
+            
+            /// \brief Set to true when a fixed stack had no free entries for a push
+            bool m_Overflow;
             
             /// \brief The first unused stack entry
             int m_FirstUnused;
@@ -125,10 +185,37 @@ namespace lr {
         public:
             /// \brief Creates a new stack
             internal_stack()
-            : m_RootReference(NULL) {
-                m_Stack.resize(initial_depth);
-                m_FirstUnused = 0;
-                m_NumFree = (int)m_Stack.size();
+            : m_RootReference(NULL)
+            , m_OwnedStates(initial_depth, 0)
+            , m_OwnedPrevious(initial_depth, empty)
+            , m_OwnedItems(initial_depth)
+            , m_Fixed(false)
+            , m_Overflow(false) {
+                m_States        = &m_OwnedStates[0];
+                m_Previous      = &m_OwnedPrevious[0];
+                m_Items         = &m_OwnedItems[0];
+                m_Size          = (int) m_OwnedStates.size();
+                m_FirstUnused   = 0;
+                m_NumFree       = m_Size;
+            }
+            
+            /// \brief Creates a stack that uses the specified entries, and never grows
+            internal_stack(storage& entries)
+            : m_RootReference(NULL)
+            , m_States(&entries.m_States[0])
+            , m_Previous(&entries.m_Previous[0])
+            , m_Items(&entries.m_Items[0])
+            , m_Size(entries.capacity())
+            , m_Fixed(true)
+            , m_Overflow(false) {
+                // The storage may have been used by an earlier stack
+                for (int index = 0; index < m_Size; ++index) {
+                    m_Items[index]      = item_type();
+                    m_Previous[index]   = empty;
+                }
+                
+                m_FirstUnused   = 0;
+                m_NumFree       = m_Size;
             }
 
             /// \brief Destroys the stack (and any remaining references)
@@ -143,7 +230,7 @@ namespace lr {
             void collect() {
                 // Create a vector of marked elements
                 std::vector<bool> marks;
-                marks.resize(m_Stack.size(), false);
+                marks.resize(m_Size, false);
                 
                 // Mark any entries used by an active reference
                 std::stack<int> waiting;
@@ -164,19 +251,19 @@ namespace lr {
                     marks[next] = true;
                     
                     // Push the preceeding entry if there is one
-                    entry& waitingEntry = m_Stack[next];
-                    if (waitingEntry.m_PreviousIndex >= 0) {
-                        if (!marks[waitingEntry.m_PreviousIndex]) {
-                            waiting.push(waitingEntry.m_PreviousIndex);
+                    int previous = m_Previous[next];
+                    if (previous >= 0) {
+                        if (!marks[previous]) {
+                            waiting.push(previous);
                         }
                     }
                 }
                 
                 // Sweep any unused items in the stack
                 m_NumFree = 0;
-                for (size_t x=0; x<m_Stack.size(); ++x) {
+                for (int x=0; x<m_Size; ++x) {
                     if (!marks[x]) {
-                        m_Stack[x].m_PreviousIndex = entry::empty;
+                        m_Previous[x] = empty;
                         ++m_NumFree;
                     }
                 }
@@ -184,45 +271,76 @@ namespace lr {
             
         private:
             void grow_stack() {
-                // Work out how many new items to create
-                int numNew = (int)m_Stack.size();
-                if (numNew > initial_depth * 8) numNew = initial_depth * 8;
+                // Double the size of the stack: this ensures that the cost of collecting is proportional to the number
+                // of entries that have been pushed since the last collection, even when the stack is very deep
+                int numNew = m_Size;
                 
                 // Resize the stack by this amount
-                m_Stack.resize(m_Stack.size() + numNew);
-                m_NumFree += numNew;
+                m_OwnedStates.resize(m_OwnedStates.size() + numNew, 0);
+                m_OwnedPrevious.resize(m_OwnedPrevious.size() + numNew, empty);
+                m_OwnedItems.resize(m_OwnedItems.size() + numNew);
+                
+                m_States    = &m_OwnedStates[0];
+                m_Previous  = &m_OwnedPrevious[0];
+                m_Items     = &m_OwnedItems[0];
+                m_Size      = (int) m_OwnedStates.size();
+                m_NumFree  += numNew;
             }
             
         public:
-            /// \brief Finds the next unused item
+            /// \brief Finds the next unused item, or returns -1 if this is a fixed stack with no free entries
             int get_new() {
-                // Collect if we've run out of free items, and grow the stack if it's still looking empty
                 if (m_NumFree <= 0) {
-                    collect();
-                    if (m_NumFree < initial_depth/2) {
-                        grow_stack();
+                    if (m_Fixed) {
+                        // Entries popped from a stack with a single reference are freed straight away, so there's only
+                        // anything to collect if the stack has been forked
+                        if (m_RootReference != NULL && m_RootReference->m_Next != NULL) {
+                            collect();
+                        }
+                        
+                        if (m_NumFree <= 0) {
+                            m_Overflow = true;
+                            return -1;
+                        }
+                    } else {
+                        // Collect if we've run out of free items, and grow the stack if it's still looking empty
+                        // (Growing when less than a quarter of the stack is free avoids frequent collections that free little)
+                        collect();
+                        if (m_NumFree < m_Size/4 || m_NumFree < initial_depth/2) {
+                            grow_stack();
+                        }
                     }
                 }
                 
                 // Find a free entry
-                while (m_Stack[m_FirstUnused].m_PreviousIndex != entry::empty) {
+                while (m_Previous[m_FirstUnused] != empty) {
                     ++m_FirstUnused;
-                    if (m_FirstUnused >= (int) m_Stack.size()) m_FirstUnused = 0;
+                    if (m_FirstUnused >= m_Size) m_FirstUnused = 0;
                 }
                 
                 // m_FirstUnused now points to an entry we can use
                 int result = m_FirstUnused;
                 ++m_FirstUnused;
-                if (m_FirstUnused >= (int) m_Stack.size()) m_FirstUnused = 0;
+                if (m_FirstUnused >= m_Size) m_FirstUnused = 0;
                 
                 // Make this a 'head' entry
-                m_Stack[result].m_PreviousIndex = entry::head;
+                m_Previous[result] = head;
                 
                 // Number of free entries goes down
                 m_NumFree--;
                 
                 return result;
             }
+            
+            /// \brief Returns an entry that can't be reached by any reference to the list of free entries
+            void release(int index) {
+                m_Items[index]      = item_type();
+                m_Previous[index]   = empty;
+                
+                // Reuse this entry for the next push
+                m_FirstUnused = index;
+                ++m_NumFree;
+            }
         };
         
     private:
@@ -245,6 +363,7 @@ namespace lr {
         , m_Stack(stack) {
             m_Next = m_Stack->m_RootReference;
             m_Last = NULL;
+            if (m_Next) m_Next->m_Last = this;
             m_Stack->m_RootReference = this;
         }
         
@@ -254,6 +373,20 @@ namespace lr {
         , m_Index(m_Stack->get_new()) {
             m_Next = m_Stack->m_RootReference;
             m_Last = NULL;
+            if (m_Next) m_Next->m_Last = this;
+            m_Stack->m_RootReference = this;
+        }
+        
+        /// \brief Creates a stack that stores its entries in storage supplied by the caller
+        ///
+        /// The storage must remain valid until every reference to the stack has been destroyed. The head of the stack uses
+        /// one of the entries, so a storage with capacity n allows n - 1 items to be pushed on top of it.
+        explicit parser_stack(storage& entries)
+        : m_Stack(new internal_stack(entries))
+        , m_Index(m_Stack->get_new()) {
+            m_Next = m_Stack->m_RootReference;
+            m_Last = NULL;
+            if (m_Next) m_Next->m_Last = this;
             m_Stack->m_RootReference = this;
         }
         
@@ -263,6 +396,7 @@ namespace lr {
         , m_Index(copyFrom.m_Index) {
             m_Next = m_Stack->m_RootReference;
             m_Last = NULL;
+            if (m_Next) m_Next->m_Last = this;
             m_Stack->m_RootReference = this;
         }
         
@@ -291,69 +425,232 @@ namespace lr {
             }
         }
         
-        inline entry& operator*() {
-            return m_Stack->m_Stack[m_Index];
+        /// \brief The state ID on top of the stack
+        inline int& state() {
+            return m_Stack->m_States[m_Index];
         }
         
-        inline entry* operator->() {
-            return &m_Stack->m_Stack[m_Index];
-        }
-
-        inline const entry& operator*() const {
-            return m_Stack->m_Stack[m_Index];
+        /// \brief The state ID on top of the stack
+        inline int state() const {
+            return m_Stack->m_States[m_Index];
         }
         
-        inline const entry* operator->() const {
-            return &m_Stack->m_Stack[m_Index];
+        /// \brief The item on top of the stack
+        inline item_type& item() {
+            return m_Stack->m_Items[m_Index];
         }
         
-        /// \brief Returns the entry at the specified offset from this entry. 'x' should be a negative value
-        ///
-        /// IE, reference[-1] gives the entry preceeding this one on the stack
-        inline entry& operator[](int x) {
-            int index = m_Index;
-            for (int pos = x; pos < 0; ++pos) {
-                int nextIndex = m_Stack->m_Stack[index].m_PreviousIndex;
-                if (nextIndex >= 0) index = nextIndex;
-            }
-            return m_Stack->m_Stack[index];
+        /// \brief The item on top of the stack
+        inline const item_type& item() const {
+            return m_Stack->m_Items[m_Index];
         }
         
-        /// \brief Returns the entry at the specified offset from this entry. 'x' should be a negative value
+        /// \brief Returns the state at the specified offset from the top of the stack. 'x' should be a negative value
         ///
-        /// IE, reference[-1] gives the entry preceeding this one on the stack
-        inline const entry& operator[](int x) const {
-            int index = m_Index;
+        /// IE, state_at(-1) gives the state preceeding the top one on the stack. Only the states and the links
+        /// between them are read, so this doesn't touch any of the items.
+        inline int state_at(int x) const {
+            const int*  previous    = m_Stack->m_Previous;
+            int         index       = m_Index;
+            
             for (int pos = x; pos < 0; ++pos) {
-                int nextIndex = m_Stack->m_Stack[index].m_PreviousIndex;
+                int nextIndex = previous[index];
                 if (nextIndex >= 0) index = nextIndex;
             }
-            return m_Stack->m_Stack[index];
+            return m_Stack->m_States[index];
         }
 
         /// \brief Pushes a new item onto the stack, and updates this to point at it
-        inline void push(int state, const item_type& newItem) {
+        ///
+        /// Returns false, leaving the stack unchanged, if the stack has fixed storage and is full.
+        inline bool push(int state, const item_type& newItem) {
             int newIndex = m_Stack->get_new();
+            if (newIndex < 0) return false;
             
-            entry& newEntry = m_Stack->m_Stack[newIndex];
+            m_Stack->m_States[newIndex]     = state;
+            m_Stack->m_Items[newIndex]      = newItem;
+            m_Stack->m_Previous[newIndex]   = m_Index;
             
-            newEntry.state              = state;
-            newEntry.item               = newItem;
-            newEntry.m_PreviousIndex    = m_Index;
+            m_Index = newIndex;
+            return true;
+        }
+        
+#if __cplusplus >= 201103L
+        /// \brief Pushes a new item onto the stack by moving it, and updates this to point at it
+        inline bool push(int state, item_type&& newItem) {
+            int newIndex = m_Stack->get_new();
+            if (newIndex < 0) return false;
+            
+            m_Stack->m_States[newIndex]     = state;
+            m_Stack->m_Items[newIndex]      = std::move(newItem);
+            m_Stack->m_Previous[newIndex]   = m_Index;
             
             m_Index = newIndex;
+            return true;
+        }
+#endif
+        
+        /// \brief True if a push has failed because the stack has fixed storage and was full
+        inline bool overflowed() const {
+            return m_Stack->m_Overflow;
+        }
+        
+        /// \brief True if this is the only reference to this stack
+        ///
+        /// When this is true, entries popped from this reference can't be reached any more
+        inline bool unique() const {
+            return m_Next == NULL && m_Last == NULL;
+        }
+        
+        /// \brief True if this refers to the same entries as another stack reference
+        inline bool shares_entries(const parser_stack& compareTo) const {
+            return m_Stack == compareTo.m_Stack;
+        }
+        
+        /// \brief The number of bytes used by the entries that this reference shares with its copies
+        ///
+        /// The items are counted by their size alone. Storage that was supplied by the caller isn't included.
+        inline size_t memory_usage() const {
+            const internal_stack* entries = m_Stack;
+            
+            return sizeof(*this) + sizeof(*entries)
+                + entries->m_OwnedStates.capacity() * sizeof(int)
+                + entries->m_OwnedPrevious.capacity() * sizeof(int)
+                + entries->m_OwnedItems.capacity() * sizeof(item_type);
+        }
+        
+        /// \brief True if this stack contains the same sequence of states as another reference to the same internal stack
+        ///
+        /// The items are not compared, so two stacks that reached the same states via different reductions are considered
+        /// to be the same. Entries are followed until the stacks join, so this is fast for stacks that share most of
+        /// their entries.
+        inline bool same_states(const parser_stack& compareTo) const {
+            // Stacks in different internal stacks can never share entries
+            if (m_Stack != compareTo.m_Stack) return false;
+            
+            int ourIndex    = m_Index;
+            int theirIndex  = compareTo.m_Index;
+            
+            const int* states   = m_Stack->m_States;
+            const int* previous = m_Stack->m_Previous;
+            
+            while (ourIndex != theirIndex) {
+                // Different states, or stacks of different lengths
+                if (states[ourIndex] != states[theirIndex]) return false;
+                if (previous[ourIndex] < 0 || previous[theirIndex] < 0) return false;
+            
+                ourIndex    = previous[ourIndex];
+                theirIndex  = previous[theirIndex];
+            }
+            
+            return true;
+        }
+        
+        /// \brief Retrieves the item at the top of the stack, prior to popping it
+        ///
+        /// If no other reference can reach the entry, the item is moved out of the stack instead of being copied.
+        /// The entry should be popped immediately afterwards.
+        inline item_type take_item() {
+#if __cplusplus >= 201103L
+            if (unique()) {
+                return std::move(item());
+            }
+#endif
+            return item();
+        }
+        
+        /// \brief Pops every entry down to the head of the stack, and gives the head the specified state
+        ///
+        /// This must be the only reference to the stack. The popped entries are freed, but the storage for them is kept,
+        /// so a stack that is reset and reused doesn't need to allocate again until it grows deeper than it was before.
+        inline void reset(int state) {
+            while (pop()) { }
+            m_Stack->m_Overflow = false;
+            
+            m_Stack->m_States[m_Index]  = state;
+            m_Stack->m_Items[m_Index]   = item_type();
         }
         
         /// \brief Pops an item from the stack (returns false if this is currently pointing at a head item)
         ///
-        /// This reference is adjusted to point at the new head of the stack
+        /// This reference is adjusted to point at the new head of the stack. If this is the only reference to the
+        /// stack, the popped entry is freed immediately, so a parser that never forks never needs to garbage collect.
+        /// Forked stacks keep their entries until the next collection.
         inline bool pop() {
-            entry& ourEntry = operator*();
-            if (ourEntry.m_PreviousIndex == -1) return false;
-            m_Index = ourEntry.m_PreviousIndex;
+            int previous = m_Stack->m_Previous[m_Index];
+            if (previous == head) return false;
+            
+            int popped  = m_Index;
+            m_Index     = previous;
+            
+            if (unique()) {
+                m_Stack->release(popped);
+            }
             return true;
         }
     };
+    
+    ///
+    /// \brief Stack of states used when simulating the parser speculatively
+    ///
+    /// This is used when checking whether or not a symbol can be reduced, where we only need to track the states that
+    /// would be pushed on top of the real parser stack. Rather than allocating its own storage, it keeps its states at
+    /// the end of a scratch vector that is reused between checks, so once the scratch vector has grown to the size of
+    /// the largest simulation no further allocations are needed.
+    ///
+    /// Stacks that share a scratch vector must be used in a strictly nested fashion: a stack created after another can
+    /// be used until it is destroyed, but the older stack must not be modified until then.
+    ///
+    class speculative_stack {
+    private:
+        /// \brief The scratch vector that stores the states in this stack
+        std::vector<int>& m_Scratch;
+        
+        /// \brief The index of the first state in this stack
+        size_t m_Base;
+        
+        /// \brief Disabled assignment
+        speculative_stack& operator=(const speculative_stack& noAssignment);
+        
+    public:
+        /// \brief Creates an empty stack at the end of the specified scratch vector
+        explicit inline speculative_stack(std::vector<int>& scratch)
+        : m_Scratch(scratch)
+        , m_Base(scratch.size()) {
+        }
+        
+        /// \brief Creates a copy of a stack (which must be the most recently created stack using its scratch vector)
+        inline speculative_stack(const speculative_stack& copyFrom)
+        : m_Scratch(copyFrom.m_Scratch)
+        , m_Base(copyFrom.m_Scratch.size()) {
+            for (size_t pos = copyFrom.m_Base; pos < m_Base; ++pos) {
+                m_Scratch.push_back(m_Scratch[pos]);
+            }
+        }
+        
+        /// \brief Releases the space used by this stack
+        inline ~speculative_stack() {
+            m_Scratch.resize(m_Base);
+        }
+        
+        /// \brief True if there are no states on this stack
+        inline bool empty() const { return m_Scratch.size() == m_Base; }
+        
+        /// \brief The number of states on this stack
+        inline size_t size() const { return m_Scratch.size() - m_Base; }
+        
+        /// \brief The state on top of the stack
+        inline int& top() { return m_Scratch.back(); }
+        
+        /// \brief The state on top of the stack
+        inline int top() const { return m_Scratch.back(); }
+        
+        /// \brief Pushes a new state onto the stack
+        inline void push(int state) { m_Scratch.push_back(state); }
+        
+        /// \brief Removes the state on top of the stack
+        inline void pop() { m_Scratch.pop_back(); }
+    };
 }
 
 #endif
@@ -34,12 +34,31 @@ namespace lr {
     ///
     /// \brief Constructs a new state, used by the parser
     ///
-    template<typename I, typename A, typename T> parser<I, A, T>::state::state(const parser_tables* tables, int initialState, session* session) 
+    template<typename I, typename A, typename T, typename P> parser<I, A, T, P>::state::state(const P* tables, int initialState, session* session) 
     : m_Tables(tables)
     , m_Session(session)
-    , m_LookaheadPos(0) {
+    , m_LookaheadPos(0)
+    , m_InitialState(initialState) {
         // Push the initial state
-        m_Stack->state          = initialState;
+        m_Stack.state()         = initialState;
+        m_NextState             = m_Session->m_FirstState;
+        m_LastState             = NULL;
+        m_Session->m_FirstState = this;
+        
+        if (m_NextState) m_NextState->m_LastState = this;
+    }
+    
+    ///
+    /// \brief Constructs a new state whose stack is stored in the specified storage
+    ///
+    template<typename I, typename A, typename T, typename P> parser<I, A, T, P>::state::state(const P* tables, int initialState, session* session, typename stack::storage& stackStorage) 
+    : m_Tables(tables)
+    , m_Stack(stackStorage)
+    , m_Session(session)
+    , m_LookaheadPos(0)
+    , m_InitialState(initialState) {
+        // Push the initial state
+        m_Stack.state()         = initialState;
         m_NextState             = m_Session->m_FirstState;
         m_LastState             = NULL;
         m_Session->m_FirstState = this;
@@ -50,11 +69,12 @@ namespace lr {
     ///
     /// \brief Creates a new parser state by copying an old one. Parser states can be run independently.
     ///
-    template<typename I, typename A, typename T> parser<I, A, T>::state::state(const state& copyFrom)
+    template<typename I, typename A, typename T, typename P> parser<I, A, T, P>::state::state(const state& copyFrom)
     : m_Tables(copyFrom.m_Tables)
     , m_Session(copyFrom.m_Session)
     , m_Stack(copyFrom.m_Stack)
-    , m_LookaheadPos(copyFrom.m_LookaheadPos) {
+    , m_LookaheadPos(copyFrom.m_LookaheadPos)
+    , m_InitialState(copyFrom.m_InitialState) {
         m_NextState             = m_Session->m_FirstState;
         m_LastState             = NULL;
         m_Session->m_FirstState = this;
@@ -65,7 +85,7 @@ namespace lr {
     ///
     /// \brief Destructor
     ///
-    template<typename I, typename A, typename T> parser<I, A, T>::state::~state() {
+    template<typename I, typename A, typename T, typename P> parser<I, A, T, P>::state::~state() {
         // Remove this state from the session
         if (m_LastState) {
             m_LastState->m_NextState = m_NextState;
@@ -85,7 +105,7 @@ namespace lr {
     ///
     /// \brief Trims the lookahead in the sessions (removes any symbols that won't be visited again)
     ///
-    template<typename I, typename A, typename T> inline void parser<I, A, T>::state::trim_lookahead() {
+    template<typename I, typename A, typename T, typename P> inline void parser<I, A, T, P>::state::trim_lookahead() {
         // Find the minimum lookahead position in all of the states
         int minPos = m_LookaheadPos;
         for (state* whichState = m_Session->m_FirstState; whichState != NULL; whichState = whichState->m_NextState) {
@@ -95,8 +115,14 @@ namespace lr {
         // Give up if there's no work to do
         if (minPos == 0) return;
         
-        // Remove the symbols from the session
-        m_Session->m_Lookahead.erase(m_Session->m_Lookahead.begin(), m_Session->m_Lookahead.begin() + minPos);
+        // Remove the symbols from the session (this only touches the symbols that are removed)
+        m_Session->m_Lookahead.pop_front((size_t) minPos);
+        m_Session->m_LookaheadBase += minPos;
+        
+        // Forget about any guards that were evaluated against the symbols that were removed
+        // (Guard states are never negative, so this finds the first guard at or after the new start of the lookahead)
+        typename session::guard_cache& guards = m_Session->m_GuardCache;
+        guards.erase(guards.begin(), guards.lower_bound(std::make_pair(m_Session->m_LookaheadBase, -1)));
         
         // Update the state lookahead positions
         for (state* whichState = m_Session->m_FirstState; whichState != NULL; whichState = whichState->m_NextState) {
@@ -109,7 +135,7 @@ namespace lr {
     ///
     /// It is an error to call this without calling lookahead() at least once since the last call.
     ///
-    template<typename I, typename A, typename T> inline void parser<I, A, T>::state::next() {
+    template<typename I, typename A, typename T, typename P> inline void parser<I, A, T, P>::state::next() {
         ++m_LookaheadPos;
         trim_lookahead();
     }
@@ -117,26 +143,67 @@ namespace lr {
     ///
     /// \brief Retrieves the current lookahead character
     ///
-    template<typename I, typename A, typename T> inline const typename parser<I, A, T>::lexeme_container& parser<I, A, T>::state::look(int offset) {
+    template<typename I, typename A, typename T, typename P> inline const typename parser<I, A, T, P>::lexeme_container& parser<I, A, T, P>::state::look(int offset) {
         // Static lexeme container representing the end of the file
         static lexeme_container endOfFile((lexeme*)NULL);
         
         // Read a new symbol if necessary
         size_t pos = m_LookaheadPos + offset;
+        m_Trace.lookahead(offset);
         
         while (pos >= m_Session->m_Lookahead.size()) {
             if (!m_Session->m_EndOfFile) {
+                // In push sessions, we need to wait for more lexemes to be pushed
+                if (m_Session->m_PushInput) {
+                    m_Session->m_NeedInput = true;
+                    return endOfFile;
+                }
+                
+                // Stop if there's no room for another symbol in a bounded session
+                if (m_Session->m_Lookahead.full()) {
+                    m_Session->m_Overflow = true;
+                    return endOfFile;
+                }
+                
+                // Tell a context-aware lexer which terminals this state can use (only the next lookahead depends on the state)
+                if (m_Session->m_ContextLexer) {
+                    if (pos == (size_t) m_LookaheadPos) {
+                        m_Session->m_ContextLexer->set_valid_symbols(m_Tables->valid_terminals(m_Stack.state()), m_Tables->count_valid_terminals());
+                    } else {
+                        m_Session->m_ContextLexer->set_valid_symbols(NULL, 0);
+                    }
+                }
+                
+                // Switch a lexer with several modes into the one that this state expects its lookahead to be in
+                if (m_Session->m_ModeLexer && pos == (size_t) m_LookaheadPos) {
+                    int mode = m_Session->m_LexerModes->mode_for_state(m_Stack.state());
+                    if (mode >= 0) m_Session->m_ModeLexer->set_mode(mode);
+                }
+                
                 // Read the next symbol using the parser actions
-                dfa::lexeme_container nextLexeme(m_Session->m_Actions->read(), true);
+                m_Trace.reading_lexeme();
+                dfa::lexeme* nextLexeme = m_Session->m_Actions->read();
+                m_Trace.read_lexeme(nextLexeme);
                 
                 // Flag up an end of file condition
-                if (nextLexeme.item() == NULL) {
+                if (nextLexeme == NULL) {
                     m_Session->m_EndOfFile = true;
                     return endOfFile;
                 }
                 
+                // Stop if the lexeme is too long or the lookahead is too deep
+                if (!m_Session->within_limits(nextLexeme)) {
+                    delete nextLexeme;
+                    return endOfFile;
+                }
+                
                 // Store in the lookahead
-                m_Session->m_Lookahead.push_back(nextLexeme);
+                m_Session->add_lookahead(dfa::lexeme_container(nextLexeme, true));
+                
+                // Remember any guards that were evaluated ahead of time for this lexeme
+                if (m_Session->m_GuardSpeculator) {
+                    add_speculative_guards(nextLexeme);
+                }
             } else {
                 // EOF
                 return endOfFile;
@@ -157,7 +224,7 @@ namespace lr {
     /// generated. This is to support guard actions (where we are only interested in storing the state) as
     /// well as standard actions (where we want to call the actions object to actually perform the action)
     ///
-    template<class I, class A, class T> template<class actions> inline bool parser<I, A, T>::state::perform_generic(const lexeme_container& lookahead, const action* act, actions& actDelegate) {
+    template<class I, class A, class T, class P> template<class actions> inline bool parser<I, A, T, P>::state::perform_generic(const lexeme_container& lookahead, const action* act, actions& actDelegate) {
         switch (act->type) {
             case lr_action::act_ignore:
                 // Discard the current lookahead
@@ -170,12 +237,17 @@ namespace lr {
                 return true;
                 
             case lr_action::act_shiftstrong:
+                // Push the strong equivalent of the lookahead (the actions decide whether or not they need a lexeme for it)
+                actDelegate.shift_strong(this, act, lookahead);
+                return true;
+                
+            case lr_action::act_shiftreduce:
             {
-                // Fetch the strong equivalent of this symbol
-                int strongEquiv = m_Tables->strong_for_weak(lookahead->matched());
+                // Push the lookahead, then perform the reduction that the new state would perform whatever the next symbol is
+                const action* reduction = m_Tables->default_reduction(act->nextState);
                 
-                // Push a new lexeme with a different symbol onto the stack
-                actDelegate.shift(this, act, lexeme_container(new dfa::lexeme(lookahead->content(), lookahead->pos(), strongEquiv), true));
+                actDelegate.shift(this, act, lookahead);
+                actDelegate.reduce(this, reduction, m_Tables->rule(reduction->nextState));
                 return true;
             }
                 
@@ -191,7 +263,7 @@ namespace lr {
             case lr_action::act_accept:                 // An accepting action is the same as a reducing action
             {
                 // For reduce actions, the 'm_NextState' field actually refers to the rule that's being reduced
-                const parser_tables::reduce_rule& rule = m_Tables->rule(act->nextState);
+                const reduce_rule& rule = m_Tables->rule(act->nextState);
                 
                 // Pop items from the stack, and create an item for them by calling the actions
                 actDelegate.reduce(this, act, rule);
@@ -224,26 +296,99 @@ namespace lr {
     /// can produce an accepting state, then this will return the ID of the guard symbol that was accepted.
     /// If no accepting state is reached, this will return a negative value (generally -1)
     ///
-    template<typename I, typename A, typename T> int parser<I, A, T>::state::check_guard(int initialState, int initialOffset) {
+    template<typename I, typename A, typename T, typename P> int parser<I, A, T, P>::state::check_guard(int initialState, int initialOffset) {
+        typedef typename session::guard_cache cache;
+        
+        // Look for an earlier result for this guard at this position in the input
+        cache&                      guards  = m_Session->m_GuardCache;
+        std::pair<int, int>         key(m_Session->m_LookaheadBase + m_LookaheadPos + initialOffset, initialState);
+        typename cache::iterator    found   = guards.find(key);
+        
+        if (found != guards.end()) {
+            return found->second;
+        }
+        
+        // Evaluate the guard, noting whether or not it needed to look at the parser stack
+        bool readUnderlying = m_Session->m_ReadUnderlyingStack;
+        m_Session->m_ReadUnderlyingStack = false;
+        
+        if (m_Session->m_Counters) ++m_Session->m_Counters->guardsEvaluated;
+        int result = evaluate_guard(initialState, initialOffset);
+        
+        // Only cache the result if it didn't depend on the stack (this should only happen if the tables are invalid), and
+        // if all of the lookahead the guard needed was available (bounded sessions don't cache anything, as the cache would grow)
+        if (!m_Session->m_ReadUnderlyingStack && !m_Session->m_NeedInput && !m_Session->m_LimitExceeded && !m_Session->m_Bounded) {
+            guards.insert(typename cache::value_type(key, result));
+        }
+        m_Session->m_ReadUnderlyingStack = readUnderlying || m_Session->m_ReadUnderlyingStack;
+        
+        return result;
+    }
+    
+    ///
+    /// \brief Adds the guard results that the speculative guard stream found for a lexeme that was just read to the guard cache
+    ///
+    template<typename I, typename A, typename T, typename P> void parser<I, A, T, P>::state::add_speculative_guards(const dfa::lexeme* newLexeme) {
+        typedef speculative_guard_stream::guard_result guard_result;
+        
+        // The lexer limits can stop the parser from seeing the input that the guards read, so results aren't used with them
+        const parser_limits& limits = m_Session->m_Limits;
+        if (m_Session->m_Bounded || limits.maxLexemeLength > 0 || limits.maxLookahead > 0) return;
+        
+        const guard_result* first;
+        const guard_result* last;
+        if (!m_Session->m_GuardSpeculator->results_for(newLexeme, first, last)) return;
+        
+        int position = m_Session->m_LookaheadBase + (int) m_Session->m_Lookahead.size() - 1;
+        for (const guard_result* result = first; result != last; ++result) {
+            // Guards that read too much of the lookahead are left for the parser to reject
+            if (limits.maxGuardLookahead > 0 && result->length > limits.maxGuardLookahead) continue;
+            
+            m_Session->m_GuardCache.insert(typename session::guard_cache::value_type(std::make_pair(position, result->guardState), result->accepted));
+        }
+    }
+    
+    ///
+    /// \brief Runs the parser forward to evaluate a guard (the uncached part of check_guard)
+    ///
+    template<typename I, typename A, typename T, typename P> int parser<I, A, T, P>::state::evaluate_guard(int initialState, int initialOffset) {
+        // Guards that only look at a few terminal symbols don't need the parser to be run
+        const guard_dfa* compiledGuards = m_Tables->compiled_guards();
+        if (compiledGuards) {
+            int dfaState = compiledGuards->start_state(initialState);
+            if (dfaState >= 0) {
+                return evaluate_compiled_guard(*compiledGuards, dfaState, initialOffset);
+            }
+        }
+        
         // Create the guard actions object
-        guard_actions guardActions(initialState, initialOffset);
+        guard_actions guardActions(m_Session->m_SpeculativeStates, initialState, initialOffset);
         
         // Set to true once the EOG symbol can be reduced
         bool canReduceEog = false;
         
         // Perform parser actions to decide if the guard is accepted or not
         for (;;) {
+            // Give up if the guard is looking too far ahead
+            if (!within_guard_limit(guardActions.offset() - initialOffset + 1)) return -1;
+            
             // Fetch the lookahead
             const lexeme_container& la = look(guardActions.offset());
             
             // Get the current state
             int state = guardActions.current_state(this);
             
+            // States with a default reduction have no other lookahead actions
+            if (m_Tables->has_default_reduction(state)) {
+                perform_generic(la, m_Tables->default_reduction(state), guardActions);
+                continue;
+            }
+            
             // Get the action for this lookahead
             int sym;
             bool isTerminal;
-            parser_tables::action_iterator act;
-            parser_tables::action_iterator end;
+            action_iterator act;
+            action_iterator end;
             
             if (la.item() != NULL) {
                 // The item is a terminal
@@ -262,7 +407,7 @@ namespace lr {
             // Reduce the EOG symbol as soon as possible
             if (m_Tables->has_end_of_guard(state)) {
                 // Check if we can reduce the EOG symbol in this state
-                parser_tables::action_iterator eogAct = m_Tables->find_nonterminal(state, m_Tables->end_of_guard());
+                action_iterator eogAct = m_Tables->find_nonterminal(state, m_Tables->end_of_guard());
                 canReduceEog = guardActions.can_reduce_nonterminal(m_Tables->end_of_guard(), eogAct, this);
                 
                 // If we can reduce the symbol, then change the lookahead
@@ -302,7 +447,7 @@ namespace lr {
                 // The guard is matched if this is an accepting action
                 if (act->type == lr_action::act_accept) {
                     // Get the accepting rule
-                    const parser_tables::reduce_rule& rule = m_Tables->rule(act->nextState);
+                    const reduce_rule& rule = m_Tables->rule(act->nextState);
                     
                     // Return the nonterminal ID for this rule, which should be the ID of the guard that was 
                     // matched
@@ -350,8 +495,65 @@ namespace lr {
         return -1;
     }
     
+    ///
+    /// \brief Checks that a guard can read the specified number of lexemes without exceeding the limits, and updates the counters
+    ///
+    template<typename I, typename A, typename T, typename P> inline bool parser<I, A, T, P>::state::within_guard_limit(int depth) {
+        int maxDepth = m_Session->m_Limits.maxGuardLookahead;
+        
+        if (maxDepth > 0 && depth > maxDepth) {
+            m_Session->m_LimitExceeded = true;
+            if (m_Session->m_Counters) ++m_Session->m_Counters->guardLookaheadExceeded;
+            return false;
+        }
+        
+        if (m_Session->m_Counters && depth > m_Session->m_Counters->deepestGuardLookahead) {
+            m_Session->m_Counters->deepestGuardLookahead = depth;
+        }
+        return true;
+    }
+    
+    ///
+    /// \brief Evaluates a guard using its compiled DFA, starting in the specified DFA state
+    ///
+    /// This produces the same result as running the parser, but only needs to look up each lookahead symbol
+    ///
+    template<typename I, typename A, typename T, typename P> int parser<I, A, T, P>::state::evaluate_compiled_guard(const guard_dfa& guards, int dfaState, int initialOffset) {
+        for (int offset = initialOffset; ; ++offset) {
+            // Stop if this state accepts the guard
+            int accepted = guards.accepted_guard(dfaState);
+            if (accepted >= 0) return accepted;
+            
+            // Give up if the guard is looking too far ahead
+            if (!within_guard_limit(offset - initialOffset + 1)) return -1;
+            
+            // Move to the next state
+            const lexeme_container& la = look(offset);
+            
+            if (la.item() != NULL) {
+                dfaState = guards.next_state(dfaState, la->matched());
+            } else {
+                dfaState = guards.end_of_input_state(dfaState);
+            }
+            
+            // The guard is rejected if there's no transition for the lookahead
+            if (dfaState < 0) return -1;
+        }
+    }
+    
+    /// \brief Returns the state on top of a speculative stack built on top of the specified position in the real stack
+    template<typename I, typename A, typename T, typename P> inline int parser<I, A, T, P>::state::speculative_state(const speculative_stack& pushed, int stackPos, const stack& underlyingStack) {
+        if (!pushed.empty()) {
+            return pushed.top();
+        }
+        
+        // The result of the current check depends on the real parser stack
+        m_Session->m_ReadUnderlyingStack = true;
+        return underlyingStack.state_at(stackPos);
+    }
+    
     /// \brief Fakes up a reduce action during can_reduce testing. act must be a reduce action
-    template<typename I, typename A, typename T> inline void parser<I, A, T>::state::fake_reduce(parser_tables::action_iterator act, int& stackPos, std::stack<int>& pushed, const stack& underlyingStack) {
+    template<typename I, typename A, typename T, typename P> inline void parser<I, A, T, P>::state::fake_reduce(action_iterator act, int& stackPos, speculative_stack& pushed, const stack& underlyingStack) {
         // Verify the action type
         switch (act->type) {
             // Reduce actions are fairly easy
@@ -360,7 +562,7 @@ namespace lr {
             case lr_action::act_accept:
             {
                 // Get the reduce rule
-                const parser_tables::reduce_rule& rule = m_Tables->rule(act->nextState);
+                const reduce_rule& rule = m_Tables->rule(act->nextState);
                 
                 // Pop items from the stack
                 for (int x=0; x<rule.length; ++x) {
@@ -374,38 +576,25 @@ namespace lr {
                 }
                 
                 // Work out the current state
-                int state;
-                if (!pushed.empty()) {
-                    state = pushed.top();
-                } else {
-                    state = underlyingStack[stackPos].state;
-                }
+                int state = speculative_state(pushed, stackPos, underlyingStack);
                 
                 // Work out the goto action
-                parser_tables::action_iterator gotoAct = m_Tables->find_nonterminal(state, rule.identifier);
-                for (; gotoAct != m_Tables->last_nonterminal_action(state); ++gotoAct) {
-                    if (gotoAct->type == lr_action::act_goto) {
-                        // Push this goto
-                        pushed.push(gotoAct->nextState);
-                        break;
-                    }
+                int gotoState = m_Tables->goto_state(state, rule.identifier);
+                if (gotoState >= 0) {
+                    // Push this goto
+                    pushed.push(gotoState);
                 }
                 break;
             }
 
             case lr_action::act_divert:
-                // Divert actions just change the state on top of the stack
-                if (!pushed.empty()) {
-                    pushed.pop();
-                } else {
-                    stackPos--;
-                }
-
+                // Divert actions push a new state without consuming the lookahead, in the same way as perform() does
                 pushed.push(act->nextState);
                 break;
 
             case lr_action::act_shift:
             case lr_action::act_shiftstrong:
+            case lr_action::act_shiftreduce:
                 // Shift actions just move to the next state
                 pushed.push(act->nextState);
                 break;
@@ -413,34 +602,91 @@ namespace lr {
     }
     
     /// \brief Returns true if a reduction of the specified lexeme will result in it being shifted
-    template<typename I, typename A, typename T> template<class symbol_fetcher> bool parser<I, A, T>::state::can_reduce(int symbol, int stackPos, std::stack<int> pushed, const stack& underlyingStack) {
-        // Get the new state
-        int state;
-        if (!pushed.empty()) {
-            // (This will always happen unless there's a bug in the parser tables)
-            state = pushed.top();
-        } else {
-            state = underlyingStack[stackPos].state;
+    ///
+    /// Whether or not a symbol can be shifted often only depends on the state on top of the stack, so this first
+    /// simulates the parser starting from just that state. If the simulation never needs to look at the rest of
+    /// the stack its result is stored in the session and reused by later checks.
+    template<typename I, typename A, typename T, typename P> template<class symbol_fetcher> bool parser<I, A, T, P>::state::can_reduce(int symbol, int stackPos, speculative_stack& pushed, const stack& underlyingStack) {
+        typedef typename session::can_reduce_cache cache;
+        
+        // Bounded sessions don't allocate space for a cache
+        if (m_Session->m_Bounded) {
+            return simulate_can_reduce<symbol_fetcher>(symbol, stackPos, pushed, underlyingStack);
+        }
+        
+        // Look up the result for the current state
+        int                         state   = speculative_state(pushed, stackPos, underlyingStack);
+        cache&                      results = m_Session->m_CanReduceCache[symbol_fetcher::c_CacheIndex];
+        std::pair<int, int>         key(state, symbol);
+        typename cache::iterator    found   = results.find(key);
+        
+        if (found == results.end()) {
+            // Simulate the parser from just this state, noting whether or not the real stack is needed
+            bool readUnderlying = m_Session->m_ReadUnderlyingStack;
+            m_Session->m_ReadUnderlyingStack = false;
+            
+            int result;
+            {
+                speculative_stack stateOnly(m_Session->m_SpeculativeStates);
+                stateOnly.push(state);
+                
+                result = simulate_can_reduce<symbol_fetcher>(symbol, stackPos, stateOnly, underlyingStack) ? 1 : 0;
+            }
+            
+            if (m_Session->m_ReadUnderlyingStack) {
+                result = session::c_DependsOnStack;
+            }
+            m_Session->m_ReadUnderlyingStack = readUnderlying;
+            
+            // Cache the result
+            found = results.insert(typename cache::value_type(key, result)).first;
+        }
+        
+        // Use the cached result if it doesn't depend on the stack
+        if (found->second != session::c_DependsOnStack) {
+            return found->second != 0;
         }
         
+        // Simulate the parser using the full stack
+        return simulate_can_reduce<symbol_fetcher>(symbol, stackPos, pushed, underlyingStack);
+    }
+    
+    /// \brief Simulates the parser to find out if the specified symbol will be shifted (the uncached part of can_reduce)
+    template<typename I, typename A, typename T, typename P> template<class symbol_fetcher> bool parser<I, A, T, P>::state::simulate_can_reduce(int symbol, int stackPos, speculative_stack& pushed, const stack& underlyingStack) {
+        // Get the new state
+        int state = speculative_state(pushed, stackPos, underlyingStack);
+        
         // Get the initial action for the terminal
-        parser_tables::action_iterator act = symbol_fetcher::find_symbol(m_Tables, state, symbol);
+        action_iterator act = symbol_fetcher::find_symbol(m_Tables, state, symbol);
         
         // Find the first reduce action for this item
-        while (act != symbol_fetcher::last_symbol_action(m_Tables, state)) {
-            // Fail if there are no actions for this terminal
-            if (act->symbolId != symbol) return false;
+        for (;;) {
+            // If there are no actions for this symbol, then this fails unless the state has a default reduction
+            if (act == symbol_fetcher::last_symbol_action(m_Tables, state) || act->symbolId != symbol) {
+                if (!symbol_fetcher::has_default_reduction(m_Tables, state)) return false;
+                
+                // Reduce and try again in the new state
+                fake_reduce(m_Tables->default_reduction(state), stackPos, pushed, underlyingStack);
+                
+                state   = speculative_state(pushed, stackPos, underlyingStack);
+                act     = symbol_fetcher::find_symbol(m_Tables, state, symbol);
+                continue;
+            }
             
             switch (act->type) {
                 case lr_action::act_shift:
                 case lr_action::act_shiftstrong:
+                case lr_action::act_shiftreduce:
                 case lr_action::act_accept:
                     // This terminal will result in a shift: this is successful
                     return true;
                     
                 case lr_action::act_divert:
-                    // Push the new state to the stack
+                    // Push the new state to the stack, and carry on looking for the same symbol in that state
                     pushed.push(act->nextState);
+                    
+                    state   = speculative_state(pushed, stackPos, underlyingStack);
+                    act     = symbol_fetcher::find_symbol(m_Tables, state, symbol);
                     break;
                     
                 case lr_action::act_guard:
@@ -459,8 +705,8 @@ namespace lr {
                 {
                     // To deal with weak reduce actions, we need to fake up the reduction and try again
                     // Use a separate stack so we can carry on after the action
-                    int             weakPos = stackPos;
-                    std::stack<int> weakStack(pushed);
+                    int                 weakPos = stackPos;
+                    speculative_stack   weakStack(pushed);
                     
                     // If we can reduce via this item, then the result is true
                     fake_reduce(act, weakPos, weakStack, underlyingStack);
@@ -479,13 +725,7 @@ namespace lr {
                     fake_reduce(act, stackPos, pushed, underlyingStack);
                     
                     // Get the new state
-                    int state;
-                    if (!pushed.empty()) {
-                        // (This will always happen unless there's a bug in the parser tables)
-                        state = pushed.top();
-                    } else {
-                        state = underlyingStack[stackPos].state;
-                    }
+                    state = speculative_state(pushed, stackPos, underlyingStack);
                     
                     // Get the initial action for the terminal
                     act = symbol_fetcher::find_symbol(m_Tables, state, symbol);
@@ -499,21 +739,18 @@ namespace lr {
                     return false;
             }
         }
-        
-        // Result is false if we run out of actions
-        return false;
     }
 
     /// \brief Performs a single parsing action, and returns the result
     ///
     /// This version takes several parameters: the current lookahead token, the ID of the symbol and whether or not it's
     /// a terminal symbol, and the range of actions that might apply to this particular symbol.
-    template<typename I, typename A, typename T> template<class actions> inline parser_result::result parser<I,A,T>::state::process_generic(
+    template<typename I, typename A, typename T, typename P> template<class actions> inline parser_result::result parser<I, A, T, P>::state::process_generic(
                                                           actions& actDelegate, 
                                                           const lexeme_container& la, 
                                                           int symbol, bool isTerminal,
-                                                          parser_tables::action_iterator& act, 
-                                                          parser_tables::action_iterator& end) {
+                                                          action_iterator& act, 
+                                                          action_iterator& end) {
         // Work out which action to perform
         for (; act != end; ++act) {
             // Stop searching if the symbol is invalid
@@ -538,6 +775,21 @@ namespace lr {
                 // Check if this guard generates a guard symbol
                 int guardSym = actDelegate.check_guard(this, act->nextState);
                 
+                // Nothing has been performed yet, so wait if the guard needs more lookahead than has been pushed
+                if (m_Session->m_NeedInput) {
+                    return parser_result::need_input;
+                }
+                
+                // Or stop if it needs more lookahead than a bounded session can hold
+                if (m_Session->m_Overflow) {
+                    return parser_result::overflow;
+                }
+                
+                // Or if it looked further ahead than the limits allow
+                if (m_Session->m_LimitExceeded) {
+                    return parser_result::limit_exceeded;
+                }
+                
                 // If the guard was not matched, continue to the next action for this symbol
                 if (guardSym < 0) {
                     continue;
@@ -573,34 +825,61 @@ namespace lr {
     
     
     /// \brief Performs a single parsing action, and returns the result
-    template<typename I, typename A, typename T> template<class actions> inline parser_result::result parser<I,A,T>::state::process_generic(actions& actDelegate) {
+    template<typename I, typename A, typename T, typename P> template<class actions> inline parser_result::result parser<I, A, T, P>::state::process_generic(actions& actDelegate) {
         // Fetch the lookahead
         lexeme_container la = actDelegate.look(this);
         
+        // Wait for more input if there are no more lexemes in a push session
+        if (m_Session->m_NeedInput) {
+            return parser_result::need_input;
+        }
+        
+        // Stop if the lookahead in a bounded session is full
+        if (m_Session->m_Overflow) {
+            return parser_result::overflow;
+        }
+        
+        // Or if the input has exceeded the limits
+        if (m_Session->m_LimitExceeded) {
+            return parser_result::limit_exceeded;
+        }
+        
         // Get the state
-        int state = m_Stack->state;
+        int state = m_Stack.state();
         
-        // Get the action for this lookahead
-        int                             sym;
-        parser_tables::action_iterator  act;
-        parser_tables::action_iterator  end;
-        bool                            isTerminal;
+        // States with a default reduction reduce without needing to look for an action for the lookahead
+        if (m_Tables->has_default_reduction(state)) {
+            perform_generic(la, m_Tables->default_reduction(state), actDelegate);
+            return parser_result::more;
+        }
         
-        if (la.item() != NULL) {
+        // When parsing one of several documents, the separator or a terminal that can't continue the document marks
+        // its end (see parse_document())
+        if (la.item() != NULL && m_Session->m_ParsingDocument && !m_Session->m_EndOfDocument) {
+            int             terminal    = la->matched();
+            action_iterator terminalAct = m_Tables->find_terminal(state, terminal);
+            
+            if (terminal == m_Session->m_DocumentSeparator || terminalAct == m_Tables->last_terminal_action(state) || terminalAct->symbolId != terminal) {
+                m_Session->m_EndOfDocument = true;
+            }
+        }
+        
+        // Get the action for this lookahead
+        if (la.item() != NULL && !m_Session->m_EndOfDocument) {
             // The item is a terminal
-            sym         = la->matched();
-            isTerminal  = true;
-            act         = m_Tables->find_terminal(state, sym);
-            end         = m_Tables->last_terminal_action(state);
+            int             sym = la->matched();
+            action_iterator act = m_Tables->find_terminal(state, sym);
+            action_iterator end = m_Tables->last_terminal_action(state);
+            
+            return process_generic(actDelegate, la, sym, true, act, end);
         } else {
             // The item is the end-of-input symbol (which counts as a nonterminal)
-            sym         = m_Tables->end_of_input();
-            isTerminal  = false;
-            act         = m_Tables->find_nonterminal(state, sym);
-            end         = m_Tables->last_nonterminal_action(state);
+            int             sym = m_Tables->end_of_input();
+            action_iterator act = m_Tables->find_nonterminal(state, sym);
+            action_iterator end = m_Tables->last_nonterminal_action(state);
+            
+            return process_generic(actDelegate, la, sym, false, act, end);
         }
-        
-        return process_generic(actDelegate, la, sym, isTerminal, act, end);
     }
     
     /// \brief Updates the state according to the actions required by a guard symbol
@@ -612,10 +891,9 @@ namespace lr {
     /// Practical experience indicates that guards are often used in situations that are not quite LALR(1); checking
     /// whether or not reductions will be successful makes them easier to use as they will not cause spurious reductions
     /// in situations where it's not appropriate.
-    template<typename I, typename A, typename T> template<class actions> bool parser<I, A, T>::state::process_guard(actions& actDelegate, 
+    template<typename I, typename A, typename T, typename P> template<class actions> bool parser<I, A, T, P>::state::process_guard(actions& actDelegate, 
                                                                                                const lexeme_container& la, 
                                                                                                int guardSymbol) {
-        typedef parser_tables::action_iterator action_iterator;
         
         // Fetch the actions for this symbol
         int              state = actDelegate.current_state(this);
@@ -644,7 +922,7 @@ namespace lr {
             }
             
             // Shift actions are always allowed
-            else if (checkAction->type == lr_action::act_shift || checkAction->type == lr_action::act_shiftstrong) {
+            else if (checkAction->type == lr_action::act_shift || checkAction->type == lr_action::act_shiftstrong || checkAction->type == lr_action::act_shiftreduce) {
                 canReduce = true;
                 break;
             }
@@ -685,6 +963,13 @@ namespace lr {
             }
             
             // Perform this action
+            if (act->type == lr_action::act_shift || act->type == lr_action::act_shiftreduce) {
+                // The guard symbol itself covers no text: it is shifted as an empty lexeme at the position of the
+                // lookahead, so the text of the lookahead is only shifted once
+                perform_generic(lexeme_container(new lexeme(lexeme::symbols(), la->pos(), la->matched()), true), act, actDelegate);
+                break;
+            }
+            
             if (perform_generic(la, act, actDelegate)) {
                 // Finish once a new symbol is requested
                 break;
@@ -699,6 +984,370 @@ namespace lr {
         // Looks good
         return true;
     }
+    
+    /// \brief Collects the actions that a GLR parse should follow from this state for the specified lookahead
+    template<typename I, typename A, typename T, typename P> template<class actions> bool parser<I, A, T, P>::state::glr_actions(actions& actDelegate, const lexeme_container& la, std::vector<const action*>& result) {
+        result.clear();
+        
+        // Get the state
+        int state = m_Stack.state();
+        
+        // States with a default reduction only have one action
+        if (m_Tables->has_default_reduction(state)) {
+            result.push_back(m_Tables->default_reduction(state));
+            return true;
+        }
+        
+        // Get the actions for this lookahead
+        int                             sym;
+        action_iterator  act;
+        action_iterator  end;
+        bool                            isTerminal;
+        
+        if (la.item() != NULL) {
+            sym         = la->matched();
+            isTerminal  = true;
+            act         = m_Tables->find_terminal(state, sym);
+            end         = m_Tables->last_terminal_action(state);
+        } else {
+            sym         = m_Tables->end_of_input();
+            isTerminal  = false;
+            act         = m_Tables->find_nonterminal(state, sym);
+            end         = m_Tables->last_nonterminal_action(state);
+        }
+        
+        for (; act != end && act->symbolId == sym; ++act) {
+            switch (act->type) {
+                case lr_action::act_guard:
+                    // Guards are handled by the deterministic parser
+                    return false;
+                    
+                case lr_action::act_weakreduce:
+                    // Weak reductions decide between weak and strong symbols, so they replace the other actions when they succeed
+                    if (isTerminal ? actDelegate.can_reduce(sym, act, this) : actDelegate.can_reduce_nonterminal(sym, act, this)) {
+                        result.clear();
+                        result.push_back(act);
+                        return true;
+                    }
+                    break;
+                    
+                default:
+                    result.push_back(act);
+                    break;
+            }
+        }
+        
+        return true;
+    }
+    
+    ///
+    /// \brief Parses the input using a GLR-style algorithm, and returns true if it was accepted
+    ///
+    template<typename I, typename A, typename T, typename P> bool parser<I, A, T, P>::state::parse_glr() {
+        typedef std::vector<state*> state_list;
+        
+        standard_actions            actDelegate;
+        std::vector<const action*>  acts;
+        std::vector<stack>          visited;
+        state_list                  active(1, this);
+        state_list                  shifted;
+        state*                      accepted    = NULL;
+        bool                        thisAlive   = true;
+        
+        m_Session->m_NeedInput = false;
+        
+        // Each round runs every state until it has moved past the current lookahead symbol
+        // (The parse stops if the input exceeds the limits, as the states would see it as the end of the input)
+        while (!active.empty() && !accepted && !m_Session->m_LimitExceeded) {
+            // A dead initial state is kept in step with the others so that it doesn't stop the lookahead being trimmed
+            if (!thisAlive) {
+                m_LookaheadPos = active[0]->m_LookaheadPos;
+            }
+            
+            visited.clear();
+            shifted.clear();
+            
+            while (!active.empty() && !accepted && !m_Session->m_LimitExceeded) {
+                state* current = active.back();
+                active.pop_back();
+                
+                // Merge with any state that has already been through this point
+                bool merged = false;
+                for (typename std::vector<stack>::const_iterator visit = visited.begin(); visit != visited.end(); ++visit) {
+                    if (visit->same_states(current->m_Stack)) {
+                        merged = true;
+                        break;
+                    }
+                }
+                
+                if (!merged) {
+                    visited.push_back(current->m_Stack);
+                    
+                    // Fetch the actions for this state
+                    const lexeme_container& la = current->look();
+                    
+                    if (m_Session->m_LimitExceeded) {
+                        // Stop without using the truncated lookahead
+                        active.push_back(current);
+                        continue;
+                    }
+                    
+                    if (!current->glr_actions(actDelegate, la, acts)) {
+                        // Guards are resolved deterministically: work out what happened from the lookahead position
+                        int                 before  = current->m_LookaheadPos + m_Session->m_LookaheadBase;
+                        parser_result::result res   = current->process_generic(actDelegate);
+                        
+                        if (res == parser_result::accept) {
+                            accepted = current;
+                        } else if (res == parser_result::more) {
+                            if (current->m_LookaheadPos + m_Session->m_LookaheadBase != before) {
+                                shifted.push_back(current);
+                            } else {
+                                active.push_back(current);
+                            }
+                        } else {
+                            merged = true;
+                        }
+                    } else if (acts.empty()) {
+                        // This state has reached an error
+                        actDelegate.reject(la);
+                        merged = true;
+                    } else {
+                        // Split the state so there's one for each action (the copies share the stack)
+                        state_list forks(1, current);
+                        for (size_t x=1; x<acts.size(); ++x) {
+                            forks.push_back(new state(*current));
+                        }
+                        
+                        // The lookahead may be moved by the actions
+                        lexeme_container lookahead = la;
+                        
+                        for (size_t x=0; x<acts.size(); ++x) {
+                            if (acts[x]->type == lr_action::act_accept) {
+                                if (!accepted) {
+                                    accepted = forks[x];
+                                } else {
+                                    active.push_back(forks[x]);
+                                }
+                            } else if (forks[x]->perform_generic(lookahead, acts[x], actDelegate)) {
+                                actDelegate.next(forks[x]);
+                                shifted.push_back(forks[x]);
+                            } else {
+                                active.push_back(forks[x]);
+                            }
+                        }
+                    }
+                }
+                
+                // Get rid of states that were merged or have died
+                if (merged) {
+                    if (current == this) {
+                        thisAlive = false;
+                    } else {
+                        delete current;
+                    }
+                }
+            }
+            
+            // Move on to the next symbol
+            if (!accepted) {
+                active.swap(shifted);
+            }
+        }
+        
+        // Destroy the states that didn't accept
+        for (typename state_list::iterator rejected = active.begin(); rejected != active.end(); ++rejected) {
+            if (*rejected != this && *rejected != accepted) delete *rejected;
+        }
+        for (typename state_list::iterator rejected = shifted.begin(); rejected != shifted.end(); ++rejected) {
+            if (*rejected != this && *rejected != accepted) delete *rejected;
+        }
+        
+        if (!accepted || m_Session->m_LimitExceeded) {
+            if (accepted && accepted != this) delete accepted;
+            return false;
+        }
+        
+        // Take on the stack of the state that accepted
+        if (accepted != this) {
+            m_Stack         = accepted->m_Stack;
+            m_LookaheadPos  = accepted->m_LookaheadPos;
+            delete accepted;
+        }
+        
+        return true;
+    }
+    
+    /// \brief Adds a symbol to the lookahead at the specified offset from the current position
+    template<typename I, typename A, typename T, typename P> void parser<I, A, T, P>::state::insert_lookahead(int offset, int symbol) {
+        static const dfa::position eofPos(-1, -1, -1);
+        
+        // The inserted symbol is an empty lexeme at the position of the symbol it is inserted before
+        const lexeme_container& before  = look(offset);
+        dfa::position           pos     = before.item() ? before->pos() : eofPos;
+        
+        if (!m_Session->m_Lookahead.insert((size_t) (m_LookaheadPos + offset), lexeme_container(new lexeme(lexeme::symbols(), pos, symbol), true))) {
+            m_Session->m_Overflow = true;
+        }
+        
+        // Cached guard results refer to input positions, which have now moved
+        m_Session->m_GuardCache.clear();
+    }
+    
+    /// \brief Removes the symbol at the specified offset from the current position from the lookahead
+    template<typename I, typename A, typename T, typename P> void parser<I, A, T, P>::state::remove_lookahead(int offset) {
+        m_Session->m_Lookahead.erase((size_t) (m_LookaheadPos + offset));
+        m_Session->m_GuardCache.clear();
+    }
+    
+    /// \brief Returns true if the parser can continue from this state after popping some states and skipping some symbols
+    template<typename I, typename A, typename T, typename P> bool parser<I, A, T, P>::state::trial_parse(int skip, int popped, int validateSymbols) {
+        // Try the repair on a copy of this state
+        state           trial(*this);
+        trial_actions   actions;
+        
+        for (int x=0; x<popped; ++x) {
+            if (!trial.m_Stack.pop()) return false;
+        }
+        
+        // Skip symbols (making sure they've been read first)
+        for (int x=0; x<skip; ++x) {
+            if (!trial.look().item()) return false;
+            ++trial.m_LookaheadPos;
+        }
+        
+        // Run the parser until enough symbols have been shifted
+        int start = trial.m_LookaheadPos + m_Session->m_LookaheadBase;
+        
+        for (;;) {
+            if (trial.m_LookaheadPos + m_Session->m_LookaheadBase - start >= validateSymbols) {
+                return true;
+            }
+            
+            parser_result::result res = trial.process_generic(actions);
+            
+            if (res == parser_result::accept) return true;
+            if (res != parser_result::more) return false;
+        }
+    }
+    
+    /// \brief Finds a terminal symbol that can be inserted after skipping a number of symbols to repair an error
+    template<typename I, typename A, typename T, typename P> int parser<I, A, T, P>::state::find_insertion(int skip, int validateSymbols) {
+        // Make sure that the symbols to skip exist
+        for (int x=0; x<skip; ++x) {
+            if (!look(x).item()) return -1;
+        }
+        
+        // Try each of the terminals that have actions in the current state
+        int stateId = m_Stack.state();
+        int lastTried = -1;
+        
+        for (const action* act = m_Tables->terminal_actions()[stateId]; act != m_Tables->last_terminal_action(stateId); ++act) {
+            // Actions are sorted by symbol, so each symbol only needs to be tried once
+            if (act->symbolId == lastTried) continue;
+            lastTried = act->symbolId;
+            
+            // Insert this symbol, and see if the parser can continue
+            insert_lookahead(skip, lastTried);
+            
+            if (trial_parse(skip, 0, validateSymbols + 1)) {
+                return lastTried;
+            }
+            
+            remove_lookahead(skip);
+        }
+        
+        return -1;
+    }
+    
+    /// \brief Attempts to recover from a syntax error at the current lookahead, and reports it to the error handler
+    template<typename I, typename A, typename T, typename P> bool parser<I, A, T, P>::state::recover(parse_error_handler& errors, int maxRepairCost, int validateSymbols) {
+        static const dfa::position eofPos(-1, -1, -1);
+        
+        // Work out where the error is
+        const lexeme_container& la          = look();
+        dfa::position           errorPos    = la.item() ? la->pos() : eofPos;
+        int                     unexpected  = la.item() ? la->matched() : m_Tables->end_of_input();
+        int                     errorState  = m_Stack.state();
+        
+        // Try the cheapest repairs first
+        for (int cost = 1; cost <= maxRepairCost; ++cost) {
+            // Delete symbols
+            if (trial_parse(cost, 0, validateSymbols)) {
+                for (int x=0; x<cost; ++x) {
+                    look();
+                    next();
+                }
+                
+                errors.syntax_error(parse_error(errorPos, unexpected, parse_error::deleted_symbols, cost, -1, 0, errorState));
+                return true;
+            }
+            
+            // Delete one fewer symbols, then insert a symbol
+            int inserted = find_insertion(cost - 1, validateSymbols);
+            if (inserted >= 0) {
+                for (int x=0; x<cost-1; ++x) {
+                    look();
+                    next();
+                }
+                
+                errors.syntax_error(parse_error(errorPos, unexpected, parse_error::inserted_symbol, cost - 1, inserted, 0, errorState));
+                return true;
+            }
+        }
+        
+        // Panic mode: pop states and skip symbols until the parser can continue
+        // (Skipping fewer symbols is preferred, as is popping fewer states)
+        int depth = 0;
+        for (stack counter(m_Stack); counter.pop(); ) ++depth;
+        
+        for (int skipped = 0; ; ++skipped) {
+            for (int popped = 0; popped <= depth; ++popped) {
+                if (trial_parse(skipped, popped, validateSymbols)) {
+                    for (int x=0; x<popped; ++x) {
+                        m_Stack.pop();
+                    }
+                    for (int x=0; x<skipped; ++x) {
+                        look();
+                        next();
+                    }
+                    
+                    errors.syntax_error(parse_error(errorPos, unexpected, parse_error::skipped_to_recovery, skipped, -1, popped, errorState));
+                    return true;
+                }
+            }
+            
+            // Give up once there are no more symbols to skip
+            if (!look(skipped).item()) break;
+        }
+        
+        errors.syntax_error(parse_error(errorPos, unexpected, parse_error::not_repaired, 0, -1, 0, errorState));
+        return false;
+    }
+    
+    ///
+    /// \brief Parses the input, recovering from any syntax errors, and returns true if it was accepted
+    ///
+    template<typename I, typename A, typename T, typename P> bool parser<I, A, T, P>::state::parse_with_recovery(parse_error_handler& errors, int maxRepairCost, int validateSymbols) {
+        if (validateSymbols < 1) validateSymbols = 1;
+        
+        for (;;) {
+            // Perform the next action
+            result next = process();
+            
+            // Keep going if there are more results
+            if (next == parser_result::more) continue;
+            
+            // Finished if the input was accepted
+            if (next == parser_result::accept) return true;
+            
+            // Push sessions aren't supported
+            if (next != parser_result::reject) return false;
+            
+            // Try to recover from the error
+            if (!recover(errors, maxRepairCost, validateSymbols)) return false;
+        }
+    }
 }
 
 #endif
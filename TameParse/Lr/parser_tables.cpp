@@ -26,11 +26,17 @@
 //
 
 #include <algorithm>
+#include <cstring>
+#include <ostream>
+#include <map>
+#include <set>
+#include <stack>
 
 #include "TameParse/Lr/parser_tables.h"
 
 using namespace std;
 using namespace contextfree;
+using namespace util;
 using namespace lr;
 
 /// \brief Ranks actions in the order they should appear in the final table
@@ -46,6 +52,7 @@ static inline int action_score(int action) {
             
         case lr_action::act_shift:
         case lr_action::act_shiftstrong:
+        case lr_action::act_shiftreduce:
         case lr_action::act_divert:
             // Shift actions are preferred if there's a conflict
             return 2;
@@ -79,14 +86,141 @@ static inline bool compare_actions(const parser_tables::action& a, const parser_
     return false;
 }
 
+/// \brief The action stored in the default reductions table for states that have no default reduction
+static inline parser_tables::action no_default_reduction() {
+    parser_tables::action result;
+    
+    result.type         = lr_action::act_ignore;
+    result.nextState    = 0;
+    result.symbolId     = -1;
+    
+    return result;
+}
+
+/// \brief True if a state with the specified actions always reduces the same rule
+///
+/// This is the case if every terminal action is a reduction of the same rule, and every nonterminal action is either
+/// a goto or a reduction of that rule (which will be the action for the end of input symbol). In such a state, a
+/// lookahead symbol with no action would produce an error, but reducing anyway will just produce that error in the
+/// next state (which is how yacc-style default reductions work).
+static bool is_default_reduction(const parser_tables::action* termActions, int termCount, const parser_tables::action* nontermActions, int nontermCount) {
+    // Need at least one reduction
+    if (termCount <= 0) return false;
+    
+    int rule = termActions[0].nextState;
+    
+    for (int x=0; x<termCount; ++x) {
+        if (termActions[x].type != lr_action::act_reduce)   return false;
+        if ((int) termActions[x].nextState != rule)         return false;
+    }
+    
+    for (int x=0; x<nontermCount; ++x) {
+        if (nontermActions[x].type == lr_action::act_goto) continue;
+        
+        if (nontermActions[x].type != lr_action::act_reduce)    return false;
+        if ((int) nontermActions[x].nextState != rule)          return false;
+    }
+    
+    return true;
+}
+
+/// \brief A row of actions, as a pointer to the first action and the number of actions
+typedef pair<const parser_tables::action*, int> action_row;
+
+/// \brief Orders rows of actions by their length and then by their content, so that identical rows can be found
+class compare_row_actions {
+public:
+    bool operator()(const action_row& a, const action_row& b) const {
+        if (a.second != b.second) return a.second < b.second;
+        
+        for (int x=0; x<a.second; ++x) {
+            const parser_tables::action& actA = a.first[x];
+            const parser_tables::action& actB = b.first[x];
+            
+            if (actA.symbolId != actB.symbolId)     return actA.symbolId < actB.symbolId;
+            if (actA.type != actB.type)             return actA.type < actB.type;
+            if (actA.nextState != actB.nextState)   return actA.nextState < actB.nextState;
+        }
+        
+        return false;
+    }
+};
+
+/// \brief The distinct rows of actions found so far while building a table
+typedef set<action_row, compare_row_actions> distinct_rows;
+
+/// \brief Returns a row with the same actions as the specified row: either the row itself or an identical row found earlier
+///
+/// Many states have exactly the same actions (for example, states that are only reached by the different gotos of the
+/// same items), and these can share a single row. The specified row is deleted if an identical one is found.
+static parser_tables::action* share_row(distinct_rows& rows, parser_tables::action* row, int count) {
+    pair<distinct_rows::iterator, bool> found = rows.insert(action_row(row, count));
+    if (found.second) return row;
+    
+    delete[] row;
+    return const_cast<parser_tables::action*>(found.first->first);
+}
+
+/// \brief Deletes the rows of an action table, deleting rows that are shared by several states only once
+static void delete_rows(parser_tables::action** rows, int numStates) {
+    set<parser_tables::action*> deleted;
+    
+    for (int stateId = 0; stateId < numStates; ++stateId) {
+        if (deleted.insert(rows[stateId]).second) {
+            delete[] rows[stateId];
+        }
+    }
+}
+
+/// \brief Copies the rows of an action table into target, keeping rows that are shared by several states shared
+static void copy_rows(parser_tables::action** target, const parser_tables::action* const* source, const parser_tables::action_count* counts, bool nonterminals, int numStates) {
+    // Rows are identified by their count as well as their position, as empty rows can point at the start of another row
+    map<action_row, parser_tables::action*> copies;
+    
+    for (int stateId = 0; stateId < numStates; ++stateId) {
+        int         count   = nonterminals ? counts[stateId].numNonterminals : counts[stateId].numTerminals;
+        action_row  row(source[stateId], count);
+        
+        map<action_row, parser_tables::action*>::iterator found = copies.find(row);
+        if (found != copies.end()) {
+            target[stateId] = found->second;
+            continue;
+        }
+        
+        parser_tables::action* copy = new parser_tables::action[count];
+        for (int x=0; x<count; ++x) {
+            copy[x] = source[stateId][x];
+        }
+        
+        copies[row]     = copy;
+        target[stateId] = copy;
+    }
+}
+
 /// \brief Creates a parser from the result of the specified builder class
-parser_tables::parser_tables(const lalr_builder& builder, const weak_symbols* weakSymbols) 
-: m_DeleteTables(true) {
+parser_tables::parser_tables(const lalr_builder& builder, const weak_symbols* weakSymbols, size_t maxIndexSize) 
+: m_NumStrongForWeak(0)
+, m_StrongForWeak(NULL)
+, m_NumDefaultGotos(0)
+, m_DefaultGotos(NULL)
+, m_DeleteTables(true)
+, m_DeleteActionLists(false)
+, m_TerminalIndex(NULL)
+, m_NonterminalIndex(NULL)
+, m_DeleteIndexes(true)
+, m_Guards(NULL)
+, m_NumValidTerminals(0)
+, m_ValidTerminals(NULL)
+, m_ExpectedOffsets(NULL)
+, m_ExpectedTerminals(NULL)
+, m_StateFlags(NULL)
+, m_DeleteStateFlags(false) {
     // Allocate the tables
     m_NumStates             = builder.count_states();
     m_NonterminalActions    = new action*[m_NumStates];
     m_TerminalActions       = new action*[m_NumStates];
     m_Counts                = new action_count[m_NumStates];
+    m_DefaultReductions     = new action[m_NumStates];
     
     contextfree::end_of_input eoi;
     contextfree::end_of_guard eog;
@@ -95,20 +229,24 @@ parser_tables::parser_tables(const lalr_builder& builder, const weak_symbols* we
     
     const grammar& gram = builder.gram();
     
-    map<int, int>   ruleIds;                            // Maps their rule IDs to our rule IDs
-    vector<int>     eogStates;                          // The end of guard states
+    // Generate the actions for every state up front
+    builder.compute_all_actions();
+    
+    map<int, int>       ruleIds;                        // Maps their rule IDs to our rule IDs
+    vector<int>         eogStates;                      // The end of guard states
+    compact_action_list actions;                        // The actions for the current state
     
     // Build up the tables for each state
     for (int stateId = 0; stateId < m_NumStates; ++stateId) {
         // Get the actions for this state
-        const lr_action_set& actions = builder.actions_for_state(stateId);
+        builder.compact_actions_for_state(stateId, actions);
         
         // Count the number of terminal and nonterminal actions
         int termCount       = 0;
         int nontermCount    = 0;
         
-        for (lr_action_set::const_iterator nextAction = actions.begin(); nextAction != actions.end(); ++nextAction) {
-            if ((*nextAction)->item()->type() == item::terminal) {
+        for (compact_action_list::const_iterator nextAction = actions.begin(); nextAction != actions.end(); ++nextAction) {
+            if (nextAction->is_terminal()) {
                 ++termCount;
             } else {
                 ++nontermCount;
@@ -121,17 +259,18 @@ parser_tables::parser_tables(const lalr_builder& builder, const weak_symbols* we
         
         int     termPos         = 0;                    // Current item in the terminal table
         int     nontermPos      = 0;                    // Current item in the nonterminal table
+        bool    hasEndOfGuard   = false;                // True if this state has an action for the end of guard symbol
         
         // Fill up the actions (not in order)
-        for (lr_action_set::const_iterator nextAction = actions.begin(); nextAction != actions.end(); ++nextAction) {
+        for (compact_action_list::const_iterator nextAction = actions.begin(); nextAction != actions.end(); ++nextAction) {
             // Get the next state
-            int nextState   = (*nextAction)->next_state();
-            int type        = (*nextAction)->type();
+            int nextState   = nextAction->next_state;
+            int type        = nextAction->type;
             
             // If the next action is a reduce action, then the next state should actually be the rule to reduce
             if (type == lr_action::act_reduce || type == lr_action::act_weakreduce || type == lr_action::act_accept) {
                 // Look up the ID we assigned this rule
-                int                     ruleId  = (*nextAction)->rule()->identifier(gram);
+                int                     ruleId  = nextAction->rule;
                 map<int, int>::iterator found   = ruleIds.find(ruleId);
                 
                 if (found == ruleIds.end()) {
@@ -142,21 +281,22 @@ parser_tables::parser_tables(const lalr_builder& builder, const weak_symbols* we
                 }
             }
             
-            if ((*nextAction)->item()->type() == item::terminal) {
+            if (nextAction->is_terminal()) {
                 // Add a new terminal action
                 termActions[termPos].type               = type;
                 termActions[termPos].nextState          = nextState;
-                termActions[termPos].symbolId           = (*nextAction)->item()->symbol();
+                termActions[termPos].symbolId           = nextAction->symbol;
                 
                 ++termPos;
             } else {
                 // Add a new nonterminal action
                 nontermActions[nontermPos].type         = type;
                 nontermActions[nontermPos].nextState    = nextState;
-                nontermActions[nontermPos].symbolId     = gram.identifier_for_item((*nextAction)->item());
+                nontermActions[nontermPos].symbolId     = nextAction->symbol;
                 
                 if (nontermActions[nontermPos].symbolId == m_EndOfGuard) {
                     eogStates.push_back(stateId);
+                    hasEndOfGuard = true;
                 }
                 
                 ++nontermPos;
@@ -167,6 +307,18 @@ parser_tables::parser_tables(const lalr_builder& builder, const weak_symbols* we
         std::sort(termActions, termActions + termCount, compare_actions);
         std::sort(nontermActions, nontermActions + nontermCount, compare_actions);
         
+        // States that reduce the same rule whatever the lookahead is don't need their terminal actions at all
+        m_DefaultReductions[stateId] = no_default_reduction();
+        
+        if (!hasEndOfGuard && is_default_reduction(termActions, termCount, nontermActions, nontermCount)) {
+            m_DefaultReductions[stateId]            = termActions[0];
+            m_DefaultReductions[stateId].symbolId   = -1;
+            
+            delete[] termActions;
+            termCount   = 0;
+            termActions = new action[0];
+        }
+        
         // Store the actions in the table
         m_TerminalActions[stateId]          = termActions;
         m_NonterminalActions[stateId]       = nontermActions;
@@ -174,6 +326,18 @@ parser_tables::parser_tables(const lalr_builder& builder, const weak_symbols* we
         m_Counts[stateId].numNonterminals   = nontermCount;
     }
     
+    // Store the most common goto for each nonterminal once, rather than in every state
+    remove_default_gotos();
+    
+    // States with identical actions share the same row (which happens more often once the default gotos are removed)
+    distinct_rows terminalRows;
+    distinct_rows nonterminalRows;
+    
+    for (int stateId = 0; stateId < m_NumStates; ++stateId) {
+        m_TerminalActions[stateId]      = share_row(terminalRows, m_TerminalActions[stateId], m_Counts[stateId].numTerminals);
+        m_NonterminalActions[stateId]   = share_row(nonterminalRows, m_NonterminalActions[stateId], m_Counts[stateId].numNonterminals);
+    }
+    
     // Store the end of guard state table (we evaluate states in order, so this is already sorted)
     m_NumEndOfGuards    = (int) eogStates.size();
     m_EndGuardStates    = new int[m_NumEndOfGuards];
@@ -234,24 +398,94 @@ parser_tables::parser_tables(const lalr_builder& builder, const weak_symbols* we
         
         // Sort the items
         sort(m_WeakToStrong, m_WeakToStrong + m_NumWeakToStrong);
+        
+        // Map the weak symbols directly to their strong equivalents, so shifting one doesn't need a search
+        m_NumStrongForWeak  = strong_for_weak_size(m_NumWeakToStrong, m_WeakToStrong);
+        m_StrongForWeak     = create_strong_for_weak(m_NumWeakToStrong, m_WeakToStrong);
+    }
+    
+    // Index the actions, provided that doesn't take too much memory
+    if (maxIndexSize > 0) {
+        build_index(maxIndexSize);
     }
+    
+    // Work out which guards can be evaluated without running the parser
+    compile_guards();
+    
+    // Work out what to report when there's a syntax error
+    compile_expected_terminals();
+    
+    // Summarise each state in a byte, so the parser doesn't need to search the actions to find out about it
+    compile_state_flags();
 }
 
-/// \brief Creates a parser from a set of tables. Tables passed into this constructor will not be deleted by the destructor
-parser_tables::parser_tables(int numStates, int endOfInputSymbol, int endOfGuardSymbol, action** terminalActions, action** nonterminalActions, action_count* actionCounts, int* endGuardStates, int numEndGuards, int numRules, reduce_rule* reduceRules, int numWeakToStrong, symbol_equivalent* weakToStrong)
-: m_NumStates(numStates)
-, m_EndOfInput(endOfInputSymbol)
-, m_EndOfGuard(endOfGuardSymbol)
-, m_TerminalActions(terminalActions)
-, m_NonterminalActions(nonterminalActions)
-, m_Counts(actionCounts)
-, m_EndGuardStates(endGuardStates)
-, m_NumEndOfGuards(numEndGuards)
-, m_NumRules(numRules)
-, m_Rules(reduceRules)
-, m_NumWeakToStrong(numWeakToStrong)
-, m_WeakToStrong(weakToStrong)
-, m_DeleteTables(false) {
+/// \brief Moves the most common goto for each nonterminal into m_DefaultGotos, removing it from the nonterminal actions
+///
+/// After a reduction, the parser is always in a state that has a goto for the nonterminal, so a state without one can
+/// use a default instead. Most nonterminals are only used in a few contexts, so this removes most of the gotos.
+void parser_tables::remove_default_gotos() {
+    // Count how often each state is the target of a goto for each nonterminal
+    map<int, map<int, int> > targetCounts;
+    
+    for (int stateId = 0; stateId < m_NumStates; ++stateId) {
+        for (int x=0; x<m_Counts[stateId].numNonterminals; ++x) {
+            const action& act = m_NonterminalActions[stateId][x];
+            if (act.type == lr_action::act_goto) {
+                ++targetCounts[act.symbolId][(int) act.nextState];
+            }
+        }
+    }
+    
+    if (targetCounts.empty()) return;
+    
+    // The default is the most common target (the lowest numbered state if several are equally common)
+    m_NumDefaultGotos   = targetCounts.rbegin()->first + 1;
+    m_DefaultGotos      = new int[m_NumDefaultGotos];
+    
+    for (int nonterminal = 0; nonterminal < m_NumDefaultGotos; ++nonterminal) {
+        m_DefaultGotos[nonterminal] = -1;
+    }
+    
+    for (map<int, map<int, int> >::const_iterator nonterminal = targetCounts.begin(); nonterminal != targetCounts.end(); ++nonterminal) {
+        // Symbol IDs are never negative, but they come from the grammar so check anyway
+        if (nonterminal->first < 0) continue;
+        
+        int bestCount = 0;
+        for (map<int, int>::const_iterator target = nonterminal->second.begin(); target != nonterminal->second.end(); ++target) {
+            if (target->second > bestCount) {
+                bestCount                               = target->second;
+                m_DefaultGotos[nonterminal->first]      = target->first;
+            }
+        }
+    }
+    
+    // Remove the gotos that are now performed by default
+    for (int stateId = 0; stateId < m_NumStates; ++stateId) {
+        action* actions = m_NonterminalActions[stateId];
+        int     count   = m_Counts[stateId].numNonterminals;
+        int     kept    = 0;
+        
+        for (int x=0; x<count; ++x) {
+            const action& act = actions[x];
+            if (act.type == lr_action::act_goto && default_goto(act.symbolId) == (int) act.nextState) continue;
+            ++kept;
+        }
+        
+        if (kept == count) continue;
+        
+        action* keptActions = new action[kept];
+        int     pos         = 0;
+        
+        for (int x=0; x<count; ++x) {
+            const action& act = actions[x];
+            if (act.type == lr_action::act_goto && default_goto(act.symbolId) == (int) act.nextState) continue;
+            keptActions[pos++] = act;
+        }
+        
+        delete[] actions;
+        m_NonterminalActions[stateId]       = keptActions;
+        m_Counts[stateId].numNonterminals   = kept;
+    }
 }
 
 /// \brief Copy constructor
@@ -260,31 +494,58 @@ parser_tables::parser_tables(const parser_tables& copyFrom)
 , m_NumRules(copyFrom.m_NumRules)
 , m_EndOfInput(copyFrom.m_EndOfInput)
 , m_EndOfGuard(copyFrom.m_EndOfGuard)
-, m_DeleteTables(copyFrom.m_DeleteTables)
-, m_NumWeakToStrong(copyFrom.m_NumWeakToStrong) {
+, m_NumDefaultGotos(copyFrom.m_DefaultGotos ? copyFrom.m_NumDefaultGotos : 0)
+, m_DefaultGotos(copyFrom.m_DefaultGotos ? new int[copyFrom.m_NumDefaultGotos] : NULL)
+, m_DeleteTables(true)
+, m_DeleteActionLists(false)
+, m_NumWeakToStrong(copyFrom.m_NumWeakToStrong)
+, m_NumStrongForWeak(copyFrom.m_NumStrongForWeak)
+, m_StrongForWeak(copyFrom.m_StrongForWeak ? new int[copyFrom.m_NumStrongForWeak] : NULL)
+, m_TerminalIndex(copyFrom.m_TerminalIndex ? new comb_vector(*copyFrom.m_TerminalIndex) : NULL)
+, m_NonterminalIndex(copyFrom.m_NonterminalIndex ? new comb_vector(*copyFrom.m_NonterminalIndex) : NULL)
+, m_DeleteIndexes(true)
+, m_Guards(copyFrom.m_Guards ? new guard_dfa(*copyFrom.m_Guards) : NULL)
+, m_NumValidTerminals(copyFrom.m_ValidTerminals ? copyFrom.m_NumValidTerminals : 0)
+, m_ValidTerminals(NULL)
+, m_ExpectedOffsets(NULL)
+, m_ExpectedTerminals(NULL)
+, m_StateFlags(copyFrom.m_StateFlags ? new unsigned char[copyFrom.m_NumStates] : NULL)
+, m_DeleteStateFlags(copyFrom.m_StateFlags != NULL) {
+    // Copy the valid terminals
+    if (copyFrom.m_ValidTerminals) {
+        size_t numWords = (size_t) m_NumStates * ((m_NumValidTerminals + 31) / 32);
+        m_ValidTerminals = new unsigned int[numWords + 1];
+        copy(copyFrom.m_ValidTerminals, copyFrom.m_ValidTerminals + numWords, m_ValidTerminals);
+    }
+    
+    // Copy the expected terminals
+    if (copyFrom.m_ExpectedOffsets) {
+        int numExpected     = copyFrom.m_ExpectedOffsets[m_NumStates];
+        m_ExpectedOffsets   = new int[m_NumStates + 1];
+        m_ExpectedTerminals = new int[numExpected + 1];
+        copy(copyFrom.m_ExpectedOffsets, copyFrom.m_ExpectedOffsets + m_NumStates + 1, m_ExpectedOffsets);
+        copy(copyFrom.m_ExpectedTerminals, copyFrom.m_ExpectedTerminals + numExpected, m_ExpectedTerminals);
+    }
+    
+    // Copy the state flags
+    if (m_StateFlags) {
+        copy(copyFrom.m_StateFlags, copyFrom.m_StateFlags + m_NumStates, m_StateFlags);
+    }
+    
     // Allocate the action tables
     m_TerminalActions       = new action*[m_NumStates];
     m_NonterminalActions    = new action*[m_NumStates];
     m_Counts                = new action_count[m_NumStates];
     
-    // Copy the states
+    // Copy the counts
     for (int stateId=0; stateId<m_NumStates; ++stateId) {
-        // Copy the counts
         m_Counts[stateId] = copyFrom.m_Counts[stateId];
-        
-        // Allocate the array for this state
-        m_TerminalActions[stateId]      = new action[m_Counts[stateId].numTerminals];
-        m_NonterminalActions[stateId]   = new action[m_Counts[stateId].numNonterminals];
-        
-        // Copy the terminals and nonterminals
-        for (int x=0; x<m_Counts[stateId].numTerminals; ++x) {
-            m_TerminalActions[stateId][x] = copyFrom.m_TerminalActions[stateId][x];
-        }
-        for (int x=0; x<m_Counts[stateId].numNonterminals; ++x) {
-            m_NonterminalActions[stateId][x] = copyFrom.m_NonterminalActions[stateId][x];
-        }
     }
     
+    // Copy the terminals and nonterminals
+    copy_rows(m_TerminalActions, copyFrom.m_TerminalActions, m_Counts, false, m_NumStates);
+    copy_rows(m_NonterminalActions, copyFrom.m_NonterminalActions, m_Counts, true, m_NumStates);
+    
     // Allocate the rule table
     m_Rules = new reduce_rule[m_NumRules];
     for (int ruleId=0; ruleId<m_NumRules; ++ruleId) {
@@ -310,6 +571,27 @@ parser_tables::parser_tables(const parser_tables& copyFrom)
     } else {
         m_WeakToStrong = NULL;
     }
+    
+    // Copy the strong symbol map
+    for (int x=0; m_StrongForWeak && x<m_NumStrongForWeak; ++x) {
+        m_StrongForWeak[x] = copyFrom.m_StrongForWeak[x];
+    }
+
+    // Copy the default reductions
+    if (copyFrom.m_DefaultReductions) {
+        m_DefaultReductions = new action[m_NumStates];
+        
+        for (int stateId=0; stateId<m_NumStates; ++stateId) {
+            m_DefaultReductions[stateId] = copyFrom.m_DefaultReductions[stateId];
+        }
+    } else {
+        m_DefaultReductions = NULL;
+    }
+    
+    // Copy the default gotos
+    for (int x=0; m_DefaultGotos && x<m_NumDefaultGotos; ++x) {
+        m_DefaultGotos[x] = copyFrom.m_DefaultGotos[x];
+    }
 }
 
 /// \brief Assignment
@@ -320,10 +602,8 @@ parser_tables& parser_tables::operator=(const parser_tables& copyFrom) {
     // Destroy the data in this object
     if (m_DeleteTables) {
         // Destroy each entry in the parser table
-        for (int x=0; x<m_NumStates; ++x) {
-            delete[] m_NonterminalActions[x];
-            delete[] m_TerminalActions[x];
-        }
+        delete_rows(m_NonterminalActions, m_NumStates);
+        delete_rows(m_TerminalActions, m_NumStates);
         
         // Destroy the tables themselves
         delete[] m_NonterminalActions;
@@ -332,6 +612,18 @@ parser_tables& parser_tables::operator=(const parser_tables& copyFrom) {
         delete[] m_Counts;
         delete[] m_EndGuardStates;
         if (m_WeakToStrong) delete[] m_WeakToStrong;
+        if (m_DefaultReductions) delete[] m_DefaultReductions;
+        if (m_DefaultGotos) delete[] m_DefaultGotos;
+    } else if (m_DeleteActionLists) {
+        // Only the lists of actions for each state were allocated
+        delete[] m_NonterminalActions;
+        delete[] m_TerminalActions;
+    }
+    
+    if (m_DeleteIndexes) {
+        if (m_TerminalIndex)    delete m_TerminalIndex;
+        if (m_NonterminalIndex) delete m_NonterminalIndex;
+        if (m_StrongForWeak)    delete[] m_StrongForWeak;
     }
 
     // Copy the data from the target object
@@ -339,32 +631,65 @@ parser_tables& parser_tables::operator=(const parser_tables& copyFrom) {
     m_NumRules          = copyFrom.m_NumRules;
     m_EndOfInput        = copyFrom.m_EndOfInput;
     m_EndOfGuard        = copyFrom.m_EndOfGuard;
-    m_DeleteTables      = copyFrom.m_DeleteTables;
+    m_DeleteTables      = true;
+    m_DeleteActionLists = false;
     m_NumWeakToStrong   = copyFrom.m_NumWeakToStrong;
+    m_NumDefaultGotos   = copyFrom.m_DefaultGotos ? copyFrom.m_NumDefaultGotos : 0;
+    m_DefaultGotos      = copyFrom.m_DefaultGotos ? new int[m_NumDefaultGotos] : NULL;
+    m_NumStrongForWeak  = copyFrom.m_NumStrongForWeak;
+    m_StrongForWeak     = copyFrom.m_StrongForWeak ? new int[m_NumStrongForWeak] : NULL;
+    m_TerminalIndex     = copyFrom.m_TerminalIndex ? new comb_vector(*copyFrom.m_TerminalIndex) : NULL;
+    m_NonterminalIndex  = copyFrom.m_NonterminalIndex ? new comb_vector(*copyFrom.m_NonterminalIndex) : NULL;
+    m_DeleteIndexes     = true;
+    
+    delete m_Guards;
+    m_Guards            = copyFrom.m_Guards ? new guard_dfa(*copyFrom.m_Guards) : NULL;
+    
+    delete[] m_ValidTerminals;
+    m_NumValidTerminals = copyFrom.m_ValidTerminals ? copyFrom.m_NumValidTerminals : 0;
+    m_ValidTerminals    = NULL;
+    
+    if (copyFrom.m_ValidTerminals) {
+        size_t numWords = (size_t) m_NumStates * ((m_NumValidTerminals + 31) / 32);
+        m_ValidTerminals = new unsigned int[numWords + 1];
+        copy(copyFrom.m_ValidTerminals, copyFrom.m_ValidTerminals + numWords, m_ValidTerminals);
+    }
+    
+    delete[] m_ExpectedOffsets;
+    delete[] m_ExpectedTerminals;
+    m_ExpectedOffsets   = NULL;
+    m_ExpectedTerminals = NULL;
+    
+    if (copyFrom.m_ExpectedOffsets) {
+        int numExpected     = copyFrom.m_ExpectedOffsets[m_NumStates];
+        m_ExpectedOffsets   = new int[m_NumStates + 1];
+        m_ExpectedTerminals = new int[numExpected + 1];
+        copy(copyFrom.m_ExpectedOffsets, copyFrom.m_ExpectedOffsets + m_NumStates + 1, m_ExpectedOffsets);
+        copy(copyFrom.m_ExpectedTerminals, copyFrom.m_ExpectedTerminals + numExpected, m_ExpectedTerminals);
+    }
+    
+    if (m_DeleteStateFlags) delete[] m_StateFlags;
+    m_StateFlags        = copyFrom.m_StateFlags ? new unsigned char[m_NumStates] : NULL;
+    m_DeleteStateFlags  = m_StateFlags != NULL;
+    
+    if (m_StateFlags) {
+        copy(copyFrom.m_StateFlags, copyFrom.m_StateFlags + m_NumStates, m_StateFlags);
+    }
 
     // Allocate the action tables
     m_TerminalActions       = new action*[m_NumStates];
     m_NonterminalActions    = new action*[m_NumStates];
     m_Counts                = new action_count[m_NumStates];
     
-    // Copy the states
+    // Copy the counts
     for (int stateId=0; stateId<m_NumStates; ++stateId) {
-        // Copy the counts
         m_Counts[stateId] = copyFrom.m_Counts[stateId];
-        
-        // Allocate the array for this state
-        m_TerminalActions[stateId]      = new action[m_Counts[stateId].numTerminals];
-        m_NonterminalActions[stateId]   = new action[m_Counts[stateId].numNonterminals];
-        
-        // Copy the terminals and nonterminals
-        for (int x=0; x<m_Counts[stateId].numTerminals; ++x) {
-            m_TerminalActions[stateId][x] = copyFrom.m_TerminalActions[stateId][x];
-        }
-        for (int x=0; x<m_Counts[stateId].numNonterminals; ++x) {
-            m_NonterminalActions[stateId][x] = copyFrom.m_NonterminalActions[stateId][x];
-        }
     }
     
+    // Copy the terminals and nonterminals
+    copy_rows(m_TerminalActions, copyFrom.m_TerminalActions, m_Counts, false, m_NumStates);
+    copy_rows(m_NonterminalActions, copyFrom.m_NonterminalActions, m_Counts, true, m_NumStates);
+    
     // Allocate the rule table
     m_Rules = new reduce_rule[m_NumRules];
     for (int ruleId=0; ruleId<m_NumRules; ++ruleId) {
@@ -390,6 +715,27 @@ parser_tables& parser_tables::operator=(const parser_tables& copyFrom) {
     } else {
         m_WeakToStrong = NULL;
     }
+    
+    // Copy the strong symbol map
+    for (int x=0; m_StrongForWeak && x<m_NumStrongForWeak; ++x) {
+        m_StrongForWeak[x] = copyFrom.m_StrongForWeak[x];
+    }
+
+    // Copy the default reductions
+    if (copyFrom.m_DefaultReductions) {
+        m_DefaultReductions = new action[m_NumStates];
+        
+        for (int stateId=0; stateId<m_NumStates; ++stateId) {
+            m_DefaultReductions[stateId] = copyFrom.m_DefaultReductions[stateId];
+        }
+    } else {
+        m_DefaultReductions = NULL;
+    }
+    
+    // Copy the default gotos
+    for (int x=0; m_DefaultGotos && x<m_NumDefaultGotos; ++x) {
+        m_DefaultGotos[x] = copyFrom.m_DefaultGotos[x];
+    }
 
     return *this;
 }
@@ -398,10 +744,8 @@ parser_tables& parser_tables::operator=(const parser_tables& copyFrom) {
 parser_tables::~parser_tables() {
     if (m_DeleteTables) {
         // Destroy each entry in the parser table
-        for (int x=0; x<m_NumStates; ++x) {
-            delete[] m_NonterminalActions[x];
-            delete[] m_TerminalActions[x];
-        }
+        delete_rows(m_NonterminalActions, m_NumStates);
+        delete_rows(m_TerminalActions, m_NumStates);
         
         // Destroy the tables themselves
         delete[] m_NonterminalActions;
@@ -410,7 +754,25 @@ parser_tables::~parser_tables() {
         delete[] m_Counts;
         delete[] m_EndGuardStates;
         if (m_WeakToStrong) delete[] m_WeakToStrong;
+        if (m_DefaultReductions) delete[] m_DefaultReductions;
+        if (m_DefaultGotos) delete[] m_DefaultGotos;
+    } else if (m_DeleteActionLists) {
+        // Only the lists of actions for each state were allocated
+        delete[] m_NonterminalActions;
+        delete[] m_TerminalActions;
     }
+    
+    if (m_DeleteIndexes) {
+        if (m_TerminalIndex)    delete m_TerminalIndex;
+        if (m_NonterminalIndex) delete m_NonterminalIndex;
+        if (m_StrongForWeak)    delete[] m_StrongForWeak;
+    }
+    
+    delete m_Guards;
+    delete[] m_ValidTerminals;
+    delete[] m_ExpectedOffsets;
+    delete[] m_ExpectedTerminals;
+    if (m_DeleteStateFlags) delete[] m_StateFlags;
 }
 
 /// \brief Calculates the size in bytes of these parser tables
@@ -422,13 +784,1006 @@ size_t parser_tables::size() const {
     total += 2 * sizeof(action*) * m_NumStates;                 // Size of the nonterminal and terminal action arrays
     total += sizeof(action_count) * m_NumStates;                // m_Counts
     total += sizeof(reduce_rule) * m_NumRules;                  // m_Rules
+    if (m_DefaultReductions) {
+        total += sizeof(action) * m_NumStates;                  // m_DefaultReductions
+    }
+    if (m_DefaultGotos) {
+        total += sizeof(int) * m_NumDefaultGotos;               // m_DefaultGotos
+    }
+    
+    // Add up the size of the various rule arrays (rows that are shared by several states are only counted once)
+    set<action_row> terminalRows;
+    set<action_row> nonterminalRows;
     
-    // Add up the size of the various rule arrays
     for (int stateId = 0; stateId < m_NumStates; ++stateId) {
-        total += sizeof(action) * m_Counts[stateId].numTerminals;
-        total += sizeof(action) * m_Counts[stateId].numNonterminals;
+        if (terminalRows.insert(action_row(m_TerminalActions[stateId], m_Counts[stateId].numTerminals)).second) {
+            total += sizeof(action) * m_Counts[stateId].numTerminals;
+        }
+        if (nonterminalRows.insert(action_row(m_NonterminalActions[stateId], m_Counts[stateId].numNonterminals)).second) {
+            total += sizeof(action) * m_Counts[stateId].numNonterminals;
+        }
     }
     
+    // Add the indexes, if there are any
+    if (m_TerminalIndex)    total += m_TerminalIndex->size();
+    if (m_NonterminalIndex) total += m_NonterminalIndex->size();
+    if (m_StrongForWeak)    total += sizeof(int) * m_NumStrongForWeak;
+    if (m_Guards)           total += m_Guards->size();
+    if (m_ValidTerminals)   total += sizeof(unsigned int) * m_NumStates * ((m_NumValidTerminals + 31) / 32);
+    if (m_ExpectedOffsets)  total += sizeof(int) * (m_NumStates + 1 + m_ExpectedOffsets[m_NumStates]);
+    if (m_StateFlags)       total += sizeof(unsigned char) * m_NumStates;
+    
     // This is the result
     return total;
 }
+
+/// \brief Creates an index for the specified action table, or returns NULL if it would be larger than maxSize bytes
+comb_vector* parser_tables::create_index(int numStates, const action* const* actions, const action_count* counts, bool nonterminals, size_t maxSize) {
+    vector<comb_vector::row> rows((size_t) numStates);
+    int numCells = 0;
+    
+    for (int stateId = 0; stateId < numStates; ++stateId) {
+        int numActions = nonterminals ? counts[stateId].numNonterminals : counts[stateId].numTerminals;
+        
+        // Actions are sorted by symbol, so only the first action for each symbol needs to be indexed
+        for (int actionId = 0; actionId < numActions; ++actionId) {
+            if (actionId > 0 && actions[stateId][actionId-1].symbolId == actions[stateId][actionId].symbolId) continue;
+            
+            // The index can't represent negative symbols: these tables will have to be searched instead
+            if (actions[stateId][actionId].symbolId < 0) return NULL;
+            
+            rows[stateId].push_back(comb_vector::cell(actions[stateId][actionId].symbolId, actionId));
+            ++numCells;
+        }
+    }
+    
+    // Every indexed symbol needs at least one cell, so give up early if even a perfectly packed index is too large
+    if (comb_vector::size_for(numStates, numCells) > maxSize) return NULL;
+    
+    // Pack the index, and discard it if it turns out to be too large
+    comb_vector* result = new comb_vector(rows);
+    if (comb_vector::size_for(result->count_rows(), result->count_cells()) > maxSize) {
+        delete result;
+        return NULL;
+    }
+    
+    return result;
+}
+
+/// \brief Creates a row-displacement index mapping states and terminal symbols to the offset of the first matching action
+comb_vector* parser_tables::create_terminal_index() const {
+    return create_index(m_NumStates, m_TerminalActions, m_Counts, false, (size_t) -1);
+}
+
+/// \brief Creates a row-displacement index mapping states and nonterminal symbols to the offset of the first matching action
+comb_vector* parser_tables::create_nonterminal_index() const {
+    return create_index(m_NumStates, m_NonterminalActions, m_Counts, true, (size_t) -1);
+}
+
+/// \brief The number of entries needed to map weak symbols directly to their strong equivalent
+int parser_tables::strong_for_weak_size(int numWeakToStrong, const symbol_equivalent* weakToStrong) {
+    int size = 0;
+    
+    for (int x=0; weakToStrong && x<numWeakToStrong; ++x) {
+        size = max(size, weakToStrong[x].m_OriginalSymbol + 1);
+    }
+    
+    return size;
+}
+
+/// \brief Creates an array mapping each terminal symbol (up to the largest weak symbol) to its strong equivalent
+int* parser_tables::create_strong_for_weak(int numWeakToStrong, const symbol_equivalent* weakToStrong) {
+    int size = strong_for_weak_size(numWeakToStrong, weakToStrong);
+    if (size == 0) return NULL;
+    
+    // Symbols that aren't weak are their own strong equivalent
+    int* result = new int[size];
+    for (int symbolId = 0; symbolId < size; ++symbolId) {
+        result[symbolId] = symbolId;
+    }
+    
+    for (int x=0; x<numWeakToStrong; ++x) {
+        if (weakToStrong[x].m_OriginalSymbol < 0) continue;
+        result[weakToStrong[x].m_OriginalSymbol] = weakToStrong[x].m_MappedTo;
+    }
+    
+    return result;
+}
+
+/// \brief Builds row-displacement indexes for the action tables
+bool parser_tables::build_index(size_t maxSize) {
+    if (m_DeleteIndexes) {
+        if (m_TerminalIndex)    delete m_TerminalIndex;
+        if (m_NonterminalIndex) delete m_NonterminalIndex;
+    } else {
+        // The strong symbol map is owned along with the indexes, so this object needs its own copy
+        m_NumStrongForWeak  = strong_for_weak_size(m_NumWeakToStrong, m_WeakToStrong);
+        m_StrongForWeak     = create_strong_for_weak(m_NumWeakToStrong, m_WeakToStrong);
+    }
+    
+    m_TerminalIndex     = create_index(m_NumStates, m_TerminalActions, m_Counts, false, maxSize);
+    m_NonterminalIndex  = NULL;
+    m_DeleteIndexes     = true;
+    
+    if (!m_TerminalIndex) return false;
+    
+    // The nonterminal index can use whatever space the terminal index left over
+    size_t remaining = maxSize - comb_vector::size_for(m_TerminalIndex->count_rows(), m_TerminalIndex->count_cells());
+    m_NonterminalIndex = create_index(m_NumStates, m_NonterminalActions, m_Counts, true, remaining);
+    
+    return m_NonterminalIndex != NULL;
+}
+
+/// \brief Compiles the guards that only look at a few terminal symbols into DFAs
+void parser_tables::compile_guards(int maxStates) {
+    delete m_Guards;
+    m_Guards = new guard_dfa(*this, maxStates);
+}
+
+/// \brief Works out which terminals can be the lookahead in each state
+void parser_tables::compile_valid_terminals() {
+    delete[] m_ValidTerminals;
+    
+    // Each row needs a bit for every terminal that has an action or a weak equivalent
+    int numTerminals = 0;
+    
+    for (int stateId = 0; stateId < m_NumStates; ++stateId) {
+        for (action_iterator act = m_TerminalActions[stateId]; act != last_terminal_action(stateId); ++act) {
+            if (act->symbolId >= numTerminals) numTerminals = act->symbolId + 1;
+        }
+    }
+    
+    for (int weakId = 0; weakId < m_NumWeakToStrong; ++weakId) {
+        if (m_WeakToStrong[weakId].m_OriginalSymbol >= numTerminals)    numTerminals = m_WeakToStrong[weakId].m_OriginalSymbol + 1;
+        if (m_WeakToStrong[weakId].m_MappedTo >= numTerminals)          numTerminals = m_WeakToStrong[weakId].m_MappedTo + 1;
+    }
+    
+    int numWords            = (numTerminals + 31) / 32;
+    m_NumValidTerminals     = numTerminals;
+    m_ValidTerminals        = new unsigned int[(size_t) m_NumStates * numWords + 1];
+    
+    find_lookahead_terminals(m_ValidTerminals, numWords, true);
+    
+    // The parser can shift a weak terminal wherever its strong equivalent is valid
+    for (int stateId = 0; stateId < m_NumStates; ++stateId) {
+        unsigned int* row = m_ValidTerminals + stateId * numWords;
+        
+        for (int weakId = 0; weakId < m_NumWeakToStrong; ++weakId) {
+            int weak    = m_WeakToStrong[weakId].m_OriginalSymbol;
+            int strong  = m_WeakToStrong[weakId].m_MappedTo;
+            
+            if (weak < 0 || strong < 0) continue;
+            if (row[strong>>5] & (1u<<(strong&31))) row[weak>>5] |= 1u<<(weak&31);
+        }
+    }
+}
+
+/// \brief Works out the state_flag bits for a state by looking at its actions
+unsigned int parser_tables::find_state_flags(int stateId) const {
+    unsigned int flags = 0;
+    
+    if (std::binary_search(m_EndGuardStates, m_EndGuardStates + m_NumEndOfGuards, stateId)) flags |= state_end_of_guard;
+    if (has_default_reduction(stateId))                                                     flags |= state_default_reduction;
+    
+    for (int nonterminals = 0; nonterminals < 2; ++nonterminals) {
+        const action*   row     = nonterminals ? m_NonterminalActions[stateId] : m_TerminalActions[stateId];
+        int             count   = nonterminals ? m_Counts[stateId].numNonterminals : m_Counts[stateId].numTerminals;
+        
+        for (int x=0; x<count; ++x) {
+            switch (row[x].type) {
+                case lr_action::act_guard:      flags |= state_guard_actions;   break;
+                case lr_action::act_weakreduce: flags |= state_weak_reduce;     break;
+                case lr_action::act_accept:     flags |= state_accept;          break;
+                default:                                                        break;
+            }
+        }
+    }
+    
+    return flags;
+}
+
+/// \brief Builds the table of state_flag bits used by state_flags() and has_end_of_guard()
+void parser_tables::compile_state_flags() {
+    unsigned char* flags = new unsigned char[m_NumStates + 1];
+    
+    // find_state_flags() must search the actions rather than use the existing table
+    if (m_DeleteStateFlags) delete[] m_StateFlags;
+    m_StateFlags        = NULL;
+    m_DeleteStateFlags  = false;
+    
+    for (int stateId = 0; stateId < m_NumStates; ++stateId) {
+        flags[stateId] = (unsigned char) find_state_flags(stateId);
+    }
+    
+    m_StateFlags        = flags;
+    m_DeleteStateFlags  = true;
+}
+
+/// \brief Works out which terminals the parser expects in each state
+void parser_tables::compile_expected_terminals() {
+    delete[] m_ExpectedOffsets;
+    delete[] m_ExpectedTerminals;
+    
+    // Each row needs a bit for every terminal that has an action
+    int numTerminals = 0;
+    
+    for (int stateId = 0; stateId < m_NumStates; ++stateId) {
+        for (action_iterator act = m_TerminalActions[stateId]; act != last_terminal_action(stateId); ++act) {
+            if (act->symbolId >= numTerminals) numTerminals = act->symbolId + 1;
+        }
+    }
+    
+    int                     numWords = (numTerminals + 31) / 32;
+    vector<unsigned int>    rows((size_t) m_NumStates * numWords + 1);
+    
+    find_lookahead_terminals(&rows[0], numWords, false);
+    
+    // Turn the rows into lists of terminals (the end of guard symbol is only used internally)
+    vector<int> expected;
+    
+    m_ExpectedOffsets = new int[m_NumStates + 1];
+    
+    for (int stateId = 0; stateId < m_NumStates; ++stateId) {
+        const unsigned int* row = &rows[(size_t) stateId * numWords];
+        
+        m_ExpectedOffsets[stateId] = (int) expected.size();
+        
+        for (int terminal = 0; terminal < numTerminals; ++terminal) {
+            if (terminal == m_EndOfGuard) continue;
+            if (row[terminal>>5] & (1u<<(terminal&31))) expected.push_back(terminal);
+        }
+    }
+    
+    m_ExpectedOffsets[m_NumStates]  = (int) expected.size();
+    m_ExpectedTerminals             = new int[expected.size() + 1];
+    copy(expected.begin(), expected.end(), m_ExpectedTerminals);
+}
+
+/// \brief Sets the bits for the terminals that can be the lookahead in each state in a set of rows of numWords words
+void parser_tables::find_lookahead_terminals(unsigned int* rows, int numWords, bool includeIgnored) const {
+    fill(rows, rows + (size_t) m_NumStates * numWords, 0u);
+    
+    // Terminals with an action are valid in their state
+    for (int stateId = 0; stateId < m_NumStates; ++stateId) {
+        unsigned int* row = rows + stateId * numWords;
+        
+        for (action_iterator act = m_TerminalActions[stateId]; act != last_terminal_action(stateId); ++act) {
+            if (act->symbolId < 0) continue;
+            if (!includeIgnored && act->type == lr_action::act_ignore) continue;
+            
+            row[act->symbolId>>5] |= 1u<<(act->symbolId&31);
+        }
+    }
+    
+    // States with a default reduction allow whatever the states they can go to after the reduction allow. These can
+    // go to other states with a default reduction, so carry on until nothing changes.
+    if (m_DefaultReductions) {
+        // Find the states that each nonterminal can go to
+        map<int, set<int> > gotoStates;
+        
+        for (int stateId = 0; stateId < m_NumStates; ++stateId) {
+            for (action_iterator act = m_NonterminalActions[stateId]; act != last_nonterminal_action(stateId); ++act) {
+                if (act->type == lr_action::act_goto) gotoStates[act->symbolId].insert(act->nextState);
+            }
+        }
+        
+        for (int nonterminal = 0; nonterminal < m_NumDefaultGotos; ++nonterminal) {
+            if (m_DefaultGotos[nonterminal] >= 0) gotoStates[nonterminal].insert(m_DefaultGotos[nonterminal]);
+        }
+        
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            
+            for (int stateId = 0; stateId < m_NumStates; ++stateId) {
+                if (!has_default_reduction(stateId)) continue;
+                
+                unsigned int*   row         = rows + stateId * numWords;
+                const set<int>& targets     = gotoStates[m_Rules[m_DefaultReductions[stateId].nextState].identifier];
+                
+                for (set<int>::const_iterator target = targets.begin(); target != targets.end(); ++target) {
+                    const unsigned int* targetRow = rows + *target * numWords;
+                    
+                    for (int word = 0; word < numWords; ++word) {
+                        if ((row[word] | targetRow[word]) != row[word]) {
+                            row[word]   |= targetRow[word];
+                            changed     = true;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/// \brief True if the nextState field of an action of the specified type refers to a state (rather than a rule)
+static inline bool refers_to_state(unsigned int type) {
+    switch (type) {
+        case lr_action::act_shift:
+        case lr_action::act_shiftstrong:
+        case lr_action::act_shiftreduce:
+        case lr_action::act_ignore:
+        case lr_action::act_goto:
+        case lr_action::act_divert:
+        case lr_action::act_guard:
+            return true;
+            
+        default:
+            return false;
+    }
+}
+
+/// \brief Turns shift actions into shift-reduce actions where the new state always performs the same reduction
+int parser_tables::combine_shift_reduce() {
+    // Tables that refer to data owned by something else can't be changed, and there's nothing to do without default reductions
+    if (!m_DeleteTables || !m_DefaultReductions) return 0;
+    
+    int combined = 0;
+    
+    for (int stateId = 0; stateId < m_NumStates; ++stateId) {
+        // Rows can be shared, but the change only depends on the action so updating a row twice does nothing
+        action* row = m_TerminalActions[stateId];
+        
+        for (int x=0; x<m_Counts[stateId].numTerminals; ++x) {
+            action& act = row[x];
+            if (act.type != lr_action::act_shift) continue;
+            
+            // The new state must always reduce the same rule, which must include the symbol that was shifted
+            // (Empty rules can be reduced by default in states that are waiting for a later part of a rule)
+            const action& defaultReduction = m_DefaultReductions[act.nextState];
+            if (defaultReduction.type != lr_action::act_reduce) continue;
+            if (m_Rules[defaultReduction.nextState].length <= 0) continue;
+            
+            act.type = lr_action::act_shiftreduce;
+            ++combined;
+        }
+    }
+    
+    // The compiled guards are built by simulating the actions
+    if (combined > 0 && m_Guards) {
+        compile_guards(m_Guards->max_states());
+    }
+    
+    return combined;
+}
+
+/// \brief Gives every state in these tables a new identifier
+bool parser_tables::renumber_states(const std::vector<int>& newIds, size_t maxIndexSize) {
+    // Tables that refer to data owned by something else can't be changed
+    if (!m_DeleteTables) return false;
+    
+    // The new IDs must be a permutation of the existing ones
+    if (newIds.size() != (size_t) m_NumStates) return false;
+    
+    vector<bool> used((size_t) m_NumStates, false);
+    for (int stateId = 0; stateId < m_NumStates; ++stateId) {
+        int newId = newIds[stateId];
+        if (newId < 0 || newId >= m_NumStates || used[newId]) return false;
+        used[newId] = true;
+    }
+    
+    // Create the new tables
+    action**        terminalActions     = new action*[m_NumStates];
+    action**        nonterminalActions  = new action*[m_NumStates];
+    action_count*   counts              = new action_count[m_NumStates];
+    action*         defaultReductions   = m_DefaultReductions ? new action[m_NumStates] : NULL;
+    
+    // Rows can be shared by several states, and must only be updated once
+    set<action*> updatedRows;
+    
+    for (int stateId = 0; stateId < m_NumStates; ++stateId) {
+        int newId = newIds[stateId];
+        
+        // Move the actions for this state (the order within the state doesn't change, as the lookup relies on it)
+        terminalActions[newId]      = m_TerminalActions[stateId];
+        nonterminalActions[newId]   = m_NonterminalActions[stateId];
+        counts[newId]               = m_Counts[stateId];
+        if (defaultReductions) {
+            defaultReductions[newId] = m_DefaultReductions[stateId];
+        }
+        
+        // Update the states that the actions refer to
+        if (updatedRows.insert(terminalActions[newId]).second) {
+            for (int x=0; x<counts[newId].numTerminals; ++x) {
+                action& act = terminalActions[newId][x];
+                if (refers_to_state(act.type)) act.nextState = newIds[act.nextState];
+            }
+        }
+        if (updatedRows.insert(nonterminalActions[newId]).second) {
+            for (int x=0; x<counts[newId].numNonterminals; ++x) {
+                action& act = nonterminalActions[newId][x];
+                if (refers_to_state(act.type)) act.nextState = newIds[act.nextState];
+            }
+        }
+    }
+    
+    // Replace the old tables
+    delete[] m_TerminalActions;
+    delete[] m_NonterminalActions;
+    delete[] m_Counts;
+    if (m_DefaultReductions) delete[] m_DefaultReductions;
+    
+    m_TerminalActions       = terminalActions;
+    m_NonterminalActions    = nonterminalActions;
+    m_Counts                = counts;
+    m_DefaultReductions     = defaultReductions;
+    
+    // The default gotos refer to states
+    for (int x=0; m_DefaultGotos && x<m_NumDefaultGotos; ++x) {
+        if (m_DefaultGotos[x] >= 0) m_DefaultGotos[x] = newIds[m_DefaultGotos[x]];
+    }
+    
+    // The end of guard states must stay sorted
+    for (int x=0; x<m_NumEndOfGuards; ++x) {
+        m_EndGuardStates[x] = newIds[m_EndGuardStates[x]];
+    }
+    std::sort(m_EndGuardStates, m_EndGuardStates + m_NumEndOfGuards);
+    
+    // The flags for each state are used by has_end_of_guard() when the guards are compiled
+    if (m_StateFlags) {
+        compile_state_flags();
+    }
+    
+    // The rows of the index are in state order, so it needs to be built again
+    if (m_TerminalIndex || m_NonterminalIndex) {
+        build_index(maxIndexSize);
+    }
+    
+    // The compiled guards refer to the states where they begin
+    if (m_Guards) {
+        compile_guards(m_Guards->max_states());
+    }
+    
+    // The valid and expected terminals are stored by state
+    if (m_ValidTerminals) {
+        compile_valid_terminals();
+    }
+    if (m_ExpectedOffsets) {
+        compile_expected_terminals();
+    }
+    
+    return true;
+}
+
+/// \brief Works out new identifiers for a set of states that put the most frequently used states first
+std::vector<int> parser_tables::order_states_by_frequency(int numStates, int numFixedStates, const std::map<int, long>& frequencies) {
+    // The fixed states keep their identifiers
+    vector<int>                 result((size_t) numStates);
+    vector<pair<long, int> >    order;
+    
+    for (int stateId = 0; stateId < numStates; ++stateId) {
+        if (stateId < numFixedStates) {
+            result[stateId] = stateId;
+            continue;
+        }
+        
+        // Sort on the negated frequency so the most frequent states come first, and states that are used equally 
+        // often stay in their original order
+        map<int, long>::const_iterator found = frequencies.find(stateId);
+        order.push_back(pair<long, int>(found == frequencies.end() ? 0 : -found->second, stateId));
+    }
+    
+    std::sort(order.begin(), order.end());
+    
+    for (size_t x=0; x<order.size(); ++x) {
+        result[order[x].second] = numFixedStates + (int) x;
+    }
+    
+    return result;
+}
+
+/// \brief Works out new state IDs for renumber_states that put each state close to the states that lead to it
+std::vector<int> parser_tables::order_states_by_traversal(int numFixedStates) const {
+    if (numFixedStates > m_NumStates) numFixedStates = m_NumStates;
+    if (numFixedStates < 0) numFixedStates = 0;
+    
+    // The fixed states keep their identifiers
+    vector<int> result((size_t) m_NumStates, -1);
+    int         nextId = numFixedStates;
+    
+    for (int stateId = 0; stateId < numFixedStates; ++stateId) {
+        result[stateId] = stateId;
+    }
+    
+    for (int fixedState = 0; fixedState < numFixedStates; ++fixedState) {
+        stack<int> waiting;
+        waiting.push(fixedState);
+        
+        while (!waiting.empty()) {
+            int stateId = waiting.top();
+            waiting.pop();
+            
+            if (result[stateId] < 0) {
+                result[stateId] = nextId++;
+            } else if (stateId != fixedState) {
+                continue;
+            }
+            
+            // Find the states that this one leads to, and visit them in order
+            vector<int> targets;
+            for (int x=0; x<m_Counts[stateId].numTerminals; ++x) {
+                const action& act = m_TerminalActions[stateId][x];
+                if (refers_to_state(act.type) && result[act.nextState] < 0) targets.push_back(act.nextState);
+            }
+            for (int x=0; x<m_Counts[stateId].numNonterminals; ++x) {
+                const action& act = m_NonterminalActions[stateId][x];
+                if (refers_to_state(act.type) && result[act.nextState] < 0) targets.push_back(act.nextState);
+            }
+            
+            for (vector<int>::reverse_iterator target = targets.rbegin(); target != targets.rend(); ++target) {
+                waiting.push(*target);
+            }
+        }
+    }
+    
+    // States that can't be reached go at the end
+    for (int stateId = 0; stateId < m_NumStates; ++stateId) {
+        if (result[stateId] < 0) result[stateId] = nextId++;
+    }
+    
+    return result;
+}
+
+/// \brief Gives every terminal symbol in these tables a new identifier
+bool parser_tables::renumber_terminals(const std::vector<int>& newIds, size_t maxIndexSize) {
+    // Tables that refer to data owned by something else can't be changed
+    if (!m_DeleteTables) return false;
+    
+    // The new IDs must be a permutation of the existing ones
+    int numTerminals = (int) newIds.size();
+    
+    vector<bool> used(newIds.size(), false);
+    for (int symbolId = 0; symbolId < numTerminals; ++symbolId) {
+        int newId = newIds[symbolId];
+        if (newId < 0 || newId >= numTerminals || used[newId]) return false;
+        used[newId] = true;
+    }
+    
+    // ... which covers every terminal symbol in these tables
+    for (int stateId = 0; stateId < m_NumStates; ++stateId) {
+        for (int x=0; x<m_Counts[stateId].numTerminals; ++x) {
+            int symbolId = m_TerminalActions[stateId][x].symbolId;
+            if (symbolId < 0 || symbolId >= numTerminals) return false;
+        }
+    }
+    
+    for (int x=0; x<m_NumWeakToStrong; ++x) {
+        const symbol_equivalent& equiv = m_WeakToStrong[x];
+        if (equiv.m_OriginalSymbol >= numTerminals || equiv.m_MappedTo >= numTerminals) return false;
+    }
+    
+    // Rows can be shared by several states, and must only be updated once
+    set<action*> updatedRows;
+    
+    for (int stateId = 0; stateId < m_NumStates; ++stateId) {
+        action* row = m_TerminalActions[stateId];
+        if (!updatedRows.insert(row).second) continue;
+        
+        int count = m_Counts[stateId].numTerminals;
+        for (int x=0; x<count; ++x) {
+            row[x].symbolId = newIds[row[x].symbolId];
+        }
+        
+        // The lookup relies on the actions being sorted by symbol, and the actions for each symbol must stay in order
+        std::stable_sort(row, row + count, compare_actions);
+    }
+    
+    // The weak symbol map is sorted by the weak symbol
+    for (int x=0; x<m_NumWeakToStrong; ++x) {
+        symbol_equivalent& equiv = m_WeakToStrong[x];
+        if (equiv.m_OriginalSymbol >= 0)    equiv.m_OriginalSymbol  = newIds[equiv.m_OriginalSymbol];
+        if (equiv.m_MappedTo >= 0)          equiv.m_MappedTo        = newIds[equiv.m_MappedTo];
+    }
+    if (m_WeakToStrong) {
+        std::sort(m_WeakToStrong, m_WeakToStrong + m_NumWeakToStrong);
+    }
+    
+    // The strong symbol map is owned along with the indexes (build_index makes a new one if this object doesn't own it)
+    if (m_DeleteIndexes) {
+        if (m_StrongForWeak) delete[] m_StrongForWeak;
+        m_NumStrongForWeak  = strong_for_weak_size(m_NumWeakToStrong, m_WeakToStrong);
+        m_StrongForWeak     = create_strong_for_weak(m_NumWeakToStrong, m_WeakToStrong);
+    }
+    
+    // The columns of the terminal index are symbols, so it needs to be built again
+    if (m_TerminalIndex || m_NonterminalIndex) {
+        build_index(maxIndexSize);
+    } else if (!m_DeleteIndexes) {
+        m_NumStrongForWeak  = strong_for_weak_size(m_NumWeakToStrong, m_WeakToStrong);
+        m_StrongForWeak     = create_strong_for_weak(m_NumWeakToStrong, m_WeakToStrong);
+        m_DeleteIndexes     = true;
+    }
+    
+    // The compiled guards match terminal symbols
+    if (m_Guards) {
+        compile_guards(m_Guards->max_states());
+    }
+    
+    // So do the valid and expected terminals
+    if (m_ValidTerminals) {
+        compile_valid_terminals();
+    }
+    if (m_ExpectedOffsets) {
+        compile_expected_terminals();
+    }
+    
+    return true;
+}
+
+/// \brief Works out dense terminal IDs for renumber_terminals
+std::vector<int> parser_tables::order_terminals_by_use(const parser_tables& tables, int numTerminals) {
+    // Count the states that have an action for each terminal
+    vector<long> uses((size_t) numTerminals, 0);
+    
+    for (int stateId = 0; stateId < tables.m_NumStates; ++stateId) {
+        const action* row   = tables.m_TerminalActions[stateId];
+        int count           = tables.m_Counts[stateId].numTerminals;
+        
+        for (int x=0; x<count; ++x) {
+            // Only count each symbol once per state
+            if (x > 0 && row[x-1].symbolId == row[x].symbolId) continue;
+            
+            int symbolId = row[x].symbolId;
+            if (symbolId >= 0 && symbolId < numTerminals) ++uses[symbolId];
+        }
+    }
+    
+    // Weak symbols are read by the parser even if it only acts on their strong equivalent
+    for (int x=0; x<tables.m_NumWeakToStrong; ++x) {
+        int symbolId = tables.m_WeakToStrong[x].m_OriginalSymbol;
+        if (symbolId >= 0 && symbolId < numTerminals && uses[symbolId] == 0) uses[symbolId] = 1;
+    }
+    
+    // Sort on the negated count so the most used terminals come first, and unused terminals come last
+    vector<pair<long, int> > order;
+    for (int symbolId = 0; symbolId < numTerminals; ++symbolId) {
+        order.push_back(pair<long, int>(-uses[symbolId], symbolId));
+    }
+    
+    std::sort(order.begin(), order.end());
+    
+    vector<int> result((size_t) numTerminals);
+    for (size_t x=0; x<order.size(); ++x) {
+        result[order[x].second] = (int) x;
+    }
+    
+    return result;
+}
+
+//              ===============
+//               Binary tables
+//              ===============
+
+/// \brief Value of the first word in binary parser tables ('TPLR' when written little-endian)
+static const int c_BinaryMagic      = 0x524c5054;
+
+/// \brief Version of the binary format written by write_binary
+static const int c_BinaryVersion    = 3;
+
+/// \brief Words in the header of the binary format
+enum binary_header {
+    hdr_magic,
+    hdr_version,
+    hdr_action_size,
+    hdr_num_states,
+    hdr_end_of_input,
+    hdr_end_of_guard,
+    hdr_num_end_guards,
+    hdr_num_rules,
+    hdr_num_weak_to_strong,
+    hdr_has_default_reductions,
+    hdr_num_terminal_actions,
+    hdr_num_nonterminal_actions,
+    hdr_terminal_index_rows,
+    hdr_terminal_index_cells,
+    hdr_nonterminal_index_rows,
+    hdr_nonterminal_index_cells,
+    hdr_num_default_gotos,
+    hdr_has_expected_terminals,
+    hdr_num_expected_terminals,
+    
+    hdr_size
+};
+
+/// \brief An action with a known value, used to check that the reader lays out actions in the same way as the writer
+static inline parser_tables::action layout_check_action() {
+    parser_tables::action result;
+    memset(&result, 0, sizeof(result));
+    
+    result.type         = 0x12;
+    result.nextState    = 0x345678;
+    result.symbolId     = 0x1abcdef0;
+    
+    return result;
+}
+
+/// \brief Writes out an array of items in binary form
+template<typename T> static inline void write_array(ostream& target, const T* items, size_t count) {
+    if (count == 0) return;
+    target.write((const char*) items, (streamsize) (sizeof(T) * count));
+}
+
+/// \brief Reads arrays from a block of binary data, checking that they stay within the block
+class binary_reader {
+private:
+    /// \brief The next byte to read
+    const char* m_Pos;
+    
+    /// \brief The number of bytes remaining
+    size_t m_Remaining;
+    
+public:
+    binary_reader(const void* data, size_t size)
+    : m_Pos((const char*) data)
+    , m_Remaining(size) {
+    }
+    
+    /// \brief Reads an array of count items, returning false if there isn't enough data left
+    template<typename T> bool read(const T*& result, size_t count) {
+        if (count > m_Remaining / sizeof(T)) return false;
+        
+        result      = (const T*) m_Pos;
+        m_Pos       += sizeof(T) * count;
+        m_Remaining -= sizeof(T) * count;
+        return true;
+    }
+};
+
+/// \brief Writes these tables to the specified stream in the format read by from_binary
+void parser_tables::write_binary(std::ostream& target) const {
+    // Count the actions
+    int numTerminalActions      = 0;
+    int numNonterminalActions   = 0;
+    
+    for (int stateId = 0; stateId < m_NumStates; ++stateId) {
+        numTerminalActions      += m_Counts[stateId].numTerminals;
+        numNonterminalActions   += m_Counts[stateId].numNonterminals;
+    }
+    
+    // Write out the header
+    int header[hdr_size];
+    
+    header[hdr_magic]                   = c_BinaryMagic;
+    header[hdr_version]                 = c_BinaryVersion;
+    header[hdr_action_size]             = (int) sizeof(action);
+    header[hdr_num_states]              = m_NumStates;
+    header[hdr_end_of_input]            = m_EndOfInput;
+    header[hdr_end_of_guard]            = m_EndOfGuard;
+    header[hdr_num_end_guards]          = m_NumEndOfGuards;
+    header[hdr_num_rules]               = m_NumRules;
+    header[hdr_num_weak_to_strong]      = m_WeakToStrong ? m_NumWeakToStrong : 0;
+    header[hdr_has_default_reductions]  = m_DefaultReductions ? 1 : 0;
+    header[hdr_num_terminal_actions]    = numTerminalActions;
+    header[hdr_num_nonterminal_actions] = numNonterminalActions;
+    header[hdr_terminal_index_rows]     = m_TerminalIndex ? m_TerminalIndex->count_rows() : 0;
+    header[hdr_terminal_index_cells]    = m_TerminalIndex ? m_TerminalIndex->count_cells() : 0;
+    header[hdr_nonterminal_index_rows]  = m_NonterminalIndex ? m_NonterminalIndex->count_rows() : 0;
+    header[hdr_nonterminal_index_cells] = m_NonterminalIndex ? m_NonterminalIndex->count_cells() : 0;
+    header[hdr_num_default_gotos]       = m_DefaultGotos ? m_NumDefaultGotos : 0;
+    header[hdr_has_expected_terminals]  = m_ExpectedOffsets ? 1 : 0;
+    header[hdr_num_expected_terminals]  = m_ExpectedOffsets ? m_ExpectedOffsets[m_NumStates] : 0;
+    
+    action layoutCheck = layout_check_action();
+    
+    write_array(target, header, hdr_size);
+    write_array(target, &layoutCheck, 1);
+    
+    // The actions for each state are written out consecutively, so their position can be worked out from the counts
+    write_array(target, m_Counts, (size_t) m_NumStates);
+    
+    for (int stateId = 0; stateId < m_NumStates; ++stateId) {
+        write_array(target, m_TerminalActions[stateId], (size_t) m_Counts[stateId].numTerminals);
+    }
+    for (int stateId = 0; stateId < m_NumStates; ++stateId) {
+        write_array(target, m_NonterminalActions[stateId], (size_t) m_Counts[stateId].numNonterminals);
+    }
+    
+    if (m_DefaultReductions) {
+        write_array(target, m_DefaultReductions, (size_t) m_NumStates);
+    }
+    
+    // The remaining tables
+    write_array(target, m_EndGuardStates, (size_t) m_NumEndOfGuards);
+    write_array(target, m_Rules, (size_t) m_NumRules);
+    write_array(target, m_WeakToStrong, (size_t) header[hdr_num_weak_to_strong]);
+    write_array(target, m_DefaultGotos, (size_t) header[hdr_num_default_gotos]);
+    
+    // The indexes
+    if (m_TerminalIndex) {
+        write_array(target, m_TerminalIndex->base(), (size_t) m_TerminalIndex->count_rows());
+        write_array(target, m_TerminalIndex->check(), (size_t) m_TerminalIndex->count_cells());
+        write_array(target, m_TerminalIndex->value(), (size_t) m_TerminalIndex->count_cells());
+    }
+    
+    if (m_NonterminalIndex) {
+        write_array(target, m_NonterminalIndex->base(), (size_t) m_NonterminalIndex->count_rows());
+        write_array(target, m_NonterminalIndex->check(), (size_t) m_NonterminalIndex->count_cells());
+        write_array(target, m_NonterminalIndex->value(), (size_t) m_NonterminalIndex->count_cells());
+    }
+    
+    // The expected terminals
+    if (m_ExpectedOffsets) {
+        write_array(target, m_ExpectedOffsets, (size_t) m_NumStates + 1);
+        write_array(target, m_ExpectedTerminals, (size_t) header[hdr_num_expected_terminals]);
+    }
+}
+
+/// \brief Creates parser tables that refer directly to data written by write_binary, or returns NULL if the data is not valid
+parser_tables* parser_tables::from_binary(const void* data, size_t size) {
+    // Every table is made up of ints, so the data must be aligned
+    if (!data || ((size_t) data) % sizeof(int) != 0) return NULL;
+    
+    binary_reader reader(data, size);
+    
+    // Check the header
+    const int*      header;
+    const action*   layoutCheck;
+    action          expectedLayout = layout_check_action();
+    
+    if (!reader.read(header, hdr_size)) return NULL;
+    if (header[hdr_magic] != c_BinaryMagic || header[hdr_version] != c_BinaryVersion)   return NULL;
+    if (header[hdr_action_size] != (int) sizeof(action))                                return NULL;
+    
+    if (!reader.read(layoutCheck, 1)) return NULL;
+    if (memcmp(layoutCheck, &expectedLayout, sizeof(action)) != 0) return NULL;
+    
+    for (int word = hdr_num_states; word < hdr_size; ++word) {
+        if (word == hdr_end_of_input || word == hdr_end_of_guard) continue;
+        if (header[word] < 0) return NULL;
+    }
+    
+    int numStates = header[hdr_num_states];
+    
+    // Indexes must have a row for every state
+    if (header[hdr_terminal_index_rows] != 0 && header[hdr_terminal_index_rows] != numStates)          return NULL;
+    if (header[hdr_nonterminal_index_rows] != 0 && header[hdr_nonterminal_index_rows] != numStates)    return NULL;
+    
+    // Read the counts, and check they agree with the number of actions
+    const action_count* counts;
+    if (!reader.read(counts, (size_t) numStates)) return NULL;
+    
+    size_t numTerminalActions       = 0;
+    size_t numNonterminalActions    = 0;
+    
+    for (int stateId = 0; stateId < numStates; ++stateId) {
+        if (counts[stateId].numTerminals < 0 || counts[stateId].numNonterminals < 0) return NULL;
+        
+        numTerminalActions      += (size_t) counts[stateId].numTerminals;
+        numNonterminalActions   += (size_t) counts[stateId].numNonterminals;
+    }
+    
+    if (numTerminalActions != (size_t) header[hdr_num_terminal_actions])         return NULL;
+    if (numNonterminalActions != (size_t) header[hdr_num_nonterminal_actions])   return NULL;
+    
+    // Read the rest of the tables
+    const action*               terminalActions;
+    const action*               nonterminalActions;
+    const action*               defaultReductions = NULL;
+    const int*                  endGuardStates;
+    const reduce_rule*          rules;
+    const symbol_equivalent*    weakToStrong;
+    const int*                  defaultGotos;
+    
+    if (!reader.read(terminalActions, numTerminalActions))                                          return NULL;
+    if (!reader.read(nonterminalActions, numNonterminalActions))                                    return NULL;
+    if (header[hdr_has_default_reductions] && !reader.read(defaultReductions, (size_t) numStates))  return NULL;
+    if (!reader.read(endGuardStates, (size_t) header[hdr_num_end_guards]))                          return NULL;
+    if (!reader.read(rules, (size_t) header[hdr_num_rules]))                                        return NULL;
+    if (!reader.read(weakToStrong, (size_t) header[hdr_num_weak_to_strong]))                        return NULL;
+    if (!reader.read(defaultGotos, (size_t) header[hdr_num_default_gotos]))                         return NULL;
+    
+    const int* terminalBase     = NULL;
+    const int* terminalCheck    = NULL;
+    const int* terminalValue    = NULL;
+    const int* nonterminalBase  = NULL;
+    const int* nonterminalCheck = NULL;
+    const int* nonterminalValue = NULL;
+    
+    if (header[hdr_terminal_index_rows]) {
+        if (!reader.read(terminalBase, (size_t) header[hdr_terminal_index_rows]))     return NULL;
+        if (!reader.read(terminalCheck, (size_t) header[hdr_terminal_index_cells]))   return NULL;
+        if (!reader.read(terminalValue, (size_t) header[hdr_terminal_index_cells]))   return NULL;
+    }
+    
+    if (header[hdr_nonterminal_index_rows]) {
+        if (!reader.read(nonterminalBase, (size_t) header[hdr_nonterminal_index_rows]))   return NULL;
+        if (!reader.read(nonterminalCheck, (size_t) header[hdr_nonterminal_index_cells])) return NULL;
+        if (!reader.read(nonterminalValue, (size_t) header[hdr_nonterminal_index_cells])) return NULL;
+    }
+    
+    // The expected terminals must be in order within the list
+    const int* expectedOffsets      = NULL;
+    const int* expectedTerminals    = NULL;
+    int        numExpected          = header[hdr_num_expected_terminals];
+    
+    if (header[hdr_has_expected_terminals]) {
+        if (!reader.read(expectedOffsets, (size_t) numStates + 1))     return NULL;
+        if (!reader.read(expectedTerminals, (size_t) numExpected))    return NULL;
+        
+        if (expectedOffsets[0] != 0 || expectedOffsets[numStates] != numExpected) return NULL;
+        for (int stateId = 0; stateId < numStates; ++stateId) {
+            if (expectedOffsets[stateId] > expectedOffsets[stateId + 1]) return NULL;
+        }
+    }
+    
+    // The tables are never modified, so it's safe to refer to the data even though it's constant. Only the
+    // lists of actions for each state need to be built, as they're made up of pointers.
+    action** terminalLists      = new action*[numStates];
+    action** nonterminalLists   = new action*[numStates];
+    
+    action* nextTerminal        = const_cast<action*>(terminalActions);
+    action* nextNonterminal     = const_cast<action*>(nonterminalActions);
+    
+    for (int stateId = 0; stateId < numStates; ++stateId) {
+        terminalLists[stateId]      = nextTerminal;
+        nonterminalLists[stateId]   = nextNonterminal;
+        
+        nextTerminal                += counts[stateId].numTerminals;
+        nextNonterminal             += counts[stateId].numNonterminals;
+    }
+    
+    // The indexes are copied by the constructor, but will continue to refer to the data
+    comb_vector terminalIndex(terminalBase, terminalCheck, terminalValue, header[hdr_terminal_index_rows], header[hdr_terminal_index_cells]);
+    comb_vector nonterminalIndex(nonterminalBase, nonterminalCheck, nonterminalValue, header[hdr_nonterminal_index_rows], header[hdr_nonterminal_index_cells]);
+    
+    parser_tables* result = new parser_tables(numStates, header[hdr_end_of_input], header[hdr_end_of_guard], 
+                                              terminalLists, nonterminalLists, const_cast<action_count*>(counts), 
+                                              const_cast<int*>(endGuardStates), header[hdr_num_end_guards], 
+                                              header[hdr_num_rules], const_cast<reduce_rule*>(rules), 
+                                              header[hdr_num_weak_to_strong], header[hdr_num_weak_to_strong] ? const_cast<symbol_equivalent*>(weakToStrong) : NULL, 
+                                              const_cast<action*>(defaultReductions), 
+                                              terminalBase ? &terminalIndex : NULL, nonterminalBase ? &nonterminalIndex : NULL, 
+                                              true, 0, NULL, 
+                                              header[hdr_num_default_gotos], header[hdr_num_default_gotos] ? defaultGotos : NULL);
+    result->m_DeleteActionLists = true;
+    result->compile_guards();
+    result->compile_state_flags();
+    
+    // The expected terminals are always owned by the tables, so they're copied
+    if (expectedOffsets) {
+        result->m_ExpectedOffsets   = new int[numStates + 1];
+        result->m_ExpectedTerminals = new int[numExpected + 1];
+        copy(expectedOffsets, expectedOffsets + numStates + 1, result->m_ExpectedOffsets);
+        copy(expectedTerminals, expectedTerminals + numExpected, result->m_ExpectedTerminals);
+    }
+    
+    return result;
+}
+
+/// \brief Finds the terminal symbols that are ignored in every state, storing them in ascending order in result
+void parser_tables::find_ignored_symbols(std::vector<int>& result) const {
+    // Count the states where each symbol has only ignore actions
+    map<int, int>   ignoredStates;
+    int             numChecked = 0;
+    
+    for (int stateId = 0; stateId < m_NumStates; ++stateId) {
+        // States with a default reduction don't look at the lookahead
+        if (has_default_reduction(stateId)) continue;
+        ++numChecked;
+        
+        const action*   act     = m_TerminalActions[stateId];
+        const action*   last    = act + m_Counts[stateId].numTerminals;
+        
+        while (act != last) {
+            // Check every action for this symbol
+            int     symbolId    = act->symbolId;
+            bool    ignored     = true;
+            
+            for (; act != last && act->symbolId == symbolId; ++act) {
+                if (act->type != lr_action::act_ignore) ignored = false;
+            }
+            
+            if (ignored) ++ignoredStates[symbolId];
+        }
+    }
+    
+    // The result is the symbols that were ignored in every state that was checked
+    result.clear();
+    if (numChecked == 0) return;
+    
+    for (map<int, int>::const_iterator symbol = ignoredStates.begin(); symbol != ignoredStates.end(); ++symbol) {
+        if (symbol->second == numChecked) {
+            result.push_back(symbol->first);
+        }
+    }
+}
@@ -29,7 +29,12 @@
 #define _LR_PARSER_TABLES_H
 
 #include <algorithm>
+#include <iosfwd>
+#include <map>
+#include <vector>
 
+#include "TameParse/Util/comb_vector.h"
+#include "TameParse/Lr/guard_dfa.h"
 #include "TameParse/Lr/lalr_builder.h"
 #include "TameParse/Lr/weak_symbols.h"
 #include "TameParse/Dfa/lexer.h"
@@ -40,6 +45,9 @@ namespace lr {
     ///
     class parser_tables {
     public:
+        /// \brief The default maximum size in bytes of the action indexes built for tables created from a lalr_builder
+        static const size_t c_DefaultMaxIndexSize = 4*1024*1024;
+        
         ///
         /// \brief Description of a parser action
         ///
@@ -80,6 +88,24 @@ namespace lr {
             int numNonterminals;
         };
         
+        /// \brief Bits in the flags for each state (see state_flags())
+        enum state_flag {
+            /// \brief The state has an action on the 'end of guard' symbol
+            state_end_of_guard      = 0x01,
+            
+            /// \brief The state has at least one guard action
+            state_guard_actions     = 0x02,
+            
+            /// \brief The state has at least one weak reduce action
+            state_weak_reduce       = 0x04,
+            
+            /// \brief The state has a default reduction
+            state_default_reduction = 0x08,
+            
+            /// \brief The state has an accepting action
+            state_accept            = 0x10
+        };
+        
         /// \brief Structure that maps a weak symbol to its strong equivalent
         struct symbol_equivalent {
             int m_OriginalSymbol;
@@ -107,9 +133,13 @@ namespace lr {
         int m_EndOfGuard;
         
         /// \brief The terminal action table (sorted in order of terminal ID)
+        ///
+        /// States with identical actions can share the same row, so rows must never be changed for a single state
         action** m_TerminalActions;
         
         /// \brief The nonterminal action table (goto actions, guard actions)
+        ///
+        /// As for the terminal actions, states with identical actions can share the same row
         action** m_NonterminalActions;
         
         /// \brief Counts the number of actions in each state
@@ -132,16 +162,126 @@ namespace lr {
         
         /// \brief Ordered list of weak symbols and their strong equivalent
         symbol_equivalent* m_WeakToStrong;
+        
+        /// \brief The number of entries in m_StrongForWeak (one more than the largest weak symbol)
+        int m_NumStrongForWeak;
+        
+        /// \brief The strong equivalent of each terminal symbol up to the largest weak symbol, or NULL to search m_WeakToStrong
+        ///
+        /// Symbols that aren't weak map to themselves. This is owned along with the indexes.
+        int* m_StrongForWeak;
+        
+        /// \brief The default reduction for each state, or NULL if there are no default reductions
+        ///
+        /// States with a default reduction have a reduce action here, and have no terminal actions. States without one
+        /// have an ignore action.
+        action* m_DefaultReductions;
+        
+        /// \brief The number of entries in m_DefaultGotos (one more than the largest nonterminal with a default goto)
+        int m_NumDefaultGotos;
+        
+        /// \brief The state to go to for each nonterminal in states that have no goto action for it, or -1
+        ///
+        /// The most common goto for each nonterminal is stored here instead of in the nonterminal actions for every
+        /// state. This can be NULL if there are no default gotos. It is owned along with the tables.
+        int* m_DefaultGotos;
 
         /// \brief True if this object owns the tables
         bool m_DeleteTables;
         
+        /// \brief True if this object owns the per-state action list arrays, but not the actions themselves
+        ///
+        /// This is the case for tables loaded by from_binary(), where the actions are in the caller's buffer
+        bool m_DeleteActionLists;
+        
+        /// \brief Row-displacement index mapping states and terminal symbols to the offset of their first action, or NULL
+        ///
+        /// The index may refer to hard-coded arrays
+        util::comb_vector* m_TerminalIndex;
+        
+        /// \brief Row-displacement index mapping states and nonterminal symbols to the offset of their first action, or NULL
+        util::comb_vector* m_NonterminalIndex;
+        
+        /// \brief True if this object owns the index objects
+        bool m_DeleteIndexes;
+        
+        /// \brief DFAs that can evaluate some of the guards without running the parser, or NULL
+        ///
+        /// These are always owned by this object.
+        guard_dfa* m_Guards;
+        
+        /// \brief The number of terminal symbols covered by each row of m_ValidTerminals
+        int m_NumValidTerminals;
+        
+        /// \brief Bits indicating the terminals that can be the lookahead in each state, or NULL
+        ///
+        /// Each state has a row of (m_NumValidTerminals + 31) / 32 words. These are always owned by this object.
+        unsigned int* m_ValidTerminals;
+        
+        /// \brief The offset in m_ExpectedTerminals of the terminals expected in each state, with an extra entry for the end of the last state, or NULL
+        ///
+        /// These are always owned by this object.
+        int* m_ExpectedOffsets;
+        
+        /// \brief The terminals that the parser expects in each state, in ascending order within each state
+        int* m_ExpectedTerminals;
+        
+        /// \brief A byte of state_flag bits for each state, or NULL
+        unsigned char* m_StateFlags;
+        
+        /// \brief True if this object owns m_StateFlags
+        bool m_DeleteStateFlags;
+        
     public:
         /// \brief Creates a parser from the result of the specified builder class
-        parser_tables(const lalr_builder& builder, const weak_symbols* weakSyms);
+        ///
+        /// The actions are indexed so they can be found in constant time, unless the index would need more than
+        /// maxIndexSize bytes, in which case the parser will use a binary search instead. Pass 0 to never build an index.
+        parser_tables(const lalr_builder& builder, const weak_symbols* weakSyms, size_t maxIndexSize = c_DefaultMaxIndexSize);
 
         /// \brief Creates a parser from a set of tables. Tables passed into this constructor will not be deleted by the destructor
-        parser_tables(int numStates, int endOfInputSymbol, int endOfGuardSymbol, action** terminalActions, action** nonterminalActions, action_count* actionCounts, int* endGuardStates, int numEndGuards, int numRules, reduce_rule* reduceRules, int numWeakToStrong, symbol_equivalent* weakToStrong);
+        ///
+        /// The index tables are optional: if they are supplied, they must have been created by create_terminal_index and
+        /// create_nonterminal_index for these tables. They are copied unless copyIndexes is false, in which case they
+        /// must last as long as this object.
+        ///
+        /// With copyIndexes set to false, this can initialise a static object when the program is compiled, which is
+        /// how generated parsers use it. The strong symbol map (see create_strong_for_weak) is treated as an index: it
+        /// is built from the weak to strong table when copyIndexes is true, and used as-is otherwise.
+        ///
+        /// The default gotos (see default_goto) and the state flags (see compile_state_flags) are optional, and are never
+        /// copied.
+        TAMEPARSE_CONSTEXPR parser_tables(int numStates, int endOfInputSymbol, int endOfGuardSymbol, const action* const* terminalActions, const action* const* nonterminalActions, const action_count* actionCounts, const int* endGuardStates, int numEndGuards, int numRules, const reduce_rule* reduceRules, int numWeakToStrong, const symbol_equivalent* weakToStrong, const action* defaultReductions = NULL, const util::comb_vector* terminalIndex = NULL, const util::comb_vector* nonterminalIndex = NULL, bool copyIndexes = true, int numStrongForWeak = 0, const int* strongForWeak = NULL, int numDefaultGotos = 0, const int* defaultGotos = NULL, const unsigned char* stateFlags = NULL)
+        : m_NumStates(numStates)
+        , m_EndOfInput(endOfInputSymbol)
+        , m_EndOfGuard(endOfGuardSymbol)
+        , m_TerminalActions(const_cast<action**>(terminalActions))
+        , m_NonterminalActions(const_cast<action**>(nonterminalActions))
+        , m_Counts(const_cast<action_count*>(actionCounts))
+        , m_EndGuardStates(const_cast<int*>(endGuardStates))
+        , m_NumEndOfGuards(numEndGuards)
+        , m_NumRules(numRules)
+        , m_Rules(const_cast<reduce_rule*>(reduceRules))
+        , m_NumWeakToStrong(numWeakToStrong)
+        , m_WeakToStrong(const_cast<symbol_equivalent*>(weakToStrong))
+        , m_NumStrongForWeak(copyIndexes ? strong_for_weak_size(numWeakToStrong, weakToStrong) : numStrongForWeak)
+        , m_StrongForWeak(copyIndexes ? create_strong_for_weak(numWeakToStrong, weakToStrong) : const_cast<int*>(strongForWeak))
+        , m_DefaultReductions(const_cast<action*>(defaultReductions))
+        , m_NumDefaultGotos(numDefaultGotos)
+        , m_DefaultGotos(const_cast<int*>(defaultGotos))
+        , m_DeleteTables(false)
+        , m_DeleteActionLists(false)
+        , m_TerminalIndex(copyIndexes && terminalIndex ? new util::comb_vector(*terminalIndex) : const_cast<util::comb_vector*>(terminalIndex))
+        , m_NonterminalIndex(copyIndexes && nonterminalIndex ? new util::comb_vector(*nonterminalIndex) : const_cast<util::comb_vector*>(nonterminalIndex))
+        , m_DeleteIndexes(copyIndexes)
+        , m_Guards(NULL)
+        , m_NumValidTerminals(0)
+        , m_ValidTerminals(NULL)
+        , m_ExpectedOffsets(NULL)
+        , m_ExpectedTerminals(NULL)
+        , m_StateFlags(const_cast<unsigned char*>(stateFlags))
+        , m_DeleteStateFlags(false) {
+        }
 
         /// \brief Copy constructor
         parser_tables(const parser_tables& copyFrom);
@@ -155,6 +295,23 @@ namespace lr {
         /// \brief Calculates the size in bytes of these parser tables
         virtual size_t size() const;
         
+        /// \brief The number of bytes used by these tables (the same as size())
+        inline size_t memory_usage() const { return size(); }
+        
+    public:
+        /// \brief Writes these tables to the specified stream (which should be opened in binary mode) in the format read by from_binary
+        ///
+        /// The format stores every table as a flat array of native-endian integers, so it can only be read on a system with the same
+        /// byte order and action layout as the one that wrote it.
+        void write_binary(std::ostream& target) const;
+        
+        /// \brief Creates parser tables that refer directly to data written by write_binary, or returns NULL if the data is not valid
+        ///
+        /// None of the tables are copied, so the data (typically a mapped file) must be aligned to an int and must remain valid
+        /// until the result is destroyed. Only the structure of the data is checked: the contents are assumed to be tables
+        /// that were written by write_binary.
+        static parser_tables* from_binary(const void* data, size_t size);
+        
     private:
         /// \brief Compares a symbol to an action
         inline static bool compare_symbols(const action& a, const action& compareTo) {
@@ -169,6 +326,29 @@ namespace lr {
             return std::lower_bound(actionList, actionList + count, compareAction, compare_symbols);
         }
         
+        /// \brief Finds an action using an index
+        inline const action_iterator find_indexed_action(int stateId, int symbol, const util::comb_vector& index, action* actionList, int count) const {
+            int offset = index.lookup(stateId, symbol);
+            if (offset < 0) return actionList + count;
+            
+            return actionList + offset;
+        }
+        
+        /// \brief Moves the most common goto for each nonterminal into m_DefaultGotos, removing it from the nonterminal actions
+        void remove_default_gotos();
+        
+        /// \brief Creates an index for the specified action table, or returns NULL if it would be larger than maxSize bytes
+        static util::comb_vector* create_index(int numStates, const action* const* actions, const action_count* counts, bool nonterminals, size_t maxSize);
+        
+        /// \brief Sets the bits for the terminals that can be the lookahead in each state in a set of rows of numWords words
+        ///
+        /// Ignored terminals are only included if includeIgnored is true. Weak terminals are included only where they
+        /// have actions of their own.
+        void find_lookahead_terminals(unsigned int* rows, int numWords, bool includeIgnored) const;
+        
+        /// \brief Works out the state_flag bits for a state by looking at its actions
+        unsigned int find_state_flags(int stateId) const;
+        
     public:
         /// \brief Returns the reduce rule with the specified ID
         inline const reduce_rule& rule(int ruleId) const { return m_Rules[ruleId]; }
@@ -185,16 +365,62 @@ namespace lr {
         
         /// \brief Finds the first action that refers to a terminal with an ID equal or greater to that supplied 
         /// to this function
+        ///
+        /// If these tables have an index, the result is either the first action for the terminal or 
+        /// last_terminal_action() if there is no such action.
         inline action_iterator find_terminal(int stateId, int terminal) const {
+            if (m_TerminalIndex) {
+                return find_indexed_action(stateId, terminal, *m_TerminalIndex, m_TerminalActions[stateId], m_Counts[stateId].numTerminals);
+            }
             return find_action(terminal, m_TerminalActions[stateId], m_Counts[stateId].numTerminals);
         }
         
         /// \brief Finds the first action that refers to a nonterminal with an ID equal or greater to that supplied
         /// to this function
+        ///
+        /// If these tables have an index, the result is either the first action for the nonterminal or 
+        /// last_nonterminal_action() if there is no such action.
         inline action_iterator find_nonterminal(int stateId, int nonterminal) const {
+            if (m_NonterminalIndex) {
+                return find_indexed_action(stateId, nonterminal, *m_NonterminalIndex, m_NonterminalActions[stateId], m_Counts[stateId].numNonterminals);
+            }
             return find_action(nonterminal, m_NonterminalActions[stateId], m_Counts[stateId].numNonterminals);
         }
         
+        /// \brief The state that the parser goes to for a nonterminal when the state has no goto action of its own, or -1
+        inline int default_goto(int nonterminal) const {
+            if (nonterminal < 0 || nonterminal >= m_NumDefaultGotos) return -1;
+            return m_DefaultGotos[nonterminal];
+        }
+        
+        /// \brief The state to go to after reducing a rule for the specified nonterminal in the specified state, or -1
+        ///
+        /// The most common goto for each nonterminal is not stored with the nonterminal actions for each state, so
+        /// this should be used to find gotos rather than searching the actions. States that can't contain the
+        /// nonterminal will also return the default goto, so this is only meaningful when the parser is in a valid state.
+        inline int goto_state(int stateId, int nonterminal) const {
+            action_iterator last = last_nonterminal_action(stateId);
+            
+            for (action_iterator gotoAct = find_nonterminal(stateId, nonterminal); gotoAct != last && gotoAct->symbolId == nonterminal; ++gotoAct) {
+                if (gotoAct->type == lr_action::act_goto) return gotoAct->nextState;
+            }
+            
+            return default_goto(nonterminal);
+        }
+        
+        /// \brief True if the specified state always reduces the same rule, whatever the lookahead
+        ///
+        /// These states have no terminal actions: the parser should perform default_reduction() instead of looking
+        /// for an action that matches the lookahead.
+        inline bool has_default_reduction(int stateId) const {
+            return m_DefaultReductions && m_DefaultReductions[stateId].type == lr_action::act_reduce;
+        }
+        
+        /// \brief The default reduce action for the specified state (only valid if has_default_reduction returns true)
+        inline action_iterator default_reduction(int stateId) const {
+            return m_DefaultReductions + stateId;
+        }
+        
         /// \brief Returns the nonterminal identifier representing the end of input symbol
         inline int end_of_input() const { return m_EndOfInput; }
         
@@ -203,18 +429,34 @@ namespace lr {
         
         /// \brief Returns true if the specified state has an end of guard symbol
         inline bool has_end_of_guard(int stateId) const {
+            if (m_StateFlags) return (m_StateFlags[stateId] & state_end_of_guard) != 0;
             return std::binary_search(m_EndGuardStates, m_EndGuardStates + m_NumEndOfGuards, stateId);
         }
         
+        /// \brief The state_flag bits for the specified state
+        ///
+        /// These are looked up in a table with a byte for each state if compile_state_flags() has been called (or the
+        /// table was supplied to the constructor), and worked out from the actions for the state otherwise.
+        inline unsigned int state_flags(int stateId) const {
+            if (m_StateFlags) return m_StateFlags[stateId];
+            return find_state_flags(stateId);
+        }
+        
         /// \brief Finds the strong symbol that is equivalent to a given weak terminal symbol
         inline int strong_for_weak(int weakTerminal) const {
+            // Use the direct map if there is one
+            if (m_StrongForWeak) {
+                if (weakTerminal < 0 || weakTerminal >= m_NumStrongForWeak) return weakTerminal;
+                return m_StrongForWeak[weakTerminal];
+            }
+            
             // If there are no symbols in the map, then just return the terminal symbol
             if (m_NumWeakToStrong == 0) return weakTerminal;
             
-            // Look up the symbol in the map
+            // Look up the symbol in the ordered map
             const symbol_equivalent     search  = { weakTerminal, 0 };
-            const symbol_equivalent*    found   = std::find(m_WeakToStrong, m_WeakToStrong + m_NumWeakToStrong, search);
-            if (found != m_WeakToStrong + m_NumWeakToStrong) {
+            const symbol_equivalent*    found   = std::lower_bound(m_WeakToStrong, m_WeakToStrong + m_NumWeakToStrong, search);
+            if (found != m_WeakToStrong + m_NumWeakToStrong && found->m_OriginalSymbol == weakTerminal) {
                 return found->m_MappedTo;
             }
             
@@ -232,6 +474,154 @@ namespace lr {
         inline int count_states() const { 
             return m_NumStates;
         }
+        
+    public:
+        /// \brief Builds row-displacement indexes for the action tables, so that find_terminal and find_nonterminal
+        /// take constant time instead of performing a binary search
+        ///
+        /// The indexes are limited to maxSize bytes between them. This returns false if either of them could not be built,
+        /// in which case the corresponding actions will continue to be found using a binary search.
+        bool build_index(size_t maxSize = c_DefaultMaxIndexSize);
+        
+        /// \brief Compiles the guards that only look at a few terminal symbols into DFAs, so that the parser can check 
+        /// them without simulating the parser
+        ///
+        /// Tables created from a lalr_builder or by from_binary() already have these; hard-coded tables don't, but it's
+        /// safe to call this on them as the DFAs are owned separately. Guards that would need more than maxStates DFA
+        /// states are left to the parser.
+        void compile_guards(int maxStates = guard_dfa::c_DefaultMaxStates);
+        
+        /// \brief The compiled guards, or NULL if compile_guards() hasn't been called
+        inline const guard_dfa* compiled_guards() const { return m_Guards; }
+        
+        /// \brief Works out which terminals can be the lookahead in each state, so that the lexer can avoid matching any others
+        ///
+        /// A terminal is valid in a state that has an action for it. States with a default reduction have no terminal
+        /// actions, so they allow the terminals that are valid in any state they can go to after the reduction. Weak
+        /// terminals are valid wherever their strong equivalent is. As with compile_guards(), the result is owned
+        /// separately, so this can be called on any tables; it is kept up to date if the tables are renumbered.
+        void compile_valid_terminals();
+        
+        /// \brief The number of terminals covered by valid_terminals(), or 0 if compile_valid_terminals() hasn't been called
+        inline int count_valid_terminals() const { return m_NumValidTerminals; }
+        
+        /// \brief Bits indicating which terminals can be the lookahead in the specified state, or NULL if 
+        /// compile_valid_terminals() hasn't been called
+        ///
+        /// Bit n%32 of word n/32 is set if terminal n is valid, in the format used by dfa::lexeme_stream::set_valid_symbols.
+        inline const unsigned int* valid_terminals(int stateId) const {
+            if (!m_ValidTerminals) return NULL;
+            return m_ValidTerminals + stateId * ((m_NumValidTerminals + 31) / 32);
+        }
+        
+        /// \brief Works out which terminals the parser expects in each state, so that syntax errors can be described quickly
+        ///
+        /// These are the terminals that have an action other than ignore. States with a default reduction expect the
+        /// terminals expected by any state they can go to after the reduction, as for compile_valid_terminals(). The
+        /// result is a sorted list for each state, which is written out by write_binary(). Tables created from a
+        /// lalr_builder compile these automatically, and they are kept up to date if the tables are renumbered.
+        void compile_expected_terminals();
+        
+        /// \brief True if the expected terminals have been compiled
+        inline bool has_expected_terminals() const { return m_ExpectedOffsets != NULL; }
+        
+        /// \brief The first of the terminals expected in the specified state, or NULL if they haven't been compiled
+        ///
+        /// The terminals are in ascending order and end at last_expected(). When a parser stops with a syntax error,
+        /// these are the terminals that could have been accepted instead of the lookahead by the state on top of its
+        /// stack (see parse_error::state()).
+        inline const int* first_expected(int stateId) const {
+            if (!m_ExpectedOffsets) return NULL;
+            return m_ExpectedTerminals + m_ExpectedOffsets[stateId];
+        }
+        
+        /// \brief The end of the terminals expected in the specified state, or NULL if they haven't been compiled
+        inline const int* last_expected(int stateId) const {
+            if (!m_ExpectedOffsets) return NULL;
+            return m_ExpectedTerminals + m_ExpectedOffsets[stateId + 1];
+        }
+        
+        /// \brief Builds the table of state_flag bits used by state_flags() and has_end_of_guard()
+        ///
+        /// This lets the parser test a state for guards, weak reductions and so on by reading a single byte, rather than
+        /// searching its actions. Tables created from a lalr_builder or by from_binary() already have this table, and
+        /// generated parsers supply it to the constructor; it's safe to call this on other hard-coded tables as the 
+        /// result is owned separately. It is kept up to date if the tables are renumbered.
+        void compile_state_flags();
+        
+        /// \brief The state_flag bits for each state, or NULL if they haven't been compiled
+        inline const unsigned char* state_flag_table() const { return m_StateFlags; }
+        
+        /// \brief Creates a row-displacement index mapping states and terminal symbols to the offset of the first matching action
+        ///
+        /// The caller is responsible for freeing the result, which is NULL if the actions can't be indexed.
+        util::comb_vector* create_terminal_index() const;
+        
+        /// \brief Creates a row-displacement index mapping states and nonterminal symbols to the offset of the first matching action
+        ///
+        /// The caller is responsible for freeing the result, which is NULL if the actions can't be indexed.
+        util::comb_vector* create_nonterminal_index() const;
+        
+        /// \brief The number of entries needed to map weak symbols directly to their strong equivalent
+        ///
+        /// This is one more than the largest weak symbol, or 0 if there are no weak symbols
+        static int strong_for_weak_size(int numWeakToStrong, const symbol_equivalent* weakToStrong);
+        
+        /// \brief Creates an array mapping each terminal symbol (up to the largest weak symbol) to its strong equivalent
+        ///
+        /// Symbols that aren't weak map to themselves. The result has strong_for_weak_size entries, and is NULL if there
+        /// are no weak symbols. The caller is responsible for freeing it with delete[].
+        static int* create_strong_for_weak(int numWeakToStrong, const symbol_equivalent* weakToStrong);
+        
+        /// \brief Turns shift actions into act_shiftreduce actions where the new state always performs the same reduction
+        ///
+        /// The parser then performs the reduction as soon as the symbol is shifted, rather than reading the next symbol and
+        /// finding that the state it has moved to has a default reduction. This returns the number of actions that were
+        /// changed, and does nothing if these tables refer to data that they don't own.
+        int combine_shift_reduce();
+        
+        /// \brief Moves every state to the position given by newIds (which maps existing state IDs to new ones)
+        ///
+        /// This is used to put states that are used together close to each other in memory. The actions within each
+        /// state stay sorted by symbol, and any index is rebuilt within maxIndexSize bytes. This returns false, leaving
+        /// the tables unchanged, if newIds is not a permutation of the existing state IDs or if these tables refer to
+        /// data that they don't own.
+        bool renumber_states(const std::vector<int>& newIds, size_t maxIndexSize = c_DefaultMaxIndexSize);
+        
+        /// \brief Works out new state IDs for renumber_states that put the most frequently used states first
+        ///
+        /// The first numFixedStates states (usually the initial states) keep their IDs. States that aren't in the
+        /// frequency map are assumed to be unused, and states that are used equally often keep their relative order.
+        static std::vector<int> order_states_by_frequency(int numStates, int numFixedStates, const std::map<int, long>& frequencies);
+        
+        /// \brief Works out new state IDs for renumber_states that put each state close to the states that lead to it
+        ///
+        /// This needs no profile: the first numFixedStates states keep their IDs, and the others are numbered in the
+        /// order that a depth-first search from the fixed states reaches them (following the shift actions before the
+        /// gotos). States along a common path through the grammar and the states of a loop end up next to each other.
+        /// States that can't be reached are left at the end in their original order.
+        std::vector<int> order_states_by_traversal(int numFixedStates) const;
+        
+        /// \brief Gives every terminal symbol in these tables a new identifier
+        ///
+        /// newIds maps existing terminal IDs to new ones, and must be a permutation that covers every terminal symbol
+        /// used by these tables. The lexer that supplies the lexemes must be given the same identifiers. This returns
+        /// false, leaving the tables unchanged, if newIds isn't a suitable permutation or if these tables refer to data
+        /// that they don't own.
+        bool renumber_terminals(const std::vector<int>& newIds, size_t maxIndexSize = c_DefaultMaxIndexSize);
+        
+        /// \brief Works out dense terminal IDs for renumber_terminals
+        ///
+        /// The terminals that the parser acts on in the most states get the lowest identifiers, so the symbols that
+        /// the parser uses are contiguous. Terminals that the parser never sees (such as those only used by the lexer)
+        /// come last, and terminals that are used equally often keep their relative order.
+        static std::vector<int> order_terminals_by_use(const parser_tables& tables, int numTerminals);
+        
+        /// \brief The index for the terminal actions, or NULL if these tables are not indexed
+        inline const util::comb_vector* terminal_index() const { return m_TerminalIndex; }
+        
+        /// \brief The index for the nonterminal actions, or NULL if these tables are not indexed
+        inline const util::comb_vector* nonterminal_index() const { return m_NonterminalIndex; }
 
     public:
         /// \brief The terminal actions table.
@@ -246,6 +636,18 @@ namespace lr {
         /// given state.
         inline const action* const* nonterminal_actions() const { return m_NonterminalActions; }
 
+        /// \brief The default reduction table, or NULL if there are no default reductions
+        ///
+        /// There is one entry per state: a reduce action for states with a default reduction, or an ignore action
+        /// for states without one.
+        inline const action* default_reductions() const { return m_DefaultReductions; }
+
+        /// \brief The default goto for each nonterminal (count_default_gotos entries, -1 for no default), or NULL
+        inline const int* default_gotos() const { return m_DefaultGotos; }
+        
+        /// \brief The number of entries in the default_gotos table
+        inline int count_default_gotos() const { return m_NumDefaultGotos; }
+
         /// \brief The action count table
         ///
         /// There is one entry per state, each entry supplies the size of the terminal and nonterminal actions for that state.
@@ -268,6 +670,21 @@ namespace lr {
 
         /// \brief The weak-to-strong equivalence table (ordered, count_weak_to_strong entries)
         inline const symbol_equivalent* weak_to_strong() const { return m_WeakToStrong; }
+        
+        /// \brief The number of entries in the strong_for_weak_table
+        inline int count_strong_for_weak() const { return m_NumStrongForWeak; }
+        
+        /// \brief The strong equivalent of each terminal symbol up to the largest weak symbol, or NULL if there isn't one
+        inline const int* strong_for_weak_table() const { return m_StrongForWeak; }
+        
+    public:
+        /// \brief Finds the terminal symbols that are ignored in every state, storing them in ascending order in result
+        ///
+        /// A lexer can skip these symbols without creating a lexeme for them, as the parser will discard them whatever
+        /// state it is in (see dfa::lexeme_stream::skip_symbols). Symbols that are only ignored in some states (which
+        /// is how the ignored_symbols rewriter treats ignored symbols with an action of their own) are not included,
+        /// and nor are states with a default reduction, as these never look at the lookahead.
+        void find_ignored_symbols(std::vector<int>& result) const;
     };
 }
 
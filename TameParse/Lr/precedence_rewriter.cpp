@@ -33,6 +33,53 @@ using namespace std;
 using namespace contextfree;
 using namespace lr;
 
+/// \brief Precedence value representing 'no precedence'
+const int precedence_rewriter::no_precedence;
+
+/// \brief Creates a new precedence rewriter
+precedence_rewriter::precedence_rewriter()
+: m_CachedBuilder(NULL)
+, m_CachedGrammar(NULL) {
+}
+
+/// \brief Copies a precedence rewriter (the rule caches are not copied)
+precedence_rewriter::precedence_rewriter(const precedence_rewriter& copyFrom)
+: action_rewriter(copyFrom)
+, m_CachedBuilder(NULL)
+, m_CachedGrammar(NULL) {
+}
+
+/// \brief Fetches the cached index of the specified rule, calculating its precedence and associativity if needed
+size_t precedence_rewriter::cached_rule(const contextfree::rule& rule, const lalr_builder& builder) const {
+    // Discard the caches if this is a new build
+    if (m_CachedBuilder != &builder || m_CachedGrammar != &builder.gram()) {
+        m_CachedBuilder = &builder;
+        m_CachedGrammar = &builder.gram();
+        m_RuleCached.clear();
+        m_RulePrecedence.clear();
+        m_RuleAssociativity.clear();
+    }
+
+    // Get the identifier for this rule
+    size_t ruleId = (size_t) rule.identifier(builder.gram());
+
+    // Make space for it in the caches
+    if (ruleId >= m_RuleCached.size()) {
+        m_RuleCached.resize(ruleId + 1, false);
+        m_RulePrecedence.resize(ruleId + 1, no_precedence);
+        m_RuleAssociativity.resize(ruleId + 1, nonassociative);
+    }
+
+    // Work out the precedence of the rule the first time it's seen
+    if (!m_RuleCached[ruleId]) {
+        m_RulePrecedence[ruleId]    = get_rule_precedence(rule);
+        m_RuleAssociativity[ruleId] = get_rule_associativity(rule);
+        m_RuleCached[ruleId]        = true;
+    }
+
+    return ruleId;
+}
+
 /// \brief Modifies the specified set of actions according to the rules in this rewriter
 ///
 /// This call should modify the contents of the supplied action set according to whatever rules it considers 
@@ -94,8 +141,9 @@ void precedence_rewriter::rewrite_actions(int stateId, lr_action_set& actions, c
         }
 
         // Get the precedence of the shift token and the rule being reduced
-        int shiftPrec   = get_precedence(terminal, shiftItems);
-        int reducePrec  = get_rule_precedence(*(*reduce)->rule());
+        size_t  reduceRule  = cached_rule(*(*reduce)->rule(), builder);
+        int     shiftPrec   = get_precedence(terminal, shiftItems);
+        int     reducePrec  = m_RulePrecedence[reduceRule];
 
         // Ignore any items which don't have a precedence
         if (shiftPrec == no_precedence || reducePrec == no_precedence) continue;
@@ -111,7 +159,7 @@ void precedence_rewriter::rewrite_actions(int stateId, lr_action_set& actions, c
             actions.erase(*reduce);
         } else {
             // When precedences are identical, then look at the associativity for the reduce side of the rule
-            associativity reduceAssoc   = get_rule_associativity(*(*reduce)->rule());
+            associativity reduceAssoc   = m_RuleAssociativity[reduceRule];
 
             // If the item being reduced is right associative, then resolve as a shift
             // (So a + b + c --> a + (b + c))
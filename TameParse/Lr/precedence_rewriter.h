@@ -29,6 +29,7 @@
 #define _LR_PRECEDENCE_REWRITER_H
 
 #include <climits>
+#include <vector>
 
 #include "TameParse/ContextFree/item.h"
 #include "TameParse/Lr/action_rewriter.h"
@@ -57,11 +58,38 @@ namespace lr {
         /// \brief Precedence value representing 'no precedence'
         static const int no_precedence = INT_MIN;
 
+    private:
+        /// \brief The builder that the rule caches were filled in for
+        mutable const lalr_builder* m_CachedBuilder;
+
+        /// \brief The grammar that the rule caches were filled in for
+        mutable const contextfree::grammar* m_CachedGrammar;
+
+        /// \brief True for each rule identifier whose precedence and associativity have been cached
+        mutable std::vector<bool> m_RuleCached;
+
+        /// \brief The precedence of each rule, indexed by rule identifier
+        mutable std::vector<int> m_RulePrecedence;
+
+        /// \brief The associativity of each rule, indexed by rule identifier
+        mutable std::vector<associativity> m_RuleAssociativity;
+
+        /// \brief Fetches the cached index of the specified rule, calculating its precedence and associativity if needed
+        ///
+        /// The caches are discarded whenever the builder or grammar changes, so each rule is only examined once per build
+        size_t cached_rule(const contextfree::rule& rule, const lalr_builder& builder) const;
+
     protected:
         /// \brief Finds the item in a rule that defines its precedence, or -1 if the rule has no such items
         int precedence_item_index(const contextfree::rule& rule) const;
 
     public:
+        /// \brief Creates a new precedence rewriter
+        precedence_rewriter();
+
+        /// \brief Copies a precedence rewriter (the rule caches are not copied)
+        precedence_rewriter(const precedence_rewriter& copyFrom);
+
         /// \brief Modifies the specified set of actions according to the rules in this rewriter
         ///
         /// This call should modify the contents of the supplied action set according to whatever rules it considers 
@@ -0,0 +1,363 @@
+//
+//  profiling_parser_trace.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include <sstream>
+
+#include "TameParse/Lr/profiling_parser_trace.h"
+#include "TameParse/Util/parallel.h"
+
+using namespace std;
+using namespace contextfree;
+using namespace lr;
+
+/// \brief Creates a frame with no time recorded against it
+parser_profile::frame::frame(frame_kind kind, int symbol)
+: kind(kind)
+, symbol(symbol)
+, selfTime(0) {
+}
+
+/// \brief Destroys this frame and its children
+parser_profile::frame::~frame() {
+    for (frame_list::iterator child = children.begin(); child != children.end(); ++child) {
+        delete *child;
+    }
+}
+
+/// \brief Finds the child with the specified kind and symbol, creating it if it doesn't exist yet
+parser_profile::frame* parser_profile::frame::child(frame_kind kind, int symbol) {
+    for (frame_list::iterator child = children.begin(); child != children.end(); ++child) {
+        if ((*child)->kind == kind && (*child)->symbol == symbol) return *child;
+    }
+    
+    children.push_back(new frame(kind, symbol));
+    return children.back();
+}
+
+/// \brief Adds a frame as a child of this one, merging it with an existing child with the same label
+void parser_profile::frame::adopt(frame* newChild) {
+    // Add as a new child if there's nothing to merge with
+    frame* existing = NULL;
+    for (frame_list::iterator child = children.begin(); child != children.end(); ++child) {
+        if ((*child)->kind == newChild->kind && (*child)->symbol == newChild->symbol) {
+            existing = *child;
+            break;
+        }
+    }
+    
+    if (!existing) {
+        children.push_back(newChild);
+        return;
+    }
+    
+    // Merge the time and the children of the new frame into the existing one
+    existing->selfTime += newChild->selfTime;
+    for (frame_list::iterator child = newChild->children.begin(); child != newChild->children.end(); ++child) {
+        existing->adopt(*child);
+    }
+    
+    newChild->children.clear();
+    delete newChild;
+}
+
+/// \brief The time spent in this frame and its children, in seconds
+double parser_profile::frame::total_time() const {
+    double result = selfTime;
+    for (frame_list::const_iterator child = children.begin(); child != children.end(); ++child) {
+        result += (*child)->total_time();
+    }
+    return result;
+}
+
+/// \brief Creates an empty profile
+parser_profile::parser_profile()
+: m_Pending(NULL) {
+    reset();
+}
+
+/// \brief Destructor
+parser_profile::~parser_profile() {
+    delete m_Pending;
+    for (frame::frame_list::iterator entry = m_Stack.begin(); entry != m_Stack.end(); ++entry) {
+        delete *entry;
+    }
+}
+
+/// \brief Throws away the profile and starts timing from now
+void parser_profile::reset() {
+    delete m_Pending;
+    for (frame::frame_list::iterator entry = m_Stack.begin(); entry != m_Stack.end(); ++entry) {
+        delete *entry;
+    }
+    
+    m_Pending       = new frame(parser_frame, -1);
+    m_ReduceLength  = 0;
+    m_ReduceTime    = 0;
+    m_Stack.clear();
+    m_Activities.clear();
+    
+    m_Clock.restart();
+    m_LastTime = m_Clock.seconds();
+}
+
+/// \brief Adds the time since the last call to the current activity
+void parser_profile::charge() {
+    double now      = m_Clock.seconds();
+    double elapsed  = now - m_LastTime;
+    m_LastTime      = now;
+    
+    // Time that isn't part of any other activity belongs to the parser
+    if (m_Activities.empty()) {
+        m_Pending->child(parser_frame, -1)->selfTime += elapsed;
+        return;
+    }
+    
+    const activity& current = m_Activities.back();
+    if (current.kind == nonterminal_frame) {
+        // Reduce actions are charged to the nonterminal once the reduction has finished
+        m_ReduceTime += elapsed;
+    } else {
+        m_Pending->child(current.kind, current.symbol)->selfTime += elapsed;
+    }
+}
+
+/// \brief Starts charging time to a new activity (until end_activity() is called)
+void parser_profile::begin_activity(frame_kind kind, int symbol) {
+    charge();
+    
+    activity newActivity;
+    newActivity.kind    = kind;
+    newActivity.symbol  = symbol;
+    m_Activities.push_back(newActivity);
+}
+
+/// \brief Goes back to charging time to the activity that was running before the last begin_activity()
+void parser_profile::end_activity() {
+    charge();
+    if (!m_Activities.empty()) m_Activities.pop_back();
+}
+
+/// \brief A terminal symbol has been shifted
+void parser_profile::shifted(int terminal) {
+    charge();
+    
+    // The pending time becomes the content of the frame for the terminal
+    frame* terminalFrame = new frame(terminal_frame, terminal);
+    terminalFrame->children.swap(m_Pending->children);
+    terminalFrame->selfTime = m_Pending->selfTime;
+    m_Pending->selfTime     = 0;
+    
+    m_Stack.push_back(terminalFrame);
+}
+
+/// \brief A reduction of a rule with the specified length has started
+void parser_profile::reducing(int length) {
+    m_ReduceLength  = length;
+    m_ReduceTime    = 0;
+    begin_activity(nonterminal_frame, -1);
+}
+
+/// \brief The reduction that was started by the last call to reducing() has finished
+void parser_profile::reduced(int nonterminal) {
+    end_activity();
+    
+    // The frames for the symbols in the rule become the children of the frame for the nonterminal
+    frame* nonterminalFrame     = new frame(nonterminal_frame, nonterminal);
+    nonterminalFrame->selfTime  = m_ReduceTime;
+    
+    int length = m_ReduceLength;
+    if (length > (int) m_Stack.size()) length = (int) m_Stack.size();
+    
+    for (frame::frame_list::iterator entry = m_Stack.end() - length; entry != m_Stack.end(); ++entry) {
+        nonterminalFrame->adopt(*entry);
+    }
+    m_Stack.erase(m_Stack.end() - length, m_Stack.end());
+    
+    m_Stack.push_back(nonterminalFrame);
+    m_ReduceLength  = 0;
+    m_ReduceTime    = 0;
+}
+
+/// \brief The total time recorded in this profile, in seconds
+double parser_profile::total_time() const {
+    double result = m_Pending->total_time();
+    for (frame::frame_list::const_iterator entry = m_Stack.begin(); entry != m_Stack.end(); ++entry) {
+        result += (*entry)->total_time();
+    }
+    return result;
+}
+
+/// \brief Converts a symbol name to a label for a folded stack (which can't contain separators or spaces)
+static string folded_label(const wstring& name) {
+    string result;
+    result.reserve(name.size());
+    
+    for (wstring::const_iterator chr = name.begin(); chr != name.end(); ++chr) {
+        if (*chr == L';' || *chr == L' ' || *chr == L'\t' || *chr == L'\n' || *chr == L'\r') {
+            result += '_';
+        } else if (*chr < 32 || *chr > 126) {
+            result += '?';
+        } else {
+            result += (char) *chr;
+        }
+    }
+    
+    return result;
+}
+
+namespace {
+    /// \brief Supplies names for symbols from lists of names
+    class profile_list_names {
+    private:
+        const vector<wstring>& m_Terminals;
+        const vector<wstring>& m_Nonterminals;
+    
+    public:
+        profile_list_names(const vector<wstring>& terminals, const vector<wstring>& nonterminals)
+        : m_Terminals(terminals)
+        , m_Nonterminals(nonterminals) {
+        }
+        
+        inline wstring terminal(int id) const {
+            if (id >= 0 && id < (int) m_Terminals.size()) return m_Terminals[id];
+            return L"";
+        }
+        
+        inline wstring nonterminal(int id) const {
+            if (id >= 0 && id < (int) m_Nonterminals.size()) return m_Nonterminals[id];
+            return L"";
+        }
+    };
+    
+    /// \brief Supplies names for symbols from a grammar and a terminal dictionary
+    class profile_grammar_names {
+    private:
+        const grammar&              m_Grammar;
+        const terminal_dictionary&  m_Terminals;
+    
+    public:
+        profile_grammar_names(const grammar& gram, const terminal_dictionary& terminals)
+        : m_Grammar(gram)
+        , m_Terminals(terminals) {
+        }
+        
+        inline wstring terminal(int id) const {
+            if (id >= 0 && id < m_Terminals.count_symbols()) return m_Terminals.name_for_symbol(id);
+            return L"";
+        }
+        
+        inline wstring nonterminal(int id) const {
+            return m_Grammar.name_for_nonterminal(id);
+        }
+    };
+}
+
+/// \brief Returns the label for a frame in a folded stack
+template<typename names> static string frame_label(const parser_profile::frame& fr, const names& symbolNames) {
+    ostringstream result;
+    
+    switch (fr.kind) {
+        case parser_profile::nonterminal_frame:
+        {
+            wstring name = symbolNames.nonterminal(fr.symbol);
+            if (name.empty()) {
+                result << "nonterminal-" << fr.symbol;
+            } else {
+                result << folded_label(name);
+            }
+            break;
+        }
+        
+        case parser_profile::terminal_frame:
+        {
+            wstring name = symbolNames.terminal(fr.symbol);
+            if (name.empty()) {
+                result << "terminal-" << fr.symbol;
+            } else {
+                result << folded_label(name);
+            }
+            break;
+        }
+        
+        case parser_profile::lexer_frame:
+            result << "[lex]";
+            break;
+        
+        case parser_profile::guard_frame:
+            result << "[guard-" << fr.symbol << "]";
+            break;
+        
+        case parser_profile::parser_frame:
+            result << "[parser]";
+            break;
+    }
+    
+    return result.str();
+}
+
+/// \brief Writes out a frame and its children in the folded stacks format
+template<typename names> static void write_frame(ostream& out, const string& path, const parser_profile::frame& fr, const names& symbolNames) {
+    string framePath = path.empty() ? frame_label(fr, symbolNames) : path + ";" + frame_label(fr, symbolNames);
+    
+    // Times are written in whole microseconds, so very short frames are left out
+    long microseconds = (long) (fr.selfTime * 1000000.0 + 0.5);
+    if (microseconds > 0) {
+        out << framePath << " " << microseconds << "\n";
+    }
+    
+    for (parser_profile::frame::frame_list::const_iterator child = fr.children.begin(); child != fr.children.end(); ++child) {
+        write_frame(out, framePath, **child, symbolNames);
+    }
+}
+
+/// \brief Writes out a profile in the folded stacks format
+template<typename names> static void write_profile(ostream& out, const parser_profile& profile, const names& symbolNames) {
+    // Each entry on the stack is the root of a tree
+    for (parser_profile::frame::frame_list::const_iterator entry = profile.stack().begin(); entry != profile.stack().end(); ++entry) {
+        write_frame(out, "", **entry, symbolNames);
+    }
+    
+    // Time that's still pending is written out without a symbol
+    const parser_profile::frame& pending = profile.pending();
+    for (parser_profile::frame::frame_list::const_iterator child = pending.children.begin(); child != pending.children.end(); ++child) {
+        write_frame(out, "", **child, symbolNames);
+    }
+}
+
+/// \brief Writes out the profile in the 'folded stacks' format read by flame graph tools
+void parser_profile::write_folded(std::ostream& out, const std::vector<std::wstring>& terminalNames, const std::vector<std::wstring>& nonterminalNames) const {
+    write_profile(out, *this, profile_list_names(terminalNames, nonterminalNames));
+}
+
+/// \brief Writes out the profile in the 'folded stacks' format, using the names from a grammar
+void parser_profile::write_folded(std::ostream& out, const contextfree::grammar& gram, const contextfree::terminal_dictionary& terminals) const {
+    write_profile(out, *this, profile_grammar_names(gram, terminals));
+}
+
+/// \brief The profile that profiling_parser_trace adds to on the calling thread
+parser_profile& parser_profile::current() {
+    static TAMEPARSE_THREAD_LOCAL parser_profile profile;
+    return profile;
+}
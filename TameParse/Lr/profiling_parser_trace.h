@@ -0,0 +1,249 @@
+//
+//  profiling_parser_trace.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _LR_PROFILING_PARSER_TRACE_H
+#define _LR_PROFILING_PARSER_TRACE_H
+
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include "TameParse/Util/stopwatch.h"
+#include "TameParse/ContextFree/grammar.h"
+#include "TameParse/ContextFree/terminal_dictionary.h"
+#include "TameParse/Lr/parser.h"
+
+namespace lr {
+    ///
+    /// \brief Where the time was spent by parsers that use profiling_parser_trace
+    ///
+    /// The profile keeps a copy of the parser stack where every entry is a tree of frames. Time spent reading lexemes,
+    /// checking guards and in the parser itself is kept in a pending frame until the next symbol is shifted, at which
+    /// point it becomes part of the frame for that terminal. When a rule is reduced, the frames for its symbols become
+    /// the children of a frame for the nonterminal, and the time spent in the reduce action is added to that frame.
+    /// Children with the same label are merged, so the tree grows with the number of distinct paths rather than with
+    /// the length of the input.
+    ///
+    /// Lookahead that is read while checking a guard is charged to the symbol that was being parsed when it was read,
+    /// rather than the symbol that it eventually becomes. As with parser_counters, every parser on a thread adds to the
+    /// same profile (see current()), so it is only meaningful when one non-GLR parser is running at a time.
+    ///
+    class parser_profile {
+    public:
+        /// \brief The kinds of frame that can appear in a profile
+        enum frame_kind {
+            /// \brief A nonterminal that was reduced (the symbol is the nonterminal ID)
+            nonterminal_frame,
+            
+            /// \brief A terminal that was shifted (the symbol is the terminal ID)
+            terminal_frame,
+            
+            /// \brief Time spent reading lexemes
+            lexer_frame,
+            
+            /// \brief Time spent checking a guard (the symbol is the initial state of the guard)
+            guard_frame,
+            
+            /// \brief Time spent in the parser that isn't accounted for by anything else
+            parser_frame
+        };
+        
+        ///
+        /// \brief A node in the profile tree
+        ///
+        class frame {
+        public:
+            /// \brief The frames contained by this one
+            typedef std::vector<frame*> frame_list;
+            
+            /// \brief What this frame represents
+            frame_kind kind;
+            
+            /// \brief The symbol or state that this frame represents (-1 for frames without one)
+            int symbol;
+            
+            /// \brief The time spent in this frame, excluding its children, in seconds
+            double selfTime;
+            
+            /// \brief The children of this frame (owned by this object)
+            frame_list children;
+        
+        private:
+            frame(const frame& noCopying);
+            frame& operator=(const frame& noCopying);
+        
+        public:
+            /// \brief Creates a frame with no time recorded against it
+            frame(frame_kind kind, int symbol);
+            
+            /// \brief Destroys this frame and its children
+            ~frame();
+            
+            /// \brief Finds the child with the specified kind and symbol, creating it if it doesn't exist yet
+            frame* child(frame_kind kind, int symbol);
+            
+            /// \brief Adds a frame as a child of this one, merging it with an existing child with the same label
+            ///
+            /// The frame is owned by this object afterwards (and is deleted if it is merged)
+            void adopt(frame* newChild);
+            
+            /// \brief The time spent in this frame and its children, in seconds
+            double total_time() const;
+        };
+    
+    private:
+        /// \brief Something that time is currently being charged to
+        struct activity {
+            frame_kind  kind;
+            int         symbol;
+        };
+        
+        /// \brief Measures the time since the profile was reset
+        util::stopwatch m_Clock;
+        
+        /// \brief The time on m_Clock when time was last charged to an activity
+        double m_LastTime;
+        
+        /// \brief The nested activities that are in progress (the last one is the one being timed)
+        std::vector<activity> m_Activities;
+        
+        /// \brief Time that will be charged to the next symbol to be shifted
+        frame* m_Pending;
+        
+        /// \brief The frames for each entry on the parser stack
+        frame::frame_list m_Stack;
+        
+        /// \brief The number of symbols in the rule that is being reduced
+        int m_ReduceLength;
+        
+        /// \brief The time spent in the action for the rule that is being reduced
+        double m_ReduceTime;
+    
+    private:
+        parser_profile(const parser_profile& noCopying);
+        parser_profile& operator=(const parser_profile& noCopying);
+        
+        /// \brief Adds the time since the last call to the current activity
+        void charge();
+    
+    public:
+        /// \brief Creates an empty profile
+        parser_profile();
+        
+        /// \brief Destructor
+        ~parser_profile();
+        
+        /// \brief Throws away the profile and starts timing from now
+        void reset();
+        
+        /// \brief Starts charging time to a new activity (until end_activity() is called)
+        void begin_activity(frame_kind kind, int symbol);
+        
+        /// \brief Goes back to charging time to the activity that was running before the last begin_activity()
+        void end_activity();
+        
+        /// \brief A terminal symbol has been shifted
+        void shifted(int terminal);
+        
+        /// \brief A reduction of a rule with the specified length has started
+        void reducing(int length);
+        
+        /// \brief The reduction that was started by the last call to reducing() has finished
+        void reduced(int nonterminal);
+        
+        /// \brief The frames for each entry on the parser stack (the last entry is the top of the stack)
+        inline const frame::frame_list& stack() const { return m_Stack; }
+        
+        /// \brief The time that hasn't been charged to a symbol yet
+        inline const frame& pending() const { return *m_Pending; }
+        
+        /// \brief The total time recorded in this profile, in seconds
+        double total_time() const;
+        
+        ///
+        /// \brief Writes out the profile in the 'folded stacks' format read by flame graph tools
+        ///
+        /// Each line contains the labels of a path through the profile separated by semicolons, followed by the number
+        /// of microseconds spent in the last frame on the path. Symbols without a name are written as 'terminal-N' or
+        /// 'nonterminal-N'.
+        ///
+        void write_folded(std::ostream& out, const std::vector<std::wstring>& terminalNames, const std::vector<std::wstring>& nonterminalNames) const;
+        
+        /// \brief Writes out the profile in the 'folded stacks' format, using the names from a grammar
+        void write_folded(std::ostream& out, const contextfree::grammar& gram, const contextfree::terminal_dictionary& terminals) const;
+        
+        /// \brief The profile that profiling_parser_trace adds to on the calling thread
+        static parser_profile& current();
+    };
+    
+    ///
+    /// \brief Parser trace class that profiles where the parser spends its time
+    ///
+    /// Use this as the parser_trace parameter of the parser template to find out which nonterminals take the most time
+    /// to lex, check guards for and reduce. The time is added to parser_profile::current(), which can be written out
+    /// for a flame graph tool once the parse has finished. This is an instrumenting profiler: it reads the clock on
+    /// every shift, reduce, guard and lexeme, so it slows the parser down noticeably.
+    ///
+    class profiling_parser_trace : public no_parser_trace {
+    private:
+        /// \brief The profile to update
+        parser_profile* m_Profile;
+    
+    public:
+        inline profiling_parser_trace()
+        : m_Profile(&parser_profile::current()) {
+        }
+        
+        inline void shift(const lexeme_container& lookahead, int newState) {
+            m_Profile->shifted(lookahead->matched());
+        }
+        
+        inline void reduce(int nonterminalId, int ruleId, int length) {
+            m_Profile->reducing(length);
+        }
+        
+        inline void reduced(int nonterminalId, int ruleId) {
+            m_Profile->reduced(nonterminalId);
+        }
+        
+        inline void reading_lexeme() {
+            m_Profile->begin_activity(parser_profile::lexer_frame, -1);
+        }
+        
+        inline void read_lexeme(const lexeme* nextLexeme) {
+            m_Profile->end_activity();
+        }
+        
+        inline void checking_guard(int initialState) {
+            m_Profile->begin_activity(parser_profile::guard_frame, initialState);
+        }
+        
+        inline void checked_guard(int initialState, int result) {
+            m_Profile->end_activity();
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,126 @@
+//
+//  replicated_language.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include "TameParse/Lr/replicated_language.h"
+#include "TameParse/Util/placed_memory.h"
+
+#if __cplusplus >= 201103L
+#include <atomic>
+#include <thread>
+#endif
+
+using namespace std;
+using namespace lr;
+
+/// \brief Loads a language from a binary lexer and binary parser tables
+replicated_language::replicated_language(const void* lexerData, size_t lexerSize, const void* tablesData, size_t tablesSize, bool hugePages, bool perNode) {
+    int numNodes = perNode ? util::count_numa_nodes() : 1;
+    
+    for (int node = 0; node < numNodes; ++node) {
+        // A single copy isn't tied to any particular node
+        compiled_language* replica = compiled_language::from_binary(lexerData, lexerSize, tablesData, tablesSize, hugePages, numNodes > 1 ? node : -1);
+        
+        if (!replica) {
+            // The data is the same for every node, so if one copy fails they all will
+            for (vector<compiled_language*>::iterator loaded = m_Replicas.begin(); loaded != m_Replicas.end(); ++loaded) {
+                delete *loaded;
+            }
+            m_Replicas.clear();
+            return;
+        }
+        
+        m_Replicas.push_back(replica);
+    }
+}
+
+/// \brief Destructor
+replicated_language::~replicated_language() {
+    for (vector<compiled_language*>::iterator replica = m_Replicas.begin(); replica != m_Replicas.end(); ++replica) {
+        delete *replica;
+    }
+}
+
+/// \brief The copy of the language in the memory closest to the calling thread
+const compiled_language& replicated_language::local() const {
+    if (m_Replicas.size() == 1) return *m_Replicas[0];
+    
+    int node = util::current_numa_node();
+    if (node < 0 || node >= (int) m_Replicas.size()) node = 0;
+    
+    return *m_Replicas[(size_t) node];
+}
+
+#if __cplusplus >= 201103L
+
+/// \brief Parses files from a result list with the local replica until there are none left
+static void parse_local_worker(const replicated_language* language, compiled_language::result_list* results, atomic<size_t>* nextFile, int initialState) {
+    for (;;) {
+        size_t fileIndex = (*nextFile)++;
+        if (fileIndex >= results->size()) return;
+        
+        // Look up the replica for each file, in case this thread has moved to a different node
+        language->local().parse_file((*results)[fileIndex], initialState);
+    }
+}
+
+#endif
+
+/// \brief Parses each of the specified files, using up to maxThreads threads
+void replicated_language::parse_files(const std::vector<std::string>& filenames, compiled_language::result_list& results, int initialState, unsigned int maxThreads) const {
+    // Each result is filled in by exactly one worker, so the list must not be resized while they're running
+    results.clear();
+    results.resize(filenames.size());
+    
+    for (size_t fileIndex = 0; fileIndex < filenames.size(); ++fileIndex) {
+        results[fileIndex].filename = filenames[fileIndex];
+    }
+
+#if __cplusplus >= 201103L
+    if (maxThreads == 0) maxThreads = thread::hardware_concurrency();
+    if (maxThreads > filenames.size()) maxThreads = (unsigned int) filenames.size();
+    
+    if (maxThreads > 1) {
+        atomic<size_t>  nextFile(0);
+        vector<thread>  workers;
+        
+        // As with compiled_language, the calling thread only waits, so the ASTs are all created on threads that have finished
+        for (unsigned int threadIndex = 0; threadIndex < maxThreads; ++threadIndex) {
+            workers.push_back(thread(parse_local_worker, this, &results, &nextFile, initialState));
+        }
+        
+        for (vector<thread>::iterator worker = workers.begin(); worker != workers.end(); ++worker) {
+            worker->join();
+        }
+        
+        return;
+    }
+#endif
+    
+    // Parse on this thread
+    const compiled_language& language = local();
+    for (compiled_language::result_list::iterator result = results.begin(); result != results.end(); ++result) {
+        language.parse_file(*result, initialState);
+    }
+}
@@ -0,0 +1,83 @@
+//
+//  replicated_language.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _LR_REPLICATED_LANGUAGE_H
+#define _LR_REPLICATED_LANGUAGE_H
+
+#include <string>
+#include <vector>
+
+#include "TameParse/Lr/compiled_language.h"
+
+namespace lr {
+    ///
+    /// \brief A compiled language loaded from binary tables, with a copy in the memory of each NUMA node
+    ///
+    /// When many threads parse with the same large tables, reading them from another node's memory (and missing in
+    /// the TLB) can take a noticeable share of the time. This keeps one copy of the lexer and the parser tables for
+    /// each node, optionally in huge pages, and each thread uses the copy for the node that it is running on.
+    ///
+    /// On machines with a single node, or when replication is turned off, there is just one copy.
+    ///
+    class replicated_language {
+    private:
+        /// \brief The copy of the language for each node (indexed by node ID)
+        std::vector<compiled_language*> m_Replicas;
+        
+        replicated_language(const replicated_language& copyFrom);
+        replicated_language& operator=(const replicated_language& copyFrom);
+    
+    public:
+        /// \brief Loads a language from a lexer written by binary_lexer::write_binary and tables written by
+        /// parser_tables::write_binary
+        ///
+        /// The data is copied into each replica, so the caller's buffers can be released once this returns. Check
+        /// is_valid() to find out if the data could be loaded.
+        replicated_language(const void* lexerData, size_t lexerSize, const void* tablesData, size_t tablesSize, bool hugePages = true, bool perNode = true);
+        
+        /// \brief Destructor
+        ~replicated_language();
+        
+        /// \brief True if the language was loaded successfully
+        inline bool is_valid() const { return !m_Replicas.empty(); }
+        
+        /// \brief The number of copies of the language
+        inline int count_replicas() const { return (int) m_Replicas.size(); }
+        
+        /// \brief The copy of the language for the specified node
+        inline const compiled_language& replica(int node) const { return *m_Replicas[(size_t) node]; }
+        
+        /// \brief The copy of the language in the memory closest to the calling thread
+        const compiled_language& local() const;
+        
+        /// \brief Parses each of the specified files, using up to maxThreads threads
+        ///
+        /// This works like compiled_language::parse_files, except that each file is parsed with the replica that is
+        /// local to the worker thread parsing it.
+        void parse_files(const std::vector<std::string>& filenames, compiled_language::result_list& results, int initialState = 0, unsigned int maxThreads = 0) const;
+    };
+}
+
+#endif
@@ -0,0 +1,364 @@
+//
+//  speculative_guard_stream.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#include <algorithm>
+
+#include "TameParse/Lr/speculative_guard_stream.h"
+
+using namespace std;
+using namespace dfa;
+using namespace lr;
+
+/// \brief Creates a stream that reads from the specified source stream and evaluates the guards in the specified tables
+speculative_guard_stream::speculative_guard_stream(lexeme_stream* source, const parser_tables* tables, int maxLookahead)
+: m_Source(source)
+, m_Guards(tables ? tables->compiled_guards() : NULL)
+, m_MaxLookahead(maxLookahead)
+, m_Started(false)
+, m_PendingBase(0)
+, m_Filling(NULL)
+, m_Current(NULL)
+, m_NextLexeme(0)
+, m_LastLexeme(NULL)
+, m_LastIndex(0)
+#if __cplusplus >= 201103L
+, m_Stop(false)
+#endif
+{
+    if (!m_Guards) return;
+    
+    // Find the compiled guards that a guard action on each terminal symbol can start
+    for (int stateId = 0; stateId < tables->count_states(); ++stateId) {
+        const parser_tables::action_count&  counts      = tables->action_counts()[stateId];
+        const parser_tables::action*        terminals   = tables->terminal_actions()[stateId];
+        
+        for (int actionId = 0; actionId < counts.numTerminals; ++actionId) {
+            const parser_tables::action& act = terminals[actionId];
+            if (act.type != lr_action::act_guard || m_Guards->start_state(act.nextState) < 0) continue;
+            
+            if ((size_t) act.symbolId >= m_GuardsForSymbol.size()) {
+                m_GuardsForSymbol.resize(act.symbolId + 1);
+            }
+            
+            vector<int>& guards = m_GuardsForSymbol[act.symbolId];
+            if (find(guards.begin(), guards.end(), (int) act.nextState) == guards.end()) {
+                guards.push_back(act.nextState);
+            }
+        }
+    }
+}
+
+/// \brief Destructor (stops the lexer thread)
+speculative_guard_stream::~speculative_guard_stream() {
+#if __cplusplus >= 201103L
+    if (m_Started) {
+        // Wait for the lexer thread to finish (it will stop once it next needs an empty batch)
+        m_Stop = true;
+        m_Thread.join();
+        
+        batch* unread;
+        while (m_Full.pop(unread)) {
+            for (size_t lexemeNum = 0; lexemeNum < unread->count; ++lexemeNum) {
+                delete unread->lexemes[lexemeNum];
+            }
+            delete unread;
+        }
+        
+        batch* empty;
+        while (m_Empty.pop(empty)) {
+            delete empty;
+        }
+    }
+#endif
+    
+    // Delete any lexemes that weren't read, and the batches
+    if (m_Current) {
+        for (size_t lexemeNum = m_NextLexeme; lexemeNum < m_Current->count; ++lexemeNum) {
+            delete m_Current->lexemes[lexemeNum];
+        }
+        delete m_Current;
+    }
+    
+    if (m_Filling) {
+        for (size_t lexemeNum = 0; lexemeNum < m_Filling->count; ++lexemeNum) {
+            delete m_Filling->lexemes[lexemeNum];
+        }
+        delete m_Filling;
+    }
+    
+    for (deque<pending_lexeme>::iterator pending = m_Pending.begin(); pending != m_Pending.end(); ++pending) {
+        delete pending->lexeme;
+    }
+    
+    delete m_Source;
+}
+
+/// \brief Moves a guard on by one lexeme (symbol is -1 at the end of the input), returning true once it has finished
+bool speculative_guard_stream::advance(guard_run& run, int symbol) {
+    // Leave guards that read too far ahead to the parser
+    if (run.length >= m_MaxLookahead) {
+        run.length = -1;
+        return true;
+    }
+    
+    // The same steps as parser::state::evaluate_compiled_guard
+    ++run.length;
+    run.dfaState = symbol >= 0 ? m_Guards->next_state(run.dfaState, symbol) : m_Guards->end_of_input_state(run.dfaState);
+    
+    return run.dfaState < 0 || m_Guards->accepted_guard(run.dfaState) >= 0;
+}
+
+/// \brief Reads the next lexeme from the source and works out the guards that it finishes or starts
+bool speculative_guard_stream::read_source() {
+    lexeme* lex = NULL;
+    (*m_Source) >> lex;
+    
+    int symbol = -1;
+    if (lex) {
+        symbol = lex->matched();
+        
+        pending_lexeme pending;
+        pending.lexeme  = lex;
+        pending.running = 0;
+        m_Pending.push_back(pending);
+        
+        // Start the guards that this symbol can begin (they read it along with the guards that are already running)
+        if (symbol >= 0 && (size_t) symbol < m_GuardsForSymbol.size()) {
+            const vector<int>&  guards  = m_GuardsForSymbol[symbol];
+            long                start   = m_PendingBase + (long) m_Pending.size() - 1;
+            
+            for (vector<int>::const_iterator guardState = guards.begin(); guardState != guards.end(); ++guardState) {
+                guard_run run;
+                run.start       = start;
+                run.guardState  = *guardState;
+                run.dfaState    = m_Guards->start_state(*guardState);
+                run.length      = 0;
+                
+                m_Running.push_back(run);
+                ++m_Pending.back().running;
+            }
+        }
+    }
+    
+    // Move the guards on, and record the ones that finish (at the end of the input, the guards carry on reading the
+    // end of input symbol until they finish, as they do in the parser)
+    for (size_t runNum = 0; runNum < m_Running.size(); ) {
+        guard_run&  run         = m_Running[runNum];
+        bool        finished    = m_Guards->accepted_guard(run.dfaState) >= 0;
+        
+        while (!finished) {
+            finished = advance(run, symbol);
+            if (lex) break;
+        }
+        
+        if (!finished) {
+            ++runNum;
+            continue;
+        }
+        
+        // Store the result with the lexeme where the guard started
+        pending_lexeme& pending = m_Pending[run.start - m_PendingBase];
+        --pending.running;
+        
+        if (run.length >= 0) {
+            guard_result result;
+            result.guardState   = run.guardState;
+            result.accepted     = run.dfaState >= 0 ? m_Guards->accepted_guard(run.dfaState) : -1;
+            result.length       = run.length;
+            pending.results.push_back(result);
+        }
+        
+        m_Running[runNum] = m_Running.back();
+        m_Running.pop_back();
+    }
+    
+    return lex != NULL;
+}
+
+/// \brief Moves the lexemes whose guards have all finished to m_Filling, returning false if the batch is full
+bool speculative_guard_stream::move_finished(bool endOfInput) {
+    while (!m_Pending.empty() && m_Filling->count < c_BatchSize) {
+        pending_lexeme& pending = m_Pending.front();
+        if (pending.running > 0) break;
+        
+        m_Filling->lexemes[m_Filling->count] = pending.lexeme;
+        m_Filling->results.insert(m_Filling->results.end(), pending.results.begin(), pending.results.end());
+        m_Filling->firstResult[++m_Filling->count] = m_Filling->results.size();
+        
+        m_Pending.pop_front();
+        ++m_PendingBase;
+    }
+    
+    if (endOfInput && m_Pending.empty()) {
+        m_Filling->last = true;
+    }
+    
+    return m_Filling->count < c_BatchSize && !m_Filling->last;
+}
+
+#if __cplusplus >= 201103L
+
+/// \brief Reads lexemes and evaluates guards into batches (runs on the lexer thread)
+void speculative_guard_stream::run_lexer() {
+    bool endOfInput = false;
+    
+    for (;;) {
+        // Wait for the reader to hand back a batch (this stops the lexer from getting too far ahead)
+        while (!m_Empty.pop(m_Filling)) {
+            if (m_Stop) return;
+            std::this_thread::yield();
+        }
+        
+        if (m_Stop) {
+            m_Empty.push(m_Filling);
+            m_Filling = NULL;
+            return;
+        }
+        
+        // Fill it up: a lexeme can only be passed on once all of the guards that start at it have finished
+        m_Filling->count            = 0;
+        m_Filling->last             = false;
+        m_Filling->firstResult[0]   = 0;
+        m_Filling->results.clear();
+        
+        while (move_finished(endOfInput)) {
+            if (!read_source()) endOfInput = true;
+        }
+        
+        // Pass it to the reader (there is always space, as there are only c_NumBatches batches)
+        batch* next     = m_Filling;
+        bool   isLast   = next->last;
+        m_Filling       = NULL;
+        m_Full.push(next);
+        
+        if (isLast) return;
+    }
+}
+
+#endif
+
+/// \brief Fills in the contents of the specified pointer with the next lexeme (or NULL if the end of input has been reached)
+lexeme_stream& speculative_guard_stream::operator>>(lexeme*& result) {
+    if (!m_Started) {
+        m_Started = true;
+        
+#if __cplusplus >= 201103L
+        // Create the batches and start the lexer thread
+        for (size_t batchNum = 0; batchNum < c_NumBatches; ++batchNum) {
+            m_Empty.push(new batch());
+        }
+        
+        m_Thread = std::thread(&speculative_guard_stream::run_lexer, this);
+#endif
+    }
+    
+    for (;;) {
+        // Return the next lexeme from the current batch
+        if (m_Current) {
+            if (m_NextLexeme < m_Current->count) {
+                m_LastIndex     = m_NextLexeme;
+                m_LastLexeme    = result = m_Current->lexemes[m_NextLexeme++];
+                return *this;
+            }
+            
+            if (m_Current->last) {
+                m_LastLexeme = result = NULL;
+                return *this;
+            }
+            
+#if __cplusplus >= 201103L
+            // Hand the batch back to the lexer thread
+            m_Empty.push(m_Current);
+            m_Current = NULL;
+#endif
+        }
+        
+#if __cplusplus >= 201103L
+        // Wait for the next batch
+        while (!m_Full.pop(m_Current)) {
+            std::this_thread::yield();
+        }
+#else
+        // Without threads, fill the batch on this thread
+        if (!m_Current) m_Current = new batch();
+        
+        m_Filling                   = m_Current;
+        m_Filling->count            = 0;
+        m_Filling->last             = false;
+        m_Filling->firstResult[0]   = 0;
+        m_Filling->results.clear();
+        
+        bool endOfInput = false;
+        while (move_finished(endOfInput)) {
+            if (!read_source()) endOfInput = true;
+        }
+        m_Filling = NULL;
+#endif
+        m_NextLexeme    = 0;
+        m_LastLexeme    = NULL;
+    }
+}
+
+/// \brief Finds the guard results for the lexeme that was returned most recently
+bool speculative_guard_stream::results_for(const lexeme* lex, const guard_result*& first, const guard_result*& last) const {
+    if (!lex || lex != m_LastLexeme) return false;
+    
+    const guard_result* results = m_Current->results.empty() ? NULL : &m_Current->results[0];
+    first   = results + m_Current->firstResult[m_LastIndex];
+    last    = results + m_Current->firstResult[m_LastIndex + 1];
+    return true;
+}
+
+/// \brief Sets the initial state of the source stream, if no lexemes have been read yet
+void speculative_guard_stream::set_initial_state(int initialState) {
+    if (!m_Started) {
+        m_Source->set_initial_state(initialState);
+    }
+}
+
+/// \brief Retrieves a checkpoint from the source stream, if no lexemes have been read yet
+bool speculative_guard_stream::checkpoint(lexer_checkpoint& result) const {
+    if (m_Started) return false;
+    return m_Source->checkpoint(result);
+}
+
+/// \brief Asks the source stream to skip symbols, if no lexemes have been read yet
+bool speculative_guard_stream::skip_symbols(const bool* skip, int numSymbols) {
+    if (m_Started) return false;
+    return m_Source->skip_symbols(skip, numSymbols);
+}
+
+/// \brief Switches the source stream into a different lexer mode, if no lexemes have been read yet
+bool speculative_guard_stream::set_mode(int mode) {
+    if (m_Started) return false;
+    return m_Source->set_mode(mode);
+}
+
+/// \brief Limits the length of the lexemes matched by the source stream, if no lexemes have been read yet
+bool speculative_guard_stream::set_max_lexeme_length(int maxLength) {
+    if (m_Started) return false;
+    return m_Source->set_max_lexeme_length(maxLength);
+}
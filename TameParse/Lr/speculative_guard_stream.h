@@ -0,0 +1,233 @@
+//
+//  speculative_guard_stream.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _LR_SPECULATIVE_GUARD_STREAM_H
+#define _LR_SPECULATIVE_GUARD_STREAM_H
+
+#include <deque>
+#include <vector>
+
+#include "TameParse/Dfa/basic_lexer.h"
+#include "TameParse/Lr/parser_tables.h"
+#include "TameParse/Util/spsc_queue.h"
+
+#if __cplusplus >= 201103L
+#include <atomic>
+#include <thread>
+#endif
+
+namespace lr {
+    ///
+    /// \brief Lexeme stream that evaluates guards on a separate thread as the lexemes are read
+    ///
+    /// This works like dfa::pipelined_lexeme_stream: the source stream is read on a separate thread, and the lexemes
+    /// are passed to the reader in batches. Before a lexeme is passed on, the lexer thread also runs every compiled
+    /// guard (see guard_dfa) that a guard action on its symbol could start, reading as much of the following input as
+    /// each guard needs. A parser that has been told about this stream (see parser::state::set_guard_speculator())
+    /// stores these results in its guard cache as it reads each lexeme, so when it reaches a guard action it only has
+    /// to look the result up.
+    ///
+    /// Compiled guards only depend on the symbols that follow them, so the results are the same as those the parser
+    /// would work out for itself. Guards that aren't compiled, and guards that need more than maxLookahead lexemes,
+    /// are still evaluated by the parser in the usual way. As with the pipelined stream, the lexer runs ahead of the
+    /// parser, so parsers that switch lexer modes or restrict the symbols the lexer can match can't use this stream.
+    /// Without C++11 thread support, the guards are evaluated on the calling thread as the lexemes are read.
+    ///
+    class speculative_guard_stream : public dfa::lexeme_stream {
+    public:
+        /// \brief The result of evaluating a guard against the input that starts at a lexeme
+        struct guard_result {
+            /// \brief The parser state where the guard begins
+            int guardState;
+            
+            /// \brief The guard symbol that was accepted, or -1 if the guard was rejected
+            int accepted;
+            
+            /// \brief The number of lexemes that the guard read
+            int length;
+        };
+        
+        /// \brief The number of lexemes passed between the threads at a time
+        static const size_t c_BatchSize = 128;
+        
+        /// \brief The number of batches that can be in use at once
+        static const size_t c_NumBatches = 15;
+        
+        /// \brief The default for the largest number of lexemes that a guard can read before it is left to the parser
+        static const int c_DefaultMaxLookahead = 256;
+        
+    private:
+        /// \brief A batch of lexemes, and the guard results for each of them
+        struct batch {
+            /// \brief The lexemes in this batch
+            dfa::lexeme* lexemes[c_BatchSize];
+            
+            /// \brief The index in results of the first result for each lexeme (with an extra entry at the end)
+            size_t firstResult[c_BatchSize + 1];
+            
+            /// \brief The guard results for the lexemes in this batch
+            std::vector<guard_result> results;
+            
+            /// \brief The number of lexemes in this batch
+            size_t count;
+            
+            /// \brief True if the source stream reached the end of the input after the lexemes in this batch
+            bool last;
+        };
+        
+        /// \brief A lexeme whose guards are still being evaluated (used on the lexer thread)
+        struct pending_lexeme {
+            /// \brief The lexeme
+            dfa::lexeme* lexeme;
+            
+            /// \brief The results of the guards that have finished
+            std::vector<guard_result> results;
+            
+            /// \brief The number of guards starting at this lexeme that are still reading input
+            int running;
+        };
+        
+        /// \brief A compiled guard that is being run against the input (used on the lexer thread)
+        struct guard_run {
+            /// \brief The number of lexemes read by the lexer thread before the one where the guard starts
+            long start;
+            
+            /// \brief The parser state where the guard begins
+            int guardState;
+            
+            /// \brief The current DFA state
+            int dfaState;
+            
+            /// \brief The number of lexemes read so far
+            int length;
+        };
+        
+        /// \brief The stream that the lexemes are read from
+        dfa::lexeme_stream* m_Source;
+        
+        /// \brief The guards that were compiled for the parser tables
+        const guard_dfa* m_Guards;
+        
+        /// \brief The guard states of the compiled guards that can start on each terminal symbol
+        std::vector<std::vector<int> > m_GuardsForSymbol;
+        
+        /// \brief The largest number of lexemes that a guard can read before it is left to the parser
+        int m_MaxLookahead;
+        
+        /// \brief True once the first lexeme has been read
+        bool m_Started;
+        
+        /// \brief The lexemes whose guards are still being evaluated (lexer thread only)
+        std::deque<pending_lexeme> m_Pending;
+        
+        /// \brief The number of lexemes that have left m_Pending (lexer thread only)
+        long m_PendingBase;
+        
+        /// \brief The guards that are still reading input (lexer thread only)
+        std::vector<guard_run> m_Running;
+        
+        /// \brief The batch that the lexer thread is filling
+        batch* m_Filling;
+        
+        /// \brief The batch that is being read
+        batch* m_Current;
+        
+        /// \brief The index of the next lexeme to return from m_Current
+        size_t m_NextLexeme;
+        
+        /// \brief The lexeme that was returned most recently, or NULL
+        dfa::lexeme* m_LastLexeme;
+        
+        /// \brief The index in m_Current of the lexeme that was returned most recently
+        size_t m_LastIndex;
+        
+#if __cplusplus >= 201103L
+        /// \brief The batches that have been filled by the lexer thread
+        util::spsc_queue<batch*, c_NumBatches + 1> m_Full;
+        
+        /// \brief The batches that the reader has finished with
+        util::spsc_queue<batch*, c_NumBatches + 1> m_Empty;
+        
+        /// \brief Set to tell the lexer thread to stop early
+        std::atomic<bool> m_Stop;
+        
+        /// \brief The lexer thread
+        std::thread m_Thread;
+        
+        /// \brief Reads lexemes and evaluates guards into batches (runs on the lexer thread)
+        void run_lexer();
+#endif
+        
+        /// \brief Reads the next lexeme from the source and works out the guards that it finishes or starts
+        ///
+        /// Returns false once the end of the input has been reached.
+        bool read_source();
+        
+        /// \brief Moves a guard on by one lexeme (symbol is -1 at the end of the input), returning true once it has finished
+        bool advance(guard_run& run, int symbol);
+        
+        /// \brief Moves the lexemes whose guards have all finished to m_Filling, returning false if the batch is full
+        bool move_finished(bool endOfInput);
+        
+        speculative_guard_stream(const speculative_guard_stream& noCopying);
+        speculative_guard_stream& operator=(const speculative_guard_stream& noCopying);
+        
+    public:
+        /// \brief Creates a stream that reads from the specified source stream and evaluates the guards in the specified tables
+        ///
+        /// The source stream becomes owned by this object, and is deleted when it is. The tables must outlive this
+        /// object. If the tables don't have any compiled guards, then this only pipelines the lexer.
+        speculative_guard_stream(dfa::lexeme_stream* source, const parser_tables* tables, int maxLookahead = c_DefaultMaxLookahead);
+        
+        /// \brief Destructor (stops the lexer thread)
+        virtual ~speculative_guard_stream();
+        
+        /// \brief Fills in the contents of the specified pointer with the next lexeme (or NULL if the end of input has been reached)
+        virtual dfa::lexeme_stream& operator>>(dfa::lexeme*& result);
+        
+        /// \brief Finds the guard results for the lexeme that was returned most recently
+        ///
+        /// Returns false if lex is not that lexeme. The results are only valid until the next lexeme is read.
+        bool results_for(const dfa::lexeme* lex, const guard_result*& first, const guard_result*& last) const;
+        
+        /// \brief Sets the initial state of the source stream, if no lexemes have been read yet
+        virtual void set_initial_state(int initialState);
+        
+        /// \brief Retrieves a checkpoint from the source stream, if no lexemes have been read yet
+        virtual bool checkpoint(dfa::lexer_checkpoint& result) const;
+        
+        /// \brief Asks the source stream to skip symbols, if no lexemes have been read yet
+        virtual bool skip_symbols(const bool* skip, int numSymbols);
+        
+        /// \brief Switches the source stream into a different lexer mode, if no lexemes have been read yet
+        virtual bool set_mode(int mode);
+        
+        /// \brief Limits the length of the lexemes matched by the source stream, if no lexemes have been read yet
+        virtual bool set_max_lexeme_length(int maxLength);
+    };
+}
+
+#endif
@@ -0,0 +1,194 @@
+//
+//  syntax_tape.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#include "TameParse/Lr/syntax_tape.h"
+
+using namespace std;
+using namespace dfa;
+using namespace lr;
+
+template class lr::parser<int, tape_parser_actions>;
+template class lr::parser<int, tape_parser_actions, no_parser_trace, small_parser_tables>::state;
+template class lr::parser<int, tape_parser_actions, no_parser_trace, small_parser_tables>::session;
+
+/// \brief Appends a terminal record to this tape, returning its index
+int syntax_tape::add_terminal(const lexeme_container& lexeme) {
+    record newRecord;
+    
+    newRecord.symbol    = lexeme->matched();
+    newRecord.rule      = -1;
+    newRecord.first     = (int) m_Lexemes.size();
+    newRecord.count     = 0;
+    newRecord.lookahead = lexeme->pos();
+    
+    m_Lexemes.push_back(lexeme);
+    m_Records.push_back(newRecord);
+    
+    return (int) m_Records.size() - 1;
+}
+
+/// \brief Appends a nonterminal record to this tape, returning its index
+int syntax_tape::add_nonterminal(int nonterminal, int rule, const vector<int>& children, const position& lookahead) {
+    record newRecord;
+    
+    newRecord.symbol    = nonterminal;
+    newRecord.rule      = rule;
+    newRecord.count     = (int) children.size();
+    newRecord.lookahead = lookahead;
+    
+    if (children.size() == 1) {
+        // Unit rules refer straight to their child
+        newRecord.first = children[0];
+    } else {
+        // Other rules store their children in order (the list we're passed is reversed)
+        newRecord.first = (int) m_Children.size();
+        m_Children.insert(m_Children.end(), children.rbegin(), children.rend());
+    }
+    
+    m_Records.push_back(newRecord);
+    
+    return (int) m_Records.size() - 1;
+}
+
+/// \brief Removes all of the records from this tape
+void syntax_tape::clear() {
+    m_Records.clear();
+    m_Children.clear();
+    m_Lexemes.clear();
+}
+
+/// \brief Reserves space for the specified number of records
+void syntax_tape::reserve(int records) {
+    m_Records.reserve((size_t) records);
+    m_Children.reserve((size_t) records);
+    m_Lexemes.reserve((size_t) records);
+}
+
+/// \brief Identifies tapes written by write() (the last byte is the version of the format)
+///
+/// Version 2 stores positions as 64-bit values: tapes written with version 1 can't be read back.
+static const int c_TapeFormat = 0x54535402;
+
+/// \brief Writes this tape to a binary stream, including the content and position of its lexemes
+void syntax_tape::write(ostream& target) const {
+    int header[4] = { c_TapeFormat, (int) m_Records.size(), (int) m_Children.size(), (int) m_Lexemes.size() };
+    target.write((const char*) header, sizeof(header));
+    
+    for (vector<record>::const_iterator rec = m_Records.begin(); rec != m_Records.end(); ++rec) {
+        int             fields[4]   = { rec->symbol, rec->rule, rec->first, rec->count };
+        stream_offset   where[3]    = { rec->lookahead.offset(), rec->lookahead.line(), rec->lookahead.column() };
+        target.write((const char*) fields, sizeof(fields));
+        target.write((const char*) where, sizeof(where));
+    }
+    
+    if (!m_Children.empty()) {
+        target.write((const char*) &m_Children[0], m_Children.size() * sizeof(int));
+    }
+    
+    for (vector<lexeme_container>::const_iterator lex = m_Lexemes.begin(); lex != m_Lexemes.end(); ++lex) {
+        (*lex)->write(target);
+    }
+}
+
+/// \brief Replaces this tape with one that was written by write(), returning false if the stream is invalid
+bool syntax_tape::read(istream& source) {
+    clear();
+    
+    int header[4];
+    source.read((char*) header, sizeof(header));
+    if (!source.good() || header[0] != c_TapeFormat) return false;
+    
+    const int* counts = header + 1;
+    if (counts[0] < 0 || counts[1] < 0 || counts[2] < 0) return false;
+    
+    // Read the records
+    m_Records.reserve((size_t) counts[0]);
+    for (int recordNum = 0; recordNum < counts[0]; ++recordNum) {
+        int             fields[4];
+        stream_offset   where[3];
+        source.read((char*) fields, sizeof(fields));
+        source.read((char*) where, sizeof(where));
+        if (!source.good()) {
+            clear();
+            return false;
+        }
+        
+        record newRecord;
+        newRecord.symbol    = fields[0];
+        newRecord.rule      = fields[1];
+        newRecord.first     = fields[2];
+        newRecord.count     = fields[3];
+        newRecord.lookahead = position(where[0], where[1], where[2]);
+        
+        m_Records.push_back(newRecord);
+    }
+    
+    // ... the lists of children
+    m_Children.resize((size_t) counts[1]);
+    if (counts[1] > 0) {
+        source.read((char*) &m_Children[0], counts[1] * sizeof(int));
+        if (source.fail()) {
+            clear();
+            return false;
+        }
+    }
+    
+    // ... and the lexemes
+    m_Lexemes.reserve((size_t) counts[2]);
+    for (int lexemeNum = 0; lexemeNum < counts[2]; ++lexemeNum) {
+        dfa::lexeme* newLexeme = dfa::lexeme::read(source);
+        if (!newLexeme) {
+            clear();
+            return false;
+        }
+        
+        m_Lexemes.push_back(lexeme_container(newLexeme, true));
+    }
+    
+    // Records can only refer to records before them, so a tape that's been read can be walked safely
+    for (int recordNum = 0; recordNum < counts[0]; ++recordNum) {
+        const record& rec = m_Records[recordNum];
+        bool valid;
+        
+        if (rec.rule < 0) {
+            valid = rec.first >= 0 && rec.first < counts[2];
+        } else if (rec.count == 1) {
+            valid = rec.first >= 0 && rec.first < recordNum;
+        } else {
+            valid = rec.count >= 0 && rec.first >= 0 && rec.first <= counts[1] - rec.count;
+            for (int child = 0; valid && child < rec.count; ++child) {
+                valid = m_Children[rec.first + child] >= 0 && m_Children[rec.first + child] < recordNum;
+            }
+        }
+        
+        if (!valid) {
+            clear();
+            return false;
+        }
+    }
+    
+    return true;
+}
@@ -0,0 +1,497 @@
+//
+//  syntax_tape.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _LR_SYNTAX_TAPE_H
+#define _LR_SYNTAX_TAPE_H
+
+#include <algorithm>
+#include <vector>
+#include <iostream>
+
+#include "TameParse/Dfa/lexer.h"
+#include "TameParse/Lr/parser.h"
+#include "TameParse/Lr/compact_parser_tables.h"
+#include "TameParse/Util/parallel.h"
+
+namespace lr {
+    ///
+    /// \brief A flat record of the shift and reduce actions performed by a parser
+    ///
+    /// This is an alternative to building an AST while parsing. Each terminal and each reduction is appended to the
+    /// tape as a small fixed-size record, and nonterminal records refer to their children by index. Nothing is
+    /// allocated per node, so the cost of a parse is mostly independent of the shape of the grammar.
+    ///
+    /// Rules with a single symbol (such as the links in a precedence chain of expressions) refer straight to their
+    /// child record, and don't need an entry in the list of children. skip_units() can be used to step over these
+    /// when walking the tape.
+    ///
+    class syntax_tape {
+    private:
+        /// \brief A terminal or nonterminal symbol on the tape
+        struct record {
+            /// \brief The identifier of the terminal or nonterminal symbol
+            int symbol;
+            
+            /// \brief The rule that was reduced, or -1 for a terminal
+            int rule;
+            
+            /// \brief For terminals, the index of the lexeme. For unit rules, the index of the child record. Otherwise
+            /// the index of the first child in the list of children
+            int first;
+            
+            /// \brief The number of children of this record
+            int count;
+            
+            /// \brief The position of the lookahead symbol when this record was added
+            dfa::position lookahead;
+        };
+        
+        /// \brief The records on this tape, in the order they were added
+        std::vector<record> m_Records;
+        
+        /// \brief The children of records that have more than one child
+        std::vector<int> m_Children;
+        
+        /// \brief The lexemes for the terminal records
+        std::vector<dfa::lexeme_container> m_Lexemes;
+        
+    public:
+        /// \brief Appends a terminal record to this tape, returning its index
+        int add_terminal(const dfa::lexeme_container& lexeme);
+        
+        /// \brief Appends a nonterminal record to this tape, returning its index
+        ///
+        /// The children are in reverse order, as they are in the reduce list passed to parser actions.
+        int add_nonterminal(int nonterminal, int rule, const std::vector<int>& children, const dfa::position& lookahead);
+        
+        /// \brief Removes all of the records from this tape
+        void clear();
+        
+        /// \brief Reserves space for the specified number of records
+        ///
+        /// Every record is the child of at most one other record, so this is enough to add this many records without
+        /// allocating any more memory (for example, when used with a parser from create_bounded_parser()).
+        void reserve(int records);
+        
+        /// \brief Writes this tape to a binary stream, including the content and position of its lexemes
+        ///
+        /// The tape is written in the native byte order, so it should be read back on the same kind of machine. When
+        /// the tape was written by a parser, the root of the tree is the last record.
+        void write(std::ostream& target) const;
+        
+        /// \brief Replaces this tape with one that was written by write(), returning false if the stream is invalid
+        bool read(std::istream& source);
+        
+    public:
+        /// \brief The number of records on this tape
+        inline int size() const { return (int) m_Records.size(); }
+        
+        /// \brief True if the specified record is a terminal
+        inline bool is_terminal(int record) const { return m_Records[record].rule < 0; }
+        
+        /// \brief The terminal or nonterminal symbol for the specified record
+        inline int symbol(int record) const { return m_Records[record].symbol; }
+        
+        /// \brief The rule reduced for the specified record, or -1 if it is a terminal
+        inline int rule(int record) const { return m_Records[record].rule; }
+        
+        /// \brief The lookahead position when the specified record was added
+        inline const dfa::position& lookahead(int record) const { return m_Records[record].lookahead; }
+        
+        /// \brief The lexeme for a terminal record
+        inline const dfa::lexeme_container& lexeme(int record) const { return m_Lexemes[m_Records[record].first]; }
+        
+        /// \brief The number of children of the specified record
+        inline int child_count(int record) const { return m_Records[record].count; }
+        
+        /// \brief The record for a child of the specified record (children are in the same order as they are in the rule)
+        inline int child(int record, int index) const {
+            const struct record& parent = m_Records[record];
+            if (parent.count == 1) return parent.first;
+            return m_Children[parent.first + index];
+        }
+        
+        /// \brief Follows any rules with a single symbol from the specified record, and returns the first record that isn't one
+        inline int skip_units(int record) const {
+            while (m_Records[record].rule >= 0 && m_Records[record].count == 1) {
+                record = m_Records[record].first;
+            }
+            return record;
+        }
+        
+        /// \brief The first record of the subtree for the specified record
+        ///
+        /// A parser adds the records for a subtree one after another, so on a tape written by a parser the subtree runs
+        /// from this record to the specified one. (Tapes written by a parser that recovered from errors can also have
+        /// records in this range that aren't part of the subtree.)
+        inline int subtree_start(int record) const {
+            while (m_Records[record].rule >= 0 && m_Records[record].count > 0) {
+                record = child(record, 0);
+            }
+            return record;
+        }
+    };
+    
+    ///
+    /// \brief Parser actions that write to a syntax tape instead of building an AST
+    ///
+    /// Each symbol on the parser stack is the index of its record on the tape: once a parse has been accepted, the
+    /// parser's item is the record for the root of the tree.
+    ///
+    class tape_parser_actions {
+    public:
+        /// \brief Type of a lexeme stream
+        typedef dfa::lexeme_stream lexeme_stream;
+        
+        /// \brief Type of a parser that uses these actions
+        typedef parser<int, tape_parser_actions> tape_parser;
+        
+        /// \brief Type of a list of reduced symbols
+        typedef tape_parser::reduce_list reduce_list;
+        
+    private:
+        /// \brief The stream of lexemes that this actions object will read from
+        lexeme_stream* m_Stream;
+        
+        /// \brief True if the stream should be deleted along with this object
+        bool m_OwnStream;
+        
+        /// \brief The tape that the actions are written to (not owned by this object)
+        syntax_tape* m_Tape;
+        
+        tape_parser_actions(const tape_parser_actions& copyFrom);
+        tape_parser_actions& operator=(tape_parser_actions& copyFrom);
+        
+    public:
+        /// \brief Creates a new actions object that will read from the specified stream and write to the specified tape
+        ///
+        /// The tape must remain valid for as long as the parser session does.
+        tape_parser_actions(lexeme_stream* stream, syntax_tape* tape, bool ownStream = true)
+        : m_Stream(stream)
+        , m_OwnStream(ownStream)
+        , m_Tape(tape) {
+        }
+        
+        /// \brief Destroys an existing actions object
+        ~tape_parser_actions() {
+            if (m_OwnStream) {
+                delete m_Stream;
+            }
+        }
+        
+        /// \brief Reads the next symbol from the stream
+        inline dfa::lexeme* read() {
+            dfa::lexeme* result = NULL;
+            (*m_Stream) >> result;
+            return result;
+        }
+        
+        /// \brief Adds a terminal to the tape
+        inline int shift(const dfa::lexeme_container& lexeme) {
+            return m_Tape->add_terminal(lexeme);
+        }
+        
+        /// \brief Adds a reduction to the tape
+        inline int reduce(int nonterminal, int rule, const reduce_list& reduce, const dfa::position& lookaheadPosition) {
+            return m_Tape->add_nonterminal(nonterminal, rule, reduce, lookaheadPosition);
+        }
+    };
+    
+    /// \brief A parser that writes a syntax tape instead of building an AST
+    typedef tape_parser_actions::tape_parser tape_parser;
+    
+    ///
+    /// \brief Builds AST nodes from the records on a syntax tape on demand
+    ///
+    /// Nodes are built by replaying the shift and reduce actions for a subtree against an actions object of the kind
+    /// that would usually be passed to the parser, so the result is the same as if the AST had been built while
+    /// parsing. Only the subtrees that are asked for are built, and each node is only built once.
+    ///
+    template<typename node_type, typename actions_type> class lazy_syntax_tree {
+    public:
+        /// \brief The list of child nodes passed to the reduce action
+        typedef std::vector<node_type> reduce_list;
+        
+    private:
+        /// \brief The tape that the nodes are built from
+        const syntax_tape& m_Tape;
+        
+        /// \brief The actions used to build each node
+        actions_type& m_Actions;
+        
+        /// \brief The nodes that have been built so far, indexed by record
+        std::vector<node_type> m_Nodes;
+        
+        /// \brief True for the records that have been built
+        std::vector<bool> m_Built;
+        
+        lazy_syntax_tree(const lazy_syntax_tree& noCopying);
+        lazy_syntax_tree& operator=(const lazy_syntax_tree& noCopying);
+        
+    public:
+        /// \brief Creates a tree that builds nodes from the specified tape using the specified actions
+        ///
+        /// The tape should not be changed while the tree is in use.
+        lazy_syntax_tree(const syntax_tape& tape, actions_type& actions)
+        : m_Tape(tape)
+        , m_Actions(actions)
+        , m_Nodes(tape.size())
+        , m_Built(tape.size(), false) {
+        }
+        
+        /// \brief Retrieves or builds the node for the specified record
+        ///
+        /// This walks the tape using its own stack, so deep trees don't exhaust the call stack.
+        const node_type& get(int record) {
+            if (m_Built[record]) return m_Nodes[record];
+            
+            // Each entry is a record and the number of its children that have been built
+            std::vector<std::pair<int, int> > pending;
+            pending.push_back(std::make_pair(record, 0));
+            
+            while (!pending.empty()) {
+                int current = pending.back().first;
+                int built   = pending.back().second;
+                
+                // Terminals are built straight from their lexeme
+                if (m_Tape.is_terminal(current)) {
+                    m_Nodes[current] = m_Actions.shift(m_Tape.lexeme(current));
+                    m_Built[current] = true;
+                    pending.pop_back();
+                    continue;
+                }
+                
+                // Build the next child that hasn't been built yet
+                int count = m_Tape.child_count(current);
+                while (built < count && m_Built[m_Tape.child(current, built)]) {
+                    ++built;
+                }
+                
+                if (built < count) {
+                    pending.back().second = built + 1;
+                    pending.push_back(std::make_pair(m_Tape.child(current, built), 0));
+                    continue;
+                }
+                
+                // All the children are available: reduce this record (the reduce list is in reverse order)
+                reduce_list children;
+                children.reserve(count);
+                for (int child = count - 1; child >= 0; --child) {
+                    children.push_back(m_Nodes[m_Tape.child(current, child)]);
+                }
+                
+                m_Nodes[current] = m_Actions.reduce(m_Tape.symbol(current), m_Tape.rule(current), children, m_Tape.lookahead(current));
+                m_Built[current] = true;
+                pending.pop_back();
+            }
+            
+            return m_Nodes[record];
+        }
+    };
+    
+    ///
+    /// \brief Builds the AST nodes for the records on a syntax tape in a separate pass after parsing
+    ///
+    /// The children of a record are always earlier on the tape, so replay() can build every node with a single pass
+    /// from the start of the tape, running the actions in the same order as the parser would have done. This is
+    /// cheaper than a lazy_syntax_tree when the whole tree is needed, and lets a parser that writes a tape run without
+    /// waiting for expensive actions.
+    ///
+    /// As the records of a subtree are next to each other on the tape, replay_parallel() can also build large
+    /// subtrees on separate threads. Each thread has its own actions object, so the actions don't need to be thread
+    /// safe, but the nodes they create must be safe to use from the calling thread once they have been built (nodes
+    /// that share data with nodes built by other actions objects must not change a reference count that isn't
+    /// atomic, for instance).
+    ///
+    template<typename node_type, typename actions_type> class replayed_syntax_tree {
+    public:
+        /// \brief The list of child nodes passed to the reduce action
+        typedef std::vector<node_type> reduce_list;
+        
+        /// \brief The default smallest number of records that replay_parallel() will build on another thread
+        static const int c_DefaultMinRecords = 256;
+        
+    private:
+        /// \brief The tape that the nodes are built from
+        const syntax_tape& m_Tape;
+        
+        /// \brief The nodes that have been built, indexed by record
+        std::vector<node_type> m_Nodes;
+        
+        /// \brief Non-zero for the records that have been built (not a vector<bool>, as threads write to it at once)
+        std::vector<char> m_Built;
+        
+        replayed_syntax_tree(const replayed_syntax_tree& noCopying);
+        replayed_syntax_tree& operator=(const replayed_syntax_tree& noCopying);
+        
+        /// \brief Builds a single record, whose children must already be built
+        void build(int record, actions_type& actions) {
+            if (m_Tape.is_terminal(record)) {
+                m_Nodes[record] = actions.shift(m_Tape.lexeme(record));
+            } else {
+                // The reduce list is in reverse order
+                int         count = m_Tape.child_count(record);
+                reduce_list children;
+                
+                children.reserve((size_t) count);
+                for (int child = count - 1; child >= 0; --child) {
+                    children.push_back(m_Nodes[m_Tape.child(record, child)]);
+                }
+                
+                m_Nodes[record] = actions.reduce(m_Tape.symbol(record), m_Tape.rule(record), children, m_Tape.lookahead(record));
+            }
+            
+            m_Built[record] = 1;
+        }
+        
+        /// \brief Builds the records from first to last that don't refer to records outside that range or that haven't been built
+        void build_range(int first, int last, actions_type& actions) {
+            for (int record = first; record <= last; ++record) {
+                if (m_Built[record]) continue;
+                
+                bool ready = true;
+                if (!m_Tape.is_terminal(record)) {
+                    for (int child = 0; ready && child < m_Tape.child_count(record); ++child) {
+                        int childRecord = m_Tape.child(record, child);
+                        ready = childRecord >= first && m_Built[childRecord];
+                    }
+                }
+                
+                if (ready) build(record, actions);
+            }
+        }
+        
+        /// \brief Task that builds a group of subtrees with one of the actions objects
+        class build_groups_task {
+        private:
+            replayed_syntax_tree& m_Tree;
+            const std::vector<std::vector<int> >& m_Groups;
+            const std::vector<actions_type*>& m_Actions;
+            
+        public:
+            build_groups_task(replayed_syntax_tree& tree, const std::vector<std::vector<int> >& groups, const std::vector<actions_type*>& actions)
+            : m_Tree(tree)
+            , m_Groups(groups)
+            , m_Actions(actions) {
+            }
+            
+            void operator()(size_t groupNum) {
+                const std::vector<int>& group = m_Groups[groupNum];
+                
+                for (std::vector<int>::const_iterator root = group.begin(); root != group.end(); ++root) {
+                    m_Tree.build_range(m_Tree.m_Tape.subtree_start(*root), *root, *m_Actions[groupNum]);
+                }
+            }
+        };
+        
+        friend class build_groups_task;
+        
+        /// \brief Orders subtrees by size, largest first
+        static bool larger_subtree(const std::pair<int, int>& a, const std::pair<int, int>& b) {
+            return a.first > b.first;
+        }
+        
+    public:
+        /// \brief Creates an empty tree for the specified tape
+        ///
+        /// The tape should not be changed while the tree is in use.
+        explicit replayed_syntax_tree(const syntax_tape& tape)
+        : m_Tape(tape)
+        , m_Nodes(tape.size())
+        , m_Built(tape.size(), 0) {
+        }
+        
+        /// \brief Builds the nodes for every record on the tape, in order
+        void replay(actions_type& actions) {
+            build_range(0, m_Tape.size() - 1, actions);
+        }
+        
+        /// \brief Builds the nodes for the tree with the specified root, building large subtrees in parallel
+        ///
+        /// One thread is used for each actions object: the calling thread uses the first one, and also builds the
+        /// nodes near the root that join the subtrees together. Subtrees with fewer than minRecords records are not
+        /// worth handing to another thread, so they are built by the calling thread as well.
+        void replay_parallel(int root, const std::vector<actions_type*>& actions, int minRecords = c_DefaultMinRecords) {
+            if (actions.empty() || root < 0) return;
+            
+            int first       = m_Tape.subtree_start(root);
+            int numThreads  = (int) actions.size();
+            int target      = (root - first + 1) / (numThreads * 4);
+            if (target < minRecords) target = minRecords;
+            
+            // Split the tree into subtrees of at most the target size, starting at the root (the first element is the size)
+            std::vector<std::pair<int, int> >   subtrees;
+            std::vector<int>                    examine(1, root);
+            
+            while (!examine.empty()) {
+                int record  = examine.back();
+                int size    = record - m_Tape.subtree_start(record) + 1;
+                examine.pop_back();
+                
+                if (size <= target) {
+                    if (size >= minRecords) subtrees.push_back(std::make_pair(size, record));
+                } else {
+                    for (int child = 0; child < m_Tape.child_count(record); ++child) {
+                        examine.push_back(m_Tape.child(record, child));
+                    }
+                }
+            }
+            
+            // Share the subtrees out between the threads, giving the largest remaining one to the least busy thread
+            std::sort(subtrees.begin(), subtrees.end(), larger_subtree);
+            
+            std::vector<std::vector<int> >  groups((size_t) numThreads);
+            std::vector<int>                groupSize((size_t) numThreads, 0);
+            
+            for (std::vector<std::pair<int, int> >::const_iterator subtree = subtrees.begin(); subtree != subtrees.end(); ++subtree) {
+                size_t leastBusy = (size_t) (std::min_element(groupSize.begin(), groupSize.end()) - groupSize.begin());
+                groups[leastBusy].push_back(subtree->second);
+                groupSize[leastBusy] += subtree->first;
+            }
+            
+            build_groups_task buildGroups(*this, groups, actions);
+            util::parallel_for(groups.size(), (unsigned int) numThreads, buildGroups);
+            
+            // Build everything else, including the records that join the subtrees together
+            build_range(first, root, *actions[0]);
+        }
+        
+        /// \brief True if the node for the specified record has been built
+        inline bool is_built(int record) const { return m_Built[record] != 0; }
+        
+        /// \brief The node for the specified record (empty if it hasn't been built)
+        inline const node_type& get(int record) const { return m_Nodes[record]; }
+    };
+
+#if __cplusplus >= 201103L
+    // The tape parsers declared by generated parsers are instantiated once in syntax_tape.cpp (as for event_parser.h)
+    extern template class parser<int, tape_parser_actions>;
+    extern template class parser<int, tape_parser_actions, no_parser_trace, small_parser_tables>::state;
+    extern template class parser<int, tape_parser_actions, no_parser_trace, small_parser_tables>::session;
+#endif
+}
+
+#endif
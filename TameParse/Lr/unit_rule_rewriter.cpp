@@ -0,0 +1,128 @@
+//
+//  unit_rule_rewriter.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include <set>
+#include <vector>
+
+#include "TameParse/Lr/unit_rule_rewriter.h"
+
+using namespace std;
+using namespace contextfree;
+using namespace lr;
+
+/// \brief True if the specified rule is a unit rule that this rewriter can skip
+bool unit_rule_rewriter::is_unit_rule(const rule& rule) {
+    if (rule.items().size() != 1)                           return false;
+    if (rule.nonterminal()->type() != item::nonterminal)    return false;
+    if (rule.items()[0]->type() != item::nonterminal)       return false;
+    
+    return true;
+}
+
+/// \brief If the specified state only reduces a unit rule, sets reducedTo to the nonterminal that it reduces to and returns true
+static bool unit_reduction(int stateId, const lalr_builder& builder, item_container& reducedTo) {
+    const lalr_state& state = *builder.machine().state_with_id(stateId);
+    
+    // The state can only contain the completed unit rule (these states have no closure)
+    if (state.count_items() != 1) return false;
+    
+    const lr0_item& onlyItem = *state[0];
+    if (!onlyItem.at_end())                                     return false;
+    if (!unit_rule_rewriter::is_unit_rule(*onlyItem.rule()))    return false;
+    
+    // Guards in the lookahead are evaluated in this state, so it can't be skipped
+    const lr1_item::lookahead_set& lookahead = state.lookahead_for(0);
+    for (lr1_item::lookahead_set::const_iterator la = lookahead.begin(); la != lookahead.end(); ++la) {
+        if ((*la)->type() == item::guard) return false;
+    }
+    
+    reducedTo = onlyItem.rule()->nonterminal();
+    return true;
+}
+
+/// \brief True if the specified state can accept a language
+///
+/// The item on top of the stack is the result of the parse when this happens, so the unit rules leading to these states
+/// must still be reduced.
+static bool is_accepting(int stateId, const lalr_builder& builder) {
+    const lalr_state& state = *builder.machine().state_with_id(stateId);
+    
+    for (int itemId = 0; itemId < state.count_items(); ++itemId) {
+        if (state[itemId]->rule()->nonterminal()->type() == item::empty) return true;
+    }
+    
+    return false;
+}
+
+/// \brief Modifies the specified set of actions according to the rules in this rewriter
+///
+/// The goto actions are redirected past any states that would only reduce a unit rule.
+void unit_rule_rewriter::rewrite_actions(int stateId, lr_action_set& actions, const lalr_builder& builder) const {
+    typedef lalr_machine::transition_set transition_set;
+    
+    const transition_set&       transits = builder.machine().transitions_for_state(stateId);
+    vector<lr_action_container> replaced;
+    vector<lr_action_container> replacements;
+    
+    for (lr_action_set::const_iterator act = actions.begin(); act != actions.end(); ++act) {
+        if ((*act)->type() != lr_action::act_goto) continue;
+        
+        // Follow the chain of unit reductions from the target state
+        // (Each step is the goto that the parser would perform from this state after the reduction)
+        int         target = (*act)->next_state();
+        set<int>    visited;
+        
+        visited.insert(target);
+        for (;;) {
+            item_container reducedTo;
+            if (!unit_reduction(target, builder, reducedTo)) break;
+            
+            transition_set::const_iterator afterReduce = transits.find(reducedTo);
+            if (afterReduce == transits.end()) break;
+            if (is_accepting(afterReduce->second, builder)) break;
+            
+            // Stop if the unit rules form a loop
+            if (!visited.insert(afterReduce->second).second) break;
+            
+            target = afterReduce->second;
+        }
+        
+        if (target == (*act)->next_state()) continue;
+        
+        replaced.push_back(*act);
+        replacements.push_back(lr_action_container(new lr_action(lr_action::act_goto, (*act)->item(), target), true));
+    }
+    
+    // Replace the actions that were redirected
+    for (size_t actionId = 0; actionId < replaced.size(); ++actionId) {
+        actions.erase(replaced[actionId]);
+        actions.insert(replacements[actionId]);
+    }
+}
+
+/// \brief Creates a clone of this rewriter
+action_rewriter* unit_rule_rewriter::clone() const {
+    return new unit_rule_rewriter();
+}
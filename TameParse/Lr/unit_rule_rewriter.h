@@ -0,0 +1,63 @@
+//
+//  unit_rule_rewriter.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _LR_UNIT_RULE_REWRITER_H
+#define _LR_UNIT_RULE_REWRITER_H
+
+#include "TameParse/Lr/action_rewriter.h"
+
+namespace lr {
+    ///
+    /// \brief Action rewriter that removes the reductions for chains of unit rules
+    ///
+    /// Expression grammars usually contain long chains of rules like '<expression> = <term>', each of which costs a
+    /// reduction for every operand that passes through it. When a goto on a nonterminal leads to a state whose only
+    /// item is a unit rule of this kind, this rewriter redirects the goto to the state that the parser would reach
+    /// after reducing that rule. The parser then never performs the reduction, and the item for the inner nonterminal
+    /// is used in place of the outer one.
+    ///
+    /// This changes what the parser actions see: they are not called for the rules that are skipped, so syntax trees
+    /// will be missing the levels for those rules unless something rebuilds them (the C++ generator does this when the
+    /// generated trees are built). States whose lookahead includes a guard are left alone, as are the unit rules that lead
+    /// directly to an accepting state (so the result of a parse is always the start symbol).
+    ///
+    class unit_rule_rewriter : public action_rewriter {
+    public:
+        /// \brief True if the specified rule is a unit rule that this rewriter can skip
+        ///
+        /// These are rules for a plain nonterminal that contain nothing other than a single plain nonterminal.
+        static bool is_unit_rule(const contextfree::rule& rule);
+        
+        /// \brief Modifies the specified set of actions according to the rules in this rewriter
+        ///
+        /// The goto actions are redirected past any states that would only reduce a unit rule.
+        virtual void rewrite_actions(int state, lr_action_set& actions, const lalr_builder& builder) const;
+        
+        /// \brief Creates a clone of this rewriter
+        virtual action_rewriter* clone() const;
+    };
+}
+
+#endif
@@ -43,13 +43,17 @@ weak_symbols::weak_symbols(const item_map& map, const grammar* gram)
 : m_StrongToWeak(map)
 , m_WeakSymbols(gram)
 , m_Grammar(gram) {
+    build_tables();
 }
 
 /// \brief Copy constructor
 weak_symbols::weak_symbols(const weak_symbols& copyFrom)
 : m_StrongToWeak(copyFrom.m_StrongToWeak)
 , m_WeakSymbols(copyFrom.m_WeakSymbols)
-, m_Grammar(copyFrom.m_Grammar) {
+, m_Grammar(copyFrom.m_Grammar)
+, m_IsWeak(copyFrom.m_IsWeak)
+, m_FirstWeak(copyFrom.m_FirstWeak)
+, m_WeakEquivalents(copyFrom.m_WeakEquivalents) {
 }
 
 /// \brief Destructor
@@ -68,6 +72,54 @@ void weak_symbols::add_symbols(const contextfree::item_container& strong, const
     
     // Store these as weak symbols
     m_WeakSymbols.merge(weak);
+    build_tables();
+}
+
+/// \brief Rebuilds the tables indexed by terminal identifier after the symbols have changed
+void weak_symbols::build_tables() {
+    // Find the largest terminal identifier that the tables need to cover
+    int maxTerminal = -1;
+    
+    for (item_set::const_iterator weakItem = m_WeakSymbols.begin(); weakItem != m_WeakSymbols.end(); ++weakItem) {
+        if ((*weakItem)->type() == item::terminal && (*weakItem)->symbol() > maxTerminal) maxTerminal = (*weakItem)->symbol();
+    }
+    
+    for (item_map::const_iterator strong = m_StrongToWeak.begin(); strong != m_StrongToWeak.end(); ++strong) {
+        if (strong->first->type() == item::terminal && strong->first->symbol() > maxTerminal) maxTerminal = strong->first->symbol();
+        
+        for (item_set::const_iterator weakItem = strong->second.begin(); weakItem != strong->second.end(); ++weakItem) {
+            if ((*weakItem)->type() == item::terminal && (*weakItem)->symbol() > maxTerminal) maxTerminal = (*weakItem)->symbol();
+        }
+    }
+    
+    // Mark the weak terminals
+    m_IsWeak.assign((size_t) (maxTerminal + 1), false);
+    
+    for (item_set::const_iterator weakItem = m_WeakSymbols.begin(); weakItem != m_WeakSymbols.end(); ++weakItem) {
+        if ((*weakItem)->type() == item::terminal) m_IsWeak[(*weakItem)->symbol()] = true;
+    }
+    
+    // Collect the weak terminal equivalents of each strong terminal
+    vector<vector<item_container> > equivalents((size_t) (maxTerminal + 1));
+    
+    for (item_map::const_iterator strong = m_StrongToWeak.begin(); strong != m_StrongToWeak.end(); ++strong) {
+        if (strong->first->type() != item::terminal) continue;
+        
+        for (item_set::const_iterator weakItem = strong->second.begin(); weakItem != strong->second.end(); ++weakItem) {
+            if ((*weakItem)->type() != item::terminal) continue;
+            equivalents[strong->first->symbol()].push_back(*weakItem);
+        }
+    }
+    
+    m_FirstWeak.clear();
+    m_WeakEquivalents.clear();
+    
+    for (int terminal = 0; terminal <= maxTerminal; ++terminal) {
+        m_FirstWeak.push_back((int) m_WeakEquivalents.size());
+        m_WeakEquivalents.insert(m_WeakEquivalents.end(), equivalents[terminal].begin(), equivalents[terminal].end());
+    }
+    
+    m_FirstWeak.push_back((int) m_WeakEquivalents.size());
 }
 
 /// \brief Given a set of weak symbols and a DFA (note: NOT an NDFA), determines the appropriate strong symbols and adds them
@@ -167,6 +219,7 @@ void weak_symbols::add_symbols(ndfa& dfa, const item_set& weak, terminal_diction
     
     // Add to the list of weak symbols
     m_WeakSymbols.merge(weak);
+    build_tables();
 }
 
 /// \brief Modifies the specified set of actions according to the rules in this rewriter
@@ -198,8 +251,7 @@ void weak_symbols::rewrite_actions(int state, lr_action_set& actions, const lalr
         if ((*act)->item()->type() != item::terminal) continue;
         
         // See if the symbol is marked as being 'strong' and has weak symbols associated with it
-        item_map::const_iterator found = m_StrongToWeak.find((*act)->item());
-        if (found != m_StrongToWeak.end() && !found->second.empty()) {
+        if (has_weak((*act)->item()->symbol())) {
             haveStrong = true;
             break;
         }
@@ -212,7 +264,7 @@ void weak_symbols::rewrite_actions(int state, lr_action_set& actions, const lalr
     lr_action_set newActions;
     
     // Add actions for any strong symbols, and remember the weak symbols that already have actions
-    map<int, int>               weakSymbols;                // Maps symbols to # actions that refer to them
+    vector<bool>                weakSymbols(m_IsWeak.size(), false);    // Weak symbols that have actions
     stack<lr_action_container>  weakActions;                // Weak actions not processed in the first pass
     stack<lr_action_container>  strongActions;              // Strong actions that might have associated weak symbols
     
@@ -224,7 +276,7 @@ void weak_symbols::rewrite_actions(int state, lr_action_set& actions, const lalr
         }
         
         // Work out if this action is on a strong symbol
-        bool isStrong = !m_WeakSymbols.contains((*act)->item());
+        bool isStrong = !is_weak((*act)->item()->symbol());
         
         // Actions on strong symbols should be preserved without alteration
         if (isStrong) {
@@ -243,7 +295,7 @@ void weak_symbols::rewrite_actions(int state, lr_action_set& actions, const lalr
         int sym = (*act)->item()->symbol();
         
         // Mark this weak symbol as having an existing action
-        ++weakSymbols[sym];
+        weakSymbols[sym] = true;
         
         // Push on to the set of weak actions
         weakActions.push(*act);
@@ -274,19 +326,9 @@ void weak_symbols::rewrite_actions(int state, lr_action_set& actions, const lalr
                 lr_action_container weakReduce(new lr_action(lr_action::act_weakreduce, act->item(), act->next_state(), act->rule()), true);
                 newActions.insert(weakReduce);
                 
-                // Remove from the weak symbols table if there are no other actions for this symbol
-                // This means that if there is a strong symbol that is equivalent to this weak symbol that the actions
-                // for that symbol will be generated. If the strong symbol has a higher priority than the weak action
-                // (by default: has a lower symbol ID), then its actions will be considered first, which is incorrect.
-                int sym = act->item()->symbol();
-                
-                map<int, int>::iterator found = weakSymbols.find(sym);
-                if (found != weakSymbols.end()) {
-                    found->second--;
-                    if (found->second < 0) {
-                        weakSymbols.erase(found);
-                    }
-                }
+                // The weak symbol is still marked as having an action, so the actions for its strong equivalent are
+                // not copied to it. If the strong symbol has a higher priority than the weak action (by default: has a
+                // lower symbol ID), then its actions would be considered first, which is incorrect.
                 break;
            }
                 
@@ -307,25 +349,22 @@ void weak_symbols::rewrite_actions(int state, lr_action_set& actions, const lalr
         // Get the next action
         const lr_action_container& act = strongActions.top();
         
-        // Look up the equivalent weak symbols for this action
-        item_map::const_iterator equivalent = m_StrongToWeak.find(act->item());
-        
         // Nothing to do if there are no equivalent symbols
-        if (equivalent == m_StrongToWeak.end()) continue;
+        int strongId = act->item()->symbol();
+        if (!has_weak(strongId)) continue;
         
         // Iterate through the weak symbols and generate equivalent actions
-        for (item_set::const_iterator weakEquiv = equivalent->second.begin(); weakEquiv != equivalent->second.end(); ++weakEquiv) {
-            // Can't deal with non-terminal symbols (should be none, but you can technically add them)
-            if ((*weakEquiv)->type() != item::terminal) continue;
+        for (int equivNum = m_FirstWeak[strongId]; equivNum < m_FirstWeak[strongId+1]; ++equivNum) {
+            const item_container& weakEquiv = m_WeakEquivalents[equivNum];
             
             // Get the symbol ID of this equivalent symbol
-            int symId = (*weakEquiv)->symbol();
+            int symId = weakEquiv->symbol();
             
             // Nothing to do if this symbol has an alternative action
-            if (weakSymbols.find(symId) != weakSymbols.end()) continue;
+            if (weakSymbols[symId]) continue;
             
             // Add a duplicate action referring to the weak symbol, identical to the action for the strong symbol
-            lr_action_container weakEquivAct(new lr_action(*act, *weakEquiv), true);
+            lr_action_container weakEquivAct(new lr_action(*act, weakEquiv), true);
             
             // Shift actions become shift-strong actions (so the symbol ID is substituted)
             if (weakEquivAct->type() == lr_action::act_shift) {
@@ -30,6 +30,7 @@
 
 #include <set>
 #include <map>
+#include <vector>
 
 #include "TameParse/Dfa/ndfa.h"
 #include "TameParse/ContextFree/item.h"
@@ -75,6 +76,33 @@ namespace lr {
         /// \brief The grammar that the symbols are from
         const contextfree::grammar* m_Grammar;
         
+        /// \brief True for the identifiers of the terminals in m_WeakSymbols
+        ///
+        /// This and the following tables are indexed by terminal identifier, and cover every terminal that appears in
+        /// m_WeakSymbols or m_StrongToWeak, so rewrite_actions() doesn't need to search the maps for each action.
+        std::vector<bool> m_IsWeak;
+        
+        /// \brief For each terminal, the index in m_WeakEquivalents of its first weak equivalent
+        ///
+        /// This has an extra entry at the end, so the equivalents of terminal x run up to m_FirstWeak[x+1].
+        std::vector<int> m_FirstWeak;
+        
+        /// \brief The weak terminals that are equivalent to each strong terminal, in order of strong terminal
+        std::vector<contextfree::item_container> m_WeakEquivalents;
+        
+        /// \brief Rebuilds the tables indexed by terminal identifier after the symbols have changed
+        void build_tables();
+        
+        /// \brief True if the specified terminal identifier is weak
+        inline bool is_weak(int terminal) const {
+            return terminal >= 0 && terminal < (int) m_IsWeak.size() && m_IsWeak[terminal];
+        }
+        
+        /// \brief True if the specified terminal identifier has weak equivalents
+        inline bool has_weak(int terminal) const {
+            return terminal >= 0 && terminal < (int) m_IsWeak.size() && m_FirstWeak[terminal] != m_FirstWeak[terminal+1];
+        }
+        
     public:
         /// \brief Constructs a translator with no weak symbols
         weak_symbols(const contextfree::grammar* gram);
@@ -30,56 +30,102 @@
 
 #include "TameParse/version.h"
 
+#include "TameParse/Util/allocation_counter.h"
 #include "TameParse/Util/astnode.h"
+#include "TameParse/Util/astnode_table.h"
+#include "TameParse/Util/flat_ast.h"
+#include "TameParse/Util/parse_cache.h"
 #include "TameParse/Util/container.h"
+#include "TameParse/Util/parallel.h"
+#include "TameParse/Util/memory_resource.h"
+#include "TameParse/Util/green_node.h"
+#include "TameParse/Util/placed_memory.h"
+#include "TameParse/Util/spsc_queue.h"
+#include "TameParse/Util/hash_map.h"
+#include "TameParse/Util/constexpr.h"
+#include "TameParse/Util/prefetch.h"
+#include "TameParse/Util/stopwatch.h"
 #include "TameParse/Util/stringreader.h"
 #include "TameParse/Util/syntax_ptr.h"
+#include "TameParse/Util/small_vector.h"
 #include "TameParse/Util/unicode.h"
 #include "TameParse/Util/utf8reader.h"
 
 #include "TameParse/Dfa/accept_action.h"
 #include "TameParse/Dfa/basic_lexer.h"
+#include "TameParse/Dfa/binary_lexer.h"
 #include "TameParse/Dfa/character_lexer.h"
 #include "TameParse/Dfa/epsilon.h"
 #include "TameParse/Dfa/hard_coded_symbol_table.h"
+#include "TameParse/Dfa/keyword_table.h"
 #include "TameParse/Dfa/lexeme.h"
+#include "TameParse/Dfa/lazy_dfa_lexer.h"
 #include "TameParse/Dfa/lexer.h"
 #include "TameParse/Dfa/ndfa.h"
+#include "TameParse/Dfa/frozen_ndfa.h"
+#include "TameParse/Dfa/lexeme_samples.h"
 #include "TameParse/Dfa/ndfa_regex.h"
+#include "TameParse/Dfa/pipelined_lexeme_stream.h"
+#include "TameParse/Dfa/push_lexer.h"
 #include "TameParse/Dfa/position.h"
+#include "TameParse/Dfa/skip_state.h"
+#include "TameParse/Dfa/line_index.h"
+#include "TameParse/Dfa/item_boundary_scanner.h"
+#include "TameParse/Dfa/token_array.h"
 #include "TameParse/Dfa/range.h"
 #include "TameParse/Dfa/remapped_symbol_map.h"
+#include "TameParse/Dfa/search.h"
 #include "TameParse/Dfa/state.h"
 #include "TameParse/Dfa/state_machine.h"
+#include "TameParse/Dfa/state_vector.h"
 #include "TameParse/Dfa/symbol_map.h"
 #include "TameParse/Dfa/symbol_set.h"
 #include "TameParse/Dfa/symbol_table.h"
 #include "TameParse/Dfa/symbol_translator.h"
 #include "TameParse/Dfa/transition.h"
 
+#include "TameParse/ContextFree/alternative_inliner.h"
 #include "TameParse/ContextFree/ebnf_items.h"
 #include "TameParse/ContextFree/grammar.h"
 #include "TameParse/ContextFree/guard.h"
 #include "TameParse/ContextFree/item.h"
 #include "TameParse/ContextFree/rule.h"
+#include "TameParse/ContextFree/sentence_generator.h"
 #include "TameParse/ContextFree/standard_items.h"
 #include "TameParse/ContextFree/terminal_dictionary.h"
 
 #include "TameParse/Lr/action_rewriter.h"
 #include "TameParse/Lr/ast_parser.h"
+#include "TameParse/Lr/green_parser.h"
+#include "TameParse/Lr/compiled_language.h"
+#include "TameParse/Lr/replicated_language.h"
+#include "TameParse/Lr/language_registry.h"
 #include "TameParse/Lr/conflict.h"
+#include "TameParse/Lr/event_parser.h"
+#include "TameParse/Lr/syntax_tape.h"
 #include "TameParse/Lr/ignored_symbols.h"
+#include "TameParse/Lr/incremental_parser.h"
 #include "TameParse/Lr/lalr_builder.h"
 #include "TameParse/Lr/lalr_machine.h"
 #include "TameParse/Lr/lalr_state.h"
+#include "TameParse/Lr/lexer_mode_table.h"
+#include "TameParse/Lr/speculative_guard_stream.h"
+#include "TameParse/Lr/lookahead_buffer.h"
 #include "TameParse/Lr/lr1_item_set.h"
 #include "TameParse/Lr/lr_action.h"
 #include "TameParse/Lr/lr_item.h"
 #include "TameParse/Lr/lr_state.h"
+#include "TameParse/Lr/parse_error.h"
 #include "TameParse/Lr/parser.h"
 #include "TameParse/Lr/parser_stack.h"
+#include "TameParse/Lr/counting_parser_trace.h"
+#include "TameParse/Lr/profiling_parser_trace.h"
 #include "TameParse/Lr/parser_state.h"
 #include "TameParse/Lr/parser_tables.h"
+#include "TameParse/Lr/compact_parser_tables.h"
+#include "TameParse/Lr/unit_rule_rewriter.h"
+#include "TameParse/Lr/guard_dfa.h"
+#include "TameParse/Lr/guard_resolver.h"
 #include "TameParse/Lr/weak_symbols.h"
 
 #include "TameParse/Language/block.h"
@@ -108,12 +154,21 @@
 #include "TameParse/Compiler/language_stage.h"
 #include "TameParse/Compiler/lexer_stage.h"
 #include "TameParse/Compiler/lr_parser_stage.h"
+#include "TameParse/Compiler/parser_profile_stage.h"
 #include "TameParse/Compiler/output_stage.h"
+#include "TameParse/Compiler/output_table.h"
+#include "TameParse/Compiler/output_cache.h"
+#include "TameParse/Compiler/OutputStages/c.h"
 #include "TameParse/Compiler/OutputStages/cplusplus.h"
+#include "TameParse/Compiler/OutputStages/statistics.h"
 #include "TameParse/Compiler/std_console.h"
+#include "TameParse/Compiler/buffered_console.h"
+#include "TameParse/Compiler/stage_profile.h"
 #include "TameParse/Compiler/parser_stage.h"
 #include "TameParse/Compiler/import_stage.h"
 #include "TameParse/Compiler/language_builder_stage.h"
+#include "TameParse/Compiler/language_compiler.h"
+#include "TameParse/Compiler/sentence_stage.h"
 #include "TameParse/Compiler/test_stage.h"
 
 #endif
@@ -3,12 +3,24 @@
 ##
 ## Converts the UnicodeData.txt file into a C database
 ##
+##   perl unicode.pl < UnicodeData.txt > unicode_data.h
+##
+## The UnicodeData.txt file isn't shipped with TameParse. The current unicode_data.h is for Unicode 6.0: the input
+## for that version can be rebuilt from unicode_data.h itself with unicode_data_from_header.pl, which is how the
+## category and case lookup tables were added to it.
+##
 
 # Iterate through stdin, which should be UnicodeData.txt file
 $charRanges = { };
 $uppercase = [ ];
 $lowercase = [ ];
 
+# The category and case mappings of each code point, for the two-stage lookup tables
+$categoryOf = { };
+$upperOf = { };
+$lowerOf = { };
+$rangeStart = -1;
+
 while ($_ = <>) {
 	# Split into fields
 	@fields = split /;/;
@@ -41,10 +53,25 @@ while ($_ = <>) {
 	# Store in the hash
 	$charRanges->{$charType} = $rangeArray;
 
+	# Large blocks (such as the CJK ideographs) are listed as a first and last character: every character between
+	# them has the same category
+	$categoryOf->{$charNum} = $charType;
+	if ($fields[1] =~ /, First>$/) {
+		$rangeStart = $charNum;
+	} elsif ($fields[1] =~ /, Last>$/ && $rangeStart >= 0) {
+		for ($inRange = $rangeStart + 1; $inRange < $charNum; $inRange++) {
+			$categoryOf->{$inRange} = $charType;
+		}
+		$rangeStart = -1;
+	}
+
 	# Get the uppercase and lowercase values
 	$uc = hex($fields[12]);
 	$lc = hex($fields[13]);
 
+	$upperOf->{$charNum} = $uc if ($uc > 0);
+	$lowerOf->{$charNum} = $lc if ($lc > 0);
+
 	if ($uc > 0) {
 		# There's a map to an uppercase character
 		if (@$uppercase == 0) {
@@ -103,16 +130,64 @@ foreach my $key (keys %$charRanges) {
 	$first = 0;
 }
 
+# Merge the character types into their main categories, so that each category can be loaded in one go
+$categories = { };
+@categoryOrder = ( );
+foreach my $key (keys %$charRanges) {
+	$category = substr($key, 0, 1);
+	if (!exists $categories->{$category}) {
+		$categories->{$category} = [ ];
+		push(@categoryOrder, $category);
+	}
+	push(@{$categories->{$category}}, @{$charRanges->{$key}});
+}
+
+foreach my $category (@categoryOrder) {
+	print "static unicode::range s_Range$category\[] = { ";
+
+	@sorted = sort { $a->[0] <=> $b->[0] } @{$categories->{$category}};
+	$merged = [ ];
+	foreach my $range (@sorted) {
+		if (@$merged > 0 && $merged->[-1]->[1] + 1 >= $range->[0]) {
+			# Touches the previous range: extend it
+			if ($merged->[-1]->[1] < $range->[1]) {
+				$merged->[-1]->[1] = $range->[1];
+			}
+		} else {
+			push(@$merged, [ $range->[0], $range->[1] ]);
+		}
+	}
+	$categories->{$category} = $merged;
+
+	foreach my $range (@$merged) {
+		$start = $range->[0];
+		$end = $range->[1] + 1;
+		print "{ $start, $end }, ";
+	}
+	print "{ -1, -1 }";
+	print " };\n";
+}
+
 # Generate the list of unicode blocks
 print "\nconst unicode::block unicode::s_Blocks[] = {";
 $count = 0;
 foreach my $key (keys %$charRanges) {
-	print "\n    { \"$key\", s_Range$key },";
+	$numRanges = @{$charRanges->{$key}};
+	print "\n    { \"$key\", s_Range$key, $numRanges },";
 	$count++;
 }
-print "\n    { NULL, NULL }\n};\n";
+print "\n    { NULL, NULL, 0 }\n};\n";
 print "\nconst unicode::block* unicode::s_EndBlock = s_Blocks + $count;\n";
 
+# ... and the list of main categories
+print "\nconst unicode::block unicode::s_Categories[] = {";
+foreach my $category (@categoryOrder) {
+	$numRanges = @{$categories->{$category}};
+	print "\n    { \"$category\", s_Range$category, $numRanges },";
+}
+print "\n    { NULL, NULL, 0 }\n};\n";
+print "\nconst unicode::block* unicode::s_EndCategory = s_Categories + ", scalar(@categoryOrder), ";\n";
+
 # Generate the array of uppercase values
 print "\nconst unicode::map_entry unicode::s_UppercaseMap[] = {\n    ";
 $first = 1;
@@ -139,3 +214,87 @@ print " };\n";
 
 print "\nconst int unicode::s_UppercaseMapSize = ", scalar(@$uppercase), ";\n";
 print "\nconst int unicode::s_LowercaseMapSize = ", scalar(@$lowercase), ";\n";
+
+# Two-stage lookup tables: the top bits of a code point select an entry in the index, which gives the block that the
+# bottom bits are looked up in. Identical blocks are only stored once. The block for characters 0-127 is always the
+# first block, so ASCII characters can be looked up without using the index.
+$blockBits		= 7;
+$blockSize		= 1 << $blockBits;
+$maxCodePoint	= 0x110000;
+
+# Splits the values returned by a function for every code point into an index and a list of unique blocks
+sub two_stage {
+	my ($valueFor) = @_;
+	my @index = ( );
+	my @blocks = ( );
+	my %blockIds = ( );
+
+	for (my $blockStart = 0; $blockStart < $maxCodePoint; $blockStart += $blockSize) {
+		my @block = map { $valueFor->($_) } ($blockStart .. $blockStart + $blockSize - 1);
+		my $key = join(',', @block);
+
+		if (!exists $blockIds{$key}) {
+			$blockIds{$key} = scalar(@blocks);
+			push(@blocks, [ @block ]);
+		}
+		push(@index, $blockIds{$key});
+	}
+
+	return (\@index, \@blocks);
+}
+
+# Prints an index generated by two_stage
+sub print_index {
+	my ($type, $name, $index) = @_;
+
+	print "\nconst $type unicode::$name\[] = {";
+	for (my $entry = 0; $entry < @$index; $entry++) {
+		print "\n    " if ($entry % 32 == 0);
+		print $index->[$entry], ", ";
+	}
+	print "\n};\n";
+}
+
+# The general categories, in the same order as unicode::general_category
+@categoryNames = qw(Cn Lu Ll Lt Lm Lo Mn Mc Me Nd Nl No Pc Pd Ps Pe Pi Pf Po Sm Sc Sk So Zs Zl Zp Cc Cf Cs Co);
+%categoryIds = ( );
+for ($categoryId = 0; $categoryId < @categoryNames; $categoryId++) {
+	$categoryIds{$categoryNames[$categoryId]} = $categoryId;
+}
+
+print "\nconst char* const unicode::s_CategoryNames[] = { ";
+print join(", ", map { "\"$_\"" } @categoryNames);
+print " };\n";
+
+# Code points that aren't in the data are unassigned (Cn)
+($categoryIndex, $categoryBlocks) = two_stage(sub {
+	my $type = $categoryOf->{$_[0]};
+	return defined($type) && exists $categoryIds{$type} ? $categoryIds{$type} : 0;
+});
+
+print_index("unsigned short", "s_CategoryIndex", $categoryIndex);
+
+print "\nconst unsigned char unicode::s_CategoryBlocks[] = {";
+foreach my $block (@$categoryBlocks) {
+	print "\n    ", join(", ", @$block), ",";
+}
+print "\n};\n";
+
+# The case tables store the offset to the uppercase and lowercase character, which is the same for most of a block
+($caseIndex, $caseBlocks) = two_stage(sub {
+	my $charNum = $_[0];
+	my $upper = exists $upperOf->{$charNum} ? $upperOf->{$charNum} - $charNum : 0;
+	my $lower = exists $lowerOf->{$charNum} ? $lowerOf->{$charNum} - $charNum : 0;
+	return "{ $upper, $lower }";
+});
+
+print_index("unsigned short", "s_CaseIndex", $caseIndex);
+
+print "\nconst unicode::case_delta unicode::s_CaseBlocks[] = {";
+foreach my $block (@$caseBlocks) {
+	print "\n    ", join(", ", @$block), ",";
+}
+print "\n};\n";
+
+print "\nconst int unicode::s_CategoryBlockCount = ", scalar(@$categoryBlocks), ";\n";
+print "\nconst int unicode::s_CaseBlockCount = ", scalar(@$caseBlocks), ";\n";
@@ -0,0 +1,77 @@
+#!/usr/bin/perl
+
+##
+## Rebuilds the fields of UnicodeData.txt that unicode.pl uses from an existing unicode_data.h
+##
+## unicode_data.h was originally generated from the UnicodeData.txt file for Unicode 6.0, which isn't shipped with
+## TameParse. This recovers the general category and the simple case mappings of every character from the range and
+## map tables in that file, so that unicode.pl can be run again to add new tables without changing the version of
+## Unicode that is used:
+##
+##   perl unicode_data_from_header.pl < unicode_data.h > UnicodeData.txt
+##   perl unicode.pl < UnicodeData.txt > unicode_data.h
+##
+## To move to a new version of Unicode, run unicode.pl on the UnicodeData.txt file from unicode.org instead.
+##
+
+# The large blocks that UnicodeData.txt lists as a first and last character instead of one line per character.
+# unicode_data.h only stores the endpoints of these, so they can't be recovered from the header itself.
+@firstLast = (
+	[ 0x3400, 0x4DB5 ],     [ 0x4E00, 0x9FCB ],     [ 0xAC00, 0xD7A3 ],
+	[ 0xD800, 0xDB7F ],     [ 0xDB80, 0xDBFF ],     [ 0xDC00, 0xDFFF ],     [ 0xE000, 0xF8FF ],
+	[ 0x20000, 0x2A6D6 ],   [ 0x2A700, 0x2B734 ],   [ 0x2B740, 0x2B81D ],
+	[ 0xF0000, 0xFFFFD ],   [ 0x100000, 0x10FFFD ]
+);
+
+%rangeName = ( );
+foreach $pair (@firstLast) {
+	$rangeName{$pair->[0]} = "<Range, First>";
+	$rangeName{$pair->[1]} = "<Range, Last>";
+}
+
+# Read the header
+$header = join('', <STDIN>);
+
+# The range tables give the character type of each character
+%charType = ( );
+while ($header =~ /static unicode::range s_Range(\w\w)\[\] = \{ (.*?) \};/g) {
+	$type = $1;
+	$ranges = $2;
+
+	while ($ranges =~ /\{ (-?\d+), (-?\d+) \}/g) {
+		for ($charNum = $1; $charNum < $2; $charNum++) {
+			$charType{$charNum} = $type;
+		}
+	}
+}
+
+# The map tables give the uppercase and lowercase equivalents
+sub read_map {
+	my ($name) = @_;
+	my %map = ( );
+
+	if ($header =~ /unicode::$name\[\] = \{(.*?)\};/s) {
+		my $entries = $1;
+
+		while ($entries =~ /\{ (\d+), (\d+), (\d+) \}/g) {
+			for (my $charNum = $1; $charNum < $2; $charNum++) {
+				$map{$charNum} = $3 + ($charNum - $1);
+			}
+		}
+	}
+
+	return %map;
+}
+
+%upper = read_map("s_UppercaseMap");
+%lower = read_map("s_LowercaseMap");
+
+# Write out a line for each character, leaving the fields that unicode.pl doesn't use empty
+foreach $charNum (sort { $a <=> $b } keys %charType) {
+	$name = exists $rangeName{$charNum} ? $rangeName{$charNum} : "CHAR";
+	$uc = exists $upper{$charNum} ? sprintf("%04X", $upper{$charNum}) : "";
+	$lc = exists $lower{$charNum} ? sprintf("%04X", $lower{$charNum}) : "";
+
+	@fields = (sprintf("%04X", $charNum), $name, $charType{$charNum}, "", "", "", "", "", "", "", "", "", $uc, $lc, "");
+	print join(';', @fields), "\n";
+}
@@ -0,0 +1,65 @@
+//
+//  allocation_counter.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#include "TameParse/Util/allocation_counter.h"
+#include "TameParse/Util/parallel.h"
+
+using namespace util;
+
+/// \brief True once the program has said that it counts its allocations
+static bool s_Enabled = false;
+
+/// \brief The number of allocations made by this thread
+static TAMEPARSE_THREAD_LOCAL long s_Allocations = 0;
+
+/// \brief The number of bytes allocated by this thread
+static TAMEPARSE_THREAD_LOCAL size_t s_Bytes = 0;
+
+/// \brief Adds an allocation of the specified size to the counts for the calling thread
+void allocation_counter::count(size_t size) {
+    ++s_Allocations;
+    s_Bytes += size;
+}
+
+/// \brief Marks the counts as meaningful (called once the program has replaced operator new)
+void allocation_counter::enable() {
+    s_Enabled = true;
+}
+
+/// \brief True if the program is counting its allocations
+bool allocation_counter::is_enabled() {
+    return s_Enabled;
+}
+
+/// \brief The number of allocations made by the calling thread so far
+long allocation_counter::allocations() {
+    return s_Allocations;
+}
+
+/// \brief The number of bytes allocated by the calling thread so far
+size_t allocation_counter::bytes() {
+    return s_Bytes;
+}
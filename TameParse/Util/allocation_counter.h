@@ -0,0 +1,59 @@
+//
+//  allocation_counter.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _UTIL_ALLOCATION_COUNTER_H
+#define _UTIL_ALLOCATION_COUNTER_H
+
+#include <cstddef>
+
+namespace util {
+    ///
+    /// \brief Counts the memory allocations made by each thread
+    ///
+    /// The library has no way to see the allocations that a program makes, so nothing is counted unless the program
+    /// replaces the global operator new with one that calls count() and then calls enable() (parsetool does this). The
+    /// counts are kept separately for each thread when C++11 is available.
+    ///
+    class allocation_counter {
+    public:
+        /// \brief Adds an allocation of the specified size to the counts for the calling thread
+        static void count(size_t size);
+        
+        /// \brief Marks the counts as meaningful (called once the program has replaced operator new)
+        static void enable();
+        
+        /// \brief True if the program is counting its allocations
+        static bool is_enabled();
+        
+        /// \brief The number of allocations made by the calling thread so far
+        static long allocations();
+        
+        /// \brief The number of bytes allocated by the calling thread so far
+        static size_t bytes();
+    };
+}
+
+#endif
@@ -0,0 +1,137 @@
+//
+//  arena.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#include <cstdlib>
+#include <new>
+
+#include "TameParse/Util/arena.h"
+#include "TameParse/Util/memory_resource.h"
+
+using namespace util;
+
+/// \brief Creates a new arena, which will allocate memory in slabs of the specified size
+arena::arena(size_t slabSize)
+: m_Slabs(NULL)
+, m_Cleanup(NULL)
+, m_SlabSize(slabSize)
+, m_Allocated(0) {
+}
+
+/// \brief Destroys this arena, along with any tracked objects and all of its memory
+arena::~arena() {
+    clear();
+}
+
+/// \brief Allocates a new slab with at least the specified number of bytes in it
+void arena::new_slab(size_t minSize) {
+    // Large allocations get a slab to themselves
+    size_t size = minSize > m_SlabSize ? minSize : m_SlabSize;
+    
+    // Allocate the header and the data in one block
+    slab* newSlab = static_cast<slab*>(malloc(c_SlabHeaderSize + size));
+    if (!newSlab) throw std::bad_alloc();
+    
+    newSlab->next   = m_Slabs;
+    newSlab->size   = size;
+    newSlab->used   = 0;
+    m_Slabs         = newSlab;
+}
+
+/// \brief Destroys all of the tracked objects, and frees all of the memory used by this arena
+void arena::clear() {
+    // Destroy the tracked objects, most recent first
+    for (cleanup* obj = m_Cleanup; obj != NULL; obj = obj->next) {
+        obj->destroy(obj->object);
+    }
+    m_Cleanup = NULL;
+    
+    // Free the slabs
+    while (m_Slabs) {
+        slab* next = m_Slabs->next;
+        free(m_Slabs);
+        m_Slabs = next;
+    }
+    
+    m_Allocated = 0;
+}
+
+/// \brief Allocates an object from the current memory_resource
+void* arena_object::operator new(size_t size) {
+    return operator new(size, (memory_resource*) NULL);
+}
+
+/// \brief Allocates an object from the specified arena, or from the current memory_resource if it is NULL
+void* arena_object::operator new(size_t size, arena* pool) {
+    if (!pool) return operator new(size, (memory_resource*) NULL);
+    return operator new(size, *pool);
+}
+
+/// \brief Allocates an object from the specified arena
+void* arena_object::operator new(size_t size, arena& pool) {
+    // The header before the object records that it came from an arena
+    header* result      = static_cast<header*>(pool.allocate(c_HeaderSize + size));
+    result->resource    = NULL;
+    result->size        = c_HeaderSize + size;
+    
+    return reinterpret_cast<char*>(result) + c_HeaderSize;
+}
+
+/// \brief Allocates an object from the specified memory_resource, or from the current one if it is NULL
+void* arena_object::operator new(size_t size, memory_resource* resource) {
+    if (!resource) resource = memory_resource::current();
+    
+    // The header before the object records the resource to give the memory back to
+    header* result      = static_cast<header*>(resource->allocate(c_HeaderSize + size));
+    result->resource    = resource;
+    result->size        = c_HeaderSize + size;
+    
+    return reinterpret_cast<char*>(result) + c_HeaderSize;
+}
+
+/// \brief Frees an object (objects in an arena are freed when the arena is cleared)
+void arena_object::operator delete(void* object) {
+    if (!object) return;
+    
+    header* allocated = reinterpret_cast<header*>(static_cast<char*>(object) - c_HeaderSize);
+    if (allocated->resource) {
+        allocated->resource->deallocate(allocated, allocated->size);
+    }
+}
+
+/// \brief Matching delete operator (only used if a constructor throws)
+void arena_object::operator delete(void* object, arena* pool) {
+    operator delete(object);
+}
+
+/// \brief Matching delete operator (only used if a constructor throws)
+void arena_object::operator delete(void* object, arena& pool) {
+    operator delete(object);
+}
+
+/// \brief Matching delete operator (only used if a constructor throws)
+void arena_object::operator delete(void* object, memory_resource* resource) {
+    operator delete(object);
+}
@@ -0,0 +1,222 @@
+//
+//  arena.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _UTIL_ARENA_H
+#define _UTIL_ARENA_H
+
+#include <cstddef>
+
+namespace util {
+    class memory_resource;
+    
+    ///
+    /// \brief Bump allocator that hands out memory from large slabs, and frees it all in one go
+    ///
+    /// Allocating from an arena is just a matter of moving a pointer on, and nothing is freed until the arena is
+    /// cleared or destroyed. This suits objects which all share the same lifetime, such as the nodes of a syntax
+    /// tree that will be thrown away once a parse has finished.
+    ///
+    /// Objects that need their destructor calling when the arena is cleared can be registered with track().
+    ///
+    class arena {
+    public:
+        /// \brief The default size of a slab
+        static const size_t c_DefaultSlabSize = 64*1024;
+        
+    private:
+        /// \brief Type used to work out the alignment of allocations
+        union max_align {
+            long double     ld;
+            long long       ll;
+            void*           ptr;
+            void            (*fn)();
+        };
+        
+    public:
+        /// \brief The alignment of all allocations
+        static const size_t c_Alignment = sizeof(max_align) > 16 ? 16 : sizeof(max_align);
+        
+    private:
+        /// \brief Header for a slab of memory (the data follows after this, at the next aligned offset)
+        struct slab {
+            /// \brief The previously allocated slab
+            slab* next;
+            
+            /// \brief The number of bytes of data in this slab
+            size_t size;
+            
+            /// \brief The number of bytes that have been used
+            size_t used;
+        };
+        
+        /// \brief An object that needs to be destroyed when the arena is cleared
+        struct cleanup {
+            /// \brief The previously registered object
+            cleanup* next;
+            
+            /// \brief Function that calls the destructor for the object
+            void (*destroy)(void* object);
+            
+            /// \brief The object to destroy
+            void* object;
+        };
+        
+        /// \brief The most recently allocated slab (NULL if no slabs have been allocated yet)
+        slab* m_Slabs;
+        
+        /// \brief The most recently registered object
+        cleanup* m_Cleanup;
+        
+        /// \brief The size to use for new slabs
+        size_t m_SlabSize;
+        
+        /// \brief The number of bytes handed out by this arena
+        size_t m_Allocated;
+        
+        /// \brief Calls the destructor for an object of the specified type
+        template<typename T> static void destroy_object(void* object) {
+            static_cast<T*>(object)->~T();
+        }
+        
+        /// \brief The offset of the data from the start of a slab
+        static const size_t c_SlabHeaderSize = (sizeof(slab) + c_Alignment - 1) & ~(c_Alignment - 1);
+        
+        /// \brief Allocates a new slab with at least the specified number of bytes in it
+        void new_slab(size_t minSize);
+        
+        /// \brief Disabled copy constructor
+        arena(const arena& copyFrom);
+        
+        /// \brief Disabled assignment
+        arena& operator=(const arena& assignFrom);
+        
+    public:
+        /// \brief Creates a new arena, which will allocate memory in slabs of the specified size
+        explicit arena(size_t slabSize = c_DefaultSlabSize);
+        
+        /// \brief Destroys this arena, along with any tracked objects and all of its memory
+        ~arena();
+        
+        /// \brief Allocates the specified number of bytes, aligned suitably for any type
+        inline void* allocate(size_t size) {
+            // Round up to the alignment
+            size = (size + c_Alignment - 1) & ~(c_Alignment - 1);
+            
+            // Make sure there's room in the current slab
+            if (!m_Slabs || m_Slabs->size - m_Slabs->used < size) {
+                new_slab(size);
+            }
+            
+            // Bump the pointer
+            void* result = reinterpret_cast<char*>(m_Slabs) + c_SlabHeaderSize + m_Slabs->used;
+            m_Slabs->used   += size;
+            m_Allocated     += size;
+            
+            return result;
+        }
+        
+        /// \brief Registers an object allocated in this arena so its destructor is called when the arena is cleared
+        ///
+        /// Objects are destroyed in the reverse of the order they were tracked in.
+        template<typename T> inline T* track(T* object) {
+            cleanup* newCleanup = static_cast<cleanup*>(allocate(sizeof(cleanup)));
+            
+            newCleanup->next    = m_Cleanup;
+            newCleanup->destroy = &destroy_object<T>;
+            newCleanup->object  = object;
+            m_Cleanup           = newCleanup;
+            
+            return object;
+        }
+        
+        /// \brief Destroys all of the tracked objects, and frees all of the memory used by this arena
+        void clear();
+        
+        /// \brief The number of bytes allocated from this arena since it was created or last cleared
+        inline size_t size() const { return m_Allocated; }
+
+    };
+    
+    ///
+    /// \brief Base class for objects that can be allocated either from a memory_resource or from an arena
+    ///
+    /// Objects are created with new (pool) T(...), where pool is an arena or NULL to use the current memory_resource
+    /// for this thread (the heap unless it has been changed), and are deleted in the usual way. Deleting an object
+    /// that came from an arena calls its destructor but leaves the memory to be reclaimed along with the arena, so
+    /// reference counted pointers can manage both kinds of object. The arena or resource must outlast the objects
+    /// allocated from it.
+    ///
+    class arena_object {
+    private:
+        /// \brief Header that records where an object was allocated
+        struct header {
+            /// \brief The resource the object was allocated from, or NULL if it came from an arena
+            memory_resource* resource;
+            
+            /// \brief The number of bytes allocated, including this header
+            size_t size;
+        };
+        
+        /// \brief The size of the header, rounded up so that the object is aligned
+        static const size_t c_HeaderSize = (sizeof(header) + arena::c_Alignment - 1) & ~(arena::c_Alignment - 1);
+        
+    public:
+        /// \brief Allocates an object from the current memory_resource
+        static void* operator new(size_t size);
+        
+        /// \brief Allocates an object from the specified arena, or from the current memory_resource if it is NULL
+        static void* operator new(size_t size, arena* pool);
+        
+        /// \brief Allocates an object from the specified arena
+        static void* operator new(size_t size, arena& pool);
+        
+        /// \brief Allocates an object from the specified memory_resource, or from the current one if it is NULL
+        static void* operator new(size_t size, memory_resource* resource);
+        
+        /// \brief Frees an object (objects in an arena are freed when the arena is cleared)
+        static void operator delete(void* object);
+        
+        /// \brief Matching delete operator (only used if a constructor throws)
+        static void operator delete(void* object, arena* pool);
+        
+        /// \brief Matching delete operator (only used if a constructor throws)
+        static void operator delete(void* object, arena& pool);
+        
+        /// \brief Matching delete operator (only used if a constructor throws)
+        static void operator delete(void* object, memory_resource* resource);
+    };
+}
+
+/// \brief Placement new operator that constructs an object in an arena
+inline void* operator new(size_t size, util::arena& fromArena) {
+    return fromArena.allocate(size);
+}
+
+/// \brief Matching delete operator (only used if a constructor throws; the memory is reclaimed with the arena)
+inline void operator delete(void* object, util::arena& fromArena) {
+}
+
+#endif
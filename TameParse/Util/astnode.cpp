@@ -25,11 +25,119 @@
 //  IN THE SOFTWARE.
 //
 
+#include <set>
+#include <vector>
+#include <utility>
+
 #include "TameParse/Util/astnode.h"
+#include "TameParse/Util/memory_resource.h"
 
+using namespace std;
 using namespace dfa;
 using namespace util;
 
+/// \brief Size of the header before a list of children, which records the resource it was allocated from
+static const size_t c_ItemsHeaderSize = (sizeof(memory_resource*) + sizeof(size_t) + arena::c_Alignment - 1) & ~(arena::c_Alignment - 1);
+
+/// \brief Allocates space for the specified number of children from the current memory resource
+static astnode_container* allocate_items(size_t capacity) {
+    memory_resource*    resource    = memory_resource::current();
+    size_t              size        = c_ItemsHeaderSize + capacity * sizeof(astnode_container);
+    char*               block       = static_cast<char*>(resource->allocate(size));
+    
+    *reinterpret_cast<memory_resource**>(block)                     = resource;
+    *reinterpret_cast<size_t*>(block + sizeof(memory_resource*))    = size;
+    
+    return reinterpret_cast<astnode_container*>(block + c_ItemsHeaderSize);
+}
+
+/// \brief Frees space allocated by allocate_items
+static void free_items(astnode_container* items) {
+    char* block = reinterpret_cast<char*>(items) - c_ItemsHeaderSize;
+    
+    (*reinterpret_cast<memory_resource**>(block))->deallocate(block, *reinterpret_cast<size_t*>(block + sizeof(memory_resource*)));
+}
+
+/// \brief Creates an empty list
+astnode_list::astnode_list()
+: m_Items(inline_items())
+, m_Count(0)
+, m_Capacity(c_InlineChildren) {
+}
+
+/// \brief Copies a list
+astnode_list::astnode_list(const astnode_list& copyFrom)
+: m_Items(inline_items())
+, m_Count(0)
+, m_Capacity(c_InlineChildren) {
+    append(copyFrom.begin(), copyFrom.end());
+}
+
+/// \brief Assigns the content of this list
+astnode_list& astnode_list::operator=(const astnode_list& assignFrom) {
+    if (&assignFrom == this) return *this;
+    
+    // Copy the new children before releasing the old ones, in case they refer to each other
+    astnode_list copy(assignFrom);
+    
+    clear();
+    append(copy.begin(), copy.end());
+    
+    return *this;
+}
+
+/// \brief Releases the children in this list
+astnode_list::~astnode_list() {
+    clear();
+    if (m_Items != inline_items()) free_items(m_Items);
+}
+
+/// \brief Makes sure that this list can hold the specified number of children without reallocating
+void astnode_list::reserve(size_t capacity) {
+    if (capacity <= m_Capacity) return;
+    
+    // Move the children to a new allocation of the requested size
+    astnode_container* newItems = allocate_items(capacity);
+    
+    for (size_t x=0; x<m_Count; ++x) {
+        new (newItems + x) astnode_container(m_Items[x]);
+        m_Items[x].~astnode_container();
+    }
+    
+    if (m_Items != inline_items()) free_items(m_Items);
+    
+    m_Items     = newItems;
+    m_Capacity  = capacity;
+}
+
+/// \brief Adds a child to the end of this list
+void astnode_list::push_back(const astnode_container& child) {
+    if (m_Count >= m_Capacity) {
+        // Copy the child first, in case it is in this list
+        astnode_container newChild(child);
+        
+        reserve(m_Capacity * 2);
+        new (m_Items + m_Count) astnode_container(newChild);
+    } else {
+        new (m_Items + m_Count) astnode_container(child);
+    }
+    
+    ++m_Count;
+}
+
+/// \brief Removes the last child from this list
+void astnode_list::pop_back() {
+    --m_Count;
+    m_Items[m_Count].~astnode_container();
+}
+
+/// \brief Removes all of the children from this list (keeping the storage)
+void astnode_list::clear() {
+    while (m_Count > 0) {
+        pop_back();
+    }
+}
+
 /// \brief Creates an empty AST node
 astnode::astnode()
 : m_ItemIdentifier(-1) 
@@ -48,9 +156,131 @@ astnode::astnode(int itemIdentifier, int rule)
 /// \brief Creates an AST node from a lexeme
 astnode::astnode(const dfa::lexeme_container& terminal)
 : m_ItemIdentifier(-1)
+, m_Rule(-1)
 , m_Lexeme(terminal) {
 }
 
+/// \brief Destroys this node
+astnode::~astnode() {
+    if (m_Children.empty()) return;
+    
+    // Take apart the nodes that would be destroyed along with this one, so their destructors have no children to release
+    node_list pending;
+    pending.append(m_Children.begin(), m_Children.end());
+    m_Children.clear();
+    
+    while (!pending.empty()) {
+        astnode_container child = pending.back();
+        pending.pop_back();
+        
+        if (child.unique() && !child->m_Children.empty()) {
+            node_list& grandchildren = child.item()->m_Children;
+            
+            pending.append(grandchildren.begin(), grandchildren.end());
+            grandchildren.clear();
+        }
+        
+        // The child is destroyed here if this was the last reference to it
+    }
+}
+
+/// \brief Writes this node and all of its children to a binary stream
+void astnode::write(std::ostream& target) const {
+    // Nodes are written in pre-order, so each node is followed by its children
+    vector<const astnode*> pending(1, this);
+    
+    while (!pending.empty()) {
+        const astnode* node = pending.back();
+        pending.pop_back();
+        
+        int header[4] = { node->m_ItemIdentifier, node->m_Rule, (int) node->m_Children.size(), node->m_Lexeme.item() ? 1 : 0 };
+        target.write((const char*) header, sizeof(header));
+        
+        if (node->m_Lexeme.item()) {
+            node->m_Lexeme->write(target);
+        }
+        
+        for (node_list::const_iterator child = node->m_Children.end(); child != node->m_Children.begin(); ) {
+            --child;
+            pending.push_back(child->item());
+        }
+    }
+}
+
+/// \brief Reads a tree that was written by write(), returning false if the stream is invalid
+bool astnode::read(std::istream& source, astnode_container& result) {
+    // The nodes whose children are still being read, and the number of children left to read for each
+    vector<pair<astnode*, int> > pending;
+    astnode_container root(NULL, true);
+    
+    do {
+        int header[4];
+        source.read((char*) header, sizeof(header));
+        if (!source.good() || header[2] < 0) return false;
+        
+        astnode*            node = new astnode(header[0], header[1]);
+        astnode_container   nodeContainer(node, true);
+        
+        if (header[3]) {
+            dfa::lexeme* terminal = dfa::lexeme::read(source);
+            if (!terminal) return false;
+            
+            node->m_Lexeme = lexeme_container(terminal, true);
+        }
+        
+        // Add to the node that's waiting for its children, or make this the root
+        if (pending.empty()) {
+            root = nodeContainer;
+        } else {
+            pending.back().first->add_child(nodeContainer);
+            --pending.back().second;
+        }
+        
+        if (header[2] > 0) {
+            node->m_Children.reserve((size_t) header[2]);
+            pending.push_back(make_pair(node, header[2]));
+        }
+        
+        // Finish any nodes that have all of their children
+        while (!pending.empty() && pending.back().second == 0) {
+            pending.pop_back();
+        }
+    } while (!pending.empty());
+    
+    result = root;
+    return true;
+}
+
+/// \brief The number of bytes used by this node, its descendants and their lexemes
+size_t astnode::memory_usage() const {
+    size_t                      total = 0;
+    set<const astnode*>         sharedNodes;
+    set<const dfa::lexeme*>     sharedLexemes;
+    vector<const astnode*>      pending(1, this);
+    
+    // Walk the tree without recursing, so deep trees can be measured without running out of stack
+    while (!pending.empty()) {
+        const astnode* node = pending.back();
+        pending.pop_back();
+        
+        // Nodes with more than one reference might be reached again
+        if (node->reference_count() > 1 && !sharedNodes.insert(node).second) continue;
+        
+        total += sizeof(*node) + node->m_Children.allocated_size();
+        
+        const dfa::lexeme* nodeLexeme = node->m_Lexeme.item();
+        if (nodeLexeme && (nodeLexeme->reference_count() <= 1 || sharedLexemes.insert(nodeLexeme).second)) {
+            total += nodeLexeme->memory_usage();
+        }
+        
+        for (node_list::const_iterator child = node->m_Children.begin(); child != node->m_Children.end(); ++child) {
+            if (child->item()) pending.push_back(child->item());
+        }
+    }
+    
+    return total;
+}
+
 /// \brief Adds a new child node to this item
 void astnode::add_child(const astnode_container& newChild) {
     m_Children.push_back(newChild);
@@ -28,22 +28,125 @@
 #ifndef _UTIL_ASTNODE_H
 #define _UTIL_ASTNODE_H
 
-#include <vector>
+#include <new>
+#include <iterator>
+#include <iostream>
 
 #include "TameParse/Dfa/lexeme.h"
+#include "TameParse/Util/arena.h"
 #include "TameParse/Util/container.h"
+#include "TameParse/Util/refcounted.h"
 
 namespace util {
     class astnode;
-    typedef container<astnode> astnode_container;
+    typedef intrusive_container<astnode> astnode_container;
+    
+    ///
+    /// \brief The list of child nodes of an AST node
+    ///
+    /// Most nodes have only a few children, so up to c_InlineChildren of them are stored in the list itself rather than
+    /// in a separate allocation. Lists that are filled from a range are allocated at exactly the right size.
+    ///
+    class astnode_list {
+    public:
+        /// \brief Iterator for the nodes in this list
+        typedef const astnode_container* const_iterator;
+        
+        /// \brief Iterator for the nodes in this list (the list can only be read through iterators)
+        typedef const_iterator iterator;
+        
+        /// \brief The number of children that are stored without a separate allocation
+        static const size_t c_InlineChildren = 4;
+        
+    private:
+        /// \brief The number of pointers needed to store a container
+        static const size_t c_WordsPerChild = (sizeof(astnode_container) + sizeof(void*) - 1) / sizeof(void*);
+        
+        /// \brief The children in this list (either m_Inline or a heap allocation)
+        astnode_container* m_Items;
+        
+        /// \brief The number of children in this list
+        size_t m_Count;
+        
+        /// \brief The number of children that m_Items has space for
+        size_t m_Capacity;
+        
+        /// \brief Storage for lists with no more than c_InlineChildren children
+        void* m_Inline[c_InlineChildren * c_WordsPerChild];
+        
+        /// \brief The inline storage for children
+        inline astnode_container* inline_items() { return reinterpret_cast<astnode_container*>(m_Inline); }
+        
+    public:
+        /// \brief Creates an empty list
+        astnode_list();
+        
+        /// \brief Copies a list
+        astnode_list(const astnode_list& copyFrom);
+        
+        /// \brief Assigns the content of this list
+        astnode_list& operator=(const astnode_list& assignFrom);
+        
+        /// \brief Releases the children in this list
+        ~astnode_list();
+        
+        /// \brief Makes sure that this list can hold the specified number of children without reallocating
+        void reserve(size_t capacity);
+        
+        /// \brief Adds a child to the end of this list
+        void push_back(const astnode_container& child);
+        
+        /// \brief Removes the last child from this list
+        void pop_back();
+        
+        /// \brief Removes all of the children from this list (keeping the storage)
+        void clear();
+        
+        /// \brief Adds a series of children to the end of this list, allocating space for all of them at once
+        template<typename iterator> void append(iterator begin, iterator end) {
+            reserve(m_Count + (size_t) std::distance(begin, end));
+            
+            for (iterator cur = begin; cur != end; ++cur) {
+                new (m_Items + m_Count) astnode_container(*cur);
+                ++m_Count;
+            }
+        }
+        
+        /// \brief The number of children in this list
+        inline size_t size() const { return m_Count; }
+        
+        /// \brief True if this list has no children
+        inline bool empty() const { return m_Count == 0; }
+        
+        /// \brief The first child in this list
+        inline const_iterator begin() const { return m_Items; }
+        
+        /// \brief The position after the last child in this list
+        inline const_iterator end() const { return m_Items + m_Count; }
+        
+        /// \brief The last child in this list
+        inline const astnode_container& back() const { return m_Items[m_Count-1]; }
+        
+        /// \brief The child at the specified index
+        inline const astnode_container& operator[](size_t index) const { return m_Items[index]; }
+        
+        /// \brief The number of bytes allocated for the children outside of the list itself
+        inline size_t allocated_size() const {
+            if ((const void*) m_Items == (const void*) m_Inline) return 0;
+            return m_Capacity * sizeof(astnode_container);
+        }
+    };
     
     ///
     /// \brief Class representing an abstract syntax tree
     ///
-    class astnode {
+    /// Nodes (and the lists of their children) are allocated from the current memory_resource for the thread that
+    /// creates them, or from an arena with new (arena) astnode(...).
+    ///
+    class astnode : public refcounted, public arena_object {
     public:
         /// \brief List of AST nodes
-        typedef std::vector<astnode_container> node_list;
+        typedef astnode_list node_list;
         
     private:
         /// \brief The identifier of the grammar item associated with this node (or -1 for a terminal node)
@@ -65,17 +168,45 @@ namespace util {
         /// \brief Creates an AST node with the specified rule and item identifier
         astnode(int itemIdentifier, int rule = -1);
         
+        /// \brief Creates an AST node with the specified rule and item identifier, and the children in the specified range
+        ///
+        /// Space for the children is allocated in one go (or not at all, if there are few enough to be stored inline)
+        template<typename iterator> astnode(int itemIdentifier, int rule, iterator firstChild, iterator lastChild)
+        : m_ItemIdentifier(itemIdentifier)
+        , m_Rule(rule)
+        , m_Lexeme(NULL, false) {
+            m_Children.append(firstChild, lastChild);
+        }
+        
         /// \brief Creates an AST node from a lexeme
         astnode(const dfa::lexeme_container& terminal);
         
+        /// \brief Destroys this node
+        ///
+        /// Child nodes that are only referred to by this node are destroyed without recursion, so deep trees can be
+        /// freed without running out of stack.
+        virtual ~astnode();
+        
+        /// \brief Writes this node and all of its children to a binary stream
+        ///
+        /// Nodes are written in the native byte order, so they should be read back on the same kind of machine.
+        void write(std::ostream& target) const;
+        
+        /// \brief Reads a tree that was written by write(), returning false if the stream is invalid
+        static bool read(std::istream& source, astnode_container& result);
+        
+        /// \brief The number of bytes used by this node, its descendants and their lexemes
+        ///
+        /// Nodes and lexemes that appear more than once in the tree (for instance, subtrees shared by ast_parser) are
+        /// only counted once.
+        size_t memory_usage() const;
+        
         /// \brief Adds a new child node to this item
         void add_child(const astnode_container& newChild);
         
         /// \brief Adds a series of children to this item
         template<typename iterator> void add_children(iterator begin, iterator end) {
-            for (iterator cur = begin; cur != end; ++cur) {
-                m_Children.push_back(*cur);
-            }
+            m_Children.append(begin, end);
         }
         
         /// \brief The ID of the rule for this node
@@ -91,7 +222,7 @@ namespace util {
         inline const node_list& children() const { return m_Children; }
         
         /// \brief Returns the child at the specified index
-        inline const astnode_container& operator[](int x) const { return children()[x]; }
+        inline const astnode_container& operator[](int x) const { return children()[(size_t) x]; }
         
     public:
         /// \brief Clones this AST node
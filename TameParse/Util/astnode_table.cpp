@@ -0,0 +1,82 @@
+//
+//  astnode_table.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include <algorithm>
+
+#include "TameParse/Util/astnode_table.h"
+
+using namespace std;
+using namespace dfa;
+using namespace util;
+
+/// \brief Creates an empty table
+astnode_table::astnode_table()
+: m_Count(0) {
+}
+
+/// \brief The hash code for a terminal node
+astnode_table::hash_code astnode_table::terminal_hash(const dfa::lexeme& lexeme) {
+    hash_code result = mix(14695981039346656037ULL, (uint64_t) lexeme.matched());
+    for (lexeme::symbol_iterator symbol = lexeme.begin(); symbol != lexeme.end(); ++symbol) {
+        result = mix(result, (uint64_t) *symbol);
+    }
+    return result;
+}
+
+/// \brief Finds the node for a terminal with the same symbol and text as the specified lexeme, or NULL if there isn't one
+const astnode_container* astnode_table::find_terminal(const dfa::lexeme& lexeme) const {
+    const vector<astnode_container>* candidates = bucket(terminal_hash(lexeme));
+    if (!candidates) return NULL;
+    
+    for (vector<astnode_container>::const_iterator candidate = candidates->begin(); candidate != candidates->end(); ++candidate) {
+        const lexeme_container& nodeLexeme = (*candidate)->lexeme();
+        if (!nodeLexeme.item() || nodeLexeme->matched() != lexeme.matched() || nodeLexeme->length() != lexeme.length()) continue;
+        
+        if (equal(lexeme.begin(), lexeme.end(), nodeLexeme->begin())) {
+            return &*candidate;
+        }
+    }
+    
+    return NULL;
+}
+
+/// \brief Adds a node to this table, so that identical nodes can be found later
+void astnode_table::add(const astnode_container& node) {
+    hash_code hash;
+    if (node->lexeme().item()) {
+        hash = terminal_hash(*node->lexeme());
+    } else {
+        hash = nonterminal_hash(node->item_identifier(), node->rule(), node->children().begin(), node->children().end());
+    }
+    
+    m_Nodes[hash].push_back(node);
+    ++m_Count;
+}
+
+/// \brief Removes all of the nodes from this table
+void astnode_table::clear() {
+    m_Nodes.clear();
+    m_Count = 0;
+}
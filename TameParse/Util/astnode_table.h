@@ -0,0 +1,129 @@
+//
+//  astnode_table.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _UTIL_ASTNODE_TABLE_H
+#define _UTIL_ASTNODE_TABLE_H
+
+#include <vector>
+#include <stdint.h>
+
+#include "TameParse/Util/astnode.h"
+#include "TameParse/Util/hash_map.h"
+
+namespace util {
+    ///
+    /// \brief Table of AST nodes used to share identical subtrees (hash-consing)
+    ///
+    /// Terminal nodes are identical if they have the same symbol and text, and nonterminal nodes are identical if they
+    /// have the same item, rule and children. Provided that every node is built from children found in or added to
+    /// the same table, identical subtrees are the same node, so they only take up memory once and can be compared by
+    /// pointer.
+    ///
+    /// Shared nodes have the position of the first place they were found, so this is best suited to trees where the
+    /// positions of the nodes aren't needed (or only the positions of the nodes that aren't repeated).
+    ///
+    class astnode_table {
+    public:
+        /// \brief Type of the hash code for a node
+        typedef uint64_t hash_code;
+        
+    private:
+        /// \brief The nodes in this table, grouped by hash code
+        typedef hash_map<hash_code, std::vector<astnode_container> >::type node_map;
+        
+        /// \brief The nodes in this table
+        node_map m_Nodes;
+        
+        /// \brief The number of nodes in this table
+        size_t m_Count;
+        
+        /// \brief Adds a value to a hash code
+        inline static hash_code mix(hash_code hash, uint64_t value) {
+            return (hash ^ value) * 1099511628211ULL;
+        }
+        
+        /// \brief The hash code for a nonterminal node
+        template<typename iterator> static hash_code nonterminal_hash(int itemIdentifier, int rule, iterator firstChild, iterator lastChild) {
+            hash_code result = mix(mix(14695981039346656037ULL, (uint64_t) itemIdentifier), (uint64_t) rule);
+            for (iterator child = firstChild; child != lastChild; ++child) {
+                result = mix(result, (uint64_t) (uintptr_t) child->item());
+            }
+            return result;
+        }
+        
+        /// \brief The hash code for a terminal node
+        static hash_code terminal_hash(const dfa::lexeme& lexeme);
+        
+        /// \brief The nodes with the specified hash code, or NULL if there are none
+        inline const std::vector<astnode_container>* bucket(hash_code hash) const {
+            node_map::const_iterator found = m_Nodes.find(hash);
+            if (found == m_Nodes.end()) return NULL;
+            return &found->second;
+        }
+        
+    public:
+        /// \brief Creates an empty table
+        astnode_table();
+        
+        /// \brief Finds the node for a terminal with the same symbol and text as the specified lexeme, or NULL if there isn't one
+        const astnode_container* find_terminal(const dfa::lexeme& lexeme) const;
+        
+        /// \brief Finds the node for a nonterminal with the specified children, or NULL if there isn't one
+        template<typename iterator> const astnode_container* find_nonterminal(int itemIdentifier, int rule, iterator firstChild, iterator lastChild) const {
+            const std::vector<astnode_container>* candidates = bucket(nonterminal_hash(itemIdentifier, rule, firstChild, lastChild));
+            if (!candidates) return NULL;
+            
+            for (std::vector<astnode_container>::const_iterator candidate = candidates->begin(); candidate != candidates->end(); ++candidate) {
+                const astnode& node = **candidate;
+                if (node.item_identifier() != itemIdentifier || node.rule() != rule || node.lexeme().item()) continue;
+                
+                // Children are compared by pointer, as they are shared too
+                astnode::node_list::const_iterator  nodeChild   = node.children().begin();
+                iterator                            child       = firstChild;
+                
+                for (; child != lastChild && nodeChild != node.children().end(); ++child, ++nodeChild) {
+                    if (child->item() != nodeChild->item()) break;
+                }
+                
+                if (child == lastChild && nodeChild == node.children().end()) {
+                    return &*candidate;
+                }
+            }
+            
+            return NULL;
+        }
+        
+        /// \brief Adds a node to this table, so that identical nodes can be found later
+        void add(const astnode_container& node);
+        
+        /// \brief Removes all of the nodes from this table
+        void clear();
+        
+        /// \brief The number of nodes in this table
+        inline size_t size() const { return m_Count; }
+    };
+}
+
+#endif
@@ -0,0 +1,199 @@
+//
+//  comb_vector.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#include <algorithm>
+
+#include "TameParse/Util/comb_vector.h"
+
+using namespace std;
+using namespace util;
+
+/// \brief Orders row indexes so that the rows with the most cells come first
+class order_by_row_size {
+private:
+    const vector<comb_vector::row>& m_Rows;
+    
+public:
+    order_by_row_size(const vector<comb_vector::row>& rows)
+    : m_Rows(rows) {
+    }
+    
+    inline bool operator()(int a, int b) const {
+        if (m_Rows[a].size() != m_Rows[b].size()) return m_Rows[a].size() > m_Rows[b].size();
+        return a < b;
+    }
+};
+
+/// \brief Packs the specified set of rows into a new table
+comb_vector::comb_vector(const vector<row>& rows)
+: m_NumRows((int) rows.size())
+, m_NumCells(0)
+, m_DeleteTables(true) {
+    int*        base    = new int[m_NumRows > 0 ? m_NumRows : 1];
+    vector<int> check;
+    vector<int> value;
+    
+    // Place the largest rows first: the small rows are then much more likely to fill the gaps they leave
+    vector<int> order;
+    for (int rowId = 0; rowId < m_NumRows; ++rowId) {
+        order.push_back(rowId);
+    }
+    stable_sort(order.begin(), order.end(), order_by_row_size(rows));
+    
+    // No cell before this one is empty
+    size_t firstFree = 0;
+    
+    for (vector<int>::const_iterator rowId = order.begin(); rowId != order.end(); ++rowId) {
+        const row& thisRow = rows[*rowId];
+        
+        // Empty rows can go anywhere: the check array will reject every lookup
+        if (thisRow.empty()) {
+            base[*rowId] = 0;
+            continue;
+        }
+        
+        // Find the first and last columns in this row
+        int minColumn = thisRow[0].first;
+        int maxColumn = thisRow[0].first;
+        for (row::const_iterator cell = thisRow.begin(); cell != thisRow.end(); ++cell) {
+            if (cell->first < minColumn) minColumn = cell->first;
+            if (cell->first > maxColumn) maxColumn = cell->first;
+        }
+        
+        // Try each base in turn, starting at the point where the first column lands in the first free cell
+        // (the base can be negative, provided that every column in the row lands inside the table)
+        int rowBase = (int) firstFree - minColumn;
+        
+        for (;; ++rowBase) {
+            bool fits = true;
+            for (row::const_iterator cell = thisRow.begin(); cell != thisRow.end(); ++cell) {
+                size_t pos = (size_t) (rowBase + cell->first);
+                if (pos < check.size() && check[pos] != -1) {
+                    fits = false;
+                    break;
+                }
+            }
+            
+            if (fits) break;
+        }
+        
+        // Store the cells for this row
+        size_t required = (size_t) (rowBase + maxColumn) + 1;
+        if (check.size() < required) {
+            check.resize(required, -1);
+            value.resize(required, 0);
+        }
+        
+        for (row::const_iterator cell = thisRow.begin(); cell != thisRow.end(); ++cell) {
+            check[rowBase + cell->first] = *rowId;
+            value[rowBase + cell->first] = cell->second;
+        }
+        
+        base[*rowId] = rowBase;
+        
+        // Move the first free cell on
+        while (firstFree < check.size() && check[firstFree] != -1) {
+            ++firstFree;
+        }
+    }
+    
+    // Copy the cells into the final arrays
+    m_NumCells = (int) check.size();
+    
+    int* finalCheck = new int[m_NumCells > 0 ? m_NumCells : 1];
+    int* finalValue = new int[m_NumCells > 0 ? m_NumCells : 1];
+    
+    copy(check.begin(), check.end(), finalCheck);
+    copy(value.begin(), value.end(), finalValue);
+    
+    m_Base  = base;
+    m_Check = finalCheck;
+    m_Value = finalValue;
+}
+
+/// \brief Copy constructor
+comb_vector::comb_vector(const comb_vector& copyFrom)
+: m_Base(NULL)
+, m_Check(NULL)
+, m_Value(NULL)
+, m_DeleteTables(false) {
+    copy_from(copyFrom);
+}
+
+/// \brief Assignment
+comb_vector& comb_vector::operator=(const comb_vector& copyFrom) {
+    if (&copyFrom == this) return *this;
+    
+    free_tables();
+    copy_from(copyFrom);
+    
+    return *this;
+}
+
+/// \brief Destructor
+comb_vector::~comb_vector() {
+    free_tables();
+}
+
+/// \brief Copies the arrays from the specified object
+void comb_vector::copy_from(const comb_vector& copyFrom) {
+    m_NumRows       = copyFrom.m_NumRows;
+    m_NumCells      = copyFrom.m_NumCells;
+    m_DeleteTables  = copyFrom.m_DeleteTables;
+    
+    // Hard-coded tables can just be shared
+    if (!m_DeleteTables) {
+        m_Base  = copyFrom.m_Base;
+        m_Check = copyFrom.m_Check;
+        m_Value = copyFrom.m_Value;
+        return;
+    }
+    
+    int* base   = new int[m_NumRows > 0 ? m_NumRows : 1];
+    int* check  = new int[m_NumCells > 0 ? m_NumCells : 1];
+    int* value  = new int[m_NumCells > 0 ? m_NumCells : 1];
+    
+    copy(copyFrom.m_Base, copyFrom.m_Base + m_NumRows, base);
+    copy(copyFrom.m_Check, copyFrom.m_Check + m_NumCells, check);
+    copy(copyFrom.m_Value, copyFrom.m_Value + m_NumCells, value);
+    
+    m_Base  = base;
+    m_Check = check;
+    m_Value = value;
+}
+
+/// \brief Frees the arrays if they're owned by this object
+void comb_vector::free_tables() {
+    if (m_DeleteTables) {
+        delete[] m_Base;
+        delete[] m_Check;
+        delete[] m_Value;
+    }
+    
+    m_Base  = NULL;
+    m_Check = NULL;
+    m_Value = NULL;
+}
@@ -0,0 +1,143 @@
+//
+//  comb_vector.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _UTIL_COMB_VECTOR_H
+#define _UTIL_COMB_VECTOR_H
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+#include "TameParse/Util/constexpr.h"
+
+namespace util {
+    ///
+    /// \brief Sparse two-dimensional table of integers, packed using row displacement ('comb vector' compression)
+    ///
+    /// Every row is assigned a base offset into a single array of cells, chosen so that the populated cells of
+    /// each row do not overlap the populated cells of any other row. A parallel check array records which row
+    /// owns each cell. Looking up a value requires a single addition and comparison, so this is as fast as a
+    /// flat table while using space close to the number of populated entries.
+    ///
+    /// Tables can either be built from a set of rows, or can refer to hard-coded arrays (in which case they
+    /// are not freed when this object is destroyed, and copies of this object share them).
+    ///
+    class comb_vector {
+    public:
+        /// \brief A populated cell in a row (column, value)
+        typedef std::pair<int, int> cell;
+        
+        /// \brief The cells that make up a single row, used when building a new comb_vector
+        typedef std::vector<cell> row;
+        
+    private:
+        /// \brief The number of rows in this table
+        int m_NumRows;
+        
+        /// \brief The number of cells in this table
+        int m_NumCells;
+        
+        /// \brief The base offset of each row (m_NumRows entries)
+        const int* m_Base;
+        
+        /// \brief The row that owns each cell (m_NumCells entries)
+        const int* m_Check;
+        
+        /// \brief The value of each cell (m_NumCells entries)
+        const int* m_Value;
+        
+        /// \brief True if this object owns the arrays
+        bool m_DeleteTables;
+        
+        /// \brief Copies the arrays from the specified object
+        void copy_from(const comb_vector& copyFrom);
+        
+        /// \brief Frees the arrays if they're owned by this object
+        void free_tables();
+        
+    public:
+        /// \brief Packs the specified set of rows into a new table
+        ///
+        /// Columns must be non-negative, and each column should appear at most once per row.
+        explicit comb_vector(const std::vector<row>& rows);
+        
+        /// \brief Creates a table from existing arrays. These are not deleted by the destructor
+        TAMEPARSE_CONSTEXPR comb_vector(const int* base, const int* check, const int* value, int numRows, int numCells)
+        : m_NumRows(numRows)
+        , m_NumCells(numCells)
+        , m_Base(base)
+        , m_Check(check)
+        , m_Value(value)
+        , m_DeleteTables(false) {
+        }
+        
+        /// \brief Copy constructor
+        comb_vector(const comb_vector& copyFrom);
+        
+        /// \brief Assignment
+        comb_vector& operator=(const comb_vector& copyFrom);
+        
+        /// \brief Destructor
+        ~comb_vector();
+        
+    public:
+        /// \brief Returns the value stored at the specified row and column, or missing if that cell is empty
+        ///
+        /// The row must be valid, but any column (including negative ones) can be passed in.
+        inline int lookup(int row, int column, int missing = -1) const {
+            unsigned int pos = (unsigned int) (m_Base[row] + column);
+            if (pos >= (unsigned int) m_NumCells || m_Check[pos] != row) return missing;
+            return m_Value[pos];
+        }
+        
+        /// \brief The number of rows in this table
+        inline int count_rows() const { return m_NumRows; }
+        
+        /// \brief The number of cells in the packed table
+        inline int count_cells() const { return m_NumCells; }
+        
+        /// \brief The base offset for each row (count_rows() entries)
+        inline const int* base() const { return m_Base; }
+        
+        /// \brief The row that owns each cell, or -1 for empty cells (count_cells() entries)
+        inline const int* check() const { return m_Check; }
+        
+        /// \brief The value of each cell (count_cells() entries)
+        inline const int* value() const { return m_Value; }
+        
+        /// \brief Size in bytes of this table
+        inline size_t size() const {
+            return sizeof(*this) + sizeof(int) * ((size_t) m_NumRows + 2 * (size_t) m_NumCells);
+        }
+        
+        /// \brief Size in bytes of the arrays that a table with the specified number of rows and cells requires
+        static inline size_t size_for(int numRows, int numCells) {
+            return sizeof(int) * ((size_t) numRows + 2 * (size_t) numCells);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,196 @@
+//
+//  flat_ast.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#include "TameParse/Util/flat_ast.h"
+
+using namespace std;
+using namespace util;
+
+/// \brief Creates an empty tree
+flat_ast::flat_ast()
+: m_Finished(false) {
+}
+
+/// \brief Appends a node without any children
+int flat_ast::add_node(int symbol, int rule, offset_type offset, offset_type length) {
+    m_Symbol.push_back(symbol);
+    m_Rule.push_back(rule);
+    m_FirstChild.push_back((int) m_Pending.size());
+    m_ChildCount.push_back(0);
+    m_Offset.push_back(offset);
+    m_Length.push_back(length);
+    
+    return (int) m_Symbol.size() - 1;
+}
+
+/// \brief Adds a terminal node, returning its index
+int flat_ast::add_terminal(int symbol, offset_type offset, offset_type length) {
+    return add_node(symbol, c_Terminal, offset, length);
+}
+
+/// \brief Adds a nonterminal node, returning its index
+int flat_ast::add_nonterminal(int nonterminal, int rule, const vector<int>& children, offset_type offset) {
+    // Empty rules are placed at the offset we were given
+    if (children.empty()) {
+        return add_node(nonterminal, rule, offset, 0);
+    }
+    
+    // Otherwise the node covers everything from its first child to the end of its last
+    int         first   = children.back();
+    int         last    = children.front();
+    offset_type start   = m_Offset[first];
+    offset_type end     = m_Offset[last] + m_Length[last];
+    int         node    = add_node(nonterminal, rule, start, end - start);
+    
+    // The children are passed in reverse
+    m_Pending.insert(m_Pending.end(), children.rbegin(), children.rend());
+    m_ChildCount[node] = (int) children.size();
+    
+    return node;
+}
+
+/// \brief Lays the tree out in breadth-first order, starting at the specified root node
+void flat_ast::finish(int root) {
+    if (m_Finished) return;
+    
+    // Work out the new order of the nodes: the children of each node are added as it is reached
+    vector<int> order;
+    order.reserve(m_Symbol.size());
+    order.push_back(root);
+    
+    vector<int> firstChild;
+    firstChild.reserve(m_Symbol.size());
+    
+    for (size_t pos = 0; pos < order.size(); ++pos) {
+        int node = order[pos];
+        
+        firstChild.push_back((int) order.size());
+        for (int child = 0; child < m_ChildCount[node]; ++child) {
+            order.push_back(m_Pending[m_FirstChild[node] + child]);
+        }
+    }
+    
+    // Rebuild the arrays in the new order
+    vector<int> symbol(order.size());
+    vector<int> rule(order.size());
+    vector<int> childCount(order.size());
+    vector<offset_type> offset(order.size());
+    vector<offset_type> length(order.size());
+    
+    for (size_t pos = 0; pos < order.size(); ++pos) {
+        int node = order[pos];
+        
+        symbol[pos]     = m_Symbol[node];
+        rule[pos]       = m_Rule[node];
+        childCount[pos] = m_ChildCount[node];
+        offset[pos]     = m_Offset[node];
+        length[pos]     = m_Length[node];
+    }
+    
+    m_Symbol.swap(symbol);
+    m_Rule.swap(rule);
+    m_FirstChild.swap(firstChild);
+    m_ChildCount.swap(childCount);
+    m_Offset.swap(offset);
+    m_Length.swap(length);
+    
+    // The list of children is no longer needed
+    vector<int>().swap(m_Pending);
+    m_Finished = true;
+}
+
+/// \brief Frees all of the nodes in this tree, so that it can be reused to build a new one
+void flat_ast::clear() {
+    vector<int>().swap(m_Symbol);
+    vector<int>().swap(m_Rule);
+    vector<int>().swap(m_FirstChild);
+    vector<int>().swap(m_ChildCount);
+    vector<offset_type>().swap(m_Offset);
+    vector<offset_type>().swap(m_Length);
+    vector<int>().swap(m_Pending);
+    
+    m_Finished = false;
+}
+
+/// \brief Writes one of the arrays in a tree
+template<typename value> static void write_array(ostream& target, const vector<value>& array) {
+    if (!array.empty()) {
+        target.write((const char*) &array[0], array.size() * sizeof(value));
+    }
+}
+
+/// \brief Reads one of the arrays in a tree
+template<typename value> static bool read_array(istream& source, vector<value>& array, int count) {
+    array.resize(count);
+    if (count > 0) {
+        source.read((char*) &array[0], count * sizeof(value));
+    }
+    return !source.fail();
+}
+
+/// \brief Identifies trees written by write() (the last byte is the version of the format)
+///
+/// Version 2 stores offsets and lengths as 64-bit values: trees written with version 1 can't be read back.
+static const int c_TreeFormat = 0x54464102;
+
+/// \brief Writes a finished tree to a binary stream
+void flat_ast::write(ostream& target) const {
+    int header[2] = { c_TreeFormat, size() };
+    target.write((const char*) header, sizeof(header));
+    
+    write_array(target, m_Symbol);
+    write_array(target, m_Rule);
+    write_array(target, m_FirstChild);
+    write_array(target, m_ChildCount);
+    write_array(target, m_Offset);
+    write_array(target, m_Length);
+}
+
+/// \brief Replaces this tree with one that was written by write(), returning false if the stream is invalid
+bool flat_ast::read(istream& source) {
+    clear();
+    
+    int header[2];
+    source.read((char*) header, sizeof(header));
+    if (!source.good() || header[0] != c_TreeFormat || header[1] < 0) return false;
+    
+    int count = header[1];
+    
+    bool ok =  read_array(source, m_Symbol, count)
+            && read_array(source, m_Rule, count)
+            && read_array(source, m_FirstChild, count)
+            && read_array(source, m_ChildCount, count)
+            && read_array(source, m_Offset, count)
+            && read_array(source, m_Length, count);
+    
+    if (!ok) {
+        clear();
+        return false;
+    }
+    
+    m_Finished = true;
+    return true;
+}
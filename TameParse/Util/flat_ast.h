@@ -0,0 +1,145 @@
+//
+//  flat_ast.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _UTIL_FLAT_AST_H
+#define _UTIL_FLAT_AST_H
+
+#include <stdint.h>
+#include <vector>
+#include <iostream>
+
+namespace util {
+    ///
+    /// \brief An abstract syntax tree stored as a set of parallel arrays
+    ///
+    /// Nodes are added bottom-up while parsing, in the order the parser produces them. Once the parse is finished,
+    /// finish() lays the tree out again in breadth-first order starting from the root, after which the children of
+    /// each node are stored next to each other: the children of node n are the nodes from first_child(n) to
+    /// first_child(n) + child_count(n) - 1, and the root is node 0.
+    ///
+    /// The whole tree is held in a handful of vectors, so walking it means reading memory in order instead of
+    /// following pointers, and it can be written out or freed in a single operation.
+    ///
+    class flat_ast {
+    public:
+        /// \brief The rule stored for terminal nodes
+        static const int c_Terminal = -1;
+        
+        /// \brief Type used for the offsets and lengths of nodes (64-bit so that very large inputs can be stored)
+        typedef int64_t offset_type;
+        
+    private:
+        /// \brief The terminal or nonterminal identifier of each node
+        std::vector<int> m_Symbol;
+        
+        /// \brief The rule matched by each node, or c_Terminal for terminals
+        std::vector<int> m_Rule;
+        
+        /// \brief The first child of each node (before finish() is called, this is an index into m_Pending)
+        std::vector<int> m_FirstChild;
+        
+        /// \brief The number of children of each node
+        std::vector<int> m_ChildCount;
+        
+        /// \brief The offset of the first symbol covered by each node
+        std::vector<offset_type> m_Offset;
+        
+        /// \brief The number of symbols covered by each node
+        std::vector<offset_type> m_Length;
+        
+        /// \brief The children of each node, in the order they were added (only used before finish() is called)
+        std::vector<int> m_Pending;
+        
+        /// \brief True once finish() has been called
+        bool m_Finished;
+        
+        /// \brief Appends a node without any children
+        int add_node(int symbol, int rule, offset_type offset, offset_type length);
+        
+    public:
+        /// \brief Creates an empty tree
+        flat_ast();
+        
+        /// \brief Adds a terminal node, returning its index
+        int add_terminal(int symbol, offset_type offset, offset_type length);
+        
+        /// \brief Adds a nonterminal node, returning its index
+        ///
+        /// The children are supplied in reverse order, as they are in the reduce list passed to parser actions. If 
+        /// there are no children, the node is placed at the specified offset, with a length of 0.
+        int add_nonterminal(int nonterminal, int rule, const std::vector<int>& children, offset_type offset);
+        
+        /// \brief Lays the tree out in breadth-first order, starting at the specified root node
+        ///
+        /// Any nodes that are not reachable from the root are discarded. No more nodes can be added after this is
+        /// called.
+        void finish(int root);
+        
+        /// \brief Frees all of the nodes in this tree, so that it can be reused to build a new one
+        void clear();
+        
+        /// \brief Writes a finished tree to a binary stream
+        ///
+        /// The tree is written in the native byte order, so it should be read back on the same kind of machine.
+        void write(std::ostream& target) const;
+        
+        /// \brief Replaces this tree with one that was written by write(), returning false if the stream is invalid
+        bool read(std::istream& source);
+        
+    public:
+        /// \brief True once finish() has been called on this tree
+        inline bool finished() const { return m_Finished; }
+        
+        /// \brief The number of nodes in this tree
+        inline int size() const { return (int) m_Symbol.size(); }
+        
+        /// \brief The terminal or nonterminal identifier of the specified node
+        inline int symbol(int node) const { return m_Symbol[node]; }
+        
+        /// \brief The rule matched by the specified node, or c_Terminal if it is a terminal
+        inline int rule(int node) const { return m_Rule[node]; }
+        
+        /// \brief True if the specified node is a terminal
+        inline bool is_terminal(int node) const { return m_Rule[node] == c_Terminal; }
+        
+        /// \brief The index of the first child of the specified node in a finished tree
+        inline int first_child(int node) const { return m_FirstChild[node]; }
+        
+        /// \brief The number of children of the specified node
+        inline int child_count(int node) const { return m_ChildCount[node]; }
+        
+        /// \brief The index of a child of the specified node in a finished tree
+        inline int child(int node, int index) const { return m_FirstChild[node] + index; }
+        
+        /// \brief The offset of the first symbol covered by the specified node
+        inline offset_type offset(int node) const { return m_Offset[node]; }
+        
+        /// \brief The number of symbols covered by the specified node
+        inline offset_type length(int node) const { return m_Length[node]; }
+    };
+}
+
+#endif
@@ -0,0 +1,241 @@
+//
+//  green_node.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include "TameParse/Util/green_node.h"
+
+using namespace std;
+using namespace util;
+
+/// \brief Creates an empty nonterminal node (used as a placeholder by the parser)
+green_node::green_node()
+: m_Kind(nonterminal)
+, m_Symbol(-1)
+, m_Rule(-1) {
+    finish();
+}
+
+/// \brief Creates a trivia node, or a token node with no trivia
+green_node::green_node(kind nodeKind, int symbol, const int* firstSymbol, const int* lastSymbol)
+: m_Kind(nodeKind)
+, m_Symbol(symbol)
+, m_Rule(-1)
+, m_Text(firstSymbol, lastSymbol) {
+    finish();
+}
+
+/// \brief Creates a token node with the specified trivia before it
+green_node::green_node(int symbol, const int* firstSymbol, const int* lastSymbol, const node_list& trivia)
+: m_Kind(token)
+, m_Symbol(symbol)
+, m_Rule(-1)
+, m_Text(firstSymbol, lastSymbol)
+, m_Children(trivia) {
+    finish();
+}
+
+/// \brief Works out the width and hash code for this node once the children are known
+void green_node::finish() {
+    m_Width         = m_Text.size();
+    m_LeadingWidth  = 0;
+    
+    for (node_list::const_iterator child = m_Children.begin(); child != m_Children.end(); ++child) {
+        m_Width += (*child)->width();
+    }
+    
+    if (m_Kind == token) {
+        // The trivia of a token all comes before its text
+        m_LeadingWidth = m_Width - m_Text.size();
+    } else if (m_Kind == nonterminal) {
+        // The leading trivia is the trivia before the first token, which is in the first child that isn't empty
+        for (node_list::const_iterator child = m_Children.begin(); child != m_Children.end(); ++child) {
+            m_LeadingWidth += (*child)->leading_width();
+            if ((*child)->width() != (*child)->leading_width()) break;
+        }
+    }
+    
+    const int* firstSymbol = m_Text.empty() ? NULL : &m_Text[0];
+    m_Hash = hash(m_Kind, m_Symbol, m_Rule, firstSymbol, firstSymbol + m_Text.size(), m_Children.begin(), m_Children.end());
+}
+
+/// \brief Destructor (takes apart deep trees without recursing)
+green_node::~green_node() {
+    if (m_Children.empty()) return;
+    
+    // Take apart the nodes that would be destroyed along with this one, so their destructors have no children to release
+    node_list pending;
+    pending.swap(m_Children);
+    
+    while (!pending.empty()) {
+        green_node_container child = pending.back();
+        pending.pop_back();
+        
+        if (child.unique() && !child->m_Children.empty()) {
+            node_list& grandchildren = child.item()->m_Children;
+            
+            pending.insert(pending.end(), grandchildren.begin(), grandchildren.end());
+            grandchildren.clear();
+        }
+        
+        // The child is destroyed here if this was the last reference to it
+    }
+}
+
+/// \brief Appends all of the text covered by this node (including the trivia) to the specified vector
+void green_node::append_text(text& target) const {
+    // Walk the tree in order without recursing (children are pushed in reverse so the first is visited first)
+    vector<const green_node*> pending(1, this);
+    
+    while (!pending.empty()) {
+        const green_node* node = pending.back();
+        pending.pop_back();
+        
+        if (node->m_Kind == nonterminal) {
+            for (node_list::const_reverse_iterator child = node->m_Children.rbegin(); child != node->m_Children.rend(); ++child) {
+                pending.push_back(child->item());
+            }
+        } else {
+            for (node_list::const_iterator trivia = node->m_Children.begin(); trivia != node->m_Children.end(); ++trivia) {
+                target.insert(target.end(), (*trivia)->m_Text.begin(), (*trivia)->m_Text.end());
+            }
+            target.insert(target.end(), node->m_Text.begin(), node->m_Text.end());
+        }
+    }
+}
+
+/// \brief Creates an empty table
+green_node_table::green_node_table()
+: m_Count(0)
+, m_Reused(0) {
+}
+
+/// \brief Finds the node for a token or trivia node, creating it if needed
+green_node_container green_node_table::find_terminal(green_node::kind nodeKind, int symbol, const int* firstSymbol, const int* lastSymbol, const green_node::node_list& trivia) {
+    green_node::hash_code   hash    = green_node::hash(nodeKind, symbol, -1, firstSymbol, lastSymbol, trivia.begin(), trivia.end());
+    green_node::node_list&  bucket  = m_Nodes[hash];
+    
+    for (green_node::node_list::const_iterator candidate = bucket.begin(); candidate != bucket.end(); ++candidate) {
+        if ((*candidate)->same_as(nodeKind, symbol, -1, firstSymbol, lastSymbol, trivia.begin(), trivia.end())) {
+            ++m_Reused;
+            return *candidate;
+        }
+    }
+    
+    green_node* newNode;
+    if (nodeKind == green_node::token) {
+        newNode = new green_node(symbol, firstSymbol, lastSymbol, trivia);
+    } else {
+        newNode = new green_node(nodeKind, symbol, firstSymbol, lastSymbol);
+    }
+    
+    green_node_container result(newNode, true);
+    
+    bucket.push_back(result);
+    ++m_Count;
+    return result;
+}
+
+/// \brief Releases the nodes that are only referred to by this table, returning the number that were removed
+size_t green_node_table::remove_unused() {
+    size_t removed = 0;
+    
+    // Releasing a node can leave its children unused too, so keep going until nothing changes
+    for (bool changed = true; changed; ) {
+        changed = false;
+        
+        for (node_map::iterator bucket = m_Nodes.begin(); bucket != m_Nodes.end(); ) {
+            green_node::node_list& nodes = bucket->second;
+            
+            for (size_t nodeNum = 0; nodeNum < nodes.size(); ) {
+                if (nodes[nodeNum].unique()) {
+                    nodes[nodeNum] = nodes.back();
+                    nodes.pop_back();
+                    ++removed;
+                    changed = true;
+                } else {
+                    ++nodeNum;
+                }
+            }
+            
+            if (nodes.empty()) {
+                m_Nodes.erase(bucket++);
+            } else {
+                ++bucket;
+            }
+        }
+    }
+    
+    m_Count -= removed;
+    return removed;
+}
+
+/// \brief Removes all of the nodes from this table
+void green_node_table::clear() {
+    m_Nodes.clear();
+    m_Count     = 0;
+    m_Reused    = 0;
+}
+
+/// \brief The child with the specified index
+red_node red_node::child(size_t index) const {
+    const green_node::node_list& children = m_Green->children();
+    if (index >= children.size()) return red_node();
+    
+    size_t offset = m_Offset;
+    for (size_t childNum = 0; childNum < index; ++childNum) {
+        offset += children[childNum]->width();
+    }
+    
+    return red_node(children[index], offset);
+}
+
+/// \brief The deepest token or trivia node covering the specified offset, or an invalid node if the offset is outside this node
+red_node red_node::find_symbol(size_t offset) const {
+    if (!is_valid() || offset < m_Offset || offset >= end_offset()) return red_node();
+    
+    green_node_container    node        = m_Green;
+    size_t                  nodeOffset  = m_Offset;
+    
+    for (;;) {
+        // The text of a token comes after its trivia
+        if (node->node_kind() == green_node::token && offset >= nodeOffset + node->leading_width()) {
+            return red_node(node, nodeOffset);
+        }
+        
+        // Move to the child that contains the offset
+        const green_node::node_list&    children    = node->children();
+        bool                            found       = false;
+        
+        for (green_node::node_list::const_iterator child = children.begin(); child != children.end(); ++child) {
+            if (offset < nodeOffset + (*child)->width()) {
+                node    = *child;
+                found   = true;
+                break;
+            }
+            nodeOffset += (*child)->width();
+        }
+        
+        if (!found) return red_node(node, nodeOffset);
+    }
+}
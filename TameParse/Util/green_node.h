@@ -0,0 +1,326 @@
+//
+//  green_node.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _UTIL_GREEN_NODE_H
+#define _UTIL_GREEN_NODE_H
+
+#include <vector>
+#include <stdint.h>
+
+#include "TameParse/Util/container.h"
+#include "TameParse/Util/hash_map.h"
+#include "TameParse/Util/refcounted.h"
+
+namespace util {
+    class green_node;
+    typedef intrusive_container<green_node> green_node_container;
+    
+    ///
+    /// \brief Immutable node of a lossless syntax tree that records widths instead of positions
+    ///
+    /// Green nodes don't know where they are in the text or what their parent is, so an unchanged subtree can be used
+    /// in any number of trees: in successive versions of the same document, or in different documents (see
+    /// green_node_table). Every symbol of the input is in the tree: tokens carry the text that the parser ignored
+    /// before them (comments and whitespace, say) as a list of trivia nodes, so writing out the text of the tokens and
+    /// their trivia in order gives back the original input.
+    ///
+    /// Positions are worked out as the tree is walked by the red_node class.
+    ///
+    class green_node : public refcounted {
+    public:
+        /// \brief The kinds of green node
+        enum kind {
+            /// \brief A terminal symbol that was shifted by the parser, with the trivia before it
+            token,
+            
+            /// \brief A symbol that the parser did not shift (usually whitespace or a comment)
+            trivia,
+            
+            /// \brief A nonterminal symbol, which contains the nodes for the symbols it was reduced from
+            nonterminal
+        };
+        
+        /// \brief List of green nodes
+        typedef std::vector<green_node_container> node_list;
+        
+        /// \brief The text of a token or trivia node
+        typedef std::vector<int> text;
+        
+        /// \brief Type of the hash code for a node
+        typedef uint64_t hash_code;
+    
+    private:
+        /// \brief The kind of node that this is
+        kind m_Kind;
+        
+        /// \brief The terminal symbol or the identifier of the nonterminal item for this node
+        int m_Symbol;
+        
+        /// \brief The rule that was reduced for a nonterminal node, or -1
+        int m_Rule;
+        
+        /// \brief The number of symbols covered by this node, including the trivia
+        size_t m_Width;
+        
+        /// \brief The number of symbols of trivia before the text of the first token in this node
+        size_t m_LeadingWidth;
+        
+        /// \brief The hash code for this node
+        hash_code m_Hash;
+        
+        /// \brief The text of a token or trivia node (empty for nonterminals)
+        text m_Text;
+        
+        /// \brief The children of a nonterminal node, or the trivia before a token
+        node_list m_Children;
+        
+        green_node(const green_node& copyFrom);
+        green_node& operator=(const green_node& assignFrom);
+        
+        /// \brief Works out the width and hash code for this node once the children are known
+        void finish();
+    
+    public:
+        /// \brief Adds a value to a hash code
+        inline static hash_code mix(hash_code hash, uint64_t value) {
+            return (hash ^ value) * 1099511628211ULL;
+        }
+        
+        /// \brief The hash code for a node of the specified kind, symbol and text, with the specified children
+        template<typename iterator> static hash_code hash(kind nodeKind, int symbol, int rule, const int* firstSymbol, const int* lastSymbol, iterator firstChild, iterator lastChild) {
+            hash_code result = mix(mix(mix(14695981039346656037ULL, (uint64_t) nodeKind), (uint64_t) symbol), (uint64_t) rule);
+            for (const int* textSymbol = firstSymbol; textSymbol != lastSymbol; ++textSymbol) {
+                result = mix(result, (uint64_t) *textSymbol);
+            }
+            
+            // Children are hashed by pointer, as identical children are expected to be shared
+            for (iterator child = firstChild; child != lastChild; ++child) {
+                result = mix(result, (uint64_t) (uintptr_t) child->item());
+            }
+            return result;
+        }
+        
+        /// \brief Creates an empty nonterminal node (used as a placeholder by the parser)
+        green_node();
+        
+        /// \brief Creates a trivia node, or a token node with no trivia
+        green_node(kind nodeKind, int symbol, const int* firstSymbol, const int* lastSymbol);
+        
+        /// \brief Creates a token node with the specified trivia before it
+        green_node(int symbol, const int* firstSymbol, const int* lastSymbol, const node_list& trivia);
+        
+        /// \brief Creates a nonterminal node with the specified children
+        template<typename iterator> green_node(int itemIdentifier, int rule, iterator firstChild, iterator lastChild)
+        : m_Kind(nonterminal)
+        , m_Symbol(itemIdentifier)
+        , m_Rule(rule)
+        , m_Children(firstChild, lastChild) {
+            finish();
+        }
+        
+        /// \brief Destructor (takes apart deep trees without recursing)
+        ~green_node();
+        
+        /// \brief The kind of node that this is
+        inline kind node_kind() const { return m_Kind; }
+        
+        /// \brief The terminal symbol matched for a token or trivia node, or the item identifier for a nonterminal
+        inline int symbol() const { return m_Symbol; }
+        
+        /// \brief The rule that was reduced for a nonterminal node, or -1 for other nodes
+        inline int rule() const { return m_Rule; }
+        
+        /// \brief The number of symbols of input covered by this node, including all of its trivia
+        inline size_t width() const { return m_Width; }
+        
+        /// \brief The number of symbols of trivia before the text of the first token in this node
+        inline size_t leading_width() const { return m_LeadingWidth; }
+        
+        /// \brief The hash code for this node
+        inline hash_code hash() const { return m_Hash; }
+        
+        /// \brief The text of a token or trivia node, without any trivia
+        inline const text& get_text() const { return m_Text; }
+        
+        /// \brief The children of a nonterminal, or the trivia before a token
+        inline const node_list& children() const { return m_Children; }
+        
+        /// \brief Appends all of the text covered by this node (including the trivia) to the specified vector
+        void append_text(text& target) const;
+        
+        /// \brief True if this node has the same kind, symbol, rule, text and children (compared by pointer) as the specified values
+        template<typename iterator> bool same_as(kind nodeKind, int symbol, int rule, const int* firstSymbol, const int* lastSymbol, iterator firstChild, iterator lastChild) const {
+            if (m_Kind != nodeKind || m_Symbol != symbol || m_Rule != rule) return false;
+            if (m_Text.size() != (size_t) (lastSymbol - firstSymbol)) return false;
+            
+            text::const_iterator ourSymbol = m_Text.begin();
+            for (const int* textSymbol = firstSymbol; textSymbol != lastSymbol; ++textSymbol, ++ourSymbol) {
+                if (*textSymbol != *ourSymbol) return false;
+            }
+            
+            node_list::const_iterator ourChild = m_Children.begin();
+            iterator child = firstChild;
+            for (; child != lastChild && ourChild != m_Children.end(); ++child, ++ourChild) {
+                if (child->item() != ourChild->item()) return false;
+            }
+            
+            return child == lastChild && ourChild == m_Children.end();
+        }
+    };
+    
+    ///
+    /// \brief Table of green nodes used to share identical subtrees
+    ///
+    /// Green nodes have no positions, so sharing them loses nothing. Keeping a table between parses means that the
+    /// subtrees for the parts of a document that weren't changed by an edit are the same nodes as before (so they
+    /// take up no extra memory, and an editor can find what changed by comparing pointers), and using one table for
+    /// several documents shares their common subtrees.
+    ///
+    /// The table holds a reference to every node in it: call remove_unused() to release the nodes that are no longer
+    /// part of any tree.
+    ///
+    class green_node_table {
+    private:
+        /// \brief The nodes in this table, grouped by hash code
+        typedef hash_map<green_node::hash_code, green_node::node_list>::type node_map;
+        
+        /// \brief The nodes in this table
+        node_map m_Nodes;
+        
+        /// \brief The number of nodes in this table
+        size_t m_Count;
+        
+        /// \brief The number of nodes that were found in the table instead of being created
+        size_t m_Reused;
+        
+        /// \brief Finds the node for a token or trivia node, creating it if needed
+        green_node_container find_terminal(green_node::kind nodeKind, int symbol, const int* firstSymbol, const int* lastSymbol, const green_node::node_list& trivia);
+        
+        green_node_table(const green_node_table& copyFrom);
+        green_node_table& operator=(const green_node_table& assignFrom);
+    
+    public:
+        /// \brief Creates an empty table
+        green_node_table();
+        
+        /// \brief Returns the trivia node with the specified symbol and text, creating it if needed
+        inline green_node_container get_trivia(int symbol, const int* firstSymbol, const int* lastSymbol) {
+            return find_terminal(green_node::trivia, symbol, firstSymbol, lastSymbol, green_node::node_list());
+        }
+        
+        /// \brief Returns the token node with the specified symbol, text and trivia, creating it if needed
+        inline green_node_container get_token(int symbol, const int* firstSymbol, const int* lastSymbol, const green_node::node_list& trivia) {
+            return find_terminal(green_node::token, symbol, firstSymbol, lastSymbol, trivia);
+        }
+        
+        /// \brief Returns the nonterminal node with the specified item, rule and children, creating it if needed
+        template<typename iterator> green_node_container get_nonterminal(int itemIdentifier, int rule, iterator firstChild, iterator lastChild) {
+            green_node::hash_code   hash    = green_node::hash(green_node::nonterminal, itemIdentifier, rule, (const int*) NULL, (const int*) NULL, firstChild, lastChild);
+            green_node::node_list&  bucket  = m_Nodes[hash];
+            
+            for (green_node::node_list::const_iterator candidate = bucket.begin(); candidate != bucket.end(); ++candidate) {
+                if ((*candidate)->same_as(green_node::nonterminal, itemIdentifier, rule, (const int*) NULL, (const int*) NULL, firstChild, lastChild)) {
+                    ++m_Reused;
+                    return *candidate;
+                }
+            }
+            
+            green_node_container result(new green_node(itemIdentifier, rule, firstChild, lastChild), true);
+            bucket.push_back(result);
+            ++m_Count;
+            return result;
+        }
+        
+        /// \brief Releases the nodes that are only referred to by this table, returning the number that were removed
+        size_t remove_unused();
+        
+        /// \brief Removes all of the nodes from this table
+        void clear();
+        
+        /// \brief The number of nodes in this table
+        inline size_t size() const { return m_Count; }
+        
+        /// \brief The number of times that an existing node was returned instead of a new one being created
+        inline size_t reused() const { return m_Reused; }
+    };
+    
+    ///
+    /// \brief Positioned view of a green node
+    ///
+    /// Red nodes are small values that are created as a tree is walked: each one is a green node together with the
+    /// offset where it starts, which is worked out from the widths of the nodes before it. Offsets count symbols from
+    /// the start of the text, and the offset of a node includes the trivia before its first token.
+    ///
+    class red_node {
+    private:
+        /// \brief The green node that this refers to
+        green_node_container m_Green;
+        
+        /// \brief The offset where the node starts
+        size_t m_Offset;
+    
+    public:
+        /// \brief Creates a red node that refers to nothing
+        red_node()
+        : m_Green(NULL, false)
+        , m_Offset(0) {
+        }
+        
+        /// \brief Creates a red node for a green node starting at the specified offset (usually a root at offset 0)
+        explicit red_node(const green_node_container& green, size_t offset = 0)
+        : m_Green(green)
+        , m_Offset(offset) {
+        }
+        
+        /// \brief True if this refers to a green node
+        inline bool is_valid() const { return m_Green.item() != NULL; }
+        
+        /// \brief The green node that this refers to
+        inline const green_node_container& green() const { return m_Green; }
+        
+        /// \brief The green node that this refers to
+        inline const green_node* operator->() const { return m_Green.item(); }
+        
+        /// \brief The offset where this node starts, including the trivia before its first token
+        inline size_t offset() const { return m_Offset; }
+        
+        /// \brief The offset of the text of the first token in this node, after its trivia
+        inline size_t text_offset() const { return m_Offset + m_Green->leading_width(); }
+        
+        /// \brief The offset just after the end of this node
+        inline size_t end_offset() const { return m_Offset + m_Green->width(); }
+        
+        /// \brief The number of children of this node (trivia for a token)
+        inline size_t count_children() const { return m_Green->children().size(); }
+        
+        /// \brief The child with the specified index
+        red_node child(size_t index) const;
+        
+        /// \brief The deepest token or trivia node covering the specified offset, or an invalid node if the offset is outside this node
+        red_node find_symbol(size_t offset) const;
+    };
+}
+
+#endif
@@ -0,0 +1,52 @@
+//
+//  hash_map.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _UTIL_HASH_MAP_H
+#define _UTIL_HASH_MAP_H
+
+#if __cplusplus >= 201103L
+#include <unordered_map>
+#else
+#include <map>
+#endif
+
+namespace util {
+    ///
+    /// \brief Chooses a hashed map type for lookups that don't depend on the order of the keys (hash_map<K, V>::type gives the map type)
+    ///
+    /// This is a std::unordered_map where C++11 is available, and a std::map otherwise, so code using it must only look up,
+    /// insert and copy entries and never rely on the order of iteration.
+    ///
+    template<typename Key, typename Value> struct hash_map {
+#if __cplusplus >= 201103L
+        typedef std::unordered_map<Key, Value> type;
+#else
+        typedef std::map<Key, Value> type;
+#endif
+    };
+}
+
+#endif
@@ -0,0 +1,130 @@
+//
+//  mapped_file.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#include <cstdio>
+#include <algorithm>
+
+#if !defined(_WIN32)
+#  include <sys/types.h>
+#  include <sys/stat.h>
+#  include <sys/mman.h>
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
+#include "TameParse/Util/mapped_file.h"
+
+using namespace std;
+using namespace util;
+
+/// \brief Opens the file with the specified name
+mapped_file::mapped_file(const std::string& filename)
+: m_Data(NULL)
+, m_Size(0)
+, m_IsOpen(false)
+, m_Allocated(false) {
+#if !defined(_WIN32)
+    // Try to map the file into memory
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        struct stat info;
+        
+        if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode)) {
+            m_Size = (size_t) info.st_size;
+            
+            if (m_Size == 0) {
+                // Empty files can't be mapped, but there's nothing to read anyway
+                m_IsOpen = true;
+            } else {
+                void* mapping = mmap(NULL, m_Size, PROT_READ, MAP_PRIVATE, fd, 0);
+                
+                if (mapping != MAP_FAILED) {
+                    m_Data      = (const unsigned char*) mapping;
+                    m_IsOpen    = true;
+                    
+                    // Files are usually lexed from start to finish
+                    madvise(mapping, m_Size, MADV_SEQUENTIAL);
+                }
+            }
+        }
+        
+        close(fd);
+    }
+    
+    if (m_IsOpen) return;
+    m_Size = 0;
+#endif
+    
+    // Fall back to reading the whole file into memory
+    FILE* file = fopen(filename.c_str(), "rb");
+    if (!file) return;
+    
+    // Read the file in blocks, growing the buffer as we go
+    size_t          capacity    = 65536;
+    unsigned char*  data        = new unsigned char[capacity];
+    
+    for (;;) {
+        if (m_Size == capacity) {
+            unsigned char* newData = new unsigned char[capacity * 2];
+            copy(data, data + m_Size, newData);
+            delete[] data;
+            
+            data        = newData;
+            capacity    *= 2;
+        }
+        
+        size_t numRead = fread(data + m_Size, 1, capacity - m_Size, file);
+        if (numRead == 0) break;
+        
+        m_Size += numRead;
+    }
+    
+    if (ferror(file)) {
+        // Couldn't read the file after all
+        delete[] data;
+        m_Size = 0;
+    } else {
+        m_Data      = data;
+        m_Allocated = true;
+        m_IsOpen    = true;
+    }
+    
+    fclose(file);
+}
+
+/// \brief Destructor: unmaps the file
+mapped_file::~mapped_file() {
+    if (!m_Data) return;
+    
+    if (m_Allocated) {
+        delete[] m_Data;
+    }
+#if !defined(_WIN32)
+    else {
+        munmap((void*) m_Data, m_Size);
+    }
+#endif
+}
@@ -0,0 +1,84 @@
+//
+//  mapped_file.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _UTIL_MAPPED_FILE_H
+#define _UTIL_MAPPED_FILE_H
+
+#include <string>
+#include <cstddef>
+
+namespace util {
+    ///
+    /// \brief Class that provides read-only access to the entire contents of a file in memory
+    ///
+    /// On systems that support it, the file is mapped into memory rather than read, so pages are only loaded as they
+    /// are accessed. On other systems, the whole file is read into a buffer when this object is created. Either way,
+    /// the contents remain valid and unchanged until this object is destroyed.
+    ///
+    class mapped_file {
+    private:
+        /// \brief The start of the file contents, or NULL if the file could not be opened (or is empty)
+        const unsigned char* m_Data;
+        
+        /// \brief The number of bytes in the file
+        size_t m_Size;
+        
+        /// \brief True if the file was opened successfully
+        bool m_IsOpen;
+        
+        /// \brief True if m_Data was allocated with new[] rather than mapped
+        bool m_Allocated;
+        
+        /// \brief Disabled copy constructor
+        mapped_file(const mapped_file& copyFrom);
+        
+        /// \brief Disabled assignment
+        mapped_file& operator=(const mapped_file& assignFrom);
+        
+    public:
+        /// \brief Opens the file with the specified name
+        ///
+        /// Check is_open() to see whether or not the file was opened successfully.
+        explicit mapped_file(const std::string& filename);
+        
+        /// \brief Destructor: unmaps the file
+        ~mapped_file();
+        
+        /// \brief True if the file was opened successfully
+        inline bool is_open() const { return m_IsOpen; }
+        
+        /// \brief The number of bytes in the file
+        inline size_t size() const { return m_Size; }
+        
+        /// \brief The first byte in the file
+        inline const unsigned char* begin() const { return m_Data; }
+        
+        /// \brief The byte after the last byte in the file
+        inline const unsigned char* end() const { return m_Data + m_Size; }
+    };
+}
+
+#endif
@@ -0,0 +1,106 @@
+//
+//  memory_resource.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include "TameParse/Util/memory_resource.h"
+#include "TameParse/Util/parallel.h"
+
+using namespace util;
+
+namespace {
+    ///
+    /// \brief Resource that uses the global operator new
+    ///
+    class heap_resource : public memory_resource {
+    protected:
+        virtual void* do_allocate(size_t size) {
+            return ::operator new(size);
+        }
+        
+        virtual void do_deallocate(void* memory, size_t size) {
+            ::operator delete(memory);
+        }
+    };
+    
+    /// \brief The heap resource (never destroyed, so objects can be freed during static destruction)
+    static heap_resource* heap_instance() {
+        static heap_resource* instance = new heap_resource();
+        return instance;
+    }
+    
+    /// \brief The current resource for this thread, or NULL for the heap
+    static TAMEPARSE_THREAD_LOCAL memory_resource* s_Current = NULL;
+}
+
+/// \brief Destructor
+memory_resource::~memory_resource() {
+}
+
+/// \brief The resource that allocates memory using the global operator new
+memory_resource* memory_resource::heap() {
+    return heap_instance();
+}
+
+/// \brief The resource that objects created on this thread should allocate memory from
+memory_resource* memory_resource::current() {
+    return s_Current ? s_Current : heap_instance();
+}
+
+/// \brief True if the current resource for this thread is the heap
+bool memory_resource::current_is_heap() {
+    return s_Current == NULL;
+}
+
+/// \brief Changes the current resource for this thread, returning the previous one
+memory_resource* memory_resource::set_current(memory_resource* resource) {
+    memory_resource* previous = current();
+    s_Current = resource == heap_instance() ? NULL : resource;
+    return previous;
+}
+
+/// \brief Creates a resource with its own arena
+arena_resource::arena_resource(size_t slabSize)
+: m_Arena(new arena(slabSize))
+, m_OwnsArena(true) {
+}
+
+/// \brief Creates a resource that allocates from an existing arena
+arena_resource::arena_resource(arena& fromArena)
+: m_Arena(&fromArena)
+, m_OwnsArena(false) {
+}
+
+/// \brief Destructor
+arena_resource::~arena_resource() {
+    if (m_OwnsArena) delete m_Arena;
+}
+
+/// \brief Allocates memory from the arena
+void* arena_resource::do_allocate(size_t size) {
+    return m_Arena->allocate(size);
+}
+
+/// \brief Does nothing (the memory is freed with the arena)
+void arena_resource::do_deallocate(void* memory, size_t size) {
+}
@@ -0,0 +1,224 @@
+//
+//  memory_resource.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _UTIL_MEMORY_RESOURCE_H
+#define _UTIL_MEMORY_RESOURCE_H
+
+#include <cstddef>
+#include <new>
+
+#include "TameParse/Util/arena.h"
+
+namespace util {
+    ///
+    /// \brief Source of memory for the objects created while lexing and parsing
+    ///
+    /// Each thread has a current resource, which is the heap unless it has been changed with a memory_resource_scope.
+    /// Lexemes, parser sessions and states, the entries of parser stacks, the lookahead, AST nodes and any other
+    /// arena_object created with no arena (such as the nodes of generated ASTs built with the pooled-ast option) take
+    /// their memory from the resource that was current when they were created, and give it back to the same resource
+    /// when they are destroyed. Subclasses can supply memory from an arena, a fixed buffer, a shared memory segment
+    /// or a different allocator.
+    ///
+    /// A resource must outlast everything allocated from it. Resources don't need to be thread-safe unless the objects
+    /// allocated from them are freed on a different thread.
+    ///
+    class memory_resource {
+    public:
+        /// \brief Destructor
+        virtual ~memory_resource();
+        
+        /// \brief Allocates the specified number of bytes, aligned suitably for any type
+        ///
+        /// This throws std::bad_alloc if the memory can't be allocated.
+        inline void* allocate(size_t size) { return do_allocate(size); }
+        
+        /// \brief Frees memory allocated by allocate() (size must be the size that was requested)
+        inline void deallocate(void* memory, size_t size) { if (memory) do_deallocate(memory, size); }
+        
+        /// \brief The resource that allocates memory using the global operator new
+        static memory_resource* heap();
+        
+        /// \brief The resource that objects created on this thread should allocate memory from
+        static memory_resource* current();
+        
+        /// \brief Changes the current resource for this thread, returning the previous one (NULL restores the heap)
+        static memory_resource* set_current(memory_resource* resource);
+        
+        /// \brief True if the current resource for this thread is the heap
+        static bool current_is_heap();
+    
+    protected:
+        /// \brief Allocates memory for allocate()
+        virtual void* do_allocate(size_t size) = 0;
+        
+        /// \brief Frees memory for deallocate()
+        virtual void do_deallocate(void* memory, size_t size) = 0;
+    };
+    
+    ///
+    /// \brief Memory resource that allocates from an arena, and frees nothing until the arena is cleared
+    ///
+    /// This suits per-request work: everything allocated while parsing a document goes away in one go when the arena
+    /// is cleared, after the objects allocated from it have been destroyed.
+    ///
+    class arena_resource : public memory_resource {
+    private:
+        /// \brief The arena that memory comes from
+        arena* m_Arena;
+        
+        /// \brief True if this object owns the arena
+        bool m_OwnsArena;
+        
+        /// \brief Disabled copy constructor
+        arena_resource(const arena_resource& copyFrom);
+        
+        /// \brief Disabled assignment
+        arena_resource& operator=(const arena_resource& assignFrom);
+    
+    public:
+        /// \brief Creates a resource with its own arena, which allocates memory in slabs of the specified size
+        explicit arena_resource(size_t slabSize = arena::c_DefaultSlabSize);
+        
+        /// \brief Creates a resource that allocates from an existing arena, which must outlast it
+        explicit arena_resource(arena& fromArena);
+        
+        /// \brief Destructor
+        virtual ~arena_resource();
+        
+        /// \brief The arena that this resource allocates from
+        inline arena& get_arena() const { return *m_Arena; }
+    
+    protected:
+        /// \brief Allocates memory from the arena
+        virtual void* do_allocate(size_t size);
+        
+        /// \brief Does nothing (the memory is freed with the arena)
+        virtual void do_deallocate(void* memory, size_t size);
+    };
+    
+    ///
+    /// \brief Makes a resource current on this thread for as long as this object exists
+    ///
+    /// The resource that was current before is restored by the destructor, so scopes can be nested.
+    ///
+    class memory_resource_scope {
+    private:
+        /// \brief The resource to restore
+        memory_resource* m_Previous;
+        
+        /// \brief Disabled copy constructor
+        memory_resource_scope(const memory_resource_scope& copyFrom);
+        
+        /// \brief Disabled assignment
+        memory_resource_scope& operator=(const memory_resource_scope& assignFrom);
+    
+    public:
+        /// \brief Makes the specified resource current
+        explicit memory_resource_scope(memory_resource* resource)
+        : m_Previous(memory_resource::set_current(resource)) {
+        }
+        
+        /// \brief Restores the resource that was current before
+        ~memory_resource_scope() {
+            memory_resource::set_current(m_Previous);
+        }
+    };
+    
+    ///
+    /// \brief Standard library allocator that takes its memory from a memory_resource
+    ///
+    /// Allocators created with the default constructor use the resource that is current at the time, so containers
+    /// with this allocator use the resource that was current when they were created.
+    ///
+    template<typename T> class resource_allocator {
+    public:
+        typedef T               value_type;
+        typedef T*              pointer;
+        typedef const T*        const_pointer;
+        typedef T&              reference;
+        typedef const T&        const_reference;
+        typedef size_t          size_type;
+        typedef std::ptrdiff_t  difference_type;
+        
+        template<typename U> struct rebind {
+            typedef resource_allocator<U> other;
+        };
+    
+    private:
+        template<typename U> friend class resource_allocator;
+        
+        /// \brief The resource that memory comes from
+        memory_resource* m_Resource;
+    
+    public:
+        /// \brief Creates an allocator for the current resource
+        resource_allocator()
+        : m_Resource(memory_resource::current()) {
+        }
+        
+        /// \brief Creates an allocator for the specified resource
+        resource_allocator(memory_resource* resource)
+        : m_Resource(resource ? resource : memory_resource::heap()) {
+        }
+        
+        /// \brief Copies an allocator for another type
+        template<typename U> resource_allocator(const resource_allocator<U>& copyFrom)
+        : m_Resource(copyFrom.m_Resource) {
+        }
+        
+        /// \brief The resource used by this allocator
+        inline memory_resource* resource() const { return m_Resource; }
+        
+        inline pointer address(reference value) const { return &value; }
+        inline const_pointer address(const_reference value) const { return &value; }
+        
+        /// \brief Allocates space for count objects
+        inline pointer allocate(size_type count, const void* hint = 0) {
+            return static_cast<pointer>(m_Resource->allocate(count * sizeof(T)));
+        }
+        
+        /// \brief Frees space for count objects
+        inline void deallocate(pointer memory, size_type count) {
+            m_Resource->deallocate(memory, count * sizeof(T));
+        }
+        
+        inline size_type max_size() const { return ((size_type) -1) / sizeof(T); }
+        
+        inline void construct(pointer memory, const T& value) { new (static_cast<void*>(memory)) T(value); }
+        inline void destroy(pointer memory) { memory->~T(); }
+        
+        /// \brief Allocators are equal if they use the same resource
+        template<typename U> inline bool operator==(const resource_allocator<U>& compareTo) const {
+            return m_Resource == compareTo.m_Resource;
+        }
+        
+        template<typename U> inline bool operator!=(const resource_allocator<U>& compareTo) const {
+            return m_Resource != compareTo.m_Resource;
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,147 @@
+//
+//  parallel.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _UTIL_PARALLEL_H
+#define _UTIL_PARALLEL_H
+
+#include <cstdlib>
+
+#if __cplusplus >= 201103L
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#endif
+
+/// \brief Storage class for statics that each thread should have its own copy of
+///
+/// This is used for free lists and counters that are updated without locking. The static util::containers for the empty
+/// items that every grammar uses are also declared with this: their reference counts are atomic with C++11, so this
+/// only stops grammars that are built on separate threads from all updating the same count.
+#if __cplusplus >= 201103L
+#define TAMEPARSE_THREAD_LOCAL thread_local
+#else
+#define TAMEPARSE_THREAD_LOCAL
+#endif
+
+namespace util {
+    ///
+    /// \brief Calls task(index) for every index from 0 up to (but not including) count, using up to maxThreads threads
+    ///
+    /// The tasks are shared out between a pool of worker threads, each of which takes the next index that hasn't been
+    /// started yet until there are none left. The calling thread is one of the workers, and this returns once every
+    /// task has finished. Each index is passed to the task exactly once, but the order in which the calls are made is
+    /// not defined, so tasks should only write to results that belong to their own index.
+    ///
+    /// If maxThreads is 0 then one thread is used for each processor core. The tasks are run in order on the calling
+    /// thread if maxThreads is 1, if there is only one task or if C++11 thread support is unavailable.
+    ///
+    template<typename Task> void parallel_for(size_t count, unsigned int maxThreads, Task& task) {
+#if __cplusplus >= 201103L
+        if (maxThreads == 0) maxThreads = std::thread::hardware_concurrency();
+        if (maxThreads > count) maxThreads = (unsigned int) count;
+        
+        if (maxThreads > 1) {
+            std::atomic<size_t>         nextIndex(0);
+            std::vector<std::thread>    workers;
+            
+            // Each worker claims indexes until they've all been handed out
+            auto worker = [&nextIndex, count, &task]() {
+                for (size_t index = nextIndex++; index < count; index = nextIndex++) {
+                    task(index);
+                }
+            };
+            
+            for (unsigned int threadIndex = 1; threadIndex < maxThreads; ++threadIndex) {
+                workers.push_back(std::thread(worker));
+            }
+            
+            worker();
+            
+            for (std::vector<std::thread>::iterator thread = workers.begin(); thread != workers.end(); ++thread) {
+                thread->join();
+            }
+            
+            return;
+        }
+#endif
+        
+        // Run the tasks on this thread
+        for (size_t index = 0; index < count; ++index) {
+            task(index);
+        }
+    }
+    
+    ///
+    /// \brief A gate that threads can wait at until another thread opens it
+    ///
+    /// Once opened, a gate stays open. Without C++11 thread support there is only ever one thread, so waiting does
+    /// nothing: code that uses a gate must make sure that it is opened before anything waits for it when the tasks
+    /// run one after the other (parallel_for runs them in order of their index in this case).
+    ///
+    class gate {
+    private:
+        gate(const gate& copyFrom);
+        gate& operator=(const gate& copyFrom);
+        
+#if __cplusplus >= 201103L
+        /// \brief Protects m_Open
+        std::mutex m_Lock;
+        
+        /// \brief Signalled when the gate is opened
+        std::condition_variable m_Opened;
+#endif
+        
+        /// \brief True once the gate has been opened
+        bool m_Open;
+        
+    public:
+        /// \brief Creates a closed gate
+        gate() : m_Open(false) { }
+        
+        /// \brief Opens this gate, releasing any threads that are waiting for it
+        inline void open() {
+#if __cplusplus >= 201103L
+            std::lock_guard<std::mutex> lock(m_Lock);
+            m_Open = true;
+            m_Opened.notify_all();
+#else
+            m_Open = true;
+#endif
+        }
+        
+        /// \brief Waits until this gate has been opened
+        inline void wait() {
+#if __cplusplus >= 201103L
+            std::unique_lock<std::mutex> lock(m_Lock);
+            while (!m_Open) m_Opened.wait(lock);
+#endif
+        }
+    };
+}
+
+#endif
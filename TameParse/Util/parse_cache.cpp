@@ -0,0 +1,154 @@
+//
+//  parse_cache.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "TameParse/Util/parse_cache.h"
+
+using namespace std;
+using namespace util;
+
+/// \brief Identifies cache entries (the last byte is the version of the format)
+///
+/// Version 2 stores positions, offsets and lengths as 64-bit values, so entries written with version 1 are treated
+/// as misses instead of being misread.
+static const uint32_t c_EntryMagic = 0x54504302;
+
+/// \brief Adds some bytes to an FNV-1a hash
+static parse_cache::hash_code add_bytes(parse_cache::hash_code hash, const char* bytes, size_t count) {
+    for (size_t pos = 0; pos < count; ++pos) {
+        hash = (hash ^ (unsigned char) bytes[pos]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+/// \brief Creates a cache that stores its entries in the specified directory
+parse_cache::parse_cache(const std::string& directory, const std::string& language)
+: m_Directory(directory) {
+    // Make sure entries are always inside the directory
+    if (!m_Directory.empty() && m_Directory[m_Directory.size()-1] != '/') {
+        m_Directory += '/';
+    }
+    
+    // Include the length of the name, so it can't be confused with the start of the content
+    uint64_t nameLength = language.size();
+    m_LanguageHash = add_bytes(14695981039346656037ULL, (const char*) &nameLength, sizeof(nameLength));
+    m_LanguageHash = add_bytes(m_LanguageHash, language.data(), language.size());
+}
+
+/// \brief The hash of the specified content, which identifies its cache entry
+parse_cache::hash_code parse_cache::key(const char* content, size_t length) const {
+    return add_bytes(m_LanguageHash, content, length);
+}
+
+/// \brief The name of the file that stores the entry for the specified content
+std::string parse_cache::filename(const char* content, size_t length) const {
+    stringstream result;
+    result << m_Directory;
+    result.fill('0');
+    result.width(16);
+    result << hex << key(content, length) << ".ast";
+    return result.str();
+}
+
+/// \brief Opens the entry for the specified content, returning NULL if there isn't a valid one
+std::istream* parse_cache::open_entry(const char* content, size_t length) const {
+    ifstream* entry = new ifstream(filename(content, length).c_str(), ios::in | ios::binary);
+    
+    entry_header header;
+    entry->read((char*) &header, sizeof(header));
+    
+    if (!entry->good() || header.magic != c_EntryMagic || header.length != length || header.key != key(content, length)) {
+        delete entry;
+        return NULL;
+    }
+    
+    return entry;
+}
+
+/// \brief Starts writing a new entry for the specified content, returning NULL if it can't be created
+std::ostream* parse_cache::create_entry(const char* content, size_t length) const {
+    // The entry is written to a temporary file first, so a partially written entry is never used
+    ofstream* entry = new ofstream((filename(content, length) + ".tmp").c_str(), ios::out | ios::binary | ios::trunc);
+    
+    entry_header header;
+    header.magic    = c_EntryMagic;
+    header.reserved = 0;
+    header.length   = length;
+    header.key      = key(content, length);
+    
+    entry->write((const char*) &header, sizeof(header));
+    
+    if (entry->fail()) {
+        delete entry;
+        return NULL;
+    }
+    
+    return entry;
+}
+
+/// \brief Finishes an entry started by create_entry(), returning false if it couldn't be written
+bool parse_cache::commit_entry(std::ostream* entry, const char* content, size_t length) const {
+    string  name    = filename(content, length);
+    string  temp    = name + ".tmp";
+    
+    entry->flush();
+    bool ok = !entry->fail();
+    delete entry;
+    
+    // Move the finished entry into place
+    if (ok) {
+        ok = rename(temp.c_str(), name.c_str()) == 0;
+    }
+    
+    if (!ok) {
+        remove(temp.c_str());
+    }
+    
+    return ok;
+}
+
+/// \brief Retrieves the AST stored for the specified content, returning false if there isn't one
+bool parse_cache::load(const std::string& content, astnode_container& tree) const {
+    istream* entry = open_entry(content.data(), content.size());
+    if (!entry) return false;
+    
+    bool result = astnode::read(*entry, tree);
+    delete entry;
+    return result;
+}
+
+/// \brief Stores an AST for the specified content, returning false if it couldn't be stored
+bool parse_cache::store(const std::string& content, const astnode_container& tree) const {
+    if (!tree.item()) return false;
+    
+    ostream* entry = create_entry(content.data(), content.size());
+    if (!entry) return false;
+    
+    tree->write(*entry);
+    return commit_entry(entry, content.data(), content.size());
+}
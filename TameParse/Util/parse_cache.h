@@ -0,0 +1,120 @@
+//
+//  parse_cache.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _UTIL_PARSE_CACHE_H
+#define _UTIL_PARSE_CACHE_H
+
+#include <string>
+#include <iostream>
+#include <stdint.h>
+
+#include "TameParse/Util/astnode.h"
+
+namespace util {
+    ///
+    /// \brief Cache of the results of parsing files, keyed on a hash of their content
+    ///
+    /// Each entry is a file in the cache directory containing a tree written in binary form. Anything with write()
+    /// and read() functions can be stored (such as flat_ast or lr::syntax_tape), as can trees of astnodes. An entry is
+    /// only used if it was stored for content with the same hash and length, so a changed file is always parsed again.
+    ///
+    /// The language name is added to the key, so that caches for different languages can share a directory. Entries
+    /// are written in the native byte order, so a cache directory shouldn't be shared between different kinds of
+    /// machine.
+    ///
+    class parse_cache {
+    public:
+        /// \brief Type of the hash code used to identify cache entries
+        typedef uint64_t hash_code;
+        
+    private:
+        /// \brief The directory where the cache entries are stored
+        std::string m_Directory;
+        
+        /// \brief The hash of the language name, which is the starting point for the hash of each entry
+        hash_code m_LanguageHash;
+        
+        /// \brief The header written at the start of each entry
+        struct entry_header {
+            /// \brief Identifies the file as a cache entry, and the version of the format
+            uint32_t magic;
+            
+            /// \brief Unused
+            uint32_t reserved;
+            
+            /// \brief The length of the content that the entry is for
+            uint64_t length;
+            
+            /// \brief The hash of the content that the entry is for
+            hash_code key;
+        };
+        
+        /// \brief Opens the entry for the specified content, returning NULL if there isn't a valid one
+        std::istream* open_entry(const char* content, size_t length) const;
+        
+        /// \brief Starts writing a new entry for the specified content, returning NULL if it can't be created
+        std::ostream* create_entry(const char* content, size_t length) const;
+        
+        /// \brief Finishes an entry started by create_entry(), returning false if it couldn't be written
+        bool commit_entry(std::ostream* entry, const char* content, size_t length) const;
+        
+    public:
+        /// \brief Creates a cache that stores its entries in the specified directory
+        explicit parse_cache(const std::string& directory, const std::string& language = std::string());
+        
+        /// \brief The hash of the specified content, which identifies its cache entry
+        hash_code key(const char* content, size_t length) const;
+        
+        /// \brief The name of the file that stores the entry for the specified content
+        std::string filename(const char* content, size_t length) const;
+        
+        /// \brief Retrieves the tree stored for the specified content, returning false if there isn't one
+        template<typename tree_type> bool load(const std::string& content, tree_type& tree) const {
+            std::istream* entry = open_entry(content.data(), content.size());
+            if (!entry) return false;
+            
+            bool result = tree.read(*entry);
+            delete entry;
+            return result;
+        }
+        
+        /// \brief Retrieves the AST stored for the specified content, returning false if there isn't one
+        bool load(const std::string& content, astnode_container& tree) const;
+        
+        /// \brief Stores a tree for the specified content, returning false if it couldn't be stored
+        template<typename tree_type> bool store(const std::string& content, const tree_type& tree) const {
+            std::ostream* entry = create_entry(content.data(), content.size());
+            if (!entry) return false;
+            
+            tree.write(*entry);
+            return commit_entry(entry, content.data(), content.size());
+        }
+        
+        /// \brief Stores an AST for the specified content, returning false if it couldn't be stored
+        bool store(const std::string& content, const astnode_container& tree) const;
+    };
+}
+
+#endif
@@ -0,0 +1,183 @@
+//
+//  placed_memory.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#if defined(__linux__)
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+#include "TameParse/Util/placed_memory.h"
+
+using namespace std;
+using namespace util;
+
+#if defined(__linux__)
+
+/// \brief The size of a huge page
+static const size_t c_HugePageSize = 2 * 1024 * 1024;
+
+/// \brief The mbind policy that prefers a node without failing if it is full (from numaif.h)
+static const int c_PreferNode = 1;
+
+#endif
+
+/// \brief The number of NUMA nodes in this machine (1 if this can't be found out)
+int util::count_numa_nodes() {
+    int numNodes = 1;
+
+#if defined(__linux__)
+    // The online nodes are listed as ranges, like '0-1,3'
+    FILE* online = fopen("/sys/devices/system/node/online", "r");
+    if (!online) return 1;
+    
+    int first, last;
+    while (fscanf(online, "%d", &first) == 1) {
+        last = first;
+        
+        int separator = fgetc(online);
+        if (separator == '-') {
+            if (fscanf(online, "%d", &last) != 1) break;
+            separator = fgetc(online);
+        }
+        
+        if (last + 1 > numNodes) numNodes = last + 1;
+        if (separator != ',') break;
+    }
+    
+    fclose(online);
+#endif
+    
+    return numNodes;
+}
+
+/// \brief The NUMA node that the calling thread is running on (0 if this can't be found out)
+int util::current_numa_node() {
+#if defined(__linux__) && defined(SYS_getcpu)
+    unsigned int cpu    = 0;
+    unsigned int node   = 0;
+    
+    if (syscall(SYS_getcpu, &cpu, &node, NULL) == 0) {
+        return (int) node;
+    }
+#endif
+    
+    return 0;
+}
+
+/// \brief Copies the specified data
+placed_memory::placed_memory(const void* data, size_t size, bool hugePages, int numaNode)
+: m_Data(NULL)
+, m_Size(size)
+, m_Mapped(0)
+, m_HugePages(false)
+, m_OnNode(false) {
+#if defined(__linux__)
+    // Round up to a whole number of pages (of the size that we're hoping to use)
+    size_t pageSize = hugePages ? c_HugePageSize : (size_t) sysconf(_SC_PAGESIZE);
+    size_t length   = (size + pageSize - 1) / pageSize * pageSize;
+    if (length == 0) length = pageSize;
+    
+    void* mapping = MAP_FAILED;
+
+#  ifdef MAP_HUGETLB
+    // Explicit huge pages only work if the administrator has reserved some
+    if (hugePages) {
+        mapping = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (mapping != MAP_FAILED) m_HugePages = true;
+    }
+#  endif
+    
+    if (mapping == MAP_FAILED) {
+        // Transparent huge pages must start on a huge page boundary, so map an extra page and trim to an aligned range
+        size_t  extra       = hugePages ? pageSize : 0;
+        void*   oversized   = mmap(NULL, length + extra, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        
+        if (oversized != MAP_FAILED) {
+            unsigned char*  start   = (unsigned char*) oversized;
+            unsigned char*  aligned = start;
+            
+            if (extra) {
+                aligned = (unsigned char*) (((size_t) start + pageSize - 1) / pageSize * pageSize);
+                if (aligned != start) munmap(start, (size_t) (aligned - start));
+                if (start + extra != aligned) munmap(aligned + length, (size_t) (start + extra - aligned));
+            }
+            
+            mapping = aligned;
+
+#  ifdef MADV_HUGEPAGE
+            if (hugePages && madvise(mapping, length, MADV_HUGEPAGE) == 0) m_HugePages = true;
+#  endif
+        }
+    }
+    
+    if (mapping != MAP_FAILED) {
+#  if defined(SYS_mbind)
+        // Pages are placed when they're first written, so the node must be chosen before the data is copied
+        if (numaNode >= 0) {
+            const size_t            bitsPerWord = sizeof(unsigned long) * 8;
+            vector<unsigned long>   nodeMask((size_t) numaNode / bitsPerWord + 1, 0);
+            
+            nodeMask[(size_t) numaNode / bitsPerWord] |= 1ul << ((size_t) numaNode % bitsPerWord);
+            
+            if (syscall(SYS_mbind, mapping, length, c_PreferNode, &nodeMask[0], nodeMask.size() * bitsPerWord + 1, 0) == 0) {
+                m_OnNode = true;
+            }
+        }
+#  endif
+        
+        m_Data      = (unsigned char*) mapping;
+        m_Mapped    = length;
+        
+        if (size > 0) memcpy(m_Data, data, size);
+        
+        // Nothing should change the tables once they're loaded
+        mprotect(m_Data, m_Mapped, PROT_READ);
+        return;
+    }
+    
+    m_HugePages = false;
+#endif
+    
+    // Fall back to an ordinary allocation (which will be aligned well enough for any of the tables)
+    m_Data = new unsigned char[size > 0 ? size : 1];
+    if (size > 0) memcpy(m_Data, data, size);
+}
+
+/// \brief Destructor
+placed_memory::~placed_memory() {
+#if defined(__linux__)
+    if (m_Mapped) {
+        munmap(m_Data, m_Mapped);
+        return;
+    }
+#endif
+    
+    delete[] m_Data;
+}
@@ -0,0 +1,103 @@
+//
+//  placed_memory.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _UTIL_PLACED_MEMORY_H
+#define _UTIL_PLACED_MEMORY_H
+
+#include <cstddef>
+
+namespace util {
+    /// \brief The number of NUMA nodes in this machine (1 if this can't be found out)
+    int count_numa_nodes();
+    
+    /// \brief The NUMA node that the calling thread is running on (0 if this can't be found out)
+    ///
+    /// Threads can move between nodes, so this is only a hint about which memory is closest to the caller.
+    int current_numa_node();
+    
+    ///
+    /// \brief A read-only copy of some data, placed in memory chosen for the threads that are going to read it
+    ///
+    /// Large tables that are read by many threads spend a lot of time in TLB misses, and on machines with several
+    /// NUMA nodes, reading them from another node's memory is slower again. This copies the data into memory that can
+    /// use 2MB huge pages and can prefer a particular node. Both requests are hints: if the system can't satisfy them
+    /// the data is stored in ordinary pages, and uses_huge_pages() or on_requested_node() return false.
+    ///
+    /// The copy is aligned to a page, so it can be passed to parser_tables::from_binary or binary_lexer::from_binary.
+    ///
+    class placed_memory {
+    private:
+        /// \brief The copy of the data
+        unsigned char* m_Data;
+        
+        /// \brief The number of bytes of data
+        size_t m_Size;
+        
+        /// \brief The number of bytes that were mapped for the data (0 if it was allocated with new[])
+        size_t m_Mapped;
+        
+        /// \brief True if the data is stored in huge pages (or the system was asked to use them)
+        bool m_HugePages;
+        
+        /// \brief True if the memory was bound to the node that was asked for
+        bool m_OnNode;
+        
+        /// \brief Disabled copy constructor
+        placed_memory(const placed_memory& copyFrom);
+        
+        /// \brief Disabled assignment
+        placed_memory& operator=(const placed_memory& assignFrom);
+    
+    public:
+        /// \brief Copies the specified data
+        ///
+        /// If hugePages is true, the copy is put in huge pages if possible. If numaNode is not negative, the copy is
+        /// put in the memory of that node if possible.
+        placed_memory(const void* data, size_t size, bool hugePages = false, int numaNode = -1);
+        
+        /// \brief Destructor
+        ~placed_memory();
+        
+        /// \brief The first byte of the copy
+        inline const unsigned char* begin() const { return m_Data; }
+        
+        /// \brief The byte after the last byte of the copy
+        inline const unsigned char* end() const { return m_Data + m_Size; }
+        
+        /// \brief The number of bytes in the copy
+        inline size_t size() const { return m_Size; }
+        
+        /// \brief True if the copy is in huge pages
+        ///
+        /// For transparent huge pages, this means that the system accepted the request: it may still choose to use
+        /// smaller pages for some of the memory.
+        inline bool uses_huge_pages() const { return m_HugePages; }
+        
+        /// \brief True if the copy was bound to the NUMA node that was requested
+        inline bool on_requested_node() const { return m_OnNode; }
+    };
+}
+
+#endif
@@ -0,0 +1,184 @@
+//
+//  refcounted.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _UTIL_REFCOUNTED_H
+#define _UTIL_REFCOUNTED_H
+
+#include <cstdlib>
+
+namespace util {
+    ///
+    /// \brief Base class for objects that store their own reference count
+    ///
+    /// Classes derived from this can be managed by intrusive_container or intrusive_ptr. These keep the count in
+    /// the object itself, so copying a reference never needs to allocate any bookkeeping. The count is not atomic:
+    /// objects should not be shared between threads.
+    ///
+    class refcounted {
+    private:
+        /// \brief The number of references to this object
+        mutable int m_RefCount;
+        
+    protected:
+        /// \brief Creates an object with no references
+        inline refcounted()
+        : m_RefCount(0) {
+        }
+        
+        /// \brief Copies of an object start with no references
+        inline refcounted(const refcounted& copyFrom)
+        : m_RefCount(0) {
+        }
+        
+        /// \brief Assignment does not change the number of references
+        inline refcounted& operator=(const refcounted& assignFrom) {
+            return *this;
+        }
+        
+        /// \brief Destructor
+        inline ~refcounted() { }
+        
+    public:
+        /// \brief Adds a reference to this object
+        inline void retain() const { ++m_RefCount; }
+        
+        /// \brief Removes a reference to this object, returning true if that was the last reference
+        inline bool release() const { return --m_RefCount <= 0; }
+        
+        /// \brief The number of references to this object
+        inline int reference_count() const { return m_RefCount; }
+    };
+    
+    ///
+    /// \brief Shared pointer for objects derived from refcounted, with the same interface as syntax_ptr
+    ///
+    /// The object is deleted when the last intrusive_ptr referring to it is destroyed. Unlike syntax_ptr, it's
+    /// fine to create more than one intrusive_ptr from the same raw pointer, as the count is kept in the object.
+    ///
+    template<typename ptr_type> class intrusive_ptr {
+    private:
+        /// \brief The object that this refers to
+        const ptr_type* m_Value;
+        
+        /// \brief Adds a reference to the object
+        inline void acquire() {
+            if (m_Value) m_Value->retain();
+        }
+        
+        /// \brief Removes a reference to the object, deleting it if this was the last one
+        inline void dispose() {
+            if (m_Value && m_Value->release()) {
+                delete m_Value;
+            }
+            m_Value = NULL;
+        }
+        
+    public:
+        /// \brief Default constructor, assigns the pointer to NULL
+        inline intrusive_ptr()
+        : m_Value(NULL) {
+        }
+        
+        /// \brief Refers to a specific pointer value
+        explicit inline intrusive_ptr(const ptr_type* value)
+        : m_Value(value) {
+            acquire();
+        }
+        
+        /// \brief Copy constructor
+        inline intrusive_ptr(const intrusive_ptr<ptr_type>& copyFrom)
+        : m_Value(copyFrom.m_Value) {
+            acquire();
+        }
+        
+        /// \brief Assignment
+        inline intrusive_ptr<ptr_type>& operator=(const intrusive_ptr<ptr_type>& assignFrom) {
+            if (m_Value == assignFrom.m_Value) return *this;
+            
+            // Acquire the new value before releasing the old one, in case one refers to the other
+            const ptr_type* oldValue = m_Value;
+            m_Value = assignFrom.m_Value;
+            acquire();
+            
+            if (oldValue && oldValue->release()) {
+                delete oldValue;
+            }
+            
+            return *this;
+        }
+        
+#if __cplusplus >= 201103L
+        /// \brief Move constructor (leaves the reference count unchanged)
+        inline intrusive_ptr(intrusive_ptr<ptr_type>&& moveFrom)
+        : m_Value(moveFrom.m_Value) {
+            moveFrom.m_Value = NULL;
+        }
+        
+        /// \brief Move assignment
+        inline intrusive_ptr<ptr_type>& operator=(intrusive_ptr<ptr_type>&& moveFrom) {
+            if (this == &moveFrom) return *this;
+            
+            const ptr_type* oldValue = m_Value;
+            m_Value             = moveFrom.m_Value;
+            moveFrom.m_Value    = NULL;
+            
+            if (oldValue && oldValue->release()) {
+                delete oldValue;
+            }
+            
+            return *this;
+        }
+#endif
+        
+        /// \brief Destructor
+        inline ~intrusive_ptr() {
+            dispose();
+        }
+        
+    public:
+        /// \brief Converts this object back to its underlying type
+        inline operator const ptr_type*() const { return m_Value; }
+        
+        /// \brief Evaluating this as a boolean returns whether or not the item is present
+        inline operator bool() const { return m_Value != NULL; }
+        
+        /// \brief Casts this pointer to a pointer of a different type (but maintains reference counting)
+        ///
+        /// As with syntax_ptr, this should only be used between classes with virtual destructors which are part
+        /// of the same hierarchy.
+        template<typename cast_type> inline intrusive_ptr<cast_type> cast_to() const {
+            return intrusive_ptr<cast_type>(static_cast<const cast_type*>(m_Value));
+        }
+        
+        // Other operators
+        
+        inline const ptr_type* operator->() const { return m_Value; }
+        inline const ptr_type& operator*() const { return *m_Value; }
+        
+        inline const ptr_type* item() const { return m_Value; }
+    };
+}
+
+#endif
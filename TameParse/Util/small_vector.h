@@ -0,0 +1,215 @@
+//
+//  small_vector.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _UTIL_SMALL_VECTOR_H
+#define _UTIL_SMALL_VECTOR_H
+
+#include <cstddef>
+#include <new>
+
+namespace util {
+    ///
+    /// \brief Vector that stores up to inline_count items inside the object itself, and only allocates memory from the
+    /// heap when more items are added
+    ///
+    /// This is intended for short lists, such as the children of a node in a syntax tree, where most instances hold
+    /// just a few items and a std::vector would need a separate allocation for each of them. Only the operations that
+    /// these lists need are supported: items can be appended, read and iterated over, and the whole list can be cleared.
+    ///
+    /// inline_count must be at least 1.
+    ///
+    template<typename item_type, size_t inline_count> class small_vector {
+    public:
+        /// \brief The type of an item in this vector
+        typedef item_type value_type;
+        
+        /// \brief Iterator type
+        typedef item_type* iterator;
+        
+        /// \brief Constant iterator type
+        typedef const item_type* const_iterator;
+        
+    private:
+        /// \brief Type used to align the inline storage
+        union max_align {
+            long double     ld;
+            long long       ll;
+            void*           ptr;
+            void            (*fn)();
+        };
+        
+        /// \brief Storage for the inline items
+        union inline_storage {
+            max_align   align;
+            char        bytes[sizeof(item_type) * inline_count];
+        };
+        
+        /// \brief The inline storage
+        inline_storage m_Inline;
+        
+        /// \brief The first item (either in the inline storage or in memory allocated from the heap)
+        item_type* m_Items;
+        
+        /// \brief The number of items in this vector
+        size_t m_Size;
+        
+        /// \brief The number of items that can be stored before the vector must grow
+        size_t m_Capacity;
+        
+        /// \brief The inline storage, as an array of items
+        inline item_type* inline_items() { return reinterpret_cast<item_type*>(m_Inline.bytes); }
+        
+        /// \brief Moves the items into storage with room for at least the specified number of items
+        void grow(size_t minCapacity) {
+            size_t newCapacity = m_Capacity * 2;
+            if (newCapacity < minCapacity) newCapacity = minCapacity;
+            
+            item_type* newItems = static_cast<item_type*>(::operator new(sizeof(item_type) * newCapacity));
+            for (size_t index = 0; index < m_Size; ++index) {
+#if __cplusplus >= 201103L
+                new (newItems + index) item_type(static_cast<item_type&&>(m_Items[index]));
+#else
+                new (newItems + index) item_type(m_Items[index]);
+#endif
+                m_Items[index].~item_type();
+            }
+            
+            if (!is_inline()) ::operator delete(m_Items);
+            
+            m_Items     = newItems;
+            m_Capacity  = newCapacity;
+        }
+        
+        /// \brief Appends copies of the items in another vector to this one
+        void append(const small_vector& copyFrom) {
+            reserve(m_Size + copyFrom.m_Size);
+            for (size_t index = 0; index < copyFrom.m_Size; ++index) {
+                new (m_Items + m_Size) item_type(copyFrom.m_Items[index]);
+                ++m_Size;
+            }
+        }
+        
+    public:
+        /// \brief Creates an empty vector
+        inline small_vector()
+        : m_Items(inline_items())
+        , m_Size(0)
+        , m_Capacity(inline_count) {
+        }
+        
+        /// \brief Copy constructor
+        small_vector(const small_vector& copyFrom)
+        : m_Items(inline_items())
+        , m_Size(0)
+        , m_Capacity(inline_count) {
+            append(copyFrom);
+        }
+        
+        /// \brief Assignment
+        small_vector& operator=(const small_vector& assignFrom) {
+            if (&assignFrom == this) return *this;
+            
+            clear();
+            append(assignFrom);
+            
+            return *this;
+        }
+        
+        /// \brief Destructor
+        ~small_vector() {
+            clear();
+            if (!is_inline()) ::operator delete(m_Items);
+        }
+        
+    public:
+        /// \brief Adds an item to the end of this vector
+        inline void push_back(const item_type& newItem) {
+            if (m_Size < m_Capacity) {
+                new (m_Items + m_Size) item_type(newItem);
+            } else {
+                // The new item might be in this vector, so copy it before the storage moves
+                item_type copy(newItem);
+                grow(m_Size + 1);
+                new (m_Items + m_Size) item_type(copy);
+            }
+            ++m_Size;
+        }
+        
+#if __cplusplus >= 201103L
+        /// \brief Moves an item to the end of this vector
+        inline void push_back(item_type&& newItem) {
+            if (m_Size >= m_Capacity) grow(m_Size + 1);
+            new (m_Items + m_Size) item_type(static_cast<item_type&&>(newItem));
+            ++m_Size;
+        }
+#endif
+        
+        /// \brief Makes sure that this vector can hold at least the specified number of items without allocating any more memory
+        inline void reserve(size_t capacity) {
+            if (capacity > m_Capacity) grow(capacity);
+        }
+        
+        /// \brief Removes all of the items from this vector (any memory allocated from the heap is kept for re-use)
+        void clear() {
+            for (size_t index = 0; index < m_Size; ++index) {
+                m_Items[index].~item_type();
+            }
+            m_Size = 0;
+        }
+        
+        /// \brief True if the items are stored inside this object rather than in memory allocated from the heap
+        inline bool is_inline() const { return m_Items == reinterpret_cast<const item_type*>(m_Inline.bytes); }
+        
+    public:
+        /// \brief The number of items in this vector
+        inline size_t size() const { return m_Size; }
+        
+        /// \brief True if there are no items in this vector
+        inline bool empty() const { return m_Size == 0; }
+        
+        /// \brief The number of items this vector can hold before it needs to allocate more memory
+        inline size_t capacity() const { return m_Capacity; }
+        
+        /// \brief Retrieves the item at the specified index
+        inline const item_type& operator[](size_t index) const { return m_Items[index]; }
+        
+        /// \brief Retrieves the item at the specified index
+        inline item_type& operator[](size_t index) { return m_Items[index]; }
+        
+        /// \brief The first item in this vector
+        inline const item_type& front() const { return m_Items[0]; }
+        
+        /// \brief The last item in this vector
+        inline const item_type& back() const { return m_Items[m_Size-1]; }
+        
+        inline const_iterator begin() const { return m_Items; }
+        inline const_iterator end() const { return m_Items + m_Size; }
+        inline iterator begin() { return m_Items; }
+        inline iterator end() { return m_Items + m_Size; }
+    };
+}
+
+#endif
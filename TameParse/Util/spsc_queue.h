@@ -0,0 +1,116 @@
+//
+//  spsc_queue.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef _UTIL_SPSC_QUEUE_H
+#define _UTIL_SPSC_QUEUE_H
+
+#include <cstddef>
+
+#if __cplusplus >= 201103L
+#include <atomic>
+
+namespace util {
+    ///
+    /// \brief Fixed-size queue that passes values from one thread to another without taking a lock
+    ///
+    /// Exactly one thread may push values and exactly one other thread may pop them. The producer only writes the tail
+    /// and the consumer only writes the head, so each side needs a single atomic load of the other's position and a
+    /// single atomic store of its own. The positions are kept on separate cache lines so that the threads don't
+    /// fight over the same line when the queue is busy.
+    ///
+    /// Capacity must be a power of two. One slot is always left empty to tell a full queue from an empty one, so the
+    /// queue holds at most Capacity - 1 values.
+    ///
+    /// This is only available when the compiler supports C++11 atomics.
+    ///
+    template<typename T, size_t Capacity> class spsc_queue {
+    public:
+        /// \brief The largest number of values that the queue can hold
+        static const size_t max_size = Capacity - 1;
+        
+    private:
+        /// \brief Mask used to wrap positions around the end of the ring
+        static const size_t c_Mask = Capacity - 1;
+        
+        static_assert(Capacity >= 2 && (Capacity & c_Mask) == 0, "spsc_queue capacity must be a power of two");
+        
+        /// \brief The index of the next value to be popped (written only by the consumer)
+        alignas(64) std::atomic<size_t> m_Head;
+        
+        /// \brief The index of the next slot to be filled (written only by the producer)
+        alignas(64) std::atomic<size_t> m_Tail;
+        
+        /// \brief The values in the queue
+        alignas(64) T m_Values[Capacity];
+        
+        spsc_queue(const spsc_queue& noCopying);
+        spsc_queue& operator=(const spsc_queue& noCopying);
+        
+    public:
+        /// \brief Creates an empty queue
+        spsc_queue()
+        : m_Head(0)
+        , m_Tail(0) {
+        }
+        
+        /// \brief Adds a value to the end of the queue (producer only)
+        ///
+        /// Returns false, leaving the queue unchanged, if it is full.
+        inline bool push(const T& value) {
+            size_t tail = m_Tail.load(std::memory_order_relaxed);
+            size_t next = (tail + 1) & c_Mask;
+            
+            if (next == m_Head.load(std::memory_order_acquire)) return false;
+            
+            m_Values[tail] = value;
+            m_Tail.store(next, std::memory_order_release);
+            return true;
+        }
+        
+        /// \brief Removes the value at the front of the queue (consumer only)
+        ///
+        /// Returns false, leaving result unchanged, if the queue is empty.
+        inline bool pop(T& result) {
+            size_t head = m_Head.load(std::memory_order_relaxed);
+            
+            if (head == m_Tail.load(std::memory_order_acquire)) return false;
+            
+            result = m_Values[head];
+            m_Head.store((head + 1) & c_Mask, std::memory_order_release);
+            return true;
+        }
+        
+        /// \brief True if the queue is empty
+        ///
+        /// Values may be pushed or popped at any time by the other thread, so this is only a snapshot.
+        inline bool empty() const {
+            return m_Head.load(std::memory_order_acquire) == m_Tail.load(std::memory_order_acquire);
+        }
+    };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,78 @@
+//
+//  stopwatch.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#ifndef _UTIL_STOPWATCH_H
+#define _UTIL_STOPWATCH_H
+
+#include <ctime>
+
+#if __cplusplus >= 201103L
+#include <chrono>
+#endif
+
+namespace util {
+    ///
+    /// \brief Measures the time that has passed since it was created or restarted
+    ///
+    /// This is the wall-clock time if C++11 is available, and the processor time used by the whole program otherwise.
+    ///
+    class stopwatch {
+    private:
+#if __cplusplus >= 201103L
+        /// \brief When the stopwatch was started
+        std::chrono::steady_clock::time_point m_Start;
+#else
+        /// \brief When the stopwatch was started
+        std::clock_t m_Start;
+#endif
+        
+    public:
+        /// \brief Creates a stopwatch that starts timing immediately
+        inline stopwatch() {
+            restart();
+        }
+        
+        /// \brief Starts timing again from now
+        inline void restart() {
+#if __cplusplus >= 201103L
+            m_Start = std::chrono::steady_clock::now();
+#else
+            m_Start = std::clock();
+#endif
+        }
+        
+        /// \brief The number of seconds since the stopwatch was started
+        inline double seconds() const {
+#if __cplusplus >= 201103L
+            return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_Start).count();
+#else
+            return (double) (std::clock() - m_Start) / CLOCKS_PER_SEC;
+#endif
+        }
+    };
+}
+
+#endif
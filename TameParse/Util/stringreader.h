@@ -68,11 +68,15 @@ namespace util {
         /// \brief Position within the string
         size_t m_Pos;
         
+        /// \brief False once there has been an attempt to read past the end of the string
+        bool m_Good;
+        
     public:
         /// \brief Creates a new stringreader that references the supplied string
         basic_stringreader(const string_type& string)
         : m_SourceString(string)
-        , m_Pos(0) {
+        , m_Pos(0)
+        , m_Good(true) {
         }
         
         /// \brief Returns the next character in the string (or 0 if all of the characters have been read)
@@ -80,6 +84,7 @@ namespace util {
             if (m_Pos >= m_SourceString.size()) {
                 // At the end of the string
                 target = 0;
+                m_Good = false;
             } else {
                 // Return the next character
                 target = m_SourceString[m_Pos++];
@@ -88,9 +93,11 @@ namespace util {
             return *this;
         }
         
-        /// \brief Returns true if there are more characters to read from the string
+        /// \brief Returns true if the last character was read successfully
+        ///
+        /// As with an istream, this only becomes false after an attempt to read past the end of the string
         inline bool good() const {
-            return m_Pos < m_SourceString.size();
+            return m_Good;
         }
     };
     
@@ -94,7 +94,7 @@ namespace util {
         inline syntax_ptr(const syntax_ptr<ptr_type>& copyFrom)
         : m_Reference(copyFrom.m_Reference) {
             // Increase the reference count for this object
-            ++m_Reference->usageCount;
+            if (m_Reference) ++m_Reference->usageCount;
         }
         
         /// \brief Assignment
@@ -102,30 +102,57 @@ namespace util {
             // Nothing to do if the reference is the same
             if (m_Reference == assignFrom.m_Reference) return *this;
             
-            // Deallocate the reference
-            m_Reference->usageCount--;
-            if (m_Reference->usageCount <= 0) {
-                delete (ptr_type*) m_Reference->value;
-                m_Reference->value = NULL;
-                delete m_Reference;
-            }
-            m_Reference = NULL;
+            // Switch to the reference in the other object, then deallocate the old reference
+            syntax_ptr_reference* oldReference = m_Reference;
             
-            // Switch to the reference in the other object
             m_Reference = assignFrom.m_Reference;
-            ++m_Reference->usageCount;
+            if (m_Reference) ++m_Reference->usageCount;
+            
+            release(oldReference);
             
             return *this;
         }
         
+#if __cplusplus >= 201103L
+        /// \brief Move constructor: takes over the reference without changing its usage count
+        ///
+        /// The syntax_ptr that was moved from may only be destroyed or assigned to afterwards.
+        inline syntax_ptr(syntax_ptr<ptr_type>&& moveFrom)
+        : m_Reference(moveFrom.m_Reference) {
+            moveFrom.m_Reference = NULL;
+        }
+        
+        /// \brief Move assignment
+        syntax_ptr<ptr_type>& operator=(syntax_ptr<ptr_type>&& moveFrom) {
+            if (this == &moveFrom) return *this;
+            
+            syntax_ptr_reference* oldReference = m_Reference;
+            
+            m_Reference             = moveFrom.m_Reference;
+            moveFrom.m_Reference    = NULL;
+            
+            release(oldReference);
+            
+            return *this;
+        }
+#endif
+        
         /// \brief Destructs a syntax_ptr
         ~syntax_ptr() {
-            m_Reference->usageCount--;
-            if (m_Reference->usageCount <= 0) {
-                delete (ptr_type*) m_Reference->value;
-                m_Reference->value = NULL;
-                delete m_Reference;
-                m_Reference = NULL;
+            release(m_Reference);
+            m_Reference = NULL;
+        }
+        
+    private:
+        /// \brief Decreases the usage count of a reference, deleting it and its value if it is no longer in use
+        static inline void release(syntax_ptr_reference* ref) {
+            if (!ref) return;
+            
+            ref->usageCount--;
+            if (ref->usageCount <= 0) {
+                delete (ptr_type*) ref->value;
+                ref->value = NULL;
+                delete ref;
             }
         }
         
@@ -109,6 +109,32 @@ static symbol_set convert_range(const symbol_range& range, const map_entry* map,
     return result;
 }
 
+/// \brief Finds the block for a character type such as 'Lu', or a main category such as 'L' (NULL if there is none)
+const unicode::block* unicode::find_category(const std::string& category) const {
+    // Main categories have one letter, character types have two
+    const block* first  = category.size() == 1 ? s_Categories   : s_Blocks;
+    const block* last   = category.size() == 1 ? s_EndCategory  : s_EndBlock;
+    
+    for (const block* candidate = first; candidate != last; ++candidate) {
+        if (category == candidate->type) return candidate;
+    }
+    
+    return NULL;
+}
+
+/// \brief Returns the symbols in the specified block
+symbol_set unicode::symbols(const block& category) {
+    // The ranges are already sorted, so they can be added in a single pass
+    symbol_set result;
+    result.reserve(category.count);
+    
+    for (int rangeNum = 0; rangeNum < category.count; ++rangeNum) {
+        result.add_sorted(symbol_range(category.ranges[rangeNum].lower, category.ranges[rangeNum].upper));
+    }
+    
+    return result;
+}
+
 /// \brief Returns the uppercase equivalent of the specified symbol set
 symbol_set unicode::to_upper(const symbol_set& source) {
     symbol_set result;
@@ -134,3 +160,26 @@ symbol_set unicode::to_lower(const symbol_set& source) {
 
     return result;
 }
+
+/// \brief Stores the general category of each of the code points in the specified range in target
+void unicode::categories(const int* begin, const int* end, unsigned char* target) {
+    static const int blockMask = (1<<c_TableBlockBits)-1;
+    
+    for (const int* codePoint = begin; codePoint != end; ++codePoint, ++target) {
+        // Runs of ASCII characters only need the first block
+        if (*codePoint >= 0 && *codePoint <= blockMask) {
+            *target = s_CategoryBlocks[*codePoint];
+        } else {
+            *target = (unsigned char) category_of(*codePoint);
+        }
+    }
+}
+
+/// \brief The size in bytes of the category and case lookup tables
+size_t unicode::lookup_table_size() {
+    static const int indexSize = c_MaxCodePoint>>c_TableBlockBits;
+    static const int blockSize = 1<<c_TableBlockBits;
+    
+    return indexSize * sizeof(s_CategoryIndex[0]) + s_CategoryBlockCount * blockSize * sizeof(s_CategoryBlocks[0])
+         + indexSize * sizeof(s_CaseIndex[0]) + s_CaseBlockCount * blockSize * sizeof(s_CaseBlocks[0]);
+}
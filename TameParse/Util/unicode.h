@@ -28,6 +28,8 @@
 #ifndef _UTIL_UNICODE_H
 #define _UTIL_UNICODE_H
 
+#include <string>
+
 #include "TameParse/Dfa/symbol_set.h"
 
 namespace util {
@@ -47,8 +49,11 @@ namespace util {
             /// \brief The type of this block (as in the UnicodeData.txt file)
             const char* type;
             
-            /// \brief The ranges in this block
+            /// \brief The ranges in this block, sorted and terminated by a range starting at -1
             const range* ranges;
+            
+            /// \brief The number of ranges in this block (not counting the terminator)
+            int count;
         };
         
         /// \brief Iterator that goes through all of the blocks
@@ -60,6 +65,27 @@ namespace util {
             int upper;
             int map_to;
         };
+        
+        /// \brief The general categories from the UnicodeData.txt file, in the order used by the lookup tables
+        enum general_category {
+            cat_Cn, cat_Lu, cat_Ll, cat_Lt, cat_Lm, cat_Lo, cat_Mn, cat_Mc, cat_Me, cat_Nd, 
+            cat_Nl, cat_No, cat_Pc, cat_Pd, cat_Ps, cat_Pe, cat_Pi, cat_Pf, cat_Po, cat_Sm, 
+            cat_Sc, cat_Sk, cat_So, cat_Zs, cat_Zl, cat_Zp, cat_Cc, cat_Cf, cat_Cs, cat_Co,
+            
+            cat_count
+        };
+        
+        /// \brief Number of bits of a code point used to index into a block of the lookup tables
+        static const int c_TableBlockBits = 7;
+        
+        /// \brief The code point after the last one that is covered by the lookup tables
+        static const int c_MaxCodePoint = 0x110000;
+        
+        /// \brief Entry in the case lookup table (values to add to a character to get its uppercase and lowercase equivalents)
+        struct case_delta {
+            int upper;
+            int lower;
+        };
     
     private:
         /// \brief The blocks in this unicode definition
@@ -67,6 +93,12 @@ namespace util {
         
         /// \brief The block after the last block in the list
         static const block* s_EndBlock;
+        
+        /// \brief The main categories (where each block has all the types starting with the same letter)
+        static const block s_Categories[];
+        
+        /// \brief The category after the last category in the list
+        static const block* s_EndCategory;
 
         /// \brief Number of entries in the upper case map
         static const int s_UppercaseMapSize;
@@ -80,6 +112,29 @@ namespace util {
         /// \brief Sorted array mapping uppercase characters to their lowercase equivalent
         static const map_entry s_LowercaseMap[];
         
+        /// \brief The names of the general categories, indexed by general_category
+        static const char* const s_CategoryNames[];
+        
+        /// \brief The block in s_CategoryBlocks for each block of code points
+        ///
+        /// The first block is always the one for the ASCII characters, so they can be looked up without this index
+        static const unsigned short s_CategoryIndex[];
+        
+        /// \brief The general category of each code point, in blocks of (1<<c_TableBlockBits) entries
+        static const unsigned char s_CategoryBlocks[];
+        
+        /// \brief The block in s_CaseBlocks for each block of code points
+        static const unsigned short s_CaseIndex[];
+        
+        /// \brief The case mapping for each code point, in blocks of (1<<c_TableBlockBits) entries
+        static const case_delta s_CaseBlocks[];
+        
+        /// \brief Number of distinct blocks in s_CategoryBlocks
+        static const int s_CategoryBlockCount;
+        
+        /// \brief Number of distinct blocks in s_CaseBlocks
+        static const int s_CaseBlockCount;
+        
     public:
         /// \brief The first character range
         inline iterator begin() const { return s_Blocks; }
@@ -87,11 +142,85 @@ namespace util {
         /// \brief The final character range
         inline iterator end() const { return s_EndBlock; }
 
+        /// \brief Finds the block for a character type such as 'Lu', or a main category such as 'L' (NULL if there is none)
+        const block* find_category(const std::string& category) const;
+        
+        /// \brief Returns the symbols in the specified block
+        static dfa::symbol_set symbols(const block& category);
+        
         /// \brief Returns the uppercase equivalent of the specified symbol set
         dfa::symbol_set to_upper(const dfa::symbol_set& source);
 
         /// \brief Returns the lowercase equivalent of the specified symbol set
         dfa::symbol_set to_lower(const dfa::symbol_set& source);
+        
+    public:
+        /// \brief The general category of the specified code point (cat_Cn if it is not assigned or is out of range)
+        static inline general_category category_of(int codePoint) {
+            static const int blockMask = (1<<c_TableBlockBits)-1;
+            
+            // ASCII characters are always in the first block
+            if (codePoint >= 0 && codePoint <= blockMask) {
+                return (general_category) s_CategoryBlocks[codePoint];
+            }
+            if (codePoint < 0 || codePoint >= c_MaxCodePoint) return cat_Cn;
+            
+            int block = s_CategoryIndex[codePoint>>c_TableBlockBits];
+            return (general_category) s_CategoryBlocks[(block<<c_TableBlockBits) | (codePoint&blockMask)];
+        }
+        
+        /// \brief The name of a general category, as used in the UnicodeData.txt file (such as 'Lu')
+        static inline const char* category_name(general_category category) {
+            if (category < 0 || category >= cat_count) return s_CategoryNames[cat_Cn];
+            return s_CategoryNames[category];
+        }
+        
+        /// \brief The uppercase equivalent of the specified code point (or the code point itself if it has none)
+        static inline int upper_case(int codePoint) {
+            return codePoint + case_of(codePoint).upper;
+        }
+        
+        /// \brief The lowercase equivalent of the specified code point (or the code point itself if it has none)
+        static inline int lower_case(int codePoint) {
+            return codePoint + case_of(codePoint).lower;
+        }
+        
+        /// \brief A case-insensitive equivalent of the specified code point, for comparing characters without regard to case
+        static inline int fold_case(int codePoint) {
+            return lower_case(upper_case(codePoint));
+        }
+        
+        /// \brief True if all of the code points in the specified range are ASCII characters
+        ///
+        /// This doesn't branch on each character, so it's a quick way to check whether the slower lookups are needed
+        /// for a piece of text.
+        template<class symbol_iterator> static inline bool is_ascii(symbol_iterator begin, symbol_iterator end) {
+            unsigned int combined = 0;
+            for (symbol_iterator codePoint = begin; codePoint != end; ++codePoint) {
+                combined |= (unsigned int) *codePoint;
+            }
+            return combined < 128;
+        }
+        
+        /// \brief Stores the general category of each of the code points in the specified range in target
+        ///
+        /// Target must have space for (end-begin) entries, each of which is a general_category value.
+        static void categories(const int* begin, const int* end, unsigned char* target);
+        
+        /// \brief The size in bytes of the category and case lookup tables
+        static size_t lookup_table_size();
+        
+    private:
+        /// \brief The case mapping entry for the specified code point
+        static inline const case_delta& case_of(int codePoint) {
+            static const case_delta noMapping = { 0, 0 };
+            static const int        blockMask = (1<<c_TableBlockBits)-1;
+            
+            if (codePoint < 0 || codePoint >= c_MaxCodePoint) return noMapping;
+            
+            int block = s_CaseIndex[codePoint>>c_TableBlockBits];
+            return s_CaseBlocks[(block<<c_TableBlockBits) | (codePoint&blockMask)];
+        }
     };
 }
 
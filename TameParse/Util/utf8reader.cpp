@@ -25,6 +25,10 @@
 //  IN THE SOFTWARE.
 //
 
+#if defined(__SSE2__)
+#  include <emmintrin.h>
+#endif
+
 #include "TameParse/Util/utf8reader.h"
 
 using namespace std;
@@ -95,7 +99,7 @@ utf8reader& utf8reader::get(wchar_t& target) {
     }
 
     // Work out how many bytes are in the complete character
-    else if ((target & 0xe0) == 0xc0) {
+    else if ((firstChar & 0xe0) == 0xc0) {
         // Begins 110xxxx (0x80 - 0x7ff)
 
         // Read the remaining characters
@@ -111,7 +115,7 @@ utf8reader& utf8reader::get(wchar_t& target) {
         // Create the result
         target = ((firstChar&0x1f)<<6) | (secondChar&0x3f);
         return *this;
-    } else if ((target & 0xf0) == 0xe0) {
+    } else if ((firstChar & 0xf0) == 0xe0) {
         // Begins 1110xxxx (0x800 - 0xffff)
 
         // Read the remaining characters
@@ -128,7 +132,7 @@ utf8reader& utf8reader::get(wchar_t& target) {
         // Create the result
         target = ((firstChar&0xf)<<12) | ((secondChar&0x3f)<<6) | (thirdChar&0x3f);
         return *this;
-    } else if ((target & 0xf8) == 0xf0) {
+    } else if ((firstChar & 0xf8) == 0xf0) {
         // Begins 11110000 (0x10000 - 0x1fffff)
 
         // Read the remaining characters
@@ -144,7 +148,7 @@ utf8reader& utf8reader::get(wchar_t& target) {
         }
 
         // Construct the UCS-4 character
-        unsigned int ucs4 = ((firstChar&0x7)<<18) | ((secondChar&0x3f)<<12) | ((thirdChar&0x3f)<<6) | (secondChar&0x3f);
+        unsigned int ucs4 = ((firstChar&0x7)<<18) | ((secondChar&0x3f)<<12) | ((thirdChar&0x3f)<<6) | (fourthChar&0x3f);
 
         // Must be less than 0x110000 to be a valid surrogate pair
         if (ucs4 >= 0x110000) {
@@ -174,3 +178,121 @@ utf8reader& utf8reader::get(wchar_t& target) {
 bool utf8reader::good() const {
     return !m_BadUTF8 && m_InputStream->good();
 }
+
+/// \brief True if the next character can be read without waiting for more input from the source stream
+bool utf8reader::has_input() const {
+    if (m_PairChar) return true;
+    if (!m_InputStream || !m_InputStream->rdbuf()) return false;
+    
+    return m_InputStream->rdbuf()->in_avail() > 0;
+}
+
+/// \brief Decodes a block of UTF-8 bytes into characters
+size_t utf8reader::decode(const unsigned char*& src, const unsigned char* end, int* dest, size_t max, bool& bad) {
+    const unsigned char*    pos     = src;
+    size_t                  count   = 0;
+    
+    while (count < max && pos < end) {
+        // Fast path for runs of ASCII characters
+        if (*pos < 0x80) {
+#if defined(__SSE2__)
+            // Convert 16 characters at a time
+            const __m128i zero = _mm_setzero_si128();
+            
+            while (end - pos >= 16 && max - count >= 16) {
+                __m128i bytes = _mm_loadu_si128((const __m128i*) pos);
+                
+                // Stop if any of these bytes have the top bit set
+                if (_mm_movemask_epi8(bytes) != 0) break;
+                
+                // Zero-extend to 32-bit characters
+                __m128i low     = _mm_unpacklo_epi8(bytes, zero);
+                __m128i high    = _mm_unpackhi_epi8(bytes, zero);
+                
+                _mm_storeu_si128((__m128i*) (dest + count),      _mm_unpacklo_epi16(low, zero));
+                _mm_storeu_si128((__m128i*) (dest + count + 4),  _mm_unpackhi_epi16(low, zero));
+                _mm_storeu_si128((__m128i*) (dest + count + 8),  _mm_unpacklo_epi16(high, zero));
+                _mm_storeu_si128((__m128i*) (dest + count + 12), _mm_unpackhi_epi16(high, zero));
+                
+                pos     += 16;
+                count   += 16;
+            }
+#else
+            // Convert 8 characters at a time
+            while (end - pos >= 8 && max - count >= 8) {
+                if ((pos[0] | pos[1] | pos[2] | pos[3] | pos[4] | pos[5] | pos[6] | pos[7]) & 0x80) break;
+                
+                for (int x=0; x<8; ++x) {
+                    dest[count + x] = pos[x];
+                }
+                
+                pos     += 8;
+                count   += 8;
+            }
+#endif
+            
+            // Deal with any remaining ASCII characters one at a time
+            while (count < max && pos < end && *pos < 0x80) {
+                dest[count] = *pos;
+                ++pos;
+                ++count;
+            }
+            
+            continue;
+        }
+        
+        // Work out how many bytes are in the complete character
+        unsigned char   firstChar = *pos;
+        int             length;
+        int             minimum;
+        int             result;
+        
+        if ((firstChar & 0xe0) == 0xc0)         { length = 2; minimum = 0x80;       result = firstChar & 0x1f; }
+        else if ((firstChar & 0xf0) == 0xe0)    { length = 3; minimum = 0x800;      result = firstChar & 0x0f; }
+        else if ((firstChar & 0xf8) == 0xf0)    { length = 4; minimum = 0x10000;    result = firstChar & 0x07; }
+        else {
+            // Not a valid leading byte
+            bad = true;
+            break;
+        }
+        
+        // Stop if the character is truncated
+        if (end - pos < length) break;
+        
+        // Add in the continuation bytes
+        bool valid = true;
+        for (int byte = 1; byte < length; ++byte) {
+            unsigned char nextChar = pos[byte];
+            if ((nextChar & 0xc0) != 0x80) {
+                valid = false;
+                break;
+            }
+            
+            result = (result << 6) | (nextChar & 0x3f);
+        }
+        
+        // Reject invalid sequences, overlong encodings and characters that can't be represented as UTF-16
+        if (!valid || result < minimum || result >= 0x110000 || (result >= 0xd800 && result < 0xe000)) {
+            bad = true;
+            break;
+        }
+        
+        if (result < 0x10000) {
+            dest[count] = result;
+            ++count;
+        } else {
+            // Need space for a surrogate pair
+            if (max - count < 2) break;
+            
+            result          -= 0x10000;
+            dest[count]     = 0xd800 + ((result >> 10) & 0x3ff);
+            dest[count+1]   = 0xdc00 + (result & 0x3ff);
+            count           += 2;
+        }
+        
+        pos += length;
+    }
+    
+    src = pos;
+    return count;
+}
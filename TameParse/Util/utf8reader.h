@@ -29,6 +29,7 @@
 #define _UTIL_UTF8READER_H
 
 #include <iostream>
+#include <cstddef>
 
 namespace util {
     ///
@@ -78,6 +79,27 @@ namespace util {
 
         /// \brief True if the stream is good
         bool good() const;
+        
+        /// \brief True if the next character can be read without waiting for more input from the source stream
+        ///
+        /// This only checks that the first byte of the character is available.
+        bool has_input() const;
+        
+    public:
+        /// \brief Decodes a block of UTF-8 bytes into characters
+        ///
+        /// Decodes characters from the bytes between src and end, storing up to max characters in dest and moving
+        /// src on past the bytes that were decoded. As with get(), characters outside the basic multilingual plane
+        /// are stored as UTF-16 surrogate pairs: decoding stops before any character that would not fit entirely
+        /// in dest, so max should be at least 2.
+        ///
+        /// Decoding also stops at the first invalid sequence (setting bad to true), or at a sequence that is
+        /// truncated by end (leaving src pointing at it, so the caller can supply more bytes). Overlong encodings,
+        /// encoded surrogates and characters above 0x10ffff are treated as invalid.
+        ///
+        /// Runs of ASCII characters are converted several bytes at a time (using SSE2 where it is available), so
+        /// this is much faster than get() for mostly-ASCII text.
+        static size_t decode(const unsigned char*& src, const unsigned char* end, int* dest, size_t max, bool& bad);
     };
 }
 
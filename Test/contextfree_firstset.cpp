@@ -27,6 +27,9 @@
 
 #include "contextfree_firstset.h"
 #include "TameParse/ContextFree/grammar.h"
+#include "TameParse/ContextFree/guard.h"
+#include "TameParse/ContextFree/ebnf_items.h"
+#include "TameParse/ContextFree/terminal_dictionary.h"
 
 using namespace contextfree;
 
@@ -64,6 +67,14 @@ void test_contextfree_firstset::run_tests() {
     nonterminal ntNonempty(testGram.id_for_nonterminal(L"nonempty"));
     (testGram += L"nonempty") << L"empty" << 3;
     
+    // Mutually recursive rules
+    nonterminal ntMutualA(testGram.id_for_nonterminal(L"mutual-a"));
+    nonterminal ntMutualB(testGram.id_for_nonterminal(L"mutual-b"));
+    (testGram += L"mutual-a") << L"mutual-b" << 4;
+    (testGram += L"mutual-a") << 4;
+    (testGram += L"mutual-b") << L"mutual-a" << 5;
+    (testGram += L"mutual-b") << 5;
+    
     // Check out the first sets of these rules
     terminal term1(1);
     terminal term2(2);
@@ -104,4 +115,108 @@ void test_contextfree_firstset::run_tests() {
     report("ntNonempty.contains-ntEmpty", contains(testGram.first(ntNonempty), ntEmpty));
     report("ntNonempty.doesnot-contain-empty", !contains(testGram.first(ntNonempty), empty));
     report("ntNonempty.size", testGram.first(ntEmpty).size() == 5);
+    
+    // Both of the mutually recursive rules should see the whole cycle, whichever is requested first
+    terminal term4(4);
+    terminal term5(5);
+    
+    report("ntMutualA.contains-term4", contains(testGram.first(ntMutualA), term4));
+    report("ntMutualA.contains-term5", contains(testGram.first(ntMutualA), term5));
+    report("ntMutualB.contains-term4", contains(testGram.first(ntMutualB), term4));
+    report("ntMutualB.contains-term5", contains(testGram.first(ntMutualB), term5));
+    report("ntMutualB.contains-ntMutualA", contains(testGram.first(ntMutualB), ntMutualA));
+    report("ntMutualB.size", testGram.first(ntMutualB).size() == 4);
+    
+    // Small sets and bitsets holding the same items should behave identically
+    item_set small(testGram);
+    item_set large(testGram);
+    
+    small.insert(40);
+    small.insert(3);
+    
+    for (int itemId = 0; itemId < 10; ++itemId) large.insert(itemId);
+    for (int itemId = 4; itemId < 10; ++itemId) large.erase(itemId);
+    large.insert(40);
+    large.erase(0);
+    large.erase(1);
+    large.erase(2);
+    
+    report("itemset.small-equals-bitset", small == large && large == small && !(small < large) && !(large < small));
+    report("itemset.small-iterates-in-order", small.begin() != small.end() && small.size() == 2);
+    
+    item_set merged(small);
+    merged.insert(1);
+    report("itemset.small-ordering", (merged < small) == (merged < large) && (small < merged) == (large < merged));
+    
+    // Merging a bitset into a small set switches representation, and reports the change
+    item_set growing(testGram);
+    growing.insert(5);
+    
+    report("itemset.merge-changes", growing.merge(large) && growing.size() == 3 && growing.contains(5) && growing.contains(40));
+    report("itemset.merge-unchanged", !growing.merge(small) && growing.size() == 3);
+    
+    for (int itemId = 100; itemId < 110; ++itemId) small.insert(itemId);
+    report("itemset.small-grows", small.size() == 12 && small.contains(3) && small.contains(109) && !small.contains(110));
+    
+    // Pruning should remove the rules that can't be reached from the start symbol or can never match anything
+    grammar pruneGram;
+    
+    nonterminal ntStart(pruneGram.id_for_nonterminal(L"start"));
+    nonterminal ntUsed(pruneGram.id_for_nonterminal(L"used"));
+    nonterminal ntLoop(pruneGram.id_for_nonterminal(L"loop"));
+    nonterminal ntUnreached(pruneGram.id_for_nonterminal(L"unreached"));
+    nonterminal ntGuarded(pruneGram.id_for_nonterminal(L"guarded"));
+    
+    guard usesGuarded;
+    (*usesGuarded.get_rule()) << ntGuarded;
+    
+    (pruneGram += L"start") << L"used";
+    (pruneGram += L"start") << L"loop" << 1;
+    (pruneGram += L"start") << usesGuarded << 2;
+    (pruneGram += L"used") << 1;
+    (pruneGram += L"used") << L"used" << 2;
+    (pruneGram += L"loop") << L"loop" << 3;
+    (pruneGram += L"unreached") << 4;
+    (pruneGram += L"guarded") << 5;
+    
+    int usedRuleId  = pruneGram.identifier_for_rule(pruneGram.rules_for_nonterminal(ntUsed.symbol())[0]);
+    
+    item_list pruneStart;
+    pruneStart.push_back(pruneGram.get_nonterminal(L"start"));
+    
+    report("prune.count", pruneGram.prune(pruneStart) == 3);
+    report("prune.keeps-reachable", pruneGram.rules_for_nonterminal(ntStart.symbol()).size() == 2 && pruneGram.rules_for_nonterminal(ntUsed.symbol()).size() == 2);
+    report("prune.unproductive", pruneGram.rules_for_nonterminal(ntLoop.symbol()).empty());
+    report("prune.unreachable", pruneGram.rules_for_nonterminal(ntUnreached.symbol()).empty());
+    report("prune.guard-rules", pruneGram.rules_for_nonterminal(ntGuarded.symbol()).size() == 1);
+    report("prune.same-identifiers", pruneGram.identifier_for_rule(pruneGram.rules_for_nonterminal(ntUsed.symbol())[0]) == usedRuleId);
+    report("prune.first", contains(pruneGram.first(ntStart), term1) && !contains(pruneGram.first(ntStart), term3));
+    report("prune.nothing-more", pruneGram.prune(pruneStart) == 0);
+    
+    // Tags should order the simple items in the same way as the items themselves
+    end_of_input    eoi;
+    end_of_guard    eog;
+    ebnf_optional   optionalTerm;
+    (*optionalTerm.get_rule()) << term1;
+    
+    report("tag.kind", term1.tag().kind == item::terminal && ntTerm.tag().kind == item::nonterminal && empty.tag().kind == item::empty && eog.tag().kind == item::eog);
+    report("tag.type-fallback", optionalTerm.tag().kind == item::optional && usesGuarded.tag().kind == item::guard);
+    report("tag.same", term1.tag() == terminal(1).tag() && term1.tag() != term2.tag() && term1.tag() != nonterminal(1).tag());
+    report("tag.order", (term1.tag() < term2.tag()) == item::compare(term1, term2) && (eoi.tag() < term1.tag()) == item::compare(eoi, term1) && (ntTerm.tag() < term3.tag()) == item::compare(ntTerm, term3));
+    report("tag.simple", item::is_simple(item::eog) && item::is_simple(item::nonterminal) && !item::is_simple(item::guard) && !item::is_simple(item::optional));
+    
+    // Names and identifiers should round-trip through the tables in the grammar and the terminal dictionary
+    report("names.nonterminal", testGram.name_for_nonterminal(ntMutualB.symbol()) == L"mutual-b" && testGram.id_for_nonterminal(L"mutual-b") == ntMutualB.symbol());
+    report("names.unknown-nonterminal", testGram.name_for_nonterminal(-1).empty() && testGram.name_for_nonterminal(10000).empty() && testGram.rules_for_nonterminal(10000).empty());
+    
+    terminal_dictionary dict;
+    int                 anonymous   = dict.add_symbol();
+    int                 named       = dict.add_symbol(L"named");
+    dict.add_symbol(L"fixed", 10);
+    int                 split       = dict.split(named);
+    
+    report("names.terminal", dict.symbol_for_name(L"named") == named && dict.name_for_symbol(named) == L"named" && dict.name_for_symbol(10) == L"fixed");
+    report("names.anonymous", dict.name_for_symbol(anonymous).empty() && dict.name_for_symbol(5).empty() && dict.symbol_for_name(L"missing") == -1);
+    report("names.count", dict.count_symbols() == 2);
+    report("names.split", split > 10 && dict.parent_of(split) == named && dict.parent_of(named) == named && dict.children_of(named).count(split) == 1 && dict.name_for_symbol(split) == L"named");
 }
@@ -59,11 +59,21 @@ void test_contextfree_followset::run_tests() {
     (testGram += L"nonterm3") << L"emptyfollow2" << L"empty";
     (testGram += L"nonterm4") << L"nonterm3" << 4;
     
+    // Cyclep and cycleq appear at the end of each other's rules, so they must end up with the same follow set
+    nonterminal cycleP(testGram.id_for_nonterminal(L"cyclep"));
+    nonterminal cycleQ(testGram.id_for_nonterminal(L"cycleq"));
+    (testGram += L"cyclep") << 5 << L"cycleq";
+    (testGram += L"cyclep") << 6;
+    (testGram += L"cycleq") << 5 << L"cyclep";
+    
+    (testGram += L"nonterm5") << L"cycleq" << 7;
+    
     // Verify each of the follow sets
     terminal term1(1);
     terminal term2(2);
     terminal term3(3);
     terminal term4(4);
+    terminal term7(7);
     
     empty_item an_empty_item;
     nonterminal ntEmpty(testGram.id_for_nonterminal(L"empty"));
@@ -85,4 +95,12 @@ void test_contextfree_followset::run_tests() {
     report("emptyFollow2.contains-term4", contains(followSet, term4));
     report("emptyFollow2.contains-empty", contains(followSet, an_empty_item));
     report("emptyFollow2.contains-ntEmpty", contains(followSet, ntEmpty));
+    
+    followSet = testGram.follow(cycleP);
+    report("cycleP.size", followSet.size() == 1);
+    report("cycleP.contains-term7", contains(followSet, term7));
+    
+    followSet = testGram.follow(cycleQ);
+    report("cycleQ.size", followSet.size() == 1);
+    report("cycleQ.contains-term7", contains(followSet, term7));
 }
@@ -0,0 +1,1760 @@
+//
+//  dfa_lexer.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <sstream>
+#include <vector>
+
+#include "dfa_lexer.h"
+
+#include "TameParse/Dfa/lexer.h"
+#include "TameParse/Dfa/lexeme_interner.h"
+#include "TameParse/Dfa/binary_lexer.h"
+#include "TameParse/Dfa/line_index.h"
+#include "TameParse/Dfa/item_boundary_scanner.h"
+#include "TameParse/Dfa/state_vector.h"
+#include "TameParse/Dfa/search.h"
+#include "TameParse/Dfa/pipelined_lexeme_stream.h"
+#include "TameParse/Dfa/push_lexer.h"
+#include "TameParse/Util/comb_vector.h"
+
+using namespace std;
+using namespace dfa;
+using namespace util;
+
+/// \brief Converts a string to a buffer of symbols
+static vector<int> to_symbols(const string& str) {
+    vector<int> result;
+    for (size_t x=0; x<str.size(); ++x) {
+        result.push_back((int)(unsigned char)str[x]);
+    }
+    return result;
+}
+
+/// \brief Returns true if two streams produce the same lexemes, counting them in count. Both streams are deleted.
+static bool same_lexemes(lexeme_stream* a, lexeme_stream* b, int& count) {
+    bool same = a != NULL && b != NULL;
+    count = 0;
+    
+    while (same) {
+        lexeme* fromA = NULL;
+        lexeme* fromB = NULL;
+        
+        (*a) >> fromA;
+        (*b) >> fromB;
+        
+        if (!fromA || !fromB) {
+            if (fromA || fromB) same = false;
+            delete fromA;
+            delete fromB;
+            break;
+        }
+        
+        if (fromA->matched() != fromB->matched() || fromA->content() != fromB->content() || fromA->pos() != fromB->pos()) {
+            same = false;
+        }
+        
+        ++count;
+        delete fromA;
+        delete fromB;
+    }
+    
+    delete a;
+    delete b;
+    return same;
+}
+
+/// \brief Lexeme stream that reads from a push_lexer, pushing a few more symbols from a buffer whenever it runs dry
+class pushed_lexeme_stream : public lexeme_stream {
+private:
+    push_lexer  m_Lexer;
+    const int*  m_Next;
+    const int*  m_End;
+    size_t      m_BlockSize;
+    
+public:
+    pushed_lexeme_stream(const basic_lexer& lexer, const int* begin, const int* end, size_t blockSize)
+    : m_Lexer(lexer)
+    , m_Next(begin)
+    , m_End(end)
+    , m_BlockSize(blockSize) {
+    }
+    
+    virtual lexeme_stream& operator>>(lexeme*& result) {
+        while (!m_Lexer.next(result)) {
+            // Push the next block, or indicate that there are no more
+            if (m_Next == m_End) {
+                m_Lexer.end_of_input();
+                continue;
+            }
+            
+            const int* blockEnd = (size_t) (m_End - m_Next) < m_BlockSize ? m_End : m_Next + m_BlockSize;
+            m_Lexer.push(m_Next, blockEnd);
+            m_Next = blockEnd;
+        }
+        
+        return *this;
+    }
+};
+
+/// \brief Collects the lexemes passed to it by push_lexer::feed
+struct lexeme_collector {
+    int     count;
+    bool    ended;
+    
+    lexeme_collector() : count(0), ended(false) { }
+    
+    void push(lexeme* lex)  { ++count; delete lex; }
+    void end_of_input()     { ended = true; }
+};
+
+/// \brief Returns true if running a state vector over spans of symbols matches running the DFA from each state in turn
+static bool same_state_vectors(const ndfa& dfa, const int* begin, const int* end) {
+    typedef state_vector_machine<wchar_t>::vector_state vector_state;
+    
+    state_machine<wchar_t>          single(dfa);
+    state_vector_machine<wchar_t>   vectors(dfa);
+    int                             numStates = dfa.count_states();
+    
+    for (const int* spanEnd = begin; spanEnd <= end && spanEnd < begin + 40; ++spanEnd) {
+        vector<vector_state> states(numStates);
+        vectors.fill_all_states(&states[0]);
+        vectors.run(&states[0], numStates, begin, spanEnd);
+        
+        for (int startState = 0; startState < numStates; ++startState) {
+            int expected = startState;
+            for (const int* pos = begin; pos != spanEnd && expected >= 0; ++pos) {
+                expected = single.run_unsafe(expected, *pos);
+            }
+            
+            if (vectors.to_state(states[startState]) != expected) return false;
+        }
+    }
+    
+    return true;
+}
+
+/// \brief Returns true if composing the mappings for two halves of a span gives the mapping for the whole span
+static bool same_composed_vectors(const ndfa& dfa, const int* begin, const int* middle, const int* end) {
+    typedef state_vector_machine<wchar_t>::vector_state vector_state;
+    
+    state_vector_machine<wchar_t>   vectors(dfa);
+    int                             numStates = dfa.count_states();
+    vector<vector_state>            first(numStates);
+    vector<vector_state>            second(numStates);
+    vector<vector_state>            whole(numStates);
+    
+    vectors.fill_all_states(&first[0]);
+    vectors.fill_all_states(&second[0]);
+    vectors.fill_all_states(&whole[0]);
+    
+    vectors.run(&first[0], numStates, begin, middle);
+    vectors.run(&second[0], numStates, middle, end);
+    vectors.run(&whole[0], numStates, begin, end);
+    vectors.compose(&first[0], numStates, &second[0]);
+    
+    return first == whole;
+}
+
+/// \brief Symbol translator with the interface used by the hard-coded tables written by the parser generator
+class flat_table_translator {
+private:
+    symbol_translator<wchar_t> m_Translator;
+    
+public:
+    flat_table_translator(const symbol_map& map)
+    : m_Translator(map) {
+    }
+    
+    inline int lookup(wchar_t symbol) const { return m_Translator.set_for_symbol(symbol); }
+};
+
+/// \brief Runner for dfa_lexer_base that counts how often it is used
+class counting_runner {
+public:
+    /// \brief Number of calls to run()
+    static int s_Calls;
+    
+    static int run(const state_machine<wchar_t>& stateMachine, const int* accept, const skip_state* skip, int state, const int*& pos, const int* end, int& acceptSymbol, const int*& acceptPos) {
+        ++s_Calls;
+        return dfa_table_runner<const state_machine<wchar_t>&>::run(stateMachine, accept, skip, state, pos, end, acceptSymbol, acceptPos);
+    }
+};
+
+int counting_runner::s_Calls = 0;
+
+/// \brief Symbol stream that supplies one symbol at a time and counts how many times it has been read from
+class trickle_symbol_stream : public lexer_symbol_stream {
+private:
+    /// \brief The symbols to return
+    vector<int> m_Symbols;
+    
+    /// \brief The next symbol to return
+    size_t m_Next;
+    
+public:
+    /// \brief Number of calls to read()
+    int reads;
+    
+    trickle_symbol_stream(const vector<int>& symbols)
+    : m_Symbols(symbols)
+    , m_Next(0)
+    , reads(0) {
+    }
+    
+    virtual lexer_symbol_stream& operator>>(int& result) {
+        result = m_Next < m_Symbols.size() ? m_Symbols[m_Next++] : symbol_set::end_of_input;
+        return *this;
+    }
+    
+    virtual size_t read(int* dest, size_t max) {
+        ++reads;
+        if (m_Next >= m_Symbols.size() || max == 0) return 0;
+        
+        *dest = m_Symbols[m_Next++];
+        return 1;
+    }
+};
+
+/// \brief Stream buffer that supplies its input a chunk at a time, like a pipe, and counts how often it has to wait for more
+class chunked_buf : public std::streambuf {
+private:
+    /// \brief The chunks of input, in order
+    vector<string> m_Chunks;
+    
+    /// \brief The next chunk to supply
+    size_t m_Next;
+    
+protected:
+    virtual int_type underflow() {
+        if (m_Next >= m_Chunks.size()) return traits_type::eof();
+        
+        ++waits;
+        string& chunk = m_Chunks[m_Next++];
+        setg(&chunk[0], &chunk[0], &chunk[0] + chunk.size());
+        return traits_type::to_int_type(chunk[0]);
+    }
+    
+public:
+    /// \brief Number of times a new chunk was supplied
+    int waits;
+    
+    chunked_buf(const vector<string>& chunks)
+    : m_Chunks(chunks)
+    , m_Next(0)
+    , waits(0) {
+    }
+};
+
+/// \brief Describes the lexemes found in some text by a stream that is restricted to some valid symbols, as symbol:length pairs
+static string valid_lexemes(const lexer& lex, const string& text, const unsigned int* valid, bool buffered) {
+    vector<int>     symbols = to_symbols(text);
+    lexeme_stream*  stream  = buffered ? lex.create_stream(new trickle_symbol_stream(symbols)) : lex.create_stream_from_symbols(&symbols[0], &symbols[0] + symbols.size());
+    stringstream    result;
+    
+    if (!stream->set_valid_symbols(valid, 32)) result << "unsupported ";
+    
+    for (;;) {
+        lexeme* next = NULL;
+        (*stream) >> next;
+        if (!next) break;
+        
+        result << next->matched() << ":" << next->length() << " ";
+        delete next;
+    }
+    
+    delete stream;
+    return result.str();
+}
+
+void test_dfa_lexer::run_tests() {
+    // Simple lexer for identifiers and whitespace
+    lexer idLexer;
+    idLexer.add_symbol("[a-z]+", 1);
+    idLexer.add_symbol("[ ]+", 2);
+    idLexer.compile(false);
+    
+    // Lexing from a buffer should generate lexemes that refer to that buffer
+    vector<int>     buffer  = to_symbols("hello world");
+    lexeme_stream*  stream  = idLexer.create_stream_from_symbols(&buffer[0], &buffer[0] + buffer.size());
+    
+    lexeme* hello;
+    lexeme* space;
+    lexeme* world;
+    lexeme* end;
+    
+    (*stream) >> hello >> space >> world >> end;
+    delete stream;
+    
+    report("ZeroCopyHello",     hello != NULL && hello->matched() == 1 && hello->content<char>() == "hello");
+    report("ZeroCopyIsView",    hello != NULL && hello->is_view() && hello->begin() == &buffer[0]);
+    report("ZeroCopySpace",     space != NULL && space->matched() == 2 && space->length() == 1);
+    report("ZeroCopyWorld",     world != NULL && world->matched() == 1 && world->begin() == &buffer[6] && world->pos().offset() == 6);
+    report("ZeroCopyEnd",       end == NULL);
+    report("ZeroCopyContent",   world != NULL && world->content() == lexeme::symbols(&buffer[6], &buffer[0] + buffer.size()));
+    
+    // Clones keep referring to the buffer
+    lexeme* worldClone = world ? world->clone() : NULL;
+    report("ZeroCopyClone",     worldClone != NULL && worldClone->is_view() && worldClone->content<char>() == "world");
+    report("ZeroCopyCompare",   worldClone != NULL && !(*worldClone < *world) && !(*world < *worldClone));
+    
+    // Retagged lexemes match a different symbol without copying the symbols of the original (unless they're short enough to be stored inline)
+    vector<int>         storedText = to_symbols("stored symbols");
+    lexeme_container    stored(new lexeme(storedText.begin(), storedText.end(), position(3, 0, 3), 1), true);
+    lexeme_container    retagged(new lexeme(stored, 7), true);
+    lexeme_container    retaggedView(new lexeme(lexeme_container(hello, false), 8), true);
+    const int*          storedSymbols = stored->begin();
+    
+    stored = lexeme_container(new lexeme(), true);
+    lexeme_container    retaggedTwice(new lexeme(retagged, 9), true);
+    retagged = lexeme_container(new lexeme(), true);
+    
+    report("RetagShares",       retaggedTwice->begin() == storedSymbols && retaggedTwice->matched() == 9 && retaggedTwice->content<char>() == "stored symbols");
+    report("RetagPosition",     retaggedTwice->pos().offset() == 3);
+    report("RetagView",         hello != NULL && retaggedView->begin() == hello->begin() && retaggedView->matched() == 8);
+    
+    // Short lexemes are stored in the object itself, and keep their own copy when they're cloned or retagged
+    vector<int>         shortText = to_symbols("short");
+    lexeme_container    shortLexeme(new lexeme(shortText.begin(), shortText.end(), position(0, 0, 0), 1), true);
+    lexeme_container    shortClone(shortLexeme->clone(), true);
+    lexeme_container    shortRetagged(new lexeme(shortLexeme, 2), true);
+    lexeme_container    shortString(new lexeme(lexeme::symbols(shortText.begin(), shortText.end()), position(0, 0, 0), 1), true);
+    const lexeme*       shortAddress = shortLexeme.item();
+    
+    report("InlineLexeme",      !shortLexeme->is_view() && shortLexeme->length() == 5 && shortLexeme->content<char>() == "short" && shortLexeme->content() == shortString->content());
+    report("InlineOwnSymbols",  (const void*) shortLexeme->begin() >= (const void*) shortAddress && (const void*) shortLexeme->end() <= (const void*) (shortAddress + 1));
+    report("InlineClone",       shortClone->begin() != shortLexeme->begin() && shortClone->content<char>() == "short" && !shortClone->is_view());
+    report("InlineRetag",       shortRetagged->begin() != shortLexeme->begin() && shortRetagged->content<char>() == "short" && shortRetagged->matched() == 2);
+    report("InlineCompare",     !(*shortString < *shortLexeme) && !(*shortLexeme < *shortString));
+    
+    // Lexemes that are freed are re-used by the next lexeme that is created on the same thread
+    shortLexeme = lexeme_container();
+    lexeme_container    recycled(new lexeme(shortText.begin(), shortText.end(), position(0, 0, 0), 3), true);
+    report("RecycledLexeme",    recycled.item() == shortAddress && recycled->matched() == 3 && recycled->content<char>() == "short");
+    
+    // Interned lexemes with the same content share their symbols and ID, whatever they were lexed from
+    lexeme_interner     interner;
+    vector<int>         identifierText      = to_symbols("a long identifier");
+    vector<int>         otherIdentifierText = to_symbols("another identifier");
+    lexeme_container    firstIdentifier(new lexeme(&identifierText[0], identifierText.size(), position(0, 0, 0), 1), true);
+    lexeme_container    secondIdentifier(new lexeme(identifierText.begin(), identifierText.end(), position(20, 0, 20), 1), true);
+    lexeme_container    otherIdentifier(new lexeme(otherIdentifierText.begin(), otherIdentifierText.end(), position(40, 0, 40), 1), true);
+    lexeme_container    notInterned(new lexeme(identifierText.begin(), identifierText.end(), position(60, 0, 60), 2), true);
+    
+    interner.add_symbol(1);
+    
+    lexeme_container    internedFirst   = interner.intern(firstIdentifier);
+    lexeme_container    internedSecond  = interner.intern(secondIdentifier);
+    lexeme_container    internedOther   = interner.intern(otherIdentifier);
+    
+    report("InternSameId",      internedFirst->interned_id() == 0 && internedSecond->interned_id() == 0 && internedOther->interned_id() == 1);
+    report("InternShares",      internedFirst->begin() == internedSecond->begin() && internedFirst->begin() != firstIdentifier->begin() && internedFirst->content<char>() == "a long identifier");
+    report("InternPosition",    internedSecond->pos().offset() == 20 && internedSecond->matched() == 1);
+    report("InternOtherSymbol", interner.intern(notInterned).item() == notInterned.item() && notInterned->interned_id() == -1);
+    report("InternFind",        interner.count() == 2 && interner.find(&otherIdentifierText[0], &otherIdentifierText[0] + otherIdentifierText.size()) == 1 && interner.get(1)->content<char>() == "another identifier");
+    
+    delete hello;
+    delete space;
+    delete world;
+    delete worldClone;
+    
+    // Lexemes that span the blocks read from a stream should be reassembled correctly
+    string          longId(1000, 'a');
+    istringstream   longInput(longId + " " + longId);
+    stream = idLexer.create_stream_from<char>(longInput);
+    
+    lexeme* firstLong;
+    lexeme* longSpace;
+    lexeme* secondLong;
+    lexeme* longEnd;
+    
+    (*stream) >> firstLong >> longSpace >> secondLong >> longEnd;
+    delete stream;
+    
+    report("BlockFirst",        firstLong != NULL && firstLong->matched() == 1 && firstLong->content<char>() == longId);
+    report("BlockSpace",        longSpace != NULL && longSpace->matched() == 2 && longSpace->pos().offset() == 1000);
+    report("BlockSecond",       secondLong != NULL && secondLong->matched() == 1 && secondLong->content<char>() == longId);
+    report("BlockEnd",          longEnd == NULL);
+    
+    delete firstLong;
+    delete longSpace;
+    delete secondLong;
+    
+    // Many short lexemes should all be read correctly as the buffer is reused
+    string shortIds;
+    for (int x=0; x<1000; ++x) {
+        shortIds += "ab ";
+    }
+    
+    istringstream shortInput(shortIds);
+    stream = idLexer.create_stream_from<char>(shortInput);
+    
+    int     numShort    = 0;
+    bool    shortOk     = true;
+    
+    for (;;) {
+        lexeme* next;
+        (*stream) >> next;
+        if (!next) break;
+        
+        // Identifiers are at offsets 0, 3, 6... and spaces at 2, 5, 8...
+        int expectedOffset = (numShort/2) * 3 + ((numShort&1) ? 2 : 0);
+        if (next->pos().offset() != expectedOffset) shortOk = false;
+        if (next->matched() != ((numShort&1) ? 2 : 1)) shortOk = false;
+        
+        ++numShort;
+        delete next;
+    }
+    delete stream;
+    
+    report("RingCount",         numShort == 2000);
+    report("RingOffsets",       shortOk);
+    
+    // Lexing from a file
+    const char* filename = "dfa_lexer_test.txt";
+    FILE* testFile = fopen(filename, "wb");
+    fputs("hello \xc3\xa9", testFile);
+    fclose(testFile);
+    
+    lexeme* fileHello;
+    lexeme* fileSpace;
+    lexeme* fileAccent;
+    lexeme* fileEnd;
+    
+    stream = idLexer.create_stream_from_file(filename);
+    report("FileOpened", stream != NULL);
+    
+    if (stream) {
+        (*stream) >> fileHello >> fileSpace >> fileAccent >> fileEnd;
+        delete stream;
+        
+        report("FileHello",     fileHello != NULL && fileHello->matched() == 1 && fileHello->content<char>() == "hello");
+        report("FileSpace",     fileSpace != NULL && fileSpace->matched() == 2);
+        report("FileUtf8",      fileAccent != NULL && fileAccent->length() == 1 && fileAccent->content()[0] == 0xe9);
+        report("FileEnd",       fileEnd == NULL);
+        
+        delete fileHello;
+        delete fileSpace;
+        delete fileAccent;
+    }
+    
+    stream = idLexer.create_stream_from_file(filename, file_symbol_stream::bytes);
+    if (stream) {
+        (*stream) >> fileHello >> fileSpace >> fileAccent >> fileEnd;
+        delete stream;
+        
+        report("FileBytes",     fileAccent != NULL && fileAccent->length() == 1 && fileAccent->content()[0] == 0xc3 && fileEnd != NULL && fileEnd->content()[0] == 0xa9);
+        
+        delete fileHello;
+        delete fileSpace;
+        delete fileAccent;
+        delete fileEnd;
+    }
+    
+    remove(filename);
+    
+    report("FileMissing",       idLexer.create_stream_from_file("dfa_lexer_missing.txt") == NULL);
+    
+    // Lexing in parallel should produce exactly the same lexemes as lexing sequentially. Strings can contain
+    // newlines, so some of the chunks will start in the wrong place and have to be resynchronised
+    lexer parallelLexer;
+    parallelLexer.add_symbol("[a-z]+", 1);
+    parallelLexer.add_symbol("[ ]+", 2);
+    parallelLexer.add_symbol("\r?\n", 3);
+    parallelLexer.add_symbol("\"[^\"]*\"", 4);
+    parallelLexer.compile(false);
+    
+    stringstream parallelText;
+    for (int lineNum = 0; lineNum < 40000; ++lineNum) {
+        parallelText << "some words " << (lineNum % 7 == 0 ? "\"a string\non two lines\" " : "") << "here" << (lineNum % 3 == 0 ? "\r\n" : "\n");
+        
+        // A string long enough to cover the start of a chunk
+        if (lineNum == 20000) {
+            parallelText << "\"";
+            for (int stringLine = 0; stringLine < 10000; ++stringLine) parallelText << "long string\n";
+            parallelText << "\"";
+        }
+    }
+    
+    vector<int>     parallelBuffer      = to_symbols(parallelText.str());
+    lexeme_stream*  sequentialStream    = parallelLexer.create_stream_from_symbols(&parallelBuffer[0], &parallelBuffer[0] + parallelBuffer.size());
+    lexeme_stream*  parallelStream      = parallelLexer.create_parallel_stream_from_symbols(&parallelBuffer[0], &parallelBuffer[0] + parallelBuffer.size(), 4);
+    
+    bool    parallelSame    = true;
+    int     parallelCount   = 0;
+    for (;;) {
+        lexeme* sequential  = NULL;
+        lexeme* parallel    = NULL;
+        
+        (*sequentialStream) >> sequential;
+        (*parallelStream)   >> parallel;
+        
+        if (!sequential || !parallel) {
+            if (sequential || parallel) parallelSame = false;
+            delete sequential;
+            delete parallel;
+            break;
+        }
+        
+        if (sequential->matched() != parallel->matched() || sequential->begin() != parallel->begin() || sequential->length() != parallel->length() || sequential->pos() != parallel->pos()) {
+            parallelSame = false;
+        }
+        
+        ++parallelCount;
+        delete sequential;
+        delete parallel;
+    }
+    
+    delete sequentialStream;
+    delete parallelStream;
+    
+    report("ParallelSame",      parallelSame);
+    report("ParallelCount",     parallelCount > 200000);
+    
+    // Small inputs are lexed in the same way, just without any chunks
+    stream = parallelLexer.create_parallel_stream_from_symbols(&buffer[0], &buffer[0] + buffer.size(), 4);
+    
+    (*stream) >> hello >> space >> world >> end;
+    report("ParallelSmall",     hello != NULL && hello->content<char>() == "hello" && world != NULL && world->pos().offset() == 6 && end == NULL);
+    
+    delete hello;
+    delete space;
+    delete world;
+    delete stream;
+    
+    // Updating a position over a whole buffer should give the same result as updating it one symbol at a time
+    static const int newlineSymbols[] = { 0x0a, 0x0d, 0x0b, 0x0c, 0x85, 0x2028, 0x2029, 0x2027, 0x84, 0x09, 0x0e };
+    vector<int> positionBuffer;
+    for (int symbolNum = 0; symbolNum < 5000; ++symbolNum) {
+        // Mostly ordinary symbols, with newlines (and CR/LF pairs) at irregular intervals
+        if (symbolNum % 37 == 0) {
+            positionBuffer.push_back(0x0d);
+            positionBuffer.push_back(0x0a);
+        } else if (symbolNum % 11 == 0) {
+            positionBuffer.push_back(newlineSymbols[(symbolNum / 11) % 11]);
+        } else {
+            positionBuffer.push_back('a' + symbolNum % 26);
+        }
+    }
+    
+    bool positionSame = true;
+    for (size_t split = 1; split < 40; ++split) {
+        position_tracker bulk;
+        position_tracker single;
+        
+        bulk.update_position(&positionBuffer[0], &positionBuffer[0] + split);
+        bulk.update_position(&positionBuffer[0] + split, &positionBuffer[0] + positionBuffer.size());
+        
+        for (size_t symbolNum = 0; symbolNum < positionBuffer.size(); ++symbolNum) {
+            single.update_position(positionBuffer[symbolNum]);
+        }
+        
+        if (bulk.current_position() != single.current_position() || bulk.seen_return() != single.seen_return()) {
+            positionSame = false;
+        }
+    }
+    
+    report("BulkPositionSame",  positionSame);
+    
+    // Lexemes from a stream that only tracks offsets should have the same positions once they're looked up in a line index
+    line_index      lines(&parallelBuffer[0], &parallelBuffer[0] + parallelBuffer.size());
+    lexeme_stream*  fullStream      = parallelLexer.create_stream_from_symbols(&parallelBuffer[0], &parallelBuffer[0] + parallelBuffer.size());
+    lexeme_stream*  offsetStream    = parallelLexer.create_offset_stream_from_symbols(&parallelBuffer[0], &parallelBuffer[0] + parallelBuffer.size());
+    bool            offsetsOnly     = true;
+    bool            offsetsSame     = true;
+    
+    for (;;) {
+        lexeme* full        = NULL;
+        lexeme* offsetOnly  = NULL;
+        
+        (*fullStream)   >> full;
+        (*offsetStream) >> offsetOnly;
+        
+        if (!full || !offsetOnly) {
+            if (full || offsetOnly) offsetsSame = false;
+            delete full;
+            delete offsetOnly;
+            break;
+        }
+        
+        if (offsetOnly->pos().has_line()) offsetsOnly = false;
+        if (full->matched() != offsetOnly->matched() || lines.resolve(offsetOnly->pos()) != full->pos()) offsetsSame = false;
+        
+        delete full;
+        delete offsetOnly;
+    }
+    
+    delete fullStream;
+    delete offsetStream;
+    
+    report("OffsetStreamNoLines",   offsetsOnly);
+    report("OffsetStreamResolved",  offsetsSame && lines.count_lines() > 40000);
+
+    // Positions beyond 2^31 symbols shouldn't wrap around
+    static const int        largeSymbols[]  = { 'a', 0x0a, 'b' };
+    const stream_offset     largeOffset     = (stream_offset) 3 << 30;
+    position_tracker        largeTracker(position(largeOffset, largeOffset, 0));
+
+    largeTracker.update_offset(largeOffset);
+    largeTracker.update_position(largeSymbols, largeSymbols + 3);
+    position                largePos        = largeTracker.current_position();
+
+    report("LargePosition",     largePos.offset() == 2*largeOffset + 3 && largePos.line() == largeOffset + 1 && largePos.column() == 1 && largePos > position(largeOffset, largeOffset, 0));
+
+    line_index              largeLines(largeSymbols, largeSymbols + 3);
+    position                largeResolved   = largeLines.position_for(largeOffset);
+    report("LargeLineIndex",    largeResolved.line() == 1 && largeResolved.column() == largeOffset - 2);
+
+    lexeme*                 largeLexeme     = new lexeme(largeSymbols, 3, largePos, 7);
+    stringstream            largeStream;
+    largeLexeme->write(largeStream);
+    lexeme*                 largeRead       = lexeme::read(largeStream);
+
+    report("LargeLexemeRead",   largeRead != NULL && largeRead->pos() == largePos && largeRead->matched() == 7 && largeRead->length() == 3);
+    
+    // Lexemes written in a different format shouldn't be misread (altering the first byte changes the format tag)
+    string                  oldFormat       = largeStream.str();
+    oldFormat[0]                            = (char) (oldFormat[0] - 1);
+    stringstream            oldStream(oldFormat);
+    report("LexemeRejectsOldFormat", lexeme::read(oldStream) == NULL);
+    report("TokenPacked",       sizeof(token) == 3*sizeof(stream_offset) + 2*sizeof(int));
+
+    delete largeLexeme;
+    delete largeRead;
+
+    // Item scanners should split inputs at the top level only
+    string                      bracketText     = "  {\"a}\": [1, 2]} {'x\\''}\n; foo; (bar)  ";
+    vector<int>                 bracketBuffer(bracketText.begin(), bracketText.end());
+    bracket_boundary_scanner    bracketScanner(';');
+    vector<string>              bracketItems;
+    const int*                  itemBegin;
+    const int*                  itemEnd;
+
+    for (const int* itemPos = &bracketBuffer[0]; bracketScanner.next_item(itemPos, &bracketBuffer[0] + bracketBuffer.size(), itemBegin, itemEnd); itemPos = itemEnd) {
+        bracketItems.push_back(string(itemBegin, itemEnd));
+    }
+
+    report("BracketItems",      bracketItems.size() == 5 && bracketItems[0] == "{\"a}\": [1, 2]}" && bracketItems[1] == "{'x\\''}" && bracketItems[2] == ";" && bracketItems[3] == "foo;" && bracketItems[4] == "(bar)");
+
+    string                      lineText        = "one\r\n\n  two \nthree";
+    vector<int>                 lineBuffer(lineText.begin(), lineText.end());
+    line_boundary_scanner       lineScanner;
+    vector<string>              lineItems;
+
+    for (const int* itemPos = &lineBuffer[0]; lineScanner.next_item(itemPos, &lineBuffer[0] + lineBuffer.size(), itemBegin, itemEnd); itemPos = itemEnd) {
+        lineItems.push_back(string(itemBegin, itemEnd));
+    }
+
+    report("LineItems",         lineItems.size() == 3 && lineItems[0] == "one" && lineItems[1] == "two " && lineItems[2] == "three");
+    
+    // Streams that skip symbols should return the same lexemes as a stream that doesn't, with the skipped ones left out
+    static const bool   skipSpace[]     = { false, false, true, true, false };
+    stringstream        skipText(parallelText.str());
+    lexeme_stream*      unskipped       = parallelLexer.create_stream_from_symbols(&parallelBuffer[0], &parallelBuffer[0] + parallelBuffer.size());
+    lexeme_stream*      skipStable      = parallelLexer.create_stream_from_symbols(&parallelBuffer[0], &parallelBuffer[0] + parallelBuffer.size());
+    lexeme_stream*      skipBuffered    = parallelLexer.create_stream_from<char>(skipText);
+    bool                canSkip         = skipStable->skip_symbols(skipSpace, 5) && skipBuffered->skip_symbols(skipSpace, 5);
+    bool                skipSame        = true;
+    int                 skipCount       = 0;
+    
+    for (;;) {
+        lexeme* full        = NULL;
+        lexeme* stable      = NULL;
+        lexeme* buffered    = NULL;
+        
+        // Find the next lexeme that isn't skipped in the full stream
+        for (;;) {
+            (*unskipped) >> full;
+            if (!full || !skipSpace[full->matched()]) break;
+            delete full;
+        }
+        
+        (*skipStable)   >> stable;
+        (*skipBuffered) >> buffered;
+        
+        if (!full || !stable || !buffered) {
+            if (full || stable || buffered) skipSame = false;
+            delete full;
+            delete stable;
+            delete buffered;
+            break;
+        }
+        
+        if (full->matched() != stable->matched() || full->pos() != stable->pos() || full->length() != stable->length()) skipSame = false;
+        if (full->matched() != buffered->matched() || full->pos() != buffered->pos() || full->content<char>() != buffered->content<char>()) skipSame = false;
+        
+        ++skipCount;
+        delete full;
+        delete stable;
+        delete buffered;
+    }
+    
+    delete unskipped;
+    delete skipStable;
+    delete skipBuffered;
+    
+    report("SkipSymbolsSame",       canSkip && skipSame && skipCount > 80000);
+    
+    // Lexemes are recycled, so lexing a buffer of symbols should hardly allocate anything
+    lexeme_stream*  budgetStream    = parallelLexer.create_stream_from_symbols(&parallelBuffer[0], &parallelBuffer[0] + parallelBuffer.size());
+    long            budgetLexemes   = 0;
+    test_budget     lexBudget;
+    
+    for (;;) {
+        lexeme* nextLexeme = NULL;
+        (*budgetStream) >> nextLexeme;
+        if (!nextLexeme) break;
+        
+        ++budgetLexemes;
+        delete nextLexeme;
+    }
+    
+    report_allocations("LexAllocations", lexBudget, budgetLexemes / 100);
+    delete budgetStream;
+    
+    // Streams restricted to some valid symbols find the longest lexeme for a valid symbol, or carry on as usual if there isn't one
+    lexer contextLexer;
+    contextLexer.add_symbol("if", 0);
+    contextLexer.add_symbol("[a-z]+", 1);
+    contextLexer.add_symbol(">", 2);
+    contextLexer.add_symbol(">>", 3);
+    contextLexer.compile();
+    
+    static const unsigned int allSymbols[]      = { 0xf };
+    static const unsigned int identOrGreater[]  = { (1u<<1) | (1u<<2) };
+    static const unsigned int identOnly[]       = { 1u<<1 };
+    static const unsigned int noSymbols[]       = { 0 };
+    
+    report("ValidSymbolsAll",           valid_lexemes(contextLexer, "if>>", allSymbols, false) == "0:2 3:2 ");
+    report("ValidSymbolsShorter",       valid_lexemes(contextLexer, "if>>", identOrGreater, false) == "1:2 2:1 2:1 ");
+    report("ValidSymbolsFallBack",      valid_lexemes(contextLexer, "if>>", identOnly, false) == "1:2 3:2 ");
+    report("ValidSymbolsNone",          valid_lexemes(contextLexer, "if>>", noSymbols, false) == "0:2 3:2 ");
+    report("ValidSymbolsLongest",       valid_lexemes(contextLexer, "iffy", identOnly, false) == "1:4 ");
+    report("ValidSymbolsUnrestricted",  valid_lexemes(contextLexer, "if>>", NULL, false) == "0:2 3:2 ");
+    report("ValidSymbolsBuffered",      valid_lexemes(contextLexer, "if>>", identOrGreater, true) == "1:2 2:1 2:1 ");
+    report("ValidSymbolsBufferedFallBack", valid_lexemes(contextLexer, "if>>", identOnly, true) == "1:2 3:2 " && valid_lexemes(contextLexer, "iffy", identOnly, true) == "1:4 ");
+    
+    // Tokenizing a buffer should produce the same symbols and positions as reading lexemes from it
+    vector<token> tokens;
+    parallelLexer.tokenize_all(&parallelBuffer[0], &parallelBuffer[0] + parallelBuffer.size(), tokens);
+    
+    bool            tokensSame  = true;
+    size_t          tokenIndex  = 0;
+    lexeme_stream*  tokenStream = parallelLexer.create_stream_from_symbols(&parallelBuffer[0], &parallelBuffer[0] + parallelBuffer.size());
+    for (;;) {
+        lexeme* next = NULL;
+        (*tokenStream) >> next;
+        if (!next) break;
+        
+        if (tokenIndex >= tokens.size()) {
+            tokensSame = false;
+        } else {
+            const token& tok = tokens[tokenIndex];
+            if (tok.symbol != next->matched() || tok.length != (int) next->length() || tok.offset != next->pos().offset() || tok.line != next->pos().line() || tok.column != next->pos().column()) {
+                tokensSame = false;
+            }
+        }
+        
+        ++tokenIndex;
+        delete next;
+    }
+    delete tokenStream;
+    
+    report("TokenizeSame",      tokensSame && tokenIndex == tokens.size() && tokenIndex > 200000);
+    
+    // Tokenizing into a small array can be carried on with the same cursor
+    token_cursor    tokenCursor(&parallelBuffer[0], &parallelBuffer[0] + parallelBuffer.size());
+    token           tokenBlock[3];
+    size_t          blockTotal  = 0;
+    bool            blocksSame  = true;
+    
+    while (!tokenCursor.at_end()) {
+        size_t count = parallelLexer.tokenize(tokenCursor, tokenBlock, 3);
+        if (count == 0) break;
+        
+        for (size_t index = 0; index < count; ++index, ++blockTotal) {
+            if (blockTotal >= tokens.size() || tokenBlock[index].offset != tokens[blockTotal].offset || tokenBlock[index].line != tokens[blockTotal].line) {
+                blocksSame = false;
+            }
+        }
+    }
+    
+    report("TokenizeBlocks",    blocksSame && blockTotal == tokens.size());
+    
+    // Tokenizing a batch of buffers should give the same tokens as tokenizing each buffer on its own
+    vector<int>         batchFirst  = to_symbols("some words");
+    vector<int>         batchSecond = to_symbols("");
+    vector<int>         batchThird  = to_symbols("\"more\"\nwords");
+    const int*          batchBegins[3]  = { &batchFirst[0], NULL, &batchThird[0] };
+    const int*          batchEnds[3]    = { &batchFirst[0] + batchFirst.size(), NULL, &batchThird[0] + batchThird.size() };
+    vector<token>       batchTokens;
+    vector<size_t>      batchStarts;
+    
+    parallelLexer.tokenize_batch(batchBegins, batchEnds, 3, batchTokens, batchStarts);
+    
+    vector<token> thirdTokens;
+    parallelLexer.tokenize_all(batchBegins[2], batchEnds[2], thirdTokens);
+    
+    bool batchSame = batchStarts.size() == 3 && batchStarts[0] == 0 && batchStarts[1] == 3 && batchStarts[2] == 3 && batchTokens.size() == 3 + thirdTokens.size();
+    for (size_t index = 0; batchSame && index < thirdTokens.size(); ++index) {
+        const token& batched = batchTokens[3 + index];
+        const token& single  = thirdTokens[index];
+        
+        if (batched.symbol != single.symbol || batched.offset != single.offset || batched.length != single.length || batched.line != single.line || batched.column != single.column) {
+            batchSame = false;
+        }
+    }
+    
+    report("TokenizeBatch",     batchSame && batchTokens[3].offset == 0 && batchTokens.back().line == 1);
+    
+    // Streams restarted from a checkpoint carry on in the same way as the original stream
+    vector<int>         checkpointBuffer    = to_symbols("some words\r\nmore \"words\" here\nend");
+    lexeme_stream*      checkpointStream    = parallelLexer.create_stream_from_symbols(&checkpointBuffer[0], &checkpointBuffer[0] + checkpointBuffer.size());
+    lexer_checkpoint    checkpoint;
+    
+    for (int skipped = 0; skipped < 4; ++skipped) {
+        lexeme* skip = NULL;
+        (*checkpointStream) >> skip;
+        delete skip;
+    }
+    
+    bool hasCheckpoint = checkpointStream->checkpoint(checkpoint);
+    report("CheckpointTaken",   hasCheckpoint && checkpoint.offset() == 12 && checkpoint.pos().line() == 1 && checkpoint.pos().column() == 0);
+    
+    lexeme_stream*  restartedStream = parallelLexer.create_stream_from_checkpoint(&checkpointBuffer[0], &checkpointBuffer[0] + checkpointBuffer.size(), checkpoint);
+    bool            restartedSame   = restartedStream != NULL;
+    int             restartedCount  = 0;
+    
+    while (restartedSame) {
+        lexeme* original    = NULL;
+        lexeme* restarted   = NULL;
+        
+        (*checkpointStream) >> original;
+        (*restartedStream)  >> restarted;
+        
+        if (!original || !restarted) {
+            if (original || restarted) restartedSame = false;
+            delete original;
+            delete restarted;
+            break;
+        }
+        
+        if (original->matched() != restarted->matched() || original->content() != restarted->content() || original->pos() != restarted->pos()) {
+            restartedSame = false;
+        }
+        
+        ++restartedCount;
+        delete original;
+        delete restarted;
+    }
+    
+    report("CheckpointRestart", restartedSame && restartedCount == 7);
+    
+    delete checkpointStream;
+    delete restartedStream;
+    
+    // Lexers that match UTF-8 bytes directly
+    symbol_string latinWord;
+    latinWord += '[';
+    latinWord += 'a'; latinWord += '-'; latinWord += 'z';
+    latinWord += 0xe0; latinWord += '-'; latinWord += 0xff;
+    latinWord += ']'; latinWord += '+';
+    
+    symbol_string cjkWord;
+    cjkWord += '[';
+    cjkWord += 0x4e00; cjkWord += '-'; cjkWord += 0x9fff;
+    cjkWord += ']'; cjkWord += '+';
+    
+    symbol_string emoticon;
+    emoticon += '[';
+    emoticon += 0x1f600; emoticon += '-'; emoticon += 0x1f64f;
+    emoticon += ']';
+    
+    lexer utf8Lexer;
+    utf8Lexer.set_utf8(true);
+    utf8Lexer.add_symbol(latinWord, 1);
+    utf8Lexer.add_symbol("[ ]+", 2);
+    utf8Lexer.add_symbol(cjkWord, 3);
+    utf8Lexer.add_symbol(emoticon, 4);
+    utf8Lexer.compile();
+    
+    vector<int> utf8Buffer = to_symbols("caf\xc3\xa9 \xe4\xb8\xad\xe6\x96\x87 \xf0\x9f\x98\x80\xc3\x80");
+    stream = utf8Lexer.create_stream_from_symbols(&utf8Buffer[0], &utf8Buffer[0] + utf8Buffer.size());
+    
+    lexeme* utf8Latin;
+    lexeme* utf8Space;
+    lexeme* utf8Cjk;
+    lexeme* utf8Space2;
+    lexeme* utf8Emoticon;
+    lexeme* utf8Reject;
+    
+    (*stream) >> utf8Latin >> utf8Space >> utf8Cjk >> utf8Space2 >> utf8Emoticon >> utf8Reject;
+    delete stream;
+    
+    report("Utf8Latin",         utf8Latin != NULL && utf8Latin->matched() == 1 && utf8Latin->length() == 5);
+    report("Utf8Cjk",           utf8Cjk != NULL && utf8Cjk->matched() == 3 && utf8Cjk->length() == 6);
+    report("Utf8Emoticon",      utf8Emoticon != NULL && utf8Emoticon->matched() == 4 && utf8Emoticon->length() == 4);
+    report("Utf8Reject",        utf8Reject != NULL && utf8Reject->matched() == -1);
+    
+    delete utf8Latin;
+    delete utf8Space;
+    delete utf8Cjk;
+    delete utf8Space2;
+    delete utf8Emoticon;
+    delete utf8Reject;
+    
+    // Narrow streams should supply bytes above 0x7f without sign extension
+    istringstream narrowInput("caf\xc3\xa9 \xe4\xb8\xad");
+    stream = utf8Lexer.create_stream_from(narrowInput);
+    
+    lexeme* narrowLatin;
+    lexeme* narrowSpace;
+    lexeme* narrowCjk;
+    
+    (*stream) >> narrowLatin >> narrowSpace >> narrowCjk;
+    delete stream;
+    
+    report("Utf8NarrowStream",  narrowLatin != NULL && narrowLatin->matched() == 1 && narrowLatin->content<char>() == "caf\xc3\xa9"
+                                && narrowCjk != NULL && narrowCjk->matched() == 3 && narrowCjk->length() == 3);
+    
+    delete narrowLatin;
+    delete narrowSpace;
+    delete narrowCjk;
+    
+    // Packed state machines should behave the same as the standard ones
+    ndfa_regex packedRegex;
+    packedRegex.add_regex(0, "[a-z][a-z0-9_]*", accept_action(1));
+    packedRegex.add_regex(0, "[0-9]+(\\.[0-9]+)?", accept_action(2));
+    packedRegex.add_regex(0, L"\x0100\x0101+", accept_action(3));
+    
+    ndfa* packedUnique  = packedRegex.to_ndfa_with_unique_symbols();
+    ndfa* packedDfa     = packedUnique->to_dfa();
+    delete packedUnique;
+    
+    state_machine<wchar_t>                          flatMachine(*packedDfa);
+    packed_state_machine<wchar_t, unsigned char>    packedMachine(*packedDfa);
+    
+    bool packedOk = true;
+    for (int stateId = 0; stateId < packedDfa->count_states(); ++stateId) {
+        for (int chr = 0; chr < 0x200; ++chr) {
+            if (flatMachine.run(stateId, (wchar_t) chr) != packedMachine.run(stateId, (wchar_t) chr)) {
+                packedOk = false;
+            }
+        }
+    }
+    
+    report("PackedFits",        packed_state_machine<wchar_t, unsigned char>::fits(*packedDfa));
+    report("PackedSame",        packedOk);
+    report("PackedSmaller",     packedMachine.size() < flatMachine.size());
+    
+    // Comb state machines should also behave the same as the standard ones
+    comb_state_machine<wchar_t> combMachine(*packedDfa);
+    
+    bool combOk = true;
+    for (int stateId = 0; stateId < packedDfa->count_states(); ++stateId) {
+        for (int chr = 0; chr < 0x200; ++chr) {
+            if (flatMachine.run(stateId, (wchar_t) chr) != combMachine.run(stateId, (wchar_t) chr)) {
+                combOk = false;
+            }
+        }
+    }
+    
+    report("CombSame",          combOk);
+    report("CombSmaller",       combMachine.size() < flatMachine.size());
+    report("CombDense",         combMachine.table().count_cells() < packedDfa->count_states() * packedDfa->symbols().count_sets());
+    
+    // Hard-coded flat tables store the new state plus one for every state and symbol set
+    int                     numFlatSets = packedDfa->symbols().count_sets();
+    vector<unsigned char>   flatCells((size_t) packedDfa->count_states() * numFlatSets, 0);
+    
+    for (int stateId = 0; stateId < packedDfa->count_states(); ++stateId) {
+        const state& thisState = packedDfa->get_state(stateId);
+        
+        for (state::iterator transit = thisState.begin(); transit != thisState.end(); ++transit) {
+            flatCells[stateId * numFlatSets + transit->symbol_set()] = (unsigned char) (transit->new_state() + 1);
+        }
+    }
+    
+    flat_table_translator                                                           flatTranslator(packedDfa->symbols());
+    state_machine_flat_tables<wchar_t, flat_table_translator, unsigned char>        flatTables(flatTranslator, &flatCells[0], packedDfa->count_states(), numFlatSets);
+    
+    bool flatTablesOk = true;
+    for (int stateId = 0; stateId < packedDfa->count_states(); ++stateId) {
+        for (int chr = 0; chr < 0x200; ++chr) {
+            if (flatMachine.run(stateId, (wchar_t) chr) != flatTables.run(stateId, (wchar_t) chr)) {
+                flatTablesOk = false;
+            }
+        }
+    }
+    
+    report("FlatTablesSame",    flatTablesOk);
+    report("FlatTablesRange",   flatTables.run(-1, L'a') == -1 && flatTables.run(packedDfa->count_states(), L'a') == -1);
+    
+    // Lexers can be given a different runner for their state machine
+    dfa_lexer_base<state_machine<wchar_t>, 0, 0, true, const state_machine<wchar_t>&, counting_runner> runnerLexer(*packedDfa);
+    
+    vector<int> runnerBuffer = to_symbols("12.5abc");
+    stream = runnerLexer.create_stream_from_symbols(&runnerBuffer[0], &runnerBuffer[0] + runnerBuffer.size());
+    
+    lexeme* runnerNumber;
+    lexeme* runnerIdentifier;
+    (*stream) >> runnerNumber >> runnerIdentifier;
+    delete stream;
+    
+    report("RunnerStable",      runnerNumber != NULL && runnerNumber->matched() == 2 && runnerNumber->length() == 4 && runnerIdentifier != NULL && runnerIdentifier->matched() == 1 && runnerIdentifier->length() == 3);
+    report("RunnerUsed",        counting_runner::s_Calls >= 2);
+    
+    delete runnerNumber;
+    delete runnerIdentifier;
+    
+    counting_runner::s_Calls = 0;
+    istringstream runnerInput("12.5abc");
+    stream = runnerLexer.create_stream_from<char>(runnerInput);
+    
+    (*stream) >> runnerNumber >> runnerIdentifier;
+    delete stream;
+    
+    report("RunnerBuffered",    runnerNumber != NULL && runnerNumber->matched() == 2 && runnerNumber->length() == 4 && runnerIdentifier != NULL && runnerIdentifier->matched() == 1 && runnerIdentifier->length() == 3);
+    report("RunnerUsedBuffered", counting_runner::s_Calls >= 2);
+    
+    delete runnerNumber;
+    delete runnerIdentifier;
+    
+    // Streams created with their actual type can be read without going through operator>>
+    typedef dfa_lexer_base<state_machine<wchar_t>, 0, 0, true, const state_machine<wchar_t>&, counting_runner> runner_lexer;
+    
+    runner_lexer::stream* staticStream = runnerLexer.create_static_stream(new buffer_symbol_stream(&runnerBuffer[0], &runnerBuffer[0] + runnerBuffer.size()));
+    lexeme* staticEnd;
+    staticStream->read(runnerNumber);
+    staticStream->read(runnerIdentifier);
+    staticStream->read(staticEnd);
+    delete staticStream;
+    
+    report("StaticStream",      runnerNumber != NULL && runnerNumber->matched() == 2 && runnerNumber->length() == 4 && runnerIdentifier != NULL && runnerIdentifier->length() == 3 && staticEnd == NULL);
+    
+    delete runnerNumber;
+    delete runnerIdentifier;
+    
+    // Rows that don't overlap should share the same cells
+    vector<comb_vector::row> combRows(3);
+    combRows[0].push_back(comb_vector::cell(0, 10));
+    combRows[0].push_back(comb_vector::cell(2, 11));
+    combRows[1].push_back(comb_vector::cell(1, 20));
+    combRows[1].push_back(comb_vector::cell(3, 21));
+    combRows[2].push_back(comb_vector::cell(5, 30));
+    
+    comb_vector combVector(combRows);
+    comb_vector combCopy(combVector);
+    
+    report("CombVectorLookup1", combVector.lookup(0, 0) == 10 && combVector.lookup(0, 2) == 11);
+    report("CombVectorLookup2", combVector.lookup(1, 1) == 20 && combVector.lookup(1, 3) == 21 && combVector.lookup(2, 5) == 30);
+    report("CombVectorMissing", combVector.lookup(0, 1) == -1 && combVector.lookup(1, 0) == -1 && combVector.lookup(2, 4, -2) == -2);
+    report("CombVectorBounds",  combVector.lookup(0, -1) == -1 && combVector.lookup(2, 1000) == -1);
+    report("CombVectorPacked",  combVector.count_cells() <= 5);
+    report("CombVectorCopy",    combCopy.lookup(1, 3) == 21 && combCopy.lookup(0, 1) == -1);
+    
+    // Strings and comments loop on all but a few symbols, so they should be skipped through
+    ndfa_regex skipRegex;
+    skipRegex.add_regex(0, "\"([^\"\\\\]|\\\\.)*\"", accept_action(1));
+    skipRegex.add_regex(0, "/\\*([^*]|\\*+[^*/])*\\*+/", accept_action(2));
+    skipRegex.add_regex(0, "[a-z]+", accept_action(3));
+    skipRegex.add_regex(0, "[ ]+", accept_action(4));
+    
+    ndfa*       skipUnique  = skipRegex.to_ndfa_with_unique_symbols();
+    ndfa*       skipDfa     = skipUnique->to_dfa();
+    skip_state* skipStates  = find_skip_states(*skipDfa);
+    int         numSkip     = 0;
+    delete skipUnique;
+    
+    for (int stateId = 0; skipStates && stateId < skipDfa->count_states(); ++stateId) {
+        if (skipStates[stateId].count > 0) ++numSkip;
+    }
+    
+    ndfa_regex  idRegex;
+    idRegex.add_regex(0, "[a-z]+", accept_action(1));
+    ndfa*       idUnique    = idRegex.to_ndfa_with_unique_symbols();
+    ndfa*       idDfa       = idUnique->to_dfa();
+    skip_state* idSkip      = find_skip_states(*idDfa);
+    delete idUnique;
+    
+    report("SkipStatesFound",   numSkip >= 2);
+    report("SkipStatesNone",    idSkip == NULL);
+    
+    // Looking for the exit of a skip state should find the same symbol as checking each symbol in turn
+    vector<int> exitBuffer;
+    for (int x=0; x<500; ++x) {
+        switch (x % 37) {
+            case 5:     exitBuffer.push_back(0x4e2d);   break;
+            case 11:    exitBuffer.push_back(0x1f600);  break;
+            case 17:    exitBuffer.push_back('"');      break;
+            case 23:    exitBuffer.push_back(0x7f);     break;
+            case 29:    exitBuffer.push_back('\\');     break;
+            case 31:    exitBuffer.push_back(-1);       break;
+            default:    exitBuffer.push_back('a' + x % 26); break;
+        }
+    }
+    
+    bool exitSame = numSkip > 0;
+    for (int stateId = 0; skipStates && stateId < skipDfa->count_states(); ++stateId) {
+        const skip_state& skip = skipStates[stateId];
+        if (skip.count == 0) continue;
+        
+        for (size_t start = 0; start < exitBuffer.size(); ++start) {
+            const int* begin    = &exitBuffer[0] + start;
+            const int* end      = &exitBuffer[0] + exitBuffer.size();
+            const int* expected = begin;
+            while (expected != end && !is_exit(skip, *expected)) ++expected;
+            
+            if (find_exit(skip, begin, end) != expected) exitSame = false;
+        }
+    }
+    
+    report("FindExitSame",      exitSame);
+    
+    // Long strings and comments should be matched in full
+    string          longString  = "\"" + string(300, 'x') + "\\\"" + string(300, 'y') + "\xe4\xb8\xad\"";
+    string          longComment = "/*" + string(400, ' ') + "**" + string(100, '/') + "*/";
+    vector<int>     skipInput   = to_symbols(longString + " " + longComment + " abc");
+    lexer           skipLexer(*skipDfa);
+    lexeme_stream*  skipStream  = skipLexer.create_stream_from_symbols(&skipInput[0], &skipInput[0] + skipInput.size());
+    
+    lexeme* skipString;
+    lexeme* skipSpace1;
+    lexeme* skipComment;
+    lexeme* skipSpace2;
+    lexeme* skipId;
+    lexeme* skipEnd;
+    
+    (*skipStream) >> skipString >> skipSpace1 >> skipComment >> skipSpace2 >> skipId >> skipEnd;
+    delete skipStream;
+    
+    report("SkipLongString",    skipString != NULL && skipString->matched() == 1 && skipString->length() == longString.size());
+    report("SkipLongComment",   skipComment != NULL && skipComment->matched() == 2 && skipComment->length() == longComment.size());
+    report("SkipAfterward",     skipId != NULL && skipId->matched() == 3 && skipId->content<char>() == "abc" && skipEnd == NULL);
+    
+    delete skipString;
+    delete skipSpace1;
+    delete skipComment;
+    delete skipSpace2;
+    delete skipId;
+    delete[] skipStates;
+    delete[] idSkip;
+    delete skipDfa;
+    
+    // Lexemes that can't be any longer should be accepted without reading another symbol
+    ndfa_regex  commitRegex;
+    commitRegex.add_regex(0, ";", accept_action(1));
+    commitRegex.add_regex(0, "[a-z]+", accept_action(2));
+    
+    ndfa*   commitUnique    = commitRegex.to_ndfa_with_unique_symbols();
+    ndfa*   commitDfa       = commitUnique->to_dfa();
+    bool*   commitStates    = find_commit_states(*commitDfa);
+    bool*   idCommit        = find_commit_states(*idDfa);
+    int     numCommit       = 0;
+    delete commitUnique;
+    
+    for (int stateId = 0; commitStates && stateId < commitDfa->count_states(); ++stateId) {
+        if (commitStates[stateId]) ++numCommit;
+    }
+    
+    report("CommitStatesFound", numCommit == 1);
+    report("CommitStatesNone",  idCommit == NULL);
+    
+    lexer                   commitLexer(*commitDfa);
+    trickle_symbol_stream*  trickle         = new trickle_symbol_stream(to_symbols(";ab;"));
+    lexeme_stream*          commitStream    = commitLexer.create_stream(trickle);
+    
+    lexeme* commitSemi;
+    (*commitStream) >> commitSemi;
+    int     semiReads   = trickle->reads;
+    
+    lexeme* commitId;
+    lexeme* commitSemi2;
+    lexeme* commitEnd;
+    (*commitStream) >> commitId >> commitSemi2 >> commitEnd;
+    delete commitStream;
+    
+    report("CommitWithoutReading",  commitSemi != NULL && commitSemi->matched() == 1 && semiReads == 1);
+    report("CommitAfterward",       commitId != NULL && commitId->content<char>() == "ab" && commitSemi2 != NULL && commitSemi2->matched() == 1 && commitEnd == NULL);
+    
+    delete commitSemi;
+    delete commitId;
+    delete commitSemi2;
+    
+    // Lexing an interactive stream shouldn't wait for more input than is needed to match the next lexeme
+    vector<string> chunks;
+    chunks.push_back("hello ");
+    chunks.push_back("world");
+    
+    chunked_buf     chunkedBuf(chunks);
+    istream         chunkedInput(&chunkedBuf);
+    lexeme_stream*  chunkedStream   = idLexer.create_stream_from(chunkedInput);
+    
+    lexeme* chunkedHello;
+    (*chunkedStream) >> chunkedHello;
+    int     helloWaits  = chunkedBuf.waits;
+    
+    lexeme* chunkedSpace;
+    lexeme* chunkedWorld;
+    lexeme* chunkedEnd;
+    (*chunkedStream) >> chunkedSpace >> chunkedWorld >> chunkedEnd;
+    delete chunkedStream;
+    
+    report("StreamReadsAvailable",  chunkedHello != NULL && chunkedHello->content<char>() == "hello" && helloWaits == 1);
+    report("StreamReadsRemainder",  chunkedSpace != NULL && chunkedWorld != NULL && chunkedWorld->content<char>() == "world" && chunkedEnd == NULL);
+    
+    delete chunkedHello;
+    delete chunkedSpace;
+    delete chunkedWorld;
+    
+    chunked_buf     decodedBuf(chunks);
+    istream         decodedInput(&decodedBuf);
+    utf8reader      decodedReader(&decodedInput);
+    lexeme_stream*  decodedStream   = idLexer.create_stream_from<wchar_t>(decodedReader);
+    
+    lexeme* decodedHello;
+    (*decodedStream) >> decodedHello;
+    delete decodedStream;
+    
+    report("DecodedReadsAvailable", decodedHello != NULL && decodedHello->content<char>() == "hello" && decodedBuf.waits == 1);
+    delete decodedHello;
+    
+    // Lexemes that need more symbols than the length limit are cut off rather than buffered in full
+    vector<int>     limitInput      = to_symbols("ab;" + string(200, 'x'));
+    lexeme_stream*  stableLimited   = commitLexer.create_stream_from_symbols(&limitInput[0], &limitInput[0] + limitInput.size());
+    lexeme_stream*  bufferedLimited = commitLexer.create_stream(new trickle_symbol_stream(limitInput));
+    bool            limitsSame      = true;
+    
+    report("LimitLexemeLengthSupported", stableLimited->set_max_lexeme_length(16) && bufferedLimited->set_max_lexeme_length(16));
+    
+    for (int streamNum = 0; streamNum < 2; ++streamNum) {
+        lexeme_stream*  limited = streamNum == 0 ? stableLimited : bufferedLimited;
+        lexeme*         limitId;
+        lexeme*         limitSemi;
+        lexeme*         limitLong;
+        
+        (*limited) >> limitId >> limitSemi >> limitLong;
+        
+        if (!limitId || limitId->content<char>() != "ab") limitsSame = false;
+        if (!limitSemi || limitSemi->matched() != 1) limitsSame = false;
+        if (!limitLong || limitLong->matched() != -1 || limitLong->length() != 17) limitsSame = false;
+        
+        delete limitId;
+        delete limitSemi;
+        delete limitLong;
+        delete limited;
+    }
+    
+    report("LimitLexemeLength", limitsSame);
+    delete[] commitStates;
+    delete[] idCommit;
+    delete commitDfa;
+    delete idDfa;
+    
+    // Binary lexers should match the same lexemes as the lexer they were written from
+    stringstream binaryStream;
+    binary_lexer::write_binary(binaryStream, *packedDfa);
+    
+    string      binaryData = binaryStream.str();
+    vector<int> binaryBuffer(binaryData.size() / sizeof(int) + 1);
+    memcpy(&binaryBuffer[0], binaryData.data(), binaryData.size());
+    
+    binary_lexer*   binaryLexer = binary_lexer::from_binary(&binaryBuffer[0], binaryData.size());
+    lexer           dfaLexer(*packedDfa);
+    
+    vector<int> binaryInput = to_symbols("ab_1" "42.7");
+    binaryInput.push_back(0x100);
+    binaryInput.push_back(0x101);
+    binaryInput.push_back(0x101);
+    binaryInput.push_back('?');
+    binaryInput.push_back('x');
+    
+    bool binarySame     = binaryLexer != NULL;
+    int  binaryCount    = 0;
+    if (binaryLexer) {
+        lexeme_stream* fromBinary   = binaryLexer->create_stream_from_symbols(&binaryInput[0], &binaryInput[0] + binaryInput.size());
+        lexeme_stream* fromDfa      = dfaLexer.create_stream_from_symbols(&binaryInput[0], &binaryInput[0] + binaryInput.size());
+        
+        for (;;) {
+            lexeme* binaryLexeme;
+            lexeme* dfaLexeme;
+            
+            (*fromBinary) >> binaryLexeme;
+            (*fromDfa) >> dfaLexeme;
+            
+            if (!binaryLexeme || !dfaLexeme) {
+                if (binaryLexeme != dfaLexeme) binarySame = false;
+                delete binaryLexeme;
+                delete dfaLexeme;
+                break;
+            }
+            
+            if (binaryLexeme->matched() != dfaLexeme->matched() || binaryLexeme->content() != dfaLexeme->content()) binarySame = false;
+            ++binaryCount;
+            
+            delete binaryLexeme;
+            delete dfaLexeme;
+        }
+        
+        delete fromBinary;
+        delete fromDfa;
+    }
+    
+    report("BinaryLexerLoaded", binaryLexer != NULL);
+    report("BinaryLexerSame",   binarySame && binaryCount == 6);
+    report("BinaryTruncated",   binary_lexer::from_binary(&binaryBuffer[0], binaryData.size() - sizeof(int)) == NULL);
+    
+    binaryBuffer[0] = ~binaryBuffer[0];
+    report("BinaryBadMagic",    binary_lexer::from_binary(&binaryBuffer[0], binaryData.size()) == NULL);
+    
+    delete binaryLexer;
+    delete packedDfa;
+    
+    // Lazy lexers should produce the same lexemes as lexers that build their DFA in advance
+    lexer eagerLexer;
+    lexer lazyLexer;
+    lexer tinyLexer;
+    
+    lexer* lexers[] = { &eagerLexer, &lazyLexer, &tinyLexer };
+    for (int lexerNum = 0; lexerNum < 3; ++lexerNum) {
+        lexers[lexerNum]->add_symbol("[a-z]+", 1);
+        lexers[lexerNum]->add_symbol("[a-z]+[0-9]+", 2);
+        lexers[lexerNum]->add_symbol("[ ]+", 3);
+        lexers[lexerNum]->add_symbol("\r?\n", 4);
+        lexers[lexerNum]->add_symbol("if|while|whilst", 5);
+    }
+    
+    eagerLexer.compile();
+    lazyLexer.compile_lazy();
+    tinyLexer.compile_lazy(1);
+    
+    stringstream lazyText;
+    for (int lineNum = 0; lineNum < 2000; ++lineNum) {
+        lazyText << "if while whilst whilst2 " << (lineNum % 5 == 0 ? "ab12 !" : "word") << (lineNum % 3 == 0 ? "\r\n" : "\n");
+    }
+    
+    vector<int> lazyBuffer  = to_symbols(lazyText.str());
+    const int*  lazyBegin   = &lazyBuffer[0];
+    const int*  lazyEnd     = &lazyBuffer[0] + lazyBuffer.size();
+    int         lazyCount   = 0;
+    
+    bool lazySame = same_lexemes(eagerLexer.create_stream_from_symbols(lazyBegin, lazyEnd), lazyLexer.create_stream_from_symbols(lazyBegin, lazyEnd), lazyCount);
+    report("LazySame",          lazySame && lazyCount > 20000);
+    
+    // Emptying the cache on every new state should still give the same results
+    bool tinySame = same_lexemes(eagerLexer.create_stream_from_symbols(lazyBegin, lazyEnd), tinyLexer.create_stream_from_symbols(lazyBegin, lazyEnd), lazyCount);
+    report("LazyTinyCache",     tinySame && lazyCount > 20000);
+    
+    // Pipelined streams should return the same lexemes as the stream they read from
+    bool pipelinedSame = same_lexemes(eagerLexer.create_stream_from_symbols(lazyBegin, lazyEnd), new pipelined_lexeme_stream(eagerLexer.create_stream_from_symbols(lazyBegin, lazyEnd)), lazyCount);
+    report("PipelinedSame",     pipelinedSame && lazyCount > 20000);
+    
+    // ... and should stop cleanly if they are destroyed before the end of the input
+    lexeme_stream*  directStream    = eagerLexer.create_stream_from_symbols(lazyBegin, lazyEnd);
+    lexeme_stream*  partialStream   = new pipelined_lexeme_stream(eagerLexer.create_stream_from_symbols(lazyBegin, lazyEnd));
+    lexeme*         directLexeme    = NULL;
+    lexeme*         partialLexeme   = NULL;
+    
+    (*directStream) >> directLexeme;
+    (*partialStream) >> partialLexeme;
+    report("PipelinedPartial",  directLexeme != NULL && partialLexeme != NULL && partialLexeme->matched() == directLexeme->matched() && partialLexeme->length() == directLexeme->length());
+    
+    delete directLexeme;
+    delete partialLexeme;
+    delete directStream;
+    delete partialStream;
+    
+    // ... or before anything has been read
+    delete new pipelined_lexeme_stream(eagerLexer.create_stream_from_symbols(lazyBegin, lazyEnd));
+    
+    // Pushing the symbols in blocks should produce the same lexemes, even when the blocks split lexemes in two
+    bool pushSame = true;
+    size_t blockSizes[] = { 1, 3, 7, 1000 };
+    for (int sizeNum = 0; sizeNum < 4; ++sizeNum) {
+        int pushCount = 0;
+        if (!same_lexemes(eagerLexer.create_stream_from_symbols(lazyBegin, lazyEnd), new pushed_lexeme_stream(eagerLexer, lazyBegin, lazyEnd, blockSizes[sizeNum]), pushCount) || pushCount != lazyCount) {
+            pushSame = false;
+        }
+    }
+    report("PushSame",          pushSame && lazyCount > 20000);
+    
+    // A lexeme that reaches the end of the symbols pushed so far isn't returned until it is known to be complete
+    push_lexer          waitingLexer(eagerLexer);
+    lexeme*             waitingLexeme   = NULL;
+    vector<int>         whileSymbols    = to_symbols("whil");
+    vector<int>         endSymbols      = to_symbols("st2 ");
+    
+    waitingLexer.push(&whileSymbols[0], &whileSymbols[0] + whileSymbols.size());
+    bool waited = !waitingLexer.next(waitingLexeme) && waitingLexeme == NULL;
+    
+    waitingLexer.push(&endSymbols[0], &endSymbols[0] + endSymbols.size());
+    bool completed = waitingLexer.next(waitingLexeme) && waitingLexeme != NULL && waitingLexeme->matched() == 2 && waitingLexeme->length() == 7;
+    report("PushWaits",         waitingLexer.valid() && waited && completed);
+    delete waitingLexeme;
+    
+    // feed() passes lexemes on until it needs more input, and the end of the input once it has been reached
+    lexeme_collector collector;
+    int fedCount = waitingLexer.feed(collector);
+    
+    waitingLexer.end_of_input();
+    fedCount += waitingLexer.feed(collector);
+    report("PushFeed",          fedCount == 1 && collector.count == 1 && collector.ended);
+    
+    // Streams that don't supply a stable buffer are read in blocks
+    istringstream   eagerInput(longId + " " + longId + "99 while");
+    istringstream   lazyInput(longId + " " + longId + "99 while");
+    bool            lazyBlocks = same_lexemes(eagerLexer.create_stream_from<char>(eagerInput), tinyLexer.create_stream_from<char>(lazyInput), lazyCount);
+    report("LazyBlocks",        lazyBlocks && lazyCount == 5);
+    
+    // Lazy streams can be restarted from a checkpoint
+    lexeme_stream*      lazyStream = lazyLexer.create_stream_from_symbols(lazyBegin, lazyEnd);
+    lexer_checkpoint    lazyCheckpoint;
+    
+    for (int skipped = 0; skipped < 30; ++skipped) {
+        lexeme* skip = NULL;
+        (*lazyStream) >> skip;
+        delete skip;
+    }
+    
+    bool lazyHasCheckpoint  = lazyStream->checkpoint(lazyCheckpoint);
+    bool lazyRestarted      = same_lexemes(lazyStream, lazyLexer.create_stream_from_checkpoint(lazyBegin, lazyEnd, lazyCheckpoint), lazyCount);
+    report("LazyCheckpoint",    lazyHasCheckpoint && lazyRestarted && lazyCount > 20000);
+    
+    // A lazy lexer over a full Unicode class only builds the states that the input reaches
+    lexer unicodeLexer;
+    unicodeLexer.add_symbol("[\\u0000-\\uffff]+", 1);
+    unicodeLexer.compile_lazy();
+    
+    vector<int> unicodeBuffer   = to_symbols("unicode");
+    lexeme*     unicodeLexeme   = NULL;
+    
+    lexeme_stream* unicodeStream = unicodeLexer.create_stream_from_symbols(&unicodeBuffer[0], &unicodeBuffer[0] + unicodeBuffer.size());
+    (*unicodeStream) >> unicodeLexeme;
+    delete unicodeStream;
+    
+    report("LazyUnicode",       unicodeLexeme != NULL && unicodeLexeme->matched() == 1 && unicodeLexeme->length() == 7);
+    delete unicodeLexeme;
+    
+    // Keywords looked up in a keyword table should be lexed in the same way as keywords in the DFA
+    const char* keywordText[] = { "if", "while", "whilst" };
+    
+    ndfa_regex                          inlineRegex;
+    ndfa_regex                          identifierRegex;
+    keyword_hash_table::keyword_list    keywordList;
+    
+    for (int keywordNum = 0; keywordNum < 3; ++keywordNum) {
+        inlineRegex.add_literal(0, keywordText[keywordNum], accept_action(keywordNum + 1));
+        
+        keyword_hash_table::keyword newKeyword;
+        newKeyword.baseSymbol       = 4;
+        newKeyword.text             = to_symbols(keywordText[keywordNum]);
+        newKeyword.keywordSymbol    = keywordNum + 1;
+        keywordList.push_back(newKeyword);
+    }
+    
+    ndfa_regex* keywordRegexes[] = { &inlineRegex, &identifierRegex };
+    for (int regexNum = 0; regexNum < 2; ++regexNum) {
+        keywordRegexes[regexNum]->add_regex(0, "[a-z]+", accept_action(4));
+        keywordRegexes[regexNum]->add_regex(0, "[ \n]+", accept_action(5));
+    }
+    
+    ndfa*               inlineUnique        = inlineRegex.to_ndfa_with_unique_symbols();
+    ndfa*               inlineDfa           = inlineUnique->to_dfa();
+    ndfa*               identifierUnique    = identifierRegex.to_ndfa_with_unique_symbols();
+    ndfa*               identifierDfa       = identifierUnique->to_dfa();
+    keyword_hash_table  keywords(keywordList);
+    
+    vector<int> ifText      = to_symbols("if");
+    vector<int> iffText     = to_symbols("iff");
+    report("KeywordClassify",   keywords.classify(4, &ifText[0], &ifText[0] + 2) == 1 && keywords.classify(5, &ifText[0], &ifText[0] + 2) == 5 && keywords.classify(4, &iffText[0], &iffText[0] + 3) == 4);
+    report("KeywordFewerStates", identifierDfa->count_states() < inlineDfa->count_states());
+    
+    lexer inlineLexer(*inlineDfa);
+    lexer keywordLexer(*identifierDfa, keywords);
+    
+    stringstream keywordStream;
+    for (int lineNum = 0; lineNum < 500; ++lineNum) {
+        keywordStream << "if iff i while whilst whilstx whi w\n";
+    }
+    
+    vector<int> keywordBuffer   = to_symbols(keywordStream.str());
+    const int*  keywordBegin    = &keywordBuffer[0];
+    const int*  keywordEnd      = &keywordBuffer[0] + keywordBuffer.size();
+    int         keywordCount    = 0;
+    
+    bool keywordSame = same_lexemes(inlineLexer.create_stream_from_symbols(keywordBegin, keywordEnd), keywordLexer.create_stream_from_symbols(keywordBegin, keywordEnd), keywordCount);
+    report("KeywordSame",       keywordSame && keywordCount == 8000);
+    
+    istringstream   inlineInput(keywordStream.str());
+    istringstream   keywordInput(keywordStream.str());
+    bool            keywordBlocks = same_lexemes(inlineLexer.create_stream_from<char>(inlineInput), keywordLexer.create_stream_from<char>(keywordInput), keywordCount);
+    report("KeywordBlocks",     keywordBlocks && keywordCount == 8000);
+    
+    vector<token>   keywordTokens;
+    token_cursor    keywordCursor(keywordBegin, keywordEnd);
+    keywordTokens.resize(4);
+    keywordLexer.tokenize(keywordCursor, &keywordTokens[0], 4);
+    report("KeywordTokenize",   keywordTokens[0].symbol == 1 && keywordTokens[2].symbol == 4 && keywordTokens[2].length == 3);
+    
+    // Larger tables should still put every keyword in its own slot
+    keyword_hash_table::keyword_list manyKeywords;
+    for (int keywordNum = 0; keywordNum < 500; ++keywordNum) {
+        stringstream keywordName;
+        keywordName << "kw" << keywordNum;
+        
+        keyword_hash_table::keyword newKeyword;
+        newKeyword.baseSymbol       = keywordNum % 2;
+        newKeyword.text             = to_symbols(keywordName.str());
+        newKeyword.keywordSymbol    = keywordNum + 10;
+        manyKeywords.push_back(newKeyword);
+    }
+    
+    keyword_hash_table  manyTable(manyKeywords);
+    keyword_hash_table  manyCopy(*(const keyword_table*)&manyTable);
+    bool                manyFound = manyTable.count_keywords() == 500;
+    
+    for (keyword_hash_table::keyword_list::const_iterator kw = manyKeywords.begin(); kw != manyKeywords.end(); ++kw) {
+        const int* begin    = &kw->text[0];
+        const int* end      = begin + kw->text.size();
+        
+        if (manyCopy.classify(kw->baseSymbol, begin, end) != kw->keywordSymbol) manyFound = false;
+        if (manyCopy.classify(1 - kw->baseSymbol, begin, end) != 1 - kw->baseSymbol) manyFound = false;
+    }
+    report("KeywordMany",       manyFound);
+    
+    // Case insensitive keywords should match lexemes in any case, without affecting the case sensitive ones
+    ndfa_regex                          foldInline;
+    ndfa_regex                          foldIdentifier;
+    keyword_hash_table::keyword_list    foldList;
+    
+    for (int keywordNum = 0; keywordNum < 3; ++keywordNum) {
+        foldInline.set_case_insensitive(keywordNum != 2);
+        foldInline.add_literal(0, keywordText[keywordNum], accept_action(keywordNum + 1));
+        
+        keyword_hash_table::keyword newKeyword;
+        newKeyword.baseSymbol       = 4;
+        newKeyword.text             = to_symbols(keywordNum == 0 ? "IF" : keywordText[keywordNum]);
+        newKeyword.keywordSymbol    = keywordNum + 1;
+        newKeyword.foldCase         = keywordNum != 2;
+        foldList.push_back(newKeyword);
+    }
+    
+    foldInline.set_case_insensitive(false);
+    ndfa_regex* foldRegexes[] = { &foldInline, &foldIdentifier };
+    for (int regexNum = 0; regexNum < 2; ++regexNum) {
+        foldRegexes[regexNum]->add_regex(0, "[a-zA-Z]+", accept_action(4));
+        foldRegexes[regexNum]->add_regex(0, "[ \n]+", accept_action(5));
+    }
+    
+    keyword_hash_table  foldKeywords(foldList);
+    keyword_hash_table  foldCopy(*(const keyword_table*)&foldKeywords);
+    vector<int>         upperIf     = to_symbols("IF");
+    vector<int>         mixedWhile  = to_symbols("wHiLe");
+    vector<int>         upperWhilst = to_symbols("WHILST");
+    vector<int>         lowerWhilst = to_symbols("whilst");
+    
+    report("KeywordFoldCase",   foldKeywords.fold_case() && foldKeywords.classify(4, &ifText[0], &ifText[0] + 2) == 1 && foldKeywords.classify(4, &upperIf[0], &upperIf[0] + 2) == 1 && foldKeywords.classify(4, &mixedWhile[0], &mixedWhile[0] + 5) == 2);
+    report("KeywordFoldCaseSensitive", foldKeywords.classify(4, &lowerWhilst[0], &lowerWhilst[0] + 6) == 3 && foldKeywords.classify(4, &upperWhilst[0], &upperWhilst[0] + 6) == 4);
+    report("KeywordFoldCaseCopy", foldCopy.fold_case() && foldCopy.classify(4, &upperIf[0], &upperIf[0] + 2) == 1 && foldCopy.classify(4, &upperWhilst[0], &upperWhilst[0] + 6) == 4);
+    
+    ndfa*               foldInlineUnique        = foldInline.to_ndfa_with_unique_symbols();
+    ndfa*               foldInlineDfa           = foldInlineUnique->to_dfa();
+    ndfa*               foldIdentifierUnique    = foldIdentifier.to_ndfa_with_unique_symbols();
+    ndfa*               foldIdentifierDfa       = foldIdentifierUnique->to_dfa();
+    
+    report("KeywordFoldCaseFewerStates", foldIdentifierDfa->count_states() < foldInlineDfa->count_states());
+    report("KeywordIgnoresCase", foldIdentifier.ignores_case(0, &upperWhilst[0], &upperWhilst[0] + 6) && !foldInline.ignores_case(0, &lowerWhilst[0], &lowerWhilst[0] + 6));
+    
+    lexer foldInlineLexer(*foldInlineDfa);
+    lexer foldKeywordLexer(*foldIdentifierDfa, foldKeywords);
+    
+    stringstream foldStream;
+    for (int lineNum = 0; lineNum < 500; ++lineNum) {
+        foldStream << "if IF iF iff While WHILE whilst WHILST Whilstx whi W\n";
+    }
+    
+    vector<int> foldBuffer  = to_symbols(foldStream.str());
+    int         foldCount   = 0;
+    
+    bool foldSame = same_lexemes(foldInlineLexer.create_stream_from_symbols(&foldBuffer[0], &foldBuffer[0] + foldBuffer.size()), foldKeywordLexer.create_stream_from_symbols(&foldBuffer[0], &foldBuffer[0] + foldBuffer.size()), foldCount);
+    report("KeywordFoldCaseSame", foldSame && foldCount == 11000);
+    
+    delete foldInlineUnique;
+    delete foldInlineDfa;
+    delete foldIdentifierUnique;
+    delete foldIdentifierDfa;
+    
+    // Small DFAs should prefer flat tables, and the smallest style should really be the smallest
+    lexer_table_sizes inlineSizes(*inlineDfa);
+    size_t smallestSize = inlineSizes.table_size(inlineSizes.smallest());
+    
+    report("TableSizesCounts",  inlineSizes.numStates == inlineDfa->count_states() && inlineSizes.numSymbolSets == inlineDfa->symbols().count_sets() && inlineSizes.numTransitions > 0);
+    report("TableSizesFlat",    inlineSizes.flatTable == sizeof(unsigned char) * inlineSizes.numStates * inlineSizes.numSymbolSets && inlineSizes.preferred() == lexer_table_sizes::flat);
+    report("TableSizesSmallest", smallestSize <= inlineSizes.combTable && smallestSize <= inlineSizes.compactTable && smallestSize <= inlineSizes.flatTable);
+    report("TableSizesCache",   inlineSizes.cache_lines(lexer_table_sizes::flat) * lexer_table_sizes::c_CacheLineSize >= inlineSizes.flatTable + inlineSizes.symbolMap);
+    
+    // Scanning a span should give the same result as running the state machine one symbol at a time
+    vector<int> spanAccept;
+    for (int stateNum = 0; stateNum < inlineDfa->count_states(); ++stateNum) {
+        spanAccept.push_back(inlineDfa->actions_for_state(stateNum).empty() ? -1 : (*inlineDfa->actions_for_state(stateNum).begin())->symbol());
+    }
+    
+    state_machine<wchar_t>                      spanFlat(*inlineDfa);
+    packed_state_machine<wchar_t, unsigned char> spanPacked(*inlineDfa);
+    comb_state_machine<wchar_t>                 spanComb(*inlineDfa);
+    bool                                        spanSame = true;
+    
+    for (const int* spanStart = keywordBegin; spanStart < keywordBegin + 200; ++spanStart) {
+        // Run the state machine by hand
+        int         expectedState   = 0;
+        int         expectedSymbol  = -1;
+        const int*  expectedAccept  = NULL;
+        const int*  expectedPos     = spanStart;
+        
+        while (expectedPos != keywordEnd) {
+            expectedState = spanFlat.run_unsafe(expectedState, *expectedPos);
+            ++expectedPos;
+            if (expectedState < 0) break;
+            if (spanAccept[expectedState] >= 0) {
+                expectedSymbol = spanAccept[expectedState];
+                expectedAccept = expectedPos;
+            }
+        }
+        
+        // Compare against each of the state machines
+        int         symbols[3]  = { -1, -1, -1 };
+        const int*  accepts[3]  = { NULL, NULL, NULL };
+        const int*  positions[3]= { spanStart, spanStart, spanStart };
+        int         states[3];
+        
+        states[0] = spanFlat.run_span(0, positions[0], keywordEnd, &spanAccept[0], symbols[0], accepts[0]);
+        states[1] = spanPacked.run_span(0, positions[1], keywordEnd, &spanAccept[0], symbols[1], accepts[1]);
+        states[2] = spanComb.run_span(0, positions[2], keywordEnd, &spanAccept[0], symbols[2], accepts[2]);
+        
+        for (int machine = 0; machine < 3; ++machine) {
+            if (states[machine] != expectedState || symbols[machine] != expectedSymbol || accepts[machine] != expectedAccept || positions[machine] != expectedPos) {
+                spanSame = false;
+            }
+        }
+    }
+    report("RunSpan",           spanSame);
+    
+    // State vectors should track every start state at once, both for small DFAs (which fit in a shuffle) and larger ones
+    ndfa_regex manyRegex;
+    manyRegex.add_regex(0, "[a-z]+", accept_action(1));
+    manyRegex.add_regex(0, "[ \n]+", accept_action(2));
+    for (int keywordNum = 0; keywordNum < 20; ++keywordNum) {
+        stringstream manyKeyword;
+        manyKeyword << "keyword" << (char) ('a' + keywordNum);
+        manyRegex.add_literal(0, manyKeyword.str(), accept_action(3 + keywordNum));
+    }
+    
+    ndfa* manyUnique    = manyRegex.to_ndfa_with_unique_symbols();
+    ndfa* manyDfa       = manyUnique->to_dfa();
+    
+    report("StateVectorSizes",  state_vector_machine<wchar_t>(*identifierDfa).uses_shuffle() && !state_vector_machine<wchar_t>(*manyDfa).uses_shuffle() && state_vector_machine<wchar_t>::fits(*manyDfa));
+    report("StateVectorSmall",  same_state_vectors(*identifierDfa, keywordBegin, keywordEnd) && same_state_vectors(*inlineDfa, keywordBegin, keywordEnd));
+    report("StateVectorLarge",  same_state_vectors(*manyDfa, keywordBegin, keywordEnd));
+    report("StateVectorCompose", same_composed_vectors(*identifierDfa, keywordBegin, keywordBegin + 17, keywordBegin + 60) && same_composed_vectors(*manyDfa, keywordBegin, keywordBegin + 23, keywordBegin + 70));
+    
+    delete manyUnique;
+    delete manyDfa;
+    // Searching should find the leftmost-longest matches anywhere in a buffer
+    ndfa_regex searchRegex;
+    searchRegex.add_regex(0, "error[0-9]+", accept_action(1));
+    searchRegex.add_regex(0, "warn(ing)?", accept_action(2));
+    searchRegex.add_literal(0, "fail", accept_action(3));
+    
+    ndfa_regex prefixRegex;
+    prefixRegex.add_regex(0, "error[0-9]+", accept_action(1));
+    
+    ndfa* searchUnique  = searchRegex.to_ndfa_with_unique_symbols();
+    ndfa* searchDfa     = searchUnique->to_dfa();
+    ndfa* prefixUnique  = prefixRegex.to_ndfa_with_unique_symbols();
+    ndfa* prefixDfa     = prefixUnique->to_dfa();
+    
+    dfa_searcher<wchar_t>   searcher(*searchDfa);
+    dfa_searcher<wchar_t>   prefixSearcher(*prefixDfa);
+    vector<int>             searchText = to_symbols("ok error42 fine errorx warning fail warn error7");
+    vector<search_match>    searchMatches;
+    
+    searcher.find_all(&searchText[0], &searchText[0] + searchText.size(), searchMatches);
+    
+    const int   expectedSymbols[]   = { 1, 2, 3, 2, 1 };
+    const int   expectedOffsets[]   = { 3, 23, 31, 36, 41 };
+    const int   expectedLengths[]   = { 7, 7, 4, 4, 6 };
+    bool        searchFound         = searchMatches.size() == 5;
+    
+    for (size_t matchNum = 0; searchFound && matchNum < searchMatches.size(); ++matchNum) {
+        const search_match& match = searchMatches[matchNum];
+        if (match.symbol != expectedSymbols[matchNum] || match.begin - &searchText[0] != expectedOffsets[matchNum] || match.end - match.begin != expectedLengths[matchNum]) {
+            searchFound = false;
+        }
+    }
+    report("SearchFindAll",     searchFound);
+    
+    search_match noMatch;
+    report("SearchNoMatch",     !searcher.find(&searchText[0], &searchText[0] + 3, noMatch) && !prefixSearcher.find(&searchText[0] + 11, &searchText[0] + 22, noMatch));
+    
+    // The prefilter should find the literal prefix and the few start symbols, and mustn't change the results
+    vector<int> errorPrefix = to_symbols("error");
+    report("SearchPrefilter",   prefixSearcher.prefilter().prefix() == errorPrefix && searcher.prefilter().prefix().empty() && searcher.prefilter().uses_skip());
+    
+    dfa_searcher<wchar_t>   unfilteredSearcher(*searchDfa, false);
+    vector<int>             longText;
+    vector<search_match>    filteredMatches;
+    vector<search_match>    unfilteredMatches;
+    
+    for (int lineNum = 0; lineNum < 200; ++lineNum) {
+        stringstream line;
+        line << "line " << lineNum << (lineNum % 7 == 0 ? " error" : " ok") << lineNum << (lineNum % 5 == 0 ? " warnin" : " fine") << (lineNum % 3 == 0 ? " fai" : " fail") << "\n";
+        
+        vector<int> lineSymbols = to_symbols(line.str());
+        longText.insert(longText.end(), lineSymbols.begin(), lineSymbols.end());
+    }
+    
+    searcher.find_all(&longText[0], &longText[0] + longText.size(), filteredMatches);
+    unfilteredSearcher.find_all(&longText[0], &longText[0] + longText.size(), unfilteredMatches);
+    
+    bool searchSame = filteredMatches.size() == unfilteredMatches.size() && filteredMatches.size() > 150;
+    for (size_t matchNum = 0; searchSame && matchNum < filteredMatches.size(); ++matchNum) {
+        if (filteredMatches[matchNum].symbol != unfilteredMatches[matchNum].symbol || filteredMatches[matchNum].begin != unfilteredMatches[matchNum].begin || filteredMatches[matchNum].end != unfilteredMatches[matchNum].end) {
+            searchSame = false;
+        }
+    }
+    report("SearchSame",        searchSame);
+    
+    delete searchUnique;
+    delete searchDfa;
+    delete prefixUnique;
+    delete prefixDfa;
+    
+    delete inlineUnique;
+    delete inlineDfa;
+    delete identifierUnique;
+    delete identifierDfa;
+}
@@ -28,10 +28,33 @@
 #include "dfa_ndfa.h"
 
 #include "TameParse/Dfa/ndfa.h"
+#include "TameParse/Dfa/frozen_ndfa.h"
 #include "TameParse/Dfa/ndfa_regex.h"
 
 using namespace dfa;
 
+// Runs a DFA against a string of symbols from an initial state, and returns true if it ends up in an accepting state
+static bool accepts(const ndfa& dfa, const int* symbols, int count, int initialState = 0) {
+    int currentState = initialState;
+    
+    for (int pos = 0; pos < count; ++pos) {
+        const state&    thisState   = dfa.get_state(currentState);
+        int             nextState   = -1;
+        
+        for (state::iterator transit = thisState.begin(); transit != thisState.end(); ++transit) {
+            if (dfa.symbols()[transit->symbol_set()][symbols[pos]]) {
+                nextState = transit->new_state();
+                break;
+            }
+        }
+        
+        if (nextState < 0) return false;
+        currentState = nextState;
+    }
+    
+    return !dfa.actions_for_state(currentState).empty();
+}
+
 void test_dfa_ndfa::run_tests() {
     // NDFA with two transitions on 'a'
     ndfa twoAs;
@@ -127,4 +150,199 @@ void test_dfa_ndfa::run_tests() {
     // Should be 5 states
     numStates = aaOrBbAsDfa->count_states();
     report("regex3", numStates == 5);
+    
+    // Compacting should merge the accepting states that have the same actions
+    ndfa* aOrBCompact = aOrBAsDfa->to_compact_dfa();
+    
+    report("compactdfa1", aOrBCompact->verify_is_dfa());
+    report("compact1", aOrBCompact->count_states() == 2);
+    report("compactaccept1", aOrBCompact->actions_for_state(0).empty() && aOrBCompact->actions_for_state(1).size() == 1);
+    
+    // ... but not states that still need different input to reach an accepting state
+    ndfa* aaOrBbCompact = aaOrBbAsDfa->to_compact_dfa();
+    
+    report("compactdfa2", aaOrBbCompact->verify_is_dfa());
+    report("compact2", aaOrBbCompact->count_states() == 4);
+    
+    // ... or states with different actions
+    ndfa_regex aThenB;
+    aThenB.add_regex(0, "a", 1);
+    aThenB.add_regex(0, "b", 2);
+    
+    ndfa* aThenBAsDfa   = aThenB.to_dfa();
+    ndfa* aThenBCompact = aThenBAsDfa->to_compact_dfa();
+    
+    report("compact3", aThenBCompact->count_states() == 3);
+    
+    // Nested repetitions produce long chains of epsilon transitions that all need to be followed
+    ndfa_regex nestedStars;
+    nestedStars.add_regex(0, "(a*b*)*c", 1);
+    
+    ndfa* nestedStarsAsDfa = nestedStars.to_dfa();
+    
+    report("verifydfa6", nestedStarsAsDfa->verify_is_dfa());
+    report("closure1", nestedStarsAsDfa->count_states() == 3);
+    report("closureaccept1", nestedStarsAsDfa->actions_for_state(0).empty() && nestedStarsAsDfa->actions_for_state(1).empty() && nestedStarsAsDfa->actions_for_state(2).size() == 1);
+    
+    delete nestedStarsAsDfa;
+    
+    // Characters outside the BMP should be matched as surrogate pairs
+    symbol_string               nonBmp;
+    ndfa_regex                  surrogates;
+    
+    nonBmp += '[';
+    nonBmp += 0x10400;
+    nonBmp += '-';
+    nonBmp += 0x10c00;
+    nonBmp += ']';
+    
+    surrogates.set_use_surrogates(true);
+    surrogates.add_regex(0, nonBmp, 1);
+    
+    ndfa* surrogatesAsDfa = surrogates.to_dfa();
+    
+    const int firstPair[]   = { 0xd801, 0xdc00 };
+    const int middlePair[]  = { 0xd802, 0xdd23 };
+    const int lastPair[]    = { 0xd803, 0xdc00 };
+    const int afterPair[]   = { 0xd803, 0xdc01 };
+    const int beforePair[]  = { 0xd800, 0xdfff };
+    
+    report("surrogate1", accepts(*surrogatesAsDfa, firstPair, 2));
+    report("surrogate2", accepts(*surrogatesAsDfa, middlePair, 2));
+    report("surrogate3", accepts(*surrogatesAsDfa, lastPair, 2));
+    report("surrogate4", !accepts(*surrogatesAsDfa, afterPair, 2));
+    report("surrogate5", !accepts(*surrogatesAsDfa, beforePair, 2));
+    report("surrogate6", !accepts(*surrogatesAsDfa, firstPair, 1));
+    
+    delete surrogatesAsDfa;
+    
+    // Initial states can be determinized on separate threads
+    ndfa_regex                  modes;
+    std::vector<int>            modeStates;
+    
+    modeStates.push_back(0);
+    modeStates.push_back(modes.add_state());
+    
+    modes.add_regex(modeStates[0], "a+", accept_action(1));
+    modes.add_regex(modeStates[0], "c", accept_action(3));
+    modes.add_regex(modeStates[1], "b+", accept_action(2));
+    modes.add_regex(modeStates[1], "c", accept_action(3));
+    
+    ndfa* modesUnique   = modes.to_ndfa_with_unique_symbols();
+    ndfa* modesDfa      = modesUnique->to_dfa(modeStates);
+    ndfa* modesParallel = modesUnique->to_dfa(modeStates, 2);
+    
+    const int aRun[]  = { 'a', 'a' };
+    const int bRun[]  = { 'b', 'b' };
+    const int oneC[]  = { 'c' };
+    
+    report("parallel-dfa1", modesParallel->is_dfa() && modesParallel->verify_is_dfa());
+    report("parallel-dfa2", accepts(*modesParallel, aRun, 2, 0) && !accepts(*modesParallel, bRun, 2, 0) && accepts(*modesParallel, oneC, 1, 0));
+    report("parallel-dfa3", accepts(*modesParallel, bRun, 2, 1) && !accepts(*modesParallel, aRun, 2, 1) && accepts(*modesParallel, oneC, 1, 1));
+    report("parallel-dfa4", modesParallel->count_states() >= modesDfa->count_states());
+    
+    ndfa* modesCompact          = modesDfa->to_compact_dfa(modeStates);
+    ndfa* modesParallelCompact  = modesParallel->to_compact_dfa(modeStates);
+    
+    report("parallel-dfa5", modesCompact->count_states() == modesParallelCompact->count_states());
+    
+    // States that only have an epsilon transition to another state can be removed without changing the language
+    ndfa_regex alternatives;
+    alternatives.add_regex(0, "(ab|cd)*e+", accept_action(1));
+    alternatives.add_regex(0, "(a|c)d", accept_action(2));
+    
+    ndfa* altUnique         = alternatives.to_ndfa_with_unique_symbols();
+    ndfa* altReduced        = altUnique->to_ndfa_without_epsilon_states();
+    ndfa* altDfa            = altUnique->to_dfa();
+    ndfa* altReducedDfa     = altReduced->to_dfa();
+    ndfa* altCompact        = altDfa->to_compact_dfa();
+    ndfa* altReducedCompact = altReducedDfa->to_compact_dfa();
+    
+    int  altEpsilon     = altReduced->symbols().identifier_for_symbols(epsilon());
+    bool noEpsilonStates = true;
+    for (int stateId = 1; stateId < altReduced->count_states(); ++stateId) {
+        const state& thisState = altReduced->get_state(stateId);
+        if (thisState.count_transitions() == 1 && thisState.begin()->symbol_set() == altEpsilon && altReduced->actions_for_state(stateId).empty()) {
+            noEpsilonStates = false;
+        }
+    }
+    
+    const int abe[]     = { 'a', 'b', 'e' };
+    const int cdabee[]  = { 'c', 'd', 'a', 'b', 'e', 'e' };
+    const int cd[]      = { 'c', 'd' };
+    const int ab[]      = { 'a', 'b' };
+    
+    report("epsilon-states1", altReduced->count_states() < altUnique->count_states() && noEpsilonStates);
+    report("epsilon-states2", altReducedDfa->verify_is_dfa() && altReducedDfa->count_states() <= altDfa->count_states() && altReducedCompact->count_states() == altCompact->count_states());
+    report("epsilon-states3", accepts(*altReducedDfa, abe, 3) && accepts(*altReducedDfa, cdabee, 6) && accepts(*altReducedDfa, cd, 2) && !accepts(*altReducedDfa, ab, 2));
+    
+    // The initial states should become states 0, 1, etc
+    ndfa*               modesReduced    = modesUnique->to_ndfa_without_epsilon_states(modeStates);
+    std::vector<int>    reducedStates;
+    reducedStates.push_back(0);
+    reducedStates.push_back(1);
+    ndfa*               modesReducedDfa = modesReduced->to_dfa(reducedStates);
+    
+    report("epsilon-states4", accepts(*modesReducedDfa, aRun, 2, 0) && !accepts(*modesReducedDfa, bRun, 2, 0) && accepts(*modesReducedDfa, bRun, 2, 1) && accepts(*modesReducedDfa, oneC, 1, 1));
+    
+    // Renumbering the states in traversal order keeps the initial states and the language, and puts the first state
+    // reached from the first initial state straight after the initial states
+    ndfa* modesOrdered  = modesCompact->to_ndfa_in_traversal_order(2);
+    ndfa* altOrdered    = altCompact->to_ndfa_in_traversal_order();
+    
+    report("traversal-order1", modesOrdered->count_states() == modesCompact->count_states() && modesOrdered->verify_is_dfa() && altOrdered->verify_is_dfa());
+    report("traversal-order2", accepts(*modesOrdered, aRun, 2, 0) && !accepts(*modesOrdered, bRun, 2, 0) && accepts(*modesOrdered, bRun, 2, 1) && accepts(*modesOrdered, oneC, 1, 1));
+    report("traversal-order3", accepts(*altOrdered, abe, 3) && accepts(*altOrdered, cdabee, 6) && accepts(*altOrdered, cd, 2) && !accepts(*altOrdered, ab, 2));
+    report("traversal-order4", modesOrdered->get_state(0).count_transitions() > 0 && modesOrdered->get_state(0).begin()->new_state() == 2);
+    
+    // A frozen NDFA should have the same transitions and actions as the NDFA it was made from, with epsilon kept separately
+    frozen_ndfa frozen(*altUnique, altEpsilon);
+    bool        sameTransitions = frozen.count_states() == altUnique->count_states();
+    bool        sameActions     = sameTransitions;
+    
+    for (int stateId = 0; sameTransitions && stateId < altUnique->count_states(); ++stateId) {
+        const state&        thisState   = altUnique->get_state(stateId);
+        const transition*   frozenTrans = frozen.begin(stateId);
+        const int*          frozenEps   = frozen.begin_epsilon(stateId);
+        
+        for (state::iterator transit = thisState.begin(); transit != thisState.end(); ++transit) {
+            if (transit->symbol_set() == altEpsilon) {
+                if (frozenEps == frozen.end_epsilon(stateId) || *frozenEps != transit->new_state()) sameTransitions = false;
+                else ++frozenEps;
+            } else {
+                if (frozenTrans == frozen.end(stateId) || *frozenTrans != *transit) sameTransitions = false;
+                else ++frozenTrans;
+            }
+        }
+        
+        if (frozenTrans != frozen.end(stateId) || frozenEps != frozen.end_epsilon(stateId)) sameTransitions = false;
+        
+        const ndfa::accept_action_list& actions = altUnique->actions_for_state(stateId);
+        if (actions.empty() ? frozen.actions(stateId) != NULL : frozen.actions(stateId) != &actions) sameActions = false;
+    }
+    
+    report("frozen-ndfa1", sameTransitions);
+    report("frozen-ndfa2", sameActions);
+    
+    delete altUnique;
+    delete altReduced;
+    delete altDfa;
+    delete altReducedDfa;
+    delete altCompact;
+    delete altReducedCompact;
+    delete modesReduced;
+    delete modesReducedDfa;
+    delete modesOrdered;
+    delete altOrdered;
+    
+    delete modesUnique;
+    delete modesDfa;
+    delete modesParallel;
+    delete modesCompact;
+    delete modesParallelCompact;
+    
+    delete aOrBCompact;
+    delete aaOrBbCompact;
+    delete aThenBCompact;
+    delete aThenBAsDfa;
 }
@@ -114,8 +114,31 @@ void test_dfa_single_regex::test(std::string name, std::string regex, std::strin
     delete fail;
 }
 
+/// \brief Lexes some text with a NDFA (which is destroyed), returning the symbol matched or -1 if the whole text wasn't matched
+static int lex_with(ndfa_regex* ndfa, const std::string& text) {
+    lexer myLexer(ndfa);
+    
+    stringstream in(text);
+    lexeme_stream* stream = myLexer.create_stream_from(in);
+    
+    lexeme* first;
+    (*stream) >> first;
+    delete stream;
+    
+    int result = -1;
+    if (first != NULL && first->content<char>() == text) {
+        result = first->matched();
+    }
+    
+    delete first;
+    return result;
+}
+
 void test_dfa_single_regex::run_tests() {
     test("basic", "a", "a", "b");
+    test("unicode1", "{u-letter}+", "aZb", "1");
+    test("unicode2", "{u-letter-uppercase}+", "AZ", "a");
+    test("unicode3", "{u-letter-uppercase}{u-number}", "A1", "1A");
     test("sayaaaa", "a*", "aaaaa", "b");
     test("ababab", "(ab)+", "ababab", "aaaaaa");
     
@@ -192,4 +215,31 @@ void test_dfa_single_regex::run_tests() {
     test("bootstrap-identifier2", "[A-Za-z\\-][A-Za-z\\-0-9]*", "language", "0");
     test("bootstrap-identifier3", "([A-Za-z\\-][A-Za-z\\-0-9]*)|(language)", "language", "0");
     test("bootstrap-identifier4", "([A-Za-z\\-][A-Za-z\\-0-9]*)|(language)", "some-identifier", "0");
+
+    // Named expressions: the second use of {number} is copied from the states generated for the first
+    ndfa_regex* numbers = new ndfa_regex();
+    numbers->define_expression("digit", "[0-9]");
+    numbers->define_expression("number", "{digit}+");
+    
+    int beforeFirst = numbers->count_states();
+    numbers->add_regex(0, "{number}", accept_action(1));
+    int beforeSecond = numbers->count_states();
+    numbers->add_regex(0, "{number}\\.{number}", accept_action(2));
+    int afterSecond = numbers->count_states();
+    numbers->add_regex(0, "{number}", accept_action(1));
+    int afterThird = numbers->count_states();
+    
+    report("expression-states", afterThird - afterSecond == beforeSecond - beforeFirst);
+    report("expression-lex1", lex_with(numbers, "12.345") == 2);
+    
+    // The same expression should be compiled again if the builder options change
+    ndfa_regex* keywords = new ndfa_regex();
+    keywords->define_expression("keyword", "ab");
+    keywords->add_regex(0, "x{keyword}", accept_action(1));
+    keywords->set_case_insensitive(true);
+    keywords->add_regex(0, "y{keyword}", accept_action(2));
+    
+    report("expression-case", lex_with(new ndfa_regex(*keywords), "yAB") == 2);
+    report("expression-nocase", lex_with(new ndfa_regex(*keywords), "xAB") == -1);
+    report("expression-lex2", lex_with(keywords, "xab") == 1);
 }
@@ -201,6 +201,22 @@ void test_dfa_symbol_deduplicate::run_tests() {
     report("NoDuplicates5", !no_duplicates->has_duplicates());
     report("AllRemapped5", check_ranges(has_duplicates5, *no_duplicates));
 
+    delete no_duplicates;
+    
+    // Lots of overlapping ranges: every boundary produces a new set
+    symbol_map has_duplicates6;
+    
+    for (int start = 0; start < 200; ++start) {
+        has_duplicates6.identifier_for_symbols(range<int>(start, start + 50));
+    }
+    
+    no_duplicates = remapped_symbol_map::deduplicate(has_duplicates6);
+    
+    report("NoDuplicates6", !no_duplicates->has_duplicates());
+    report("AllRemapped6", check_ranges(has_duplicates6, *no_duplicates));
+    report("Count6", no_duplicates->count_sets() == 249);
+    report("FirstSet6.Size", no_duplicates->new_symbols(has_duplicates6.find_identifier_for_symbols(range<int>(0, 50))).size() == 50);
+
     // Finished with the set
     delete no_duplicates;
 }
@@ -117,6 +117,13 @@ void test_dfa_symbol_set::run_tests() {
     report("Invert4", (threeGroups & ~threeGroups) == empty);
     report("Invert5", (threeGroups | ~threeGroups) == ~empty);
 
+    report("Touching1", (symbol_set(r(10, 20)) | r(20, 30)) == symbol_set(r(10, 30)));
+    report("Touching2", (threeGroups | (symbol_set(r(20, 30)) | r(40, 50))) == symbol_set(r(10, 60)));
+    report("EmptyRange1", symbol_set(r(5, 5)).empty());
+    report("Intersect1", (threeGroups & (symbol_set(r(15, 35)) | r(55, 70))) == (symbol_set(r(15, 20)) | r(30, 35) | r(55, 60)));
+    report("Exclude1", threeGroups.excluding(symbol_set(r(15, 35)) | r(55, 70)) == (symbol_set(r(10, 15)) | r(35, 40) | r(50, 55)));
+    report("Exclude2", threeGroups.excluding(r(35, 36)) == (symbol_set(r(10, 20)) | r(30, 35) | r(36, 40) | r(50, 60)));
+
     symbol_set a_to_z(r('a', 'z'));
     symbol_set A_to_Z(r('A', 'Z'));
     symbol_set m_to_o(r('m', 'o'));
@@ -134,4 +141,59 @@ void test_dfa_symbol_set::run_tests() {
     report("ToLower2", uc.to_lower(a_to_z) == a_to_z);
     report("ToLower3", uc.to_lower(A_to_Z_to_0) == a_to_z_to_0);
     report("ToLower4", uc.to_lower(M_to_O) == m_to_o);
+    
+    // Adding sorted ranges should give the same result as merging them
+    symbol_set sortedGroups;
+    sortedGroups.add_sorted(r(10, 20));
+    sortedGroups.add_sorted(r(15, 40));
+    sortedGroups.add_sorted(r(40, 45));
+    sortedGroups.add_sorted(r(50, 60));
+    sortedGroups.add_sorted(r(5, 8));
+    report("AddSorted", sortedGroups == (symbol_set(r(5, 8)) | r(10, 45) | r(50, 60)));
+    
+    // The main unicode categories contain every character type in the category
+    const unicode::block*   letters     = uc.find_category("L");
+    const unicode::block*   uppercase   = uc.find_category("Lu");
+    symbol_set              letterSet   = letters ? unicode::symbols(*letters) : symbol_set();
+    symbol_set              upperSet    = uppercase ? unicode::symbols(*uppercase) : symbol_set();
+    
+    report("UnicodeCategory",   letterSet['a'] && letterSet['A'] && letterSet[0x3b1] && !letterSet['1']);
+    report("UnicodeType",       upperSet['A'] && !upperSet['a']);
+    report("UnicodeContains",   (letterSet & upperSet) == upperSet);
+    report("UnicodeUnknown",    uc.find_category("Xx") == NULL && uc.find_category("X") == NULL);
+    
+    // The lookup tables should give the same categories as the range lists
+    report("CategoryOf",        unicode::category_of('A') == unicode::cat_Lu && unicode::category_of('a') == unicode::cat_Ll && unicode::category_of(' ') == unicode::cat_Zs && unicode::category_of(0x4e01) == unicode::cat_Lo);
+    report("CategoryOutOfRange", unicode::category_of(-1) == unicode::cat_Cn && unicode::category_of(unicode::c_MaxCodePoint) == unicode::cat_Cn);
+    
+    bool sameCategories = true;
+    for (unicode::iterator block = uc.begin(); block != uc.end(); ++block) {
+        for (int rangeNum = 0; rangeNum < block->count; ++rangeNum) {
+            const unicode::range& range = block->ranges[rangeNum];
+            
+            if (std::string(unicode::category_name(unicode::category_of(range.lower))) != block->type)   sameCategories = false;
+            if (std::string(unicode::category_name(unicode::category_of(range.upper-1))) != block->type) sameCategories = false;
+        }
+    }
+    report("CategoryMatchesRanges", sameCategories);
+    
+    report("UpperCase",         unicode::upper_case('a') == 'A' && unicode::upper_case('A') == 'A' && unicode::upper_case('1') == '1');
+    report("LowerCase",         unicode::lower_case(0x391) == 0x3b1 && unicode::lower_case(0x3b1) == 0x3b1);
+    report("FoldCase",          unicode::fold_case(0x17f) == 's' && unicode::fold_case('S') == 's');
+    
+    bool sameUpper = true;
+    for (int codePoint = 0; codePoint < 0x800; ++codePoint) {
+        if (uc.to_upper(symbol_set(r(codePoint, codePoint+1))) != symbol_set(r(unicode::upper_case(codePoint), unicode::upper_case(codePoint)+1))) {
+            sameUpper = false;
+        }
+    }
+    report("UpperCaseMatchesMap", sameUpper);
+    
+    int             asciiText[]     = { 'a', 'b', ' ', '1' };
+    int             mixedText[]     = { 'a', 0x3b1, '1' };
+    unsigned char   mixedCats[3];
+    unicode::categories(mixedText, mixedText + 3, mixedCats);
+    
+    report("IsAscii",           unicode::is_ascii(asciiText, asciiText + 4) && !unicode::is_ascii(mixedText, mixedText + 3));
+    report("Categories",        mixedCats[0] == unicode::cat_Ll && mixedCats[1] == unicode::cat_Ll && mixedCats[2] == unicode::cat_Nd);
 }
@@ -29,6 +29,7 @@
 
 #include "dfa_symbol_translator.h"
 #include "TameParse/Dfa/symbol_translator.h"
+#include "TameParse/Dfa/hard_coded_symbol_table.h"
 
 using namespace dfa;
 
@@ -93,4 +94,50 @@ void test_dfa_symbol_translator::run_tests() {
     report("size4", trans4.size() < 2048);
     report("contains4-1", trans4.set_for_symbol(0) == allSymbols);
     report("contains4-2", trans4.set_for_symbol(255) == allSymbols);
+    
+    // Ranges which cross the boundary of the fast lookup table
+    symbol_table<wchar_t> table5;
+    table5.add_range(range<int>(0x41, 0x5b), 1);
+    table5.add_range(range<int>(0xf0, 0x110), 2);
+    
+    report("contains5-1", table5.lookup(0x41) == 1);
+    report("contains5-2", table5.lookup(0x5b) == symbol_set::null);
+    report("contains5-3", table5.lookup(0xff) == 2);
+    report("contains5-4", table5.lookup(0x100) == 2);
+    report("contains5-5", table5.lookup(0x10f) == 2);
+    report("contains5-6", table5.lookup(0x110) == symbol_set::null);
+    
+    // The hard-coded version of the table should produce the same results
+    int fast5[256];
+    for (int chr=0; chr<256; ++chr) fast5[chr] = table5.lookup((wchar_t) chr);
+    
+    size_t  hardCodedSize;
+    int*    hardCoded5 = table5.table.to_hard_coded_table(hardCodedSize);
+    
+    hard_coded_fast_symbol_table<wchar_t, 2> fastTable5(fast5, hardCoded5);
+    
+    bool hardCodedOk = true;
+    for (int chr=0; chr<0x200; ++chr) {
+        if (fastTable5.lookup((wchar_t) chr) != table5.lookup((wchar_t) chr)) hardCodedOk = false;
+    }
+    report("hardcoded5", hardCodedOk);
+    
+    delete[] hardCoded5;
+    
+    // The table with shared blocks should produce the same results for the whole of the basic multilingual plane
+    table5.add_range(range<int>(0x4e00, 0x9fcc), 3);
+    
+    std::vector<unsigned char>  bmpBlocks5;
+    std::vector<int>            bmpSets5;
+    table5.to_bmp_blocks(bmpBlocks5, bmpSets5);
+    
+    hard_coded_bmp_symbol_table<wchar_t> bmpTable5(&bmpBlocks5[0], &bmpSets5[0], 4);
+    
+    bool bmpOk = bmpBlocks5.size() == 256 && bmpBlocks5[0] == 0;
+    for (int chr=0; chr<0x10000; ++chr) {
+        if (bmpTable5.lookup((wchar_t) chr) != table5.lookup((wchar_t) chr)) bmpOk = false;
+    }
+    report("bmp5", bmpOk);
+    report("bmp5-shared", bmpSets5.size() == 256 * 5);
+    report("bmp5-outside", sizeof(wchar_t) < 4 || bmpTable5.lookup((wchar_t) 0x10000) == 4);
 }
@@ -25,15 +25,28 @@
 //  IN THE SOFTWARE.
 //
 
+#include <algorithm>
+#include <set>
 #include <string>
 #include <sstream>
 #include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <utility>
 
 #include "language_bootstrap.h"
 #include "TameParse/Util/utf8reader.h"
 #include "TameParse/Language/bootstrap.h"
 #include "TameParse/Language/formatter.h"
+#include "TameParse/Lr/compiled_language.h"
 #include "TameParse/Lr/conflict.h"
+#include "TameParse/Lr/event_parser.h"
+#include "TameParse/Lr/incremental_parser.h"
+#include "TameParse/Lr/ast_parser.h"
+#include "TameParse/Lr/green_parser.h"
+#include "TameParse/Lr/syntax_tape.h"
+#include "TameParse/Util/parse_cache.h"
+#include "TameParse/Util/memory_resource.h"
 
 using namespace std;
 using namespace util;
@@ -72,6 +85,147 @@ static bool test_lex(string phrase, const lexer& lex, int expectedSymbol, const
     return result;
 }
 
+/// \brief Parser events that count the symbols that are shifted and reduced
+class counting_events : public parser_events {
+public:
+    int shifts;
+    int reduces;
+    
+    counting_events() : shifts(0), reduces(0) { }
+    
+    virtual void shift(const lexeme_container& lexeme) {
+        ++shifts;
+    }
+    
+    virtual value reduce(int nonterminal, int rule, const value_list& values) {
+        ++reduces;
+        return parser_events::reduce(nonterminal, rule, values);
+    }
+};
+
+/// \brief Counts the terminal and nonterminal nodes in an AST
+static void count_nodes(const astnode* node, int& terminals, int& nonterminals) {
+    if (node->lexeme().item()) {
+        ++terminals;
+    } else {
+        ++nonterminals;
+    }
+    
+    for (astnode::node_list::const_iterator child = node->children().begin(); child != node->children().end(); ++child) {
+        count_nodes(child->item(), terminals, nonterminals);
+    }
+}
+
+/// \brief Adds the distinct nodes in an AST to a set
+static void distinct_nodes(const astnode* node, set<const astnode*>& nodes) {
+    if (!nodes.insert(node).second) return;
+    
+    for (astnode::node_list::const_iterator child = node->children().begin(); child != node->children().end(); ++child) {
+        distinct_nodes(child->item(), nodes);
+    }
+}
+
+/// \brief True if a finished flat AST has the same nodes as a tree of astnodes, in breadth-first order
+static bool flat_matches_tree(const flat_ast& flat, const astnode* root) {
+    vector<const astnode*> order;
+    order.push_back(root);
+    
+    for (size_t pos = 0; pos < order.size(); ++pos) {
+        const astnode* node = order[pos];
+        int index           = (int) pos;
+        
+        if (index >= flat.size()) return false;
+        
+        if (node->lexeme().item()) {
+            if (!flat.is_terminal(index)) return false;
+            if (flat.symbol(index) != node->lexeme()->matched()) return false;
+            if (flat.offset(index) != node->lexeme()->pos().offset()) return false;
+            if (flat.length(index) != (int) node->lexeme()->length()) return false;
+        } else {
+            if (flat.symbol(index) != node->item_identifier()) return false;
+            if (flat.rule(index) != node->rule()) return false;
+        }
+        
+        if (flat.child_count(index) != (int) node->children().size()) return false;
+        if (flat.child_count(index) > 0 && flat.first_child(index) != (int) order.size()) return false;
+        
+        for (astnode::node_list::const_iterator child = node->children().begin(); child != node->children().end(); ++child) {
+            order.push_back(child->item());
+        }
+    }
+    
+    return (int) order.size() == flat.size();
+}
+
+// Parses some text into a complete green tree, optionally sharing nodes through a table
+static bool parse_green(const bootstrap& bs, const string& text, green_node_table* table, green_node_container& result) {
+    stringstream            source(text);
+    utf8reader              reader(&source);
+    green_parser            parser(&bs.get_parser().get_tables(), false);
+    green_parser_actions*   actions = new green_parser_actions(bs.get_lexer().create_stream_from<wchar_t>(reader), table);
+    green_parser::state*    state   = parser.create_parser(actions);
+    
+    bool accepted = state->parse();
+    if (accepted) {
+        result = actions->complete(state->get_item());
+    }
+    
+    delete state;
+    return accepted;
+}
+
+// True if the symbols found in a red tree at each offset match the text
+static bool red_offsets_match(const red_node& root, const green_node::text& text) {
+    if (root.end_offset() != text.size()) return false;
+    
+    for (size_t offset = 0; offset < text.size(); ++offset) {
+        red_node symbol = root.find_symbol(offset);
+        if (!symbol.is_valid() || offset < symbol.offset() || offset >= symbol.end_offset()) return false;
+        
+        // Tokens are only found once the offset is past their trivia
+        size_t textStart = symbol->node_kind() == green_node::token ? symbol.text_offset() : symbol.offset();
+        if (offset < textStart || symbol->get_text()[offset - textStart] != text[offset]) return false;
+    }
+    
+    return true;
+}
+
+// True if any token in a green tree has trivia
+static bool has_trivia(const green_node* node) {
+    if (node->node_kind() == green_node::token) return !node->children().empty();
+    
+    for (green_node::node_list::const_iterator child = node->children().begin(); child != node->children().end(); ++child) {
+        if (has_trivia(child->item())) return true;
+    }
+    return false;
+}
+
+static bool propagation_matches_digraph(const bootstrap& bs) {
+    // Rebuild the bootstrap parser using the dragon book propagation algorithm
+    const lalr_machine& digraph = bs.get_builder().machine();
+    lalr_builder        propagated(const_cast<grammar&>(bs.get_grammar()), const_cast<terminal_dictionary&>(bs.get_terminals()));
+    
+    propagated.set_lookahead_algorithm(lalr_builder::lookahead_propagate);
+    propagated.add_initial_state((*digraph.state_with_id(0))[0]->rule()->items()[0]);
+    propagated.complete_parser();
+    
+    // Every item should have the same lookahead
+    if (propagated.machine().count_states() != digraph.count_states()) return false;
+    
+    for (int stateId = 0; stateId < digraph.count_states(); ++stateId) {
+        const lalr_state& ours      = *digraph.state_with_id(stateId);
+        const lalr_state& theirs    = *propagated.machine().state_with_id(stateId);
+        
+        if (ours != theirs) return false;
+        
+        for (int itemId = 0; itemId < ours.count_items(); ++itemId) {
+            if (ours.lookahead_for(itemId) != theirs.lookahead_for(itemId)) return false;
+        }
+    }
+    
+    return true;
+}
+
 void test_language_bootstrap::run_tests() {
     // Create a bootstrap object
     bootstrap bs;
@@ -245,6 +399,7 @@ void test_language_bootstrap::run_tests() {
     conflict::find_conflicts(bs.get_builder(), conflicts);
     
     report("NoConflicts", conflicts.size() == 0);
+    report("PropagationMatchesDigraph", propagation_matches_digraph(bs));
     
     // Write out the conflicts to the standard I/O if there were any
     if (conflicts.size() > 0) {
@@ -266,7 +421,9 @@ void test_language_bootstrap::run_tests() {
     ast_parser::state* defParser = bs.get_parser().create_parser(new ast_parser_actions(defaultStream));
     
     // Try parsing the language
-    bool acceptedDefault = defParser->parse();
+    test_budget defaultBudget;
+    bool        acceptedDefault     = defParser->parse();
+    long        defaultAllocations  = defaultBudget.allocations();
     
     report("CanParseLanguageDefinition", acceptedDefault);
     
@@ -275,6 +432,526 @@ void test_language_bootstrap::run_tests() {
     definition_file_container defn = bs.get_definition(defParser->get_item().item());
     report("CanGetDefinition", defn.item() != NULL);
     
+    // AST nodes keep their own reference count: copying a container shares the node, moving it leaves the count alone
+    int                 rootCount   = defParser->get_item()->reference_count();
+    astnode_container   rootCopy    = defParser->get_item();
+    
+    report("AstCopyShared", rootCopy.item() == defParser->get_item().item() && rootCopy->reference_count() == rootCount + 1);
+    
+#if __cplusplus >= 201103L
+    astnode_container   rootMoved   = std::move(rootCopy);
+    report("AstMoveKeepsCount", rootCopy.item() == NULL && rootMoved->reference_count() == rootCount + 1);
+    
+    rootMoved = astnode_container();
+#else
+    rootCopy = astnode_container();
+#endif
+    report("AstReleased", defParser->get_item()->reference_count() == rootCount);
+    
+    // Nodes built from a range keep their children in order, and only spill out of the node when there are lots of them
+    astnode_container sizedChildren[6] = { astnode_container(new astnode(1), true), astnode_container(new astnode(2), true), astnode_container(new astnode(3), true),
+                                           astnode_container(new astnode(4), true), astnode_container(new astnode(5), true), astnode_container(new astnode(6), true) };
+    astnode_container smallNode(new astnode(10, 0, sizedChildren, sizedChildren + 3), true);
+    astnode_container largeNode(new astnode(11, 0, sizedChildren, sizedChildren + 6), true);
+    
+    report("AstSizedChildren", smallNode->children().size() == 3 && (*smallNode)[0].item() == sizedChildren[0].item() && (*smallNode)[2].item() == sizedChildren[2].item());
+    report("AstSizedManyChildren", largeNode->children().size() == 6 && (*largeNode)[5].item() == sizedChildren[5].item() && sizedChildren[5]->reference_count() == 2);
+    
+    largeNode = astnode_container();
+    report("AstChildrenReleased", sizedChildren[5]->reference_count() == 1 && sizedChildren[0]->reference_count() == 2);
+    
+    // Memory used by trees counts nodes that appear more than once a single time
+    astnode_container   twiceChildren[2]    = { sizedChildren[0], sizedChildren[0] };
+    astnode_container   twiceNode(new astnode(12, 0, twiceChildren, twiceChildren + 2), true);
+    astnode_container   spilledNode(new astnode(13, 0, sizedChildren, sizedChildren + 6), true);
+    
+    report("AstMemoryUsage", smallNode->memory_usage() == 4 * sizeof(astnode) && spilledNode->memory_usage() == 7 * sizeof(astnode) + 6 * sizeof(astnode_container));
+    report("AstMemorySharedOnce", twiceNode->memory_usage() == 2 * sizeof(astnode));
+    
+    lexeme::symbols     shortSymbols(3, 'a');
+    lexeme::symbols     longSymbols(100, 'a');
+    lexeme              shortLexeme(shortSymbols, position(0, 0, 0), 0);
+    lexeme              longLexeme(longSymbols, position(0, 0, 0), 0);
+    
+    report("LexemeMemoryUsage", shortLexeme.memory_usage() == sizeof(lexeme) && longLexeme.memory_usage() > sizeof(lexeme) + 100 * sizeof(int));
+    
+    // Destroying a very deep tree shouldn't overflow the stack
+    astnode_container deepTree(new astnode(0), true);
+    for (int depth = 0; depth < 1000000; ++depth) {
+        astnode_container parent(new astnode(depth, 0, &deepTree, &deepTree + 1), true);
+        deepTree = parent;
+    }
+    
+    astnode_container sharedLeaf = deepTree;
+    for (int depth = 0; depth < 999000; ++depth) sharedLeaf = (*sharedLeaf)[0];
+    
+    deepTree = astnode_container();
+    report("AstDeepTreeReleased", sharedLeaf->reference_count() == 1 && sharedLeaf->children().size() == 1);
+    
+    // Parse the language again, this time allocating the AST from an arena: the result should be the same
+    stringstream arenaDefinition(bootstrap::get_default_language_definition());
+    utf8reader arenaReader(&arenaDefinition);
+    
+    ast_parser_actions*  arenaActions   = new ast_parser_actions(bs.get_lexer().create_stream_from<wchar_t>(arenaReader), true);
+    ast_parser::state*   arenaParser    = bs.get_parser().create_parser(arenaActions);
+    test_budget          arenaBudget;
+    
+    report("CanParseWithArena", arenaParser->parse());
+    
+    // The nodes are allocated from the arena, so there should be far fewer allocations than without one
+    report_allocations("ArenaParseAllocations", arenaBudget, defaultAllocations * 3 / 4);
+    report("ArenaUsed", arenaActions->get_arena() != NULL && arenaActions->get_arena()->size() > 0);
+    report("ArenaSameTree", formatter::to_string(*arenaParser->get_item(), bs.get_grammar(), bs.get_terminals()) == formatter::to_string(*defParser->get_item(), bs.get_grammar(), bs.get_terminals()));
+    
+    // Memory resources are current for a scope, and scopes can be nested
+    arena_resource outerResource;
+    arena_resource innerResource;
+    {
+        memory_resource_scope outerScope(&outerResource);
+        {
+            memory_resource_scope innerScope(&innerResource);
+            report("ResourceScopeCurrent", memory_resource::current() == &innerResource);
+        }
+        
+        report("ResourceScopeRestored", memory_resource::current() == &outerResource);
+        
+        vector<int, resource_allocator<int> > resourceVector(100, 1);
+        report("ResourceAllocatorUsed", resourceVector.get_allocator().resource() == &outerResource && outerResource.get_arena().size() >= 100 * sizeof(int));
+    }
+    report("ResourceScopeHeap", memory_resource::current_is_heap() && memory_resource::current() == memory_resource::heap());
+    
+    // Parse the language with everything that the parser allocates coming from an arena resource
+    {
+        arena_resource          parseResource;
+        memory_resource_scope   parseScope(&parseResource);
+        
+        stringstream resourceDefinition(bootstrap::get_default_language_definition());
+        utf8reader resourceReader(&resourceDefinition);
+        
+        test_budget          resourceBudget;
+        ast_parser::state*   resourceParser = bs.get_parser().create_parser(new ast_parser_actions(bs.get_lexer().create_stream_from<wchar_t>(resourceReader)));
+        
+        report("CanParseWithResource", resourceParser->parse());
+        report_allocations("ResourceParseAllocations", resourceBudget, defaultAllocations / 4);
+        report("ResourceUsed", parseResource.get_arena().size() > 0);
+        report("ResourceSameTree", formatter::to_string(*resourceParser->get_item(), bs.get_grammar(), bs.get_terminals()) == formatter::to_string(*defParser->get_item(), bs.get_grammar(), bs.get_terminals()));
+        
+        delete resourceParser;
+    }
+    
+    // Parse it sharing identical subtrees: the tree should look the same, but have fewer distinct nodes
+    stringstream sharedDefinition(bootstrap::get_default_language_definition());
+    utf8reader sharedReader(&sharedDefinition);
+    
+    ast_parser_actions*  sharedActions  = new ast_parser_actions(bs.get_lexer().create_stream_from<wchar_t>(sharedReader), false, true);
+    ast_parser::state*   sharedParser   = bs.get_parser().create_parser(sharedActions);
+    
+    int allTerminals    = 0;
+    int allNonterminals = 0;
+    count_nodes(defParser->get_item().item(), allTerminals, allNonterminals);
+    
+    set<const astnode*> sharedNodes;
+    
+    report("CanParseSharingNodes", sharedParser->parse());
+    distinct_nodes(sharedParser->get_item().item(), sharedNodes);
+    
+    report("SharedNodesSameTree", formatter::to_string(*sharedParser->get_item(), bs.get_grammar(), bs.get_terminals()) == formatter::to_string(*defParser->get_item(), bs.get_grammar(), bs.get_terminals()));
+    report("SharedNodesFewer", (int) sharedNodes.size() < allTerminals + allNonterminals && sharedNodes.size() == sharedActions->get_shared_nodes()->size());
+    
+    delete sharedParser;
+    
+    // Two identical languages in the same file should share the same node
+    string              twoLanguages    = bootstrap::get_default_language_definition() + "\n" + bootstrap::get_default_language_definition();
+    stringstream        twoDefinitions(twoLanguages);
+    utf8reader          twoReader(&twoDefinitions);
+    ast_parser::state*  twoParser       = bs.get_parser().create_parser(new ast_parser_actions(bs.get_lexer().create_stream_from<wchar_t>(twoReader), false, true));
+    
+    set<const astnode*> twoNodes;
+    
+    report("CanParseTwoLanguages", twoParser->parse());
+    distinct_nodes(twoParser->get_item().item(), twoNodes);
+    report("SharedNodesRepeatedSubtree", twoNodes.size() < sharedNodes.size() + 8);
+    
+    delete twoParser;
+    
+    // Parse it once more reporting events: there should be one for each node in the AST
+    stringstream eventDefinition(bootstrap::get_default_language_definition());
+    utf8reader eventReader(&eventDefinition);
+    
+    event_parser        eventParser(&bs.get_parser().get_tables(), false);
+    counting_events     counter;
+    event_parser::state* eventState = eventParser.create_parser(new event_parser_actions(bs.get_lexer().create_stream_from<wchar_t>(eventReader), &counter));
+    
+    int astTerminals    = 0;
+    int astNonterminals = 0;
+    count_nodes(defParser->get_item().item(), astTerminals, astNonterminals);
+    
+    report("CanParseWithEvents", eventState->parse());
+    report("EventsShiftEachTerminal", counter.shifts == astTerminals);
+    report("EventsReduceEachNonterminal", counter.reduces == astNonterminals);
+    
+    delete eventState;
+    
+    // Parse it to a syntax tape, and build the AST from the tape afterwards: it should match the one built while parsing
+    stringstream tapeDefinition(bootstrap::get_default_language_definition());
+    utf8reader tapeReader(&tapeDefinition);
+    
+    tape_parser         tapeParser(&bs.get_parser().get_tables(), false);
+    syntax_tape         tape;
+    tape_parser::state* tapeState = tapeParser.create_parser(new tape_parser_actions(bs.get_lexer().create_stream_from<wchar_t>(tapeReader), &tape));
+    
+    report("CanParseToTape", tapeState->parse());
+    report("TapeRecordsEachNode", tape.size() == astTerminals + astNonterminals);
+    
+    ast_parser_actions  lazyActions(NULL);
+    lazy_syntax_tree<astnode_container, ast_parser_actions> lazyTree(tape, lazyActions);
+    
+    int tapeRoot    = tapeState->get_item();
+    int tapeContent = tape.skip_units(tapeRoot);
+    report("TapeUnitsSkipped", tape.is_terminal(tapeContent) || tape.child_count(tapeContent) != 1);
+    report("TapeLazySameTree", formatter::to_string(*lazyTree.get(tapeRoot), bs.get_grammar(), bs.get_terminals()) == formatter::to_string(*defParser->get_item(), bs.get_grammar(), bs.get_terminals()));
+    report("TapeLazyBuiltOnce", lazyTree.get(tapeRoot).item() == lazyTree.get(tapeRoot).item());
+    
+    // Writing the tape out and reading it back should give the same tree, with the same lexemes
+    stringstream    tapeData;
+    syntax_tape     tapeCopy;
+    tape.write(tapeData);
+    
+    report("TapeReadBack", tapeCopy.read(tapeData) && tapeCopy.size() == tape.size());
+    report("TapeRootIsLast", tapeRoot == tape.size() - 1);
+    
+    bool sameLexemes = tapeCopy.size() == tape.size();
+    for (int record = 0; sameLexemes && record < tape.size(); ++record) {
+        if (!tape.is_terminal(record)) continue;
+        
+        const lexeme& original  = *tape.lexeme(record);
+        const lexeme& copy      = *tapeCopy.lexeme(record);
+        sameLexemes = original.matched() == copy.matched() && original.content() == copy.content() && original.pos() == copy.pos();
+    }
+    report("TapeReadBackLexemes", sameLexemes);
+    
+    ast_parser_actions  copyActions(NULL);
+    lazy_syntax_tree<astnode_container, ast_parser_actions> copyTree(tapeCopy, copyActions);
+    report("TapeReadBackSameTree", formatter::to_string(*copyTree.get(tapeCopy.size() - 1), bs.get_grammar(), bs.get_terminals()) == formatter::to_string(*defParser->get_item(), bs.get_grammar(), bs.get_terminals()));
+    
+    stringstream truncatedTape(tapeData.str().substr(0, tapeData.str().size() / 2));
+    report("TapeRejectsTruncated", !tapeCopy.read(truncatedTape) && tapeCopy.size() == 0);
+    
+    string oldTape = tapeData.str();
+    oldTape[0] = (char) (oldTape[0] - 1);
+    stringstream oldTapeData(oldTape);
+    report("TapeRejectsOldFormat", !tapeCopy.read(oldTapeData) && tapeCopy.size() == 0);
+    
+    // Replaying the whole tape after parsing should build the same tree, as should building subtrees in parallel
+    ast_parser_actions  replayActions(NULL);
+    replayed_syntax_tree<astnode_container, ast_parser_actions> replayedTree(tape);
+    replayedTree.replay(replayActions);
+    
+    // The subtree for each child starts just after the previous child
+    bool subtreesAdjacent = tape.subtree_start(tapeRoot) == 0;
+    for (int record = 0; subtreesAdjacent && record < tape.size(); ++record) {
+        if (tape.is_terminal(record) || tape.child_count(record) == 0) continue;
+        
+        for (int child = 1; subtreesAdjacent && child < tape.child_count(record); ++child) {
+            subtreesAdjacent = tape.subtree_start(tape.child(record, child)) == tape.child(record, child - 1) + 1;
+        }
+        
+        subtreesAdjacent = subtreesAdjacent && tape.child(record, tape.child_count(record) - 1) == record - 1;
+    }
+    
+    report("TapeSubtreeStart", subtreesAdjacent);
+    report("TapeReplaySameTree", replayedTree.is_built(tapeRoot) && formatter::to_string(*replayedTree.get(tapeRoot), bs.get_grammar(), bs.get_terminals()) == formatter::to_string(*defParser->get_item(), bs.get_grammar(), bs.get_terminals()));
+    
+    vector<ast_parser_actions*> parallelActions;
+    for (int threadNum = 0; threadNum < 4; ++threadNum) parallelActions.push_back(new ast_parser_actions(NULL));
+    
+    replayed_syntax_tree<astnode_container, ast_parser_actions> parallelTree(tape);
+    parallelTree.replay_parallel(tapeRoot, parallelActions, 16);
+    
+    report("TapeReplayParallelSameTree", parallelTree.is_built(tapeRoot) && formatter::to_string(*parallelTree.get(tapeRoot), bs.get_grammar(), bs.get_terminals()) == formatter::to_string(*defParser->get_item(), bs.get_grammar(), bs.get_terminals()));
+    
+    for (int threadNum = 0; threadNum < 4; ++threadNum) delete parallelActions[threadNum];
+    
+    delete tapeState;
+    
+    // Parse it into a flat AST: once it's finished, it should have the same nodes as the AST in breadth-first order
+    stringstream flatDefinition(bootstrap::get_default_language_definition());
+    utf8reader flatReader(&flatDefinition);
+    
+    flat_ast_parser         flatParser(&bs.get_parser().get_tables(), false);
+    flat_ast                flatTree;
+    flat_ast_parser::state* flatState = flatParser.create_parser(new flat_ast_parser_actions(bs.get_lexer().create_stream_from<wchar_t>(flatReader), &flatTree));
+    
+    report("CanParseToFlatAst", flatState->parse());
+    
+    flatTree.finish(flatState->get_item());
+    report("FlatAstSameTree", flatTree.finished() && flat_matches_tree(flatTree, defParser->get_item().item()));
+    report("FlatAstCoversInput", flatTree.length(0) > 0 && flatTree.offset(0) + flatTree.length(0) <= (int) bootstrap::get_default_language_definition().size());
+    
+    // Writing the tree out and reading it back should produce the same tree
+    stringstream    flatData;
+    flat_ast        flatCopy;
+    flatTree.write(flatData);
+    
+    report("FlatAstReadBack", flatCopy.read(flatData) && flat_matches_tree(flatCopy, defParser->get_item().item()));
+    
+    stringstream    truncatedData(flatData.str().substr(0, flatData.str().size() / 2));
+    report("FlatAstRejectsTruncated", !flatCopy.read(truncatedData) && flatCopy.size() == 0);
+    
+    string oldFlat = flatData.str();
+    oldFlat[0] = (char) (oldFlat[0] - 1);
+    stringstream oldFlatData(oldFlat);
+    report("FlatAstRejectsOldFormat", !flatCopy.read(oldFlatData) && flatCopy.size() == 0);
+    
+    // Parse it into a green tree: this should include the comments and whitespace, so its text is the original text
+    string              greenDefinition = bootstrap::get_default_language_definition();
+    green_node::text    greenText(greenDefinition.begin(), greenDefinition.end());
+    green_node_table    greenTable;
+    green_node_container greenTree(NULL, false);
+    green_node::text    greenTreeText;
+    
+    report("CanParseToGreenTree", parse_green(bs, greenDefinition, &greenTable, greenTree));
+    greenTree->append_text(greenTreeText);
+    
+    report("GreenTreeLossless", greenTree->width() == greenText.size() && greenTreeText == greenText);
+    report("GreenTreeHasTrivia", has_trivia(greenTree.item()) && greenTree->leading_width() > 0);
+    report("RedNodeOffsets", red_offsets_match(red_node(greenTree), greenText));
+    
+    // Parsing the same text with the same table should produce exactly the same tree
+    green_node_container    greenAgain(NULL, false);
+    size_t                  greenNodes  = greenTable.size();
+    
+    report("GreenTreeReused", parse_green(bs, greenDefinition, &greenTable, greenAgain) && greenAgain.item() == greenTree.item() && greenTable.size() == greenNodes);
+    
+    // After an edit, only the nodes on the path to the change should be new
+    green_node_container    greenEdited(NULL, false);
+    green_node::text        greenEditedText;
+    string                  editedDefinition = "// Edited\n" + greenDefinition;
+    
+    report("CanParseEditedGreenTree", parse_green(bs, editedDefinition, &greenTable, greenEdited));
+    greenEdited->append_text(greenEditedText);
+    
+    report("GreenEditLossless", greenEditedText == green_node::text(editedDefinition.begin(), editedDefinition.end()));
+    report("GreenEditSharesSubtrees", greenEdited.item() != greenTree.item() && greenTable.size() > greenNodes && greenTable.size() - greenNodes < greenNodes / 10);
+    
+    // Once the original tree has gone, the nodes that only it used can be removed from the table
+    size_t editedNodes = greenTable.size();
+    greenTree   = green_node_container(NULL, false);
+    greenAgain  = green_node_container(NULL, false);
+    
+    size_t removedNodes = greenTable.remove_unused();
+    report("GreenRemoveUnused", removedNodes > 0 && removedNodes < editedNodes / 10 && greenTable.size() == editedNodes - removedNodes);
+    
+    // Trees can also be built without a table
+    green_node_container    unsharedTree(NULL, false);
+    green_node::text        unsharedText;
+    
+    report("CanParseUnsharedGreenTree", parse_green(bs, greenDefinition, NULL, unsharedTree));
+    unsharedTree->append_text(unsharedText);
+    report("UnsharedGreenTreeLossless", unsharedText == greenText);
+    
+    // Trees of AST nodes can be written out and read back too
+    stringstream        astData;
+    astnode_container   astCopy;
+    defParser->get_item()->write(astData);
+    
+    report("AstReadBack", astnode::read(astData, astCopy) && formatter::to_string(*astCopy, bs.get_grammar(), bs.get_terminals()) == formatter::to_string(*defParser->get_item(), bs.get_grammar(), bs.get_terminals()));
+    
+    stringstream truncatedAst(astData.str().substr(0, astData.str().size() / 2));
+    report("AstRejectsTruncated", !astnode::read(truncatedAst, astCopy));
+
+    // The definition can be lexed once, then parsed from the tokens as many times as needed
+    const string&   tokenText = bootstrap::get_default_language_definition();
+    vector<int>     tokenSymbols;
+    for (string::const_iterator chr = tokenText.begin(); chr != tokenText.end(); ++chr) {
+        tokenSymbols.push_back((unsigned char) *chr);
+    }
+
+    token_array             defTokens(bs.get_lexer(), &tokenSymbols[0], &tokenSymbols[0] + tokenSymbols.size());
+    ast_parser::state*      tokenParser     = bs.get_parser().create_parser(new ast_parser_actions(defTokens));
+    ast_parser::state*      tokenParserAgain= bs.get_parser().create_parser(new ast_parser_actions(defTokens, true));
+    flat_ast                tokenFlat;
+    flat_ast_parser::state* tokenFlatState  = flatParser.create_parser(new flat_ast_parser_actions(defTokens, &tokenFlat));
+    simple_parser           tokenSimple(&bs.get_parser().get_tables(), false);
+    simple_parser::state*   tokenSimpleState= tokenSimple.create_parser(new simple_parser_actions(defTokens));
+
+    report("TokenArrayLexed", defTokens.size() > 100 && defTokens.symbols() == &tokenSymbols[0]);
+    report("TokenArrayParse", tokenParser->parse() && formatter::to_string(*tokenParser->get_item(), bs.get_grammar(), bs.get_terminals()) == formatter::to_string(*defParser->get_item(), bs.get_grammar(), bs.get_terminals()));
+    report("TokenArrayParseAgain", tokenParserAgain->parse() && formatter::to_string(*tokenParserAgain->get_item(), bs.get_grammar(), bs.get_terminals()) == formatter::to_string(*defParser->get_item(), bs.get_grammar(), bs.get_terminals()));
+    report("TokenArrayFlatAst", tokenFlatState->parse() && (tokenFlat.finish(tokenFlatState->get_item()), flat_matches_tree(tokenFlat, defParser->get_item().item())));
+    report("TokenArraySimple", tokenSimpleState->parse());
+
+    delete tokenParser;
+    delete tokenParserAgain;
+    delete tokenFlatState;
+    delete tokenSimpleState;
+    
+    // Parse results can be cached on disk, keyed on the content of the file that was parsed
+    string              cachedText  = bootstrap::get_default_language_definition();
+    parse_cache         astCache(".", "bootstrap");
+    parse_cache         flatCache(".", "bootstrap-flat");
+    astnode_container   cachedAst;
+    flat_ast            cachedFlat;
+    
+    report("ParseCacheMiss", !astCache.load(cachedText, cachedAst));
+    report("ParseCacheStore", astCache.store(cachedText, defParser->get_item()) && flatCache.store(cachedText, flatTree));
+    report("ParseCacheHit", astCache.load(cachedText, cachedAst) && formatter::to_string(*cachedAst, bs.get_grammar(), bs.get_terminals()) == formatter::to_string(*defParser->get_item(), bs.get_grammar(), bs.get_terminals()));
+    report("ParseCacheFlatHit", flatCache.load(cachedText, cachedFlat) && flat_matches_tree(cachedFlat, defParser->get_item().item()));
+    report("ParseCacheChangedContent", !astCache.load(cachedText + " ", cachedAst));
+    report("ParseCacheSeparateLanguages", astCache.filename(cachedText.data(), cachedText.size()) != flatCache.filename(cachedText.data(), cachedText.size()));
+    
+    remove(astCache.filename(cachedText.data(), cachedText.size()).c_str());
+    remove(flatCache.filename(cachedText.data(), cachedText.size()).c_str());
+    
+    delete flatState;
+    
+    // Whitespace and comments are ignored in every state, so a lexer can skip them without changing the result
+    vector<int> ignoredSymbols;
+    bs.get_parser().get_tables().find_ignored_symbols(ignoredSymbols);
+    
+    int whitespaceId    = bs.get_terminal_items().whitespace->symbol();
+    int commentId       = bs.get_terminal_items().comment->symbol();
+    report("IgnoredSymbolsFound", find(ignoredSymbols.begin(), ignoredSymbols.end(), whitespaceId) != ignoredSymbols.end() && find(ignoredSymbols.begin(), ignoredSymbols.end(), commentId) != ignoredSymbols.end());
+    
+    int     numSkipped  = ignoredSymbols.empty() ? 0 : ignoredSymbols.back() + 1;
+    bool*   skipIgnored = new bool[numSkipped + 1];
+    fill(skipIgnored, skipIgnored + numSkipped + 1, false);
+    for (vector<int>::const_iterator ignored = ignoredSymbols.begin(); ignored != ignoredSymbols.end(); ++ignored) {
+        skipIgnored[*ignored] = true;
+    }
+    
+    stringstream skipDefinition(bootstrap::get_default_language_definition());
+    utf8reader skipReader(&skipDefinition);
+    
+    lexeme_stream*      skipStream  = bs.get_lexer().create_stream_from<wchar_t>(skipReader);
+    bool                canSkip     = skipStream->skip_symbols(skipIgnored, numSkipped);
+    ast_parser::state*  skipParser  = bs.get_parser().create_parser(new ast_parser_actions(skipStream, true));
+    
+    report("CanParseSkippingIgnored", canSkip && skipParser->parse());
+    report("SkipIgnoredSameTree", formatter::to_string(*skipParser->get_item(), bs.get_grammar(), bs.get_terminals()) == formatter::to_string(*defParser->get_item(), bs.get_grammar(), bs.get_terminals()));
+    
+    delete skipParser;
+    delete[] skipIgnored;
+    
+    // Restricting the lexer to the terminals that are valid in each state shouldn't change the result for valid input
+    parser_tables* contextTables = new parser_tables(bs.get_parser().get_tables());
+    contextTables->compile_valid_terminals();
+    
+    int         stateWords          = (contextTables->count_valid_terminals() + 31) / 32;
+    bool        whitespaceAllowed   = contextTables->count_valid_terminals() > whitespaceId;
+    
+    for (int stateId = 0; stateId < contextTables->count_states() && whitespaceAllowed; ++stateId) {
+        const unsigned int* valid = contextTables->valid_terminals(stateId);
+        if (!(valid[whitespaceId>>5] & (1u<<(whitespaceId&31)))) whitespaceAllowed = false;
+    }
+    
+    report("ValidTerminalsIncludeIgnored", stateWords > 0 && whitespaceAllowed);
+    
+    stringstream contextDefinition(bootstrap::get_default_language_definition());
+    utf8reader contextReader(&contextDefinition);
+    
+    ast_parser          contextParser(contextTables, true);
+    lexeme_stream*      contextStream   = bs.get_lexer().create_stream_from<wchar_t>(contextReader);
+    ast_parser::state*  contextState    = contextParser.create_parser(new ast_parser_actions(contextStream, true));
+    
+    contextState->set_context_lexer(contextStream);
+    
+    report("CanParseWithContextLexer", contextState->parse());
+    report("ContextLexerSameTree", formatter::to_string(*contextState->get_item(), bs.get_grammar(), bs.get_terminals()) == formatter::to_string(*defParser->get_item(), bs.get_grammar(), bs.get_terminals()));
+    
+    delete contextState;
+    
+    // Parse several copies of the language on separate threads, sharing the lexer and tables from the bootstrap language
+    compiled_language   sharedLanguage(&bs.get_lexer(), &bs.get_parser().get_tables(), false);
+    vector<string>      parallelFiles;
+    
+    for (int fileIndex = 0; fileIndex < 4; ++fileIndex) {
+        stringstream filename;
+        filename << "parallel-parse-" << fileIndex << ".tp";
+        
+        ofstream file(filename.str().c_str());
+        file << (fileIndex == 2 ? string("rhubarb rhubarb rhubarb") : bootstrap::get_default_language_definition());
+        
+        parallelFiles.push_back(filename.str());
+    }
+    parallelFiles.push_back("parallel-parse-missing.tp");
+    
+    compiled_language::result_list parallelResults;
+    sharedLanguage.parse_files(parallelFiles, parallelResults, 0, 3);
+    
+    bool parallelSame = true;
+    for (int fileIndex = 0; fileIndex < 4; ++fileIndex) {
+        if (fileIndex == 2) continue;
+        if (!parallelResults[fileIndex].accepted) {
+            parallelSame = false;
+            continue;
+        }
+        
+        if (formatter::to_string(*parallelResults[fileIndex].ast, bs.get_grammar(), bs.get_terminals()) != formatter::to_string(*defParser->get_item(), bs.get_grammar(), bs.get_terminals())) {
+            parallelSame = false;
+        }
+    }
+    
+    report("ParallelParseResults", parallelResults.size() == parallelFiles.size());
+    report("ParallelParseSameTree", parallelSame);
+    report("ParallelParseRejectsNonsense", parallelResults[2].opened && !parallelResults[2].accepted && parallelResults[2].error_position.line() == 0);
+    report("ParallelParseMissingFile", !parallelResults[4].opened);
+    
+    // Languages and sessions can report how much memory they are using
+    size_t  languageMemory  = sharedLanguage.memory_usage();
+    size_t  stateMemory     = defParser->memory_usage();
+    size_t  sessionMemory   = defParser->session_memory_usage();
+    size_t  treeMemory      = defParser->get_item()->memory_usage();
+    
+    report("LanguageMemoryUsage", languageMemory == sizeof(compiled_language) + bs.get_lexer().size() + bs.get_parser().get_tables().size());
+    report("SessionMemoryUsage", stateMemory > sizeof(ast_parser::state) && sessionMemory > stateMemory);
+    report("TreeMemoryUsage", treeMemory > defParser->get_item()->children().size() * sizeof(astnode));
+    
+    for (int fileIndex = 0; fileIndex < 4; ++fileIndex) {
+        remove(parallelFiles[fileIndex].c_str());
+    }
+    
+    // Edits to the language can be parsed incrementally, giving the same result as parsing the edited text from scratch
+    string              definition = bootstrap::get_default_language_definition();
+    vector<int>         definitionSymbols(definition.begin(), definition.end());
+    incremental_parser  incremental(sharedLanguage);
+    
+    report("IncrementalParse", incremental.parse(&definitionSymbols[0], &definitionSymbols[0] + definitionSymbols.size()));
+    report("IncrementalSameTree", formatter::to_string(*incremental.ast(), bs.get_grammar(), bs.get_terminals()) == formatter::to_string(*defParser->get_item(), bs.get_grammar(), bs.get_terminals()));
+    
+    size_t  numTokens   = incremental.tokens().size();
+    int     spaces[]    = { ' ', ' ' };
+    int     braces[]    = { '{', '{', '{' };
+    size_t  lateEdit    = definition.rfind('\n', definition.size() - 2);
+    size_t  middleEdit  = definition.find('\n', definition.size() / 2);
+    
+    bool    lateAccepted = incremental.edit(lateEdit, 0, spaces, spaces + 2);
+    report("IncrementalEdit", lateAccepted);
+    report("IncrementalEditRelexesLittle", incremental.relexed_tokens() < 5 && incremental.tokens().size() == numTokens + 1);
+    report("IncrementalEditReparsesLittle", incremental.reparsed_tokens() < numTokens / 4);
+    
+    incremental_parser  fromScratch(sharedLanguage);
+    fromScratch.parse(&incremental.text()[0], &incremental.text()[0] + incremental.text().size());
+    
+    bool sameTokens = fromScratch.tokens().size() == incremental.tokens().size();
+    for (size_t tokenId = 0; sameTokens && tokenId < fromScratch.tokens().size(); ++tokenId) {
+        const lexeme_container& expected    = fromScratch.tokens()[tokenId];
+        const lexeme_container& actual      = incremental.tokens()[tokenId];
+        
+        if (expected->pos() != actual->pos() || expected->matched() != actual->matched() || expected->content() != actual->content()) {
+            sameTokens = false;
+        }
+    }
+    
+    report("IncrementalSameTokens", sameTokens);
+    report("IncrementalEditSameTree", fromScratch.accepted() && formatter::to_string(*incremental.ast(), bs.get_grammar(), bs.get_terminals()) == formatter::to_string(*fromScratch.ast(), bs.get_grammar(), bs.get_terminals()));
+    
+    // Breaking the text and then repairing it should take us back to the original tree
+    report("IncrementalBreak", !incremental.edit(middleEdit, 0, braces, braces + 3) && incremental.ast().item() == NULL);
+    report("IncrementalRepair", incremental.edit(middleEdit, 3, NULL, NULL) && incremental.edit(lateEdit, 2, NULL, NULL));
+    report("IncrementalRepairSameTree", formatter::to_string(*incremental.ast(), bs.get_grammar(), bs.get_terminals()) == formatter::to_string(*defParser->get_item(), bs.get_grammar(), bs.get_terminals()));
+    
+    delete arenaParser;
     delete defParser;
     
     // Create a stream o' nonsense, and parse it
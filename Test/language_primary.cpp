@@ -25,12 +25,24 @@
 //  IN THE SOFTWARE.
 //
 
+#include <algorithm>
 #include <string>
 #include <sstream>
 
 #include "TameParse/Util/utf8reader.h"
 #include "TameParse/Language/bootstrap.h"
 #include "TameParse/Language/language_parser.h"
+#include "TameParse/Compiler/language_compiler.h"
+#include "TameParse/Compiler/language_builder_stage.h"
+#include "TameParse/Compiler/test_stage.h"
+#include "TameParse/Compiler/parser_profile_stage.h"
+#include "TameParse/Compiler/buffered_console.h"
+#include "TameParse/Compiler/lexer_stage.h"
+#include "TameParse/Compiler/lr_parser_stage.h"
+#include "TameParse/Compiler/parser_stage.h"
+#include "TameParse/Compiler/sentence_stage.h"
+#include "TameParse/Util/parallel.h"
+#include "TameParse/Compiler/std_console.h"
 
 #include "language_primary.h"
 #include "tameparse_language.h"
@@ -41,6 +53,51 @@ using namespace dfa;
 using namespace lr;
 using namespace language;
 
+// Lexes a phrase, switching the stream to the given mode after a number of lexemes, and returns the lexemes separated by '|'
+static string test_mode_lex(const compiled_language& language, string phrase, int switchAfter, int mode) {
+    stringstream    source(phrase);
+    lexeme_stream*  lxs     = language.get_lexer().create_stream_from(source);
+    string          result;
+    
+    for (int count = 0; ; ++count) {
+        if (count == switchAfter) {
+            lxs->set_mode(mode);
+        }
+        
+        lexeme* next;
+        (*lxs) >> next;
+        
+        if (next == NULL) break;
+        if (next->matched() < 0) {
+            delete next;
+            break;
+        }
+        
+        result += next->content<char>();
+        result += "|";
+        delete next;
+    }
+    
+    delete lxs;
+    return result;
+}
+
+// Parses a phrase with a compiled language, switching the lexer into the mode for each parser state if useModes is true
+static bool test_mode_parse(const compiled_language& language, string phrase, bool useModes) {
+    stringstream        source(phrase);
+    lexeme_stream*      lxs     = language.get_lexer().create_stream_from(source);
+    ast_parser::state*  parser  = language.get_parser().create_parser(new ast_parser_actions(lxs));
+    
+    if (useModes) {
+        parser->set_mode_lexer(lxs, language.lexer_modes());
+    }
+    
+    bool accepted = parser->parse();
+    delete parser;
+    
+    return accepted;
+}
+
 // Checks that a given phrase is lexed as the specified symbol
 static bool test_lex(string phrase, const lexer& lex, int expectedSymbol) {
     // Create a lexeme stream
@@ -101,6 +158,396 @@ static bool test_ignored(string phrase, const lexer& lex, const set<int>& ignore
     return result;
 }
 
+/// \brief Console that discards the verbose messages produced while compiling languages at runtime
+class quiet_console : public compiler::std_console {
+private:
+    /// \brief Receives the verbose messages
+    wstringstream m_Verbose;
+    
+public:
+    quiet_console(const wstring& filename)
+    : std_console(filename) {
+    }
+    
+    virtual wostream& verbose_stream() { return m_Verbose; }
+};
+
+/// \brief Console that records the errors and messages it receives, and sets the number of threads to use
+class recording_console : public quiet_console {
+private:
+    /// \brief The value of the threads option
+    wstring m_Threads;
+    
+public:
+    /// \brief The errors and messages, in the order that they were received
+    wstringstream log;
+    
+    /// \brief True if the show-test-timing option should be set
+    bool showTiming;
+    
+    /// \brief True if the suppress-warnings option should be set
+    bool suppressWarnings;
+    
+    /// \brief The value of the test-throughput option
+    wstring throughput;
+    
+    /// \brief True if the utf8-lexer option should be set
+    bool utf8Lexer;
+    
+    recording_console(const wstring& filename, const wstring& threads)
+    : quiet_console(filename)
+    , m_Threads(threads)
+    , showTiming(false)
+    , suppressWarnings(false)
+    , utf8Lexer(false) {
+    }
+    
+    virtual void report_error(const compiler::error& error) {
+        log << L"error " << error.identifier() << L": " << error.description() << L"\n";
+    }
+    
+    virtual wostream& message_stream() { return log; }
+    
+    virtual wstring get_option(const wstring& name) const {
+        if (name == L"threads") return m_Threads;
+        if (name == L"show-test-timing" && showTiming) return L"1";
+        if (name == L"suppress-warnings" && suppressWarnings) return L"1";
+        if (name == L"test-throughput") return throughput;
+        if (name == L"utf8-lexer" && utf8Lexer) return L"1";
+        return L"";
+    }
+};
+
+/// \brief Console that sets the options for the sentence generator, and discards the files that are written
+class sentence_console : public recording_console {
+public:
+    /// \brief The value of the sentence-size option
+    wstring sentenceSize;
+    
+    sentence_console(const wstring& filename, const wstring& size)
+    : recording_console(filename, L"1")
+    , sentenceSize(size) {
+    }
+    
+    virtual wstring get_option(const wstring& name) const {
+        if (name == L"sentence-size") return sentenceSize;
+        return recording_console::get_option(name);
+    }
+    
+    virtual ostream* open_binary_file_for_writing(const wstring& filename) { return new stringstream(); }
+};
+
+/// \brief Records which indexes a parallel_for has visited
+class count_visits {
+public:
+    vector<int> visits;
+    
+    count_visits(size_t count)
+    : visits(count, 0) {
+    }
+    
+    void operator()(size_t index) { ++visits[index]; }
+};
+
+/// \brief Builds the parser states and compiles the lexer for a language, in the same way as parsetool
+class states_and_lexer_task {
+private:
+    compiler::lexer_stage&      m_Lexer;
+    compiler::lr_parser_stage&  m_Parser;
+    util::gate&                 m_GrammarGate;
+    
+public:
+    states_and_lexer_task(compiler::lexer_stage& lexer, compiler::lr_parser_stage& parser, util::gate& grammarGate)
+    : m_Lexer(lexer)
+    , m_Parser(parser)
+    , m_GrammarGate(grammarGate) {
+    }
+    
+    void operator()(size_t index) {
+        if (index == 0) {
+            m_Parser.build_states();
+            m_GrammarGate.open();
+        } else {
+            m_Lexer.compile();
+        }
+    }
+};
+
+// Builds the lexer and parser for the first language in a definition, and returns a summary of the tables
+static wstring build_lexer_and_parser(const wstring& definitionText, const wstring& languageName, bool concurrent) {
+    recording_console           console(L"split.tp", L"4");
+    compiler::console_container cons(&console, false);
+    language_parser             parser;
+    
+    parser.set_filename(L"split.tp");
+    if (!parser.parse(definitionText)) return L"syntax error";
+    
+    definition_file_container definition = parser.file_definition();
+    
+    compiler::import_stage importStage(cons, L"split.tp", definition);
+    importStage.compile();
+    
+    compiler::language_builder_stage builderStage(cons, L"split.tp", &importStage);
+    builderStage.compile();
+    
+    compiler::language_stage*   language = builderStage.language_with_name(languageName);
+    if (!language) return L"no language";
+    
+    compiler::lexer_stage       lexerStage(cons, L"split.tp", language);
+    compiler::lr_parser_stage   parserStage(cons, L"split.tp", language, &lexerStage, vector<wstring>(1, L"<S>"));
+    
+    if (concurrent) {
+        util::gate              grammarGate;
+        states_and_lexer_task   task(lexerStage, parserStage, grammarGate);
+        
+        lexerStage.set_grammar_gate(&grammarGate);
+        util::parallel_for(2, 2, task);
+        lexerStage.set_grammar_gate(NULL);
+        
+        parserStage.build_tables();
+    } else {
+        lexerStage.compile();
+        parserStage.compile();
+    }
+    
+    if (!lexerStage.dfa() || !parserStage.get_tables()) return L"no tables: " + console.log.str();
+    
+    wstringstream result;
+    result  << lexerStage.dfa()->count_states() << L" " << language->terminals()->count_symbols() << L" " 
+            << parserStage.get_tables()->count_states() << L" " << parserStage.get_tables()->count_weak_to_strong() << L" " 
+            << parserStage.get_tables()->size() << L" " << console.log.str();
+    return result.str();
+}
+
+// Builds the parser tables for a language from a freshly parsed definition, and describes the rules and actions in them
+static wstring describe_parser_tables(const wstring& definitionText, const wstring& languageName, const wstring& threads) {
+    recording_console           console(L"tables.tp", threads);
+    compiler::console_container cons(&console, false);
+    language_parser             parser;
+    
+    parser.set_filename(L"tables.tp");
+    if (!parser.parse(definitionText)) return L"syntax error";
+    
+    definition_file_container definition = parser.file_definition();
+    
+    compiler::import_stage importStage(cons, L"tables.tp", definition);
+    importStage.compile();
+    
+    compiler::language_builder_stage builderStage(cons, L"tables.tp", &importStage);
+    builderStage.compile();
+    
+    compiler::language_stage*   language = builderStage.language_with_name(languageName);
+    if (!language) return L"no language";
+    
+    compiler::lexer_stage       lexerStage(cons, L"tables.tp", language);
+    compiler::lr_parser_stage   parserStage(cons, L"tables.tp", language, &lexerStage, vector<wstring>(1, L"<S>"));
+    
+    // The states are built before the lexer is compiled, as parsetool does, so nothing else has numbered the items yet
+    if (parserStage.build_states()) {
+        lexerStage.compile();
+        parserStage.build_tables();
+    }
+    
+    const lr::parser_tables* tables = parserStage.get_tables();
+    if (!tables) return L"no tables: " + console.log.str();
+    
+    wstringstream result;
+    for (int ruleId = 0; ruleId < tables->count_reduce_rules(); ++ruleId) {
+        const lr::parser_tables::reduce_rule& rule = tables->rule(ruleId);
+        result << L"R" << rule.identifier << L"," << rule.ruleId << L"," << rule.length << L" ";
+    }
+    
+    for (int stateId = 0; stateId < tables->count_states(); ++stateId) {
+        result << L"\nS" << stateId << L":";
+        
+        for (const lr::parser_tables::action* act = tables->terminal_actions()[stateId]; act != tables->last_terminal_action(stateId); ++act) {
+            result << L" t" << act->symbolId << L"," << act->type << L"," << act->nextState;
+        }
+        for (const lr::parser_tables::action* act = tables->nonterminal_actions()[stateId]; act != tables->last_nonterminal_action(stateId); ++act) {
+            result << L" n" << act->symbolId << L"," << act->type << L"," << act->nextState;
+        }
+    }
+    
+    return result.str() + console.log.str();
+}
+
+// Generates a sentence for a nonterminal in a language, and returns it (or the errors if it couldn't be generated)
+static wstring generate_sentence(const wstring& definitionText, const wstring& languageName, const wstring& startSymbol, const wstring& size) {
+    sentence_console            console(L"sentence.tp", size);
+    compiler::console_container cons(&console, false);
+    language_parser             parser;
+    
+    parser.set_filename(L"sentence.tp");
+    if (!parser.parse(definitionText)) return L"syntax error";
+    
+    definition_file_container definition = parser.file_definition();
+    
+    compiler::import_stage importStage(cons, L"sentence.tp", definition);
+    importStage.compile();
+    
+    compiler::language_builder_stage builderStage(cons, L"sentence.tp", &importStage);
+    builderStage.compile();
+    
+    compiler::language_stage*   language = builderStage.language_with_name(languageName);
+    if (!language) return L"no language";
+    
+    compiler::lexer_stage       lexerStage(cons, L"sentence.tp", language);
+    compiler::lr_parser_stage   parserStage(cons, L"sentence.tp", language, &lexerStage, vector<wstring>(1, L"<S>"));
+    lexerStage.compile();
+    parserStage.compile();
+    
+    compiler::sentence_stage    sentenceStage(cons, L"sentence.tp", language, &lexerStage, &parserStage, startSymbol, L"sentence.txt");
+    sentenceStage.compile();
+    
+    if (!console.log.str().empty()) return console.log.str();
+    return sentenceStage.sentence();
+}
+
+// Builds every language in a definition, and runs its tests, returning what was reported to the console
+static wstring compile_and_test(const wstring& definitionText, const wstring& threads, bool showTiming = false, vector<compiler::stage_profile>* profiles = NULL, const wstring& throughput = L"", bool utf8Lexer = false) {
+    recording_console           console(L"parallel.tp", threads);
+    console.showTiming = showTiming;
+    console.throughput = throughput;
+    console.utf8Lexer  = utf8Lexer;
+    compiler::console_container cons(&console, false);
+    language_parser             parser;
+    
+    parser.set_filename(L"parallel.tp");
+    if (!parser.parse(definitionText)) return L"syntax error";
+    
+    definition_file_container definition = parser.file_definition();
+    
+    compiler::import_stage importStage(cons, L"parallel.tp", definition);
+    importStage.compile();
+    
+    compiler::language_builder_stage builderStage(cons, L"parallel.tp", &importStage);
+    builderStage.compile();
+    
+    compiler::test_stage testStage(cons, L"parallel.tp", definition, &importStage);
+    testStage.compile();
+    
+    if (profiles) *profiles = console.profiles();
+    return console.log.str();
+}
+
+// Builds every language in a definition, describing the number of rules for <S> in each of the listed languages and the
+// number of times each of them was compiled
+static wstring build_dialects(const wstring& definitionText, const wstring& threads, const wchar_t** languages) {
+    recording_console           console(L"dialects.tp", threads);
+    compiler::console_container cons(&console, false);
+    language_parser             parser;
+    
+    parser.set_filename(L"dialects.tp");
+    if (!parser.parse(definitionText)) return L"syntax error";
+    
+    definition_file_container definition = parser.file_definition();
+    
+    compiler::import_stage importStage(cons, L"dialects.tp", definition);
+    importStage.compile();
+    
+    compiler::language_builder_stage builderStage(cons, L"dialects.tp", &importStage);
+    builderStage.compile();
+    
+    if (!console.log.str().empty()) return console.log.str();
+    
+    wstringstream result;
+    for (const wchar_t** name = languages; *name; ++name) {
+        compiler::language_stage* language = builderStage.language_with_name(*name);
+        if (!language) return wstring(L"missing ") + *name;
+        
+        int compiled = 0;
+        for (vector<compiler::stage_profile>::const_iterator profile = console.profiles().begin(); profile != console.profiles().end(); ++profile) {
+            if (profile->stage() == L"language" && profile->language() == *name) ++compiled;
+        }
+        
+        result << *name << L":" << language->grammar()->rules_for_nonterminal(L"<S>").size() << L"/" << compiled << L" ";
+    }
+    
+    return result.str();
+}
+
+// Finds the profile for a stage, or NULL if there isn't one
+static const compiler::stage_profile* find_profile(const vector<compiler::stage_profile>& profiles, const wstring& stage, const wstring& language) {
+    for (vector<compiler::stage_profile>::const_iterator profile = profiles.begin(); profile != profiles.end(); ++profile) {
+        if (profile->stage() == stage && profile->language() == language) return &*profile;
+    }
+    return NULL;
+}
+
+// Finds the value of a counter in a profile (-1 if it's not there)
+static long find_counter(const compiler::stage_profile* profile, const wstring& name) {
+    if (!profile) return -1;
+    for (compiler::stage_profile::counter_list::const_iterator count = profile->counters().begin(); count != profile->counters().end(); ++count) {
+        if (count->first == name) return count->second;
+    }
+    return -1;
+}
+
+// Finds whether a profile has a timing with the specified name
+static bool has_timing(const compiler::stage_profile* profile, const wstring& name) {
+    if (!profile) return false;
+    for (compiler::stage_profile::timing_list::const_iterator timing = profile->timings().begin(); timing != profile->timings().end(); ++timing) {
+        if (timing->first == name) return timing->second >= 0;
+    }
+    return false;
+}
+
+// Writes out the stages and languages in a list of profiles
+static wstring profile_order(const vector<compiler::stage_profile>& profiles) {
+    wstringstream result;
+    for (vector<compiler::stage_profile>::const_iterator profile = profiles.begin(); profile != profiles.end(); ++profile) {
+        result << profile->stage() << L":" << profile->language() << L" ";
+    }
+    return result.str();
+}
+
+// Checks that a language compiled at runtime accepts a given phrase
+static bool test_runtime_parse(const compiled_language& language, string phrase) {
+    stringstream        source(phrase);
+    lexeme_stream*      lxs     = language.get_lexer().create_stream_from(source);
+    ast_parser::state*  parse   = language.get_parser().create_parser(new ast_parser_actions(lxs));
+    
+    bool result = parse->parse();
+    delete parse;
+    
+    return result;
+}
+
+// Parses a phrase as a series of documents, and returns the input position after each one (or 'reject' if one is rejected)
+static string parse_documents(const compiled_language& language, string phrase, string separator) {
+    // Find the separator symbol
+    int separatorSymbol = -1;
+    if (!separator.empty()) {
+        stringstream    separatorSource(separator);
+        lexeme_stream*  separatorStream = language.get_lexer().create_stream_from(separatorSource);
+        lexeme*         separatorLexeme;
+        
+        (*separatorStream) >> separatorLexeme;
+        separatorSymbol = separatorLexeme->matched();
+        
+        delete separatorLexeme;
+        delete separatorStream;
+    }
+    
+    // Parse the documents
+    stringstream        source(phrase);
+    lexeme_stream*      lxs     = language.get_lexer().create_stream_from(source);
+    ast_parser::state*  parse   = language.get_parser().create_parser(new ast_parser_actions(lxs));
+    stringstream        result;
+    
+    while (parse->more_documents()) {
+        if (!parse->parse_document(separatorSymbol)) {
+            result << "reject";
+            break;
+        }
+        
+        result << parse->input_position() << " ";
+    }
+    
+    delete parse;
+    return result.str();
+}
+
 void test_language_primary::run_tests() {
     // Build the list of ignored symbols
     set<int> ignoredSymbols;
@@ -173,4 +620,321 @@ void test_language_primary::run_tests() {
     language_parser lp;
     report("CanParseLanguageDefinition2", lp.parse(bootstrap::get_default_language_definition()));
     report("CanGetDefinition", lp.file_definition().item() != NULL);
+    
+    // Parsed definitions are allocated from an arena; copies of them live on the heap and outlast it
+    language_parser arenaParser;
+    arenaParser.parse(L"language Arena { lexer { a = /a/ } grammar { <S> = a <S> | a } }");
+    
+    definition_file_container arenaDefinition   = arenaParser.file_definition();
+    bool                      usedArena         = arenaDefinition.item() && arenaDefinition->pool() && arenaDefinition->pool()->size() > 0;
+    definition_file*          arenaCopy         = arenaDefinition.item() ? arenaDefinition->clone() : NULL;
+    
+    arenaDefinition = definition_file_container(NULL, true);
+    arenaParser.parse(L"language Other { }");
+    
+    report("DefinitionUsesArena", usedArena);
+    report("DefinitionCopyOnHeap", arenaCopy && !arenaCopy->pool() && arenaCopy->begin() != arenaCopy->end() && (*arenaCopy->begin())->language()->identifier() == L"Arena");
+    delete arenaCopy;
+    
+    // Languages can be compiled from a definition at runtime
+    wstring         runtimeDefinition   = L"language Runtime { lexer { a = /a/ b = /b/ } grammar { <S> = a <S> | b } }";
+    vector<wstring> runtimeStart(1, L"<S>");
+    
+    quiet_console               runtimeConsole(L"runtime.tp");
+    compiler::console_container runtimeCons(&runtimeConsole, false);
+    compiled_language*          runtime = compiler::language_compiler::compile_language(runtimeCons, L"runtime.tp", runtimeDefinition, L"", runtimeStart);
+    
+    report("RuntimeCompile", runtime != NULL);
+    report("RuntimeAccept", runtime != NULL && test_runtime_parse(*runtime, "aab"));
+    report("RuntimeReject", runtime != NULL && !test_runtime_parse(*runtime, "aba"));
+    delete runtime;
+    
+    // A session can parse several documents one after the other
+    wstring                     documentDefinition = L"language Documents { lexer { a = /a/ b = /b/ separator = /;/ } grammar { <S> = a <S> | b } }";
+    quiet_console               documentConsole(L"documents.tp");
+    compiler::console_container documentCons(&documentConsole, false);
+    compiled_language*          documents = compiler::language_compiler::compile_language(documentCons, L"documents.tp", documentDefinition, L"", runtimeStart);
+    
+    report("DocumentsCompile", documents != NULL);
+    report("DocumentsAdjacent", documents != NULL && parse_documents(*documents, "aabbab", "") == "3 4 6 ");
+    report("DocumentsSeparated", documents != NULL && parse_documents(*documents, "aab;b;ab;", ";") == "4 6 9 ");
+    report("DocumentsReject", documents != NULL && parse_documents(*documents, "aab;a;b", ";") == "4 reject");
+    delete documents;
+    
+    quiet_console               brokenConsole(L"broken.tp");
+    compiler::console_container brokenCons(&brokenConsole, false);
+    
+    // Lexer blocks can name a mode: their symbols only match after the stream has been switched into it
+    wstring         modeDefinition  = L"language Modes { lexer { word = /[a-z]+/ quote = /\"/ } lexer text { text = /[^\"]+/ quote |= /\"/ } grammar { <S> = word quote text quote } }";
+    
+    quiet_console               modeConsole(L"modes.tp");
+    compiler::console_container modeCons(&modeConsole, false);
+    compiled_language*          modes = compiler::language_compiler::compile_language(modeCons, L"modes.tp", modeDefinition, L"", runtimeStart);
+    
+    report("ModeCompile", modes != NULL);
+    report("ModeDefaultOnly", modes != NULL && test_mode_lex(*modes, "ab\"cd ef\"", -1, 0) == "ab|\"|cd|");
+    report("ModeSwitch", modes != NULL && test_mode_lex(*modes, "ab\"cd ef\"", 2, 1) == "ab|\"|cd ef|\"|");
+    report("ModeSwitchToDefault", modes != NULL && test_mode_lex(*modes, "ab", 0, 0) == "ab|");
+    
+    // The mode is kept by checkpoints and can also be set on a token cursor
+    if (modes) {
+        string          modeText    = "cd ef\"gh";
+        vector<int>     modeBuffer(modeText.begin(), modeText.end());
+        const int*      modeStart   = &modeBuffer[0];
+        const int*      modeEnd     = modeStart + modeBuffer.size();
+        lexeme_stream*  modeStream  = modes->get_lexer().create_stream_from_symbols(modeStart, modeEnd);
+        lexer_checkpoint modePoint;
+        
+        modeStream->set_mode(1);
+        bool            hasPoint    = modeStream->checkpoint(modePoint);
+        lexeme_stream*  restarted   = modes->get_lexer().create_stream_from_checkpoint(modeStart, modeEnd, modePoint);
+        lexeme*         text        = NULL;
+        if (restarted) (*restarted) >> text;
+        
+        report("ModeCheckpoint", hasPoint && modePoint.mode() == 1 && text && text->content<char>() == "cd ef");
+        delete text;
+        delete restarted;
+        delete modeStream;
+        
+        token_cursor    modeCursor(modeStart, modeEnd);
+        token           modeTokens[3];
+        modeCursor.set_mode(1);
+        size_t          numTokens   = modes->get_lexer().tokenize(modeCursor, modeTokens, 3);
+        
+        report("ModeTokenize", numTokens == 3 && modeTokens[0].length == 5 && modeTokens[1].length == 1 && modeTokens[2].length == 2 && modeTokens[2].symbol == modeTokens[0].symbol && modeTokens[1].symbol != modeTokens[0].symbol);
+    }
+    delete modes;
+    
+    // Terminals from another language are matched in a mode for that language, which the parser switches to
+    wstring         embedDefinition = L"language Sql { keywords { select from } lexer { identifier = /[a-z]+/ } ignore { whitespace = /[ ]+/ } grammar { <Query> = select identifier from identifier } }"
+                                      L"language Template { lexer { text = /[^{}]+/ open = \"{{\" close = \"}}\" } grammar { <Document> = (text | <Query>)* <Query> = open Sql.select Sql.identifier Sql.from Sql.identifier close } }";
+    vector<wstring> embedStart(1, L"<Document>");
+    
+    quiet_console               embedConsole(L"embed.tp");
+    compiler::console_container embedCons(&embedConsole, false);
+    compiled_language*          embed = compiler::language_compiler::compile_language(embedCons, L"embed.tp", embedDefinition, L"Template", embedStart);
+    
+    report("EmbedCompile", embed != NULL && embed->lexer_modes() != NULL);
+    report("EmbedStartMode", embed != NULL && embed->lexer_modes() && embed->lexer_modes()->mode_for_state(0) == 0);
+    report("EmbedParse", embed != NULL && test_mode_parse(*embed, "a {{select x from y}} b", true));
+    report("EmbedHostKeywords", embed != NULL && test_mode_parse(*embed, "select {{select x from y}}{{select a from b}}", true));
+    report("EmbedNeedsModes", embed != NULL && !test_mode_parse(*embed, "a {{select x from y}} b", false));
+    report("EmbedRejects", embed != NULL && !test_mode_parse(*embed, "a {{select x y}} b", true));
+    delete embed;
+    
+    wstring                     missingDefinition = L"language Sql { lexer { identifier = /[a-z]+/ } grammar { <Query> = identifier } } language Template { grammar { <Document> = Sql.where } }";
+    quiet_console               missingConsole(L"missing.tp");
+    compiler::console_container missingCons(&missingConsole, false);
+    
+    report("EmbedMissingTerminal", compiler::language_compiler::compile_language(missingCons, L"missing.tp", missingDefinition, L"Template", embedStart) == NULL);
+    report("EmbedMissingLanguage", compiler::language_compiler::compile_language(missingCons, L"missing.tp", L"language Template { grammar { <Document> = Sql.where } }", L"Template", embedStart) == NULL);
+    
+    report("RuntimeSyntaxError", compiler::language_compiler::compile_language(brokenCons, L"broken.tp", L"language Broken { grammar { <S> = ", L"", runtimeStart) == NULL);
+    
+    // Independent languages and tests can be built in parallel, but should report their results in the same order
+    count_visits visited(100);
+    util::parallel_for(visited.visits.size(), 4, visited);
+    
+    report("ParallelForVisitsOnce", count(visited.visits.begin(), visited.visits.end(), 1) == 100);
+    
+    recording_console           parentConsole(L"buffered.tp", L"");
+    compiler::buffered_console  buffered(parentConsole);
+    
+    buffered.report_error(compiler::error(compiler::error::sev_error, L"buffered.tp", L"FIRST", L"First", position(-1, -1, -1)));
+    buffered.message_stream() << L"message\n";
+    
+    bool heldBack = parentConsole.log.str().empty() && buffered.exit_code() == compiler::error::sev_error;
+    buffered.replay();
+    bool replayed = parentConsole.log.str() == L"message\nerror FIRST: First\n";
+    buffered.report_error(compiler::error(compiler::error::sev_error, L"buffered.tp", L"SECOND", L"Second", position(-1, -1, -1)));
+    
+    report("BufferedConsoleHeld", heldBack);
+    report("BufferedConsoleReplayed", replayed);
+    report("BufferedConsoleForwards", parentConsole.log.str() == L"message\nerror FIRST: First\nerror SECOND: Second\n");
+    
+    // Buffered consoles don't keep the errors that their parent won't show
+    recording_console           suppressingConsole(L"suppressed.tp", L"");
+    suppressingConsole.suppressWarnings = true;
+    compiler::buffered_console  suppressedBuffer(suppressingConsole);
+    
+    suppressedBuffer.report_error(compiler::error(compiler::error::sev_warning, L"suppressed.tp", L"WARNING", L"Warning", position(-1, -1, -1)));
+    suppressedBuffer.report_error(compiler::error(compiler::error::sev_detail, L"suppressed.tp", L"DETAIL", L"Detail", position(-1, -1, -1)));
+    suppressedBuffer.report_error(compiler::error(compiler::error::sev_error, L"suppressed.tp", L"ERROR", L"Error", position(-1, -1, -1)));
+    
+    bool suppressedExitCode = suppressedBuffer.exit_code() == compiler::error::sev_error;
+    suppressedBuffer.replay();
+    
+    report("ShowsErrors", !suppressedBuffer.shows_errors(compiler::error::sev_warning) && suppressedBuffer.shows_errors(compiler::error::sev_detail) && suppressedBuffer.shows_errors(compiler::error::sev_error) && parentConsole.shows_errors(compiler::error::sev_warning));
+    report("BufferedConsoleSuppressed", suppressingConsole.log.str() == L"error DETAIL: Detail\nerror ERROR: Error\n" && suppressedExitCode);
+    
+    // The parser states can be built while the lexer is compiled, as long as the lexer waits before adding weak symbols
+    wstring splitDefinition = L"language Split { lexer { id = /[a-z]+/ } weak keywords { when = \"when\" } grammar { <S> = \"if\" id | when id | id } }";
+    wstring sequentialSplit = build_lexer_and_parser(splitDefinition, L"Split", false);
+    wstring concurrentSplit = build_lexer_and_parser(splitDefinition, L"Split", true);
+    
+    // Sentences can be generated from a language for use as parser benchmarks
+    wstring sentenceDefinition  = L"language Sentence { lexer { id = /[a-z]+/ number = /[0-9]+/ } ignore { whitespace = /[ \\t\\n]+/ } keywords { let } "
+                                  L"grammar { <S> = (let id '=' <E> ';')+ <E> = <T> ('+' <T>)* <T> = id | number | '(' <E> ')' } }";
+    wstring sentence            = generate_sentence(sentenceDefinition, L"Sentence", L"<S>", L"200");
+    
+    report("SentenceGenerated", sentence.find(L"let ") == 0 && sentence.find(L"error") == wstring::npos);
+    report("SentenceSize", count(sentence.begin(), sentence.end(), L' ') + count(sentence.begin(), sentence.end(), L'\n') >= 100);
+    report("SentenceRepeatable", sentence == generate_sentence(sentenceDefinition, L"Sentence", L"<S>", L"200"));
+    report("SentenceUndefinedStart", generate_sentence(sentenceDefinition, L"Sentence", L"<Missing>", L"200").find(L"SENTENCE_UNDEFINED_START") != wstring::npos);
+    
+    report("SplitParserSame", sequentialSplit == concurrentSplit && sequentialSplit.find(L"no ") == wstring::npos && sequentialSplit.find(L"error") == wstring::npos);
+    
+    // The rules are numbered the same way whatever the number of threads used to build the parser
+    wstring numberedDefinition  = L"language Numbered { lexer { id = /[a-z]+/ num = /[0-9]+/ } ignore { whitespace = /[ ]+/ } keywords { if then } "
+                                  L"grammar { <S> = <Statement>* "
+                                  L"<Statement> = <Expr> ';' | if <Expr> then <Statement> | '{' <Statement>* '}' | [=> id '='] <Assign> "
+                                  L"<Assign> = id '=' <Expr> ';' "
+                                  L"<Expr> = <Term> | <Expr> '+' <Term> | <Expr> '-' <Term> "
+                                  L"<Term> = <Factor> | <Term> '*' <Factor> "
+                                  L"<Factor> = id | num | '(' <Expr> ')' | id '(' <Expr> (',' <Expr>)* ')' } }";
+    wstring serialTables        = describe_parser_tables(numberedDefinition, L"Numbered", L"1");
+    wstring threadedTables      = describe_parser_tables(numberedDefinition, L"Numbered", L"4");
+    
+    report("ThreadedTablesSame", serialTables == threadedTables && serialTables.find(L"\nS0:") != wstring::npos && serialTables.find(L"error") == wstring::npos);
+    
+    // Definition files can be kept between compilations, and are parsed again when their text changes
+    compiler::parser_stage::definition_cache    definitions(2);
+    definition_file_container                   cachedDefinition;
+    definition_file_container                   firstDefinition(new definition_file(), true);
+    
+    definitions.store(L"/first.tp", "language First { }", firstDefinition);
+    
+    bool cacheHit       = definitions.find(L"/first.tp", "language First { }", cachedDefinition) && cachedDefinition.item() == firstDefinition.item();
+    bool cacheChanged   = !definitions.find(L"/first.tp", "language First { lexer { } }", cachedDefinition);
+    
+    definitions.store(L"/second.tp", "", firstDefinition);
+    definitions.store(L"/third.tp", "", firstDefinition);
+    
+    report("DefinitionCacheHit", cacheHit);
+    report("DefinitionCacheChanged", cacheChanged);
+    report("DefinitionCacheLimit", !definitions.find(L"/first.tp", "language First { }", cachedDefinition) && definitions.find(L"/third.tp", "", cachedDefinition));
+    
+    wstring parallelDefinition = 
+        L"language First { lexer { a = /a/ } grammar { <S> = a <Missing-First> } } "
+        L"language Second { lexer { b = /b/ } grammar { <S> = b | b <S> } } "
+        L"language Third : Second { grammar { <S> |= <Missing-Third> } } "
+        L"test Second { <S> = \"b\" <S> = \"bb\" <S> != \"bb\" <S> = \"bbb\" <S> = \"a\" } "
+        L"test Third { <S> = \"bbbb\" <S> = \"\" }";
+    
+    wstring sequentialLog   = compile_and_test(parallelDefinition, L"1");
+    wstring parallelLog     = compile_and_test(parallelDefinition, L"4");
+    
+    report("ParallelLanguageErrors", sequentialLog.find(L"Missing-First") != wstring::npos && sequentialLog.find(L"Missing-First") < sequentialLog.find(L"Missing-Third"));
+    report("ParallelTestsFailed", sequentialLog.find(L"Second: 3/5 passed") != wstring::npos);
+    report("ParallelSameOrder", parallelLog == sequentialLog);
+    
+    // Languages that inherit from the same language build on a single compiled copy of it
+    wstring dialectDefinition =
+        L"language Base { lexer { a = /a/ b = /b/ } grammar { <S> = a } } "
+        L"language One : Base { grammar { <S> |= b } } "
+        L"language Two : Base { grammar { <S> |= b b } } "
+        L"language Three : Two { grammar { <S> |= a b } } "
+        L"language Other { lexer { c = /c/ } grammar { <S> = c } }";
+    const wchar_t* dialects[] = { L"Base", L"One", L"Two", L"Three", L"Other", NULL };
+    
+    wstring sequentialDialects  = build_dialects(dialectDefinition, L"1", dialects);
+    wstring parallelDialects    = build_dialects(dialectDefinition, L"4", dialects);
+    
+    report("InheritedRules", sequentialDialects == L"Base:1/1 One:2/1 Two:2/1 Three:3/1 Other:1/1 ");
+    report("InheritedParallel", parallelDialects == sequentialDialects);
+    
+    wstring timingLog       = compile_and_test(parallelDefinition, L"4", true);
+    
+    report("TestTimingHidden", sequentialLog.find(L"lexemes") == wstring::npos);
+    report("TestTimingLexemes", timingLog.find(L"Second.<S>.4") != wstring::npos && timingLog.find(L" 3 lexemes ", timingLog.find(L"Second.<S>.4")) != wstring::npos);
+    report("TestTimingSlowest", timingLog.find(L"Slowest test: Second.") != wstring::npos);
+    
+    wstring throughputLog   = compile_and_test(parallelDefinition, L"4", false, NULL, L"20");
+    
+    report("TestThroughputHidden", sequentialLog.find(L"throughput") == wstring::npos);
+    report("TestThroughputSummary", throughputLog.find(L"Second throughput: ") != wstring::npos && throughputLog.find(L"bytes/s", throughputLog.find(L"Second throughput: ")) != wstring::npos);
+    report("TestThroughputLookahead", throughputLog.find(L"peak lookahead 0") != wstring::npos);
+    report("TestThroughputSameResults", throughputLog.find(L"Second: 3/5 passed") != wstring::npos);
+    
+    // A UTF-8 lexer matches bytes, so tests with characters outside ASCII should be encoded before they're lexed
+    wstring utf8Definition =
+        L"language Utf { lexer { word = /[a-z\x00e9\x20ac]+/ } grammar { <S> = word } } "
+        L"test Utf { <S> = \"caf\x00e9\" <S> = \"\x20ac\" <S> != \"caf\x00e9 \x20ac\" }";
+    
+    wstring characterLog    = compile_and_test(utf8Definition, L"1");
+    wstring utf8Log         = compile_and_test(utf8Definition, L"1", false, NULL, L"", true);
+    wstring utf8Throughput  = compile_and_test(utf8Definition, L"1", false, NULL, L"1", true);
+    
+    report("TestCharacterLexer", characterLog.find(L"Utf: 3/3 passed") != wstring::npos);
+    report("TestUtf8Lexer", utf8Log.find(L"Utf: 3/3 passed") != wstring::npos);
+    report("TestUtf8Throughput", utf8Throughput.find(L"Utf: 3/3 passed") != wstring::npos && utf8Throughput.find(L"Utf throughput: ") != wstring::npos);
+    
+    vector<compiler::stage_profile> sequentialProfiles;
+    vector<compiler::stage_profile> parallelProfiles;
+    compile_and_test(parallelDefinition, L"1", false, &sequentialProfiles);
+    compile_and_test(parallelDefinition, L"4", false, &parallelProfiles);
+    
+    const compiler::stage_profile* secondLexer  = find_profile(parallelProfiles, L"lexer", L"Second");
+    const compiler::stage_profile* secondParser = find_profile(parallelProfiles, L"lr_parser", L"Second");
+    
+    report("ProfileStages", find_profile(parallelProfiles, L"import", L"") && find_profile(parallelProfiles, L"language", L"Third") && find_profile(parallelProfiles, L"tests", L""));
+    report("ProfileSameOrder", !sequentialProfiles.empty() && profile_order(sequentialProfiles) == profile_order(parallelProfiles));
+    report("ProfileLexerCounters", find_counter(secondLexer, L"ndfa_states") > 0 && find_counter(secondLexer, L"dfa_states") > 0 && find_counter(secondLexer, L"symbol_classes") > 0);
+    report("ProfileParserCounters", find_counter(secondParser, L"lr0_states") > 0 && find_counter(secondParser, L"propagation_edges") >= 0 && find_counter(secondParser, L"conflicts") == 0);
+    report("ProfileRewriterTimings", secondParser && !secondParser->timings().empty() && secondParser->timings().front().first == L"rewriter.weak_symbols");
+    report("ProfileLexerPhases", has_timing(secondLexer, L"phase.subset_construction") && has_timing(secondLexer, L"phase.compact_dfa"));
+    report("ProfileParserPhases", has_timing(secondParser, L"phase.lr0_states") && has_timing(secondParser, L"phase.lookaheads") && has_timing(secondParser, L"phase.conflicts"));
+    
+    compiler::stage_profile jsonProfile(L"lexer", L"a\"b.tp", wstring(L"L") + (wchar_t) 0xe9);
+    jsonProfile.add_counter(L"dfa_states", 12);
+    jsonProfile.add_timing(L"rewriter.x", 0.5);
+    
+    vector<compiler::stage_profile> jsonProfiles(1, jsonProfile);
+    stringstream json;
+    compiler::stage_profile::write_json(json, jsonProfiles);
+    
+    report("ProfileJson", json.str() == 
+        "{\n  \"stages\": [\n    {\n      \"stage\": \"lexer\",\n      \"file\": \"a\\\"b.tp\",\n      \"language\": \"L\\u00e9\",\n"
+        "      \"seconds\": 0.000000,\n      \"peak_memory\": -1,\n      \"counters\": {\n        \"dfa_states\": 12\n      },\n"
+        "      \"timings\": {\n        \"rewriter.x\": 0.500000\n      }\n    }\n  ]\n}\n");
+    
+    // Parser profiles should read back the frequencies that were written
+    compiler::parser_profile_stage::frequency_map writtenFrequencies;
+    compiler::parser_profile_stage::frequency_map readFrequencies;
+    writtenFrequencies[3]   = 12;
+    writtenFrequencies[7]   = 1;
+    readFrequencies[3]      = 1;
+    
+    stringstream profileText;
+    compiler::parser_profile_stage::write_profile(profileText, writtenFrequencies);
+    
+    stringstream invalidProfile("# TameParse parser profile\n3 x\n");
+    stringstream noHeaderProfile("3 12\n");
+    
+    report("ParserProfileRead", compiler::parser_profile_stage::read_profile(profileText, readFrequencies) && readFrequencies.size() == 2 && readFrequencies[3] == 13 && readFrequencies[7] == 1);
+    report("ParserProfileInvalid", !compiler::parser_profile_stage::read_profile(invalidProfile, readFrequencies) && !compiler::parser_profile_stage::read_profile(noHeaderProfile, readFrequencies) && readFrequencies[3] == 13);
+    
+#if __cplusplus >= 201103L
+    // ... on a background thread, and swapped while sessions are using them
+    typedef compiler::language_compiler::language_ptr language_ptr;
+    
+    quiet_console           backgroundConsole(L"background.tp");
+    future<language_ptr>    background      = compiler::language_compiler::compile_in_background(backgroundConsole, L"background.tp", L"language Swapped { lexer { a = /a/ b = /b/ } grammar { <S> = b <S> | a } }", L"", runtimeStart);
+    
+    quiet_console               firstConsole(L"runtime.tp");
+    compiler::console_container firstCons(&firstConsole, false);
+    compiler::live_language     live;
+    
+    report("LiveEmpty", !live.current());
+    live.replace(compiler::language_compiler::compile_shared(firstCons, L"runtime.tp", runtimeDefinition, L"", runtimeStart));
+    
+    language_ptr session    = live.current();
+    language_ptr swapped    = background.get();
+    language_ptr previous   = live.replace(swapped);
+    
+    report("BackgroundCompile", swapped != NULL);
+    report("LiveReplaced", previous == session && live.current() == swapped);
+    report("LiveSessionKept", session && test_runtime_parse(*session, "aab") && !test_runtime_parse(*session, "bba"));
+    report("LiveNewSession", live.current() && test_runtime_parse(*live.current(), "bba") && !test_runtime_parse(*live.current(), "aab"));
+#endif
 }
@@ -25,17 +25,39 @@
 //  IN THE SOFTWARE.
 //
 
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <sstream>
+#include <fstream>
+#include <queue>
 
 #include "lr_lalr_general.h"
 
 #include "TameParse/Dfa/character_lexer.h"
+#include "TameParse/Dfa/lexeme_interner.h"
+#include "TameParse/Dfa/ndfa_regex.h"
+#include "TameParse/Dfa/binary_lexer.h"
 #include "TameParse/ContextFree/grammar.h"
+#include "TameParse/ContextFree/alternative_inliner.h"
 #include "TameParse/Lr/lalr_builder.h"
 #include "TameParse/Lr/parser.h"
+#include "TameParse/Lr/compact_parser_tables.h"
+#include "TameParse/Lr/counting_parser_trace.h"
+#include "TameParse/Lr/replicated_language.h"
+#include "TameParse/Lr/language_registry.h"
+#include "TameParse/Lr/profiling_parser_trace.h"
 #include "TameParse/Lr/conflict.h"
+#include "TameParse/Lr/unit_rule_rewriter.h"
+#include "TameParse/Lr/guard_resolver.h"
 #include "TameParse/Language/formatter.h"
+#include "TameParse/Util/stopwatch.h"
+
+#if __cplusplus >= 201103L
+#include <thread>
+#endif
 
 using namespace std;
 using namespace dfa;
@@ -213,6 +235,311 @@ static bool state_comparison_always_reversible(lalr_machine& m) {
     return true;
 }
 
+static bool same_lookaheads(const lalr_machine& a, const lalr_machine& b) {
+    // Machines built with different lookahead algorithms should be identical
+    if (a.count_states() != b.count_states()) return false;
+    
+    for (int stateId = 0; stateId < a.count_states(); ++stateId) {
+        const lalr_state& stateA = *a.state_with_id(stateId);
+        const lalr_state& stateB = *b.state_with_id(stateId);
+        
+        if (stateA != stateB) return false;
+        
+        for (int itemId = 0; itemId < stateA.count_items(); ++itemId) {
+            if (stateA.lookahead_for(itemId) != stateB.lookahead_for(itemId)) {
+                wcerr << L"Lookahead differs for item " << itemId << L" in state " << stateId << endl;
+                return false;
+            }
+        }
+    }
+    
+    return true;
+}
+
+static bool same_machine(const lalr_builder& a, const lalr_builder& b) {
+    // Builders for different grammars have to be compared through their transitions and actions, as their items are
+    // numbered differently
+    if (a.count_states() != b.count_states()) return false;
+    
+    for (int stateId = 0; stateId < a.count_states(); ++stateId) {
+        if (a.machine().transitions_for_state(stateId) != b.machine().transitions_for_state(stateId)) {
+            wcerr << L"Transitions differ for state " << stateId << endl;
+            return false;
+        }
+        
+        const lr_action_set& actionsA = a.actions_for_state(stateId);
+        const lr_action_set& actionsB = b.actions_for_state(stateId);
+        
+        if (actionsA.size() != actionsB.size()) return false;
+        
+        lr_action_set::const_iterator actB = actionsB.begin();
+        for (lr_action_set::const_iterator actA = actionsA.begin(); actA != actionsA.end(); ++actA, ++actB) {
+            if (!(**actA == **actB)) {
+                wcerr << L"Actions differ for state " << stateId << endl;
+                return false;
+            }
+        }
+    }
+    
+    return true;
+}
+
+static bool compact_actions_round_trip(const lalr_builder& builder) {
+    // Converting actions to the compact form and back again should produce the same actions
+    compact_action_list compact;
+    
+    for (int stateId = 0; stateId < builder.count_states(); ++stateId) {
+        const lr_action_set& actions = builder.actions_for_state(stateId);
+        builder.compact_actions_for_state(stateId, compact);
+        
+        if (compact.size() != actions.size()) return false;
+        
+        compact_action_list::const_iterator compactAct = compact.begin();
+        for (lr_action_set::const_iterator act = actions.begin(); act != actions.end(); ++act, ++compactAct) {
+            if (!(*compactAct->to_action(builder.gram()) == **act)) return false;
+            if (compact_action(*compactAct->to_action(builder.gram()), builder.gram()) != *compactAct) return false;
+        }
+    }
+    
+    return true;
+}
+
+static bool closure_cache_matches(const lalr_builder& builder) {
+    // The cached closure for each state should be the same as a freshly generated one
+    for (int stateId = 0; stateId < builder.count_states(); ++stateId) {
+        lr1_item_set generated;
+        lalr_builder::generate_closure(*builder.machine().state_with_id(stateId), generated, &builder.gram());
+        
+        const lr1_item_set& cached = builder.closure_for_state(stateId);
+        if (&cached != &builder.closure_for_state(stateId)) return false;
+        if (cached.size() != generated.size()) return false;
+        
+        lr1_item_set::const_iterator cachedItem = cached.begin();
+        for (lr1_item_set::const_iterator item = generated.begin(); item != generated.end(); ++item, ++cachedItem) {
+            if (**item != **cachedItem) return false;
+        }
+    }
+    
+    return true;
+}
+
+static bool same_actions(const lalr_builder& expected, const lalr_builder& actual) {
+    // Every state should have the same actions, in the same order
+    if (expected.count_states() != actual.count_states()) return false;
+    
+    for (int stateId = 0; stateId < expected.count_states(); ++stateId) {
+        const lr_action_set& expectedActions    = expected.actions_for_state(stateId);
+        const lr_action_set& actualActions      = actual.actions_for_state(stateId);
+        if (expectedActions.size() != actualActions.size()) return false;
+        
+        lr_action_set::const_iterator actualAction = actualActions.begin();
+        for (lr_action_set::const_iterator expectedAction = expectedActions.begin(); expectedAction != expectedActions.end(); ++expectedAction, ++actualAction) {
+            if (!(**expectedAction == **actualAction)) return false;
+        }
+    }
+    
+    return true;
+}
+
+static bool same_conflicts(const conflict_list& expected, const conflict_list& actual) {
+    // The same conflicts should be found in the same order
+    if (expected.size() != actual.size()) return false;
+    
+    for (size_t conflictNum = 0; conflictNum < expected.size(); ++conflictNum) {
+        if (*expected[conflictNum] < *actual[conflictNum] || *actual[conflictNum] < *expected[conflictNum]) return false;
+    }
+    
+    return true;
+}
+
+/// \brief Fills in a grammar with guards, repetitions and a LALR conflict, and returns the identifier of the nonterminal to start from
+///
+/// The builders for each copy of this grammar should be the first thing to number its rules and items
+static int build_numbered_grammar(grammar& gram, terminal_dictionary& terms) {
+    terminal a(terms.add_symbol(L"'a'"));
+    terminal b(terms.add_symbol(L"'b'"));
+    terminal c(terms.add_symbol(L"'c'"));
+    terminal d(terms.add_symbol(L"'d'"));
+    terminal e(terms.add_symbol(L"'e'"));
+    
+    nonterminal start(gram.id_for_nonterminal(L"<Start>"));
+    nonterminal matchingBs(gram.id_for_nonterminal(L"<Matching-Bs>"));
+    nonterminal matchingCs(gram.id_for_nonterminal(L"<Matching-Cs>"));
+    nonterminal conflictE(gram.id_for_nonterminal(L"<E>"));
+    nonterminal conflictF(gram.id_for_nonterminal(L"<F>"));
+    
+    ebnf_repeating someBs;
+    (*someBs.get_rule()) << b;
+    
+    guard matchBguard;
+    (*matchBguard.get_rule()) << matchingBs << c;
+    
+    (gram += L"<Matching-Bs>") << a << matchingBs << b;
+    (gram += L"<Matching-Bs>") << a << b;
+    (gram += L"<Matching-Cs>") << a << matchingCs << c;
+    (gram += L"<Matching-Cs>") << a << someBs << c;
+    
+    (gram += L"<Start>") << matchBguard << matchingCs;
+    (gram += L"<Start>") << d << conflictE << c;
+    (gram += L"<Start>") << d << conflictF << d;
+    (gram += L"<Start>") << e << conflictF << c;
+    (gram += L"<Start>") << e << conflictE << d;
+    (gram += L"<E>") << e;
+    (gram += L"<F>") << e;
+    
+    return start.symbol();
+}
+
+/// \brief True if two sets of parser tables have the same rules and actions
+static bool same_tables(const parser_tables& expected, const parser_tables& actual) {
+    if (expected.count_states() != actual.count_states()) return false;
+    if (expected.count_reduce_rules() != actual.count_reduce_rules()) return false;
+    
+    for (int ruleId = 0; ruleId < expected.count_reduce_rules(); ++ruleId) {
+        const parser_tables::reduce_rule& expectedRule  = expected.rule(ruleId);
+        const parser_tables::reduce_rule& actualRule    = actual.rule(ruleId);
+        
+        if (expectedRule.identifier != actualRule.identifier || expectedRule.ruleId != actualRule.ruleId || expectedRule.length != actualRule.length) return false;
+    }
+    
+    for (int stateId = 0; stateId < expected.count_states(); ++stateId) {
+        const parser_tables::action_count& expectedCount    = expected.action_counts()[stateId];
+        const parser_tables::action_count& actualCount      = actual.action_counts()[stateId];
+        if (expectedCount.numTerminals != actualCount.numTerminals || expectedCount.numNonterminals != actualCount.numNonterminals) return false;
+        
+        for (int actionNum = 0; actionNum < expectedCount.numTerminals; ++actionNum) {
+            const parser_tables::action& expectedAction = expected.terminal_actions()[stateId][actionNum];
+            const parser_tables::action& actualAction   = actual.terminal_actions()[stateId][actionNum];
+            if (expectedAction.type != actualAction.type || expectedAction.nextState != actualAction.nextState || expectedAction.symbolId != actualAction.symbolId) return false;
+        }
+        
+        for (int actionNum = 0; actionNum < expectedCount.numNonterminals; ++actionNum) {
+            const parser_tables::action& expectedAction = expected.nonterminal_actions()[stateId][actionNum];
+            const parser_tables::action& actualAction   = actual.nonterminal_actions()[stateId][actionNum];
+            if (expectedAction.type != actualAction.type || expectedAction.nextState != actualAction.nextState || expectedAction.symbolId != actualAction.symbolId) return false;
+        }
+    }
+    
+    return true;
+}
+
+static bool closures_share_buffer(const lalr_builder& builder) {
+    // Closures are expanded into the same buffer for every state, and are correct when a state is revisited
+    if (builder.count_states() < 2) return false;
+    
+    const lr1_item_set* first = &builder.closure_for_state(0);
+    size_t              size  = first->size();
+    
+    if (&builder.closure_for_state(1) != first) return false;
+    if (builder.closure_for_state(0).size() != size) return false;
+    
+    return closure_cache_matches(builder);
+}
+
+/// \brief Finds where a lookahead came from by searching every item in the machine (the original, uncached algorithm)
+static set<lalr_builder::lr_item_id> search_lookahead_source(lalr_builder& builder, int stateId, int itemId, const item_container& lookahead) {
+    typedef lalr_builder::lr_item_id lr_item_id;
+    
+    set<lr_item_id>     result;
+    set<lr_item_id>     visited;
+    queue<lr_item_id>   toProcess;
+    
+    toProcess.push(lr_item_id(stateId, itemId));
+    
+    while (!toProcess.empty()) {
+        lr_item_id next = toProcess.front();
+        toProcess.pop();
+        
+        if (visited.find(next) != visited.end()) continue;
+        visited.insert(next);
+        
+        for (int sourceState = 0; sourceState < builder.count_states(); ++sourceState) {
+            const lalr_state& state = *builder.machine().state_with_id(sourceState);
+            
+            for (int sourceItem = 0; sourceItem < state.count_items(); ++sourceItem) {
+                lr_item_id source(sourceState, sourceItem);
+                
+                const set<lr_item_id>& spontaneous = builder.spontaneous_for_item(sourceState, sourceItem);
+                if (spontaneous.find(next) != spontaneous.end() && builder.lookahead_for_spontaneous(sourceState, sourceItem, next.state_id, next.item_id).contains(lookahead)) {
+                    result.insert(source);
+                }
+                
+                const set<lr_item_id>& propagated = builder.propagations_for_item(sourceState, sourceItem);
+                if (propagated.find(next) != propagated.end() && state.lookahead_for(sourceItem).contains(lookahead)) {
+                    result.insert(source);
+                    toProcess.push(source);
+                }
+            }
+        }
+    }
+    
+    return result;
+}
+
+/// \brief Checks that the cached lookahead sources match a search of the whole machine, and that asking again gives the same result
+static bool lookahead_sources_match(lalr_builder& builder) {
+    typedef lalr_builder::lr_item_id lr_item_id;
+    
+    int numSearched = 0;
+    
+    for (int stateId = 0; stateId < builder.count_states(); ++stateId) {
+        const lalr_state& state = *builder.machine().state_with_id(stateId);
+        
+        for (int itemId = 0; itemId < state.count_items(); ++itemId) {
+            if (!state[itemId]->at_end()) continue;
+            
+            const item_set& lookahead = state.lookahead_for(itemId);
+            for (item_set::const_iterator la = lookahead.begin(); la != lookahead.end(); ++la) {
+                set<lr_item_id> found;
+                set<lr_item_id> foundAgain;
+                
+                builder.find_lookahead_source(stateId, itemId, *la, found);
+                builder.find_lookahead_source(stateId, itemId, *la, foundAgain);
+                
+                if (found != search_lookahead_source(builder, stateId, itemId, *la)) return false;
+                if (found != foundAgain) return false;
+                ++numSearched;
+            }
+        }
+    }
+    
+    return numSearched > 0;
+}
+
+/// \brief Rewriter that removes every action
+class remove_all_actions : public action_rewriter {
+public:
+    virtual void rewrite_actions(int state, lr_action_set& actions, const lalr_builder& builder) const {
+        actions.clear();
+    }
+    
+    virtual action_rewriter* clone() const {
+        return new remove_all_actions();
+    }
+};
+
+static bool copies_are_interned(lalr_machine& m) {
+    // Adding a copy of an existing state should find the original rather than creating a new state
+    bool ok         = true;
+    int  numStates  = m.count_states();
+    
+    for (int stateId = 0; stateId < numStates; ++stateId) {
+        lalr_machine::container copy(new lalr_state(*m.state_with_id(stateId)), true);
+        
+        if (copy->hash() != m.state_with_id(stateId)->hash()) {
+            wcerr << stateId << L" has a different hash to its copy" << endl;
+            ok = false;
+        }
+        
+        if (m.add_state(copy) != stateId) {
+            wcerr << stateId << L" was not found when a copy was added" << endl;
+            ok = false;
+        }
+    }
+    
+    return ok && m.count_states() == numStates;
+}
+
 static bool no_duplicate_states(lalr_machine& m) {
     // State X and state Y can only be the same if they have the same ID
     bool ok = true;
@@ -255,6 +582,312 @@ static bool can_parse(int_string& symbols, simple_parser& p, character_lexer& le
     return result;
 }
 
+// Parses a string with the guards evaluated ahead of time by a speculative_guard_stream
+static bool can_parse_speculative(int_string& symbols, simple_parser& p, character_lexer& lex, const parser_limits& limits = parser_limits(), parser_limit_counters* counters = NULL) {
+    int_stringstream            stream(symbols);
+    speculative_guard_stream*   speculator  = new speculative_guard_stream(lex.create_stream_from(stream), &p.get_tables());
+    simple_parser::state*       state       = p.create_parser(new simple_parser_actions(speculator));
+    
+    state->set_guard_speculator(speculator);
+    state->set_limits(limits);
+    state->set_limit_counters(counters);
+    bool result = state->parse();
+    
+    delete state;
+    return result;
+}
+
+// Reads a string through a speculative_guard_stream, and returns the guard results for each lexeme as a string
+static wstring speculated_guards(int_string& symbols, const parser_tables& tables, character_lexer& lex, int maxLookahead = speculative_guard_stream::c_DefaultMaxLookahead) {
+    typedef speculative_guard_stream::guard_result guard_result;
+    
+    int_stringstream            stream(symbols);
+    speculative_guard_stream    speculator(lex.create_stream_from(stream), &tables, maxLookahead);
+    wstringstream               result;
+    
+    for (;;) {
+        lexeme* lex = NULL;
+        speculator >> lex;
+        if (!lex) break;
+        
+        const guard_result* first;
+        const guard_result* last;
+        if (speculator.results_for(lex, first, last)) {
+            for (const guard_result* guard = first; guard != last; ++guard) {
+                result << (guard->accepted >= 0 ? L"+" : L"-") << guard->length;
+            }
+        }
+        result << L".";
+        
+        delete lex;
+    }
+    
+    return result.str();
+}
+
+/// \brief Gives each symbol in a string the identifier it has after parser_tables::renumber_terminals
+static int_string renumber_symbols(const int_string& symbols, const vector<int>& newIds) {
+    int_string result;
+    for (size_t x=0; x<symbols.size(); ++x) {
+        result += (wchar_t) newIds[symbols[x]];
+    }
+    return result;
+}
+
+/// \brief Copy of a set of parser tables in the compact representation
+class compact_copy {
+public:
+    typedef small_parser_tables::action action;
+    
+    vector<action>                              terminalActions;
+    vector<action>                              nonterminalActions;
+    vector<const action*>                       terminalLists;
+    vector<const action*>                       nonterminalLists;
+    vector<small_parser_tables::action_count>   counts;
+    vector<small_parser_tables::reduce_rule>    rules;
+    vector<action>                              defaultReductions;
+    small_parser_tables*                        tables;
+    
+    static action narrow(const parser_tables::action& act) {
+        action result = { (unsigned short) act.type, (unsigned short) act.nextState, (short) act.symbolId };
+        return result;
+    }
+    
+    explicit compact_copy(const parser_tables& wide) {
+        for (int stateId = 0; stateId < wide.count_states(); ++stateId) {
+            const parser_tables::action_count& count = wide.action_counts()[stateId];
+            small_parser_tables::action_count narrowCount = { (short) count.numTerminals, (short) count.numNonterminals };
+            counts.push_back(narrowCount);
+            
+            for (int x = 0; x < count.numTerminals; ++x)    terminalActions.push_back(narrow(wide.terminal_actions()[stateId][x]));
+            for (int x = 0; x < count.numNonterminals; ++x) nonterminalActions.push_back(narrow(wide.nonterminal_actions()[stateId][x]));
+            defaultReductions.push_back(narrow(wide.default_reductions()[stateId]));
+        }
+        
+        // Actions are only pointed at once the vectors are complete
+        int terminalPos     = 0;
+        int nonterminalPos  = 0;
+        for (int stateId = 0; stateId < wide.count_states(); ++stateId) {
+            terminalLists.push_back(&terminalActions[0] + terminalPos);
+            nonterminalLists.push_back(&nonterminalActions[0] + nonterminalPos);
+            
+            terminalPos     += counts[stateId].numTerminals;
+            nonterminalPos  += counts[stateId].numNonterminals;
+        }
+        
+        for (int ruleId = 0; ruleId < wide.count_reduce_rules(); ++ruleId) {
+            const parser_tables::reduce_rule& rule = wide.rule(ruleId);
+            small_parser_tables::reduce_rule narrowRule = { (short) rule.identifier, (short) rule.ruleId, (short) rule.length };
+            rules.push_back(narrowRule);
+        }
+        
+        tables = new small_parser_tables(wide.count_states(), wide.end_of_input(), wide.end_of_guard(), &terminalLists[0], &nonterminalLists[0], 
+                                         &counts[0], wide.end_of_guard_states(), wide.count_end_of_guards(), wide.count_reduce_rules(), &rules[0], 
+                                         wide.count_weak_to_strong(), wide.weak_to_strong(), &defaultReductions[0], 
+                                         wide.terminal_index(), wide.nonterminal_index(), 0, NULL, 
+                                         wide.count_default_gotos(), wide.default_gotos());
+    }
+    
+    ~compact_copy() {
+        delete tables;
+    }
+};
+
+/// \brief Parser that reads compact tables
+typedef parser<int, simple_parser_actions, no_parser_trace, small_parser_tables> compact_parser;
+
+static bool can_parse_compact(int_string& symbols, compact_parser& p, character_lexer& lex) {
+    int_stringstream stream(symbols);
+    compact_parser::state* state = p.create_parser(new simple_parser_actions(lex.create_stream_from(stream)));
+    
+    bool result = state->parse();
+    
+    delete state;
+    return result;
+}
+
+// Error handler that records the errors that were reported
+class recorded_errors : public parse_error_handler {
+public:
+    vector<parse_error> errors;
+    
+    void syntax_error(const parse_error& error) {
+        errors.push_back(error);
+    }
+};
+
+/// \brief True if two sets of tables expect the same terminals in every state
+static bool same_expected(const parser_tables& a, const parser_tables& b) {
+    if (!a.has_expected_terminals() || !b.has_expected_terminals() || a.count_states() != b.count_states()) return false;
+    
+    for (int stateId = 0; stateId < a.count_states(); ++stateId) {
+        if (a.last_expected(stateId) - a.first_expected(stateId) != b.last_expected(stateId) - b.first_expected(stateId)) return false;
+        if (!equal(a.first_expected(stateId), a.last_expected(stateId), b.first_expected(stateId))) return false;
+    }
+    
+    return true;
+}
+
+/// \brief The terminals expected in the state where an error was found
+static vector<int> expected_for_error(const parser_tables& tables, const parse_error& error) {
+    if (error.state() < 0 || !tables.has_expected_terminals()) return vector<int>();
+    return vector<int>(tables.first_expected(error.state()), tables.last_expected(error.state()));
+}
+
+// Parses a string, recovering from any errors
+static bool can_parse_recovering(int_string& symbols, simple_parser& p, character_lexer& lex, recorded_errors& errors, int validateSymbols = 3) {
+    int_stringstream stream(symbols);
+    simple_parser::state* state = p.create_parser(new simple_parser_actions(lex.create_stream_from(stream)));
+    
+    bool result = state->parse_with_recovery(errors, 3, validateSymbols);
+    
+    delete state;
+    return result;
+}
+
+// Parses a string using the GLR algorithm
+static bool can_parse_glr(int_string& symbols, simple_parser& p, character_lexer& lex) {
+    int_stringstream stream(symbols);
+    simple_parser::state* state = p.create_parser(new simple_parser_actions(lex.create_stream_from(stream)));
+    
+    bool result = state->parse_glr();
+    
+    delete state;
+    return result;
+}
+
+// Parses a string by pushing the symbols into the parser one at a time
+static bool can_parse_pushed(int_string& symbols, simple_parser& p, bool& waitedForInput) {
+    simple_parser::state* state = p.create_push_parser(new simple_parser_actions(NULL));
+    
+    waitedForInput = true;
+    for (size_t x=0; x<symbols.size(); ++x) {
+        // A parser for a string that matches can't finish until the end of input has been signalled
+        if (state->parse_available() != parser_result::need_input) waitedForInput = false;
+        
+        state->push(new lexeme(lexeme::symbols(1, symbols[x]), position((int)x, 0, (int)x), symbols[x]));
+    }
+    
+    state->end_of_input();
+    bool result = state->parse_available() == parser_result::accept;
+    
+    delete state;
+    return result;
+}
+
+#if __cplusplus >= 201103L
+/// \brief Registry loader that loads the same language for every name except 'missing', taking a while over it
+class slow_language_loader : public language_registry::loader {
+private:
+    const string& m_LexerData;
+    const string& m_TablesData;
+    
+public:
+    slow_language_loader(const string& lexerData, const string& tablesData) : m_LexerData(lexerData), m_TablesData(tablesData) { }
+    
+    virtual compiled_language* load(const string& name) {
+        if (name == "missing") return NULL;
+        
+        util::stopwatch waiting;
+        while (waiting.seconds() < 0.01) { }
+        
+        return compiled_language::from_binary(m_LexerData.data(), m_LexerData.size(), m_TablesData.data(), m_TablesData.size());
+    }
+};
+#endif
+
+// Parses a string with a parser that has the specified limits, updating the specified counters
+/// \brief Lexeme stream that takes a while to produce each lexeme
+class slow_lexeme_stream : public lexeme_stream {
+private:
+    lexeme_stream* m_Source;
+    
+public:
+    slow_lexeme_stream(lexeme_stream* source) : m_Source(source) { }
+    virtual ~slow_lexeme_stream() { delete m_Source; }
+    
+    virtual lexeme_stream& operator>>(lexeme*& result) {
+        util::stopwatch waiting;
+        while (waiting.seconds() < 0.002) { }
+        
+        (*m_Source) >> result;
+        return *this;
+    }
+};
+
+/// \brief True if a profile frame or one of its children has the specified kind
+static bool has_frame(const parser_profile::frame& fr, parser_profile::frame_kind kind) {
+    if (fr.kind == kind) return true;
+    for (size_t child = 0; child < fr.children.size(); ++child) {
+        if (has_frame(*fr.children[child], kind)) return true;
+    }
+    return false;
+}
+
+static parser_result::result parse_limited(int_string& symbols, simple_parser& p, character_lexer& lex, const parser_limits& limits, parser_limit_counters& counters, bool glr = false) {
+    int_stringstream        stream(symbols);
+    simple_parser::state*   state = p.create_parser(new simple_parser_actions(lex.create_stream_from(stream)));
+    
+    state->set_limits(limits);
+    state->set_limit_counters(&counters);
+    
+    parser_result::result result;
+    if (glr) {
+        result = state->parse_glr() ? parser_result::accept : state->limit_exceeded() ? parser_result::limit_exceeded : parser_result::reject;
+    } else {
+        result = state->parse_available();
+    }
+    
+    delete state;
+    return result;
+}
+
+// Parses a string with a parser that keeps its stack and lookahead in fixed storage of the specified sizes
+static parser_result::result parse_bounded(int_string& symbols, simple_parser& p, character_lexer& lex, int stackCapacity, int lookaheadCapacity, bool& overflowed) {
+    simple_parser::stack::storage       stackStorage(stackCapacity);
+    vector<lexeme_container>            lookaheadStorage(lookaheadCapacity, lexeme_container((lexeme*) NULL, false));
+    
+    int_stringstream        stream(symbols);
+    simple_parser::state*   state = p.create_bounded_parser(new simple_parser_actions(lex.create_stream_from(stream)), stackStorage, &lookaheadStorage[0], lookaheadCapacity);
+    
+    parser_result::result result = state->parse_available();
+    overflowed = state->overflowed();
+    
+    delete state;
+    return result;
+}
+
+// The guards checked by two parser states that parse the same input in one session
+struct shared_guard_checks {
+    bool    accepted;
+    long    firstEvaluated;
+    long    secondEvaluated;
+    size_t  cachedBetween;
+    size_t  cachedAfter;
+};
+
+// Parses the input of a new state with it, and then with a copy of it. The copy starts once the first state has finished,
+// so it checks the same guards at the same positions, and the lookahead can't be trimmed until it moves on.
+static shared_guard_checks parse_shared(simple_parser::state* first) {
+    shared_guard_checks     result;
+    parser_limit_counters   counters;
+    
+    first->set_limit_counters(&counters);
+    simple_parser::state*   second = new simple_parser::state(*first);
+    
+    result.accepted         = first->parse_available() == parser_result::accept;
+    result.firstEvaluated   = counters.guardsEvaluated;
+    result.cachedBetween    = first->count_cached_guards();
+    
+    result.accepted         = second->parse_available() == parser_result::accept && result.accepted;
+    result.secondEvaluated  = counters.guardsEvaluated - result.firstEvaluated;
+    result.cachedAfter      = first->count_cached_guards();
+    
+    delete second;
+    delete first;
+    return result;
+}
+
 void test_lalr_general::run_tests() {
     // Grammar specified in example 4.46 of the dragon book
     grammar             dragon446;
@@ -327,6 +960,59 @@ void test_lalr_general::run_tests() {
     report("NotEqualSimple", (*builder.machine().state_with_id(1)) != (*builder.machine().state_with_id(6)));
     report("NoDuplicateStates", no_duplicate_states(builder.machine()));
     report("StateOrderingWorks", state_comparison_always_reversible(builder.machine()));
+    report("CopiesAreInterned", copies_are_interned(builder.machine()));
+    
+    // The dragon book propagation algorithm should produce the same lookaheads as the digraph algorithm
+    lalr_builder propagateBuilder(dragon446, terms);
+    propagateBuilder.set_lookahead_algorithm(lalr_builder::lookahead_propagate);
+    propagateBuilder.add_initial_state(s);
+    propagateBuilder.complete_parser();
+    
+    report("DigraphLookaheadDefault", builder.get_lookahead_algorithm() == lalr_builder::lookahead_digraph);
+    report("DigraphMatchesPropagation", same_lookaheads(builder.machine(), propagateBuilder.machine()));
+    report("ClosureCacheMatches", closure_cache_matches(propagateBuilder));
+    report("ClosureScratchBuffer", closures_share_buffer(propagateBuilder));
+    report("LookaheadSourceCache", lookahead_sources_match(propagateBuilder));
+    
+    // Changing the rewriters should discard any cached actions
+    bool hadActions = !propagateBuilder.actions_for_state(0).empty();
+    propagateBuilder.add_rewriter(action_rewriter_container(new remove_all_actions(), true));
+    bool removedActions = propagateBuilder.actions_for_state(0).empty();
+    propagateBuilder.set_rewriters(action_rewriter_list());
+    
+    report("RewritersInvalidateActions", hadActions && removedActions && !propagateBuilder.actions_for_state(0).empty());
+    
+    // Generating all of the actions at once should give the same result as generating them one at a time
+    propagateBuilder.clear_caches();
+    propagateBuilder.compute_all_actions();
+    
+    bool sameActions = true;
+    for (int stateId = 0; stateId < builder.count_states(); ++stateId) {
+        if (propagateBuilder.actions_for_state(stateId).size() != builder.actions_for_state(stateId).size()) sameActions = false;
+    }
+    report("ComputeAllActions", sameActions && closure_cache_matches(propagateBuilder));
+    
+    // Adding an item to a state whose hash has already been calculated should change the hash
+    lalr_state                  extendedState(*builder.machine().state_with_id(1));
+    lalr_state::hash_code       originalHash = extendedState.hash();
+    extendedState.add((*builder.machine().state_with_id(6))[0], &dragon446);
+    report("StateHashUpdated", extendedState.hash() != originalHash && extendedState != *builder.machine().state_with_id(1));
+    
+    // Packed items keep the rule identifier and offset, and packed kernels don't depend on the order items are added in
+    const lr0_item& firstItem   = *(*builder.machine().state_with_id(1))[0];
+    const lr0_item& secondItem  = *(*builder.machine().state_with_id(6))[0];
+    
+    report("PackedItem", (int) (firstItem.packed() >> packed_offset_bits) == firstItem.rule()->identifier(dragon446) 
+                         && (int) (firstItem.packed() & ((1 << packed_offset_bits) - 1)) == firstItem.offset());
+    
+    lalr_state reversedState;
+    reversedState.add((*builder.machine().state_with_id(6))[0], &dragon446);
+    for (int itemId = builder.machine().state_with_id(1)->count_items() - 1; itemId >= 0; --itemId) {
+        reversedState.add((*builder.machine().state_with_id(1))[itemId], &dragon446);
+    }
+    
+    report("PackedKernelSorted", extendedState.kernel().size() == 2 && extendedState.kernel()[0] < extendedState.kernel()[1]);
+    report("PackedKernelOrder", reversedState == extendedState && reversedState.hash() == extendedState.hash() && firstItem != secondItem);
     
     // Create a parser for this grammar
     simple_parser p(builder, NULL);
@@ -350,15 +1036,165 @@ void test_lalr_general::run_tests() {
     // Test the parser
     report("Accept1", parse1->parse());
     report("Accept2", parse2->parse());
-
+    
+    // Parsing a deeply nested input should only allocate when the stack needs to grow
+    int_string deepInput;
+    for (int star = 0; star < 10000; ++star) deepInput += timesId;
+    deepInput += idId;
+    
+    int_stringstream        deepStream(deepInput);
+    simple_parser::state*   deepParse   = p.create_parser(new simple_parser_actions(lex.create_stream_from(deepStream)));
+    test_budget             deepBudget;
+    bool                    deepAccept  = deepParse->parse();
+    
+    report("AcceptDeep", deepAccept);
+    report_allocations("DeepParseAllocations", deepBudget, deepInput.size() / 100);
+    delete deepParse;
+
     conflict_list conflicts;
     conflict::find_conflicts(builder, conflicts);
     
     report("NoConflicts1", conflicts.size() == 0);
+    report("CompactActionsRoundTrip", compact_actions_round_trip(builder));
+    
+    // A builder that only keeps the compact actions should produce the same actions and a working parser
+    lalr_builder lowMemory(dragon446, terms);
+    lowMemory.add_initial_state(s);
+    lowMemory.complete_parser();
+    lowMemory.set_keep_actions(false);
+    lowMemory.discard_lookahead_sources();
+    
+    bool sameCompactActions = true;
+    for (int stateId = 0; stateId < builder.count_states(); ++stateId) {
+        compact_action_list expected;
+        compact_action_list discarded;
+        compact_action_list cached;
+        
+        builder.compact_actions_for_state(stateId, expected);
+        lowMemory.compact_actions_for_state(stateId, discarded);
+        lowMemory.compact_actions_for_state(stateId, cached);
+        
+        if (expected != discarded || expected != cached) sameCompactActions = false;
+    }
+    
+    simple_parser   lowMemoryParser(lowMemory, NULL);
+    
+    report("LowMemoryActions", sameCompactActions && lowMemory.count_propagations() == 0);
+    report("LowMemoryParse", can_parse(test2, lowMemoryParser, lex));
 
     delete parse1;
     delete parse2;
     
+    // Rebuilding after a rule has changed should only recalculate the states that depend on it
+    grammar dragonChanged;
+    
+    nonterminal sPrimeChanged(dragonChanged.id_for_nonterminal(L"S'"));
+    nonterminal sChanged(dragonChanged.id_for_nonterminal(L"S"));
+    nonterminal lChanged(dragonChanged.id_for_nonterminal(L"L"));
+    nonterminal rChanged(dragonChanged.id_for_nonterminal(L"R"));
+    
+    // As for the dragon book grammar, except with an extra rule S -> id id
+    (dragonChanged += sPrimeChanged) << sChanged;
+    (dragonChanged += sChanged) << lChanged << equals << rChanged;
+    (dragonChanged += sChanged) << rChanged;
+    (dragonChanged += sChanged) << id << id;
+    (dragonChanged += lChanged) << times << rChanged;
+    (dragonChanged += lChanged) << id;
+    (dragonChanged += rChanged) << lChanged;
+    
+    // States that can't be reused can be expanded on several threads (this is built first, so the grammar caches are empty)
+    lalr_builder threadedIncremental(dragonChanged, terms);
+    threadedIncremental.add_initial_state(sChanged);
+    threadedIncremental.complete_parser(builder, 4);
+    
+    lalr_builder fullChanged(dragonChanged, terms);
+    fullChanged.add_initial_state(sChanged);
+    fullChanged.complete_parser();
+    
+    lalr_builder incrementalChanged(dragonChanged, terms);
+    incrementalChanged.add_initial_state(sChanged);
+    incrementalChanged.complete_parser(builder);
+    
+    report("IncrementalReusesStates", incrementalChanged.count_reused_states() > 0 && incrementalChanged.count_reused_states() < incrementalChanged.count_states());
+    report("IncrementalSameAsFull", same_machine(incrementalChanged, fullChanged));
+    report("FullBuildReusesNothing", fullChanged.count_reused_states() == 0);
+    
+    // An unchanged grammar can reuse everything, and a rebuild can start from an incremental build
+    lalr_builder incrementalUnchanged(dragon446, terms);
+    incrementalUnchanged.add_initial_state(s);
+    incrementalUnchanged.complete_parser(builder);
+    
+    lalr_builder incrementalReverted(dragon446, terms);
+    incrementalReverted.add_initial_state(s);
+    incrementalReverted.complete_parser(incrementalChanged);
+    
+    report("IncrementalUnchanged", incrementalUnchanged.count_reused_states() == builder.count_states() && same_machine(incrementalUnchanged, builder));
+    report("IncrementalReverted", incrementalReverted.count_reused_states() > 0 && same_machine(incrementalReverted, builder));
+    report("ThreadedIncremental", threadedIncremental.count_reused_states() == incrementalChanged.count_reused_states() && same_machine(threadedIncremental, fullChanged));
+    
+    // The incrementally built parser should accept the new rule
+    simple_parser   incrementalParser(incrementalChanged, NULL);
+    int_string      idId2;
+    
+    idId2 += idId;
+    idId2 += idId;
+    
+    report("IncrementalParse1", can_parse(idId2, incrementalParser, lex));
+    report("IncrementalParse2", can_parse(test2, incrementalParser, lex));
+    report("IncrementalOriginalRejects", !can_parse(idId2, p, lex));
+    
+    // Errors can be repaired by deleting or inserting symbols
+    int_string extraEquals;
+    int_string missingId;
+    int_string twoErrors;
+    
+    extraEquals += idId; extraEquals += equalsId; extraEquals += equalsId; extraEquals += idId;
+    missingId   += idId; missingId += equalsId;
+    twoErrors   += idId; twoErrors += equalsId; twoErrors += equalsId; twoErrors += timesId; twoErrors += idId; twoErrors += idId;
+    
+    recorded_errors deletedErrors;
+    recorded_errors insertedErrors;
+    recorded_errors twoErrorsErrors;
+    recorded_errors noErrors;
+    
+    report("RecoverDeleted", can_parse_recovering(extraEquals, p, lex, deletedErrors));
+    report("RecoverDeletedReported", deletedErrors.errors.size() == 1 && deletedErrors.errors[0].repair_type() == parse_error::deleted_symbols && deletedErrors.errors[0].unexpected() == equalsId && deletedErrors.errors[0].pos().offset() == 2);
+    report("RecoverInserted", can_parse_recovering(missingId, p, lex, insertedErrors));
+    report("RecoverInsertedReported", insertedErrors.errors.size() == 1 && insertedErrors.errors[0].repair_type() == parse_error::inserted_symbol && insertedErrors.errors[0].inserted() == idId);
+    report("RecoverAllErrors", can_parse_recovering(twoErrors, p, lex, twoErrorsErrors, 1) && twoErrorsErrors.errors.size() == 2);
+    report("RecoverNoErrors", can_parse_recovering(test2, p, lex, noErrors) && noErrors.errors.empty());
+    
+    // Errors describe the terminals that the parser expected
+    vector<int> expectedRvalue;
+    expectedRvalue.push_back(min(idId, timesId));
+    expectedRvalue.push_back(max(idId, timesId));
+    
+    report("ExpectedAfterEquals", !deletedErrors.errors.empty() && expected_for_error(p.get_tables(), deletedErrors.errors[0]) == expectedRvalue);
+    report("ExpectedAtEndOfInput", !insertedErrors.errors.empty() && expected_for_error(p.get_tables(), insertedErrors.errors[0]) == expectedRvalue);
+    
+    // Shifting 'id' leads to a state that always reduces L -> id, so the two actions can be combined
+    parser_tables*  shiftReduceTables   = new parser_tables(builder, NULL);
+    int             numShiftReduce      = shiftReduceTables->combine_shift_reduce();
+    bool            shiftReduceValid    = true;
+    
+    for (int stateId = 0; stateId < shiftReduceTables->count_states(); ++stateId) {
+        for (int x=0; x<shiftReduceTables->action_counts()[stateId].numTerminals; ++x) {
+            const parser_tables::action& act = shiftReduceTables->terminal_actions()[stateId][x];
+            if (act.type != lr_action::act_shiftreduce) continue;
+            
+            if (!shiftReduceTables->has_default_reduction(act.nextState)) shiftReduceValid = false;
+            else if (shiftReduceTables->rule(shiftReduceTables->default_reduction(act.nextState)->nextState).length <= 0) shiftReduceValid = false;
+        }
+    }
+    
+    simple_parser   shiftReduceParser(shiftReduceTables, true);
+    recorded_errors shiftReduceErrors;
+    
+    report("CombineShiftReduce", numShiftReduce > 0 && shiftReduceValid);
+    report("ShiftReduceAccept", can_parse(test1, shiftReduceParser, lex) && can_parse(test2, shiftReduceParser, lex));
+    report("ShiftReduceRejects", !can_parse(idId2, shiftReduceParser, lex) && !can_parse(missingId, shiftReduceParser, lex));
+    report("ShiftReduceRecovers", can_parse_recovering(extraEquals, shiftReduceParser, lex, shiftReduceErrors) && shiftReduceErrors.errors.size() == 1);
+    
     // Create another parser, this one with a particular type of empty production (accepts arbitrary strings of ids)
     grammar emptyProd;
 
@@ -490,4 +1326,1303 @@ void test_lalr_general::run_tests() {
     // Also test [=> [=> 'd' ] ] 'd'
     // This actually tests two things: do multiple guards in one state work, and do recursive guards work?
     report("ContextSensitiveRecursiveGuards1", can_parse(oneD, simpleCsParser, lex));
+    
+    // Push parsers should give the same results, waiting for input until the end of input is signalled
+    // (Strings that don't match can be rejected before the end of input)
+    bool pushWaited         = false;
+    bool pushRejectWaited   = false;
+    
+    report("PushContextSensitive1", can_parse_pushed(threeOfEach, simpleCsParser, pushWaited));
+    report("PushContextSensitive2", !can_parse_pushed(csDoesntMatch1, simpleCsParser, pushRejectWaited));
+    report("PushWaitsForInput", pushWaited);
+    
+    // A state can be reset to parse several inputs one after another (including after a rejected input)
+    int_stringstream        resetInput1(threeOfEach);
+    simple_parser::state*   resetState  = simpleCsParser.create_parser(new simple_parser_actions(lex.create_stream_from(resetInput1)));
+    bool                    resetFirst  = resetState->parse();
+    
+    int_stringstream resetInput2(csDoesntMatch1);
+    resetState->get_actions()->reset(lex.create_stream_from(resetInput2));
+    resetState->reset();
+    bool resetRejected = !resetState->parse();
+    
+    int_stringstream resetInput3(oneD);
+    resetState->get_actions()->reset(lex.create_stream_from(resetInput3));
+    resetState->reset();
+    bool resetGuarded = resetState->parse();
+    
+    int_stringstream resetInput4(threeOfEach);
+    resetState->reset(new simple_parser_actions(lex.create_stream_from(resetInput4)));
+    bool resetReplaced = resetState->parse();
+    
+    delete resetState;
+    
+    report("ResetFirstParse",   resetFirst);
+    report("ResetRejects",      resetRejected);
+    report("ResetGuards",       resetGuarded);
+    report("ResetNewActions",   resetReplaced);
+    
+    // Parsers with fixed storage should give the same results if the storage is large enough, and stop cleanly if not
+    bool boundedOverflow        = true;
+    bool boundedRejectOverflow  = true;
+    bool lookaheadOverflow      = false;
+    bool stackOverflow          = false;
+    
+    report("BoundedParse",              parse_bounded(threeOfEach, simpleCsParser, lex, 32, 16, boundedOverflow) == parser_result::accept && !boundedOverflow);
+    report("BoundedReject",             parse_bounded(csDoesntMatch1, simpleCsParser, lex, 32, 16, boundedRejectOverflow) == parser_result::reject && !boundedRejectOverflow);
+    report("BoundedLookaheadOverflow",  parse_bounded(threeOfEach, simpleCsParser, lex, 32, 2, lookaheadOverflow) == parser_result::overflow && lookaheadOverflow);
+    report("BoundedStackOverflow",      parse_bounded(threeOfEach, simpleCsParser, lex, 3, 16, stackOverflow) == parser_result::overflow && stackOverflow);
+    
+    // Parsers with limits stop once the input exceeds them, and count how close the input came to them
+    parser_limit_counters unlimitedCounters;
+    parser_limit_counters guardCounters;
+    parser_limit_counters lookaheadCounters;
+    parser_limit_counters glrCounters;
+    
+    report("LimitsNotReached",      parse_limited(threeOfEach, simpleCsParser, lex, parser_limits(), unlimitedCounters) == parser_result::accept);
+    report("LimitCounters",         unlimitedCounters.longestLexeme == 1 && unlimitedCounters.deepestGuardLookahead > 1 && unlimitedCounters.deepestLookahead >= unlimitedCounters.deepestGuardLookahead);
+    report("LimitsLargeEnough",     parse_limited(threeOfEach, simpleCsParser, lex, parser_limits(1, (int) unlimitedCounters.deepestGuardLookahead, (int) unlimitedCounters.deepestLookahead), unlimitedCounters) == parser_result::accept);
+    report("LimitGuardLookahead",   parse_limited(threeOfEach, simpleCsParser, lex, parser_limits(0, 2, 0), guardCounters) == parser_result::limit_exceeded && guardCounters.guardLookaheadExceeded == 1);
+    report("LimitLookahead",        parse_limited(threeOfEach, simpleCsParser, lex, parser_limits(0, 0, 2), lookaheadCounters) == parser_result::limit_exceeded && lookaheadCounters.lookaheadExceeded == 1);
+    report("LimitGlr",              parse_limited(threeOfEach, simpleCsParser, lex, parser_limits(0, 2, 0), glrCounters, true) == parser_result::limit_exceeded);
+    
+    // Long lexemes exceed the limits as soon as they're added to the lookahead
+    parser_limit_counters   lengthCounters;
+    simple_parser::state*   lengthState = simpleCsParser.create_push_parser(new simple_parser_actions(NULL));
+    
+    lengthState->set_limits(parser_limits(4, 0, 0));
+    lengthState->set_limit_counters(&lengthCounters);
+    lengthState->push(new lexeme(lexeme::symbols(5, threeOfEach[0]), position(0, 0, 0), threeOfEach[0]));
+    lengthState->end_of_input();
+    
+    report("LimitLexemeLength",     lengthState->parse_available() == parser_result::limit_exceeded && lengthState->limit_exceeded() && lengthCounters.lexemesTooLong == 1);
+    delete lengthState;
+    
+    // Sessions with an interner intern the lexemes for its symbols as they are read
+    lexeme_interner         interner;
+    int_stringstream        internedStream(threeOfEach);
+    simple_parser::state*   internedState = simpleCsParser.create_parser(new simple_parser_actions(lex.create_stream_from(internedStream)));
+    
+    interner.add_symbol(aId);
+    interner.add_symbol(bId);
+    internedState->set_interner(&interner);
+    
+    bool            internedFirst   = internedState->look().item() && internedState->look()->interned_id() == 0;
+    bool            internedParse   = internedState->parse();
+    vector<int>     aSymbol(1, aId);
+    vector<int>     cSymbol(1, cId);
+    
+    report("InternedParse",     internedParse && internedFirst && internedState->get_interner() == &interner);
+    report("InternedSymbols",   interner.count() == 2 && interner.find(&aSymbol[0], &aSymbol[0] + 1) == 0 && interner.find(&cSymbol[0], &cSymbol[0] + 1) < 0);
+    delete internedState;
+    
+    // The counting trace should count what the parser does without changing the result
+    typedef parser<int, simple_parser_actions, counting_parser_trace> counting_parser;
+    counting_parser countingCsParser(csBuilder, NULL);
+    lexer_counters  lexerCounts;
+    
+    parser_counters::current().reset();
+    int_stringstream            countStream(threeOfEach);
+    counting_parser::state*     countState  = countingCsParser.create_parser(new simple_parser_actions(new counting_lexeme_stream(lex.create_stream_from(countStream), lexerCounts)));
+    bool                        countParsed = countState->parse();
+    delete countState;
+    
+    const parser_counters& counts = parser_counters::current();
+    long ruleReductions = 0;
+    for (size_t ruleId = 0; ruleId < counts.reductionsForRule.size(); ++ruleId) {
+        ruleReductions += counts.reductionsForRule[ruleId];
+    }
+    
+    report("CountingParse", countParsed);
+    report("CountingShifts", counts.shifts >= 9 && counts.rejected == 0);
+    report("CountingReductions", counts.reductions > 0 && ruleReductions == counts.reductions);
+    report("CountingGuards", counts.guardChecks > 0 && counts.guardMatches > 0 && counts.guardMatches <= counts.guardChecks && !counts.guardChecksForState.empty());
+    report("CountingLookahead", counts.maxLookahead >= 6);
+    report("CountingStackDepth", counts.maxStackDepth >= 6 && counts.stackDepth == 1);
+    report("CountingLexemes", lexerCounts.lexemes == 9 && lexerCounts.symbols == 9 && lexerCounts.longestLexeme == 1 && lexerCounts.lexemesForSymbol.size() > (size_t) aId && lexerCounts.lexemesForSymbol[aId] == 3);
+    
+    parser_counters::current().reset();
+    int_stringstream            rejectStream(csDoesntMatch1);
+    counting_parser::state*     rejectState = countingCsParser.create_parser(new simple_parser_actions(lex.create_stream_from(rejectStream)));
+    bool                        rejectParsed = rejectState->parse();
+    delete rejectState;
+    
+    report("CountingRejects", !rejectParsed && parser_counters::current().rejected == 1);
+    
+    // The profiling trace should attribute the time spent in the lexer to the symbols of the parse tree
+    typedef parser<int, simple_parser_actions, profiling_parser_trace> profiling_parser;
+    profiling_parser profilingCsParser(csBuilder, NULL);
+    
+    parser_profile::current().reset();
+    int_stringstream            profileStream(threeOfEach);
+    profiling_parser::state*    profileState    = profilingCsParser.create_parser(new simple_parser_actions(new slow_lexeme_stream(lex.create_stream_from(profileStream))));
+    bool                        profileParsed   = profileState->parse();
+    delete profileState;
+    
+    const parser_profile&   profile = parser_profile::current();
+    stringstream            folded;
+    profile.write_folded(folded, contextSensitive, terms);
+    
+    long    lexMicroseconds = 0;
+    bool    wellFormed      = true;
+    bool    foundRoot       = false;
+    string  line;
+    while (getline(folded, line)) {
+        size_t space = line.rfind(' ');
+        if (space == string::npos || atol(line.c_str() + space + 1) <= 0) wellFormed = false;
+        if (line.find("<Context-Sensitive>;") != string::npos) foundRoot = true;
+        if (space != string::npos && space >= 6 && line.compare(space - 5, 5, "[lex]") == 0) {
+            lexMicroseconds += atol(line.c_str() + space + 1);
+        }
+    }
+    
+    report("ProfileParse", profileParsed);
+    report("ProfileStack", profile.stack().size() == 1 && profile.stack()[0]->kind == parser_profile::nonterminal_frame);
+    report("ProfileTotal", profile.total_time() >= 0.018);
+    report("ProfileFolded", wellFormed && foundRoot);
+    report("ProfileGuards", !profile.stack().empty() && has_frame(*profile.stack()[0], parser_profile::guard_frame));
+    report("ProfileLexing", lexMicroseconds >= 18000);
+    
+    parser_profile::current().reset();
+    report("ProfileReset", profile.stack().empty() && profile.total_time() == 0);
+    
+    // Only the [=> 'd' ] guard is regular: the others match nested structures or contain another guard
+    const parser_tables& csTables = simpleCsParser.get_tables();
+    report("CompiledGuardsRegularOnly", csTables.compiled_guards() != NULL && csTables.compiled_guards()->count_guards() == 1);
+    
+    // Guards over a fixed sequence of terminals are evaluated by a DFA, and should give the same results as the parser
+    grammar tokenGuarded;
+    
+    nonterminal tokenGuardedLan(tokenGuarded.id_for_nonterminal(L"<Token-Guarded>"));
+    nonterminal tokenGuardedAbc(tokenGuarded.id_for_nonterminal(L"<Abc>"));
+    nonterminal tokenGuardedAbd(tokenGuarded.id_for_nonterminal(L"<Abd>"));
+    
+    guard abcGuard;
+    (*abcGuard.get_rule()) << a << b << c;
+    
+    (tokenGuarded += L"<Token-Guarded>") << abcGuard << tokenGuardedAbc;
+    (tokenGuarded += L"<Token-Guarded>") << tokenGuardedAbd;
+    (tokenGuarded += L"<Abc>") << a << b << c;
+    (tokenGuarded += L"<Abd>") << a << b << d;
+    
+    lalr_builder tokenGuardedBuilder(tokenGuarded, terms);
+    tokenGuardedBuilder.add_initial_state(tokenGuardedLan);
+    tokenGuardedBuilder.complete_parser();
+    
+    simple_parser           tokenGuardedParser(tokenGuardedBuilder, NULL);
+    const parser_tables&    tokenGuardedTables = tokenGuardedParser.get_tables();
+    
+    // Hard-coded tables don't compile their guards, so the parser evaluates them
+    parser_tables uncompiledTables(tokenGuardedTables.count_states(), tokenGuardedTables.end_of_input(), tokenGuardedTables.end_of_guard(), 
+                                   tokenGuardedTables.terminal_actions(), tokenGuardedTables.nonterminal_actions(), tokenGuardedTables.action_counts(), 
+                                   tokenGuardedTables.end_of_guard_states(), tokenGuardedTables.count_end_of_guards(), 
+                                   tokenGuardedTables.count_reduce_rules(), tokenGuardedTables.reduce_rules(), 
+                                   tokenGuardedTables.count_weak_to_strong(), tokenGuardedTables.weak_to_strong(), tokenGuardedTables.default_reductions(), 
+                                   NULL, NULL, true, 0, NULL, tokenGuardedTables.count_default_gotos(), tokenGuardedTables.default_gotos());
+    simple_parser uncompiledParser(&uncompiledTables, false);
+    
+    int_string guardAbc; guardAbc += aId; guardAbc += bId; guardAbc += cId;
+    int_string guardAbd; guardAbd += aId; guardAbd += bId; guardAbd += dId;
+    int_string guardAb;  guardAb  += aId; guardAb  += bId;
+    int_string guardAbcd = guardAbc; guardAbcd += dId;
+    
+    bool compiledWaited     = false;
+    bool uncompiledWaited   = false;
+    
+    report("CompiledGuardsFound", tokenGuardedTables.compiled_guards() != NULL && tokenGuardedTables.compiled_guards()->count_guards() == 1 && uncompiledTables.compiled_guards() == NULL);
+    report("CompiledGuardAccepts", can_parse(guardAbc, tokenGuardedParser, lex) && can_parse(guardAbc, uncompiledParser, lex));
+    report("CompiledGuardRejects", can_parse(guardAbd, tokenGuardedParser, lex) && can_parse(guardAbd, uncompiledParser, lex));
+    report("CompiledGuardShortInput", !can_parse(guardAb, tokenGuardedParser, lex) && !can_parse(guardAb, uncompiledParser, lex));
+    report("CompiledGuardLongInput", !can_parse(guardAbcd, tokenGuardedParser, lex) && !can_parse(guardAbcd, uncompiledParser, lex));
+    report("CompiledGuardPushed", can_parse_pushed(guardAbc, tokenGuardedParser, compiledWaited) && can_parse_pushed(guardAbc, uncompiledParser, uncompiledWaited) && compiledWaited == uncompiledWaited);
+    
+    uncompiledTables.compile_guards();
+    report("CompiledGuardsLater", uncompiledTables.compiled_guards() != NULL && uncompiledTables.compiled_guards()->count_guards() == 1 && can_parse(guardAbc, uncompiledParser, lex));
+    
+    // Compiled guards can be evaluated on the lexer thread, and the results should be the same as the parser's
+    report("SpeculativeGuardResults", speculated_guards(guardAbc, tokenGuardedTables, lex) == L"+3..." && speculated_guards(guardAbd, tokenGuardedTables, lex) == L"-3...");
+    report("SpeculativeGuardShortInput", speculated_guards(guardAb, tokenGuardedTables, lex) == L"-3..");
+    report("SpeculativeGuardTooFar", speculated_guards(guardAbc, tokenGuardedTables, lex, 2) == L"...");
+    report("SpeculativeGuardParse", can_parse_speculative(guardAbc, tokenGuardedParser, lex) && can_parse_speculative(guardAbd, tokenGuardedParser, lex) 
+                                    && !can_parse_speculative(guardAb, tokenGuardedParser, lex) && !can_parse_speculative(guardAbcd, tokenGuardedParser, lex));
+    report("SpeculativeGuardLimit", can_parse_speculative(guardAbd, tokenGuardedParser, lex, parser_limits(0, 3, 0)) && !can_parse_speculative(guardAbc, tokenGuardedParser, lex, parser_limits(0, 2, 0)));
+    
+    // The parser only looks up the results, so it never reads ahead for the guard itself
+    parser_limit_counters speculativeCounters;
+    parser_limit_counters parsedCounters;
+    parse_limited(guardAbc, tokenGuardedParser, lex, parser_limits(), parsedCounters);
+    
+    report("SpeculativeGuardLookedUp", can_parse_speculative(guardAbc, tokenGuardedParser, lex, parser_limits(), &speculativeCounters) && speculativeCounters.deepestGuardLookahead == 0 && parsedCounters.deepestGuardLookahead == 3);
+    report("SpeculativeGuardMixed", can_parse_speculative(threeOfEach, simpleCsParser, lex) && !can_parse_speculative(csDoesntMatch1, simpleCsParser, lex) && can_parse_speculative(oneD, simpleCsParser, lex));
+    
+    // Lists of guarded items are longer than a batch
+    grammar guardedList;
+    
+    nonterminal guardedListLan(guardedList.id_for_nonterminal(L"<Guarded-List>"));
+    nonterminal guardedListItem(guardedList.id_for_nonterminal(L"<Token-Guarded>"));
+    nonterminal guardedListAbc(guardedList.id_for_nonterminal(L"<Abc>"));
+    nonterminal guardedListAbd(guardedList.id_for_nonterminal(L"<Abd>"));
+    
+    guard listAbcGuard;
+    (*listAbcGuard.get_rule()) << a << b << c;
+    
+    (guardedList += L"<Guarded-List>") << guardedListItem;
+    (guardedList += L"<Guarded-List>") << guardedListLan << guardedListItem;
+    (guardedList += L"<Token-Guarded>") << listAbcGuard << guardedListAbc;
+    (guardedList += L"<Token-Guarded>") << guardedListAbd;
+    (guardedList += L"<Abc>") << a << b << c;
+    (guardedList += L"<Abd>") << a << b << d;
+    
+    lalr_builder guardedListBuilder(guardedList, terms);
+    guardedListBuilder.add_initial_state(guardedListLan);
+    guardedListBuilder.complete_parser();
+    
+    simple_parser guardedListParser(guardedListBuilder, NULL);
+    
+    int_string longGuardedList;
+    for (int x=0; x<300; ++x) {
+        longGuardedList += guardAbc;
+        longGuardedList += guardAbd;
+    }
+    int_string brokenGuardedList = longGuardedList;
+    brokenGuardedList[1000] = cId;
+    
+    report("SpeculativeGuardLongInput", can_parse_speculative(longGuardedList, guardedListParser, lex) && can_parse(longGuardedList, guardedListParser, lex));
+    report("SpeculativeGuardLongReject", !can_parse_speculative(brokenGuardedList, guardedListParser, lex) && !can_parse(brokenGuardedList, guardedListParser, lex));
+    
+    // A stream that is deleted before it has been read to the end stops its thread
+    int_stringstream unreadStream(longGuardedList);
+    speculative_guard_stream* unread = new speculative_guard_stream(lex.create_stream_from(unreadStream), &guardedListParser.get_tables());
+    lexeme* firstLexeme = NULL;
+    (*unread) >> firstLexeme;
+    delete firstLexeme;
+    delete unread;
+    report("SpeculativeGuardStopped", true);
+    
+    // Guard results are cached in the session, so a second state checking the same guards doesn't evaluate them again
+    int_string abcThenAbd = guardAbc; abcThenAbd += guardAbd;
+    
+    int_stringstream    sharedStream(abcThenAbd);
+    shared_guard_checks shared = parse_shared(guardedListParser.create_parser(new simple_parser_actions(lex.create_stream_from(sharedStream))));
+    
+    report("GuardCacheHit", shared.accepted && shared.firstEvaluated == 2 && shared.secondEvaluated == 0);
+    report("GuardCacheKept", shared.cachedBetween == 2);
+    report("GuardCacheTrimmed", shared.cachedAfter == 0);
+    
+    // Bounded sessions don't cache anything, as the cache would grow
+    simple_parser::stack::storage   sharedStackStorage(32);
+    vector<lexeme_container>        sharedLookaheadStorage(16, lexeme_container((lexeme*) NULL, false));
+    int_stringstream                boundedStream(abcThenAbd);
+    shared_guard_checks             bounded = parse_shared(guardedListParser.create_bounded_parser(new simple_parser_actions(lex.create_stream_from(boundedStream)), sharedStackStorage, &sharedLookaheadStorage[0], 16));
+    
+    report("GuardCacheBounded", bounded.accepted && bounded.firstEvaluated >= shared.firstEvaluated && bounded.secondEvaluated == bounded.firstEvaluated && bounded.cachedBetween == 0);
+    
+    // Reducing a rule that is longer than the guard makes the guard read the parser stack (this only happens if the
+    // tables are invalid), so its result can't be reused by a state with a different stack. The tables have no default
+    // reductions or gotos, so the long rule is only ever reduced while checking whether the guard can end.
+    grammar stackGuarded;
+    
+    nonterminal stackGuardedLan(stackGuarded.id_for_nonterminal(L"<Stack-Guarded>"));
+    nonterminal stackGuardedInGuard(stackGuarded.id_for_nonterminal(L"<In-Guard>"));
+    nonterminal stackGuardedAbc(stackGuarded.id_for_nonterminal(L"<Abc>"));
+    nonterminal stackGuardedAbd(stackGuarded.id_for_nonterminal(L"<Abd>"));
+    
+    guard inGuard;
+    (*inGuard.get_rule()) << stackGuardedInGuard;
+    
+    (stackGuarded += L"<Stack-Guarded>") << inGuard << stackGuardedAbc;
+    (stackGuarded += L"<Stack-Guarded>") << stackGuardedAbd;
+    (stackGuarded += L"<In-Guard>") << a << b << c;
+    (stackGuarded += L"<Abc>") << a << b << c;
+    (stackGuarded += L"<Abd>") << a << b << d;
+    
+    lalr_builder stackGuardedBuilder(stackGuarded, terms);
+    stackGuardedBuilder.add_initial_state(stackGuardedLan);
+    stackGuardedBuilder.complete_parser();
+    
+    simple_parser                           stackGuardedParser(stackGuardedBuilder, NULL);
+    const parser_tables&                    validTables = stackGuardedParser.get_tables();
+    vector<parser_tables::reduce_rule>      longRules(validTables.reduce_rules(), validTables.reduce_rules() + validTables.count_reduce_rules());
+    
+    for (vector<parser_tables::reduce_rule>::iterator rule = longRules.begin(); rule != longRules.end(); ++rule) {
+        if (rule->identifier == stackGuardedInGuard.symbol()) rule->length += 2;
+    }
+    
+    parser_tables longRuleTables(validTables.count_states(), validTables.end_of_input(), validTables.end_of_guard(), 
+                                 validTables.terminal_actions(), validTables.nonterminal_actions(), validTables.action_counts(), 
+                                 validTables.end_of_guard_states(), validTables.count_end_of_guards(), 
+                                 (int) longRules.size(), &longRules[0], 
+                                 validTables.count_weak_to_strong(), validTables.weak_to_strong(), NULL, 
+                                 NULL, NULL, true);
+    simple_parser longRuleParser(&longRuleTables, false);
+    
+    int_stringstream    validStream(guardAbc);
+    int_stringstream    stackStream(guardAbc);
+    shared_guard_checks valid       = parse_shared(stackGuardedParser.create_parser(new simple_parser_actions(lex.create_stream_from(validStream))));
+    shared_guard_checks readsStack  = parse_shared(longRuleParser.create_parser(new simple_parser_actions(lex.create_stream_from(stackStream))));
+    
+    report("GuardCacheValidTables", valid.accepted && valid.firstEvaluated > 0 && valid.secondEvaluated == 0);
+    report("GuardCacheReadsStack", readsStack.firstEvaluated > 0 && readsStack.secondEvaluated == readsStack.firstEvaluated && readsStack.cachedBetween == 0);
+    
+    // The minimal LR(1) construction should split the states that are conflicted in a LALR(1) parser, but only those
+    grammar lr1Only;
+    
+    int eId = terms.add_symbol(L"'e'");
+    terminal e(eId);
+    
+    nonterminal lr1Language(lr1Only.id_for_nonterminal(L"<LR1>"));
+    nonterminal lr1E(lr1Only.id_for_nonterminal(L"<E>"));
+    nonterminal lr1F(lr1Only.id_for_nonterminal(L"<F>"));
+    
+    (lr1Only += lr1Language) << a << lr1E << c;
+    (lr1Only += lr1Language) << a << lr1F << d;
+    (lr1Only += lr1Language) << b << lr1F << c;
+    (lr1Only += lr1Language) << b << lr1E << d;
+    (lr1Only += lr1E) << e;
+    (lr1Only += lr1F) << e;
+    
+    lalr_builder lalrOnlyBuilder(lr1Only, terms);
+    lalrOnlyBuilder.add_initial_state(lr1Language);
+    lalrOnlyBuilder.complete_parser();
+    
+    lalr_builder lr1OnlyBuilder(lr1Only, terms);
+    lr1OnlyBuilder.set_construction_algorithm(lalr_builder::construct_minimal_lr1);
+    lr1OnlyBuilder.add_initial_state(lr1Language);
+    lr1OnlyBuilder.complete_parser();
+    
+    conflicts.clear();
+    conflict::find_conflicts(lalrOnlyBuilder, conflicts);
+    report("LalrOnlyConflicts", conflicts.size() > 0);
+
+    // The states reached by each reduction are traced when they're asked for
+    bool allReduceSources = !conflicts.empty();
+    for (conflict_list::const_iterator conf = conflicts.begin(); conf != conflicts.end(); ++conf) {
+        for (conflict::reduce_iterator reduceItem = (*conf)->first_reduce_item(); reduceItem != (*conf)->last_reduce_item(); ++reduceItem) {
+            if ((*conf)->reduce_states(reduceItem).empty()) allReduceSources = false;
+        }
+    }
+    report("LalrOnlyConflictSources", allReduceSources);
+    
+    // Checking the states on several threads finds the same conflicts, even if only the compact actions are kept
+    lalr_builder threadedConflictBuilder(lr1Only, terms);
+    threadedConflictBuilder.add_initial_state(lr1Language);
+    threadedConflictBuilder.complete_parser();
+    threadedConflictBuilder.set_keep_actions(false);
+    
+    conflict_list serialConflicts;
+    conflict_list threadedConflicts;
+    conflict::find_conflicts(lalrOnlyBuilder, serialConflicts);
+    conflict::find_conflicts(threadedConflictBuilder, threadedConflicts, 4);
+    
+    report("ThreadedConflicts", !threadedConflicts.empty() && same_conflicts(serialConflicts, threadedConflicts));
+    
+    // The conflicts and tables for fresh grammars don't depend on the number of threads used to build the parser
+    grammar                 serialConflictGrammar;
+    terminal_dictionary     serialConflictTerms;
+    nonterminal             serialConflictStart(build_numbered_grammar(serialConflictGrammar, serialConflictTerms));
+    lalr_builder            serialFreshBuilder(serialConflictGrammar, serialConflictTerms);
+    
+    grammar                 threadedConflictGrammar;
+    terminal_dictionary     threadedConflictTerms;
+    nonterminal             threadedConflictStart(build_numbered_grammar(threadedConflictGrammar, threadedConflictTerms));
+    lalr_builder            threadedFreshBuilder(threadedConflictGrammar, threadedConflictTerms);
+    
+    serialFreshBuilder.add_initial_state(serialConflictStart);
+    serialFreshBuilder.complete_parser(1);
+    
+    threadedFreshBuilder.add_initial_state(threadedConflictStart);
+    threadedFreshBuilder.complete_parser(4);
+    
+    conflict_list serialFreshConflicts;
+    conflict_list threadedFreshConflicts;
+    conflict::find_conflicts(serialFreshBuilder, serialFreshConflicts, 1);
+    conflict::find_conflicts(threadedFreshBuilder, threadedFreshConflicts, 4);
+    
+    parser_tables           serialConflictTables(serialFreshBuilder, NULL);
+    parser_tables           threadedConflictTables(threadedFreshBuilder, NULL);
+    
+    report("ThreadedConflictsFreshGrammar", !threadedFreshConflicts.empty() && same_conflicts(serialFreshConflicts, threadedFreshConflicts));
+    report("ThreadedConflictTablesFreshGrammar", same_tables(serialConflictTables, threadedConflictTables));
+    
+    conflicts.clear();
+    conflict::find_conflicts(lr1OnlyBuilder, conflicts);
+    report("MinimalLr1NoConflicts", conflicts.size() == 0);
+    report("MinimalLr1SplitsOneState", lr1OnlyBuilder.count_states() == lalrOnlyBuilder.count_states() + 1);
+    
+    simple_parser lr1OnlyParser(lr1OnlyBuilder, NULL);
+    
+    int_string aec; aec += aId; aec += eId; aec += cId;
+    int_string aed; aed += aId; aed += eId; aed += dId;
+    int_string bec; bec += bId; bec += eId; bec += cId;
+    int_string bed; bed += bId; bed += eId; bed += dId;
+    int_string aee; aee += aId; aee += eId; aee += eId;
+    
+    report("MinimalLr1Parse1", can_parse(aec, lr1OnlyParser, lex));
+    report("MinimalLr1Parse2", can_parse(aed, lr1OnlyParser, lex));
+    report("MinimalLr1Parse3", can_parse(bec, lr1OnlyParser, lex));
+    report("MinimalLr1Parse4", can_parse(bed, lr1OnlyParser, lex));
+    report("MinimalLr1Reject", !can_parse(aee, lr1OnlyParser, lex));
+    
+    // LALR grammars should produce the same machine, and guards should still work
+    lalr_builder minimalDragonBuilder(dragon446, terms);
+    minimalDragonBuilder.set_construction_algorithm(lalr_builder::construct_minimal_lr1);
+    minimalDragonBuilder.add_initial_state(s);
+    minimalDragonBuilder.complete_parser();
+    
+    report("MinimalLr1LalrSize", minimalDragonBuilder.count_states() == builder.count_states());
+    
+    lalr_builder minimalCsBuilder(contextSensitive, terms);
+    minimalCsBuilder.set_construction_algorithm(lalr_builder::construct_minimal_lr1);
+    minimalCsBuilder.add_initial_state(csLan);
+    minimalCsBuilder.complete_parser();
+    
+    simple_parser minimalCsParser(minimalCsBuilder, NULL);
+    
+    report("MinimalLr1ContextSensitive1", can_parse(threeOfEach, minimalCsParser, lex));
+    report("MinimalLr1ContextSensitive2", !can_parse(csDoesntMatch1, minimalCsParser, lex));
+    report("MinimalLr1RecursiveGuards", can_parse(oneD, minimalCsParser, lex));
+    
+    // Inlining alternatives should produce a grammar that accepts the same language with fewer reductions
+    grammar             alternatives;
+    nonterminal         alternativeStart(alternatives.id_for_nonterminal(L"<Alternatives>"));
+    
+    ebnf_alternate aOrB;
+    (*aOrB.get_rule()) << a;
+    (*aOrB.add_rule()) << b;
+    
+    ebnf_alternate cOrD;
+    (*cOrD.get_rule()) << c;
+    (*cOrD.add_rule()) << d;
+    
+    ebnf_repeating manyAOrB;
+    (*manyAOrB.get_rule()) << aOrB;
+    
+    (alternatives += alternativeStart) << manyAOrB << cOrD;
+    
+    alternative_inliner inliner;
+    rule_list           inlinedRules;
+    rule_list&          startRules = alternatives.rules_for_nonterminal(alternativeStart.symbol());
+    
+    for (rule_list::const_iterator startRule = startRules.begin(); startRule != startRules.end(); ++startRule) {
+        inliner.inline_rule(*startRule, inlinedRules);
+    }
+    startRules.swap(inlinedRules);
+    alternatives.clear_caches();
+    
+    const rule_container&   firstInlined    = startRules[0];
+    const ebnf*             inlinedRepeat   = firstInlined->items().empty() ? NULL : firstInlined->items()[0]->cast_ebnf();
+    
+    report("InlineAlternatives", inliner.count_inlined() == 2 && startRules.size() == 2);
+    report("InlineRepeatedAlternatives", inlinedRepeat != NULL && inlinedRepeat->count_rules() == 2 && (*inlinedRepeat->first_rule())->items()[0]->type() == item::terminal);
+    
+    alternative_inliner cappedInliner(1);
+    rule_list           cappedRules;
+    cappedInliner.inline_rule(inlinedRules[0], cappedRules);
+    report("InlineAlternativesCapped", cappedRules.size() == 1 && cappedInliner.count_inlined() == 0);
+    
+    lalr_builder alternativesBuilder(alternatives, terms);
+    alternativesBuilder.add_initial_state(alternativeStart);
+    alternativesBuilder.complete_parser();
+    
+    conflicts.clear();
+    conflict::find_conflicts(alternativesBuilder, conflicts);
+    
+    simple_parser alternativesParser(alternativesBuilder, NULL);
+    
+    int_string abac; abac += aId; abac += bId; abac += aId; abac += cId;
+    int_string bd;   bd += bId; bd += dId;
+    int_string onlyC; onlyC += cId;
+    int_string abab; abab += aId; abab += bId; abab += aId; abab += bId;
+    
+    report("InlineAlternativesNoConflicts", conflicts.size() == 0);
+    report("InlineAlternativesParse1", can_parse(abac, alternativesParser, lex));
+    report("InlineAlternativesParse2", can_parse(bd, alternativesParser, lex));
+    report("InlineAlternativesReject1", !can_parse(onlyC, alternativesParser, lex));
+    report("InlineAlternativesReject2", !can_parse(abab, alternativesParser, lex));
+    
+    // Eliminating unit rules should accept the same language while performing fewer reductions
+    grammar             unitRules;
+    nonterminal         unitExpr(unitRules.id_for_nonterminal(L"<Unit-Expr>"));
+    nonterminal         unitTerm(unitRules.id_for_nonterminal(L"<Unit-Term>"));
+    nonterminal         unitFactor(unitRules.id_for_nonterminal(L"<Unit-Factor>"));
+    
+    (unitRules += unitExpr) << unitExpr << b << unitTerm;
+    (unitRules += unitExpr) << unitTerm;
+    (unitRules += unitTerm) << unitFactor;
+    (unitRules += unitFactor) << a;
+    (unitRules += unitFactor) << c << unitExpr << d;
+    
+    report("UnitRule", unit_rule_rewriter::is_unit_rule(*unitRules.rules_for_nonterminal(unitTerm.symbol())[0]));
+    report("NotUnitRule", !unit_rule_rewriter::is_unit_rule(*unitRules.rules_for_nonterminal(unitFactor.symbol())[0]));
+    
+    lalr_builder withUnitsBuilder(unitRules, terms);
+    withUnitsBuilder.add_initial_state(unitExpr);
+    withUnitsBuilder.complete_parser();
+    
+    lalr_builder noUnitsBuilder(unitRules, terms);
+    noUnitsBuilder.add_rewriter(action_rewriter_container(new unit_rule_rewriter()));
+    noUnitsBuilder.add_initial_state(unitExpr);
+    noUnitsBuilder.complete_parser();
+    
+    counting_parser withUnitsParser(withUnitsBuilder, NULL);
+    counting_parser noUnitsParser(noUnitsBuilder, NULL);
+    simple_parser   noUnitsSimpleParser(noUnitsBuilder, NULL);
+    
+    // a + a + ( a )
+    int_string unitSum;
+    unitSum += aId; unitSum += bId; unitSum += aId; unitSum += bId; unitSum += cId; unitSum += aId; unitSum += dId;
+    
+    int_string unitBadSum;
+    unitBadSum += aId; unitBadSum += bId; unitBadSum += bId;
+    
+    parser_counters::current().reset();
+    int_stringstream            withUnitsStream(unitSum);
+    counting_parser::state*     withUnitsState  = withUnitsParser.create_parser(new simple_parser_actions(lex.create_stream_from(withUnitsStream)));
+    bool                        withUnitsParsed = withUnitsState->parse();
+    long                        withUnitsCount  = parser_counters::current().reductions;
+    delete withUnitsState;
+    
+    parser_counters::current().reset();
+    int_stringstream            noUnitsStream(unitSum);
+    counting_parser::state*     noUnitsState    = noUnitsParser.create_parser(new simple_parser_actions(lex.create_stream_from(noUnitsStream)));
+    bool                        noUnitsParsed   = noUnitsState->parse();
+    long                        noUnitsCount    = parser_counters::current().reductions;
+    delete noUnitsState;
+    
+    conflicts.clear();
+    conflict::find_conflicts(noUnitsBuilder, conflicts);
+    
+    report("UnitRulesNoConflicts", conflicts.size() == 0);
+    report("UnitRulesParse", withUnitsParsed && noUnitsParsed);
+    report("UnitRulesReject", !can_parse(unitBadSum, noUnitsSimpleParser, lex));
+    report("UnitRulesFewerReductions", noUnitsCount < withUnitsCount);
+    
+    // Guards that are decided by their first symbol can be replaced by divert actions
+    grammar             resolvable;
+    nonterminal         resolvableLan(resolvable.id_for_nonterminal(L"<Resolvable>"));
+    nonterminal         resolvableAb(resolvable.id_for_nonterminal(L"<Ab>"));
+    nonterminal         resolvableAc(resolvable.id_for_nonterminal(L"<Ac>"));
+    nonterminal         resolvableDa(resolvable.id_for_nonterminal(L"<Da>"));
+    nonterminal         resolvableDc(resolvable.id_for_nonterminal(L"<Dc>"));
+    
+    guard aGuard;
+    guard daGuard;
+    (*aGuard.get_rule()) << a;
+    (*daGuard.get_rule()) << d << a;
+    
+    (resolvable += resolvableLan) << aGuard << resolvableAb;
+    (resolvable += resolvableLan) << resolvableAc;
+    (resolvable += resolvableLan) << daGuard << resolvableDa;
+    (resolvable += resolvableLan) << resolvableDc;
+    (resolvable += resolvableAb) << a << b;
+    (resolvable += resolvableAc) << a << c;
+    (resolvable += resolvableDa) << d << a;
+    (resolvable += resolvableDc) << d << c;
+    
+    lalr_builder guardedBuilder(resolvable, terms);
+    guardedBuilder.add_initial_state(resolvableLan);
+    guardedBuilder.complete_parser();
+    
+    lalr_builder resolvedBuilder(resolvable, terms);
+    resolvedBuilder.add_rewriter(action_rewriter_container(new guard_resolver()));
+    resolvedBuilder.add_initial_state(resolvableLan);
+    resolvedBuilder.complete_parser();
+    
+    simple_parser   guardedParser(guardedBuilder, NULL);
+    simple_parser   resolvedParser(resolvedBuilder, NULL);
+    counting_parser guardedCounting(guardedBuilder, NULL);
+    counting_parser resolvedCounting(resolvedBuilder, NULL);
+    
+    // The guard on 'a' should be a divert, but the one on 'd' needs the next symbol as well
+    const parser_tables& resolvedTables = resolvedParser.get_tables();
+    bool divertA    = false;
+    bool guardA     = false;
+    bool guardD     = false;
+    
+    for (int stateId = 0; stateId < resolvedTables.count_states(); ++stateId) {
+        for (parser_tables::action_iterator act = resolvedTables.find_terminal(stateId, aId); act != resolvedTables.last_terminal_action(stateId) && act->symbolId == aId; ++act) {
+            if (act->type == lr_action::act_divert) divertA = true;
+            if (act->type == lr_action::act_guard)  guardA  = true;
+        }
+        for (parser_tables::action_iterator act = resolvedTables.find_terminal(stateId, dId); act != resolvedTables.last_terminal_action(stateId) && act->symbolId == dId; ++act) {
+            if (act->type == lr_action::act_guard)  guardD  = true;
+        }
+    }
+    
+    int_string resolveAb; resolveAb += aId; resolveAb += bId;
+    int_string resolveAc; resolveAc += aId; resolveAc += cId;
+    int_string resolveDa; resolveDa += dId; resolveDa += aId;
+    int_string resolveDc; resolveDc += dId; resolveDc += cId;
+    
+    report("ResolvedGuardDiverts", divertA && !guardA && guardD);
+    report("ResolvedGuardAccepts", can_parse(resolveAb, guardedParser, lex) && can_parse(resolveAb, resolvedParser, lex));
+    report("ResolvedGuardRejects", !can_parse(resolveAc, guardedParser, lex) && !can_parse(resolveAc, resolvedParser, lex));
+    report("UnresolvedGuardAccepts", can_parse(resolveDa, resolvedParser, lex) && can_parse(resolveDc, resolvedParser, lex));
+    
+    parser_counters::current().reset();
+    int_stringstream            guardedStream(resolveAb);
+    counting_parser::state*     guardedState    = guardedCounting.create_parser(new simple_parser_actions(lex.create_stream_from(guardedStream)));
+    bool                        guardedParsed   = guardedState->parse();
+    long                        guardedChecks   = parser_counters::current().guardChecks;
+    delete guardedState;
+    
+    parser_counters::current().reset();
+    int_stringstream            resolvedStream(resolveAb);
+    counting_parser::state*     resolvedState   = resolvedCounting.create_parser(new simple_parser_actions(lex.create_stream_from(resolvedStream)));
+    bool                        resolvedParsed  = resolvedState->parse();
+    long                        resolvedChecks  = parser_counters::current().guardChecks;
+    delete resolvedState;
+    
+    report("ResolvedGuardNotChecked", guardedParsed && resolvedParsed && guardedChecks > 0 && resolvedChecks == 0);
+    
+    // Generating the states and actions on several threads gives the same result, and the rewriters still see every state
+    lalr_builder threadedResolvedBuilder(resolvable, terms);
+    threadedResolvedBuilder.add_rewriter(action_rewriter_container(new guard_resolver()));
+    threadedResolvedBuilder.add_initial_state(resolvableLan);
+    threadedResolvedBuilder.complete_parser();
+    threadedResolvedBuilder.compute_all_actions(4);
+    
+    lalr_builder threadedCsBuilder(contextSensitive, terms);
+    threadedCsBuilder.add_initial_state(csLan);
+    threadedCsBuilder.complete_parser(4);
+    threadedCsBuilder.compute_all_actions(4);
+    
+    report("ThreadedActionsResolved", same_actions(resolvedBuilder, threadedResolvedBuilder));
+    report("ThreadedActionsGuarded", same_actions(csBuilder, threadedCsBuilder));
+    report("ThreadedStatesGuarded", same_machine(csBuilder, threadedCsBuilder));
+    
+    // The rules are numbered the same way in fresh grammars whatever the number of threads used to build the parser
+    grammar                 serialActionsGrammar;
+    terminal_dictionary     serialActionsTerms;
+    nonterminal             serialActionsStart(build_numbered_grammar(serialActionsGrammar, serialActionsTerms));
+    lalr_builder            serialActionsBuilder(serialActionsGrammar, serialActionsTerms);
+    
+    grammar                 threadedActionsGrammar;
+    terminal_dictionary     threadedActionsTerms;
+    nonterminal             threadedActionsStart(build_numbered_grammar(threadedActionsGrammar, threadedActionsTerms));
+    lalr_builder            threadedActionsBuilder(threadedActionsGrammar, threadedActionsTerms);
+    
+    serialActionsBuilder.add_initial_state(serialActionsStart);
+    serialActionsBuilder.complete_parser(1);
+    serialActionsBuilder.compute_all_actions(1);
+    
+    threadedActionsBuilder.add_initial_state(threadedActionsStart);
+    threadedActionsBuilder.complete_parser(4);
+    threadedActionsBuilder.compute_all_actions(4);
+    
+    parser_tables           serialActionsTables(serialActionsBuilder, NULL);
+    parser_tables           threadedActionsTables(threadedActionsBuilder, NULL);
+    
+    report("ThreadedActionsFreshGrammar", serialActionsTables.count_reduce_rules() > 0 && same_tables(serialActionsTables, threadedActionsTables));
+    
+    // Indexed tables should find the same actions as the binary search
+    parser_tables  searchTables(csBuilder, NULL, 0);
+    parser_tables* indexedTables = new parser_tables(csBuilder, NULL);
+    
+    report("IndexedByDefault", indexedTables->terminal_index() != NULL && indexedTables->nonterminal_index() != NULL);
+    report("NotIndexed", searchTables.terminal_index() == NULL && searchTables.nonterminal_index() == NULL);
+    
+    bool sameTerminals      = true;
+    bool sameNonterminals   = true;
+    for (int stateId = 0; stateId < searchTables.count_states(); ++stateId) {
+        for (int symbolId = -1; symbolId < 32; ++symbolId) {
+            parser_tables::action_iterator searched = searchTables.find_terminal(stateId, symbolId);
+            parser_tables::action_iterator indexed  = indexedTables->find_terminal(stateId, symbolId);
+            
+            bool searchFound    = searched != searchTables.last_terminal_action(stateId) && searched->symbolId == symbolId;
+            bool indexFound     = indexed != indexedTables->last_terminal_action(stateId);
+            
+            if (searchFound != indexFound) sameTerminals = false;
+            else if (searchFound && (indexed->symbolId != symbolId || indexed->type != searched->type || indexed->nextState != searched->nextState)) sameTerminals = false;
+            
+            searched    = searchTables.find_nonterminal(stateId, symbolId);
+            indexed     = indexedTables->find_nonterminal(stateId, symbolId);
+            
+            searchFound = searched != searchTables.last_nonterminal_action(stateId) && searched->symbolId == symbolId;
+            indexFound  = indexed != indexedTables->last_nonterminal_action(stateId);
+            
+            if (searchFound != indexFound) sameNonterminals = false;
+            else if (searchFound && (indexed->symbolId != symbolId || indexed->type != searched->type || indexed->nextState != searched->nextState)) sameNonterminals = false;
+        }
+    }
+    
+    report("IndexedTerminals", indexedTables->terminal_index() != NULL && sameTerminals);
+    report("IndexedNonterminals", indexedTables->nonterminal_index() != NULL && sameNonterminals);
+    
+    // ... and should parse in the same way
+    simple_parser indexedCsParser(indexedTables, true);
+    
+    report("IndexedContextSensitive1", can_parse(threeOfEach, indexedCsParser, lex));
+    report("IndexedContextSensitive2", !can_parse(csDoesntMatch1, indexedCsParser, lex));
+    report("IndexedContextSensitiveRecursiveGuards1", can_parse(oneD, indexedCsParser, lex));
+    
+    // Indexes that exceed the memory cap shouldn't be built
+    parser_tables cappedTables(csBuilder, NULL, 8);
+    parser_tables rebuiltTables(csBuilder, NULL, 0);
+    
+    report("IndexCapped", cappedTables.terminal_index() == NULL && cappedTables.nonterminal_index() == NULL);
+    report("IndexRebuilt", rebuiltTables.build_index() && rebuiltTables.terminal_index() != NULL);
+    report("IndexRebuiltCapped", !rebuiltTables.build_index(8) && rebuiltTables.terminal_index() == NULL);
+    
+    // Copies of indexed tables keep their index
+    parser_tables copiedTables(*indexedTables);
+    report("IndexedCopy", copiedTables.terminal_index() != NULL && copiedTables.find_terminal(0, aId) - copiedTables.terminal_actions()[0] == indexedTables->find_terminal(0, aId) - indexedTables->terminal_actions()[0]);
+    
+    // Hard-coded tables can refer to an existing index rather than copying it
+    parser_tables sharedTables(indexedTables->count_states(), indexedTables->end_of_input(), indexedTables->end_of_guard(), 
+                               indexedTables->terminal_actions(), indexedTables->nonterminal_actions(), indexedTables->action_counts(), 
+                               indexedTables->end_of_guard_states(), indexedTables->count_end_of_guards(), 
+                               indexedTables->count_reduce_rules(), indexedTables->reduce_rules(), 
+                               indexedTables->count_weak_to_strong(), indexedTables->weak_to_strong(), indexedTables->default_reductions(), 
+                               indexedTables->terminal_index(), indexedTables->nonterminal_index(), false, 0, NULL, 
+                               indexedTables->count_default_gotos(), indexedTables->default_gotos());
+    
+    report("SharedIndex", sharedTables.terminal_index() == indexedTables->terminal_index() && sharedTables.nonterminal_index() == indexedTables->nonterminal_index());
+    report("SharedIndexFind", sharedTables.find_terminal(0, aId) == indexedTables->find_terminal(0, aId));
+    
+    // The flags for each state are compiled with the tables, and give the same results as searching the actions
+    bool sameFlags      = true;
+    bool foundGuard     = false;
+    bool foundAccept    = false;
+    bool foundEog       = false;
+    
+    for (int stateId = 0; stateId < indexedTables->count_states(); ++stateId) {
+        unsigned int flags = indexedTables->state_flags(stateId);
+        
+        if (flags != sharedTables.state_flags(stateId)) sameFlags = false;
+        if (indexedTables->has_end_of_guard(stateId) != sharedTables.has_end_of_guard(stateId)) sameFlags = false;
+        if (((flags & parser_tables::state_default_reduction) != 0) != indexedTables->has_default_reduction(stateId)) sameFlags = false;
+        
+        if (flags & parser_tables::state_guard_actions) foundGuard  = true;
+        if (flags & parser_tables::state_accept)        foundAccept = true;
+        if (flags & parser_tables::state_end_of_guard)  foundEog    = true;
+    }
+    
+    report("StateFlagsCompiled", indexedTables->state_flag_table() != NULL && sharedTables.state_flag_table() == NULL && copiedTables.state_flag_table() != indexedTables->state_flag_table());
+    report("StateFlagsSameAsSearch", sameFlags);
+    report("StateFlagsFound", foundGuard && foundAccept && foundEog);
+    
+    sharedTables.compile_state_flags();
+    report("StateFlagsCompileHardCoded", sharedTables.state_flag_table() != NULL && sharedTables.state_flags(0) == indexedTables->state_flags(0));
+    
+    // Weak symbols are mapped straight to their strong equivalent, or found by searching the ordered table if there is no map
+    parser_tables::symbol_equivalent weakToStrong[] = { { 2, 7 }, { 5, 3 } };
+    parser_tables mappedTables(indexedTables->count_states(), indexedTables->end_of_input(), indexedTables->end_of_guard(), 
+                               indexedTables->terminal_actions(), indexedTables->nonterminal_actions(), indexedTables->action_counts(), 
+                               indexedTables->end_of_guard_states(), indexedTables->count_end_of_guards(), 
+                               indexedTables->count_reduce_rules(), indexedTables->reduce_rules(), 
+                               2, weakToStrong, indexedTables->default_reductions());
+    parser_tables searchedTables(indexedTables->count_states(), indexedTables->end_of_input(), indexedTables->end_of_guard(), 
+                                 indexedTables->terminal_actions(), indexedTables->nonterminal_actions(), indexedTables->action_counts(), 
+                                 indexedTables->end_of_guard_states(), indexedTables->count_end_of_guards(), 
+                                 indexedTables->count_reduce_rules(), indexedTables->reduce_rules(), 
+                                 2, weakToStrong, indexedTables->default_reductions(), NULL, NULL, false);
+    parser_tables copiedMap(mappedTables);
+    
+    report("StrongForWeakMapped", mappedTables.count_strong_for_weak() == 6 && mappedTables.strong_for_weak_table() != NULL && mappedTables.strong_for_weak(2) == 7 && mappedTables.strong_for_weak(5) == 3 && mappedTables.strong_for_weak(4) == 4 && mappedTables.strong_for_weak(9) == 9);
+    report("StrongForWeakSearched", searchedTables.strong_for_weak_table() == NULL && searchedTables.strong_for_weak(2) == 7 && searchedTables.strong_for_weak(5) == 3 && searchedTables.strong_for_weak(4) == 4);
+    report("StrongForWeakCopied", copiedMap.strong_for_weak_table() != mappedTables.strong_for_weak_table() && copiedMap.strong_for_weak(5) == 3);
+    
+    // Compact tables should parse in the same way as the tables they were narrowed from
+    compact_copy    compactTables(*indexedTables);
+    compact_parser  compactCsParser(compactTables.tables, false);
+    
+    report("CompactTablesFit", small_parser_tables::can_represent(*indexedTables));
+    report("CompactActionSize", sizeof(small_parser_tables::action) * 2 == sizeof(parser_tables::action));
+    report("CompactContextSensitive1", can_parse_compact(threeOfEach, compactCsParser, lex));
+    report("CompactContextSensitive2", !can_parse_compact(csDoesntMatch1, compactCsParser, lex));
+    report("CompactContextSensitiveRecursiveGuards1", can_parse_compact(oneD, compactCsParser, lex));
+    
+    // Binary tables should parse in the same way as the tables they were written from
+    stringstream binaryStream;
+    indexedTables->write_binary(binaryStream);
+    
+    string      binaryData = binaryStream.str();
+    vector<int> binaryBuffer(binaryData.size() / sizeof(int) + 1);
+    memcpy(&binaryBuffer[0], binaryData.data(), binaryData.size());
+    
+    parser_tables* binaryTables = parser_tables::from_binary(&binaryBuffer[0], binaryData.size());
+    
+    report("BinaryTablesLoaded", binaryTables != NULL && binaryTables->count_states() == indexedTables->count_states());
+    report("BinaryTablesIndexed", binaryTables != NULL && binaryTables->terminal_index() != NULL && binaryTables->nonterminal_index() != NULL);
+    report("BinaryTablesRefer", binaryTables != NULL && (const void*) binaryTables->action_counts() > (const void*) &binaryBuffer[0] && (const void*) binaryTables->action_counts() < (const void*) (&binaryBuffer[0] + binaryBuffer.size()));
+    report("BinaryTablesTruncated", parser_tables::from_binary(&binaryBuffer[0], binaryData.size() - sizeof(int)) == NULL);
+    report("BinaryTablesExpected", binaryTables != NULL && same_expected(*binaryTables, *indexedTables));
+    
+    if (binaryTables) {
+        simple_parser binaryCsParser(binaryTables, true);
+        
+        report("BinaryContextSensitive1", can_parse(threeOfEach, binaryCsParser, lex));
+        report("BinaryContextSensitive2", !can_parse(csDoesntMatch1, binaryCsParser, lex));
+        report("BinaryContextSensitiveRecursiveGuards1", can_parse(oneD, binaryCsParser, lex));
+    }
+    
+    // Languages loaded from binary tables can be placed in huge pages and copied for each NUMA node
+    ndfa_regex csRegex;
+    csRegex.add_regex(0, "a", accept_action(aId));
+    csRegex.add_regex(0, "b", accept_action(bId));
+    csRegex.add_regex(0, "c", accept_action(cId));
+    csRegex.add_regex(0, "d", accept_action(dId));
+    
+    ndfa*           csUnique    = csRegex.to_ndfa_with_unique_symbols();
+    ndfa*           csDfa       = csUnique->to_dfa();
+    stringstream    csLexerStream;
+    binary_lexer::write_binary(csLexerStream, *csDfa);
+    delete csDfa;
+    delete csUnique;
+    
+    string                  csLexerData = csLexerStream.str();
+    util::placed_memory     placedTables(binaryData.data(), binaryData.size(), true, 0);
+    replicated_language     replicated(csLexerData.data(), csLexerData.size(), binaryData.data(), binaryData.size());
+    replicated_language     invalidReplicated(csLexerData.data(), csLexerData.size() - sizeof(int), binaryData.data(), binaryData.size(), false, false);
+    
+    report("PlacedMemoryCopied", placedTables.size() == binaryData.size() && memcmp(placedTables.begin(), binaryData.data(), binaryData.size()) == 0 && ((size_t) placedTables.begin() % sizeof(int)) == 0);
+    report("ReplicatedLoaded", replicated.is_valid() && replicated.count_replicas() == util::count_numa_nodes() && !invalidReplicated.is_valid());
+    report("ReplicatedLocal", replicated.is_valid() && &replicated.local() == &replicated.replica(util::current_numa_node() < replicated.count_replicas() ? util::current_numa_node() : 0));
+    
+    vector<string> replicatedFiles;
+    for (int fileIndex = 0; fileIndex < 3; ++fileIndex) {
+        stringstream filename;
+        filename << "replicated-parse-" << fileIndex << ".txt";
+        
+        ofstream file(filename.str().c_str());
+        file << (fileIndex == 1 ? "aabbbcc" : "aaabbbccc");
+        
+        replicatedFiles.push_back(filename.str());
+    }
+    
+    compiled_language::result_list replicatedResults;
+    if (replicated.is_valid()) replicated.parse_files(replicatedFiles, replicatedResults, 0, 2);
+    
+    report("ReplicatedParse", replicatedResults.size() == 3 && replicatedResults[0].accepted && !replicatedResults[1].accepted && replicatedResults[2].accepted);
+    
+    for (int fileIndex = 0; fileIndex < 3; ++fileIndex) {
+        remove(replicatedFiles[fileIndex].c_str());
+    }
+    
+#if __cplusplus >= 201103L
+    // Registries load languages once, share them between threads and evict the least recently used ones
+    compiled_language*  sizedLanguage   = compiled_language::from_binary(csLexerData.data(), csLexerData.size(), binaryData.data(), binaryData.size());
+    size_t              languageBytes   = sizedLanguage ? sizedLanguage->memory_usage() : 0;
+    delete sizedLanguage;
+    
+    language_registry               registry(new slow_language_loader(csLexerData, binaryData), languageBytes * 2);
+    language_registry::language_ptr firstA  = registry.get("a");
+    language_registry::language_ptr secondA = registry.get("a");
+    
+    report("RegistryLoad", firstA && firstA == secondA && registry.count_loads() == 1 && registry.memory_usage() == languageBytes);
+    report("RegistryMissing", !registry.get("missing") && !registry.is_loaded("missing") && registry.count_languages() == 1);
+    
+    language_registry::language_ptr languageB = registry.get("b");
+    registry.get("a");
+    registry.get("c");
+    
+    report("RegistryEvict", registry.is_loaded("a") && !registry.is_loaded("b") && registry.is_loaded("c") && registry.memory_usage() <= registry.max_bytes());
+    report("RegistryEvictedHandle", languageB && languageB.use_count() == 1 && languageB->memory_usage() == languageBytes);
+    
+    vector<language_registry::language_ptr> sharedLanguages(4);
+    vector<thread>                          sharedThreads;
+    size_t                                  loadsBefore = registry.count_loads();
+    
+    for (size_t threadNum = 0; threadNum < sharedLanguages.size(); ++threadNum) {
+        sharedThreads.push_back(thread([&registry, &sharedLanguages, threadNum] () { sharedLanguages[threadNum] = registry.get("d"); }));
+    }
+    for (size_t threadNum = 0; threadNum < sharedThreads.size(); ++threadNum) {
+        sharedThreads[threadNum].join();
+    }
+    
+    report("RegistrySharedLoad", registry.count_loads() == loadsBefore + 1 && sharedLanguages[0] && sharedLanguages[0] == sharedLanguages[1] && sharedLanguages[0] == sharedLanguages[2] && sharedLanguages[0] == sharedLanguages[3]);
+    
+    registry.remove("d");
+    registry.set_max_bytes(0);
+    report("RegistryShrink", !registry.is_loaded("d") && registry.count_languages() == 1 && registry.memory_usage() == languageBytes);
+    
+    // The file loader reads the binary lexer and tables written by the compiler
+    {
+        ofstream lexerFile("registry-test.lexer", ios::binary);
+        lexerFile.write(csLexerData.data(), (streamsize) csLexerData.size());
+        ofstream tablesFile("registry-test.tables", ios::binary);
+        tablesFile.write(binaryData.data(), (streamsize) binaryData.size());
+    }
+    
+    language_registry fileRegistry(new language_registry::file_loader("."), languageBytes * 4);
+    report("RegistryFileLoader", fileRegistry.get("registry-test") && !fileRegistry.get("registry-missing"));
+    
+    remove("registry-test.lexer");
+    remove("registry-test.tables");
+#endif
+
+    // Lists of items can be split up and parsed in parallel, with the results in the same order as the items
+    string itemText;
+    for (int itemIndex = 0; itemIndex < 200; ++itemIndex) {
+        itemText += (itemIndex % 3 == 1 ? "aabbbcc\n" : "  aaabbbccc\r\n\n");
+    }
+
+    vector<int>                         itemBuffer(itemText.begin(), itemText.end());
+    line_boundary_scanner               lineScanner;
+    compiled_language::item_result_list itemResults;
+    compiled_language::item_result_list serialItemResults;
+    bool                                itemsInOrder    = true;
+
+    if (replicated.is_valid()) {
+        replicated.replica(0).parse_items(&itemBuffer[0], &itemBuffer[0] + itemBuffer.size(), lineScanner, itemResults, 0, 4);
+        replicated.replica(0).parse_items(&itemBuffer[0], &itemBuffer[0] + itemBuffer.size(), lineScanner, serialItemResults, 0, 1);
+    }
+
+    for (size_t itemIndex = 0; itemIndex < itemResults.size(); ++itemIndex) {
+        const parse_item_result& item = itemResults[itemIndex];
+
+        if (item.accepted != (itemIndex % 3 != 1) || item.accepted != (item.ast.item() != NULL)) itemsInOrder = false;
+        if (item.length != (item.accepted ? 9 : 7)) itemsInOrder = false;
+        if (itemIndex >= serialItemResults.size() || serialItemResults[itemIndex].accepted != item.accepted) itemsInOrder = false;
+    }
+
+    report("ParseItemsSplit", itemResults.size() == 200);
+    report("ParseItemsInOrder", itemsInOrder);
+    report("ParseItemsPositions", itemResults.size() == 200 && itemResults[1].offset == 14 && itemResults[1].position.line() == 2 && itemResults[2].position.line() == 3 && itemResults[2].position.column() == 2);
+    bool tokensParsedTwice = false;
+    if (replicated.is_valid()) {
+        // Items are the same as any other buffer once they're split into tokens
+        token_array         itemTokens(replicated.replica(0).get_lexer(), &itemBuffer[2], &itemBuffer[11]);
+        ast_parser::state*  firstParse  = replicated.replica(0).create_parser(itemTokens);
+        ast_parser::state*  secondParse = replicated.replica(0).create_parser(itemTokens);
+
+        tokensParsedTwice = itemTokens.size() == 9 && firstParse->parse() && secondParse->parse() && secondParse->get_item()->children().size() == firstParse->get_item()->children().size();
+
+        delete firstParse;
+        delete secondParse;
+    }
+    report("TokenArrayLanguage", tokensParsedTwice);
+    report("ParseItemsErrorPosition",itemResults.size() == 200 && !itemResults[1].accepted && itemResults[1].error_position.offset() >= 14 && itemResults[1].error_position.line() == 2);
+    
+    // Copies of binary tables shouldn't depend on the actions in the original data
+    parser_tables* binaryCopySource = parser_tables::from_binary(&binaryBuffer[0], binaryData.size());
+    parser_tables  binaryCopy(*binaryCopySource);
+    delete binaryCopySource;
+    
+    report("BinaryTablesCopy", binaryCopy.find_terminal(0, aId) - binaryCopy.terminal_actions()[0] == indexedTables->find_terminal(0, aId) - indexedTables->terminal_actions()[0]);
+    
+    // States that only reduce a single rule should use a default reduction instead of storing terminal actions
+    int  numDefaultStates   = 0;
+    bool defaultsCompacted  = true;
+    for (int stateId = 0; stateId < searchTables.count_states(); ++stateId) {
+        if (!searchTables.has_default_reduction(stateId)) continue;
+        
+        ++numDefaultStates;
+        if (searchTables.action_counts()[stateId].numTerminals != 0) defaultsCompacted = false;
+        if (searchTables.default_reduction(stateId)->type != lr_action::act_reduce) defaultsCompacted = false;
+    }
+    
+    report("DefaultReductions", numDefaultStates > 0);
+    report("DefaultReductionsCompacted", defaultsCompacted);
+    report("DefaultReductionsCopied", copiedTables.default_reductions() != NULL && copiedTables.has_default_reduction(0) == indexedTables->has_default_reduction(0));
+    
+    // States with identical actions share a single row, and copies of the tables keep the rows shared
+    bool    identicalShared = true;
+    int     numIdentical    = 0;
+    
+    for (int firstState = 0; firstState < indexedTables->count_states(); ++firstState) {
+        for (int secondState = firstState + 1; secondState < indexedTables->count_states(); ++secondState) {
+            int count = indexedTables->action_counts()[firstState].numNonterminals;
+            if (count != indexedTables->action_counts()[secondState].numNonterminals) continue;
+            
+            bool identical = true;
+            for (int x=0; x<count; ++x) {
+                const parser_tables::action& firstAct   = indexedTables->nonterminal_actions()[firstState][x];
+                const parser_tables::action& secondAct  = indexedTables->nonterminal_actions()[secondState][x];
+                
+                if (firstAct.type != secondAct.type || firstAct.nextState != secondAct.nextState || firstAct.symbolId != secondAct.symbolId) identical = false;
+            }
+            if (!identical) continue;
+            
+            ++numIdentical;
+            if (indexedTables->nonterminal_actions()[firstState] != indexedTables->nonterminal_actions()[secondState]) identicalShared = false;
+            if (copiedTables.nonterminal_actions()[firstState] != copiedTables.nonterminal_actions()[secondState]) identicalShared = false;
+        }
+    }
+    
+    report("SharedActionRows", numIdentical > 0 && identicalShared);
+
+    // The most common goto for each nonterminal is only stored as a default
+    bool defaultsRemoved = true;
+    bool gotosFound      = true;
+
+    for (int stateId = 0; stateId < indexedTables->count_states(); ++stateId) {
+        for (int x=0; x<indexedTables->action_counts()[stateId].numNonterminals; ++x) {
+            const parser_tables::action& act = indexedTables->nonterminal_actions()[stateId][x];
+            if (act.type != lr_action::act_goto) continue;
+
+            if (indexedTables->default_goto(act.symbolId) == (int) act.nextState) defaultsRemoved = false;
+            if (indexedTables->goto_state(stateId, act.symbolId) != (int) act.nextState) gotosFound = false;
+        }
+    }
+
+    report("DefaultGotos", indexedTables->count_default_gotos() > 0 && indexedTables->default_gotos() != NULL);
+    report("DefaultGotosRemoved", defaultsRemoved && gotosFound);
+    report("DefaultGotosCopied", copiedTables.default_gotos() != indexedTables->default_gotos() && copiedTables.count_default_gotos() == indexedTables->count_default_gotos());
+    
+    // Tables renumbered by how often the states are used should still parse the same way
+    parser_counters::current().reset();
+    int_stringstream            hotStream(threeOfEach);
+    counting_parser::state*     hotState = countingCsParser.create_parser(new simple_parser_actions(lex.create_stream_from(hotStream)));
+    hotState->parse();
+    delete hotState;
+    
+    parser_counters::count_map  hotStates   = parser_counters::current().statesEntered;
+    int                         hottestId   = -1;
+    for (parser_counters::count_map::const_iterator hot = hotStates.begin(); hot != hotStates.end(); ++hot) {
+        if (hot->first == 0) continue;
+        if (hottestId < 0 || hot->second > hotStates[hottestId]) hottestId = hot->first;
+    }
+    
+    parser_tables*  renumberedTables    = new parser_tables(csBuilder, NULL);
+    vector<int>     hotOrder            = parser_tables::order_states_by_frequency(renumberedTables->count_states(), 1, hotStates);
+    
+    report("CountingStatesEntered", !hotStates.empty() && hottestId > 0);
+    report("HotOrderKeepsInitial", hotOrder.size() == (size_t) renumberedTables->count_states() && hotOrder[0] == 0);
+    report("HotOrderHottestFirst", hottestId > 0 && hotOrder[hottestId] == 1);
+    report("RenumberStates", renumberedTables->renumber_states(hotOrder) && renumberedTables->terminal_index() != NULL);
+    
+    bool sameRenumbered = true;
+    for (int stateId = 0; stateId < searchTables.count_states(); ++stateId) {
+        int newId = hotOrder[stateId];
+        
+        if (renumberedTables->count_actions_for_state(newId) != searchTables.count_actions_for_state(stateId)) sameRenumbered = false;
+        if (renumberedTables->has_default_reduction(newId) != searchTables.has_default_reduction(stateId)) sameRenumbered = false;
+        if (renumberedTables->has_end_of_guard(newId) != searchTables.has_end_of_guard(stateId)) sameRenumbered = false;
+    }
+    report("RenumberedMovesStates", sameRenumbered);
+    
+    simple_parser renumberedCsParser(renumberedTables, true);
+    
+    report("RenumberedContextSensitive1", can_parse(threeOfEach, renumberedCsParser, lex));
+    report("RenumberedContextSensitive2", !can_parse(csDoesntMatch1, renumberedCsParser, lex));
+    report("RenumberedContextSensitiveRecursiveGuards1", can_parse(oneD, renumberedCsParser, lex));
+    
+    // The traversal order needs no profile, and puts the first state that the initial state leads to straight after it
+    parser_tables*  traversalTables = new parser_tables(csBuilder, NULL);
+    vector<int>     traversalOrder  = traversalTables->order_states_by_traversal(1);
+    vector<bool>    traversalUsed(traversalOrder.size(), false);
+    bool            traversalPermutes = traversalOrder.size() == (size_t) traversalTables->count_states() && traversalOrder[0] == 0;
+    
+    for (size_t stateId = 0; traversalPermutes && stateId < traversalOrder.size(); ++stateId) {
+        int newId = traversalOrder[stateId];
+        if (newId < 0 || newId >= (int) traversalOrder.size() || traversalUsed[newId]) traversalPermutes = false;
+        else traversalUsed[newId] = true;
+    }
+    
+    int firstTarget = -1;
+    for (int x=0; firstTarget < 0 && x<traversalTables->action_counts()[0].numTerminals; ++x) {
+        const parser_tables::action& act = traversalTables->terminal_actions()[0][x];
+        if (act.type == lr_action::act_shift || act.type == lr_action::act_shiftstrong || act.type == lr_action::act_guard) firstTarget = act.nextState;
+    }
+    
+    report("TraversalOrderPermutes", traversalPermutes);
+    report("TraversalOrderFollowsShift", traversalPermutes && firstTarget > 0 && traversalOrder[firstTarget] == 1);
+    report("RenumberTraversal", traversalTables->renumber_states(traversalOrder));
+    
+    simple_parser traversalCsParser(traversalTables, true);
+    
+    report("TraversalContextSensitive1", can_parse(threeOfEach, traversalCsParser, lex));
+    report("TraversalContextSensitive2", !can_parse(csDoesntMatch1, traversalCsParser, lex));
+    report("TraversalContextSensitiveRecursiveGuards1", can_parse(oneD, traversalCsParser, lex));
+    
+    // Only permutations of the existing states can be used, and only on tables that own their data
+    parser_tables   notRenumbered(csBuilder, NULL);
+    vector<int>     duplicateOrder(notRenumbered.count_states(), 0);
+    report("RenumberRejectsDuplicates", !notRenumbered.renumber_states(duplicateOrder) && !notRenumbered.renumber_states(vector<int>(1, 0)));
+    
+    parser_tables* binaryRenumbered = parser_tables::from_binary(&binaryBuffer[0], binaryData.size());
+    report("RenumberRejectsBinary", binaryRenumbered != NULL && !binaryRenumbered->renumber_states(hotOrder));
+    delete binaryRenumbered;
+    
+    // Renumbering the terminals gives the ones the grammar uses the lowest identifiers
+    parser_tables*  denseTables = new parser_tables(csBuilder, NULL);
+    vector<int>     denseIds    = parser_tables::order_terminals_by_use(*denseTables, terms.count_symbols());
+    
+    report("DenseTerminalsFirst", denseIds[aId] < 4 && denseIds[bId] < 4 && denseIds[cId] < 4 && denseIds[dId] < 4);
+    report("RenumberTerminals", denseTables->renumber_terminals(denseIds) && denseTables->terminal_index() != NULL);
+    
+    bool denseSorted = true;
+    for (int stateId = 0; stateId < denseTables->count_states(); ++stateId) {
+        const parser_tables::action* row = denseTables->terminal_actions()[stateId];
+        for (int x=0; x<denseTables->action_counts()[stateId].numTerminals; ++x) {
+            if (row[x].symbolId >= 4 || (x > 0 && row[x-1].symbolId > row[x].symbolId)) denseSorted = false;
+        }
+    }
+    report("RenumberedTerminalsDense", denseSorted);
+    
+    simple_parser denseCsParser(denseTables, true);
+    int_string denseThreeOfEach = renumber_symbols(threeOfEach, denseIds);
+    int_string denseDoesntMatch = renumber_symbols(csDoesntMatch1, denseIds);
+    int_string denseOneD        = renumber_symbols(oneD, denseIds);
+    
+    report("DenseContextSensitive1", can_parse(denseThreeOfEach, denseCsParser, lex));
+    report("DenseContextSensitive2", !can_parse(denseDoesntMatch, denseCsParser, lex));
+    report("DenseContextSensitiveRecursiveGuards1", can_parse(denseOneD, denseCsParser, lex));
+    report("DenseRejectsOldIdentifiers", denseIds[aId] == aId || !can_parse(threeOfEach, denseCsParser, lex));
+    
+    // The new identifiers must be a permutation that covers every terminal in the tables
+    vector<int> duplicateTerminals(terms.count_symbols(), 0);
+    report("RenumberTerminalsRejects", !notRenumbered.renumber_terminals(duplicateTerminals) && !notRenumbered.renumber_terminals(vector<int>(1, 0)));
+    
+    // Guards are evaluated in the same way when the shifts that are followed by a reduction are combined
+    parser_tables* csShiftReduce = new parser_tables(csBuilder, NULL);
+    csShiftReduce->compile_guards();
+    
+    report("CombineShiftReduceGuards", csShiftReduce->combine_shift_reduce() > 0 && csShiftReduce->compiled_guards() != NULL);
+    
+    simple_parser shiftReduceCsParser(csShiftReduce, true);
+    
+    report("ShiftReduceContextSensitive1", can_parse(threeOfEach, shiftReduceCsParser, lex));
+    report("ShiftReduceContextSensitive2", !can_parse(csDoesntMatch1, shiftReduceCsParser, lex));
+    report("ShiftReduceContextSensitiveRecursiveGuards1", can_parse(oneD, shiftReduceCsParser, lex));
+    
+    // Items taken from a stack that has no other references are moved out rather than copied
+    typedef parser_stack<lexeme_container> lexeme_stack;
+    
+    lexeme_stack        stack;
+    lexeme_container    stackLexeme(new lexeme(lexeme::symbols(), position(0, 0, 0), aId), true);
+    
+    stack.push(1, stackLexeme);
+    int pushedCount = stackLexeme->reference_count();
+    
+    bool sharedNotUnique;
+    {
+        lexeme_stack        sharedStack(stack);
+        lexeme_container    sharedItem  = sharedStack.take_item();
+        
+        sharedNotUnique = !stack.unique() && !sharedStack.unique() && sharedItem->reference_count() == pushedCount + 1;
+    }
+    
+    report("StackShared", sharedNotUnique);
+    report("StackUnique", stack.unique());
+    
+    lexeme_container takenItem = stack.take_item();
+    stack.pop();
+    
+    report("StackTakeItem", takenItem.item() == stackLexeme.item());
+#if __cplusplus >= 201103L
+    report("StackTakeItemMoves", takenItem->reference_count() == pushedCount);
+#endif
+    
+    // Entries popped from a forked stack are kept; otherwise they're released immediately
+    lexeme_stack        releaseStack;
+    int                 unpushedCount = stackLexeme->reference_count();
+    
+    releaseStack.push(1, stackLexeme);
+    releaseStack.push(2, stackLexeme);
+    
+    bool forkKeeps;
+    {
+        lexeme_stack forked(releaseStack);
+        releaseStack.pop();
+        
+        forkKeeps = stackLexeme->reference_count() == unpushedCount + 2 && forked.state() == 2;
+    }
+    
+    releaseStack.pop();
+    
+    report("StackForkKeepsEntries", forkKeeps);
+    report("StackPopReleases", stackLexeme->reference_count() == unpushedCount + 1);
+    
+    // Stacks with fixed storage refuse pushes once they're full
+    parser_stack<int>::storage  fixedEntries(3);
+    parser_stack<int>           fixedStack(fixedEntries);
+    
+    bool fixedPushed    = fixedStack.push(1, 1) && fixedStack.push(2, 2);
+    bool fixedRefused   = !fixedStack.push(3, 3) && fixedStack.overflowed() && fixedStack.state() == 2;
+    bool fixedReused    = fixedStack.pop() && fixedStack.push(4, 4) && fixedStack.state() == 4 && fixedStack.state_at(-1) == 1;
+    
+    report("StackFixed", fixedPushed && fixedRefused && fixedReused);
+    
+    // Speculative stacks share a scratch vector, and release their space when they're destroyed
+    vector<int>         scratch;
+    speculative_stack   speculative(scratch);
+    
+    speculative.push(1);
+    speculative.push(2);
+    
+    bool copyMatches;
+    {
+        speculative_stack copied(speculative);
+        copied.pop();
+        copied.push(3);
+        
+        copyMatches = copied.size() == 2 && copied.top() == 3 && scratch.size() == 4;
+    }
+    
+    report("SpeculativeStackCopy", copyMatches);
+    report("SpeculativeStackReleased", scratch.size() == 2 && speculative.top() == 2);
+    
+    // Stacks that reach the same states by different routes can be merged
+    lexeme_stack    firstRoute;
+    firstRoute.push(1, stackLexeme);
+    
+    lexeme_stack    secondRoute(firstRoute);
+    firstRoute.push(2, stackLexeme);
+    secondRoute.push(2, lexeme_container());
+    
+    lexeme_stack    otherRoute(firstRoute);
+    otherRoute.pop();
+    otherRoute.push(3, stackLexeme);
+    
+    report("StackSameStates", firstRoute.same_states(secondRoute) && secondRoute.same_states(firstRoute));
+    report("StackDifferentStates", !firstRoute.same_states(otherRoute) && !otherRoute.same_states(stack));
+    
+    // A grammar that needs two symbols of lookahead to decide which reduction to perform
+    grammar             twoLookahead;
+    
+    nonterminal twoStart(twoLookahead.id_for_nonterminal(L"<Two-Lookahead>"));
+    nonterminal aFirst(twoLookahead.id_for_nonterminal(L"<A-First>"));
+    nonterminal aSecond(twoLookahead.id_for_nonterminal(L"<A-Second>"));
+    
+    (twoLookahead += twoStart) << aFirst << b << c;
+    (twoLookahead += twoStart) << aSecond << b << d;
+    (twoLookahead += aFirst) << a;
+    (twoLookahead += aSecond) << a;
+    
+    lalr_builder twoBuilder(twoLookahead, terms);
+    twoBuilder.add_initial_state(twoStart);
+    twoBuilder.complete_parser();
+    
+    simple_parser twoParser(twoBuilder, NULL);
+    
+    int_string abc;
+    int_string abd;
+    int_string abb;
+    
+    abc += aId; abc += bId; abc += cId;
+    abd += aId; abd += bId; abd += dId;
+    abb += aId; abb += bId; abb += bId;
+    
+    report("GlrConflictNeeded", !(can_parse(abc, twoParser, lex) && can_parse(abd, twoParser, lex)));
+    report("GlrConflict1", can_parse_glr(abc, twoParser, lex));
+    report("GlrConflict2", can_parse_glr(abd, twoParser, lex));
+    report("GlrConflictReject", !can_parse_glr(abb, twoParser, lex));
+    
+    // An ambiguous grammar, where the states have to be merged to avoid an explosion in the number of parses
+    grammar             ambiguous;
+    
+    nonterminal ambiguousList(ambiguous.id_for_nonterminal(L"<Ambiguous>"));
+    
+    (ambiguous += ambiguousList) << ambiguousList << ambiguousList;
+    (ambiguous += ambiguousList) << a;
+    
+    lalr_builder ambiguousBuilder(ambiguous, terms);
+    ambiguousBuilder.add_initial_state(ambiguousList);
+    ambiguousBuilder.complete_parser();
+    
+    simple_parser ambiguousParser(ambiguousBuilder, NULL);
+    
+    int_string manyAs;
+    for (int x=0; x<40; ++x) manyAs += aId;
+    
+    report("GlrAmbiguous", can_parse_glr(manyAs, ambiguousParser, lex));
+    report("GlrAmbiguousReject", !can_parse_glr(abc, ambiguousParser, lex));
+    
+    // Grammars without conflicts should parse the same way as they do deterministically
+    report("GlrDeterministic1", can_parse_glr(threeOfEach, simpleCsParser, lex));
+    report("GlrDeterministic2", !can_parse_glr(csDoesntMatch1, simpleCsParser, lex));
+    report("GlrDeterministic3", can_parse_glr(manyIds, emptyParser, lex));
 }
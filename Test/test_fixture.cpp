@@ -25,12 +25,126 @@
 //  IN THE SOFTWARE.
 //
 
+#include <cstdlib>
 #include <iostream>
+#include <new>
+#include <sstream>
+
+#if __cplusplus >= 201103L
+#include <atomic>
+#endif
 
 #include "test_fixture.h"
 
 using namespace std;
 
+#if __cplusplus >= 201103L
+/// \brief The number of allocations made through operator new
+static atomic<long> s_Allocations(0);
+
+/// \brief The number of bytes allocated through operator new
+static atomic<long> s_AllocatedBytes(0);
+#else
+static long s_Allocations       = 0;
+static long s_AllocatedBytes    = 0;
+#endif
+
+// Exception specifications for the replacement operators (dynamic exception specifications were removed in C++17)
+#if __cplusplus >= 201103L
+#define THROWS_BAD_ALLOC
+#define THROWS_NOTHING noexcept
+#else
+#define THROWS_BAD_ALLOC throw(std::bad_alloc)
+#define THROWS_NOTHING throw()
+#endif
+
+/// \brief Allocates memory, counting the allocation
+static void* counted_alloc(size_t size) {
+    ++s_Allocations;
+    s_AllocatedBytes += (long) size;
+    
+    return malloc(size ? size : 1);
+}
+
+void* operator new(size_t size) THROWS_BAD_ALLOC {
+    void* result = counted_alloc(size);
+    if (!result) throw bad_alloc();
+    return result;
+}
+
+void* operator new[](size_t size) THROWS_BAD_ALLOC {
+    void* result = counted_alloc(size);
+    if (!result) throw bad_alloc();
+    return result;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) THROWS_NOTHING {
+    return counted_alloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) THROWS_NOTHING {
+    return counted_alloc(size);
+}
+
+void operator delete(void* mem) THROWS_NOTHING {
+    free(mem);
+}
+
+void operator delete[](void* mem) THROWS_NOTHING {
+    free(mem);
+}
+
+void operator delete(void* mem, const std::nothrow_t&) THROWS_NOTHING {
+    free(mem);
+}
+
+void operator delete[](void* mem, const std::nothrow_t&) THROWS_NOTHING {
+    free(mem);
+}
+
+#if __cplusplus >= 201402L
+// C++14 compilers call these when the size is known, so they have to be replaced along with the unsized versions
+void operator delete(void* mem, size_t) THROWS_NOTHING {
+    operator delete(mem);
+}
+
+void operator delete[](void* mem, size_t) THROWS_NOTHING {
+    operator delete[](mem);
+}
+#endif
+
+/// \brief Creates a budget that starts measuring immediately
+test_budget::test_budget() {
+    restart();
+}
+
+/// \brief Starts measuring again from now
+void test_budget::restart() {
+    m_StartAllocations  = total_allocations();
+    m_StartBytes        = total_bytes();
+    m_Time.restart();
+}
+
+/// \brief The number of allocations made since this started measuring
+long test_budget::allocations() const {
+    return total_allocations() - m_StartAllocations;
+}
+
+/// \brief The number of bytes allocated since this started measuring
+long test_budget::bytes() const {
+    return total_bytes() - m_StartBytes;
+}
+
+/// \brief The total number of allocations made by the test program
+long test_budget::total_allocations() {
+    return s_Allocations;
+}
+
+/// \brief The total number of bytes allocated by the test program
+long test_budget::total_bytes() {
+    return s_AllocatedBytes;
+}
+
 /// \brief Creates a new test fixture with the specified name
 test_fixture::test_fixture(std::string name) 
 : m_Name(name)
@@ -67,6 +181,16 @@ void test_fixture::report_known_failure(std::string test_name, bool result) {
     }
 }
 
+/// \brief Reports on whether a test stayed within an allocation budget
+void test_fixture::report_allocations(std::string test_name, const test_budget& budget, long maxAllocations) {
+    long allocations = budget.allocations();
+    
+    stringstream name;
+    name << test_name << " (" << allocations << "/" << maxAllocations << ")";
+    
+    report(name.str(), allocations <= maxAllocations);
+}
+
 /// \brief Runs this test
 void test_fixture::run() {
     cout << endl << "*** TESTS FROM " << m_Name << endl;
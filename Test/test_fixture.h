@@ -30,6 +30,50 @@
 
 #include <string>
 
+#include "TameParse/Util/stopwatch.h"
+
+///
+/// \brief Measures the heap allocations and the time used by part of a test
+///
+/// The test program replaces the global operator new, so every allocation made through it is counted, including the
+/// ones made by the library and by any other threads. This makes it possible to write tests such as 'lexing N tokens
+/// performs at most N/100 allocations', which fail when a change makes a component allocate more than it used to.
+/// Allocations made directly with malloc are not counted.
+///
+class test_budget {
+private:
+    /// \brief The number of allocations when this started measuring
+    long m_StartAllocations;
+    
+    /// \brief The number of bytes allocated when this started measuring
+    long m_StartBytes;
+    
+    /// \brief Measures the time since this started
+    util::stopwatch m_Time;
+    
+public:
+    /// \brief Creates a budget that starts measuring immediately
+    test_budget();
+    
+    /// \brief Starts measuring again from now
+    void restart();
+    
+    /// \brief The number of allocations made since this started measuring
+    long allocations() const;
+    
+    /// \brief The number of bytes allocated since this started measuring
+    long bytes() const;
+    
+    /// \brief The number of seconds since this started measuring
+    inline double seconds() const { return m_Time.seconds(); }
+    
+    /// \brief The total number of allocations made by the test program
+    static long total_allocations();
+    
+    /// \brief The total number of bytes allocated by the test program
+    static long total_bytes();
+};
+
 /// \brief Class that represents a series of tests
 class test_fixture {
 private:
@@ -52,6 +96,12 @@ public:
     /// \brief Reports on the result of an individual test (which is known to fail)
     void report_known_failure(std::string test_name, bool result);
     
+    /// \brief Reports on whether a test stayed within an allocation budget
+    ///
+    /// The test fails if more than maxAllocations allocations were made since the budget started measuring, and the
+    /// number of allocations is shown either way so that the budget can be adjusted.
+    void report_allocations(std::string test_name, const test_budget& budget, long maxAllocations);
+    
     /// \brief Runs this test
     void run();
     
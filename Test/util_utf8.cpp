@@ -0,0 +1,95 @@
+//
+//  util_utf8.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+
+#include <string>
+#include <vector>
+
+#include "util_utf8.h"
+
+#include "TameParse/Util/utf8reader.h"
+
+using namespace std;
+using namespace util;
+
+/// \brief Decodes the specified string, returning the characters that were decoded
+static vector<int> decode(const string& utf8, size_t& bytesUsed, bool& bad, size_t max = 256) {
+    vector<int>             result(max);
+    const unsigned char*    start   = (const unsigned char*) utf8.data();
+    const unsigned char*    pos     = start;
+    
+    bad = false;
+    result.resize(utf8reader::decode(pos, start + utf8.size(), &result[0], max, bad));
+    bytesUsed = pos - start;
+    
+    return result;
+}
+
+void test_util_utf8::run_tests() {
+    size_t  used;
+    bool    bad;
+    
+    // Long runs of ASCII characters should be passed through unchanged
+    string          ascii   = "The quick brown fox jumps over the lazy dog, 0123456789";
+    vector<int>     chars   = decode(ascii, used, bad);
+    
+    bool asciiOk = chars.size() == ascii.size();
+    for (size_t x=0; asciiOk && x<ascii.size(); ++x) {
+        if (chars[x] != ascii[x]) asciiOk = false;
+    }
+    report("Ascii",             asciiOk && used == ascii.size() && !bad);
+    
+    // Multi-byte characters in the middle of an ASCII run
+    chars = decode("abcdefghijklmnopqrstuvwxyz\xc3\xa9\xe2\x82\xac" "abcdefghijklmnopqrstuvwxyz", used, bad);
+    report("MultiByteLength",   chars.size() == 54 && !bad);
+    report("TwoByte",           chars.size() > 26 && chars[26] == 0xe9);
+    report("ThreeByte",         chars.size() > 27 && chars[27] == 0x20ac);
+    report("AsciiAfter",        chars.size() == 54 && chars[28] == 'a' && chars[53] == 'z');
+    
+    // Characters outside the BMP become surrogate pairs
+    chars = decode("\xf0\x9f\x98\x80", used, bad);
+    report("SurrogatePair",     chars.size() == 2 && chars[0] == 0xd83d && chars[1] == 0xde00 && used == 4);
+    
+    // ... but only if there's space for both halves
+    chars = decode("a\xf0\x9f\x98\x80", used, bad, 2);
+    report("SurrogateNoSpace",  chars.size() == 1 && used == 1 && !bad);
+    
+    // Truncated characters are left for the next call
+    chars = decode("ab\xe2\x82", used, bad);
+    report("Truncated",         chars.size() == 2 && used == 2 && !bad);
+    
+    // Invalid sequences stop the decoding
+    chars = decode("ab\xc3(", used, bad);
+    report("BadContinuation",   chars.size() == 2 && used == 2 && bad);
+    
+    chars = decode("ab\xc0\xaf", used, bad);
+    report("Overlong",          chars.size() == 2 && bad);
+    
+    chars = decode("\xed\xa0\x80", used, bad);
+    report("EncodedSurrogate",  chars.empty() && bad);
+    
+    chars = decode("\xff", used, bad);
+    report("BadLeadingByte",    chars.empty() && bad);
+}
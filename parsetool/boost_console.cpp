@@ -47,12 +47,14 @@ namespace fs = boost::filesystem;
  // \brief Copies this console
 boost_console::boost_console(const boost_console& bc)
 : std_console(L"")
-, m_VarMap(bc.m_VarMap) {
+, m_VarMap(bc.m_VarMap)
+, m_OptionsValid(bc.m_OptionsValid) {
 }
 
 /// \brief Constructor
 boost_console::boost_console(int argc, const char** argv) 
-: std_console(L"") {
+: std_console(L"")
+, m_OptionsValid(true) {
     // Declare the options supported by the tameparse utility
     po::options_description inputOptions("Input options");
 
@@ -64,11 +66,37 @@ boost_console::boost_console(int argc, const char** argv)
     
     outputOptions.add_options()
         ("output-file,o",       po::value<string>(),            "specifies the base name for the output file. For languages that need to generate multiple files (for example, C++), the appropriate extensions will be added to this filename. If this is not specified, the output filenames will be derived from the input file.")
-        ("output-language,T",   po::value<string>(),            "specifies the output language the parser will be generated in.")
+        ("output-language,T",   po::value<string>(),            "specifies the output language the parser will be generated in: 'cplusplus' (the default) or 'c' (a self-contained parser that doesn't need the TameParse headers, for languages that don't use guards, weak symbols, lexer modes or the keyword table).")
         ("class-name,C",        po::value<string>(),            "specifies the name of the class to generate (overriding anything defined in the parser block of the input file)")
         ("namespace-name,N",    po::value<string>(),            "specifies the namespace to put the target class into.")
+        ("lexer-tables",        po::value<string>(),            "specifies how the lexer state machine is written in C++ output: 'flat' (fastest), 'compact' (smallest for sparse states), 'comb' (row-displacement), 'direct' (compiled into code with a label for each state) or 'auto' (the default, which picks one based on the number of states and symbol sets).")
+        ("parser-tables",       po::value<string>(),            "specifies how the parser tables are written in C++ output: 'wide' (32-bit symbols and states), 'compact' (16-bit symbols and up to 4095 states and rules) or 'auto' (the default, which uses compact tables whenever the grammar fits).")
+        ("c-tables",            po::value<string>(),            "specifies the type of the tables in C output: 'narrow' (the default, which uses the smallest integer type that holds each table) or 'int'.")
+        ("direct-parser",                                       "also generate a parser with its state machine compiled into code in C++ output. This is only done for languages that don't use guards or weak symbols.")
+        ("direct-parser-max-states", po::value<string>(),       "specifies the largest number of parser states for which --direct-parser will generate code (the default is 2000).")
+        ("static-parser",                                       "also generate a parse_<start> function for each start symbol in C++ output. These read from the generated lexer directly, so that no virtual functions are called while parsing.")
+        ("keep-trivia",                                         "make the lexeme streams created by C++ output return the symbols that the parser ignores in every state (such as whitespace and comments), rather than skipping them without creating a lexeme. Formatters that need this trivia should set this option.")
+        ("pooled-ast",                                          "generate AST classes whose repetitions keep their first few items inline, and which can be allocated from a util::arena passed to the parser actions.")
+        ("split-output",                                        "write the tables and the AST class definitions in C++ output to separate <output>_tables.cpp and <output>_ast.cpp files. Files whose content hasn't changed are not rewritten, so builds only recompile the parts of the parser that change.")
+        ("dense-terminals",                                     "renumber the terminal symbols in the output so that the symbols the parser acts on in the most states have the lowest identifiers, followed by the symbols that are only used by the lexer. This keeps the symbol columns of the parser tables contiguous, so they can be indexed directly and fit in narrower types.")
+        ("dependency-file",     po::value<string>(),            "writes a makefile fragment to the specified file that lists the input file and every file that it imports as dependencies of the output files.")
+        ("skip-up-to-date",                                     "do not generate any output if the output files are newer than the input file, every file that it imports and any parser profile. Changes to the options are not detected, so the output should also depend on anything that sets them.")
+        ("cache-dir",           po::value<string>(),            "specifies a directory where generated files are cached. If the input files and options are unchanged since an earlier run, the cached output is used instead of building the parser again.")
+        ("profile-report",      po::value<string>(),            "writes a JSON report of the time, peak memory and work done by each compilation stage to the specified file.")
+        ("threads,j",           po::value<string>(),            "specifies the number of threads used to compile independent languages and run tests. If this is not specified, one thread is used for each processor core.")
+        ("keyword-table",                                       "match literals that are also matched by another lexer symbol, such as keywords that look like identifiers, by looking up the text of each lexeme in a hash table rather than in the lexer DFA. Case insensitive literals are found by folding the text of each lexeme to lower case. This can make the DFA much smaller for languages with many keywords.")
+        ("no-surrogates",                                       "do not add lexer states that match characters outside the basic multilingual plane as UTF-16 surrogate pairs. This makes the lexer smaller for languages that allow any character in some symbols, but the surrogates in a pair will be matched separately.")
+        ("utf8-lexer",                                          "build a lexer that matches the bytes of UTF-8 text rather than characters. Generated parsers can then read narrow (char) streams directly, and the content of each lexeme is its UTF-8 text.")
+        ("parallel-lexer",                                      "build the states of the lexer for each lexer mode on a separate thread, then join them together. This makes compiling lexers with several modes faster, but the generated tables may be ordered differently.")
         ("run-tests",                                           "if the language contains any tests, then run them")
-        ("test",                                                "specifies that no output should be generated. This tool will instead try to read from stdin and indicate whether or not it can be accepted.");
+        ("show-test-timing",                                    "with --run-tests, display the time taken and the number of lexemes read by each test")
+        ("test-throughput",     po::value<string>(),            "with --run-tests, parse the input of each test that passed the specified number of times and display the lexemes/s, bytes/s, allocations per parse and peak lookahead for each test and each language.")
+        ("test-throughput-size", po::value<string>(),           "with --run-tests, parse the input of each test that passed repeatedly until at least the specified number of bytes (of UTF-8) have been read, and display the throughput as for --test-throughput.")
+        ("test",                                                "specifies that no output should be generated. This tool will instead try to read from stdin and indicate whether or not it can be accepted.")
+        ("generate-sentence",   po::value<string>(),            "instead of generating a parser, write a randomly generated sentence for the first start symbol to the specified file. The text for each terminal is taken from the lexer, and the sentence is checked by parsing it. This is useful for creating large inputs for benchmarks.")
+        ("sentence-size",       po::value<string>(),            "with --generate-sentence, the approximate number of terminals in the sentence (the default is 1000).")
+        ("sentence-depth",      po::value<string>(),            "with --generate-sentence, the number of times a nonterminal can be nested inside itself before the sentence uses its shortest rule (the default is 8).")
+        ("sentence-seed",       po::value<string>(),            "with --generate-sentence, a number that selects a different random sentence.");
 
     po::options_description infoOptions("Information");
     
@@ -80,13 +108,31 @@ boost_console::boost_console(int argc, const char** argv)
         ("warranty",                                            "display warranty information.")
         ("license",                                             "display license information.");
 
+    po::options_description serverOptions("Compile server");
+    
+    serverOptions.add_options()
+        ("server",              po::value<string>(),            "run as a compile server that accepts requests on the UNIX domain socket at the specified path. The server keeps the output for the grammars it has built in memory, so requests to build an unchanged grammar again are answered without running the lexer or parser builders.")
+        ("client",              po::value<string>(),            "send this request to the compile server listening on the specified socket, and display its results. If the server can't be contacted, the request is handled by this process instead.")
+        ("stop-server",                                         "with --client, ask the compile server to stop.");
+
     po::options_description parserOptions("Parser generator options");
 
     parserOptions.add_options()
         ("compile-language,L",  po::value<string>(),            "specifies the name of the language block to compile (overriding anything defined in the parser block of the input file)")
         ("start-symbol,S",      po::value< vector<string> >(),  "specifies the name of the start symbol (overriding anything defined in the parser block of the input file)")
         ("enable-lr1-resolver",                                 "attempt to resolve reduce/reduce conflicts that would be allowed by a LR(1) parser")
-        ("show-parser",                                         "writes the generated parser to standard out");
+        ("minimal-lr1",                                         "build a minimal LR(1) parser, splitting the LALR states that would have reduce/reduce conflicts")
+        ("prune-grammar",                                       "remove the rules that can't be reached from the start symbols, or can never match any input, before building the parser")
+        ("low-memory",                                          "reduce the peak memory needed to build the parser by discarding the intermediate data for each state as soon as it has been used to build the parser tables. This can make displaying the parser slower, and --verbose will display the peak memory used.")
+        ("resolve-guards",                                      "replace guards that are always matched by the first symbol of the lookahead with direct actions when the parser is built")
+        ("shift-reduce",                                        "combine shift actions with the reduction performed by the state they lead to, where that state reduces the same rule whatever the next symbol is. The parser then reduces as soon as the symbol is shifted. Parsers that use these actions can't be generated as C or direct-coded C++.")
+        ("eliminate-unit-rules",                                "skip the reductions for chains of rules like <a> = <b> when the parser is built (nodes for the skipped rules are rebuilt in generated syntax trees)")
+        ("inline-alternatives",                                 "replace alternatives such as (a | b) with copies of the rules that contain them, so the parser performs fewer reductions (this changes the shape of the syntax tree)")
+        ("parser-profile-input", po::value< vector<string> >(), "parses the specified sample file with the generated parser and moves the states that it uses most often next to each other in the parser tables.")
+        ("parser-profile",      po::value<string>(),            "reads state frequencies written by --write-parser-profile and uses them to order the parser tables, along with any sample files.")
+        ("write-parser-profile", po::value<string>(),           "writes the state frequencies found in the sample files and any profile that was read to the specified file.")
+        ("show-parser",                                         "writes the generated parser to standard out")
+        ("show-parser-stats",                                   "writes a summary of the generated lexer and parser to standard out: the number of states and actions, how the actions are distributed between states, the size of the tables in each encoding and the states with the most actions.");
     
     po::options_description errorOptions("Error reporting");
     
@@ -103,7 +149,8 @@ boost_console::boost_console(int argc, const char** argv)
         ("show-parser-closure",                                 "display the closure of all states when showing the parser with --show-parser.")
         ("show-propagation",                                    "display the lookahead propagation tables")
         ("disable-compact-dfa",                                 "do not compact the DFA")
-        ("disable-merged-dfa",                                  "do not attempt to merge symbol sets in the DFA");
+        ("disable-merged-dfa",                                  "do not attempt to merge symbol sets in the DFA")
+        ("disable-state-layout",                                "do not renumber the lexer and parser states so that related states are close together");
 
     // Positional options
     po::positional_options_description positional;
@@ -114,8 +161,8 @@ boost_console::boost_console(int argc, const char** argv)
     // Command line options
     po::options_description cmdLine;
     po::options_description help;
-    cmdLine.add(inputOptions).add(outputOptions).add(infoOptions).add(parserOptions).add(errorOptions).add(hiddenOptions);
-    help.add(inputOptions).add(outputOptions).add(infoOptions).add(parserOptions).add(errorOptions);
+    cmdLine.add(inputOptions).add(outputOptions).add(infoOptions).add(parserOptions).add(errorOptions).add(serverOptions).add(hiddenOptions);
+    help.add(inputOptions).add(outputOptions).add(infoOptions).add(parserOptions).add(errorOptions).add(serverOptions);
 
     // Store the options
     try {
@@ -124,7 +171,10 @@ boost_console::boost_console(int argc, const char** argv)
     } catch (po::error e) {
         cerr << e.what() << endl << endl;
         cout << help << endl;
-        ::exit(1);
+        
+        // The compile server handles requests in the same process, so this can't just exit
+        m_OptionsValid = false;
+        return;
     }
 
     // Display help if needed
@@ -154,8 +204,8 @@ boost_console::boost_console(int argc, const char** argv)
         doneSomething = true;
     }
 
-    // Also display help if no input file is displayed
-    if (!doneSomething && m_VarMap.count("input-file") == 0) {
+    // Also display help if no input file is displayed (the compile server options don't need one)
+    if (!doneSomething && m_VarMap.count("input-file") == 0 && m_VarMap.count("server") == 0 && m_VarMap.count("stop-server") == 0) {
         cerr << argv[0] << ": no input files" << endl << endl;
         cout << help << endl;
     }
@@ -166,8 +216,8 @@ boost_console::boost_console(int argc, const char** argv)
 
 /// \brief Returns true if the options are valid and the parser can start
 bool boost_console::can_start() const {
-    // Nothing to do if no input file is specified
-    if (m_VarMap.count("input-file") == 0) {
+    // Nothing to do if the options couldn't be read, or if no input file is specified
+    if (!m_OptionsValid || m_VarMap.count("input-file") == 0) {
         return false;
     }
 
@@ -320,6 +370,17 @@ std::vector<std::wstring> boost_console::split_path(const std::wstring& pathname
     return res;
 }
 
+/// \brief Retrieves the time that the file with the specified name was last modified
+///
+/// Returns false if the file doesn't exist or the time can't be determined.
+bool boost_console::last_write_time(const std::wstring& filename, std::time_t& result) {
+    boost::system::error_code   errorCode;
+    fs::wpath                   path(filename);
+    
+    result = fs::last_write_time(path, errorCode);
+    return !errorCode;
+}
+
 /// \brief Opens a text file with the specified name for reading
 ///
 /// The caller should delete the stream once it has finished with it. Streams are generally expected to contain UTF-8
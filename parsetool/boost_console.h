@@ -46,6 +46,9 @@ private:
     /// \brief The variables map for this object
     variables_map m_VarMap;
     
+    /// \brief False if the command line options could not be read
+    bool m_OptionsValid;
+    
     /// \brief The name of the input file
     std::wstring m_InputFile;
 
@@ -79,6 +82,11 @@ public:
     ///
     /// The default implementation assumes UNIX-style paths.
     virtual std::vector<std::wstring> split_path(const std::wstring& pathname);
+
+    /// \brief Retrieves the time that the file with the specified name was last modified
+    ///
+    /// Returns false if the file doesn't exist or the time can't be determined.
+    virtual bool last_write_time(const std::wstring& filename, std::time_t& result);
     
     /// \brief Opens a text file with the specified name for reading
     ///
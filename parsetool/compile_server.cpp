@@ -0,0 +1,408 @@
+//
+//  compile_server.cpp
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+#include "compile_server.h"
+
+#if defined(HAVE_UNISTD_H) && defined(HAVE_SYS_SOCKET_H) && defined(HAVE_SYS_UN_H)
+#define TAMEPARSE_COMPILE_SERVER
+
+#include <csignal>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#endif
+
+using namespace std;
+
+#ifdef TAMEPARSE_COMPILE_SERVER
+
+/// \brief The largest string that will be accepted from the other end of a connection
+static const size_t c_MaxStringLength = 256 * 1024 * 1024;
+
+/// \brief Writes all of the specified bytes to a socket, returning false if this fails
+static bool write_bytes(int socket, const char* bytes, size_t count) {
+    while (count > 0) {
+        ssize_t written = ::write(socket, bytes, count);
+        if (written <= 0) return false;
+        
+        bytes += written;
+        count -= (size_t) written;
+    }
+    
+    return true;
+}
+
+/// \brief Reads the specified number of bytes from a socket, returning false if this fails
+static bool read_bytes(int socket, char* bytes, size_t count) {
+    while (count > 0) {
+        ssize_t numRead = ::read(socket, bytes, count);
+        if (numRead <= 0) return false;
+        
+        bytes += numRead;
+        count -= (size_t) numRead;
+    }
+    
+    return true;
+}
+
+/// \brief Writes a 32-bit value to a socket, most significant byte first
+static bool write_int(int socket, unsigned long value) {
+    char bytes[4];
+    for (int byteNum = 0; byteNum < 4; ++byteNum) {
+        bytes[byteNum] = (char) ((value >> (8 * (3 - byteNum))) & 0xff);
+    }
+    
+    return write_bytes(socket, bytes, 4);
+}
+
+/// \brief Reads a 32-bit value written by write_int from a socket
+static bool read_int(int socket, unsigned long& value) {
+    unsigned char bytes[4];
+    if (!read_bytes(socket, (char*) bytes, 4)) return false;
+    
+    value = 0;
+    for (int byteNum = 0; byteNum < 4; ++byteNum) {
+        value = (value << 8) | bytes[byteNum];
+    }
+    
+    return true;
+}
+
+/// \brief Writes a string to a socket, preceded by its length
+static bool write_string(int socket, const string& value) {
+    return write_int(socket, (unsigned long) value.size()) && write_bytes(socket, value.data(), value.size());
+}
+
+/// \brief Reads a string written by write_string from a socket
+static bool read_string(int socket, string& value) {
+    unsigned long length;
+    if (!read_int(socket, length) || length > c_MaxStringLength) return false;
+    
+    value.resize(length);
+    return length == 0 || read_bytes(socket, &value[0], length);
+}
+
+/// \brief Converts wide text to UTF-8
+static string to_utf8(const wstring& text) {
+    string result;
+    result.reserve(text.size());
+    
+    for (size_t pos = 0; pos < text.size(); ++pos) {
+        unsigned long chr = (unsigned long) text[pos];
+        
+        // Join up UTF-16 surrogate pairs
+        if (chr >= 0xd800 && chr < 0xdc00 && pos+1 < text.size() && (unsigned long) text[pos+1] >= 0xdc00 && (unsigned long) text[pos+1] < 0xe000) {
+            chr = 0x10000 + ((chr - 0xd800) << 10) + ((unsigned long) text[pos+1] - 0xdc00);
+            ++pos;
+        }
+        
+        if (chr < 0x80) {
+            result += (char) chr;
+        } else if (chr < 0x800) {
+            result += (char) (0xc0 | (chr >> 6));
+            result += (char) (0x80 | (chr & 0x3f));
+        } else if (chr < 0x10000) {
+            result += (char) (0xe0 | (chr >> 12));
+            result += (char) (0x80 | ((chr >> 6) & 0x3f));
+            result += (char) (0x80 | (chr & 0x3f));
+        } else {
+            result += (char) (0xf0 | (chr >> 18));
+            result += (char) (0x80 | ((chr >> 12) & 0x3f));
+            result += (char) (0x80 | ((chr >> 6) & 0x3f));
+            result += (char) (0x80 | (chr & 0x3f));
+        }
+    }
+    
+    return result;
+}
+
+/// \brief Fills in the address for a UNIX domain socket, returning false if the path is too long
+static bool socket_address(const string& socketPath, sockaddr_un& address) {
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    
+    if (socketPath.size() >= sizeof(address.sun_path)) return false;
+    
+    strcpy(address.sun_path, socketPath.c_str());
+    return true;
+}
+
+///
+/// \brief Redirects the standard streams to strings while it exists
+///
+class capture_output {
+private:
+    wstringstream   m_Out;
+    wstringstream   m_Err;
+    ostringstream   m_NarrowOut;
+    ostringstream   m_NarrowErr;
+    
+    wstreambuf*     m_OldOut;
+    wstreambuf*     m_OldErr;
+    streambuf*      m_OldNarrowOut;
+    streambuf*      m_OldNarrowErr;
+    
+public:
+    capture_output()
+    : m_OldOut(wcout.rdbuf(m_Out.rdbuf()))
+    , m_OldErr(wcerr.rdbuf(m_Err.rdbuf()))
+    , m_OldNarrowOut(cout.rdbuf(m_NarrowOut.rdbuf()))
+    , m_OldNarrowErr(cerr.rdbuf(m_NarrowErr.rdbuf())) {
+    }
+    
+    ~capture_output() {
+        wcout.rdbuf(m_OldOut);
+        wcerr.rdbuf(m_OldErr);
+        cout.rdbuf(m_OldNarrowOut);
+        cerr.rdbuf(m_OldNarrowErr);
+    }
+    
+    /// \brief The text written to stdout so far
+    string out() const { return m_NarrowOut.str() + to_utf8(m_Out.str()); }
+    
+    /// \brief The text written to stderr so far
+    string err() const { return m_NarrowErr.str() + to_utf8(m_Err.str()); }
+};
+
+/// \brief Handles a single connection to the server, returning false if the server should stop
+static bool handle_connection(int connection, compile_request_handler handler) {
+    // Read the request: the working directory followed by the arguments
+    unsigned long   numArguments;
+    string          workingDirectory;
+    vector<string>  arguments;
+    
+    if (!read_string(connection, workingDirectory) || !read_int(connection, numArguments) || numArguments > 4096) {
+        return true;
+    }
+    
+    for (unsigned long argNum = 0; argNum < numArguments; ++argNum) {
+        string argument;
+        if (!read_string(connection, argument)) return true;
+        arguments.push_back(argument);
+    }
+    
+    // Stop if the client asks
+    if (arguments.size() == 2 && arguments[1] == "--stop-server") {
+        write_int(connection, 0);
+        write_string(connection, "");
+        write_string(connection, "");
+        return false;
+    }
+    
+    // Run the request in the client's directory, capturing its output
+    int     exitCode = 1;
+    string  out;
+    string  err;
+    
+    // The server goes back to its own directory afterwards, so relative paths in later requests don't resolve
+    // against the directory of an earlier client
+    char    serverDirectory[4096];
+    
+    if (workingDirectory.empty()) {
+        err = "tameparse: the client did not send its working directory\n";
+    } else if (!::getcwd(serverDirectory, sizeof(serverDirectory))) {
+        err = "tameparse: could not find the server's working directory\n";
+    } else if (::chdir(workingDirectory.c_str()) != 0) {
+        err = "tameparse: could not change to the directory '" + workingDirectory + "'\n";
+    } else {
+        vector<const char*> argv;
+        for (vector<string>::const_iterator argument = arguments.begin(); argument != arguments.end(); ++argument) {
+            argv.push_back(argument->c_str());
+        }
+        argv.push_back(NULL);
+        
+        capture_output capture;
+        
+        try {
+            exitCode = handler((int) arguments.size(), &argv[0]);
+        } catch (...) {
+            // run_stages() has already reported the problem
+            exitCode = 1;
+        }
+        
+        wcout.flush();
+        wcerr.flush();
+        
+        out = capture.out();
+        err = capture.err();
+        
+        if (::chdir(serverDirectory) != 0) {
+            err += "tameparse: could not change back to the directory '" + string(serverDirectory) + "'\n";
+        }
+    }
+    
+    // Send the results back
+    write_int(connection, (unsigned long) exitCode);
+    write_string(connection, out);
+    write_string(connection, err);
+    
+    return true;
+}
+
+/// \brief Removes a socket left behind by a server that has stopped, returning false if the path can't be used
+///
+/// Anything at the path that isn't a socket is left alone, as is a socket that another server is still listening on.
+static bool remove_stale_socket(const string& socketPath, const sockaddr_un& address) {
+    struct stat status;
+    if (::lstat(socketPath.c_str(), &status) != 0) {
+        // Nothing to remove
+        return true;
+    }
+    
+    if (!S_ISSOCK(status.st_mode)) {
+        cerr << "tameparse: '" << socketPath << "' already exists and is not a socket" << endl;
+        return false;
+    }
+    
+    // Check that there's no server still using the socket
+    int probe = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (probe < 0) {
+        cerr << "tameparse: could not listen on '" << socketPath << "'" << endl;
+        return false;
+    }
+    
+    bool inUse = ::connect(probe, (const sockaddr*) &address, sizeof(address)) == 0;
+    ::close(probe);
+    
+    if (inUse) {
+        cerr << "tameparse: a server is already listening on '" << socketPath << "'" << endl;
+        return false;
+    }
+    
+    if (::unlink(socketPath.c_str()) != 0) {
+        cerr << "tameparse: could not remove the old socket '" << socketPath << "'" << endl;
+        return false;
+    }
+    
+    return true;
+}
+
+/// \brief Runs a compile server that accepts requests on the UNIX domain socket with the specified path
+int run_compile_server(const string& socketPath, compile_request_handler handler) {
+    sockaddr_un address;
+    if (!socket_address(socketPath, address)) {
+        cerr << "tameparse: the socket path '" << socketPath << "' is too long" << endl;
+        return 1;
+    }
+    
+    // Clients that go away shouldn't stop the server
+    signal(SIGPIPE, SIG_IGN);
+    
+    // Replace any socket left behind by an earlier server
+    if (!remove_stale_socket(socketPath, address)) {
+        return 1;
+    }
+    
+    // Only the user running the server can connect to it
+    int     server      = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    mode_t  oldMask     = ::umask(0077);
+    bool    bound       = server >= 0 && ::bind(server, (sockaddr*) &address, sizeof(address)) == 0;
+    ::umask(oldMask);
+    
+    if (!bound || ::listen(server, 16) != 0) {
+        cerr << "tameparse: could not listen on '" << socketPath << "'" << endl;
+        if (server >= 0) ::close(server);
+        return 1;
+    }
+    
+    // Handle requests until one asks the server to stop
+    for (;;) {
+        int connection = ::accept(server, NULL, NULL);
+        if (connection < 0) continue;
+        
+        bool keepRunning = handle_connection(connection, handler);
+        ::close(connection);
+        
+        if (!keepRunning) break;
+    }
+    
+    ::close(server);
+    ::unlink(socketPath.c_str());
+    return 0;
+}
+
+/// \brief Sends a request to the compile server listening on the specified socket
+bool send_compile_request(const string& socketPath, const vector<string>& arguments, int& exitCode) {
+    sockaddr_un address;
+    if (!socket_address(socketPath, address)) return false;
+    
+    int connection = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (connection < 0) return false;
+    
+    if (::connect(connection, (sockaddr*) &address, sizeof(address)) != 0) {
+        ::close(connection);
+        return false;
+    }
+    
+    // Send the working directory and the arguments
+    char    cwd[4096];
+    string  workingDirectory = ::getcwd(cwd, sizeof(cwd)) ? cwd : "";
+    bool    ok               = write_string(connection, workingDirectory) && write_int(connection, (unsigned long) arguments.size());
+    
+    for (vector<string>::const_iterator argument = arguments.begin(); ok && argument != arguments.end(); ++argument) {
+        ok = write_string(connection, *argument);
+    }
+    
+    // Read the response
+    unsigned long   result = 1;
+    string          out;
+    string          err;
+    
+    ok = ok && read_int(connection, result) && read_string(connection, out) && read_string(connection, err);
+    ::close(connection);
+    
+    if (!ok) return false;
+    
+    fwrite(out.data(), 1, out.size(), stdout);
+    fwrite(err.data(), 1, err.size(), stderr);
+    
+    exitCode = (int) result;
+    return true;
+}
+
+#else
+
+/// \brief Runs a compile server that accepts requests on the UNIX domain socket with the specified path
+int run_compile_server(const string& socketPath, compile_request_handler handler) {
+    cerr << "tameparse: the compile server is not supported on this platform" << endl;
+    return 1;
+}
+
+/// \brief Sends a request to the compile server listening on the specified socket
+bool send_compile_request(const string& socketPath, const vector<string>& arguments, int& exitCode) {
+    return false;
+}
+
+#endif
@@ -0,0 +1,57 @@
+//
+//  compile_server.h
+//  Parse
+//
+//  Copyright (c) 2011-2012 Andrew Hunter
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy 
+//  of this software and associated documentation files (the \"Software\"), to 
+//  deal in the Software without restriction, including without limitation the 
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+//  sell copies of the Software, and to permit persons to whom the Software is 
+//  furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+//  IN THE SOFTWARE.
+//
+
+#ifndef TameParse_compile_server_h
+#define TameParse_compile_server_h
+
+#include <string>
+#include <vector>
+
+///
+/// \brief Function that handles a request sent to a compile server by running the tool with the specified arguments
+///
+/// The output written to the standard streams while this runs is sent back to the client, and the result is used as
+/// the client's exit code.
+///
+typedef int (*compile_request_handler)(int argc, const char** argv);
+
+///
+/// \brief Runs a compile server that accepts requests on the UNIX domain socket with the specified path
+///
+/// Requests are handled one at a time, in the working directory of the client that sent them. The server keeps running
+/// until a client sends a request whose only argument is --stop-server. Returns the exit code for the server process.
+///
+int run_compile_server(const std::string& socketPath, compile_request_handler handler);
+
+///
+/// \brief Sends a request to the compile server listening on the specified socket
+///
+/// The arguments should be the same as the ones passed to main(), including the program name. The output from the
+/// server is written to stdout and stderr. Returns false if the server could not be contacted, in which case the caller
+/// should handle the request itself.
+///
+bool send_compile_request(const std::string& socketPath, const std::vector<std::string>& arguments, int& exitCode);
+
+#endif
@@ -27,9 +27,12 @@
 
 #include "TameParse/TameParse.h"
 #include "boost_console.h"
+#include "compile_server.h"
 
+#include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <new>
 
 using namespace std;
 using namespace util;
@@ -40,12 +43,168 @@ using namespace tameparse;
 using namespace language;
 using namespace compiler;
 
-int main (int argc, const char * argv[])
-{
-    // Create the console
-    boost_console       console(argc, argv);
-    console_container   cons(&console, false);
+#if __cplusplus >= 201103L
+#define TAMEPARSE_THROWS_BAD_ALLOC
+#define TAMEPARSE_NO_THROW noexcept
+#else
+#define TAMEPARSE_THROWS_BAD_ALLOC throw(std::bad_alloc)
+#define TAMEPARSE_NO_THROW throw()
+#endif
+
+// The allocations are counted so that --test-throughput can report how many each parse makes
+
+void* operator new(size_t size) TAMEPARSE_THROWS_BAD_ALLOC {
+    allocation_counter::count(size);
+    
+    void* result = malloc(size ? size : 1);
+    if (!result) throw std::bad_alloc();
+    return result;
+}
+
+void* operator new[](size_t size) TAMEPARSE_THROWS_BAD_ALLOC {
+    return operator new(size);
+}
+
+void operator delete(void* memory) TAMEPARSE_NO_THROW {
+    free(memory);
+}
+
+void operator delete[](void* memory) TAMEPARSE_NO_THROW {
+    free(memory);
+}
+
+/// \brief Writes a filename so that make will read it as a single word
+static void write_make_filename(boost_console& console, const wstring& filename, ostream& target) {
+    string name = console.convert_filename(filename);
+    
+    for (string::const_iterator nextChar = name.begin(); nextChar != name.end(); ++nextChar) {
+        if (*nextChar == ' ' || *nextChar == '#')   target << '\\';
+        if (*nextChar == '$')                       target << '$';
+        target << *nextChar;
+    }
+}
+
+/// \brief Writes a makefile fragment that says that the output files depend on the input files
+///
+/// Each input file also gets a rule with no dependencies, so that make doesn't stop with an error if one of them is
+/// removed (in the same way as the -MP option for gcc).
+static void write_dependency_file(boost_console& console, const wstring& filename, const vector<wstring>& outputFiles, const vector<wstring>& inputFiles) {
+    auto_ptr<ostream> target(console.open_binary_file_for_writing(filename));
+    if (!target.get() || !target->good()) {
+        console.report_error(error(error::sev_error, filename, L"CANT_WRITE_DEPENDENCIES", L"Could not open the dependency file for writing", position(-1, -1, -1)));
+        return;
+    }
+    
+    for (vector<wstring>::const_iterator outputFile = outputFiles.begin(); outputFile != outputFiles.end(); ++outputFile) {
+        if (outputFile != outputFiles.begin()) *target << ' ';
+        write_make_filename(console, *outputFile, *target);
+    }
+    *target << ':';
+    
+    for (vector<wstring>::const_iterator inputFile = inputFiles.begin(); inputFile != inputFiles.end(); ++inputFile) {
+        *target << " \\\n  ";
+        write_make_filename(console, *inputFile, *target);
+    }
+    *target << '\n';
+    
+    for (vector<wstring>::const_iterator inputFile = inputFiles.begin(); inputFile != inputFiles.end(); ++inputFile) {
+        *target << '\n';
+        write_make_filename(console, *inputFile, *target);
+        *target << ":\n";
+    }
+}
+
+/// \brief Returns true if all of the output files exist and are newer than all of the input files
+///
+/// The options aren't taken into account, so the output must be rebuilt some other way if they change.
+static bool is_up_to_date(boost_console& console, const vector<wstring>& outputFiles, const vector<wstring>& inputFiles) {
+    if (outputFiles.empty()) return false;
+    
+    // Find the oldest output file
+    time_t oldestOutput = 0;
+    for (vector<wstring>::const_iterator outputFile = outputFiles.begin(); outputFile != outputFiles.end(); ++outputFile) {
+        time_t modified;
+        if (!console.last_write_time(*outputFile, modified)) return false;
+        
+        if (outputFile == outputFiles.begin() || modified < oldestOutput) {
+            oldestOutput = modified;
+        }
+    }
+    
+    // Every input file must be older than it
+    for (vector<wstring>::const_iterator inputFile = inputFiles.begin(); inputFile != inputFiles.end(); ++inputFile) {
+        time_t modified;
+        if (!console.last_write_time(*inputFile, modified) || modified >= oldestOutput) return false;
+    }
+    
+    return true;
+}
+
+/// \brief NULL, or the cache entries kept in memory by a compile server
+static output_cache::memory_store* s_ResidentCache = NULL;
+
+/// \brief NULL, or the definition files kept in memory by a compile server
+static parser_stage::definition_cache* s_ResidentDefinitions = NULL;
+
+/// \brief Builds the states of the parser and compiles the lexer for a language
+///
+/// These are the two slowest stages, and most of their work can be done on separate threads: the parser states only
+/// depend on the language stage, and the lexer only needs to wait for them before it adds its weak symbols to the
+/// grammar. The parser states are task 0, so they are built first if the tasks end up running one after the other.
+class lexer_and_parser_task {
+private:
+    /// \brief The lexer stage to compile
+    lexer_stage& m_LexerStage;
+    
+    /// \brief The parser stage whose states should be built
+    lr_parser_stage& m_ParserStage;
+    
+    /// \brief Opened once the parser stage has finished reading the grammar
+    util::gate m_GrammarGate;
     
+    /// \brief Set to the result of building the parser states
+    bool m_BuiltStates;
+    
+public:
+    lexer_and_parser_task(lexer_stage& lexerStage, lr_parser_stage& parserStage)
+    : m_LexerStage(lexerStage)
+    , m_ParserStage(parserStage)
+    , m_BuiltStates(false) {
+        m_LexerStage.set_grammar_gate(&m_GrammarGate);
+    }
+    
+    ~lexer_and_parser_task() {
+        m_LexerStage.set_grammar_gate(NULL);
+    }
+    
+    /// \brief Builds the parser states (index 0) or compiles the lexer (index 1)
+    void operator()(size_t index) {
+        if (index == 0) {
+            m_BuiltStates = m_ParserStage.build_states();
+            m_GrammarGate.open();
+        } else {
+            m_LexerStage.compile();
+        }
+    }
+    
+    /// \brief True if the parser states were built successfully
+    inline bool built_states() const { return m_BuiltStates; }
+};
+
+/// \brief The number of threads set by the 'threads' option (0 to use one per processor core)
+static unsigned int option_threads(boost_console& console) {
+    wstring threads = console.get_option(L"threads");
+    if (threads.empty()) return 0;
+    
+    long value = wcstol(threads.c_str(), NULL, 10);
+    if (value < 0) return 0;
+    
+    return (unsigned int) value;
+}
+
+/// \brief Runs the stages requested by the options in the console, and returns the exit code
+static int run_stages(boost_console& console, console_container& cons)
+{
     try {
         // Give up if the console is set not to start
         if (!console.can_start()) {
@@ -57,7 +216,7 @@ int main (int argc, const char * argv[])
         console.verbose_stream() << endl;
         
         // Parse the input file
-        parser_stage parserStage(cons, console.input_file());
+        parser_stage parserStage(cons, console.input_file(), s_ResidentDefinitions);
         parserStage.compile();
         
         // Stop if we have an error
@@ -72,7 +231,7 @@ int main (int argc, const char * argv[])
         }
         
         // Parse any imported files
-        import_stage importStage(cons, console.input_file(), parserStage.definition_file());
+        import_stage importStage(cons, console.input_file(), parserStage.definition_file(), s_ResidentDefinitions);
         importStage.compile();
 
         // Stop if we have an error
@@ -95,7 +254,122 @@ int main (int argc, const char * argv[])
                 && console.get_option(L"start-symbol").empty()
                 && console.get_option(L"output-language").empty()
                 && console.get_option(L"test").empty()
-                && console.get_option(L"show-parser").empty()) {
+                && console.get_option(L"show-parser").empty()
+                && console.get_option(L"show-parser-stats").empty()) {
+                return console.exit_code();
+            }
+        }
+        
+        // Work out the prefix filename
+        wstring prefixFilename = console.get_option(L"output-file");
+        if (prefixFilename.empty()) {
+            // Derive from the input file
+            // This works provided the target language 
+            prefixFilename = console.input_file();
+        }
+        
+        // Work out which files will be generated (only the C and C++ output stages write files)
+        wstring         outputLanguage  = console.get_option(L"output-language");
+        vector<wstring> outputFiles;
+        
+        if (console.get_option(L"test").empty() && console.get_option(L"generate-sentence").empty()) {
+            if (outputLanguage.empty() || outputLanguage == L"cplusplus") {
+                outputFiles.push_back(prefixFilename + L".cpp");
+                outputFiles.push_back(prefixFilename + L".h");
+                if (!console.get_option(L"split-output").empty()) {
+                    outputFiles.push_back(prefixFilename + L"_tables.cpp");
+                    outputFiles.push_back(prefixFilename + L"_ast.cpp");
+                }
+            } else if (outputLanguage == L"c") {
+                outputFiles.push_back(prefixFilename + L".h");
+                outputFiles.push_back(prefixFilename + L".c");
+            }
+        }
+        
+        // ... and which files they're generated from
+        vector<wstring> inputFiles;
+        for (import_stage::file_iterator inputFile = importStage.begin_file(); inputFile != importStage.end_file(); ++inputFile) {
+            inputFiles.push_back(inputFile->first);
+        }
+        
+        vector<wstring> profileFiles = console.get_option_list(L"parser-profile-input");
+        if (!console.get_option(L"parser-profile").empty()) {
+            profileFiles.push_back(console.get_option(L"parser-profile"));
+        }
+        inputFiles.insert(inputFiles.end(), profileFiles.begin(), profileFiles.end());
+        
+        // The output files are the only result unless one of the options that displays the parser is set
+        bool outputOnly = console.get_option(L"test").empty()
+            && console.get_option(L"generate-sentence").empty()
+            && console.get_option(L"show-parser").empty()
+            && console.get_option(L"show-parser-closure").empty()
+            && console.get_option(L"show-parser-stats").empty()
+            && console.get_option(L"show-propagation").empty()
+            && console.get_option(L"write-parser-profile").empty();
+        
+        // Tell the build system which files the output depends on if requested
+        if (!console.get_option(L"dependency-file").empty() && !outputFiles.empty()) {
+            write_dependency_file(console, console.get_option(L"dependency-file"), outputFiles, inputFiles);
+        }
+        
+        // Nothing needs to be done if the output is newer than all of the files it was generated from
+        if (outputOnly && !console.get_option(L"skip-up-to-date").empty() && is_up_to_date(console, outputFiles, inputFiles)) {
+            console.verbose_stream() << L"  = Output is up to date" << endl;
+            return console.exit_code();
+        }
+        
+        // Try to fetch the output from the cache if one is specified or this is a compile server (only C++ output is cached)
+        auto_ptr<output_cache>  cache(NULL);
+        
+        if ((!console.get_option(L"cache-dir").empty() || s_ResidentCache)
+            && (outputLanguage.empty() || outputLanguage == L"cplusplus")
+            && outputOnly) {
+            cache = auto_ptr<output_cache>(new output_cache(cons, console.get_option(L"cache-dir"), s_ResidentCache));
+            
+            // The key is made up of the version of this tool, the options that affect the output and the input files
+            wstringstream versionString;
+            versionString << version::major_version << L"." << version::minor_version << L"." << version::revision;
+            cache->add_string(versionString.str());
+            cache->add_string(prefixFilename);
+            
+            const wchar_t* keyOptions[] = { 
+                L"compile-language", L"class-name", L"namespace-name", L"enable-lr1-resolver", L"minimal-lr1", L"inline-alternatives", L"eliminate-unit-rules", L"resolve-guards", L"prune-grammar", 
+                L"allow-reduce-conflicts", L"no-conflicts", L"disable-compact-dfa", L"disable-merged-dfa", L"disable-state-layout", L"lexer-tables", L"parser-tables",
+                L"direct-parser", L"direct-parser-max-states", L"pooled-ast", L"static-parser", L"keep-trivia", L"parallel-lexer", L"keyword-table", L"no-surrogates", L"utf8-lexer", L"split-output", L"dense-terminals", L"shift-reduce", NULL 
+            };
+            
+            for (int optionNum = 0; keyOptions[optionNum]; ++optionNum) {
+                cache->add_string(keyOptions[optionNum]);
+                cache->add_string(console.get_option(keyOptions[optionNum]));
+            }
+            
+            vector<wstring> keyStartSymbols = console.get_option_list(L"start-symbol");
+            cache->add_string(L"start-symbol");
+            for (vector<wstring>::const_iterator startSymbol = keyStartSymbols.begin(); startSymbol != keyStartSymbols.end(); ++startSymbol) {
+                cache->add_string(*startSymbol);
+            }
+            
+            // The parser profile changes the order of the parser tables
+            cache->add_string(L"parser-profile");
+            for (vector<wstring>::const_iterator profileFile = profileFiles.begin(); cache.get() && profileFile != profileFiles.end(); ++profileFile) {
+                cache->add_string(*profileFile);
+                if (!cache->add_file(*profileFile)) {
+                    cache.reset();
+                }
+            }
+            
+            for (import_stage::file_iterator inputFile = importStage.begin_file(); cache.get() && inputFile != importStage.end_file(); ++inputFile) {
+                cache->add_string(inputFile->second);
+                if (!cache->add_file(inputFile->first)) {
+                    // Can't cache the output if one of the files can't be read
+                    cache.reset();
+                    break;
+                }
+            }
+            
+            // Use the cached output if it exists
+            if (cache.get() && cache->restore(outputFiles)) {
+                console.verbose_stream() << L"  = Using cached output " << cache->key() << endl;
                 return console.exit_code();
             }
         }
@@ -217,22 +491,39 @@ int main (int argc, const char * argv[])
             return error::sev_error;
         }
         
-        // Generate the lexer for the target language
-        lexer_stage lexerStage(cons, importStage.file_with_language(buildLanguageName), compileLanguageStage);
-        lexerStage.compile();
-
-        // Stop if we have an error
+        // Generate the lexer and the parser states for the target language at the same time. Each stage reports to
+        // its own buffered console, which is replayed in the order that the stages used to run in, so the results
+        // don't depend on how the threads were scheduled.
+        buffered_console*   lexerConsole    = new buffered_console(console);
+        buffered_console*   parserConsole   = new buffered_console(console);
+        console_container   lexerCons(lexerConsole, true);
+        console_container   parserCons(parserConsole, true);
+        
+        lexer_stage lexerStage(lexerCons, importStage.file_with_language(buildLanguageName), compileLanguageStage);
+        lr_parser_stage lrParserStage(parserCons, importStage.file_with_language(buildLanguageName), compileLanguageStage, &lexerStage, startSymbols);
+        lrParserStage.set_prune_grammar(!console.get_option(L"prune-grammar").empty());
+        
+        lexer_and_parser_task task(lexerStage, lrParserStage);
+        util::parallel_for(2, option_threads(console), task);
+        
+        // Report the lexer results, and stop if we have an error (the parser results are discarded in this case)
+        lexerConsole->replay();
         if (console.exit_code()) {
             return console.exit_code();
         }
-
-        // Generate the parser
-        lr_parser_stage lrParserStage(cons, importStage.file_with_language(buildLanguageName), compileLanguageStage, &lexerStage, startSymbols);
-        lrParserStage.compile();
+        
+        // Finish generating the parser
+        parserConsole->replay();
+        if (task.built_states()) {
+            lrParserStage.build_tables();
+        }
         
         // Write the parser out if requested
         if (!console.get_option(L"show-parser").empty() || !console.get_option(L"show-parser-closure").empty()) {
-            wcout << endl << L"== Parser tables:" << endl << formatter::to_string(*lrParserStage.get_parser(), *compileLanguageStage->grammar(), *compileLanguageStage->terminals(), !console.get_option(L"show-parser-closure").empty()) << endl;
+            // The tables can be very large, so they're written directly to the output rather than built up as a string
+            wcout << endl << L"== Parser tables:" << endl;
+            formatter::write(wcout, *lrParserStage.get_parser(), *compileLanguageStage->grammar(), *compileLanguageStage->terminals(), !console.get_option(L"show-parser-closure").empty());
+            wcout << endl;
         }
 
         // Display the propagation tables if requested
@@ -261,10 +552,11 @@ int main (int argc, const char * argv[])
                         // Ignore any items that have no items in them
                         if (spontaneous.empty() && propagate.empty()) continue;
 
-                        wcout   << L"  " 
-                                << formatter::to_string(*state[itemId], *compileLanguageStage->grammar(), *compileLanguageStage->terminals()) 
-                                << L" " << formatter::to_string(state.lookahead_for(itemId), *compileLanguageStage->grammar(), *compileLanguageStage->terminals())
-                                << endl;
+                        wcout << L"  ";
+                        formatter::write(wcout, *state[itemId], *compileLanguageStage->grammar(), *compileLanguageStage->terminals());
+                        wcout << L" ";
+                        formatter::write(wcout, state.lookahead_for(itemId), *compileLanguageStage->grammar(), *compileLanguageStage->terminals());
+                        wcout << endl;
 
                         // Write out which items generate spontaneous lookaheads
                         for (set<lr_item_id>::const_iterator spont = spontaneous.begin(); spont != spontaneous.end(); spont++) {
@@ -292,6 +584,29 @@ int main (int argc, const char * argv[])
             return console.exit_code();
         }
         
+        // Order the parser tables according to the profile, if there is one
+        parser_profile_stage profileStage(cons, importStage.file_with_language(buildLanguageName), &lexerStage, &lrParserStage);
+        profileStage.compile();
+        
+        // Stop if we have an error
+        if (console.exit_code()) {
+            return console.exit_code();
+        }
+        
+        // Summarise the size of the tables if requested
+        if (!console.get_option(L"show-parser-stats").empty()) {
+            output_statistics statistics(cons, importStage.file_with_language(buildLanguageName), &lexerStage, compileLanguageStage, &lrParserStage, wcout);
+            statistics.compile();
+        }
+        
+        // Write a randomly generated sentence instead of the parser if requested
+        if (!console.get_option(L"generate-sentence").empty()) {
+            sentence_stage sentenceStage(cons, importStage.file_with_language(buildLanguageName), compileLanguageStage, &lexerStage, &lrParserStage, startSymbols[0], console.get_option(L"generate-sentence"));
+            sentenceStage.compile();
+            
+            return console.exit_code();
+        }
+        
         // The --test option sets the target language to 'test'
         if (!console.get_option(L"test").empty()) {
             targetLanguage = L"test";
@@ -302,20 +617,15 @@ int main (int argc, const char * argv[])
             targetLanguage = L"cplusplus";
         }
         
-        // Work out the prefix filename
-        wstring prefixFilename = console.get_option(L"output-file");
-        if (prefixFilename.empty()) {
-            // Derive from the input file
-            // This works provided the target language 
-            prefixFilename = console.input_file();
-        }
-        
         // Create the output stage         
         auto_ptr<output_stage> outputStage(NULL);
         
         if (targetLanguage == L"cplusplus") {
             // Use the C++ language generator
             outputStage = auto_ptr<output_stage>(new output_cplusplus(cons, importStage.file_with_language(buildLanguageName), &lexerStage, compileLanguageStage, &lrParserStage, prefixFilename, buildClassName, buildNamespaceName));
+        } else if (targetLanguage == L"c") {
+            // Use the C language generator
+            outputStage = auto_ptr<output_stage>(new output_c(cons, importStage.file_with_language(buildLanguageName), &lexerStage, compileLanguageStage, &lrParserStage, prefixFilename, buildClassName));
         } else if (targetLanguage == L"test") {
             // Special case: read from stdin, and try to parse the source language
             ast_parser parser(*lrParserStage.get_tables());
@@ -359,7 +669,7 @@ int main (int argc, const char * argv[])
                 trace_parser::stack stack = stdInParser->get_stack();
                 console.verbose_stream() << endl << L"Stack:" << endl;
                 do {
-                    console.verbose_stream() << formatter::to_string(*stack->item, *compileLanguageStage->grammar(), *compileLanguageStage->terminals()) << endl;
+                    console.verbose_stream() << formatter::to_string(*stack.item(), *compileLanguageStage->grammar(), *compileLanguageStage->terminals()) << endl;
                 } while (stack.pop());
             }
         } else {
@@ -373,6 +683,14 @@ int main (int argc, const char * argv[])
         // Compile the final output
         if (outputStage.get()) {
             outputStage->compile();
+            
+            // Finish with the output stage so that the files are completely written
+            outputStage.reset();
+            
+            // Store the result in the cache if it was generated successfully
+            if (cache.get() && !console.exit_code()) {
+                cache->store(outputFiles);
+            }
         }
         
         // Done
@@ -382,3 +700,75 @@ int main (int argc, const char * argv[])
         throw;
     }
 }
+
+/// \brief Runs the compiler with the options in the specified console, and returns the exit code
+static int run_console(boost_console& console)
+{
+    console_container cons(&console, false);
+    
+    // Run the compiler
+    int exitCode = run_stages(console, cons);
+    
+    // Write out the profile of the stages that ran if it was requested
+    console.write_profile_report();
+    
+    if (!exitCode) exitCode = console.exit_code();
+    return exitCode;
+}
+
+/// \brief Handles a request sent to the compile server
+static int run_request(int argc, const char** argv)
+{
+    boost_console console(argc, argv);
+    return run_console(console);
+}
+
+int main (int argc, const char * argv[])
+{
+    // The replacement operator new counts every allocation
+    allocation_counter::enable();
+    
+    // Create the console
+    boost_console console(argc, argv);
+    
+    // Run as a compile server if requested, keeping the generated output in memory between requests
+    if (!console.get_option(L"server").empty()) {
+        output_cache::memory_store      residentCache;
+        parser_stage::definition_cache  residentDefinitions;
+        s_ResidentCache         = &residentCache;
+        s_ResidentDefinitions   = &residentDefinitions;
+        
+        return run_compile_server(console.convert_filename(console.get_option(L"server")), run_request);
+    }
+    
+    // Pass the request on to a compile server if there is one
+    if (!console.get_option(L"client").empty()) {
+        // Send the arguments without the --client option
+        vector<string> arguments;
+        for (int argNum = 0; argNum < argc; ++argNum) {
+            string argument = argv[argNum];
+            
+            if (argNum > 0 && argument == "--client") {
+                ++argNum;
+                continue;
+            } else if (argument.compare(0, 9, "--client=") == 0) {
+                continue;
+            }
+            
+            arguments.push_back(argument);
+        }
+        
+        int exitCode;
+        if (send_compile_request(console.convert_filename(console.get_option(L"client")), arguments, exitCode)) {
+            return exitCode;
+        }
+        
+        // There's nothing to stop if the server isn't running
+        if (!console.get_option(L"stop-server").empty()) {
+            return 0;
+        }
+    }
+    
+    // Run the compiler in this process
+    return run_console(console);
+}